@@ -29,6 +29,7 @@
 #include <arrow-glib/type.hpp>
 #include <arrow-glib/decimal.hpp>
 
+#include <cmath>
 #include <iostream>
 #include <sstream>
 
@@ -639,6 +640,120 @@ garrow_array_dictionary_encode(GArrowArray *array,
   return garrow_array_new_raw(&arrow_dictionary_encoded_array);
 }
 
+/**
+ * garrow_array_take:
+ * @array: A #GArrowArray.
+ * @indices: The integer positions of the values to be taken.
+ * @error: (nullable): Return location for a #GError or %NULL.
+ *
+ * Returns: (nullable) (transfer full):
+ *   A newly created array of the values of @array at @indices on
+ *   success, %NULL on error. Null indices produce null values.
+ *
+ * Since: 0.10.0
+ */
+GArrowArray *
+garrow_array_take(GArrowArray *array,
+                  GArrowArray *indices,
+                  GError **error)
+{
+  auto arrow_array = garrow_array_get_raw(array);
+  auto arrow_indices = garrow_array_get_raw(indices);
+  auto memory_pool = arrow::default_memory_pool();
+  arrow::compute::FunctionContext context(memory_pool);
+  std::shared_ptr<arrow::Array> arrow_taken_array;
+  auto status = arrow::compute::Take(&context,
+                                     *arrow_array,
+                                     *arrow_indices,
+                                     &arrow_taken_array);
+  if (!status.ok()) {
+    std::stringstream message;
+    message << "[array][take] <";
+    message << arrow_array->type()->ToString();
+    message << "> <";
+    message << arrow_indices->type()->ToString();
+    message << ">";
+    garrow_error_check(error, status, message.str().c_str());
+    return NULL;
+  }
+
+  return garrow_array_new_raw(&arrow_taken_array);
+}
+
+/**
+ * garrow_array_filter:
+ * @array: A #GArrowArray.
+ * @mask: A #GArrowBooleanArray of the same length as @array.
+ * @error: (nullable): Return location for a #GError or %NULL.
+ *
+ * Returns: (nullable) (transfer full):
+ *   A newly created array of the values of @array where @mask is
+ *   %TRUE on success, %NULL on error. Null mask values drop the value.
+ *
+ * Since: 0.10.0
+ */
+GArrowArray *
+garrow_array_filter(GArrowArray *array,
+                    GArrowBooleanArray *mask,
+                    GError **error)
+{
+  auto arrow_array = garrow_array_get_raw(array);
+  auto arrow_mask = garrow_array_get_raw(GARROW_ARRAY(mask));
+  auto memory_pool = arrow::default_memory_pool();
+  arrow::compute::FunctionContext context(memory_pool);
+  std::shared_ptr<arrow::Array> arrow_filtered_array;
+  auto status = arrow::compute::Filter(&context,
+                                       *arrow_array,
+                                       *arrow_mask,
+                                       arrow::compute::FilterOptions(),
+                                       &arrow_filtered_array);
+  if (!status.ok()) {
+    std::stringstream message;
+    message << "[array][filter] <";
+    message << arrow_array->type()->ToString();
+    message << ">";
+    garrow_error_check(error, status, message.str().c_str());
+    return NULL;
+  }
+
+  return garrow_array_new_raw(&arrow_filtered_array);
+}
+
+/**
+ * garrow_array_sort_indices:
+ * @array: A #GArrowArray.
+ * @error: (nullable): Return location for a #GError or %NULL.
+ *
+ * Returns: (nullable) (transfer full):
+ *   A newly created array of the positions of the values of @array in
+ *   ascending order, which can be passed to garrow_array_take(), on
+ *   success, %NULL on error.
+ *
+ * Since: 0.10.0
+ */
+GArrowArray *
+garrow_array_sort_indices(GArrowArray *array,
+                          GError **error)
+{
+  auto arrow_array = garrow_array_get_raw(array);
+  auto memory_pool = arrow::default_memory_pool();
+  arrow::compute::FunctionContext context(memory_pool);
+  std::shared_ptr<arrow::Array> arrow_indices;
+  auto status = arrow::compute::SortIndices(&context,
+                                            *arrow_array,
+                                            &arrow_indices);
+  if (!status.ok()) {
+    std::stringstream message;
+    message << "[array][sort-indices] <";
+    message << arrow_array->type()->ToString();
+    message << ">";
+    garrow_error_check(error, status, message.str().c_str());
+    return NULL;
+  }
+
+  return garrow_array_new_raw(&arrow_indices);
+}
+
 
 G_DEFINE_TYPE(GArrowNullArray,               \
               garrow_null_array,             \
@@ -797,6 +912,96 @@ garrow_numeric_array_class_init(GArrowNumericArrayClass *klass)
 {
 }
 
+template <typename ArrowType>
+static gdouble
+garrow_numeric_scalar_get_value(const arrow::compute::Scalar &arrow_scalar)
+{
+  using ScalarType = arrow::compute::NumericScalar<ArrowType>;
+  return static_cast<const ScalarType &>(arrow_scalar).value;
+}
+
+static std::shared_ptr<arrow::compute::Scalar>
+garrow_numeric_array_aggregate(GArrowNumericArray *array,
+                               arrow::Status (*aggregate)(
+                                 arrow::compute::FunctionContext *context,
+                                 const arrow::compute::Datum &value,
+                                 arrow::compute::Datum *out),
+                               const char *context_name,
+                               GError **error)
+{
+  auto arrow_array = garrow_array_get_raw(GARROW_ARRAY(array));
+  auto memory_pool = arrow::default_memory_pool();
+  arrow::compute::FunctionContext context(memory_pool);
+  arrow::compute::Datum arrow_result;
+  auto status = aggregate(&context,
+                          arrow::compute::Datum(arrow_array),
+                          &arrow_result);
+  if (!status.ok()) {
+    std::stringstream message;
+    message << "[numeric-array][" << context_name << "] <";
+    message << arrow_array->type()->ToString();
+    message << ">";
+    garrow_error_check(error, status, message.str().c_str());
+    return nullptr;
+  }
+  return arrow_result.scalar();
+}
+
+/**
+ * garrow_numeric_array_sum:
+ * @array: A #GArrowNumericArray.
+ * @error: (nullable): Return location for a #GError or %NULL.
+ *
+ * Returns: The sum of the non-null values of @array, 0 if there are
+ *   none or on error. Integers are summed in 64 bits.
+ *
+ * Since: 0.10.0
+ */
+gdouble
+garrow_numeric_array_sum(GArrowNumericArray *array,
+                         GError **error)
+{
+  auto arrow_scalar = garrow_numeric_array_aggregate(array,
+                                                     arrow::compute::Sum,
+                                                     "sum",
+                                                     error);
+  if (!arrow_scalar || !arrow_scalar->is_valid) {
+    return 0.0;
+  }
+  switch (arrow_scalar->type->id()) {
+  case arrow::Type::INT64:
+    return garrow_numeric_scalar_get_value<arrow::Int64Type>(*arrow_scalar);
+  case arrow::Type::UINT64:
+    return garrow_numeric_scalar_get_value<arrow::UInt64Type>(*arrow_scalar);
+  default:
+    return garrow_numeric_scalar_get_value<arrow::DoubleType>(*arrow_scalar);
+  }
+}
+
+/**
+ * garrow_numeric_array_mean:
+ * @array: A #GArrowNumericArray.
+ * @error: (nullable): Return location for a #GError or %NULL.
+ *
+ * Returns: The arithmetic mean of the non-null values of @array, NaN
+ *   if there are none or on error.
+ *
+ * Since: 0.10.0
+ */
+gdouble
+garrow_numeric_array_mean(GArrowNumericArray *array,
+                          GError **error)
+{
+  auto arrow_scalar = garrow_numeric_array_aggregate(array,
+                                                     arrow::compute::Mean,
+                                                     "mean",
+                                                     error);
+  if (!arrow_scalar || !arrow_scalar->is_valid) {
+    return NAN;
+  }
+  return garrow_numeric_scalar_get_value<arrow::DoubleType>(*arrow_scalar);
+}
+
 
 G_DEFINE_TYPE(GArrowInt8Array,               \
               garrow_int8_array,             \
@@ -19,6 +19,8 @@
 
 #pragma once
 
+#include <arrow-glib/version.h>
+
 #include <arrow-glib/buffer.h>
 #include <arrow-glib/compute.h>
 #include <arrow-glib/basic-data-type.h>
@@ -70,6 +72,13 @@ GArrowArray   *garrow_array_unique      (GArrowArray *array,
                                          GError **error);
 GArrowArray   *garrow_array_dictionary_encode(GArrowArray *array,
                                               GError **error);
+GARROW_AVAILABLE_IN_0_10
+GArrowArray   *garrow_array_take        (GArrowArray *array,
+                                         GArrowArray *indices,
+                                         GError **error);
+GARROW_AVAILABLE_IN_0_10
+GArrowArray   *garrow_array_sort_indices(GArrowArray *array,
+                                         GError **error);
 
 #define GARROW_TYPE_NULL_ARRAY                  \
   (garrow_null_array_get_type())
@@ -182,6 +191,11 @@ gboolean       garrow_boolean_array_get_value (GArrowBooleanArray *array,
 gboolean      *garrow_boolean_array_get_values(GArrowBooleanArray *array,
                                                gint64 *length);
 
+GARROW_AVAILABLE_IN_0_10
+GArrowArray   *garrow_array_filter      (GArrowArray *array,
+                                         GArrowBooleanArray *mask,
+                                         GError **error);
+
 #define GARROW_TYPE_NUMERIC_ARRAY (garrow_numeric_array_get_type())
 G_DECLARE_DERIVABLE_TYPE(GArrowNumericArray,
                          garrow_numeric_array,
@@ -193,6 +207,13 @@ struct _GArrowNumericArrayClass
   GArrowPrimitiveArrayClass parent_class;
 };
 
+GARROW_AVAILABLE_IN_0_10
+gdouble garrow_numeric_array_sum(GArrowNumericArray *array,
+                                 GError **error);
+GARROW_AVAILABLE_IN_0_10
+gdouble garrow_numeric_array_mean(GArrowNumericArray *array,
+                                  GError **error);
+
 #define GARROW_TYPE_INT8_ARRAY (garrow_int8_array_get_type())
 G_DECLARE_DERIVABLE_TYPE(GArrowInt8Array,
                          garrow_int8_array,
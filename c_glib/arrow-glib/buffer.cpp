@@ -58,6 +58,24 @@ G_DEFINE_TYPE_WITH_PRIVATE(GArrowBuffer, garrow_buffer, G_TYPE_OBJECT)
 #define GARROW_BUFFER_GET_PRIVATE(obj) \
   (G_TYPE_INSTANCE_GET_PRIVATE((obj), GARROW_TYPE_BUFFER, GArrowBufferPrivate))
 
+static void
+garrow_buffer_bytes_free(gpointer user_data)
+{
+  auto arrow_buffer = static_cast<std::shared_ptr<arrow::Buffer> *>(user_data);
+  delete arrow_buffer;
+}
+
+/* The returned GBytes shares the data of the buffer and keeps it alive,
+ * so it stays valid after the GArrowBuffer is freed. */
+static GBytes *
+garrow_buffer_new_bytes_raw(const std::shared_ptr<arrow::Buffer> &arrow_buffer)
+{
+  return g_bytes_new_with_free_func(arrow_buffer->data(),
+                                    arrow_buffer->size(),
+                                    garrow_buffer_bytes_free,
+                                    new std::shared_ptr<arrow::Buffer>(arrow_buffer));
+}
+
 static void
 garrow_buffer_dispose(GObject *object)
 {
@@ -265,8 +283,9 @@ garrow_buffer_get_capacity(GArrowBuffer *buffer)
  * garrow_buffer_get_data:
  * @buffer: A #GArrowBuffer.
  *
- * Returns: (transfer full): The data of the buffer. The data is owned by
- *   the buffer. You should not free or modify the data.
+ * Returns: (transfer full): The data of the buffer. The data is shared
+ *   with the buffer without copying and stays valid while the returned
+ *   #GBytes is alive. You should not modify the data.
  *
  * Since: 0.3.0
  */
@@ -280,9 +299,7 @@ garrow_buffer_get_data(GArrowBuffer *buffer)
   }
 
   auto arrow_buffer = garrow_buffer_get_raw(buffer);
-  auto data = g_bytes_new_static(arrow_buffer->data(),
-                                 arrow_buffer->size());
-  return data;
+  return garrow_buffer_new_bytes_raw(arrow_buffer);
 }
 
 /**
@@ -290,8 +307,9 @@ garrow_buffer_get_data(GArrowBuffer *buffer)
  * @buffer: A #GArrowBuffer.
  *
  * Returns: (transfer full) (nullable): The data of the buffer. If the
- *   buffer is imutable, it returns %NULL. The data is owned by the
- *   buffer. You should not free the data.
+ *   buffer is imutable, it returns %NULL. The data is shared with the
+ *   buffer without copying and stays valid while the returned #GBytes
+ *   is alive.
  *
  * Since: 0.3.0
  */
@@ -309,8 +327,7 @@ garrow_buffer_get_mutable_data(GArrowBuffer *buffer)
     return priv->data;
   }
 
-  return g_bytes_new_static(arrow_buffer->mutable_data(),
-                            arrow_buffer->size());
+  return garrow_buffer_new_bytes_raw(arrow_buffer);
 }
 
 /**
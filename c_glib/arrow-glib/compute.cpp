@@ -22,6 +22,9 @@
 #endif
 
 #include <arrow-glib/compute.hpp>
+#include <arrow-glib/error.hpp>
+
+#include <arrow/util/thread-pool.h>
 
 G_BEGIN_DECLS
 
@@ -32,6 +35,9 @@ G_BEGIN_DECLS
  * @include: arrow-glib/arrow-glib.h
  *
  * #GArrowCastOptions is a class to custom garrow_array_cast().
+ *
+ * garrow_set_cpu_thread_pool_capacity() controls how many threads
+ * computations that run in parallel use.
  */
 
 typedef struct GArrowCastOptionsPrivate_ {
@@ -153,6 +159,40 @@ garrow_cast_options_new(void)
   return GARROW_CAST_OPTIONS(cast_options);
 }
 
+/**
+ * garrow_get_cpu_thread_pool_capacity:
+ *
+ * Returns: The number of threads of the thread pool that parallel
+ *   computations run in.
+ *
+ * Since: 0.10.0
+ */
+gint
+garrow_get_cpu_thread_pool_capacity(void)
+{
+  return arrow::GetCpuThreadPoolCapacity();
+}
+
+/**
+ * garrow_set_cpu_thread_pool_capacity:
+ * @n_threads: The number of threads of the thread pool. It must be
+ *   positive.
+ * @error: (nullable): Return location for a #GError or %NULL.
+ *
+ * Resizes the thread pool that parallel computations run in.
+ *
+ * Returns: %TRUE on success, %FALSE if there was an error.
+ *
+ * Since: 0.10.0
+ */
+gboolean
+garrow_set_cpu_thread_pool_capacity(gint n_threads,
+                                    GError **error)
+{
+  auto status = arrow::SetCpuThreadPoolCapacity(n_threads);
+  return garrow_error_check(error, status, "[cpu-thread-pool][set-capacity]");
+}
+
 G_END_DECLS
 
 GArrowCastOptions *
@@ -20,6 +20,7 @@
 #pragma once
 
 #include <arrow-glib/gobject-type.h>
+#include <arrow-glib/version.h>
 
 G_BEGIN_DECLS
 
@@ -36,4 +37,10 @@ struct _GArrowCastOptionsClass
 
 GArrowCastOptions *garrow_cast_options_new(void);
 
+GARROW_AVAILABLE_IN_0_10
+gint garrow_get_cpu_thread_pool_capacity(void);
+GARROW_AVAILABLE_IN_0_10
+gboolean garrow_set_cpu_thread_pool_capacity(gint n_threads,
+                                             GError **error);
+
 G_END_DECLS
@@ -229,6 +229,76 @@ garrow_record_batch_reader_read_next(GArrowRecordBatchReader *reader,
   }
 }
 
+static void
+garrow_record_batch_reader_read_next_thread(GTask *task,
+                                            gpointer source_object,
+                                            gpointer task_data,
+                                            GCancellable *cancellable)
+{
+  auto reader = GARROW_RECORD_BATCH_READER(source_object);
+  GError *error = NULL;
+  auto record_batch = garrow_record_batch_reader_read_next(reader, &error);
+  if (error) {
+    g_task_return_error(task, error);
+  } else {
+    g_task_return_pointer(task, record_batch, g_object_unref);
+  }
+}
+
+/**
+ * garrow_record_batch_reader_read_next_async:
+ * @reader: A #GArrowRecordBatchReader.
+ * @cancellable: (nullable): A #GCancellable or %NULL.
+ * @callback: (scope async): A #GAsyncReadyCallback to call when the
+ *   record batch is read.
+ * @user_data: (closure): Data to pass to the callback function.
+ *
+ * Reads the next record batch in a worker thread so that the main
+ * loop isn't blocked while the input is read. Call
+ * garrow_record_batch_reader_read_next_finish() in @callback to get
+ * the result.
+ *
+ * You must not read from @reader again until the read finishes.
+ *
+ * Since: 0.10.0
+ */
+void
+garrow_record_batch_reader_read_next_async(GArrowRecordBatchReader *reader,
+                                           GCancellable *cancellable,
+                                           GAsyncReadyCallback callback,
+                                           gpointer user_data)
+{
+  auto task = g_task_new(reader, cancellable, callback, user_data);
+  g_task_set_source_tag(task,
+                        reinterpret_cast<gpointer>(
+                          garrow_record_batch_reader_read_next_async));
+  g_task_run_in_thread(task, garrow_record_batch_reader_read_next_thread);
+  g_object_unref(task);
+}
+
+/**
+ * garrow_record_batch_reader_read_next_finish:
+ * @reader: A #GArrowRecordBatchReader.
+ * @result: The #GAsyncResult passed to the callback of
+ *   garrow_record_batch_reader_read_next_async().
+ * @error: (nullable): Return location for a #GError or %NULL.
+ *
+ * Returns: (nullable) (transfer full):
+ *   The next record batch in the stream or %NULL on end of stream or
+ *   error.
+ *
+ * Since: 0.10.0
+ */
+GArrowRecordBatch *
+garrow_record_batch_reader_read_next_finish(GArrowRecordBatchReader *reader,
+                                            GAsyncResult *result,
+                                            GError **error)
+{
+  g_return_val_if_fail(g_task_is_valid(result, reader), NULL);
+  return static_cast<GArrowRecordBatch *>(
+    g_task_propagate_pointer(G_TASK(result), error));
+}
+
 
 G_DEFINE_TYPE(GArrowTableBatchReader,
               garrow_table_batch_reader,
@@ -19,6 +19,8 @@
 
 #pragma once
 
+#include <arrow-glib/version.h>
+
 #include <arrow-glib/gobject-type.h>
 #include <arrow-glib/record-batch.h>
 #include <arrow-glib/schema.h>
@@ -58,6 +60,17 @@ GArrowRecordBatch *garrow_record_batch_reader_read_next_record_batch(
 GArrowRecordBatch *garrow_record_batch_reader_read_next(
   GArrowRecordBatchReader *reader,
   GError **error);
+GARROW_AVAILABLE_IN_0_10
+void garrow_record_batch_reader_read_next_async(
+  GArrowRecordBatchReader *reader,
+  GCancellable *cancellable,
+  GAsyncReadyCallback callback,
+  gpointer user_data);
+GARROW_AVAILABLE_IN_0_10
+GArrowRecordBatch *garrow_record_batch_reader_read_next_finish(
+  GArrowRecordBatchReader *reader,
+  GAsyncResult *result,
+  GError **error);
 
 
 #define GARROW_TYPE_TABLE_BATCH_READER (garrow_table_batch_reader_get_type())
@@ -60,6 +60,12 @@ class TestBuffer < Test::Unit::TestCase
     assert_equal(@data, @buffer.data.to_s)
   end
 
+  def test_data_outlive_buffer
+    data = Arrow::Buffer.new(@data).copy(0, @data.bytesize).data
+    GC.start
+    assert_equal(@data, data.to_s)
+  end
+
   def test_mutable_data
     require_gi_bindings(3, 1, 2)
     assert_nil(@buffer.mutable_data)
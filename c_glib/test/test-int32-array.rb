@@ -50,4 +50,12 @@ class TestInt32Array < Test::Unit::TestCase
     array = builder.finish
     assert_equal([-1, 2, -4], array.values)
   end
+
+  def test_sum
+    assert_equal(2.0, build_int32_array([-1, nil, 3]).sum)
+  end
+
+  def test_mean
+    assert_equal(1.0, build_int32_array([-1, nil, 3]).mean)
+  end
 end
@@ -33,6 +33,29 @@ class TestTableBatchReader < Test::Unit::TestCase
     assert_nil(reader.read_next)
   end
 
+  def test_read_next_async
+    array = build_boolean_array([true])
+    table = build_table("visible" => array)
+    reader = Arrow::TableBatchReader.new(table)
+    record_batches = []
+    loop = GLib::MainLoop.new
+    read_next = lambda do
+      reader.read_next_async(nil) do |_, result|
+        record_batch = reader.read_next_finish(result)
+        if record_batch
+          record_batches << record_batch
+          read_next.call
+        else
+          loop.quit
+        end
+      end
+    end
+    read_next.call
+    loop.run
+    assert_equal([build_record_batch("visible" => array)],
+                 record_batches)
+  end
+
   def test_schema
     array = build_boolean_array([])
     table = build_table("visible" => array)
@@ -20,9 +20,17 @@
 include(CheckCXXCompilerFlag)
 # x86/amd64 compiler flags
 CHECK_CXX_COMPILER_FLAG("-msse3" CXX_SUPPORTS_SSE3)
+# AVX2 is only enabled for the sources with runtime dispatch
+CHECK_CXX_COMPILER_FLAG("-mavx2" CXX_SUPPORTS_AVX2)
 # power compiler flags
 CHECK_CXX_COMPILER_FLAG("-maltivec" CXX_SUPPORTS_ALTIVEC)
 
+# The SSE4.2 instructions, such as those of CRC32C checksums, are only used
+# once the CPU is checked to support them
+if (ARROW_USE_SSE)
+  add_definitions(-DARROW_USE_SSE)
+endif()
+
 # compiler flags that are common across debug/release builds
 
 if (MSVC)
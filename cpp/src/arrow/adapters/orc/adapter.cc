@@ -18,9 +18,11 @@
 #include "arrow/adapters/orc/adapter.h"
 
 #include <algorithm>
+#include <cmath>
 #include <cstdint>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <utility>
@@ -39,8 +41,8 @@
 #include "arrow/util/bit-util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/decimal.h"
-#include "arrow/util/lazy.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/parallel.h"
 #include "arrow/util/visibility.h"
 
 #include "orc/Exceptions.hh"
@@ -218,9 +220,176 @@ constexpr int64_t kReadRowsBatch = 1000;
 // The numer of nanoseconds in a second
 constexpr int64_t kOneSecondNanos = 1000000000LL;
 
+// The number of nanoseconds in a day
+constexpr int64_t kOneDayNanos = 86400 * kOneSecondNanos;
+
+// ----------------------------------------------------------------------
+// Stripe statistics and predicates
+
+template <class stats_type>
+const stats_type* CastStatistics(const liborc::ColumnStatistics* stats) {
+  return dynamic_cast<const stats_type*>(stats);
+}
+
+void GetColumnStatistics(const liborc::Type& type, const liborc::ColumnStatistics* stats,
+                         ORCColumnStatistics* out) {
+  *out = ORCColumnStatistics();
+  if (stats == nullptr) {
+    return;
+  }
+  out->num_values = static_cast<int64_t>(stats->getNumberOfValues());
+  out->has_null = stats->hasNull();
+
+  switch (type.getKind()) {
+    case liborc::BYTE:
+    case liborc::SHORT:
+    case liborc::INT:
+    case liborc::LONG: {
+      auto int_stats = CastStatistics<liborc::IntegerColumnStatistics>(stats);
+      out->kind = ORCColumnStatistics::INTEGER;
+      if (int_stats != nullptr && int_stats->hasMinimum() && int_stats->hasMaximum()) {
+        out->has_bounds = true;
+        out->int_min = int_stats->getMinimum();
+        out->int_max = int_stats->getMaximum();
+      }
+      break;
+    }
+    case liborc::DATE: {
+      auto date_stats = CastStatistics<liborc::DateColumnStatistics>(stats);
+      out->kind = ORCColumnStatistics::INTEGER;
+      if (date_stats != nullptr && date_stats->hasMinimum() &&
+          date_stats->hasMaximum()) {
+        out->has_bounds = true;
+        out->int_min = date_stats->getMinimum();
+        out->int_max = date_stats->getMaximum();
+      }
+      break;
+    }
+    case liborc::TIMESTAMP: {
+      auto timestamp_stats = CastStatistics<liborc::TimestampColumnStatistics>(stats);
+      out->kind = ORCColumnStatistics::INTEGER;
+      if (timestamp_stats != nullptr && timestamp_stats->hasMinimum() &&
+          timestamp_stats->hasMaximum()) {
+        out->has_bounds = true;
+        out->int_min = timestamp_stats->getMinimum() * 1000000LL - kOneDayNanos;
+        out->int_max = timestamp_stats->getMaximum() * 1000000LL + kOneDayNanos;
+      }
+      break;
+    }
+    case liborc::BOOLEAN: {
+      auto bool_stats = CastStatistics<liborc::BooleanColumnStatistics>(stats);
+      out->kind = ORCColumnStatistics::INTEGER;
+      if (bool_stats != nullptr && bool_stats->hasCount() && out->num_values > 0) {
+        out->has_bounds = true;
+        out->int_min = bool_stats->getFalseCount() > 0 ? 0 : 1;
+        out->int_max = bool_stats->getTrueCount() > 0 ? 1 : 0;
+      }
+      break;
+    }
+    case liborc::FLOAT:
+    case liborc::DOUBLE: {
+      auto double_stats = CastStatistics<liborc::DoubleColumnStatistics>(stats);
+      out->kind = ORCColumnStatistics::DOUBLE;
+      if (double_stats != nullptr && double_stats->hasMinimum() &&
+          double_stats->hasMaximum()) {
+        out->has_bounds = true;
+        out->double_min = double_stats->getMinimum();
+        out->double_max = double_stats->getMaximum();
+      }
+      break;
+    }
+    case liborc::STRING:
+    case liborc::VARCHAR:
+    case liborc::CHAR: {
+      auto string_stats = CastStatistics<liborc::StringColumnStatistics>(stats);
+      out->kind = ORCColumnStatistics::STRING;
+      if (string_stats != nullptr && string_stats->hasMinimum() &&
+          string_stats->hasMaximum()) {
+        out->has_bounds = true;
+        out->string_min = string_stats->getMinimum();
+        out->string_max = string_stats->getMaximum();
+      }
+      break;
+    }
+    default:
+      break;
+  }
+}
+
+// Whether some value in [min, max] may compare true with value
+template <typename T>
+bool BoundsMayMatch(ORCPredicate::Op op, const T& min, const T& max, const T& value) {
+  switch (op) {
+    case ORCPredicate::EQUAL:
+      return !(value < min) && !(max < value);
+    case ORCPredicate::NOT_EQUAL:
+      return !(min == value && max == value);
+    case ORCPredicate::LESS:
+      return min < value;
+    case ORCPredicate::LESS_EQUAL:
+      return !(value < min);
+    case ORCPredicate::GREATER:
+      return value < max;
+    case ORCPredicate::GREATER_EQUAL:
+      return !(max < value);
+  }
+  return true;
+}
+
+ORCPredicate::ORCPredicate(int field_index, Op op, int32_t value)
+    : ORCPredicate(field_index, op, static_cast<int64_t>(value)) {}
+
+ORCPredicate::ORCPredicate(int field_index, Op op, int64_t value)
+    : field_index(field_index),
+      op(op),
+      kind(ORCColumnStatistics::INTEGER),
+      int_value(value),
+      double_value(0) {}
+
+ORCPredicate::ORCPredicate(int field_index, Op op, double value)
+    : field_index(field_index),
+      op(op),
+      kind(ORCColumnStatistics::DOUBLE),
+      int_value(0),
+      double_value(value) {}
+
+ORCPredicate::ORCPredicate(int field_index, Op op, const std::string& value)
+    : field_index(field_index),
+      op(op),
+      kind(ORCColumnStatistics::STRING),
+      int_value(0),
+      double_value(0),
+      string_value(value) {}
+
+bool ORCPredicate::MayMatch(const ORCColumnStatistics& statistics) const {
+  if (statistics.num_values == 0) {
+    // All of the values are null, comparisons with them are null too
+    return false;
+  }
+  if (statistics.kind != kind || !statistics.has_bounds) {
+    return true;
+  }
+  switch (kind) {
+    case ORCColumnStatistics::INTEGER:
+      return BoundsMayMatch(op, statistics.int_min, statistics.int_max, int_value);
+    case ORCColumnStatistics::DOUBLE:
+      if (std::isnan(statistics.double_min) || std::isnan(statistics.double_max) ||
+          std::isnan(double_value)) {
+        return true;
+      }
+      return BoundsMayMatch(op, statistics.double_min, statistics.double_max,
+                            double_value);
+    case ORCColumnStatistics::STRING:
+      return BoundsMayMatch(op, statistics.string_min, statistics.string_max,
+                            string_value);
+    default:
+      return true;
+  }
+}
+
 class ORCFileReader::Impl {
  public:
-  Impl() {}
+  Impl() : use_threads_(false) {}
   ~Impl() {}
 
   Status Open(const std::shared_ptr<io::ReadableFileInterface>& file, MemoryPool* pool) {
@@ -232,12 +401,27 @@ class ORCFileReader::Impl {
     } catch (const liborc::ParseError& e) {
       return Status::IOError(e.what());
     }
+    file_ = file;
     pool_ = pool;
     reader_ = std::move(liborc_reader);
 
     return Init();
   }
 
+  // Open another reader on the same file, for reading stripes in parallel.
+  // The file tail of the first reader is reused, so only the stripes are read
+  Status OpenStripeReader(std::unique_ptr<liborc::Reader>* out) {
+    std::unique_ptr<ArrowInputFile> io_wrapper(new ArrowInputFile(file_));
+    liborc::ReaderOptions options;
+    options.setSerializedFileTail(reader_->getSerializedFileTail());
+    try {
+      *out = createReader(std::move(io_wrapper), options);
+    } catch (const liborc::ParseError& e) {
+      return Status::IOError(e.what());
+    }
+    return Status::OK();
+  }
+
   Status Init() {
     int64_t nstripes = reader_->getNumberOfStripes();
     stripes_.resize(nstripes);
@@ -250,6 +434,8 @@ class ORCFileReader::Impl {
     return Status::OK();
   }
 
+  void set_use_threads(bool use_threads) { use_threads_ = use_threads; }
+
   int64_t NumberOfStripes() { return stripes_.size(); }
 
   int64_t NumberOfRows() { return reader_->getNumberOfRows(); }
@@ -288,13 +474,99 @@ class ORCFileReader::Impl {
 
   Status Read(std::shared_ptr<Table>* out) {
     liborc::RowReaderOptions opts;
-    return ReadTable(opts, out);
+    return ReadTable(opts, AllStripes(), out);
   }
 
   Status Read(const std::vector<int>& include_indices, std::shared_ptr<Table>* out) {
     liborc::RowReaderOptions opts;
     RETURN_NOT_OK(SelectIndices(&opts, include_indices));
-    return ReadTable(opts, out);
+    return ReadTable(opts, AllStripes(), out);
+  }
+
+  Status ReadMatchingStripes(const std::vector<ORCPredicate>& predicates,
+                             const std::vector<int>& include_indices,
+                             std::shared_ptr<Table>* out) {
+    liborc::RowReaderOptions opts;
+    if (!include_indices.empty()) {
+      RETURN_NOT_OK(SelectIndices(&opts, include_indices));
+    }
+    std::vector<int64_t> stripes;
+    RETURN_NOT_OK(SelectStripes(predicates, &stripes));
+    return ReadTable(opts, stripes, out);
+  }
+
+  Status SelectStripes(const std::vector<ORCPredicate>& predicates,
+                       std::vector<int64_t>* out) {
+    const int64_t num_fields = reader_->getType().getSubtypeCount();
+    for (const ORCPredicate& predicate : predicates) {
+      if (predicate.field_index < 0 || predicate.field_index >= num_fields) {
+        std::stringstream ss;
+        ss << "Out of bounds field index in predicate: " << predicate.field_index;
+        return Status::Invalid(ss.str());
+      }
+    }
+    // Files written without stripe statistics have none to skip stripes with
+    const int64_t num_statistics =
+        static_cast<int64_t>(reader_->getNumberOfStripeStatistics());
+
+    out->clear();
+    std::vector<ORCColumnStatistics> statistics;
+    for (int64_t stripe = 0; stripe < NumberOfStripes(); ++stripe) {
+      bool may_match = true;
+      if (stripe < num_statistics && !predicates.empty()) {
+        RETURN_NOT_OK(ReadStripeStatistics(stripe, &statistics));
+        for (const ORCPredicate& predicate : predicates) {
+          if (!predicate.MayMatch(statistics[predicate.field_index])) {
+            may_match = false;
+            break;
+          }
+        }
+      }
+      if (may_match) {
+        out->push_back(stripe);
+      }
+    }
+    return Status::OK();
+  }
+
+  Status ReadStripeStatistics(int64_t stripe, std::vector<ORCColumnStatistics>* out) {
+    if (stripe < 0 || stripe >= NumberOfStripes()) {
+      std::stringstream ss;
+      ss << "Out of bounds stripe: " << stripe;
+      return Status::Invalid(ss.str());
+    }
+    const liborc::Type& type = reader_->getType();
+    if (type.getKind() != liborc::STRUCT) {
+      return Status::NotImplemented(
+          "Only ORC files with a top-level struct "
+          "can be handled");
+    }
+    std::unique_ptr<liborc::StripeStatistics> stripe_stats;
+    try {
+      stripe_stats = reader_->getStripeStatistics(stripe);
+    } catch (const std::exception& e) {
+      return Status::IOError(e.what());
+    }
+    const int num_fields = static_cast<int>(type.getSubtypeCount());
+    out->resize(num_fields);
+    for (int i = 0; i < num_fields; ++i) {
+      const liborc::Type* field_type = type.getSubtype(i);
+      const liborc::ColumnStatistics* stats = nullptr;
+      if (field_type->getColumnId() < stripe_stats->getNumberOfColumns()) {
+        stats = stripe_stats->getColumnStatistics(
+            static_cast<uint32_t>(field_type->getColumnId()));
+      }
+      GetColumnStatistics(*field_type, stats, &(*out)[i]);
+    }
+    return Status::OK();
+  }
+
+  std::vector<int64_t> AllStripes() const {
+    std::vector<int64_t> stripes(stripes_.size());
+    for (size_t i = 0; i < stripes_.size(); ++i) {
+      stripes[i] = static_cast<int64_t>(i);
+    }
+    return stripes;
   }
 
   Status ReadStripe(int64_t stripe, std::shared_ptr<RecordBatch>* out) {
@@ -311,6 +583,30 @@ class ORCFileReader::Impl {
     return ReadBatch(opts, stripes_[stripe].num_rows, out);
   }
 
+  Status GetRecordBatchReader(const liborc::RowReaderOptions& opts, int64_t batch_size,
+                              std::shared_ptr<RecordBatchReader>* out) {
+    if (batch_size <= 0) {
+      return Status::Invalid("Batch size must be positive");
+    }
+    std::unique_ptr<liborc::RowReader> rowreader;
+    std::unique_ptr<liborc::ColumnVectorBatch> batch;
+    try {
+      rowreader = reader_->createRowReader(opts);
+      batch = rowreader->createRowBatch(batch_size);
+    } catch (const liborc::ParseError& e) {
+      return Status::Invalid(e.what());
+    }
+    std::shared_ptr<Schema> schema;
+    RETURN_NOT_OK(GetArrowSchema(rowreader->getSelectedType(), &schema));
+
+    std::unique_ptr<RecordBatchBuilder> builder;
+    RETURN_NOT_OK(RecordBatchBuilder::Make(schema, pool_, batch_size, &builder));
+
+    out->reset(new StreamingReader(this, std::move(rowreader), std::move(batch),
+                                   std::move(builder)));
+    return Status::OK();
+  }
+
   Status SelectStripe(liborc::RowReaderOptions* opts, int64_t stripe) {
     if (stripe < 0 || stripe >= NumberOfStripes()) {
       std::stringstream ss;
@@ -335,22 +631,87 @@ class ORCFileReader::Impl {
   }
 
   Status ReadTable(const liborc::RowReaderOptions& row_opts,
-                   std::shared_ptr<Table>* out) {
-    liborc::RowReaderOptions opts(row_opts);
-    std::vector<std::shared_ptr<RecordBatch>> batches(stripes_.size());
-    for (size_t stripe = 0; stripe < stripes_.size(); stripe++) {
-      opts.range(stripes_[stripe].offset, stripes_[stripe].length);
-      RETURN_NOT_OK(ReadBatch(opts, stripes_[stripe].num_rows, &batches[stripe]));
+                   const std::vector<int64_t>& stripes, std::shared_ptr<Table>* out) {
+    std::vector<std::shared_ptr<RecordBatch>> batches(stripes.size());
+    if (use_threads_ && stripes.size() > 1) {
+      RETURN_NOT_OK(ReadStripesParallel(row_opts, stripes, &batches));
+    } else {
+      liborc::RowReaderOptions opts(row_opts);
+      for (size_t i = 0; i < stripes.size(); i++) {
+        const StripeInformation& stripe = stripes_[stripes[i]];
+        opts.range(stripe.offset, stripe.length);
+        RETURN_NOT_OK(ReadBatch(opts, stripe.num_rows, &batches[i]));
+      }
+    }
+    if (batches.empty()) {
+      std::shared_ptr<Schema> schema;
+      RETURN_NOT_OK(GetSelectedSchema(row_opts, &schema));
+      return Table::FromRecordBatches(schema, batches, out);
     }
     return Table::FromRecordBatches(batches, out);
   }
 
+  // The schema of the fields selected by the options
+  Status GetSelectedSchema(const liborc::RowReaderOptions& opts,
+                           std::shared_ptr<Schema>* out) {
+    std::unique_ptr<liborc::RowReader> rowreader;
+    try {
+      rowreader = reader_->createRowReader(opts);
+    } catch (const liborc::ParseError& e) {
+      return Status::Invalid(e.what());
+    }
+    return GetArrowSchema(rowreader->getSelectedType(), out);
+  }
+
+  // Decode the stripes on the CPU thread pool into their slots of batches. A
+  // liborc::Reader is not thread-safe, so the tasks take their readers from a
+  // free list, which grows to about one reader per thread
+  Status ReadStripesParallel(const liborc::RowReaderOptions& row_opts,
+                             const std::vector<int64_t>& stripes,
+                             std::vector<std::shared_ptr<RecordBatch>>* batches) {
+    std::mutex readers_mutex;
+    std::vector<std::unique_ptr<liborc::Reader>> readers;
+
+    auto ReadStripeTask = [&](int i) -> Status {
+      std::unique_ptr<liborc::Reader> reader;
+      {
+        std::lock_guard<std::mutex> lock(readers_mutex);
+        if (!readers.empty()) {
+          reader = std::move(readers.back());
+          readers.pop_back();
+        }
+      }
+      if (reader == nullptr) {
+        RETURN_NOT_OK(OpenStripeReader(&reader));
+      }
+      const StripeInformation& stripe = stripes_[stripes[i]];
+      liborc::RowReaderOptions opts(row_opts);
+      opts.range(stripe.offset, stripe.length);
+      // Exceptions must not escape the thread pool
+      try {
+        RETURN_NOT_OK(ReadBatch(reader.get(), opts, stripe.num_rows, &(*batches)[i]));
+      } catch (const liborc::ParseError& e) {
+        return Status::IOError(e.what());
+      }
+
+      std::lock_guard<std::mutex> lock(readers_mutex);
+      readers.push_back(std::move(reader));
+      return Status::OK();
+    };
+    return ParallelFor(static_cast<int>(stripes.size()), ReadStripeTask);
+  }
+
   Status ReadBatch(const liborc::RowReaderOptions& opts, int64_t nrows,
                    std::shared_ptr<RecordBatch>* out) {
+    return ReadBatch(reader_.get(), opts, nrows, out);
+  }
+
+  Status ReadBatch(liborc::Reader* reader, const liborc::RowReaderOptions& opts,
+                   int64_t nrows, std::shared_ptr<RecordBatch>* out) {
     std::unique_ptr<liborc::RowReader> rowreader;
     std::unique_ptr<liborc::ColumnVectorBatch> batch;
     try {
-      rowreader = reader_->createRowReader(opts);
+      rowreader = reader->createRowReader(opts);
       batch = rowreader->createRowBatch(std::min(nrows, kReadRowsBatch));
     } catch (const liborc::ParseError& e) {
       return Status::Invalid(e.what());
@@ -527,14 +888,14 @@ class ORCFileReader::Impl {
     if (batch->hasNulls) {
       valid_bytes = reinterpret_cast<const uint8_t*>(batch->notNull.data()) + offset;
     }
+    // Narrow the values in a loop the compiler can vectorize, then append them
+    // in bulk, which also packs the validity bytes a word at a time
     const source_type* source = batch->data.data() + offset;
-    auto cast_iter = internal::MakeLazyRange(
-        [&source](int64_t index) { return static_cast<target_type>(source[index]); },
-        length);
-
-    RETURN_NOT_OK(builder->AppendValues(cast_iter.begin(), cast_iter.end(), valid_bytes));
-
-    return Status::OK();
+    std::vector<target_type> values(static_cast<size_t>(length));
+    for (int64_t i = 0; i < length; ++i) {
+      values[i] = static_cast<target_type>(source[i]);
+    }
+    return builder->AppendValues(values.data(), length, valid_bytes);
   }
 
   Status AppendBoolBatch(liborc::ColumnVectorBatch* cbatch, int64_t offset,
@@ -551,13 +912,11 @@ class ORCFileReader::Impl {
       valid_bytes = reinterpret_cast<const uint8_t*>(batch->notNull.data()) + offset;
     }
     const int64_t* source = batch->data.data() + offset;
-
-    auto cast_iter = internal::MakeLazyRange(
-        [&source](int64_t index) { return static_cast<bool>(source[index]); }, length);
-
-    RETURN_NOT_OK(builder->AppendValues(cast_iter.begin(), cast_iter.end(), valid_bytes));
-
-    return Status::OK();
+    std::vector<uint8_t> values(static_cast<size_t>(length));
+    for (int64_t i = 0; i < length; ++i) {
+      values[i] = source[i] != 0;
+    }
+    return builder->AppendValues(values.data(), length, valid_bytes);
   }
 
   Status AppendTimestampBatch(liborc::ColumnVectorBatch* cbatch, int64_t offset,
@@ -576,16 +935,11 @@ class ORCFileReader::Impl {
 
     const int64_t* seconds = batch->data.data() + offset;
     const int64_t* nanos = batch->nanoseconds.data() + offset;
-
-    auto transform_timestamp = [seconds, nanos](int64_t index) {
-      return seconds[index] * kOneSecondNanos + nanos[index];
-    };
-
-    auto transform_range = internal::MakeLazyRange(transform_timestamp, length);
-
-    RETURN_NOT_OK(builder->AppendValues(transform_range.begin(), transform_range.end(),
-                                        valid_bytes));
-    return Status::OK();
+    std::vector<int64_t> values(static_cast<size_t>(length));
+    for (int64_t i = 0; i < length; ++i) {
+      values[i] = seconds[i] * kOneSecondNanos + nanos[i];
+    }
+    return builder->AppendValues(values.data(), length, valid_bytes);
   }
 
   template <class builder_type>
@@ -650,10 +1004,51 @@ class ORCFileReader::Impl {
     return Status::OK();
   }
 
+  // Reads the rows selected by a row reader into batches, reusing the ORC
+  // column vectors and the builders of the fields
+  class StreamingReader : public RecordBatchReader {
+   public:
+    StreamingReader(Impl* impl, std::unique_ptr<liborc::RowReader> rowreader,
+                    std::unique_ptr<liborc::ColumnVectorBatch> batch,
+                    std::unique_ptr<RecordBatchBuilder> builder)
+        : impl_(impl),
+          rowreader_(std::move(rowreader)),
+          batch_(std::move(batch)),
+          builder_(std::move(builder)) {}
+
+    std::shared_ptr<Schema> schema() const override { return builder_->schema(); }
+
+    Status ReadNext(std::shared_ptr<RecordBatch>* out) override {
+      try {
+        if (!rowreader_->next(*batch_)) {
+          out->reset();
+          return Status::OK();
+        }
+      } catch (const liborc::ParseError& e) {
+        return Status::IOError(e.what());
+      }
+      const liborc::Type& type = rowreader_->getSelectedType();
+      const auto& struct_batch = checked_cast<liborc::StructVectorBatch&>(*batch_);
+      for (int i = 0; i < builder_->num_fields(); i++) {
+        RETURN_NOT_OK(impl_->AppendBatch(type.getSubtype(i), struct_batch.fields[i], 0,
+                                         batch_->numElements, builder_->GetField(i)));
+      }
+      return builder_->Flush(out);
+    }
+
+   private:
+    Impl* impl_;
+    std::unique_ptr<liborc::RowReader> rowreader_;
+    std::unique_ptr<liborc::ColumnVectorBatch> batch_;
+    std::unique_ptr<RecordBatchBuilder> builder_;
+  };
+
  private:
+  std::shared_ptr<io::ReadableFileInterface> file_;
   MemoryPool* pool_;
   std::unique_ptr<liborc::Reader> reader_;
   std::vector<StripeInformation> stripes_;
+  bool use_threads_;
 };
 
 ORCFileReader::ORCFileReader() { impl_.reset(new ORCFileReader::Impl()); }
@@ -688,10 +1083,495 @@ Status ORCFileReader::ReadStripe(int64_t stripe, const std::vector<int>& include
   return impl_->ReadStripe(stripe, include_indices, out);
 }
 
+Status ORCFileReader::ReadMatchingStripes(const std::vector<ORCPredicate>& predicates,
+                                          const std::vector<int>& include_indices,
+                                          std::shared_ptr<Table>* out) {
+  return impl_->ReadMatchingStripes(predicates, include_indices, out);
+}
+
+Status ORCFileReader::SelectStripes(const std::vector<ORCPredicate>& predicates,
+                                    std::vector<int64_t>* out) {
+  return impl_->SelectStripes(predicates, out);
+}
+
+Status ORCFileReader::ReadStripeStatistics(int64_t stripe,
+                                           std::vector<ORCColumnStatistics>* out) {
+  return impl_->ReadStripeStatistics(stripe, out);
+}
+
+Status ORCFileReader::GetRecordBatchReader(int64_t batch_size,
+                                           std::shared_ptr<RecordBatchReader>* out) {
+  liborc::RowReaderOptions opts;
+  return impl_->GetRecordBatchReader(opts, batch_size, out);
+}
+
+Status ORCFileReader::GetRecordBatchReader(int64_t batch_size,
+                                           const std::vector<int>& include_indices,
+                                           std::shared_ptr<RecordBatchReader>* out) {
+  liborc::RowReaderOptions opts;
+  RETURN_NOT_OK(impl_->SelectIndices(&opts, include_indices));
+  return impl_->GetRecordBatchReader(opts, batch_size, out);
+}
+
+void ORCFileReader::set_use_threads(bool use_threads) {
+  impl_->set_use_threads(use_threads);
+}
+
 int64_t ORCFileReader::NumberOfStripes() { return impl_->NumberOfStripes(); }
 
 int64_t ORCFileReader::NumberOfRows() { return impl_->NumberOfRows(); }
 
+// ----------------------------------------------------------------------
+// ORCFileWriter
+
+class ArrowOutputStream : public liborc::OutputStream {
+ public:
+  explicit ArrowOutputStream(const std::shared_ptr<io::OutputStream>& sink)
+      : sink_(sink), length_(0) {}
+
+  uint64_t getLength() const override { return length_; }
+
+  uint64_t getNaturalWriteSize() const override { return 128 * 1024; }
+
+  void write(const void* buf, size_t length) override {
+    ORC_THROW_NOT_OK(sink_->Write(buf, static_cast<int64_t>(length)));
+    length_ += length;
+  }
+
+  const std::string& getName() const override {
+    static const std::string filename("ArrowOutputStream");
+    return filename;
+  }
+
+  // The sink is left open, as by the IPC writers
+  void close() override {}
+
+ private:
+  std::shared_ptr<io::OutputStream> sink_;
+  uint64_t length_;
+};
+
+Status GetORCType(const DataType& type, std::unique_ptr<liborc::Type>* out) {
+  switch (type.id()) {
+    case Type::BOOL:
+      *out = liborc::createPrimitiveType(liborc::BOOLEAN);
+      break;
+    case Type::INT8:
+      *out = liborc::createPrimitiveType(liborc::BYTE);
+      break;
+    case Type::INT16:
+      *out = liborc::createPrimitiveType(liborc::SHORT);
+      break;
+    case Type::INT32:
+      *out = liborc::createPrimitiveType(liborc::INT);
+      break;
+    case Type::INT64:
+      *out = liborc::createPrimitiveType(liborc::LONG);
+      break;
+    case Type::FLOAT:
+      *out = liborc::createPrimitiveType(liborc::FLOAT);
+      break;
+    case Type::DOUBLE:
+      *out = liborc::createPrimitiveType(liborc::DOUBLE);
+      break;
+    case Type::STRING:
+      *out = liborc::createPrimitiveType(liborc::STRING);
+      break;
+    case Type::BINARY:
+    case Type::FIXED_SIZE_BINARY:
+      *out = liborc::createPrimitiveType(liborc::BINARY);
+      break;
+    case Type::DATE32:
+      *out = liborc::createPrimitiveType(liborc::DATE);
+      break;
+    case Type::TIMESTAMP:
+      *out = liborc::createPrimitiveType(liborc::TIMESTAMP);
+      break;
+    case Type::DECIMAL: {
+      const auto& decimal_type = checked_cast<const Decimal128Type&>(type);
+      *out = liborc::createDecimalType(static_cast<uint64_t>(decimal_type.precision()),
+                                       static_cast<uint64_t>(decimal_type.scale()));
+      break;
+    }
+    case Type::LIST: {
+      std::unique_ptr<liborc::Type> value_type;
+      RETURN_NOT_OK(
+          GetORCType(*checked_cast<const ListType&>(type).value_type(), &value_type));
+      *out = liborc::createListType(std::move(value_type));
+      break;
+    }
+    case Type::STRUCT: {
+      std::unique_ptr<liborc::Type> struct_type = liborc::createStructType();
+      for (const auto& child : type.children()) {
+        std::unique_ptr<liborc::Type> child_type;
+        RETURN_NOT_OK(GetORCType(*child->type(), &child_type));
+        struct_type->addStructField(child->name(), std::move(child_type));
+      }
+      *out = std::move(struct_type);
+      break;
+    }
+    default: {
+      std::stringstream ss;
+      ss << "Unsupported type for ORC writing: " << type.ToString();
+      return Status::NotImplemented(ss.str());
+    }
+  }
+  return Status::OK();
+}
+
+Status GetORCCompression(Compression::type compression, liborc::CompressionKind* out) {
+  switch (compression) {
+    case Compression::UNCOMPRESSED:
+      *out = liborc::CompressionKind_NONE;
+      break;
+    case Compression::SNAPPY:
+      *out = liborc::CompressionKind_SNAPPY;
+      break;
+    case Compression::GZIP:
+      *out = liborc::CompressionKind_ZLIB;
+      break;
+    case Compression::ZSTD:
+      *out = liborc::CompressionKind_ZSTD;
+      break;
+    case Compression::LZ4:
+      *out = liborc::CompressionKind_LZ4;
+      break;
+    case Compression::LZO:
+      *out = liborc::CompressionKind_LZO;
+      break;
+    default:
+      return Status::NotImplemented("Unsupported compression for ORC writing");
+  }
+  return Status::OK();
+}
+
+// Copy the validity of values [offset, offset + length) of an array into the
+// notNull bytes of a batch
+void FillNotNull(const Array& array, int64_t offset, int64_t length,
+                 liborc::ColumnVectorBatch* batch) {
+  batch->numElements = length;
+  batch->hasNulls = array.null_count() > 0;
+  if (batch->hasNulls) {
+    char* not_null = batch->notNull.data();
+    for (int64_t i = 0; i < length; ++i) {
+      not_null[i] = array.IsValid(offset + i);
+    }
+  }
+}
+
+template <class array_type, class batch_type>
+Status FillNumericBatch(const Array& array, int64_t offset, int64_t length,
+                        liborc::ColumnVectorBatch* cbatch) {
+  const auto& values = checked_cast<const array_type&>(array);
+  auto batch = checked_cast<batch_type*>(cbatch);
+  auto source = values.raw_values() + offset;
+  auto data = batch->data.data();
+  for (int64_t i = 0; i < length; ++i) {
+    data[i] = source[i];
+  }
+  return Status::OK();
+}
+
+Status FillBoolBatch(const Array& array, int64_t offset, int64_t length,
+                     liborc::ColumnVectorBatch* cbatch) {
+  const auto& values = checked_cast<const BooleanArray&>(array);
+  auto batch = checked_cast<liborc::LongVectorBatch*>(cbatch);
+  int64_t* data = batch->data.data();
+  for (int64_t i = 0; i < length; ++i) {
+    data[i] = values.Value(offset + i);
+  }
+  return Status::OK();
+}
+
+// The values point into the array, which must outlive the batch
+Status FillBinaryBatch(const Array& array, int64_t offset, int64_t length,
+                       liborc::ColumnVectorBatch* cbatch) {
+  const auto& values = checked_cast<const BinaryArray&>(array);
+  auto batch = checked_cast<liborc::StringVectorBatch*>(cbatch);
+  for (int64_t i = 0; i < length; ++i) {
+    int32_t value_length = 0;
+    const uint8_t* value = values.GetValue(offset + i, &value_length);
+    batch->data[i] = reinterpret_cast<char*>(const_cast<uint8_t*>(value));
+    batch->length[i] = value_length;
+  }
+  return Status::OK();
+}
+
+Status FillFixedSizeBinaryBatch(const Array& array, int64_t offset, int64_t length,
+                                liborc::ColumnVectorBatch* cbatch) {
+  const auto& values = checked_cast<const FixedSizeBinaryArray&>(array);
+  auto batch = checked_cast<liborc::StringVectorBatch*>(cbatch);
+  for (int64_t i = 0; i < length; ++i) {
+    batch->data[i] =
+        reinterpret_cast<char*>(const_cast<uint8_t*>(values.GetValue(offset + i)));
+    batch->length[i] = values.byte_width();
+  }
+  return Status::OK();
+}
+
+Status FillTimestampBatch(const Array& array, int64_t offset, int64_t length,
+                          liborc::ColumnVectorBatch* cbatch) {
+  const auto& values = checked_cast<const TimestampArray&>(array);
+  auto batch = checked_cast<liborc::TimestampVectorBatch*>(cbatch);
+  int64_t units_per_second = 1;
+  switch (checked_cast<const TimestampType&>(*array.type()).unit()) {
+    case TimeUnit::SECOND:
+      units_per_second = 1;
+      break;
+    case TimeUnit::MILLI:
+      units_per_second = 1000;
+      break;
+    case TimeUnit::MICRO:
+      units_per_second = 1000000;
+      break;
+    case TimeUnit::NANO:
+      units_per_second = kOneSecondNanos;
+      break;
+  }
+  const int64_t nanos_per_unit = kOneSecondNanos / units_per_second;
+  const int64_t* source = values.raw_values() + offset;
+  for (int64_t i = 0; i < length; ++i) {
+    // ORC nanoseconds are positive, so round the seconds down
+    int64_t seconds = source[i] / units_per_second;
+    int64_t remainder = source[i] % units_per_second;
+    if (remainder < 0) {
+      seconds -= 1;
+      remainder += units_per_second;
+    }
+    batch->data[i] = seconds;
+    batch->nanoseconds[i] = remainder * nanos_per_unit;
+  }
+  return Status::OK();
+}
+
+Status FillDecimalBatch(const Array& array, int64_t offset, int64_t length,
+                        liborc::ColumnVectorBatch* cbatch) {
+  const auto& values = checked_cast<const Decimal128Array&>(array);
+  // ORC keeps decimals of up to 18 digits in 64 bits
+  auto batch64 = dynamic_cast<liborc::Decimal64VectorBatch*>(cbatch);
+  if (batch64 != nullptr) {
+    for (int64_t i = 0; i < length; ++i) {
+      Decimal128 value(values.GetValue(offset + i));
+      batch64->values[i] = static_cast<int64_t>(value.low_bits());
+    }
+    return Status::OK();
+  }
+  auto batch128 = checked_cast<liborc::Decimal128VectorBatch*>(cbatch);
+  for (int64_t i = 0; i < length; ++i) {
+    Decimal128 value(values.GetValue(offset + i));
+    batch128->values[i] = liborc::Int128(value.high_bits(), value.low_bits());
+  }
+  return Status::OK();
+}
+
+Status FillBatch(const Array& array, int64_t offset, int64_t length,
+                 liborc::ColumnVectorBatch* batch);
+
+Status FillStructBatch(const Array& array, int64_t offset, int64_t length,
+                       liborc::ColumnVectorBatch* cbatch) {
+  const auto& values = checked_cast<const StructArray&>(array);
+  auto batch = checked_cast<liborc::StructVectorBatch*>(cbatch);
+  for (int i = 0; i < values.num_fields(); ++i) {
+    RETURN_NOT_OK(FillBatch(*values.field(i), offset, length, batch->fields[i]));
+  }
+  return Status::OK();
+}
+
+Status FillListBatch(const Array& array, int64_t offset, int64_t length,
+                     liborc::ColumnVectorBatch* cbatch) {
+  const auto& values = checked_cast<const ListArray&>(array);
+  auto batch = checked_cast<liborc::ListVectorBatch*>(cbatch);
+  const int64_t start = values.value_offset(offset);
+  int64_t* offsets = batch->offsets.data();
+  for (int64_t i = 0; i <= length; ++i) {
+    offsets[i] = values.value_offset(offset + i) - start;
+  }
+  return FillBatch(*values.values(), start, offsets[length], batch->elements.get());
+}
+
+// Convert values [offset, offset + length) of an array into a batch of the
+// ORC type of the array
+Status FillBatch(const Array& array, int64_t offset, int64_t length,
+                 liborc::ColumnVectorBatch* batch) {
+  if (batch->capacity < static_cast<uint64_t>(length)) {
+    batch->resize(static_cast<uint64_t>(length));
+  }
+  FillNotNull(array, offset, length, batch);
+
+  switch (array.type_id()) {
+    case Type::BOOL:
+      return FillBoolBatch(array, offset, length, batch);
+    case Type::INT8:
+      return FillNumericBatch<Int8Array, liborc::LongVectorBatch>(array, offset, length,
+                                                                  batch);
+    case Type::INT16:
+      return FillNumericBatch<Int16Array, liborc::LongVectorBatch>(array, offset, length,
+                                                                   batch);
+    case Type::INT32:
+      return FillNumericBatch<Int32Array, liborc::LongVectorBatch>(array, offset, length,
+                                                                   batch);
+    case Type::INT64:
+      return FillNumericBatch<Int64Array, liborc::LongVectorBatch>(array, offset, length,
+                                                                   batch);
+    case Type::DATE32:
+      return FillNumericBatch<Date32Array, liborc::LongVectorBatch>(array, offset,
+                                                                    length, batch);
+    case Type::FLOAT:
+      return FillNumericBatch<FloatArray, liborc::DoubleVectorBatch>(array, offset,
+                                                                     length, batch);
+    case Type::DOUBLE:
+      return FillNumericBatch<DoubleArray, liborc::DoubleVectorBatch>(array, offset,
+                                                                      length, batch);
+    case Type::STRING:
+    case Type::BINARY:
+      return FillBinaryBatch(array, offset, length, batch);
+    case Type::FIXED_SIZE_BINARY:
+      return FillFixedSizeBinaryBatch(array, offset, length, batch);
+    case Type::TIMESTAMP:
+      return FillTimestampBatch(array, offset, length, batch);
+    case Type::DECIMAL:
+      return FillDecimalBatch(array, offset, length, batch);
+    case Type::STRUCT:
+      return FillStructBatch(array, offset, length, batch);
+    case Type::LIST:
+      return FillListBatch(array, offset, length, batch);
+    default: {
+      std::stringstream ss;
+      ss << "Unsupported type for ORC writing: " << array.type()->ToString();
+      return Status::NotImplemented(ss.str());
+    }
+  }
+}
+
+class ORCFileWriter::Impl {
+ public:
+  Impl() : closed_(false) {}
+
+  Status Open(const std::shared_ptr<Schema>& schema,
+              const std::shared_ptr<io::OutputStream>& sink,
+              const ORCWriteOptions& options) {
+    if (options.batch_size <= 0) {
+      return Status::Invalid("Batch size must be positive");
+    }
+    RETURN_NOT_OK(GetORCType(*struct_(schema->fields()), &type_));
+
+    liborc::CompressionKind compression;
+    RETURN_NOT_OK(GetORCCompression(options.compression, &compression));
+    liborc::WriterOptions orc_options;
+    orc_options.setCompression(compression);
+    orc_options.setCompressionBlockSize(
+        static_cast<uint64_t>(options.compression_block_size));
+    orc_options.setStripeSize(static_cast<uint64_t>(options.stripe_size));
+
+    output_.reset(new ArrowOutputStream(sink));
+    try {
+      writer_ = liborc::createWriter(*type_, output_.get(), orc_options);
+      batch_ = writer_->createRowBatch(static_cast<uint64_t>(options.batch_size));
+    } catch (const liborc::NotImplementedYet& e) {
+      return Status::NotImplemented(e.what());
+    } catch (const std::exception& e) {
+      return Status::IOError(e.what());
+    }
+    schema_ = schema;
+    options_ = options;
+    return Status::OK();
+  }
+
+  Status Write(const RecordBatch& batch) {
+    if (closed_) {
+      return Status::Invalid("Cannot write to a closed ORC writer");
+    }
+    if (!batch.schema()->Equals(*schema_)) {
+      return Status::Invalid("Record batch schema does not match the ORC writer's");
+    }
+    auto struct_batch = checked_cast<liborc::StructVectorBatch*>(batch_.get());
+    const int num_columns = batch.num_columns();
+
+    for (int64_t offset = 0; offset < batch.num_rows(); offset += options_.batch_size) {
+      const int64_t length = std::min(options_.batch_size, batch.num_rows() - offset);
+      // The columns fill separate ORC column vectors
+      auto FillColumn = [&](int i) {
+        return FillBatch(*batch.column(i), offset, length, struct_batch->fields[i]);
+      };
+      if (options_.use_threads && num_columns > 1) {
+        RETURN_NOT_OK(ParallelFor(num_columns, FillColumn));
+      } else {
+        for (int i = 0; i < num_columns; ++i) {
+          RETURN_NOT_OK(FillColumn(i));
+        }
+      }
+      struct_batch->numElements = length;
+      struct_batch->hasNulls = false;
+      try {
+        writer_->add(*batch_);
+      } catch (const std::exception& e) {
+        return Status::IOError(e.what());
+      }
+    }
+    return Status::OK();
+  }
+
+  Status Write(const Table& table) {
+    if (!table.schema()->Equals(*schema_)) {
+      return Status::Invalid("Table schema does not match the ORC writer's");
+    }
+    TableBatchReader reader(table);
+    reader.set_chunksize(options_.batch_size);
+    std::shared_ptr<RecordBatch> batch;
+    while (true) {
+      RETURN_NOT_OK(reader.ReadNext(&batch));
+      if (batch == nullptr) {
+        break;
+      }
+      RETURN_NOT_OK(Write(*batch));
+    }
+    return Status::OK();
+  }
+
+  Status Close() {
+    if (closed_) {
+      return Status::OK();
+    }
+    closed_ = true;
+    try {
+      writer_->close();
+    } catch (const std::exception& e) {
+      return Status::IOError(e.what());
+    }
+    return Status::OK();
+  }
+
+ private:
+  std::shared_ptr<Schema> schema_;
+  ORCWriteOptions options_;
+  // The writer refers to the type and the output stream
+  std::unique_ptr<liborc::Type> type_;
+  std::unique_ptr<ArrowOutputStream> output_;
+  std::unique_ptr<liborc::Writer> writer_;
+  std::unique_ptr<liborc::ColumnVectorBatch> batch_;
+  bool closed_;
+};
+
+ORCFileWriter::ORCFileWriter() { impl_.reset(new ORCFileWriter::Impl()); }
+
+ORCFileWriter::~ORCFileWriter() {}
+
+Status ORCFileWriter::Open(const std::shared_ptr<Schema>& schema,
+                           const std::shared_ptr<io::OutputStream>& sink,
+                           const ORCWriteOptions& options,
+                           std::unique_ptr<ORCFileWriter>* writer) {
+  auto result = std::unique_ptr<ORCFileWriter>(new ORCFileWriter());
+  RETURN_NOT_OK(result->impl_->Open(schema, sink, options));
+  *writer = std::move(result);
+  return Status::OK();
+}
+
+Status ORCFileWriter::Write(const RecordBatch& batch) { return impl_->Write(batch); }
+
+Status ORCFileWriter::Write(const Table& table) { return impl_->Write(table); }
+
+Status ORCFileWriter::Close() { return impl_->Close(); }
+
 }  // namespace orc
 }  // namespace adapters
 }  // namespace arrow
@@ -20,6 +20,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "arrow/io/interfaces.h"
@@ -27,6 +28,7 @@
 #include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -35,6 +37,66 @@ namespace adapters {
 
 namespace orc {
 
+/// \brief The statistics of a top-level column in a stripe
+///
+/// The bounds are those of the Arrow values the column is read as: integers
+/// and booleans (as 0 and 1), dates in days, timestamps in nanoseconds
+/// (widened by a day, as ORC timestamp statistics may be in the time zone of
+/// the writer) are INTEGER; floats and doubles DOUBLE; strings, chars and
+/// varchars STRING. Other columns have kind NONE and no bounds.
+struct ARROW_EXPORT ORCColumnStatistics {
+  enum Kind { NONE, INTEGER, DOUBLE, STRING };
+
+  ORCColumnStatistics()
+      : kind(NONE),
+        num_values(0),
+        has_null(false),
+        has_bounds(false),
+        int_min(0),
+        int_max(0),
+        double_min(0),
+        double_max(0) {}
+
+  Kind kind;
+  /// The number of non-null values
+  int64_t num_values;
+  bool has_null;
+  /// Whether the minimum and maximum of the kind are set
+  bool has_bounds;
+  int64_t int_min;
+  int64_t int_max;
+  double double_min;
+  double double_max;
+  std::string string_min;
+  std::string string_max;
+};
+
+/// \brief A comparison of a top-level column with a literal
+///
+/// A stripe is skipped when its statistics show that the comparison is false
+/// or null for all of its rows. Stripes whose statistics are missing, of
+/// another kind than the literal, or include NaN are kept.
+struct ARROW_EXPORT ORCPredicate {
+  enum Op { EQUAL, NOT_EQUAL, LESS, LESS_EQUAL, GREATER, GREATER_EQUAL };
+
+  ORCPredicate(int field_index, Op op, int32_t value);
+  ORCPredicate(int field_index, Op op, int64_t value);
+  ORCPredicate(int field_index, Op op, double value);
+  ORCPredicate(int field_index, Op op, const std::string& value);
+
+  /// \brief Whether some values within the statistics may satisfy the
+  /// comparison
+  bool MayMatch(const ORCColumnStatistics& statistics) const;
+
+  int field_index;
+  Op op;
+  /// The kind of the literal, INTEGER, DOUBLE or STRING
+  ORCColumnStatistics::Kind kind;
+  int64_t int_value;
+  double double_value;
+  std::string string_value;
+};
+
 /// \class ORCFileReader
 /// \brief Read an Arrow Table or RecordBatch from an ORC file.
 class ARROW_EXPORT ORCFileReader {
@@ -70,6 +132,33 @@ class ARROW_EXPORT ORCFileReader {
   /// \param[out] out the returned RecordBatch
   Status Read(const std::vector<int>& include_indices, std::shared_ptr<Table>* out);
 
+  /// \brief Read the stripes of the file which may satisfy all of the predicates
+  ///
+  /// Stripes are skipped using their statistics only: the rows of the stripes
+  /// which are read are not filtered. The table will be composed of one record
+  /// batch per stripe read, and may be empty.
+  ///
+  /// \param[in] predicates the predicates, all of which rows must satisfy
+  /// \param[in] include_indices the selected field indices to read, or all of
+  /// them if empty
+  /// \param[out] out the returned Table
+  Status ReadMatchingStripes(const std::vector<ORCPredicate>& predicates,
+                             const std::vector<int>& include_indices,
+                             std::shared_ptr<Table>* out);
+
+  /// \brief The indices of the stripes which may satisfy all of the predicates
+  ///
+  /// \param[in] predicates the predicates, all of which rows must satisfy
+  /// \param[out] out the indices of the stripes, in order
+  Status SelectStripes(const std::vector<ORCPredicate>& predicates,
+                       std::vector<int64_t>* out);
+
+  /// \brief Read the statistics of the top-level columns of a stripe
+  ///
+  /// \param[in] stripe the stripe index
+  /// \param[out] out the statistics of each field of the schema
+  Status ReadStripeStatistics(int64_t stripe, std::vector<ORCColumnStatistics>* out);
+
   /// \brief Read a single stripe as a RecordBatch
   ///
   /// \param[in] stripe the stripe index
@@ -84,6 +173,35 @@ class ARROW_EXPORT ORCFileReader {
   Status ReadStripe(int64_t stripe, const std::vector<int>& include_indices,
                     std::shared_ptr<RecordBatch>* out);
 
+  /// \brief Return a reader of the record batches of the file
+  ///
+  /// The stripes are scanned in order into batches of at most batch_size rows.
+  /// The ORC column vectors and the Arrow builders are reused from one batch to
+  /// the next, so the memory used is bounded by the batch size rather than by
+  /// the size of a stripe. The ORCFileReader must outlive the returned reader.
+  ///
+  /// \param[in] batch_size the maximum number of rows of each batch
+  /// \param[out] out the returned RecordBatchReader
+  Status GetRecordBatchReader(int64_t batch_size,
+                              std::shared_ptr<RecordBatchReader>* out);
+
+  /// \brief Return a reader of the record batches of the file
+  ///
+  /// \param[in] batch_size the maximum number of rows of each batch
+  /// \param[in] include_indices the selected field indices to read
+  /// \param[out] out the returned RecordBatchReader
+  Status GetRecordBatchReader(int64_t batch_size, const std::vector<int>& include_indices,
+                              std::shared_ptr<RecordBatchReader>* out);
+
+  /// \brief Set whether Read decodes the stripes of the file in parallel
+  ///
+  /// When enabled, the stripes are decoded concurrently on the CPU thread pool,
+  /// each thread with its own ORC reader on the shared input file, which must
+  /// therefore support concurrent ReadAt calls. Defaults to false.
+  ///
+  /// \param[in] use_threads whether to use multiple threads
+  void set_use_threads(bool use_threads);
+
   /// \brief The number of stripes in the file
   int64_t NumberOfStripes();
 
@@ -96,6 +214,66 @@ class ARROW_EXPORT ORCFileReader {
   ORCFileReader();
 };
 
+/// \brief Options of an ORCFileWriter
+struct ARROW_EXPORT ORCWriteOptions {
+  /// The codec of the file. Brotli is not supported by ORC
+  Compression::type compression = Compression::GZIP;
+
+  /// The size of the compressed blocks of the streams of a stripe
+  int64_t compression_block_size = 64 * 1024;
+
+  /// The size of the stripes, in bytes of encoded data
+  int64_t stripe_size = 64 * 1024 * 1024;
+
+  /// The rows converted into an ORC column vector batch at a time
+  int64_t batch_size = 1 << 16;
+
+  /// Convert the columns of each batch in parallel, on the CPU thread pool
+  bool use_threads = false;
+};
+
+/// \class ORCFileWriter
+/// \brief Write Arrow record batches or tables to an ORC file
+///
+/// Columns of boolean, signed integer, floating point, string, binary, fixed
+/// size binary, date32, timestamp and decimal type, and lists and structs of
+/// them, can be written. Timestamps are written with nanosecond precision.
+///
+/// The columns of a batch are converted to ORC column vectors, in parallel if
+/// use_threads is set, then encoded by the ORC writer, which closes a stripe
+/// whenever its encoded size reaches the stripe size.
+class ARROW_EXPORT ORCFileWriter {
+ public:
+  ~ORCFileWriter();
+
+  /// \brief Create a new ORC writer
+  ///
+  /// \param[in] schema the schema of the batches to write
+  /// \param[in] sink the stream to write the file to, which is not closed by
+  /// the writer
+  /// \param[in] options the options of the writer
+  /// \param[out] writer the returned writer object
+  /// \return Status
+  static Status Open(const std::shared_ptr<Schema>& schema,
+                     const std::shared_ptr<io::OutputStream>& sink,
+                     const ORCWriteOptions& options,
+                     std::unique_ptr<ORCFileWriter>* writer);
+
+  /// \brief Write a record batch of the schema of the writer
+  Status Write(const RecordBatch& batch);
+
+  /// \brief Write a table of the schema of the writer
+  Status Write(const Table& table);
+
+  /// \brief Write the stripe in progress and the footer of the file
+  Status Close();
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+  ORCFileWriter();
+};
+
 }  // namespace orc
 
 }  // namespace adapters
@@ -18,11 +18,23 @@
 #ifndef ARROW_TENSORFLOW_CONVERTER_H
 #define ARROW_TENSORFLOW_CONVERTER_H
 
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <memory>
+#include <vector>
 
+#include "tensorflow/core/framework/allocation_description.pb.h"
 #include "tensorflow/core/framework/op.h"
+#include "tensorflow/core/framework/tensor.h"
 
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/record_batch.h"
 #include "arrow/type.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/parallel.h"
 
 // These utilities are supposed to be included in TensorFlow operators
 // that need to be compiled separately from Arrow because of ABI issues.
@@ -149,6 +161,177 @@ Status GetTensorFlowType(std::shared_ptr<DataType> dtype, ::tensorflow::DataType
   return arrow::Status::OK();
 }
 
+/// \brief A TensorFlow tensor buffer of the memory of an Arrow buffer, which
+/// it keeps alive
+class ArrowTensorBuffer : public ::tensorflow::TensorBuffer {
+ public:
+  ArrowTensorBuffer(const std::shared_ptr<Buffer>& buffer, const uint8_t* data,
+                    size_t size)
+      : ::tensorflow::TensorBuffer(const_cast<uint8_t*>(data)),
+        buffer_(buffer),
+        size_(size) {}
+
+  size_t size() const override { return size_; }
+
+  ::tensorflow::TensorBuffer* root_buffer() override { return this; }
+
+  void FillAllocationDescription(
+      ::tensorflow::AllocationDescription* proto) const override {
+    proto->set_requested_bytes(static_cast<int64_t>(size_));
+    proto->set_allocator_name("arrow");
+  }
+
+  bool OwnsMemory() const override { return false; }
+
+ private:
+  std::shared_ptr<Buffer> buffer_;
+  size_t size_;
+};
+
+/// \brief Convert a numeric array without nulls to a 1D TensorFlow tensor
+///
+/// The tensor shares the memory of the array if it is aligned as Eigen wants
+/// it, as the 64-byte aligned buffers of the Arrow memory pools are, and
+/// copies it otherwise. Boolean arrays are unpacked into a new tensor.
+inline Status ArrayToTensor(const Array& array, ::tensorflow::Tensor* out) {
+  ::tensorflow::DataType dtype;
+  RETURN_NOT_OK(GetTensorFlowType(array.type(), &dtype));
+  if (array.null_count() != 0) {
+    return Status::Invalid("Cannot convert an array with nulls to a TensorFlow tensor");
+  }
+  const int64_t length = array.length();
+  const ::tensorflow::TensorShape shape({length});
+  const auto& values = array.data()->buffers[1];
+
+  if (dtype == ::tensorflow::DT_BOOL) {
+    *out = ::tensorflow::Tensor(dtype, shape);
+    auto out_values = out->flat<bool>();
+    for (int64_t i = 0; i < length; ++i) {
+      out_values(i) = BitUtil::GetBit(values->data(), array.offset() + i);
+    }
+    return Status::OK();
+  }
+
+  const int64_t byte_width =
+      checked_cast<const FixedWidthType&>(*array.type()).bit_width() / 8;
+  const size_t nbytes = static_cast<size_t>(length * byte_width);
+  if (length == 0) {
+    *out = ::tensorflow::Tensor(dtype, shape);
+    return Status::OK();
+  }
+  const uint8_t* data = values->data() + array.offset() * byte_width;
+  if (reinterpret_cast<uintptr_t>(data) % EIGEN_MAX_ALIGN_BYTES == 0) {
+    auto tensor_buffer = new ArrowTensorBuffer(values, data, nbytes);
+    *out = ::tensorflow::Tensor(dtype, shape, tensor_buffer);
+    // The tensor holds its own reference
+    tensor_buffer->Unref();
+  } else {
+    *out = ::tensorflow::Tensor(dtype, shape);
+    std::memcpy(const_cast<char*>(out->tensor_data().data()), data, nbytes);
+  }
+  return Status::OK();
+}
+
+namespace internal {
+
+// Interleave the rows [row_begin, row_end) of the columns into a row-major
+// matrix, T being an unsigned integer as wide as their values
+template <typename T>
+void StackColumns(const std::vector<const T*>& columns, int64_t row_begin,
+                  int64_t row_end, T* out) {
+  const int64_t num_columns = static_cast<int64_t>(columns.size());
+  for (int64_t i = row_begin; i < row_end; ++i) {
+    T* out_row = out + i * num_columns;
+    for (int64_t j = 0; j < num_columns; ++j) {
+      out_row[j] = columns[j][i];
+    }
+  }
+}
+
+template <typename T>
+Status StackColumnsParallel(const std::vector<const uint8_t*>& columns,
+                            int64_t num_rows, uint8_t* out) {
+  // The rows are copied by blocks, each task writing a contiguous range of
+  // the matrix
+  constexpr int64_t kRowsPerTask = 1 << 16;
+  std::vector<const T*> typed_columns;
+  for (const uint8_t* column : columns) {
+    typed_columns.push_back(reinterpret_cast<const T*>(column));
+  }
+  const int num_tasks = static_cast<int>((num_rows + kRowsPerTask - 1) / kRowsPerTask);
+  return ParallelFor(num_tasks, [&](int i) {
+    const int64_t row_begin = i * kRowsPerTask;
+    const int64_t row_end = std::min(num_rows, row_begin + kRowsPerTask);
+    StackColumns<T>(typed_columns, row_begin, row_end, reinterpret_cast<T*>(out));
+    return Status::OK();
+  });
+}
+
+}  // namespace internal
+
+/// \brief Stack numeric columns of a record batch into a 2D TensorFlow tensor
+///
+/// The tensor has a row of the values of the columns by row of the batch. The
+/// columns must have the same type and no nulls, and are copied once, in
+/// parallel on the CPU thread pool.
+///
+/// \param[in] batch the record batch
+/// \param[in] column_indices the indices of the columns to stack
+/// \param[out] out the tensor, of shape [num_rows, number of columns]
+inline Status RecordBatchToTensor(const RecordBatch& batch,
+                                  const std::vector<int>& column_indices,
+                                  ::tensorflow::Tensor* out) {
+  if (column_indices.empty()) {
+    return Status::Invalid("No columns to stack into a TensorFlow tensor");
+  }
+  const int64_t num_rows = batch.num_rows();
+  const auto& type = batch.column(column_indices[0])->type();
+  ::tensorflow::DataType dtype;
+  RETURN_NOT_OK(GetTensorFlowType(type, &dtype));
+  if (dtype == ::tensorflow::DT_BOOL) {
+    return Status::NotImplemented("Stacking boolean columns into a TensorFlow tensor");
+  }
+  const int byte_width = checked_cast<const FixedWidthType&>(*type).bit_width() / 8;
+
+  std::vector<const uint8_t*> columns;
+  for (int i : column_indices) {
+    const auto& column = batch.column(i);
+    if (!column->type()->Equals(*type)) {
+      return Status::Invalid("Cannot stack columns of different types");
+    }
+    if (column->null_count() != 0) {
+      return Status::Invalid("Cannot stack a column with nulls");
+    }
+    columns.push_back(column->data()->buffers[1]->data() + column->offset() * byte_width);
+  }
+
+  *out = ::tensorflow::Tensor(
+      dtype, ::tensorflow::TensorShape({num_rows, static_cast<int64_t>(columns.size())}));
+  auto out_data =
+      reinterpret_cast<uint8_t*>(const_cast<char*>(out->tensor_data().data()));
+  switch (byte_width) {
+    case 1:
+      return internal::StackColumnsParallel<uint8_t>(columns, num_rows, out_data);
+    case 2:
+      return internal::StackColumnsParallel<uint16_t>(columns, num_rows, out_data);
+    case 4:
+      return internal::StackColumnsParallel<uint32_t>(columns, num_rows, out_data);
+    case 8:
+      return internal::StackColumnsParallel<uint64_t>(columns, num_rows, out_data);
+    default:
+      return Status::NotImplemented("Stacking columns of this width");
+  }
+}
+
+/// \brief Stack all of the columns of a record batch into a 2D TensorFlow tensor
+inline Status RecordBatchToTensor(const RecordBatch& batch, ::tensorflow::Tensor* out) {
+  std::vector<int> column_indices;
+  for (int i = 0; i < batch.num_columns(); ++i) {
+    column_indices.push_back(i);
+  }
+  return RecordBatchToTensor(batch, column_indices, out);
+}
+
 }  // namespace tensorflow
 
 }  // namespace adapters
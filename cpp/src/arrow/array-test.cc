@@ -17,8 +17,11 @@
 
 #include <cstdint>
 #include <cstdlib>
+#include <limits>
 #include <memory>
 #include <numeric>
+#include <string>
+#include <thread>
 #include <vector>
 
 #include "gtest/gtest.h"
@@ -29,6 +32,7 @@
 #include "arrow/ipc/test-common.h"
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
+#include "arrow/table.h"
 #include "arrow/test-common.h"
 #include "arrow/test-util.h"
 #include "arrow/type.h"
@@ -36,6 +40,7 @@
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/decimal.h"
 #include "arrow/util/lazy.h"
+#include "arrow/visitor_inline.h"
 
 namespace arrow {
 
@@ -190,6 +195,57 @@ TEST_F(TestArray, SliceRecomputeNullCount) {
   ASSERT_EQ(0, arr->null_count());
 }
 
+TEST_F(TestArray, SliceNullCountFromBitmapCounts) {
+  const int64_t length = 100000;
+  vector<uint8_t> valid_bytes(length);
+  test::random_null_bytes(length, 0.3, valid_bytes.data());
+
+  std::shared_ptr<Array> array;
+  ASSERT_OK(MakeArrayFromValidBytes(valid_bytes, pool_, &array));
+  const auto& bitmap = array->data()->buffers[0];
+
+  auto expected_null_count = [&](int64_t offset, int64_t slice_length) {
+    return std::count(valid_bytes.begin() + offset,
+                      valid_bytes.begin() + offset + slice_length, 0);
+  };
+
+  // Too short a slice of the bitmap to count it all
+  ASSERT_EQ(expected_null_count(50000, 100), array->Slice(50000, 100)->null_count());
+  ASSERT_EQ(nullptr, bitmap->bitmap_counts());
+
+  // The counts are cached on the bitmap and shared by the slices
+  ASSERT_EQ(expected_null_count(1000, 90000), array->Slice(1000, 90000)->null_count());
+  ASSERT_NE(nullptr, bitmap->bitmap_counts());
+  for (int64_t offset : {0, 1, 4095, 4096, 12345, 50000}) {
+    for (int64_t slice_length : {0, 1, 100, 4097, 40000}) {
+      auto slice = array->Slice(offset, slice_length);
+      ASSERT_EQ(kUnknownNullCount, slice->data()->null_count);
+      ASSERT_EQ(expected_null_count(offset, slice_length), slice->null_count());
+    }
+  }
+
+  // Writing the bitmap drops them
+  bitmap->mutable_data();
+  ASSERT_EQ(nullptr, bitmap->bitmap_counts());
+  ASSERT_EQ(expected_null_count(10, 99990), array->Slice(10)->null_count());
+}
+
+TEST_F(TestArray, SliceKnownNullCount) {
+  vector<uint8_t> valid_bytes = {1, 1, 1, 1, 1, 1};
+  std::shared_ptr<Array> array;
+  ASSERT_OK(MakeArrayFromValidBytes(valid_bytes, pool_, &array));
+  ASSERT_EQ(0, array->Slice(2, 3)->data()->null_count);
+
+  valid_bytes = {0, 0, 0, 0, 0, 0};
+  ASSERT_OK(MakeArrayFromValidBytes(valid_bytes, pool_, &array));
+  ASSERT_EQ(3, array->Slice(2, 3)->data()->null_count);
+
+  valid_bytes = {1, 0, 0, 0, 0, 0};
+  ASSERT_OK(MakeArrayFromValidBytes(valid_bytes, pool_, &array));
+  ASSERT_EQ(kUnknownNullCount, array->Slice(2, 3)->data()->null_count);
+  ASSERT_EQ(3, array->Slice(2, 3)->null_count());
+}
+
 TEST_F(TestArray, NullArraySliceNullCount) {
   auto null_arr = std::make_shared<NullArray>(10);
   auto null_arr_sliced = null_arr->Slice(3, 6);
@@ -232,6 +288,162 @@ TEST_F(TestArray, TestIsNullIsValid) {
   }
 }
 
+TEST_F(TestArray, VisitArrayValuesInline) {
+  // Long enough for blocks of only valid slots and of only nulls
+  const int64_t length = 2000;
+  std::vector<bool> is_valid(length);
+  std::vector<int32_t> values(length);
+  for (int64_t i = 0; i < length; ++i) {
+    is_valid[i] = i < 600 || (i >= 1200 && i % 3 != 0);
+    values[i] = static_cast<int32_t>(i * 7);
+  }
+  std::shared_ptr<Array> array;
+  ArrayFromVector<Int32Type, int32_t>(is_valid, values, &array);
+
+  for (int64_t offset : {0, 1, 300, 1999}) {
+    auto slice = array->Slice(offset);
+    std::vector<int64_t> valid_seen, nulls_seen;
+    ASSERT_TRUE(VisitArrayValuesInline<Int32Type>(
+        *slice->data(),
+        [&](int64_t i, int32_t value) {
+          EXPECT_EQ(values[offset + i], value);
+          valid_seen.push_back(i);
+          return true;
+        },
+        [&](int64_t i) {
+          nulls_seen.push_back(i);
+          return true;
+        }));
+    ASSERT_EQ(slice->length() - slice->null_count(),
+              static_cast<int64_t>(valid_seen.size()));
+    ASSERT_EQ(slice->null_count(), static_cast<int64_t>(nulls_seen.size()));
+    for (int64_t i : valid_seen) {
+      ASSERT_TRUE(slice->IsValid(i));
+    }
+    for (int64_t i : nulls_seen) {
+      ASSERT_TRUE(slice->IsNull(i));
+    }
+  }
+
+  // A range, stopped early
+  int64_t num_visited = 0;
+  auto count_until_null = [&](int64_t) {
+    ++num_visited;
+    return false;
+  };
+  ASSERT_FALSE(VisitArrayValuesInline<Int32Type>(
+      *array->data(), 590, 100,
+      [&](int64_t, int32_t) {
+        ++num_visited;
+        return true;
+      },
+      count_until_null));
+  ASSERT_EQ(11, num_visited);
+
+  // Strings and booleans, without nulls
+  std::shared_ptr<Array> strings, booleans;
+  ArrayFromVector<StringType, std::string>({"ab", "", "cde"}, &strings);
+  std::string concatenated;
+  ASSERT_TRUE(VisitArrayValuesInline<StringType>(
+      *strings->data(),
+      [&](int64_t, const uint8_t* value, int32_t value_length) {
+        concatenated.append(reinterpret_cast<const char*>(value), value_length);
+        return true;
+      },
+      [](int64_t) { return false; }));
+  ASSERT_EQ("abcde", concatenated);
+
+  ArrayFromVector<BooleanType, bool>({true, false, true}, &booleans);
+  int64_t num_true = 0;
+  ASSERT_TRUE(VisitArrayValuesInline<BooleanType>(
+      *booleans->Slice(1)->data(),
+      [&](int64_t, bool value) {
+        num_true += value;
+        return true;
+      },
+      [](int64_t) { return false; }));
+  ASSERT_EQ(1, num_true);
+}
+
+TEST_F(TestArray, RangeEqualsValidRuns) {
+  // Long enough for blocks of only valid slots and of only nulls
+  const int64_t length = 2000;
+  std::vector<bool> is_valid(length);
+  std::vector<int32_t> values(length);
+  std::vector<std::string> strings(length);
+  for (int64_t i = 0; i < length; ++i) {
+    is_valid[i] = i < 600 || (i >= 1200 && i % 3 != 0);
+    values[i] = static_cast<int32_t>(i * 7);
+    strings[i] = std::string(static_cast<size_t>(i % 5), static_cast<char>('a' + i % 7));
+  }
+  std::shared_ptr<Array> array, string_array;
+  ArrayFromVector<Int32Type, int32_t>(is_valid, values, &array);
+  ArrayFromVector<StringType, std::string>(is_valid, strings, &string_array);
+
+  // The values of null slots do not count, and the ranges are compared at
+  // other offsets of the right arrays
+  const int64_t shift = 3;
+  std::vector<bool> other_is_valid(shift, true);
+  std::vector<int32_t> other_values(shift, 0);
+  std::vector<std::string> other_strings(shift, "xyz");
+  for (int64_t i = 0; i < length; ++i) {
+    other_is_valid.push_back(is_valid[i]);
+    other_values.push_back(is_valid[i] ? values[i] : -1);
+    other_strings.push_back(is_valid[i] ? strings[i] : "null");
+  }
+  std::shared_ptr<Array> other, other_string_array;
+  ArrayFromVector<Int32Type, int32_t>(other_is_valid, other_values, &other);
+  ArrayFromVector<StringType, std::string>(other_is_valid, other_strings,
+                                           &other_string_array);
+
+  for (int64_t start : {0, 1, 590, 1199}) {
+    for (int64_t end : {start + 1, static_cast<int64_t>(1300), length}) {
+      ASSERT_TRUE(array->RangeEquals(start, end, start + shift, other));
+      ASSERT_TRUE(
+          string_array->RangeEquals(start, end, start + shift, other_string_array));
+    }
+  }
+  ASSERT_TRUE(array->Slice(5)->Equals(other->Slice(5 + shift)));
+  ASSERT_TRUE(string_array->Slice(5)->Equals(other_string_array->Slice(5 + shift)));
+
+  // A differing valid value, or a differing null after it
+  for (int64_t i : {0, 599, 1201, 1997}) {
+    std::vector<int32_t> changed_values(other_values);
+    changed_values[i + shift] += 1;
+    std::vector<std::string> changed_strings(other_strings);
+    changed_strings[i + shift] += "!";
+    std::vector<bool> changed_is_valid(other_is_valid);
+    changed_is_valid[i + shift + 1] = !changed_is_valid[i + shift + 1];
+    std::shared_ptr<Array> changed, changed_strings_array, changed_validity;
+    ArrayFromVector<Int32Type, int32_t>(other_is_valid, changed_values, &changed);
+    ArrayFromVector<StringType, std::string>(other_is_valid, changed_strings,
+                                             &changed_strings_array);
+    ArrayFromVector<Int32Type, int32_t>(changed_is_valid, other_values,
+                                        &changed_validity);
+    ASSERT_FALSE(array->RangeEquals(0, length, shift, changed)) << i;
+    ASSERT_FALSE(string_array->RangeEquals(0, length, shift, changed_strings_array))
+        << i;
+    ASSERT_TRUE(array->RangeEquals(0, i, shift, changed)) << i;
+    ASSERT_FALSE(array->RangeEquals(0, length, shift, changed_validity)) << i;
+    ASSERT_TRUE(array->RangeEquals(0, i + 1, shift, changed_validity)) << i;
+  }
+}
+
+TEST_F(TestArray, RangeEqualsFloatingPoint) {
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+  std::shared_ptr<Array> left, right, with_nan, other_with_nan;
+  ArrayFromVector<DoubleType, double>({true, false, true}, {0.0, 1.0, 2.0}, &left);
+  ArrayFromVector<DoubleType, double>({true, false, true}, {-0.0, nan, 2.0}, &right);
+  ArrayFromVector<DoubleType, double>({true, true, true}, {0.0, nan, 2.0}, &with_nan);
+  ArrayFromVector<DoubleType, double>({true, true, true}, {0.0, nan, 2.0},
+                                      &other_with_nan);
+  // 0.0 equals -0.0, and the values of null slots are ignored
+  ASSERT_TRUE(left->RangeEquals(0, 3, 0, right));
+  // NaN is never equal
+  ASSERT_FALSE(with_nan->RangeEquals(1, 2, 1, other_with_nan));
+  ASSERT_TRUE(with_nan->RangeEquals(2, 3, 2, right));
+}
+
 TEST_F(TestArray, TestIsNullIsValidNoNulls) {
   const int64_t size = 10;
 
@@ -1523,6 +1735,33 @@ TEST_F(TestBinaryBuilder, TestCapacityReserve) {
   ASSERT_EQ(640, result_->value_data()->capacity());
 }
 
+TEST_F(TestBinaryBuilder, TestAppendValuesOffsets) {
+  // "bb", "a", null, "ccc" packed with a leading unused byte
+  const std::string data = "xbbaccc";
+  vector<int32_t> offsets = {1, 3, 4, 4, 7};
+  vector<uint8_t> valid_bytes = {1, 1, 0, 1};
+  vector<string> expected = {"bb", "a", "", "ccc"};
+
+  ASSERT_OK(builder_->AppendValues(offsets.data(), 4,
+                                   reinterpret_cast<const uint8_t*>(data.data()),
+                                   valid_bytes.data()));
+  ASSERT_OK(builder_->Append("dd"));
+  ASSERT_OK(builder_->AppendValues(offsets.data(), 4,
+                                   reinterpret_cast<const uint8_t*>(data.data())));
+  ASSERT_EQ(14, builder_->value_data_length());
+  Done();
+
+  ASSERT_EQ(9, result_->length());
+  ASSERT_EQ(1, result_->null_count());
+  ASSERT_TRUE(result_->IsNull(2));
+  ASSERT_FALSE(result_->IsNull(7));
+  ASSERT_EQ("dd", result_->GetString(4));
+  for (int i = 0; i < 4; ++i) {
+    ASSERT_EQ(expected[i], result_->GetString(i));
+    ASSERT_EQ(expected[i], result_->GetString(i + 5));
+  }
+}
+
 TEST_F(TestBinaryBuilder, TestZeroLength) {
   // All buffers are null
   Done();
@@ -1908,6 +2147,54 @@ TEST_F(TestAdaptiveIntBuilder, TestAppendValues) {
   ASSERT_TRUE(expected_->Equals(result_));
 }
 
+TEST_F(TestAdaptiveIntBuilder, TestAppendValuesNullsIgnored) {
+  // Long enough for several blocks of the width detection, whose values at
+  // the nulls don't fit an int16
+  const int64_t length = 5000;
+  std::vector<int64_t> values(length);
+  std::vector<uint8_t> valid_bytes(length);
+  std::vector<bool> is_valid(length);
+  for (int64_t i = 0; i < length; ++i) {
+    is_valid[i] = valid_bytes[i] = i % 3 != 0;
+    values[i] = is_valid[i] ? (i % 2 ? -i : i) : int64_t(1) << 40;
+  }
+  ASSERT_OK(builder_->AppendValues(values.data(), length, valid_bytes.data()));
+  Done();
+
+  ASSERT_TRUE(result_->type()->Equals(int16()));
+  std::vector<int16_t> expected_values(values.begin(), values.end());
+  ArrayFromVector<Int16Type, int16_t>(is_valid, expected_values, &expected_);
+  ASSERT_TRUE(expected_->Equals(result_));
+}
+
+TEST_F(TestAdaptiveIntBuilder, TestShrinkOnFinish) {
+  // The width is kept by a reused builder
+  ASSERT_OK(builder_->Append(std::numeric_limits<int32_t>::min()));
+  Done();
+  ASSERT_TRUE(result_->type()->Equals(int32()));
+  std::vector<int64_t> values = {1, -2, 3};
+  ASSERT_OK(builder_->AppendValues(values.data(), values.size()));
+  Done();
+  ASSERT_TRUE(result_->type()->Equals(int32()));
+
+  builder_->set_shrink_on_finish(true);
+  ASSERT_OK(builder_->AppendValues(values.data(), values.size()));
+  ASSERT_OK(builder_->AppendNull());
+  ASSERT_OK(builder_->Append(-300));
+  Done();
+  ArrayFromVector<Int16Type, int16_t>({true, true, true, false, true},
+                                      {1, -2, 3, 0, -300}, &expected_);
+  ASSERT_TRUE(expected_->Equals(result_));
+
+  // Values at the nulls are not kept
+  std::vector<uint8_t> valid_bytes = {1, 0, 1};
+  values = {5, std::numeric_limits<int64_t>::max(), -5};
+  ASSERT_OK(builder_->AppendValues(values.data(), values.size(), valid_bytes.data()));
+  Done();
+  ArrayFromVector<Int8Type, int8_t>({true, false, true}, {5, 0, -5}, &expected_);
+  ASSERT_TRUE(expected_->Equals(result_));
+}
+
 TEST_F(TestAdaptiveIntBuilder, TestAssertZeroPadded) {
   std::vector<int64_t> values(
       {0, static_cast<int64_t>(std::numeric_limits<int32_t>::max()) + 1});
@@ -2035,6 +2322,21 @@ TEST_F(TestAdaptiveUIntBuilder, TestAppendValues) {
   ASSERT_TRUE(expected_->Equals(result_));
 }
 
+TEST_F(TestAdaptiveUIntBuilder, TestShrinkOnFinish) {
+  builder_->set_shrink_on_finish(true);
+  ASSERT_OK(builder_->Append(std::numeric_limits<uint64_t>::max()));
+  Done();
+  ASSERT_TRUE(result_->type()->Equals(uint64()));
+
+  std::vector<uint64_t> values(3000);
+  std::iota(values.begin(), values.end(), 0);
+  ASSERT_OK(builder_->AppendValues(values.data(), values.size()));
+  Done();
+  std::vector<uint16_t> expected_values(values.begin(), values.end());
+  ArrayFromVector<UInt16Type, uint16_t>(expected_values, &expected_);
+  ASSERT_TRUE(expected_->Equals(result_));
+}
+
 TEST_F(TestAdaptiveUIntBuilder, TestAssertZeroPadded) {
   std::vector<uint64_t> values(
       {0, static_cast<uint64_t>(std::numeric_limits<uint32_t>::max()) + 1});
@@ -2237,6 +2539,47 @@ TYPED_TEST(TestDictionaryBuilder, DeltaDictionary) {
   ASSERT_TRUE(expected_delta.Equals(result_delta));
 }
 
+TYPED_TEST(TestDictionaryBuilder, DeltaDictionaryTableGrowth) {
+  using Scalar = typename TypeParam::c_type;
+  // Skip this test for (u)int8
+  if (sizeof(Scalar) > 1) {
+    DictionaryBuilder<TypeParam> builder(default_memory_pool());
+    for (int64_t i = 0; i < 100; i++) {
+      ASSERT_OK(builder.Append(static_cast<Scalar>(i)));
+    }
+    std::shared_ptr<Array> result;
+    ASSERT_OK(builder.Finish(&result));
+
+    // Grow the hash table while it holds entries from the previous Finish
+    NumericBuilder<TypeParam> dict_builder;
+    Int16Builder int_builder;
+    for (int64_t i = 0; i < 3000; i++) {
+      ASSERT_OK(builder.Append(static_cast<Scalar>(i % 2000)));
+      ASSERT_OK(int_builder.Append(static_cast<int16_t>(i % 2000)));
+      if (i >= 100 && i < 2000) {
+        ASSERT_OK(dict_builder.Append(static_cast<Scalar>(i)));
+      }
+    }
+    std::shared_ptr<Array> result_delta;
+    ASSERT_OK(builder.Finish(&result_delta));
+
+    std::shared_ptr<Array> dict_array;
+    ASSERT_OK(dict_builder.Finish(&dict_array));
+    std::shared_ptr<Array> int_array;
+    ASSERT_OK(int_builder.Finish(&int_array));
+    DictionaryArray expected_delta(std::make_shared<DictionaryType>(int16(), dict_array),
+                                   int_array);
+    ASSERT_TRUE(expected_delta.Equals(result_delta));
+
+    // Reset discards the dictionary
+    builder.Reset();
+    ASSERT_OK(builder.Append(static_cast<Scalar>(1500)));
+    ASSERT_OK(builder.Finish(&result));
+    const auto& dict_result = checked_cast<const DictionaryArray&>(*result);
+    ASSERT_EQ(1, dict_result.dictionary()->length());
+  }
+}
+
 TYPED_TEST(TestDictionaryBuilder, DoubleDeltaDictionary) {
   DictionaryBuilder<TypeParam> builder(default_memory_pool());
 
@@ -3017,6 +3360,222 @@ TEST_F(TestListArray, TestZeroLength) {
   ASSERT_OK(ValidateArray(*result_));
 }
 
+// ----------------------------------------------------------------------
+// Large binary and list tests
+
+TEST(TestLargeStringBuilder, Basics) {
+  LargeStringBuilder builder;
+  ASSERT_OK(builder.Append("foo"));
+  ASSERT_OK(builder.AppendNull());
+  ASSERT_OK(builder.Append(""));
+  ASSERT_OK(builder.AppendValues({"bar", "bazz"}));
+
+  std::shared_ptr<Array> out;
+  FinishAndCheckPadding(&builder, &out);
+  ASSERT_OK(ValidateArray(*out));
+  ASSERT_TRUE(out->type()->Equals(large_utf8()));
+  ASSERT_EQ(5, out->length());
+  ASSERT_EQ(1, out->null_count());
+
+  const auto& strings = checked_cast<const LargeStringArray&>(*out);
+  ASSERT_EQ("foo", strings.GetString(0));
+  ASSERT_EQ("", strings.GetString(2));
+  ASSERT_EQ("bazz", strings.GetString(4));
+  ASSERT_EQ(10, strings.value_offset(5));
+  ASSERT_EQ(4, strings.value_length(4));
+
+  LargeStringBuilder other;
+  ASSERT_OK(other.Append("bar"));
+  ASSERT_OK(other.Append("bazz"));
+  std::shared_ptr<Array> tail;
+  ASSERT_OK(other.Finish(&tail));
+  ASSERT_TRUE(out->Slice(3)->Equals(tail));
+  ASSERT_TRUE(out->RangeEquals(3, 5, 0, tail));
+  ASSERT_FALSE(out->Slice(2)->Equals(tail));
+}
+
+TEST(TestLargeListArray, Basics) {
+  auto value_builder = std::make_shared<Int16Builder>();
+  LargeListBuilder builder(default_memory_pool(), value_builder);
+  const std::vector<int16_t> values = {1, 2, 3, 4, 5};
+  ASSERT_OK(builder.Append());
+  ASSERT_OK(value_builder->AppendValues(values.data(), 3));
+  ASSERT_OK(builder.AppendNull());
+  ASSERT_OK(builder.Append());
+  ASSERT_OK(builder.Append());
+  ASSERT_OK(value_builder->AppendValues(values.data() + 3, 2));
+
+  std::shared_ptr<Array> out;
+  FinishAndCheckPadding(&builder, &out);
+  ASSERT_OK(ValidateArray(*out));
+  ASSERT_TRUE(out->type()->Equals(large_list(int16())));
+
+  const auto& lists = checked_cast<const LargeListArray&>(*out);
+  ASSERT_EQ(4, lists.length());
+  ASSERT_EQ(1, lists.null_count());
+  ASSERT_EQ(3, lists.value_offset(2));
+  ASSERT_EQ(0, lists.value_length(2));
+  ASSERT_EQ(2, lists.value_length(3));
+
+  std::shared_ptr<Array> offsets, rebuilt;
+  ArrayFromVector<Int64Type, int64_t>({0, 3, 3, 3, 5}, &offsets);
+  ASSERT_OK(LargeListArray::FromArrays(*offsets, *lists.values(), default_memory_pool(),
+                                       &rebuilt));
+  ASSERT_TRUE(rebuilt->Slice(2)->Equals(out->Slice(2)));
+  ASSERT_FALSE(rebuilt->Equals(out));
+  ASSERT_TRUE(out->Slice(1)->Equals(out->Slice(1)));
+}
+
+TEST(TestFixedSizeListArray, Basics) {
+  auto value_builder = std::make_shared<Int32Builder>();
+  FixedSizeListBuilder builder(default_memory_pool(), value_builder, 2);
+  ASSERT_TRUE(builder.type()->Equals(fixed_size_list(int32(), 2)));
+  const std::vector<int32_t> values = {1, 2, 0, 0, 3, 4, 5, 6};
+  const std::vector<uint8_t> valid_bytes = {1, 0, 1, 1};
+  ASSERT_OK(builder.AppendValues(4, valid_bytes.data()));
+  ASSERT_OK(value_builder->AppendValues(values.data(), values.size()));
+
+  std::shared_ptr<Array> out;
+  FinishAndCheckPadding(&builder, &out);
+  ASSERT_OK(ValidateArray(*out));
+
+  const auto& lists = checked_cast<const FixedSizeListArray&>(*out);
+  ASSERT_EQ(4, lists.length());
+  ASSERT_EQ(1, lists.null_count());
+  ASSERT_EQ(2, lists.list_size());
+  ASSERT_EQ(4, lists.value_offset(2));
+
+  // Slicing shifts the values seen by the lists
+  auto slice = std::static_pointer_cast<FixedSizeListArray>(out->Slice(2));
+  ASSERT_EQ(4, slice->value_offset(0));
+
+  std::shared_ptr<Array> child, tail;
+  ArrayFromVector<Int32Type, int32_t>({3, 4, 5, 6}, &child);
+  ASSERT_OK(FixedSizeListArray::FromArrays(child, 2, &tail));
+  ASSERT_TRUE(slice->Equals(tail));
+  ASSERT_TRUE(out->RangeEquals(2, 4, 0, tail));
+  ASSERT_FALSE(out->RangeEquals(0, 1, 0, tail));
+
+  // Null lists still hold list_size values, which aren't compared
+  std::shared_ptr<Array> other;
+  std::vector<int32_t> other_values = values;
+  other_values[2] = 7;
+  ASSERT_OK(builder.AppendValues(4, valid_bytes.data()));
+  ASSERT_OK(value_builder->AppendValues(other_values.data(), other_values.size()));
+  ASSERT_OK(builder.Finish(&other));
+  ASSERT_TRUE(out->Equals(other));
+}
+
+TEST(TestFixedSizeListArray, Invalid) {
+  auto value_builder = std::make_shared<Int32Builder>();
+  FixedSizeListBuilder builder(default_memory_pool(), value_builder, 3);
+  ASSERT_OK(builder.Append());
+  ASSERT_OK(value_builder->Append(1));
+  std::shared_ptr<Array> out;
+  ASSERT_RAISES(Invalid, builder.Finish(&out));
+
+  std::shared_ptr<Array> child;
+  ArrayFromVector<Int32Type, int32_t>({1, 2, 3, 4}, &child);
+  ASSERT_RAISES(Invalid, FixedSizeListArray::FromArrays(child, 3, &out));
+
+  auto type = fixed_size_list(int32(), 3);
+  FixedSizeListArray too_short(type, 2, child);
+  ASSERT_RAISES(Invalid, ValidateArray(too_short));
+}
+
+// ----------------------------------------------------------------------
+// RunLengthEncodedArray tests
+
+TEST(TestRunLengthEncodedArray, Basics) {
+  auto value_builder = std::make_shared<Int32Builder>();
+  RunLengthEncodedBuilder builder(default_memory_pool(), value_builder);
+  ASSERT_TRUE(builder.type()->Equals(run_length_encoded(int32())));
+  ASSERT_OK(builder.AppendRun(3));
+  ASSERT_OK(value_builder->Append(7));
+  const std::vector<int32_t> run_lengths = {1, 2};
+  ASSERT_OK(builder.AppendRuns(run_lengths.data(), 2));
+  ASSERT_OK(value_builder->AppendNull());
+  ASSERT_OK(value_builder->Append(8));
+  ASSERT_OK(builder.ExtendLastRun(2));
+  ASSERT_EQ(8, builder.length());
+  ASSERT_EQ(3, builder.num_runs());
+
+  std::shared_ptr<Array> out;
+  FinishAndCheckPadding(&builder, &out);
+  ASSERT_OK(ValidateArray(*out));
+
+  // 7, 7, 7, null, 8, 8, 8, 8
+  const auto& rle = checked_cast<const RunLengthEncodedArray&>(*out);
+  ASSERT_EQ(8, rle.length());
+  ASSERT_EQ(0, rle.null_count());
+  ASSERT_EQ(3, rle.num_runs());
+  ASSERT_EQ(nullptr, rle.null_bitmap_data());
+  ASSERT_EQ(0, rle.FindRun(0));
+  ASSERT_EQ(0, rle.FindRun(2));
+  ASSERT_EQ(1, rle.FindRun(3));
+  ASSERT_EQ(2, rle.FindRun(7));
+
+  std::shared_ptr<Array> run_ends, values, rebuilt;
+  ArrayFromVector<Int32Type, int32_t>({3, 4, 8}, &run_ends);
+  ArrayFromVector<Int32Type, int32_t>({true, false, true}, {7, 0, 8}, &values);
+  ASSERT_OK(RunLengthEncodedArray::FromArrays(*run_ends, values, &rebuilt));
+  ASSERT_TRUE(rebuilt->Equals(out));
+
+  // Slicing leaves the runs alone, and finds them from the offset
+  auto slice = std::static_pointer_cast<RunLengthEncodedArray>(out->Slice(2, 3));
+  ASSERT_OK(ValidateArray(*slice));
+  ASSERT_EQ(0, slice->FindRun(0));
+  ASSERT_EQ(2, slice->FindRun(2));
+  std::vector<std::vector<int64_t>> runs;
+  slice->VisitRuns([&](int64_t run, int64_t position, int64_t run_length) {
+    runs.push_back({run, position, run_length});
+  });
+  ASSERT_EQ(runs, (std::vector<std::vector<int64_t>>{{0, 0, 1}, {1, 1, 1}, {2, 2, 1}}));
+
+  std::shared_ptr<Buffer> rebased_run_ends;
+  std::shared_ptr<Array> rebased_values;
+  ASSERT_OK(slice->RebaseRuns(default_memory_pool(), &rebased_run_ends, &rebased_values));
+  ASSERT_OK(RunLengthEncodedArray::FromArrays(Int32Array(3, rebased_run_ends),
+                                              rebased_values, &rebuilt));
+  ASSERT_TRUE(rebuilt->Equals(slice));
+
+  // Arrays are equal slot by slot, whatever their runs
+  ArrayFromVector<Int32Type, int32_t>({1, 2, 3, 4, 6, 8}, &run_ends);
+  ArrayFromVector<Int32Type, int32_t>({true, true, true, false, true, true},
+                                      {7, 7, 7, 0, 8, 8}, &values);
+  ASSERT_OK(RunLengthEncodedArray::FromArrays(*run_ends, values, &rebuilt));
+  ASSERT_TRUE(rebuilt->Equals(out));
+  ASSERT_TRUE(out->RangeEquals(2, 5, 2, rebuilt));
+  ASSERT_FALSE(out->RangeEquals(2, 5, 3, rebuilt));
+  ASSERT_FALSE(out->Slice(1)->Equals(rebuilt->Slice(2)));
+}
+
+TEST(TestRunLengthEncodedArray, Invalid) {
+  auto value_builder = std::make_shared<Int32Builder>();
+  RunLengthEncodedBuilder builder(default_memory_pool(), value_builder);
+  ASSERT_RAISES(Invalid, builder.AppendRun(0));
+  ASSERT_RAISES(Invalid, builder.ExtendLastRun(1));
+  ASSERT_OK(builder.AppendRun(2));
+  ASSERT_RAISES(CapacityError, builder.AppendRun(std::numeric_limits<int32_t>::max()));
+  std::shared_ptr<Array> out;
+  ASSERT_RAISES(Invalid, builder.Finish(&out));
+
+  std::shared_ptr<Array> run_ends, values;
+  ArrayFromVector<Int32Type, int32_t>({1, 2, 3}, &values);
+  ArrayFromVector<Int32Type, int32_t>({2, 2, 3}, &run_ends);
+  ASSERT_RAISES(Invalid, RunLengthEncodedArray::FromArrays(*run_ends, values, &out));
+  ArrayFromVector<Int32Type, int32_t>({2, 3}, &run_ends);
+  ASSERT_RAISES(Invalid, RunLengthEncodedArray::FromArrays(*run_ends, values, &out));
+  ArrayFromVector<Int32Type, int32_t>({true, false, true}, {1, 2, 3}, &run_ends);
+  ASSERT_RAISES(Invalid, RunLengthEncodedArray::FromArrays(*run_ends, values, &out));
+
+  // The runs must cover the array
+  ArrayFromVector<Int32Type, int32_t>({1, 2, 3}, &run_ends);
+  RunLengthEncodedArray too_long(run_length_encoded(int32()), 4,
+                                 run_ends->data()->buffers[1], values);
+  ASSERT_RAISES(Invalid, ValidateArray(too_long));
+}
+
 // ----------------------------------------------------------------------
 // DictionaryArray tests
 
@@ -3629,6 +4188,120 @@ TEST(TestUnionArrayAdHoc, TestSliceEquals) {
   CheckUnion(batch->column(2));
 }
 
+class TestUnionBuilder : public TestBuilder {
+ public:
+  void MakeBuilder(UnionMode::type mode) {
+    type_ = union_({field("ints", int32()), field("strs", utf8())}, {5, 2}, mode);
+    std::unique_ptr<ArrayBuilder> builder;
+    ASSERT_OK(::arrow::MakeBuilder(pool_, type_, &builder));
+    builder_.reset(checked_cast<UnionBuilder*>(builder.release()));
+    ASSERT_EQ(2, builder_->num_fields());
+    ints_ = checked_cast<Int32Builder*>(builder_->child_builder(0));
+    strs_ = checked_cast<StringBuilder*>(builder_->child_builder(1));
+  }
+
+ protected:
+  std::shared_ptr<DataType> type_;
+  std::unique_ptr<UnionBuilder> builder_;
+  Int32Builder* ints_;
+  StringBuilder* strs_;
+};
+
+TEST_F(TestUnionBuilder, Dense) {
+  MakeBuilder(UnionMode::DENSE);
+  ASSERT_OK(builder_->Append(5));
+  ASSERT_OK(ints_->Append(1));
+  ASSERT_OK(builder_->Append(2));
+  ASSERT_OK(strs_->Append("a"));
+  ASSERT_OK(builder_->AppendNull());
+  ASSERT_OK(builder_->Append(5));
+  ASSERT_OK(ints_->Append(2));
+
+  // Bulk append, the values of the children being appended separately
+  const uint8_t type_codes[] = {2, 2, 5, 2};
+  const uint8_t valid_bytes[] = {1, 0, 1, 1};
+  ASSERT_OK(builder_->AppendValues(type_codes, 4, valid_bytes));
+  ASSERT_OK(strs_->Append("b"));
+  ASSERT_OK(strs_->Append("c"));
+  ASSERT_OK(ints_->Append(3));
+
+  // Explicit offsets may refer to the same values again
+  const uint8_t more_codes[] = {5, 2};
+  const int32_t more_offsets[] = {0, 2};
+  ASSERT_OK(builder_->AppendValues(more_codes, more_offsets, 2));
+
+  std::shared_ptr<Array> out;
+  ASSERT_OK(builder_->Finish(&out));
+  ASSERT_OK(ValidateArray(*out));
+  const auto& array = checked_cast<const UnionArray&>(*out);
+  ASSERT_EQ(10, array.length());
+  ASSERT_EQ(2, array.null_count());
+  ASSERT_TRUE(array.IsNull(2));
+  ASSERT_TRUE(array.IsNull(5));
+  const std::vector<uint8_t> expected_codes = {5, 2, 5, 5, 2, 2, 5, 2, 5, 2};
+  const std::vector<int32_t> expected_offsets = {0, 0, 0, 1, 1, 0, 2, 2, 0, 2};
+  for (int64_t i = 0; i < array.length(); ++i) {
+    ASSERT_EQ(expected_codes[i], array.raw_type_ids()[i]) << i;
+    ASSERT_EQ(expected_offsets[i], array.value_offset(i)) << i;
+  }
+  ASSERT_EQ(3, array.child(0)->length());
+  ASSERT_EQ(3, array.child(1)->length());
+  ASSERT_EQ(0, builder_->length());
+}
+
+TEST_F(TestUnionBuilder, Sparse) {
+  MakeBuilder(UnionMode::SPARSE);
+  ASSERT_OK(builder_->Append(5));
+  ASSERT_OK(ints_->Append(1));
+  ASSERT_OK(strs_->AppendNull());
+  ASSERT_OK(builder_->AppendNull());
+  ASSERT_OK(ints_->AppendNull());
+  ASSERT_OK(strs_->AppendNull());
+  const uint8_t type_codes[] = {2, 5};
+  ASSERT_OK(builder_->AppendValues(type_codes, 2));
+  ASSERT_OK(ints_->AppendNull());
+  ASSERT_OK(ints_->Append(3));
+  ASSERT_OK(strs_->Append("a"));
+  ASSERT_OK(strs_->AppendNull());
+
+  std::shared_ptr<Array> out;
+  ASSERT_OK(builder_->Finish(&out));
+  ASSERT_OK(ValidateArray(*out));
+  const auto& array = checked_cast<const UnionArray&>(*out);
+  ASSERT_EQ(4, array.length());
+  ASSERT_EQ(1, array.null_count());
+  ASSERT_EQ(nullptr, array.value_offsets());
+  ASSERT_EQ(5, array.raw_type_ids()[0]);
+  ASSERT_EQ(2, array.raw_type_ids()[2]);
+  ASSERT_EQ(5, array.raw_type_ids()[3]);
+  ASSERT_EQ(4, array.child(0)->length());
+  ASSERT_EQ(4, array.child(1)->length());
+
+  // Offsets are for dense unions only
+  const int32_t offsets[] = {0};
+  ASSERT_RAISES(Invalid, builder_->AppendValues(type_codes, offsets, 1));
+}
+
+TEST_F(TestUnionBuilder, Invalid) {
+  MakeBuilder(UnionMode::DENSE);
+  // Type codes not in the type
+  ASSERT_RAISES(Invalid, builder_->Append(0));
+  const uint8_t type_codes[] = {5, 3};
+  ASSERT_RAISES(Invalid, builder_->AppendValues(type_codes, 2));
+  ASSERT_EQ(0, builder_->length());
+
+  // Slots referring to child values that were not appended
+  std::shared_ptr<Array> out;
+  ASSERT_OK(builder_->Append(5));
+  ASSERT_RAISES(Invalid, builder_->Finish(&out));
+
+  // Sparse children of other lengths than the union
+  MakeBuilder(UnionMode::SPARSE);
+  ASSERT_OK(builder_->Append(2));
+  ASSERT_OK(strs_->Append("a"));
+  ASSERT_RAISES(Invalid, builder_->Finish(&out));
+}
+
 using DecimalVector = std::vector<Decimal128>;
 
 class DecimalTest : public ::testing::TestWithParam<int> {
@@ -3797,4 +4470,55 @@ TEST(TestRechunkArraysConsistently, Plain) {
   }
 }
 
+// ----------------------------------------------------------------------
+// Test finishing several builders into a chunked array
+
+TEST(TestFinishBuilders, FromThreads) {
+  const int kNumBuilders = 4;
+  const int kValuesPerBuilder = 1000;
+  std::vector<std::unique_ptr<Int32Builder>> builders;
+  std::vector<ArrayBuilder*> builder_ptrs;
+  for (int i = 0; i < kNumBuilders; ++i) {
+    builders.emplace_back(new Int32Builder);
+    builder_ptrs.push_back(builders.back().get());
+  }
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kNumBuilders; ++i) {
+    threads.emplace_back([&builders, i]() {
+      for (int j = 0; j < kValuesPerBuilder; ++j) {
+        ARROW_CHECK_OK(builders[i]->Append(i * kValuesPerBuilder + j));
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  std::shared_ptr<ChunkedArray> result;
+  ASSERT_OK(FinishBuilders(builder_ptrs, &result));
+  ASSERT_EQ(kNumBuilders, result->num_chunks());
+  ASSERT_EQ(kNumBuilders * kValuesPerBuilder, result->length());
+  for (int i = 0; i < kNumBuilders; ++i) {
+    const auto& chunk = checked_cast<const Int32Array&>(*result->chunk(i));
+    ASSERT_EQ(kValuesPerBuilder, chunk.length());
+    ASSERT_EQ(i * kValuesPerBuilder, chunk.Value(0));
+  }
+  // The builders were reset
+  ASSERT_EQ(0, builders[0]->length());
+
+  // Serial finishing gives empty chunks from the reset builders
+  ASSERT_OK(FinishBuilders(builder_ptrs, &result, false /* use_threads */));
+  ASSERT_EQ(0, result->length());
+}
+
+TEST(TestFinishBuilders, Invalid) {
+  std::shared_ptr<ChunkedArray> result;
+  ASSERT_RAISES(Invalid, FinishBuilders({}, &result));
+
+  Int32Builder int_builder;
+  StringBuilder string_builder;
+  ASSERT_RAISES(Invalid, FinishBuilders({&int_builder, &string_builder}, &result));
+}
+
 }  // namespace arrow
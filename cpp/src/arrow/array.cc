@@ -23,6 +23,7 @@
 #include <limits>
 #include <set>
 #include <sstream>
+#include <type_traits>
 #include <utility>
 
 #include "arrow/buffer.h"
@@ -73,12 +74,34 @@ std::shared_ptr<ArrayData> ArrayData::Make(const std::shared_ptr<DataType>& type
 // ----------------------------------------------------------------------
 // Base array class
 
+// Validity bitmaps of at least this many bits cache their counts
+static constexpr int64_t kMinCountedBitmapBits = 16 * internal::BitmapCounts::kBlockBits;
+
+// The number of valid slots of a range of a validity bitmap, from the counts
+// cached on its buffer so that the null counts of the slices of a large array
+// take O(blocks) rather than a popcount of each. The bitmap is counted up to
+// the end of the range when the range is at least an eighth of that, so that
+// the counts cost at most eight times the popcount of the range.
+static int64_t CountValidSlots(const Buffer& bitmap, int64_t offset, int64_t length) {
+  const uint8_t* data = bitmap.data();
+  const int64_t end = offset + length;
+  std::shared_ptr<const internal::BitmapCounts> counts = bitmap.bitmap_counts();
+  if (counts == nullptr || counts->length() < end) {
+    if (end < kMinCountedBitmapBits || length < end / 8) {
+      return CountSetBits(data, offset, length);
+    }
+    counts = std::make_shared<internal::BitmapCounts>(data, end);
+    bitmap.set_bitmap_counts(counts);
+  }
+  return counts->CountSetBits(data, offset, length);
+}
+
 int64_t Array::null_count() const {
   if (ARROW_PREDICT_FALSE(data_->null_count < 0)) {
     if (data_->buffers[0]) {
-      data_->null_count =
-          data_->length - CountSetBits(null_bitmap_data_, data_->offset, data_->length);
-
+      const int64_t num_valid =
+          CountValidSlots(*data_->buffers[0], data_->offset, data_->length);
+      data_->null_count = data_->length - num_valid;
     } else {
       data_->null_count = 0;
     }
@@ -126,7 +149,7 @@ static inline std::shared_ptr<ArrayData> SliceData(const ArrayData& data, int64_
   auto new_data = data.Copy();
   new_data->length = length;
   new_data->offset = offset;
-  new_data->null_count = data.null_count != 0 ? kUnknownNullCount : 0;
+  new_data->null_count = internal::SliceNullCount(data, length);
   return new_data;
 }
 
@@ -197,26 +220,39 @@ ListArray::ListArray(const std::shared_ptr<DataType>& type, int64_t length,
   SetData(internal_data);
 }
 
-Status ListArray::FromArrays(const Array& offsets, const Array& values, MemoryPool* pool,
-                             std::shared_ptr<Array>* out) {
+namespace {
+
+// Build a list array of type TYPE from an array of offsets of the same width
+template <typename TYPE>
+Status ListArrayFromArrays(const Array& offsets, const Array& values, MemoryPool* pool,
+                           std::shared_ptr<Array>* out) {
+  using offset_type = typename TYPE::offset_type;
+  using ArrayType = typename TypeTraits<TYPE>::ArrayType;
+  using OffsetArrowType = typename std::conditional<sizeof(offset_type) == 4, Int32Type,
+                                                     Int64Type>::type;
+  using OffsetArrayType = NumericArray<OffsetArrowType>;
+
   if (offsets.length() == 0) {
     return Status::Invalid("List offsets must have non-zero length");
   }
 
-  if (offsets.type_id() != Type::INT32) {
-    return Status::Invalid("List offsets must be signed int32");
+  if (offsets.type_id() != OffsetArrowType::type_id) {
+    std::stringstream ss;
+    ss << "List offsets must be signed int" << sizeof(offset_type) * 8;
+    return Status::Invalid(ss.str());
   }
 
   BufferVector buffers = {};
 
-  const auto& typed_offsets = checked_cast<const Int32Array&>(offsets);
+  const auto& typed_offsets = checked_cast<const OffsetArrayType&>(offsets);
 
   const int64_t num_offsets = offsets.length();
 
   if (offsets.null_count() > 0) {
     std::shared_ptr<Buffer> clean_offsets, clean_valid_bits;
 
-    RETURN_NOT_OK(AllocateBuffer(pool, num_offsets * sizeof(int32_t), &clean_offsets));
+    RETURN_NOT_OK(
+        AllocateBuffer(pool, num_offsets * sizeof(offset_type), &clean_offsets));
 
     // Copy valid bits, zero out the bit for the final offset
     RETURN_NOT_OK(offsets.null_bitmap()->Copy(0, BitUtil::BytesForBits(num_offsets - 1),
@@ -224,12 +260,12 @@ Status ListArray::FromArrays(const Array& offsets, const Array& values, MemoryPo
     BitUtil::ClearBit(clean_valid_bits->mutable_data(), num_offsets);
     buffers.emplace_back(std::move(clean_valid_bits));
 
-    const int32_t* raw_offsets = typed_offsets.raw_values();
-    auto clean_raw_offsets = reinterpret_cast<int32_t*>(clean_offsets->mutable_data());
+    const offset_type* raw_offsets = typed_offsets.raw_values();
+    auto clean_raw_offsets = reinterpret_cast<offset_type*>(clean_offsets->mutable_data());
 
     // Must work backwards so we can tell how many values were in the last non-null value
     DCHECK(offsets.IsValid(num_offsets - 1));
-    int32_t current_offset = raw_offsets[num_offsets - 1];
+    offset_type current_offset = raw_offsets[num_offsets - 1];
     for (int64_t i = num_offsets - 1; i >= 0; --i) {
       if (offsets.IsValid(i)) {
         current_offset = raw_offsets[i];
@@ -243,15 +279,22 @@ Status ListArray::FromArrays(const Array& offsets, const Array& values, MemoryPo
     buffers.emplace_back(typed_offsets.values());
   }
 
-  auto list_type = list(values.type());
+  auto list_type = std::make_shared<TYPE>(values.type());
   auto internal_data = ArrayData::Make(list_type, num_offsets - 1, std::move(buffers),
                                        offsets.null_count(), offsets.offset());
   internal_data->child_data.push_back(values.data());
 
-  *out = std::make_shared<ListArray>(internal_data);
+  *out = std::make_shared<ArrayType>(internal_data);
   return Status::OK();
 }
 
+}  // namespace
+
+Status ListArray::FromArrays(const Array& offsets, const Array& values, MemoryPool* pool,
+                             std::shared_ptr<Array>* out) {
+  return ListArrayFromArrays<ListType>(offsets, values, pool, out);
+}
+
 void ListArray::SetData(const std::shared_ptr<ArrayData>& data) {
   this->Array::SetData(data);
   DCHECK_EQ(data->buffers.size(), 2);
@@ -271,6 +314,198 @@ std::shared_ptr<DataType> ListArray::value_type() const {
 
 std::shared_ptr<Array> ListArray::values() const { return values_; }
 
+// ----------------------------------------------------------------------
+// LargeListArray
+
+LargeListArray::LargeListArray(const std::shared_ptr<ArrayData>& data) {
+  DCHECK_EQ(data->type->id(), Type::LARGE_LIST);
+  SetData(data);
+}
+
+LargeListArray::LargeListArray(const std::shared_ptr<DataType>& type, int64_t length,
+                               const std::shared_ptr<Buffer>& value_offsets,
+                               const std::shared_ptr<Array>& values,
+                               const std::shared_ptr<Buffer>& null_bitmap,
+                               int64_t null_count, int64_t offset) {
+  auto internal_data =
+      ArrayData::Make(type, length, {null_bitmap, value_offsets}, null_count, offset);
+  internal_data->child_data.emplace_back(values->data());
+  SetData(internal_data);
+}
+
+Status LargeListArray::FromArrays(const Array& offsets, const Array& values,
+                                  MemoryPool* pool, std::shared_ptr<Array>* out) {
+  return ListArrayFromArrays<LargeListType>(offsets, values, pool, out);
+}
+
+void LargeListArray::SetData(const std::shared_ptr<ArrayData>& data) {
+  this->Array::SetData(data);
+  DCHECK_EQ(data->buffers.size(), 2);
+
+  auto value_offsets = data->buffers[1];
+  raw_value_offsets_ = value_offsets == nullptr
+                           ? nullptr
+                           : reinterpret_cast<const int64_t*>(value_offsets->data());
+
+  DCHECK_EQ(data_->child_data.size(), 1);
+  values_ = MakeArray(data_->child_data[0]);
+}
+
+std::shared_ptr<DataType> LargeListArray::value_type() const {
+  return checked_cast<const LargeListType&>(*type()).value_type();
+}
+
+std::shared_ptr<Array> LargeListArray::values() const { return values_; }
+
+// ----------------------------------------------------------------------
+// FixedSizeListArray
+
+FixedSizeListArray::FixedSizeListArray(const std::shared_ptr<ArrayData>& data) {
+  DCHECK_EQ(data->type->id(), Type::FIXED_SIZE_LIST);
+  SetData(data);
+}
+
+FixedSizeListArray::FixedSizeListArray(const std::shared_ptr<DataType>& type,
+                                       int64_t length,
+                                       const std::shared_ptr<Array>& values,
+                                       const std::shared_ptr<Buffer>& null_bitmap,
+                                       int64_t null_count, int64_t offset) {
+  auto internal_data = ArrayData::Make(type, length, {null_bitmap}, null_count, offset);
+  internal_data->child_data.emplace_back(values->data());
+  SetData(internal_data);
+}
+
+Status FixedSizeListArray::FromArrays(const std::shared_ptr<Array>& values,
+                                      int32_t list_size, std::shared_ptr<Array>* out) {
+  if (list_size <= 0) {
+    return Status::Invalid("Fixed size lists must have a positive size");
+  }
+  if (values->length() % list_size != 0) {
+    std::stringstream ss;
+    ss << "The length of the values, " << values->length()
+       << ", is not a multiple of the list size " << list_size;
+    return Status::Invalid(ss.str());
+  }
+  *out = std::make_shared<FixedSizeListArray>(fixed_size_list(values->type(), list_size),
+                                              values->length() / list_size, values);
+  return Status::OK();
+}
+
+void FixedSizeListArray::SetData(const std::shared_ptr<ArrayData>& data) {
+  this->Array::SetData(data);
+  DCHECK_EQ(data->buffers.size(), 1);
+  list_size_ = checked_cast<const FixedSizeListType&>(*data->type).list_size();
+
+  DCHECK_EQ(data_->child_data.size(), 1);
+  values_ = MakeArray(data_->child_data[0]);
+}
+
+std::shared_ptr<DataType> FixedSizeListArray::value_type() const {
+  return checked_cast<const FixedSizeListType&>(*type()).value_type();
+}
+
+std::shared_ptr<Array> FixedSizeListArray::values() const { return values_; }
+
+// ----------------------------------------------------------------------
+// RunLengthEncodedArray
+
+RunLengthEncodedArray::RunLengthEncodedArray(const std::shared_ptr<ArrayData>& data) {
+  DCHECK_EQ(data->type->id(), Type::RUN_LENGTH_ENCODED);
+  SetData(data);
+}
+
+RunLengthEncodedArray::RunLengthEncodedArray(const std::shared_ptr<DataType>& type,
+                                             int64_t length,
+                                             const std::shared_ptr<Buffer>& run_ends,
+                                             const std::shared_ptr<Array>& values,
+                                             int64_t offset) {
+  auto internal_data =
+      ArrayData::Make(type, length, {nullptr, run_ends}, /*null_count=*/0, offset);
+  internal_data->child_data.emplace_back(values->data());
+  SetData(internal_data);
+}
+
+Status RunLengthEncodedArray::FromArrays(const Array& run_ends,
+                                         const std::shared_ptr<Array>& values,
+                                         std::shared_ptr<Array>* out) {
+  if (run_ends.type_id() != Type::INT32) {
+    return Status::TypeError("Run ends must be int32");
+  }
+  if (run_ends.null_count() > 0) {
+    return Status::Invalid("Run ends must not contain nulls");
+  }
+  if (run_ends.length() != values->length()) {
+    std::stringstream ss;
+    ss << "There are " << run_ends.length() << " run ends for " << values->length()
+       << " values";
+    return Status::Invalid(ss.str());
+  }
+  const auto& typed_run_ends = checked_cast<const Int32Array&>(run_ends);
+  const int64_t length =
+      run_ends.length() == 0 ? 0 : typed_run_ends.Value(run_ends.length() - 1);
+
+  std::shared_ptr<Buffer> run_ends_buffer = run_ends.data()->buffers[1];
+  if (run_ends.offset() != 0) {
+    run_ends_buffer = SliceBuffer(run_ends_buffer, run_ends.offset() * sizeof(int32_t),
+                                  run_ends.length() * sizeof(int32_t));
+  }
+  auto result = std::make_shared<RunLengthEncodedArray>(
+      run_length_encoded(values->type()), length, run_ends_buffer, values);
+  RETURN_NOT_OK(ValidateArray(*result));
+  *out = result;
+  return Status::OK();
+}
+
+void RunLengthEncodedArray::SetData(const std::shared_ptr<ArrayData>& data) {
+  this->Array::SetData(data);
+  DCHECK_EQ(data->buffers.size(), 2);
+  auto run_ends = data->buffers[1];
+  raw_run_ends_ =
+      run_ends == nullptr ? nullptr : reinterpret_cast<const int32_t*>(run_ends->data());
+
+  DCHECK_EQ(data_->child_data.size(), 1);
+  values_ = MakeArray(data_->child_data[0]);
+}
+
+std::shared_ptr<DataType> RunLengthEncodedArray::value_type() const {
+  return checked_cast<const RunLengthEncodedType&>(*type()).value_type();
+}
+
+std::shared_ptr<Array> RunLengthEncodedArray::values() const { return values_; }
+
+Status RunLengthEncodedArray::RebaseRuns(MemoryPool* pool,
+                                         std::shared_ptr<Buffer>* run_ends,
+                                         std::shared_ptr<Array>* values) const {
+  const int64_t offset = data_->offset;
+  const int64_t length = data_->length;
+  if (length == 0) {
+    *values = values_->Slice(0, 0);
+    return AllocateBuffer(pool, 0, run_ends);
+  }
+  const int64_t first_run = FindRun(0);
+  const int64_t end_run = FindRun(length - 1) + 1;
+  if (offset == 0 && end_run == num_runs() && raw_run_ends_[end_run - 1] == length) {
+    *run_ends = data_->buffers[1];
+    *values = values_;
+    return Status::OK();
+  }
+  const int64_t rebased_runs = end_run - first_run;
+  RETURN_NOT_OK(AllocateBuffer(pool, rebased_runs * sizeof(int32_t), run_ends));
+  auto out = reinterpret_cast<int32_t*>((*run_ends)->mutable_data());
+  for (int64_t i = 0; i < rebased_runs; ++i) {
+    out[i] = static_cast<int32_t>(
+        std::min<int64_t>(raw_run_ends_[first_run + i], offset + length) - offset);
+  }
+  *values = values_->Slice(first_run, rebased_runs);
+  return Status::OK();
+}
+
+int64_t RunLengthEncodedArray::FindRun(int64_t i) const {
+  // The first run whose end is past the slot
+  const int32_t* end = raw_run_ends_ + num_runs();
+  return std::upper_bound(raw_run_ends_, end, data_->offset + i) - raw_run_ends_;
+}
+
 // ----------------------------------------------------------------------
 // String and binary
 
@@ -317,6 +552,55 @@ StringArray::StringArray(int64_t length, const std::shared_ptr<Buffer>& value_of
                          int64_t offset)
     : BinaryArray(utf8(), length, value_offsets, data, null_bitmap, null_count, offset) {}
 
+// ----------------------------------------------------------------------
+// Large string and binary
+
+LargeBinaryArray::LargeBinaryArray(const std::shared_ptr<ArrayData>& data) {
+  DCHECK_EQ(data->type->id(), Type::LARGE_BINARY);
+  SetData(data);
+}
+
+void LargeBinaryArray::SetData(const std::shared_ptr<ArrayData>& data) {
+  DCHECK_EQ(data->buffers.size(), 3);
+  auto value_offsets = data->buffers[1];
+  auto value_data = data->buffers[2];
+  this->Array::SetData(data);
+  raw_data_ = value_data == nullptr ? nullptr : value_data->data();
+  raw_value_offsets_ = value_offsets == nullptr
+                           ? nullptr
+                           : reinterpret_cast<const int64_t*>(value_offsets->data());
+}
+
+LargeBinaryArray::LargeBinaryArray(int64_t length,
+                                   const std::shared_ptr<Buffer>& value_offsets,
+                                   const std::shared_ptr<Buffer>& data,
+                                   const std::shared_ptr<Buffer>& null_bitmap,
+                                   int64_t null_count, int64_t offset)
+    : LargeBinaryArray(large_binary(), length, value_offsets, data, null_bitmap,
+                       null_count, offset) {}
+
+LargeBinaryArray::LargeBinaryArray(const std::shared_ptr<DataType>& type, int64_t length,
+                                   const std::shared_ptr<Buffer>& value_offsets,
+                                   const std::shared_ptr<Buffer>& data,
+                                   const std::shared_ptr<Buffer>& null_bitmap,
+                                   int64_t null_count, int64_t offset) {
+  SetData(ArrayData::Make(type, length, {null_bitmap, value_offsets, data}, null_count,
+                          offset));
+}
+
+LargeStringArray::LargeStringArray(const std::shared_ptr<ArrayData>& data) {
+  DCHECK_EQ(data->type->id(), Type::LARGE_STRING);
+  SetData(data);
+}
+
+LargeStringArray::LargeStringArray(int64_t length,
+                                   const std::shared_ptr<Buffer>& value_offsets,
+                                   const std::shared_ptr<Buffer>& data,
+                                   const std::shared_ptr<Buffer>& null_bitmap,
+                                   int64_t null_count, int64_t offset)
+    : LargeBinaryArray(large_utf8(), length, value_offsets, data, null_bitmap,
+                       null_count, offset) {}
+
 // ----------------------------------------------------------------------
 // Fixed width binary
 
@@ -643,6 +927,108 @@ void DictionaryArray::SetData(const std::shared_ptr<ArrayData>& data) {
   indices_ = MakeArray(indices_data);
 }
 
+namespace {
+
+template <typename InType, typename OutType>
+void TransposeIndices(const ArrayData& in_data, int64_t null_count,
+                      const int32_t* transpose_map, uint8_t* out) {
+  using in_c_type = typename InType::c_type;
+  using out_c_type = typename OutType::c_type;
+  const in_c_type* src =
+      reinterpret_cast<const in_c_type*>(in_data.buffers[1]->data()) + in_data.offset;
+  out_c_type* dest = reinterpret_cast<out_c_type*>(out) + in_data.offset;
+  const int64_t length = in_data.length;
+
+  if (null_count == 0) {
+    for (int64_t i = 0; i < length; ++i) {
+      dest[i] = static_cast<out_c_type>(transpose_map[src[i]]);
+    }
+  } else {
+    // Indices under null slots may be garbage and must not be looked up
+    internal::BitmapReader valid_reader(in_data.buffers[0]->data(), in_data.offset,
+                                        length);
+    for (int64_t i = 0; i < length; ++i) {
+      dest[i] = valid_reader.IsSet() ? static_cast<out_c_type>(transpose_map[src[i]])
+                                     : out_c_type(0);
+      valid_reader.Next();
+    }
+  }
+}
+
+template <typename InType>
+Status TransposeIndicesTo(const DataType& out_index_type, const ArrayData& in_data,
+                          int64_t null_count, const int32_t* transpose_map,
+                          uint8_t* out) {
+  switch (out_index_type.id()) {
+    case Type::INT8:
+      TransposeIndices<InType, Int8Type>(in_data, null_count, transpose_map, out);
+      break;
+    case Type::INT16:
+      TransposeIndices<InType, Int16Type>(in_data, null_count, transpose_map, out);
+      break;
+    case Type::INT32:
+      TransposeIndices<InType, Int32Type>(in_data, null_count, transpose_map, out);
+      break;
+    case Type::INT64:
+      TransposeIndices<InType, Int64Type>(in_data, null_count, transpose_map, out);
+      break;
+    default:
+      std::stringstream ss;
+      ss << "Categorical index type not supported: " << out_index_type.ToString();
+      return Status::NotImplemented(ss.str());
+  }
+  return Status::OK();
+}
+
+}  // namespace
+
+Status DictionaryArray::Transpose(MemoryPool* pool, const std::shared_ptr<DataType>& type,
+                                  const int32_t* transpose_map,
+                                  std::shared_ptr<Array>* out) const {
+  DCHECK_EQ(type->id(), Type::DICTIONARY);
+  const DataType& out_index_type =
+      *checked_cast<const DictionaryType&>(*type).index_type();
+  const int64_t out_width =
+      checked_cast<const FixedWidthType&>(out_index_type).bit_width() / 8;
+
+  // Keep the offset so that the validity bitmap can be shared
+  std::shared_ptr<Buffer> out_buffer;
+  RETURN_NOT_OK(AllocateBuffer(pool, (data_->offset + data_->length) * out_width,
+                               &out_buffer));
+  uint8_t* out_data = out_buffer->mutable_data();
+  const int64_t nulls = null_count();
+
+  switch (dict_type_->index_type()->id()) {
+    case Type::INT8:
+      RETURN_NOT_OK(TransposeIndicesTo<Int8Type>(out_index_type, *data_, nulls,
+                                                 transpose_map, out_data));
+      break;
+    case Type::INT16:
+      RETURN_NOT_OK(TransposeIndicesTo<Int16Type>(out_index_type, *data_, nulls,
+                                                  transpose_map, out_data));
+      break;
+    case Type::INT32:
+      RETURN_NOT_OK(TransposeIndicesTo<Int32Type>(out_index_type, *data_, nulls,
+                                                  transpose_map, out_data));
+      break;
+    case Type::INT64:
+      RETURN_NOT_OK(TransposeIndicesTo<Int64Type>(out_index_type, *data_, nulls,
+                                                  transpose_map, out_data));
+      break;
+    default:
+      std::stringstream ss;
+      ss << "Categorical index type not supported: "
+         << dict_type_->index_type()->ToString();
+      return Status::NotImplemented(ss.str());
+  }
+
+  auto transposed = ArrayData::Make(type, data_->length,
+                                      {data_->buffers[0], out_buffer}, nulls,
+                                      data_->offset);
+  *out = MakeArray(transposed);
+  return Status::OK();
+}
+
 std::shared_ptr<Array> DictionaryArray::indices() const { return indices_; }
 
 std::shared_ptr<Array> DictionaryArray::dictionary() const {
@@ -691,7 +1077,99 @@ struct ValidateVisitor {
     return Status::OK();
   }
 
-  Status Visit(const ListArray& array) {
+  Status Visit(const LargeBinaryArray& array) {
+    if (array.data()->buffers.size() != 3) {
+      return Status::Invalid("number of buffers was != 3");
+    }
+    return Status::OK();
+  }
+
+  Status Visit(const ListArray& array) { return ValidateOffsets(array); }
+
+  Status Visit(const LargeListArray& array) { return ValidateOffsets(array); }
+
+  Status Visit(const FixedSizeListArray& array) {
+    if (array.length() < 0) {
+      return Status::Invalid("Length was negative");
+    }
+    if (array.list_size() <= 0) {
+      return Status::Invalid("List size was not positive");
+    }
+    if (!array.values()) {
+      return Status::Invalid("values was null");
+    }
+    if (array.values()->length() < array.value_offset(array.length())) {
+      std::stringstream ss;
+      ss << "Values length " << array.values()->length() << " is less than "
+         << array.value_offset(array.length()) << " for " << array.length()
+         << " lists of size " << array.list_size() << " at offset "
+         << array.offset();
+      return Status::Invalid(ss.str());
+    }
+    const Status child_valid = ValidateArray(*array.values());
+    if (!child_valid.ok()) {
+      std::stringstream ss;
+      ss << "Child array invalid: " << child_valid.ToString();
+      return Status::Invalid(ss.str());
+    }
+    return Status::OK();
+  }
+
+  Status Visit(const RunLengthEncodedArray& array) {
+    if (array.length() < 0) {
+      return Status::Invalid("Length was negative");
+    }
+    if (array.data()->buffers.size() != 2) {
+      return Status::Invalid("number of buffers was != 2");
+    }
+    if (array.null_bitmap_data() != nullptr || array.null_count() != 0) {
+      return Status::Invalid("Run-length-encoded arrays have no validity bitmap");
+    }
+    if (!array.values()) {
+      return Status::Invalid("values was null");
+    }
+    const int64_t num_runs = array.num_runs();
+    if (num_runs > 0) {
+      auto run_ends = array.run_ends();
+      if (!run_ends ||
+          run_ends->size() < num_runs * static_cast<int64_t>(sizeof(int32_t))) {
+        std::stringstream ss;
+        ss << "Run ends buffer is too small for " << num_runs << " runs";
+        return Status::Invalid(ss.str());
+      }
+      const int32_t* raw_run_ends = array.raw_run_ends();
+      int32_t prev_end = 0;
+      for (int64_t i = 0; i < num_runs; ++i) {
+        if (raw_run_ends[i] <= prev_end) {
+          std::stringstream ss;
+          ss << "Run end " << raw_run_ends[i] << " at run " << i
+             << " is not greater than the previous one, " << prev_end;
+          return Status::Invalid(ss.str());
+        }
+        prev_end = raw_run_ends[i];
+      }
+    }
+    const int64_t logical_end = array.offset() + array.length();
+    const int64_t last_end = num_runs == 0 ? 0 : array.raw_run_ends()[num_runs - 1];
+    if (last_end < logical_end) {
+      std::stringstream ss;
+      ss << "The runs end at " << last_end << ", before the end of the array at "
+         << logical_end;
+      return Status::Invalid(ss.str());
+    }
+    const Status child_valid = ValidateArray(*array.values());
+    if (!child_valid.ok()) {
+      std::stringstream ss;
+      ss << "Child array invalid: " << child_valid.ToString();
+      return Status::Invalid(ss.str());
+    }
+    return Status::OK();
+  }
+
+  template <typename ArrayType>
+  Status ValidateOffsets(const ArrayType& array) {
+    using offset_type = typename ArrayType::TypeClass::offset_type;
+
     if (array.length() < 0) {
       return Status::Invalid("Length was negative");
     }
@@ -700,7 +1178,7 @@ struct ValidateVisitor {
     if (array.length() && !value_offsets) {
       return Status::Invalid("value_offsets_ was null");
     }
-    if (value_offsets->size() / static_cast<int>(sizeof(int32_t)) < array.length()) {
+    if (value_offsets->size() / static_cast<int>(sizeof(offset_type)) < array.length()) {
       std::stringstream ss;
       ss << "offset buffer size (bytes): " << value_offsets->size()
          << " isn't large enough for length: " << array.length();
@@ -711,7 +1189,7 @@ struct ValidateVisitor {
       return Status::Invalid("values was null");
     }
 
-    const int32_t last_offset = array.value_offset(array.length());
+    const offset_type last_offset = array.value_offset(array.length());
     if (array.values()->length() != last_offset) {
       std::stringstream ss;
       ss << "Final offset invariant not equal to values length: " << last_offset
@@ -726,12 +1204,12 @@ struct ValidateVisitor {
       return Status::Invalid(ss.str());
     }
 
-    int32_t prev_offset = array.value_offset(0);
+    offset_type prev_offset = array.value_offset(0);
     if (prev_offset != 0) {
       return Status::Invalid("The first offset wasn't zero");
     }
     for (int64_t i = 1; i <= array.length(); ++i) {
-      int32_t current_offset = array.value_offset(i);
+      offset_type current_offset = array.value_offset(i);
       if (array.IsNull(i - 1) && current_offset != prev_offset) {
         std::stringstream ss;
         ss << "Offset invariant failure at: " << i
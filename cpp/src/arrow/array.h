@@ -18,6 +18,7 @@
 #ifndef ARROW_ARRAY_H
 #define ARROW_ARRAY_H
 
+#include <algorithm>
 #include <cmath>
 #include <cstdint>
 #include <memory>
@@ -183,6 +184,20 @@ struct ARROW_EXPORT ArrayData {
 ARROW_EXPORT
 std::shared_ptr<Array> MakeArray(const std::shared_ptr<ArrayData>& data);
 
+namespace internal {
+
+/// \brief The null count of a slice of length slice_length of data: known
+/// when data has no nulls or only nulls, otherwise left to be counted
+static inline int64_t SliceNullCount(const ::arrow::ArrayData& data,
+                                     int64_t slice_length) {
+  if (data.null_count == 0) {
+    return 0;
+  }
+  return data.null_count == data.length ? slice_length : kUnknownNullCount;
+}
+
+}  // namespace internal
+
 // ----------------------------------------------------------------------
 // User array accessor types
 
@@ -470,6 +485,173 @@ class ARROW_EXPORT ListArray : public Array {
   std::shared_ptr<Array> values_;
 };
 
+/// \brief Concrete Array class for list data with 64-bit offsets
+class ARROW_EXPORT LargeListArray : public Array {
+ public:
+  using TypeClass = LargeListType;
+
+  explicit LargeListArray(const std::shared_ptr<ArrayData>& data);
+
+  LargeListArray(const std::shared_ptr<DataType>& type, int64_t length,
+                 const std::shared_ptr<Buffer>& value_offsets,
+                 const std::shared_ptr<Array>& values,
+                 const std::shared_ptr<Buffer>& null_bitmap = NULLPTR,
+                 int64_t null_count = 0, int64_t offset = 0);
+
+  /// \brief Construct LargeListArray from array of offsets and child value array
+  ///
+  /// As ListArray::FromArrays, with offsets of int64 type
+  static Status FromArrays(const Array& offsets, const Array& values, MemoryPool* pool,
+                           std::shared_ptr<Array>* out);
+
+  /// \brief Return array object containing the list's values
+  std::shared_ptr<Array> values() const;
+
+  /// Note that this buffer does not account for any slice offset
+  std::shared_ptr<Buffer> value_offsets() const { return data_->buffers[1]; }
+
+  std::shared_ptr<DataType> value_type() const;
+
+  /// Return pointer to raw value offsets accounting for any slice offset
+  const int64_t* raw_value_offsets() const { return raw_value_offsets_ + data_->offset; }
+
+  // Neither of these functions will perform boundschecking
+  int64_t value_offset(int64_t i) const { return raw_value_offsets_[i + data_->offset]; }
+  int64_t value_length(int64_t i) const {
+    i += data_->offset;
+    return raw_value_offsets_[i + 1] - raw_value_offsets_[i];
+  }
+
+ protected:
+  void SetData(const std::shared_ptr<ArrayData>& data);
+  const int64_t* raw_value_offsets_;
+
+ private:
+  std::shared_ptr<Array> values_;
+};
+
+/// \brief Concrete Array class for lists of the same number of values
+///
+/// There is no offsets buffer: the values of slot i start at (offset + i) *
+/// list_size in the child, which is not sliced along with the array.
+class ARROW_EXPORT FixedSizeListArray : public Array {
+ public:
+  using TypeClass = FixedSizeListType;
+
+  explicit FixedSizeListArray(const std::shared_ptr<ArrayData>& data);
+
+  FixedSizeListArray(const std::shared_ptr<DataType>& type, int64_t length,
+                     const std::shared_ptr<Array>& values,
+                     const std::shared_ptr<Buffer>& null_bitmap = NULLPTR,
+                     int64_t null_count = 0, int64_t offset = 0);
+
+  /// \brief Construct FixedSizeListArray from the child value array, cut
+  /// into lists of list_size values
+  ///
+  /// \param[in] values Array whose length is a multiple of list_size
+  /// \param[in] list_size the number of values of each list
+  /// \param[out] out Will have length equal to values.length() / list_size
+  static Status FromArrays(const std::shared_ptr<Array>& values, int32_t list_size,
+                           std::shared_ptr<Array>* out);
+
+  /// \brief Return array object containing the list's values
+  std::shared_ptr<Array> values() const;
+
+  std::shared_ptr<DataType> value_type() const;
+
+  int32_t list_size() const { return list_size_; }
+
+  // Neither of these functions will perform boundschecking
+  int64_t value_offset(int64_t i) const { return (i + data_->offset) * list_size_; }
+  int32_t value_length(int64_t = 0) const { return list_size_; }
+
+ protected:
+  void SetData(const std::shared_ptr<ArrayData>& data);
+  int32_t list_size_;
+
+ private:
+  std::shared_ptr<Array> values_;
+};
+
+// ----------------------------------------------------------------------
+// RunLengthEncodedArray
+
+/// Concrete Array class for run-length-encoded data
+///
+/// The length and offset of the array count logical slots. The run ends and
+/// the values always describe the whole unsliced array, so that slicing does
+/// not touch them. The array has no validity bitmap and a null count of zero;
+/// null slots are runs whose value is null.
+class ARROW_EXPORT RunLengthEncodedArray : public Array {
+ public:
+  using TypeClass = RunLengthEncodedType;
+
+  explicit RunLengthEncodedArray(const std::shared_ptr<ArrayData>& data);
+
+  RunLengthEncodedArray(const std::shared_ptr<DataType>& type, int64_t length,
+                        const std::shared_ptr<Buffer>& run_ends,
+                        const std::shared_ptr<Array>& values, int64_t offset = 0);
+
+  /// \brief Construct RunLengthEncodedArray from the run ends and the values
+  ///
+  /// \param[in] run_ends Int32Array without nulls of strictly increasing
+  /// positive run ends
+  /// \param[in] values Array with a value per run
+  /// \param[out] out Will have length equal to the last run end
+  static Status FromArrays(const Array& run_ends, const std::shared_ptr<Array>& values,
+                           std::shared_ptr<Array>* out);
+
+  /// \brief Return the buffer of int32 run ends of the unsliced array
+  std::shared_ptr<Buffer> run_ends() const { return data_->buffers[1]; }
+
+  const int32_t* raw_run_ends() const { return raw_run_ends_; }
+
+  /// \brief Return array object containing a value per run
+  std::shared_ptr<Array> values() const;
+
+  std::shared_ptr<DataType> value_type() const;
+
+  /// \brief The number of runs of the unsliced array
+  int64_t num_runs() const { return values_->length(); }
+
+  /// \brief Return the index of the run containing slot i, with a binary
+  /// search of the run ends. Does not perform boundschecking
+  int64_t FindRun(int64_t i) const;
+
+  /// \brief Return the run ends and the values of the runs overlapping this
+  /// array, with run ends counted from its offset, as for an unsliced array
+  ///
+  /// The run ends are copied only when the array is sliced.
+  Status RebaseRuns(MemoryPool* pool, std::shared_ptr<Buffer>* run_ends,
+                    std::shared_ptr<Array>* values) const;
+
+  /// \brief Call visit(run_index, position, run_length) for each run
+  /// overlapping this array, clipped to it, with positions counted from the
+  /// array's offset
+  template <typename Visitor>
+  void VisitRuns(Visitor&& visit) const {
+    if (data_->length == 0) {
+      return;
+    }
+    const int64_t end = data_->offset + data_->length;
+    int64_t run = FindRun(0);
+    int64_t position = data_->offset;
+    while (position < end) {
+      const int64_t run_end = std::min<int64_t>(raw_run_ends_[run], end);
+      visit(run, position - data_->offset, run_end - position);
+      position = run_end;
+      ++run;
+    }
+  }
+
+ protected:
+  void SetData(const std::shared_ptr<ArrayData>& data);
+  const int32_t* raw_run_ends_;
+
+ private:
+  std::shared_ptr<Array> values_;
+};
+
 // ----------------------------------------------------------------------
 // Binary and String
 
@@ -560,6 +742,85 @@ class ARROW_EXPORT StringArray : public BinaryArray {
   }
 };
 
+/// \brief Concrete Array class for variable-length binary data with 64-bit
+/// offsets
+class ARROW_EXPORT LargeBinaryArray : public FlatArray {
+ public:
+  using TypeClass = LargeBinaryType;
+
+  explicit LargeBinaryArray(const std::shared_ptr<ArrayData>& data);
+
+  LargeBinaryArray(int64_t length, const std::shared_ptr<Buffer>& value_offsets,
+                   const std::shared_ptr<Buffer>& data,
+                   const std::shared_ptr<Buffer>& null_bitmap = NULLPTR,
+                   int64_t null_count = 0, int64_t offset = 0);
+
+  // Return the pointer to the given elements bytes
+  const uint8_t* GetValue(int64_t i, int64_t* out_length) const {
+    // Account for base offset
+    i += data_->offset;
+
+    const int64_t pos = raw_value_offsets_[i];
+    *out_length = raw_value_offsets_[i + 1] - pos;
+    return raw_data_ + pos;
+  }
+
+  /// \brief Get binary value as a std::string
+  ///
+  /// \param i the value index
+  /// \return the value copied into a std::string
+  std::string GetString(int64_t i) const {
+    int64_t length = 0;
+    const uint8_t* bytes = GetValue(i, &length);
+    return std::string(reinterpret_cast<const char*>(bytes), static_cast<size_t>(length));
+  }
+
+  /// Note that this buffer does not account for any slice offset
+  std::shared_ptr<Buffer> value_offsets() const { return data_->buffers[1]; }
+
+  /// Note that this buffer does not account for any slice offset
+  std::shared_ptr<Buffer> value_data() const { return data_->buffers[2]; }
+
+  const int64_t* raw_value_offsets() const { return raw_value_offsets_ + data_->offset; }
+
+  // Neither of these functions will perform boundschecking
+  int64_t value_offset(int64_t i) const { return raw_value_offsets_[i + data_->offset]; }
+  int64_t value_length(int64_t i) const {
+    i += data_->offset;
+    return raw_value_offsets_[i + 1] - raw_value_offsets_[i];
+  }
+
+ protected:
+  // For subclasses
+  LargeBinaryArray() {}
+
+  /// Protected method for constructors
+  void SetData(const std::shared_ptr<ArrayData>& data);
+
+  // Constructor that allows sub-classes/builders to propagate there logical type up the
+  // class hierarchy.
+  LargeBinaryArray(const std::shared_ptr<DataType>& type, int64_t length,
+                   const std::shared_ptr<Buffer>& value_offsets,
+                   const std::shared_ptr<Buffer>& data,
+                   const std::shared_ptr<Buffer>& null_bitmap = NULLPTR,
+                   int64_t null_count = 0, int64_t offset = 0);
+
+  const int64_t* raw_value_offsets_;
+  const uint8_t* raw_data_;
+};
+
+class ARROW_EXPORT LargeStringArray : public LargeBinaryArray {
+ public:
+  using TypeClass = LargeStringType;
+
+  explicit LargeStringArray(const std::shared_ptr<ArrayData>& data);
+
+  LargeStringArray(int64_t length, const std::shared_ptr<Buffer>& value_offsets,
+                   const std::shared_ptr<Buffer>& data,
+                   const std::shared_ptr<Buffer>& null_bitmap = NULLPTR,
+                   int64_t null_count = 0, int64_t offset = 0);
+};
+
 // ----------------------------------------------------------------------
 // Fixed width binary
 
@@ -755,6 +1016,20 @@ class ARROW_EXPORT DictionaryArray : public Array {
                            const std::shared_ptr<Array>& indices,
                            std::shared_ptr<Array>* out);
 
+  /// \brief Remap the indices of this array onto another dictionary
+  ///
+  /// The transpose map gives, for each index into this array's dictionary, the
+  /// corresponding index into the dictionary of type. Both are typically
+  /// computed with compute::UnifyDictionaries. The validity bitmap is shared
+  /// with this array.
+  ///
+  /// \param[in] pool memory pool to allocate the new indices from
+  /// \param[in] type the dictionary type of the result
+  /// \param[in] transpose_map maps indices of this array to indices of type
+  /// \param[out] out the resulting DictionaryArray
+  Status Transpose(MemoryPool* pool, const std::shared_ptr<DataType>& type,
+                   const int32_t* transpose_map, std::shared_ptr<Array>* out) const;
+
   std::shared_ptr<Array> indices() const;
   std::shared_ptr<Array> dictionary() const;
 
@@ -218,6 +218,65 @@ TEST(TestBuffer, SliceMutableBuffer) {
   ASSERT_TRUE(slice->Equals(expected));
 }
 
+// Host memory posing as device memory, which is only read through CopyToHost
+class FakeDeviceBuffer : public Buffer {
+ public:
+  explicit FakeDeviceBuffer(const std::string& host_data)
+      : Buffer(reinterpret_cast<const uint8_t*>(host_data.data()),
+               static_cast<int64_t>(host_data.size()), MemoryType::CUDA_DEVICE) {}
+
+  Status CopyToHost(const int64_t position, const int64_t nbytes,
+                    void* out) const override {
+    ++num_copies;
+    std::memcpy(out, data_ + position, static_cast<size_t>(nbytes));
+    return Status::OK();
+  }
+
+  mutable int num_copies = 0;
+};
+
+static std::string BufferToString(const Buffer& buffer) {
+  return std::string(reinterpret_cast<const char*>(buffer.data()),
+                     static_cast<size_t>(buffer.size()));
+}
+
+TEST(TestBuffer, MemoryType) {
+  std::shared_ptr<Buffer> host;
+  ASSERT_OK(AllocateBuffer(10, &host));
+  ASSERT_EQ(MemoryType::HOST, host->memory_type());
+  ASSERT_TRUE(host->is_cpu());
+
+  uint8_t shared_data[4] = {1, 2, 3, 4};
+  auto shared = std::make_shared<MutableBuffer>(shared_data, 4, MemoryType::SHARED_HOST);
+  ASSERT_TRUE(shared->is_cpu());
+  ASSERT_EQ(MemoryType::SHARED_HOST, SliceBuffer(shared, 1)->memory_type());
+  ASSERT_EQ(MemoryType::SHARED_HOST, SliceMutableBuffer(shared, 1, 2)->memory_type());
+  std::shared_ptr<Buffer> out;
+  ASSERT_OK(ViewOrCopyToHost(shared, default_memory_pool(), &out));
+  ASSERT_EQ(shared.get(), out.get());
+}
+
+TEST(TestBuffer, CopyDeviceToHost) {
+  const std::string data = "some bytes on a device";
+  auto device = std::make_shared<FakeDeviceBuffer>(data);
+  ASSERT_FALSE(device->is_cpu());
+
+  std::shared_ptr<Buffer> out;
+  ASSERT_OK(ViewOrCopyToHost(device, default_memory_pool(), &out));
+  ASSERT_TRUE(out->is_cpu());
+  ASSERT_EQ(data, BufferToString(*out));
+  ASSERT_EQ(1, device->num_copies);
+
+  // Slices of device buffers are device memory, copied through their parent
+  std::shared_ptr<Buffer> slice = SliceBuffer(SliceBuffer(device, 5), 0, 5);
+  ASSERT_EQ(MemoryType::CUDA_DEVICE, slice->memory_type());
+  ASSERT_OK(slice->Copy(1, 4, &out));
+  ASSERT_EQ("ytes", BufferToString(*out));
+  ASSERT_OK(ViewOrCopyToHost(slice, default_memory_pool(), &out));
+  ASSERT_EQ("bytes", BufferToString(*out));
+  ASSERT_EQ(3, device->num_copies);
+}
+
 TEST(TestBufferBuilder, ResizeReserve) {
   const std::string data = "some data";
   auto data_ptr = data.c_str();
@@ -243,4 +302,22 @@ TEST(TestBufferBuilder, ResizeReserve) {
   ASSERT_EQ(128, builder.capacity());
 }
 
+TEST(TestBufferBuilder, FinishZeroesPadding) {
+  const std::string data = "some data";
+
+  BufferBuilder builder;
+  ASSERT_OK(builder.Resize(1024));
+  // Dirty the uninitialized capacity so the test does not depend on the pool
+  memset(builder.mutable_data(), 0xff, static_cast<size_t>(builder.capacity()));
+  ASSERT_OK(builder.Append(data.c_str(), 9));
+
+  std::shared_ptr<Buffer> result;
+  ASSERT_OK(builder.Finish(&result, false));
+  ASSERT_EQ(9, result->size());
+  ASSERT_EQ(0, memcmp(result->data(), data.c_str(), 9));
+  for (int64_t i = result->size(); i < result->capacity(); ++i) {
+    ASSERT_EQ(0, result->data()[i]);
+  }
+}
+
 }  // namespace arrow
@@ -18,6 +18,8 @@
 #include "arrow/buffer.h"
 
 #include <cstdint>
+#include <memory>
+#include <utility>
 
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
@@ -35,9 +37,9 @@ Status Buffer::Copy(const int64_t start, const int64_t nbytes, MemoryPool* pool,
   std::shared_ptr<ResizableBuffer> new_buffer;
   RETURN_NOT_OK(AllocateResizableBuffer(pool, nbytes, &new_buffer));
 
-  std::memcpy(new_buffer->mutable_data(), data() + start, static_cast<size_t>(nbytes));
+  RETURN_NOT_OK(CopyToHost(start, nbytes, new_buffer->mutable_data()));
 
-  *out = new_buffer;
+  *out = std::move(new_buffer);
   return Status::OK();
 }
 
@@ -46,13 +48,38 @@ Status Buffer::Copy(const int64_t start, const int64_t nbytes,
   return Copy(start, nbytes, default_memory_pool(), out);
 }
 
+std::shared_ptr<const internal::BitmapCounts> Buffer::bitmap_counts() const {
+  return std::atomic_load(&bitmap_counts_);
+}
+
+void Buffer::set_bitmap_counts(
+    std::shared_ptr<const internal::BitmapCounts> counts) const {
+  has_bitmap_counts_.store(counts != nullptr, std::memory_order_relaxed);
+  std::atomic_store(&bitmap_counts_, std::move(counts));
+}
+
+Status Buffer::CopyToHost(const int64_t position, const int64_t nbytes,
+                          void* out) const {
+  DCHECK_LE(position + nbytes, size_);
+  if (is_cpu()) {
+    std::memcpy(out, data_ + position, static_cast<size_t>(nbytes));
+    return Status::OK();
+  }
+  if (parent_ != nullptr) {
+    return parent_->CopyToHost(data_ - parent_->data() + position, nbytes, out);
+  }
+  return Status::NotImplemented("Copying device memory of a plain Buffer to the host");
+}
+
 bool Buffer::Equals(const Buffer& other, const int64_t nbytes) const {
+  DCHECK(is_cpu() && other.is_cpu()) << "Comparing bytes of device buffers";
   return this == &other || (size_ >= nbytes && other.size_ >= nbytes &&
                             (data_ == other.data_ ||
                              !memcmp(data_, other.data_, static_cast<size_t>(nbytes))));
 }
 
 bool Buffer::Equals(const Buffer& other) const {
+  DCHECK(is_cpu() && other.is_cpu()) << "Comparing bytes of device buffers";
   return this == &other || (size_ == other.size_ &&
                             (data_ == other.data_ ||
                              !memcmp(data_, other.data_, static_cast<size_t>(size_))));
@@ -141,17 +168,30 @@ std::shared_ptr<Buffer> SliceMutableBuffer(const std::shared_ptr<Buffer>& buffer
 
 MutableBuffer::MutableBuffer(const std::shared_ptr<Buffer>& parent, const int64_t offset,
                              const int64_t size)
-    : MutableBuffer(parent->mutable_data() + offset, size) {
+    : MutableBuffer(parent->mutable_data() + offset, size, parent->memory_type()) {
   DCHECK(parent->is_mutable()) << "Must pass mutable buffer";
   parent_ = parent;
 }
 
+Status ViewOrCopyToHost(const std::shared_ptr<Buffer>& buffer, MemoryPool* pool,
+                        std::shared_ptr<Buffer>* out) {
+  if (buffer->is_cpu()) {
+    *out = buffer;
+    return Status::OK();
+  }
+  std::shared_ptr<Buffer> copy;
+  RETURN_NOT_OK(AllocateBuffer(pool, buffer->size(), &copy));
+  RETURN_NOT_OK(buffer->CopyToHost(0, buffer->size(), copy->mutable_data()));
+  *out = std::move(copy);
+  return Status::OK();
+}
+
 Status AllocateBuffer(MemoryPool* pool, const int64_t size,
                       std::shared_ptr<Buffer>* out) {
   auto buffer = std::make_shared<PoolBuffer>(pool);
   RETURN_NOT_OK(buffer->Resize(size));
   buffer->ZeroPadding();
-  *out = buffer;
+  *out = std::move(buffer);
   return Status::OK();
 }
 
@@ -159,12 +199,19 @@ Status AllocateBuffer(const int64_t size, std::shared_ptr<Buffer>* out) {
   return AllocateBuffer(default_memory_pool(), size, out);
 }
 
+Result<std::shared_ptr<Buffer>> AllocateBuffer(const int64_t size, MemoryPool* pool) {
+  auto buffer = std::make_shared<PoolBuffer>(pool);
+  RETURN_NOT_OK(buffer->Resize(size));
+  buffer->ZeroPadding();
+  return std::shared_ptr<Buffer>(std::move(buffer));
+}
+
 Status AllocateResizableBuffer(MemoryPool* pool, const int64_t size,
                                std::shared_ptr<ResizableBuffer>* out) {
   auto buffer = std::make_shared<PoolBuffer>(pool);
   RETURN_NOT_OK(buffer->Resize(size));
   buffer->ZeroPadding();
-  *out = buffer;
+  *out = std::move(buffer);
   return Status::OK();
 }
 
@@ -173,4 +220,12 @@ Status AllocateResizableBuffer(const int64_t size,
   return AllocateResizableBuffer(default_memory_pool(), size, out);
 }
 
+Result<std::shared_ptr<ResizableBuffer>> AllocateResizableBuffer(const int64_t size,
+                                                                 MemoryPool* pool) {
+  auto buffer = std::make_shared<PoolBuffer>(pool);
+  RETURN_NOT_OK(buffer->Resize(size));
+  buffer->ZeroPadding();
+  return std::shared_ptr<ResizableBuffer>(std::move(buffer));
+}
+
 }  // namespace arrow
@@ -19,6 +19,7 @@
 #define ARROW_BUFFER_H
 
 #include <algorithm>
+#include <atomic>
 #include <cstdint>
 #include <cstring>
 #include <memory>
@@ -26,6 +27,7 @@
 #include <type_traits>
 
 #include "arrow/memory_pool.h"
+#include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/util/bit-util.h"
 #include "arrow/util/macros.h"
@@ -36,6 +38,18 @@ namespace arrow {
 // ----------------------------------------------------------------------
 // Buffer classes
 
+/// \brief Where the memory of a Buffer lives
+enum class MemoryType : int8_t {
+  /// Ordinary CPU memory
+  HOST,
+  /// CPU memory pinned for transfers to and from CUDA devices
+  PINNED_HOST,
+  /// CPU memory shared with other processes, as that of plasma objects
+  SHARED_HOST,
+  /// Memory of a CUDA device, which the CPU cannot read
+  CUDA_DEVICE,
+};
+
 /// \class Buffer
 /// \brief Object containing a pointer to a piece of contiguous memory with a
 /// particular size. Base class does not own its memory
@@ -55,11 +69,23 @@ class ARROW_EXPORT Buffer {
   /// \note The passed memory must be kept alive through some other means
   Buffer(const uint8_t* data, int64_t size)
       : is_mutable_(false),
+        memory_type_(MemoryType::HOST),
         data_(data),
         mutable_data_(NULLPTR),
         size_(size),
         capacity_(size) {}
 
+  /// \brief Construct from memory of the given type and size without copying
+  /// it
+  ///
+  /// \param[in] data a memory buffer
+  /// \param[in] size buffer size
+  /// \param[in] memory_type where the memory lives
+  Buffer(const uint8_t* data, int64_t size, MemoryType memory_type)
+      : Buffer(data, size) {
+    memory_type_ = memory_type;
+  }
+
   /// \brief Construct from std::string without copying memory
   ///
   /// \param[in] data a std::string object
@@ -80,20 +106,43 @@ class ARROW_EXPORT Buffer {
   /// in general we expected buffers to be aligned and padded to 64 bytes.  In the future
   /// we might add utility methods to help determine if a buffer satisfies this contract.
   Buffer(const std::shared_ptr<Buffer>& parent, const int64_t offset, const int64_t size)
-      : Buffer(parent->data() + offset, size) {
+      : Buffer(parent->data() + offset, size, parent->memory_type()) {
     parent_ = parent;
   }
 
   bool is_mutable() const { return is_mutable_; }
 
+  /// \brief Where the memory of the buffer lives, that of its parent for
+  /// slices
+  MemoryType memory_type() const { return memory_type_; }
+
+  /// \brief Whether the CPU can read the memory at data()
+  ///
+  /// When false, data() is the address of the memory on its device, and the
+  /// bytes must be copied to the host with CopyToHost to be read.
+  bool is_cpu() const { return memory_type_ != MemoryType::CUDA_DEVICE; }
+
+  /// \brief Copy bytes of the buffer, wherever it lives, to host memory
+  ///
+  /// Device buffers override this with a device to host copy. Slices of them,
+  /// which are plain Buffers, forward the copy to their parent.
+  ///
+  /// \param[in] position the first byte to copy
+  /// \param[in] nbytes the number of bytes to copy
+  /// \param[out] out host memory of at least nbytes
+  /// \return Status, NotImplemented if the memory cannot be reached
+  virtual Status CopyToHost(const int64_t position, const int64_t nbytes,
+                            void* out) const;
+
   /// Return true if both buffers are the same size and contain the same bytes
-  /// up to the number of compared bytes
+  /// up to the number of compared bytes. Both must be CPU buffers
   bool Equals(const Buffer& other, int64_t nbytes) const;
 
-  /// Return true if both buffers are the same size and contain the same bytes
+  /// Return true if both buffers are the same size and contain the same bytes.
+  /// Both must be CPU buffers
   bool Equals(const Buffer& other) const;
 
-  /// Copy a section of the buffer into a new Buffer.
+  /// Copy a section of the buffer into a new host Buffer, from any device.
   Status Copy(const int64_t start, const int64_t nbytes, MemoryPool* pool,
               std::shared_ptr<Buffer>* out) const;
 
@@ -130,6 +179,9 @@ class ARROW_EXPORT Buffer {
 #ifndef NDEBUG
     CheckMutable();
 #endif
+    if (ARROW_PREDICT_FALSE(has_bitmap_counts_.load(std::memory_order_relaxed))) {
+      set_bitmap_counts(NULLPTR);
+    }
     return mutable_data_;
   }
 
@@ -137,8 +189,22 @@ class ARROW_EXPORT Buffer {
 
   std::shared_ptr<Buffer> parent() const { return parent_; }
 
+  /// \brief The counts of the set bits of the buffer as a bitmap, cached by
+  /// the arrays which have it as their validity bitmap and shared by their
+  /// slices
+  ///
+  /// \return null if none were cached
+  std::shared_ptr<const internal::BitmapCounts> bitmap_counts() const;
+
+  /// \brief Cache counts of the set bits of the buffer as a bitmap
+  ///
+  /// Safe to call concurrently, the last counts set are kept. Getting the
+  /// mutable data of the buffer drops them, as it may then be written.
+  void set_bitmap_counts(std::shared_ptr<const internal::BitmapCounts> counts) const;
+
  protected:
   bool is_mutable_;
+  MemoryType memory_type_;
   const uint8_t* data_;
   uint8_t* mutable_data_;
   int64_t size_;
@@ -147,6 +213,10 @@ class ARROW_EXPORT Buffer {
   // null by default, but may be set
   std::shared_ptr<Buffer> parent_;
 
+  // Accessed atomically
+  mutable std::shared_ptr<const internal::BitmapCounts> bitmap_counts_;
+  mutable std::atomic<bool> has_bitmap_counts_{false};
+
   void CheckMutable() const;
 
  private:
@@ -182,6 +252,12 @@ class ARROW_EXPORT MutableBuffer : public Buffer {
     is_mutable_ = true;
   }
 
+  MutableBuffer(uint8_t* data, const int64_t size, MemoryType memory_type)
+      : Buffer(data, size, memory_type) {
+    mutable_data_ = data;
+    is_mutable_ = true;
+  }
+
   MutableBuffer(const std::shared_ptr<Buffer>& parent, const int64_t offset,
                 const int64_t size);
 
@@ -221,6 +297,20 @@ class ARROW_EXPORT ResizableBuffer : public MutableBuffer {
   ResizableBuffer(uint8_t* data, int64_t size) : MutableBuffer(data, size) {}
 };
 
+/// \brief Return the buffer itself if the CPU can read it, else a copy of it
+/// in host memory
+///
+/// Code reading the bytes of buffers that may live on a device, such as
+/// those of record batches read from device memory, goes through this.
+///
+/// \param[in] buffer the buffer
+/// \param[in] pool the memory pool to allocate a copy from
+/// \param[out] out the buffer or its copy
+/// \return Status
+ARROW_EXPORT
+Status ViewOrCopyToHost(const std::shared_ptr<Buffer>& buffer, MemoryPool* pool,
+                        std::shared_ptr<Buffer>* out);
+
 /// \brief Allocate a fixed size mutable buffer from a memory pool, zero its padding.
 ///
 /// \param[in] pool a memory pool
@@ -240,6 +330,15 @@ Status AllocateBuffer(MemoryPool* pool, const int64_t size, std::shared_ptr<Buff
 ARROW_EXPORT
 Status AllocateBuffer(const int64_t size, std::shared_ptr<Buffer>* out);
 
+/// \brief Allocate a fixed size mutable buffer from a memory pool, zero its padding.
+///
+/// \param[in] size size of buffer to allocate
+/// \param[in] pool a memory pool
+/// \return the allocated buffer (contains padding), or the error
+ARROW_EXPORT
+Result<std::shared_ptr<Buffer>> AllocateBuffer(
+    const int64_t size, MemoryPool* pool ARROW_MEMORY_POOL_DEFAULT);
+
 /// \brief Allocate a resizeable buffer from a memory pool, zero its padding.
 ///
 /// \param[in] pool a memory pool
@@ -260,6 +359,15 @@ Status AllocateResizableBuffer(MemoryPool* pool, const int64_t size,
 ARROW_EXPORT
 Status AllocateResizableBuffer(const int64_t size, std::shared_ptr<ResizableBuffer>* out);
 
+/// \brief Allocate a resizeable buffer from a memory pool, zero its padding.
+///
+/// \param[in] size size of buffer to allocate
+/// \param[in] pool a memory pool
+/// \return the allocated buffer, or the error
+ARROW_EXPORT
+Result<std::shared_ptr<ResizableBuffer>> AllocateResizableBuffer(
+    const int64_t size, MemoryPool* pool ARROW_MEMORY_POOL_DEFAULT);
+
 /// \class BufferBuilder
 /// \brief A class for incrementally building a contiguous chunk of in-memory data
 class ARROW_EXPORT BufferBuilder {
@@ -269,6 +377,9 @@ class ARROW_EXPORT BufferBuilder {
 
   /// \brief Resizes the buffer to the nearest multiple of 64 bytes
   ///
+  /// Newly allocated memory is left uninitialized since it is expected to be
+  /// overwritten by appends; Finish zeroes the padding of the result.
+  ///
   /// \param elements the new capacity of the of the builder. Will be rounded
   /// up to a multiple of 64 bytes for padding
   /// \param shrink_to_fit if new capacity smaller than existing size,
@@ -280,8 +391,6 @@ class ARROW_EXPORT BufferBuilder {
     if (elements == 0) {
       return Status::OK();
     }
-    int64_t old_capacity = capacity_;
-
     if (buffer_ == NULLPTR) {
       RETURN_NOT_OK(AllocateResizableBuffer(pool_, elements, &buffer_));
     } else {
@@ -289,9 +398,6 @@ class ARROW_EXPORT BufferBuilder {
     }
     capacity_ = buffer_->capacity();
     data_ = buffer_->mutable_data();
-    if (capacity_ > old_capacity) {
-      memset(data_ + old_capacity, 0, capacity_ - old_capacity);
-    }
     return Status::OK();
   }
 
@@ -343,6 +449,9 @@ class ARROW_EXPORT BufferBuilder {
 
   Status Finish(std::shared_ptr<Buffer>* out, bool shrink_to_fit = true) {
     RETURN_NOT_OK(Resize(size_, shrink_to_fit));
+    if (buffer_ != NULLPTR) {
+      buffer_->ZeroPadding();
+    }
     *out = buffer_;
     Reset();
     return Status::OK();
@@ -356,6 +465,7 @@ class ARROW_EXPORT BufferBuilder {
   int64_t capacity() const { return capacity_; }
   int64_t length() const { return size_; }
   const uint8_t* data() const { return data_; }
+  uint8_t* mutable_data() { return data_; }
 
  protected:
   std::shared_ptr<ResizableBuffer> buffer_;
@@ -17,8 +17,15 @@
 
 #include "benchmark/benchmark.h"
 
+#include <cstddef>
+#include <limits>
+#include <string>
+#include <vector>
+
 #include "arrow/builder.h"
 #include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
+#include "arrow/table_builder.h"
 #include "arrow/test-util.h"
 
 namespace arrow {
@@ -57,6 +64,73 @@ static void BM_BuildVectorNoNulls(
                           kFinalSize);
 }
 
+static void BM_BuildPrimitiveArrayScalarAppend(
+    benchmark::State& state) {  // NOLINT non-const reference
+  // 2 MiB block
+  std::vector<int64_t> data(256 * 1024, 100);
+  while (state.KeepRunning()) {
+    Int64Builder builder;
+    for (int i = 0; i < kFinalSize; i++) {
+      for (int64_t value : data) {
+        ABORT_NOT_OK(builder.Append(value));
+      }
+    }
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(builder.Finish(&out));
+  }
+  state.SetBytesProcessed(state.iterations() * data.size() * sizeof(int64_t) *
+                          kFinalSize);
+}
+
+// Nine in ten values null, as validity bytes for the bulk appends
+static std::vector<uint8_t> MakeMostlyNullValidBytes(int64_t length) {
+  std::vector<uint8_t> valid_bytes(length);
+  for (int64_t i = 0; i < length; i++) {
+    valid_bytes[i] = (i % 10) == 0;
+  }
+  return valid_bytes;
+}
+
+static void BM_BuildPrimitiveArrayMostlyNulls(
+    benchmark::State& state) {  // NOLINT non-const reference
+  // 2 MiB block
+  std::vector<int64_t> data(256 * 1024, 100);
+  const auto valid_bytes = MakeMostlyNullValidBytes(data.size());
+  while (state.KeepRunning()) {
+    Int64Builder builder;
+    for (int i = 0; i < kFinalSize; i++) {
+      ABORT_NOT_OK(builder.AppendValues(data.data(), data.size(), valid_bytes.data()));
+    }
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(builder.Finish(&out));
+  }
+  state.SetBytesProcessed(state.iterations() * data.size() * sizeof(int64_t) *
+                          kFinalSize);
+}
+
+static void BM_BuildPrimitiveArrayMostlyNullsScalarAppend(
+    benchmark::State& state) {  // NOLINT non-const reference
+  // 2 MiB block
+  std::vector<int64_t> data(256 * 1024, 100);
+  const auto valid_bytes = MakeMostlyNullValidBytes(data.size());
+  while (state.KeepRunning()) {
+    Int64Builder builder;
+    for (int i = 0; i < kFinalSize; i++) {
+      for (size_t j = 0; j < data.size(); j++) {
+        if (valid_bytes[j]) {
+          ABORT_NOT_OK(builder.Append(data[j]));
+        } else {
+          ABORT_NOT_OK(builder.AppendNull());
+        }
+      }
+    }
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(builder.Finish(&out));
+  }
+  state.SetBytesProcessed(state.iterations() * data.size() * sizeof(int64_t) *
+                          kFinalSize);
+}
+
 static void BM_BuildAdaptiveIntNoNulls(
     benchmark::State& state) {  // NOLINT non-const reference
   int64_t size = static_cast<int64_t>(std::numeric_limits<int16_t>::max()) * 256;
@@ -95,6 +169,54 @@ static void BM_BuildAdaptiveIntNoNullsScalarAppend(
   state.SetBytesProcessed(state.iterations() * data.size() * sizeof(int64_t));
 }
 
+// Values of increasing magnitude, so that the builder widens its integers
+// through every size, copying the values appended so far each time
+static std::vector<int64_t> MakeWideningValues(int64_t size) {
+  std::vector<int64_t> data;
+  const int64_t quarter = size / 4;
+  const int64_t bounds[] = {std::numeric_limits<int8_t>::max(),
+                            std::numeric_limits<int16_t>::max(),
+                            std::numeric_limits<int32_t>::max(),
+                            std::numeric_limits<int64_t>::max()};
+  for (int64_t bound : bounds) {
+    for (int64_t i = 0; i < quarter; i++) {
+      data.push_back(bound - (i % 100));
+    }
+  }
+  return data;
+}
+
+static void BM_BuildAdaptiveIntExpand(
+    benchmark::State& state) {  // NOLINT non-const reference
+  int64_t size = static_cast<int64_t>(std::numeric_limits<int16_t>::max()) * 256;
+  int64_t chunk_size = size / 64;
+  const auto data = MakeWideningValues(size);
+  while (state.KeepRunning()) {
+    AdaptiveIntBuilder builder;
+    for (int64_t i = 0; i < static_cast<int64_t>(data.size()); i += chunk_size) {
+      ABORT_NOT_OK(builder.AppendValues(data.data() + i, chunk_size, nullptr));
+    }
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(builder.Finish(&out));
+  }
+  state.SetBytesProcessed(state.iterations() * data.size() * sizeof(int64_t));
+}
+
+static void BM_BuildAdaptiveIntExpandScalarAppend(
+    benchmark::State& state) {  // NOLINT non-const reference
+  int64_t size = static_cast<int64_t>(std::numeric_limits<int16_t>::max()) * 256;
+  const auto data = MakeWideningValues(size);
+  while (state.KeepRunning()) {
+    AdaptiveIntBuilder builder;
+    for (int64_t value : data) {
+      ABORT_NOT_OK(builder.Append(value));
+    }
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(builder.Finish(&out));
+  }
+  state.SetBytesProcessed(state.iterations() * data.size() * sizeof(int64_t));
+}
+
 static void BM_BuildAdaptiveUIntNoNulls(
     benchmark::State& state) {  // NOLINT non-const reference
   int64_t size = static_cast<int64_t>(std::numeric_limits<uint16_t>::max()) * 256;
@@ -171,7 +293,274 @@ static void BM_BuildFixedSizeBinaryArray(
   state.SetBytesProcessed(state.iterations() * iterations * width);
 }
 
+static void BM_BuildStringArrayBulkAppend(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t iterations = 1 << 20;
+  const int64_t chunk_size = 1 << 10;
+
+  std::string value = "1234567890";
+  const std::vector<std::string> values(chunk_size, value);
+  while (state.KeepRunning()) {
+    StringBuilder builder;
+    for (int64_t i = 0; i < iterations; i += chunk_size) {
+      ABORT_NOT_OK(builder.AppendValues(values));
+    }
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(builder.Finish(&out));
+  }
+  state.SetBytesProcessed(state.iterations() * iterations * value.size());
+}
+
+// ----------------------------------------------------------------------
+// Dictionary builders
+
+// Draws from 1000 distinct values, so lookups mostly hit the memo table
+constexpr int64_t kDistinctValues = 1000;
+
+static void BM_BuildInt64DictionaryArray(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t iterations = 1 << 20;
+  std::vector<int64_t> data;
+  test::randint<int64_t>(iterations, 0, kDistinctValues, &data);
+
+  while (state.KeepRunning()) {
+    DictionaryBuilder<Int64Type> builder(default_memory_pool());
+    for (int64_t value : data) {
+      ABORT_NOT_OK(builder.Append(value));
+    }
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(builder.Finish(&out));
+  }
+  state.SetBytesProcessed(state.iterations() * iterations * sizeof(int64_t));
+}
+
+static void BM_BuildInt64DictionaryArrayAppendArray(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t iterations = 1 << 20;
+  std::vector<int64_t> data;
+  test::randint<int64_t>(iterations, 0, kDistinctValues, &data);
+  std::shared_ptr<Array> dense;
+  ArrayFromVector<Int64Type, int64_t>(data, &dense);
+
+  while (state.KeepRunning()) {
+    DictionaryBuilder<Int64Type> builder(default_memory_pool());
+    ABORT_NOT_OK(builder.AppendArray(*dense));
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(builder.Finish(&out));
+  }
+  state.SetBytesProcessed(state.iterations() * iterations * sizeof(int64_t));
+}
+
+static void BM_BuildStringDictionaryArray(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t iterations = 1 << 20;
+  std::vector<std::string> distinct;
+  for (int64_t i = 0; i < kDistinctValues; i++) {
+    distinct.push_back("value-" + std::to_string(i));
+  }
+  std::vector<int64_t> indices;
+  test::randint<int64_t>(iterations, 0, kDistinctValues - 1, &indices);
+  int64_t total_bytes = 0;
+  for (int64_t index : indices) {
+    total_bytes += static_cast<int64_t>(distinct[index].size());
+  }
+
+  while (state.KeepRunning()) {
+    StringDictionaryBuilder builder(default_memory_pool());
+    for (int64_t index : indices) {
+      ABORT_NOT_OK(builder.Append(distinct[index]));
+    }
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(builder.Finish(&out));
+  }
+  state.SetBytesProcessed(state.iterations() * total_bytes);
+}
+
+// ----------------------------------------------------------------------
+// Nested builders
+
+static void BM_BuildListArray(benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t iterations = 1 << 18;
+  const int64_t list_size = 4;
+  const std::vector<int64_t> values(list_size, 100);
+
+  while (state.KeepRunning()) {
+    auto value_builder = std::make_shared<Int64Builder>();
+    ListBuilder builder(default_memory_pool(), value_builder);
+    for (int64_t i = 0; i < iterations; i++) {
+      ABORT_NOT_OK(builder.Append());
+      ABORT_NOT_OK(value_builder->AppendValues(values));
+    }
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(builder.Finish(&out));
+  }
+  state.SetBytesProcessed(state.iterations() * iterations * list_size * sizeof(int64_t));
+}
+
+static void BM_BuildListArrayBulkAppend(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t iterations = 1 << 18;
+  const int64_t list_size = 4;
+  const int64_t chunk_size = 1 << 10;
+  const std::vector<int64_t> values(chunk_size * list_size, 100);
+  std::vector<int32_t> offsets(chunk_size);
+
+  while (state.KeepRunning()) {
+    auto value_builder = std::make_shared<Int64Builder>();
+    ListBuilder builder(default_memory_pool(), value_builder);
+    for (int64_t i = 0; i < iterations; i += chunk_size) {
+      // Offsets are absolute positions in the values appended so far
+      const auto start = static_cast<int32_t>(value_builder->length());
+      for (int64_t j = 0; j < chunk_size; j++) {
+        offsets[j] = start + static_cast<int32_t>(j * list_size);
+      }
+      ABORT_NOT_OK(builder.AppendValues(offsets.data(), chunk_size));
+      ABORT_NOT_OK(value_builder->AppendValues(values));
+    }
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(builder.Finish(&out));
+  }
+  state.SetBytesProcessed(state.iterations() * iterations * list_size * sizeof(int64_t));
+}
+
+static void BM_BuildStructArray(benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t iterations = 1 << 20;
+  const std::string value = "1234567890";
+  auto type = struct_({field("id", int64()), field("name", utf8())});
+
+  while (state.KeepRunning()) {
+    auto id_builder = std::make_shared<Int64Builder>();
+    auto name_builder = std::make_shared<StringBuilder>();
+    StructBuilder builder(type, default_memory_pool(), {id_builder, name_builder});
+    for (int64_t i = 0; i < iterations; i++) {
+      ABORT_NOT_OK(builder.Append());
+      ABORT_NOT_OK(id_builder->Append(i));
+      ABORT_NOT_OK(name_builder->Append(value));
+    }
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(builder.Finish(&out));
+  }
+  state.SetBytesProcessed(state.iterations() * iterations *
+                          (sizeof(int64_t) + value.size()));
+}
+
+// A list of structs, with every tenth list null
+static void BM_BuildListOfStructArray(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t iterations = 1 << 18;
+  const int64_t list_size = 4;
+  auto struct_type = struct_({field("x", float64()), field("y", float64())});
+
+  while (state.KeepRunning()) {
+    auto x_builder = std::make_shared<DoubleBuilder>();
+    auto y_builder = std::make_shared<DoubleBuilder>();
+    auto struct_builder = std::make_shared<StructBuilder>(
+        struct_type, default_memory_pool(),
+        std::vector<std::shared_ptr<ArrayBuilder>>{x_builder, y_builder});
+    ListBuilder builder(default_memory_pool(), struct_builder);
+    for (int64_t i = 0; i < iterations; i++) {
+      if (i % 10 == 0) {
+        ABORT_NOT_OK(builder.AppendNull());
+        continue;
+      }
+      ABORT_NOT_OK(builder.Append());
+      for (int64_t j = 0; j < list_size; j++) {
+        ABORT_NOT_OK(struct_builder->Append());
+        ABORT_NOT_OK(x_builder->Append(1.5));
+        ABORT_NOT_OK(y_builder->Append(2.5));
+      }
+    }
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(builder.Finish(&out));
+  }
+  state.SetItemsProcessed(state.iterations() * iterations);
+}
+
+struct BenchmarkRow {
+  int64_t id;
+  double price;
+  int32_t quantity;
+  float weight;
+};
+
+constexpr int64_t kNumBenchmarkRows = 1 << 20;
+
+static std::shared_ptr<Schema> BenchmarkRowSchema() {
+  return schema({field("id", int64()), field("price", float64()),
+                 field("quantity", int32()), field("weight", float32())});
+}
+
+static RowLayout BenchmarkRowLayout() {
+  return RowLayout{sizeof(BenchmarkRow),
+                   {offsetof(BenchmarkRow, id), offsetof(BenchmarkRow, price),
+                    offsetof(BenchmarkRow, quantity), offsetof(BenchmarkRow, weight)}};
+}
+
+static std::vector<BenchmarkRow> MakeBenchmarkRows() {
+  std::vector<BenchmarkRow> rows(kNumBenchmarkRows);
+  for (int64_t i = 0; i < kNumBenchmarkRows; ++i) {
+    rows[i] = {i, static_cast<double>(i) / 8, static_cast<int32_t>(i % 100),
+               static_cast<float>(i % 7)};
+  }
+  return rows;
+}
+
+static void BM_RecordBatchFromRowsAppend(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const auto rows = MakeBenchmarkRows();
+  std::unique_ptr<RecordBatchBuilder> builder;
+  ABORT_NOT_OK(RecordBatchBuilder::Make(BenchmarkRowSchema(), default_memory_pool(),
+                                        &builder));
+  while (state.KeepRunning()) {
+    for (const auto& row : rows) {
+      ABORT_NOT_OK(builder->GetFieldAs<Int64Builder>(0)->Append(row.id));
+      ABORT_NOT_OK(builder->GetFieldAs<DoubleBuilder>(1)->Append(row.price));
+      ABORT_NOT_OK(builder->GetFieldAs<Int32Builder>(2)->Append(row.quantity));
+      ABORT_NOT_OK(builder->GetFieldAs<FloatBuilder>(3)->Append(row.weight));
+    }
+    std::shared_ptr<RecordBatch> batch;
+    ABORT_NOT_OK(builder->Flush(&batch));
+  }
+  state.SetBytesProcessed(state.iterations() * kNumBenchmarkRows * sizeof(BenchmarkRow));
+}
+
+static void BM_RecordBatchFromRows(benchmark::State& state) {  // NOLINT non-const ref
+  const auto rows = MakeBenchmarkRows();
+  const auto schema = BenchmarkRowSchema();
+  const auto layout = BenchmarkRowLayout();
+  while (state.KeepRunning()) {
+    std::shared_ptr<RecordBatch> batch;
+    ABORT_NOT_OK(RecordBatchFromRows(schema, layout,
+                                     reinterpret_cast<const uint8_t*>(rows.data()),
+                                     kNumBenchmarkRows, default_memory_pool(), &batch));
+  }
+  state.SetBytesProcessed(state.iterations() * kNumBenchmarkRows * sizeof(BenchmarkRow));
+}
+
+static void BM_RecordBatchToRows(benchmark::State& state) {  // NOLINT non-const ref
+  auto rows = MakeBenchmarkRows();
+  std::shared_ptr<RecordBatch> batch;
+  ABORT_NOT_OK(RecordBatchFromRows(BenchmarkRowSchema(), BenchmarkRowLayout(),
+                                   reinterpret_cast<const uint8_t*>(rows.data()),
+                                   kNumBenchmarkRows, default_memory_pool(), &batch));
+  const auto layout = BenchmarkRowLayout();
+  while (state.KeepRunning()) {
+    ABORT_NOT_OK(
+        RecordBatchToRows(*batch, layout, reinterpret_cast<uint8_t*>(rows.data())));
+  }
+  state.SetBytesProcessed(state.iterations() * kNumBenchmarkRows * sizeof(BenchmarkRow));
+}
+
 BENCHMARK(BM_BuildPrimitiveArrayNoNulls)->Repetitions(3)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_BuildPrimitiveArrayScalarAppend)
+    ->Repetitions(3)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_BuildPrimitiveArrayMostlyNulls)
+    ->Repetitions(3)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_BuildPrimitiveArrayMostlyNullsScalarAppend)
+    ->Repetitions(3)
+    ->Unit(benchmark::kMicrosecond);
 BENCHMARK(BM_BuildVectorNoNulls)->Repetitions(3)->Unit(benchmark::kMicrosecond);
 
 BENCHMARK(BM_BuildBooleanArrayNoNulls)->Repetitions(3)->Unit(benchmark::kMicrosecond);
@@ -181,8 +570,28 @@ BENCHMARK(BM_BuildAdaptiveIntNoNullsScalarAppend)
     ->Repetitions(3)
     ->Unit(benchmark::kMicrosecond);
 BENCHMARK(BM_BuildAdaptiveUIntNoNulls)->Repetitions(3)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_BuildAdaptiveIntExpand)->Repetitions(3)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_BuildAdaptiveIntExpandScalarAppend)
+    ->Repetitions(3)
+    ->Unit(benchmark::kMicrosecond);
 
 BENCHMARK(BM_BuildBinaryArray)->Repetitions(3)->Unit(benchmark::kMicrosecond);
 BENCHMARK(BM_BuildFixedSizeBinaryArray)->Repetitions(3)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_BuildStringArrayBulkAppend)->Repetitions(3)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_BuildInt64DictionaryArray)->Repetitions(3)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_BuildInt64DictionaryArrayAppendArray)
+    ->Repetitions(3)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_BuildStringDictionaryArray)->Repetitions(3)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_BuildListArray)->Repetitions(3)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_BuildListArrayBulkAppend)->Repetitions(3)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_BuildStructArray)->Repetitions(3)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_BuildListOfStructArray)->Repetitions(3)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_RecordBatchFromRowsAppend)->Repetitions(3)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_RecordBatchFromRows)->Repetitions(3)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_RecordBatchToRows)->Repetitions(3)->Unit(benchmark::kMicrosecond);
 
 }  // namespace arrow
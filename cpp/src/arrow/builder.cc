@@ -22,6 +22,7 @@
 #include <limits>
 #include <numeric>
 #include <sstream>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -29,6 +30,7 @@
 #include "arrow/buffer.h"
 #include "arrow/compare.h"
 #include "arrow/status.h"
+#include "arrow/table.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/bit-util.h"
@@ -37,7 +39,9 @@
 #include "arrow/util/decimal.h"
 #include "arrow/util/hash-util.h"
 #include "arrow/util/hash.h"
+#include "arrow/util/int-util.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
 
 namespace arrow {
 
@@ -125,6 +129,12 @@ Status ArrayBuilder::Finish(std::shared_ptr<Array>* out) {
   return Status::OK();
 }
 
+Result<std::shared_ptr<Array>> ArrayBuilder::Finish() {
+  std::shared_ptr<ArrayData> internal_data;
+  RETURN_NOT_OK(FinishInternal(&internal_data));
+  return MakeArray(internal_data);
+}
+
 Status ArrayBuilder::Reserve(int64_t additional_elements) {
   if (length_ + additional_elements > capacity_) {
     // TODO(emkornfield) power of 2 growth is potentially suboptimal
@@ -150,7 +160,8 @@ void ArrayBuilder::UnsafeAppendToBitmap(const uint8_t* valid_bytes, int64_t leng
     UnsafeSetNotNull(length);
     return;
   }
-  UnsafeAppendToBitmap(valid_bytes, valid_bytes + length);
+  null_count_ += PackBytesToBitmap(valid_bytes, length, null_bitmap_data_, length_);
+  length_ += length;
 }
 
 void ArrayBuilder::UnsafeAppendToBitmap(const std::vector<bool>& is_valid) {
@@ -196,6 +207,7 @@ Status NullBuilder::FinishInternal(std::shared_ptr<ArrayData>* out) {
 
 template <typename T>
 void PrimitiveBuilder<T>::Reset() {
+  ArrayBuilder::Reset();
   data_.reset();
   raw_data_ = nullptr;
 }
@@ -314,7 +326,11 @@ template class PrimitiveBuilder<FloatType>;
 template class PrimitiveBuilder<DoubleType>;
 
 AdaptiveIntBuilderBase::AdaptiveIntBuilderBase(MemoryPool* pool)
-    : ArrayBuilder(int64(), pool), data_(nullptr), raw_data_(nullptr), int_size_(1) {}
+    : ArrayBuilder(int64(), pool),
+      data_(nullptr),
+      raw_data_(nullptr),
+      int_size_(1),
+      shrink_on_finish_(false) {}
 
 void AdaptiveIntBuilderBase::Reset() {
   ArrayBuilder::Reset();
@@ -339,9 +355,125 @@ Status AdaptiveIntBuilderBase::Resize(int64_t capacity) {
   return ArrayBuilder::Resize(capacity);
 }
 
+namespace {
+
+// The narrower integers of the signedness of Wide
+template <typename Wide>
+struct NarrowTypes {
+  static constexpr bool kSigned = std::is_signed<Wide>::value;
+  using Int8 = typename std::conditional<kSigned, int8_t, uint8_t>::type;
+  using Int16 = typename std::conditional<kSigned, int16_t, uint16_t>::type;
+  using Int32 = typename std::conditional<kSigned, int32_t, uint32_t>::type;
+};
+
+inline uint8_t DetectWidth(const int64_t* values, const uint8_t* valid_bytes,
+                           int64_t length, uint8_t min_width) {
+  return internal::DetectIntWidth(values, valid_bytes, length, min_width);
+}
+
+inline uint8_t DetectWidth(const uint64_t* values, const uint8_t* valid_bytes,
+                           int64_t length, uint8_t min_width) {
+  return internal::DetectUIntWidth(values, valid_bytes, length, min_width);
+}
+
+// Narrow the 64-bit values into out, as integers of int_size bytes
+template <typename Wide>
+void NarrowInts(const Wide* values, int64_t length, uint8_t int_size, uint8_t* out) {
+  using Int8 = typename NarrowTypes<Wide>::Int8;
+  using Int16 = typename NarrowTypes<Wide>::Int16;
+  using Int32 = typename NarrowTypes<Wide>::Int32;
+  switch (int_size) {
+    case 1:
+      internal::DowncastInts(values, reinterpret_cast<Int8*>(out), length);
+      break;
+    case 2:
+      internal::DowncastInts(values, reinterpret_cast<Int16*>(out), length);
+      break;
+    case 4:
+      internal::DowncastInts(values, reinterpret_cast<Int32*>(out), length);
+      break;
+    case 8:
+      std::memcpy(out, values, sizeof(Wide) * length);
+      break;
+    default:
+      DCHECK(false);
+  }
+}
+
+// Widen length integers of int_size bytes, from the offset-th of data, into out
+template <typename Wide>
+void WidenInts(const uint8_t* data, uint8_t int_size, int64_t offset, int64_t length,
+               Wide* out) {
+  using Int8 = typename NarrowTypes<Wide>::Int8;
+  using Int16 = typename NarrowTypes<Wide>::Int16;
+  using Int32 = typename NarrowTypes<Wide>::Int32;
+  switch (int_size) {
+    case 1: {
+      const Int8* values = reinterpret_cast<const Int8*>(data) + offset;
+      std::copy(values, values + length, out);
+    } break;
+    case 2: {
+      const Int16* values = reinterpret_cast<const Int16*>(data) + offset;
+      std::copy(values, values + length, out);
+    } break;
+    case 4: {
+      const Int32* values = reinterpret_cast<const Int32*>(data) + offset;
+      std::copy(values, values + length, out);
+    } break;
+    case 8:
+      std::memcpy(out, data + offset * sizeof(Wide), sizeof(Wide) * length);
+      break;
+    default:
+      DCHECK(false);
+  }
+}
+
+// Narrow, in place, the length integers of int_size bytes at data to the
+// smallest width holding those valid in the bitmap, all if it is null, and
+// return that width. The values are widened a chunk at a time for the
+// width detection and the narrowing, which writes each chunk below the
+// next chunk to read.
+template <typename Wide>
+uint8_t ShrinkInts(uint8_t* data, uint8_t int_size, int64_t length,
+                   const uint8_t* null_bitmap) {
+  constexpr int64_t kChunkLength = 1024;
+  Wide chunk[kChunkLength];
+  uint8_t valid_bytes[kChunkLength];
+
+  uint8_t new_int_size = 1;
+  for (int64_t offset = 0; offset < length && new_int_size < int_size;
+       offset += kChunkLength) {
+    const int64_t chunk_length = std::min(kChunkLength, length - offset);
+    WidenInts(data, int_size, offset, chunk_length, chunk);
+    if (null_bitmap != nullptr) {
+      for (int64_t i = 0; i < chunk_length; ++i) {
+        valid_bytes[i] = BitUtil::GetBit(null_bitmap, offset + i);
+      }
+    }
+    new_int_size = DetectWidth(chunk, null_bitmap ? valid_bytes : nullptr, chunk_length,
+                               new_int_size);
+  }
+  if (new_int_size >= int_size) {
+    return int_size;
+  }
+  for (int64_t offset = 0; offset < length; offset += kChunkLength) {
+    const int64_t chunk_length = std::min(kChunkLength, length - offset);
+    WidenInts(data, int_size, offset, chunk_length, chunk);
+    NarrowInts(chunk, chunk_length, new_int_size, data + offset * new_int_size);
+  }
+  return new_int_size;
+}
+
+}  // namespace
+
 AdaptiveIntBuilder::AdaptiveIntBuilder(MemoryPool* pool) : AdaptiveIntBuilderBase(pool) {}
 
 Status AdaptiveIntBuilder::FinishInternal(std::shared_ptr<ArrayData>* out) {
+  if (shrink_on_finish_ && int_size_ > 1) {
+    int_size_ = ShrinkInts<int64_t>(raw_data_, int_size_, length_,
+                                    null_count_ > 0 ? null_bitmap_data_ : nullptr);
+  }
+
   std::shared_ptr<DataType> output_type;
   switch (int_size_) {
     case 1:
@@ -375,52 +507,13 @@ Status AdaptiveIntBuilder::AppendValues(const int64_t* values, int64_t length,
                                         const uint8_t* valid_bytes) {
   RETURN_NOT_OK(Reserve(length));
 
-  if (length > 0) {
-    if (int_size_ < 8) {
-      uint8_t new_int_size = int_size_;
-      for (int64_t i = 0; i < length; i++) {
-        if (valid_bytes == nullptr || valid_bytes[i]) {
-          new_int_size = internal::ExpandedIntSize(values[i], new_int_size);
-        }
-      }
-      if (new_int_size != int_size_) {
-        RETURN_NOT_OK(ExpandIntSize(new_int_size));
-      }
+  if (length > 0 && int_size_ < 8) {
+    const uint8_t new_int_size = DetectWidth(values, valid_bytes, length, int_size_);
+    if (new_int_size != int_size_) {
+      RETURN_NOT_OK(ExpandIntSize(new_int_size));
     }
   }
-
-  if (int_size_ == 8) {
-    std::memcpy(reinterpret_cast<int64_t*>(raw_data_) + length_, values,
-                sizeof(int64_t) * length);
-  } else {
-#ifdef _MSC_VER
-#pragma warning(push)
-#pragma warning(disable : 4996)
-#endif
-    // int_size_ may have changed, so we need to recheck
-    switch (int_size_) {
-      case 1: {
-        int8_t* data_ptr = reinterpret_cast<int8_t*>(raw_data_) + length_;
-        std::transform(values, values + length, data_ptr,
-                       [](int64_t x) { return static_cast<int8_t>(x); });
-      } break;
-      case 2: {
-        int16_t* data_ptr = reinterpret_cast<int16_t*>(raw_data_) + length_;
-        std::transform(values, values + length, data_ptr,
-                       [](int64_t x) { return static_cast<int16_t>(x); });
-      } break;
-      case 4: {
-        int32_t* data_ptr = reinterpret_cast<int32_t*>(raw_data_) + length_;
-        std::transform(values, values + length, data_ptr,
-                       [](int64_t x) { return static_cast<int32_t>(x); });
-      } break;
-      default:
-        DCHECK(false);
-    }
-#ifdef _MSC_VER
-#pragma warning(pop)
-#endif
-  }
+  NarrowInts(values, length, int_size_, raw_data_ + length_ * int_size_);
 
   // length_ is update by these
   ArrayBuilder::UnsafeAppendToBitmap(valid_bytes, length);
@@ -500,6 +593,11 @@ AdaptiveUIntBuilder::AdaptiveUIntBuilder(MemoryPool* pool)
     : AdaptiveIntBuilderBase(pool) {}
 
 Status AdaptiveUIntBuilder::FinishInternal(std::shared_ptr<ArrayData>* out) {
+  if (shrink_on_finish_ && int_size_ > 1) {
+    int_size_ = ShrinkInts<uint64_t>(raw_data_, int_size_, length_,
+                                     null_count_ > 0 ? null_bitmap_data_ : nullptr);
+  }
+
   std::shared_ptr<DataType> output_type;
   switch (int_size_) {
     case 1:
@@ -533,52 +631,13 @@ Status AdaptiveUIntBuilder::AppendValues(const uint64_t* values, int64_t length,
                                          const uint8_t* valid_bytes) {
   RETURN_NOT_OK(Reserve(length));
 
-  if (length > 0) {
-    if (int_size_ < 8) {
-      uint8_t new_int_size = int_size_;
-      for (int64_t i = 0; i < length; i++) {
-        if (valid_bytes == nullptr || valid_bytes[i]) {
-          new_int_size = internal::ExpandedUIntSize(values[i], new_int_size);
-        }
-      }
-      if (new_int_size != int_size_) {
-        RETURN_NOT_OK(ExpandIntSize(new_int_size));
-      }
-    }
-  }
-
-  if (int_size_ == 8) {
-    std::memcpy(reinterpret_cast<uint64_t*>(raw_data_) + length_, values,
-                sizeof(uint64_t) * length);
-  } else {
-#ifdef _MSC_VER
-#pragma warning(push)
-#pragma warning(disable : 4996)
-#endif
-    // int_size_ may have changed, so we need to recheck
-    switch (int_size_) {
-      case 1: {
-        uint8_t* data_ptr = reinterpret_cast<uint8_t*>(raw_data_) + length_;
-        std::transform(values, values + length, data_ptr,
-                       [](uint64_t x) { return static_cast<uint8_t>(x); });
-      } break;
-      case 2: {
-        uint16_t* data_ptr = reinterpret_cast<uint16_t*>(raw_data_) + length_;
-        std::transform(values, values + length, data_ptr,
-                       [](uint64_t x) { return static_cast<uint16_t>(x); });
-      } break;
-      case 4: {
-        uint32_t* data_ptr = reinterpret_cast<uint32_t*>(raw_data_) + length_;
-        std::transform(values, values + length, data_ptr,
-                       [](uint64_t x) { return static_cast<uint32_t>(x); });
-      } break;
-      default:
-        DCHECK(false);
+  if (length > 0 && int_size_ < 8) {
+    const uint8_t new_int_size = DetectWidth(values, valid_bytes, length, int_size_);
+    if (new_int_size != int_size_) {
+      RETURN_NOT_OK(ExpandIntSize(new_int_size));
     }
-#ifdef _MSC_VER
-#pragma warning(pop)
-#endif
   }
+  NarrowInts(values, length, int_size_, raw_data_ + length_ * int_size_);
 
   // length_ is update by these
   ArrayBuilder::UnsafeAppendToBitmap(valid_bytes, length);
@@ -724,9 +783,7 @@ Status BooleanBuilder::AppendValues(const uint8_t* values, int64_t length,
                                     const uint8_t* valid_bytes) {
   RETURN_NOT_OK(Reserve(length));
 
-  int64_t i = 0;
-  internal::GenerateBitsUnrolled(raw_data_, length_, length,
-                                 [values, &i]() -> bool { return values[i++] != 0; });
+  PackBytesToBitmap(values, length, raw_data_, length_);
 
   // this updates length_
   ArrayBuilder::UnsafeAppendToBitmap(valid_bytes, length);
@@ -887,12 +944,11 @@ struct DictionaryHashHelper<T, enable_if_binary<T>> {
 
   static Status AppendArray(Builder& builder, const Array& in_array) {
     const auto& array = checked_cast<const BinaryArray&>(in_array);
-    for (uint64_t index = 0, limit = array.length(); index < limit; ++index) {
-      int32_t length;
-      const uint8_t* ptr = array.GetValue(index, &length);
-      RETURN_NOT_OK(builder.Append(ptr, length));
+    if (array.length() == 0) {
+      return Status::OK();
     }
-    return Status::OK();
+    return builder.AppendValues(array.raw_value_offsets(), array.length(),
+                                array.value_data()->data());
   }
 };
 
@@ -970,6 +1026,11 @@ DictionaryBuilder<FixedSizeBinaryType>::DictionaryBuilder(
 
 template <typename T>
 void DictionaryBuilder<T>::Reset() {
+  // Also drop the memo table; the next Resize creates a fresh one
+  ArrayBuilder::Reset();
+  hash_table_.reset();
+  hash_slots_ = nullptr;
+  entry_id_offset_ = 0;
   dict_builder_.Reset();
   overflow_dict_builder_.Reset();
   values_builder_.Reset();
@@ -988,8 +1049,8 @@ Status DictionaryBuilder<T>::Resize(int64_t capacity) {
     hash_table_size_ = kInitialHashTableSize;
     entry_id_offset_ = 0;
     mod_bitmask_ = kInitialHashTableSize - 1;
-    hash_table_load_threshold_ =
-        static_cast<int64_t>(static_cast<double>(capacity) * kMaxHashTableLoad);
+    hash_table_load_threshold_ = static_cast<int64_t>(
+        static_cast<double>(kInitialHashTableSize) * kMaxHashTableLoad);
   }
   RETURN_NOT_OK(values_builder_.Resize(capacity));
   return ArrayBuilder::Resize(capacity);
@@ -1010,8 +1071,12 @@ int64_t DictionaryBuilder<T>::HashValue(const Scalar& value) {
 
 template <typename T>
 typename DictionaryBuilder<T>::Scalar DictionaryBuilder<T>::GetDictionaryValue(
-    typename TypeTraits<T>::BuilderType& dictionary_builder, int64_t index) {
-  return DictionaryHashHelper<T>::GetDictionaryValue(dictionary_builder, index);
+    int64_t index) {
+  if (index >= entry_id_offset_) {
+    return DictionaryHashHelper<T>::GetDictionaryValue(dict_builder_,
+                                                       index - entry_id_offset_);
+  }
+  return DictionaryHashHelper<T>::GetDictionaryValue(overflow_dict_builder_, index);
 }
 
 template <typename T>
@@ -1057,7 +1122,8 @@ Status DictionaryBuilder<T>::Append(const Scalar& value) {
     hash_slots_[j] = index;
     RETURN_NOT_OK(AppendDictionary(value));
 
-    if (ARROW_PREDICT_FALSE(static_cast<int32_t>(dict_builder_.length()) >
+    // The memo table holds the entries of previous Finish calls as well
+    if (ARROW_PREDICT_FALSE(dict_builder_.length() + entry_id_offset_ >
                             hash_table_load_threshold_)) {
       RETURN_NOT_OK(DoubleTableSize());
     }
@@ -1115,7 +1181,7 @@ Status DictionaryBuilder<FixedSizeBinaryType>::AppendArray(const Array& array) {
 template <typename T>
 Status DictionaryBuilder<T>::DoubleTableSize() {
 #define INNER_LOOP \
-  int64_t j = HashValue(GetDictionaryValue(dict_builder_, index)) & new_mod_bitmask
+  int64_t j = HashValue(GetDictionaryValue(index)) & new_mod_bitmask
 
   DOUBLE_TABLE_SIZE(, INNER_LOOP);
 
@@ -1301,6 +1367,234 @@ ArrayBuilder* ListBuilder::value_builder() const {
   return value_builder_.get();
 }
 
+// ----------------------------------------------------------------------
+// LargeListBuilder
+
+LargeListBuilder::LargeListBuilder(MemoryPool* pool,
+                                   std::shared_ptr<ArrayBuilder> const& value_builder,
+                                   const std::shared_ptr<DataType>& type)
+    : ArrayBuilder(type ? type
+                        : std::static_pointer_cast<DataType>(
+                              std::make_shared<LargeListType>(value_builder->type())),
+                   pool),
+      offsets_builder_(pool),
+      value_builder_(value_builder) {}
+
+Status LargeListBuilder::AppendValues(const int64_t* offsets, int64_t length,
+                                      const uint8_t* valid_bytes) {
+  RETURN_NOT_OK(Reserve(length));
+  UnsafeAppendToBitmap(valid_bytes, length);
+  offsets_builder_.UnsafeAppend(offsets, length);
+  return Status::OK();
+}
+
+Status LargeListBuilder::AppendNextOffset() {
+  return offsets_builder_.Append(value_builder_->length());
+}
+
+Status LargeListBuilder::Append(bool is_valid) {
+  RETURN_NOT_OK(Reserve(1));
+  UnsafeAppendToBitmap(is_valid);
+  return AppendNextOffset();
+}
+
+Status LargeListBuilder::Resize(int64_t capacity) {
+  // one more then requested for offsets
+  RETURN_NOT_OK(offsets_builder_.Resize((capacity + 1) * sizeof(int64_t)));
+  return ArrayBuilder::Resize(capacity);
+}
+
+Status LargeListBuilder::FinishInternal(std::shared_ptr<ArrayData>* out) {
+  RETURN_NOT_OK(AppendNextOffset());
+
+  // Offset padding zeroed by BufferBuilder
+  std::shared_ptr<Buffer> offsets;
+  RETURN_NOT_OK(offsets_builder_.Finish(&offsets));
+
+  std::shared_ptr<ArrayData> items;
+  if (value_builder_->length() == 0) {
+    // Try to make sure we get a non-null values buffer (ARROW-2744)
+    RETURN_NOT_OK(value_builder_->Resize(0));
+  }
+  RETURN_NOT_OK(value_builder_->FinishInternal(&items));
+
+  *out = ArrayData::Make(type_, length_, {null_bitmap_, offsets}, null_count_);
+  (*out)->child_data.emplace_back(std::move(items));
+  Reset();
+  return Status::OK();
+}
+
+void LargeListBuilder::Reset() {
+  ArrayBuilder::Reset();
+  offsets_builder_.Reset();
+  value_builder_->Reset();
+}
+
+// ----------------------------------------------------------------------
+// FixedSizeListBuilder
+
+FixedSizeListBuilder::FixedSizeListBuilder(
+    MemoryPool* pool, std::shared_ptr<ArrayBuilder> const& value_builder,
+    int32_t list_size)
+    : FixedSizeListBuilder(pool, value_builder,
+                           fixed_size_list(value_builder->type(), list_size)) {}
+
+FixedSizeListBuilder::FixedSizeListBuilder(
+    MemoryPool* pool, std::shared_ptr<ArrayBuilder> const& value_builder,
+    const std::shared_ptr<DataType>& type)
+    : ArrayBuilder(type, pool),
+      list_size_(checked_cast<const FixedSizeListType&>(*type).list_size()),
+      value_builder_(value_builder) {}
+
+Status FixedSizeListBuilder::AppendValues(int64_t length, const uint8_t* valid_bytes) {
+  RETURN_NOT_OK(Reserve(length));
+  UnsafeAppendToBitmap(valid_bytes, length);
+  return Status::OK();
+}
+
+Status FixedSizeListBuilder::Append(bool is_valid) {
+  RETURN_NOT_OK(Reserve(1));
+  UnsafeAppendToBitmap(is_valid);
+  return Status::OK();
+}
+
+Status FixedSizeListBuilder::FinishInternal(std::shared_ptr<ArrayData>* out) {
+  if (value_builder_->length() != length_ * list_size_) {
+    std::stringstream ss;
+    ss << "FixedSizeListBuilder of " << length_ << " lists of size " << list_size_
+       << " has " << value_builder_->length() << " values";
+    return Status::Invalid(ss.str());
+  }
+
+  std::shared_ptr<ArrayData> items;
+  if (value_builder_->length() == 0) {
+    // Try to make sure we get a non-null values buffer (ARROW-2744)
+    RETURN_NOT_OK(value_builder_->Resize(0));
+  }
+  RETURN_NOT_OK(value_builder_->FinishInternal(&items));
+
+  RETURN_NOT_OK(TrimBuffer(BitUtil::BytesForBits(length_), null_bitmap_.get()));
+  *out = ArrayData::Make(type_, length_, {null_bitmap_}, null_count_);
+  (*out)->child_data.emplace_back(std::move(items));
+  Reset();
+  return Status::OK();
+}
+
+void FixedSizeListBuilder::Reset() {
+  ArrayBuilder::Reset();
+  value_builder_->Reset();
+}
+
+// ----------------------------------------------------------------------
+// RunLengthEncodedBuilder
+
+RunLengthEncodedBuilder::RunLengthEncodedBuilder(
+    MemoryPool* pool, std::shared_ptr<ArrayBuilder> const& value_builder)
+    : RunLengthEncodedBuilder(pool, value_builder,
+                              run_length_encoded(value_builder->type())) {}
+
+RunLengthEncodedBuilder::RunLengthEncodedBuilder(
+    MemoryPool* pool, std::shared_ptr<ArrayBuilder> const& value_builder,
+    const std::shared_ptr<DataType>& type)
+    : ArrayBuilder(type, pool), run_ends_builder_(pool), value_builder_(value_builder) {}
+
+Status RunLengthEncodedBuilder::Resize(int64_t capacity) {
+  // Unlike other builders, the capacity counts runs and there is no bitmap
+  DCHECK_LE(capacity, kListMaximumElements);
+  RETURN_NOT_OK(
+      run_ends_builder_.Resize(capacity * sizeof(int32_t), /*shrink_to_fit=*/false));
+  capacity_ = capacity;
+  return Status::OK();
+}
+
+Status RunLengthEncodedBuilder::CheckLength(int64_t run_length) {
+  if (ARROW_PREDICT_FALSE(run_length <= 0)) {
+    return Status::Invalid("Runs must have a positive length");
+  }
+  if (ARROW_PREDICT_FALSE(length_ + run_length > std::numeric_limits<int32_t>::max())) {
+    std::stringstream ss;
+    ss << "Run-length-encoded array cannot contain more than "
+       << std::numeric_limits<int32_t>::max() << " slots, have "
+       << length_ + run_length;
+    return Status::CapacityError(ss.str());
+  }
+  return Status::OK();
+}
+
+Status RunLengthEncodedBuilder::AppendRun(int64_t run_length) {
+  RETURN_NOT_OK(CheckLength(run_length));
+  if (num_runs() == capacity_) {
+    RETURN_NOT_OK(Resize(BitUtil::NextPower2(num_runs() + 1)));
+  }
+  length_ += run_length;
+  run_ends_builder_.UnsafeAppend(static_cast<int32_t>(length_));
+  return Status::OK();
+}
+
+Status RunLengthEncodedBuilder::AppendRuns(const int32_t* run_lengths,
+                                           int64_t num_runs) {
+  int64_t total_length = 0;
+  for (int64_t i = 0; i < num_runs; ++i) {
+    if (ARROW_PREDICT_FALSE(run_lengths[i] <= 0)) {
+      return Status::Invalid("Runs must have a positive length");
+    }
+    total_length += run_lengths[i];
+  }
+  if (num_runs == 0) {
+    return Status::OK();
+  }
+  RETURN_NOT_OK(CheckLength(total_length));
+  if (this->num_runs() + num_runs > capacity_) {
+    RETURN_NOT_OK(Resize(BitUtil::NextPower2(this->num_runs() + num_runs)));
+  }
+  for (int64_t i = 0; i < num_runs; ++i) {
+    length_ += run_lengths[i];
+    run_ends_builder_.UnsafeAppend(static_cast<int32_t>(length_));
+  }
+  return Status::OK();
+}
+
+Status RunLengthEncodedBuilder::ExtendLastRun(int64_t run_length) {
+  if (num_runs() == 0) {
+    return Status::Invalid("No run to extend");
+  }
+  RETURN_NOT_OK(CheckLength(run_length));
+  length_ += run_length;
+  reinterpret_cast<int32_t*>(run_ends_builder_.mutable_data())[num_runs() - 1] =
+      static_cast<int32_t>(length_);
+  return Status::OK();
+}
+
+Status RunLengthEncodedBuilder::FinishInternal(std::shared_ptr<ArrayData>* out) {
+  if (value_builder_->length() != num_runs()) {
+    std::stringstream ss;
+    ss << "RunLengthEncodedBuilder of " << num_runs() << " runs has "
+       << value_builder_->length() << " values";
+    return Status::Invalid(ss.str());
+  }
+
+  std::shared_ptr<Buffer> run_ends;
+  RETURN_NOT_OK(run_ends_builder_.Finish(&run_ends));
+
+  std::shared_ptr<ArrayData> items;
+  if (value_builder_->length() == 0) {
+    // Try to make sure we get a non-null values buffer (ARROW-2744)
+    RETURN_NOT_OK(value_builder_->Resize(0));
+  }
+  RETURN_NOT_OK(value_builder_->FinishInternal(&items));
+
+  *out = ArrayData::Make(type_, length_, {nullptr, run_ends}, /*null_count=*/0);
+  (*out)->child_data.emplace_back(std::move(items));
+  Reset();
+  return Status::OK();
+}
+
+void RunLengthEncodedBuilder::Reset() {
+  ArrayBuilder::Reset();
+  run_ends_builder_.Reset();
+  value_builder_->Reset();
+}
+
 // ----------------------------------------------------------------------
 // String and binary
 
@@ -1355,6 +1649,28 @@ Status BinaryBuilder::AppendNull() {
   return Status::OK();
 }
 
+Status BinaryBuilder::AppendValues(const int32_t* offsets, int64_t length,
+                                   const uint8_t* data, const uint8_t* valid_bytes) {
+  const int32_t first_offset = offsets[0];
+  const int64_t total_length = offsets[length] - first_offset;
+  RETURN_NOT_OK(Reserve(length));
+  RETURN_NOT_OK(ReserveData(total_length));
+
+  // Rebase the offsets onto the end of the existing value data
+  const int32_t delta = static_cast<int32_t>(value_data_length()) - first_offset;
+  if (delta == 0) {
+    offsets_builder_.UnsafeAppend(offsets, length);
+  } else {
+    for (int64_t i = 0; i < length; ++i) {
+      offsets_builder_.UnsafeAppend(offsets[i] + delta);
+    }
+  }
+  value_data_builder_.UnsafeAppend(data + first_offset, total_length);
+
+  UnsafeAppendToBitmap(valid_bytes, length);
+  return Status::OK();
+}
+
 Status BinaryBuilder::FinishInternal(std::shared_ptr<ArrayData>* out) {
   // Write final offset (values length)
   RETURN_NOT_OK(AppendNextOffset());
@@ -1486,6 +1802,126 @@ Status StringBuilder::Append(const char** values, int64_t length,
   return AppendValues(values, length, valid_bytes);
 }
 
+// ----------------------------------------------------------------------
+// Large string and binary
+
+LargeBinaryBuilder::LargeBinaryBuilder(const std::shared_ptr<DataType>& type,
+                                       MemoryPool* pool)
+    : ArrayBuilder(type, pool), offsets_builder_(pool), value_data_builder_(pool) {}
+
+LargeBinaryBuilder::LargeBinaryBuilder(MemoryPool* pool)
+    : LargeBinaryBuilder(large_binary(), pool) {}
+
+Status LargeBinaryBuilder::Resize(int64_t capacity) {
+  // one more then requested for offsets
+  RETURN_NOT_OK(offsets_builder_.Resize((capacity + 1) * sizeof(int64_t)));
+  return ArrayBuilder::Resize(capacity);
+}
+
+Status LargeBinaryBuilder::ReserveData(int64_t elements) {
+  return value_data_builder_.Reserve(elements);
+}
+
+Status LargeBinaryBuilder::Append(const uint8_t* value, int64_t length) {
+  RETURN_NOT_OK(Reserve(1));
+  RETURN_NOT_OK(offsets_builder_.Append(value_data_builder_.length()));
+  RETURN_NOT_OK(value_data_builder_.Append(value, length));
+
+  UnsafeAppendToBitmap(true);
+  return Status::OK();
+}
+
+Status LargeBinaryBuilder::AppendNull() {
+  RETURN_NOT_OK(offsets_builder_.Append(value_data_builder_.length()));
+  RETURN_NOT_OK(Reserve(1));
+
+  UnsafeAppendToBitmap(false);
+  return Status::OK();
+}
+
+Status LargeBinaryBuilder::AppendValues(const int64_t* offsets, int64_t length,
+                                        const uint8_t* data,
+                                        const uint8_t* valid_bytes) {
+  const int64_t first_offset = offsets[0];
+  const int64_t total_length = offsets[length] - first_offset;
+  RETURN_NOT_OK(Reserve(length));
+  RETURN_NOT_OK(ReserveData(total_length));
+
+  // Rebase the offsets onto the end of the existing value data
+  const int64_t delta = value_data_length() - first_offset;
+  if (delta == 0) {
+    offsets_builder_.UnsafeAppend(offsets, length);
+  } else {
+    for (int64_t i = 0; i < length; ++i) {
+      offsets_builder_.UnsafeAppend(offsets[i] + delta);
+    }
+  }
+  value_data_builder_.UnsafeAppend(data + first_offset, total_length);
+
+  UnsafeAppendToBitmap(valid_bytes, length);
+  return Status::OK();
+}
+
+Status LargeBinaryBuilder::FinishInternal(std::shared_ptr<ArrayData>* out) {
+  // Write final offset (values length)
+  RETURN_NOT_OK(offsets_builder_.Append(value_data_builder_.length()));
+
+  // These buffers' padding zeroed by BufferBuilder
+  std::shared_ptr<Buffer> offsets, value_data;
+  RETURN_NOT_OK(offsets_builder_.Finish(&offsets));
+  RETURN_NOT_OK(value_data_builder_.Finish(&value_data));
+
+  *out = ArrayData::Make(type_, length_, {null_bitmap_, offsets, value_data}, null_count_,
+                         0);
+  Reset();
+  return Status::OK();
+}
+
+void LargeBinaryBuilder::Reset() {
+  ArrayBuilder::Reset();
+  offsets_builder_.Reset();
+  value_data_builder_.Reset();
+}
+
+const uint8_t* LargeBinaryBuilder::GetValue(int64_t i, int64_t* out_length) const {
+  const int64_t* offsets = offsets_builder_.data();
+  int64_t offset = offsets[i];
+  if (i == (length_ - 1)) {
+    *out_length = value_data_builder_.length() - offset;
+  } else {
+    *out_length = offsets[i + 1] - offset;
+  }
+  return value_data_builder_.data() + offset;
+}
+
+LargeStringBuilder::LargeStringBuilder(MemoryPool* pool)
+    : LargeBinaryBuilder(large_utf8(), pool) {}
+
+Status LargeStringBuilder::AppendValues(const std::vector<std::string>& values,
+                                        const uint8_t* valid_bytes) {
+  const int64_t length = static_cast<int64_t>(values.size());
+  int64_t total_length = 0;
+  for (int64_t i = 0; i < length; ++i) {
+    if (valid_bytes == nullptr || valid_bytes[i]) {
+      total_length += static_cast<int64_t>(values[i].size());
+    }
+  }
+  RETURN_NOT_OK(Reserve(length));
+  RETURN_NOT_OK(ReserveData(total_length));
+
+  for (int64_t i = 0; i < length; ++i) {
+    offsets_builder_.UnsafeAppend(value_data_builder_.length());
+    if (valid_bytes == nullptr || valid_bytes[i]) {
+      value_data_builder_.UnsafeAppend(
+          reinterpret_cast<const uint8_t*>(values[i].data()),
+          static_cast<int64_t>(values[i].size()));
+    }
+  }
+
+  UnsafeAppendToBitmap(valid_bytes, length);
+  return Status::OK();
+}
+
 // ----------------------------------------------------------------------
 // Fixed width binary
 
@@ -1574,6 +2010,167 @@ Status StructBuilder::FinishInternal(std::shared_ptr<ArrayData>* out) {
   return Status::OK();
 }
 
+// ----------------------------------------------------------------------
+// UnionBuilder
+
+UnionBuilder::UnionBuilder(const std::shared_ptr<DataType>& type, MemoryPool* pool,
+                           std::vector<std::shared_ptr<ArrayBuilder>>&& child_builders)
+    : ArrayBuilder(type, pool),
+      mode_(checked_cast<const UnionType&>(*type).mode()),
+      child_builders_(std::move(child_builders)),
+      child_of_code_(std::numeric_limits<uint8_t>::max() + 1, -1),
+      child_lengths_(child_builders_.size(), 0),
+      types_builder_(pool),
+      offsets_builder_(pool) {
+  const std::vector<uint8_t>& type_codes =
+      checked_cast<const UnionType&>(*type).type_codes();
+  for (size_t i = 0; i < type_codes.size(); ++i) {
+    child_of_code_[type_codes[i]] = static_cast<int>(i);
+  }
+}
+
+Status UnionBuilder::CheckTypeCodes(const uint8_t* type_codes, int64_t length) const {
+  for (int64_t i = 0; i < length; ++i) {
+    if (ARROW_PREDICT_FALSE(child_of_code_[type_codes[i]] < 0)) {
+      std::stringstream ss;
+      ss << "Type code " << static_cast<int>(type_codes[i]) << " not in "
+         << type_->ToString();
+      return Status::Invalid(ss.str());
+    }
+  }
+  return Status::OK();
+}
+
+Status UnionBuilder::NextOffset(int child, int32_t* out) {
+  const int64_t offset = child_lengths_[child];
+  if (ARROW_PREDICT_FALSE(offset > std::numeric_limits<int32_t>::max())) {
+    return Status::CapacityError(
+        "Dense union child cannot have more than INT32_MAX values");
+  }
+  child_lengths_[child] = offset + 1;
+  *out = static_cast<int32_t>(offset);
+  return Status::OK();
+}
+
+Status UnionBuilder::Append(uint8_t type_code) {
+  RETURN_NOT_OK(CheckTypeCodes(&type_code, 1));
+  RETURN_NOT_OK(Reserve(1));
+  UnsafeAppendToBitmap(true);
+  types_builder_.UnsafeAppend(type_code);
+  if (mode_ == UnionMode::DENSE) {
+    int32_t offset;
+    RETURN_NOT_OK(NextOffset(child_of_code_[type_code], &offset));
+    offsets_builder_.UnsafeAppend(offset);
+  }
+  return Status::OK();
+}
+
+Status UnionBuilder::AppendNull() {
+  RETURN_NOT_OK(Reserve(1));
+  UnsafeAppendToBitmap(false);
+  types_builder_.UnsafeAppend(checked_cast<const UnionType&>(*type_).type_codes()[0]);
+  if (mode_ == UnionMode::DENSE) {
+    offsets_builder_.UnsafeAppend(0);
+  }
+  return Status::OK();
+}
+
+Status UnionBuilder::AppendValues(const uint8_t* type_codes, int64_t length,
+                                  const uint8_t* valid_bytes) {
+  RETURN_NOT_OK(CheckTypeCodes(type_codes, length));
+  RETURN_NOT_OK(Reserve(length));
+  UnsafeAppendToBitmap(valid_bytes, length);
+  types_builder_.UnsafeAppend(type_codes, length);
+  if (mode_ == UnionMode::DENSE) {
+    for (int64_t i = 0; i < length; ++i) {
+      int32_t offset = 0;
+      if (valid_bytes == nullptr || valid_bytes[i] != 0) {
+        RETURN_NOT_OK(NextOffset(child_of_code_[type_codes[i]], &offset));
+      }
+      offsets_builder_.UnsafeAppend(offset);
+    }
+  }
+  return Status::OK();
+}
+
+Status UnionBuilder::AppendValues(const uint8_t* type_codes, const int32_t* offsets,
+                                  int64_t length, const uint8_t* valid_bytes) {
+  if (mode_ != UnionMode::DENSE) {
+    return Status::Invalid("Only dense unions have value offsets");
+  }
+  RETURN_NOT_OK(CheckTypeCodes(type_codes, length));
+  for (int64_t i = 0; i < length; ++i) {
+    if (valid_bytes != nullptr && valid_bytes[i] == 0) {
+      continue;
+    }
+    if (ARROW_PREDICT_FALSE(offsets[i] < 0)) {
+      return Status::Invalid("Dense union offsets must not be negative");
+    }
+    int64_t& child_length = child_lengths_[child_of_code_[type_codes[i]]];
+    child_length = std::max<int64_t>(child_length, offsets[i] + int64_t(1));
+  }
+  RETURN_NOT_OK(Reserve(length));
+  UnsafeAppendToBitmap(valid_bytes, length);
+  types_builder_.UnsafeAppend(type_codes, length);
+  offsets_builder_.UnsafeAppend(offsets, length);
+  return Status::OK();
+}
+
+Status UnionBuilder::Resize(int64_t capacity) {
+  RETURN_NOT_OK(types_builder_.Resize(capacity));
+  if (mode_ == UnionMode::DENSE) {
+    RETURN_NOT_OK(offsets_builder_.Resize(capacity * sizeof(int32_t)));
+  }
+  return ArrayBuilder::Resize(capacity);
+}
+
+void UnionBuilder::Reset() {
+  ArrayBuilder::Reset();
+  types_builder_.Reset();
+  offsets_builder_.Reset();
+  std::fill(child_lengths_.begin(), child_lengths_.end(), 0);
+  for (const auto& child_builder : child_builders_) {
+    child_builder->Reset();
+  }
+}
+
+Status UnionBuilder::FinishInternal(std::shared_ptr<ArrayData>* out) {
+  for (size_t i = 0; i < child_builders_.size(); ++i) {
+    const int64_t child_length = child_builders_[i]->length();
+    const bool consistent = mode_ == UnionMode::DENSE ? child_length >= child_lengths_[i]
+                                                      : child_length == length_;
+    if (!consistent) {
+      std::stringstream ss;
+      ss << "Union child " << i << " has " << child_length << " values, but ";
+      if (mode_ == UnionMode::DENSE) {
+        ss << "the slots refer to " << child_lengths_[i];
+      } else {
+        ss << "a sparse union of length " << length_ << " needs as many";
+      }
+      return Status::Invalid(ss.str());
+    }
+  }
+
+  RETURN_NOT_OK(TrimBuffer(BitUtil::BytesForBits(length_), null_bitmap_.get()));
+  std::shared_ptr<Buffer> types, offsets;
+  RETURN_NOT_OK(types_builder_.Finish(&types));
+  if (mode_ == UnionMode::DENSE) {
+    RETURN_NOT_OK(offsets_builder_.Finish(&offsets));
+  }
+  *out = ArrayData::Make(type_, length_, {null_bitmap_, types, offsets}, null_count_);
+
+  (*out)->child_data.resize(child_builders_.size());
+  for (size_t i = 0; i < child_builders_.size(); ++i) {
+    if (child_builders_[i]->length() == 0) {
+      // Try to make sure the child buffers are initialized
+      RETURN_NOT_OK(child_builders_[i]->Resize(0));
+    }
+    RETURN_NOT_OK(child_builders_[i]->FinishInternal(&(*out)->child_data[i]));
+  }
+  Reset();
+  return Status::OK();
+}
+
 // ----------------------------------------------------------------------
 // Helper functions
 
@@ -1612,6 +2209,8 @@ Status MakeBuilder(MemoryPool* pool, const std::shared_ptr<DataType>& type,
       BUILDER_CASE(DOUBLE, DoubleBuilder);
       BUILDER_CASE(STRING, StringBuilder);
       BUILDER_CASE(BINARY, BinaryBuilder);
+      BUILDER_CASE(LARGE_STRING, LargeStringBuilder);
+      BUILDER_CASE(LARGE_BINARY, LargeBinaryBuilder);
       BUILDER_CASE(FIXED_SIZE_BINARY, FixedSizeBinaryBuilder);
       BUILDER_CASE(DECIMAL, Decimal128Builder);
     case Type::LIST: {
@@ -1623,6 +2222,33 @@ Status MakeBuilder(MemoryPool* pool, const std::shared_ptr<DataType>& type,
       return Status::OK();
     }
 
+    case Type::LARGE_LIST: {
+      std::unique_ptr<ArrayBuilder> value_builder;
+      std::shared_ptr<DataType> value_type =
+          checked_cast<const LargeListType&>(*type).value_type();
+      RETURN_NOT_OK(MakeBuilder(pool, value_type, &value_builder));
+      out->reset(new LargeListBuilder(pool, std::move(value_builder), type));
+      return Status::OK();
+    }
+
+    case Type::FIXED_SIZE_LIST: {
+      std::unique_ptr<ArrayBuilder> value_builder;
+      std::shared_ptr<DataType> value_type =
+          checked_cast<const FixedSizeListType&>(*type).value_type();
+      RETURN_NOT_OK(MakeBuilder(pool, value_type, &value_builder));
+      out->reset(new FixedSizeListBuilder(pool, std::move(value_builder), type));
+      return Status::OK();
+    }
+
+    case Type::RUN_LENGTH_ENCODED: {
+      std::unique_ptr<ArrayBuilder> value_builder;
+      std::shared_ptr<DataType> value_type =
+          checked_cast<const RunLengthEncodedType&>(*type).value_type();
+      RETURN_NOT_OK(MakeBuilder(pool, value_type, &value_builder));
+      out->reset(new RunLengthEncodedBuilder(pool, std::move(value_builder), type));
+      return Status::OK();
+    }
+
     case Type::STRUCT: {
       const std::vector<std::shared_ptr<Field>>& fields = type->children();
       std::vector<std::shared_ptr<ArrayBuilder>> values_builder;
@@ -1636,6 +2262,17 @@ Status MakeBuilder(MemoryPool* pool, const std::shared_ptr<DataType>& type,
       return Status::OK();
     }
 
+    case Type::UNION: {
+      std::vector<std::shared_ptr<ArrayBuilder>> child_builders;
+      for (const auto& child : type->children()) {
+        std::unique_ptr<ArrayBuilder> builder;
+        RETURN_NOT_OK(MakeBuilder(pool, child->type(), &builder));
+        child_builders.emplace_back(std::move(builder));
+      }
+      out->reset(new UnionBuilder(type, pool, std::move(child_builders)));
+      return Status::OK();
+    }
+
     default: {
       std::stringstream ss;
       ss << "MakeBuilder: cannot construct builder for type " << type->ToString();
@@ -1644,4 +2281,35 @@ Status MakeBuilder(MemoryPool* pool, const std::shared_ptr<DataType>& type,
   }
 }
 
+Status FinishBuilders(const std::vector<ArrayBuilder*>& builders,
+                      std::shared_ptr<ChunkedArray>* out, bool use_threads) {
+  if (builders.empty()) {
+    return Status::Invalid("Must pass at least one builder");
+  }
+  const std::shared_ptr<DataType> type = builders[0]->type();
+  for (const ArrayBuilder* builder : builders) {
+    if (!builder->type()->Equals(*type)) {
+      std::stringstream ss;
+      ss << "Builders must all have the same type, got " << type->ToString() << " and "
+         << builder->type()->ToString();
+      return Status::Invalid(ss.str());
+    }
+  }
+
+  ArrayVector chunks(builders.size());
+  auto FinishOne = [&builders, &chunks](int i) {
+    return builders[i]->Finish(&chunks[i]);
+  };
+  const int num_builders = static_cast<int>(builders.size());
+  if (use_threads) {
+    RETURN_NOT_OK(ParallelFor(num_builders, FinishOne));
+  } else {
+    for (int i = 0; i < num_builders; ++i) {
+      RETURN_NOT_OK(FinishOne(i));
+    }
+  }
+  *out = std::make_shared<ChunkedArray>(chunks, type);
+  return Status::OK();
+}
+
 }  // namespace arrow
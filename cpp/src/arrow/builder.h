@@ -29,6 +29,7 @@
 
 #include "arrow/buffer.h"
 #include "arrow/memory_pool.h"
+#include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
@@ -40,6 +41,7 @@
 namespace arrow {
 
 class Array;
+class ChunkedArray;
 class Decimal128;
 
 constexpr int64_t kBinaryMemoryLimit = std::numeric_limits<int32_t>::max() - 1;
@@ -133,6 +135,12 @@ class ARROW_EXPORT ArrayBuilder {
   /// \return Status
   Status Finish(std::shared_ptr<Array>* out);
 
+  /// \brief Return result of builder as an Array object.
+  ///        Resets the builder except for DictionaryBuilder
+  ///
+  /// \return the finalized Array object, or the error
+  Result<std::shared_ptr<Array>> Finish();
+
   std::shared_ptr<DataType> type() const { return type_; }
 
   // Unsafe operations (don't check capacity/don't resize)
@@ -464,6 +472,14 @@ class ARROW_EXPORT AdaptiveIntBuilderBase : public ArrayBuilder {
   ARROW_DEPRECATED("Use Finish instead")
   std::shared_ptr<Buffer> data() const { return data_; }
 
+  /// \brief Whether Finish narrows the values to the smallest width holding
+  /// the valid ones
+  ///
+  /// The width only ever grows, and is kept by Finish and Reset, so that the
+  /// arrays after the first of a reused builder are at least as wide as the
+  /// widest before. Off by default.
+  void set_shrink_on_finish(bool shrink) { shrink_on_finish_ = shrink; }
+
   void Reset() override;
   Status Resize(int64_t capacity) override;
 
@@ -472,6 +488,7 @@ class ARROW_EXPORT AdaptiveIntBuilderBase : public ArrayBuilder {
   uint8_t* raw_data_;
 
   uint8_t int_size_;
+  bool shrink_on_finish_;
 };
 
 // Check if we would need to expand the underlying storage type
@@ -888,6 +905,128 @@ class ARROW_EXPORT ListBuilder : public ArrayBuilder {
   Status AppendNextOffset();
 };
 
+/// \class LargeListBuilder
+/// \brief Builder class for list arrays with 64-bit offsets
+///
+/// As ListBuilder, for lists whose values do not fit in 32-bit offsets.
+class ARROW_EXPORT LargeListBuilder : public ArrayBuilder {
+ public:
+  LargeListBuilder(MemoryPool* pool, std::shared_ptr<ArrayBuilder> const& value_builder,
+                   const std::shared_ptr<DataType>& type = NULLPTR);
+
+  Status Resize(int64_t capacity) override;
+  void Reset() override;
+  Status FinishInternal(std::shared_ptr<ArrayData>* out) override;
+
+  /// \brief Vector append
+  ///
+  /// If passed, valid_bytes is of equal length to values, and any zero byte
+  /// will be considered as a null for that slot
+  Status AppendValues(const int64_t* offsets, int64_t length,
+                      const uint8_t* valid_bytes = NULLPTR);
+
+  /// \brief Start a new variable-length list slot
+  ///
+  /// This function should be called before beginning to append elements to the
+  /// value builder
+  Status Append(bool is_valid = true);
+
+  Status AppendNull() { return Append(false); }
+
+  ArrayBuilder* value_builder() const { return value_builder_.get(); }
+
+ protected:
+  TypedBufferBuilder<int64_t> offsets_builder_;
+  std::shared_ptr<ArrayBuilder> value_builder_;
+
+  Status AppendNextOffset();
+};
+
+/// \class FixedSizeListBuilder
+/// \brief Builder class for lists of the same number of values
+///
+/// Each slot is appended here, and its list_size values are appended to the
+/// value builder separately. Null slots need list_size values too, which may
+/// be nulls.
+class ARROW_EXPORT FixedSizeListBuilder : public ArrayBuilder {
+ public:
+  FixedSizeListBuilder(MemoryPool* pool,
+                       std::shared_ptr<ArrayBuilder> const& value_builder,
+                       int32_t list_size);
+
+  FixedSizeListBuilder(MemoryPool* pool,
+                       std::shared_ptr<ArrayBuilder> const& value_builder,
+                       const std::shared_ptr<DataType>& type);
+
+  Status FinishInternal(std::shared_ptr<ArrayData>* out) override;
+  void Reset() override;
+
+  /// \brief Vector append of length slots
+  ///
+  /// If passed, valid_bytes is of equal length to values, and any zero byte
+  /// will be considered as a null for that slot
+  Status AppendValues(int64_t length, const uint8_t* valid_bytes = NULLPTR);
+
+  /// \brief Append a slot, whose values are appended to the value builder
+  Status Append(bool is_valid = true);
+
+  Status AppendNull() { return Append(false); }
+
+  ArrayBuilder* value_builder() const { return value_builder_.get(); }
+
+  int32_t list_size() const { return list_size_; }
+
+ protected:
+  int32_t list_size_;
+  std::shared_ptr<ArrayBuilder> value_builder_;
+};
+
+// ----------------------------------------------------------------------
+// RunLengthEncodedBuilder
+
+/// \class RunLengthEncodedBuilder
+/// \brief Builder class for run-length-encoded arrays
+///
+/// Each run is appended here with its length, and its value is appended to
+/// the value builder separately. Null runs have a null value. The builder
+/// keeps a run end per run and allocates nothing per logical slot.
+class ARROW_EXPORT RunLengthEncodedBuilder : public ArrayBuilder {
+ public:
+  RunLengthEncodedBuilder(MemoryPool* pool,
+                          std::shared_ptr<ArrayBuilder> const& value_builder);
+
+  RunLengthEncodedBuilder(MemoryPool* pool,
+                          std::shared_ptr<ArrayBuilder> const& value_builder,
+                          const std::shared_ptr<DataType>& type);
+
+  /// \brief Reserve space for the run ends of the indicated number of runs
+  Status Resize(int64_t capacity) override;
+  Status FinishInternal(std::shared_ptr<ArrayData>* out) override;
+  void Reset() override;
+
+  /// \brief Start a run of run_length slots, whose value is appended to the
+  /// value builder
+  Status AppendRun(int64_t run_length);
+
+  /// \brief Vector append of num_runs runs, whose values are appended to the
+  /// value builder
+  Status AppendRuns(const int32_t* run_lengths, int64_t num_runs);
+
+  /// \brief Lengthen the last run by run_length slots, for values equal to
+  /// the last one
+  Status ExtendLastRun(int64_t run_length);
+
+  int64_t num_runs() const { return run_ends_builder_.length(); }
+
+  ArrayBuilder* value_builder() const { return value_builder_.get(); }
+
+ protected:
+  Status CheckLength(int64_t run_length);
+
+  TypedBufferBuilder<int32_t> run_ends_builder_;
+  std::shared_ptr<ArrayBuilder> value_builder_;
+};
+
 // ----------------------------------------------------------------------
 // Binary and String
 
@@ -911,6 +1050,21 @@ class ARROW_EXPORT BinaryBuilder : public ArrayBuilder {
 
   Status AppendNull();
 
+  /// \brief Append a sequence of values laid out as in a BinaryArray
+  ///
+  /// The offsets and value bytes are copied in bulk after a single capacity
+  /// check, rather than one value at a time.
+  ///
+  /// \param[in] offsets length + 1 offsets into data; the offsets need not
+  /// start at zero
+  /// \param[in] length the number of values to append
+  /// \param[in] data the value bytes referenced by offsets
+  /// \param[in] valid_bytes an optional sequence of bytes where non-zero
+  /// indicates a valid (non-null) value
+  /// \return Status
+  Status AppendValues(const int32_t* offsets, int64_t length, const uint8_t* data,
+                      const uint8_t* valid_bytes = NULLPTR);
+
   void Reset() override;
   Status Resize(int64_t capacity) override;
 
@@ -945,6 +1099,7 @@ class ARROW_EXPORT StringBuilder : public BinaryBuilder {
   explicit StringBuilder(MemoryPool* pool ARROW_MEMORY_POOL_DEFAULT);
 
   using BinaryBuilder::Append;
+  using BinaryBuilder::AppendValues;
   using BinaryBuilder::Reset;
 
   /// \brief Append a sequence of strings in one shot.
@@ -977,6 +1132,82 @@ class ARROW_EXPORT StringBuilder : public BinaryBuilder {
                 const uint8_t* valid_bytes = NULLPTR);
 };
 
+/// \class LargeBinaryBuilder
+/// \brief Builder class for variable-length binary data with 64-bit offsets
+class ARROW_EXPORT LargeBinaryBuilder : public ArrayBuilder {
+ public:
+  explicit LargeBinaryBuilder(MemoryPool* pool ARROW_MEMORY_POOL_DEFAULT);
+
+  LargeBinaryBuilder(const std::shared_ptr<DataType>& type, MemoryPool* pool);
+
+  Status Append(const uint8_t* value, int64_t length);
+
+  Status Append(const char* value, int64_t length) {
+    return Append(reinterpret_cast<const uint8_t*>(value), length);
+  }
+
+  Status Append(const std::string& value) {
+    return Append(value.c_str(), static_cast<int64_t>(value.size()));
+  }
+
+  Status AppendNull();
+
+  /// \brief Append a sequence of values laid out as in a LargeBinaryArray
+  ///
+  /// \param[in] offsets length + 1 offsets into data; the offsets need not
+  /// start at zero
+  /// \param[in] length the number of values to append
+  /// \param[in] data the value bytes referenced by offsets
+  /// \param[in] valid_bytes an optional sequence of bytes where non-zero
+  /// indicates a valid (non-null) value
+  /// \return Status
+  Status AppendValues(const int64_t* offsets, int64_t length, const uint8_t* data,
+                      const uint8_t* valid_bytes = NULLPTR);
+
+  void Reset() override;
+  Status Resize(int64_t capacity) override;
+
+  /// \brief Ensures there is enough allocated capacity to append the indicated
+  /// number of bytes to the value data buffer without additional allocations
+  Status ReserveData(int64_t elements);
+
+  Status FinishInternal(std::shared_ptr<ArrayData>* out) override;
+
+  /// \return size of values buffer so far
+  int64_t value_data_length() const { return value_data_builder_.length(); }
+  /// \return capacity of values buffer
+  int64_t value_data_capacity() const { return value_data_builder_.capacity(); }
+
+  /// Temporary access to a value.
+  ///
+  /// This pointer becomes invalid on the next modifying operation.
+  const uint8_t* GetValue(int64_t i, int64_t* out_length) const;
+
+ protected:
+  TypedBufferBuilder<int64_t> offsets_builder_;
+  TypedBufferBuilder<uint8_t> value_data_builder_;
+};
+
+/// \class LargeStringBuilder
+/// \brief Builder class for UTF8 strings with 64-bit offsets
+class ARROW_EXPORT LargeStringBuilder : public LargeBinaryBuilder {
+ public:
+  using LargeBinaryBuilder::LargeBinaryBuilder;
+  explicit LargeStringBuilder(MemoryPool* pool ARROW_MEMORY_POOL_DEFAULT);
+
+  using LargeBinaryBuilder::Append;
+  using LargeBinaryBuilder::AppendValues;
+
+  /// \brief Append a sequence of strings in one shot.
+  ///
+  /// \param[in] values a vector of strings
+  /// \param[in] valid_bytes an optional sequence of bytes where non-zero
+  /// indicates a valid (non-null) value
+  /// \return Status
+  Status AppendValues(const std::vector<std::string>& values,
+                      const uint8_t* valid_bytes = NULLPTR);
+};
+
 // ----------------------------------------------------------------------
 // FixedSizeBinaryBuilder
 
@@ -1095,6 +1326,71 @@ class ARROW_EXPORT StructBuilder : public ArrayBuilder {
   std::vector<std::shared_ptr<ArrayBuilder>> field_builders_;
 };
 
+// ----------------------------------------------------------------------
+// Union
+
+/// \brief Builder for dense and sparse UnionArray, after the mode of its type
+///
+/// Each slot is appended with the type code of its child, and its value is
+/// appended to that child's builder separately. In dense mode only that child
+/// gets the value, and the slot refers to it by its offset in the child. In
+/// sparse mode every child must get a value or a null for every slot.
+class ARROW_EXPORT UnionBuilder : public ArrayBuilder {
+ public:
+  UnionBuilder(const std::shared_ptr<DataType>& type, MemoryPool* pool,
+               std::vector<std::shared_ptr<ArrayBuilder>>&& child_builders);
+
+  Status Resize(int64_t capacity) override;
+  void Reset() override;
+  Status FinishInternal(std::shared_ptr<ArrayData>* out) override;
+
+  /// \brief Append a slot of the child with the given type code
+  ///
+  /// In dense mode the slot refers to the next value appended to the child.
+  Status Append(uint8_t type_code);
+
+  /// \brief Append a null slot, of the first type code of the union, which in
+  /// dense mode refers to no child value
+  Status AppendNull();
+
+  /// \brief Vector append of the type codes of length slots
+  ///
+  /// In dense mode each valid slot refers to the next value appended to the
+  /// child of its type code. If passed, valid_bytes is of equal length to
+  /// type_codes, and any zero byte will be considered as a null for that slot.
+  Status AppendValues(const uint8_t* type_codes, int64_t length,
+                      const uint8_t* valid_bytes = NULLPTR);
+
+  /// \brief Vector append of the type codes of length dense union slots and
+  /// of the offsets of their values in the children
+  ///
+  /// If passed, valid_bytes is of equal length to type_codes, and any zero
+  /// byte will be considered as a null for that slot.
+  Status AppendValues(const uint8_t* type_codes, const int32_t* offsets, int64_t length,
+                      const uint8_t* valid_bytes = NULLPTR);
+
+  ArrayBuilder* child_builder(int i) const { return child_builders_[i].get(); }
+
+  int num_fields() const { return static_cast<int>(child_builders_.size()); }
+
+  UnionMode::type mode() const { return mode_; }
+
+ protected:
+  Status CheckTypeCodes(const uint8_t* type_codes, int64_t length) const;
+
+  // The offset of the next value of a child in dense mode
+  Status NextOffset(int child, int32_t* out);
+
+  UnionMode::type mode_;
+  std::vector<std::shared_ptr<ArrayBuilder>> child_builders_;
+  // The child of each type code, -1 for the codes not in the type
+  std::vector<int> child_of_code_;
+  // In dense mode, the number of values of each child the slots refer to
+  std::vector<int64_t> child_lengths_;
+  TypedBufferBuilder<uint8_t> types_builder_;
+  TypedBufferBuilder<int32_t> offsets_builder_;
+};
+
 // ----------------------------------------------------------------------
 // Dictionary builder
 
@@ -1159,6 +1455,8 @@ class ARROW_EXPORT DictionaryBuilder : public ArrayBuilder {
   /// \brief Append a whole dense array to the builder
   Status AppendArray(const Array& array);
 
+  /// \brief Reset the builder, discarding the dictionary accumulated by
+  /// previous Finish calls
   void Reset() override;
   Status Resize(int64_t capacity) override;
   Status FinishInternal(std::shared_ptr<ArrayData>* out) override;
@@ -1169,8 +1467,9 @@ class ARROW_EXPORT DictionaryBuilder : public ArrayBuilder {
  protected:
   // Hash table implementation helpers
   Status DoubleTableSize();
-  Scalar GetDictionaryValue(typename TypeTraits<T>::BuilderType& dictionary_builder,
-                            int64_t index);
+  // Get the dictionary entry with the given memo table index, which may come
+  // from a previous Finish call
+  Scalar GetDictionaryValue(int64_t index);
   int64_t HashValue(const Scalar& value);
   // Check whether the dictionary entry in *slot* is equal to the given *value*
   bool SlotDifferent(hash_slot_t slot, const Scalar& value);
@@ -1271,6 +1570,20 @@ class ARROW_EXPORT StringDictionaryBuilder : public DictionaryBuilder<StringType
 Status ARROW_EXPORT MakeBuilder(MemoryPool* pool, const std::shared_ptr<DataType>& type,
                                 std::unique_ptr<ArrayBuilder>* out);
 
+/// \brief Finish several builders of the same type into one ChunkedArray
+///
+/// Each builder becomes one chunk, in order, so no data is copied. This lets
+/// independent producer threads each fill their own builder and hand the
+/// result over as a single column. The builders are reset as by Finish.
+///
+/// \param[in] builders the builders to finish; all must have the same type
+/// \param[out] out the resulting chunked array
+/// \param[in] use_threads finish the builders in parallel on the CPU thread pool
+/// \return Status
+ARROW_EXPORT
+Status FinishBuilders(const std::vector<ArrayBuilder*>& builders,
+                      std::shared_ptr<ChunkedArray>* out, bool use_threads = true);
+
 }  // namespace arrow
 
 #endif  // ARROW_BUILDER_H_
@@ -19,7 +19,9 @@
 
 #include "arrow/compare.h"
 
+#include <algorithm>
 #include <cstdint>
+#include <cstring>
 #include <memory>
 #include <vector>
 
@@ -40,6 +42,53 @@ namespace arrow {
 
 namespace internal {
 
+// Call compare_run(left_start, right_start, length) on each run of valid slots
+// of [left_start, left_start + length) of left, stopping at the first run for
+// which it returns false
+template <typename CompareRun>
+static bool CompareValidRuns(const Array& left, int64_t left_start, int64_t right_start,
+                             int64_t length, CompareRun&& compare_run) {
+  const uint8_t* bitmap = left.null_bitmap_data();
+  if (bitmap == nullptr || left.data()->null_count == 0) {
+    return length == 0 || compare_run(left_start, right_start, length);
+  }
+
+  BitBlockCounter counter(bitmap, left.offset() + left_start, length);
+  // The start of the current run of valid slots, or -1 between runs
+  int64_t run_start = -1;
+  auto end_run = [&](int64_t run_end) {
+    const int64_t start = run_start;
+    run_start = -1;
+    return start < 0 ||
+           compare_run(left_start + start, right_start + start, run_end - start);
+  };
+  for (int64_t pos = 0; pos < length;) {
+    const BitBlockCount block = counter.NextFourWords();
+    if (block.AllSet()) {
+      if (run_start < 0) {
+        run_start = pos;
+      }
+    } else if (block.NoneSet()) {
+      if (!end_run(pos)) {
+        return false;
+      }
+    } else {
+      const int64_t bit_offset = left.offset() + left_start;
+      for (int64_t j = pos; j < pos + block.length; ++j) {
+        if (BitUtil::GetBit(bitmap, bit_offset + j)) {
+          if (run_start < 0) {
+            run_start = j;
+          }
+        } else if (!end_run(j)) {
+          return false;
+        }
+      }
+    }
+    pos += block.length;
+  }
+  return end_run(length);
+}
+
 class RangeEqualsVisitor {
  public:
   RangeEqualsVisitor(const Array& right, int64_t left_start_idx, int64_t left_end_idx,
@@ -50,76 +99,194 @@ class RangeEqualsVisitor {
         right_start_idx_(right_start_idx),
         result_(false) {}
 
-  template <typename ArrayType>
-  inline Status CompareValues(const ArrayType& left) {
-    const auto& right = checked_cast<const ArrayType&>(right_);
+  // Whether the slots of the range are null in both arrays alike, a whole
+  // word of the validity bitmaps at a time
+  bool CompareValidity(const Array& left) const {
+    const int64_t length = left_end_idx_ - left_start_idx_;
+    const uint8_t* left_bitmap = left.null_bitmap_data();
+    const uint8_t* right_bitmap = right_.null_bitmap_data();
+    if (left_bitmap != nullptr && right_bitmap != nullptr) {
+      return BitmapEquals(left_bitmap, left.offset() + left_start_idx_, right_bitmap,
+                          right_.offset() + right_start_idx_, length);
+    } else if (left_bitmap != nullptr) {
+      return CountSetBits(left_bitmap, left.offset() + left_start_idx_, length) == length;
+    } else if (right_bitmap != nullptr) {
+      return CountSetBits(right_bitmap, right_.offset() + right_start_idx_, length) ==
+             length;
+    }
+    return true;
+  }
 
-    for (int64_t i = left_start_idx_, o_i = right_start_idx_; i < left_end_idx_;
-         ++i, ++o_i) {
-      const bool is_null = left.IsNull(i);
-      if (is_null != right.IsNull(o_i) ||
-          (!is_null && left.Value(i) != right.Value(o_i))) {
-        result_ = false;
-        return Status::OK();
+  // Compare the values of a run of valid slots, integers bytewise
+  template <typename ArrayType>
+  static bool CompareValueRun(const ArrayType& left, const ArrayType& right, int64_t i,
+                              int64_t o_i, int64_t length) {
+    using T = typename std::decay<decltype(*left.raw_values())>::type;
+    return std::memcmp(left.raw_values() + i, right.raw_values() + o_i,
+                       static_cast<size_t>(length) * sizeof(T)) == 0;
+  }
+
+  static bool CompareValueRun(const BooleanArray& left, const BooleanArray& right,
+                              int64_t i, int64_t o_i, int64_t length) {
+    return BitmapEquals(left.values()->data(), left.offset() + i, right.values()->data(),
+                        right.offset() + o_i, length);
+  }
+
+  // Floating point values keep their comparison semantics, so that NaN is
+  // never equal and 0.0 equals -0.0
+  template <typename TYPE>
+  static bool CompareFloatingRun(const NumericArray<TYPE>& left,
+                                 const NumericArray<TYPE>& right, int64_t i, int64_t o_i,
+                                 int64_t length) {
+    const typename TYPE::c_type* left_data = left.raw_values() + i;
+    const typename TYPE::c_type* right_data = right.raw_values() + o_i;
+    for (int64_t j = 0; j < length; ++j) {
+      if (left_data[j] != right_data[j]) {
+        return false;
       }
     }
-    result_ = true;
-    return Status::OK();
+    return true;
   }
 
-  bool CompareBinaryRange(const BinaryArray& left) const {
-    const auto& right = checked_cast<const BinaryArray&>(right_);
+  static bool CompareValueRun(const FloatArray& left, const FloatArray& right, int64_t i,
+                              int64_t o_i, int64_t length) {
+    return CompareFloatingRun<FloatType>(left, right, i, o_i, length);
+  }
 
-    for (int64_t i = left_start_idx_, o_i = right_start_idx_; i < left_end_idx_;
-         ++i, ++o_i) {
-      const bool is_null = left.IsNull(i);
-      if (is_null != right.IsNull(o_i)) {
-        return false;
-      }
-      if (is_null) continue;
-      const int32_t begin_offset = left.value_offset(i);
-      const int32_t end_offset = left.value_offset(i + 1);
-      const int32_t right_begin_offset = right.value_offset(o_i);
-      const int32_t right_end_offset = right.value_offset(o_i + 1);
-      // Underlying can't be equal if the size isn't equal
-      if (end_offset - begin_offset != right_end_offset - right_begin_offset) {
-        return false;
-      }
+  static bool CompareValueRun(const DoubleArray& left, const DoubleArray& right,
+                              int64_t i, int64_t o_i, int64_t length) {
+    return CompareFloatingRun<DoubleType>(left, right, i, o_i, length);
+  }
 
-      if (end_offset - begin_offset > 0 &&
-          std::memcmp(left.value_data()->data() + begin_offset,
-                      right.value_data()->data() + right_begin_offset,
-                      static_cast<size_t>(end_offset - begin_offset))) {
+  template <typename ArrayType>
+  inline Status CompareValues(const ArrayType& left) {
+    const auto& right = checked_cast<const ArrayType&>(right_);
+
+    result_ = CompareValidity(left) &&
+              CompareValidRuns(left, left_start_idx_, right_start_idx_,
+                               left_end_idx_ - left_start_idx_,
+                               [&](int64_t i, int64_t o_i, int64_t length) {
+                                 return CompareValueRun(left, right, i, o_i, length);
+                               });
+    return Status::OK();
+  }
+
+  // Whether the value offsets of a run of slots are equal once rebased to the
+  // start of the run
+  template <typename ArrayType>
+  static bool RebasedOffsetsEqual(const ArrayType& left, const ArrayType& right,
+                                  int64_t i, int64_t o_i, int64_t length) {
+    using offset_type = typename ArrayType::TypeClass::offset_type;
+    const offset_type* left_offsets = left.raw_value_offsets() + i;
+    const offset_type* right_offsets = right.raw_value_offsets() + o_i;
+    const offset_type left_base = left_offsets[0];
+    const offset_type right_base = right_offsets[0];
+    for (int64_t j = 1; j <= length; ++j) {
+      if (left_offsets[j] - left_base != right_offsets[j] - right_base) {
         return false;
       }
     }
     return true;
   }
 
-  bool CompareLists(const ListArray& left) {
-    const auto& right = checked_cast<const ListArray&>(right_);
+  template <typename ArrayType>
+  bool CompareBinaryRange(const ArrayType& left) const {
+    using offset_type = typename ArrayType::TypeClass::offset_type;
+    const auto& right = checked_cast<const ArrayType&>(right_);
+
+    if (!CompareValidity(left)) {
+      return false;
+    }
+    // Each run of valid values is contiguous in the data, so it is compared
+    // with a single memcmp once its lengths are known to match
+    return CompareValidRuns(
+        left, left_start_idx_, right_start_idx_, left_end_idx_ - left_start_idx_,
+        [&](int64_t i, int64_t o_i, int64_t length) {
+          if (!RebasedOffsetsEqual(left, right, i, o_i, length)) {
+            return false;
+          }
+          const offset_type begin_offset = left.value_offset(i);
+          const offset_type nbytes = left.value_offset(i + length) - begin_offset;
+          return nbytes == 0 ||
+                 std::memcmp(left.value_data()->data() + begin_offset,
+                             right.value_data()->data() + right.value_offset(o_i),
+                             static_cast<size_t>(nbytes)) == 0;
+        });
+  }
+
+  template <typename ArrayType>
+  bool CompareLists(const ArrayType& left) {
+    const auto& right = checked_cast<const ArrayType&>(right_);
 
     const std::shared_ptr<Array>& left_values = left.values();
     const std::shared_ptr<Array>& right_values = right.values();
 
-    for (int64_t i = left_start_idx_, o_i = right_start_idx_; i < left_end_idx_;
-         ++i, ++o_i) {
-      const bool is_null = left.IsNull(i);
-      if (is_null != right.IsNull(o_i)) {
+    if (!CompareValidity(left)) {
+      return false;
+    }
+    return CompareValidRuns(
+        left, left_start_idx_, right_start_idx_, left_end_idx_ - left_start_idx_,
+        [&](int64_t i, int64_t o_i, int64_t length) {
+          if (!RebasedOffsetsEqual(left, right, i, o_i, length)) {
+            return false;
+          }
+          return left_values->RangeEquals(left.value_offset(i),
+                                          left.value_offset(i + length),
+                                          right.value_offset(o_i), right_values);
+        });
+  }
+
+  bool CompareFixedSizeLists(const FixedSizeListArray& left) {
+    const auto& right = checked_cast<const FixedSizeListArray&>(right_);
+    if (left.list_size() != right.list_size()) {
+      return false;
+    }
+
+    const std::shared_ptr<Array>& left_values = left.values();
+    const std::shared_ptr<Array>& right_values = right.values();
+
+    if (!CompareValidity(left)) {
+      return false;
+    }
+    // The values of a run of valid slots are contiguous in the child
+    return CompareValidRuns(
+        left, left_start_idx_, right_start_idx_, left_end_idx_ - left_start_idx_,
+        [&](int64_t i, int64_t o_i, int64_t length) {
+          return left_values->RangeEquals(left.value_offset(i),
+                                          left.value_offset(i + length),
+                                          right.value_offset(o_i), right_values);
+        });
+  }
+
+  // Equal values slot by slot, whatever the runs: walk both arrays a stretch
+  // within one run of each at a time
+  bool CompareRunLengthEncoded(const RunLengthEncodedArray& left) {
+    const auto& right = checked_cast<const RunLengthEncodedArray&>(right_);
+    const std::shared_ptr<Array>& left_values = left.values();
+    const std::shared_ptr<Array>& right_values = right.values();
+
+    int64_t i = left_start_idx_;
+    int64_t o_i = right_start_idx_;
+    if (i >= left_end_idx_) {
+      return true;
+    }
+    int64_t left_run = left.FindRun(i);
+    int64_t right_run = right.FindRun(o_i);
+    while (i < left_end_idx_) {
+      const int64_t left_run_end =
+          std::min<int64_t>(left.raw_run_ends()[left_run] - left.offset(), left_end_idx_);
+      const int64_t right_run_end = right.raw_run_ends()[right_run] - right.offset();
+      const int64_t length = std::min(left_run_end - i, right_run_end - o_i);
+      if (!left_values->RangeEquals(left_run, left_run + 1, right_run, right_values)) {
         return false;
       }
-      if (is_null) continue;
-      const int32_t begin_offset = left.value_offset(i);
-      const int32_t end_offset = left.value_offset(i + 1);
-      const int32_t right_begin_offset = right.value_offset(o_i);
-      const int32_t right_end_offset = right.value_offset(o_i + 1);
-      // Underlying can't be equal if the size isn't equal
-      if (end_offset - begin_offset != right_end_offset - right_begin_offset) {
-        return false;
+      i += length;
+      o_i += length;
+      if (i == left_run_end) {
+        ++left_run;
       }
-      if (!left_values->RangeEquals(begin_offset, end_offset, right_begin_offset,
-                                    right_values)) {
-        return false;
+      if (o_i == right_run_end) {
+        ++right_run;
       }
     }
     return true;
@@ -213,6 +380,11 @@ class RangeEqualsVisitor {
     return Status::OK();
   }
 
+  Status Visit(const LargeBinaryArray& left) {
+    result_ = CompareBinaryRange(left);
+    return Status::OK();
+  }
+
   Status Visit(const FixedSizeBinaryArray& left) {
     const auto& right = checked_cast<const FixedSizeBinaryArray&>(right_);
 
@@ -229,21 +401,13 @@ class RangeEqualsVisitor {
       right_data = right.raw_values();
     }
 
-    for (int64_t i = left_start_idx_, o_i = right_start_idx_; i < left_end_idx_;
-         ++i, ++o_i) {
-      const bool is_null = left.IsNull(i);
-      if (is_null != right.IsNull(o_i)) {
-        result_ = false;
-        return Status::OK();
-      }
-      if (is_null) continue;
-
-      if (std::memcmp(left_data + width * i, right_data + width * o_i, width)) {
-        result_ = false;
-        return Status::OK();
-      }
-    }
-    result_ = true;
+    auto compare_run = [&](int64_t i, int64_t o_i, int64_t length) {
+      return std::memcmp(left_data + width * i, right_data + width * o_i,
+                         static_cast<size_t>(width * length)) == 0;
+    };
+    result_ = CompareValidity(left) &&
+              CompareValidRuns(left, left_start_idx_, right_start_idx_,
+                               left_end_idx_ - left_start_idx_, compare_run);
     return Status::OK();
   }
 
@@ -268,6 +432,21 @@ class RangeEqualsVisitor {
     return Status::OK();
   }
 
+  Status Visit(const LargeListArray& left) {
+    result_ = CompareLists(left);
+    return Status::OK();
+  }
+
+  Status Visit(const FixedSizeListArray& left) {
+    result_ = CompareFixedSizeLists(left);
+    return Status::OK();
+  }
+
+  Status Visit(const RunLengthEncodedArray& left) {
+    result_ = CompareRunLengthEncoded(left);
+    return Status::OK();
+  }
+
   Status Visit(const StructArray& left) {
     result_ = CompareStructs(left);
     return Status::OK();
@@ -315,22 +494,21 @@ static bool IsEqualPrimitive(const PrimitiveArray& left, const PrimitiveArray& r
     right_data = right.values()->data() + right.offset() * byte_width;
   }
 
+  auto number_of_bytes_to_compare = static_cast<size_t>(byte_width * left.length());
   if (left.null_count() > 0) {
-    for (int64_t i = 0; i < left.length(); ++i) {
-      const bool left_null = left.IsNull(i);
-      const bool right_null = right.IsNull(i);
-      if (left_null != right_null) {
-        return false;
-      }
-      if (!left_null && memcmp(left_data, right_data, byte_width) != 0) {
-        return false;
-      }
-      left_data += byte_width;
-      right_data += byte_width;
+    // Identical bytes, null slots included, are the common case
+    if (memcmp(left_data, right_data, number_of_bytes_to_compare) == 0) {
+      return true;
     }
-    return true;
+    // The validity bitmaps are equal, only compare the runs of valid values
+    return CompareValidRuns(left, 0, 0, left.length(),
+                            [&](int64_t i, int64_t, int64_t length) {
+                              return memcmp(left_data + i * byte_width,
+                                            right_data + i * byte_width,
+                                            static_cast<size_t>(length * byte_width)) ==
+                                     0;
+                            });
   } else {
-    auto number_of_bytes_to_compare = static_cast<size_t>(byte_width * left.length());
     return memcmp(left_data, right_data, number_of_bytes_to_compare) == 0;
   }
 }
@@ -350,17 +528,10 @@ class ArrayEqualsVisitor : public RangeEqualsVisitor {
     const auto& right = checked_cast<const BooleanArray&>(right_);
 
     if (left.null_count() > 0) {
-      const uint8_t* left_data = left.values()->data();
-      const uint8_t* right_data = right.values()->data();
-
-      for (int64_t i = 0; i < left.length(); ++i) {
-        if (left.IsValid(i) && BitUtil::GetBit(left_data, i + left.offset()) !=
-                                   BitUtil::GetBit(right_data, i + right.offset())) {
-          result_ = false;
-          return Status::OK();
-        }
-      }
-      result_ = true;
+      // The validity bitmaps are equal, only compare the valid values
+      result_ = VisitArrayValuesInline<BooleanType>(
+          *left.data(), [&](int64_t i, bool value) { return value == right.Value(i); },
+          [](int64_t) { return true; });
     } else {
       result_ = BitmapEquals(left.values()->data(), left.offset(), right.values()->data(),
                              right.offset(), left.length());
@@ -379,18 +550,20 @@ class ArrayEqualsVisitor : public RangeEqualsVisitor {
 
   template <typename ArrayType>
   bool ValueOffsetsEqual(const ArrayType& left) {
+    using offset_type = typename ArrayType::TypeClass::offset_type;
     const auto& right = checked_cast<const ArrayType&>(right_);
 
     if (left.offset() == 0 && right.offset() == 0) {
       return left.value_offsets()->Equals(*right.value_offsets(),
-                                          (left.length() + 1) * sizeof(int32_t));
+                                          (left.length() + 1) * sizeof(offset_type));
     } else {
       // One of the arrays is sliced; logic is more complicated because the
       // value offsets are not both 0-based
       auto left_offsets =
-          reinterpret_cast<const int32_t*>(left.value_offsets()->data()) + left.offset();
+          reinterpret_cast<const offset_type*>(left.value_offsets()->data()) +
+          left.offset();
       auto right_offsets =
-          reinterpret_cast<const int32_t*>(right.value_offsets()->data()) +
+          reinterpret_cast<const offset_type*>(right.value_offsets()->data()) +
           right.offset();
 
       for (int64_t i = 0; i < left.length() + 1; ++i) {
@@ -402,10 +575,12 @@ class ArrayEqualsVisitor : public RangeEqualsVisitor {
     }
   }
 
-  bool CompareBinary(const BinaryArray& left) {
-    const auto& right = checked_cast<const BinaryArray&>(right_);
+  template <typename ArrayType>
+  bool CompareBinary(const ArrayType& left) {
+    using offset_type = typename ArrayType::TypeClass::offset_type;
+    const auto& right = checked_cast<const ArrayType&>(right_);
 
-    bool equal_offsets = ValueOffsetsEqual<BinaryArray>(left);
+    bool equal_offsets = ValueOffsetsEqual<ArrayType>(left);
     if (!equal_offsets) {
       return false;
     }
@@ -434,18 +609,14 @@ class ArrayEqualsVisitor : public RangeEqualsVisitor {
       }
     } else {
       // ARROW-537: Only compare data in non-null slots
-      const int32_t* left_offsets = left.raw_value_offsets();
-      const int32_t* right_offsets = right.raw_value_offsets();
-      for (int64_t i = 0; i < left.length(); ++i) {
-        if (left.IsNull(i)) {
-          continue;
-        }
-        if (std::memcmp(left_data + left_offsets[i], right_data + right_offsets[i],
-                        left.value_length(i))) {
-          return false;
-        }
-      }
-      return true;
+      const offset_type* right_offsets = right.raw_value_offsets();
+      return VisitArrayValuesInline<typename ArrayType::TypeClass>(
+          *left.data(),
+          [&](int64_t i, const uint8_t* value, offset_type length) {
+            return std::memcmp(value, right_data + right_offsets[i],
+                               static_cast<size_t>(length)) == 0;
+          },
+          [](int64_t) { return true; });
     }
   }
 
@@ -454,17 +625,31 @@ class ArrayEqualsVisitor : public RangeEqualsVisitor {
     return Status::OK();
   }
 
-  Status Visit(const ListArray& left) {
-    const auto& right = checked_cast<const ListArray&>(right_);
-    bool equal_offsets = ValueOffsetsEqual<ListArray>(left);
+  Status Visit(const LargeBinaryArray& left) {
+    result_ = CompareBinary(left);
+    return Status::OK();
+  }
+
+  template <typename ArrayType>
+  bool CompareList(const ArrayType& left) {
+    const auto& right = checked_cast<const ArrayType&>(right_);
+    bool equal_offsets = ValueOffsetsEqual<ArrayType>(left);
     if (!equal_offsets) {
-      result_ = false;
-      return Status::OK();
+      return false;
     }
 
-    result_ = left.values()->RangeEquals(
-        left.value_offset(0), left.value_offset(left.length()) - left.value_offset(0),
-        right.value_offset(0), right.values());
+    return left.values()->RangeEquals(left.value_offset(0),
+                                      left.value_offset(left.length()),
+                                      right.value_offset(0), right.values());
+  }
+
+  Status Visit(const ListArray& left) {
+    result_ = CompareList(left);
+    return Status::OK();
+  }
+
+  Status Visit(const LargeListArray& left) {
+    result_ = CompareList(left);
     return Status::OK();
   }
 
@@ -496,21 +681,14 @@ inline bool FloatingApproxEquals(const NumericArray<TYPE>& left,
 
   static constexpr T EPSILON = static_cast<T>(1E-5);
 
-  if (left.null_count() > 0) {
-    for (int64_t i = 0; i < left.length(); ++i) {
-      if (left.IsNull(i)) continue;
-      if (fabs(left_data[i] - right_data[i]) > EPSILON) {
-        return false;
-      }
-    }
-  } else {
-    for (int64_t i = 0; i < left.length(); ++i) {
-      if (fabs(left_data[i] - right_data[i]) > EPSILON) {
-        return false;
-      }
-    }
+  // Bitwise equal values need no arithmetic
+  if (std::memcmp(left_data, right_data, sizeof(T) * left.length()) == 0) {
+    return true;
   }
-  return true;
+  return VisitArrayValuesInline<TYPE>(
+      *left.data(),
+      [&](int64_t i, T value) { return !(fabs(value - right_data[i]) > EPSILON); },
+      [](int64_t) { return true; });
 }
 
 class ApproxEqualsVisitor : public ArrayEqualsVisitor {
@@ -630,6 +808,19 @@ class TypeEqualsVisitor {
 
   Status Visit(const ListType& left) { return VisitChildren(left); }
 
+  Status Visit(const LargeListType& left) { return VisitChildren(left); }
+
+  Status Visit(const FixedSizeListType& left) {
+    const auto& right = checked_cast<const FixedSizeListType&>(right_);
+    if (left.list_size() != right.list_size()) {
+      result_ = false;
+      return Status::OK();
+    }
+    return VisitChildren(left);
+  }
+
+  Status Visit(const RunLengthEncodedType& left) { return VisitChildren(left); }
+
   Status Visit(const StructType& left) { return VisitChildren(left); }
 
   Status Visit(const UnionType& left) {
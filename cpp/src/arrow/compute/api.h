@@ -19,9 +19,16 @@
 #define ARROW_COMPUTE_API_H
 
 #include "arrow/compute/context.h"
+#include "arrow/compute/expression.h"
 #include "arrow/compute/kernel.h"
+#include "arrow/compute/registry.h"
 
+#include "arrow/compute/kernels/aggregate.h"
+#include "arrow/compute/kernels/arithmetic.h"
 #include "arrow/compute/kernels/cast.h"
 #include "arrow/compute/kernels/hash.h"
+#include "arrow/compute/kernels/join.h"
+#include "arrow/compute/kernels/sort.h"
+#include "arrow/compute/kernels/take.h"
 
 #endif  // ARROW_COMPUTE_API_H
@@ -17,13 +17,26 @@
 
 #include "benchmark/benchmark.h"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <string>
 #include <vector>
 
+#include "arrow/array.h"
 #include "arrow/builder.h"
 #include "arrow/memory_pool.h"
+#include "arrow/table.h"
+#include "arrow/test-random.h"
 #include "arrow/test-util.h"
+#include "arrow/util/decimal.h"
 
 #include "arrow/compute/context.h"
+#include "arrow/compute/kernels/aggregate.h"
+#include "arrow/compute/kernels/arithmetic.h"
+#include "arrow/compute/kernels/cast.h"
 #include "arrow/compute/kernels/hash.h"
 
 namespace arrow {
@@ -89,20 +102,10 @@ struct HashParams {
 
   void GenerateTestData(const int64_t length, const int64_t num_unique,
                         std::shared_ptr<Array>* arr) const {
-    std::vector<int64_t> draws;
-    std::vector<T> values;
-    std::vector<bool> is_valid;
-    test::randint<int64_t>(length, 0, num_unique, &draws);
-    for (int64_t draw : draws) {
-      values.push_back(static_cast<T>(draw));
-    }
-
-    if (this->null_percent > 0) {
-      test::random_is_valid(length, this->null_percent, &is_valid);
-      ArrayFromVector<Type, T>(is_valid, values, arr);
-    } else {
-      ArrayFromVector<Type, T>(values, arr);
-    }
+    test::RandomArrayGenerator gen(0);
+    const int64_t max_value = static_cast<int64_t>(std::numeric_limits<T>::max());
+    const auto max = static_cast<T>(std::min<int64_t>(num_unique, max_value));
+    ABORT_NOT_OK(gen.Numeric<Type>(length, 0, max, this->null_percent, arr));
   }
 
   int64_t GetBytesProcessed(int64_t length) const { return length * sizeof(T); }
@@ -114,29 +117,9 @@ struct HashParams<StringType> {
   int32_t byte_width;
   void GenerateTestData(const int64_t length, const int64_t num_unique,
                         std::shared_ptr<Array>* arr) const {
-    std::vector<int64_t> draws;
-    test::randint<int64_t>(length, 0, num_unique, &draws);
-
-    const int64_t total_bytes = this->byte_width * num_unique;
-    std::vector<uint8_t> uniques(total_bytes);
-    const uint32_t seed = 0;
-    test::random_bytes(total_bytes, seed, uniques.data());
-
-    std::vector<bool> is_valid;
-    if (this->null_percent > 0) {
-      test::random_is_valid(length, this->null_percent, &is_valid);
-    }
-
-    StringBuilder builder;
-    for (int64_t i = 0; i < length; ++i) {
-      if (this->null_percent == 0 || is_valid[i]) {
-        ABORT_NOT_OK(builder.Append(uniques.data() + this->byte_width * draws[i],
-                                    this->byte_width));
-      } else {
-        ABORT_NOT_OK(builder.AppendNull());
-      }
-    }
-    ABORT_NOT_OK(builder.Finish(arr));
+    test::RandomArrayGenerator gen(0);
+    ABORT_NOT_OK(gen.StringWithRepeats(length, num_unique, this->byte_width,
+                                       this->byte_width, this->null_percent, arr));
   }
 
   int64_t GetBytesProcessed(int64_t length) const { return length * byte_width; }
@@ -154,6 +137,7 @@ void BenchUnique(benchmark::State& state, const ParamType& params, int64_t lengt
     ABORT_NOT_OK(Unique(&ctx, Datum(arr), &out));
   }
   state.SetBytesProcessed(state.iterations() * params.GetBytesProcessed(length));
+  state.SetItemsProcessed(state.iterations() * length);
 }
 
 template <typename ParamType>
@@ -168,6 +152,7 @@ void BenchDictionaryEncode(benchmark::State& state, const ParamType& params,
     ABORT_NOT_OK(DictionaryEncode(&ctx, Datum(arr), &out));
   }
   state.SetBytesProcessed(state.iterations() * params.GetBytesProcessed(length));
+  state.SetItemsProcessed(state.iterations() * length);
 }
 
 static void BM_UniqueUInt8NoNulls(benchmark::State& state) {
@@ -227,5 +212,465 @@ BENCHMARK(BM_UniqueUInt8WithNulls)
     ->Unit(benchmark::kMicrosecond)
     ->UseRealTime();
 
+constexpr int kHashMatrixLength = 1 << 20;
+
+static void BM_UniqueInt64(benchmark::State& state) {  // NOLINT non-const reference
+  BenchUnique(state, HashParams<Int64Type>{state.range(1) / 1000.0}, kHashMatrixLength,
+              state.range(0));
+}
+
+static void BM_DictionaryEncodeInt64(
+    benchmark::State& state) {  // NOLINT non-const reference
+  BenchDictionaryEncode(state, HashParams<Int64Type>{state.range(1) / 1000.0},
+                        kHashMatrixLength, state.range(0));
+}
+
+static void BM_DictionaryEncodeString10bytes(
+    benchmark::State& state) {  // NOLINT non-const reference
+  BenchDictionaryEncode(state, HashParams<StringType>{state.range(1) / 1000.0, 10},
+                        kHashMatrixLength, state.range(0));
+}
+
+// As the number of unique values and the permille of nulls
+static void HashMatrixArguments(benchmark::internal::Benchmark* bench) {
+  for (int64_t num_unique : {50, 1 << 10, 1 << 20}) {
+    for (int64_t null_permille : {0, 10, 500}) {
+      bench->Args({num_unique, null_permille});
+    }
+  }
+}
+
+#define ADD_HASH_MATRIX_ARGS(WHAT)    \
+  WHAT->Apply(HashMatrixArguments)    \
+      ->MinTime(1.0)                  \
+      ->Unit(benchmark::kMicrosecond) \
+      ->UseRealTime()
+
+ADD_HASH_MATRIX_ARGS(BENCHMARK(BM_UniqueInt64));
+ADD_HASH_MATRIX_ARGS(BENCHMARK(BM_DictionaryEncodeInt64));
+ADD_HASH_MATRIX_ARGS(BENCHMARK(BM_DictionaryEncodeString10bytes));
+
+// ----------------------------------------------------------------------
+// Decimal kernels, at precisions whose values fit in 64 bits and wider ones
+
+constexpr int kDecimalBenchmarkLength = 1 << 16;
+
+// Random values of at most precision digits and scale 2, half of them
+// negative and 5% null
+static void MakeDecimalArray(int64_t length, int32_t precision,
+                             std::shared_ptr<Array>* out) {
+  std::mt19937_64 rng(42);
+  const int32_t low_digits = std::min(precision, 18);
+  const auto low_bound = static_cast<int64_t>(std::pow(10.0, low_digits));
+  const auto high_bound = static_cast<int64_t>(std::pow(10.0, precision - low_digits));
+
+  std::vector<bool> is_valid;
+  test::random_is_valid(length, 0.05, &is_valid);
+  Decimal128Builder builder(decimal(precision, 2));
+  for (int64_t i = 0; i < length; ++i) {
+    if (!is_valid[i]) {
+      ABORT_NOT_OK(builder.AppendNull());
+      continue;
+    }
+    Decimal128 value = Decimal128(static_cast<int64_t>(rng() % high_bound)) * low_bound +
+                       static_cast<int64_t>(rng() % low_bound);
+    ABORT_NOT_OK(builder.Append(rng() & 1 ? value.Negate() : value));
+  }
+  ABORT_NOT_OK(builder.Finish(out));
+}
+
+static void BenchDecimalCast(benchmark::State& state,
+                             const std::shared_ptr<DataType>& out_type,
+                             const std::shared_ptr<Array>& input,
+                             const CastOptions& options = CastOptions()) {
+  FunctionContext ctx;
+  while (state.KeepRunning()) {
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(Cast(&ctx, *input, out_type, options, &out));
+  }
+  state.SetItemsProcessed(state.iterations() * input->length());
+}
+
+// Up the scale by two digits
+static void BM_CastDecimalToDecimal(benchmark::State& state) {  // NOLINT non-const ref
+  const auto precision = static_cast<int32_t>(state.range(0));
+  std::shared_ptr<Array> input;
+  MakeDecimalArray(kDecimalBenchmarkLength, precision, &input);
+  BenchDecimalCast(state, decimal(precision + 2, 4), input);
+}
+
+static void BM_CastDecimalToInt64(benchmark::State& state) {  // NOLINT non-const ref
+  const auto precision = static_cast<int32_t>(state.range(0));
+  std::shared_ptr<Array> input;
+  MakeDecimalArray(kDecimalBenchmarkLength, precision, &input);
+  CastOptions options;
+  options.allow_decimal_truncate = true;
+  options.allow_int_overflow = true;
+  BenchDecimalCast(state, int64(), input, options);
+}
+
+static void BM_CastDecimalToDouble(benchmark::State& state) {  // NOLINT non-const ref
+  const auto precision = static_cast<int32_t>(state.range(0));
+  std::shared_ptr<Array> input;
+  MakeDecimalArray(kDecimalBenchmarkLength, precision, &input);
+  BenchDecimalCast(state, float64(), input);
+}
+
+static void BM_CastDecimalToString(benchmark::State& state) {  // NOLINT non-const ref
+  const auto precision = static_cast<int32_t>(state.range(0));
+  std::shared_ptr<Array> input;
+  MakeDecimalArray(kDecimalBenchmarkLength, precision, &input);
+  BenchDecimalCast(state, utf8(), input);
+}
+
+static void BM_CastStringToDecimal(benchmark::State& state) {  // NOLINT non-const ref
+  const auto precision = static_cast<int32_t>(state.range(0));
+  std::shared_ptr<Array> decimals, input;
+  MakeDecimalArray(kDecimalBenchmarkLength, precision, &decimals);
+  FunctionContext ctx;
+  ABORT_NOT_OK(Cast(&ctx, *decimals, utf8(), CastOptions(), &input));
+  BenchDecimalCast(state, decimal(precision, 2), input);
+}
+
+static void BenchDecimalArithmetic(benchmark::State& state, ArithmeticOp::type op,
+                                   int32_t precision) {
+  std::shared_ptr<Array> left, right;
+  MakeDecimalArray(kDecimalBenchmarkLength, precision, &left);
+  MakeDecimalArray(kDecimalBenchmarkLength + 1, precision, &right);
+  right = right->Slice(1);
+
+  FunctionContext ctx;
+  while (state.KeepRunning()) {
+    Datum out;
+    ABORT_NOT_OK(Arithmetic(&ctx, op, Datum(left), Datum(right), &out));
+  }
+  state.SetItemsProcessed(state.iterations() * kDecimalBenchmarkLength);
+}
+
+static void BM_AddDecimal(benchmark::State& state) {  // NOLINT non-const reference
+  BenchDecimalArithmetic(state, ArithmeticOp::ADD, static_cast<int32_t>(state.range(0)));
+}
+
+// The precision of the products is twice that of the operands
+static void BM_MultiplyDecimal(benchmark::State& state) {  // NOLINT non-const reference
+  BenchDecimalArithmetic(state, ArithmeticOp::MULTIPLY,
+                         static_cast<int32_t>(state.range(0)));
+}
+
+static void BM_SumDecimal(benchmark::State& state) {  // NOLINT non-const reference
+  std::shared_ptr<Array> input;
+  MakeDecimalArray(kDecimalBenchmarkLength, static_cast<int32_t>(state.range(0)), &input);
+
+  FunctionContext ctx;
+  while (state.KeepRunning()) {
+    Datum out;
+    ABORT_NOT_OK(Sum(&ctx, Datum(input), &out));
+  }
+  state.SetItemsProcessed(state.iterations() * kDecimalBenchmarkLength);
+}
+
+#define ADD_DECIMAL_ARGS(WHAT) \
+  WHAT->Arg(9)->Arg(16)->Arg(36)->MinTime(1.0)->Unit(benchmark::kMicrosecond)
+
+ADD_DECIMAL_ARGS(BENCHMARK(BM_CastDecimalToDecimal));
+ADD_DECIMAL_ARGS(BENCHMARK(BM_CastDecimalToInt64));
+ADD_DECIMAL_ARGS(BENCHMARK(BM_CastDecimalToDouble));
+ADD_DECIMAL_ARGS(BENCHMARK(BM_CastDecimalToString));
+ADD_DECIMAL_ARGS(BENCHMARK(BM_CastStringToDecimal));
+ADD_DECIMAL_ARGS(BENCHMARK(BM_AddDecimal));
+ADD_DECIMAL_ARGS(BENCHMARK(BM_SumDecimal));
+
+BENCHMARK(BM_MultiplyDecimal)
+    ->Arg(9)
+    ->Arg(18)
+    ->MinTime(1.0)
+    ->Unit(benchmark::kMicrosecond);
+
+// ----------------------------------------------------------------------
+// Casts between every pair of types that GetCastFunction supports
+
+constexpr int kCastBenchmarkLength = 1 << 16;
+
+// The benchmarks are about throughput, so let every value through
+static CastOptions CastBenchmarkOptions() {
+  CastOptions options;
+  options.allow_int_overflow = true;
+  options.allow_time_truncate = true;
+  options.allow_decimal_truncate = true;
+  return options;
+}
+
+static int64_t TotalBufferSize(const ArrayData& data) {
+  int64_t total = 0;
+  for (const auto& buffer : data.buffers) {
+    total += buffer ? buffer->size() : 0;
+  }
+  for (const auto& child : data.child_data) {
+    total += TotalBufferSize(*child);
+  }
+  return total;
+}
+
+// Strings that parse as the values of the output type
+static std::shared_ptr<Array> MakeCastStrings(const Int64Array& values,
+                                              const DataType& out_type) {
+  StringBuilder builder;
+  for (int64_t i = 0; i < values.length(); ++i) {
+    if (values.IsNull(i)) {
+      ABORT_NOT_OK(builder.AppendNull());
+      continue;
+    }
+    std::stringstream ss;
+    if (out_type.id() == Type::TIMESTAMP) {
+      ss << "1970-01-01T00:01:" << (10 + values.Value(i) % 50);
+    } else if (out_type.id() == Type::DECIMAL) {
+      ss << values.Value(i) << ".25";
+    } else {
+      ss << values.Value(i);
+    }
+    ABORT_NOT_OK(builder.Append(ss.str()));
+  }
+  std::shared_ptr<Array> out;
+  ABORT_NOT_OK(builder.Finish(&out));
+  return out;
+}
+
+// Reinterpret the offsets and data of a string array as another type
+static std::shared_ptr<Array> RetypeArray(const Array& array,
+                                          const std::shared_ptr<DataType>& type) {
+  auto data = array.data()->Copy();
+  data->type = type;
+  return MakeArray(data);
+}
+
+// Random values of in_type, 5% null, that cast to out_type
+static std::shared_ptr<Array> MakeCastInput(const std::shared_ptr<DataType>& in_type,
+                                            const std::shared_ptr<DataType>& out_type,
+                                            int64_t length) {
+  std::vector<bool> is_valid;
+  test::random_is_valid(length, 0.05, &is_valid);
+  std::vector<int64_t> draws;
+  test::randint<int64_t>(length, 0, 100, &draws);
+  std::shared_ptr<Array> values;
+  ArrayFromVector<Int64Type, int64_t>(is_valid, draws, &values);
+
+  FunctionContext ctx;
+  std::shared_ptr<Array> out;
+  switch (in_type->id()) {
+    case Type::NA:
+      return std::make_shared<NullArray>(length);
+    case Type::STRING:
+      return MakeCastStrings(static_cast<const Int64Array&>(*values), *out_type);
+    case Type::LARGE_STRING:
+      ABORT_NOT_OK(Cast(&ctx, *MakeCastInput(utf8(), out_type, length), large_utf8(),
+                        CastOptions(), &out));
+      return out;
+    case Type::BINARY:
+      return RetypeArray(*MakeCastInput(utf8(), out_type, length), binary());
+    case Type::LARGE_BINARY:
+      return RetypeArray(*MakeCastInput(large_utf8(), out_type, length), large_binary());
+    case Type::DICTIONARY: {
+      const auto value_type =
+          static_cast<const DictionaryType&>(*in_type).dictionary()->type();
+      Datum encoded;
+      ABORT_NOT_OK(DictionaryEncode(
+          &ctx, Datum(MakeCastInput(value_type, out_type, length)), &encoded));
+      return MakeArray(encoded.array());
+    }
+    case Type::LIST:
+    case Type::LARGE_LIST: {
+      // Four values per list
+      const auto& value_type = in_type->child(0)->type();
+      const auto& out_value_type =
+          out_type->num_children() > 0 ? out_type->child(0)->type() : value_type;
+      auto list_values = MakeCastInput(value_type, out_value_type, length * 4);
+      std::vector<int64_t> offsets;
+      for (int64_t i = 0; i <= length; ++i) {
+        offsets.push_back(i * 4);
+      }
+      std::shared_ptr<Array> offsets_array;
+      if (in_type->id() == Type::LIST) {
+        ArrayFromVector<Int32Type, int32_t>(
+            std::vector<int32_t>(offsets.begin(), offsets.end()), &offsets_array);
+        ABORT_NOT_OK(ListArray::FromArrays(*offsets_array, *list_values,
+                                           default_memory_pool(), &out));
+      } else {
+        ArrayFromVector<Int64Type, int64_t>(offsets, &offsets_array);
+        ABORT_NOT_OK(LargeListArray::FromArrays(*offsets_array, *list_values,
+                                                default_memory_pool(), &out));
+      }
+      return out;
+    }
+    case Type::DATE32:
+    case Type::TIME32: {
+      // These are only cast from int32
+      std::shared_ptr<Array> int32_values;
+      ABORT_NOT_OK(Cast(&ctx, *values, int32(), CastOptions(), &int32_values));
+      ABORT_NOT_OK(Cast(&ctx, *int32_values, in_type, CastOptions(), &out));
+      return out;
+    }
+    default:
+      ABORT_NOT_OK(Cast(&ctx, *values, in_type, CastOptions(), &out));
+      return out;
+  }
+}
+
+// A dictionary type with an empty dictionary of the value type, for the
+// cast kernel to dispatch on
+static std::shared_ptr<DataType> DictionaryOf(const std::shared_ptr<DataType>& type) {
+  std::unique_ptr<ArrayBuilder> builder;
+  ABORT_NOT_OK(MakeBuilder(default_memory_pool(), type, &builder));
+  std::shared_ptr<Array> dictionary;
+  ABORT_NOT_OK(builder->Finish(&dictionary));
+  return ::arrow::dictionary(int32(), dictionary);
+}
+
+// The input and output types of the casts. Dictionaries are cast to their
+// value type, and lists to lists of any castable value type.
+static const std::vector<std::shared_ptr<DataType>>& CastBenchmarkTypes() {
+  static const std::vector<std::shared_ptr<DataType>> types = {
+      null(),
+      boolean(),
+      uint8(),
+      int8(),
+      uint16(),
+      int16(),
+      uint32(),
+      int32(),
+      uint64(),
+      int64(),
+      float32(),
+      float64(),
+      decimal(20, 2),
+      date32(),
+      date64(),
+      time32(TimeUnit::MILLI),
+      time64(TimeUnit::MICRO),
+      timestamp(TimeUnit::MILLI),
+      utf8(),
+      large_utf8(),
+      binary(),
+      large_binary(),
+      DictionaryOf(int64()),
+      DictionaryOf(float64()),
+      DictionaryOf(utf8()),
+      list(int32()),
+      list(float64()),
+      large_list(int32())};
+  return types;
+}
+
+static void BM_Cast(benchmark::State& state) {  // NOLINT non-const reference
+  const auto& in_type = CastBenchmarkTypes()[state.range(0)];
+  const auto& out_type = CastBenchmarkTypes()[state.range(1)];
+  auto input = MakeCastInput(in_type, out_type, kCastBenchmarkLength);
+  const auto options = CastBenchmarkOptions();
+
+  FunctionContext ctx;
+  while (state.KeepRunning()) {
+    std::shared_ptr<Array> out;
+    if (!Cast(&ctx, *input, out_type, options, &out).ok()) {
+      state.SkipWithError("Failed to cast!");
+    }
+  }
+  state.SetBytesProcessed(state.iterations() * TotalBufferSize(*input->data()));
+  state.SetItemsProcessed(state.iterations() * kCastBenchmarkLength);
+  state.SetLabel(in_type->ToString() + " -> " + out_type->ToString());
+}
+
+static void CastArguments(benchmark::internal::Benchmark* bench) {
+  const auto& types = CastBenchmarkTypes();
+  const auto options = CastBenchmarkOptions();
+  for (int64_t i = 0; i < static_cast<int64_t>(types.size()); ++i) {
+    for (int64_t j = 0; j < static_cast<int64_t>(types.size()); ++j) {
+      std::unique_ptr<UnaryKernel> kernel;
+      if (!GetCastFunction(*types[i], types[j], options, &kernel).ok()) {
+        continue;
+      }
+      // Dictionaries are cast through their values, whichever the output
+      if (types[i]->id() == Type::DICTIONARY) {
+        const auto& value_type =
+            *static_cast<const DictionaryType&>(*types[i]).dictionary()->type();
+        if (!GetCastFunction(value_type, types[j], options, &kernel).ok()) {
+          continue;
+        }
+      }
+      bench->Args({i, j});
+    }
+  }
+}
+
+BENCHMARK(BM_Cast)->Apply(CastArguments)->Unit(benchmark::kMicrosecond);
+
+// ----------------------------------------------------------------------
+// Chunked against contiguous inputs, as the number of chunks of the same
+// values
+
+constexpr int kChunkedBenchmarkLength = 1 << 22;
+
+static std::shared_ptr<ChunkedArray> MakeChunked(const std::shared_ptr<Array>& array,
+                                                 int64_t num_chunks) {
+  ArrayVector chunks;
+  const int64_t chunk_length = array->length() / num_chunks;
+  for (int64_t i = 0; i < num_chunks; ++i) {
+    chunks.push_back(array->Slice(i * chunk_length, chunk_length));
+  }
+  return std::make_shared<ChunkedArray>(chunks);
+}
+
+static void BM_CastInt32ToInt64Chunked(
+    benchmark::State& state) {  // NOLINT non-const reference
+  std::shared_ptr<Array> values;
+  HashParams<Int32Type>{0.05}.GenerateTestData(kChunkedBenchmarkLength, 1 << 20,
+                                               &values);
+  const Datum input(MakeChunked(values, state.range(0)));
+
+  FunctionContext ctx;
+  while (state.KeepRunning()) {
+    Datum out;
+    ABORT_NOT_OK(Cast(&ctx, input, int64(), CastOptions(), &out));
+  }
+  state.SetBytesProcessed(state.iterations() * kChunkedBenchmarkLength * sizeof(int32_t));
+  state.SetItemsProcessed(state.iterations() * kChunkedBenchmarkLength);
+}
+
+static void BM_UniqueInt64Chunked(benchmark::State& state) {  // NOLINT non-const ref
+  std::shared_ptr<Array> values;
+  HashParams<Int64Type>{0.05}.GenerateTestData(kChunkedBenchmarkLength, 1 << 10,
+                                               &values);
+  const Datum input(MakeChunked(values, state.range(0)));
+
+  FunctionContext ctx;
+  while (state.KeepRunning()) {
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(Unique(&ctx, input, &out));
+  }
+  state.SetBytesProcessed(state.iterations() * kChunkedBenchmarkLength * sizeof(int64_t));
+  state.SetItemsProcessed(state.iterations() * kChunkedBenchmarkLength);
+}
+
+static void BM_DictionaryEncodeInt64Chunked(
+    benchmark::State& state) {  // NOLINT non-const reference
+  std::shared_ptr<Array> values;
+  HashParams<Int64Type>{0.05}.GenerateTestData(kChunkedBenchmarkLength, 1 << 10,
+                                               &values);
+  const Datum input(MakeChunked(values, state.range(0)));
+
+  FunctionContext ctx;
+  while (state.KeepRunning()) {
+    Datum out;
+    ABORT_NOT_OK(DictionaryEncode(&ctx, input, &out));
+  }
+  state.SetBytesProcessed(state.iterations() * kChunkedBenchmarkLength * sizeof(int64_t));
+  state.SetItemsProcessed(state.iterations() * kChunkedBenchmarkLength);
+}
+
+#define ADD_CHUNKED_ARGS(WHAT) \
+  WHAT->Arg(1)->Arg(16)->Arg(1024)->MinTime(1.0)->Unit(benchmark::kMicrosecond)
+
+ADD_CHUNKED_ARGS(BENCHMARK(BM_CastInt32ToInt64Chunked));
+ADD_CHUNKED_ARGS(BENCHMARK(BM_UniqueInt64Chunked));
+ADD_CHUNKED_ARGS(BENCHMARK(BM_DictionaryEncodeInt64Chunked));
+
 }  // namespace compute
 }  // namespace arrow
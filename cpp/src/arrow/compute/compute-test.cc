@@ -16,10 +16,14 @@
 // under the License.
 
 #include <cstdint>
+#include <algorithm>
+#include <cmath>
 #include <cstdlib>
 #include <memory>
 #include <numeric>
+#include <random>
 #include <sstream>
+#include <string>
 #include <vector>
 
 #include "gtest/gtest.h"
@@ -28,19 +32,32 @@
 #include "arrow/buffer.h"
 #include "arrow/builder.h"
 #include "arrow/compare.h"
+#include "arrow/concatenate.h"
 #include "arrow/ipc/test-common.h"
 #include "arrow/memory_pool.h"
 #include "arrow/pretty_print.h"
+#include "arrow/record_batch.h"
 #include "arrow/status.h"
+#include "arrow/table.h"
 #include "arrow/test-common.h"
 #include "arrow/test-util.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/parallel.h"
 
 #include "arrow/compute/context.h"
+#include "arrow/compute/expression.h"
 #include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/aggregate.h"
+#include "arrow/compute/kernels/arithmetic.h"
 #include "arrow/compute/kernels/cast.h"
 #include "arrow/compute/kernels/hash.h"
+#include "arrow/compute/kernels/join.h"
+#include "arrow/compute/kernels/sort.h"
+#include "arrow/compute/kernels/take.h"
+#include "arrow/compute/kernels/util-internal.h"
+#include "arrow/compute/registry.h"
 
 using std::shared_ptr;
 using std::vector;
@@ -243,6 +260,44 @@ TEST_F(TestCast, ToIntDowncastSafe) {
   CheckFails<Int32Type>(int32(), v9, is_valid, int16(), options);
 }
 
+TEST_F(TestCast, ToIntDowncastSafeBlocks) {
+  CastOptions options;
+  options.allow_int_overflow = false;
+
+  // Longer than a block of 64 values, with nulls in some blocks only
+  const int64_t length = 200;
+  vector<bool> is_valid(length, true);
+  for (int64_t i = 70; i < 140; ++i) {
+    is_valid[i] = i % 3 != 0;
+  }
+  vector<int32_t> v1(length);
+  vector<int16_t> e1(length);
+  for (int64_t i = 0; i < length; ++i) {
+    v1[i] = static_cast<int32_t>(i * 163 - 16000);
+    e1[i] = static_cast<int16_t>(v1[i]);
+  }
+  CheckCase<Int32Type, int32_t, Int16Type, int16_t>(int32(), v1, is_valid, int16(), e1,
+                                                    options);
+
+  // Out of bounds values in null slots of a later block are ignored, those in
+  // valid slots are not
+  v1[99] = 70000;
+  e1[99] = static_cast<int16_t>(v1[99]);
+  CheckCase<Int32Type, int32_t, Int16Type, int16_t>(int32(), v1, is_valid, int16(), e1,
+                                                    options);
+  v1[199] = -70000;
+  CheckFails<Int32Type>(int32(), v1, is_valid, int16(), options);
+
+  // Unsigned to signed of the same width
+  vector<bool> is_valid2 = {true, false, true, true, true};
+  vector<uint32_t> v2 = {0, 4000000000U, 1, 2147483647U, 5};
+  vector<int32_t> e2 = {0, static_cast<int32_t>(v2[1]), 1, 2147483647, 5};
+  CheckCase<UInt32Type, uint32_t, Int32Type, int32_t>(uint32(), v2, is_valid2, int32(),
+                                                      e2, options);
+  v2[2] = 2147483648U;
+  CheckFails<UInt32Type>(uint32(), v2, is_valid2, int32(), options);
+}
+
 TEST_F(TestCast, ToIntDowncastUnsafe) {
   CastOptions options;
   options.allow_int_overflow = true;
@@ -625,6 +680,27 @@ TEST_F(TestCast, ChunkedArray) {
   ASSERT_TRUE(out.chunked_array()->Equals(*ex_carr));
 }
 
+TEST_F(TestCast, ArenaMemoryPool) {
+  ArenaMemoryPool arena(default_memory_pool());
+  FunctionContext ctx(&arena);
+
+  vector<bool> is_valid = {true, false, true, true, true};
+  vector<int16_t> v1 = {0, 1, 2, 3, 4};
+  vector<int64_t> e1 = {0, 1, 2, 3, 4};
+
+  shared_ptr<Array> input, expected, result;
+  ArrayFromVector<Int16Type, int16_t>(int16(), is_valid, v1, &input);
+  ArrayFromVector<Int64Type, int64_t>(int64(), is_valid, e1, &expected);
+
+  ASSERT_OK(Cast(&ctx, *input, int64(), {}, &result));
+  ASSERT_ARRAYS_EQUAL(*expected, *result);
+  ASSERT_GT(arena.bytes_allocated(), 0);
+
+  result.reset();
+  ASSERT_EQ(0, arena.bytes_allocated());
+  arena.Reset();
+}
+
 TEST_F(TestCast, UnsupportedTarget) {
   vector<bool> is_valid = {true, false, true, true, true};
   vector<int32_t> v1 = {0, 1, 2, 3, 4};
@@ -769,6 +845,58 @@ TEST_F(TestCast, OffsetOutputBuffer) {
                                                                 int16(), e3);
 }
 
+TEST_F(TestCast, PreallocatedOutput) {
+  std::vector<int64_t> sizes;
+  ASSERT_OK(GetCastOutputBufferSizes(int64(), 10, &sizes));
+  ASSERT_EQ(std::vector<int64_t>({2, 80}), sizes);
+  ASSERT_OK(GetCastOutputBufferSizes(boolean(), 10, &sizes));
+  ASSERT_EQ(std::vector<int64_t>({2, 2}), sizes);
+  ASSERT_RAISES(NotImplemented, GetCastOutputBufferSizes(utf8(), 10, &sizes));
+
+  InstrumentedMemoryPool pool(default_memory_pool());
+  FunctionContext ctx(&pool);
+  std::shared_ptr<ArrayData> out;
+  ASSERT_OK(PreallocateCastOutput(&ctx, int64(), 5, &out));
+  const uint8_t* bitmap = out->buffers[0]->data();
+  const uint8_t* values = out->buffers[1]->data();
+
+  // The same output serves batch after batch without allocating
+  auto with_nulls = _MakeArray<Int32Type, int32_t>(
+      int32(), {7, 1, 2, 3, 4, 5}, {true, true, false, true, false, true});
+  auto without_nulls = _MakeArray<Int32Type, int32_t>(int32(), {-1, -2, -3, -4, -5}, {});
+  auto int64s = _MakeArray<Int64Type, int64_t>(int64(), {10, 20, 30, 40, 50}, {});
+  pool.ResetStatistics();
+  for (const auto& batch :
+       {with_nulls->Slice(1), without_nulls, int64s, with_nulls->Slice(1)}) {
+    ASSERT_OK(CastInto(&ctx, *batch, CastOptions(), out));
+    ASSERT_EQ(bitmap, out->buffers[0]->data());
+    ASSERT_EQ(values, out->buffers[1]->data());
+
+    shared_ptr<Array> expected;
+    ASSERT_OK(Cast(&this->ctx_, *batch, int64(), CastOptions(), &expected));
+    ASSERT_ARRAYS_EQUAL(*expected, *MakeArray(out->Copy()));
+  }
+  ASSERT_EQ(0, pool.num_allocations());
+
+  // Writing at an offset leaves the values before it alone
+  auto second_half = out->Copy();
+  second_half->offset = 2;
+  second_half->length = 3;
+  ASSERT_OK(CastInto(&ctx, *without_nulls->Slice(2), CastOptions(), second_half));
+  auto whole = out->Copy();
+  whole->null_count = kUnknownNullCount;
+  auto expected = _MakeArray<Int64Type, int64_t>(int64(), {1, 0, -3, -4, -5},
+                                                 {true, false, true, true, true});
+  ASSERT_ARRAYS_EQUAL(*expected, *MakeArray(whole));
+
+  ASSERT_RAISES(Invalid, CastInto(&ctx, *with_nulls, CastOptions(), out));
+  auto too_small = out->Copy();
+  too_small->offset = 1;
+  ASSERT_RAISES(Invalid, CastInto(&ctx, *without_nulls, CastOptions(), too_small));
+  auto unallocated = ArrayData::Make(int64(), 5, {nullptr, out->buffers[1]});
+  ASSERT_RAISES(Invalid, CastInto(&ctx, *without_nulls, CastOptions(), unallocated));
+}
+
 template <typename TestType>
 class TestDictionaryCast : public TestCast {};
 
@@ -824,6 +952,42 @@ TEST_F(TestCast, DictToNonDictNoNulls) {
   ASSERT_ARRAYS_EQUAL(*e2, *chunks[1]);
 }
 
+TEST_F(TestCast, DictToOtherValueType) {
+  // The dictionary is cast once, then the indices mapped over it
+  auto dict = _MakeArray<StringType, std::string>(utf8(), {"10", "-2", "x", "7"}, {});
+  auto dict_type = dictionary(int8(), dict);
+  auto indices = _MakeArray<Int8Type, int8_t>(int8(), {1, 0, 3, 0, 2, 1},
+                                              {true, true, false, true, true, true});
+  auto dict_array = std::make_shared<DictionaryArray>(dict_type, indices);
+
+  CastOptions options;
+  shared_ptr<Array> result;
+  ASSERT_RAISES(Invalid, Cast(&ctx_, *dict_array, int32(), options, &result));
+
+  options.null_on_parse_error = true;
+  shared_ptr<Array> expected = _MakeArray<Int32Type, int32_t>(
+      int32(), {-2, 10, 0, 10, 0, -2}, {true, true, false, true, false, true});
+  CheckPass(*dict_array, *expected, int32(), options);
+  ASSERT_OK(Cast(&ctx_, *dict_array, int32(), options, &result));
+  ASSERT_EQ(2, result->data()->null_count);
+
+  // The null of the dictionary isn't written into the validity of the input
+  ASSERT_EQ(1, dict_array->null_count());
+  ASSERT_TRUE(dict_array->IsValid(4));
+
+  auto numbers = _MakeArray<Int32Type, int32_t>(int32(), {3, 100000, 5}, {});
+  auto int_dict_array = std::make_shared<DictionaryArray>(
+      dictionary(int8(), numbers),
+      _MakeArray<Int8Type, int8_t>(int8(), {2, 0, 0}, {true, false, true}));
+  expected = _MakeArray<DoubleType, double>(float64(), {5, 0, 3}, {true, false, true});
+  CheckPass(*int_dict_array, *expected, float64(), options);
+  ASSERT_RAISES(NotImplemented, Cast(&ctx_, *int_dict_array, utf8(), options, &result));
+
+  // Overflow in a value no index refers to
+  options.allow_int_overflow = false;
+  ASSERT_RAISES(Invalid, Cast(&ctx_, *int_dict_array, int16(), options, &result));
+}
+
 /*TYPED_TEST(TestDictionaryCast, Reverse) {
   CastOptions options;
   shared_ptr<Array> plain_array =
@@ -835,6 +999,311 @@ TEST_F(TestCast, DictToNonDictNoNulls) {
   this->CheckPass(*plain_array, *dict_array, dict_array->type(), options);
 }*/
 
+TEST_F(TestCast, StringToNumber) {
+  CastOptions options;
+
+  vector<bool> is_valid = {true, false, true, true, true, true};
+
+  vector<std::string> v1 = {"0", "x", "-128", "127", "-0", "007"};
+  vector<int8_t> e1 = {0, 0, -128, 127, 0, 7};
+  CheckCase<StringType, std::string, Int8Type, int8_t>(utf8(), v1, is_valid, int8(), e1,
+                                                       options);
+
+  vector<std::string> v2 = {"18446744073709551615", "", "1", "0", "42", "10"};
+  vector<uint64_t> e2 = {18446744073709551615ULL, 0, 1, 0, 42, 10};
+  CheckCase<StringType, std::string, UInt64Type, uint64_t>(utf8(), v2, is_valid,
+                                                           uint64(), e2, options);
+
+  vector<std::string> v3 = {"1.5", "", "-0.25", "1e10", "123456789012345678901234",
+                            "inf"};
+  vector<double> e3 = {1.5, 0, -0.25, 1e10, 123456789012345678901234.0, INFINITY};
+  CheckCase<StringType, std::string, DoubleType, double>(utf8(), v3, is_valid, float64(),
+                                                         e3, options);
+
+  vector<std::string> v4 = {"0.1", "", "3.4028235e38", "-7", "1E-3", "+2."};
+  vector<float> e4 = {0.1f, 0, 3.4028235e38f, -7, 1e-3f, 2};
+  CheckCase<StringType, std::string, FloatType, float>(utf8(), v4, is_valid, float32(),
+                                                       e4, options);
+
+  CheckFails<StringType, std::string>(utf8(), {"1", "128"}, {}, int8(), options);
+  CheckFails<StringType, std::string>(utf8(), {"-1"}, {}, uint8(), options);
+  CheckFails<StringType, std::string>(utf8(), {" 1"}, {}, int32(), options);
+  CheckFails<StringType, std::string>(utf8(), {"18446744073709551616"}, {}, uint64(),
+                                      options);
+  CheckFails<StringType, std::string>(utf8(), {"1.5x"}, {}, float64(), options);
+  CheckFails<StringType, std::string>(utf8(), {"0x10"}, {}, float64(), options);
+  CheckFails<StringType, std::string>(utf8(), {""}, {}, float64(), options);
+}
+
+TEST_F(TestCast, StringToTimestamp) {
+  CastOptions options;
+
+  vector<bool> is_valid = {true, false, true, true};
+  vector<std::string> v1 = {"1970-01-01", "", "2000-02-29T12:34:56",
+                            "1969-12-31 23:59:59Z"};
+
+  vector<int64_t> e1 = {0, 0, 951827696, -1};
+  CheckCase<StringType, std::string, TimestampType, int64_t>(
+      utf8(), v1, is_valid, timestamp(TimeUnit::SECOND), e1, options);
+
+  vector<int64_t> e2 = {0, 0, 951827696000000LL, -1000000};
+  CheckCase<StringType, std::string, TimestampType, int64_t>(
+      utf8(), v1, is_valid, timestamp(TimeUnit::MICRO), e2, options);
+
+  auto type = timestamp(TimeUnit::SECOND);
+  CheckFails<StringType, std::string>(utf8(), {"2001-02-29"}, {}, type, options);
+  CheckFails<StringType, std::string>(utf8(), {"2000-13-01"}, {}, type, options);
+  CheckFails<StringType, std::string>(utf8(), {"2000-01-01T24:00:00"}, {}, type, options);
+  CheckFails<StringType, std::string>(utf8(), {"2000-1-01"}, {}, type, options);
+  CheckFails<StringType, std::string>(utf8(), {"2000-01-01T00:00:0a"}, {}, type, options);
+  CheckFails<StringType, std::string>(utf8(), {"2500-01-01"}, {},
+                                      timestamp(TimeUnit::NANO), options);
+}
+
+TEST_F(TestCast, StringParseErrorToNull) {
+  CastOptions options;
+  options.null_on_parse_error = true;
+
+  vector<std::string> v1 = {"1", "x", "3", "", "5", "2147483648"};
+  vector<int32_t> e1 = {1, 0, 3, 0, 5, 0};
+
+  shared_ptr<Array> input, result, expected;
+  ArrayFromVector<StringType, std::string>(utf8(), v1, &input);
+  ArrayFromVector<Int32Type, int32_t>(int32(), {true, false, true, false, true, false},
+                                      e1, &expected);
+  ASSERT_OK(Cast(&ctx_, *input, int32(), options, &result));
+  ASSERT_ARRAYS_EQUAL(*expected, *result);
+  // Counted while parsing
+  ASSERT_EQ(3, result->data()->null_count);
+
+  // The validity of the input is copied, not modified
+  ArrayFromVector<StringType, std::string>(utf8(), {true, true, true, false, true, true},
+                                           v1, &input);
+  ASSERT_OK(Cast(&ctx_, *input, int32(), options, &result));
+  ASSERT_ARRAYS_EQUAL(*expected, *result);
+  ASSERT_EQ(3, result->data()->null_count);
+  ASSERT_TRUE(input->IsValid(1));
+  ASSERT_TRUE(input->IsValid(5));
+
+  ASSERT_OK(Cast(&ctx_, *input->Slice(1), int32(), options, &result));
+  ASSERT_ARRAYS_EQUAL(*expected->Slice(1), *result);
+}
+
+TEST_F(TestCast, StringToDecimal) {
+  CastOptions options;
+
+  vector<bool> is_valid = {true, false, true, true, true};
+  vector<std::string> v1 = {"1.5", "x", "-0.25", "12", "1E-2"};
+  vector<Decimal128> e1 = {150, 0, -25, 1200, 1};
+  CheckCase<StringType, std::string, Decimal128Type, Decimal128>(
+      utf8(), v1, is_valid, decimal(5, 2), e1, options);
+
+  // Values of more than 18 digits
+  vector<std::string> v2 = {"12345678901234567890.123", "", "-0.001", "0",
+                            "-99999999999999999999999999999999999.999"};
+  vector<Decimal128> e2 = {Decimal128("12345678901234567890123"), 0, -1, 0,
+                           Decimal128("-99999999999999999999999999999999999999")};
+  CheckCase<StringType, std::string, Decimal128Type, Decimal128>(
+      utf8(), v2, is_valid, decimal(38, 3), e2, options);
+
+  // Losing digits, too many digits, not a number
+  CheckFails<StringType, std::string>(utf8(), {"1.234"}, {}, decimal(5, 2), options);
+  CheckFails<StringType, std::string>(utf8(), {"1234.5"}, {}, decimal(5, 2), options);
+  CheckFails<StringType, std::string>(utf8(), {"1.2.3"}, {}, decimal(5, 2), options);
+  CheckFails<StringType, std::string>(utf8(), {""}, {}, decimal(5, 2), options);
+
+  options.null_on_parse_error = true;
+  vector<Decimal128> e3 = {150, 0, 0, 0, 1};
+  std::shared_ptr<Array> input, expected, result;
+  ArrayFromVector<StringType, std::string>(utf8(), {"1.5", "x", "0.123", "1000", "0.01"},
+                                           &input);
+  ArrayFromVector<Decimal128Type, Decimal128>(
+      decimal(3, 2), {true, false, false, false, true}, e3, &expected);
+  ASSERT_OK(Cast(&ctx_, *input, decimal(3, 2), options, &result));
+  ASSERT_ARRAYS_EQUAL(*expected, *result);
+}
+
+TEST_F(TestCast, DecimalToString) {
+  CastOptions options;
+
+  vector<bool> is_valid = {true, false, true, true, true};
+  vector<Decimal128> v1 = {150, 7, -25, 0, Decimal128("-123456789012345678901234567")};
+  vector<std::string> e1 = {"1.50", "", "-0.25", "0.00", "-1234567890123456789012345.67"};
+  CheckCase<Decimal128Type, Decimal128, StringType, std::string>(
+      decimal(38, 2), v1, is_valid, utf8(), e1, options);
+
+  vector<std::string> e2 = {"150", "", "-25", "0", "-123456789012345678901234567"};
+  CheckCase<Decimal128Type, Decimal128, StringType, std::string>(
+      decimal(38, 0), v1, {}, utf8(), {"150", "7", "-25", "0", e2[4]}, options);
+}
+
+TEST_F(TestCast, IntegerToDecimal) {
+  CastOptions options;
+
+  // The null slot holds a value out of bounds
+  vector<bool> is_valid = {true, false, true, true, true};
+  vector<int32_t> v1 = {1, 1000000, -25, 0, 999};
+  vector<Decimal128> e1 = {100, 0, -2500, 0, 99900};
+  CheckCase<Int32Type, int32_t, Decimal128Type, Decimal128>(int32(), v1, is_valid,
+                                                            decimal(5, 2), e1, options);
+
+  // Values of more than 18 digits
+  vector<int64_t> v2 = {std::numeric_limits<int64_t>::min(), 0, 1, -1,
+                        std::numeric_limits<int64_t>::max()};
+  vector<Decimal128> e2 = {Decimal128("-9223372036854775808000"), 0, 1000, -1000,
+                           Decimal128("9223372036854775807000")};
+  CheckCase<Int64Type, int64_t, Decimal128Type, Decimal128>(int64(), v2, is_valid,
+                                                            decimal(22, 3), e2, options);
+  vector<uint64_t> v3 = {std::numeric_limits<uint64_t>::max(), 0, 1, 2, 3};
+  vector<Decimal128> e3 = {Decimal128("18446744073709551615"), 0, 1, 2, 3};
+  CheckCase<UInt64Type, uint64_t, Decimal128Type, Decimal128>(
+      uint64(), v3, {}, decimal(20, 0), e3, options);
+
+  CheckFails<Int32Type, int32_t>(int32(), {1000}, {}, decimal(5, 2), options);
+  CheckFails<Int32Type, int32_t>(int32(), {-1000}, {}, decimal(5, 2), options);
+  CheckFails<UInt64Type, uint64_t>(uint64(), v3, {}, decimal(19, 0), options);
+
+  options.allow_int_overflow = true;
+  CheckCase<Int32Type, int32_t, Decimal128Type, Decimal128>(
+      int32(), {1000}, {}, decimal(5, 2), {100000}, options);
+}
+
+TEST_F(TestCast, DecimalToInteger) {
+  CastOptions options;
+
+  // The null slot holds a value that would lose digits
+  vector<bool> is_valid = {true, false, true, true, true};
+  vector<Decimal128> v1 = {100, 150, -2500, 0, 12700};
+  vector<int8_t> e1 = {1, 0, -25, 0, 127};
+  CheckCase<Decimal128Type, Decimal128, Int8Type, int8_t>(decimal(5, 2), v1, is_valid,
+                                                          int8(), e1, options);
+
+  // Values of more than 18 digits
+  vector<Decimal128> v2 = {Decimal128("-9223372036854775808000"), 1, 1000, -1000,
+                           Decimal128("9223372036854775807000")};
+  vector<int64_t> e2 = {std::numeric_limits<int64_t>::min(), 0, 1, -1,
+                        std::numeric_limits<int64_t>::max()};
+  CheckCase<Decimal128Type, Decimal128, Int64Type, int64_t>(decimal(22, 3), v2, is_valid,
+                                                            int64(), e2, options);
+  CheckCase<Decimal128Type, Decimal128, UInt64Type, uint64_t>(
+      decimal(20, 0), {Decimal128("18446744073709551615"), 0}, {}, uint64(),
+      {std::numeric_limits<uint64_t>::max(), 0}, options);
+
+  // Out of bounds, losing digits
+  CheckFails<Decimal128Type, Decimal128>(decimal(5, 2), {12800}, {}, int8(), options);
+  CheckFails<Decimal128Type, Decimal128>(decimal(5, 2), {-100}, {}, uint32(), options);
+  CheckFails<Decimal128Type, Decimal128>(
+      decimal(22, 3), {Decimal128("-9223372036854775809000")}, {}, int64(), options);
+  CheckFails<Decimal128Type, Decimal128>(decimal(5, 2), {150}, {}, int32(), options);
+  CheckFails<Decimal128Type, Decimal128>(decimal(22, 3), {-1}, {}, int32(), options);
+
+  options.allow_decimal_truncate = true;
+  CheckCase<Decimal128Type, Decimal128, Int32Type, int32_t>(
+      decimal(5, 2), {150, -199, 99}, {}, int32(), {1, -1, 0}, options);
+  CheckCase<Decimal128Type, Decimal128, Int32Type, int32_t>(
+      decimal(22, 3), {1500, -1999, 999}, {}, int32(), {1, -1, 0}, options);
+  CheckFails<Decimal128Type, Decimal128>(decimal(5, 2), {12800}, {}, int8(), options);
+}
+
+TEST_F(TestCast, DecimalToDecimal) {
+  CastOptions options;
+
+  vector<bool> is_valid = {true, false, true, true, true};
+  vector<Decimal128> v1 = {150, 12345, -25, 0, 99999};
+
+  // Same scale, with and without bounds to check
+  CheckCase<Decimal128Type, Decimal128, Decimal128Type, Decimal128>(
+      decimal(5, 2), v1, is_valid, decimal(7, 2), v1, options);
+  CheckCase<Decimal128Type, Decimal128, Decimal128Type, Decimal128>(
+      decimal(7, 2), {150, 1234567, 0}, {true, false, true}, decimal(5, 2), {150, 0, 0},
+      options);
+
+  // Up the scale, in 64 and 128 bits
+  vector<Decimal128> e2 = {15000, 0, -2500, 0, 9999900};
+  CheckCase<Decimal128Type, Decimal128, Decimal128Type, Decimal128>(
+      decimal(5, 2), v1, is_valid, decimal(7, 4), e2, options);
+  vector<Decimal128> e3 = {Decimal128("1500000000000000000000"), 0,
+                           Decimal128("-250000000000000000000"), 0,
+                           Decimal128("999990000000000000000000")};
+  CheckCase<Decimal128Type, Decimal128, Decimal128Type, Decimal128>(
+      decimal(5, 2), v1, is_valid, decimal(24, 21), e3, options);
+
+  // Down the scale, in 64 and 128 bits
+  CheckCase<Decimal128Type, Decimal128, Decimal128Type, Decimal128>(
+      decimal(7, 4), e2, is_valid, decimal(5, 2), v1, options);
+  CheckCase<Decimal128Type, Decimal128, Decimal128Type, Decimal128>(
+      decimal(24, 21), e3, is_valid, decimal(5, 2), v1, options);
+
+  // Out of bounds, losing digits
+  CheckFails<Decimal128Type, Decimal128>(decimal(7, 2), {100000}, {}, decimal(5, 2),
+                                         options);
+  CheckFails<Decimal128Type, Decimal128>(decimal(5, 2), {10000}, {}, decimal(5, 3),
+                                         options);
+  CheckFails<Decimal128Type, Decimal128>(decimal(38, 0), {1}, {}, decimal(38, 38),
+                                         options);
+  CheckFails<Decimal128Type, Decimal128>(decimal(5, 2), {155}, {}, decimal(5, 1),
+                                         options);
+  CheckFails<Decimal128Type, Decimal128>(decimal(24, 21), {e3[0] + 1}, {}, decimal(5, 2),
+                                         options);
+
+  options.allow_decimal_truncate = true;
+  CheckCase<Decimal128Type, Decimal128, Decimal128Type, Decimal128>(
+      decimal(5, 2), {155, -155, 9}, {}, decimal(5, 1), {15, -15, 0}, options);
+  const Decimal128 min_value("-99999999999999999999999999999999999999");
+  CheckCase<Decimal128Type, Decimal128, Decimal128Type, Decimal128>(
+      decimal(38, 0), {min_value, 7}, {}, decimal(38, 0), {min_value, 7}, options);
+}
+
+TEST_F(TestCast, FloatToDecimal) {
+  CastOptions options;
+
+  // The null slot holds a value out of bounds
+  vector<bool> is_valid = {true, false, true, true, true};
+  vector<double> v1 = {1.5, 1e10, -0.254, 0, 999.996};
+  vector<Decimal128> e1 = {150, 0, -25, 0, 100000};
+  CheckCase<DoubleType, double, Decimal128Type, Decimal128>(float64(), v1, is_valid,
+                                                            decimal(6, 2), e1, options);
+  vector<float> v2 = {1.5f, 1e10f, -0.25f, 0, 1024.0f};
+  vector<Decimal128> e2 = {150, 0, -25, 0, 102400};
+  CheckCase<FloatType, float, Decimal128Type, Decimal128>(float32(), v2, is_valid,
+                                                          decimal(6, 2), e2, options);
+
+  // Values of more than 18 digits
+  vector<double> v3 = {1e25, -1e25, 0.5, -2.5, 1.5};
+  vector<Decimal128> e3 = {Decimal128("10000000000000000905969664"),
+                           Decimal128("-10000000000000000905969664"), 1, -3, 2};
+  CheckCase<DoubleType, double, Decimal128Type, Decimal128>(float64(), v3, {},
+                                                            decimal(30, 0), e3, options);
+
+  CheckFails<DoubleType, double>(float64(), {1000}, {}, decimal(5, 2), options);
+  CheckFails<DoubleType, double>(float64(), {NAN}, {}, decimal(5, 2), options);
+  CheckFails<DoubleType, double>(float64(), {-INFINITY}, {}, decimal(38, 2), options);
+
+  options.allow_int_overflow = true;
+  CheckCase<DoubleType, double, Decimal128Type, Decimal128>(
+      float64(), {1000, NAN, 1}, {}, decimal(5, 2), {0, 0, 100}, options);
+}
+
+TEST_F(TestCast, DecimalToFloat) {
+  CastOptions options;
+
+  vector<bool> is_valid = {true, false, true, true, true};
+  vector<Decimal128> v1 = {150, 7, -25, 0, 1};
+  vector<double> e1 = {1.5, 0, -0.25, 0, 0.01};
+  CheckCase<Decimal128Type, Decimal128, DoubleType, double>(decimal(5, 2), v1, is_valid,
+                                                            float64(), e1, options);
+  vector<float> e2 = {1.5f, 0, -0.25f, 0, 0.01f};
+  CheckCase<Decimal128Type, Decimal128, FloatType, float>(decimal(5, 2), v1, is_valid,
+                                                          float32(), e2, options);
+
+  // Values of more than 18 digits
+  vector<Decimal128> v3 = {Decimal128("-36893488147419103232"), 150, 0,
+                           Decimal128("36893488147419103232")};
+  vector<double> e3 = {-3.6893488147419103232e17, 1.5, 0, 3.6893488147419103232e17};
+  CheckCase<Decimal128Type, Decimal128, DoubleType, double>(decimal(38, 2), v3, {},
+                                                            float64(), e3, options);
+}
+
 TEST_F(TestCast, ListToList) {
   CastOptions options;
   std::shared_ptr<Array> offsets;
@@ -876,6 +1345,131 @@ TEST_F(TestCast, ListToList) {
                   options);
 }
 
+TEST_F(TestCast, RunLengthEncoded) {
+  CastOptions options;
+  auto plain = _MakeArray<Int32Type, int32_t>(int32(), {4, 4, 4, 0, 0, 7, 4, 4},
+                                              {true, true, true, false, false, true,
+                                               true, true});
+  shared_ptr<Array> encoded;
+  ASSERT_OK(Cast(&this->ctx_, *plain, run_length_encoded(int32()), options, &encoded));
+  ASSERT_OK(ValidateArray(*encoded));
+  const auto& rle = checked_cast<const RunLengthEncodedArray&>(*encoded);
+  ASSERT_EQ(4, rle.num_runs());
+  ASSERT_EQ(0, rle.null_count());
+  auto expected_values =
+      _MakeArray<Int32Type, int32_t>(int32(), {4, 0, 7, 4}, {true, false, true, true});
+  ASSERT_ARRAYS_EQUAL(*expected_values, *rle.values());
+  ASSERT_EQ((vector<int32_t>{3, 5, 6, 8}),
+            vector<int32_t>(rle.raw_run_ends(), rle.raw_run_ends() + 4));
+
+  // Decoding gives back the plain array, from slices too
+  this->CheckPass(*encoded, *plain, int32(), options);
+  this->CheckPass(*encoded->Slice(2, 5), *plain->Slice(2, 5), int32(), options);
+  this->CheckPass(*plain->Slice(1), *encoded->Slice(1), encoded->type(), options);
+
+  // The values are cast run by run, or decoded to another type
+  shared_ptr<Array> int64_plain, double_plain;
+  ASSERT_OK(Cast(&this->ctx_, *plain, int64(), options, &int64_plain));
+  ASSERT_OK(Cast(&this->ctx_, *plain, float64(), options, &double_plain));
+  shared_ptr<Array> result;
+  ASSERT_OK(Cast(&this->ctx_, *encoded->Slice(1), run_length_encoded(int64()), options,
+                 &result));
+  ASSERT_OK(ValidateArray(*result));
+  ASSERT_EQ(4, checked_cast<const RunLengthEncodedArray&>(*result).num_runs());
+  this->CheckPass(*result, *int64_plain->Slice(1), int64(), options);
+  this->CheckPass(*encoded, *double_plain, float64(), options);
+
+  // Strings and booleans are encoded too
+  auto strings = _MakeArray<StringType, std::string>(utf8(), {"a", "a", "b", "", ""},
+                                                     {true, true, true, true, false});
+  ASSERT_OK(Cast(&this->ctx_, *strings, run_length_encoded(utf8()), options, &result));
+  ASSERT_EQ(4, checked_cast<const RunLengthEncodedArray&>(*result).num_runs());
+  this->CheckPass(*result, *strings, utf8(), options);
+  auto bools = _MakeArray<BooleanType, bool>(boolean(), {true, true, false, true}, {});
+  ASSERT_OK(Cast(&this->ctx_, *bools, run_length_encoded(boolean()), options, &result));
+  ASSERT_EQ(3, checked_cast<const RunLengthEncodedArray&>(*result).num_runs());
+  this->CheckPass(*result, *bools, boolean(), options);
+
+  // Empty arrays have no runs
+  ASSERT_OK(Cast(&this->ctx_, *plain->Slice(0, 0), run_length_encoded(int32()), options,
+                 &result));
+  ASSERT_OK(ValidateArray(*result));
+  ASSERT_EQ(0, checked_cast<const RunLengthEncodedArray&>(*result).num_runs());
+}
+
+TEST_F(TestCast, LargeOffsets) {
+  CastOptions options;
+  std::vector<bool> is_valid = {true, false, true, true, true};
+  std::vector<std::string> strings = {"a", "", "bc", "", "def"};
+
+  std::shared_ptr<Array> string_array, large_string_array;
+  ArrayFromVector<StringType, std::string>(is_valid, strings, &string_array);
+  LargeStringBuilder builder(pool_);
+  for (size_t i = 0; i < strings.size(); ++i) {
+    ASSERT_OK(is_valid[i] ? builder.Append(strings[i]) : builder.AppendNull());
+  }
+  ASSERT_OK(builder.Finish(&large_string_array));
+
+  this->CheckPass(*string_array, *large_string_array, large_utf8(), options);
+  this->CheckPass(*large_string_array, *string_array, utf8(), options);
+  this->CheckPass(*string_array->Slice(2), *large_string_array->Slice(2), large_utf8(),
+                  options);
+  this->CheckPass(*large_string_array->Slice(1, 3), *string_array->Slice(1, 3), utf8(),
+                  options);
+
+  // Binary casts reuse the data buffer
+  std::shared_ptr<Array> binary_array, large_binary_array, result;
+  ArrayFromVector<BinaryType, std::string>(is_valid, strings, &binary_array);
+  ASSERT_OK(Cast(&this->ctx_, *binary_array, large_binary(), options,
+                 &large_binary_array));
+  ASSERT_EQ(Type::LARGE_BINARY, large_binary_array->type_id());
+  ASSERT_EQ(binary_array->data()->buffers[2]->data(),
+            large_binary_array->data()->buffers[2]->data());
+  this->CheckPass(*large_binary_array, *binary_array, binary(), options);
+
+  // Lists, and their values
+  std::shared_ptr<Array> offsets, values, list_array, large_list_array;
+  ArrayFromVector<Int32Type, int32_t>({0, 2, 2, 5}, &offsets);
+  ArrayFromVector<Int32Type, int32_t>({1, 2, 3, 4, 5}, &values);
+  ASSERT_OK(ListArray::FromArrays(*offsets, *values, pool_, &list_array));
+  ArrayFromVector<Int64Type, int64_t>({0, 2, 2, 5}, &offsets);
+  ArrayFromVector<Int64Type, int64_t>({1, 2, 3, 4, 5}, &values);
+  ASSERT_OK(LargeListArray::FromArrays(*offsets, *values, pool_, &large_list_array));
+
+  this->CheckPass(*list_array, *large_list_array, large_list_array->type(), options);
+  this->CheckPass(*large_list_array, *list_array, list_array->type(), options);
+}
+
+TEST_F(TestCast, ChunkedArrayParallel) {
+  // One chunk is split into morsels
+  const int64_t long_length = detail::kMorselLength * 2 + 100;
+  vector<int32_t> values(long_length);
+  for (int64_t i = 0; i < long_length; ++i) {
+    values[i] = static_cast<int32_t>(i % 1000) - 500;
+  }
+  vector<bool> is_valid;
+  test::random_is_valid(long_length, 0.1, &is_valid);
+  auto long_chunk = _MakeArray<Int32Type, int32_t>(int32(), values, is_valid);
+  auto short_chunk = _MakeArray<Int32Type, int32_t>(int32(), {1, 2, 3}, {});
+  auto chunked = std::make_shared<ChunkedArray>(
+      ArrayVector{short_chunk, long_chunk->Slice(1), long_chunk->Slice(0, 0)});
+
+  Datum expected;
+  ASSERT_OK(Cast(&this->ctx_, Datum(chunked), int64(), CastOptions(), &expected));
+
+  this->ctx_.set_use_threads(true);
+  Datum result;
+  ASSERT_OK(Cast(&this->ctx_, Datum(chunked), int64(), CastOptions(), &result));
+  ASSERT_EQ(Datum::CHUNKED_ARRAY, result.kind());
+  ASSERT_EQ(5, result.chunked_array()->num_chunks());
+  ASSERT_TRUE(result.chunked_array()->Equals(*expected.chunked_array()));
+
+  // Errors of any morsel are reported
+  ASSERT_RAISES(Invalid, Cast(&this->ctx_, Datum(chunked), uint8(), CastOptions(),
+                              &result));
+  this->ctx_.set_use_threads(false);
+}
+
 // ----------------------------------------------------------------------
 // Dictionary tests
 
@@ -910,6 +1504,38 @@ void CheckDictEncode(FunctionContext* ctx, const shared_ptr<DataType>& type,
   ASSERT_ARRAYS_EQUAL(expected, *result);
 }
 
+// A union of int32 values of type code 5 and strings of type code 2: the
+// negative values stand for null slots, the even ones for ints and the odd
+// ones for strings of their digits
+void MakeUnionOfValues(UnionMode::type mode, const vector<int>& values,
+                       shared_ptr<Array>* out) {
+  auto type = union_({field("ints", int32()), field("strs", utf8())}, {5, 2}, mode);
+  std::unique_ptr<ArrayBuilder> builder;
+  ASSERT_OK(MakeBuilder(default_memory_pool(), type, &builder));
+  auto& union_builder = checked_cast<UnionBuilder&>(*builder);
+  auto& ints = checked_cast<Int32Builder&>(*union_builder.child_builder(0));
+  auto& strs = checked_cast<StringBuilder&>(*union_builder.child_builder(1));
+  const bool sparse = mode == UnionMode::SPARSE;
+  for (int value : values) {
+    if (value < 0) {
+      ASSERT_OK(union_builder.AppendNull());
+    } else if (value % 2 == 0) {
+      ASSERT_OK(union_builder.Append(5));
+      ASSERT_OK(ints.Append(value));
+    } else {
+      ASSERT_OK(union_builder.Append(2));
+      ASSERT_OK(strs.Append(std::to_string(value)));
+    }
+    if (sparse && (value < 0 || value % 2 != 0)) {
+      ASSERT_OK(ints.AppendNull());
+    }
+    if (sparse && (value < 0 || value % 2 == 0)) {
+      ASSERT_OK(strs.AppendNull());
+    }
+  }
+  ASSERT_OK(builder->Finish(out));
+}
+
 class TestHashKernel : public ComputeFixture, public TestBase {};
 
 template <typename Type>
@@ -941,8 +1567,8 @@ TYPED_TEST(TestHashKernelPrimitive, DictEncode) {
 
 TYPED_TEST(TestHashKernelPrimitive, PrimitiveResizeTable) {
   using T = typename TypeParam::c_type;
-  // Skip this test for (u)int8
-  if (sizeof(Scalar) == 1) {
+  // Skip this test for types too narrow to hold kTotalValues distinct values
+  if (sizeof(T) <= 2) {
     return;
   }
 
@@ -968,6 +1594,27 @@ TYPED_TEST(TestHashKernelPrimitive, PrimitiveResizeTable) {
   CheckDictEncode<TypeParam, T>(&this->ctx_, type, values, {}, uniques, {}, indices);
 }
 
+TEST_F(TestHashKernel, UniqueUnion) {
+  for (auto mode : {UnionMode::DENSE, UnionMode::SPARSE}) {
+    shared_ptr<Array> values, expected, result;
+    MakeUnionOfValues(mode, {4, 3, -1, 4, 2, 3, 7, 2, -1, 4}, &values);
+    MakeUnionOfValues(mode, {4, 3, 2, 7}, &expected);
+    ASSERT_OK(Unique(&this->ctx_, Datum(values), &result));
+    ASSERT_OK(ValidateArray(*result));
+    ASSERT_ARRAYS_EQUAL(*expected, *result);
+
+    // The distinct values of all the chunks, sliced ones included
+    auto chunked = std::make_shared<ChunkedArray>(
+        ArrayVector{values->Slice(0, 4), values->Slice(4, 3), values->Slice(7)});
+    ASSERT_OK(Unique(&this->ctx_, Datum(chunked), &result));
+    ASSERT_ARRAYS_EQUAL(*expected, *result);
+
+    MakeUnionOfValues(mode, {3, 7, 2, 4}, &expected);
+    ASSERT_OK(Unique(&this->ctx_, Datum(values->Slice(5)), &result));
+    ASSERT_ARRAYS_EQUAL(*expected, *result);
+  }
+}
+
 TEST_F(TestHashKernel, UniqueTimeTimestamp) {
   CheckUnique<Time32Type, int32_t>(&this->ctx_, time32(TimeUnit::SECOND), {2, 1, 2, 1},
                                    {true, false, true, true}, {2, 1}, {});
@@ -1033,6 +1680,45 @@ TEST_F(TestHashKernel, DictEncodeBinary) {
       {true, false, true, true, true}, {"test", "test2", "baz"}, {}, {0, 0, 1, 0, 2});
 }
 
+TEST_F(TestHashKernel, DictionaryEncoded) {
+  // Values already dictionary-encoded are hashed by their indices
+  auto dict = _MakeArray<StringType, std::string>(utf8(), {"a", "b", "c", "d"}, {});
+  auto dict_type = dictionary(int16(), dict);
+  auto make_chunk = [&](const vector<int16_t>& values, const vector<bool>& is_valid) {
+    return std::make_shared<DictionaryArray>(
+        dict_type, _MakeArray<Int16Type, int16_t>(int16(), values, is_valid));
+  };
+  auto chunked = std::make_shared<ChunkedArray>(ArrayVector{
+      make_chunk({2, 0, 2}, {}), make_chunk({0, 3, 1, 3}, {true, true, false, true})});
+
+  auto plain = std::make_shared<ChunkedArray>(ArrayVector{
+      _MakeArray<StringType, std::string>(utf8(), {"c", "a", "c"}, {}),
+      _MakeArray<StringType, std::string>(utf8(), {"a", "d", "", "d"},
+                                          {true, true, false, true})});
+
+  for (const Datum& input : {Datum(chunked), Datum(chunked->chunk(1))}) {
+    const Datum plain_input =
+        input.kind() == Datum::ARRAY ? Datum(plain->chunk(1)) : Datum(plain);
+
+    shared_ptr<Array> result, expected;
+    ASSERT_OK(Unique(&this->ctx_, input, &result));
+    ASSERT_OK(Unique(&this->ctx_, plain_input, &expected));
+    ASSERT_ARRAYS_EQUAL(*expected, *result);
+
+    Datum encoded, expected_encoded;
+    ASSERT_OK(DictionaryEncode(&this->ctx_, input, &encoded));
+    ASSERT_OK(DictionaryEncode(&this->ctx_, plain_input, &expected_encoded));
+    ASSERT_EQ(expected_encoded.kind(), encoded.kind());
+    ASSERT_TRUE(expected_encoded.type()->Equals(*encoded.type()));
+    if (encoded.kind() == Datum::ARRAY) {
+      ASSERT_ARRAYS_EQUAL(*MakeArray(expected_encoded.array()),
+                          *MakeArray(encoded.array()));
+    } else {
+      ASSERT_TRUE(expected_encoded.chunked_array()->Equals(*encoded.chunked_array()));
+    }
+  }
+}
+
 TEST_F(TestHashKernel, BinaryResizeTable) {
   const int64_t kTotalValues = 10000;
   const int64_t kRepeats = 10;
@@ -1156,5 +1842,1845 @@ TEST_F(TestHashKernel, ChunkedArrayInvoke) {
   ASSERT_TRUE(encoded_out.chunked_array()->Equals(*dict_carr));
 }
 
+TEST_F(TestHashKernel, ChunkedArrayParallel) {
+  const int64_t long_length = detail::kMorselLength + 1000;
+  vector<int64_t> values(long_length);
+  for (int64_t i = 0; i < long_length; ++i) {
+    // The values of the second morsel are mostly new ones
+    values[i] = (i * 7919) % (i < long_length / 2 ? 5000 : 1000000);
+  }
+  vector<bool> is_valid;
+  test::random_is_valid(long_length, 0.05, &is_valid);
+  auto long_chunk = _MakeArray<Int64Type, int64_t>(int64(), values, is_valid);
+  auto short_chunk = _MakeArray<Int64Type, int64_t>(int64(), {-1, 7, -1}, {});
+  auto chunked = std::make_shared<ChunkedArray>(ArrayVector{short_chunk, long_chunk});
+
+  shared_ptr<Array> expected_unique;
+  ASSERT_OK(Unique(&this->ctx_, Datum(chunked), &expected_unique));
+  Datum expected_encoded;
+  ASSERT_OK(DictionaryEncode(&this->ctx_, Datum(chunked), &expected_encoded));
+
+  // The same dictionaries as hashing sequentially
+  this->ctx_.set_use_threads(true);
+  shared_ptr<Array> unique;
+  ASSERT_OK(Unique(&this->ctx_, Datum(chunked), &unique));
+  ASSERT_ARRAYS_EQUAL(*expected_unique, *unique);
+
+  Datum encoded;
+  ASSERT_OK(DictionaryEncode(&this->ctx_, Datum(chunked), &encoded));
+  ASSERT_EQ(Datum::CHUNKED_ARRAY, encoded.kind());
+  ASSERT_EQ(3, encoded.chunked_array()->num_chunks());
+  ASSERT_TRUE(encoded.chunked_array()->type()->Equals(
+      *expected_encoded.chunked_array()->type()));
+  ASSERT_TRUE(encoded.chunked_array()->Equals(*expected_encoded.chunked_array()));
+  this->ctx_.set_use_threads(false);
+}
+
+
+TEST_F(TestHashKernel, UnifyDictionaries) {
+  auto type = utf8();
+  auto dict1 = _MakeArray<StringType, std::string>(type, {"foo", "bar", "baz"}, {});
+  auto dict2 = _MakeArray<StringType, std::string>(type, {"baz", "qux", "foo"}, {});
+  auto indices1 = _MakeArray<Int8Type, int8_t>(int8(), {2, 0, 1, 1}, {});
+  auto indices2 = _MakeArray<Int16Type, int16_t>(int16(), {1, 2, 0, 0},
+                                                  {true, true, false, true});
+  auto arr1 = std::make_shared<DictionaryArray>(dictionary(int8(), dict1), indices1);
+  auto arr2 = std::make_shared<DictionaryArray>(dictionary(int16(), dict2), indices2);
+
+  std::shared_ptr<DataType> out_type;
+  std::vector<std::shared_ptr<Buffer>> transpose_maps;
+  ASSERT_OK(UnifyDictionaries(&this->ctx_, {arr1->type(), arr2->type()}, &out_type,
+                              &transpose_maps));
+
+  auto ex_dict =
+      _MakeArray<StringType, std::string>(type, {"foo", "bar", "baz", "qux"}, {});
+  ASSERT_TRUE(out_type->Equals(*dictionary(int16(), ex_dict)));
+  ASSERT_EQ(2, transpose_maps.size());
+  const int32_t* map1 = reinterpret_cast<const int32_t*>(transpose_maps[0]->data());
+  const int32_t* map2 = reinterpret_cast<const int32_t*>(transpose_maps[1]->data());
+  ASSERT_EQ(vector<int32_t>({0, 1, 2}), vector<int32_t>(map1, map1 + 3));
+  ASSERT_EQ(vector<int32_t>({2, 3, 0}), vector<int32_t>(map2, map2 + 3));
+
+  // Remap the indices onto the unified dictionary
+  shared_ptr<Array> out1, out2;
+  ASSERT_OK(arr1->Transpose(this->pool_, out_type, map1, &out1));
+  ASSERT_OK(arr2->Transpose(this->pool_, out_type, map2, &out2));
+  auto ex_indices1 = _MakeArray<Int16Type, int16_t>(int16(), {2, 0, 1, 1}, {});
+  auto ex_indices2 = _MakeArray<Int16Type, int16_t>(int16(), {3, 0, 0, 2},
+                                                     {true, true, false, true});
+  ASSERT_ARRAYS_EQUAL(DictionaryArray(out_type, ex_indices1), *out1);
+  ASSERT_ARRAYS_EQUAL(DictionaryArray(out_type, ex_indices2), *out2);
+
+  // Sliced arrays keep their offset
+  shared_ptr<Array> out_slice;
+  auto slice = std::static_pointer_cast<DictionaryArray>(arr2->Slice(1, 3));
+  ASSERT_OK(slice->Transpose(this->pool_, out_type, map2, &out_slice));
+  ASSERT_ARRAYS_EQUAL(*DictionaryArray(out_type, ex_indices2).Slice(1, 3), *out_slice);
+
+  ASSERT_RAISES(Invalid, UnifyDictionaries(&this->ctx_, {}, &out_type, &transpose_maps));
+  ASSERT_RAISES(Invalid, UnifyDictionaries(&this->ctx_, {arr1->type(), utf8()},
+                                           &out_type, &transpose_maps));
+}
+
+std::vector<uint64_t> HashValues(const Array& array) {
+  std::vector<uint64_t> hashes(static_cast<size_t>(array.length()));
+  ARROW_CHECK_OK(HashArray(*array.data(), hashes.data()));
+  return hashes;
+}
+
+TEST_F(TestHashKernel, HashArray) {
+  auto ints = _MakeArray<Int32Type, int32_t>(
+      int32(), {1, 2, 1, 7, 0, 7, 3}, {true, true, true, false, true, false, true});
+  auto hashes = HashValues(*ints);
+  ASSERT_EQ(hashes[0], hashes[2]);
+  ASSERT_EQ(hashes[3], hashes[5]);
+  std::vector<uint64_t> distinct = {hashes[0], hashes[1], hashes[3], hashes[4],
+                                    hashes[6]};
+  std::sort(distinct.begin(), distinct.end());
+  ASSERT_EQ(distinct.end(), std::unique(distinct.begin(), distinct.end()));
+
+  // Slices hash like the corresponding values, and nulls of any type hash alike
+  auto sliced = HashValues(*ints->Slice(2));
+  ASSERT_EQ(std::vector<uint64_t>(hashes.begin() + 2, hashes.end()), sliced);
+  ASSERT_EQ(hashes[3], HashValues(NullArray(2))[1]);
+
+  auto strings = _MakeArray<StringType, std::string>(
+      utf8(), {"foo", "", "a somewhat longer string", "foo", "", "bar"},
+      {true, true, true, true, false, true});
+  hashes = HashValues(*strings);
+  ASSERT_EQ(hashes[0], hashes[3]);
+  ASSERT_NE(hashes[0], hashes[1]);
+  ASSERT_NE(hashes[0], hashes[5]);
+  ASSERT_NE(hashes[1], hashes[4]);
+  ASSERT_EQ(HashValues(NullArray(1))[0], hashes[4]);
+  sliced = HashValues(*strings->Slice(1, 3));
+  ASSERT_EQ(std::vector<uint64_t>(hashes.begin() + 1, hashes.begin() + 4), sliced);
+
+  // Values past the prefetch distance
+  std::vector<std::string> many_strings;
+  for (int i = 0; i < 100; ++i) {
+    many_strings.push_back(std::to_string(i % 10));
+  }
+  auto many = _MakeArray<StringType, std::string>(utf8(), many_strings, {});
+  hashes = HashValues(*many);
+  for (size_t i = 10; i < hashes.size(); ++i) {
+    ASSERT_EQ(hashes[i - 10], hashes[i]);
+  }
+
+  auto bools = _MakeArray<BooleanType, bool>(boolean(), {true, false, true}, {});
+  hashes = HashValues(*bools);
+  ASSERT_EQ(hashes[0], hashes[2]);
+  ASSERT_NE(hashes[0], hashes[1]);
+
+  auto fsb_type = fixed_size_binary(3);
+  auto fsb = _MakeArray<FixedSizeBinaryType, std::string>(fsb_type,
+                                                           {"abc", "abd", "abc"}, {});
+  hashes = HashValues(*fsb);
+  ASSERT_EQ(hashes[0], hashes[2]);
+  ASSERT_NE(hashes[0], hashes[1]);
+
+  ListBuilder list_builder(default_memory_pool(), std::make_shared<Int8Builder>());
+  std::shared_ptr<Array> list;
+  ASSERT_OK(list_builder.Finish(&list));
+  std::vector<uint64_t> out(1);
+  ASSERT_RAISES(NotImplemented, HashArray(*list->data(), out.data()));
+}
+
+TEST_F(TestHashKernel, HashRows) {
+  auto ints =
+      _MakeArray<Int32Type, int32_t>(int32(), {1, 2, 1, 1}, {true, true, true, false});
+  auto strings =
+      _MakeArray<StringType, std::string>(utf8(), {"a", "b", "a", "a"}, {});
+  auto doubles = _MakeArray<DoubleType, double>(float64(), {0.5, 0.5, 1.5, 0.5}, {});
+  auto schema = ::arrow::schema(
+      {field("ints", int32()), field("strings", utf8()), field("doubles", float64())});
+  auto batch = RecordBatch::Make(schema, 4, {ints, strings, doubles});
+
+  shared_ptr<Array> out;
+  ASSERT_OK(HashRows(&this->ctx_, *batch, {0, 1}, &out));
+  ASSERT_EQ(0, out->null_count());
+  auto hashes = checked_cast<const UInt64Array&>(*out).raw_values();
+  ASSERT_EQ(hashes[0], hashes[2]);
+  ASSERT_NE(hashes[0], hashes[1]);
+  ASSERT_NE(hashes[0], hashes[3]);
+
+  // The order of the columns matters
+  shared_ptr<Array> reversed;
+  ASSERT_OK(HashRows(&this->ctx_, *batch, {1, 0}, &reversed));
+  ASSERT_NE(hashes[0], checked_cast<const UInt64Array&>(*reversed).Value(0));
+
+  ASSERT_OK(HashRows(&this->ctx_, *batch, {0, 1, 2}, &out));
+  hashes = checked_cast<const UInt64Array&>(*out).raw_values();
+  ASSERT_NE(hashes[0], hashes[2]);
+
+  // A single column gives the column's hashes
+  ASSERT_OK(HashRows(&this->ctx_, *batch, {1}, &out));
+  hashes = checked_cast<const UInt64Array&>(*out).raw_values();
+  ASSERT_EQ(HashValues(*strings), std::vector<uint64_t>(hashes, hashes + 4));
+
+  ASSERT_RAISES(Invalid, HashRows(&this->ctx_, *batch, {}, &out));
+  ASSERT_RAISES(Invalid, HashRows(&this->ctx_, *batch, {0, 3}, &out));
+}
+
+// ----------------------------------------------------------------------
+// Scalar aggregate tests
+
+template <typename Type>
+class TestAggregateKernel : public ComputeFixture, public TestBase {
+ protected:
+  using T = typename Type::c_type;
+  using SumType = typename std::conditional<
+      std::is_floating_point<T>::value, DoubleType,
+      typename std::conditional<std::is_unsigned<T>::value, UInt64Type,
+                                Int64Type>::type>::type;
+  using Sum = typename SumType::c_type;
+
+  // Check the aggregates of a slice against a plain loop over its values
+  void CheckSlice(const std::shared_ptr<Array>& array, int64_t offset, int64_t length) {
+    auto slice = array->Slice(offset, length);
+    const auto& values = checked_cast<const NumericArray<Type>&>(*slice);
+    Sum expected_sum = 0;
+    T expected_min = std::numeric_limits<T>::max();
+    T expected_max = std::numeric_limits<T>::lowest();
+    int64_t count = 0;
+    for (int64_t i = 0; i < values.length(); ++i) {
+      if (values.IsValid(i)) {
+        expected_sum += static_cast<Sum>(values.Value(i));
+        expected_min = std::min(expected_min, values.Value(i));
+        expected_max = std::max(expected_max, values.Value(i));
+        ++count;
+      }
+    }
+
+    Datum out;
+    ASSERT_OK(compute::Sum(&this->ctx_, Datum(slice), &out));
+    ASSERT_EQ(Datum::SCALAR, out.kind());
+    const auto& sum = checked_cast<const NumericScalar<SumType>&>(*out.scalar());
+    ASSERT_TRUE(sum.type->Equals(*TypeTraits<SumType>::type_singleton()));
+    ASSERT_EQ(count > 0, sum.is_valid);
+    if (count > 0) {
+      ASSERT_EQ(expected_sum, sum.value);
+    }
+
+    ASSERT_OK(MinMax(&this->ctx_, Datum(slice), &out));
+    ASSERT_EQ(Datum::COLLECTION, out.kind());
+    auto min_max = out.collection();
+    const auto& min = checked_cast<const NumericScalar<Type>&>(*min_max[0].scalar());
+    const auto& max = checked_cast<const NumericScalar<Type>&>(*min_max[1].scalar());
+    ASSERT_EQ(count > 0, min.is_valid);
+    ASSERT_EQ(count > 0, max.is_valid);
+    if (count > 0) {
+      ASSERT_EQ(expected_min, min.value);
+      ASSERT_EQ(expected_max, max.value);
+    }
+
+    ASSERT_OK(Mean(&this->ctx_, Datum(slice), &out));
+    const auto& mean = checked_cast<const NumericScalar<DoubleType>&>(*out.scalar());
+    ASSERT_EQ(count > 0, mean.is_valid);
+    if (count > 0) {
+      ASSERT_DOUBLE_EQ(static_cast<double>(expected_sum) / static_cast<double>(count),
+                       mean.value);
+    }
+
+    ASSERT_OK(Count(&this->ctx_, CountOptions(), Datum(slice), &out));
+    ASSERT_EQ(count, checked_cast<const NumericScalar<Int64Type>&>(*out.scalar()).value);
+    ASSERT_OK(Count(&this->ctx_, CountOptions(CountOptions::COUNT_NULL), Datum(slice),
+                    &out));
+    ASSERT_EQ(length - count,
+              checked_cast<const NumericScalar<Int64Type>&>(*out.scalar()).value);
+  }
+};
+
+typedef ::testing::Types<Int8Type, UInt8Type, Int16Type, UInt32Type, Int64Type,
+                         UInt64Type, FloatType, DoubleType>
+    AggregateTypes;
+
+TYPED_TEST_CASE(TestAggregateKernel, AggregateTypes);
+
+TYPED_TEST(TestAggregateKernel, Slices) {
+  using T = typename TypeParam::c_type;
+  const int64_t kLength = 1000;
+  vector<T> values;
+  for (int64_t i = 0; i < kLength; ++i) {
+    // Small values, so that floating point sums are exact in any order
+    values.push_back(static_cast<T>((i * 37) % 101) / static_cast<T>(2));
+  }
+
+  for (double null_probability : {0.0, 0.1, 0.9, 1.0}) {
+    vector<bool> is_valid;
+    test::random_is_valid(kLength, null_probability, &is_valid);
+    auto array = _MakeArray<TypeParam, T>(TypeTraits<TypeParam>::type_singleton(),
+                                          values, is_valid);
+    this->CheckSlice(array, 0, kLength);
+    this->CheckSlice(array, 3, kLength - 3);
+    this->CheckSlice(array, 64, 130);
+    this->CheckSlice(array, 67, 64);
+    this->CheckSlice(array, 5, 10);
+    this->CheckSlice(array, 0, 0);
+  }
+}
+
+class TestScalarAggregate : public ComputeFixture, public TestBase {};
+
+TEST_F(TestScalarAggregate, ChunkedArray) {
+  auto chunk1 = _MakeArray<Int32Type, int32_t>(int32(), {1, 2, 3}, {true, false, true});
+  auto chunk2 = _MakeArray<Int32Type, int32_t>(int32(), {-4, 10}, {});
+  Datum chunked(std::make_shared<ChunkedArray>(ArrayVector{chunk1, chunk2}));
+
+  Datum out;
+  ASSERT_OK(Sum(&this->ctx_, chunked, &out));
+  ASSERT_EQ(10, checked_cast<const NumericScalar<Int64Type>&>(*out.scalar()).value);
+  ASSERT_OK(MinMax(&this->ctx_, chunked, &out));
+  auto min_max = out.collection();
+  using Int32Scalar = NumericScalar<Int32Type>;
+  ASSERT_EQ(-4, checked_cast<const Int32Scalar&>(*min_max[0].scalar()).value);
+  ASSERT_EQ(10, checked_cast<const Int32Scalar&>(*min_max[1].scalar()).value);
+  ASSERT_OK(Mean(&this->ctx_, chunked, &out));
+  ASSERT_EQ(2.5, checked_cast<const NumericScalar<DoubleType>&>(*out.scalar()).value);
+  ASSERT_OK(Count(&this->ctx_, CountOptions(CountOptions::COUNT_NULL), chunked, &out));
+  ASSERT_EQ(1, checked_cast<const NumericScalar<Int64Type>&>(*out.scalar()).value);
+
+  // Count works on any type, the other aggregates on numbers only
+  auto strings = _MakeArray<StringType, std::string>(utf8(), {"a", "b"}, {false, true});
+  ASSERT_OK(Count(&this->ctx_, CountOptions(), Datum(strings), &out));
+  ASSERT_EQ(1, checked_cast<const NumericScalar<Int64Type>&>(*out.scalar()).value);
+  ASSERT_RAISES(NotImplemented, Sum(&this->ctx_, Datum(strings), &out));
+  ASSERT_RAISES(Invalid, Sum(&this->ctx_, Datum(), &out));
+}
+
+TEST_F(TestScalarAggregate, SumDecimal) {
+  auto check_sum = [this](const shared_ptr<DataType>& type,
+                          const vector<Decimal128>& values,
+                          const vector<bool>& is_valid) {
+    Decimal128 expected_sum;
+    for (size_t i = 0; i < values.size(); ++i) {
+      if (is_valid[i]) {
+        expected_sum += values[i];
+      }
+    }
+    auto array = _MakeArray<Decimal128Type, Decimal128>(type, values, is_valid);
+    for (int64_t offset : {0, 1}) {
+      Datum out;
+      ASSERT_OK(Sum(&this->ctx_, Datum(array->Slice(offset)), &out));
+      const auto& sum = checked_cast<const Decimal128Scalar&>(*out.scalar());
+      const int32_t scale = checked_cast<const Decimal128Type&>(*type).scale();
+      ASSERT_TRUE(sum.type->Equals(*decimal(38, scale)));
+      ASSERT_TRUE(sum.is_valid);
+      if (offset == 0) {
+        ASSERT_EQ(expected_sum, sum.value);
+      }
+      expected_sum -= is_valid[0] ? values[0] : 0;
+    }
+  };
+
+  // Values of at most 18 digits, whose sums are beyond the range of int64_t
+  vector<Decimal128> values;
+  vector<bool> is_valid;
+  for (int i = 0; i < 200; ++i) {
+    values.push_back(i % 3 == 0 ? Decimal128(-12345) : Decimal128("999999999999999999"));
+    is_valid.push_back(i % 7 != 0);
+  }
+  check_sum(decimal(18, 2), values, is_valid);
+  check_sum(decimal(18, 2), values, vector<bool>(values.size(), true));
+
+  // And of more
+  for (auto& value : values) {
+    value *= Decimal128("1000000000000000000");
+  }
+  check_sum(decimal(38, 4), values, is_valid);
+
+  // Only nulls
+  auto nulls = _MakeArray<Decimal128Type, Decimal128>(decimal(5, 1), {1, 2},
+                                                      {false, false});
+  Datum out;
+  ASSERT_OK(Sum(&this->ctx_, Datum(nulls), &out));
+  ASSERT_FALSE(out.scalar()->is_valid);
+}
+
+TEST_F(TestScalarAggregate, RunLengthEncoded) {
+  // 2, 2, 2, null, null, -1, 5, 5
+  auto plain = _MakeArray<Int32Type, int32_t>(int32(), {2, 2, 2, 0, 0, -1, 5, 5},
+                                              {true, true, true, false, false, true,
+                                               true, true});
+  shared_ptr<Array> encoded;
+  ASSERT_OK(Cast(&this->ctx_, *plain, run_length_encoded(int32()), CastOptions(),
+                 &encoded));
+
+  for (int64_t offset : {0, 2}) {
+    Datum input(encoded->Slice(offset)), expected_input(plain->Slice(offset));
+    Datum out, expected;
+    ASSERT_OK(Sum(&this->ctx_, input, &out));
+    ASSERT_OK(Sum(&this->ctx_, expected_input, &expected));
+    ASSERT_TRUE(out.scalar()->type->Equals(*int64()));
+    ASSERT_EQ(checked_cast<const NumericScalar<Int64Type>&>(*expected.scalar()).value,
+              checked_cast<const NumericScalar<Int64Type>&>(*out.scalar()).value);
+
+    ASSERT_OK(Mean(&this->ctx_, input, &out));
+    ASSERT_OK(Mean(&this->ctx_, expected_input, &expected));
+    ASSERT_EQ(checked_cast<const NumericScalar<DoubleType>&>(*expected.scalar()).value,
+              checked_cast<const NumericScalar<DoubleType>&>(*out.scalar()).value);
+
+    ASSERT_OK(MinMax(&this->ctx_, input, &out));
+    using Int32Scalar = NumericScalar<Int32Type>;
+    ASSERT_EQ(-1, checked_cast<const Int32Scalar&>(*out.collection()[0].scalar()).value);
+    ASSERT_EQ(5, checked_cast<const Int32Scalar&>(*out.collection()[1].scalar()).value);
+
+    for (auto mode : {CountOptions::COUNT_VALID, CountOptions::COUNT_NULL}) {
+      ASSERT_OK(Count(&this->ctx_, CountOptions(mode), input, &out));
+      ASSERT_OK(Count(&this->ctx_, CountOptions(mode), expected_input, &expected));
+      ASSERT_EQ(checked_cast<const NumericScalar<Int64Type>&>(*expected.scalar()).value,
+                checked_cast<const NumericScalar<Int64Type>&>(*out.scalar()).value);
+    }
+  }
+}
+
+// ----------------------------------------------------------------------
+// Grouped aggregation tests
+
+class TestGroupBy : public ComputeFixture, public TestBase {
+ protected:
+  void SetUp() override {
+    schema_ = ::arrow::schema(
+        {field("key", utf8()), field("flag", boolean()), field("value", int32())});
+  }
+
+  std::shared_ptr<RecordBatch> MakeBatch(const vector<std::string>& keys,
+                                         const vector<bool>& keys_valid,
+                                         const vector<bool>& flags,
+                                         const vector<int32_t>& values,
+                                         const vector<bool>& values_valid) {
+    auto key_array = _MakeArray<StringType, std::string>(utf8(), keys, keys_valid);
+    auto flag_array = _MakeArray<BooleanType, bool>(boolean(), flags, {});
+    auto value_array = _MakeArray<Int32Type, int32_t>(int32(), values, values_valid);
+    return RecordBatch::Make(schema_, static_cast<int64_t>(keys.size()),
+                             {key_array, flag_array, value_array});
+  }
+
+  std::shared_ptr<Schema> schema_;
+};
+
+TEST_F(TestGroupBy, Aggregates) {
+  auto batch =
+      MakeBatch({"a", "b", "a", "", "b", "c"}, {true, true, true, false, true, true},
+                {true, true, true, true, true, true}, {1, 5, 3, 7, 0, 2},
+                {true, true, true, true, true, false});
+  std::vector<AggregateSpec> aggregates = {
+      {Aggregate::COUNT, 2}, {Aggregate::SUM, 2}, {Aggregate::MIN, 2},
+      {Aggregate::MAX, 2},   {Aggregate::MEAN, 2}};
+
+  std::unique_ptr<GroupByAggregator> aggregator;
+  ASSERT_OK(GroupByAggregator::Make(&this->ctx_, schema_, {0}, aggregates, &aggregator));
+  ASSERT_OK(aggregator->Consume(*batch));
+  ASSERT_EQ(4, aggregator->num_groups());
+
+  std::shared_ptr<RecordBatch> result;
+  ASSERT_OK(aggregator->Finish(&result));
+  ASSERT_EQ(6, result->num_columns());
+  ASSERT_EQ("key", result->schema()->field(0)->name());
+  ASSERT_EQ("sum(value)", result->schema()->field(2)->name());
+
+  // Nulls form a group, groups without values have null aggregates
+  auto keys = _MakeArray<StringType, std::string>(utf8(), {"a", "b", "", "c"},
+                                                  {true, true, false, true});
+  ASSERT_ARRAYS_EQUAL(*keys, *result->column(0));
+  auto counts = _MakeArray<Int64Type, int64_t>(int64(), {2, 2, 1, 0}, {});
+  ASSERT_ARRAYS_EQUAL(*counts, *result->column(1));
+  auto sums =
+      _MakeArray<Int64Type, int64_t>(int64(), {4, 5, 7, 0}, {true, true, true, false});
+  ASSERT_ARRAYS_EQUAL(*sums, *result->column(2));
+  auto mins =
+      _MakeArray<Int32Type, int32_t>(int32(), {1, 0, 7, 0}, {true, true, true, false});
+  ASSERT_ARRAYS_EQUAL(*mins, *result->column(3));
+  auto maxs =
+      _MakeArray<Int32Type, int32_t>(int32(), {3, 5, 7, 0}, {true, true, true, false});
+  ASSERT_ARRAYS_EQUAL(*maxs, *result->column(4));
+  auto means = _MakeArray<DoubleType, double>(float64(), {2, 2.5, 7, 0},
+                                              {true, true, true, false});
+  ASSERT_ARRAYS_EQUAL(*means, *result->column(5));
+}
+
+TEST_F(TestGroupBy, CompositeKeysAcrossBatches) {
+  auto batch1 = MakeBatch({"a", "a", "b"}, {}, {true, false, true}, {1, 2, 3}, {});
+  auto batch2 = MakeBatch({"b", "a", "a", "b"}, {}, {true, false, true, false},
+                          {4, 5, 6, 7}, {});
+  std::vector<AggregateSpec> aggregates = {{Aggregate::SUM, 2}};
+
+  std::unique_ptr<GroupByAggregator> aggregator;
+  ASSERT_OK(
+      GroupByAggregator::Make(&this->ctx_, schema_, {1, 0}, aggregates, &aggregator));
+  ASSERT_OK(aggregator->Consume(*batch1));
+  ASSERT_OK(aggregator->Consume(*batch2));
+
+  std::shared_ptr<RecordBatch> result;
+  ASSERT_OK(aggregator->Finish(&result));
+  auto flags = _MakeArray<BooleanType, bool>(boolean(), {true, false, true, false}, {});
+  auto keys = _MakeArray<StringType, std::string>(utf8(), {"a", "a", "b", "b"}, {});
+  auto sums = _MakeArray<Int64Type, int64_t>(int64(), {7, 7, 7, 7}, {});
+  ASSERT_ARRAYS_EQUAL(*flags, *result->column(0));
+  ASSERT_ARRAYS_EQUAL(*keys, *result->column(1));
+  ASSERT_ARRAYS_EQUAL(*sums, *result->column(2));
+
+  // Partial aggregates merge into the same result
+  std::unique_ptr<GroupByAggregator> partial1, partial2;
+  ASSERT_OK(GroupByAggregator::Make(&this->ctx_, schema_, {1, 0}, aggregates, &partial1));
+  ASSERT_OK(GroupByAggregator::Make(&this->ctx_, schema_, {1, 0}, aggregates, &partial2));
+  ASSERT_OK(partial1->Consume(*batch1));
+  ASSERT_OK(partial2->Consume(*batch2));
+  ASSERT_OK(partial1->Merge(*partial2));
+  std::shared_ptr<RecordBatch> merged;
+  ASSERT_OK(partial1->Finish(&merged));
+  ASSERT_BATCHES_EQUAL(*result, *merged);
+
+  // The same through a chunked table
+  std::shared_ptr<Table> table, table_result;
+  ASSERT_OK(Table::FromRecordBatches({batch1, batch2}, &table));
+  ASSERT_OK(GroupBy(&this->ctx_, *table, {1, 0}, aggregates, &table_result));
+  std::shared_ptr<Table> expected;
+  ASSERT_OK(Table::FromRecordBatches({result}, &expected));
+  ASSERT_TRUE(expected->Equals(*table_result));
+}
+
+TEST_F(TestGroupBy, ManyGroups) {
+  const int64_t kLength = 10000;
+  Int64Builder key_builder;
+  DoubleBuilder value_builder;
+  for (int64_t i = 0; i < kLength; ++i) {
+    ASSERT_OK(key_builder.Append(i % 3000));
+    ASSERT_OK(value_builder.Append(static_cast<double>(i)));
+  }
+  std::shared_ptr<Array> keys, values;
+  ASSERT_OK(key_builder.Finish(&keys));
+  ASSERT_OK(value_builder.Finish(&values));
+  auto schema = ::arrow::schema({field("key", int64()), field("value", float64())});
+  auto batch = RecordBatch::Make(schema, kLength, {keys, values});
+
+  std::unique_ptr<GroupByAggregator> aggregator;
+  ASSERT_OK(GroupByAggregator::Make(&this->ctx_, schema, {0},
+                                    {{Aggregate::MAX, 1}, {Aggregate::COUNT, 1}},
+                                    &aggregator));
+  ASSERT_OK(aggregator->Consume(*batch));
+  std::shared_ptr<RecordBatch> result;
+  ASSERT_OK(aggregator->Finish(&result));
+  ASSERT_EQ(3000, result->num_rows());
+
+  const auto& result_keys = checked_cast<const Int64Array&>(*result->column(0));
+  const auto& maxs = checked_cast<const DoubleArray&>(*result->column(1));
+  const auto& counts = checked_cast<const Int64Array&>(*result->column(2));
+  for (int64_t g = 0; g < 3000; ++g) {
+    ASSERT_EQ(g, result_keys.Value(g));
+    ASSERT_EQ(static_cast<double>(g < 1000 ? 9000 + g : 6000 + g), maxs.Value(g));
+    ASSERT_EQ(g < 1000 ? 4 : 3, counts.Value(g));
+  }
+}
+
+TEST_F(TestGroupBy, Invalid) {
+  std::unique_ptr<GroupByAggregator> aggregator;
+  ASSERT_RAISES(Invalid,
+                GroupByAggregator::Make(&this->ctx_, schema_, {}, {}, &aggregator));
+  ASSERT_RAISES(Invalid,
+                GroupByAggregator::Make(&this->ctx_, schema_, {3}, {}, &aggregator));
+  ASSERT_RAISES(Invalid, GroupByAggregator::Make(&this->ctx_, schema_, {0},
+                                                 {{Aggregate::SUM, -1}}, &aggregator));
+  ASSERT_RAISES(NotImplemented,
+                GroupByAggregator::Make(&this->ctx_, schema_, {0},
+                                        {{Aggregate::SUM, 0}}, &aggregator));
+  auto list_schema = ::arrow::schema({field("list", list(int8()))});
+  ASSERT_RAISES(NotImplemented,
+                GroupByAggregator::Make(&this->ctx_, list_schema, {0}, {}, &aggregator));
+
+  ASSERT_OK(GroupByAggregator::Make(&this->ctx_, schema_, {0}, {{Aggregate::COUNT, 0}},
+                                    &aggregator));
+  auto other_schema = ::arrow::schema({field("key", utf8())});
+  auto keys = _MakeArray<StringType, std::string>(utf8(), {"a"}, {});
+  auto other_batch = RecordBatch::Make(other_schema, 1, {keys});
+  ASSERT_RAISES(Invalid, aggregator->Consume(*other_batch));
+
+  std::unique_ptr<GroupByAggregator> other;
+  ASSERT_OK(GroupByAggregator::Make(&this->ctx_, schema_, {1}, {{Aggregate::COUNT, 0}},
+                                    &other));
+  ASSERT_RAISES(Invalid, aggregator->Merge(*other));
+}
+
+// ----------------------------------------------------------------------
+// Hash join tests
+
+class TestHashJoin : public ComputeFixture, public TestBase {
+ protected:
+  void SetUp() override {
+    probe_schema_ = ::arrow::schema({field("id", int32()), field("name", utf8())});
+    build_schema_ = ::arrow::schema({field("key", int32()), field("value", float64())});
+    build_batches_ = {MakeBuildBatch({2, 1, 2}, {}, {20, 10, 21}),
+                      MakeBuildBatch({0, 5, 1}, {false, true, true}, {0, 50, 11})};
+  }
+
+  std::shared_ptr<RecordBatch> MakeProbeBatch(const vector<int32_t>& ids,
+                                              const vector<bool>& ids_valid,
+                                              const vector<std::string>& names) {
+    auto id_array = _MakeArray<Int32Type, int32_t>(int32(), ids, ids_valid);
+    auto name_array = _MakeArray<StringType, std::string>(utf8(), names, {});
+    return RecordBatch::Make(probe_schema_, static_cast<int64_t>(ids.size()),
+                             {id_array, name_array});
+  }
+
+  std::shared_ptr<RecordBatch> MakeBuildBatch(const vector<int32_t>& keys,
+                                              const vector<bool>& keys_valid,
+                                              const vector<double>& values) {
+    auto key_array = _MakeArray<Int32Type, int32_t>(int32(), keys, keys_valid);
+    auto value_array = _MakeArray<DoubleType, double>(float64(), values, {});
+    return RecordBatch::Make(build_schema_, static_cast<int64_t>(keys.size()),
+                             {key_array, value_array});
+  }
+
+  void MakeJoin(JoinType::type join_type, std::unique_ptr<HashJoin>* join) {
+    ASSERT_OK(HashJoin::Make(&this->ctx_, join_type, probe_schema_, {0}, build_schema_,
+                             {0}, join));
+    std::shared_ptr<Table> build_table;
+    ASSERT_OK(Table::FromRecordBatches(build_batches_, &build_table));
+    TableBatchReader reader(*build_table);
+    ASSERT_OK((*join)->Build(&reader));
+    ASSERT_EQ(6, (*join)->num_build_rows());
+  }
+
+  std::shared_ptr<Schema> probe_schema_;
+  std::shared_ptr<Schema> build_schema_;
+  std::vector<std::shared_ptr<RecordBatch>> build_batches_;
+};
+
+TEST_F(TestHashJoin, Inner) {
+  std::unique_ptr<HashJoin> join;
+  MakeJoin(JoinType::INNER, &join);
+  ASSERT_EQ(3, join->output_schema()->num_fields());
+  ASSERT_EQ("value", join->output_schema()->field(2)->name());
+
+  auto probe = MakeProbeBatch({1, 2, 3, 0, 2}, {true, true, true, false, true},
+                              {"a", "b", "c", "d", "e"});
+  std::shared_ptr<RecordBatch> result;
+  ASSERT_OK(join->Probe(&this->ctx_, *probe, &result));
+
+  // Null keys never match, matches come in build order
+  auto ids = _MakeArray<Int32Type, int32_t>(int32(), {1, 1, 2, 2, 2, 2}, {});
+  auto names =
+      _MakeArray<StringType, std::string>(utf8(), {"a", "a", "b", "b", "e", "e"}, {});
+  auto values =
+      _MakeArray<DoubleType, double>(float64(), {10, 11, 20, 21, 20, 21}, {});
+  ASSERT_EQ(6, result->num_rows());
+  ASSERT_ARRAYS_EQUAL(*ids, *result->column(0));
+  ASSERT_ARRAYS_EQUAL(*names, *result->column(1));
+  ASSERT_ARRAYS_EQUAL(*values, *result->column(2));
+}
+
+TEST_F(TestHashJoin, LeftOuter) {
+  std::unique_ptr<HashJoin> join;
+  MakeJoin(JoinType::LEFT_OUTER, &join);
+  ASSERT_TRUE(join->output_schema()->field(2)->nullable());
+
+  auto probe = MakeProbeBatch({1, 2, 3, 0, 2}, {true, true, true, false, true},
+                              {"a", "b", "c", "d", "e"});
+  std::shared_ptr<RecordBatch> result;
+  ASSERT_OK(join->Probe(&this->ctx_, *probe, &result));
+
+  auto ids = _MakeArray<Int32Type, int32_t>(
+      int32(), {1, 1, 2, 2, 3, 0, 2, 2},
+      {true, true, true, true, true, false, true, true});
+  auto values = _MakeArray<DoubleType, double>(
+      float64(), {10, 11, 20, 21, 0, 0, 20, 21},
+      {true, true, true, true, false, false, true, true});
+  ASSERT_EQ(8, result->num_rows());
+  ASSERT_ARRAYS_EQUAL(*ids, *result->column(0));
+  ASSERT_ARRAYS_EQUAL(*values, *result->column(2));
+
+  // Probe rows matching at most once keep their columns
+  auto unique_probe = MakeProbeBatch({3, 5}, {}, {"c", "f"});
+  ASSERT_OK(join->Probe(&this->ctx_, *unique_probe, &result));
+  ASSERT_EQ(unique_probe->column_data(1), result->column_data(1));
+  values = _MakeArray<DoubleType, double>(float64(), {0, 50}, {false, true});
+  ASSERT_ARRAYS_EQUAL(*values, *result->column(2));
+}
+
+TEST_F(TestHashJoin, LeftSemi) {
+  std::unique_ptr<HashJoin> join;
+  MakeJoin(JoinType::LEFT_SEMI, &join);
+  ASSERT_TRUE(join->output_schema()->Equals(*probe_schema_));
+
+  auto probe = MakeProbeBatch({1, 2, 3, 0, 2}, {true, true, true, false, true},
+                              {"a", "b", "c", "d", "e"});
+  std::shared_ptr<RecordBatch> result;
+  ASSERT_OK(join->Probe(&this->ctx_, *probe, &result));
+  auto ids = _MakeArray<Int32Type, int32_t>(int32(), {1, 2, 2}, {});
+  auto names = _MakeArray<StringType, std::string>(utf8(), {"a", "b", "e"}, {});
+  ASSERT_ARRAYS_EQUAL(*ids, *result->column(0));
+  ASSERT_ARRAYS_EQUAL(*names, *result->column(1));
+}
+
+TEST_F(TestHashJoin, ParallelJoin) {
+  std::vector<std::shared_ptr<RecordBatch>> probe_batches;
+  for (int i = 0; i < 8; ++i) {
+    probe_batches.push_back(
+        MakeProbeBatch({i % 3, 1, 5}, {}, {"x", "y", std::to_string(i)}));
+  }
+  std::shared_ptr<Table> probe_table, build_table;
+  ASSERT_OK(Table::FromRecordBatches(probe_batches, &probe_table));
+  ASSERT_OK(Table::FromRecordBatches(build_batches_, &build_table));
+
+  std::shared_ptr<Table> serial, parallel;
+  {
+    TableBatchReader probe(*probe_table);
+    TableBatchReader build(*build_table);
+    this->ctx_.set_use_threads(false);
+    ASSERT_OK(Join(&this->ctx_, JoinType::INNER, &probe, {0}, &build, {0}, &serial));
+  }
+  {
+    TableBatchReader probe(*probe_table);
+    TableBatchReader build(*build_table);
+    this->ctx_.set_use_threads(true);
+    ASSERT_OK(Join(&this->ctx_, JoinType::INNER, &probe, {0}, &build, {0}, &parallel));
+  }
+  // Keys 1 and 2 match twice, key 5 once and key 0 never
+  ASSERT_EQ(8 * 3 + 5 * 2, serial->num_rows());
+  ASSERT_TRUE(serial->Equals(*parallel));
+}
+
+TEST_F(TestHashJoin, Invalid) {
+  std::unique_ptr<HashJoin> join;
+  ASSERT_RAISES(Invalid, HashJoin::Make(&this->ctx_, JoinType::INNER, probe_schema_, {},
+                                        build_schema_, {}, &join));
+  ASSERT_RAISES(Invalid, HashJoin::Make(&this->ctx_, JoinType::INNER, probe_schema_,
+                                        {0, 1}, build_schema_, {0}, &join));
+  ASSERT_RAISES(Invalid, HashJoin::Make(&this->ctx_, JoinType::INNER, probe_schema_, {1},
+                                        build_schema_, {0}, &join));
+  ASSERT_RAISES(Invalid, HashJoin::Make(&this->ctx_, JoinType::INNER, probe_schema_, {2},
+                                        build_schema_, {0}, &join));
+
+  ASSERT_OK(HashJoin::Make(&this->ctx_, JoinType::INNER, probe_schema_, {0},
+                           build_schema_, {0}, &join));
+  auto probe = MakeProbeBatch({1}, {}, {"a"});
+  std::shared_ptr<RecordBatch> result;
+  ASSERT_RAISES(Invalid, join->Probe(&this->ctx_, *probe, &result));
+}
+
+// ----------------------------------------------------------------------
+// Take and filter tests
+
+class TestTake : public ComputeFixture, public TestBase {
+ protected:
+  // The values at the given positions, taken one slice at a time
+  std::shared_ptr<Array> TakeSlices(const std::shared_ptr<Array>& values,
+                                    const std::vector<int64_t>& positions) {
+    if (positions.empty()) {
+      return values->Slice(0, 0);
+    }
+    ArrayVector slices;
+    for (int64_t position : positions) {
+      slices.push_back(values->Slice(position, 1));
+    }
+    std::shared_ptr<Array> out;
+    EXPECT_OK(Concatenate(slices, pool_, &out));
+    return out;
+  }
+
+  void CheckTake(const std::shared_ptr<Array>& values) {
+    std::vector<int64_t> positions;
+    for (int64_t i = 0; i < 3 * values->length(); ++i) {
+      positions.push_back((i * 7919) % values->length());
+    }
+    std::shared_ptr<Array> indices;
+    ArrayFromVector<Int64Type, int64_t>(positions, &indices);
+
+    std::shared_ptr<Array> result;
+    ASSERT_OK(Take(&this->ctx_, *values, *indices, &result));
+    ASSERT_OK(ValidateArray(*result));
+    ASSERT_ARRAYS_EQUAL(*TakeSlices(values, positions), *result);
+  }
+
+  // Filter values with masks of varying density, sliced along with the values
+  void CheckFilter(const std::shared_ptr<Array>& values) {
+    const int64_t length = values->length();
+    for (double density : {0.0, 0.05, 0.3, 0.8, 0.97, 1.0}) {
+      std::vector<bool> mask_values;
+      std::vector<bool> is_valid;
+      test::random_is_valid(length + 5, 1.0 - density, &mask_values);
+      test::random_is_valid(length + 5, 0.02, &is_valid);
+      std::shared_ptr<Array> mask;
+      ArrayFromVector<BooleanType, bool>(is_valid, mask_values, &mask);
+      mask = mask->Slice(5);
+
+      std::vector<int64_t> positions;
+      for (int64_t i = 0; i < length; ++i) {
+        if (mask_values[i + 5] && is_valid[i + 5]) {
+          positions.push_back(i);
+        }
+      }
+
+      std::shared_ptr<Array> result;
+      ASSERT_OK(Filter(&this->ctx_, *values, *mask, FilterOptions(), &result));
+      ASSERT_OK(ValidateArray(*result));
+      ASSERT_ARRAYS_EQUAL(*TakeSlices(values, positions), *result);
+
+      std::vector<int32_t> expected_selection(positions.begin(), positions.end());
+      std::shared_ptr<Array> expected;
+      ArrayFromVector<Int32Type, int32_t>(expected_selection, &expected);
+      ASSERT_OK(Filter(&this->ctx_, *values, *mask,
+                       FilterOptions(FilterOptions::SELECTION_VECTOR), &result));
+      ASSERT_ARRAYS_EQUAL(*expected, *result);
+    }
+  }
+
+  void CheckTakeAndFilter(const std::shared_ptr<Array>& array) {
+    CheckTake(array);
+    CheckTake(array->Slice(7));
+    CheckFilter(array);
+    CheckFilter(array->Slice(7));
+  }
+
+  const int64_t kLength = 300;
+};
+
+TEST_F(TestTake, Indices) {
+  auto values =
+      _MakeArray<Int32Type, int32_t>(int32(), {1, 2, 3, 4}, {true, false, true, true});
+  auto indices = _MakeArray<Int8Type, int8_t>(int8(), {3, 0, 0, 1, 3},
+                                              {true, true, false, true, true});
+  auto expected = _MakeArray<Int32Type, int32_t>(int32(), {4, 1, 0, 0, 4},
+                                                 {true, true, false, false, true});
+  std::shared_ptr<Array> result;
+  ASSERT_OK(Take(&this->ctx_, *values, *indices, &result));
+  ASSERT_ARRAYS_EQUAL(*expected, *result);
+  ASSERT_EQ(2, result->null_count());
+
+  indices = _MakeArray<UInt64Type, uint64_t>(uint64(), {2, 2, 0}, {});
+  expected = _MakeArray<Int32Type, int32_t>(int32(), {3, 3, 1}, {});
+  ASSERT_OK(Take(&this->ctx_, *values, *indices, &result));
+  ASSERT_ARRAYS_EQUAL(*expected, *result);
+
+  // Only null indices can select from an empty array
+  indices = _MakeArray<Int32Type, int32_t>(int32(), {5, 5}, {false, false});
+  ASSERT_OK(Take(&this->ctx_, *values->Slice(0, 0), *indices, &result));
+  ASSERT_EQ(2, result->length());
+  ASSERT_EQ(2, result->null_count());
+}
+
+TEST_F(TestTake, Types) {
+  CheckTakeAndFilter(MakeRandomArray<NullArray>(kLength));
+  CheckTakeAndFilter(MakeRandomArray<Int8Array>(kLength, 30));
+  CheckTakeAndFilter(MakeRandomArray<Int64Array>(kLength, 30));
+  CheckTakeAndFilter(MakeRandomArray<DoubleArray>(kLength, 0));
+  CheckTakeAndFilter(MakeRandomArray<FixedSizeBinaryArray>(kLength, 20));
+
+  std::vector<bool> is_valid;
+  std::vector<bool> bools;
+  test::random_is_valid(kLength, 0.2, &is_valid);
+  test::random_is_valid(kLength, 0.5, &bools);
+  std::shared_ptr<Array> array;
+  ArrayFromVector<BooleanType, bool>(is_valid, bools, &array);
+  CheckTakeAndFilter(array);
+
+  std::vector<std::string> strings;
+  for (int64_t i = 0; i < kLength; ++i) {
+    strings.push_back(
+        std::string(static_cast<size_t>(i % 5), static_cast<char>('a' + i % 26)));
+  }
+  ArrayFromVector<StringType, std::string>(is_valid, strings, &array);
+  CheckTakeAndFilter(array);
+}
+
+TEST_F(TestTake, NestedTypes) {
+  ListBuilder builder(pool_, std::make_shared<Int16Builder>(pool_));
+  auto value_builder = static_cast<Int16Builder*>(builder.value_builder());
+  for (int64_t i = 0; i < kLength; ++i) {
+    if (i % 9 == 0) {
+      ASSERT_OK(builder.AppendNull());
+      continue;
+    }
+    ASSERT_OK(builder.Append());
+    for (int64_t j = 0; j < i % 4; ++j) {
+      ASSERT_OK(value_builder->Append(static_cast<int16_t>(i * j)));
+    }
+  }
+  std::shared_ptr<Array> list_array;
+  ASSERT_OK(builder.Finish(&list_array));
+  CheckTakeAndFilter(list_array);
+
+  auto type = struct_({field("ints", int32()), field("lists", list_array->type())});
+  auto ints = MakeRandomArray<Int32Array>(kLength, 10);
+  auto struct_array =
+      std::make_shared<StructArray>(type, kLength, ArrayVector{ints, list_array},
+                                    MakeRandomNullBitmap(kLength, 5), 5);
+  CheckTakeAndFilter(struct_array);
+
+  std::shared_ptr<Array> dict;
+  ArrayFromVector<StringType, std::string>({"foo", "bar", "baz"}, &dict);
+  std::vector<bool> is_valid;
+  test::random_is_valid(kLength, 0.1, &is_valid);
+  std::vector<int8_t> indices;
+  for (int64_t i = 0; i < kLength; ++i) {
+    indices.push_back(static_cast<int8_t>(i % 3));
+  }
+  std::shared_ptr<Array> index_array;
+  ArrayFromVector<Int8Type, int8_t>(is_valid, indices, &index_array);
+  CheckTakeAndFilter(std::make_shared<DictionaryArray>(dictionary(int8(), dict),
+                                                       index_array));
+}
+
+TEST_F(TestTake, LargeAndFixedSizeTypes) {
+  std::vector<bool> is_valid;
+  test::random_is_valid(kLength, 0.2, &is_valid);
+  std::vector<std::string> strings;
+  for (int64_t i = 0; i < kLength; ++i) {
+    strings.push_back(
+        std::string(static_cast<size_t>(i % 5), static_cast<char>('a' + i % 26)));
+  }
+  std::shared_ptr<Array> array, large_array;
+  ArrayFromVector<StringType, std::string>(is_valid, strings, &array);
+  ASSERT_OK(Cast(&this->ctx_, *array, large_utf8(), CastOptions(), &large_array));
+  CheckTakeAndFilter(large_array);
+
+  LargeListBuilder builder(pool_, std::make_shared<Int16Builder>(pool_));
+  auto value_builder = static_cast<Int16Builder*>(builder.value_builder());
+  for (int64_t i = 0; i < kLength; ++i) {
+    if (i % 9 == 0) {
+      ASSERT_OK(builder.AppendNull());
+      continue;
+    }
+    ASSERT_OK(builder.Append());
+    for (int64_t j = 0; j < i % 4; ++j) {
+      ASSERT_OK(value_builder->Append(static_cast<int16_t>(i * j)));
+    }
+  }
+  ASSERT_OK(builder.Finish(&large_array));
+  CheckTakeAndFilter(large_array);
+
+  auto values = MakeRandomArray<Int32Array>(kLength * 3, 10);
+  auto type = fixed_size_list(int32(), 3);
+  CheckTakeAndFilter(std::make_shared<FixedSizeListArray>(
+      type, kLength, values, MakeRandomNullBitmap(kLength, 5), 5));
+}
+
+TEST_F(TestTake, Union) {
+  for (auto mode : {UnionMode::DENSE, UnionMode::SPARSE}) {
+    shared_ptr<Array> values, expected, result;
+    MakeUnionOfValues(mode, {1, 2, -1, 4, 5, 6, 7}, &values);
+    auto indices = _MakeArray<Int32Type, int32_t>(int32(), {6, 0, 2, 0, 3, 1, 5},
+                                                  {true, true, true, true, false, true,
+                                                   true});
+    MakeUnionOfValues(mode, {7, 1, -1, 1, -1, 2, 6}, &expected);
+    ASSERT_OK(Take(&this->ctx_, *values, *indices, &result));
+    ASSERT_OK(ValidateArray(*result));
+    ASSERT_ARRAYS_EQUAL(*expected, *result);
+    ASSERT_EQ(2, result->null_count());
+
+    // From a slice
+    indices = _MakeArray<Int32Type, int32_t>(int32(), {3, 0, 1}, {});
+    MakeUnionOfValues(mode, {7, 4, 5}, &expected);
+    ASSERT_OK(Take(&this->ctx_, *values->Slice(3), *indices, &result));
+    ASSERT_ARRAYS_EQUAL(*expected, *result);
+
+    // Only null indices can select from an empty array
+    indices = _MakeArray<Int32Type, int32_t>(int32(), {0, 0}, {false, false});
+    ASSERT_OK(Take(&this->ctx_, *values->Slice(0, 0), *indices, &result));
+    ASSERT_OK(ValidateArray(*result));
+    ASSERT_EQ(2, result->null_count());
+  }
+}
+
+TEST_F(TestTake, RunLengthEncoded) {
+  std::vector<bool> is_valid;
+  std::vector<int32_t> ints;
+  std::vector<std::string> strings;
+  for (int64_t i = 0; i < kLength; ++i) {
+    // Runs of varying length, some of them null
+    const int64_t run = static_cast<int64_t>(std::sqrt(static_cast<double>(i * 3)));
+    is_valid.push_back(run % 5 != 1);
+    ints.push_back(static_cast<int32_t>(run % 4));
+    strings.push_back(std::string(static_cast<size_t>(run % 3), 'x'));
+  }
+  std::shared_ptr<Array> plain, encoded;
+  ArrayFromVector<Int32Type, int32_t>(is_valid, ints, &plain);
+  ASSERT_OK(Cast(&this->ctx_, *plain, run_length_encoded(int32()), CastOptions(),
+                 &encoded));
+  CheckTakeAndFilter(encoded);
+
+  ArrayFromVector<StringType, std::string>(is_valid, strings, &plain);
+  ASSERT_OK(Cast(&this->ctx_, *plain, run_length_encoded(utf8()), CastOptions(),
+                 &encoded));
+  CheckTakeAndFilter(encoded);
+
+  // Null indices give runs of nulls
+  auto indices = _MakeArray<Int32Type, int32_t>(int32(), {0, 0, 1, 0}, {true, true,
+                                                                        false, false});
+  std::shared_ptr<Array> result;
+  ASSERT_OK(Take(&this->ctx_, *encoded, *indices, &result));
+  ASSERT_OK(ValidateArray(*result));
+  ASSERT_EQ(2, checked_cast<const RunLengthEncodedArray&>(*result).num_runs());
+}
+
+TEST_F(TestTake, ChainedFilters) {
+  auto values = MakeRandomArray<Int32Array>(kLength, 10);
+  std::vector<bool> first_values;
+  std::vector<bool> second_values;
+  test::random_is_valid(kLength, 0.5, &first_values);
+  std::shared_ptr<Array> first_mask;
+  ArrayFromVector<BooleanType, bool>(first_values, &first_mask);
+
+  std::shared_ptr<Array> selection;
+  ASSERT_OK(Filter(&this->ctx_, *values, *first_mask,
+                   FilterOptions(FilterOptions::SELECTION_VECTOR), &selection));
+  test::random_is_valid(selection->length(), 0.3, &second_values);
+  std::shared_ptr<Array> second_mask;
+  ArrayFromVector<BooleanType, bool>(second_values, &second_mask);
+  ASSERT_OK(Filter(&this->ctx_, *selection, *second_mask, FilterOptions(), &selection));
+  std::shared_ptr<Array> result;
+  ASSERT_OK(Take(&this->ctx_, *values, *selection, &result));
+
+  std::shared_ptr<Array> filtered;
+  ASSERT_OK(Filter(&this->ctx_, *values, *first_mask, FilterOptions(), &filtered));
+  std::shared_ptr<Array> expected;
+  ASSERT_OK(Filter(&this->ctx_, *filtered, *second_mask, FilterOptions(), &expected));
+  ASSERT_ARRAYS_EQUAL(*expected, *result);
+}
+
+TEST_F(TestTake, Invalid) {
+  auto values = _MakeArray<Int32Type, int32_t>(int32(), {1, 2, 3}, {});
+  std::shared_ptr<Array> result;
+
+  auto indices = _MakeArray<Int32Type, int32_t>(int32(), {0, 3}, {});
+  ASSERT_RAISES(Invalid, Take(&this->ctx_, *values, *indices, &result));
+  indices = _MakeArray<Int32Type, int32_t>(int32(), {-1}, {});
+  ASSERT_RAISES(Invalid, Take(&this->ctx_, *values, *indices, &result));
+  auto huge = _MakeArray<UInt64Type, uint64_t>(
+      uint64(), {std::numeric_limits<uint64_t>::max()}, {});
+  ASSERT_RAISES(Invalid, Take(&this->ctx_, *values, *huge, &result));
+  auto doubles = _MakeArray<DoubleType, double>(float64(), {0.0}, {});
+  ASSERT_RAISES(Invalid, Take(&this->ctx_, *values, *doubles, &result));
+
+  auto mask = _MakeArray<BooleanType, bool>(boolean(), {true, false}, {});
+  ASSERT_RAISES(Invalid, Filter(&this->ctx_, *values, *mask, FilterOptions(), &result));
+  ASSERT_RAISES(Invalid,
+                Filter(&this->ctx_, *values, *values, FilterOptions(), &result));
+}
+
+// ----------------------------------------------------------------------
+// Sort tests
+
+// Check that indices is the stable permutation sorting values in ascending
+// order, nulls last, given a less-than comparison of valid values
+template <typename Less>
+void CheckSortIndices(const Array& values, const Array& indices, Less&& less) {
+  std::vector<uint64_t> expected(static_cast<size_t>(values.length()));
+  std::iota(expected.begin(), expected.end(), 0);
+  std::stable_sort(expected.begin(), expected.end(), [&](uint64_t left, uint64_t right) {
+    if (values.IsNull(left) || values.IsNull(right)) {
+      return values.IsValid(left) && values.IsNull(right);
+    }
+    return less(left, right);
+  });
+  std::shared_ptr<Array> expected_indices;
+  ArrayFromVector<UInt64Type, uint64_t>(expected, &expected_indices);
+  ASSERT_ARRAYS_EQUAL(*expected_indices, indices);
+}
+
+template <typename Type>
+class TestSortIndices : public ComputeFixture, public TestBase {
+ protected:
+  using T = typename Type::c_type;
+
+  // Random values across the whole range of the type, many of them repeated
+  vector<T> MakeValues(int64_t length) {
+    std::mt19937_64 gen(42);
+    vector<T> values;
+    for (int64_t i = 0; i < length; ++i) {
+      const uint64_t bits = gen();
+      if (i % 3 == 0) {
+        values.push_back(static_cast<T>(bits % 7));
+      } else if (std::is_floating_point<T>::value) {
+        values.push_back(static_cast<T>(static_cast<int64_t>(bits)) / 1000);
+      } else {
+        values.push_back(static_cast<T>(bits));
+      }
+    }
+    if (std::is_floating_point<T>::value) {
+      values[1] = std::numeric_limits<T>::quiet_NaN();
+      values[2] = -std::numeric_limits<T>::infinity();
+      values[4] = std::numeric_limits<T>::infinity();
+      values[5] = -std::numeric_limits<T>::quiet_NaN();
+      values[7] = static_cast<T>(-0.0);
+    }
+    return values;
+  }
+
+  void CheckSort(const std::shared_ptr<Array>& array) {
+    const auto& values = checked_cast<const NumericArray<Type>&>(*array);
+    std::shared_ptr<Array> indices;
+    ASSERT_OK(SortIndices(&this->ctx_, values, &indices));
+    CheckSortIndices(values, *indices, [&values](uint64_t left, uint64_t right) {
+      const T l = values.Value(left);
+      const T r = values.Value(right);
+      // NaNs come last, and zeros of either sign compare equal except that
+      // the radix sort puts negative zeros first
+      if (l != l || r != r) {
+        return l == l;
+      }
+      return l < r || (l == 0 && r == 0 && std::signbit(l) && !std::signbit(r));
+    });
+  }
+};
+
+typedef ::testing::Types<Int8Type, UInt8Type, Int16Type, UInt16Type, Int32Type,
+                         UInt32Type, Int64Type, UInt64Type, FloatType, DoubleType>
+    SortTypes;
+
+TYPED_TEST_CASE(TestSortIndices, SortTypes);
+
+TYPED_TEST(TestSortIndices, Primitive) {
+  using T = typename TypeParam::c_type;
+  const int64_t kLength = 1000;
+  auto values = this->MakeValues(kLength);
+  for (double null_probability : {0.0, 0.2, 1.0}) {
+    vector<bool> is_valid;
+    test::random_is_valid(kLength, null_probability, &is_valid);
+    auto array = _MakeArray<TypeParam, T>(TypeTraits<TypeParam>::type_singleton(),
+                                          values, is_valid);
+    this->CheckSort(array);
+    this->CheckSort(array->Slice(13, 500));
+    this->CheckSort(array->Slice(0, 0));
+  }
+
+  // All values sharing their high bytes
+  vector<T> small_values;
+  for (int64_t i = 0; i < kLength; ++i) {
+    small_values.push_back(static_cast<T>((i * 31) % 17));
+  }
+  this->CheckSort(_MakeArray<TypeParam, T>(TypeTraits<TypeParam>::type_singleton(),
+                                           small_values, {}));
+}
+
+class TestSort : public ComputeFixture, public TestBase {};
+
+TEST_F(TestSort, Temporal) {
+  vector<int64_t> values = {5, -3, 0, 7, -3, 1000000000000LL, -1000000000000LL};
+  vector<bool> is_valid = {true, true, false, true, true, true, true};
+  auto array = _MakeArray<TimestampType, int64_t>(timestamp(TimeUnit::NANO), values,
+                                                  is_valid);
+  std::shared_ptr<Array> indices;
+  ASSERT_OK(SortIndices(&this->ctx_, *array, &indices));
+  auto expected = _MakeArray<UInt64Type, uint64_t>(uint64(), {6, 1, 4, 0, 3, 5, 2}, {});
+  ASSERT_ARRAYS_EQUAL(*expected, *indices);
+
+  vector<int32_t> days = {3, -1, 2};
+  auto dates = _MakeArray<Date32Type, int32_t>(date32(), days, {});
+  ASSERT_OK(SortIndices(&this->ctx_, *dates, &indices));
+  expected = _MakeArray<UInt64Type, uint64_t>(uint64(), {1, 2, 0}, {});
+  ASSERT_ARRAYS_EQUAL(*expected, *indices);
+}
+
+TEST_F(TestSort, Boolean) {
+  vector<bool> values;
+  vector<bool> is_valid;
+  test::random_is_valid(200, 0.5, &values);
+  test::random_is_valid(200, 0.1, &is_valid);
+  std::shared_ptr<Array> array;
+  ArrayFromVector<BooleanType, bool>(is_valid, values, &array);
+  array = array->Slice(3);
+  const auto& booleans = checked_cast<const BooleanArray&>(*array);
+
+  std::shared_ptr<Array> indices;
+  ASSERT_OK(SortIndices(&this->ctx_, booleans, &indices));
+  CheckSortIndices(booleans, *indices, [&booleans](uint64_t left, uint64_t right) {
+    return !booleans.Value(left) && booleans.Value(right);
+  });
+}
+
+TEST_F(TestSort, Binary) {
+  vector<std::string> values;
+  for (int64_t i = 0; i < 300; ++i) {
+    values.push_back(std::string(static_cast<size_t>((i * 7) % 5),
+                                 static_cast<char>('a' + (i * 13) % 3)));
+  }
+  values[10] = std::string("ab\0c", 4);
+  values[11] = std::string("ab\0", 3);
+  vector<bool> is_valid;
+  test::random_is_valid(300, 0.1, &is_valid);
+  auto array = _MakeArray<StringType, std::string>(utf8(), values, is_valid)->Slice(2);
+  const auto& strings = checked_cast<const StringArray&>(*array);
+
+  std::shared_ptr<Array> indices;
+  ASSERT_OK(SortIndices(&this->ctx_, strings, &indices));
+  CheckSortIndices(strings, *indices, [&strings](uint64_t left, uint64_t right) {
+    return strings.GetString(left) < strings.GetString(right);
+  });
+
+  auto fixed = MakeRandomArray<FixedSizeBinaryArray>(100, 10);
+  const auto& fixed_values = checked_cast<const FixedSizeBinaryArray&>(*fixed);
+  ASSERT_OK(SortIndices(&this->ctx_, fixed_values, &indices));
+  CheckSortIndices(fixed_values, *indices,
+                   [&fixed_values](uint64_t left, uint64_t right) {
+                     return std::memcmp(fixed_values.GetValue(left),
+                                        fixed_values.GetValue(right),
+                                        fixed_values.byte_width()) < 0;
+                   });
+
+  std::shared_ptr<Array> sorted;
+  ASSERT_OK(Sort(&this->ctx_, strings, &sorted));
+  std::shared_ptr<Array> expected;
+  ASSERT_OK(SortIndices(&this->ctx_, strings, &indices));
+  ASSERT_OK(Take(&this->ctx_, strings, *indices, &expected));
+  ASSERT_ARRAYS_EQUAL(*expected, *sorted);
+}
+
+TEST_F(TestSort, ChunkedArray) {
+  vector<int32_t> values;
+  test::randint<int32_t, int32_t>(1000, -50, 50, &values);
+  vector<bool> is_valid;
+  test::random_is_valid(1000, 0.1, &is_valid);
+  auto array = _MakeArray<Int32Type, int32_t>(int32(), values, is_valid);
+
+  std::shared_ptr<Array> expected;
+  ASSERT_OK(SortIndices(&this->ctx_, *array, &expected));
+
+  ArrayVector chunks;
+  int64_t offset = 0;
+  for (int64_t length : {100, 0, 37, 263, 1, 299, 300}) {
+    chunks.push_back(array->Slice(offset, length));
+    offset += length;
+  }
+  ChunkedArray chunked(chunks);
+  for (bool use_threads : {false, true}) {
+    std::shared_ptr<Array> indices;
+    ASSERT_OK(SortIndices(&this->ctx_, chunked, SortOptions(use_threads), &indices));
+    ASSERT_ARRAYS_EQUAL(*expected, *indices);
+  }
+
+  ChunkedArray empty(ArrayVector{}, int32());
+  std::shared_ptr<Array> indices;
+  ASSERT_OK(SortIndices(&this->ctx_, empty, SortOptions(), &indices));
+  ASSERT_EQ(0, indices->length());
+}
+
+TEST_F(TestSort, NotImplemented) {
+  std::shared_ptr<Array> array;
+  ListBuilder builder(pool_, std::make_shared<Int32Builder>(pool_));
+  ASSERT_OK(builder.AppendNull());
+  ASSERT_OK(builder.Finish(&array));
+  std::shared_ptr<Array> indices;
+  ASSERT_RAISES(NotImplemented, SortIndices(&this->ctx_, *array, &indices));
+}
+
+// ----------------------------------------------------------------------
+// Elementwise arithmetic and comparison tests
+
+template <typename Type>
+class TestElementwiseKernel : public ComputeFixture, public TestBase {
+ protected:
+  using T = typename Type::c_type;
+
+  void SetUp() override {
+    const int64_t length = 300;
+    vector<T> left_values;
+    vector<T> right_values;
+    for (int64_t i = 0; i < length; ++i) {
+      left_values.push_back(static_cast<T>((i * 7) % 23 + 1));
+      right_values.push_back(static_cast<T>((i * 5) % 19 + 1));
+    }
+    vector<bool> left_valid;
+    vector<bool> right_valid;
+    test::random_is_valid(length, 0.1, &left_valid);
+    test::random_is_valid(length, 0.3, &right_valid);
+    left_ = _MakeArray<Type, T>(type(), left_values, left_valid)->Slice(3);
+    right_ = _MakeArray<Type, T>(type(), right_values, right_valid)->Slice(1, 297);
+  }
+
+  std::shared_ptr<DataType> type() const {
+    return TypeTraits<Type>::type_singleton();
+  }
+
+  const NumericArray<Type>& left() const {
+    return checked_cast<const NumericArray<Type>&>(*left_);
+  }
+
+  const NumericArray<Type>& right() const {
+    return checked_cast<const NumericArray<Type>&>(*right_);
+  }
+
+  // Check an arithmetic operation on arrays and broadcast scalars against
+  // applying func to each pair of values
+  template <typename Function>
+  void CheckArithmetic(ArithmeticOp::type op, Function&& func) {
+    const T scalar_value = right().Value(0);
+    auto scalar = std::make_shared<NumericScalar<Type>>(type(), scalar_value);
+    for (int kind = 0; kind < 3; ++kind) {
+      Datum left_operand = kind == 2 ? Datum(scalar) : Datum(left_);
+      Datum right_operand = kind == 1 ? Datum(scalar) : Datum(right_);
+      Datum out;
+      ASSERT_OK(Arithmetic(&this->ctx_, op, left_operand, right_operand, &out));
+      auto result = MakeArray(out.array());
+      ASSERT_OK(ValidateArray(*result));
+
+      NumericBuilder<Type> builder;
+      for (int64_t i = 0; i < result->length(); ++i) {
+        const bool left_valid = kind == 2 || left().IsValid(i);
+        const bool right_valid = kind == 1 || right().IsValid(i);
+        if (left_valid && right_valid) {
+          const T l = kind == 2 ? scalar_value : left().Value(i);
+          const T r = kind == 1 ? scalar_value : right().Value(i);
+          ASSERT_OK(builder.Append(func(l, r)));
+        } else {
+          ASSERT_OK(builder.AppendNull());
+        }
+      }
+      std::shared_ptr<Array> expected;
+      ASSERT_OK(builder.Finish(&expected));
+      ASSERT_ARRAYS_EQUAL(*expected, *result);
+    }
+  }
+
+  template <typename Function>
+  void CheckCompare(CompareOp::type op, Function&& func) {
+    Datum out;
+    ASSERT_OK(Compare(&this->ctx_, op, Datum(left_), Datum(right_), &out));
+    auto result = MakeArray(out.array());
+    ASSERT_OK(ValidateArray(*result));
+    BooleanBuilder builder;
+    for (int64_t i = 0; i < result->length(); ++i) {
+      if (left().IsValid(i) && right().IsValid(i)) {
+        ASSERT_OK(builder.Append(func(left().Value(i), right().Value(i))));
+      } else {
+        ASSERT_OK(builder.AppendNull());
+      }
+    }
+    std::shared_ptr<Array> expected;
+    ASSERT_OK(builder.Finish(&expected));
+    ASSERT_ARRAYS_EQUAL(*expected, *result);
+  }
+
+  std::shared_ptr<Array> left_;
+  std::shared_ptr<Array> right_;
+};
+
+TYPED_TEST_CASE(TestElementwiseKernel, AggregateTypes);
+
+TYPED_TEST(TestElementwiseKernel, Arithmetic) {
+  using T = typename TypeParam::c_type;
+  this->CheckArithmetic(ArithmeticOp::ADD,
+                        [](T l, T r) { return static_cast<T>(l + r); });
+  this->CheckArithmetic(ArithmeticOp::SUBTRACT,
+                        [](T l, T r) { return static_cast<T>(l - r); });
+  this->CheckArithmetic(ArithmeticOp::MULTIPLY,
+                        [](T l, T r) { return static_cast<T>(l * r); });
+  this->CheckArithmetic(ArithmeticOp::DIVIDE,
+                        [](T l, T r) { return static_cast<T>(l / r); });
+}
+
+TYPED_TEST(TestElementwiseKernel, Compare) {
+  using T = typename TypeParam::c_type;
+  this->CheckCompare(CompareOp::EQUAL, [](T l, T r) { return l == r; });
+  this->CheckCompare(CompareOp::NOT_EQUAL, [](T l, T r) { return l != r; });
+  this->CheckCompare(CompareOp::LESS, [](T l, T r) { return l < r; });
+  this->CheckCompare(CompareOp::LESS_EQUAL, [](T l, T r) { return l <= r; });
+  this->CheckCompare(CompareOp::GREATER, [](T l, T r) { return l > r; });
+  this->CheckCompare(CompareOp::GREATER_EQUAL, [](T l, T r) { return l >= r; });
+}
+
+class TestElementwise : public ComputeFixture, public TestBase {};
+
+TEST_F(TestElementwise, ScalarBroadcast) {
+  auto values = _MakeArray<DoubleType, double>(float64(), {1.5, 3.0, -2.0, 0.0},
+                                               {true, true, false, true});
+  auto threshold = std::make_shared<NumericScalar<DoubleType>>(float64(), 1.0);
+  Datum out;
+  ASSERT_OK(Compare(&this->ctx_, CompareOp::GREATER, Datum(values), Datum(threshold),
+                    &out));
+  auto expected = _MakeArray<BooleanType, bool>(boolean(), {true, true, false, false},
+                                                {true, true, false, true});
+  ASSERT_ARRAYS_EQUAL(*expected, *MakeArray(out.array()));
+
+  // a * b + c
+  Datum product;
+  ASSERT_OK(Multiply(&this->ctx_, Datum(values), Datum(values), &product));
+  ASSERT_OK(Add(&this->ctx_, product, Datum(threshold), &out));
+  expected = _MakeArray<DoubleType, double>(float64(), {3.25, 10.0, 0.0, 1.0},
+                                            {true, true, false, true});
+  ASSERT_ARRAYS_EQUAL(*expected, *MakeArray(out.array()));
+
+  // A null scalar makes every value null
+  auto null_scalar = std::make_shared<NumericScalar<DoubleType>>(float64(), 0.0, false);
+  ASSERT_OK(Subtract(&this->ctx_, Datum(null_scalar), Datum(values), &out));
+  ASSERT_EQ(4, out.array()->null_count);
+}
+
+TEST_F(TestElementwise, CompareDictionary) {
+  auto dict = _MakeArray<DoubleType, double>(float64(), {0.5, 2.0, 1.0}, {});
+  auto indices = _MakeArray<Int32Type, int32_t>(int32(), {1, 0, 2, 2, 1, 0},
+                                                {true, true, false, true, true, true});
+  auto values = std::make_shared<DictionaryArray>(dictionary(int32(), dict), indices);
+  auto threshold = std::make_shared<NumericScalar<DoubleType>>(float64(), 1.0);
+
+  Datum out;
+  ASSERT_OK(Compare(&this->ctx_, CompareOp::GREATER_EQUAL, Datum(values),
+                    Datum(threshold), &out));
+  auto expected = _MakeArray<BooleanType, bool>(
+      boolean(), {true, false, false, true, true, false},
+      {true, true, false, true, true, true});
+  ASSERT_ARRAYS_EQUAL(*expected, *MakeArray(out.array()));
+
+  ASSERT_OK(
+      Compare(&this->ctx_, CompareOp::LESS, Datum(threshold), Datum(values), &out));
+  expected = _MakeArray<BooleanType, bool>(boolean(),
+                                           {true, false, false, false, true, false},
+                                           {true, true, false, true, true, true});
+  ASSERT_ARRAYS_EQUAL(*expected, *MakeArray(out.array()));
+
+  ASSERT_RAISES(NotImplemented, Compare(&this->ctx_, CompareOp::EQUAL, Datum(values),
+                                        Datum(values), &out));
+  auto int_scalar = std::make_shared<NumericScalar<Int32Type>>(int32(), 1);
+  ASSERT_RAISES(Invalid, Compare(&this->ctx_, CompareOp::EQUAL, Datum(values),
+                                 Datum(int_scalar), &out));
+}
+
+TEST_F(TestElementwise, CompareRunLengthEncoded) {
+  auto plain = _MakeArray<DoubleType, double>(float64(), {0.5, 0.5, 2.0, 1.0, 1.0, 1.0},
+                                              {true, true, false, true, true, true});
+  shared_ptr<Array> values;
+  ASSERT_OK(Cast(&this->ctx_, *plain, run_length_encoded(float64()), CastOptions(),
+                 &values));
+  auto threshold = std::make_shared<NumericScalar<DoubleType>>(float64(), 1.0);
+
+  for (int64_t offset : {0, 1}) {
+    Datum out, expected;
+    ASSERT_OK(Compare(&this->ctx_, CompareOp::GREATER_EQUAL, Datum(values->Slice(offset)),
+                      Datum(threshold), &out));
+    ASSERT_TRUE(out.type()->Equals(run_length_encoded(boolean())));
+    ASSERT_OK(Compare(&this->ctx_, CompareOp::GREATER_EQUAL, Datum(plain->Slice(offset)),
+                      Datum(threshold), &expected));
+    shared_ptr<Array> decoded;
+    ASSERT_OK(Cast(&this->ctx_, *MakeArray(out.array()), boolean(), CastOptions(),
+                   &decoded));
+    ASSERT_ARRAYS_EQUAL(*MakeArray(expected.array()), *decoded);
+  }
+
+  Datum out;
+  ASSERT_RAISES(NotImplemented, Compare(&this->ctx_, CompareOp::EQUAL, Datum(values),
+                                        Datum(values), &out));
+}
+
+TEST_F(TestElementwise, IntegerEdgeCases) {
+  const int32_t kMin = std::numeric_limits<int32_t>::min();
+  const int32_t kMax = std::numeric_limits<int32_t>::max();
+  auto left = _MakeArray<Int32Type, int32_t>(int32(), {kMax, kMin, 7, 5}, {});
+  auto right = _MakeArray<Int32Type, int32_t>(int32(), {1, -1, -2, 0},
+                                              {true, true, true, false});
+  Datum out;
+  ASSERT_OK(Add(&this->ctx_, Datum(left), Datum(right), &out));
+  auto expected = _MakeArray<Int32Type, int32_t>(int32(), {kMin, kMax, 5, 0},
+                                                 {true, true, true, false});
+  ASSERT_ARRAYS_EQUAL(*expected, *MakeArray(out.array()));
+
+  // The zero divisor is at a null position
+  ASSERT_OK(Divide(&this->ctx_, Datum(left), Datum(right), &out));
+  expected = _MakeArray<Int32Type, int32_t>(int32(), {kMax, kMin, -3, 0},
+                                            {true, true, true, false});
+  ASSERT_ARRAYS_EQUAL(*expected, *MakeArray(out.array()));
+
+  auto zeros = _MakeArray<Int32Type, int32_t>(int32(), {1, 1, 0, 1}, {});
+  ASSERT_RAISES(Invalid, Divide(&this->ctx_, Datum(left), Datum(zeros), &out));
+  auto zero = std::make_shared<NumericScalar<Int32Type>>(int32(), 0);
+  ASSERT_RAISES(Invalid, Divide(&this->ctx_, Datum(left), Datum(zero), &out));
+
+  auto bytes = _MakeArray<UInt16Type, uint16_t>(uint16(), {65535, 300}, {});
+  ASSERT_OK(Multiply(&this->ctx_, Datum(bytes), Datum(bytes), &out));
+  auto expected_bytes = _MakeArray<UInt16Type, uint16_t>(
+      uint16(), {1, static_cast<uint16_t>(300 * 300)}, {});
+  ASSERT_ARRAYS_EQUAL(*expected_bytes, *MakeArray(out.array()));
+}
+
+TEST_F(TestElementwise, Invalid) {
+  auto ints = _MakeArray<Int32Type, int32_t>(int32(), {1, 2}, {});
+  auto longs = _MakeArray<Int64Type, int64_t>(int64(), {1, 2}, {});
+  auto short_ints = _MakeArray<Int32Type, int32_t>(int32(), {1}, {});
+  auto scalar = std::make_shared<NumericScalar<Int32Type>>(int32(), 1);
+  Datum out;
+  ASSERT_RAISES(Invalid, Add(&this->ctx_, Datum(ints), Datum(longs), &out));
+  ASSERT_RAISES(Invalid, Add(&this->ctx_, Datum(ints), Datum(short_ints), &out));
+  ASSERT_RAISES(Invalid, Add(&this->ctx_, Datum(scalar), Datum(scalar), &out));
+  ASSERT_RAISES(Invalid, Add(&this->ctx_, Datum(), Datum(ints), &out));
+
+  auto chunked = std::make_shared<ChunkedArray>(ArrayVector{ints});
+  ASSERT_RAISES(NotImplemented, Add(&this->ctx_, Datum(chunked), Datum(ints), &out));
+  auto strings = _MakeArray<StringType, std::string>(utf8(), {"a"}, {});
+  ASSERT_RAISES(NotImplemented, Compare(&this->ctx_, CompareOp::EQUAL, Datum(strings),
+                                        Datum(strings), &out));
+}
+
+TEST_F(TestElementwise, Decimals) {
+  // 1.5, -0.5, 99.9 and 0.25, 1.00, -0.01, at 64 bits
+  auto left = _MakeArray<Decimal128Type, Decimal128>(decimal(3, 1), {15, -5, 999, 1},
+                                                     {true, true, true, false});
+  auto right =
+      _MakeArray<Decimal128Type, Decimal128>(decimal(3, 2), {25, 100, -1, 1}, {});
+  Datum out;
+  ASSERT_OK(Add(&this->ctx_, Datum(left), Datum(right), &out));
+  auto expected = _MakeArray<Decimal128Type, Decimal128>(
+      decimal(5, 2), {175, 50, 9989, 0}, {true, true, true, false});
+  ASSERT_ARRAYS_EQUAL(*expected, *MakeArray(out.array()));
+
+  ASSERT_OK(Subtract(&this->ctx_, Datum(right), Datum(left), &out));
+  expected = _MakeArray<Decimal128Type, Decimal128>(decimal(5, 2), {-125, 150, -9991, 0},
+                                                    {true, true, true, false});
+  ASSERT_ARRAYS_EQUAL(*expected, *MakeArray(out.array()));
+
+  ASSERT_OK(Multiply(&this->ctx_, Datum(left), Datum(right), &out));
+  expected = _MakeArray<Decimal128Type, Decimal128>(decimal(6, 3), {375, -500, -999, 0},
+                                                    {true, true, true, false});
+  ASSERT_ARRAYS_EQUAL(*expected, *MakeArray(out.array()));
+
+  auto scalar = std::make_shared<Decimal128Scalar>(decimal(2, 1), Decimal128(-20));
+  ASSERT_OK(Multiply(&this->ctx_, Datum(scalar), Datum(left), &out));
+  expected = _MakeArray<Decimal128Type, Decimal128>(decimal(5, 2), {-300, 100, -19980, 0},
+                                                    {true, true, true, false});
+  ASSERT_ARRAYS_EQUAL(*expected, *MakeArray(out.array()));
+
+  // At 128 bits, and sliced
+  const Decimal128 big("12345678901234567890");
+  auto wide_left = _MakeArray<Decimal128Type, Decimal128>(
+      decimal(20, 2), {big, -big, 1}, {true, true, true});
+  auto wide_right = _MakeArray<Decimal128Type, Decimal128>(decimal(20, 0), {big, 3, -big},
+                                                           {true, false, true});
+  ASSERT_OK(Add(&this->ctx_, Datum(wide_left), Datum(wide_right), &out));
+  expected = _MakeArray<Decimal128Type, Decimal128>(
+      decimal(23, 2), {big + big * 100, 0, 1 - big * 100}, {true, false, true});
+  ASSERT_ARRAYS_EQUAL(*expected, *MakeArray(out.array()));
+
+  ASSERT_OK(Multiply(&this->ctx_, Datum(wide_left->Slice(1)),
+                     Datum(wide_right->Slice(1)), &out));
+  expected = _MakeArray<Decimal128Type, Decimal128>(decimal(38, 2), {0, -big},
+                                                    {false, true});
+  ASSERT_ARRAYS_EQUAL(*expected, *MakeArray(out.array()));
+
+  auto ints = _MakeArray<Int32Type, int32_t>(int32(), {1, 2, 3, 4}, {});
+  ASSERT_RAISES(Invalid, Add(&this->ctx_, Datum(left), Datum(ints), &out));
+  ASSERT_RAISES(Invalid, Add(&this->ctx_, Datum(left), Datum(wide_left), &out));
+  ASSERT_RAISES(NotImplemented, Divide(&this->ctx_, Datum(left), Datum(right), &out));
+  auto fine = _MakeArray<Decimal128Type, Decimal128>(decimal(38, 20), {1}, {});
+  ASSERT_RAISES(Invalid, Multiply(&this->ctx_, Datum(fine), Datum(fine), &out));
+}
+
+// The results must not depend on the instruction set the loops are compiled for
+TEST_F(TestElementwise, SimdLevels) {
+  const int64_t length = 1000;
+  vector<int32_t> int_values;
+  vector<double> double_values;
+  for (int64_t i = 0; i < length; ++i) {
+    int_values.push_back(static_cast<int32_t>(i * 2654435761U));
+    double_values.push_back(static_cast<double>(i % 101) / 8 - 6);
+  }
+  vector<bool> valid;
+  test::random_is_valid(length, 0.1, &valid);
+  const auto ints = _MakeArray<Int32Type, int32_t>(int32(), int_values, valid)->Slice(3);
+  const auto doubles = _MakeArray<DoubleType, double>(float64(), double_values, valid);
+  const auto int_scalar = std::make_shared<NumericScalar<Int32Type>>(int32(), -7);
+
+  KernelRegistry* registry = KernelRegistry::GetInstance();
+  const SimdLevel::type detected = registry->simd_level();
+
+  Datum expected_ints, expected_doubles, out;
+  ASSERT_OK(Multiply(&this->ctx_, Datum(ints), Datum(int_scalar), &expected_ints));
+  ASSERT_OK(
+      Divide(&this->ctx_, Datum(doubles), Datum(doubles->Slice(0)), &expected_doubles));
+  for (auto level : {SimdLevel::NONE, SimdLevel::SSE4_2, SimdLevel::AVX2}) {
+    registry->set_max_simd_level(level);
+    ASSERT_LE(registry->simd_level(), level);
+    ASSERT_OK(Multiply(&this->ctx_, Datum(ints), Datum(int_scalar), &out));
+    ASSERT_ARRAYS_EQUAL(*MakeArray(expected_ints.array()), *MakeArray(out.array()));
+    ASSERT_OK(Divide(&this->ctx_, Datum(doubles), Datum(doubles->Slice(0)), &out));
+    ASSERT_ARRAYS_EQUAL(*MakeArray(expected_doubles.array()), *MakeArray(out.array()));
+  }
+  registry->set_max_simd_level(SimdLevel::AVX512);
+  ASSERT_EQ(detected, registry->simd_level());
+}
+
+namespace {
+
+int BaselineFunction(int x) { return x; }
+
+int WideFunction(int x) { return -x; }
+
+double OtherSignature(double x) { return x; }
+
+}  // namespace
+
+TEST(KernelRegistry, RegisterAndGet) {
+  KernelRegistry* registry = KernelRegistry::GetInstance();
+  const SimdLevel::type detected = registry->simd_level();
+
+  int (*function)(int) = nullptr;
+  ASSERT_RAISES(KeyError, registry->Get("test_identity", &function));
+
+  ASSERT_OK(registry->Register("test_identity", SimdLevel::NONE, &BaselineFunction));
+  ASSERT_RAISES(Invalid,
+                registry->Register("test_identity", SimdLevel::NONE, &WideFunction));
+  ASSERT_RAISES(Invalid,
+                registry->Register("test_identity", SimdLevel::AVX2, &OtherSignature));
+  ASSERT_OK(registry->Register("test_identity", SimdLevel::AVX2, &WideFunction));
+
+  double (*other)(double) = nullptr;
+  ASSERT_RAISES(Invalid, registry->Get("test_identity", &other));
+
+  // The most capable implementation the CPU supports is chosen
+  ASSERT_OK(registry->Get("test_identity", &function));
+  ASSERT_EQ(detected >= SimdLevel::AVX2 ? -1 : 1, function(1));
+
+  registry->set_max_simd_level(SimdLevel::SSE4_2);
+  ASSERT_OK(registry->Get("test_identity", &function));
+  ASSERT_EQ(1, function(1));
+  registry->set_max_simd_level(SimdLevel::AVX512);
+
+  // Without a baseline implementation
+  ASSERT_OK(registry->Register("test_wide_only", SimdLevel::AVX512, &WideFunction));
+  registry->set_max_simd_level(SimdLevel::NONE);
+  ASSERT_RAISES(Invalid, registry->Get("test_wide_only", &function));
+  registry->set_max_simd_level(SimdLevel::AVX512);
+}
+
+class TestExpression : public ComputeFixture, public TestBase {
+ protected:
+  void SetUp() override {
+    // Not a multiple of the chunk size, and columns at different offsets
+    const int64_t length = 5000;
+    vector<double> a_values, b_values;
+    vector<int32_t> c_values;
+    vector<bool> flag_values;
+    for (int64_t i = 0; i < length + 7; ++i) {
+      a_values.push_back(static_cast<double>(i % 17) / 4 - 2);
+      b_values.push_back(static_cast<double>(i % 13) / 2);
+      c_values.push_back(static_cast<int32_t>(i % 11) - 5);
+      flag_values.push_back(i % 3 == 0);
+    }
+    vector<bool> a_valid, c_valid;
+    test::random_is_valid(length + 7, 0.1, &a_valid);
+    test::random_is_valid(length + 7, 0.2, &c_valid);
+    a_ = _MakeArray<DoubleType, double>(float64(), a_values, a_valid)->Slice(7);
+    b_ = _MakeArray<DoubleType, double>(float64(), b_values, {})->Slice(0, length);
+    c_ = _MakeArray<Int32Type, int32_t>(int32(), c_values, c_valid)->Slice(3, length);
+    flag_ = _MakeArray<BooleanType, bool>(boolean(), flag_values, {})->Slice(5, length);
+    schema_ = ::arrow::schema({field("a", float64()), field("b", float64()),
+                               field("c", int32()), field("flag", boolean())});
+    batch_ = RecordBatch::Make(schema_, length, {a_, b_, c_, flag_});
+  }
+
+  std::shared_ptr<Array> Unfused(ArithmeticOp::type op,
+                                 const std::shared_ptr<Array>& left, const Datum& right) {
+    Datum out;
+    ABORT_NOT_OK(Arithmetic(&this->ctx_, op, Datum(left), right, &out));
+    return MakeArray(out.array());
+  }
+
+  void CheckEvaluate(const std::shared_ptr<Expression>& expr, const Array& expected) {
+    std::shared_ptr<Array> result;
+    ASSERT_OK(Evaluate(&this->ctx_, expr, *batch_, &result));
+    ASSERT_OK(ValidateArray(*result));
+    ASSERT_ARRAYS_EQUAL(expected, *result);
+  }
+
+  std::shared_ptr<Array> a_, b_, c_, flag_;
+  std::shared_ptr<Schema> schema_;
+  std::shared_ptr<RecordBatch> batch_;
+};
+
+TEST_F(TestExpression, FusedArithmetic) {
+  auto a = Expression::Field("a");
+  auto b = Expression::Field("b");
+  auto c = Expression::Cast(Expression::Field("c"), float64());
+  auto half = std::make_shared<NumericScalar<DoubleType>>(float64(), 0.5);
+
+  // (cast(c) * a + b) > 0.5
+  auto sum = Expression::Arithmetic(
+      ArithmeticOp::ADD, Expression::Arithmetic(ArithmeticOp::MULTIPLY, c, a), b);
+  auto expr = Expression::Compare(CompareOp::GREATER, sum, Expression::Literal(half));
+  ASSERT_EQ("(((cast(c, double) * a) + b) > 0.5)", expr->ToString());
+
+  std::shared_ptr<Array> c_double;
+  ASSERT_OK(Cast(&this->ctx_, *c_, float64(), CastOptions(), &c_double));
+  auto expected_sum =
+      Unfused(ArithmeticOp::ADD, Unfused(ArithmeticOp::MULTIPLY, c_double, Datum(a_)),
+              Datum(b_));
+  CheckEvaluate(sum, *expected_sum);
+
+  Datum expected;
+  ASSERT_OK(Compare(&this->ctx_, CompareOp::GREATER, Datum(expected_sum), Datum(half),
+                    &expected));
+  CheckEvaluate(expr, *MakeArray(expected.array()));
+
+  // The same evaluator serves batches of the same schema
+  std::unique_ptr<ExpressionEvaluator> evaluator;
+  ASSERT_OK(ExpressionEvaluator::Make(&this->ctx_, expr, schema_, &evaluator));
+  ASSERT_TRUE(evaluator->type()->Equals(boolean()));
+  std::shared_ptr<Array> result;
+  for (int64_t length : {0, 1, 64, 2048, 2049}) {
+    auto slice = batch_->Slice(100, length);
+    ASSERT_OK(evaluator->Evaluate(*slice, &result));
+    ASSERT_ARRAYS_EQUAL(*MakeArray(expected.array())->Slice(100, length), *result);
+  }
+}
+
+TEST_F(TestExpression, BooleansAndCasts) {
+  // flag == (a < b)
+  auto less = Expression::Compare(CompareOp::LESS, Expression::Field("a"),
+                                  Expression::Field("b"));
+  auto expr = Expression::Compare(CompareOp::EQUAL, Expression::Field("flag"), less);
+  std::shared_ptr<Array> result;
+  ASSERT_OK(Evaluate(&this->ctx_, expr, *batch_, &result));
+  ASSERT_OK(ValidateArray(*result));
+
+  const auto& a = checked_cast<const DoubleArray&>(*a_);
+  const auto& b = checked_cast<const DoubleArray&>(*b_);
+  const auto& flag = checked_cast<const BooleanArray&>(*flag_);
+  BooleanBuilder builder;
+  for (int64_t i = 0; i < batch_->num_rows(); ++i) {
+    if (a.IsValid(i)) {
+      ASSERT_OK(builder.Append(flag.Value(i) == (a.Value(i) < b.Value(i))));
+    } else {
+      ASSERT_OK(builder.AppendNull());
+    }
+  }
+  std::shared_ptr<Array> expected;
+  ASSERT_OK(builder.Finish(&expected));
+  ASSERT_ARRAYS_EQUAL(*expected, *result);
+
+  // Casts truncate and wrap around as static_cast does, without nulls the
+  // result has no validity bitmap
+  auto narrow = Expression::Cast(
+      Expression::Cast(Expression::Field("b"), int64()), int8());
+  auto widened = Expression::Cast(Expression::Field("flag"), int8());
+  ASSERT_OK(Evaluate(&this->ctx_,
+                     Expression::Arithmetic(ArithmeticOp::SUBTRACT, narrow, widened),
+                     *batch_, &result));
+  ASSERT_EQ(0, result->null_count());
+  ASSERT_EQ(nullptr, result->null_bitmap());
+  Int8Builder int8_builder;
+  for (int64_t i = 0; i < batch_->num_rows(); ++i) {
+    ASSERT_OK(int8_builder.Append(static_cast<int8_t>(
+        static_cast<int8_t>(static_cast<int64_t>(b.Value(i))) - flag.Value(i))));
+  }
+  ASSERT_OK(int8_builder.Finish(&expected));
+  ASSERT_ARRAYS_EQUAL(*expected, *result);
+}
+
+TEST_F(TestExpression, Nulls) {
+  auto null_scalar = std::make_shared<NumericScalar<DoubleType>>(float64(), 0.0, false);
+  auto expr = Expression::Arithmetic(ArithmeticOp::ADD, Expression::Field("b"),
+                                     Expression::Literal(null_scalar));
+  std::shared_ptr<Array> result;
+  ASSERT_OK(Evaluate(&this->ctx_, expr, *batch_, &result));
+  ASSERT_EQ(batch_->num_rows(), result->null_count());
+  ASSERT_EQ("(b + null)", expr->ToString());
+
+  // The zero divisors at null rows are ignored
+  auto ints = _MakeArray<Int32Type, int32_t>(int32(), {6, 7, 8}, {});
+  auto divisors =
+      _MakeArray<Int32Type, int32_t>(int32(), {2, 0, -4}, {true, false, true});
+  auto batch = RecordBatch::Make(
+      ::arrow::schema({field("x", int32()), field("y", int32())}), 3, {ints, divisors});
+  expr = Expression::Arithmetic(ArithmeticOp::DIVIDE, Expression::Field("x"),
+                                Expression::Field("y"));
+  ASSERT_OK(Evaluate(&this->ctx_, expr, *batch, &result));
+  auto expected =
+      _MakeArray<Int32Type, int32_t>(int32(), {3, 0, -2}, {true, false, true});
+  ASSERT_ARRAYS_EQUAL(*expected, *result);
+
+  auto zeros = _MakeArray<Int32Type, int32_t>(int32(), {2, 0, -4}, {});
+  batch = RecordBatch::Make(batch->schema(), 3, {ints, zeros});
+  ASSERT_RAISES(Invalid, Evaluate(&this->ctx_, expr, *batch, &result));
+}
+
+TEST_F(TestExpression, Invalid) {
+  std::unique_ptr<ExpressionEvaluator> evaluator;
+  auto a = Expression::Field("a");
+  auto c = Expression::Field("c");
+  ASSERT_RAISES(Invalid, ExpressionEvaluator::Make(&this->ctx_, Expression::Field("d"),
+                                                   schema_, &evaluator));
+  ASSERT_RAISES(Invalid,
+                ExpressionEvaluator::Make(
+                    &this->ctx_, Expression::Arithmetic(ArithmeticOp::ADD, a, c),
+                    schema_, &evaluator));
+  ASSERT_RAISES(Invalid, ExpressionEvaluator::Make(&this->ctx_, nullptr, schema_,
+                                                   &evaluator));
+  auto flag = Expression::Field("flag");
+  ASSERT_RAISES(NotImplemented,
+                ExpressionEvaluator::Make(
+                    &this->ctx_, Expression::Arithmetic(ArithmeticOp::ADD, flag, flag),
+                    schema_, &evaluator));
+  ASSERT_RAISES(NotImplemented,
+                ExpressionEvaluator::Make(&this->ctx_, Expression::Cast(a, utf8()),
+                                          schema_, &evaluator));
+
+  auto strings = _MakeArray<StringType, std::string>(utf8(), {"a"}, {});
+  auto batch = RecordBatch::Make(::arrow::schema({field("s", utf8())}), 1, {strings});
+  std::shared_ptr<Array> result;
+  ASSERT_RAISES(NotImplemented,
+                Evaluate(&this->ctx_, Expression::Field("s"), *batch, &result));
+
+  ASSERT_OK(ExpressionEvaluator::Make(&this->ctx_, a, schema_, &evaluator));
+  ASSERT_RAISES(Invalid, evaluator->Evaluate(*batch, &result));
+}
+
+TEST_F(TestExpression, Equals) {
+  auto one = std::make_shared<NumericScalar<DoubleType>>(float64(), 1.0);
+  auto other_one = std::make_shared<NumericScalar<DoubleType>>(float64(), 1.0);
+  auto zero = std::make_shared<NumericScalar<DoubleType>>(float64(), 0.0);
+  auto negative_zero = std::make_shared<NumericScalar<DoubleType>>(float64(), -0.0);
+  auto make = [](const std::shared_ptr<Scalar>& value) {
+    return Expression::Arithmetic(ArithmeticOp::ADD, Expression::Field("a"),
+                                  Expression::Literal(value));
+  };
+  ASSERT_TRUE(make(one)->Equals(*make(other_one)));
+  ASSERT_FALSE(make(one)->Equals(*make(zero)));
+  ASSERT_FALSE(make(zero)->Equals(*make(negative_zero)));
+  ASSERT_FALSE(make(one)->Equals(*Expression::Arithmetic(
+      ArithmeticOp::SUBTRACT, Expression::Field("a"), Expression::Literal(one))));
+  ASSERT_FALSE(Expression::Field("a")->Equals(*Expression::Field("b")));
+  ASSERT_FALSE(Expression::Cast(Expression::Field("a"), int32())
+                   ->Equals(*Expression::Cast(Expression::Field("a"), int64())));
+}
+
+TEST_F(TestExpression, EvaluatorCache) {
+  ExpressionEvaluatorCache cache(&this->ctx_);
+  auto make = [](double threshold) {
+    auto value = std::make_shared<NumericScalar<DoubleType>>(float64(), threshold);
+    return Expression::Compare(CompareOp::LESS, Expression::Field("a"),
+                               Expression::Literal(value));
+  };
+  std::shared_ptr<Array> expected;
+  ASSERT_OK(Evaluate(&this->ctx_, make(1.0), *batch_, &expected));
+
+  // Equal expressions share an evaluator, whatever the nulls of the batches
+  std::shared_ptr<Array> result;
+  for (int64_t offset : {0, 10, 2000}) {
+    auto slice = batch_->Slice(offset, 1000);
+    ASSERT_OK(cache.Evaluate(make(1.0), *slice, &result));
+    ASSERT_ARRAYS_EQUAL(*expected->Slice(offset, 1000), *result);
+  }
+  ASSERT_EQ(1, cache.size());
+
+  auto no_nulls = RecordBatch::Make(::arrow::schema({field("a", float64())}),
+                                    b_->length(), {b_});
+  ASSERT_OK(cache.Evaluate(make(1.0), *no_nulls, &result));
+  ASSERT_EQ(nullptr, result->null_bitmap());
+  ASSERT_OK(cache.Evaluate(make(2.0), *batch_, &result));
+  ASSERT_EQ(3, cache.size());
+
+  // Failing to make an evaluator doesn't add an entry
+  ASSERT_RAISES(Invalid, cache.Evaluate(Expression::Field("d"), *batch_, &result));
+  ASSERT_EQ(3, cache.size());
+
+  // Concurrent evaluations use evaluators of their own
+  const int num_tasks = 8;
+  std::vector<std::shared_ptr<Array>> results(num_tasks);
+  ASSERT_OK(ParallelFor(num_tasks, [&](int i) {
+    return cache.Evaluate(make(1.0), *batch_, &results[i]);
+  }));
+  for (const auto& task_result : results) {
+    ASSERT_ARRAYS_EQUAL(*expected, *task_result);
+  }
+  ASSERT_EQ(3, cache.size());
+}
+
 }  // namespace compute
 }  // namespace arrow
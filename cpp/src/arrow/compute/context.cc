@@ -25,7 +25,7 @@
 namespace arrow {
 namespace compute {
 
-FunctionContext::FunctionContext(MemoryPool* pool) : pool_(pool) {
+FunctionContext::FunctionContext(MemoryPool* pool) : pool_(pool), use_threads_(false) {
   if (!::arrow::CpuInfo::initialized()) {
     ::arrow::CpuInfo::Init();
   }
@@ -60,9 +60,17 @@ class ARROW_EXPORT FunctionContext {
   /// \brief Return the current status of the context
   const Status& status() const { return status_; }
 
+  /// \brief Whether kernels may split their work over the chunks of their
+  /// input across the CPU thread pool, false by default
+  bool use_threads() const { return use_threads_; }
+
+  /// \brief Allow or disallow kernels to run on the CPU thread pool
+  void set_use_threads(bool use_threads) { use_threads_ = use_threads; }
+
  private:
   Status status_;
   MemoryPool* pool_;
+  bool use_threads_;
 };
 
 }  // namespace compute
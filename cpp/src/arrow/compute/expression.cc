@@ -0,0 +1,1048 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/expression.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/arithmetic-internal.h"
+#include "arrow/compute/kernels/util-internal.h"
+#include "arrow/record_batch.h"
+#include "arrow/type.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/util/checked_cast.h"
+
+namespace arrow {
+namespace compute {
+
+// ----------------------------------------------------------------------
+// Expression
+
+Expression::Expression(kind expression_kind)
+    : kind_(expression_kind),
+      arithmetic_op_(ArithmeticOp::ADD),
+      compare_op_(CompareOp::EQUAL) {}
+
+std::shared_ptr<Expression> Expression::Field(const std::string& name) {
+  std::shared_ptr<Expression> expr(new Expression(FIELD));
+  expr->name_ = name;
+  return expr;
+}
+
+std::shared_ptr<Expression> Expression::Literal(const std::shared_ptr<Scalar>& value) {
+  std::shared_ptr<Expression> expr(new Expression(LITERAL));
+  expr->value_ = value;
+  return expr;
+}
+
+std::shared_ptr<Expression> Expression::Cast(const std::shared_ptr<Expression>& operand,
+                                             const std::shared_ptr<DataType>& to_type) {
+  std::shared_ptr<Expression> expr(new Expression(CAST));
+  expr->to_type_ = to_type;
+  expr->operands_ = {operand};
+  return expr;
+}
+
+std::shared_ptr<Expression> Expression::Arithmetic(
+    ArithmeticOp::type op, const std::shared_ptr<Expression>& left,
+    const std::shared_ptr<Expression>& right) {
+  std::shared_ptr<Expression> expr(new Expression(ARITHMETIC));
+  expr->arithmetic_op_ = op;
+  expr->operands_ = {left, right};
+  return expr;
+}
+
+std::shared_ptr<Expression> Expression::Compare(
+    CompareOp::type op, const std::shared_ptr<Expression>& left,
+    const std::shared_ptr<Expression>& right) {
+  std::shared_ptr<Expression> expr(new Expression(COMPARE));
+  expr->compare_op_ = op;
+  expr->operands_ = {left, right};
+  return expr;
+}
+
+namespace {
+
+#define NUMERIC_TYPE_CASES(CASE) \
+  CASE(UInt8Type);               \
+  CASE(Int8Type);                \
+  CASE(UInt16Type);              \
+  CASE(Int16Type);               \
+  CASE(UInt32Type);              \
+  CASE(Int32Type);               \
+  CASE(UInt64Type);              \
+  CASE(Int64Type);               \
+  CASE(FloatType);               \
+  CASE(DoubleType)
+
+// Widen the one byte integers so that they print as numbers
+template <typename T>
+auto Printable(T value) -> decltype(+value) {
+  return +value;
+}
+
+void PrintLiteral(const Scalar& value, std::ostream* os) {
+  if (value.type == nullptr) {
+    *os << "<untyped literal>";
+    return;
+  }
+  if (!value.is_valid) {
+    *os << "null";
+    return;
+  }
+
+#define PRINT_CASE(InType)                                                     \
+  case InType::type_id:                                                        \
+    *os << Printable(checked_cast<const NumericScalar<InType>&>(value).value); \
+    return
+
+  switch (value.type->id()) {
+    NUMERIC_TYPE_CASES(PRINT_CASE);
+    default:
+      break;
+  }
+
+#undef PRINT_CASE
+
+  *os << "<" << value.type->ToString() << " literal>";
+}
+
+bool LiteralEquals(const Scalar& left, const Scalar& right) {
+  if (left.type == nullptr || right.type == nullptr) {
+    return left.type == right.type;
+  }
+  if (!left.type->Equals(*right.type) || left.is_valid != right.is_valid) {
+    return false;
+  }
+  if (!left.is_valid) {
+    return true;
+  }
+
+  // Bitwise, so that 0.0 and -0.0 differ but a NaN equals itself
+#define EQUALS_CASE(InType)                                                         \
+  case InType::type_id: {                                                           \
+    const auto& left_value = checked_cast<const NumericScalar<InType>&>(left).value; \
+    const auto& right_value = checked_cast<const NumericScalar<InType>&>(right).value; \
+    return std::memcmp(&left_value, &right_value, sizeof(left_value)) == 0;          \
+  }
+
+  switch (left.type->id()) {
+    NUMERIC_TYPE_CASES(EQUALS_CASE);
+    default:
+      break;
+  }
+
+#undef EQUALS_CASE
+
+  // Literals of other types can't be evaluated, their only use is in errors
+  return &left == &right;
+}
+
+const char* ArithmeticSymbol(ArithmeticOp::type op) {
+  switch (op) {
+    case ArithmeticOp::ADD:
+      return "+";
+    case ArithmeticOp::SUBTRACT:
+      return "-";
+    case ArithmeticOp::MULTIPLY:
+      return "*";
+    case ArithmeticOp::DIVIDE:
+      return "/";
+  }
+  return "?";
+}
+
+const char* CompareSymbol(CompareOp::type op) {
+  switch (op) {
+    case CompareOp::EQUAL:
+      return "==";
+    case CompareOp::NOT_EQUAL:
+      return "!=";
+    case CompareOp::LESS:
+      return "<";
+    case CompareOp::LESS_EQUAL:
+      return "<=";
+    case CompareOp::GREATER:
+      return ">";
+    case CompareOp::GREATER_EQUAL:
+      return ">=";
+  }
+  return "?";
+}
+
+void PrintExpression(const Expression& expr, std::ostream* os) {
+  const auto& operands = expr.operands();
+  switch (expr.expression_kind()) {
+    case Expression::FIELD:
+      *os << expr.name();
+      return;
+    case Expression::LITERAL:
+      if (expr.value() == nullptr) {
+        *os << "<null literal>";
+      } else {
+        PrintLiteral(*expr.value(), os);
+      }
+      return;
+    case Expression::CAST:
+      *os << "cast(";
+      PrintExpression(*operands[0], os);
+      *os << ", " << expr.to_type()->ToString() << ")";
+      return;
+    case Expression::ARITHMETIC:
+    case Expression::COMPARE:
+      *os << "(";
+      PrintExpression(*operands[0], os);
+      *os << " "
+          << (expr.expression_kind() == Expression::ARITHMETIC
+                  ? ArithmeticSymbol(expr.arithmetic_op())
+                  : CompareSymbol(expr.compare_op()))
+          << " ";
+      PrintExpression(*operands[1], os);
+      *os << ")";
+      return;
+  }
+}
+
+}  // namespace
+
+std::string Expression::ToString() const {
+  std::stringstream ss;
+  PrintExpression(*this, &ss);
+  return ss.str();
+}
+
+bool Expression::Equals(const Expression& other) const {
+  if (this == &other) {
+    return true;
+  }
+  if (kind_ != other.kind_ || operands_.size() != other.operands_.size()) {
+    return false;
+  }
+  switch (kind_) {
+    case FIELD:
+      return name_ == other.name_;
+    case LITERAL:
+      if (value_ == nullptr || other.value_ == nullptr) {
+        return value_ == other.value_;
+      }
+      return LiteralEquals(*value_, *other.value_);
+    case CAST:
+      if (to_type_ == nullptr || other.to_type_ == nullptr) {
+        if (to_type_ != other.to_type_) {
+          return false;
+        }
+      } else if (!to_type_->Equals(*other.to_type_)) {
+        return false;
+      }
+      break;
+    case ARITHMETIC:
+      if (arithmetic_op_ != other.arithmetic_op_) {
+        return false;
+      }
+      break;
+    case COMPARE:
+      if (compare_op_ != other.compare_op_) {
+        return false;
+      }
+      break;
+  }
+  for (size_t i = 0; i < operands_.size(); ++i) {
+    const auto& operand = operands_[i];
+    const auto& other_operand = other.operands_[i];
+    if (operand == nullptr || other_operand == nullptr) {
+      if (operand != other_operand) {
+        return false;
+      }
+    } else if (!operand->Equals(*other_operand)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// ----------------------------------------------------------------------
+// Evaluation
+//
+// The expression is turned into a tree of nodes of the same shape, each of
+// which evaluates its operation over one chunk of rows at a time into scratch
+// buffers of kChunkSize values it owns. Column values are used in place.
+// Booleans are evaluated as one byte per row, and packed into a bitmap when
+// they are the result.
+
+namespace {
+
+constexpr int64_t kChunkSize = ExpressionEvaluator::kChunkSize;
+constexpr int64_t kChunkWords = kChunkSize / 64;
+
+static_assert(kChunkSize % 64 == 0, "chunks must consist of whole validity words");
+
+// The C type the values of an Arrow type are evaluated as
+template <typename Type>
+struct ValueType {
+  using type = typename Type::c_type;
+};
+
+template <>
+struct ValueType<BooleanType> {
+  using type = bool;
+};
+
+class Node {
+ public:
+  explicit Node(const std::shared_ptr<DataType>& type) : type_(type) {}
+
+  virtual ~Node() = default;
+
+  const std::shared_ptr<DataType>& type() const { return type_; }
+
+  // Use the columns of a batch for the field references of the tree. Return
+  // false if none of the rows of the batch can be null, in which case the
+  // validity is never looked at.
+  virtual bool Bind(const RecordBatch& batch) = 0;
+
+  // Evaluate the rows [offset, offset + length) of the bound batch, length
+  // being at most kChunkSize
+  virtual Status Evaluate(int64_t offset, int64_t length) = 0;
+
+  // Write the values last evaluated to the values buffer of an array of the
+  // type of the node, starting at position out_offset
+  virtual void CopyValues(int64_t length, uint8_t* out, int64_t out_offset) const = 0;
+
+  // One bit per row last evaluated telling whether it is valid, the bits past
+  // the length being zero, or nullptr if all the rows are valid
+  const uint64_t* validity() const { return validity_; }
+
+ protected:
+  std::shared_ptr<DataType> type_;
+  const uint64_t* validity_ = nullptr;
+};
+
+template <typename T>
+class TypedNode : public Node {
+ public:
+  explicit TypedNode(const std::shared_ptr<DataType>& type) : Node(type) {}
+
+  // The values last evaluated, meaningless at null rows
+  const T* values() const { return values_; }
+
+  void CopyValues(int64_t length, uint8_t* out, int64_t out_offset) const override {
+    if (std::is_same<T, bool>::value) {
+      PackBytesToBitmap(reinterpret_cast<const uint8_t*>(values_), length, out,
+                        out_offset);
+    } else {
+      std::memcpy(out + out_offset * sizeof(T), values_, length * sizeof(T));
+    }
+  }
+
+ protected:
+  const T* values_ = nullptr;
+};
+
+// The validity of the rows [offset, offset + length) of a column, or nullptr
+// if it has no nulls
+const uint64_t* LoadValidity(const ArrayData& data, int64_t offset, int64_t length,
+                             uint64_t* words) {
+  if (data.null_count == 0 || data.buffers[0] == nullptr) {
+    return nullptr;
+  }
+  const uint8_t* bitmap = data.buffers[0]->data();
+  for (int64_t i = 0; i < length; i += 64) {
+    words[i / 64] = LoadBitmapBlock(bitmap, data.offset + offset + i,
+                                    std::min<int64_t>(64, length - i));
+  }
+  return words;
+}
+
+// The validity of rows valid in both operands
+const uint64_t* CombineValidity(const uint64_t* left, const uint64_t* right,
+                                int64_t length, uint64_t* words) {
+  if (left == nullptr) {
+    return right;
+  }
+  if (right == nullptr) {
+    return left;
+  }
+  for (int64_t i = 0; i < (length + 63) / 64; ++i) {
+    words[i] = left[i] & right[i];
+  }
+  return words;
+}
+
+template <typename Type>
+class FieldNode : public TypedNode<typename ValueType<Type>::type> {
+ public:
+  FieldNode(const std::shared_ptr<DataType>& type, int index)
+      : TypedNode<typename ValueType<Type>::type>(type), index_(index) {}
+
+  bool Bind(const RecordBatch& batch) override {
+    data_ = batch.column_data(index_);
+    return data_->null_count != 0;
+  }
+
+  Status Evaluate(int64_t offset, int64_t length) override {
+    this->values_ = GetValues<typename Type::c_type>(*data_, 1) + offset;
+    this->validity_ = LoadValidity(*data_, offset, length, validity_words_);
+    return Status::OK();
+  }
+
+ private:
+  int index_;
+  std::shared_ptr<ArrayData> data_;
+  uint64_t validity_words_[kChunkWords];
+};
+
+// Boolean columns are unpacked into one byte per row
+template <>
+class FieldNode<BooleanType> : public TypedNode<bool> {
+ public:
+  FieldNode(const std::shared_ptr<DataType>& type, int index)
+      : TypedNode<bool>(type), index_(index), scratch_(new bool[kChunkSize]) {}
+
+  bool Bind(const RecordBatch& batch) override {
+    data_ = batch.column_data(index_);
+    return data_->null_count != 0;
+  }
+
+  Status Evaluate(int64_t offset, int64_t length) override {
+    internal::BitmapReader reader(data_->buffers[1]->data(), data_->offset + offset,
+                                  length);
+    for (int64_t i = 0; i < length; ++i) {
+      scratch_[i] = reader.IsSet();
+      reader.Next();
+    }
+    values_ = scratch_.get();
+    validity_ = LoadValidity(*data_, offset, length, validity_words_);
+    return Status::OK();
+  }
+
+ private:
+  int index_;
+  std::shared_ptr<ArrayData> data_;
+  std::unique_ptr<bool[]> scratch_;
+  uint64_t validity_words_[kChunkWords];
+};
+
+// A literal is broadcast to a full chunk once and for all
+template <typename Type>
+class LiteralNode : public TypedNode<typename Type::c_type> {
+ public:
+  using T = typename Type::c_type;
+
+  explicit LiteralNode(const NumericScalar<Type>& value)
+      : TypedNode<T>(value.type), scratch_(kChunkSize, value.value) {
+    this->values_ = scratch_.data();
+    if (!value.is_valid) {
+      std::memset(validity_words_, 0, sizeof(validity_words_));
+      this->validity_ = validity_words_;
+    }
+  }
+
+  bool Bind(const RecordBatch& batch) override { return this->validity_ != nullptr; }
+
+  Status Evaluate(int64_t offset, int64_t length) override { return Status::OK(); }
+
+ private:
+  std::vector<T> scratch_;
+  uint64_t validity_words_[kChunkWords];
+};
+
+template <typename InType, typename OutType>
+class CastNode : public TypedNode<typename ValueType<OutType>::type> {
+ public:
+  using In = typename ValueType<InType>::type;
+  using Out = typename ValueType<OutType>::type;
+
+  CastNode(const std::shared_ptr<DataType>& type, std::unique_ptr<Node> operand)
+      : TypedNode<Out>(type),
+        input_(checked_cast<TypedNode<In>*>(operand.get())),
+        operand_(std::move(operand)),
+        scratch_(new Out[kChunkSize]) {
+    this->values_ = scratch_.get();
+  }
+
+  bool Bind(const RecordBatch& batch) override { return operand_->Bind(batch); }
+
+  Status Evaluate(int64_t offset, int64_t length) override {
+    RETURN_NOT_OK(operand_->Evaluate(offset, length));
+    const In* in = input_->values();
+    Out* out = scratch_.get();
+    for (int64_t i = 0; i < length; ++i) {
+      out[i] = static_cast<Out>(in[i]);
+    }
+    this->validity_ = operand_->validity();
+    return Status::OK();
+  }
+
+ private:
+  const TypedNode<In>* input_;
+  std::unique_ptr<Node> operand_;
+  std::unique_ptr<Out[]> scratch_;
+};
+
+// The operations of two operands of the same type, Derived providing
+// Status Compute(const T* left, const T* right, int64_t length, Out* out)
+template <typename Derived, typename T, typename Out>
+class BinaryNode : public TypedNode<Out> {
+ public:
+  BinaryNode(const std::shared_ptr<DataType>& type, std::unique_ptr<Node> left,
+             std::unique_ptr<Node> right)
+      : TypedNode<Out>(type),
+        left_input_(checked_cast<TypedNode<T>*>(left.get())),
+        right_input_(checked_cast<TypedNode<T>*>(right.get())),
+        left_(std::move(left)),
+        right_(std::move(right)),
+        scratch_(new Out[kChunkSize]) {
+    this->values_ = scratch_.get();
+  }
+
+  bool Bind(const RecordBatch& batch) override {
+    const bool left_nulls = left_->Bind(batch);
+    const bool right_nulls = right_->Bind(batch);
+    return left_nulls || right_nulls;
+  }
+
+  Status Evaluate(int64_t offset, int64_t length) override {
+    RETURN_NOT_OK(left_->Evaluate(offset, length));
+    RETURN_NOT_OK(right_->Evaluate(offset, length));
+    this->validity_ =
+        CombineValidity(left_->validity(), right_->validity(), length, validity_words_);
+    return static_cast<Derived*>(this)->Compute(left_input_->values(),
+                                                right_input_->values(), length,
+                                                scratch_.get());
+  }
+
+ protected:
+  const TypedNode<T>* left_input_;
+  const TypedNode<T>* right_input_;
+  std::unique_ptr<Node> left_;
+  std::unique_ptr<Node> right_;
+  std::unique_ptr<Out[]> scratch_;
+  uint64_t validity_words_[kChunkWords];
+};
+
+// Integer division fails on a zero divisor at a valid row
+template <typename Op, typename T>
+typename std::enable_if<std::is_same<Op, DivideOp>::value && std::is_integral<T>::value,
+                        Status>::type
+CheckDivisors(const T* divisors, const uint64_t* validity, int64_t length) {
+  bool any_zero = false;
+  if (validity == nullptr) {
+    // Without branches, so that the loop vectorizes
+    for (int64_t i = 0; i < length; ++i) {
+      any_zero |= divisors[i] == 0;
+    }
+  } else {
+    for (int64_t i = 0; i < length; ++i) {
+      any_zero |= divisors[i] == 0 && ((validity[i / 64] >> (i % 64)) & 1) != 0;
+    }
+  }
+  return any_zero ? Status::Invalid("Integer division by zero") : Status::OK();
+}
+
+template <typename Op, typename T>
+typename std::enable_if<
+    !(std::is_same<Op, DivideOp>::value && std::is_integral<T>::value), Status>::type
+CheckDivisors(const T*, const uint64_t*, int64_t) {
+  return Status::OK();
+}
+
+template <typename Type, typename Op>
+class ArithmeticNode
+    : public BinaryNode<ArithmeticNode<Type, Op>, typename Type::c_type,
+                        typename Type::c_type> {
+ public:
+  using T = typename Type::c_type;
+  using Base = BinaryNode<ArithmeticNode<Type, Op>, T, T>;
+
+  using Base::Base;
+
+  Status Compute(const T* left, const T* right, int64_t length, T* out) {
+    RETURN_NOT_OK((CheckDivisors<Op, T>(right, this->validity_, length)));
+    for (int64_t i = 0; i < length; ++i) {
+      out[i] = Op::Call(left[i], right[i]);
+    }
+    return Status::OK();
+  }
+};
+
+template <typename Type, typename Op>
+class CompareNode
+    : public BinaryNode<CompareNode<Type, Op>, typename ValueType<Type>::type, bool> {
+ public:
+  using T = typename ValueType<Type>::type;
+  using Base = BinaryNode<CompareNode<Type, Op>, T, bool>;
+
+  using Base::Base;
+
+  Status Compute(const T* left, const T* right, int64_t length, bool* out) {
+    for (int64_t i = 0; i < length; ++i) {
+      out[i] = Op::Call(left[i], right[i]);
+    }
+    return Status::OK();
+  }
+};
+
+// ----------------------------------------------------------------------
+// Building the node tree
+
+Status UnsupportedType(const char* what, const DataType& type) {
+  std::stringstream ss;
+  ss << "Expressions don't support " << what << " of type " << type.ToString();
+  return Status::NotImplemented(ss.str());
+}
+
+Status MakeFieldNode(const std::string& name, const Schema& schema,
+                     std::unique_ptr<Node>* out) {
+  const int64_t index = schema.GetFieldIndex(name);
+  if (index < 0) {
+    std::stringstream ss;
+    ss << "No field named '" << name << "' in schema";
+    return Status::Invalid(ss.str());
+  }
+  const auto& type = schema.field(static_cast<int>(index))->type();
+
+#define FIELD_CASE(InType)                                            \
+  case InType::type_id:                                               \
+    out->reset(new FieldNode<InType>(type, static_cast<int>(index))); \
+    return Status::OK()
+
+  switch (type->id()) {
+    FIELD_CASE(BooleanType);
+    NUMERIC_TYPE_CASES(FIELD_CASE);
+    default:
+      break;
+  }
+
+#undef FIELD_CASE
+
+  return UnsupportedType("columns", *type);
+}
+
+Status MakeLiteralNode(const std::shared_ptr<Scalar>& value, std::unique_ptr<Node>* out) {
+  if (value == nullptr || value->type == nullptr) {
+    return Status::Invalid("Literals need a typed value");
+  }
+
+#define LITERAL_CASE(InType)                                                  \
+  case InType::type_id:                                                       \
+    out->reset(                                                               \
+        new LiteralNode<InType>(checked_cast<const NumericScalar<InType>&>(*value))); \
+    return Status::OK()
+
+  switch (value->type->id()) {
+    NUMERIC_TYPE_CASES(LITERAL_CASE);
+    default:
+      break;
+  }
+
+#undef LITERAL_CASE
+
+  return UnsupportedType("literals", *value->type);
+}
+
+template <typename InType>
+Status MakeCastNode(std::unique_ptr<Node> operand,
+                    const std::shared_ptr<DataType>& to_type,
+                    std::unique_ptr<Node>* out) {
+#define CAST_CASE(OutType)                                                        \
+  case OutType::type_id:                                                          \
+    out->reset(new CastNode<InType, OutType>(to_type, std::move(operand))); \
+    return Status::OK()
+
+  switch (to_type->id()) {
+    CAST_CASE(BooleanType);
+    NUMERIC_TYPE_CASES(CAST_CASE);
+    default:
+      break;
+  }
+
+#undef CAST_CASE
+
+  return UnsupportedType("casts to values", *to_type);
+}
+
+Status MakeCastNode(std::unique_ptr<Node> operand,
+                    const std::shared_ptr<DataType>& to_type,
+                    std::unique_ptr<Node>* out) {
+  if (to_type == nullptr) {
+    return Status::Invalid("Casts need a target type");
+  }
+  const std::shared_ptr<DataType> from_type = operand->type();
+
+#define CAST_FROM_CASE(InType)                                       \
+  case InType::type_id:                                              \
+    return MakeCastNode<InType>(std::move(operand), to_type, out)
+
+  switch (from_type->id()) {
+    CAST_FROM_CASE(BooleanType);
+    NUMERIC_TYPE_CASES(CAST_FROM_CASE);
+    default:
+      break;
+  }
+
+#undef CAST_FROM_CASE
+
+  return UnsupportedType("casts from values", *from_type);
+}
+
+Status CheckOperandTypes(const Node& left, const Node& right) {
+  if (!left.type()->Equals(*right.type())) {
+    std::stringstream ss;
+    ss << "Operands of different types " << left.type()->ToString() << " and "
+       << right.type()->ToString() << ", cast one of them";
+    return Status::Invalid(ss.str());
+  }
+  return Status::OK();
+}
+
+template <typename Op>
+Status MakeArithmeticNode(std::unique_ptr<Node> left, std::unique_ptr<Node> right,
+                          std::unique_ptr<Node>* out) {
+  const std::shared_ptr<DataType> type = left->type();
+
+#define ARITHMETIC_CASE(InType)                                                        \
+  case InType::type_id:                                                                \
+    out->reset(new ArithmeticNode<InType, Op>(type, std::move(left), std::move(right))); \
+    return Status::OK()
+
+  switch (type->id()) {
+    NUMERIC_TYPE_CASES(ARITHMETIC_CASE);
+    default:
+      break;
+  }
+
+#undef ARITHMETIC_CASE
+
+  return UnsupportedType("arithmetic on values", *type);
+}
+
+Status MakeArithmeticNode(ArithmeticOp::type op, std::unique_ptr<Node> left,
+                          std::unique_ptr<Node> right, std::unique_ptr<Node>* out) {
+  RETURN_NOT_OK(CheckOperandTypes(*left, *right));
+  switch (op) {
+    case ArithmeticOp::ADD:
+      return MakeArithmeticNode<AddOp>(std::move(left), std::move(right), out);
+    case ArithmeticOp::SUBTRACT:
+      return MakeArithmeticNode<SubtractOp>(std::move(left), std::move(right), out);
+    case ArithmeticOp::MULTIPLY:
+      return MakeArithmeticNode<MultiplyOp>(std::move(left), std::move(right), out);
+    case ArithmeticOp::DIVIDE:
+      return MakeArithmeticNode<DivideOp>(std::move(left), std::move(right), out);
+  }
+  return Status::Invalid("Unknown arithmetic operation");
+}
+
+template <typename Op>
+Status MakeCompareNode(std::unique_ptr<Node> left, std::unique_ptr<Node> right,
+                       std::unique_ptr<Node>* out) {
+  const std::shared_ptr<DataType> type = left->type();
+
+#define COMPARE_CASE(InType)                                                          \
+  case InType::type_id:                                                               \
+    out->reset(                                                                       \
+        new CompareNode<InType, Op>(boolean(), std::move(left), std::move(right))); \
+    return Status::OK()
+
+  switch (type->id()) {
+    COMPARE_CASE(BooleanType);
+    NUMERIC_TYPE_CASES(COMPARE_CASE);
+    default:
+      break;
+  }
+
+#undef COMPARE_CASE
+
+  return UnsupportedType("comparisons of values", *type);
+}
+
+Status MakeCompareNode(CompareOp::type op, std::unique_ptr<Node> left,
+                       std::unique_ptr<Node> right, std::unique_ptr<Node>* out) {
+  RETURN_NOT_OK(CheckOperandTypes(*left, *right));
+  switch (op) {
+    case CompareOp::EQUAL:
+      return MakeCompareNode<EqualOp>(std::move(left), std::move(right), out);
+    case CompareOp::NOT_EQUAL:
+      return MakeCompareNode<NotEqualOp>(std::move(left), std::move(right), out);
+    case CompareOp::LESS:
+      return MakeCompareNode<LessOp>(std::move(left), std::move(right), out);
+    case CompareOp::LESS_EQUAL:
+      return MakeCompareNode<LessEqualOp>(std::move(left), std::move(right), out);
+    case CompareOp::GREATER:
+      return MakeCompareNode<GreaterOp>(std::move(left), std::move(right), out);
+    case CompareOp::GREATER_EQUAL:
+      return MakeCompareNode<GreaterEqualOp>(std::move(left), std::move(right), out);
+  }
+  return Status::Invalid("Unknown comparison");
+}
+
+#undef NUMERIC_TYPE_CASES
+
+Status MakeNode(const std::shared_ptr<Expression>& expr, const Schema& schema,
+                std::unique_ptr<Node>* out) {
+  if (expr == nullptr) {
+    return Status::Invalid("Null expression");
+  }
+  const auto& operands = expr->operands();
+  std::unique_ptr<Node> left, right;
+  switch (expr->expression_kind()) {
+    case Expression::FIELD:
+      return MakeFieldNode(expr->name(), schema, out);
+    case Expression::LITERAL:
+      return MakeLiteralNode(expr->value(), out);
+    case Expression::CAST:
+      RETURN_NOT_OK(MakeNode(operands[0], schema, &left));
+      return MakeCastNode(std::move(left), expr->to_type(), out);
+    case Expression::ARITHMETIC:
+      RETURN_NOT_OK(MakeNode(operands[0], schema, &left));
+      RETURN_NOT_OK(MakeNode(operands[1], schema, &right));
+      return MakeArithmeticNode(expr->arithmetic_op(), std::move(left), std::move(right),
+                                out);
+    case Expression::COMPARE:
+      RETURN_NOT_OK(MakeNode(operands[0], schema, &left));
+      RETURN_NOT_OK(MakeNode(operands[1], schema, &right));
+      return MakeCompareNode(expr->compare_op(), std::move(left), std::move(right), out);
+  }
+  return Status::Invalid("Unknown expression kind");
+}
+
+}  // namespace
+
+// ----------------------------------------------------------------------
+// ExpressionEvaluator
+
+constexpr int64_t ExpressionEvaluator::kChunkSize;
+
+class ExpressionEvaluator::ExpressionEvaluatorImpl {
+ public:
+  ExpressionEvaluatorImpl(FunctionContext* ctx, const std::shared_ptr<Schema>& schema,
+                          std::unique_ptr<Node> root)
+      : ctx_(ctx), schema_(schema), root_(std::move(root)) {}
+
+  std::shared_ptr<DataType> type() const { return root_->type(); }
+
+  Status Evaluate(const RecordBatch& batch, std::shared_ptr<Array>* out) {
+    if (!batch.schema()->Equals(*schema_, /*check_metadata=*/false)) {
+      return Status::Invalid("Batch schema doesn't match the schema of the evaluator");
+    }
+    const int64_t length = batch.num_rows();
+    const auto& type = root_->type();
+
+    const int64_t values_size =
+        type->id() == Type::BOOL
+            ? BitUtil::BytesForBits(length)
+            : length * checked_cast<const FixedWidthType&>(*type).bit_width() / 8;
+    std::shared_ptr<Buffer> values, bitmap;
+    RETURN_NOT_OK(ctx_->Allocate(values_size, &values));
+    uint8_t* values_data = values->mutable_data();
+    if (type->id() == Type::BOOL && values_size > 0) {
+      // Packing leaves the bits past the length as they are
+      values_data[values_size - 1] = 0;
+    }
+
+    // Without nulls in the inputs there is no validity to compute or write
+    const bool may_have_nulls = root_->Bind(batch);
+    uint8_t* bitmap_data = nullptr;
+    if (may_have_nulls) {
+      RETURN_NOT_OK(ctx_->Allocate(BitUtil::BytesForBits(length), &bitmap));
+      bitmap_data = bitmap->mutable_data();
+    }
+
+    int64_t null_count = 0;
+    for (int64_t offset = 0; offset < length; offset += kChunkSize) {
+      const int64_t chunk_length = std::min(kChunkSize, length - offset);
+      RETURN_NOT_OK(root_->Evaluate(offset, chunk_length));
+      root_->CopyValues(chunk_length, values_data, offset);
+      if (may_have_nulls) {
+        null_count += WriteValidity(offset, chunk_length, bitmap_data);
+      }
+    }
+
+    if (null_count == 0) {
+      bitmap = nullptr;
+    }
+    *out = MakeArray(ArrayData::Make(type, length, {bitmap, values}, null_count));
+    return Status::OK();
+  }
+
+ private:
+  // Write the validity of the rows last evaluated to the output bitmap,
+  // returning the number of nulls. Chunks start at whole bytes of the bitmap.
+  int64_t WriteValidity(int64_t offset, int64_t length, uint8_t* bitmap) {
+    const uint64_t* validity = root_->validity();
+    int64_t null_count = 0;
+    for (int64_t i = 0; i < length; i += 64) {
+      const int64_t block_length = std::min<int64_t>(64, length - i);
+      const uint64_t word =
+          validity != nullptr ? validity[i / 64] : AllValid(block_length);
+      null_count += block_length - BitUtil::Popcount(word);
+      const uint64_t little_endian = BitUtil::ToLittleEndian(word);
+      std::memcpy(bitmap + (offset + i) / 8, &little_endian,
+                  BitUtil::BytesForBits(block_length));
+    }
+    return null_count;
+  }
+
+  FunctionContext* ctx_;
+  std::shared_ptr<Schema> schema_;
+  std::unique_ptr<Node> root_;
+};
+
+ExpressionEvaluator::ExpressionEvaluator(std::unique_ptr<ExpressionEvaluatorImpl> impl)
+    : impl_(std::move(impl)) {}
+
+ExpressionEvaluator::~ExpressionEvaluator() {}
+
+Status ExpressionEvaluator::Make(FunctionContext* ctx,
+                                 const std::shared_ptr<Expression>& expression,
+                                 const std::shared_ptr<Schema>& schema,
+                                 std::unique_ptr<ExpressionEvaluator>* out) {
+  std::unique_ptr<Node> root;
+  RETURN_NOT_OK(MakeNode(expression, *schema, &root));
+  std::unique_ptr<ExpressionEvaluatorImpl> impl(
+      new ExpressionEvaluatorImpl(ctx, schema, std::move(root)));
+  out->reset(new ExpressionEvaluator(std::move(impl)));
+  return Status::OK();
+}
+
+std::shared_ptr<DataType> ExpressionEvaluator::type() const { return impl_->type(); }
+
+Status ExpressionEvaluator::Evaluate(const RecordBatch& batch,
+                                     std::shared_ptr<Array>* out) {
+  return impl_->Evaluate(batch, out);
+}
+
+// ----------------------------------------------------------------------
+// ExpressionEvaluatorCache
+
+class ExpressionEvaluatorCache::ExpressionEvaluatorCacheImpl {
+ public:
+  explicit ExpressionEvaluatorCacheImpl(FunctionContext* ctx) : ctx_(ctx) {}
+
+  Status Evaluate(const std::shared_ptr<Expression>& expression,
+                  const RecordBatch& batch, std::shared_ptr<Array>* out) {
+    if (expression == nullptr) {
+      return Status::Invalid("Null expression");
+    }
+    const std::string key = expression->ToString();
+    std::unique_ptr<ExpressionEvaluator> evaluator =
+        Acquire(key, *expression, *batch.schema());
+    if (evaluator == nullptr) {
+      RETURN_NOT_OK(
+          ExpressionEvaluator::Make(ctx_, expression, batch.schema(), &evaluator));
+    }
+    Status status = evaluator->Evaluate(batch, out);
+    Release(key, expression, batch.schema(), std::move(evaluator));
+    return status;
+  }
+
+  int64_t size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return size_;
+  }
+
+ private:
+  struct Entry {
+    std::shared_ptr<Expression> expression;
+    std::shared_ptr<Schema> schema;
+    // The evaluators not in use by any thread
+    std::vector<std::unique_ptr<ExpressionEvaluator>> idle;
+  };
+
+  using Bucket = std::vector<Entry>;
+
+  static Entry* FindEntry(Bucket* bucket, const Expression& expression,
+                          const Schema& schema) {
+    for (auto& entry : *bucket) {
+      if (entry.expression->Equals(expression) &&
+          entry.schema->Equals(schema, /*check_metadata=*/false)) {
+        return &entry;
+      }
+    }
+    return nullptr;
+  }
+
+  // Take an idle evaluator of an expression and schema, if there is one
+  std::unique_ptr<ExpressionEvaluator> Acquire(const std::string& key,
+                                               const Expression& expression,
+                                               const Schema& schema) {
+    std::unique_ptr<ExpressionEvaluator> evaluator;
+    std::lock_guard<std::mutex> lock(mutex_);
+    Entry* entry = FindEntry(&entries_[key], expression, schema);
+    if (entry != nullptr && !entry->idle.empty()) {
+      evaluator = std::move(entry->idle.back());
+      entry->idle.pop_back();
+    }
+    return evaluator;
+  }
+
+  // Give an evaluator back for the following batches
+  void Release(const std::string& key, const std::shared_ptr<Expression>& expression,
+               const std::shared_ptr<Schema>& schema,
+               std::unique_ptr<ExpressionEvaluator> evaluator) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Bucket* bucket = &entries_[key];
+    Entry* entry = FindEntry(bucket, *expression, *schema);
+    if (entry == nullptr) {
+      bucket->push_back(Entry{expression, schema, {}});
+      entry = &bucket->back();
+      ++size_;
+    }
+    entry->idle.push_back(std::move(evaluator));
+  }
+
+  FunctionContext* ctx_;
+  mutable std::mutex mutex_;
+  // Entries by the string form of their expression
+  std::unordered_map<std::string, Bucket> entries_;
+  int64_t size_ = 0;
+};
+
+ExpressionEvaluatorCache::ExpressionEvaluatorCache(FunctionContext* ctx)
+    : impl_(new ExpressionEvaluatorCacheImpl(ctx)) {}
+
+ExpressionEvaluatorCache::~ExpressionEvaluatorCache() {}
+
+Status ExpressionEvaluatorCache::Evaluate(const std::shared_ptr<Expression>& expression,
+                                          const RecordBatch& batch,
+                                          std::shared_ptr<Array>* out) {
+  return impl_->Evaluate(expression, batch, out);
+}
+
+int64_t ExpressionEvaluatorCache::size() const { return impl_->size(); }
+
+Status Evaluate(FunctionContext* ctx, const std::shared_ptr<Expression>& expression,
+                const RecordBatch& batch, std::shared_ptr<Array>* out) {
+  std::unique_ptr<ExpressionEvaluator> evaluator;
+  RETURN_NOT_OK(ExpressionEvaluator::Make(ctx, expression, batch.schema(), &evaluator));
+  return evaluator->Evaluate(batch, out);
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,202 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_COMPUTE_EXPRESSION_H
+#define ARROW_COMPUTE_EXPRESSION_H
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/arithmetic.h"
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Array;
+class DataType;
+class RecordBatch;
+class Schema;
+
+namespace compute {
+
+class FunctionContext;
+
+/// \brief A tree of elementwise operations over the columns of record batches
+///
+/// The leaves are column references and scalar literals, the inner nodes
+/// numeric casts, arithmetic and comparisons. The operands of arithmetic and
+/// comparisons must have the same type, as for the Arithmetic and Compare
+/// kernels; casts make them so. Expressions are immutable and can be shared
+/// between trees.
+class ARROW_EXPORT Expression {
+ public:
+  enum kind { FIELD, LITERAL, CAST, ARITHMETIC, COMPARE };
+
+  /// \brief Reference the column of the given name
+  static std::shared_ptr<Expression> Field(const std::string& name);
+
+  /// \brief A literal value, broadcast to every row
+  static std::shared_ptr<Expression> Literal(const std::shared_ptr<Scalar>& value);
+
+  /// \brief Convert the values of an expression to another numeric type, as
+  /// static_cast does
+  static std::shared_ptr<Expression> Cast(const std::shared_ptr<Expression>& operand,
+                                          const std::shared_ptr<DataType>& to_type);
+
+  static std::shared_ptr<Expression> Arithmetic(ArithmeticOp::type op,
+                                                const std::shared_ptr<Expression>& left,
+                                                const std::shared_ptr<Expression>& right);
+
+  static std::shared_ptr<Expression> Compare(CompareOp::type op,
+                                             const std::shared_ptr<Expression>& left,
+                                             const std::shared_ptr<Expression>& right);
+
+  kind expression_kind() const { return kind_; }
+
+  /// \brief The column name of a field reference
+  const std::string& name() const { return name_; }
+
+  /// \brief The value of a literal
+  const std::shared_ptr<Scalar>& value() const { return value_; }
+
+  /// \brief The target type of a cast
+  const std::shared_ptr<DataType>& to_type() const { return to_type_; }
+
+  ArithmeticOp::type arithmetic_op() const { return arithmetic_op_; }
+
+  CompareOp::type compare_op() const { return compare_op_; }
+
+  /// \brief The operands of a cast, arithmetic or comparison
+  const std::vector<std::shared_ptr<Expression>>& operands() const { return operands_; }
+
+  std::string ToString() const;
+
+  /// \brief Whether two expressions are the same tree, literals being equal
+  /// if they have the same type, validity and bits
+  bool Equals(const Expression& other) const;
+
+ private:
+  explicit Expression(kind expression_kind);
+
+  kind kind_;
+  std::string name_;
+  std::shared_ptr<Scalar> value_;
+  std::shared_ptr<DataType> to_type_;
+  ArithmeticOp::type arithmetic_op_;
+  CompareOp::type compare_op_;
+  std::vector<std::shared_ptr<Expression>> operands_;
+};
+
+/// \brief Evaluate an expression over record batches in a single fused pass
+///
+/// Rather than materializing the result of each operation over the whole
+/// batch, the rows are processed in chunks of kChunkSize: every operation of
+/// the tree is applied to a chunk before moving on to the next one, so that
+/// the intermediate results stay in cache and only the final result is
+/// written out. Columns are read in place. If none of the inputs of a batch
+/// have nulls, the validity of the rows is neither computed nor written.
+///
+/// The result of a row is null if any value it is computed from is null.
+/// Integer arithmetic wraps around on overflow and integer division by zero
+/// fails, as with the Arithmetic kernel. Columns can be of boolean, integer
+/// or floating point type, literals of integer or floating point type;
+/// arithmetic doesn't apply to booleans.
+class ARROW_EXPORT ExpressionEvaluator {
+ public:
+  /// The number of rows evaluated at a time
+  static constexpr int64_t kChunkSize = 2048;
+
+  ~ExpressionEvaluator();
+
+  /// \brief Check the types of an expression and prepare to evaluate it over
+  /// batches of the given schema
+  ///
+  /// \param[in] context the FunctionContext
+  /// \param[in] expression the expression
+  /// \param[in] schema schema of the batches to evaluate the expression over
+  /// \param[out] out the evaluator
+  static Status Make(FunctionContext* context,
+                     const std::shared_ptr<Expression>& expression,
+                     const std::shared_ptr<Schema>& schema,
+                     std::unique_ptr<ExpressionEvaluator>* out);
+
+  /// \brief The type of the results
+  std::shared_ptr<DataType> type() const;
+
+  /// \brief Evaluate the expression over a batch, one result per row
+  ///
+  /// An evaluator is not thread-safe: give each thread its own.
+  Status Evaluate(const RecordBatch& batch, std::shared_ptr<Array>* out);
+
+ private:
+  class ExpressionEvaluatorImpl;
+
+  explicit ExpressionEvaluator(std::unique_ptr<ExpressionEvaluatorImpl> impl);
+
+  std::unique_ptr<ExpressionEvaluatorImpl> impl_;
+};
+
+/// \brief Evaluators kept for reuse across batches
+///
+/// Making an evaluator checks the types of the expression and instantiates
+/// its operations for them; the cache does so once per distinct expression
+/// and schema, and reuses the evaluator for the following batches. What
+/// depends on the batch, whether the validity of the rows needs computing at
+/// all, is decided anew for each one.
+///
+/// The cache can be used from several threads at once, concurrent
+/// evaluations of the same expression using evaluators of their own.
+class ARROW_EXPORT ExpressionEvaluatorCache {
+ public:
+  /// \param[in] context the FunctionContext of the evaluators, which must
+  /// outlive the cache
+  explicit ExpressionEvaluatorCache(FunctionContext* context);
+
+  ~ExpressionEvaluatorCache();
+
+  /// \brief Evaluate an expression over a batch, one result per row
+  Status Evaluate(const std::shared_ptr<Expression>& expression,
+                  const RecordBatch& batch, std::shared_ptr<Array>* out);
+
+  /// \brief The number of distinct expressions and schemas evaluated
+  int64_t size() const;
+
+ private:
+  class ExpressionEvaluatorCacheImpl;
+
+  std::unique_ptr<ExpressionEvaluatorCacheImpl> impl_;
+};
+
+/// \brief Evaluate an expression over a record batch
+///
+/// \param[in] context the FunctionContext
+/// \param[in] expression the expression
+/// \param[in] batch the batch
+/// \param[out] out one result per row of the batch
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Evaluate(FunctionContext* context, const std::shared_ptr<Expression>& expression,
+                const RecordBatch& batch, std::shared_ptr<Array>* out);
+
+}  // namespace compute
+}  // namespace arrow
+
+#endif  // ARROW_COMPUTE_EXPRESSION_H
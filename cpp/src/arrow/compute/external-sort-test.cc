@@ -0,0 +1,193 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "arrow/array.h"
+#include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
+#include "arrow/status.h"
+#include "arrow/table.h"
+#include "arrow/test-common.h"
+#include "arrow/test-util.h"
+#include "arrow/type.h"
+
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/external-sort.h"
+#include "arrow/compute/kernels/sort.h"
+#include "arrow/compute/kernels/take.h"
+
+using std::shared_ptr;
+using std::vector;
+
+namespace arrow {
+namespace compute {
+
+class TestExternalSort : public TestBase {
+ protected:
+  void SetUp() override {
+    TestBase::SetUp();
+    schema_ = ::arrow::schema({field("key", int64()), field("row", int64())});
+  }
+
+  // Batches of keys drawn from a small range so that there are many ties,
+  // with the position of each row in the input as payload
+  void MakeBatches(int num_batches, int64_t batch_length, double null_probability) {
+    std::default_random_engine engine(42);
+    std::uniform_int_distribution<int64_t> keys(0, 99);
+    std::bernoulli_distribution is_null(null_probability);
+    int64_t row = 0;
+    for (int i = 0; i < num_batches; ++i) {
+      vector<int64_t> key_values;
+      vector<bool> key_valid;
+      vector<int64_t> rows;
+      for (int64_t j = 0; j < batch_length; ++j) {
+        key_values.push_back(keys(engine));
+        key_valid.push_back(!is_null(engine));
+        rows.push_back(row++);
+      }
+      shared_ptr<Array> key_array, row_array;
+      ArrayFromVector<Int64Type, int64_t>(int64(), key_valid, key_values, &key_array);
+      ArrayFromVector<Int64Type, int64_t>(rows, &row_array);
+      batches_.push_back(
+          RecordBatch::Make(schema_, batch_length, {key_array, row_array}));
+    }
+  }
+
+  void ExternalSort(const ExternalSortOptions& options, shared_ptr<Table>* out,
+                    int* num_spilled_runs) {
+    FunctionContext ctx(default_memory_pool());
+    std::unique_ptr<ExternalSorter> sorter;
+    ASSERT_OK(ExternalSorter::Make(&ctx, schema_, options, &sorter));
+    for (const auto& batch : batches_) {
+      ASSERT_OK(sorter->Consume(batch));
+    }
+    std::shared_ptr<RecordBatchReader> reader;
+    ASSERT_OK(sorter->Finish(&reader));
+    *num_spilled_runs = sorter->num_spilled_runs();
+
+    vector<shared_ptr<RecordBatch>> sorted;
+    shared_ptr<RecordBatch> batch;
+    while (true) {
+      ASSERT_OK(reader->ReadNext(&batch));
+      if (batch == nullptr) {
+        break;
+      }
+      ASSERT_LE(batch->num_rows(), options.batch_size);
+      sorted.push_back(batch);
+    }
+    reader.reset();
+    ASSERT_OK(Table::FromRecordBatches(schema_, sorted, out));
+  }
+
+  // Compare with the input sorted in memory by SortIndices, which is stable
+  // as well
+  void CheckSorted(const Table& actual) {
+    FunctionContext ctx(default_memory_pool());
+    shared_ptr<Table> input;
+    ASSERT_OK(Table::FromRecordBatches(schema_, batches_, &input));
+    ASSERT_EQ(input->num_rows(), actual.num_rows());
+
+    shared_ptr<Array> indices;
+    ASSERT_OK(SortIndices(&ctx, *CombinedColumn(*input, 0), &indices));
+    for (int j = 0; j < schema_->num_fields(); ++j) {
+      shared_ptr<Array> expected;
+      ASSERT_OK(Take(&ctx, *CombinedColumn(*input, j), *indices, &expected));
+      test::AssertArraysEqual(*expected, *CombinedColumn(actual, j));
+    }
+  }
+
+  shared_ptr<Array> CombinedColumn(const Table& table, int i) {
+    shared_ptr<Table> combined;
+    ABORT_NOT_OK(table.CombineChunks(default_memory_pool(), &combined));
+    return combined->column(i)->data()->chunk(0);
+  }
+
+  shared_ptr<Schema> schema_;
+  vector<shared_ptr<RecordBatch>> batches_;
+};
+
+TEST_F(TestExternalSort, InMemory) {
+  MakeBatches(4, 100, 0.1);
+  ExternalSortOptions options;
+  options.batch_size = 64;
+
+  shared_ptr<Table> sorted;
+  int num_spilled_runs;
+  ASSERT_NO_FATAL_FAILURE(ExternalSort(options, &sorted, &num_spilled_runs));
+  ASSERT_EQ(0, num_spilled_runs);
+  ASSERT_NO_FATAL_FAILURE(CheckSorted(*sorted));
+}
+
+TEST_F(TestExternalSort, Spilled) {
+  MakeBatches(20, 500, 0.1);
+  ExternalSortOptions options;
+  // Each batch holds about 8KB, so that runs of a few batches get spilled
+  options.memory_limit = 64 << 10;
+  options.batch_size = 300;
+
+  shared_ptr<Table> sorted;
+  int num_spilled_runs;
+  ASSERT_NO_FATAL_FAILURE(ExternalSort(options, &sorted, &num_spilled_runs));
+  ASSERT_GT(num_spilled_runs, 1);
+  ASSERT_NO_FATAL_FAILURE(CheckSorted(*sorted));
+}
+
+TEST_F(TestExternalSort, SpilledAllNulls) {
+  MakeBatches(10, 500, 1.0);
+  ExternalSortOptions options;
+  options.memory_limit = 64 << 10;
+
+  shared_ptr<Table> sorted;
+  int num_spilled_runs;
+  ASSERT_NO_FATAL_FAILURE(ExternalSort(options, &sorted, &num_spilled_runs));
+  ASSERT_GT(num_spilled_runs, 1);
+  // Equal keys keep the input order across runs
+  ASSERT_NO_FATAL_FAILURE(CheckSorted(*sorted));
+}
+
+TEST_F(TestExternalSort, Empty) {
+  ExternalSortOptions options;
+  shared_ptr<Table> sorted;
+  int num_spilled_runs;
+  ASSERT_NO_FATAL_FAILURE(ExternalSort(options, &sorted, &num_spilled_runs));
+  ASSERT_EQ(0, sorted->num_rows());
+}
+
+TEST_F(TestExternalSort, InvalidOptions) {
+  FunctionContext ctx(default_memory_pool());
+  std::unique_ptr<ExternalSorter> sorter;
+  ExternalSortOptions options;
+  options.sort_column = 2;
+  ASSERT_RAISES(Invalid, ExternalSorter::Make(&ctx, schema_, options, &sorter));
+
+  options.sort_column = 0;
+  options.memory_limit = 0;
+  ASSERT_RAISES(Invalid, ExternalSorter::Make(&ctx, schema_, options, &sorter));
+
+  auto list_schema = ::arrow::schema({field("key", list(int32()))});
+  ASSERT_RAISES(NotImplemented,
+                ExternalSorter::Make(&ctx, list_schema, ExternalSortOptions(), &sorter));
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -24,6 +24,7 @@
 #include "arrow/array.h"
 #include "arrow/record_batch.h"
 #include "arrow/table.h"
+#include "arrow/util/decimal.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/variant.h"
 #include "arrow/util/visibility.h"
@@ -40,13 +41,41 @@ class ARROW_EXPORT OpKernel {
   virtual ~OpKernel() = default;
 };
 
-/// \brief Placeholder for Scalar values until we implement these
+/// \brief Base class for single values, such as the results of aggregations
 struct ARROW_EXPORT Scalar {
-  ~Scalar() {}
+  virtual ~Scalar() = default;
+
+  std::shared_ptr<DataType> type;
+  bool is_valid;
+
+ protected:
+  Scalar(const std::shared_ptr<DataType>& type, bool is_valid)
+      : type(type), is_valid(is_valid) {}
 
   ARROW_DISALLOW_COPY_AND_ASSIGN(Scalar);
 };
 
+/// \brief A single value of a type with a C representation, or a null
+template <typename Type>
+struct NumericScalar : public Scalar {
+  using c_type = typename Type::c_type;
+
+  NumericScalar(const std::shared_ptr<DataType>& type, c_type value,
+                bool is_valid = true)
+      : Scalar(type, is_valid), value(value) {}
+
+  c_type value;
+};
+
+/// \brief A single decimal value, or a null
+struct ARROW_EXPORT Decimal128Scalar : public Scalar {
+  Decimal128Scalar(const std::shared_ptr<DataType>& type, const Decimal128& value,
+                   bool is_valid = true)
+      : Scalar(type, is_valid), value(value) {}
+
+  Decimal128 value;
+};
+
 /// \class Datum
 /// \brief Variant type for various Arrow C++ data structures
 struct ARROW_EXPORT Datum {
@@ -99,6 +128,10 @@ struct ARROW_EXPORT Datum {
     }
   }
 
+  std::shared_ptr<Scalar> scalar() const {
+    return util::get<std::shared_ptr<Scalar>>(this->value);
+  }
+
   std::shared_ptr<ArrayData> array() const {
     return util::get<std::shared_ptr<ArrayData>>(this->value);
   }
@@ -123,6 +156,8 @@ struct ARROW_EXPORT Datum {
       return util::get<std::shared_ptr<ArrayData>>(this->value)->type;
     } else if (this->kind() == Datum::CHUNKED_ARRAY) {
       return util::get<std::shared_ptr<ChunkedArray>>(this->value)->type();
+    } else if (this->kind() == Datum::SCALAR) {
+      return util::get<std::shared_ptr<Scalar>>(this->value)->type;
     }
     return NULLPTR;
   }
@@ -132,9 +167,21 @@ struct ARROW_EXPORT Datum {
 /// \brief An array-valued function of a single input argument
 class ARROW_EXPORT UnaryKernel : public OpKernel {
  public:
+  /// \brief Apply the function to an input
+  ///
+  /// If out already holds array data on entry, kernels that support it write
+  /// their result into its preallocated buffers instead of allocating.
   virtual Status Call(FunctionContext* ctx, const Datum& input, Datum* out) = 0;
 };
 
+/// \class BinaryKernel
+/// \brief An array-valued function of two input arguments
+class ARROW_EXPORT BinaryKernel : public OpKernel {
+ public:
+  virtual Status Call(FunctionContext* ctx, const Datum& left, const Datum& right,
+                      Datum* out) = 0;
+};
+
 }  // namespace compute
 }  // namespace arrow
 
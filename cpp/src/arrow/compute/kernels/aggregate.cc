@@ -0,0 +1,1020 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include "arrow/compute/kernels/aggregate.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/builder.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/hash.h"
+#include "arrow/compute/kernels/row-keys-internal.h"
+#include "arrow/compute/kernels/util-internal.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/decimal.h"
+#include "arrow/util/hash.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+namespace compute {
+
+namespace {
+
+// ----------------------------------------------------------------------
+// Grouped aggregate states
+
+class GroupedAggregator {
+ public:
+  virtual ~GroupedAggregator() = default;
+
+  // Make room for the states of num_groups groups
+  virtual void Resize(int64_t num_groups) = 0;
+
+  // Update the states of the groups of the given rows
+  virtual void Consume(const ArrayData& values, const int32_t* group_ids) = 0;
+
+  // Fold the states of another aggregator into the states of the groups given
+  // for each of its groups
+  virtual void Merge(const GroupedAggregator& other, const int32_t* group_ids) = 0;
+
+  virtual Status Finish(MemoryPool* pool, std::shared_ptr<Array>* out) = 0;
+
+  virtual std::shared_ptr<DataType> out_type() const = 0;
+};
+
+// Call the visitor with the position and index of every valid value
+template <typename Visitor>
+void VisitValid(const ArrayData& values, const int32_t* group_ids, Visitor&& visit) {
+  if (values.null_count != 0 && values.buffers[0] != nullptr) {
+    // The bits are only tested in the blocks with some nulls
+    const uint8_t* valid_bits = values.buffers[0]->data();
+    internal::BitBlockCounter counter(valid_bits, values.offset, values.length);
+    int64_t position = 0;
+    while (position < values.length) {
+      const internal::BitBlockCount block = counter.NextWord();
+      if (block.AllSet()) {
+        for (int64_t i = position; i < position + block.length; ++i) {
+          visit(i, group_ids[i]);
+        }
+      } else if (!block.NoneSet()) {
+        for (int64_t i = position; i < position + block.length; ++i) {
+          if (BitUtil::GetBit(valid_bits, values.offset + i)) {
+            visit(i, group_ids[i]);
+          }
+        }
+      }
+      position += block.length;
+    }
+  } else {
+    for (int64_t i = 0; i < values.length; ++i) {
+      visit(i, group_ids[i]);
+    }
+  }
+}
+
+// Make an array from the states, null where a group has no values
+template <typename OutType, typename T>
+Status FinishStates(MemoryPool* pool, const std::vector<T>& states,
+                    const std::vector<int64_t>& counts, std::shared_ptr<Array>* out) {
+  std::vector<uint8_t> valid_bytes(counts.size());
+  for (size_t i = 0; i < counts.size(); ++i) {
+    valid_bytes[i] = counts[i] > 0;
+  }
+  NumericBuilder<OutType> builder(pool);
+  RETURN_NOT_OK(builder.AppendValues(states.data(), static_cast<int64_t>(states.size()),
+                                     valid_bytes.data()));
+  return builder.Finish(out);
+}
+
+class GroupedCount : public GroupedAggregator {
+ public:
+  void Resize(int64_t num_groups) override { counts_.resize(num_groups, 0); }
+
+  void Consume(const ArrayData& values, const int32_t* group_ids) override {
+    VisitValid(values, group_ids, [this](int64_t, int32_t g) { ++counts_[g]; });
+  }
+
+  void Merge(const GroupedAggregator& other, const int32_t* group_ids) override {
+    const auto& counts = checked_cast<const GroupedCount&>(other).counts_;
+    for (size_t i = 0; i < counts.size(); ++i) {
+      counts_[group_ids[i]] += counts[i];
+    }
+  }
+
+  Status Finish(MemoryPool* pool, std::shared_ptr<Array>* out) override {
+    Int64Builder builder(pool);
+    RETURN_NOT_OK(
+        builder.AppendValues(counts_.data(), static_cast<int64_t>(counts_.size())));
+    return builder.Finish(out);
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return int64(); }
+
+ private:
+  std::vector<int64_t> counts_;
+};
+
+// The type summing values of the given type
+template <typename Type, typename Enable = void>
+struct SumType {
+  using type = Int64Type;
+};
+
+template <typename Type>
+struct SumType<Type, typename std::enable_if<IsUnsignedInt<Type>::value>::type> {
+  using type = UInt64Type;
+};
+
+template <typename Type>
+struct SumType<Type, typename std::enable_if<IsFloatingPoint<Type>::value>::type> {
+  using type = DoubleType;
+};
+
+template <typename Type, typename SumOutType>
+class GroupedSumBase : public GroupedAggregator {
+ public:
+  using T = typename Type::c_type;
+  using Acc = typename SumOutType::c_type;
+
+  void Resize(int64_t num_groups) override {
+    sums_.resize(num_groups, 0);
+    counts_.resize(num_groups, 0);
+  }
+
+  void Consume(const ArrayData& data, const int32_t* group_ids) override {
+    const T* values = GetValues<T>(data, 1);
+    VisitValid(data, group_ids, [&](int64_t i, int32_t g) {
+      sums_[g] += static_cast<Acc>(values[i]);
+      ++counts_[g];
+    });
+  }
+
+  void Merge(const GroupedAggregator& other, const int32_t* group_ids) override {
+    const auto& other_sum = checked_cast<const GroupedSumBase&>(other);
+    for (size_t i = 0; i < other_sum.sums_.size(); ++i) {
+      sums_[group_ids[i]] += other_sum.sums_[i];
+      counts_[group_ids[i]] += other_sum.counts_[i];
+    }
+  }
+
+  Status Finish(MemoryPool* pool, std::shared_ptr<Array>* out) override {
+    return FinishStates<SumOutType>(pool, sums_, counts_, out);
+  }
+
+  std::shared_ptr<DataType> out_type() const override {
+    return TypeTraits<SumOutType>::type_singleton();
+  }
+
+ protected:
+  std::vector<Acc> sums_;
+  std::vector<int64_t> counts_;
+};
+
+template <typename Type>
+using GroupedSum = GroupedSumBase<Type, typename SumType<Type>::type>;
+
+template <typename Type>
+class GroupedMean : public GroupedSumBase<Type, DoubleType> {
+ public:
+  Status Finish(MemoryPool* pool, std::shared_ptr<Array>* out) override {
+    std::vector<double> means(this->sums_.size());
+    for (size_t i = 0; i < means.size(); ++i) {
+      means[i] = this->counts_[i] > 0
+                     ? this->sums_[i] / static_cast<double>(this->counts_[i])
+                     : 0;
+    }
+    return FinishStates<DoubleType>(pool, means, this->counts_, out);
+  }
+};
+
+template <typename Type, bool kMin>
+class GroupedMinMax : public GroupedAggregator {
+ public:
+  using T = typename Type::c_type;
+
+  void Resize(int64_t num_groups) override {
+    values_.resize(num_groups, 0);
+    counts_.resize(num_groups, 0);
+  }
+
+  void Consume(const ArrayData& data, const int32_t* group_ids) override {
+    const T* values = GetValues<T>(data, 1);
+    VisitValid(data, group_ids,
+               [&](int64_t i, int32_t g) { Update(g, values[i], 1); });
+  }
+
+  void Merge(const GroupedAggregator& other, const int32_t* group_ids) override {
+    const auto& other_min_max = checked_cast<const GroupedMinMax&>(other);
+    for (size_t i = 0; i < other_min_max.values_.size(); ++i) {
+      if (other_min_max.counts_[i] > 0) {
+        Update(group_ids[i], other_min_max.values_[i], other_min_max.counts_[i]);
+      }
+    }
+  }
+
+  Status Finish(MemoryPool* pool, std::shared_ptr<Array>* out) override {
+    return FinishStates<Type>(pool, values_, counts_, out);
+  }
+
+  std::shared_ptr<DataType> out_type() const override {
+    return TypeTraits<Type>::type_singleton();
+  }
+
+ private:
+  void Update(int32_t g, T value, int64_t count) {
+    if (counts_[g] == 0 || (kMin ? value < values_[g] : values_[g] < value)) {
+      values_[g] = value;
+    }
+    counts_[g] += count;
+  }
+
+  std::vector<T> values_;
+  std::vector<int64_t> counts_;
+};
+
+template <typename Type>
+using GroupedMin = GroupedMinMax<Type, true>;
+
+template <typename Type>
+using GroupedMax = GroupedMinMax<Type, false>;
+
+template <template <typename> class Aggregator>
+Status MakeNumericAggregator(const DataType& type,
+                             std::unique_ptr<GroupedAggregator>* out) {
+#define NUMERIC_CASE(InType)                \
+  case InType::type_id:                     \
+    out->reset(new Aggregator<InType>());   \
+    break
+
+  switch (type.id()) {
+    NUMERIC_CASE(UInt8Type);
+    NUMERIC_CASE(Int8Type);
+    NUMERIC_CASE(UInt16Type);
+    NUMERIC_CASE(Int16Type);
+    NUMERIC_CASE(UInt32Type);
+    NUMERIC_CASE(Int32Type);
+    NUMERIC_CASE(UInt64Type);
+    NUMERIC_CASE(Int64Type);
+    NUMERIC_CASE(FloatType);
+    NUMERIC_CASE(DoubleType);
+    default: {
+      std::stringstream ss;
+      ss << "Aggregating values of type " << type.ToString();
+      return Status::NotImplemented(ss.str());
+    }
+  }
+
+#undef NUMERIC_CASE
+
+  return Status::OK();
+}
+
+Status MakeGroupedAggregator(const AggregateSpec& spec, const DataType& type,
+                             std::unique_ptr<GroupedAggregator>* out) {
+  switch (spec.function) {
+    case Aggregate::COUNT:
+      out->reset(new GroupedCount());
+      return Status::OK();
+    case Aggregate::SUM:
+      return MakeNumericAggregator<GroupedSum>(type, out);
+    case Aggregate::MIN:
+      return MakeNumericAggregator<GroupedMin>(type, out);
+    case Aggregate::MAX:
+      return MakeNumericAggregator<GroupedMax>(type, out);
+    case Aggregate::MEAN:
+      return MakeNumericAggregator<GroupedMean>(type, out);
+  }
+  return Status::Invalid("Unknown aggregate function");
+}
+
+const char* AggregateName(Aggregate::type function) {
+  switch (function) {
+    case Aggregate::COUNT:
+      return "count";
+    case Aggregate::SUM:
+      return "sum";
+    case Aggregate::MIN:
+      return "min";
+    case Aggregate::MAX:
+      return "max";
+    case Aggregate::MEAN:
+      return "mean";
+  }
+  return "unknown";
+}
+
+}  // namespace
+
+// ----------------------------------------------------------------------
+// GroupByAggregator implementation
+
+class GroupByAggregator::GroupByAggregatorImpl {
+ public:
+  GroupByAggregatorImpl(FunctionContext* ctx, const std::shared_ptr<Schema>& schema,
+                        const std::vector<int>& key_columns,
+                        const std::vector<AggregateSpec>& aggregates)
+      : ctx_(ctx),
+        schema_(schema),
+        key_column_indices_(key_columns),
+        specs_(aggregates),
+        table_(ctx->memory_pool()),
+        key_data_(ctx->memory_pool()),
+        key_offsets_(ctx->memory_pool()),
+        num_groups_(0) {}
+
+  Status Init() {
+    if (key_column_indices_.empty()) {
+      return Status::Invalid("Must group by at least one column");
+    }
+    RETURN_NOT_OK(encoder_.Init(*schema_, key_column_indices_));
+    for (const AggregateSpec& spec : specs_) {
+      RETURN_NOT_OK(CheckColumn(spec.column));
+      std::unique_ptr<GroupedAggregator> aggregator;
+      RETURN_NOT_OK(MakeGroupedAggregator(spec, *schema_->field(spec.column)->type(),
+                                          &aggregator));
+      aggregators_.push_back(std::move(aggregator));
+    }
+    RETURN_NOT_OK(key_offsets_.Append(0));
+    return table_.Init();
+  }
+
+  Status Consume(const RecordBatch& batch) {
+    if (!batch.schema()->Equals(*schema_)) {
+      return Status::Invalid("Batch schema does not match the aggregator's schema");
+    }
+    const int64_t length = batch.num_rows();
+
+    std::shared_ptr<Array> row_hashes;
+    RETURN_NOT_OK(HashRows(ctx_, batch, key_column_indices_, &row_hashes));
+    const uint64_t* hashes = checked_cast<const UInt64Array&>(*row_hashes).raw_values();
+    encoder_.Encode(batch);
+
+    group_ids_.resize(static_cast<size_t>(length));
+    for (int64_t i = 0; i < length; ++i) {
+      RETURN_NOT_OK(GetOrInsertGroup(hashes[i], encoder_.key(i), encoder_.key_length(i),
+                                     &group_ids_[i]));
+    }
+
+    for (size_t k = 0; k < aggregators_.size(); ++k) {
+      aggregators_[k]->Resize(num_groups_);
+      aggregators_[k]->Consume(*batch.column_data(specs_[k].column), group_ids_.data());
+    }
+    return Status::OK();
+  }
+
+  Status Merge(const GroupByAggregatorImpl& other) {
+    if (!other.schema_->Equals(*schema_) ||
+        other.key_column_indices_ != key_column_indices_ ||
+        !SameAggregates(other.specs_)) {
+      return Status::Invalid("Can only merge aggregators made with the same arguments");
+    }
+    const int64_t* offsets = other.key_offsets_.data();
+    std::vector<int32_t> group_ids(static_cast<size_t>(other.num_groups_));
+    for (int32_t g = 0; g < other.num_groups_; ++g) {
+      RETURN_NOT_OK(GetOrInsertGroup(other.group_hashes_[g],
+                                     other.key_data_.data() + offsets[g],
+                                     offsets[g + 1] - offsets[g], &group_ids[g]));
+    }
+    for (size_t k = 0; k < aggregators_.size(); ++k) {
+      aggregators_[k]->Resize(num_groups_);
+      aggregators_[k]->Merge(*other.aggregators_[k], group_ids.data());
+    }
+    return Status::OK();
+  }
+
+  Status Finish(std::shared_ptr<RecordBatch>* out) {
+    std::vector<std::shared_ptr<Field>> fields;
+    std::vector<std::shared_ptr<Array>> columns;
+    for (size_t k = 0; k < key_column_indices_.size(); ++k) {
+      std::shared_ptr<Array> keys;
+      RETURN_NOT_OK(DecodeKeys(k, &keys));
+      fields.push_back(schema_->field(key_column_indices_[k]));
+      columns.push_back(keys);
+    }
+    for (size_t k = 0; k < aggregators_.size(); ++k) {
+      std::shared_ptr<Array> values;
+      aggregators_[k]->Resize(num_groups_);
+      RETURN_NOT_OK(aggregators_[k]->Finish(ctx_->memory_pool(), &values));
+      std::stringstream name;
+      name << AggregateName(specs_[k].function) << "("
+           << schema_->field(specs_[k].column)->name() << ")";
+      fields.push_back(field(name.str(), aggregators_[k]->out_type()));
+      columns.push_back(values);
+    }
+    *out = RecordBatch::Make(::arrow::schema(fields), num_groups_, columns);
+    return Status::OK();
+  }
+
+  int64_t num_groups() const { return num_groups_; }
+
+ private:
+  Status CheckColumn(int i) const {
+    if (i < 0 || i >= schema_->num_fields()) {
+      std::stringstream ss;
+      ss << "Column index " << i << " out of bounds for a schema of "
+         << schema_->num_fields() << " fields";
+      return Status::Invalid(ss.str());
+    }
+    return Status::OK();
+  }
+
+  bool SameAggregates(const std::vector<AggregateSpec>& specs) const {
+    if (specs.size() != specs_.size()) {
+      return false;
+    }
+    for (size_t k = 0; k < specs.size(); ++k) {
+      if (specs[k].function != specs_[k].function ||
+          specs[k].column != specs_[k].column) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Rebuild the k-th key column from the encoded keys of all groups
+  Status DecodeKeys(size_t k, std::shared_ptr<Array>* out) {
+    const std::vector<detail::KeyColumn>& key_columns = encoder_.columns();
+    const detail::KeyColumn& column = key_columns[k];
+    const int64_t* offsets = key_offsets_.data();
+    const uint8_t* keys = key_data_.data();
+    MemoryPool* pool = ctx_->memory_pool();
+
+    // Position of the k-th key column within each group's key
+    std::vector<int64_t> positions(offsets, offsets + num_groups_);
+    for (size_t j = 0; j < k; ++j) {
+      for (int64_t g = 0; g < num_groups_; ++g) {
+        positions[g] += detail::RowKeyEncoder::EncodedWidth(key_columns[j],
+                                                            keys + positions[g]);
+      }
+    }
+
+    std::shared_ptr<Buffer> null_bitmap;
+    RETURN_NOT_OK(GetEmptyBitmap(pool, num_groups_, &null_bitmap));
+    int64_t null_count = 0;
+    for (int64_t g = 0; g < num_groups_; ++g) {
+      if (keys[positions[g]]) {
+        BitUtil::SetBit(null_bitmap->mutable_data(), g);
+      } else {
+        ++null_count;
+      }
+    }
+
+    BufferVector buffers = {null_count > 0 ? null_bitmap : nullptr};
+    switch (column.kind) {
+      case detail::KeyColumn::FIXED_WIDTH: {
+        std::shared_ptr<Buffer> values;
+        RETURN_NOT_OK(AllocateBuffer(pool, num_groups_ * column.byte_width, &values));
+        for (int64_t g = 0; g < num_groups_; ++g) {
+          std::memcpy(values->mutable_data() + g * column.byte_width,
+                      keys + positions[g] + 1, static_cast<size_t>(column.byte_width));
+        }
+        buffers.push_back(values);
+      } break;
+      case detail::KeyColumn::BOOLEAN: {
+        std::shared_ptr<Buffer> values;
+        RETURN_NOT_OK(GetEmptyBitmap(pool, num_groups_, &values));
+        for (int64_t g = 0; g < num_groups_; ++g) {
+          if (keys[positions[g] + 1]) {
+            BitUtil::SetBit(values->mutable_data(), g);
+          }
+        }
+        buffers.push_back(values);
+      } break;
+      case detail::KeyColumn::BINARY: {
+        std::shared_ptr<Buffer> value_offsets;
+        RETURN_NOT_OK(
+            AllocateBuffer(pool, (num_groups_ + 1) * sizeof(int32_t), &value_offsets));
+        auto raw_offsets = reinterpret_cast<int32_t*>(value_offsets->mutable_data());
+        raw_offsets[0] = 0;
+        for (int64_t g = 0; g < num_groups_; ++g) {
+          int32_t value_length;
+          std::memcpy(&value_length, keys + positions[g] + 1, sizeof(int32_t));
+          raw_offsets[g + 1] = raw_offsets[g] + value_length;
+        }
+        std::shared_ptr<Buffer> values;
+        RETURN_NOT_OK(AllocateBuffer(pool, raw_offsets[num_groups_], &values));
+        for (int64_t g = 0; g < num_groups_; ++g) {
+          std::memcpy(values->mutable_data() + raw_offsets[g],
+                      keys + positions[g] + 1 + sizeof(int32_t),
+                      static_cast<size_t>(raw_offsets[g + 1] - raw_offsets[g]));
+        }
+        buffers.push_back(value_offsets);
+        buffers.push_back(values);
+      } break;
+    }
+
+    const auto& type = schema_->field(key_column_indices_[k])->type();
+    *out = MakeArray(ArrayData::Make(type, num_groups_, std::move(buffers), null_count));
+    return Status::OK();
+  }
+
+  Status GetOrInsertGroup(uint64_t hash, const uint8_t* key, int64_t length,
+                          int32_t* group_id) {
+    const auto table_hash = static_cast<uint32_t>(hash ^ (hash >> 32));
+    auto equal = [&](int32_t g) {
+      const int64_t* offsets = key_offsets_.data();
+      return offsets[g + 1] - offsets[g] == length &&
+             0 == std::memcmp(key, key_data_.data() + offsets[g],
+                              static_cast<size_t>(length));
+    };
+    int64_t pos;
+    *group_id = table_.Find(table_hash, equal, &pos);
+    if (*group_id == internal::GroupHashTable::kNotFound) {
+      if (num_groups_ == std::numeric_limits<int32_t>::max()) {
+        return Status::CapacityError("Too many groups");
+      }
+      *group_id = num_groups_++;
+      RETURN_NOT_OK(key_data_.Append(key, length));
+      RETURN_NOT_OK(key_offsets_.Append(key_data_.length()));
+      group_hashes_.push_back(hash);
+      RETURN_NOT_OK(table_.Insert(pos, table_hash, *group_id));
+    }
+    return Status::OK();
+  }
+
+  FunctionContext* ctx_;
+  std::shared_ptr<Schema> schema_;
+  std::vector<int> key_column_indices_;
+  detail::RowKeyEncoder encoder_;
+  std::vector<AggregateSpec> specs_;
+  std::vector<std::unique_ptr<GroupedAggregator>> aggregators_;
+
+  // The encoded key and row hash of every group, by group id
+  internal::GroupHashTable table_;
+  TypedBufferBuilder<uint8_t> key_data_;
+  TypedBufferBuilder<int64_t> key_offsets_;
+  std::vector<uint64_t> group_hashes_;
+  int32_t num_groups_;
+
+  // Scratch space for the batch being consumed
+  std::vector<int32_t> group_ids_;
+};
+
+GroupByAggregator::GroupByAggregator(std::unique_ptr<GroupByAggregatorImpl> impl)
+    : impl_(std::move(impl)) {}
+
+GroupByAggregator::~GroupByAggregator() {}
+
+Status GroupByAggregator::Make(FunctionContext* ctx,
+                               const std::shared_ptr<Schema>& schema,
+                               const std::vector<int>& key_columns,
+                               const std::vector<AggregateSpec>& aggregates,
+                               std::unique_ptr<GroupByAggregator>* out) {
+  std::unique_ptr<GroupByAggregatorImpl> impl(
+      new GroupByAggregatorImpl(ctx, schema, key_columns, aggregates));
+  RETURN_NOT_OK(impl->Init());
+  out->reset(new GroupByAggregator(std::move(impl)));
+  return Status::OK();
+}
+
+Status GroupByAggregator::Consume(const RecordBatch& batch) {
+  return impl_->Consume(batch);
+}
+
+Status GroupByAggregator::Merge(const GroupByAggregator& other) {
+  return impl_->Merge(*other.impl_);
+}
+
+Status GroupByAggregator::Finish(std::shared_ptr<RecordBatch>* out) {
+  return impl_->Finish(out);
+}
+
+int64_t GroupByAggregator::num_groups() const { return impl_->num_groups(); }
+
+Status GroupBy(FunctionContext* ctx, const Table& table,
+               const std::vector<int>& key_columns,
+               const std::vector<AggregateSpec>& aggregates,
+               std::shared_ptr<Table>* out) {
+  std::unique_ptr<GroupByAggregator> aggregator;
+  RETURN_NOT_OK(GroupByAggregator::Make(ctx, table.schema(), key_columns, aggregates,
+                                        &aggregator));
+  TableBatchReader reader(table);
+  std::shared_ptr<RecordBatch> batch;
+  while (true) {
+    RETURN_NOT_OK(reader.ReadNext(&batch));
+    if (batch == nullptr) {
+      break;
+    }
+    RETURN_NOT_OK(aggregator->Consume(*batch));
+  }
+
+  std::shared_ptr<RecordBatch> result;
+  RETURN_NOT_OK(aggregator->Finish(&result));
+  return Table::FromRecordBatches({result}, out);
+}
+
+// ----------------------------------------------------------------------
+// Scalar aggregates
+
+namespace {
+
+template <typename Type, typename SumOutType>
+struct SumStateBase {
+  using T = typename Type::c_type;
+  using Acc = typename SumOutType::c_type;
+
+  void Consume(const ArrayData& data) {
+    const T* values = GetValues<T>(data, 1);
+    VisitValidityBlocks(data, [&](int64_t position, int64_t length, uint64_t valid) {
+      const T* block = values + position;
+      Acc block_sum = 0;
+      if (valid == AllValid(length)) {
+        for (int64_t j = 0; j < length; ++j) {
+          block_sum += static_cast<Acc>(block[j]);
+        }
+        count += length;
+      } else if (valid != 0) {
+        for (int64_t j = 0; j < length; ++j) {
+          block_sum += ((valid >> j) & 1) ? static_cast<Acc>(block[j]) : 0;
+        }
+        count += BitUtil::Popcount(valid);
+      }
+      sum += block_sum;
+    });
+  }
+
+  // Consume the values of runs, each one as many times as its run length
+  void ConsumeRuns(const ArrayData& data, const int64_t* run_lengths) {
+    const T* values = GetValues<T>(data, 1);
+    VisitValidityBlocks(data, [&](int64_t position, int64_t length, uint64_t valid) {
+      for (int64_t j = position; j < position + length; ++j) {
+        if ((valid >> (j - position)) & 1) {
+          sum += static_cast<Acc>(values[j]) * static_cast<Acc>(run_lengths[j]);
+          count += run_lengths[j];
+        }
+      }
+    });
+  }
+
+  Datum Finish(const std::shared_ptr<DataType>&) const {
+    return Datum(std::make_shared<NumericScalar<SumOutType>>(
+        TypeTraits<SumOutType>::type_singleton(), sum, count > 0));
+  }
+
+  Acc sum = 0;
+  int64_t count = 0;
+};
+
+template <typename Type>
+using SumState = SumStateBase<Type, typename SumType<Type>::type>;
+
+// Decimals are summed in 128 bits. Those of at most 18 digits are summed from
+// the low words of the values, with the upper and the lower 32 bits of the
+// words apart so that the sums of a block can't overflow 64 bits.
+struct DecimalSumState {
+  void Consume(const ArrayData& data) {
+    const auto& type = checked_cast<const Decimal128Type&>(*data.type);
+    const uint8_t* values = data.buffers[1]->data() + data.offset * 16;
+    if (type.precision() <= 18) {
+      ConsumeInt64(data, reinterpret_cast<const uint64_t*>(values));
+    } else {
+      Consume128(data, values);
+    }
+  }
+
+  void ConsumeInt64(const ArrayData& data, const uint64_t* words) {
+    VisitValidityBlocks(data, [&](int64_t position, int64_t length, uint64_t valid) {
+      const uint64_t* block = words + 2 * position;
+      int64_t high_sum = 0;
+      uint64_t low_sum = 0;
+      if (valid == AllValid(length)) {
+        for (int64_t j = 0; j < length; ++j) {
+          const auto value =
+              static_cast<int64_t>(BitUtil::FromLittleEndian(block[2 * j]));
+          high_sum += value >> 32;
+          low_sum += static_cast<uint64_t>(value) & 0xffffffffULL;
+        }
+        count += length;
+      } else if (valid != 0) {
+        for (int64_t j = 0; j < length; ++j) {
+          const auto value =
+              ((valid >> j) & 1)
+                  ? static_cast<int64_t>(BitUtil::FromLittleEndian(block[2 * j]))
+                  : 0;
+          high_sum += value >> 32;
+          low_sum += static_cast<uint64_t>(value) & 0xffffffffULL;
+        }
+        count += BitUtil::Popcount(valid);
+      }
+      // high_sum * 2^32 + low_sum
+      sum += Decimal128(high_sum >> 32, static_cast<uint64_t>(high_sum) << 32);
+      sum += Decimal128(0, low_sum);
+    });
+  }
+
+  void Consume128(const ArrayData& data, const uint8_t* values) {
+    VisitValidityBlocks(data, [&](int64_t position, int64_t length, uint64_t valid) {
+      const uint8_t* block = values + 16 * position;
+      for (int64_t j = 0; j < length; ++j) {
+        if ((valid >> j) & 1) {
+          sum += Decimal128(block + 16 * j);
+        }
+      }
+      count += BitUtil::Popcount(valid);
+    });
+  }
+
+  void ConsumeRuns(const ArrayData& data, const int64_t* run_lengths) {
+    const uint8_t* values = data.buffers[1]->data() + data.offset * 16;
+    VisitValidityBlocks(data, [&](int64_t position, int64_t length, uint64_t valid) {
+      for (int64_t j = position; j < position + length; ++j) {
+        if ((valid >> (j - position)) & 1) {
+          sum += Decimal128(values + 16 * j) * Decimal128(run_lengths[j]);
+          count += run_lengths[j];
+        }
+      }
+    });
+  }
+
+  // Of the largest precision, with the scale of the values
+  Datum Finish(const std::shared_ptr<DataType>& type) const {
+    const int32_t scale = checked_cast<const Decimal128Type&>(*type).scale();
+    return Datum(std::make_shared<Decimal128Scalar>(decimal(38, scale), sum, count > 0));
+  }
+
+  Decimal128 sum;
+  int64_t count = 0;
+};
+
+template <typename Type>
+struct MeanState : public SumStateBase<Type, DoubleType> {
+  Datum Finish(const std::shared_ptr<DataType>&) const {
+    const double mean =
+        this->count > 0 ? this->sum / static_cast<double>(this->count) : 0;
+    return Datum(std::make_shared<NumericScalar<DoubleType>>(float64(), mean,
+                                                             this->count > 0));
+  }
+};
+
+template <typename Type>
+struct MinMaxState {
+  using T = typename Type::c_type;
+  using Limits = std::numeric_limits<T>;
+
+  // Identities of min and max, which nulls are replaced with
+  static constexpr T kMinIdentity =
+      Limits::has_infinity ? Limits::infinity() : Limits::max();
+  static constexpr T kMaxIdentity =
+      Limits::has_infinity ? -Limits::infinity() : Limits::lowest();
+
+  void Consume(const ArrayData& data) {
+    const T* values = GetValues<T>(data, 1);
+    VisitValidityBlocks(data, [&](int64_t position, int64_t length, uint64_t valid) {
+      const T* block = values + position;
+      T block_min = kMinIdentity;
+      T block_max = kMaxIdentity;
+      if (valid == AllValid(length)) {
+        for (int64_t j = 0; j < length; ++j) {
+          block_min = std::min(block_min, block[j]);
+          block_max = std::max(block_max, block[j]);
+        }
+        count += length;
+      } else if (valid != 0) {
+        for (int64_t j = 0; j < length; ++j) {
+          const bool is_valid = (valid >> j) & 1;
+          block_min = std::min(block_min, is_valid ? block[j] : kMinIdentity);
+          block_max = std::max(block_max, is_valid ? block[j] : kMaxIdentity);
+        }
+        count += BitUtil::Popcount(valid);
+      }
+      min = std::min(min, block_min);
+      max = std::max(max, block_max);
+    });
+  }
+
+  // The run lengths don't matter to the extremes
+  void ConsumeRuns(const ArrayData& data, const int64_t*) { Consume(data); }
+
+  Datum Finish(const std::shared_ptr<DataType>& type) const {
+    std::vector<Datum> min_max = {
+        Datum(std::make_shared<NumericScalar<Type>>(type, min, count > 0)),
+        Datum(std::make_shared<NumericScalar<Type>>(type, max, count > 0))};
+    return Datum(min_max);
+  }
+
+  T min = kMinIdentity;
+  T max = kMaxIdentity;
+  int64_t count = 0;
+};
+
+template <typename Type>
+constexpr typename Type::c_type MinMaxState<Type>::kMinIdentity;
+
+template <typename Type>
+constexpr typename Type::c_type MinMaxState<Type>::kMaxIdentity;
+
+template <typename State>
+class ScalarAggregateKernel : public UnaryKernel {
+ public:
+  explicit ScalarAggregateKernel(const std::shared_ptr<DataType>& type) : type_(type) {}
+
+  Status Call(FunctionContext* ctx, const Datum& input, Datum* out) override {
+    State state;
+    switch (input.kind()) {
+      case Datum::ARRAY:
+        Consume(input.array(), &state);
+        break;
+      case Datum::CHUNKED_ARRAY:
+        for (const auto& chunk : input.chunked_array()->chunks()) {
+          Consume(chunk->data(), &state);
+        }
+        break;
+      default:
+        return Status::Invalid("Aggregation input must be array-like");
+    }
+    *out = state.Finish(type_);
+    return Status::OK();
+  }
+
+ private:
+  // The values of a run-length-encoded array are consumed once per run
+  static void Consume(const std::shared_ptr<ArrayData>& data, State* state) {
+    if (data->type->id() != Type::RUN_LENGTH_ENCODED) {
+      state->Consume(*data);
+      return;
+    }
+    const RunLengthEncodedArray array(data);
+    std::vector<int64_t> run_lengths;
+    int64_t first_run = 0;
+    array.VisitRuns([&](int64_t run, int64_t, int64_t run_length) {
+      if (run_lengths.empty()) {
+        first_run = run;
+      }
+      run_lengths.push_back(run_length);
+    });
+    const auto num_runs = static_cast<int64_t>(run_lengths.size());
+    state->ConsumeRuns(*array.values()->Slice(first_run, num_runs)->data(),
+                       run_lengths.data());
+  }
+
+  std::shared_ptr<DataType> type_;
+};
+
+// A run-length-encoded array is aggregated as its values
+std::shared_ptr<DataType> AggregatedType(const std::shared_ptr<DataType>& type) {
+  if (type->id() == Type::RUN_LENGTH_ENCODED) {
+    return checked_cast<const RunLengthEncodedType&>(*type).value_type();
+  }
+  return type;
+}
+
+template <template <typename> class State>
+Status MakeScalarAggregateKernel(const std::shared_ptr<DataType>& type,
+                                 std::unique_ptr<UnaryKernel>* out) {
+#define NUMERIC_CASE(InType)                                        \
+  case InType::type_id:                                             \
+    out->reset(new ScalarAggregateKernel<State<InType>>(value_type)); \
+    break
+
+  const std::shared_ptr<DataType> value_type = AggregatedType(type);
+  switch (value_type->id()) {
+    NUMERIC_CASE(UInt8Type);
+    NUMERIC_CASE(Int8Type);
+    NUMERIC_CASE(UInt16Type);
+    NUMERIC_CASE(Int16Type);
+    NUMERIC_CASE(UInt32Type);
+    NUMERIC_CASE(Int32Type);
+    NUMERIC_CASE(UInt64Type);
+    NUMERIC_CASE(Int64Type);
+    NUMERIC_CASE(FloatType);
+    NUMERIC_CASE(DoubleType);
+    default: {
+      std::stringstream ss;
+      ss << "Aggregating values of type " << type->ToString();
+      return Status::NotImplemented(ss.str());
+    }
+  }
+
+#undef NUMERIC_CASE
+
+  return Status::OK();
+}
+
+class CountKernel : public UnaryKernel {
+ public:
+  explicit CountKernel(const CountOptions& options) : options_(options) {}
+
+  Status Call(FunctionContext* ctx, const Datum& input, Datum* out) override {
+    int64_t length = 0;
+    int64_t null_count = 0;
+    switch (input.kind()) {
+      case Datum::ARRAY:
+        length = input.array()->length;
+        null_count = NullCount(*MakeArray(input.array()));
+        break;
+      case Datum::CHUNKED_ARRAY:
+        length = input.chunked_array()->length();
+        for (const auto& chunk : input.chunked_array()->chunks()) {
+          null_count += NullCount(*chunk);
+        }
+        break;
+      default:
+        return Status::Invalid("Count input must be array-like");
+    }
+    const int64_t count = options_.count_mode == CountOptions::COUNT_NULL
+                              ? null_count
+                              : length - null_count;
+    *out = Datum(std::make_shared<NumericScalar<Int64Type>>(int64(), count));
+    return Status::OK();
+  }
+
+ private:
+  // The nulls of a run-length-encoded array are the runs of its null values
+  static int64_t NullCount(const Array& array) {
+    if (array.type_id() != Type::RUN_LENGTH_ENCODED) {
+      return array.null_count();
+    }
+    const auto& rle = checked_cast<const RunLengthEncodedArray&>(array);
+    const Array& values = *rle.values();
+    int64_t null_count = 0;
+    if (values.null_count() > 0) {
+      rle.VisitRuns([&](int64_t run, int64_t, int64_t run_length) {
+        null_count += values.IsNull(run) ? run_length : 0;
+      });
+    }
+    return null_count;
+  }
+
+  CountOptions options_;
+};
+
+using GetAggregateKernel = Status (*)(FunctionContext*, const std::shared_ptr<DataType>&,
+                                      std::unique_ptr<UnaryKernel>*);
+
+Status InvokeAggregate(FunctionContext* ctx, GetAggregateKernel get_kernel,
+                       const Datum& value, Datum* out) {
+  if (!value.is_arraylike()) {
+    return Status::Invalid("Aggregation input must be array-like");
+  }
+  std::unique_ptr<UnaryKernel> kernel;
+  RETURN_NOT_OK(get_kernel(ctx, value.type(), &kernel));
+  return kernel->Call(ctx, value, out);
+}
+
+}  // namespace
+
+Status GetSumKernel(FunctionContext* ctx, const std::shared_ptr<DataType>& type,
+                    std::unique_ptr<UnaryKernel>* kernel) {
+  if (AggregatedType(type)->id() == Type::DECIMAL) {
+    kernel->reset(new ScalarAggregateKernel<DecimalSumState>(AggregatedType(type)));
+    return Status::OK();
+  }
+  return MakeScalarAggregateKernel<SumState>(type, kernel);
+}
+
+Status GetMinMaxKernel(FunctionContext* ctx, const std::shared_ptr<DataType>& type,
+                       std::unique_ptr<UnaryKernel>* kernel) {
+  return MakeScalarAggregateKernel<MinMaxState>(type, kernel);
+}
+
+Status GetMeanKernel(FunctionContext* ctx, const std::shared_ptr<DataType>& type,
+                     std::unique_ptr<UnaryKernel>* kernel) {
+  return MakeScalarAggregateKernel<MeanState>(type, kernel);
+}
+
+Status Sum(FunctionContext* ctx, const Datum& value, Datum* out) {
+  return InvokeAggregate(ctx, GetSumKernel, value, out);
+}
+
+Status MinMax(FunctionContext* ctx, const Datum& value, Datum* out) {
+  return InvokeAggregate(ctx, GetMinMaxKernel, value, out);
+}
+
+Status Mean(FunctionContext* ctx, const Datum& value, Datum* out) {
+  return InvokeAggregate(ctx, GetMeanKernel, value, out);
+}
+
+Status Count(FunctionContext* ctx, const CountOptions& options, const Datum& value,
+             Datum* out) {
+  CountKernel kernel(options);
+  return kernel.Call(ctx, value, out);
+}
+
+}  // namespace compute
+}  // namespace arrow
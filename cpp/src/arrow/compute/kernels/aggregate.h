@@ -0,0 +1,218 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#ifndef ARROW_COMPUTE_KERNELS_AGGREGATE_H
+#define ARROW_COMPUTE_KERNELS_AGGREGATE_H
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "arrow/compute/kernel.h"
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class RecordBatch;
+class Schema;
+class Table;
+
+namespace compute {
+
+class FunctionContext;
+
+// ----------------------------------------------------------------------
+// Scalar aggregates
+//
+// These reduce an array or chunked array of integer or floating point values
+// to scalars, skipping nulls. The values are consumed in blocks of 64 along
+// with the validity bitmap word covering them: all-null blocks are skipped and
+// all-valid blocks take a branch-free path.
+
+/// \brief Options for Count
+struct ARROW_EXPORT CountOptions {
+  enum mode {
+    /// Count the non-null values
+    COUNT_VALID,
+    /// Count the nulls
+    COUNT_NULL
+  };
+
+  explicit CountOptions(mode count_mode = COUNT_VALID) : count_mode(count_mode) {}
+
+  mode count_mode;
+};
+
+ARROW_EXPORT
+Status GetSumKernel(FunctionContext* context, const std::shared_ptr<DataType>& type,
+                    std::unique_ptr<UnaryKernel>* kernel);
+
+ARROW_EXPORT
+Status GetMinMaxKernel(FunctionContext* context, const std::shared_ptr<DataType>& type,
+                       std::unique_ptr<UnaryKernel>* kernel);
+
+ARROW_EXPORT
+Status GetMeanKernel(FunctionContext* context, const std::shared_ptr<DataType>& type,
+                     std::unique_ptr<UnaryKernel>* kernel);
+
+/// \brief Sum the non-null values of an array-like object
+/// \param[in] context the FunctionContext
+/// \param[in] value array-like input of integer, floating point or decimal type
+/// \param[out] out scalar of type int64, uint64 or double depending on the
+/// input type, null if there are no non-null values. Integer sums wrap around
+/// on overflow. Decimals are summed in 128 bits to a decimal of precision 38
+/// and the scale of the input.
+///
+/// A run-length-encoded input is summed a run at a time, each value times the
+/// length of its run. MinMax and Mean take run-length-encoded input as well.
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Sum(FunctionContext* context, const Datum& value, Datum* out);
+
+/// \brief Compute the smallest and largest non-null values of an array-like
+/// object
+/// \param[in] context the FunctionContext
+/// \param[in] value array-like input of integer or floating point type
+/// \param[out] out collection of the minimum and maximum scalars, of the
+/// input type and null if there are no non-null values
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Status MinMax(FunctionContext* context, const Datum& value, Datum* out);
+
+/// \brief Compute the arithmetic mean of the non-null values of an array-like
+/// object
+/// \param[in] context the FunctionContext
+/// \param[in] value array-like input of integer or floating point type
+/// \param[out] out double scalar, null if there are no non-null values
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Mean(FunctionContext* context, const Datum& value, Datum* out);
+
+/// \brief Count the non-null values or the nulls of an array-like object
+/// \param[in] context the FunctionContext
+/// \param[in] options what to count
+/// \param[in] value array-like input of any type
+/// \param[out] out int64 scalar
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Count(FunctionContext* context, const CountOptions& options, const Datum& value,
+             Datum* out);
+
+// ----------------------------------------------------------------------
+// Grouped aggregates
+
+/// \brief The functions supported by grouped aggregation
+struct ARROW_EXPORT Aggregate {
+  enum type {
+    /// The number of non-null values, as int64
+    COUNT,
+    /// The sum of the non-null values, as int64, uint64 or double depending on
+    /// the value type. Integer sums wrap around on overflow.
+    SUM,
+    /// The smallest non-null value
+    MIN,
+    /// The largest non-null value
+    MAX,
+    /// The arithmetic mean of the non-null values, as double
+    MEAN
+  };
+};
+
+/// \brief An aggregate function applied to one column
+struct ARROW_EXPORT AggregateSpec {
+  AggregateSpec(Aggregate::type function, int column)
+      : function(function), column(column) {}
+
+  Aggregate::type function;
+  int column;
+};
+
+/// \brief Hash-based grouped aggregation over a stream of record batches
+///
+/// Rows are grouped by the values of the key columns, nulls forming a group of
+/// their own, and each aggregate keeps one state per group, so memory grows
+/// with the number of groups and not with the number of rows consumed. The
+/// groups appear in the result in the order they were first seen.
+///
+/// An aggregator is not thread-safe. To aggregate in parallel, give each
+/// thread its own aggregator and Merge the partial states at the end.
+///
+/// Keys can be of boolean, primitive, binary, string, fixed-size binary or
+/// decimal type. COUNT applies to values of any type and the other functions
+/// to integer and floating point values. Aggregates other than COUNT are null
+/// for groups without any non-null value.
+class ARROW_EXPORT GroupByAggregator {
+ public:
+  ~GroupByAggregator();
+
+  /// \brief Create an aggregator for batches of the given schema
+  ///
+  /// \param[in] context the FunctionContext
+  /// \param[in] schema schema of the batches to consume
+  /// \param[in] key_columns indices of the columns to group by, at least one
+  /// \param[in] aggregates the aggregates to compute
+  /// \param[out] out the aggregator
+  static Status Make(FunctionContext* context, const std::shared_ptr<Schema>& schema,
+                     const std::vector<int>& key_columns,
+                     const std::vector<AggregateSpec>& aggregates,
+                     std::unique_ptr<GroupByAggregator>* out);
+
+  /// \brief Group the rows of a batch and update the aggregates
+  Status Consume(const RecordBatch& batch);
+
+  /// \brief Merge the groups and aggregates of another aggregator made with
+  /// the same arguments into this one
+  Status Merge(const GroupByAggregator& other);
+
+  /// \brief Make a batch with the key columns followed by one column per
+  /// aggregate, holding one row per group
+  Status Finish(std::shared_ptr<RecordBatch>* out);
+
+  /// \brief The number of groups seen so far
+  int64_t num_groups() const;
+
+ private:
+  class GroupByAggregatorImpl;
+
+  explicit GroupByAggregator(std::unique_ptr<GroupByAggregatorImpl> impl);
+
+  std::unique_ptr<GroupByAggregatorImpl> impl_;
+};
+
+/// \brief Compute grouped aggregates over all rows of a table
+///
+/// \param[in] context the FunctionContext
+/// \param[in] table the table
+/// \param[in] key_columns indices of the columns to group by
+/// \param[in] aggregates the aggregates to compute
+/// \param[out] out table with the key columns followed by one column per
+/// aggregate, holding one row per group
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Status GroupBy(FunctionContext* context, const Table& table,
+               const std::vector<int>& key_columns,
+               const std::vector<AggregateSpec>& aggregates, std::shared_ptr<Table>* out);
+
+}  // namespace compute
+}  // namespace arrow
+
+#endif  // ARROW_COMPUTE_KERNELS_AGGREGATE_H
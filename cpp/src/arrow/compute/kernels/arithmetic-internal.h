@@ -0,0 +1,143 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_COMPUTE_KERNELS_ARITHMETIC_INTERNAL_H
+#define ARROW_COMPUTE_KERNELS_ARITHMETIC_INTERNAL_H
+
+#include <type_traits>
+
+namespace arrow {
+namespace compute {
+
+// The elementwise operations shared by the arithmetic and comparison kernels
+// and the expression evaluator
+
+// ----------------------------------------------------------------------
+// Arithmetic
+
+// The type integer arithmetic is done in: unsigned, so that overflow wraps
+// around, and at least as wide as unsigned int, so that promotion doesn't
+// turn the operands back into signed ints
+template <typename T, bool = std::is_integral<T>::value>
+struct WrappingType {
+  using type = T;
+};
+
+template <typename T>
+struct WrappingType<T, true> {
+  using type = typename std::conditional<(sizeof(T) < sizeof(unsigned int)), unsigned int,
+                                         typename std::make_unsigned<T>::type>::type;
+};
+
+template <typename T>
+using Wrapping = typename WrappingType<T>::type;
+
+struct AddOp {
+  template <typename T>
+  static T Call(T left, T right) {
+    using W = Wrapping<T>;
+    return static_cast<T>(static_cast<W>(left) + static_cast<W>(right));
+  }
+};
+
+struct SubtractOp {
+  template <typename T>
+  static T Call(T left, T right) {
+    using W = Wrapping<T>;
+    return static_cast<T>(static_cast<W>(left) - static_cast<W>(right));
+  }
+};
+
+struct MultiplyOp {
+  template <typename T>
+  static T Call(T left, T right) {
+    using W = Wrapping<T>;
+    return static_cast<T>(static_cast<W>(left) * static_cast<W>(right));
+  }
+};
+
+struct DivideOp {
+  template <typename T>
+  static typename std::enable_if<std::is_floating_point<T>::value, T>::type Call(
+      T left, T right) {
+    return left / right;
+  }
+
+  // Zero divisors are rejected beforehand for valid positions, and give zero
+  // at null ones. Dividing the smallest signed value by -1 wraps around.
+  template <typename T>
+  static typename std::enable_if<std::is_integral<T>::value, T>::type Call(T left,
+                                                                            T right) {
+    if (right == 0) {
+      return 0;
+    }
+    if (std::is_signed<T>::value && right == static_cast<T>(-1)) {
+      return static_cast<T>(static_cast<Wrapping<T>>(0) - static_cast<Wrapping<T>>(left));
+    }
+    return static_cast<T>(left / right);
+  }
+};
+
+// ----------------------------------------------------------------------
+// Comparisons
+
+struct EqualOp {
+  template <typename T>
+  static bool Call(T left, T right) {
+    return left == right;
+  }
+};
+
+struct NotEqualOp {
+  template <typename T>
+  static bool Call(T left, T right) {
+    return left != right;
+  }
+};
+
+struct LessOp {
+  template <typename T>
+  static bool Call(T left, T right) {
+    return left < right;
+  }
+};
+
+struct LessEqualOp {
+  template <typename T>
+  static bool Call(T left, T right) {
+    return left <= right;
+  }
+};
+
+struct GreaterOp {
+  template <typename T>
+  static bool Call(T left, T right) {
+    return left > right;
+  }
+};
+
+struct GreaterEqualOp {
+  template <typename T>
+  static bool Call(T left, T right) {
+    return left >= right;
+  }
+};
+
+}  // namespace compute
+}  // namespace arrow
+
+#endif  // ARROW_COMPUTE_KERNELS_ARITHMETIC_INTERNAL_H
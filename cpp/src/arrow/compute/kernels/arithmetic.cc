@@ -0,0 +1,789 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/arithmetic.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <type_traits>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/arithmetic-internal.h"
+#include "arrow/compute/kernels/take.h"
+#include "arrow/compute/kernels/util-internal.h"
+#include "arrow/compute/registry.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/decimal.h"
+
+namespace arrow {
+namespace compute {
+
+namespace {
+
+// ----------------------------------------------------------------------
+// Operands
+
+// Element access to an array operand and to a broadcast scalar operand, so
+// that the inner loops are written once for both
+template <typename T>
+struct ArrayOperand {
+  const T* values;
+
+  T operator[](int64_t i) const { return values[i]; }
+};
+
+template <typename T>
+struct ScalarOperand {
+  T value;
+
+  T operator[](int64_t) const { return value; }
+};
+
+// Check that the operands are two arrays of the same length or an array and a
+// scalar, and get the length of the result
+Status CheckOperandKinds(const Datum& left, const Datum& right, int64_t* length) {
+  for (const Datum* operand : {&left, &right}) {
+    if (operand->kind() != Datum::ARRAY && operand->kind() != Datum::SCALAR) {
+      return Status::NotImplemented(
+          "Elementwise functions only apply to arrays and scalars");
+    }
+  }
+  if (left.kind() == Datum::SCALAR && right.kind() == Datum::SCALAR) {
+    return Status::Invalid("At least one operand must be an array");
+  }
+  if (left.kind() == Datum::ARRAY && right.kind() == Datum::ARRAY &&
+      left.array()->length != right.array()->length) {
+    std::stringstream ss;
+    ss << "Array operands must have the same length, got " << left.array()->length
+       << " and " << right.array()->length;
+    return Status::Invalid(ss.str());
+  }
+  *length = left.kind() == Datum::ARRAY ? left.array()->length : right.array()->length;
+  return Status::OK();
+}
+
+// As CheckOperandKinds, also checking that the operands have the same type
+Status CheckOperands(const Datum& left, const Datum& right, int64_t* length) {
+  RETURN_NOT_OK(CheckOperandKinds(left, right, length));
+  if (!left.type()->Equals(*right.type())) {
+    std::stringstream ss;
+    ss << "Operands must have the same type, got " << left.type()->ToString()
+       << " and " << right.type()->ToString();
+    return Status::Invalid(ss.str());
+  }
+  return Status::OK();
+}
+
+const uint8_t* NullBitmap(const ArrayData& data) {
+  return data.null_count != 0 && data.buffers[0] != nullptr ? data.buffers[0]->data()
+                                                              : nullptr;
+}
+
+bool IsNullScalar(const Datum& operand) {
+  return operand.kind() == Datum::SCALAR && !operand.scalar()->is_valid;
+}
+
+// Set the null bitmap and null count of the result: null wherever either
+// operand is, or everywhere if either is a null scalar
+Status ComputeValidity(FunctionContext* ctx, const Datum& left, const Datum& right,
+                       ArrayData* out) {
+  if (IsNullScalar(left) || IsNullScalar(right)) {
+    RETURN_NOT_OK(GetEmptyBitmap(ctx->memory_pool(), out->length, &out->buffers[0]));
+    out->null_count = out->length;
+    return Status::OK();
+  }
+
+  const ArrayData* left_data = left.kind() == Datum::ARRAY ? left.array().get() : nullptr;
+  const ArrayData* right_data =
+      right.kind() == Datum::ARRAY ? right.array().get() : nullptr;
+  const uint8_t* left_bitmap = left_data != nullptr ? NullBitmap(*left_data) : nullptr;
+  const uint8_t* right_bitmap = right_data != nullptr ? NullBitmap(*right_data) : nullptr;
+
+  if (left_bitmap != nullptr && right_bitmap != nullptr) {
+    RETURN_NOT_OK(BitmapAnd(ctx->memory_pool(), left_bitmap, left_data->offset,
+                            right_bitmap, right_data->offset, out->length, 0,
+                            &out->buffers[0]));
+    out->null_count =
+        out->length - CountSetBits(out->buffers[0]->data(), 0, out->length);
+  } else if (left_bitmap != nullptr || right_bitmap != nullptr) {
+    const ArrayData& data = left_bitmap != nullptr ? *left_data : *right_data;
+    RETURN_NOT_OK(CopyBitmap(ctx->memory_pool(), data.buffers[0]->data(), data.offset,
+                             out->length, &out->buffers[0]));
+    out->null_count = data.null_count;
+  } else {
+    out->null_count = 0;
+  }
+  return Status::OK();
+}
+
+// Call func with the operands wrapped for element access
+template <typename Type, typename Function>
+void VisitOperands(const Datum& left, const Datum& right, Function&& func) {
+  using T = typename Type::c_type;
+  using ScalarType = NumericScalar<Type>;
+  if (left.kind() == Datum::ARRAY && right.kind() == Datum::ARRAY) {
+    func(ArrayOperand<T>{GetValues<T>(*left.array(), 1)},
+         ArrayOperand<T>{GetValues<T>(*right.array(), 1)});
+  } else if (left.kind() == Datum::ARRAY) {
+    func(ArrayOperand<T>{GetValues<T>(*left.array(), 1)},
+         ScalarOperand<T>{checked_cast<const ScalarType&>(*right.scalar()).value});
+  } else {
+    func(ScalarOperand<T>{checked_cast<const ScalarType&>(*left.scalar()).value},
+         ArrayOperand<T>{GetValues<T>(*right.array(), 1)});
+  }
+}
+
+// ----------------------------------------------------------------------
+// Arithmetic
+
+// Fail if an integer divisor is zero at a valid position of the result
+template <typename Type>
+Status CheckDivisors(const Datum& right, const ArrayData& out) {
+  using T = typename Type::c_type;
+  if (!std::is_integral<T>::value || out.null_count == out.length) {
+    return Status::OK();
+  }
+  const Status zero_division = Status::Invalid("Integer division by zero");
+  if (right.kind() == Datum::SCALAR) {
+    const T divisor = checked_cast<const NumericScalar<Type>&>(*right.scalar()).value;
+    return divisor == 0 ? zero_division : Status::OK();
+  }
+  const T* divisors = GetValues<T>(*right.array(), 1);
+  const uint8_t* bitmap = out.null_count != 0 ? out.buffers[0]->data() : nullptr;
+  for (int64_t i = 0; i < out.length; ++i) {
+    if (divisors[i] == 0 && (bitmap == nullptr || BitUtil::GetBit(bitmap, i))) {
+      return zero_division;
+    }
+  }
+  return Status::OK();
+}
+
+// The inner loop of the arithmetic kernels, stamped out once per instruction
+// set the kernel registry dispatches to so that the compiler vectorizes each
+// with the widest registers it has
+#define ARITHMETIC_LOOP(NAME, ATTRIBUTES)                                   \
+  struct NAME {                                                             \
+    template <typename Op, typename Left, typename Right, typename T>       \
+    ATTRIBUTES static void Run(const Left& left, const Right& right,        \
+                               int64_t length, T* dest) {                   \
+      for (int64_t i = 0; i < length; ++i) {                                \
+        dest[i] = Op::Call(left[i], right[i]);                              \
+      }                                                                     \
+    }                                                                       \
+  }
+
+ARITHMETIC_LOOP(BaselineLoop, );
+#ifdef ARROW_HAVE_TARGET_ATTRIBUTE
+ARITHMETIC_LOOP(Avx2Loop, ARROW_TARGET("avx2"));
+ARITHMETIC_LOOP(Avx512Loop, ARROW_TARGET("avx512f"));
+#endif
+
+#undef ARITHMETIC_LOOP
+
+template <typename Op, typename Loop, typename T>
+struct ArithmeticLoopVisitor {
+  T* dest;
+  int64_t length;
+
+  template <typename Left, typename Right>
+  void operator()(const Left& left, const Right& right) const {
+    Loop::template Run<Op>(left, right, length, dest);
+  }
+};
+
+// The signature of the arithmetic functions in the kernel registry
+template <typename Type>
+using ArithmeticFunction = void(const Datum& left, const Datum& right, int64_t length,
+                                typename Type::c_type* dest);
+
+template <typename Type, typename Op, typename Loop>
+void ApplyArithmetic(const Datum& left, const Datum& right, int64_t length,
+                     typename Type::c_type* dest) {
+  using T = typename Type::c_type;
+  VisitOperands<Type>(left, right, ArithmeticLoopVisitor<Op, Loop, T>{dest, length});
+}
+
+// As "add_int32"
+std::string ArithmeticFunctionName(const std::string& op_name, const DataType& type) {
+  return op_name + "_" + type.ToString();
+}
+
+template <typename Type, typename Op>
+Status RegisterArithmeticFunction(KernelRegistry* registry,
+                                  const std::string& op_name) {
+  const std::string name =
+      ArithmeticFunctionName(op_name, *TypeTraits<Type>::type_singleton());
+  RETURN_NOT_OK(registry->Register(name, SimdLevel::NONE,
+                                   &ApplyArithmetic<Type, Op, BaselineLoop>));
+#ifdef ARROW_HAVE_TARGET_ATTRIBUTE
+  RETURN_NOT_OK(
+      registry->Register(name, SimdLevel::AVX2, &ApplyArithmetic<Type, Op, Avx2Loop>));
+  RETURN_NOT_OK(registry->Register(name, SimdLevel::AVX512,
+                                   &ApplyArithmetic<Type, Op, Avx512Loop>));
+#endif
+  return Status::OK();
+}
+
+template <typename Type, typename Op>
+class ArithmeticKernel : public BinaryKernel {
+ public:
+  using T = typename Type::c_type;
+
+  ArithmeticKernel(const std::shared_ptr<DataType>& type,
+                   ArithmeticFunction<Type>* function)
+      : type_(type), function_(function) {}
+
+  Status Call(FunctionContext* ctx, const Datum& left, const Datum& right,
+              Datum* out) override {
+    int64_t length;
+    RETURN_NOT_OK(CheckOperands(left, right, &length));
+    auto result = std::make_shared<ArrayData>(type_, length);
+    result->buffers.resize(2);
+    RETURN_NOT_OK(ComputeValidity(ctx, left, right, result.get()));
+    if (std::is_same<Op, DivideOp>::value) {
+      RETURN_NOT_OK(CheckDivisors<Type>(right, *result));
+    }
+
+    RETURN_NOT_OK(ctx->Allocate(length * sizeof(T), &result->buffers[1]));
+    T* dest = reinterpret_cast<T*>(result->buffers[1]->mutable_data());
+    function_(left, right, length, dest);
+    *out = Datum(result);
+    return Status::OK();
+  }
+
+ private:
+  std::shared_ptr<DataType> type_;
+  ArithmeticFunction<Type>* function_;
+};
+
+// ----------------------------------------------------------------------
+// Decimal arithmetic
+
+constexpr int32_t kMaxDecimalPrecision = 38;
+
+// The most digits of the decimals computed with 64-bit integers
+constexpr int32_t kMaxInt64DecimalPrecision = 18;
+
+struct DecimalResult {
+  int32_t precision;
+  int32_t scale;
+};
+
+// The precision and scale of the result of a decimal operation: sums and
+// differences have the larger scale of the operands and one more integer digit
+// than the larger of theirs, products the sum of their precisions and scales.
+// The precision is not capped yet.
+template <typename Op>
+DecimalResult GetDecimalResult(const Decimal128Type& left, const Decimal128Type& right) {
+  if (std::is_same<Op, MultiplyOp>::value) {
+    return {left.precision() + right.precision(), left.scale() + right.scale()};
+  }
+  const int32_t scale = std::max(left.scale(), right.scale());
+  const int32_t integer_digits =
+      std::max(left.precision() - left.scale(), right.precision() - right.scale());
+  return {integer_digits + 1 + scale, scale};
+}
+
+const uint8_t* DecimalValues(const ArrayData& data) {
+  return data.buffers[1]->data() + data.offset * 16;
+}
+
+// Element access to decimal array operands: to the low words of values, when
+// they fit in 64 bits, or to whole values
+struct DecimalArray64 {
+  explicit DecimalArray64(const ArrayData& data)
+      : words(reinterpret_cast<const uint64_t*>(DecimalValues(data))) {}
+
+  int64_t operator[](int64_t i) const {
+    return static_cast<int64_t>(BitUtil::FromLittleEndian(words[2 * i]));
+  }
+
+  const uint64_t* words;
+};
+
+struct DecimalArray128 {
+  explicit DecimalArray128(const ArrayData& data) : bytes(DecimalValues(data)) {}
+
+  Decimal128 operator[](int64_t i) const { return Decimal128(bytes + 16 * i); }
+
+  const uint8_t* bytes;
+};
+
+template <typename T>
+struct DecimalAccess {};
+
+template <>
+struct DecimalAccess<int64_t> {
+  using ArrayType = DecimalArray64;
+
+  static int64_t FromScalar(const Decimal128& value) {
+    return static_cast<int64_t>(value.low_bits());
+  }
+
+  static void Store(int64_t value, uint64_t* out) {
+    out[0] = BitUtil::ToLittleEndian(static_cast<uint64_t>(value));
+    out[1] = BitUtil::ToLittleEndian(value < 0 ? ~uint64_t(0) : uint64_t(0));
+  }
+};
+
+template <>
+struct DecimalAccess<Decimal128> {
+  using ArrayType = DecimalArray128;
+
+  static Decimal128 FromScalar(const Decimal128& value) { return value; }
+
+  static void Store(const Decimal128& value, uint64_t* out) {
+    value.ToBytes(reinterpret_cast<uint8_t*>(out));
+  }
+};
+
+// Call func with the decimal operands wrapped for element access as T
+template <typename T, typename Function>
+void VisitDecimalOperands(const Datum& left, const Datum& right, Function&& func) {
+  using Access = DecimalAccess<T>;
+  using ArrayType = typename Access::ArrayType;
+  auto scalar = [](const Datum& operand) {
+    return ScalarOperand<T>{Access::FromScalar(
+        checked_cast<const Decimal128Scalar&>(*operand.scalar()).value)};
+  };
+  if (left.kind() == Datum::ARRAY && right.kind() == Datum::ARRAY) {
+    func(ArrayType(*left.array()), ArrayType(*right.array()));
+  } else if (left.kind() == Datum::ARRAY) {
+    func(ArrayType(*left.array()), scalar(right));
+  } else {
+    func(scalar(left), ArrayType(*right.array()));
+  }
+}
+
+template <typename T>
+T PowerOfTen(int32_t exponent) {
+  T power = 1;
+  for (int32_t i = 0; i < exponent; ++i) {
+    power = MultiplyOp::Call<T>(power, 10);
+  }
+  return power;
+}
+
+// Bring a value to the scale of the result by its multiplier, wrapping around
+// like the operations
+template <typename T>
+T Rescale(const T& value, const T& multiplier) {
+  return multiplier == 1 ? value : MultiplyOp::Call<T>(value, multiplier);
+}
+
+template <typename Op, typename T>
+struct DecimalLoopVisitor {
+  T left_multiplier;
+  T right_multiplier;
+  int64_t length;
+  uint64_t* dest;
+
+  template <typename Left, typename Right>
+  void operator()(const Left& left, const Right& right) const {
+    for (int64_t i = 0; i < length; ++i) {
+      DecimalAccess<T>::Store(Op::template Call<T>(Rescale(left[i], left_multiplier),
+                                                   Rescale(right[i], right_multiplier)),
+                              dest + 2 * i);
+    }
+  }
+};
+
+// Decimal operands may have different precisions and scales, the result has
+// one that holds every value of the operation as by GetDecimalResult. When its
+// precision is at most 18 digits, the values and the result fit in 64 bits and
+// are computed as int64_t, otherwise as Decimal128. Precisions are capped at
+// 38 digits, beyond which results wrap around as with the Decimal128
+// operators.
+template <typename Op>
+class DecimalArithmeticKernel : public BinaryKernel {
+ public:
+  Status Call(FunctionContext* ctx, const Datum& left, const Datum& right,
+              Datum* out) override {
+    int64_t length;
+    RETURN_NOT_OK(CheckOperandKinds(left, right, &length));
+    if (left.type()->id() != Type::DECIMAL || right.type()->id() != Type::DECIMAL) {
+      std::stringstream ss;
+      ss << "Operands must both be decimals, got " << left.type()->ToString() << " and "
+         << right.type()->ToString();
+      return Status::Invalid(ss.str());
+    }
+    const auto& left_type = checked_cast<const Decimal128Type&>(*left.type());
+    const auto& right_type = checked_cast<const Decimal128Type&>(*right.type());
+    const DecimalResult result_type = GetDecimalResult<Op>(left_type, right_type);
+    if (result_type.scale > kMaxDecimalPrecision) {
+      std::stringstream ss;
+      ss << "The result of " << left_type.ToString() << " and " << right_type.ToString()
+         << " would have a scale of more than " << kMaxDecimalPrecision;
+      return Status::Invalid(ss.str());
+    }
+
+    auto type = decimal(std::min(result_type.precision, kMaxDecimalPrecision),
+                        result_type.scale);
+    auto result = std::make_shared<ArrayData>(type, length);
+    result->buffers.resize(2);
+    RETURN_NOT_OK(ComputeValidity(ctx, left, right, result.get()));
+
+    RETURN_NOT_OK(ctx->Allocate(length * 16, &result->buffers[1]));
+    auto dest = reinterpret_cast<uint64_t*>(result->buffers[1]->mutable_data());
+    // Products have the scale of the product of the values
+    const bool rescale = !std::is_same<Op, MultiplyOp>::value;
+    const int32_t left_shift = rescale ? result_type.scale - left_type.scale() : 0;
+    const int32_t right_shift = rescale ? result_type.scale - right_type.scale() : 0;
+    if (result_type.precision <= kMaxInt64DecimalPrecision) {
+      VisitDecimalOperands<int64_t>(
+          left, right,
+          DecimalLoopVisitor<Op, int64_t>{PowerOfTen<int64_t>(left_shift),
+                                          PowerOfTen<int64_t>(right_shift), length,
+                                          dest});
+    } else {
+      VisitDecimalOperands<Decimal128>(
+          left, right,
+          DecimalLoopVisitor<Op, Decimal128>{PowerOfTen<Decimal128>(left_shift),
+                                             PowerOfTen<Decimal128>(right_shift),
+                                             length, dest});
+    }
+    *out = Datum(result);
+    return Status::OK();
+  }
+};
+
+template <typename Op>
+Status MakeDecimalArithmeticKernel(std::unique_ptr<BinaryKernel>* kernel) {
+  kernel->reset(new DecimalArithmeticKernel<Op>());
+  return Status::OK();
+}
+
+template <>
+Status MakeDecimalArithmeticKernel<DivideOp>(std::unique_ptr<BinaryKernel>*) {
+  return Status::NotImplemented("Division of decimals");
+}
+
+// ----------------------------------------------------------------------
+// Comparisons
+
+template <typename Type, typename Op>
+class CompareKernel : public BinaryKernel {
+ public:
+  using T = typename Type::c_type;
+
+  Status Call(FunctionContext* ctx, const Datum& left, const Datum& right,
+              Datum* out) override {
+    int64_t length;
+    RETURN_NOT_OK(CheckOperands(left, right, &length));
+    auto result = std::make_shared<ArrayData>(boolean(), length);
+    result->buffers.resize(2);
+    RETURN_NOT_OK(ComputeValidity(ctx, left, right, result.get()));
+
+    RETURN_NOT_OK(GetEmptyBitmap(ctx->memory_pool(), length, &result->buffers[1]));
+    VisitOperands<Type>(left, right, Apply{result->buffers[1]->mutable_data(), length});
+    *out = Datum(result);
+    return Status::OK();
+  }
+
+ private:
+  // Pack the comparison results eight at a time
+  struct Apply {
+    uint8_t* dest;
+    int64_t length;
+
+    template <typename Left, typename Right>
+    void operator()(const Left& left, const Right& right) const {
+      const int64_t num_bytes = length / 8;
+      for (int64_t byte = 0; byte < num_bytes; ++byte) {
+        const int64_t i = byte * 8;
+        uint8_t bits = 0;
+        for (int j = 0; j < 8; ++j) {
+          bits |= static_cast<uint8_t>(Op::Call(left[i + j], right[i + j]) << j);
+        }
+        dest[byte] = bits;
+      }
+      for (int64_t i = num_bytes * 8; i < length; ++i) {
+        if (Op::Call(left[i], right[i])) {
+          BitUtil::SetBit(dest, i);
+        }
+      }
+    }
+  };
+};
+
+// ----------------------------------------------------------------------
+// Kernel dispatch
+
+#define NUMERIC_KERNEL_CASES(KERNEL_CASE) \
+  KERNEL_CASE(UInt8Type);                 \
+  KERNEL_CASE(Int8Type);                  \
+  KERNEL_CASE(UInt16Type);                \
+  KERNEL_CASE(Int16Type);                 \
+  KERNEL_CASE(UInt32Type);                \
+  KERNEL_CASE(Int32Type);                 \
+  KERNEL_CASE(UInt64Type);                \
+  KERNEL_CASE(Int64Type);                 \
+  KERNEL_CASE(FloatType);                 \
+  KERNEL_CASE(DoubleType)
+
+template <typename Op>
+Status RegisterArithmeticFunctions(KernelRegistry* registry,
+                                   const std::string& op_name) {
+#define REGISTER_CASE(InType) \
+  RETURN_NOT_OK((RegisterArithmeticFunction<InType, Op>(registry, op_name)))
+
+  NUMERIC_KERNEL_CASES(REGISTER_CASE);
+
+#undef REGISTER_CASE
+
+  return Status::OK();
+}
+
+// Register the arithmetic functions with the kernel registry on first use
+Status EnsureArithmeticFunctionsRegistered() {
+  static std::once_flag registered;
+  static Status status;
+  std::call_once(registered, []() {
+    KernelRegistry* registry = KernelRegistry::GetInstance();
+    status = RegisterArithmeticFunctions<AddOp>(registry, "add");
+    if (status.ok()) {
+      status = RegisterArithmeticFunctions<SubtractOp>(registry, "subtract");
+    }
+    if (status.ok()) {
+      status = RegisterArithmeticFunctions<MultiplyOp>(registry, "multiply");
+    }
+    if (status.ok()) {
+      status = RegisterArithmeticFunctions<DivideOp>(registry, "divide");
+    }
+  });
+  return status;
+}
+
+template <typename Op>
+Status MakeArithmeticKernel(const std::string& op_name,
+                            const std::shared_ptr<DataType>& type,
+                            std::unique_ptr<BinaryKernel>* kernel) {
+  if (type->id() == Type::DECIMAL) {
+    return MakeDecimalArithmeticKernel<Op>(kernel);
+  }
+  RETURN_NOT_OK(EnsureArithmeticFunctionsRegistered());
+  KernelRegistry* registry = KernelRegistry::GetInstance();
+
+#define ARITHMETIC_CASE(InType)                                                    \
+  case InType::type_id: {                                                          \
+    ArithmeticFunction<InType>* function;                                          \
+    RETURN_NOT_OK(registry->Get(ArithmeticFunctionName(op_name, *type), &function)); \
+    kernel->reset(new ArithmeticKernel<InType, Op>(type, function));               \
+  } break
+
+  switch (type->id()) {
+    NUMERIC_KERNEL_CASES(ARITHMETIC_CASE);
+    default:
+      break;
+  }
+
+#undef ARITHMETIC_CASE
+
+  if (*kernel == nullptr) {
+    std::stringstream ss;
+    ss << "No arithmetic kernel for type " << type->ToString();
+    return Status::NotImplemented(ss.str());
+  }
+  return Status::OK();
+}
+
+template <typename Op>
+Status MakeCompareKernel(const std::shared_ptr<DataType>& type,
+                         std::unique_ptr<BinaryKernel>* kernel) {
+#define COMPARE_CASE(InType)                       \
+  case InType::type_id:                            \
+    kernel->reset(new CompareKernel<InType, Op>()); \
+    break
+
+  switch (type->id()) {
+    NUMERIC_KERNEL_CASES(COMPARE_CASE);
+    default:
+      break;
+  }
+
+#undef COMPARE_CASE
+
+  if (*kernel == nullptr) {
+    std::stringstream ss;
+    ss << "No comparison kernel for type " << type->ToString();
+    return Status::NotImplemented(ss.str());
+  }
+  return Status::OK();
+}
+
+#undef NUMERIC_KERNEL_CASES
+
+// The type of the operands, that of the array one if the other is a scalar
+Status GetOperandType(const Datum& left, const Datum& right,
+                      std::shared_ptr<DataType>* type) {
+  *type = left.kind() == Datum::SCALAR ? right.type() : left.type();
+  if (*type == nullptr) {
+    return Status::Invalid("Elementwise functions need typed operands");
+  }
+  return Status::OK();
+}
+
+bool IsDictionaryArray(const Datum& operand) {
+  return operand.kind() == Datum::ARRAY && operand.type()->id() == Type::DICTIONARY;
+}
+
+// Compare a dictionary array with a scalar by comparing the dictionary once
+// and taking the results by the indices
+Status CompareDictionary(FunctionContext* ctx, CompareOp::type op, const Datum& left,
+                         const Datum& right, Datum* out) {
+  const bool dictionary_left = IsDictionaryArray(left);
+  const Datum& other = dictionary_left ? right : left;
+  if (other.kind() != Datum::SCALAR) {
+    return Status::NotImplemented(
+        "Dictionary arrays can only be compared with scalars of their value type");
+  }
+  DictionaryArray array(dictionary_left ? left.array() : right.array());
+  const Datum dictionary(array.dictionary());
+
+  Datum dictionary_result;
+  RETURN_NOT_OK(Compare(ctx, op, dictionary_left ? dictionary : other,
+                        dictionary_left ? other : dictionary, &dictionary_result));
+  std::shared_ptr<Array> result;
+  RETURN_NOT_OK(
+      Take(ctx, *MakeArray(dictionary_result.array()), *array.indices(), &result));
+  *out = Datum(result);
+  return Status::OK();
+}
+
+bool IsRunLengthEncodedArray(const Datum& operand) {
+  return operand.kind() == Datum::ARRAY &&
+         operand.type()->id() == Type::RUN_LENGTH_ENCODED;
+}
+
+// Compare a run-length-encoded array with a scalar by comparing a value per
+// run, the results keeping the runs of the array
+Status CompareRunLengthEncoded(FunctionContext* ctx, CompareOp::type op,
+                               const Datum& left, const Datum& right, Datum* out) {
+  const bool encoded_left = IsRunLengthEncodedArray(left);
+  const Datum& other = encoded_left ? right : left;
+  if (other.kind() != Datum::SCALAR) {
+    return Status::NotImplemented(
+        "Run-length-encoded arrays can only be compared with scalars of their value "
+        "type");
+  }
+  const ArrayData& data = *(encoded_left ? left.array() : right.array());
+  const Datum values(data.child_data[0]);
+
+  Datum values_result;
+  RETURN_NOT_OK(Compare(ctx, op, encoded_left ? values : other,
+                        encoded_left ? other : values, &values_result));
+  auto result = ArrayData::Make(run_length_encoded(boolean()), data.length,
+                                {nullptr, data.buffers[1]}, /*null_count=*/0,
+                                data.offset);
+  result->child_data.push_back(values_result.array());
+  *out = Datum(result);
+  return Status::OK();
+}
+
+}  // namespace
+
+Status GetArithmeticKernel(FunctionContext* ctx, ArithmeticOp::type op,
+                           const std::shared_ptr<DataType>& type,
+                           std::unique_ptr<BinaryKernel>* kernel) {
+  kernel->reset();
+  switch (op) {
+    case ArithmeticOp::ADD:
+      return MakeArithmeticKernel<AddOp>("add", type, kernel);
+    case ArithmeticOp::SUBTRACT:
+      return MakeArithmeticKernel<SubtractOp>("subtract", type, kernel);
+    case ArithmeticOp::MULTIPLY:
+      return MakeArithmeticKernel<MultiplyOp>("multiply", type, kernel);
+    case ArithmeticOp::DIVIDE:
+      return MakeArithmeticKernel<DivideOp>("divide", type, kernel);
+  }
+  return Status::Invalid("Unknown arithmetic operation");
+}
+
+Status GetCompareKernel(FunctionContext* ctx, CompareOp::type op,
+                        const std::shared_ptr<DataType>& type,
+                        std::unique_ptr<BinaryKernel>* kernel) {
+  kernel->reset();
+  switch (op) {
+    case CompareOp::EQUAL:
+      return MakeCompareKernel<EqualOp>(type, kernel);
+    case CompareOp::NOT_EQUAL:
+      return MakeCompareKernel<NotEqualOp>(type, kernel);
+    case CompareOp::LESS:
+      return MakeCompareKernel<LessOp>(type, kernel);
+    case CompareOp::LESS_EQUAL:
+      return MakeCompareKernel<LessEqualOp>(type, kernel);
+    case CompareOp::GREATER:
+      return MakeCompareKernel<GreaterOp>(type, kernel);
+    case CompareOp::GREATER_EQUAL:
+      return MakeCompareKernel<GreaterEqualOp>(type, kernel);
+  }
+  return Status::Invalid("Unknown comparison");
+}
+
+Status Arithmetic(FunctionContext* ctx, ArithmeticOp::type op, const Datum& left,
+                  const Datum& right, Datum* out) {
+  std::shared_ptr<DataType> type;
+  RETURN_NOT_OK(GetOperandType(left, right, &type));
+  std::unique_ptr<BinaryKernel> kernel;
+  RETURN_NOT_OK(GetArithmeticKernel(ctx, op, type, &kernel));
+  return kernel->Call(ctx, left, right, out);
+}
+
+Status Add(FunctionContext* ctx, const Datum& left, const Datum& right, Datum* out) {
+  return Arithmetic(ctx, ArithmeticOp::ADD, left, right, out);
+}
+
+Status Subtract(FunctionContext* ctx, const Datum& left, const Datum& right,
+                Datum* out) {
+  return Arithmetic(ctx, ArithmeticOp::SUBTRACT, left, right, out);
+}
+
+Status Multiply(FunctionContext* ctx, const Datum& left, const Datum& right,
+                Datum* out) {
+  return Arithmetic(ctx, ArithmeticOp::MULTIPLY, left, right, out);
+}
+
+Status Divide(FunctionContext* ctx, const Datum& left, const Datum& right, Datum* out) {
+  return Arithmetic(ctx, ArithmeticOp::DIVIDE, left, right, out);
+}
+
+Status Compare(FunctionContext* ctx, CompareOp::type op, const Datum& left,
+               const Datum& right, Datum* out) {
+  if (IsDictionaryArray(left) || IsDictionaryArray(right)) {
+    return CompareDictionary(ctx, op, left, right, out);
+  }
+  if (IsRunLengthEncodedArray(left) || IsRunLengthEncodedArray(right)) {
+    return CompareRunLengthEncoded(ctx, op, left, right, out);
+  }
+  std::shared_ptr<DataType> type;
+  RETURN_NOT_OK(GetOperandType(left, right, &type));
+  std::unique_ptr<BinaryKernel> kernel;
+  RETURN_NOT_OK(GetCompareKernel(ctx, op, type, &kernel));
+  return kernel->Call(ctx, left, right, out);
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,132 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_COMPUTE_KERNELS_ARITHMETIC_H
+#define ARROW_COMPUTE_KERNELS_ARITHMETIC_H
+
+#include <memory>
+
+#include "arrow/compute/kernel.h"
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class DataType;
+
+namespace compute {
+
+class FunctionContext;
+
+// ----------------------------------------------------------------------
+// Elementwise arithmetic and comparisons
+//
+// These apply to two operands of the same integer or floating point type:
+// either two arrays of the same length, or an array and a scalar which is
+// broadcast to every position of the array. Results are null wherever an
+// operand is null; the validity bitmaps of array operands are combined 64 bits
+// at a time. The inner loops are plain loops over contiguous values that the
+// compiler vectorizes with the instruction set the library is built for.
+//
+// Decimals can be added, subtracted and multiplied, with operands of any
+// precision and scale: sums and differences are computed at the larger scale
+// of the operands, products at the sum of their scales. Results of up to 18
+// digits are computed in 64 bits.
+
+/// \brief The arithmetic operations
+struct ARROW_EXPORT ArithmeticOp {
+  enum type {
+    /// Integers wrap around on overflow
+    ADD,
+    SUBTRACT,
+    MULTIPLY,
+    /// Integer division truncates towards zero and fails on division by zero
+    DIVIDE
+  };
+};
+
+/// \brief The comparison operations
+struct ARROW_EXPORT CompareOp {
+  enum type { EQUAL, NOT_EQUAL, LESS, LESS_EQUAL, GREATER, GREATER_EQUAL };
+};
+
+ARROW_EXPORT
+Status GetArithmeticKernel(FunctionContext* context, ArithmeticOp::type op,
+                           const std::shared_ptr<DataType>& type,
+                           std::unique_ptr<BinaryKernel>* kernel);
+
+ARROW_EXPORT
+Status GetCompareKernel(FunctionContext* context, CompareOp::type op,
+                        const std::shared_ptr<DataType>& type,
+                        std::unique_ptr<BinaryKernel>* kernel);
+
+/// \brief Apply an arithmetic operation elementwise
+/// \param[in] context the FunctionContext
+/// \param[in] op the operation
+/// \param[in] left array or scalar
+/// \param[in] right array or scalar, at least one of the operands being an
+/// array
+/// \param[out] out array of the type of the operands, or a decimal holding
+/// the results of decimal operands
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Arithmetic(FunctionContext* context, ArithmeticOp::type op, const Datum& left,
+                  const Datum& right, Datum* out);
+
+/// \brief Add two operands elementwise
+ARROW_EXPORT
+Status Add(FunctionContext* context, const Datum& left, const Datum& right, Datum* out);
+
+/// \brief Subtract the right operand from the left one elementwise
+ARROW_EXPORT
+Status Subtract(FunctionContext* context, const Datum& left, const Datum& right,
+                Datum* out);
+
+/// \brief Multiply two operands elementwise
+ARROW_EXPORT
+Status Multiply(FunctionContext* context, const Datum& left, const Datum& right,
+                Datum* out);
+
+/// \brief Divide the left operand by the right one elementwise
+ARROW_EXPORT
+Status Divide(FunctionContext* context, const Datum& left, const Datum& right,
+              Datum* out);
+
+/// \brief Compare two operands elementwise
+///
+/// A dictionary array can be compared with a scalar of its value type: the
+/// dictionary is compared once and the results taken by the indices. A
+/// run-length-encoded array can be too, with a comparison per run, giving a
+/// run-length-encoded boolean array of the same runs.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] op the comparison
+/// \param[in] left array or scalar
+/// \param[in] right array or scalar, at least one of the operands being an
+/// array
+/// \param[out] out boolean array, true where left op right holds
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Compare(FunctionContext* context, CompareOp::type op, const Datum& left,
+               const Datum& right, Datum* out);
+
+}  // namespace compute
+}  // namespace arrow
+
+#endif  // ARROW_COMPUTE_KERNELS_ARITHMETIC_H
@@ -17,7 +17,11 @@
 
 #include "arrow/compute/kernels/cast.h"
 
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include <cstdint>
+#include <cstdlib>
 #include <cstring>
 #include <functional>
 #include <limits>
@@ -36,11 +40,14 @@
 #include "arrow/type_traits.h"
 #include "arrow/util/bit-util.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/decimal.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/parsing.h"
 
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/take.h"
 #include "arrow/compute/kernels/util-internal.h"
 
 #ifdef ARROW_EXTRA_ERROR_CONTEXT
@@ -206,6 +213,23 @@ struct CastFunctor<O, I,
   }
 };
 
+// The values of I::c_type that O::c_type can represent are those in
+// [kMin, kMax]
+template <typename O, typename I>
+struct IntegerDowncastBounds {
+  using in_type = typename I::c_type;
+  using out_type = typename O::c_type;
+
+  // The maximum of a downcast is always representable in the input type; the
+  // minimum is zero unless both types are signed
+  static constexpr in_type kMax =
+      static_cast<in_type>(std::numeric_limits<out_type>::max());
+  static constexpr in_type kMin =
+      std::is_signed<in_type>::value && std::is_signed<out_type>::value
+          ? static_cast<in_type>(std::numeric_limits<out_type>::min())
+          : 0;
+};
+
 template <typename O, typename I>
 struct CastFunctor<O, I,
                    typename std::enable_if<is_integer_downcast<O, I>::value>::type> {
@@ -214,39 +238,50 @@ struct CastFunctor<O, I,
     using in_type = typename I::c_type;
     using out_type = typename O::c_type;
 
-    auto in_offset = input.offset;
-
     const in_type* in_data = GetValues<in_type>(input, 1);
     auto out_data = GetMutableValues<out_type>(output, 1);
 
-    if (!options.allow_int_overflow) {
-      constexpr in_type kMax = static_cast<in_type>(std::numeric_limits<out_type>::max());
-      constexpr in_type kMin = static_cast<in_type>(std::numeric_limits<out_type>::min());
+    if (options.allow_int_overflow) {
+      for (int64_t i = 0; i < input.length; ++i) {
+        out_data[i] = static_cast<out_type>(in_data[i]);
+      }
+      return;
+    }
 
-      // Null count may be -1 if the input array had been sliced
-      if (input.null_count != 0) {
-        internal::BitmapReader is_valid_reader(input.buffers[0]->data(), in_offset,
-                                               input.length);
-        for (int64_t i = 0; i < input.length; ++i) {
-          if (ARROW_PREDICT_FALSE(is_valid_reader.IsSet() &&
-                                  (*in_data > kMax || *in_data < kMin))) {
-            ctx->SetStatus(Status::Invalid("Integer value out of bounds"));
+    // Blocks of 64 values are checked by reducing them to their minimum and
+    // maximum and comparing those to the bounds, then converted, in loops
+    // without branches that the compiler vectorizes. Null slots are replaced
+    // by zero for the reduction, and blocks with no valid values are not
+    // reduced at all.
+    constexpr in_type kMin = IntegerDowncastBounds<O, I>::kMin;
+    constexpr in_type kMax = IntegerDowncastBounds<O, I>::kMax;
+
+    bool out_of_bounds = false;
+    VisitValidityBlocks(input, [&](int64_t position, int64_t length, uint64_t valid) {
+      const in_type* values = in_data + position;
+      if (valid != 0 && !out_of_bounds) {
+        in_type block_min = 0;
+        in_type block_max = 0;
+        if (valid == AllValid(length)) {
+          for (int64_t j = 0; j < length; ++j) {
+            block_min = std::min(block_min, values[j]);
+            block_max = std::max(block_max, values[j]);
           }
-          *out_data++ = static_cast<out_type>(*in_data++);
-          is_valid_reader.Next();
-        }
-      } else {
-        for (int64_t i = 0; i < input.length; ++i) {
-          if (ARROW_PREDICT_FALSE(*in_data > kMax || *in_data < kMin)) {
-            ctx->SetStatus(Status::Invalid("Integer value out of bounds"));
+        } else {
+          for (int64_t j = 0; j < length; ++j) {
+            const in_type value = ((valid >> j) & 1) ? values[j] : 0;
+            block_min = std::min(block_min, value);
+            block_max = std::max(block_max, value);
           }
-          *out_data++ = static_cast<out_type>(*in_data++);
         }
+        out_of_bounds = block_min < kMin || block_max > kMax;
       }
-    } else {
-      for (int64_t i = 0; i < input.length; ++i) {
-        *out_data++ = static_cast<out_type>(*in_data++);
+      for (int64_t j = 0; j < length; ++j) {
+        out_data[position + j] = static_cast<out_type>(values[j]);
       }
+    });
+    if (ARROW_PREDICT_FALSE(out_of_bounds)) {
+      ctx->SetStatus(Status::Invalid("Integer value out of bounds"));
     }
   }
 };
@@ -268,6 +303,593 @@ struct CastFunctor<O, I,
   }
 };
 
+// ----------------------------------------------------------------------
+// Decimals to and from numbers and other decimals
+//
+// Values of at most 18 digits are converted with 64-bit integers, wider ones
+// as Decimal128. The loops don't branch on the validity of the slots: the
+// errors of every value are computed and those of the valid ones collected a
+// block at a time.
+
+constexpr int32_t kMaxInt64DecimalDigits = 18;
+
+enum DecimalCastError : uint8_t { kDecimalOverflow = 1, kDecimalTruncation = 2 };
+
+static const uint8_t* DecimalValues(const ArrayData& data) {
+  return data.buffers[1]->data() + data.offset * 16;
+}
+
+static uint8_t* MutableDecimalValues(ArrayData* data) {
+  return data->buffers[1]->mutable_data() + data->offset * 16;
+}
+
+static inline int64_t LoadDecimal64(const uint8_t* value) {
+  uint64_t low;
+  std::memcpy(&low, value, sizeof(low));
+  return static_cast<int64_t>(BitUtil::FromLittleEndian(low));
+}
+
+static inline void StoreDecimal64(int64_t value, uint8_t* out) {
+  const uint64_t words[2] = {
+      BitUtil::ToLittleEndian(static_cast<uint64_t>(value)),
+      BitUtil::ToLittleEndian(value < 0 ? ~uint64_t(0) : uint64_t(0))};
+  std::memcpy(out, words, sizeof(words));
+}
+
+static inline int64_t WrappingMultiply(int64_t left, int64_t right) {
+  return static_cast<int64_t>(static_cast<uint64_t>(left) * static_cast<uint64_t>(right));
+}
+
+// The kernels scale by integer powers of ten
+static Status CheckDecimalScale(const Decimal128Type& type) {
+  if (type.scale() < 0) {
+    return Status::NotImplemented("Casting decimals of negative scale");
+  }
+  return Status::OK();
+}
+
+template <typename T>
+static T PowerOfTen(int32_t exponent) {
+  T power = 1;
+  for (int32_t i = 0; i < exponent; ++i) {
+    power *= 10;
+  }
+  return power;
+}
+
+template <typename T>
+static typename std::enable_if<std::is_signed<T>::value, uint64_t>::type UnsignedAbs(
+    T value) {
+  const auto wide = static_cast<uint64_t>(static_cast<int64_t>(value));
+  return value < 0 ? ~wide + 1 : wide;
+}
+
+template <typename T>
+static typename std::enable_if<std::is_unsigned<T>::value, uint64_t>::type UnsignedAbs(
+    T value) {
+  return value;
+}
+
+template <typename T>
+static Decimal128 IntegerToDecimal(T value) {
+  return std::is_signed<T>::value
+             ? Decimal128(static_cast<int64_t>(value))
+             : Decimal128(0, static_cast<uint64_t>(value));
+}
+
+// Whether the value is within the range of T
+template <typename T>
+static bool FitsIn(int64_t value) {
+  using Limits = std::numeric_limits<T>;
+  return std::is_signed<T>::value || sizeof(T) < sizeof(int64_t)
+             ? value >= static_cast<int64_t>(Limits::min()) &&
+                   value <= static_cast<int64_t>(Limits::max())
+             : value >= 0;
+}
+
+template <typename T>
+static bool FitsIn(const Decimal128& value) {
+  using Limits = std::numeric_limits<T>;
+  return value >= IntegerToDecimal(Limits::min()) &&
+         value <= IntegerToDecimal(Limits::max());
+}
+
+// Call convert(i) for every slot of the input, which converts the value and
+// returns its errors, and report those of the valid slots that the options
+// don't allow
+template <typename Convert>
+static void ConvertDecimals(FunctionContext* ctx, const CastOptions& options,
+                            const ArrayData& input, Convert&& convert) {
+  uint8_t errors = 0;
+  VisitValidityBlocks(input, [&](int64_t position, int64_t length, uint64_t valid) {
+    uint8_t block_errors = 0;
+    for (int64_t j = 0; j < length; ++j) {
+      const uint8_t value_errors = convert(position + j);
+      block_errors |= ((valid >> j) & 1) ? value_errors : 0;
+    }
+    errors |= block_errors;
+  });
+  if (options.allow_int_overflow) {
+    errors &= ~kDecimalOverflow;
+  }
+  if (options.allow_decimal_truncate) {
+    errors &= ~kDecimalTruncation;
+  }
+  if (ARROW_PREDICT_FALSE(errors & kDecimalOverflow)) {
+    ctx->SetStatus(Status::Invalid("Decimal value out of bounds"));
+  } else if (ARROW_PREDICT_FALSE(errors & kDecimalTruncation)) {
+    ctx->SetStatus(Status::Invalid("Decimal value would lose digits"));
+  }
+}
+
+// Integers are multiplied by ten to the scale, and overflow if they have more
+// digits than the precision leaves to the integer part
+template <typename I>
+struct CastFunctor<Decimal128Type, I,
+                   typename std::enable_if<std::is_base_of<Integer, I>::value>::type> {
+  void operator()(FunctionContext* ctx, const CastOptions& options,
+                  const ArrayData& input, ArrayData* output) {
+    using in_type = typename I::c_type;
+    const auto& type = checked_cast<const Decimal128Type&>(*output->type);
+    FUNC_RETURN_NOT_OK(CheckDecimalScale(type));
+    const in_type* in_data = GetValues<in_type>(input, 1);
+    uint8_t* out_data = MutableDecimalValues(output);
+
+    // 64-bit integers have at most 20 digits
+    const int32_t integer_digits = type.precision() - type.scale();
+    const uint64_t bound = integer_digits < 20 ? PowerOfTen<uint64_t>(integer_digits) : 0;
+    const auto overflows = [bound](in_type value) -> uint8_t {
+      return bound != 0 && UnsignedAbs(value) >= bound ? kDecimalOverflow : 0;
+    };
+
+    if (type.precision() <= kMaxInt64DecimalDigits) {
+      const int64_t multiplier = PowerOfTen<int64_t>(type.scale());
+      ConvertDecimals(ctx, options, input, [&](int64_t i) {
+        const in_type value = in_data[i];
+        StoreDecimal64(WrappingMultiply(static_cast<int64_t>(value), multiplier),
+                       out_data + 16 * i);
+        return overflows(value);
+      });
+    } else {
+      const Decimal128 multiplier = PowerOfTen<Decimal128>(type.scale());
+      ConvertDecimals(ctx, options, input, [&](int64_t i) {
+        const in_type value = in_data[i];
+        (IntegerToDecimal(value) * multiplier).ToBytes(out_data + 16 * i);
+        return overflows(value);
+      });
+    }
+  }
+};
+
+// Decimals are divided by ten to the scale, truncating towards zero
+template <typename O>
+struct CastFunctor<O, Decimal128Type,
+                   typename std::enable_if<std::is_base_of<Integer, O>::value>::type> {
+  void operator()(FunctionContext* ctx, const CastOptions& options,
+                  const ArrayData& input, ArrayData* output) {
+    using out_type = typename O::c_type;
+    const auto& type = checked_cast<const Decimal128Type&>(*input.type);
+    FUNC_RETURN_NOT_OK(CheckDecimalScale(type));
+    const uint8_t* in_data = DecimalValues(input);
+    auto out_data = GetMutableValues<out_type>(output, 1);
+
+    if (type.precision() <= kMaxInt64DecimalDigits) {
+      const int64_t divisor = PowerOfTen<int64_t>(type.scale());
+      ConvertDecimals(ctx, options, input, [&](int64_t i) {
+        const int64_t value = LoadDecimal64(in_data + 16 * i);
+        const int64_t quotient = value / divisor;
+        out_data[i] = static_cast<out_type>(quotient);
+        return static_cast<uint8_t>((FitsIn<out_type>(quotient) ? 0 : kDecimalOverflow) |
+                                    (value % divisor == 0 ? 0 : kDecimalTruncation));
+      });
+    } else {
+      const Decimal128 divisor = PowerOfTen<Decimal128>(type.scale());
+      ConvertDecimals(ctx, options, input, [&](int64_t i) {
+        Decimal128 quotient, remainder;
+        DCHECK_OK(Decimal128(in_data + 16 * i).Divide(divisor, &quotient, &remainder));
+        out_data[i] = static_cast<out_type>(quotient.low_bits());
+        return static_cast<uint8_t>((FitsIn<out_type>(quotient) ? 0 : kDecimalOverflow) |
+                                    (remainder == 0 ? 0 : kDecimalTruncation));
+      });
+    }
+  }
+};
+
+// Floating point values are multiplied by ten to the scale and rounded to the
+// nearest integer, those out of the range of the precision and NaNs overflow
+// and become zero
+template <typename I>
+struct CastFunctor<
+    Decimal128Type, I,
+    typename std::enable_if<std::is_base_of<FloatingPoint, I>::value>::type> {
+  void operator()(FunctionContext* ctx, const CastOptions& options,
+                  const ArrayData& input, ArrayData* output) {
+    using in_type = typename I::c_type;
+    const auto& type = checked_cast<const Decimal128Type&>(*output->type);
+    const in_type* in_data = GetValues<in_type>(input, 1);
+    uint8_t* out_data = MutableDecimalValues(output);
+
+    const double multiplier = std::pow(10.0, type.scale());
+    const double bound = std::pow(10.0, type.precision());
+    if (type.precision() <= kMaxInt64DecimalDigits) {
+      ConvertDecimals(ctx, options, input, [&](int64_t i) -> uint8_t {
+        const double value = std::round(static_cast<double>(in_data[i]) * multiplier);
+        const bool in_range = std::abs(value) < bound;
+        StoreDecimal64(in_range ? static_cast<int64_t>(value) : 0, out_data + 16 * i);
+        return in_range ? 0 : kDecimalOverflow;
+      });
+    } else {
+      constexpr double kTwoTo64 = 18446744073709551616.0;
+      ConvertDecimals(ctx, options, input, [&](int64_t i) -> uint8_t {
+        const double value = std::round(static_cast<double>(in_data[i]) * multiplier);
+        const double magnitude = std::abs(value);
+        const bool in_range = magnitude < bound;
+        Decimal128 decimal;
+        if (in_range) {
+          const double high = std::floor(magnitude / kTwoTo64);
+          decimal = Decimal128(static_cast<int64_t>(high),
+                               static_cast<uint64_t>(magnitude - high * kTwoTo64));
+          if (value < 0) {
+            decimal.Negate();
+          }
+        }
+        decimal.ToBytes(out_data + 16 * i);
+        return in_range ? 0 : kDecimalOverflow;
+      });
+    }
+  }
+};
+
+// Decimals are divided by ten to the scale as doubles, which round values of
+// more than 15 digits
+template <typename O>
+struct CastFunctor<
+    O, Decimal128Type,
+    typename std::enable_if<std::is_base_of<FloatingPoint, O>::value>::type> {
+  void operator()(FunctionContext* ctx, const CastOptions& options,
+                  const ArrayData& input, ArrayData* output) {
+    using out_type = typename O::c_type;
+    const auto& type = checked_cast<const Decimal128Type&>(*input.type);
+    const uint8_t* in_data = DecimalValues(input);
+    auto out_data = GetMutableValues<out_type>(output, 1);
+
+    const double divisor = std::pow(10.0, type.scale());
+    if (type.precision() <= kMaxInt64DecimalDigits) {
+      for (int64_t i = 0; i < input.length; ++i) {
+        const auto value = static_cast<double>(LoadDecimal64(in_data + 16 * i));
+        out_data[i] = static_cast<out_type>(value / divisor);
+      }
+    } else {
+      constexpr double kTwoTo64 = 18446744073709551616.0;
+      for (int64_t i = 0; i < input.length; ++i) {
+        const Decimal128 decimal(in_data + 16 * i);
+        const double value = static_cast<double>(decimal.high_bits()) * kTwoTo64 +
+                             static_cast<double>(decimal.low_bits());
+        out_data[i] = static_cast<out_type>(value / divisor);
+      }
+    }
+  }
+};
+
+// Decimals are multiplied or divided by ten to the difference of the scales,
+// truncating towards zero, and overflow if they have more digits than the
+// output precision
+template <>
+struct CastFunctor<Decimal128Type, Decimal128Type> {
+  void operator()(FunctionContext* ctx, const CastOptions& options,
+                  const ArrayData& input, ArrayData* output) {
+    const auto& in_type = checked_cast<const Decimal128Type&>(*input.type);
+    const auto& out_type = checked_cast<const Decimal128Type&>(*output->type);
+    FUNC_RETURN_NOT_OK(CheckDecimalScale(in_type));
+    FUNC_RETURN_NOT_OK(CheckDecimalScale(out_type));
+    const uint8_t* in_data = DecimalValues(input);
+    uint8_t* out_data = MutableDecimalValues(output);
+
+    const int32_t delta = out_type.scale() - in_type.scale();
+    // The rescaled value has fewer digits than the output precision exactly
+    // when the input value has fewer than this
+    const int32_t max_in_digits = out_type.precision() - delta;
+    const bool check_overflow = max_in_digits < in_type.precision();
+    if (delta == 0 && !check_overflow) {
+      std::memcpy(out_data, in_data, input.length * 16);
+      return;
+    }
+
+    // Scaling down by more digits than a decimal has makes it zero, as does
+    // scaling down by 38
+    const int32_t exponent = std::min(std::abs(delta), 38);
+    if (in_type.precision() + std::max(delta, 0) <= kMaxInt64DecimalDigits &&
+        exponent <= kMaxInt64DecimalDigits) {
+      const int64_t multiplier = PowerOfTen<int64_t>(exponent);
+      const int64_t bound =
+          check_overflow ? PowerOfTen<int64_t>(std::max(max_in_digits, 0)) : 0;
+      ConvertDecimals(ctx, options, input, [&](int64_t i) {
+        const int64_t value = LoadDecimal64(in_data + 16 * i);
+        const bool overflows = check_overflow && (value >= bound || value <= -bound);
+        if (delta >= 0) {
+          StoreDecimal64(WrappingMultiply(value, multiplier), out_data + 16 * i);
+          return static_cast<uint8_t>(overflows ? kDecimalOverflow : 0);
+        }
+        StoreDecimal64(value / multiplier, out_data + 16 * i);
+        return static_cast<uint8_t>((overflows ? kDecimalOverflow : 0) |
+                                    (value % multiplier == 0 ? 0 : kDecimalTruncation));
+      });
+    } else {
+      const Decimal128 multiplier = PowerOfTen<Decimal128>(exponent);
+      const Decimal128 bound =
+          check_overflow ? PowerOfTen<Decimal128>(std::max(max_in_digits, 0)) : 0;
+      ConvertDecimals(ctx, options, input, [&](int64_t i) {
+        const Decimal128 value(in_data + 16 * i);
+        const bool overflows = check_overflow && (value >= bound || value <= -bound);
+        if (delta >= 0) {
+          (value * multiplier).ToBytes(out_data + 16 * i);
+          return static_cast<uint8_t>(overflows ? kDecimalOverflow : 0);
+        }
+        Decimal128 quotient, remainder;
+        DCHECK_OK(value.Divide(multiplier, &quotient, &remainder));
+        quotient.ToBytes(out_data + 16 * i);
+        return static_cast<uint8_t>((overflows ? kDecimalOverflow : 0) |
+                                    (remainder == 0 ? 0 : kDecimalTruncation));
+      });
+    }
+  }
+};
+
+// ----------------------------------------------------------------------
+// From strings, by parsing them
+
+// Give the output a validity bitmap of its own, rather than one shared with
+// the input, so that slots can be nulled
+static Status MakeValidityMutable(FunctionContext* ctx, const ArrayData& input,
+                                  ArrayData* output) {
+  const std::shared_ptr<Buffer>& validity = output->buffers[0];
+  if (validity != nullptr && validity != input.buffers[0]) {
+    // Already copied because of an offset, or preallocated
+    return Status::OK();
+  }
+  std::shared_ptr<Buffer> copy;
+  const int64_t bitmap_size = BitUtil::BytesForBits(output->offset + input.length);
+  RETURN_NOT_OK(ctx->Allocate(bitmap_size, &copy));
+  if (input.buffers[0] == nullptr) {
+    memset(copy->mutable_data(), 0xff, bitmap_size);
+  } else {
+    CopyBitmap(input.buffers[0]->data(), input.offset, input.length,
+               copy->mutable_data(), output->offset);
+  }
+  output->buffers[0] = copy;
+  return Status::OK();
+}
+
+// Keep the null count of the output exact when it nulled num_nulls more
+// slots than the input has
+static void AddNullCount(const ArrayData& input, int64_t num_nulls, ArrayData* output) {
+  if (num_nulls > 0) {
+    output->null_count =
+        input.null_count >= 0 ? input.null_count + num_nulls : kUnknownNullCount;
+  }
+}
+
+// Parse every valid string of the input with parse(s, length, &value),
+// directly from the offsets and data of the array
+template <typename T, typename ParseFunc>
+void ParseStrings(FunctionContext* ctx, const CastOptions& options,
+                  const ArrayData& input, ArrayData* output, ParseFunc&& parse) {
+  const int32_t* offsets = GetValues<int32_t>(input, 1);
+  const char* data = input.buffers[2] == nullptr
+                         ? ""
+                         : reinterpret_cast<const char*>(input.buffers[2]->data());
+  auto out_data = GetMutableValues<T>(output, 1);
+
+  const uint8_t* in_validity = input.null_count != 0 && input.buffers[0] != nullptr
+                                   ? input.buffers[0]->data()
+                                   : nullptr;
+  uint8_t* out_validity = nullptr;
+  int64_t num_parse_errors = 0;
+  for (int64_t i = 0; i < input.length; ++i) {
+    if (in_validity != nullptr && !BitUtil::GetBit(in_validity, input.offset + i)) {
+      continue;
+    }
+    const char* s = data + offsets[i];
+    const size_t length = static_cast<size_t>(offsets[i + 1] - offsets[i]);
+    if (ARROW_PREDICT_TRUE(parse(s, length, out_data + i))) {
+      continue;
+    }
+    if (!options.null_on_parse_error) {
+      std::stringstream ss;
+      ss << "Cannot parse '" << std::string(s, length) << "' as a value of type "
+         << output->type->ToString();
+      ctx->SetStatus(Status::Invalid(ss.str()));
+      return;
+    }
+    if (out_validity == nullptr) {
+      FUNC_RETURN_NOT_OK(MakeValidityMutable(ctx, input, output));
+      out_validity = output->buffers[0]->mutable_data();
+    }
+    BitUtil::ClearBit(out_validity, output->offset + i);
+    out_data[i] = T();
+    ++num_parse_errors;
+  }
+  AddNullCount(input, num_parse_errors, output);
+}
+
+template <typename O>
+struct CastFunctor<O, StringType,
+                   typename std::enable_if<std::is_base_of<Integer, O>::value>::type> {
+  void operator()(FunctionContext* ctx, const CastOptions& options,
+                  const ArrayData& input, ArrayData* output) {
+    using out_type = typename O::c_type;
+    ParseStrings<out_type>(ctx, options, input, output, internal::ParseInteger<out_type>);
+  }
+};
+
+template <typename O>
+struct CastFunctor<
+    O, StringType,
+    typename std::enable_if<std::is_base_of<FloatingPoint, O>::value>::type> {
+  void operator()(FunctionContext* ctx, const CastOptions& options,
+                  const ArrayData& input, ArrayData* output) {
+    using out_type = typename O::c_type;
+    ParseStrings<out_type>(ctx, options, input, output, internal::ParseFloat<out_type>);
+  }
+};
+
+template <>
+struct CastFunctor<TimestampType, StringType> {
+  void operator()(FunctionContext* ctx, const CastOptions& options,
+                  const ArrayData& input, ArrayData* output) {
+    const TimeUnit::type unit = checked_cast<const TimestampType&>(*output->type).unit();
+    ParseStrings<int64_t>(ctx, options, input, output,
+                          [unit](const char* s, size_t length, int64_t* out) {
+                            return internal::ParseTimestamp(s, length, unit, out);
+                          });
+  }
+};
+
+// Decimals are brought to the scale of the output type, failing on values
+// that would lose digits or have more than its precision
+template <>
+struct CastFunctor<Decimal128Type, StringType> {
+  void operator()(FunctionContext* ctx, const CastOptions& options,
+                  const ArrayData& input, ArrayData* output) {
+    const auto& type = checked_cast<const Decimal128Type&>(*output->type);
+    const int32_t out_precision = type.precision();
+    const int32_t out_scale = type.scale();
+    ParseStrings<std::array<uint8_t, 16>>(
+        ctx, options, input, output,
+        [out_precision, out_scale](const char* s, size_t length,
+                                   std::array<uint8_t, 16>* out) {
+          Decimal128 value;
+          int32_t precision;
+          int32_t scale;
+          if (!Decimal128::FromString(s, length, &value, &precision, &scale).ok()) {
+            return false;
+          }
+          if (scale != out_scale) {
+            Decimal128 rescaled;
+            if (std::abs(out_scale - scale) > 38 ||
+                !value.Rescale(scale, out_scale, &rescaled).ok()) {
+              return false;
+            }
+            value = rescaled;
+            precision += out_scale - scale;
+          }
+          if (precision > out_precision) {
+            return false;
+          }
+          value.ToBytes(out->data());
+          return true;
+        });
+  }
+};
+
+// ----------------------------------------------------------------------
+// From decimals to strings, formatting into the output data
+
+static Status FormatDecimals(FunctionContext* ctx, const ArrayData& input,
+                             ArrayData* output) {
+  const int32_t scale = checked_cast<const Decimal128Type&>(*input.type).scale();
+  const uint8_t* values = DecimalValues(input);
+  const uint8_t* validity = input.null_count != 0 && input.buffers[0] != nullptr
+                                ? input.buffers[0]->data()
+                                : nullptr;
+
+  std::shared_ptr<Buffer> offsets_buffer;
+  RETURN_NOT_OK(ctx->Allocate((input.length + 1) * sizeof(int32_t), &offsets_buffer));
+  auto offsets = reinterpret_cast<int32_t*>(offsets_buffer->mutable_data());
+  BufferBuilder data_builder(ctx->memory_pool());
+
+  int32_t offset = 0;
+  char buffer[Decimal128::kMaxStringLength];
+  for (int64_t i = 0; i < input.length; ++i) {
+    offsets[i] = offset;
+    if (validity != nullptr && !BitUtil::GetBit(validity, input.offset + i)) {
+      continue;
+    }
+    const int32_t length = Decimal128(values + 16 * i).ToString(scale, buffer);
+    RETURN_NOT_OK(data_builder.Append(buffer, length));
+    offset += length;
+  }
+  offsets[input.length] = offset;
+
+  std::shared_ptr<Buffer> data;
+  RETURN_NOT_OK(data_builder.Finish(&data));
+  output->buffers.push_back(offsets_buffer);
+  output->buffers.push_back(data);
+  return Status::OK();
+}
+
+template <>
+struct CastFunctor<StringType, Decimal128Type> {
+  void operator()(FunctionContext* ctx, const CastOptions& options,
+                  const ArrayData& input, ArrayData* output) {
+    FUNC_RETURN_NOT_OK(FormatDecimals(ctx, input, output));
+  }
+};
+
+// ----------------------------------------------------------------------
+// Between 32-bit and 64-bit offsets
+
+// Convert the offsets of the slots of input to OutOffset, less base, failing if
+// the values they span don't fit in OutOffset
+template <typename OutOffset, typename InOffset>
+static Status ConvertOffsets(FunctionContext* ctx, const ArrayData& input, InOffset base,
+                             std::shared_ptr<Buffer>* out) {
+  RETURN_NOT_OK(ctx->Allocate((input.length + 1) * sizeof(OutOffset), out));
+  auto out_offsets = reinterpret_cast<OutOffset*>((*out)->mutable_data());
+  if (input.buffers[1] == nullptr) {
+    out_offsets[0] = 0;
+    return Status::OK();
+  }
+  const InOffset* in_offsets = GetValues<InOffset>(input, 1);
+  if (static_cast<int64_t>(in_offsets[input.length] - base) >
+      static_cast<int64_t>(std::numeric_limits<OutOffset>::max())) {
+    std::stringstream ss;
+    ss << "Array of " << input.type->ToString() << " is too large to be represented with "
+       << sizeof(OutOffset) * 8 << "-bit offsets";
+    return Status::CapacityError(ss.str());
+  }
+  for (int64_t i = 0; i <= input.length; ++i) {
+    out_offsets[i] = static_cast<OutOffset>(in_offsets[i] - base);
+  }
+  return Status::OK();
+}
+
+// The offsets are rebased to start at zero, the data is sliced without copying
+template <typename O, typename I>
+struct CastFunctor<
+    O, I,
+    typename std::enable_if<(std::is_same<I, BinaryType>::value &&
+                             std::is_same<O, LargeBinaryType>::value) ||
+                            (std::is_same<I, LargeBinaryType>::value &&
+                             std::is_same<O, BinaryType>::value) ||
+                            (std::is_same<I, StringType>::value &&
+                             std::is_same<O, LargeStringType>::value) ||
+                            (std::is_same<I, LargeStringType>::value &&
+                             std::is_same<O, StringType>::value)>::type> {
+  using in_offset_type = typename I::offset_type;
+  using out_offset_type = typename O::offset_type;
+
+  void operator()(FunctionContext* ctx, const CastOptions& options,
+                  const ArrayData& input, ArrayData* output) {
+    in_offset_type begin = 0;
+    in_offset_type end = 0;
+    if (input.buffers[1] != nullptr) {
+      const in_offset_type* in_offsets = GetValues<in_offset_type>(input, 1);
+      begin = in_offsets[0];
+      end = in_offsets[input.length];
+    }
+    std::shared_ptr<Buffer> offsets;
+    FUNC_RETURN_NOT_OK(
+        (ConvertOffsets<out_offset_type, in_offset_type>(ctx, input, begin, &offsets)));
+    std::shared_ptr<Buffer> data = input.buffers[2];
+    if (data != nullptr) {
+      data = SliceBuffer(data, begin, end - begin);
+    }
+    output->buffers.push_back(offsets);
+    output->buffers.push_back(data);
+  }
+};
+
 // ----------------------------------------------------------------------
 // From one timestamp to another
 
@@ -472,8 +1094,12 @@ struct CastFunctor<Date32Type, Date64Type> {
 // ----------------------------------------------------------------------
 // List to List
 
+template <typename InListType, typename OutListType>
 class ListCastKernel : public UnaryKernel {
  public:
+  using in_offset_type = typename InListType::offset_type;
+  using out_offset_type = typename OutListType::offset_type;
+
   ListCastKernel(std::unique_ptr<UnaryKernel> child_caster,
                  const std::shared_ptr<DataType>& out_type)
       : child_caster_(std::move(child_caster)), out_type_(out_type) {}
@@ -482,7 +1108,7 @@ class ListCastKernel : public UnaryKernel {
     DCHECK_EQ(Datum::ARRAY, input.kind());
 
     const ArrayData& in_data = *input.array();
-    DCHECK_EQ(Type::LIST, in_data.type->id());
+    DCHECK_EQ(InListType::type_id, in_data.type->id());
     ArrayData* result;
 
     if (in_data.offset != 0) {
@@ -496,8 +1122,12 @@ class ListCastKernel : public UnaryKernel {
 
     result = out->array().get();
 
-    // Copy buffers from parent
+    // Copy buffers from parent, converting the offsets to the output's width
     result->buffers = in_data.buffers;
+    if (!std::is_same<in_offset_type, out_offset_type>::value) {
+      RETURN_NOT_OK((ConvertOffsets<out_offset_type, in_offset_type>(
+          ctx, in_data, 0, &result->buffers[1])));
+    }
 
     Datum casted_child;
     RETURN_NOT_OK(child_caster_->Call(ctx, Datum(in_data.child_data[0]), &casted_child));
@@ -512,9 +1142,240 @@ class ListCastKernel : public UnaryKernel {
   std::shared_ptr<DataType> out_type_;
 };
 
+// ----------------------------------------------------------------------
+// Run-length encoding and decoding
+
+// Whether the values at positions i and j are equal, nulls included
+static inline bool FixedWidthValuesEqual(const Array& values, const uint8_t* data,
+                                         int byte_width, int64_t i, int64_t j) {
+  if (values.IsNull(i) || values.IsNull(j)) {
+    return values.IsNull(i) && values.IsNull(j);
+  }
+  if (byte_width == 0) {
+    // Booleans
+    return BitUtil::GetBit(data, values.offset() + i) ==
+           BitUtil::GetBit(data, values.offset() + j);
+  }
+  return std::memcmp(data + (values.offset() + i) * byte_width,
+                     data + (values.offset() + j) * byte_width,
+                     static_cast<size_t>(byte_width)) == 0;
+}
+
+// Find where the runs of equal values of an array end, comparing fixed-width
+// values bytewise and others with RangeEquals
+static Status FindRunEnds(const Array& values, std::vector<int32_t>* run_ends) {
+  if (values.length() > std::numeric_limits<int32_t>::max()) {
+    return Status::CapacityError(
+        "Run-length-encoded arrays cannot have more than INT32_MAX slots");
+  }
+  const Type::type type_id = values.type_id();
+  const bool is_fixed_width =
+      type_id != Type::NA && (is_primitive(type_id) ||
+                              type_id == Type::FIXED_SIZE_BINARY ||
+                              type_id == Type::DECIMAL);
+  const uint8_t* data = nullptr;
+  int byte_width = 0;
+  if (is_fixed_width && values.length() > 0) {
+    data = values.data()->buffers[1]->data();
+    byte_width = checked_cast<const FixedWidthType&>(*values.type()).bit_width() / 8;
+  }
+  // RangeEquals short-circuits when comparing an array with itself, so the
+  // neighbouring values are compared through a second view of the data
+  const std::shared_ptr<Array> shifted = MakeArray(values.data());
+  for (int64_t i = 1; i < values.length(); ++i) {
+    const bool equal =
+        is_fixed_width ? FixedWidthValuesEqual(values, data, byte_width, i - 1, i)
+                       : values.RangeEquals(*shifted, i - 1, i, i);
+    if (!equal) {
+      run_ends->push_back(static_cast<int32_t>(i));
+    }
+  }
+  if (values.length() > 0) {
+    run_ends->push_back(static_cast<int32_t>(values.length()));
+  }
+  return Status::OK();
+}
+
+// Cast a child of a run-length-encoded array, if its type is not already the
+// output's
+static Status CastRunValues(FunctionContext* ctx, UnaryKernel* caster,
+                            const std::shared_ptr<ArrayData>& values,
+                            std::shared_ptr<ArrayData>* out) {
+  if (caster == nullptr) {
+    *out = values;
+    return Status::OK();
+  }
+  Datum casted;
+  RETURN_NOT_OK(caster->Call(ctx, Datum(values), &casted));
+  *out = casted.array();
+  return Status::OK();
+}
+
+// Encode an array into runs of its equal values, cast to the output's value
+// type first
+class RunLengthEncodeKernel : public UnaryKernel {
+ public:
+  RunLengthEncodeKernel(std::unique_ptr<UnaryKernel> value_caster,
+                        const std::shared_ptr<DataType>& out_type)
+      : value_caster_(std::move(value_caster)), out_type_(out_type) {}
+
+  Status Call(FunctionContext* ctx, const Datum& input, Datum* out) override {
+    DCHECK_EQ(Datum::ARRAY, input.kind());
+    if (out->kind() != Datum::NONE) {
+      return Status::NotImplemented(
+          "Casting to run-length-encoded arrays into preallocated memory");
+    }
+    std::shared_ptr<ArrayData> values_data;
+    RETURN_NOT_OK(CastRunValues(ctx, value_caster_.get(), input.array(), &values_data));
+    const auto values = MakeArray(values_data);
+
+    std::vector<int32_t> run_ends;
+    RETURN_NOT_OK(FindRunEnds(*values, &run_ends));
+
+    // The value of each run is the one at its start
+    std::shared_ptr<Buffer> run_ends_buffer;
+    RETURN_NOT_OK(ctx->Allocate(run_ends.size() * sizeof(int32_t), &run_ends_buffer));
+    std::shared_ptr<Buffer> run_starts;
+    RETURN_NOT_OK(ctx->Allocate(run_ends.size() * sizeof(int32_t), &run_starts));
+    auto out_ends = reinterpret_cast<int32_t*>(run_ends_buffer->mutable_data());
+    auto out_starts = reinterpret_cast<int32_t*>(run_starts->mutable_data());
+    for (size_t i = 0; i < run_ends.size(); ++i) {
+      out_ends[i] = run_ends[i];
+      out_starts[i] = i == 0 ? 0 : run_ends[i - 1];
+    }
+    std::shared_ptr<Array> run_values;
+    RETURN_NOT_OK(Take(ctx, *values,
+                       Int32Array(static_cast<int64_t>(run_ends.size()), run_starts),
+                       &run_values));
+
+    auto result = ArrayData::Make(out_type_, values->length(),
+                                  {nullptr, run_ends_buffer}, /*null_count=*/0);
+    result->child_data.push_back(run_values->data());
+    out->value = result;
+    return Status::OK();
+  }
+
+ private:
+  std::unique_ptr<UnaryKernel> value_caster_;
+  std::shared_ptr<DataType> out_type_;
+};
+
+// Cast the values of a run-length-encoded array, once per run, and either keep
+// the runs or decode them, taking the value of each slot's run
+class RunLengthDecodeKernel : public UnaryKernel {
+ public:
+  RunLengthDecodeKernel(std::unique_ptr<UnaryKernel> value_caster,
+                        const std::shared_ptr<DataType>& out_type)
+      : value_caster_(std::move(value_caster)), out_type_(out_type) {}
+
+  Status Call(FunctionContext* ctx, const Datum& input, Datum* out) override {
+    DCHECK_EQ(Datum::ARRAY, input.kind());
+    if (out->kind() != Datum::NONE) {
+      return Status::NotImplemented(
+          "Casting from run-length-encoded arrays into preallocated memory");
+    }
+    const ArrayData& in_data = *input.array();
+    std::shared_ptr<ArrayData> values;
+    RETURN_NOT_OK(
+        CastRunValues(ctx, value_caster_.get(), in_data.child_data[0], &values));
+
+    if (out_type_->id() == Type::RUN_LENGTH_ENCODED) {
+      auto result = in_data.Copy();
+      result->type = out_type_;
+      result->child_data = {values};
+      out->value = result;
+      return Status::OK();
+    }
+
+    const RunLengthEncodedArray array(input.array());
+    std::shared_ptr<Buffer> run_indices;
+    RETURN_NOT_OK(ctx->Allocate(array.length() * sizeof(int32_t), &run_indices));
+    auto out_indices = reinterpret_cast<int32_t*>(run_indices->mutable_data());
+    array.VisitRuns([&](int64_t run, int64_t position, int64_t run_length) {
+      std::fill(out_indices + position, out_indices + position + run_length,
+                static_cast<int32_t>(run));
+    });
+    std::shared_ptr<Array> result;
+    RETURN_NOT_OK(Take(ctx, *MakeArray(values), Int32Array(array.length(), run_indices),
+                       &result));
+    out->value = result->data();
+    return Status::OK();
+  }
+
+ private:
+  std::unique_ptr<UnaryKernel> value_caster_;
+  std::shared_ptr<DataType> out_type_;
+};
+
 // ----------------------------------------------------------------------
 // Dictionary to other things
 
+// The dictionary of a dictionary array as values of the output type. A
+// dictionary of another type is cast, once, so that only the indices are then
+// mapped over; all of its values are cast, whether the indices refer to them
+// or not.
+static Status GetDictionaryAsOutputType(FunctionContext* ctx, const CastOptions& options,
+                                        const ArrayData& input, const ArrayData& output,
+                                        std::shared_ptr<Array>* out) {
+  const auto& type = checked_cast<const DictionaryType&>(*input.type);
+  if (type.dictionary()->type()->Equals(*output.type)) {
+    *out = type.dictionary();
+    return Status::OK();
+  }
+  return Cast(ctx, *type.dictionary(), output.type, options, out);
+}
+
+template <typename IndexType>
+int64_t NullDictionaryNulls(const Array& indices, const Array& dictionary,
+                            uint8_t* out_validity, int64_t out_offset) {
+  using index_c_type = typename IndexType::c_type;
+  const index_c_type* in = GetValues<index_c_type>(*indices.data(), 1);
+  int64_t num_nulled = 0;
+  for (int64_t i = 0; i < indices.length(); ++i) {
+    if (indices.IsValid(i) && dictionary.IsNull(in[i])) {
+      BitUtil::ClearBit(out_validity, out_offset + i);
+      ++num_nulled;
+    }
+  }
+  return num_nulled;
+}
+
+// Make null the slots whose index refers to a null of the dictionary, as when
+// casting it made some of its values null
+static Status NullDictionaryNulls(FunctionContext* ctx, const ArrayData& input,
+                                  const Array& indices, const Array& dictionary,
+                                  ArrayData* output) {
+  if (dictionary.null_count() == 0) {
+    return Status::OK();
+  }
+  RETURN_NOT_OK(MakeValidityMutable(ctx, input, output));
+  uint8_t* out_validity = output->buffers[0]->mutable_data();
+  const int64_t out_offset = output->offset;
+  int64_t num_nulled = 0;
+  switch (indices.type()->id()) {
+    case Type::INT8:
+      num_nulled =
+          NullDictionaryNulls<Int8Type>(indices, dictionary, out_validity, out_offset);
+      break;
+    case Type::INT16:
+      num_nulled =
+          NullDictionaryNulls<Int16Type>(indices, dictionary, out_validity, out_offset);
+      break;
+    case Type::INT32:
+      num_nulled =
+          NullDictionaryNulls<Int32Type>(indices, dictionary, out_validity, out_offset);
+      break;
+    case Type::INT64:
+      num_nulled =
+          NullDictionaryNulls<Int64Type>(indices, dictionary, out_validity, out_offset);
+      break;
+    default:
+      break;
+  }
+  AddNullCount(input, num_nulled, output);
+  return Status::OK();
+}
+
 template <typename IndexType>
 void UnpackFixedSizeBinaryDictionary(FunctionContext* ctx, const Array& indices,
                                      const FixedSizeBinaryArray& dictionary,
@@ -554,14 +1415,9 @@ struct CastFunctor<
                   const ArrayData& input, ArrayData* output) {
     DictionaryArray dict_array(input.Copy());
 
-    const DictionaryType& type = checked_cast<const DictionaryType&>(*input.type);
-    const DataType& values_type = *type.dictionary()->type();
-    const FixedSizeBinaryArray& dictionary =
-        checked_cast<const FixedSizeBinaryArray&>(*type.dictionary());
-
-    // Check if values and output type match
-    DCHECK(values_type.Equals(*output->type))
-        << "Dictionary type: " << values_type << " target type: " << (*output->type);
+    std::shared_ptr<Array> values;
+    FUNC_RETURN_NOT_OK(GetDictionaryAsOutputType(ctx, options, input, *output, &values));
+    const auto& dictionary = checked_cast<const FixedSizeBinaryArray&>(*values);
 
     const Array& indices = *dict_array.indices();
     switch (indices.type()->id()) {
@@ -583,6 +1439,7 @@ struct CastFunctor<
         ctx->SetStatus(Status::Invalid(ss.str()));
         return;
     }
+    FUNC_RETURN_NOT_OK(NullDictionaryNulls(ctx, input, indices, dictionary, output));
   }
 };
 
@@ -634,13 +1491,9 @@ struct CastFunctor<T, DictionaryType,
                   const ArrayData& input, ArrayData* output) {
     DictionaryArray dict_array(input.Copy());
 
-    const DictionaryType& type = checked_cast<const DictionaryType&>(*input.type);
-    const DataType& values_type = *type.dictionary()->type();
-    const BinaryArray& dictionary = checked_cast<const BinaryArray&>(*type.dictionary());
-
-    // Check if values and output type match
-    DCHECK(values_type.Equals(*output->type))
-        << "Dictionary type: " << values_type << " target type: " << (*output->type);
+    std::shared_ptr<Array> values;
+    FUNC_RETURN_NOT_OK(GetDictionaryAsOutputType(ctx, options, input, *output, &values));
+    const auto& dictionary = checked_cast<const BinaryArray&>(*values);
 
     const Array& indices = *dict_array.indices();
     switch (indices.type()->id()) {
@@ -666,6 +1519,7 @@ struct CastFunctor<T, DictionaryType,
         ctx->SetStatus(Status::Invalid(ss.str()));
         return;
     }
+    FUNC_RETURN_NOT_OK(NullDictionaryNulls(ctx, input, indices, dictionary, output));
   }
 };
 
@@ -694,14 +1548,9 @@ struct CastFunctor<T, DictionaryType,
 
     DictionaryArray dict_array(input.Copy());
 
-    const DictionaryType& type = checked_cast<const DictionaryType&>(*input.type);
-    const DataType& values_type = *type.dictionary()->type();
-
-    // Check if values and output type match
-    DCHECK(values_type.Equals(*output->type))
-        << "Dictionary type: " << values_type << " target type: " << (*output->type);
-
-    const c_type* dictionary = GetValues<c_type>(*type.dictionary()->data(), 1);
+    std::shared_ptr<Array> values;
+    FUNC_RETURN_NOT_OK(GetDictionaryAsOutputType(ctx, options, input, *output, &values));
+    const c_type* dictionary = GetValues<c_type>(*values->data(), 1);
 
     auto out = GetMutableValues<c_type>(output, 1);
     const Array& indices = *dict_array.indices();
@@ -724,6 +1573,7 @@ struct CastFunctor<T, DictionaryType,
         ctx->SetStatus(Status::Invalid(ss.str()));
         return;
     }
+    FUNC_RETURN_NOT_OK(NullDictionaryNulls(ctx, input, indices, *values, output));
   }
 };
 
@@ -733,11 +1583,53 @@ typedef std::function<void(FunctionContext*, const CastOptions& options, const A
                            ArrayData*)>
     CastFunction;
 
+// Whether the output has preallocated buffers for both the validity and the
+// values, all of which are to be written in place
+static bool IsPreallocatedInPlace(const ArrayData& out) {
+  return out.buffers.size() == 2 && out.buffers[0] != nullptr &&
+         out.buffers[1] != nullptr;
+}
+
+// Write the validity of the input into the preallocated bitmap of the output
+static void WriteValidityInPlace(const ArrayData& input, ArrayData* out) {
+  uint8_t* bitmap = out->buffers[0]->mutable_data();
+  if (input.type->id() == Type::NA) {
+    BitUtil::SetBitsTo(bitmap, out->offset, input.length, false);
+  } else if (input.null_count == 0 || input.buffers[0] == nullptr) {
+    BitUtil::SetBitsTo(bitmap, out->offset, input.length, true);
+  } else {
+    CopyBitmap(input.buffers[0]->data(), input.offset, input.length, bitmap,
+               out->offset);
+  }
+  out->null_count = input.null_count;
+}
+
+// Zero-copy casts write into preallocated buffers rather than sharing those of
+// the input, so the caller can keep reusing them
+static void CopyInPlace(const ArrayData& input, ArrayData* out) {
+  WriteValidityInPlace(input, out);
+  const int bit_width = checked_cast<const FixedWidthType&>(*input.type).bit_width();
+  const uint8_t* in_values = input.buffers[1]->data();
+  uint8_t* out_values = out->buffers[1]->mutable_data();
+  if (bit_width == 1) {
+    CopyBitmap(in_values, input.offset, input.length, out_values, out->offset);
+  } else {
+    const int64_t byte_width = bit_width / 8;
+    std::memcpy(out_values + out->offset * byte_width,
+                in_values + input.offset * byte_width, input.length * byte_width);
+  }
+}
+
 static Status AllocateIfNotPreallocated(FunctionContext* ctx, const ArrayData& input,
                                         bool can_pre_allocate_values, ArrayData* out) {
   const int64_t length = input.length;
   out->null_count = input.null_count;
 
+  if (IsPreallocatedInPlace(*out)) {
+    WriteValidityInPlace(input, out);
+    return Status::OK();
+  }
+
   // Propagate bitmap unless we are null type
   std::shared_ptr<Buffer> validity_bitmap = input.buffers[0];
   if (input.type->id() == Type::NA) {
@@ -817,6 +1709,10 @@ class CastKernel : public UnaryKernel {
 
     result = out->array().get();
 
+    if (is_zero_copy_ && IsPreallocatedInPlace(*result)) {
+      CopyInPlace(in_data, result);
+      return Status::OK();
+    }
     if (!is_zero_copy_) {
       RETURN_NOT_OK(
           AllocateIfNotPreallocated(ctx, in_data, can_pre_allocate_values_, result));
@@ -835,11 +1731,15 @@ class CastKernel : public UnaryKernel {
   std::shared_ptr<DataType> out_type_;
 };
 
+// Whether the values of the type are held in an offsets and a data buffer
+static inline bool IsVarLength(Type::type type_id) {
+  return is_binary_like(type_id) || is_large_binary_like(type_id);
+}
+
 #define CAST_CASE(InType, OutType)                                                      \
   case OutType::type_id:                                                                \
     is_zero_copy = is_zero_copy_cast<OutType, InType>::value;                           \
-    can_pre_allocate_values =                                                           \
-        !(!is_binary_like(InType::type_id) && is_binary_like(OutType::type_id));        \
+    can_pre_allocate_values = !IsVarLength(OutType::type_id);                           \
     func = [](FunctionContext* ctx, const CastOptions& options, const ArrayData& input, \
               ArrayData* out) {                                                         \
       CastFunctor<OutType, InType> func;                                                \
@@ -860,6 +1760,11 @@ class CastKernel : public UnaryKernel {
   FN(IN_TYPE, FloatType);          \
   FN(IN_TYPE, DoubleType);
 
+// Integer and floating point inputs
+#define NUMBER_CASES(FN, IN_TYPE) \
+  NUMERIC_CASES(FN, IN_TYPE)      \
+  FN(IN_TYPE, Decimal128Type);
+
 #define NULL_CASES(FN, IN_TYPE) \
   NUMERIC_CASES(FN, IN_TYPE)    \
   FN(NullType, Time32Type);     \
@@ -869,12 +1774,12 @@ class CastKernel : public UnaryKernel {
   FN(NullType, Date64Type);
 
 #define INT32_CASES(FN, IN_TYPE) \
-  NUMERIC_CASES(FN, IN_TYPE)     \
+  NUMBER_CASES(FN, IN_TYPE)      \
   FN(Int32Type, Time32Type);     \
   FN(Int32Type, Date32Type);
 
 #define INT64_CASES(FN, IN_TYPE) \
-  NUMERIC_CASES(FN, IN_TYPE)     \
+  NUMBER_CASES(FN, IN_TYPE)      \
   FN(Int64Type, TimestampType);  \
   FN(Int64Type, Time64Type);     \
   FN(Int64Type, Date64Type);
@@ -927,6 +1832,41 @@ class CastKernel : public UnaryKernel {
   FN(IN_TYPE, BinaryType);            \
   FN(IN_TYPE, StringType);
 
+#define STRING_CASES(FN, IN_TYPE)  \
+  FN(StringType, UInt8Type);       \
+  FN(StringType, Int8Type);        \
+  FN(StringType, UInt16Type);      \
+  FN(StringType, Int16Type);       \
+  FN(StringType, UInt32Type);      \
+  FN(StringType, Int32Type);       \
+  FN(StringType, UInt64Type);      \
+  FN(StringType, Int64Type);       \
+  FN(StringType, FloatType);       \
+  FN(StringType, DoubleType);      \
+  FN(StringType, TimestampType);   \
+  FN(StringType, Decimal128Type);  \
+  FN(StringType, LargeStringType);
+
+#define LARGE_STRING_CASES(FN, IN_TYPE) FN(LargeStringType, StringType);
+
+#define BINARY_CASES(FN, IN_TYPE) FN(BinaryType, LargeBinaryType);
+
+#define LARGE_BINARY_CASES(FN, IN_TYPE) FN(LargeBinaryType, BinaryType);
+
+#define DECIMAL_CASES(FN, IN_TYPE)    \
+  FN(Decimal128Type, UInt8Type);      \
+  FN(Decimal128Type, Int8Type);       \
+  FN(Decimal128Type, UInt16Type);     \
+  FN(Decimal128Type, Int16Type);      \
+  FN(Decimal128Type, UInt32Type);     \
+  FN(Decimal128Type, Int32Type);      \
+  FN(Decimal128Type, UInt64Type);     \
+  FN(Decimal128Type, Int64Type);      \
+  FN(Decimal128Type, FloatType);      \
+  FN(Decimal128Type, DoubleType);     \
+  FN(Decimal128Type, Decimal128Type); \
+  FN(Decimal128Type, StringType);
+
 #define GET_CAST_FUNCTION(CASE_GENERATOR, InType)                              \
   static std::unique_ptr<UnaryKernel> Get##InType##CastFunc(                   \
       const std::shared_ptr<DataType>& out_type, const CastOptions& options) { \
@@ -947,22 +1887,27 @@ class CastKernel : public UnaryKernel {
 
 GET_CAST_FUNCTION(NULL_CASES, NullType);
 GET_CAST_FUNCTION(NUMERIC_CASES, BooleanType);
-GET_CAST_FUNCTION(NUMERIC_CASES, UInt8Type);
-GET_CAST_FUNCTION(NUMERIC_CASES, Int8Type);
-GET_CAST_FUNCTION(NUMERIC_CASES, UInt16Type);
-GET_CAST_FUNCTION(NUMERIC_CASES, Int16Type);
-GET_CAST_FUNCTION(NUMERIC_CASES, UInt32Type);
+GET_CAST_FUNCTION(NUMBER_CASES, UInt8Type);
+GET_CAST_FUNCTION(NUMBER_CASES, Int8Type);
+GET_CAST_FUNCTION(NUMBER_CASES, UInt16Type);
+GET_CAST_FUNCTION(NUMBER_CASES, Int16Type);
+GET_CAST_FUNCTION(NUMBER_CASES, UInt32Type);
 GET_CAST_FUNCTION(INT32_CASES, Int32Type);
-GET_CAST_FUNCTION(NUMERIC_CASES, UInt64Type);
+GET_CAST_FUNCTION(NUMBER_CASES, UInt64Type);
 GET_CAST_FUNCTION(INT64_CASES, Int64Type);
-GET_CAST_FUNCTION(NUMERIC_CASES, FloatType);
-GET_CAST_FUNCTION(NUMERIC_CASES, DoubleType);
+GET_CAST_FUNCTION(NUMBER_CASES, FloatType);
+GET_CAST_FUNCTION(NUMBER_CASES, DoubleType);
 GET_CAST_FUNCTION(DATE32_CASES, Date32Type);
 GET_CAST_FUNCTION(DATE64_CASES, Date64Type);
 GET_CAST_FUNCTION(TIME32_CASES, Time32Type);
 GET_CAST_FUNCTION(TIME64_CASES, Time64Type);
 GET_CAST_FUNCTION(TIMESTAMP_CASES, TimestampType);
 GET_CAST_FUNCTION(DICTIONARY_CASES, DictionaryType);
+GET_CAST_FUNCTION(STRING_CASES, StringType);
+GET_CAST_FUNCTION(LARGE_STRING_CASES, LargeStringType);
+GET_CAST_FUNCTION(BINARY_CASES, BinaryType);
+GET_CAST_FUNCTION(LARGE_BINARY_CASES, LargeBinaryType);
+GET_CAST_FUNCTION(DECIMAL_CASES, Decimal128Type);
 
 #define CAST_FUNCTION_CASE(InType)                      \
   case InType::type_id:                                 \
@@ -971,19 +1916,59 @@ GET_CAST_FUNCTION(DICTIONARY_CASES, DictionaryType);
 
 namespace {
 
+template <typename InListType>
 Status GetListCastFunc(const DataType& in_type, const std::shared_ptr<DataType>& out_type,
                        const CastOptions& options, std::unique_ptr<UnaryKernel>* kernel) {
-  if (out_type->id() != Type::LIST) {
+  if (out_type->id() != Type::LIST && out_type->id() != Type::LARGE_LIST) {
     // Kernel will be null
     return Status::OK();
   }
-  const DataType& in_value_type = *checked_cast<const ListType&>(in_type).value_type();
-  std::shared_ptr<DataType> out_value_type =
-      checked_cast<const ListType&>(*out_type).value_type();
+  const DataType& in_value_type = *in_type.child(0)->type();
+  std::shared_ptr<DataType> out_value_type = out_type->child(0)->type();
   std::unique_ptr<UnaryKernel> child_caster;
   RETURN_NOT_OK(GetCastFunction(in_value_type, out_value_type, options, &child_caster));
-  *kernel =
-      std::unique_ptr<UnaryKernel>(new ListCastKernel(std::move(child_caster), out_type));
+  if (out_type->id() == Type::LIST) {
+    kernel->reset(
+        new ListCastKernel<InListType, ListType>(std::move(child_caster), out_type));
+  } else {
+    kernel->reset(
+        new ListCastKernel<InListType, LargeListType>(std::move(child_caster), out_type));
+  }
+  return Status::OK();
+}
+
+// The caster from in_type to out_type, or none if they are equal
+Status GetValueCastFunc(const DataType& in_type,
+                        const std::shared_ptr<DataType>& out_type,
+                        const CastOptions& options,
+                        std::unique_ptr<UnaryKernel>* kernel) {
+  if (in_type.Equals(*out_type)) {
+    return Status::OK();
+  }
+  return GetCastFunction(in_type, out_type, options, kernel);
+}
+
+Status GetRunLengthEncodedCastFunc(const DataType& in_type,
+                                   const std::shared_ptr<DataType>& out_type,
+                                   const CastOptions& options,
+                                   std::unique_ptr<UnaryKernel>* kernel) {
+  std::unique_ptr<UnaryKernel> value_caster;
+  if (in_type.id() == Type::RUN_LENGTH_ENCODED) {
+    const DataType& in_value_type =
+        *checked_cast<const RunLengthEncodedType&>(in_type).value_type();
+    const std::shared_ptr<DataType> out_value_type =
+        out_type->id() == Type::RUN_LENGTH_ENCODED
+            ? checked_cast<const RunLengthEncodedType&>(*out_type).value_type()
+            : out_type;
+    RETURN_NOT_OK(
+        GetValueCastFunc(in_value_type, out_value_type, options, &value_caster));
+    kernel->reset(new RunLengthDecodeKernel(std::move(value_caster), out_type));
+  } else {
+    const std::shared_ptr<DataType> out_value_type =
+        checked_cast<const RunLengthEncodedType&>(*out_type).value_type();
+    RETURN_NOT_OK(GetValueCastFunc(in_type, out_value_type, options, &value_caster));
+    kernel->reset(new RunLengthEncodeKernel(std::move(value_caster), out_type));
+  }
   return Status::OK();
 }
 
@@ -991,6 +1976,10 @@ Status GetListCastFunc(const DataType& in_type, const std::shared_ptr<DataType>&
 
 Status GetCastFunction(const DataType& in_type, const std::shared_ptr<DataType>& out_type,
                        const CastOptions& options, std::unique_ptr<UnaryKernel>* kernel) {
+  if (in_type.id() == Type::RUN_LENGTH_ENCODED ||
+      out_type->id() == Type::RUN_LENGTH_ENCODED) {
+    return GetRunLengthEncodedCastFunc(in_type, out_type, options, kernel);
+  }
   switch (in_type.id()) {
     CAST_FUNCTION_CASE(NullType);
     CAST_FUNCTION_CASE(BooleanType);
@@ -1010,8 +1999,16 @@ Status GetCastFunction(const DataType& in_type, const std::shared_ptr<DataType>&
     CAST_FUNCTION_CASE(Time64Type);
     CAST_FUNCTION_CASE(TimestampType);
     CAST_FUNCTION_CASE(DictionaryType);
+    CAST_FUNCTION_CASE(StringType);
+    CAST_FUNCTION_CASE(LargeStringType);
+    CAST_FUNCTION_CASE(BinaryType);
+    CAST_FUNCTION_CASE(LargeBinaryType);
+    CAST_FUNCTION_CASE(Decimal128Type);
     case Type::LIST:
-      RETURN_NOT_OK(GetListCastFunc(in_type, out_type, options, kernel));
+      RETURN_NOT_OK(GetListCastFunc<ListType>(in_type, out_type, options, kernel));
+      break;
+    case Type::LARGE_LIST:
+      RETURN_NOT_OK(GetListCastFunc<LargeListType>(in_type, out_type, options, kernel));
       break;
     default:
       break;
@@ -1033,12 +2030,70 @@ Status Cast(FunctionContext* ctx, const Datum& value,
   RETURN_NOT_OK(GetCastFunction(*value.type(), out_type, options, &func));
 
   std::vector<Datum> result;
-  RETURN_NOT_OK(detail::InvokeUnaryArrayKernel(ctx, func.get(), value, &result));
+  RETURN_NOT_OK(detail::InvokeUnaryArrayKernelParallel(ctx, func.get(), value, &result));
 
   *out = detail::WrapDatumsLike(value, result);
   return Status::OK();
 }
 
+Status GetCastOutputBufferSizes(const std::shared_ptr<DataType>& to_type, int64_t length,
+                                std::vector<int64_t>* sizes) {
+  const Type::type type_id = to_type->id();
+  const bool is_fixed_width = is_primitive(type_id) ||
+                              type_id == Type::FIXED_SIZE_BINARY ||
+                              type_id == Type::DECIMAL;
+  if (type_id == Type::NA || !is_fixed_width) {
+    std::stringstream ss;
+    ss << "Cannot pre-allocate memory for type: " << to_type->ToString();
+    return Status::NotImplemented(ss.str());
+  }
+  const int bit_width = checked_cast<const FixedWidthType&>(*to_type).bit_width();
+  const int64_t values_size =
+      bit_width == 1 ? BitUtil::BytesForBits(length) : length * (bit_width / 8);
+  *sizes = {BitUtil::BytesForBits(length), values_size};
+  return Status::OK();
+}
+
+Status PreallocateCastOutput(FunctionContext* ctx,
+                             const std::shared_ptr<DataType>& to_type, int64_t length,
+                             std::shared_ptr<ArrayData>* out) {
+  std::vector<int64_t> sizes;
+  RETURN_NOT_OK(GetCastOutputBufferSizes(to_type, length, &sizes));
+  BufferVector buffers(sizes.size());
+  for (size_t i = 0; i < sizes.size(); ++i) {
+    RETURN_NOT_OK(ctx->Allocate(sizes[i], &buffers[i]));
+  }
+  *out = ArrayData::Make(to_type, length, std::move(buffers));
+  return Status::OK();
+}
+
+Status CastInto(FunctionContext* ctx, const Array& value, const CastOptions& options,
+                const std::shared_ptr<ArrayData>& out) {
+  if (out->length != value.length()) {
+    return Status::Invalid("Output of a cast must have the length of its input");
+  }
+  std::vector<int64_t> sizes;
+  RETURN_NOT_OK(GetCastOutputBufferSizes(out->type, out->offset + out->length, &sizes));
+  if (out->buffers.size() != sizes.size()) {
+    return Status::Invalid(
+        "Preallocated output must have a validity and a values buffer");
+  }
+  for (size_t i = 0; i < sizes.size(); ++i) {
+    const auto& buffer = out->buffers[i];
+    if (buffer == nullptr || !buffer->is_mutable() || buffer->size() < sizes[i]) {
+      std::stringstream ss;
+      ss << "Buffer " << i << " of preallocated output must be mutable and hold at least "
+         << sizes[i] << " bytes";
+      return Status::Invalid(ss.str());
+    }
+  }
+
+  std::unique_ptr<UnaryKernel> func;
+  RETURN_NOT_OK(GetCastFunction(*value.type(), out->type, options, &func));
+  Datum datum_out(out);
+  return func->Call(ctx, Datum(value.data()), &datum_out);
+}
+
 Status Cast(FunctionContext* ctx, const Array& array,
             const std::shared_ptr<DataType>& out_type, const CastOptions& options,
             std::shared_ptr<Array>* out) {
@@ -19,6 +19,7 @@
 #define ARROW_COMPUTE_KERNELS_CAST_H
 
 #include <memory>
+#include <vector>
 
 #include "arrow/status.h"
 #include "arrow/util/visibility.h"
@@ -35,10 +36,28 @@ class DataType;
 namespace compute {
 
 struct ARROW_EXPORT CastOptions {
-  CastOptions() : allow_int_overflow(false), allow_time_truncate(false) {}
+  CastOptions()
+      : allow_int_overflow(false),
+        allow_time_truncate(false),
+        allow_decimal_truncate(false),
+        null_on_parse_error(false) {}
 
+  /// Let integers and decimals out of the range of the output type wrap
+  /// around rather than failing the cast. Floats out of the range of a
+  /// decimal type become zero.
   bool allow_int_overflow;
   bool allow_time_truncate;
+
+  /// When casting decimals to integers or to smaller scales, drop the
+  /// digits that do not fit rather than failing the cast. Values are
+  /// truncated towards zero.
+  bool allow_decimal_truncate;
+
+  /// When casting from strings, make those that cannot be parsed null rather
+  /// than failing the cast. Integers are parsed in decimal, floats as by
+  /// strtod, timestamps as ISO-8601 "YYYY-MM-DD[Thh:mm:ss][Z]" in UTC,
+  /// decimals as by Decimal128::FromString at the scale of the output type.
+  bool null_on_parse_error;
 };
 
 /// \since 0.7.0
@@ -48,6 +67,15 @@ Status GetCastFunction(const DataType& in_type, const std::shared_ptr<DataType>&
                        const CastOptions& options, std::unique_ptr<UnaryKernel>* kernel);
 
 /// \brief Cast from one array type to another
+///
+/// A dictionary array is cast by casting its dictionary, once, then mapping
+/// the indices to the cast values; a dictionary value that cannot be cast
+/// fails the cast even if no index refers to it.
+///
+/// Casting to a run-length-encoded type encodes the runs of equal values,
+/// nulls included, cast to its value type. Casting from one casts a value
+/// per run, then decodes the runs unless the output is run-length-encoded.
+///
 /// \param[in] context the FunctionContext
 /// \param[in] value array to cast
 /// \param[in] to_type type to cast to
@@ -62,6 +90,11 @@ Status Cast(FunctionContext* context, const Array& value,
             std::shared_ptr<Array>* out);
 
 /// \brief Cast from one value to another
+///
+/// If the context allows threads, the chunks of a chunked array are cast on
+/// the CPU thread pool, the very long ones a slice at a time; the result then
+/// has a chunk per slice.
+///
 /// \param[in] context the FunctionContext
 /// \param[in] value datum to cast
 /// \param[in] to_type type to cast to
@@ -75,6 +108,52 @@ Status Cast(FunctionContext* context, const Datum& value,
             const std::shared_ptr<DataType>& to_type, const CastOptions& options,
             Datum* out);
 
+/// \brief Compute the sizes of the buffers of the result of a cast
+///
+/// These are the validity bitmap and the values, for casts to fixed-width
+/// types; other types can't be preallocated.
+///
+/// \param[in] to_type type to cast to
+/// \param[in] length number of values to cast
+/// \param[out] sizes the minimum size in bytes of each buffer
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Status GetCastOutputBufferSizes(const std::shared_ptr<DataType>& to_type, int64_t length,
+                                std::vector<int64_t>* sizes);
+
+/// \brief Allocate the buffers of the result of a cast, for use with CastInto
+///
+/// \param[in] context the FunctionContext
+/// \param[in] to_type type to cast to
+/// \param[in] length number of values to cast
+/// \param[out] out array data with freshly allocated buffers
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Status PreallocateCastOutput(FunctionContext* context,
+                             const std::shared_ptr<DataType>& to_type, int64_t length,
+                             std::shared_ptr<ArrayData>* out);
+
+/// \brief Cast an array into preallocated buffers
+///
+/// The validity and the values are written in place, at the offset of the
+/// output, even by casts that otherwise share the buffers of their input, so
+/// that the same output can be reused for batch after batch without any
+/// allocation. Only its null count changes.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] value array to cast
+/// \param[in] options casting options
+/// \param[in,out] out array data of the type to cast to and the length of
+/// value, with mutable buffers of at least the sizes given by
+/// GetCastOutputBufferSizes for its offset plus length
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Status CastInto(FunctionContext* context, const Array& value, const CastOptions& options,
+                const std::shared_ptr<ArrayData>& out);
+
 }  // namespace compute
 }  // namespace arrow
 
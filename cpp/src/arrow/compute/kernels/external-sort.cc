@@ -0,0 +1,647 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/external-sort.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/row-keys-internal.h"
+#include "arrow/compute/kernels/sort.h"
+#include "arrow/compute/kernels/take.h"
+#include "arrow/compute/kernels/util-internal.h"
+#include "arrow/concatenate.h"
+#include "arrow/io/file.h"
+#include "arrow/ipc/reader.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/util/io-util.h"
+
+namespace arrow {
+namespace compute {
+
+namespace {
+
+// ----------------------------------------------------------------------
+// Comparing values of the sort column across batches, in the order of
+// SortIndices
+
+class KeyComparator {
+ public:
+  virtual ~KeyComparator() = default;
+
+  // Compare left[i] with right[j], nulls coming last
+  int Compare(const ArrayData& left, int64_t i, const ArrayData& right,
+              int64_t j) const {
+    const bool left_valid = detail::IsValid(left, i);
+    const bool right_valid = detail::IsValid(right, j);
+    if (!left_valid || !right_valid) {
+      return static_cast<int>(right_valid) - static_cast<int>(left_valid);
+    }
+    return CompareValues(left, i, right, j);
+  }
+
+ protected:
+  virtual int CompareValues(const ArrayData& left, int64_t i, const ArrayData& right,
+                            int64_t j) const = 0;
+};
+
+template <typename T>
+typename std::enable_if<std::is_integral<T>::value, int>::type CompareNumbers(T a, T b) {
+  return (a > b) - (a < b);
+}
+
+// NaNs come after all other values
+template <typename T>
+typename std::enable_if<std::is_floating_point<T>::value, int>::type CompareNumbers(T a,
+                                                                                   T b) {
+  const bool a_nan = std::isnan(a);
+  const bool b_nan = std::isnan(b);
+  if (a_nan || b_nan) {
+    return static_cast<int>(a_nan) - static_cast<int>(b_nan);
+  }
+  return (a > b) - (a < b);
+}
+
+template <typename Type>
+class NumericComparator : public KeyComparator {
+ protected:
+  using T = typename Type::c_type;
+
+  int CompareValues(const ArrayData& left, int64_t i, const ArrayData& right,
+                    int64_t j) const override {
+    return CompareNumbers(GetValues<T>(left, 1)[i], GetValues<T>(right, 1)[j]);
+  }
+};
+
+class BooleanComparator : public KeyComparator {
+ protected:
+  int CompareValues(const ArrayData& left, int64_t i, const ArrayData& right,
+                    int64_t j) const override {
+    const bool a = BitUtil::GetBit(left.buffers[1]->data(), left.offset + i);
+    const bool b = BitUtil::GetBit(right.buffers[1]->data(), right.offset + j);
+    return static_cast<int>(a) - static_cast<int>(b);
+  }
+};
+
+int CompareBytes(const uint8_t* a, int64_t a_length, const uint8_t* b,
+                 int64_t b_length) {
+  const int64_t length = std::min(a_length, b_length);
+  const int result = length > 0 ? std::memcmp(a, b, static_cast<size_t>(length)) : 0;
+  if (result != 0) {
+    return result;
+  }
+  return (a_length > b_length) - (a_length < b_length);
+}
+
+class BinaryComparator : public KeyComparator {
+ protected:
+  int CompareValues(const ArrayData& left, int64_t i, const ArrayData& right,
+                    int64_t j) const override {
+    const int32_t* left_offsets = GetValues<int32_t>(left, 1);
+    const int32_t* right_offsets = GetValues<int32_t>(right, 1);
+    return CompareBytes(Data(left) + left_offsets[i],
+                        left_offsets[i + 1] - left_offsets[i],
+                        Data(right) + right_offsets[j],
+                        right_offsets[j + 1] - right_offsets[j]);
+  }
+
+  static const uint8_t* Data(const ArrayData& data) {
+    return data.buffers[2] == nullptr ? nullptr : data.buffers[2]->data();
+  }
+};
+
+class FixedSizeBinaryComparator : public KeyComparator {
+ public:
+  explicit FixedSizeBinaryComparator(int32_t byte_width) : byte_width_(byte_width) {}
+
+ protected:
+  int CompareValues(const ArrayData& left, int64_t i, const ArrayData& right,
+                    int64_t j) const override {
+    return CompareBytes(left.buffers[1]->data() + (left.offset + i) * byte_width_,
+                        byte_width_,
+                        right.buffers[1]->data() + (right.offset + j) * byte_width_,
+                        byte_width_);
+  }
+
+ private:
+  int32_t byte_width_;
+};
+
+Status MakeKeyComparator(const DataType& type, std::unique_ptr<KeyComparator>* out) {
+#define NUMERIC_CASE(InType)                     \
+  case InType::type_id:                          \
+    out->reset(new NumericComparator<InType>()); \
+    return Status::OK()
+
+  switch (type.id()) {
+    NUMERIC_CASE(UInt8Type);
+    NUMERIC_CASE(Int8Type);
+    NUMERIC_CASE(UInt16Type);
+    NUMERIC_CASE(Int16Type);
+    NUMERIC_CASE(UInt32Type);
+    NUMERIC_CASE(Int32Type);
+    NUMERIC_CASE(UInt64Type);
+    NUMERIC_CASE(Int64Type);
+    NUMERIC_CASE(FloatType);
+    NUMERIC_CASE(DoubleType);
+    NUMERIC_CASE(Date32Type);
+    NUMERIC_CASE(Date64Type);
+    NUMERIC_CASE(Time32Type);
+    NUMERIC_CASE(Time64Type);
+    NUMERIC_CASE(TimestampType);
+    case Type::BOOL:
+      out->reset(new BooleanComparator());
+      return Status::OK();
+    case Type::BINARY:
+    case Type::STRING:
+      out->reset(new BinaryComparator());
+      return Status::OK();
+    case Type::FIXED_SIZE_BINARY:
+      out->reset(new FixedSizeBinaryComparator(
+          static_cast<const FixedSizeBinaryType&>(type).byte_width()));
+      return Status::OK();
+    default:
+      break;
+  }
+
+#undef NUMERIC_CASE
+
+  std::stringstream ss;
+  ss << "Sorting arrays of type " << type.ToString();
+  return Status::NotImplemented(ss.str());
+}
+
+// ----------------------------------------------------------------------
+// Merging sorted runs
+
+// A tournament tree over k sources whose inner nodes hold the loser of the
+// match played there, the overall winner being kept in node 0. Once the
+// winning source advances, a single match per level finds the next winner.
+class LoserTree {
+ public:
+  template <typename Less>
+  void Init(int num_sources, Less&& less) {
+    num_sources_ = num_sources;
+    nodes_.assign(static_cast<size_t>(num_sources), 0);
+    nodes_[0] = Play(1, less);
+  }
+
+  int winner() const { return nodes_[0]; }
+
+  // Find the new winner after the current one advanced
+  template <typename Less>
+  void Replay(Less&& less) {
+    int winner = nodes_[0];
+    for (int node = (winner + num_sources_) / 2; node > 0; node /= 2) {
+      if (less(nodes_[node], winner)) {
+        std::swap(nodes_[node], winner);
+      }
+    }
+    nodes_[0] = winner;
+  }
+
+ private:
+  // The leaves of source s are at num_sources + s, the children of node n at
+  // 2n and 2n + 1
+  template <typename Less>
+  int Play(int node, Less& less) {
+    if (node >= num_sources_) {
+      return node - num_sources_;
+    }
+    const int left = Play(2 * node, less);
+    const int right = Play(2 * node + 1, less);
+    if (less(right, left)) {
+      nodes_[node] = left;
+      return right;
+    }
+    nodes_[node] = right;
+    return left;
+  }
+
+  int num_sources_;
+  std::vector<int> nodes_;
+};
+
+// A spilled run read back one batch at a time
+class RunCursor {
+ public:
+  Status Open(const std::string& path, MemoryPool* pool) {
+    RETURN_NOT_OK(io::ReadableFile::Open(path, pool, &file_));
+    RETURN_NOT_OK(ipc::RecordBatchFileReader::Open(file_, &reader_));
+    next_batch_ = 0;
+    return LoadBatch();
+  }
+
+  Status Close() { return file_->Close(); }
+
+  bool done() const { return batch_ == nullptr; }
+
+  const std::shared_ptr<RecordBatch>& batch() const { return batch_; }
+
+  int64_t row() const { return row_; }
+
+  Status Advance() {
+    if (++row_ == batch_->num_rows()) {
+      return LoadBatch();
+    }
+    return Status::OK();
+  }
+
+ private:
+  Status LoadBatch() {
+    while (next_batch_ < reader_->num_record_batches()) {
+      RETURN_NOT_OK(reader_->ReadRecordBatch(next_batch_++, &batch_));
+      if (batch_->num_rows() > 0) {
+        row_ = 0;
+        return Status::OK();
+      }
+    }
+    batch_.reset();
+    return Status::OK();
+  }
+
+  std::shared_ptr<io::ReadableFile> file_;
+  std::shared_ptr<ipc::RecordBatchFileReader> reader_;
+  int next_batch_;
+  std::shared_ptr<RecordBatch> batch_;
+  int64_t row_;
+};
+
+void DeleteFiles(const std::vector<std::string>& paths) {
+  for (const std::string& path : paths) {
+    internal::PlatformFilename file_name;
+    if (internal::FileNameFromString(path, &file_name).ok()) {
+      ARROW_UNUSED(internal::FileDelete(file_name));
+    }
+  }
+}
+
+class MergingReader : public RecordBatchReader {
+ public:
+  MergingReader(const std::shared_ptr<Schema>& schema, int sort_column,
+                int64_t batch_size, const KeyComparator* comparator, MemoryPool* pool,
+                const std::vector<std::string>& paths)
+      : schema_(schema),
+        sort_column_(sort_column),
+        batch_size_(batch_size),
+        comparator_(comparator),
+        pool_(pool),
+        paths_(paths),
+        cursors_(paths.size()) {}
+
+  ~MergingReader() override {
+    for (RunCursor& cursor : cursors_) {
+      ARROW_UNUSED(cursor.Close());
+    }
+    DeleteFiles(paths_);
+  }
+
+  Status Init() {
+    for (size_t i = 0; i < paths_.size(); ++i) {
+      RETURN_NOT_OK(cursors_[i].Open(paths_[i], pool_));
+    }
+    tree_.Init(static_cast<int>(cursors_.size()),
+               [this](int a, int b) { return Less(a, b); });
+    return Status::OK();
+  }
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* out) override {
+    // The output rows as slices of the batches of the runs
+    struct Segment {
+      std::shared_ptr<RecordBatch> batch;
+      int64_t offset;
+      int64_t length;
+    };
+    std::vector<Segment> segments;
+    int64_t length = 0;
+    while (length < batch_size_) {
+      RunCursor& cursor = cursors_[tree_.winner()];
+      if (cursor.done()) {
+        break;
+      }
+      if (!segments.empty() && segments.back().batch == cursor.batch() &&
+          segments.back().offset + segments.back().length == cursor.row()) {
+        ++segments.back().length;
+      } else {
+        segments.push_back({cursor.batch(), cursor.row(), 1});
+      }
+      ++length;
+      RETURN_NOT_OK(cursor.Advance());
+      tree_.Replay([this](int a, int b) { return Less(a, b); });
+    }
+    if (length == 0) {
+      out->reset();
+      return Status::OK();
+    }
+
+    std::vector<std::shared_ptr<Array>> columns;
+    for (int j = 0; j < schema_->num_fields(); ++j) {
+      ArrayVector slices;
+      for (const Segment& segment : segments) {
+        slices.push_back(segment.batch->column(j)->Slice(segment.offset, segment.length));
+      }
+      std::shared_ptr<Array> column;
+      if (slices.size() == 1) {
+        column = slices[0];
+      } else {
+        RETURN_NOT_OK(Concatenate(slices, pool_, &column));
+      }
+      columns.push_back(column);
+    }
+    *out = RecordBatch::Make(schema_, length, columns);
+    return Status::OK();
+  }
+
+ private:
+  // Whether the current row of run a comes first, exhausted runs coming last
+  // and ties going to the earlier run so that the merge is stable
+  bool Less(int a, int b) const {
+    const RunCursor& left = cursors_[a];
+    const RunCursor& right = cursors_[b];
+    if (left.done() || right.done()) {
+      return right.done() && (!left.done() || a < b);
+    }
+    const int result = comparator_->Compare(*left.batch()->column_data(sort_column_),
+                                            left.row(),
+                                            *right.batch()->column_data(sort_column_),
+                                            right.row());
+    return result < 0 || (result == 0 && a < b);
+  }
+
+  std::shared_ptr<Schema> schema_;
+  int sort_column_;
+  int64_t batch_size_;
+  const KeyComparator* comparator_;
+  MemoryPool* pool_;
+  std::vector<std::string> paths_;
+  std::vector<RunCursor> cursors_;
+  LoserTree tree_;
+};
+
+// Reads batches held in memory
+class BatchVectorReader : public RecordBatchReader {
+ public:
+  BatchVectorReader(const std::shared_ptr<Schema>& schema,
+                    std::vector<std::shared_ptr<RecordBatch>> batches)
+      : schema_(schema), batches_(std::move(batches)), next_(0) {}
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* out) override {
+    if (next_ == batches_.size()) {
+      out->reset();
+    } else {
+      *out = std::move(batches_[next_++]);
+    }
+    return Status::OK();
+  }
+
+ private:
+  std::shared_ptr<Schema> schema_;
+  std::vector<std::shared_ptr<RecordBatch>> batches_;
+  size_t next_;
+};
+
+int64_t DataBytes(const ArrayData& data) {
+  int64_t bytes = 0;
+  for (const auto& buffer : data.buffers) {
+    if (buffer != nullptr) {
+      bytes += buffer->size();
+    }
+  }
+  for (const auto& child : data.child_data) {
+    bytes += DataBytes(*child);
+  }
+  return bytes;
+}
+
+std::string SpillFilePrefix(const std::string& directory) {
+  std::random_device device;
+  std::stringstream ss;
+  ss << directory << "/arrow-sort-" << std::hex << device() << device() << "-";
+  return ss.str();
+}
+
+}  // namespace
+
+// ----------------------------------------------------------------------
+// ExternalSorter implementation
+
+class ExternalSorter::ExternalSorterImpl {
+ public:
+  ExternalSorterImpl(FunctionContext* ctx, const std::shared_ptr<Schema>& schema,
+                     const ExternalSortOptions& options)
+      : schema_(schema),
+        options_(options),
+        pool_(ctx->memory_pool(), options.memory_limit),
+        sort_ctx_(&pool_),
+        buffered_bytes_(0),
+        finished_(false) {
+    sort_ctx_.set_use_threads(ctx->use_threads());
+  }
+
+  ~ExternalSorterImpl() {
+    // Runs not handed over to a reader yet
+    if (!finished_) {
+      DeleteFiles(paths_);
+    }
+  }
+
+  Status Init() {
+    if (options_.sort_column < 0 || options_.sort_column >= schema_->num_fields()) {
+      std::stringstream ss;
+      ss << "Sort column " << options_.sort_column << " out of bounds for a schema of "
+         << schema_->num_fields() << " fields";
+      return Status::Invalid(ss.str());
+    }
+    if (options_.memory_limit <= 0 || options_.batch_size <= 0) {
+      return Status::Invalid("Memory limit and batch size must be positive");
+    }
+    RETURN_NOT_OK(
+        MakeKeyComparator(*schema_->field(options_.sort_column)->type(), &comparator_));
+    spill_prefix_ = SpillFilePrefix(options_.spill_directory);
+    return Status::OK();
+  }
+
+  Status Consume(const std::shared_ptr<RecordBatch>& batch) {
+    if (finished_) {
+      return Status::Invalid("The sort was already finished");
+    }
+    if (!batch->schema()->Equals(*schema_)) {
+      return Status::Invalid("Batch schema does not match the sorter's schema");
+    }
+    if (batch->num_rows() == 0) {
+      return Status::OK();
+    }
+    buffered_.push_back(batch);
+    for (int j = 0; j < batch->num_columns(); ++j) {
+      buffered_bytes_ += DataBytes(*batch->column_data(j));
+    }
+    if (buffered_bytes_ >= options_.memory_limit / 3) {
+      return SpillRun();
+    }
+    return Status::OK();
+  }
+
+  Status Finish(std::shared_ptr<RecordBatchReader>* out) {
+    if (finished_) {
+      return Status::Invalid("The sort was already finished");
+    }
+    if (paths_.empty()) {
+      std::vector<std::shared_ptr<RecordBatch>> sorted;
+      RETURN_NOT_OK(SortRun(&sorted));
+      finished_ = true;
+      *out = std::make_shared<BatchVectorReader>(schema_, std::move(sorted));
+      return Status::OK();
+    }
+    if (!buffered_.empty()) {
+      RETURN_NOT_OK(SpillRun());
+    }
+    finished_ = true;
+    auto reader = std::make_shared<MergingReader>(schema_, options_.sort_column,
+                                                  options_.batch_size, comparator_.get(),
+                                                  &pool_, paths_);
+    RETURN_NOT_OK(reader->Init());
+    *out = reader;
+    return Status::OK();
+  }
+
+  int num_spilled_runs() const { return static_cast<int>(paths_.size()); }
+
+ private:
+  // Sort the buffered batches into batches of the output size
+  Status SortRun(std::vector<std::shared_ptr<RecordBatch>>* out) {
+    std::shared_ptr<Table> table;
+    RETURN_NOT_OK(Table::FromRecordBatches(schema_, buffered_, &table));
+    buffered_.clear();
+    buffered_bytes_ = 0;
+    const int64_t length = table->num_rows();
+    if (length == 0) {
+      return Status::OK();
+    }
+
+    std::shared_ptr<Array> indices;
+    RETURN_NOT_OK(SortIndices(&sort_ctx_, *table->column(options_.sort_column)->data(),
+                              SortOptions(sort_ctx_.use_threads()), &indices));
+    std::vector<std::shared_ptr<Array>> columns;
+    for (int j = 0; j < table->num_columns(); ++j) {
+      const ArrayVector& chunks = table->column(j)->data()->chunks();
+      std::shared_ptr<Array> values;
+      if (chunks.size() == 1) {
+        values = chunks[0];
+      } else {
+        RETURN_NOT_OK(Concatenate(chunks, &pool_, &values));
+      }
+      std::shared_ptr<Array> sorted;
+      RETURN_NOT_OK(Take(&sort_ctx_, *values, *indices, &sorted));
+      columns.push_back(sorted);
+    }
+    table.reset();
+
+    for (int64_t offset = 0; offset < length; offset += options_.batch_size) {
+      const int64_t batch_length = std::min(options_.batch_size, length - offset);
+      std::vector<std::shared_ptr<Array>> slices;
+      for (const auto& column : columns) {
+        slices.push_back(column->Slice(offset, batch_length));
+      }
+      out->push_back(RecordBatch::Make(schema_, batch_length, slices));
+    }
+    return Status::OK();
+  }
+
+  // Sort the buffered batches and write them to a new spill file
+  Status SpillRun() {
+    std::vector<std::shared_ptr<RecordBatch>> sorted;
+    RETURN_NOT_OK(SortRun(&sorted));
+
+    std::stringstream path;
+    path << spill_prefix_ << paths_.size() << ".arrow";
+    std::shared_ptr<io::OutputStream> sink;
+    RETURN_NOT_OK(io::FileOutputStream::Open(path.str(), &sink));
+    paths_.push_back(path.str());
+
+    std::shared_ptr<ipc::RecordBatchWriter> writer;
+    RETURN_NOT_OK(ipc::RecordBatchFileWriter::Open(sink.get(), schema_, &writer));
+    writer->set_memory_pool(&pool_);
+    if (options_.compression != Compression::UNCOMPRESSED) {
+      RETURN_NOT_OK(static_cast<ipc::RecordBatchFileWriter&>(*writer).set_compression(
+          options_.compression));
+    }
+    for (const auto& batch : sorted) {
+      RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
+    }
+    RETURN_NOT_OK(writer->Close());
+    return sink->Close();
+  }
+
+  std::shared_ptr<Schema> schema_;
+  ExternalSortOptions options_;
+  CappedMemoryPool pool_;
+  FunctionContext sort_ctx_;
+  std::unique_ptr<KeyComparator> comparator_;
+
+  std::vector<std::shared_ptr<RecordBatch>> buffered_;
+  int64_t buffered_bytes_;
+
+  std::string spill_prefix_;
+  std::vector<std::string> paths_;
+  bool finished_;
+};
+
+ExternalSorter::ExternalSorter(std::unique_ptr<ExternalSorterImpl> impl)
+    : impl_(std::move(impl)) {}
+
+ExternalSorter::~ExternalSorter() {}
+
+Status ExternalSorter::Make(FunctionContext* ctx, const std::shared_ptr<Schema>& schema,
+                            const ExternalSortOptions& options,
+                            std::unique_ptr<ExternalSorter>* out) {
+  std::unique_ptr<ExternalSorterImpl> impl(new ExternalSorterImpl(ctx, schema, options));
+  RETURN_NOT_OK(impl->Init());
+  out->reset(new ExternalSorter(std::move(impl)));
+  return Status::OK();
+}
+
+Status ExternalSorter::Consume(const std::shared_ptr<RecordBatch>& batch) {
+  return impl_->Consume(batch);
+}
+
+Status ExternalSorter::Finish(std::shared_ptr<RecordBatchReader>* out) {
+  return impl_->Finish(out);
+}
+
+int ExternalSorter::num_spilled_runs() const { return impl_->num_spilled_runs(); }
+
+}  // namespace compute
+}  // namespace arrow
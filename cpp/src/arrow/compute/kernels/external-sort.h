@@ -0,0 +1,107 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_COMPUTE_KERNELS_EXTERNAL_SORT_H
+#define ARROW_COMPUTE_KERNELS_EXTERNAL_SORT_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "arrow/status.h"
+#include "arrow/util/compression.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class RecordBatch;
+class RecordBatchReader;
+class Schema;
+
+namespace compute {
+
+class FunctionContext;
+
+/// \brief Options for ExternalSorter
+struct ARROW_EXPORT ExternalSortOptions {
+  /// The index of the column to sort by
+  int sort_column = 0;
+
+  /// The bytes the sorter may allocate. The consumed batches are buffered
+  /// into runs of up to a third of it, leaving room to sort them
+  int64_t memory_limit = 256 << 20;
+
+  /// The directory to write the sorted runs to
+  std::string spill_directory = ".";
+
+  /// The codec compressing the buffers of the spilled runs
+  Compression::type compression = Compression::UNCOMPRESSED;
+
+  /// The number of rows of the spilled and of the output batches
+  int64_t batch_size = 64 * 1024;
+};
+
+/// \brief Sort a stream of record batches larger than memory by one column
+///
+/// The consumed batches are buffered until they reach the run size, then
+/// sorted in memory with SortIndices and Take and written to a spill file of
+/// the IPC file format, so that at most one run is in memory at a time. At the
+/// end the runs are merged with a loser tree, reading one batch of each run
+/// at a time. If everything fits in one run nothing is spilled.
+///
+/// The sort has the order of SortIndices: it is stable, nulls are placed at
+/// the end and NaNs after all other values. The sort column can be of
+/// integer, floating point, boolean, date, time, timestamp, binary, string or
+/// fixed-size binary type.
+///
+/// Allocations of the sorter go to a CappedMemoryPool over the context's pool,
+/// so that exceeding the memory limit fails with Status::OutOfMemory instead
+/// of exhausting memory. The batches given to Consume are allocated by the
+/// caller and count towards the run size only.
+class ARROW_EXPORT ExternalSorter {
+ public:
+  ~ExternalSorter();
+
+  /// \brief Create a sorter for batches of the given schema
+  static Status Make(FunctionContext* context, const std::shared_ptr<Schema>& schema,
+                     const ExternalSortOptions& options,
+                     std::unique_ptr<ExternalSorter>* out);
+
+  /// \brief Add a batch to the sort, possibly spilling a run
+  Status Consume(const std::shared_ptr<RecordBatch>& batch);
+
+  /// \brief Finish consuming and stream the sorted rows
+  ///
+  /// The reader owns the spill files and deletes them when destroyed. It
+  /// must not outlive the sorter.
+  Status Finish(std::shared_ptr<RecordBatchReader>* out);
+
+  /// \brief The number of runs spilled so far
+  int num_spilled_runs() const;
+
+ private:
+  class ExternalSorterImpl;
+
+  explicit ExternalSorter(std::unique_ptr<ExternalSorterImpl> impl);
+
+  std::unique_ptr<ExternalSorterImpl> impl_;
+};
+
+}  // namespace compute
+}  // namespace arrow
+
+#endif  // ARROW_COMPUTE_KERNELS_EXTERNAL_SORT_H
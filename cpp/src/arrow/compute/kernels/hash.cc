@@ -17,6 +17,8 @@
 
 #include "arrow/compute/kernels/hash.h"
 
+#include <algorithm>
+#include <cstring>
 #include <exception>
 #include <limits>
 #include <memory>
@@ -29,10 +31,15 @@
 #include "arrow/builder.h"
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/take.h"
 #include "arrow/compute/kernels/util-internal.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/hash-util.h"
 #include "arrow/util/hash.h"
+#include "arrow/util/macros.h"
+#include "arrow/visitor_inline.h"
 
 namespace arrow {
 namespace compute {
@@ -73,13 +80,7 @@ const char* HashException::what() const throw() { return msg_.c_str(); }
 class HashTable {
  public:
   HashTable(const std::shared_ptr<DataType>& type, MemoryPool* pool)
-      : type_(type),
-        pool_(pool),
-        initialized_(false),
-        hash_table_(nullptr),
-        hash_slots_(nullptr),
-        hash_table_size_(0),
-        mod_bitmask_(0) {}
+      : type_(type), pool_(pool), initialized_(false), table_(pool) {}
 
   virtual ~HashTable() {}
 
@@ -88,40 +89,21 @@ class HashTable {
   virtual Status GetDictionary(std::shared_ptr<ArrayData>* out) = 0;
 
  protected:
-  Status Init(int64_t elements);
+  Status Init() {
+    RETURN_NOT_OK(table_.Init());
+    initialized_ = true;
+    return Status::OK();
+  }
 
   std::shared_ptr<DataType> type_;
   MemoryPool* pool_;
   bool initialized_;
 
-  // The hash table contains integer indices that reference the set of observed
-  // distinct values
-  std::shared_ptr<Buffer> hash_table_;
-  hash_slot_t* hash_slots_;
-
-  /// Size of the table. Must be a power of 2.
-  int64_t hash_table_size_;
-
-  /// Size at which we decide to resize
-  int64_t hash_table_load_threshold_;
-
-  // Store hash_table_size_ - 1, so that j & mod_bitmask_ is equivalent to j %
-  // hash_table_size_, but uses far fewer CPU cycles
-  int64_t mod_bitmask_;
+  // Maps the hashes of the observed distinct values to their indices in the
+  // dictionary. It grows by itself as values are inserted.
+  internal::GroupHashTable table_;
 };
 
-Status HashTable::Init(int64_t elements) {
-  DCHECK_EQ(elements, BitUtil::NextPower2(elements));
-  RETURN_NOT_OK(internal::NewHashTable(elements, pool_, &hash_table_));
-  hash_slots_ = reinterpret_cast<hash_slot_t*>(hash_table_->mutable_data());
-  hash_table_size_ = elements;
-  hash_table_load_threshold_ =
-      static_cast<int64_t>(static_cast<double>(elements) * kMaxHashTableLoad);
-  mod_bitmask_ = elements - 1;
-  initialized_ = true;
-  return Status::OK();
-}
-
 template <typename Type, typename Action, typename Enable = void>
 class HashTableKernel : public HashTable {};
 
@@ -133,9 +115,6 @@ class HashTableKernel : public HashTable {};
 // isin: set false when not found, otherwise true
 // value counts: append to dictionary when not found, increment count for slot
 
-template <typename Type, typename Enable = void>
-class HashDictionary {};
-
 // ----------------------------------------------------------------------
 // Hash table pass for nulls
 
@@ -172,35 +151,6 @@ class HashTableKernel<Type, Action, enable_if_null<Type>> : public HashTable {
 // ----------------------------------------------------------------------
 // Hash table pass for primitive types
 
-template <typename Type>
-struct HashDictionary<Type, enable_if_has_c_type<Type>> {
-  using T = typename Type::c_type;
-
-  explicit HashDictionary(MemoryPool* pool) : pool(pool), size(0), capacity(0) {}
-
-  Status Init() {
-    this->size = 0;
-    RETURN_NOT_OK(AllocateResizableBuffer(this->pool, 0, &this->buffer));
-    return Resize(kInitialHashTableSize);
-  }
-
-  Status DoubleSize() { return Resize(this->size * 2); }
-
-  Status Resize(const int64_t elements) {
-    RETURN_NOT_OK(this->buffer->Resize(elements * sizeof(T)));
-
-    this->capacity = elements;
-    this->values = reinterpret_cast<T*>(this->buffer->mutable_data());
-    return Status::OK();
-  }
-
-  MemoryPool* pool;
-  std::shared_ptr<ResizableBuffer> buffer;
-  T* values;
-  int64_t size;
-  int64_t capacity;
-};
-
 #define GENERIC_HASH_PASS(HASH_INNER_LOOP)                                               \
   if (arr.null_count != 0) {                                                             \
     internal::BitmapReader valid_reader(arr.buffers[0]->data(), arr.offset, arr.length); \
@@ -230,12 +180,7 @@ class HashTableKernel<
   using T = typename Type::c_type;
 
   HashTableKernel(const std::shared_ptr<DataType>& type, MemoryPool* pool)
-      : HashTable(type, pool), dict_(pool) {}
-
-  Status Init() {
-    RETURN_NOT_OK(dict_.Init());
-    return HashTable::Init(kInitialHashTableSize);
-  }
+      : HashTable(type, pool), dict_values_(pool), dict_size_(0) {}
 
   Status Append(const ArrayData& arr) override {
     if (!initialized_) {
@@ -247,35 +192,28 @@ class HashTableKernel<
 
     RETURN_NOT_OK(action->Reserve(arr.length));
 
-#define HASH_INNER_LOOP()                                               \
-  const T value = values[i];                                            \
-  int64_t j = HashValue(value) & mod_bitmask_;                          \
-  hash_slot_t slot = hash_slots_[j];                                    \
-                                                                        \
-  while (kHashSlotEmpty != slot && dict_.values[slot] != value) {       \
-    ++j;                                                                \
-    if (ARROW_PREDICT_FALSE(j == hash_table_size_)) {                   \
-      j = 0;                                                            \
-    }                                                                   \
-    slot = hash_slots_[j];                                              \
-  }                                                                     \
-                                                                        \
-  if (slot == kHashSlotEmpty) {                                         \
-    if (!Action::allow_expand) {                                        \
-      throw HashException("Encountered new dictionary value");          \
-    }                                                                   \
-                                                                        \
-    slot = static_cast<hash_slot_t>(dict_.size);                        \
-    hash_slots_[j] = slot;                                              \
-    dict_.values[dict_.size++] = value;                                 \
-                                                                        \
-    action->ObserveNotFound(slot);                                      \
-                                                                        \
-    if (ARROW_PREDICT_FALSE(dict_.size > hash_table_load_threshold_)) { \
-      RETURN_NOT_OK(action->DoubleSize());                              \
-    }                                                                   \
-  } else {                                                              \
-    action->ObserveFound(slot);                                         \
+#define HASH_INNER_LOOP()                                                    \
+  const T value = values[i];                                                 \
+  const uint32_t hash = HashValue(value);                                    \
+  const T* dict_values = dict_values_.data();                                \
+  const auto equal = [&](int32_t index) {                                    \
+    return dict_values[index] == value;                                      \
+  };                                                                         \
+  int64_t pos;                                                               \
+  hash_slot_t slot = table_.Find(hash, equal, &pos);                         \
+                                                                             \
+  if (slot == internal::GroupHashTable::kNotFound) {                         \
+    if (!Action::allow_expand) {                                             \
+      throw HashException("Encountered new dictionary value");               \
+    }                                                                        \
+                                                                             \
+    slot = dict_size_++;                                                     \
+    RETURN_NOT_OK(dict_values_.Append(value));                               \
+    RETURN_NOT_OK(table_.Insert(pos, hash, slot));                           \
+                                                                             \
+    action->ObserveNotFound(slot);                                           \
+  } else {                                                                   \
+    action->ObserveFound(slot);                                              \
   }
 
     GENERIC_HASH_PASS(HASH_INNER_LOOP);
@@ -287,33 +225,21 @@ class HashTableKernel<
 
   Status GetDictionary(std::shared_ptr<ArrayData>* out) override {
     // TODO(wesm): handle null being in the dictionary
-    auto dict_data = dict_.buffer;
-    RETURN_NOT_OK(dict_data->Resize(dict_.size * sizeof(T), false));
-    dict_data->ZeroPadding();
+    BufferVector buffers = {nullptr, nullptr};
+    RETURN_NOT_OK(dict_values_.Finish(&buffers[1]));
 
-    *out = ArrayData::Make(type_, dict_.size, {nullptr, dict_data}, 0);
+    *out = ArrayData::Make(type_, dict_size_, std::move(buffers), 0);
     return Status::OK();
   }
 
  protected:
-  int64_t HashValue(const T& value) const {
+  uint32_t HashValue(const T& value) const {
     // TODO(wesm): Use faster hash function for C types
     return HashUtil::Hash(&value, sizeof(T), 0);
   }
 
-  Status DoubleTableSize() {
-#define PRIMITIVE_INNER_LOOP           \
-  const T value = dict_.values[index]; \
-  int64_t j = HashValue(value) & new_mod_bitmask;
-
-    DOUBLE_TABLE_SIZE(, PRIMITIVE_INNER_LOOP);
-
-#undef PRIMITIVE_INNER_LOOP
-
-    return dict_.Resize(hash_table_size_);
-  }
-
-  HashDictionary<Type> dict_;
+  TypedBufferBuilder<T> dict_values_;
+  int32_t dict_size_;
 };
 
 // ----------------------------------------------------------------------
@@ -409,7 +335,7 @@ class HashTableKernel<Type, Action, enable_if_binary<Type>> : public HashTable {
     // after 1st dict entry of length 3: 0 3
     // after 2nd dict entry of length 4: 0 3 7
     RETURN_NOT_OK(dict_offsets_.Append(0));
-    return HashTable::Init(kInitialHashTableSize);
+    return HashTable::Init();
   }
 
   Status Append(const ArrayData& arr) override {
@@ -423,50 +349,38 @@ class HashTableKernel<Type, Action, enable_if_binary<Type>> : public HashTable {
     if (arr.buffers[2].get() == nullptr) {
       data = &empty_value;
     } else {
-      data = GetValues<uint8_t>(arr, 2);
+      data = arr.buffers[2]->data();
     }
 
     auto action = checked_cast<Action*>(this);
     RETURN_NOT_OK(action->Reserve(arr.length));
 
-#define HASH_INNER_LOOP()                                                           \
-  const int32_t position = offsets[i];                                              \
-  const int32_t length = offsets[i + 1] - position;                                 \
-  const uint8_t* value = data + position;                                           \
-                                                                                    \
-  int64_t j = HashValue(value, length) & mod_bitmask_;                              \
-  hash_slot_t slot = hash_slots_[j];                                                \
-                                                                                    \
-  const int32_t* dict_offsets = dict_offsets_.data();                               \
-  const uint8_t* dict_data = dict_data_.data();                                     \
-  while (kHashSlotEmpty != slot &&                                                  \
-         !((dict_offsets[slot + 1] - dict_offsets[slot]) == length &&               \
-           0 == memcmp(value, dict_data + dict_offsets[slot], length))) {           \
-    ++j;                                                                            \
-    if (ARROW_PREDICT_FALSE(j == hash_table_size_)) {                               \
-      j = 0;                                                                        \
-    }                                                                               \
-    slot = hash_slots_[j];                                                          \
-  }                                                                                 \
-                                                                                    \
-  if (slot == kHashSlotEmpty) {                                                     \
-    if (!Action::allow_expand) {                                                    \
-      throw HashException("Encountered new dictionary value");                      \
-    }                                                                               \
-                                                                                    \
-    slot = dict_size_++;                                                            \
-    hash_slots_[j] = slot;                                                          \
-                                                                                    \
-    RETURN_NOT_OK(dict_data_.Append(value, length));                                \
-    RETURN_NOT_OK(dict_offsets_.Append(static_cast<int32_t>(dict_data_.length()))); \
-                                                                                    \
-    action->ObserveNotFound(slot);                                                  \
-                                                                                    \
-    if (ARROW_PREDICT_FALSE(dict_size_ > hash_table_load_threshold_)) {             \
-      RETURN_NOT_OK(action->DoubleSize());                                          \
-    }                                                                               \
-  } else {                                                                          \
-    action->ObserveFound(slot);                                                     \
+#define HASH_INNER_LOOP()                                                    \
+  const int32_t position = offsets[i];                                       \
+  const int32_t length = offsets[i + 1] - position;                          \
+  const uint8_t* value = data + position;                                    \
+  const uint32_t hash = HashValue(value, length);                            \
+                                                                             \
+  const auto equal = [&](int32_t index) {                                    \
+    return DictValueEquals(index, value, length);                            \
+  };                                                                         \
+  int64_t pos;                                                               \
+  hash_slot_t slot = table_.Find(hash, equal, &pos);                         \
+                                                                             \
+  if (slot == internal::GroupHashTable::kNotFound) {                         \
+    if (!Action::allow_expand) {                                             \
+      throw HashException("Encountered new dictionary value");               \
+    }                                                                        \
+                                                                             \
+    slot = dict_size_++;                                                     \
+    RETURN_NOT_OK(dict_data_.Append(value, length));                         \
+    RETURN_NOT_OK(                                                           \
+        dict_offsets_.Append(static_cast<int32_t>(dict_data_.length())));    \
+    RETURN_NOT_OK(table_.Insert(pos, hash, slot));                           \
+                                                                             \
+    action->ObserveNotFound(slot);                                           \
+  } else {                                                                   \
+    action->ObserveFound(slot);                                              \
   }
 
     GENERIC_HASH_PASS(HASH_INNER_LOOP);
@@ -488,26 +402,15 @@ class HashTableKernel<Type, Action, enable_if_binary<Type>> : public HashTable {
   }
 
  protected:
-  int64_t HashValue(const uint8_t* data, int32_t length) const {
+  uint32_t HashValue(const uint8_t* data, int32_t length) const {
     return HashUtil::Hash(data, length, 0);
   }
 
-  Status DoubleTableSize() {
-#define VARBYTES_SETUP                                \
-  const int32_t* dict_offsets = dict_offsets_.data(); \
-  const uint8_t* dict_data = dict_data_.data()
-
-#define VARBYTES_COMPUTE_HASH                                           \
-  const int32_t length = dict_offsets[index + 1] - dict_offsets[index]; \
-  const uint8_t* value = dict_data + dict_offsets[index];               \
-  int64_t j = HashValue(value, length) & new_mod_bitmask
-
-    DOUBLE_TABLE_SIZE(VARBYTES_SETUP, VARBYTES_COMPUTE_HASH);
-
-#undef VARBYTES_SETUP
-#undef VARBYTES_COMPUTE_HASH
-
-    return Status::OK();
+  bool DictValueEquals(int32_t index, const uint8_t* value, int32_t length) const {
+    const int32_t* dict_offsets = dict_offsets_.data();
+    const int32_t position = dict_offsets[index];
+    return dict_offsets[index + 1] - position == length &&
+           0 == memcmp(value, dict_data_.data() + position, length);
   }
 
   TypedBufferBuilder<int32_t> dict_offsets_;
@@ -530,7 +433,7 @@ class HashTableKernel<Type, Action, enable_if_fixed_size_binary<Type>>
 
   Status Init() {
     RETURN_NOT_OK(dict_data_.Resize(kInitialHashTableSize * byte_width_));
-    return HashTable::Init(kInitialHashTableSize);
+    return HashTable::Init();
   }
 
   Status Append(const ArrayData& arr) override {
@@ -543,38 +446,28 @@ class HashTableKernel<Type, Action, enable_if_fixed_size_binary<Type>>
     auto action = checked_cast<Action*>(this);
     RETURN_NOT_OK(action->Reserve(arr.length));
 
-#define HASH_INNER_LOOP()                                                      \
-  const uint8_t* value = data + i * byte_width_;                               \
-  int64_t j = HashValue(value) & mod_bitmask_;                                 \
-  hash_slot_t slot = hash_slots_[j];                                           \
-                                                                               \
-  const uint8_t* dict_data = dict_data_.data();                                \
-  while (kHashSlotEmpty != slot &&                                             \
-         !(0 == memcmp(value, dict_data + slot * byte_width_, byte_width_))) { \
-    ++j;                                                                       \
-    if (ARROW_PREDICT_FALSE(j == hash_table_size_)) {                          \
-      j = 0;                                                                   \
-    }                                                                          \
-    slot = hash_slots_[j];                                                     \
-  }                                                                            \
-                                                                               \
-  if (slot == kHashSlotEmpty) {                                                \
-    if (!Action::allow_expand) {                                               \
-      throw HashException("Encountered new dictionary value");                 \
-    }                                                                          \
-                                                                               \
-    slot = dict_size_++;                                                       \
-    hash_slots_[j] = slot;                                                     \
-                                                                               \
-    RETURN_NOT_OK(dict_data_.Append(value, byte_width_));                      \
-                                                                               \
-    action->ObserveNotFound(slot);                                             \
-                                                                               \
-    if (ARROW_PREDICT_FALSE(dict_size_ > hash_table_load_threshold_)) {        \
-      RETURN_NOT_OK(action->DoubleSize());                                     \
-    }                                                                          \
-  } else {                                                                     \
-    action->ObserveFound(slot);                                                \
+#define HASH_INNER_LOOP()                                                    \
+  const uint8_t* value = data + i * byte_width_;                             \
+  const uint32_t hash = HashValue(value);                                    \
+                                                                             \
+  const auto equal = [&](int32_t index) {                                    \
+    return DictValueEquals(index, value);                                    \
+  };                                                                         \
+  int64_t pos;                                                               \
+  hash_slot_t slot = table_.Find(hash, equal, &pos);                         \
+                                                                             \
+  if (slot == internal::GroupHashTable::kNotFound) {                         \
+    if (!Action::allow_expand) {                                             \
+      throw HashException("Encountered new dictionary value");               \
+    }                                                                        \
+                                                                             \
+    slot = dict_size_++;                                                     \
+    RETURN_NOT_OK(dict_data_.Append(value, byte_width_));                    \
+    RETURN_NOT_OK(table_.Insert(pos, hash, slot));                           \
+                                                                             \
+    action->ObserveNotFound(slot);                                           \
+  } else {                                                                   \
+    action->ObserveFound(slot);                                              \
   }
 
     GENERIC_HASH_PASS(HASH_INNER_LOOP);
@@ -594,22 +487,12 @@ class HashTableKernel<Type, Action, enable_if_fixed_size_binary<Type>>
   }
 
  protected:
-  int64_t HashValue(const uint8_t* data) const {
+  uint32_t HashValue(const uint8_t* data) const {
     return HashUtil::Hash(data, byte_width_, 0);
   }
 
-  Status DoubleTableSize() {
-#define FIXED_BYTES_SETUP const uint8_t* dict_data = dict_data_.data()
-
-#define FIXED_BYTES_COMPUTE_HASH \
-  int64_t j = HashValue(dict_data + index * byte_width_) & new_mod_bitmask
-
-    DOUBLE_TABLE_SIZE(FIXED_BYTES_SETUP, FIXED_BYTES_COMPUTE_HASH);
-
-#undef FIXED_BYTES_SETUP
-#undef FIXED_BYTES_COMPUTE_HASH
-
-    return Status::OK();
+  bool DictValueEquals(int32_t index, const uint8_t* value) const {
+    return 0 == memcmp(value, dict_data_.data() + index * byte_width_, byte_width_);
   }
 
   int32_t byte_width_;
@@ -707,8 +590,6 @@ class UniqueImpl : public HashTableKernel<Type, UniqueImpl<Type>> {
   void ObserveNull() {}
   void ObserveNotFound(const hash_slot_t slot) {}
 
-  Status DoubleSize() { return Base::DoubleTableSize(); }
-
   Status Append(const ArrayData& input) override { return Base::Append(input); }
 
   Status Flush(Datum* out) override {
@@ -737,8 +618,6 @@ class DictEncodeImpl : public HashTableKernel<Type, DictEncodeImpl<Type>> {
 
   void ObserveNotFound(const hash_slot_t slot) { return ObserveFound(slot); }
 
-  Status DoubleSize() { return Base::DoubleTableSize(); }
-
   Status Flush(Datum* out) override {
     std::shared_ptr<ArrayData> result;
     RETURN_NOT_OK(indices_builder_.FinishInternal(&result));
@@ -887,17 +766,297 @@ Status InvokeHash(FunctionContext* ctx, HashKernel* func, const Datum& value,
   return Status::OK();
 }
 
+using GetHashKernel = Status (*)(FunctionContext*, const std::shared_ptr<DataType>&,
+                                 std::unique_ptr<HashKernel>*);
+
+// The morsels of a chunked array to hash on the CPU thread pool, or none if
+// it should be hashed in one go
+ArrayVector HashMorsels(FunctionContext* ctx, const Datum& value) {
+  if (!ctx->use_threads() || value.kind() != Datum::CHUNKED_ARRAY ||
+      value.type()->id() == Type::NA) {
+    return {};
+  }
+  ArrayVector morsels = detail::SplitIntoMorsels(*value.chunked_array());
+  if (morsels.size() <= 1) {
+    morsels.clear();
+  }
+  return morsels;
+}
+
+// Hash each morsel with a kernel of its own. The dictionaries of the morsels,
+// unified in order, are what hashing them one after the other with a single
+// kernel would have given.
+Status InvokeHashParallel(FunctionContext* ctx, GetHashKernel get_kernel,
+                          const ArrayVector& morsels, std::vector<Datum>* kernel_outputs,
+                          ArrayVector* dictionaries) {
+  kernel_outputs->resize(morsels.size());
+  dictionaries->resize(morsels.size());
+  return detail::RunTasks(
+      ctx, static_cast<int>(morsels.size()), [&](FunctionContext* task_ctx, int i) {
+        std::unique_ptr<HashKernel> func;
+        RETURN_NOT_OK(get_kernel(task_ctx, morsels[i]->type(), &func));
+        RETURN_NOT_OK(func->Call(task_ctx, Datum(morsels[i]), &(*kernel_outputs)[i]));
+        std::shared_ptr<ArrayData> dict_data;
+        RETURN_NOT_OK(func->GetDictionary(&dict_data));
+        (*dictionaries)[i] = MakeArray(dict_data);
+        return Status::OK();
+      });
+}
+
+Status DictionaryEncodeParallel(FunctionContext* ctx, const ArrayVector& morsels,
+                                Datum* out) {
+  std::vector<Datum> indices_outputs;
+  ArrayVector dictionaries;
+  RETURN_NOT_OK(InvokeHashParallel(ctx, GetDictionaryEncodeKernel, morsels,
+                                   &indices_outputs, &dictionaries));
+
+  std::vector<std::shared_ptr<DataType>> morsel_types;
+  for (size_t i = 0; i < morsels.size(); ++i) {
+    morsel_types.push_back(
+        ::arrow::dictionary(indices_outputs[i].array()->type, dictionaries[i]));
+  }
+  std::shared_ptr<DataType> dict_type;
+  std::vector<std::shared_ptr<Buffer>> transpose_maps;
+  RETURN_NOT_OK(UnifyDictionaries(ctx, morsel_types, &dict_type, &transpose_maps));
+
+  ArrayVector dict_chunks(morsels.size());
+  RETURN_NOT_OK(detail::RunTasks(
+      ctx, static_cast<int>(morsels.size()), [&](FunctionContext* task_ctx, int i) {
+        DictionaryArray morsel(morsel_types[i], MakeArray(indices_outputs[i].array()));
+        const auto transpose_map =
+            reinterpret_cast<const int32_t*>(transpose_maps[i]->data());
+        return morsel.Transpose(task_ctx->memory_pool(), dict_type, transpose_map,
+                                &dict_chunks[i]);
+      }));
+  *out = Datum(std::make_shared<ChunkedArray>(dict_chunks));
+  return Status::OK();
+}
+
+// Whether a datum holds dictionary-encoded values, which are hashed by their
+// indices: there are as many distinct indices as distinct values, and they
+// are cheaper to hash
+bool IsDictionaryEncoded(const Datum& value) {
+  return value.type() != nullptr && value.type()->id() == Type::DICTIONARY &&
+         (value.kind() == Datum::ARRAY ||
+          (value.kind() == Datum::CHUNKED_ARRAY &&
+           value.chunked_array()->num_chunks() > 0));
+}
+
+// The indices of dictionary-encoded values, of the same shape
+Datum DictionaryIndices(const Datum& value) {
+  ArrayVector indices;
+  if (value.kind() == Datum::ARRAY) {
+    indices.push_back(DictionaryArray(value.array()).indices());
+  } else {
+    for (const auto& chunk : value.chunked_array()->chunks()) {
+      indices.push_back(checked_cast<const DictionaryArray&>(*chunk).indices());
+    }
+  }
+  return detail::WrapArraysLike(value, indices);
+}
+
+// The distinct values are those the distinct indices refer to
+Status UniqueDictionaryEncoded(FunctionContext* ctx, const Datum& value,
+                               std::shared_ptr<Array>* out) {
+  const auto& type = checked_cast<const DictionaryType&>(*value.type());
+  std::shared_ptr<Array> unique_indices;
+  RETURN_NOT_OK(Unique(ctx, DictionaryIndices(value), &unique_indices));
+  return Take(ctx, *type.dictionary(), *unique_indices, out);
+}
+
+// Encode the indices, then take the values the distinct indices refer to as
+// the dictionary
+Status DictionaryEncodeDictionaryEncoded(FunctionContext* ctx, const Datum& value,
+                                         Datum* out) {
+  const auto& type = checked_cast<const DictionaryType&>(*value.type());
+  Datum encoded;
+  RETURN_NOT_OK(DictionaryEncode(ctx, DictionaryIndices(value), &encoded));
+
+  const auto& encoded_type = checked_cast<const DictionaryType&>(*encoded.type());
+  std::shared_ptr<Array> dictionary;
+  RETURN_NOT_OK(Take(ctx, *type.dictionary(), *encoded_type.dictionary(), &dictionary));
+  const auto dict_type = ::arrow::dictionary(encoded_type.index_type(), dictionary);
+
+  ArrayVector encoded_chunks;
+  if (encoded.kind() == Datum::ARRAY) {
+    encoded_chunks.push_back(MakeArray(encoded.array()));
+  } else {
+    encoded_chunks = encoded.chunked_array()->chunks();
+  }
+  ArrayVector dict_chunks;
+  for (const auto& chunk : encoded_chunks) {
+    dict_chunks.push_back(std::make_shared<DictionaryArray>(
+        dict_type, checked_cast<const DictionaryArray&>(*chunk).indices()));
+  }
+  *out = detail::WrapArraysLike(value, dict_chunks);
+  return Status::OK();
+}
+
+// The dictionary indices of the values of a child of a union over all chunks,
+// -1 for nulls
+Status EncodeUnionChild(FunctionContext* ctx, const ArrayVector& child_chunks,
+                        const std::shared_ptr<DataType>& type,
+                        std::shared_ptr<Array>* dictionary,
+                        std::vector<int32_t>* indices) {
+  Datum encoded;
+  RETURN_NOT_OK(
+      DictionaryEncode(ctx, Datum(std::make_shared<ChunkedArray>(child_chunks, type)),
+                       &encoded));
+  *dictionary = checked_cast<const DictionaryType&>(*encoded.type()).dictionary();
+  for (const auto& chunk : encoded.chunked_array()->chunks()) {
+    const auto& chunk_indices = checked_cast<const Int32Array&>(
+        *checked_cast<const DictionaryArray&>(*chunk).indices());
+    for (int64_t i = 0; i < chunk_indices.length(); ++i) {
+      indices->push_back(chunk_indices.IsValid(i) ? chunk_indices.Value(i) : -1);
+    }
+  }
+  return Status::OK();
+}
+
+// The distinct values of a union are its distinct pairs of a type code and a
+// value of that child. Each child is dictionary-encoded, and the distinct
+// values of the children make up the children of the result, their slots
+// being in order of first occurrence. Null slots, of the union or of its
+// children, are left out.
+Status UniqueUnion(FunctionContext* ctx, const Datum& value,
+                   std::shared_ptr<Array>* out) {
+  const auto& type = checked_cast<const UnionType&>(*value.type());
+  const bool dense = type.mode() == UnionMode::DENSE;
+  const size_t num_children = type.type_codes().size();
+  std::vector<int> child_of_code(std::numeric_limits<uint8_t>::max() + 1, 0);
+  for (size_t child = 0; child < num_children; ++child) {
+    child_of_code[type.type_codes()[child]] = static_cast<int>(child);
+  }
+
+  ArrayVector chunks;
+  if (value.kind() == Datum::ARRAY) {
+    chunks.push_back(MakeArray(value.array()));
+  } else {
+    chunks = value.chunked_array()->chunks();
+  }
+  if (chunks.empty()) {
+    std::unique_ptr<ArrayBuilder> builder;
+    RETURN_NOT_OK(MakeBuilder(ctx->memory_pool(), value.type(), &builder));
+    return builder->Finish(out);
+  }
+
+  // The child values of the slots of every chunk, the whole child of a dense
+  // union and the slots' own of a sparse one
+  std::vector<std::shared_ptr<Array>> dictionaries(num_children);
+  std::vector<std::vector<int32_t>> child_indices(num_children);
+  for (size_t child = 0; child < num_children; ++child) {
+    ArrayVector child_chunks;
+    for (const auto& chunk : chunks) {
+      child_chunks.push_back(
+          checked_cast<const UnionArray&>(*chunk).child(static_cast<int>(child)));
+    }
+    RETURN_NOT_OK(EncodeUnionChild(ctx, child_chunks, type.child(child)->type(),
+                                   &dictionaries[child], &child_indices[child]));
+  }
+
+  // The distinct pairs, in order of first occurrence
+  std::vector<std::vector<bool>> seen(num_children);
+  for (size_t child = 0; child < num_children; ++child) {
+    seen[child].resize(static_cast<size_t>(dictionaries[child]->length()), false);
+  }
+  std::vector<uint8_t> unique_codes;
+  std::vector<int32_t> unique_indices;
+  std::vector<int64_t> child_bases(num_children, 0);
+  for (const auto& chunk : chunks) {
+    const auto& array = checked_cast<const UnionArray&>(*chunk);
+    const uint8_t* type_ids = array.raw_type_ids();
+    for (int64_t i = 0; i < array.length(); ++i) {
+      if (array.IsNull(i)) {
+        continue;
+      }
+      const int child = child_of_code[type_ids[i]];
+      const int64_t child_position =
+          child_bases[child] + (dense ? array.value_offset(i) : i);
+      const int32_t index = child_indices[child][child_position];
+      if (index >= 0 && !seen[child][index]) {
+        seen[child][index] = true;
+        unique_codes.push_back(type_ids[i]);
+        unique_indices.push_back(index);
+      }
+    }
+    for (size_t child = 0; child < num_children; ++child) {
+      child_bases[child] +=
+          dense ? array.child(static_cast<int>(child))->length() : array.length();
+    }
+  }
+
+  // Take the distinct values of each child: only its own slots' in a dense
+  // union, and a value or a null for every slot in a sparse one
+  const int64_t length = static_cast<int64_t>(unique_codes.size());
+  std::vector<int32_t> offsets(unique_codes.size());
+  ArrayVector children;
+  for (size_t child = 0; child < num_children; ++child) {
+    Int32Builder take_indices(ctx->memory_pool());
+    for (int64_t i = 0; i < length; ++i) {
+      if (child_of_code[unique_codes[i]] == static_cast<int>(child)) {
+        offsets[i] = static_cast<int32_t>(take_indices.length());
+        RETURN_NOT_OK(take_indices.Append(unique_indices[i]));
+      } else if (!dense) {
+        RETURN_NOT_OK(take_indices.AppendNull());
+      }
+    }
+    std::shared_ptr<Array> indices, values;
+    RETURN_NOT_OK(take_indices.Finish(&indices));
+    RETURN_NOT_OK(Take(ctx, *dictionaries[child], *indices, &values));
+    children.push_back(values);
+  }
+
+  std::shared_ptr<Buffer> type_ids, value_offsets;
+  RETURN_NOT_OK(AllocateBuffer(ctx->memory_pool(), length, &type_ids));
+  std::copy(unique_codes.begin(), unique_codes.end(), type_ids->mutable_data());
+  if (dense) {
+    RETURN_NOT_OK(
+        AllocateBuffer(ctx->memory_pool(), length * sizeof(int32_t), &value_offsets));
+    std::copy(offsets.begin(), offsets.end(),
+              reinterpret_cast<int32_t*>(value_offsets->mutable_data()));
+  }
+  *out = std::make_shared<UnionArray>(value.type(), length, children, type_ids,
+                                      value_offsets);
+  return Status::OK();
+}
+
 }  // namespace
 
 Status Unique(FunctionContext* ctx, const Datum& value, std::shared_ptr<Array>* out) {
+  if (IsDictionaryEncoded(value)) {
+    return UniqueDictionaryEncoded(ctx, value, out);
+  }
+  if (value.type() != nullptr && value.type()->id() == Type::UNION) {
+    return UniqueUnion(ctx, value, out);
+  }
+
   std::unique_ptr<HashKernel> func;
   RETURN_NOT_OK(GetUniqueKernel(ctx, value.type(), &func));
 
   std::vector<Datum> dummy_outputs;
+  const ArrayVector morsels = HashMorsels(ctx, value);
+  if (!morsels.empty()) {
+    // The distinct values of the distinct values of each morsel
+    ArrayVector dictionaries;
+    RETURN_NOT_OK(
+        InvokeHashParallel(ctx, GetUniqueKernel, morsels, &dummy_outputs, &dictionaries));
+    dummy_outputs.clear();
+    auto distinct = std::make_shared<ChunkedArray>(dictionaries);
+    return InvokeHash(ctx, func.get(), Datum(distinct), &dummy_outputs, out);
+  }
   return InvokeHash(ctx, func.get(), value, &dummy_outputs, out);
 }
 
 Status DictionaryEncode(FunctionContext* ctx, const Datum& value, Datum* out) {
+  if (IsDictionaryEncoded(value)) {
+    return DictionaryEncodeDictionaryEncoded(ctx, value, out);
+  }
+
+  const ArrayVector morsels = HashMorsels(ctx, value);
+  if (!morsels.empty()) {
+    return DictionaryEncodeParallel(ctx, morsels, out);
+  }
+
   std::unique_ptr<HashKernel> func;
   RETURN_NOT_OK(GetDictionaryEncodeKernel(ctx, value.type(), &func));
 
@@ -921,5 +1080,231 @@ Status DictionaryEncode(FunctionContext* ctx, const Datum& value, Datum* out) {
   return Status::OK();
 }
 
+Status UnifyDictionaries(FunctionContext* ctx,
+                         const std::vector<std::shared_ptr<DataType>>& types,
+                         std::shared_ptr<DataType>* out_type,
+                         std::vector<std::shared_ptr<Buffer>>* transpose_maps) {
+  if (types.empty()) {
+    return Status::Invalid("Must pass at least one dictionary type");
+  }
+  ArrayVector dictionaries;
+  int index_width = 0;
+  for (const auto& type : types) {
+    if (type->id() != Type::DICTIONARY) {
+      std::stringstream ss;
+      ss << "Cannot unify dictionaries of non-dictionary type " << type->ToString();
+      return Status::Invalid(ss.str());
+    }
+    const auto& dict_type = checked_cast<const DictionaryType&>(*type);
+    if (!dictionaries.empty() &&
+        !dict_type.dictionary()->type()->Equals(*dictionaries[0]->type())) {
+      return Status::Invalid("Dictionaries to unify must have the same value type");
+    }
+    dictionaries.push_back(dict_type.dictionary());
+    const auto& index_type = checked_cast<const FixedWidthType&>(*dict_type.index_type());
+    index_width = std::max(index_width, index_type.bit_width());
+  }
+
+  // Dictionary-encoding each dictionary in turn with a single hash table yields
+  // the unified dictionary, and the indices of each piece are its transpose map
+  std::unique_ptr<HashKernel> func;
+  RETURN_NOT_OK(GetDictionaryEncodeKernel(ctx, dictionaries[0]->type(), &func));
+
+  std::shared_ptr<Array> dictionary;
+  std::vector<Datum> indices_outputs;
+  RETURN_NOT_OK(InvokeHash(ctx, func.get(),
+                           Datum(std::make_shared<ChunkedArray>(dictionaries)),
+                           &indices_outputs, &dictionary));
+
+  transpose_maps->clear();
+  for (const Datum& datum : indices_outputs) {
+    std::shared_ptr<Buffer> transpose_map = datum.array()->buffers[1];
+    if (transpose_map == nullptr) {
+      RETURN_NOT_OK(AllocateBuffer(ctx->memory_pool(), 0, &transpose_map));
+    }
+    transpose_maps->push_back(transpose_map);
+  }
+
+  const int64_t length = dictionary->length();
+  std::shared_ptr<DataType> index_type;
+  if (index_width <= 8 && length <= std::numeric_limits<int8_t>::max()) {
+    index_type = int8();
+  } else if (index_width <= 16 && length <= std::numeric_limits<int16_t>::max()) {
+    index_type = int16();
+  } else if (index_width <= 32 && length <= std::numeric_limits<int32_t>::max()) {
+    index_type = int32();
+  } else {
+    index_type = int64();
+  }
+  *out_type = ::arrow::dictionary(index_type, dictionary);
+  return Status::OK();
+}
+
+// ----------------------------------------------------------------------
+// Array hashing
+
+namespace {
+
+// Hash of a null value of any type
+constexpr uint64_t kNullHash = 0x4e2b39a1d5c7f083ULL;
+
+// Bijective 64-bit mix (the MurmurHash3 finalizer)
+inline uint64_t HashWord(uint64_t x) {
+  x ^= x >> 33;
+  x *= 0xff51afd7ed558ccdULL;
+  x ^= x >> 33;
+  x *= 0xc4ceb9fe1a85ec53ULL;
+  x ^= x >> 33;
+  return x;
+}
+
+inline uint64_t HashBytes(const uint8_t* data, int64_t length) {
+  constexpr uint64_t kMultiplier = 0xc6a4a7935bd1e995ULL;
+  uint64_t hash = static_cast<uint64_t>(length) * kMultiplier;
+  int64_t i = 0;
+  for (; i + 8 <= length; i += 8) {
+    uint64_t word;
+    std::memcpy(&word, data + i, sizeof(word));
+    hash = (hash ^ HashWord(word)) * kMultiplier;
+  }
+  if (i < length) {
+    uint64_t word = 0;
+    std::memcpy(&word, data + i, static_cast<size_t>(length - i));
+    hash = (hash ^ HashWord(word)) * kMultiplier;
+  }
+  return HashWord(hash);
+}
+
+class HashArrayImpl {
+ public:
+  HashArrayImpl(const ArrayData& data, uint64_t* out) : data_(data), out_(out) {}
+
+  Status Hash() {
+    RETURN_NOT_OK(VisitTypeInline(*data_.type, this));
+    if (data_.null_count != 0 && data_.buffers[0] != nullptr) {
+      internal::BitmapReader valid_reader(data_.buffers[0]->data(), data_.offset,
+                                          data_.length);
+      for (int64_t i = 0; i < data_.length; ++i) {
+        if (valid_reader.IsNotSet()) {
+          out_[i] = kNullHash;
+        }
+        valid_reader.Next();
+      }
+    }
+    return Status::OK();
+  }
+
+  Status Visit(const NullType&) {
+    std::fill(out_, out_ + data_.length, kNullHash);
+    return Status::OK();
+  }
+
+  Status Visit(const BooleanType&) {
+    internal::BitmapReader value_reader(data_.buffers[1]->data(), data_.offset,
+                                        data_.length);
+    const uint64_t hashes[2] = {HashWord(0), HashWord(1)};
+    for (int64_t i = 0; i < data_.length; ++i) {
+      out_[i] = hashes[value_reader.IsSet()];
+      value_reader.Next();
+    }
+    return Status::OK();
+  }
+
+  template <typename Type>
+  typename std::enable_if<has_c_type<Type>::value, Status>::type Visit(const Type&) {
+    using T = typename Type::c_type;
+    const T* values = GetValues<T>(data_, 1);
+    for (int64_t i = 0; i < data_.length; ++i) {
+      // A fixed-size memcpy compiles to a plain load, also for floating point
+      uint64_t word = 0;
+      std::memcpy(&word, values + i, sizeof(T));
+      out_[i] = HashWord(word);
+    }
+    return Status::OK();
+  }
+
+  Status Visit(const FixedSizeBinaryType& type) {
+    const int64_t byte_width = type.byte_width();
+    const uint8_t* data = GetValues<uint8_t>(data_, 1);
+    for (int64_t i = 0; i < data_.length; ++i) {
+      out_[i] = HashBytes(data + i * byte_width, byte_width);
+    }
+    return Status::OK();
+  }
+
+  Status Visit(const BinaryType&) {
+    // Fetch values a few iterations ahead, as they are read in a data-dependent
+    // order
+    constexpr int64_t kPrefetchDistance = 16;
+    constexpr uint8_t empty_value = 0;
+    const int32_t* offsets = GetValues<int32_t>(data_, 1);
+    const uint8_t* data =
+        data_.buffers[2] == nullptr ? &empty_value : data_.buffers[2]->data();
+    const int64_t prefetch_end = data_.length - kPrefetchDistance;
+    int64_t i = 0;
+    for (; i < prefetch_end; ++i) {
+      ARROW_PREFETCH(data + offsets[i + kPrefetchDistance]);
+      out_[i] = HashBytes(data + offsets[i], offsets[i + 1] - offsets[i]);
+    }
+    for (; i < data_.length; ++i) {
+      out_[i] = HashBytes(data + offsets[i], offsets[i + 1] - offsets[i]);
+    }
+    return Status::OK();
+  }
+
+  Status Visit(const DataType& type) {
+    std::stringstream ss;
+    ss << "Hashing arrays of type " << type.ToString();
+    return Status::NotImplemented(ss.str());
+  }
+
+ private:
+  const ArrayData& data_;
+  uint64_t* out_;
+};
+
+}  // namespace
+
+Status HashArray(const ArrayData& data, uint64_t* out) {
+  return HashArrayImpl(data, out).Hash();
+}
+
+Status HashRows(FunctionContext* ctx, const RecordBatch& batch,
+                const std::vector<int>& column_indices, std::shared_ptr<Array>* out) {
+  if (column_indices.empty()) {
+    return Status::Invalid("Must pass at least one column to hash");
+  }
+  for (int i : column_indices) {
+    if (i < 0 || i >= batch.num_columns()) {
+      std::stringstream ss;
+      ss << "Column index " << i << " out of bounds for a batch of "
+         << batch.num_columns() << " columns";
+      return Status::Invalid(ss.str());
+    }
+  }
+
+  const int64_t length = batch.num_rows();
+  std::shared_ptr<Buffer> hashes;
+  RETURN_NOT_OK(AllocateBuffer(ctx->memory_pool(), length * sizeof(uint64_t), &hashes));
+  auto row_hashes = reinterpret_cast<uint64_t*>(hashes->mutable_data());
+  RETURN_NOT_OK(HashArray(*batch.column_data(column_indices[0]), row_hashes));
+
+  if (column_indices.size() > 1) {
+    std::shared_ptr<Buffer> scratch;
+    RETURN_NOT_OK(
+        AllocateBuffer(ctx->memory_pool(), length * sizeof(uint64_t), &scratch));
+    auto column_hashes = reinterpret_cast<uint64_t*>(scratch->mutable_data());
+    for (size_t k = 1; k < column_indices.size(); ++k) {
+      RETURN_NOT_OK(HashArray(*batch.column_data(column_indices[k]), column_hashes));
+      for (int64_t i = 0; i < length; ++i) {
+        row_hashes[i] = HashUtil::HashCombine64(column_hashes[i], row_hashes[i]);
+      }
+    }
+  }
+
+  *out = std::make_shared<UInt64Array>(length, hashes);
+  return Status::OK();
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -18,6 +18,7 @@
 #ifndef ARROW_COMPUTE_KERNELS_HASH_H
 #define ARROW_COMPUTE_KERNELS_HASH_H
 
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -52,6 +53,11 @@ Status GetDictionaryEncodeKernel(FunctionContext* ctx,
                                  std::unique_ptr<HashKernel>* kernel);
 
 /// \brief Compute unique elements from an array-like object
+///
+/// If the context allows threads, the chunks of a chunked array, the very
+/// long ones a slice at a time, are hashed on the CPU thread pool; the result
+/// is the same.
+///
 /// \param[in] context the FunctionContext
 /// \param[in] datum array-like input
 /// \param[out] out result as Array
@@ -62,6 +68,12 @@ ARROW_EXPORT
 Status Unique(FunctionContext* context, const Datum& datum, std::shared_ptr<Array>* out);
 
 /// \brief Dictionary-encode values in an array-like object
+///
+/// If the context allows threads, the chunks of a chunked array, the very
+/// long ones a slice at a time, are encoded on the CPU thread pool and their
+/// dictionaries unified; the result then has a chunk per slice, but the same
+/// dictionary and indices.
+///
 /// \param[in] context the FunctionContext
 /// \param[in] data array-like input
 /// \param[out] out result with same shape and type as input
@@ -71,10 +83,63 @@ Status Unique(FunctionContext* context, const Datum& datum, std::shared_ptr<Arra
 ARROW_EXPORT
 Status DictionaryEncode(FunctionContext* context, const Datum& data, Datum* out);
 
-// TODO(wesm): Define API for incremental dictionary encoding
+/// \brief Unify the dictionaries of several dictionary types
+///
+/// The unified dictionary holds the distinct values of all input dictionaries,
+/// with the first dictionary's values first and in their original order. Its
+/// index type is the narrowest signed integer type that is at least as wide as
+/// every input index type and can address the whole dictionary. Use the
+/// transpose maps with DictionaryArray::Transpose to remap indices without
+/// decoding the values.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] types dictionary types whose dictionaries have the same value
+/// type and contain no nulls
+/// \param[out] out_type dictionary type holding the unified dictionary
+/// \param[out] transpose_maps for each input type, an int32 buffer mapping
+/// indices into its dictionary to indices into the unified dictionary
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Status UnifyDictionaries(FunctionContext* context,
+                         const std::vector<std::shared_ptr<DataType>>& types,
+                         std::shared_ptr<DataType>* out_type,
+                         std::vector<std::shared_ptr<Buffer>>* transpose_maps);
 
-// TODO(wesm): Define API for regularizing DictionaryArray objects with
-// different dictionaries
+/// \brief Compute a 64-bit hash of every value of an array
+///
+/// Fixed-width values are hashed with a multiply-xorshift mix of their bit
+/// pattern, in a branch-free loop over the whole column, so values of up to
+/// 64 bits never collide with each other. Binary and fixed-size binary values
+/// are hashed a word at a time. Floating point values are hashed by their bit
+/// pattern. All nulls hash to the same value.
+///
+/// \param[in] data the array to hash; its slice offset is honored
+/// \param[out] out preallocated space for data.length hashes
+/// \return Status, NotImplemented for nested, union and dictionary types
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Status HashArray(const ArrayData& data, uint64_t* out);
+
+/// \brief Compute a combined hash of several columns for every row of a batch
+///
+/// The columns are hashed one at a time with HashArray and each column's
+/// hashes are folded into the row hashes with HashUtil::HashCombine64, so
+/// every pass streams through a single column. Equal rows over the selected
+/// columns have equal hashes; the order of the columns matters.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] batch the record batch
+/// \param[in] column_indices the columns making up the key, at least one
+/// \param[out] out a UInt64Array without nulls holding one hash per row
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Status HashRows(FunctionContext* context, const RecordBatch& batch,
+                const std::vector<int>& column_indices, std::shared_ptr<Array>* out);
+
+// TODO(wesm): Define API for incremental dictionary encoding
 
 // class DictionaryEncoder {
 //  public:
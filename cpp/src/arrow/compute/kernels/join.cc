@@ -0,0 +1,380 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/join.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/builder.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/hash.h"
+#include "arrow/compute/kernels/row-keys-internal.h"
+#include "arrow/compute/kernels/take.h"
+#include "arrow/compute/kernels/util-internal.h"
+#include "arrow/concatenate.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/hash.h"
+
+namespace arrow {
+namespace compute {
+
+// ----------------------------------------------------------------------
+// HashJoin implementation
+//
+// Every distinct key of the build side is stored once, encoded, and the hash
+// table maps it to its key id. The build rows of a key are chained through
+// next_row_ in build order, starting at first_row_[key id].
+
+class HashJoin::HashJoinImpl {
+ public:
+  HashJoinImpl(FunctionContext* ctx, JoinType::type join_type,
+               const std::shared_ptr<Schema>& probe_schema,
+               const std::vector<int>& probe_keys,
+               const std::shared_ptr<Schema>& build_schema,
+               const std::vector<int>& build_keys)
+      : ctx_(ctx),
+        join_type_(join_type),
+        probe_schema_(probe_schema),
+        probe_keys_(probe_keys),
+        build_schema_(build_schema),
+        build_keys_(build_keys),
+        table_(ctx->memory_pool()),
+        key_data_(ctx->memory_pool()),
+        key_offsets_(ctx->memory_pool()),
+        num_build_rows_(0),
+        built_(false) {}
+
+  Status Init() {
+    if (probe_keys_.empty()) {
+      return Status::Invalid("Must join on at least one key column");
+    }
+    if (probe_keys_.size() != build_keys_.size()) {
+      return Status::Invalid("Probe and build sides must have as many key columns");
+    }
+    RETURN_NOT_OK(probe_encoder_.Init(*probe_schema_, probe_keys_));
+    RETURN_NOT_OK(build_encoder_.Init(*build_schema_, build_keys_));
+    for (size_t k = 0; k < probe_keys_.size(); ++k) {
+      const auto& probe_type = probe_schema_->field(probe_keys_[k])->type();
+      const auto& build_type = build_schema_->field(build_keys_[k])->type();
+      if (!probe_type->Equals(*build_type)) {
+        std::stringstream ss;
+        ss << "Cannot join keys of type " << probe_type->ToString()
+           << " with keys of type " << build_type->ToString();
+        return Status::Invalid(ss.str());
+      }
+    }
+
+    std::vector<std::shared_ptr<Field>> fields = probe_schema_->fields();
+    if (join_type_ != JoinType::LEFT_SEMI) {
+      for (int j = 0; j < build_schema_->num_fields(); ++j) {
+        if (std::find(build_keys_.begin(), build_keys_.end(), j) != build_keys_.end()) {
+          continue;
+        }
+        const auto& build_field = build_schema_->field(j);
+        build_output_columns_.push_back(j);
+        if (join_type_ == JoinType::LEFT_OUTER) {
+          fields.push_back(field(build_field->name(), build_field->type(), true,
+                                 build_field->metadata()));
+        } else {
+          fields.push_back(build_field);
+        }
+      }
+    }
+    output_schema_ = ::arrow::schema(fields);
+
+    RETURN_NOT_OK(key_offsets_.Append(0));
+    return table_.Init();
+  }
+
+  Status Build(RecordBatchReader* reader) {
+    if (built_) {
+      return Status::Invalid("The build side of the join was already read");
+    }
+    built_ = true;
+
+    std::vector<ArrayVector> chunks(build_output_columns_.size());
+    std::shared_ptr<RecordBatch> batch;
+    while (true) {
+      RETURN_NOT_OK(reader->ReadNext(&batch));
+      if (batch == nullptr) {
+        break;
+      }
+      if (!batch->schema()->Equals(*build_schema_)) {
+        return Status::Invalid("Batch schema does not match the join's build schema");
+      }
+      RETURN_NOT_OK(IndexRows(*batch));
+      for (size_t j = 0; j < build_output_columns_.size(); ++j) {
+        chunks[j].push_back(batch->column(build_output_columns_[j]));
+      }
+    }
+
+    MemoryPool* pool = ctx_->memory_pool();
+    for (size_t j = 0; j < build_output_columns_.size(); ++j) {
+      std::shared_ptr<Array> column;
+      if (chunks[j].empty()) {
+        std::unique_ptr<ArrayBuilder> builder;
+        RETURN_NOT_OK(MakeBuilder(
+            pool, build_schema_->field(build_output_columns_[j])->type(), &builder));
+        RETURN_NOT_OK(builder->Finish(&column));
+      } else if (chunks[j].size() == 1) {
+        column = chunks[j][0];
+      } else {
+        RETURN_NOT_OK(Concatenate(chunks[j], pool, &column));
+      }
+      build_columns_.push_back(column);
+    }
+    return Status::OK();
+  }
+
+  Status Probe(FunctionContext* ctx, const RecordBatch& batch,
+               std::shared_ptr<RecordBatch>* out) const {
+    if (!built_) {
+      return Status::Invalid("Must build the join before probing it");
+    }
+    if (!batch.schema()->Equals(*probe_schema_)) {
+      return Status::Invalid("Batch schema does not match the join's probe schema");
+    }
+    const int64_t length = batch.num_rows();
+
+    std::shared_ptr<Array> row_hashes;
+    RETURN_NOT_OK(HashRows(ctx, batch, probe_keys_, &row_hashes));
+    const uint64_t* hashes = checked_cast<const UInt64Array&>(*row_hashes).raw_values();
+    detail::RowKeyEncoder encoder = probe_encoder_;
+    encoder.Encode(batch);
+
+    // The probe rows are often joined once each, in order; their columns can
+    // then be used as they are
+    bool probe_identity = true;
+    Int64Builder probe_indices(ctx->memory_pool());
+    Int64Builder build_indices(ctx->memory_pool());
+    RETURN_NOT_OK(probe_indices.Reserve(length));
+    auto append_probe_row = [&](int64_t i) {
+      probe_identity = probe_identity && probe_indices.length() == i;
+      return probe_indices.Append(i);
+    };
+
+    for (int64_t i = 0; i < length; ++i) {
+      const uint8_t* key = encoder.key(i);
+      int32_t key_id = internal::GroupHashTable::kNotFound;
+      if (!encoder.HasNulls(key)) {
+        key_id = FindKey(hashes[i], key, encoder.key_length(i));
+      }
+      if (key_id == internal::GroupHashTable::kNotFound) {
+        if (join_type_ == JoinType::LEFT_OUTER) {
+          RETURN_NOT_OK(append_probe_row(i));
+          RETURN_NOT_OK(build_indices.AppendNull());
+        }
+        continue;
+      }
+      if (join_type_ == JoinType::LEFT_SEMI) {
+        RETURN_NOT_OK(append_probe_row(i));
+        continue;
+      }
+      for (int64_t row = first_row_[key_id]; row != -1; row = next_row_[row]) {
+        RETURN_NOT_OK(append_probe_row(i));
+        RETURN_NOT_OK(build_indices.Append(row));
+      }
+    }
+
+    const int64_t out_length = probe_indices.length();
+    probe_identity = probe_identity && out_length == length;
+    std::shared_ptr<Array> probe_positions, build_positions;
+    RETURN_NOT_OK(probe_indices.Finish(&probe_positions));
+    RETURN_NOT_OK(build_indices.Finish(&build_positions));
+
+    std::vector<std::shared_ptr<Array>> columns;
+    for (int j = 0; j < batch.num_columns(); ++j) {
+      std::shared_ptr<Array> column = batch.column(j);
+      if (!probe_identity) {
+        RETURN_NOT_OK(Take(ctx, *batch.column(j), *probe_positions, &column));
+      }
+      columns.push_back(column);
+    }
+    for (const auto& build_column : build_columns_) {
+      std::shared_ptr<Array> column;
+      RETURN_NOT_OK(Take(ctx, *build_column, *build_positions, &column));
+      columns.push_back(column);
+    }
+    *out = RecordBatch::Make(output_schema_, out_length, columns);
+    return Status::OK();
+  }
+
+  std::shared_ptr<Schema> output_schema() const { return output_schema_; }
+
+  int64_t num_build_rows() const { return num_build_rows_; }
+
+ private:
+  // Add the rows of a build batch to the chains of their keys
+  Status IndexRows(const RecordBatch& batch) {
+    const int64_t length = batch.num_rows();
+    std::shared_ptr<Array> row_hashes;
+    RETURN_NOT_OK(HashRows(ctx_, batch, build_keys_, &row_hashes));
+    const uint64_t* hashes = checked_cast<const UInt64Array&>(*row_hashes).raw_values();
+    build_encoder_.Encode(batch);
+
+    next_row_.resize(static_cast<size_t>(num_build_rows_ + length), -1);
+    for (int64_t i = 0; i < length; ++i) {
+      const uint8_t* key = build_encoder_.key(i);
+      if (build_encoder_.HasNulls(key)) {
+        continue;
+      }
+      const int64_t row = num_build_rows_ + i;
+      int32_t key_id;
+      RETURN_NOT_OK(
+          GetOrInsertKey(hashes[i], key, build_encoder_.key_length(i), &key_id));
+      if (key_id == static_cast<int32_t>(first_row_.size())) {
+        first_row_.push_back(row);
+        last_row_.push_back(row);
+      } else {
+        next_row_[last_row_[key_id]] = row;
+        last_row_[key_id] = row;
+      }
+    }
+    num_build_rows_ += length;
+    return Status::OK();
+  }
+
+  static uint32_t TableHash(uint64_t hash) {
+    return static_cast<uint32_t>(hash ^ (hash >> 32));
+  }
+
+  bool KeyEquals(int32_t key_id, const uint8_t* key, int64_t length) const {
+    const int64_t* offsets = key_offsets_.data();
+    return offsets[key_id + 1] - offsets[key_id] == length &&
+           0 == std::memcmp(key, key_data_.data() + offsets[key_id],
+                            static_cast<size_t>(length));
+  }
+
+  int32_t FindKey(uint64_t hash, const uint8_t* key, int64_t length) const {
+    int64_t pos;
+    return table_.Find(TableHash(hash),
+                       [&](int32_t key_id) { return KeyEquals(key_id, key, length); },
+                       &pos);
+  }
+
+  Status GetOrInsertKey(uint64_t hash, const uint8_t* key, int64_t length,
+                        int32_t* key_id) {
+    int64_t pos;
+    *key_id = table_.Find(TableHash(hash),
+                          [&](int32_t id) { return KeyEquals(id, key, length); }, &pos);
+    if (*key_id == internal::GroupHashTable::kNotFound) {
+      const int64_t num_keys = key_offsets_.length() - 1;
+      if (num_keys == std::numeric_limits<int32_t>::max()) {
+        return Status::CapacityError("Too many distinct join keys");
+      }
+      *key_id = static_cast<int32_t>(num_keys);
+      RETURN_NOT_OK(key_data_.Append(key, length));
+      RETURN_NOT_OK(key_offsets_.Append(key_data_.length()));
+      RETURN_NOT_OK(table_.Insert(pos, TableHash(hash), *key_id));
+    }
+    return Status::OK();
+  }
+
+  FunctionContext* ctx_;
+  JoinType::type join_type_;
+  std::shared_ptr<Schema> probe_schema_;
+  std::vector<int> probe_keys_;
+  std::shared_ptr<Schema> build_schema_;
+  std::vector<int> build_keys_;
+  std::shared_ptr<Schema> output_schema_;
+
+  detail::RowKeyEncoder probe_encoder_;
+  detail::RowKeyEncoder build_encoder_;
+
+  // The encoded build keys by key id
+  internal::GroupHashTable table_;
+  TypedBufferBuilder<uint8_t> key_data_;
+  TypedBufferBuilder<int64_t> key_offsets_;
+
+  // The chains of build rows of every key
+  std::vector<int64_t> first_row_;
+  std::vector<int64_t> last_row_;
+  std::vector<int64_t> next_row_;
+  int64_t num_build_rows_;
+
+  // The build columns in the output, concatenated over the build batches
+  std::vector<int> build_output_columns_;
+  std::vector<std::shared_ptr<Array>> build_columns_;
+  bool built_;
+};
+
+HashJoin::HashJoin(std::unique_ptr<HashJoinImpl> impl) : impl_(std::move(impl)) {}
+
+HashJoin::~HashJoin() {}
+
+Status HashJoin::Make(FunctionContext* ctx, JoinType::type join_type,
+                      const std::shared_ptr<Schema>& probe_schema,
+                      const std::vector<int>& probe_keys,
+                      const std::shared_ptr<Schema>& build_schema,
+                      const std::vector<int>& build_keys,
+                      std::unique_ptr<HashJoin>* out) {
+  std::unique_ptr<HashJoinImpl> impl(new HashJoinImpl(
+      ctx, join_type, probe_schema, probe_keys, build_schema, build_keys));
+  RETURN_NOT_OK(impl->Init());
+  out->reset(new HashJoin(std::move(impl)));
+  return Status::OK();
+}
+
+Status HashJoin::Build(RecordBatchReader* reader) { return impl_->Build(reader); }
+
+Status HashJoin::Probe(FunctionContext* ctx, const RecordBatch& batch,
+                       std::shared_ptr<RecordBatch>* out) const {
+  return impl_->Probe(ctx, batch, out);
+}
+
+std::shared_ptr<Schema> HashJoin::output_schema() const { return impl_->output_schema(); }
+
+int64_t HashJoin::num_build_rows() const { return impl_->num_build_rows(); }
+
+Status Join(FunctionContext* ctx, JoinType::type join_type, RecordBatchReader* probe,
+            const std::vector<int>& probe_keys, RecordBatchReader* build,
+            const std::vector<int>& build_keys, std::shared_ptr<Table>* out) {
+  std::unique_ptr<HashJoin> join;
+  RETURN_NOT_OK(HashJoin::Make(ctx, join_type, probe->schema(), probe_keys,
+                               build->schema(), build_keys, &join));
+  RETURN_NOT_OK(join->Build(build));
+
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  std::shared_ptr<RecordBatch> batch;
+  while (true) {
+    RETURN_NOT_OK(probe->ReadNext(&batch));
+    if (batch == nullptr) {
+      break;
+    }
+    batches.push_back(batch);
+  }
+
+  std::vector<std::shared_ptr<RecordBatch>> joined(batches.size());
+  RETURN_NOT_OK(detail::RunTasks(ctx, static_cast<int>(batches.size()),
+                                 [&](FunctionContext* task_ctx, int i) {
+                                   return join->Probe(task_ctx, *batches[i], &joined[i]);
+                                 }));
+  return Table::FromRecordBatches(join->output_schema(), joined, out);
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,139 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_COMPUTE_KERNELS_JOIN_H
+#define ARROW_COMPUTE_KERNELS_JOIN_H
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class RecordBatch;
+class RecordBatchReader;
+class Schema;
+class Table;
+
+namespace compute {
+
+class FunctionContext;
+
+/// \brief The kinds of joins
+struct ARROW_EXPORT JoinType {
+  enum type {
+    /// A row for every pair of probe and build rows with equal keys
+    INNER,
+    /// Like INNER, plus the probe rows without any match, with nulls for the
+    /// build columns
+    LEFT_OUTER,
+    /// The probe rows with at least one match, once each
+    LEFT_SEMI
+  };
+};
+
+/// \brief Hash join of batches of rows against a build side
+///
+/// The build side is read in full and its rows are indexed by key in a hash
+/// table. Probing a batch looks up the key of each of its rows and gathers
+/// the matching rows of both sides with Take. Joined rows are in probe order,
+/// and the matches of a probe row in build order. Rows whose key has a null
+/// never match.
+///
+/// Joined batches hold the probe columns followed by the build columns other
+/// than the build key columns, which are nullable for LEFT_OUTER joins.
+/// LEFT_SEMI joins only produce the probe columns.
+///
+/// Keys can be of boolean, primitive, binary, string, fixed-size binary or
+/// decimal type, the probe and build key columns having the same types. Once
+/// built, a join can probe batches from several threads at once.
+class ARROW_EXPORT HashJoin {
+ public:
+  ~HashJoin();
+
+  /// \brief Create a join of batches of a probe schema against batches of a
+  /// build schema
+  ///
+  /// \param[in] context the FunctionContext
+  /// \param[in] join_type the kind of join
+  /// \param[in] probe_schema schema of the batches to probe
+  /// \param[in] probe_keys indices of the probe key columns, at least one
+  /// \param[in] build_schema schema of the build side
+  /// \param[in] build_keys indices of the build key columns, matched in order
+  /// with the probe key columns
+  /// \param[out] out the join
+  static Status Make(FunctionContext* context, JoinType::type join_type,
+                     const std::shared_ptr<Schema>& probe_schema,
+                     const std::vector<int>& probe_keys,
+                     const std::shared_ptr<Schema>& build_schema,
+                     const std::vector<int>& build_keys, std::unique_ptr<HashJoin>* out);
+
+  /// \brief Read all batches of the build side and index their rows
+  ///
+  /// Must be called exactly once, before probing.
+  Status Build(RecordBatchReader* reader);
+
+  /// \brief Join a batch of the probe schema against the build side
+  ///
+  /// \param[in] context the FunctionContext of the calling thread
+  /// \param[in] batch the batch to probe
+  /// \param[out] out the joined rows, of the output schema
+  Status Probe(FunctionContext* context, const RecordBatch& batch,
+               std::shared_ptr<RecordBatch>* out) const;
+
+  /// \brief The schema of the joined batches
+  std::shared_ptr<Schema> output_schema() const;
+
+  /// \brief The number of rows of the build side
+  int64_t num_build_rows() const;
+
+ private:
+  class HashJoinImpl;
+
+  explicit HashJoin(std::unique_ptr<HashJoinImpl> impl);
+
+  std::unique_ptr<HashJoinImpl> impl_;
+};
+
+/// \brief Join all batches of a probe reader against all batches of a build
+/// reader
+///
+/// The probe batches are joined on the CPU thread pool if the context allows
+/// it, each batch being a partition of its own.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] join_type the kind of join
+/// \param[in] probe the batches to probe
+/// \param[in] probe_keys indices of the probe key columns
+/// \param[in] build the batches of the build side
+/// \param[in] build_keys indices of the build key columns
+/// \param[out] out table of the joined rows, see HashJoin
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Join(FunctionContext* context, JoinType::type join_type,
+            RecordBatchReader* probe, const std::vector<int>& probe_keys,
+            RecordBatchReader* build, const std::vector<int>& build_keys,
+            std::shared_ptr<Table>* out);
+
+}  // namespace compute
+}  // namespace arrow
+
+#endif  // ARROW_COMPUTE_KERNELS_JOIN_H
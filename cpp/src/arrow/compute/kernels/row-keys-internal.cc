@@ -0,0 +1,163 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/row-keys-internal.h"
+
+#include <cstring>
+#include <sstream>
+
+#include "arrow/buffer.h"
+#include "arrow/compute/kernels/util-internal.h"
+#include "arrow/record_batch.h"
+#include "arrow/type.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+namespace compute {
+namespace detail {
+
+namespace {
+
+struct KeyColumnVisitor {
+  Status Visit(const BooleanType&) {
+    column = {KeyColumn::BOOLEAN, 1};
+    return Status::OK();
+  }
+
+  Status Visit(const FixedWidthType& type) {
+    column = {KeyColumn::FIXED_WIDTH, type.bit_width() / 8};
+    return Status::OK();
+  }
+
+  Status Visit(const BinaryType&) {
+    column = {KeyColumn::BINARY, sizeof(int32_t)};
+    return Status::OK();
+  }
+
+  Status Visit(const DictionaryType& type) { return NotImplemented(type); }
+
+  Status Visit(const DataType& type) { return NotImplemented(type); }
+
+  Status NotImplemented(const DataType& type) {
+    std::stringstream ss;
+    ss << "Keys of type " << type.ToString();
+    return Status::NotImplemented(ss.str());
+  }
+
+  KeyColumn column;
+};
+
+}  // namespace
+
+Status RowKeyEncoder::Init(const Schema& schema, const std::vector<int>& key_columns) {
+  indices_ = key_columns;
+  columns_.clear();
+  for (int i : key_columns) {
+    if (i < 0 || i >= schema.num_fields()) {
+      std::stringstream ss;
+      ss << "Column index " << i << " out of bounds for a schema of "
+         << schema.num_fields() << " fields";
+      return Status::Invalid(ss.str());
+    }
+    KeyColumnVisitor visitor;
+    RETURN_NOT_OK(VisitTypeInline(*schema.field(i)->type(), &visitor));
+    columns_.push_back(visitor.column);
+  }
+  return Status::OK();
+}
+
+void RowKeyEncoder::Encode(const RecordBatch& batch) {
+  const int64_t length = batch.num_rows();
+  offsets_.assign(static_cast<size_t>(length + 1), 0);
+  for (size_t k = 0; k < columns_.size(); ++k) {
+    const KeyColumn& column = columns_[k];
+    if (column.kind == KeyColumn::BINARY) {
+      const ArrayData& data = *batch.column_data(indices_[k]);
+      const int32_t* offsets = GetValues<int32_t>(data, 1);
+      for (int64_t i = 0; i < length; ++i) {
+        const int64_t value_length = IsValid(data, i) ? offsets[i + 1] - offsets[i] : 0;
+        offsets_[i + 1] += 1 + column.byte_width + value_length;
+      }
+    } else {
+      for (int64_t i = 0; i < length; ++i) {
+        offsets_[i + 1] += 1 + column.byte_width;
+      }
+    }
+  }
+  for (int64_t i = 0; i < length; ++i) {
+    offsets_[i + 1] += offsets_[i];
+  }
+
+  keys_.assign(static_cast<size_t>(offsets_[length]), 0);
+  cursors_.assign(offsets_.begin(), offsets_.end() - 1);
+  for (size_t k = 0; k < columns_.size(); ++k) {
+    const KeyColumn& column = columns_[k];
+    const ArrayData& data = *batch.column_data(indices_[k]);
+    for (int64_t i = 0; i < length; ++i) {
+      uint8_t* dest = keys_.data() + cursors_[i];
+      const bool is_valid = IsValid(data, i);
+      *dest++ = is_valid;
+      switch (column.kind) {
+        case KeyColumn::FIXED_WIDTH:
+          if (is_valid) {
+            std::memcpy(dest,
+                        data.buffers[1]->data() + (data.offset + i) * column.byte_width,
+                        static_cast<size_t>(column.byte_width));
+          }
+          cursors_[i] += 1 + column.byte_width;
+          break;
+        case KeyColumn::BOOLEAN:
+          *dest = is_valid && BitUtil::GetBit(data.buffers[1]->data(), data.offset + i);
+          cursors_[i] += 2;
+          break;
+        case KeyColumn::BINARY: {
+          const int32_t* offsets = GetValues<int32_t>(data, 1);
+          const int32_t value_length = is_valid ? offsets[i + 1] - offsets[i] : 0;
+          std::memcpy(dest, &value_length, sizeof(int32_t));
+          if (value_length > 0) {
+            std::memcpy(dest + sizeof(int32_t), data.buffers[2]->data() + offsets[i],
+                        static_cast<size_t>(value_length));
+          }
+          cursors_[i] += 1 + sizeof(int32_t) + value_length;
+        } break;
+      }
+    }
+  }
+}
+
+bool RowKeyEncoder::HasNulls(const uint8_t* key) const {
+  for (const KeyColumn& column : columns_) {
+    if (!*key) {
+      return true;
+    }
+    key += EncodedWidth(column, key);
+  }
+  return false;
+}
+
+int64_t RowKeyEncoder::EncodedWidth(const KeyColumn& column, const uint8_t* key) {
+  if (column.kind == KeyColumn::BINARY) {
+    int32_t value_length;
+    std::memcpy(&value_length, key + 1, sizeof(int32_t));
+    return 1 + sizeof(int32_t) + value_length;
+  }
+  return 1 + column.byte_width;
+}
+
+}  // namespace detail
+}  // namespace compute
+}  // namespace arrow
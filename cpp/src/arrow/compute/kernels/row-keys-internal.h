@@ -0,0 +1,94 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_COMPUTE_KERNELS_ROW_KEYS_INTERNAL_H
+#define ARROW_COMPUTE_KERNELS_ROW_KEYS_INTERNAL_H
+
+#include <cstdint>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/status.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/bit-util.h"
+
+namespace arrow {
+
+class RecordBatch;
+class Schema;
+
+namespace compute {
+namespace detail {
+
+// ----------------------------------------------------------------------
+// Row keys
+//
+// The key of a row is encoded as one byte string so that keys are compared
+// with a single memcmp. Each key column contributes a validity byte followed
+// by the value bytes (zeroed for nulls); binary values are prefixed with their
+// 32-bit length.
+
+struct KeyColumn {
+  enum Kind { FIXED_WIDTH, BOOLEAN, BINARY };
+
+  Kind kind;
+  int64_t byte_width;
+};
+
+inline bool IsValid(const ArrayData& data, int64_t i) {
+  return data.null_count == 0 || data.buffers[0] == nullptr ||
+         BitUtil::GetBit(data.buffers[0]->data(), data.offset + i);
+}
+
+// Encodes the keys of the rows of record batches over some key columns
+class RowKeyEncoder {
+ public:
+  // Check the key columns of the schema and choose their encodings. Keys can
+  // be of boolean, primitive, binary, string, fixed-size binary or decimal
+  // type.
+  Status Init(const Schema& schema, const std::vector<int>& key_columns);
+
+  // Encode the keys of all rows of a batch of the schema given to Init,
+  // replacing the keys of the previous batch
+  void Encode(const RecordBatch& batch);
+
+  const std::vector<KeyColumn>& columns() const { return columns_; }
+
+  const uint8_t* key(int64_t i) const { return keys_.data() + offsets_[i]; }
+
+  int64_t key_length(int64_t i) const { return offsets_[i + 1] - offsets_[i]; }
+
+  // Whether any key column of an encoded key is null
+  bool HasNulls(const uint8_t* key) const;
+
+  // The number of bytes a key column takes in an encoded key, starting at key
+  static int64_t EncodedWidth(const KeyColumn& column, const uint8_t* key);
+
+ private:
+  std::vector<int> indices_;
+  std::vector<KeyColumn> columns_;
+
+  std::vector<uint8_t> keys_;
+  std::vector<int64_t> offsets_;
+  std::vector<int64_t> cursors_;
+};
+
+}  // namespace detail
+}  // namespace compute
+}  // namespace arrow
+
+#endif  // ARROW_COMPUTE_KERNELS_ROW_KEYS_INTERNAL_H
@@ -0,0 +1,425 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/sort.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/take.h"
+#include "arrow/compute/kernels/util-internal.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/parallel.h"
+
+namespace arrow {
+namespace compute {
+
+namespace {
+
+// The non-null values of one or more chunks in sorted order: their sort keys
+// along with their positions
+template <typename Key>
+struct SortedRun {
+  std::vector<Key> keys;
+  std::vector<uint64_t> indices;
+};
+
+// ----------------------------------------------------------------------
+// Radix sort
+
+// Order-preserving mapping of integers and floating point values to unsigned
+// integers of the same width
+template <typename T, typename Enable = void>
+struct RadixKey {};
+
+template <typename T>
+struct RadixKey<T, typename std::enable_if<std::is_integral<T>::value>::type> {
+  using type = typename std::make_unsigned<T>::type;
+
+  static type Encode(T value) {
+    // Flip the sign bit so that negative values come first
+    constexpr type kFlip = std::is_signed<T>::value
+                               ? static_cast<type>(static_cast<type>(1)
+                                                   << (sizeof(type) * 8 - 1))
+                               : static_cast<type>(0);
+    return static_cast<type>(static_cast<type>(value) ^ kFlip);
+  }
+};
+
+template <typename T>
+struct RadixKey<T, typename std::enable_if<std::is_floating_point<T>::value>::type> {
+  using type = typename std::conditional<sizeof(T) == 4, uint32_t, uint64_t>::type;
+
+  static type Encode(T value) {
+    constexpr type kSignBit = static_cast<type>(1) << (sizeof(type) * 8 - 1);
+    if (std::isnan(value)) {
+      // All NaNs sort last, whatever their sign and payload
+      value = std::numeric_limits<T>::quiet_NaN();
+    }
+    type bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    // Negative values have all their bits flipped to reverse their order,
+    // positive ones only their sign bit to come after the negative ones
+    return (bits & kSignBit) ? static_cast<type>(~bits) : (bits | kSignBit);
+  }
+};
+
+// Sort by the keys with a least significant digit radix sort, one byte at a
+// time. Passes over a byte that every key shares are skipped.
+template <typename Key>
+void RadixSort(SortedRun<Key>* run) {
+  constexpr int kNumPasses = static_cast<int>(sizeof(Key));
+  const int64_t length = static_cast<int64_t>(run->keys.size());
+  if (length < 2) {
+    return;
+  }
+
+  // The histograms of all passes are computed in a single pass over the keys
+  std::vector<int64_t> counts(kNumPasses * 256, 0);
+  for (const Key key : run->keys) {
+    for (int pass = 0; pass < kNumPasses; ++pass) {
+      ++counts[pass * 256 + ((key >> (pass * 8)) & 0xFF)];
+    }
+  }
+
+  std::vector<Key> keys(static_cast<size_t>(length));
+  std::vector<uint64_t> indices(static_cast<size_t>(length));
+  for (int pass = 0; pass < kNumPasses; ++pass) {
+    int64_t* pass_counts = counts.data() + pass * 256;
+    const int shift = pass * 8;
+    if (pass_counts[(run->keys[0] >> shift) & 0xFF] == length) {
+      continue;
+    }
+    int64_t offset = 0;
+    for (int digit = 0; digit < 256; ++digit) {
+      const int64_t count = pass_counts[digit];
+      pass_counts[digit] = offset;
+      offset += count;
+    }
+    for (int64_t i = 0; i < length; ++i) {
+      const Key key = run->keys[i];
+      const int64_t dest = pass_counts[(key >> shift) & 0xFF]++;
+      keys[dest] = key;
+      indices[dest] = run->indices[i];
+    }
+    run->keys.swap(keys);
+    run->indices.swap(indices);
+  }
+}
+
+// ----------------------------------------------------------------------
+// Sorters
+//
+// A sorter provides the sort key of the value at a position of a chunk, and
+// sorts a run made of the keys of the non-null values of a chunk, which are in
+// the order of their positions.
+
+template <typename Type>
+class RadixSorter {
+ public:
+  using T = typename Type::c_type;
+  using Key = typename RadixKey<T>::type;
+
+  explicit RadixSorter(const ArrayData& values) : values_(GetValues<T>(values, 1)) {}
+
+  Key key(int64_t i) const { return RadixKey<T>::Encode(values_[i]); }
+
+  static void Sort(SortedRun<Key>* run) { RadixSort(run); }
+
+ private:
+  const T* values_;
+};
+
+class BooleanSorter {
+ public:
+  using Key = uint8_t;
+
+  explicit BooleanSorter(const ArrayData& values)
+      : values_(values.length > 0 ? values.buffers[1]->data() : nullptr),
+        offset_(values.offset) {}
+
+  Key key(int64_t i) const { return BitUtil::GetBit(values_, offset_ + i) ? 1 : 0; }
+
+  static void Sort(SortedRun<Key>* run) { RadixSort(run); }
+
+ private:
+  const uint8_t* values_;
+  int64_t offset_;
+};
+
+// A binary value pointing into the buffers of the chunk it comes from
+struct BinaryKey {
+  const uint8_t* data;
+  int32_t length;
+
+  bool operator<(const BinaryKey& other) const {
+    const int32_t prefix_length = std::min(length, other.length);
+    const int cmp = prefix_length > 0 ? std::memcmp(data, other.data,
+                                                    static_cast<size_t>(prefix_length))
+                                      : 0;
+    return cmp < 0 || (cmp == 0 && length < other.length);
+  }
+};
+
+// Sort binary keys by comparison, positions breaking ties to keep the sort
+// stable
+void SortBinaryKeys(SortedRun<BinaryKey>* run) {
+  const size_t length = run->keys.size();
+  std::vector<std::pair<BinaryKey, uint64_t>> entries(length);
+  for (size_t i = 0; i < length; ++i) {
+    entries[i] = std::make_pair(run->keys[i], run->indices[i]);
+  }
+  std::sort(entries.begin(), entries.end(),
+            [](const std::pair<BinaryKey, uint64_t>& left,
+               const std::pair<BinaryKey, uint64_t>& right) {
+              return left.first < right.first ||
+                     (!(right.first < left.first) && left.second < right.second);
+            });
+  for (size_t i = 0; i < length; ++i) {
+    run->keys[i] = entries[i].first;
+    run->indices[i] = entries[i].second;
+  }
+}
+
+class BinarySorter {
+ public:
+  using Key = BinaryKey;
+
+  explicit BinarySorter(const ArrayData& values)
+      : offsets_(GetValues<int32_t>(values, 1)),
+        data_(values.buffers[2] != nullptr ? values.buffers[2]->data() : nullptr) {}
+
+  Key key(int64_t i) const {
+    return BinaryKey{data_ + offsets_[i], offsets_[i + 1] - offsets_[i]};
+  }
+
+  static void Sort(SortedRun<Key>* run) { SortBinaryKeys(run); }
+
+ private:
+  const int32_t* offsets_;
+  const uint8_t* data_;
+};
+
+class FixedSizeBinarySorter {
+ public:
+  using Key = BinaryKey;
+
+  explicit FixedSizeBinarySorter(const ArrayData& values)
+      : byte_width_(checked_cast<const FixedSizeBinaryType&>(*values.type).byte_width()),
+        data_(values.buffers[1] != nullptr
+                  ? values.buffers[1]->data() + values.offset * byte_width_
+                  : nullptr) {}
+
+  Key key(int64_t i) const { return BinaryKey{data_ + i * byte_width_, byte_width_}; }
+
+  static void Sort(SortedRun<Key>* run) { SortBinaryKeys(run); }
+
+ private:
+  int32_t byte_width_;
+  const uint8_t* data_;
+};
+
+// ----------------------------------------------------------------------
+// Sorting chunks and merging the sorted chunks
+
+// Sort the non-null values of a chunk whose first value is at position base,
+// and collect the positions of its nulls
+template <typename Sorter>
+void SortChunk(const ArrayData& values, uint64_t base,
+               SortedRun<typename Sorter::Key>* run, std::vector<uint64_t>* nulls) {
+  if (values.length == 0) {
+    return;
+  }
+  const Sorter sorter(values);
+  const int64_t num_valid =
+      values.length - (values.null_count < 0 ? 0 : values.null_count);
+  run->keys.reserve(static_cast<size_t>(num_valid));
+  run->indices.reserve(static_cast<size_t>(num_valid));
+  VisitValidityBlocks(values, [&](int64_t position, int64_t length, uint64_t valid) {
+    for (int64_t j = 0; j < length; ++j) {
+      const int64_t i = position + j;
+      if ((valid >> j) & 1) {
+        run->keys.push_back(sorter.key(i));
+        run->indices.push_back(base + static_cast<uint64_t>(i));
+      } else {
+        nulls->push_back(base + static_cast<uint64_t>(i));
+      }
+    }
+  });
+  Sorter::Sort(run);
+}
+
+// Merge two sorted runs, the values of the left one coming first on ties
+template <typename Key>
+void MergeRuns(const SortedRun<Key>& left, const SortedRun<Key>& right,
+               SortedRun<Key>* out) {
+  const size_t length = left.keys.size() + right.keys.size();
+  out->keys.resize(length);
+  out->indices.resize(length);
+  size_t i = 0;
+  size_t j = 0;
+  for (size_t k = 0; k < length; ++k) {
+    if (j == right.keys.size() ||
+        (i < left.keys.size() && !(right.keys[j] < left.keys[i]))) {
+      out->keys[k] = left.keys[i];
+      out->indices[k] = left.indices[i++];
+    } else {
+      out->keys[k] = right.keys[j];
+      out->indices[k] = right.indices[j++];
+    }
+  }
+}
+
+template <typename Function>
+Status RunTasks(bool use_threads, int num_tasks, Function&& func) {
+  if (use_threads && num_tasks > 1) {
+    return ParallelFor(num_tasks, std::forward<Function>(func));
+  }
+  for (int i = 0; i < num_tasks; ++i) {
+    RETURN_NOT_OK(func(i));
+  }
+  return Status::OK();
+}
+
+template <typename Sorter>
+Status SortChunks(FunctionContext* ctx, const ArrayVector& chunks, bool use_threads,
+                  std::shared_ptr<Array>* out) {
+  using Key = typename Sorter::Key;
+
+  const int num_chunks = static_cast<int>(chunks.size());
+  std::vector<uint64_t> bases(chunks.size());
+  uint64_t length = 0;
+  for (int i = 0; i < num_chunks; ++i) {
+    bases[i] = length;
+    length += static_cast<uint64_t>(chunks[i]->length());
+  }
+
+  std::vector<SortedRun<Key>> runs(chunks.size());
+  std::vector<std::vector<uint64_t>> nulls(chunks.size());
+  auto SortOne = [&](int i) {
+    SortChunk<Sorter>(*chunks[i]->data(), bases[i], &runs[i], &nulls[i]);
+    return Status::OK();
+  };
+  RETURN_NOT_OK(RunTasks(use_threads, num_chunks, SortOne));
+
+  while (runs.size() > 1) {
+    std::vector<SortedRun<Key>> merged((runs.size() + 1) / 2);
+    auto MergeOne = [&](int i) {
+      MergeRuns(runs[2 * i], runs[2 * i + 1], &merged[i]);
+      runs[2 * i] = SortedRun<Key>();
+      runs[2 * i + 1] = SortedRun<Key>();
+      return Status::OK();
+    };
+    RETURN_NOT_OK(RunTasks(use_threads, static_cast<int>(runs.size() / 2), MergeOne));
+    if (runs.size() % 2 != 0) {
+      merged.back() = std::move(runs.back());
+    }
+    runs.swap(merged);
+  }
+
+  std::shared_ptr<Buffer> indices;
+  RETURN_NOT_OK(AllocateBuffer(
+      ctx->memory_pool(), static_cast<int64_t>(length * sizeof(uint64_t)), &indices));
+  uint64_t* dest = reinterpret_cast<uint64_t*>(indices->mutable_data());
+  if (!runs.empty()) {
+    const std::vector<uint64_t>& sorted = runs[0].indices;
+    std::copy(sorted.begin(), sorted.end(), dest);
+    dest += sorted.size();
+  }
+  for (const auto& chunk_nulls : nulls) {
+    std::copy(chunk_nulls.begin(), chunk_nulls.end(), dest);
+    dest += chunk_nulls.size();
+  }
+  *out = std::make_shared<UInt64Array>(static_cast<int64_t>(length), indices);
+  return Status::OK();
+}
+
+Status SortChunks(FunctionContext* ctx, const std::shared_ptr<DataType>& type,
+                  const ArrayVector& chunks, bool use_threads,
+                  std::shared_ptr<Array>* out) {
+#define RADIX_SORT_CASE(InType) \
+  case InType::type_id:         \
+    return SortChunks<RadixSorter<InType>>(ctx, chunks, use_threads, out)
+
+  switch (type->id()) {
+    RADIX_SORT_CASE(UInt8Type);
+    RADIX_SORT_CASE(Int8Type);
+    RADIX_SORT_CASE(UInt16Type);
+    RADIX_SORT_CASE(Int16Type);
+    RADIX_SORT_CASE(UInt32Type);
+    RADIX_SORT_CASE(Int32Type);
+    RADIX_SORT_CASE(UInt64Type);
+    RADIX_SORT_CASE(Int64Type);
+    RADIX_SORT_CASE(FloatType);
+    RADIX_SORT_CASE(DoubleType);
+    RADIX_SORT_CASE(Date32Type);
+    RADIX_SORT_CASE(Date64Type);
+    RADIX_SORT_CASE(Time32Type);
+    RADIX_SORT_CASE(Time64Type);
+    RADIX_SORT_CASE(TimestampType);
+    case Type::BOOL:
+      return SortChunks<BooleanSorter>(ctx, chunks, use_threads, out);
+    case Type::BINARY:
+    case Type::STRING:
+      return SortChunks<BinarySorter>(ctx, chunks, use_threads, out);
+    case Type::FIXED_SIZE_BINARY:
+      return SortChunks<FixedSizeBinarySorter>(ctx, chunks, use_threads, out);
+    default:
+      break;
+  }
+
+#undef RADIX_SORT_CASE
+
+  std::stringstream ss;
+  ss << "Sorting arrays of type " << type->ToString();
+  return Status::NotImplemented(ss.str());
+}
+
+}  // namespace
+
+Status SortIndices(FunctionContext* ctx, const Array& values,
+                   std::shared_ptr<Array>* out) {
+  return SortChunks(ctx, values.type(), {MakeArray(values.data())}, false, out);
+}
+
+Status SortIndices(FunctionContext* ctx, const ChunkedArray& values,
+                   const SortOptions& options, std::shared_ptr<Array>* out) {
+  return SortChunks(ctx, values.type(), values.chunks(), options.use_threads, out);
+}
+
+Status Sort(FunctionContext* ctx, const Array& values, std::shared_ptr<Array>* out) {
+  std::shared_ptr<Array> indices;
+  RETURN_NOT_OK(SortIndices(ctx, values, &indices));
+  return Take(ctx, values, *indices, out);
+}
+
+}  // namespace compute
+}  // namespace arrow
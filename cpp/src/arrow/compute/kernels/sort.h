@@ -0,0 +1,92 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_COMPUTE_KERNELS_SORT_H
+#define ARROW_COMPUTE_KERNELS_SORT_H
+
+#include <memory>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Array;
+class ChunkedArray;
+
+namespace compute {
+
+class FunctionContext;
+
+/// \brief Options for sorting chunked arrays
+struct ARROW_EXPORT SortOptions {
+  explicit SortOptions(bool use_threads = true) : use_threads(use_threads) {}
+
+  /// Sort the chunks and merge the sorted chunks on the CPU thread pool
+  bool use_threads;
+};
+
+/// \brief Compute the permutation that sorts an array in ascending order
+///
+/// The sort is stable and nulls are placed at the end. Integer, floating
+/// point, boolean, date, time and timestamp values are sorted with an LSD
+/// radix sort, skipping the passes over bytes all values share; floating point
+/// NaNs sort after all other values. Binary, string and fixed-size binary
+/// values are compared lexicographically in place.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] values the array to sort
+/// \param[out] out uint64 array of the positions of the values in sorted order
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Status SortIndices(FunctionContext* context, const Array& values,
+                   std::shared_ptr<Array>* out);
+
+/// \brief Compute the permutation that sorts a chunked array in ascending order
+///
+/// Each chunk is sorted on its own, then the sorted chunks are merged pairwise
+/// until one is left. Both steps run on the CPU thread pool if use_threads is
+/// set in the options.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] values the chunked array to sort
+/// \param[in] options sort options
+/// \param[out] out uint64 array of the positions of the values in sorted order,
+/// counting through the chunks one after the other
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Status SortIndices(FunctionContext* context, const ChunkedArray& values,
+                   const SortOptions& options, std::shared_ptr<Array>* out);
+
+/// \brief Sort an array in ascending order
+///
+/// Equivalent to taking the values at the positions given by SortIndices.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] values the array to sort
+/// \param[out] out the sorted values
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Sort(FunctionContext* context, const Array& values, std::shared_ptr<Array>* out);
+
+}  // namespace compute
+}  // namespace arrow
+
+#endif  // ARROW_COMPUTE_KERNELS_SORT_H
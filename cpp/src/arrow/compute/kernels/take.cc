@@ -0,0 +1,627 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/take.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/util-internal.h"
+#include "arrow/memory_pool.h"
+#include "arrow/type.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+namespace compute {
+
+namespace {
+
+// ----------------------------------------------------------------------
+// Take
+
+// Resolve integer indices to positions in an array of num_values values, -1
+// standing for a null index
+template <typename IndexType>
+Status ResolvePositions(const ArrayData& indices, int64_t num_values,
+                        std::vector<int64_t>* positions) {
+  using IndexT = typename IndexType::c_type;
+  const IndexT* raw = GetValues<IndexT>(indices, 1);
+  const uint8_t* bitmap = indices.null_count != 0 && indices.buffers[0] != nullptr
+                              ? indices.buffers[0]->data()
+                              : nullptr;
+  positions->resize(static_cast<size_t>(indices.length));
+  int64_t* out = positions->data();
+  for (int64_t i = 0; i < indices.length; ++i) {
+    if (bitmap != nullptr && !BitUtil::GetBit(bitmap, indices.offset + i)) {
+      out[i] = -1;
+      continue;
+    }
+    // Unsigned 64-bit indices too large for int64 turn negative and are
+    // rejected along with the other out of bounds indices
+    const int64_t position = static_cast<int64_t>(raw[i]);
+    if (position < 0 || position >= num_values) {
+      std::stringstream ss;
+      ss << "Take index " << position << " out of bounds for array of length "
+         << num_values;
+      return Status::Invalid(ss.str());
+    }
+    out[i] = position;
+  }
+  return Status::OK();
+}
+
+Status ResolvePositions(const ArrayData& indices, int64_t num_values,
+                        std::vector<int64_t>* positions) {
+  switch (indices.type->id()) {
+    case Type::INT8:
+      return ResolvePositions<Int8Type>(indices, num_values, positions);
+    case Type::INT16:
+      return ResolvePositions<Int16Type>(indices, num_values, positions);
+    case Type::INT32:
+      return ResolvePositions<Int32Type>(indices, num_values, positions);
+    case Type::INT64:
+      return ResolvePositions<Int64Type>(indices, num_values, positions);
+    case Type::UINT8:
+      return ResolvePositions<UInt8Type>(indices, num_values, positions);
+    case Type::UINT16:
+      return ResolvePositions<UInt16Type>(indices, num_values, positions);
+    case Type::UINT32:
+      return ResolvePositions<UInt32Type>(indices, num_values, positions);
+    case Type::UINT64:
+      return ResolvePositions<UInt64Type>(indices, num_values, positions);
+    default:
+      break;
+  }
+  std::stringstream ss;
+  ss << "Take indices must be of integer type, got " << indices.type->ToString();
+  return Status::Invalid(ss.str());
+}
+
+// Copy the fixed-width values at the given positions, reading the first value
+// for null positions so that the copy loop doesn't branch
+template <typename T>
+void GatherValues(const uint8_t* in, const std::vector<int64_t>& positions,
+                  uint8_t* out) {
+  const T* values = reinterpret_cast<const T*>(in);
+  T* dest = reinterpret_cast<T*>(out);
+  for (size_t i = 0; i < positions.size(); ++i) {
+    dest[i] = values[std::max<int64_t>(positions[i], 0)];
+  }
+}
+
+// Gather the values of an array at positions into it, -1 standing for a null
+class TakeImpl {
+ public:
+  TakeImpl(MemoryPool* pool, const ArrayData& values,
+           const std::vector<int64_t>& positions)
+      : pool_(pool), values_(values), positions_(positions) {}
+
+  Status Take(std::shared_ptr<ArrayData>* out) {
+    const int64_t length = static_cast<int64_t>(positions_.size());
+    out_ = std::make_shared<ArrayData>(values_.type, length);
+
+    std::shared_ptr<Buffer> null_bitmap;
+    if (values_.type->id() == Type::NA) {
+      out_->null_count = length;
+    } else if (values_.type->id() == Type::RUN_LENGTH_ENCODED) {
+      // Null positions take a run of a null value instead
+      out_->null_count = 0;
+    } else {
+      RETURN_NOT_OK(TakeNullBitmap(&null_bitmap));
+    }
+    out_->buffers.push_back(null_bitmap);
+
+    RETURN_NOT_OK(VisitTypeInline(*values_.type, this));
+    *out = out_;
+    return Status::OK();
+  }
+
+  Status Visit(const NullType&) { return Status::OK(); }
+
+  Status Visit(const BooleanType&) {
+    std::shared_ptr<Buffer> values;
+    RETURN_NOT_OK(GetEmptyBitmap(pool_, out_->length, &values));
+    uint8_t* dest = values->mutable_data();
+    if (values_.length > 0) {
+      const uint8_t* bitmap = values_.buffers[1]->data();
+      for (int64_t i = 0; i < out_->length; ++i) {
+        const int64_t position = positions_[i];
+        if (position >= 0 && BitUtil::GetBit(bitmap, values_.offset + position)) {
+          BitUtil::SetBit(dest, i);
+        }
+      }
+    }
+    out_->buffers.push_back(values);
+    return Status::OK();
+  }
+
+  Status Visit(const FixedWidthType& type) {
+    const int64_t byte_width = type.bit_width() / 8;
+    std::shared_ptr<Buffer> values;
+    RETURN_NOT_OK(AllocateBuffer(pool_, out_->length * byte_width, &values));
+    uint8_t* dest = values->mutable_data();
+    if (values_.length == 0) {
+      // Only null positions can select from an empty array
+      std::memset(dest, 0, static_cast<size_t>(out_->length * byte_width));
+      out_->buffers.push_back(values);
+      return Status::OK();
+    }
+
+    const uint8_t* src = values_.buffers[1]->data() + values_.offset * byte_width;
+    switch (byte_width) {
+      case 1:
+        GatherValues<uint8_t>(src, positions_, dest);
+        break;
+      case 2:
+        GatherValues<uint16_t>(src, positions_, dest);
+        break;
+      case 4:
+        GatherValues<uint32_t>(src, positions_, dest);
+        break;
+      case 8:
+        GatherValues<uint64_t>(src, positions_, dest);
+        break;
+      default:
+        for (int64_t i = 0; i < out_->length; ++i) {
+          const int64_t position = std::max<int64_t>(positions_[i], 0);
+          std::memcpy(dest + i * byte_width, src + position * byte_width,
+                      static_cast<size_t>(byte_width));
+        }
+        break;
+    }
+    out_->buffers.push_back(values);
+    return Status::OK();
+  }
+
+  Status Visit(const BinaryType&) { return TakeBinary<int32_t>(); }
+
+  Status Visit(const LargeBinaryType&) { return TakeBinary<int64_t>(); }
+
+  Status Visit(const ListType&) { return TakeList<int32_t>(); }
+
+  Status Visit(const LargeListType&) { return TakeList<int64_t>(); }
+
+  Status Visit(const FixedSizeListType& type) {
+    // Each selected list takes its list_size consecutive child values, which
+    // are not sliced along with the parent, and a null position as many nulls
+    const int64_t list_size = type.list_size();
+    std::vector<int64_t> child_positions;
+    child_positions.reserve(static_cast<size_t>(out_->length * list_size));
+    for (int64_t i = 0; i < out_->length; ++i) {
+      const int64_t position = positions_[i];
+      const int64_t begin = position >= 0 ? (values_.offset + position) * list_size : -1;
+      for (int64_t j = 0; j < list_size; ++j) {
+        child_positions.push_back(begin >= 0 ? begin + j : -1);
+      }
+    }
+    std::shared_ptr<ArrayData> child;
+    RETURN_NOT_OK(TakeImpl(pool_, *values_.child_data[0], child_positions).Take(&child));
+    out_->child_data.push_back(child);
+    return Status::OK();
+  }
+
+  Status Visit(const StructType&) { return TakeChildrenAtPositions(); }
+
+  Status Visit(const RunLengthEncodedType&) {
+    // Consecutive positions in the same run, or null, make a run of the output
+    const int32_t* run_ends =
+        values_.buffers[1] != nullptr
+            ? reinterpret_cast<const int32_t*>(values_.buffers[1]->data())
+            : nullptr;
+    const int32_t* run_ends_end = run_ends + values_.child_data[0]->length;
+    TypedBufferBuilder<int32_t> run_ends_builder(pool_);
+    std::vector<int64_t> child_positions;
+    int64_t last_run = -2;
+    for (int64_t i = 0; i < out_->length; ++i) {
+      const int64_t position = positions_[i];
+      const int64_t run =
+          position < 0
+              ? -1
+              : std::upper_bound(run_ends, run_ends_end, values_.offset + position) -
+                    run_ends;
+      if (run != last_run) {
+        if (i > 0) {
+          RETURN_NOT_OK(run_ends_builder.Append(static_cast<int32_t>(i)));
+        }
+        child_positions.push_back(run);
+        last_run = run;
+      }
+    }
+    if (out_->length > 0) {
+      RETURN_NOT_OK(run_ends_builder.Append(static_cast<int32_t>(out_->length)));
+    }
+    std::shared_ptr<Buffer> out_run_ends;
+    RETURN_NOT_OK(run_ends_builder.Finish(&out_run_ends));
+    std::shared_ptr<ArrayData> child;
+    RETURN_NOT_OK(TakeImpl(pool_, *values_.child_data[0], child_positions).Take(&child));
+    out_->buffers.push_back(out_run_ends);
+    out_->child_data.push_back(child);
+    return Status::OK();
+  }
+
+  Status Visit(const DictionaryType& type) {
+    // The dictionary is part of the type, so only the indices need taking
+    return Visit(checked_cast<const FixedWidthType&>(*type.index_type()));
+  }
+
+  Status Visit(const UnionType& type) {
+    // Null positions get the first type code, and refer to no value of a
+    // dense union's child
+    std::shared_ptr<Buffer> type_ids;
+    RETURN_NOT_OK(AllocateBuffer(pool_, out_->length, &type_ids));
+    uint8_t* dest_ids = type_ids->mutable_data();
+    const uint8_t* src_ids =
+        values_.length > 0 ? values_.buffers[1]->data() + values_.offset : nullptr;
+    for (int64_t i = 0; i < out_->length; ++i) {
+      const int64_t position = positions_[i];
+      dest_ids[i] = position >= 0 ? src_ids[position] : type.type_codes()[0];
+    }
+    out_->buffers.push_back(type_ids);
+
+    if (type.mode() == UnionMode::SPARSE) {
+      out_->buffers.push_back(nullptr);
+      return TakeChildrenAtPositions();
+    }
+
+    // Each child takes the values the selected slots of its type refer to, in
+    // order, so the offsets are the running counts of those slots
+    std::vector<int> child_of_code(std::numeric_limits<uint8_t>::max() + 1, 0);
+    for (size_t child = 0; child < type.type_codes().size(); ++child) {
+      child_of_code[type.type_codes()[child]] = static_cast<int>(child);
+    }
+    std::shared_ptr<Buffer> offsets;
+    RETURN_NOT_OK(AllocateBuffer(pool_, out_->length * sizeof(int32_t), &offsets));
+    int32_t* dest_offsets = reinterpret_cast<int32_t*>(offsets->mutable_data());
+    const int32_t* src_offsets =
+        values_.length > 0 ? GetValues<int32_t>(values_, 2) : nullptr;
+    const uint8_t* bitmap = values_.null_count != 0 && values_.buffers[0] != nullptr
+                                ? values_.buffers[0]->data()
+                                : nullptr;
+    std::vector<std::vector<int64_t>> child_positions(type.type_codes().size());
+    for (int64_t i = 0; i < out_->length; ++i) {
+      const int64_t position = positions_[i];
+      if (position < 0 ||
+          (bitmap != nullptr && !BitUtil::GetBit(bitmap, values_.offset + position))) {
+        dest_offsets[i] = 0;
+        continue;
+      }
+      std::vector<int64_t>& child = child_positions[child_of_code[src_ids[position]]];
+      dest_offsets[i] = static_cast<int32_t>(child.size());
+      child.push_back(src_offsets[position]);
+    }
+    out_->buffers.push_back(offsets);
+
+    for (size_t child = 0; child < child_positions.size(); ++child) {
+      std::shared_ptr<ArrayData> child_data;
+      RETURN_NOT_OK(TakeImpl(pool_, *values_.child_data[child], child_positions[child])
+                        .Take(&child_data));
+      out_->child_data.push_back(child_data);
+    }
+    return Status::OK();
+  }
+
+ private:
+  // Take the children at the same positions as the parent, as those of a
+  // struct or a sparse union
+  Status TakeChildrenAtPositions() {
+    // The children are not sliced along with the parent
+    std::vector<int64_t> child_positions(positions_);
+    if (values_.offset != 0) {
+      for (int64_t& position : child_positions) {
+        if (position >= 0) {
+          position += values_.offset;
+        }
+      }
+    }
+    for (const auto& child_data : values_.child_data) {
+      std::shared_ptr<ArrayData> child;
+      RETURN_NOT_OK(TakeImpl(pool_, *child_data, child_positions).Take(&child));
+      out_->child_data.push_back(child);
+    }
+    return Status::OK();
+  }
+
+  template <typename offset_type>
+  Status TakeBinary() {
+    std::shared_ptr<Buffer> offsets;
+    RETURN_NOT_OK(TakeOffsets<offset_type>(&offsets));
+    const offset_type* dest_offsets =
+        reinterpret_cast<const offset_type*>(offsets->data());
+
+    std::shared_ptr<Buffer> values;
+    RETURN_NOT_OK(AllocateBuffer(pool_, dest_offsets[out_->length], &values));
+    uint8_t* dest = values->mutable_data();
+    if (values_.length > 0) {
+      const offset_type* src_offsets = GetValues<offset_type>(values_, 1);
+      const uint8_t* src = values_.buffers[2]->data();
+      for (int64_t i = 0; i < out_->length; ++i) {
+        const int64_t position = positions_[i];
+        const offset_type value_length = dest_offsets[i + 1] - dest_offsets[i];
+        if (position >= 0 && value_length > 0) {
+          std::memcpy(dest + dest_offsets[i], src + src_offsets[position],
+                      static_cast<size_t>(value_length));
+        }
+      }
+    }
+
+    out_->buffers.push_back(offsets);
+    out_->buffers.push_back(values);
+    return Status::OK();
+  }
+
+  template <typename offset_type>
+  Status TakeList() {
+    std::shared_ptr<Buffer> offsets;
+    RETURN_NOT_OK(TakeOffsets<offset_type>(&offsets));
+    const offset_type* dest_offsets =
+        reinterpret_cast<const offset_type*>(offsets->data());
+
+    // The child values of each selected list, in order
+    std::vector<int64_t> child_positions;
+    child_positions.reserve(static_cast<size_t>(dest_offsets[out_->length]));
+    if (values_.length > 0) {
+      const offset_type* src_offsets = GetValues<offset_type>(values_, 1);
+      for (int64_t i = 0; i < out_->length; ++i) {
+        const int64_t position = positions_[i];
+        if (position >= 0) {
+          for (int64_t j = src_offsets[position]; j < src_offsets[position + 1]; ++j) {
+            child_positions.push_back(j);
+          }
+        }
+      }
+    }
+    std::shared_ptr<ArrayData> child;
+    RETURN_NOT_OK(TakeImpl(pool_, *values_.child_data[0], child_positions).Take(&child));
+
+    out_->buffers.push_back(offsets);
+    out_->child_data.push_back(child);
+    return Status::OK();
+  }
+
+  // Combine the validity of the indices with the validity of the values they
+  // select. No bitmap is needed if neither has nulls.
+  Status TakeNullBitmap(std::shared_ptr<Buffer>* out) {
+    const uint8_t* bitmap = values_.null_count != 0 && values_.buffers[0] != nullptr
+                                ? values_.buffers[0]->data()
+                                : nullptr;
+    const bool null_positions =
+        std::any_of(positions_.begin(), positions_.end(),
+                    [](int64_t position) { return position < 0; });
+    if (bitmap == nullptr && !null_positions) {
+      out_->null_count = 0;
+      return Status::OK();
+    }
+
+    RETURN_NOT_OK(GetEmptyBitmap(pool_, out_->length, out));
+    uint8_t* dest = (*out)->mutable_data();
+    int64_t null_count = 0;
+    for (int64_t i = 0; i < out_->length; ++i) {
+      const int64_t position = positions_[i];
+      if (position >= 0 &&
+          (bitmap == nullptr || BitUtil::GetBit(bitmap, values_.offset + position))) {
+        BitUtil::SetBit(dest, i);
+      } else {
+        ++null_count;
+      }
+    }
+    out_->null_count = null_count;
+    return Status::OK();
+  }
+
+  // Make the offsets of the selected values of a binary or list array
+  template <typename offset_type>
+  Status TakeOffsets(std::shared_ptr<Buffer>* out) {
+    RETURN_NOT_OK(AllocateBuffer(pool_, (out_->length + 1) * sizeof(offset_type), out));
+    offset_type* dest = reinterpret_cast<offset_type*>((*out)->mutable_data());
+    const offset_type* src =
+        values_.length > 0 ? GetValues<offset_type>(values_, 1) : nullptr;
+    int64_t values_length = 0;
+    for (int64_t i = 0; i < out_->length; ++i) {
+      dest[i] = static_cast<offset_type>(values_length);
+      const int64_t position = positions_[i];
+      if (position >= 0) {
+        const int64_t value_length = src[position + 1] - src[position];
+        if (value_length > std::numeric_limits<offset_type>::max() - values_length) {
+          std::stringstream ss;
+          ss << "Taken array is too large to be represented with "
+             << sizeof(offset_type) * 8 << "-bit offsets";
+          return Status::CapacityError(ss.str());
+        }
+        values_length += value_length;
+      }
+    }
+    dest[out_->length] = static_cast<offset_type>(values_length);
+    return Status::OK();
+  }
+
+  MemoryPool* pool_;
+  const ArrayData& values_;
+  const std::vector<int64_t>& positions_;
+  std::shared_ptr<ArrayData> out_;
+};
+
+// ----------------------------------------------------------------------
+// Filter
+
+// Call visit(position, length, selected) for consecutive blocks of up to 64
+// mask values, bit j of selected telling whether the mask is true and not null
+// at position + j
+template <typename Visitor>
+void VisitMaskBlocks(const ArrayData& mask, Visitor&& visit) {
+  const uint8_t* values = mask.length > 0 ? mask.buffers[1]->data() : nullptr;
+  VisitValidityBlocks(mask, [&](int64_t position, int64_t length, uint64_t valid) {
+    visit(position, length,
+          valid & LoadBitmapBlock(values, mask.offset + position, length));
+  });
+}
+
+// Blocks with fewer selected values are compacted by scanning their set bits
+constexpr int kSparseBlockThreshold = 16;
+
+// Write the positions of the selected values of the mask to out, which must
+// have room for one position more than are selected
+template <typename T>
+void SelectPositions(const ArrayData& mask, T* out) {
+  int64_t n = 0;
+  VisitMaskBlocks(mask, [&](int64_t position, int64_t length, uint64_t selected) {
+    if (selected == 0) {
+      return;
+    }
+    if (selected == AllValid(length)) {
+      for (int64_t j = 0; j < length; ++j) {
+        out[n + j] = static_cast<T>(position + j);
+      }
+      n += length;
+    } else if (BitUtil::Popcount(selected) < kSparseBlockThreshold) {
+      while (selected != 0) {
+        out[n++] = static_cast<T>(position + BitUtil::CountTrailingZeros(selected));
+        selected &= selected - 1;
+      }
+    } else {
+      // Write every position and only advance past the selected ones
+      for (int64_t j = 0; j < length; ++j) {
+        out[n] = static_cast<T>(position + j);
+        n += static_cast<int64_t>((selected >> j) & 1);
+      }
+    }
+  });
+}
+
+int64_t CountSelected(const ArrayData& mask) {
+  int64_t count = 0;
+  VisitMaskBlocks(mask, [&count](int64_t, int64_t, uint64_t selected) {
+    count += BitUtil::Popcount(selected);
+  });
+  return count;
+}
+
+// Filter a run-length-encoded array a run at a time: each run keeps as many
+// slots as the mask selects in it, and is dropped if it selects none
+Status FilterRunLengthEncoded(MemoryPool* pool, const RunLengthEncodedArray& values,
+                              const ArrayData& mask, std::shared_ptr<Array>* out) {
+  // The selected positions of the mask as a bitmap, starting at bit 0
+  std::shared_ptr<Buffer> selected;
+  RETURN_NOT_OK(GetEmptyBitmap(pool, mask.length, &selected));
+  uint8_t* selected_bits = selected->mutable_data();
+  VisitMaskBlocks(mask, [&](int64_t position, int64_t length, uint64_t block) {
+    for (int64_t j = 0; j < length; ++j) {
+      BitUtil::SetBitTo(selected_bits, position + j, (block >> j) & 1);
+    }
+  });
+
+  TypedBufferBuilder<int32_t> run_ends_builder(pool);
+  std::vector<int64_t> child_positions;
+  int64_t out_length = 0;
+  Status status;
+  values.VisitRuns([&](int64_t run, int64_t position, int64_t run_length) {
+    const int64_t count = CountSetBits(selected_bits, position, run_length);
+    if (count == 0 || !status.ok()) {
+      return;
+    }
+    out_length += count;
+    status = run_ends_builder.Append(static_cast<int32_t>(out_length));
+    child_positions.push_back(run);
+  });
+  RETURN_NOT_OK(status);
+
+  std::shared_ptr<Buffer> run_ends;
+  RETURN_NOT_OK(run_ends_builder.Finish(&run_ends));
+  std::shared_ptr<ArrayData> child;
+  RETURN_NOT_OK(
+      TakeImpl(pool, *values.data()->child_data[0], child_positions).Take(&child));
+  auto result = ArrayData::Make(values.type(), out_length, {nullptr, run_ends},
+                                /*null_count=*/0);
+  result->child_data.push_back(child);
+  *out = MakeArray(result);
+  return Status::OK();
+}
+
+}  // namespace
+
+Status Take(FunctionContext* ctx, const Array& values, const Array& indices,
+            std::shared_ptr<Array>* out) {
+  std::vector<int64_t> positions;
+  RETURN_NOT_OK(ResolvePositions(*indices.data(), values.length(), &positions));
+
+  std::shared_ptr<ArrayData> result;
+  RETURN_NOT_OK(TakeImpl(ctx->memory_pool(), *values.data(), positions).Take(&result));
+  *out = MakeArray(result);
+  return Status::OK();
+}
+
+Status Filter(FunctionContext* ctx, const Array& values, const Array& mask,
+              const FilterOptions& options, std::shared_ptr<Array>* out) {
+  if (mask.type_id() != Type::BOOL) {
+    std::stringstream ss;
+    ss << "Filter mask must be boolean, got " << mask.type()->ToString();
+    return Status::Invalid(ss.str());
+  }
+  if (mask.length() != values.length()) {
+    std::stringstream ss;
+    ss << "Filter mask of length " << mask.length()
+       << " doesn't match values of length " << values.length();
+    return Status::Invalid(ss.str());
+  }
+
+  const ArrayData& mask_data = *mask.data();
+  const int64_t num_selected = CountSelected(mask_data);
+
+  if (options.output == FilterOptions::SELECTION_VECTOR) {
+    if (values.length() > std::numeric_limits<int32_t>::max()) {
+      return Status::CapacityError(
+          "Array is too large to have its positions held in an int32 selection vector");
+    }
+    std::shared_ptr<Buffer> selection;
+    RETURN_NOT_OK(
+        AllocateBuffer(ctx->memory_pool(), (num_selected + 1) * sizeof(int32_t),
+                       &selection));
+    SelectPositions(mask_data, reinterpret_cast<int32_t*>(selection->mutable_data()));
+    *out = std::make_shared<Int32Array>(num_selected, selection);
+    return Status::OK();
+  }
+
+  if (num_selected == values.length()) {
+    *out = MakeArray(values.data());
+    return Status::OK();
+  }
+  if (values.type_id() == Type::RUN_LENGTH_ENCODED) {
+    return FilterRunLengthEncoded(ctx->memory_pool(),
+                                  checked_cast<const RunLengthEncodedArray&>(values),
+                                  mask_data, out);
+  }
+  std::vector<int64_t> positions(static_cast<size_t>(num_selected + 1));
+  SelectPositions(mask_data, positions.data());
+  positions.resize(static_cast<size_t>(num_selected));
+
+  std::shared_ptr<ArrayData> result;
+  RETURN_NOT_OK(TakeImpl(ctx->memory_pool(), *values.data(), positions).Take(&result));
+  *out = MakeArray(result);
+  return Status::OK();
+}
+
+}  // namespace compute
+}  // namespace arrow
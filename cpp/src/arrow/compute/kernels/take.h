@@ -0,0 +1,100 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_COMPUTE_KERNELS_TAKE_H
+#define ARROW_COMPUTE_KERNELS_TAKE_H
+
+#include <memory>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Array;
+
+namespace compute {
+
+class FunctionContext;
+
+/// \brief Select values of an array by position
+///
+/// The result has the length of indices, its i-th value being the value of
+/// values at position indices[i]. It is null wherever the index or the value
+/// it selects is null. All types are supported except unions; the dictionary
+/// of a dictionary array is kept as is and only its indices are taken. A
+/// run-length-encoded array gives one too, whose runs are the consecutive
+/// indices into the same run.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] values the array to select values from
+/// \param[in] indices array of integer type, each non-null index being in
+/// [0, values.length())
+/// \param[out] out the selected values, of the type of values
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Take(FunctionContext* context, const Array& values, const Array& indices,
+            std::shared_ptr<Array>* out);
+
+/// \brief Options for Filter
+struct ARROW_EXPORT FilterOptions {
+  enum output_type {
+    /// Output the selected values
+    VALUES,
+    /// Output an int32 selection vector holding the positions of the selected
+    /// values, in order, which can be given to Take later
+    SELECTION_VECTOR
+  };
+
+  explicit FilterOptions(output_type output = VALUES) : output(output) {}
+
+  output_type output;
+};
+
+/// \brief Select the values of an array where a boolean mask is true
+///
+/// Values where the mask is false or null are dropped. The mask is consumed
+/// 64 positions at a time: empty and full blocks are handled without looking
+/// at individual bits, sparse blocks by scanning the set bits only and the
+/// others by branch-free compaction.
+///
+/// A run-length-encoded array is filtered a run at a time, each run keeping
+/// the number of slots the mask selects in it, into a run-length-encoded
+/// array.
+///
+/// To chain filters without materializing intermediate results, filter with
+/// SELECTION_VECTOR output, filter the selection vector itself with each
+/// following mask, which leaves the positions of the values passing all of
+/// them, and Take the values once at the end.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] values the array to filter
+/// \param[in] mask boolean array of the length of values
+/// \param[in] options what to output
+/// \param[out] out the selected values, of the type of values, or their
+/// positions as an int32 array
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Filter(FunctionContext* context, const Array& values, const Array& mask,
+              const FilterOptions& options, std::shared_ptr<Array>* out);
+
+}  // namespace compute
+}  // namespace arrow
+
+#endif  // ARROW_COMPUTE_KERNELS_TAKE_H
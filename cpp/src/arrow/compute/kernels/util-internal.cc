@@ -17,12 +17,15 @@
 
 #include "arrow/compute/kernels/util-internal.h"
 
+#include <functional>
 #include <memory>
 #include <vector>
 
 #include "arrow/array.h"
 #include "arrow/status.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/tracing.h"
 
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernel.h"
@@ -31,17 +34,40 @@ namespace arrow {
 namespace compute {
 namespace detail {
 
+#ifdef ARROW_TRACING
+static int64_t ArrayBytes(const ArrayData& data) {
+  int64_t bytes = 0;
+  for (const auto& buffer : data.buffers) {
+    if (buffer) {
+      bytes += buffer->size();
+    }
+  }
+  for (const auto& child : data.child_data) {
+    bytes += ArrayBytes(*child);
+  }
+  return bytes;
+}
+#endif
+
+// Call the kernel on a single array, recording a tracing span for the call
+static Status CallUnaryKernel(FunctionContext* ctx, UnaryKernel* kernel,
+                              const Datum& value, Datum* output) {
+  ARROW_TRACE_SPAN(span, "compute", "UnaryKernel::Call");
+  ARROW_TRACE_BYTES(span, ArrayBytes(*value.array()));
+  return kernel->Call(ctx, value, output);
+}
+
 Status InvokeUnaryArrayKernel(FunctionContext* ctx, UnaryKernel* kernel,
                               const Datum& value, std::vector<Datum>* outputs) {
   if (value.kind() == Datum::ARRAY) {
     Datum output;
-    RETURN_NOT_OK(kernel->Call(ctx, value, &output));
+    RETURN_NOT_OK(CallUnaryKernel(ctx, kernel, value, &output));
     outputs->push_back(output);
   } else if (value.kind() == Datum::CHUNKED_ARRAY) {
     const ChunkedArray& array = *value.chunked_array();
     for (int i = 0; i < array.num_chunks(); i++) {
       Datum output;
-      RETURN_NOT_OK(kernel->Call(ctx, Datum(array.chunk(i)), &output));
+      RETURN_NOT_OK(CallUnaryKernel(ctx, kernel, Datum(array.chunk(i)), &output));
       outputs->push_back(output);
     }
   } else {
@@ -50,6 +76,54 @@ Status InvokeUnaryArrayKernel(FunctionContext* ctx, UnaryKernel* kernel,
   return Status::OK();
 }
 
+ArrayVector SplitIntoMorsels(const ChunkedArray& array) {
+  ArrayVector morsels;
+  for (const auto& chunk : array.chunks()) {
+    const int64_t length = chunk->length();
+    if (length <= kMorselLength) {
+      morsels.push_back(chunk);
+      continue;
+    }
+    const int64_t num_morsels = (length + kMorselLength - 1) / kMorselLength;
+    for (int64_t i = 0; i < num_morsels; ++i) {
+      const int64_t begin = length * i / num_morsels;
+      const int64_t end = length * (i + 1) / num_morsels;
+      morsels.push_back(chunk->Slice(begin, end - begin));
+    }
+  }
+  return morsels;
+}
+
+Status RunTasks(FunctionContext* ctx, int num_tasks,
+                const std::function<Status(FunctionContext*, int)>& func) {
+  if (!ctx->use_threads() || num_tasks <= 1) {
+    for (int i = 0; i < num_tasks; ++i) {
+      RETURN_NOT_OK(func(ctx, i));
+    }
+    return Status::OK();
+  }
+  return ParallelFor(num_tasks, [&](int i) {
+    FunctionContext task_ctx(ctx->memory_pool());
+    return func(&task_ctx, i);
+  });
+}
+
+Status InvokeUnaryArrayKernelParallel(FunctionContext* ctx, UnaryKernel* kernel,
+                                      const Datum& value, std::vector<Datum>* outputs) {
+  if (!ctx->use_threads() || value.kind() != Datum::CHUNKED_ARRAY) {
+    return InvokeUnaryArrayKernel(ctx, kernel, value, outputs);
+  }
+  const ArrayVector morsels = SplitIntoMorsels(*value.chunked_array());
+  std::vector<Datum> results(morsels.size());
+  RETURN_NOT_OK(RunTasks(ctx, static_cast<int>(morsels.size()),
+                         [&](FunctionContext* task_ctx, int i) {
+                           return CallUnaryKernel(task_ctx, kernel, Datum(morsels[i]),
+                                                  &results[i]);
+                         }));
+  outputs->insert(outputs->end(), results.begin(), results.end());
+  return Status::OK();
+}
+
 Datum WrapArraysLike(const Datum& value,
                      const std::vector<std::shared_ptr<Array>>& arrays) {
   // Create right kind of datum
@@ -18,11 +18,17 @@
 #ifndef ARROW_COMPUTE_KERNELS_UTIL_INTERNAL_H
 #define ARROW_COMPUTE_KERNELS_UTIL_INTERNAL_H
 
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <functional>
 #include <memory>
 #include <vector>
 
+#include "arrow/array.h"
 #include "arrow/compute/kernel.h"
 #include "arrow/type_fwd.h"
+#include "arrow/util/bit-util.h"
 
 namespace arrow {
 namespace compute {
@@ -47,11 +53,67 @@ static inline void CopyData(const ArrayData& input, ArrayData* output) {
   output->child_data = input.child_data;
 }
 
+// Load up to 64 bits of a bitmap starting at an arbitrary bit offset, the bits
+// past length being zero
+inline uint64_t LoadBitmapBlock(const uint8_t* bitmap, int64_t bit_offset,
+                                int64_t length) {
+  if (length == 64) {
+    return internal::LoadBitmapWord(bitmap, bit_offset);
+  }
+  uint64_t word = 0;
+  internal::BitmapReader reader(bitmap, bit_offset, length);
+  for (int64_t j = 0; j < length; ++j) {
+    word |= static_cast<uint64_t>(reader.IsSet()) << j;
+    reader.Next();
+  }
+  return word;
+}
+
+// The validity word of a block of length values without any nulls
+inline uint64_t AllValid(int64_t length) {
+  return length == 64 ? ~static_cast<uint64_t>(0)
+                      : (static_cast<uint64_t>(1) << length) - 1;
+}
+
+// Call visit(position, length, valid) for consecutive blocks of up to 64
+// values, bit j of valid telling whether the value at position + j is valid
+template <typename Visitor>
+void VisitValidityBlocks(const ArrayData& data, Visitor&& visit) {
+  const uint8_t* bitmap = data.null_count != 0 && data.buffers[0] != nullptr
+                              ? data.buffers[0]->data()
+                              : nullptr;
+  for (int64_t i = 0; i < data.length; i += 64) {
+    const int64_t block_length = std::min<int64_t>(64, data.length - i);
+    visit(i, block_length,
+          bitmap != nullptr ? LoadBitmapBlock(bitmap, data.offset + i, block_length)
+                            : AllValid(block_length));
+  }
+}
+
 namespace detail {
 
 Status InvokeUnaryArrayKernel(FunctionContext* ctx, UnaryKernel* kernel,
                               const Datum& value, std::vector<Datum>* outputs);
 
+// The most values a task of a parallel kernel invocation works on
+constexpr int64_t kMorselLength = 1 << 20;
+
+// The chunks of a chunked array in order, those longer than kMorselLength
+// sliced into morsels of about equal length
+ArrayVector SplitIntoMorsels(const ChunkedArray& array);
+
+// Call func(task_ctx, i) for i in [0, num_tasks), on the CPU thread pool if
+// the context allows it. As kernels report errors through their context,
+// each task gets a context of its own over the same memory pool.
+Status RunTasks(FunctionContext* ctx, int num_tasks,
+                const std::function<Status(FunctionContext*, int)>& func);
+
+// Like InvokeUnaryArrayKernel, but calling the kernel on the morsels of a
+// chunked array on the CPU thread pool if the context allows it, with one
+// output per morsel. The kernel must not carry state from a call to the next.
+Status InvokeUnaryArrayKernelParallel(FunctionContext* ctx, UnaryKernel* kernel,
+                                      const Datum& value, std::vector<Datum>* outputs);
+
 Datum WrapArraysLike(const Datum& value,
                      const std::vector<std::shared_ptr<Array>>& arrays);
 
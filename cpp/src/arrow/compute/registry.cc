@@ -0,0 +1,162 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/registry.h"
+
+#include <algorithm>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <typeindex>
+#include <unordered_map>
+
+#include "arrow/util/cpu-info.h"
+
+namespace arrow {
+namespace compute {
+
+namespace {
+
+// The most capable instruction set both the CPU and the compiler support
+SimdLevel::type DetectSimdLevel() {
+  if (!CpuInfo::initialized()) {
+    CpuInfo::Init();
+  }
+#ifdef ARROW_HAVE_TARGET_ATTRIBUTE
+  if (CpuInfo::IsSupported(CpuInfo::AVX512)) {
+    return SimdLevel::AVX512;
+  }
+  if (CpuInfo::IsSupported(CpuInfo::AVX2)) {
+    return SimdLevel::AVX2;
+  }
+  if (CpuInfo::IsSupported(CpuInfo::SSE4_2)) {
+    return SimdLevel::SSE4_2;
+  }
+#endif
+  return SimdLevel::NONE;
+}
+
+constexpr int kNumSimdLevels = SimdLevel::AVX512 + 1;
+
+}  // namespace
+
+class KernelRegistry::KernelRegistryImpl {
+ public:
+  struct Entry {
+    explicit Entry(const std::type_info& signature) : signature(signature) {
+      std::fill(functions, functions + kNumSimdLevels, nullptr);
+    }
+
+    std::type_index signature;
+    ErasedFunction functions[kNumSimdLevels];
+  };
+
+  KernelRegistryImpl()
+      : detected_level_(DetectSimdLevel()), max_level_(detected_level_) {}
+
+  Status Register(const std::string& name, SimdLevel::type level,
+                  const std::type_info& signature, ErasedFunction function) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(name);
+    if (it == entries_.end()) {
+      it = entries_.emplace(name, Entry(signature)).first;
+    }
+    Entry& entry = it->second;
+    if (entry.signature != std::type_index(signature)) {
+      return SignatureMismatch(name);
+    }
+    if (entry.functions[level] != nullptr) {
+      std::stringstream ss;
+      ss << "Kernel function " << name << " already registered for SIMD level "
+         << static_cast<int>(level);
+      return Status::Invalid(ss.str());
+    }
+    entry.functions[level] = function;
+    return Status::OK();
+  }
+
+  Status Get(const std::string& name, const std::type_info& signature,
+             ErasedFunction* out) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(name);
+    if (it == entries_.end()) {
+      return Status::KeyError("No kernel function registered as " + name);
+    }
+    const Entry& entry = it->second;
+    if (entry.signature != std::type_index(signature)) {
+      return SignatureMismatch(name);
+    }
+    for (int level = max_level_; level >= 0; --level) {
+      if (entry.functions[level] != nullptr) {
+        *out = entry.functions[level];
+        return Status::OK();
+      }
+    }
+    return Status::Invalid("No baseline implementation of kernel function " + name);
+  }
+
+  SimdLevel::type simd_level() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return max_level_;
+  }
+
+  void set_max_simd_level(SimdLevel::type level) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    max_level_ = std::min(level, detected_level_);
+  }
+
+ private:
+  static Status SignatureMismatch(const std::string& name) {
+    return Status::Invalid("Kernel function " + name +
+                           " registered with another signature");
+  }
+
+  const SimdLevel::type detected_level_;
+  SimdLevel::type max_level_;
+  std::unordered_map<std::string, Entry> entries_;
+  mutable std::mutex mutex_;
+};
+
+KernelRegistry::KernelRegistry() : impl_(new KernelRegistryImpl()) {}
+
+KernelRegistry::~KernelRegistry() {}
+
+KernelRegistry* KernelRegistry::GetInstance() {
+  static KernelRegistry registry;
+  return &registry;
+}
+
+Status KernelRegistry::RegisterErased(const std::string& name, SimdLevel::type level,
+                                      const std::type_info& signature,
+                                      ErasedFunction function) {
+  return impl_->Register(name, level, signature, function);
+}
+
+Status KernelRegistry::GetErased(const std::string& name,
+                                 const std::type_info& signature,
+                                 ErasedFunction* out) const {
+  return impl_->Get(name, signature, out);
+}
+
+SimdLevel::type KernelRegistry::simd_level() const { return impl_->simd_level(); }
+
+void KernelRegistry::set_max_simd_level(SimdLevel::type level) {
+  impl_->set_max_simd_level(level);
+}
+
+}  // namespace compute
+}  // namespace arrow
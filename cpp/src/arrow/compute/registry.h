@@ -0,0 +1,113 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_COMPUTE_REGISTRY_H
+#define ARROW_COMPUTE_REGISTRY_H
+
+#include <memory>
+#include <string>
+#include <typeinfo>
+
+#include "arrow/status.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
+
+// Compile a function for an instruction set beyond the baseline of the
+// build, to be called only once the CPU is known to support it
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define ARROW_HAVE_TARGET_ATTRIBUTE
+#define ARROW_TARGET(TARGET) __attribute__((target(TARGET)))
+#endif
+
+namespace arrow {
+namespace compute {
+
+/// \brief Instruction sets kernels can be compiled for, from the least to
+/// the most capable
+struct ARROW_EXPORT SimdLevel {
+  enum type { NONE, SSE4_2, AVX2, AVX512 };
+};
+
+/// \brief Implementations of kernel functions for several instruction sets
+///
+/// A function is registered under a name once per instruction set it is
+/// compiled for, and Get returns the implementation for the most capable
+/// instruction set the CPU supports, as CpuInfo detects at startup. A single
+/// build can so use AVX2 or AVX-512 where available and still run everywhere
+/// else. Every function must have an implementation for SimdLevel::NONE.
+///
+/// The registry can be used from several threads at once. Getting a function
+/// takes a lock, so kernels do so once, not per call.
+class ARROW_EXPORT KernelRegistry {
+ public:
+  ~KernelRegistry();
+
+  /// \brief The registry of the process
+  static KernelRegistry* GetInstance();
+
+  /// \brief Register the implementation of a function for an instruction set
+  ///
+  /// \return Status, Invalid if there already is one, or if one for another
+  /// instruction set has another signature
+  template <typename Function>
+  Status Register(const std::string& name, SimdLevel::type level, Function* function) {
+    return RegisterErased(name, level, typeid(Function),
+                          reinterpret_cast<ErasedFunction>(function));
+  }
+
+  /// \brief Get the best implementation of a function for this CPU
+  ///
+  /// \return Status, KeyError if there is no function of the name, Invalid if
+  /// it has another signature
+  template <typename Function>
+  Status Get(const std::string& name, Function** out) const {
+    ErasedFunction function;
+    RETURN_NOT_OK(GetErased(name, typeid(Function), &function));
+    *out = reinterpret_cast<Function*>(function);
+    return Status::OK();
+  }
+
+  /// \brief The most capable instruction set implementations are chosen for
+  SimdLevel::type simd_level() const;
+
+  /// \brief Choose implementations for at most the given instruction set,
+  /// whatever the CPU supports, say to test the others
+  ///
+  /// Functions already gotten are not affected.
+  void set_max_simd_level(SimdLevel::type level);
+
+ private:
+  using ErasedFunction = void (*)();
+
+  KernelRegistry();
+
+  Status RegisterErased(const std::string& name, SimdLevel::type level,
+                        const std::type_info& signature, ErasedFunction function);
+
+  Status GetErased(const std::string& name, const std::type_info& signature,
+                   ErasedFunction* out) const;
+
+  class KernelRegistryImpl;
+  std::unique_ptr<KernelRegistryImpl> impl_;
+
+  ARROW_DISALLOW_COPY_AND_ASSIGN(KernelRegistry);
+};
+
+}  // namespace compute
+}  // namespace arrow
+
+#endif  // ARROW_COMPUTE_REGISTRY_H
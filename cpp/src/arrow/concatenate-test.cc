@@ -0,0 +1,180 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "arrow/array.h"
+#include "arrow/builder.h"
+#include "arrow/concatenate.h"
+#include "arrow/status.h"
+#include "arrow/test-common.h"
+#include "arrow/test-util.h"
+#include "arrow/type.h"
+
+namespace arrow {
+
+class TestConcatenate : public TestBase {
+ protected:
+  // Slice the array at uneven offsets and check that concatenating the
+  // slices gives back the original
+  void CheckRoundTrip(const std::shared_ptr<Array>& array) {
+    const int64_t length = array->length();
+    std::vector<int64_t> cuts = {0, 3, 11, 12, 37, 64, 101};
+    ArrayVector slices;
+    int64_t start = 0;
+    for (int64_t cut : cuts) {
+      if (cut > start && cut < length) {
+        slices.push_back(array->Slice(start, cut - start));
+        start = cut;
+      }
+    }
+    slices.push_back(array->Slice(start));
+
+    std::shared_ptr<Array> result;
+    ASSERT_OK(Concatenate(slices, pool_, &result));
+    ASSERT_OK(ValidateArray(*result));
+    ASSERT_EQ(array->null_count(), result->null_count());
+    test::AssertArraysEqual(*array, *result);
+
+    // Concatenating a single slice with a non-zero offset compacts it
+    auto tail = array->Slice(5);
+    ASSERT_OK(Concatenate({tail}, pool_, &result));
+    ASSERT_EQ(0, result->offset());
+    test::AssertArraysEqual(*tail, *result);
+  }
+
+  const int64_t kLength = 150;
+};
+
+TEST_F(TestConcatenate, Null) {
+  CheckRoundTrip(MakeRandomArray<NullArray>(kLength));
+}
+
+TEST_F(TestConcatenate, Primitive) {
+  CheckRoundTrip(MakeRandomArray<Int8Array>(kLength, 20));
+  CheckRoundTrip(MakeRandomArray<Int32Array>(kLength, 20));
+  CheckRoundTrip(MakeRandomArray<DoubleArray>(kLength, 0));
+  CheckRoundTrip(MakeRandomArray<FixedSizeBinaryArray>(kLength, 15));
+}
+
+TEST_F(TestConcatenate, Boolean) {
+  std::vector<bool> is_valid;
+  std::vector<bool> values;
+  test::random_is_valid(kLength, 0.2, &is_valid);
+  test::random_is_valid(kLength, 0.5, &values);
+  std::shared_ptr<Array> array;
+  ArrayFromVector<BooleanType, bool>(is_valid, values, &array);
+  CheckRoundTrip(array);
+}
+
+TEST_F(TestConcatenate, Binary) {
+  CheckRoundTrip(MakeRandomArray<BinaryArray>(kLength, 30));
+
+  std::vector<bool> is_valid;
+  test::random_is_valid(kLength, 0.1, &is_valid);
+  std::vector<std::string> values;
+  for (int64_t i = 0; i < kLength; ++i) {
+    values.push_back(std::string(static_cast<size_t>(i % 7), 'a'));
+  }
+  std::shared_ptr<Array> array;
+  ArrayFromVector<StringType, std::string>(is_valid, values, &array);
+  CheckRoundTrip(array);
+}
+
+TEST_F(TestConcatenate, List) {
+  ListBuilder builder(pool_, std::make_shared<Int16Builder>(pool_));
+  auto value_builder = static_cast<Int16Builder*>(builder.value_builder());
+  for (int64_t i = 0; i < kLength; ++i) {
+    if (i % 9 == 0) {
+      ASSERT_OK(builder.AppendNull());
+      continue;
+    }
+    ASSERT_OK(builder.Append());
+    for (int64_t j = 0; j < i % 4; ++j) {
+      ASSERT_OK(value_builder->Append(static_cast<int16_t>(i * j)));
+    }
+  }
+  std::shared_ptr<Array> array;
+  ASSERT_OK(builder.Finish(&array));
+  CheckRoundTrip(array);
+}
+
+TEST_F(TestConcatenate, Struct) {
+  auto ints = MakeRandomArray<Int32Array>(kLength, 10);
+  auto strings = MakeRandomArray<BinaryArray>(kLength, 20);
+  auto type = struct_({field("ints", int32()), field("strings", binary())});
+  auto array = std::make_shared<StructArray>(type, kLength, ArrayVector{ints, strings},
+                                             MakeRandomNullBitmap(kLength, 5), 5);
+  CheckRoundTrip(array);
+}
+
+TEST_F(TestConcatenate, Dictionary) {
+  std::shared_ptr<Array> dict;
+  ArrayFromVector<StringType, std::string>({"foo", "bar", "baz"}, &dict);
+  auto type = dictionary(int8(), dict);
+
+  std::vector<bool> is_valid;
+  test::random_is_valid(kLength, 0.1, &is_valid);
+  std::vector<int8_t> indices;
+  for (int64_t i = 0; i < kLength; ++i) {
+    indices.push_back(static_cast<int8_t>(i % 3));
+  }
+  std::shared_ptr<Array> index_array;
+  ArrayFromVector<Int8Type, int8_t>(is_valid, indices, &index_array);
+  CheckRoundTrip(std::make_shared<DictionaryArray>(type, index_array));
+
+  // Different dictionaries are rejected
+  std::shared_ptr<Array> other_dict;
+  ArrayFromVector<StringType, std::string>({"foo", "bar", "qux"}, &other_dict);
+  auto other = std::make_shared<DictionaryArray>(dictionary(int8(), other_dict),
+                                                 index_array);
+  std::shared_ptr<Array> result;
+  auto first = std::make_shared<DictionaryArray>(type, index_array);
+  ASSERT_RAISES(Invalid, Concatenate({first, other}, pool_, &result));
+}
+
+TEST_F(TestConcatenate, RunLengthEncoded) {
+  auto value_builder = std::make_shared<Int16Builder>(pool_);
+  RunLengthEncodedBuilder builder(pool_, value_builder);
+  for (int64_t i = 0; builder.length() < kLength; ++i) {
+    ASSERT_OK(builder.AppendRun(i % 5 + 1));
+    if (i % 7 == 0) {
+      ASSERT_OK(value_builder->AppendNull());
+    } else {
+      ASSERT_OK(value_builder->Append(static_cast<int16_t>(i)));
+    }
+  }
+  std::shared_ptr<Array> array;
+  ASSERT_OK(builder.Finish(&array));
+  CheckRoundTrip(array);
+}
+
+TEST_F(TestConcatenate, Invalid) {
+  std::shared_ptr<Array> result;
+  ASSERT_RAISES(Invalid, Concatenate({}, pool_, &result));
+
+  auto ints = MakeRandomArray<Int32Array>(10);
+  auto doubles = MakeRandomArray<DoubleArray>(10);
+  ASSERT_RAISES(Invalid, Concatenate({ints, doubles}, pool_, &result));
+}
+
+}  // namespace arrow
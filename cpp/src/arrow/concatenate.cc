@@ -0,0 +1,319 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/concatenate.h"
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/memory_pool.h"
+#include "arrow/status.h"
+#include "arrow/type.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+
+namespace {
+
+// Set length bits of a bitmap starting at offset
+void SetBitmap(uint8_t* bitmap, int64_t offset, int64_t length) {
+  int64_t i = 0;
+  for (; i < length && (offset + i) % 8 != 0; ++i) {
+    BitUtil::SetBit(bitmap, offset + i);
+  }
+  const int64_t num_bytes = (length - i) / 8;
+  std::memset(bitmap + (offset + i) / 8, 0xFF, static_cast<size_t>(num_bytes));
+  for (i += num_bytes * 8; i < length; ++i) {
+    BitUtil::SetBit(bitmap, offset + i);
+  }
+}
+
+// A range of child values referenced by one input's offsets
+struct ValueRange {
+  int64_t offset;
+  int64_t length;
+};
+
+class ConcatenateImpl {
+ public:
+  ConcatenateImpl(const ArrayVector& in, MemoryPool* pool) : in_(in), pool_(pool) {}
+
+  Status Concatenate(std::shared_ptr<ArrayData>* out) {
+    int64_t length = 0;
+    int64_t null_count = 0;
+    for (const auto& array : in_) {
+      length += array->length();
+      null_count += array->null_count();
+    }
+    out_ = std::make_shared<ArrayData>(in_[0]->type(), length, null_count);
+
+    std::shared_ptr<Buffer> null_bitmap;
+    if (null_count != 0 && out_->type->id() != Type::NA) {
+      RETURN_NOT_OK(ConcatenateBitmaps(true /* null_bitmap */, &null_bitmap));
+    }
+    out_->buffers.push_back(null_bitmap);
+
+    RETURN_NOT_OK(VisitTypeInline(*out_->type, this));
+    *out = out_;
+    return Status::OK();
+  }
+
+  Status Visit(const NullType&) { return Status::OK(); }
+
+  Status Visit(const BooleanType&) {
+    std::shared_ptr<Buffer> values;
+    RETURN_NOT_OK(ConcatenateBitmaps(false /* null_bitmap */, &values));
+    out_->buffers.push_back(values);
+    return Status::OK();
+  }
+
+  Status Visit(const FixedWidthType& type) {
+    const int64_t byte_width = type.bit_width() / 8;
+    std::shared_ptr<Buffer> values;
+    RETURN_NOT_OK(AllocateBuffer(pool_, out_->length * byte_width, &values));
+    uint8_t* dest = values->mutable_data();
+    for (const auto& array : in_) {
+      const ArrayData& data = *array->data();
+      const int64_t num_bytes = data.length * byte_width;
+      if (num_bytes > 0) {
+        std::memcpy(dest, data.buffers[1]->data() + data.offset * byte_width,
+                    static_cast<size_t>(num_bytes));
+      }
+      dest += num_bytes;
+    }
+    out_->buffers.push_back(values);
+    return Status::OK();
+  }
+
+  Status Visit(const BinaryType&) { return ConcatenateBinary<int32_t>(); }
+
+  Status Visit(const LargeBinaryType&) { return ConcatenateBinary<int64_t>(); }
+
+  Status Visit(const ListType&) { return ConcatenateList<int32_t>(); }
+
+  Status Visit(const LargeListType&) { return ConcatenateList<int64_t>(); }
+
+  Status Visit(const FixedSizeListType& type) {
+    const int64_t list_size = type.list_size();
+    ArrayVector children;
+    for (const auto& array : in_) {
+      const ArrayData& data = *array->data();
+      auto child = MakeArray(data.child_data[0]);
+      children.push_back(child->Slice(data.offset * list_size, data.length * list_size));
+    }
+    std::shared_ptr<Array> values;
+    RETURN_NOT_OK(arrow::Concatenate(children, pool_, &values));
+    out_->child_data.push_back(values->data());
+    return Status::OK();
+  }
+
+  Status Visit(const RunLengthEncodedType&) {
+    // Rebase the run ends of each input on the length of those before it
+    TypedBufferBuilder<int32_t> run_ends_builder(pool_);
+    ArrayVector children;
+    int64_t base = 0;
+    for (const auto& array : in_) {
+      const auto& rle = checked_cast<const RunLengthEncodedArray&>(*array);
+      std::shared_ptr<Buffer> run_ends;
+      std::shared_ptr<Array> values;
+      RETURN_NOT_OK(rle.RebaseRuns(pool_, &run_ends, &values));
+      if (base + rle.length() > std::numeric_limits<int32_t>::max()) {
+        return Status::CapacityError(
+            "Concatenated run-length-encoded array would have more than "
+            "INT32_MAX slots");
+      }
+      const auto raw_run_ends = reinterpret_cast<const int32_t*>(run_ends->data());
+      RETURN_NOT_OK(run_ends_builder.Reserve(values->length() * sizeof(int32_t)));
+      for (int64_t i = 0; i < values->length(); ++i) {
+        run_ends_builder.UnsafeAppend(static_cast<int32_t>(base + raw_run_ends[i]));
+      }
+      base += rle.length();
+      children.push_back(values);
+    }
+    std::shared_ptr<Buffer> run_ends;
+    RETURN_NOT_OK(run_ends_builder.Finish(&run_ends));
+    std::shared_ptr<Array> values;
+    RETURN_NOT_OK(arrow::Concatenate(children, pool_, &values));
+    out_->buffers.push_back(run_ends);
+    out_->child_data.push_back(values->data());
+    return Status::OK();
+  }
+
+  Status Visit(const StructType& type) {
+    for (int field = 0; field < type.num_children(); ++field) {
+      ArrayVector children;
+      for (const auto& array : in_) {
+        const ArrayData& data = *array->data();
+        auto child = MakeArray(data.child_data[field]);
+        children.push_back(child->Slice(data.offset, data.length));
+      }
+      std::shared_ptr<Array> values;
+      RETURN_NOT_OK(arrow::Concatenate(children, pool_, &values));
+      out_->child_data.push_back(values->data());
+    }
+    return Status::OK();
+  }
+
+  Status Visit(const DictionaryType& type) {
+    // The input types are equal, so they share the same dictionary and only the
+    // indices need concatenating
+    return Visit(checked_cast<const FixedWidthType&>(*type.index_type()));
+  }
+
+  Status Visit(const UnionType&) {
+    return Status::NotImplemented("Concatenation of union arrays");
+  }
+
+ private:
+  template <typename offset_type>
+  Status ConcatenateBinary() {
+    std::shared_ptr<Buffer> offsets;
+    std::vector<ValueRange> ranges;
+    RETURN_NOT_OK(ConcatenateOffsets<offset_type>(&offsets, &ranges));
+
+    int64_t values_length = 0;
+    for (const ValueRange& range : ranges) {
+      values_length += range.length;
+    }
+    std::shared_ptr<Buffer> values;
+    RETURN_NOT_OK(AllocateBuffer(pool_, values_length, &values));
+    uint8_t* dest = values->mutable_data();
+    for (size_t i = 0; i < in_.size(); ++i) {
+      if (ranges[i].length > 0) {
+        std::memcpy(dest, in_[i]->data()->buffers[2]->data() + ranges[i].offset,
+                    static_cast<size_t>(ranges[i].length));
+      }
+      dest += ranges[i].length;
+    }
+
+    out_->buffers.push_back(offsets);
+    out_->buffers.push_back(values);
+    return Status::OK();
+  }
+
+  template <typename offset_type>
+  Status ConcatenateList() {
+    std::shared_ptr<Buffer> offsets;
+    std::vector<ValueRange> ranges;
+    RETURN_NOT_OK(ConcatenateOffsets<offset_type>(&offsets, &ranges));
+
+    ArrayVector children;
+    for (size_t i = 0; i < in_.size(); ++i) {
+      auto child = MakeArray(in_[i]->data()->child_data[0]);
+      children.push_back(child->Slice(ranges[i].offset, ranges[i].length));
+    }
+    std::shared_ptr<Array> values;
+    RETURN_NOT_OK(arrow::Concatenate(children, pool_, &values));
+
+    out_->buffers.push_back(offsets);
+    out_->child_data.push_back(values->data());
+    return Status::OK();
+  }
+
+  // Concatenate the validity or boolean values bitmaps of the inputs. An input
+  // without a validity bitmap contributes all-set bits.
+  Status ConcatenateBitmaps(bool null_bitmap, std::shared_ptr<Buffer>* out) {
+    RETURN_NOT_OK(GetEmptyBitmap(pool_, out_->length, out));
+    uint8_t* dest = (*out)->mutable_data();
+    int64_t position = 0;
+    for (const auto& array : in_) {
+      const ArrayData& data = *array->data();
+      const uint8_t* bitmap = null_bitmap ? array->null_bitmap_data()
+                                          : (data.length > 0 ? data.buffers[1]->data()
+                                                             : NULLPTR);
+      if (bitmap != NULLPTR) {
+        CopyBitmap(bitmap, data.offset, data.length, dest, position);
+      } else if (null_bitmap) {
+        SetBitmap(dest, position, data.length);
+      }
+      position += data.length;
+    }
+    return Status::OK();
+  }
+
+  // Rebase the offsets of each input onto the end of the previous one and
+  // record the range of values each input references
+  template <typename offset_type>
+  Status ConcatenateOffsets(std::shared_ptr<Buffer>* out,
+                            std::vector<ValueRange>* ranges) {
+    RETURN_NOT_OK(AllocateBuffer(pool_, (out_->length + 1) * sizeof(offset_type), out));
+    offset_type* dest = reinterpret_cast<offset_type*>((*out)->mutable_data());
+    int64_t values_length = 0;
+    for (const auto& array : in_) {
+      const ArrayData& data = *array->data();
+      ValueRange range = {0, 0};
+      if (data.length > 0) {
+        const offset_type* src =
+            reinterpret_cast<const offset_type*>(data.buffers[1]->data()) + data.offset;
+        range.offset = src[0];
+        range.length = src[data.length] - src[0];
+        if (range.length > std::numeric_limits<offset_type>::max() - values_length) {
+          std::stringstream ss;
+          ss << "Concatenated array is too large to be represented with "
+             << sizeof(offset_type) * 8 << "-bit offsets";
+          return Status::CapacityError(ss.str());
+        }
+        const offset_type delta = static_cast<offset_type>(values_length - range.offset);
+        for (int64_t i = 0; i < data.length; ++i) {
+          dest[i] = src[i] + delta;
+        }
+      }
+      ranges->push_back(range);
+      dest += data.length;
+      values_length += range.length;
+    }
+    *dest = static_cast<offset_type>(values_length);
+    return Status::OK();
+  }
+
+  const ArrayVector& in_;
+  MemoryPool* pool_;
+  std::shared_ptr<ArrayData> out_;
+};
+
+}  // namespace
+
+Status Concatenate(const ArrayVector& arrays, MemoryPool* pool,
+                   std::shared_ptr<Array>* out) {
+  if (arrays.empty()) {
+    return Status::Invalid("Must pass at least one array");
+  }
+  const auto& type = arrays[0]->type();
+  for (const auto& array : arrays) {
+    if (!array->type()->Equals(*type)) {
+      std::stringstream ss;
+      ss << "Arrays to be concatenated must all have the same type, got "
+         << type->ToString() << " and " << array->type()->ToString();
+      return Status::Invalid(ss.str());
+    }
+  }
+
+  std::shared_ptr<ArrayData> data;
+  RETURN_NOT_OK(ConcatenateImpl(arrays, pool).Concatenate(&data));
+  *out = MakeArray(data);
+  return Status::OK();
+}
+
+}  // namespace arrow
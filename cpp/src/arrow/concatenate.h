@@ -0,0 +1,49 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_CONCATENATE_H
+#define ARROW_CONCATENATE_H
+
+#include <memory>
+#include <vector>
+
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Array;
+class MemoryPool;
+class Status;
+
+/// \brief Concatenate arrays of the same type into a single contiguous array
+///
+/// The exact size of every output buffer is computed up front so each one is
+/// allocated only once. Slice offsets of the inputs are honored. Dictionary
+/// arrays can only be concatenated if they share the same dictionary; union
+/// arrays are not supported.
+///
+/// \param[in] arrays the arrays to concatenate, in order
+/// \param[in] pool memory pool to allocate the result from
+/// \param[out] out the resulting array
+/// \return Status
+ARROW_EXPORT
+Status Concatenate(const std::vector<std::shared_ptr<Array>>& arrays, MemoryPool* pool,
+                   std::shared_ptr<Array>* out);
+
+}  // namespace arrow
+
+#endif  // ARROW_CONCATENATE_H
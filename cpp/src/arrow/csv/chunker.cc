@@ -0,0 +1,58 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/csv/chunker.h"
+
+#include <cstdint>
+
+namespace arrow {
+namespace csv {
+
+Chunker::Chunker(const ParseOptions& options) : options_(options) {}
+
+Status Chunker::Process(const char* data, int64_t size, int64_t* out_size) const {
+  if (!options_.newlines_in_values) {
+    // Any newline ends a row
+    int64_t end = size;
+    while (end > 0 && data[end - 1] != '\n' && data[end - 1] != '\r') {
+      --end;
+    }
+    *out_size = end;
+    return Status::OK();
+  }
+
+  // Only the newlines out of quotes end a row, which takes following the
+  // quotes from the start
+  int64_t end = 0;
+  bool in_quotes = false;
+  for (int64_t i = 0; i < size; ++i) {
+    const char c = data[i];
+    if (options_.escaping && c == options_.escape_char) {
+      ++i;
+    } else if (options_.quoting && c == options_.quote_char) {
+      // A doubled quote toggles twice
+      in_quotes = !in_quotes;
+    } else if (!in_quotes && (c == '\n' || c == '\r')) {
+      end = i + 1;
+    }
+  }
+  *out_size = end;
+  return Status::OK();
+}
+
+}  // namespace csv
+}  // namespace arrow
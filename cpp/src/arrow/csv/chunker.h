@@ -0,0 +1,53 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_CSV_CHUNKER_H
+#define ARROW_CSV_CHUNKER_H
+
+#include <cstdint>
+
+#include "arrow/csv/options.h"
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace csv {
+
+/// \class Chunker
+/// \brief Finds where the last whole row of a block of CSV ends, so that
+/// blocks cut there can be parsed independently of each other
+class ARROW_EXPORT Chunker {
+ public:
+  explicit Chunker(const ParseOptions& options);
+
+  /// \brief Find the end of the whole rows of a block starting at a row
+  ///
+  /// \param[in] data the block
+  /// \param[in] size the bytes of the block
+  /// \param[out] out_size the bytes of the block up to and including the
+  /// last newline ending a row, 0 if no row ends in the block
+  /// \return Status
+  Status Process(const char* data, int64_t size, int64_t* out_size) const;
+
+ private:
+  ParseOptions options_;
+};
+
+}  // namespace csv
+}  // namespace arrow
+
+#endif  // ARROW_CSV_CHUNKER_H
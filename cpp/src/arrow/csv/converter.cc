@@ -0,0 +1,268 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/csv/converter.h"
+
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "arrow/builder.h"
+#include "arrow/csv/parser.h"
+#include "arrow/memory_pool.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/parsing.h"
+
+namespace arrow {
+namespace csv {
+
+namespace {
+
+// A small set of strings, looked up without copying the value
+class ValueSet {
+ public:
+  explicit ValueSet(const std::vector<std::string>& values) : values_(values) {}
+
+  bool Contains(const uint8_t* data, uint32_t size) const {
+    for (const auto& value : values_) {
+      if (value.size() == size && std::memcmp(value.data(), data, size) == 0) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+ private:
+  std::vector<std::string> values_;
+};
+
+Status ConversionError(const DataType& type, const uint8_t* data, uint32_t size) {
+  std::stringstream ss;
+  ss << "CSV value '" << std::string(reinterpret_cast<const char*>(data), size)
+     << "' is not of type " << type.ToString();
+  return Status::Invalid(ss.str());
+}
+
+// A converter telling nulls apart from the other values
+class ConcreteConverter : public Converter {
+ public:
+  ConcreteConverter(const std::shared_ptr<DataType>& type, const ConvertOptions& options,
+                    MemoryPool* pool)
+      : Converter(type, options, pool), null_values_(options.null_values) {}
+
+ protected:
+  bool IsNull(const uint8_t* data, uint32_t size, bool quoted) const {
+    return !quoted && null_values_.Contains(data, size);
+  }
+
+  ValueSet null_values_;
+};
+
+class NullConverter : public ConcreteConverter {
+ public:
+  using ConcreteConverter::ConcreteConverter;
+
+  Status Convert(const BlockParser& parser, int32_t col,
+                 std::shared_ptr<Array>* out) const override {
+    NullBuilder builder(pool_);
+    auto visit = [&](const uint8_t* data, uint32_t size, bool quoted) -> Status {
+      if (!IsNull(data, size, quoted)) {
+        return ConversionError(*type_, data, size);
+      }
+      return builder.AppendNull();
+    };
+    RETURN_NOT_OK(parser.VisitColumn(col, visit));
+    return builder.Finish(out);
+  }
+};
+
+class BooleanConverter : public ConcreteConverter {
+ public:
+  BooleanConverter(const std::shared_ptr<DataType>& type, const ConvertOptions& options,
+                   MemoryPool* pool)
+      : ConcreteConverter(type, options, pool),
+        true_values_(options.true_values),
+        false_values_(options.false_values) {}
+
+  Status Convert(const BlockParser& parser, int32_t col,
+                 std::shared_ptr<Array>* out) const override {
+    BooleanBuilder builder(type_, pool_);
+    RETURN_NOT_OK(builder.Reserve(parser.num_rows()));
+    auto visit = [&](const uint8_t* data, uint32_t size, bool quoted) -> Status {
+      if (IsNull(data, size, quoted)) {
+        return builder.AppendNull();
+      }
+      if (true_values_.Contains(data, size)) {
+        return builder.Append(true);
+      }
+      if (false_values_.Contains(data, size)) {
+        return builder.Append(false);
+      }
+      return ConversionError(*type_, data, size);
+    };
+    RETURN_NOT_OK(parser.VisitColumn(col, visit));
+    return builder.Finish(out);
+  }
+
+ private:
+  ValueSet true_values_;
+  ValueSet false_values_;
+};
+
+template <typename T, typename Enable = void>
+struct NumberParser {};
+
+template <typename T>
+struct NumberParser<T, typename std::enable_if<std::is_integral<T>::value>::type> {
+  static bool Parse(const char* s, size_t length, T* out) {
+    return internal::ParseInteger(s, length, out);
+  }
+};
+
+template <typename T>
+struct NumberParser<T, typename std::enable_if<std::is_floating_point<T>::value>::type> {
+  static bool Parse(const char* s, size_t length, T* out) {
+    return internal::ParseFloat(s, length, out);
+  }
+};
+
+template <typename ArrowType>
+class NumericConverter : public ConcreteConverter {
+ public:
+  using ConcreteConverter::ConcreteConverter;
+  using c_type = typename ArrowType::c_type;
+
+  Status Convert(const BlockParser& parser, int32_t col,
+                 std::shared_ptr<Array>* out) const override {
+    NumericBuilder<ArrowType> builder(type_, pool_);
+    RETURN_NOT_OK(builder.Reserve(parser.num_rows()));
+    auto visit = [&](const uint8_t* data, uint32_t size, bool quoted) -> Status {
+      if (IsNull(data, size, quoted)) {
+        return builder.AppendNull();
+      }
+      c_type value;
+      if (!NumberParser<c_type>::Parse(reinterpret_cast<const char*>(data), size,
+                                       &value)) {
+        return ConversionError(*type_, data, size);
+      }
+      builder.UnsafeAppend(value);
+      return Status::OK();
+    };
+    RETURN_NOT_OK(parser.VisitColumn(col, visit));
+    return builder.Finish(out);
+  }
+};
+
+class TimestampConverter : public ConcreteConverter {
+ public:
+  using ConcreteConverter::ConcreteConverter;
+
+  Status Convert(const BlockParser& parser, int32_t col,
+                 std::shared_ptr<Array>* out) const override {
+    const TimeUnit::type unit = checked_cast<const TimestampType&>(*type_).unit();
+    TimestampBuilder builder(type_, pool_);
+    RETURN_NOT_OK(builder.Reserve(parser.num_rows()));
+    auto visit = [&](const uint8_t* data, uint32_t size, bool quoted) -> Status {
+      if (IsNull(data, size, quoted)) {
+        return builder.AppendNull();
+      }
+      int64_t value;
+      if (!internal::ParseTimestamp(reinterpret_cast<const char*>(data), size, unit,
+                                    &value)) {
+        return ConversionError(*type_, data, size);
+      }
+      builder.UnsafeAppend(value);
+      return Status::OK();
+    };
+    RETURN_NOT_OK(parser.VisitColumn(col, visit));
+    return builder.Finish(out);
+  }
+};
+
+// Converts to string and to binary, which all values are
+class BinaryConverter : public ConcreteConverter {
+ public:
+  using ConcreteConverter::ConcreteConverter;
+
+  Status Convert(const BlockParser& parser, int32_t col,
+                 std::shared_ptr<Array>* out) const override {
+    BinaryBuilder builder(type_, pool_);
+    RETURN_NOT_OK(builder.Reserve(parser.num_rows()));
+    const bool can_be_null = options_.strings_can_be_null;
+    auto visit = [&](const uint8_t* data, uint32_t size, bool quoted) -> Status {
+      if (can_be_null && IsNull(data, size, quoted)) {
+        return builder.AppendNull();
+      }
+      return builder.Append(data, static_cast<int32_t>(size));
+    };
+    RETURN_NOT_OK(parser.VisitColumn(col, visit));
+    return builder.Finish(out);
+  }
+};
+
+}  // namespace
+
+Converter::Converter(const std::shared_ptr<DataType>& type, const ConvertOptions& options,
+                     MemoryPool* pool)
+    : type_(type), options_(options), pool_(pool) {}
+
+Status Converter::Make(const std::shared_ptr<DataType>& type,
+                       const ConvertOptions& options, MemoryPool* pool,
+                       std::shared_ptr<Converter>* out) {
+  Converter* result;
+
+  switch (type->id()) {
+#define CONVERTER_CASE(TYPE_ID, CONVERTER_TYPE)     \
+  case TYPE_ID:                                     \
+    result = new CONVERTER_TYPE(type, options, pool); \
+    break;
+
+    CONVERTER_CASE(Type::NA, NullConverter)
+    CONVERTER_CASE(Type::BOOL, BooleanConverter)
+    CONVERTER_CASE(Type::INT8, NumericConverter<Int8Type>)
+    CONVERTER_CASE(Type::INT16, NumericConverter<Int16Type>)
+    CONVERTER_CASE(Type::INT32, NumericConverter<Int32Type>)
+    CONVERTER_CASE(Type::INT64, NumericConverter<Int64Type>)
+    CONVERTER_CASE(Type::UINT8, NumericConverter<UInt8Type>)
+    CONVERTER_CASE(Type::UINT16, NumericConverter<UInt16Type>)
+    CONVERTER_CASE(Type::UINT32, NumericConverter<UInt32Type>)
+    CONVERTER_CASE(Type::UINT64, NumericConverter<UInt64Type>)
+    CONVERTER_CASE(Type::FLOAT, NumericConverter<FloatType>)
+    CONVERTER_CASE(Type::DOUBLE, NumericConverter<DoubleType>)
+    CONVERTER_CASE(Type::TIMESTAMP, TimestampConverter)
+    CONVERTER_CASE(Type::BINARY, BinaryConverter)
+    CONVERTER_CASE(Type::STRING, BinaryConverter)
+
+#undef CONVERTER_CASE
+
+    default: {
+      std::stringstream ss;
+      ss << "CSV conversion to " << type->ToString() << " is not supported";
+      return Status::NotImplemented(ss.str());
+    }
+  }
+
+  out->reset(result);
+  return Status::OK();
+}
+
+}  // namespace csv
+}  // namespace arrow
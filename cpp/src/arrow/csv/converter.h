@@ -0,0 +1,77 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_CSV_CONVERTER_H
+#define ARROW_CSV_CONVERTER_H
+
+#include <cstdint>
+#include <memory>
+
+#include "arrow/csv/options.h"
+#include "arrow/status.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Array;
+class DataType;
+class MemoryPool;
+
+namespace csv {
+
+class BlockParser;
+
+/// \class Converter
+/// \brief Converts the values of a column of parsed CSV into an array
+///
+/// Converters are stateless once made, so that one may convert the blocks
+/// of a column in several threads at once.
+class ARROW_EXPORT Converter {
+ public:
+  virtual ~Converter() = default;
+
+  /// \brief Convert a column of a parsed block
+  ///
+  /// \return Status, Invalid when a value is not of the type
+  virtual Status Convert(const BlockParser& parser, int32_t col,
+                         std::shared_ptr<Array>* out) const = 0;
+
+  std::shared_ptr<DataType> type() const { return type_; }
+
+  /// \brief Make the converter to a type
+  ///
+  /// \return Status, NotImplemented for types values cannot be converted to
+  static Status Make(const std::shared_ptr<DataType>& type, const ConvertOptions& options,
+                     MemoryPool* pool, std::shared_ptr<Converter>* out);
+
+ protected:
+  Converter(const std::shared_ptr<DataType>& type, const ConvertOptions& options,
+            MemoryPool* pool);
+
+  std::shared_ptr<DataType> type_;
+  ConvertOptions options_;
+  MemoryPool* pool_;
+
+ private:
+  ARROW_DISALLOW_COPY_AND_ASSIGN(Converter);
+};
+
+}  // namespace csv
+}  // namespace arrow
+
+#endif  // ARROW_CSV_CONVERTER_H
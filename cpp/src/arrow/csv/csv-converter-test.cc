@@ -0,0 +1,113 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "arrow/array.h"
+#include "arrow/csv/converter.h"
+#include "arrow/csv/options.h"
+#include "arrow/csv/parser.h"
+#include "arrow/memory_pool.h"
+#include "arrow/status.h"
+#include "arrow/test-util.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace csv {
+
+class TestConverter : public ::testing::Test {
+ public:
+  // Convert a column of one value per line
+  Status Convert(const std::shared_ptr<DataType>& type, const std::string& csv,
+                 std::shared_ptr<Array>* out) {
+    int64_t parsed_size;
+    RETURN_NOT_OK(parser_.Parse(csv.data(), static_cast<int64_t>(csv.size()),
+                                &parsed_size));
+    std::shared_ptr<Converter> converter;
+    RETURN_NOT_OK(Converter::Make(type, options_, default_memory_pool(), &converter));
+    RETURN_NOT_OK(converter->Convert(parser_, 0, out));
+    return ValidateArray(**out);
+  }
+
+ protected:
+  BlockParser parser_{ParseOptions(), 1};
+  ConvertOptions options_;
+};
+
+TEST_F(TestConverter, Integers) {
+  std::shared_ptr<Array> array, expected;
+  ASSERT_OK(Convert(int32(), "12\n\nNA\n-3\n", &array));
+  ArrayFromVector<Int32Type, int32_t>({true, false, true}, {12, 0, -3}, &expected);
+  ASSERT_ARRAYS_EQUAL(*expected, *array);
+
+  ASSERT_RAISES(Invalid, Convert(uint8(), "256\n", &array));
+  ASSERT_RAISES(Invalid, Convert(int64(), "1.5\n", &array));
+  // Quoted values are never null
+  ASSERT_RAISES(Invalid, Convert(int64(), "\"\"\n", &array));
+}
+
+TEST_F(TestConverter, FloatsAndBooleans) {
+  std::shared_ptr<Array> array, expected;
+  ASSERT_OK(Convert(float64(), "1.5\n-1e3\nnull\n", &array));
+  ArrayFromVector<DoubleType, double>({true, true, false}, {1.5, -1000, 0}, &expected);
+  ASSERT_ARRAYS_EQUAL(*expected, *array);
+
+  ASSERT_OK(Convert(boolean(), "true\n0\nN/A\n", &array));
+  ArrayFromVector<BooleanType, bool>({true, true, false}, {true, false, false},
+                                     &expected);
+  ASSERT_ARRAYS_EQUAL(*expected, *array);
+  ASSERT_RAISES(Invalid, Convert(boolean(), "yes\n", &array));
+}
+
+TEST_F(TestConverter, Timestamps) {
+  std::shared_ptr<Array> array, expected;
+  ASSERT_OK(Convert(timestamp(TimeUnit::SECOND), "1970-01-02\n1970-01-01 00:01:00\nNA\n",
+                    &array));
+  ArrayFromVector<TimestampType, int64_t>(timestamp(TimeUnit::SECOND),
+                                          {true, true, false}, {86400, 60, 0},
+                                          &expected);
+  ASSERT_ARRAYS_EQUAL(*expected, *array);
+}
+
+TEST_F(TestConverter, Strings) {
+  std::shared_ptr<Array> array, expected;
+  ASSERT_OK(Convert(utf8(), "ab\nNA\n\"\"\n", &array));
+  ArrayFromVector<StringType, std::string>({"ab", "NA", ""}, &expected);
+  ASSERT_ARRAYS_EQUAL(*expected, *array);
+
+  options_.strings_can_be_null = true;
+  ASSERT_OK(Convert(binary(), "ab\nNA\n\"\"\n", &array));
+  ArrayFromVector<BinaryType, std::string>({true, false, true}, {"ab", "", ""},
+                                           &expected);
+  ASSERT_ARRAYS_EQUAL(*expected, *array);
+}
+
+TEST_F(TestConverter, Nulls) {
+  std::shared_ptr<Array> array;
+  ASSERT_OK(Convert(null(), "\nNA\nNULL\n", &array));
+  ASSERT_EQ(2, array->length());
+  ASSERT_RAISES(Invalid, Convert(null(), "x\n", &array));
+  ASSERT_RAISES(NotImplemented, Convert(decimal(10, 2), "1\n", &array));
+}
+
+}  // namespace csv
+}  // namespace arrow
@@ -0,0 +1,124 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "arrow/csv/chunker.h"
+#include "arrow/csv/options.h"
+#include "arrow/csv/parser.h"
+#include "arrow/status.h"
+#include "arrow/test-util.h"
+
+namespace arrow {
+namespace csv {
+
+// The values of each column, and whether they were quoted
+void GetColumns(const BlockParser& parser, std::vector<std::vector<std::string>>* values,
+                std::vector<std::vector<bool>>* quoted) {
+  values->assign(parser.num_cols(), {});
+  quoted->assign(parser.num_cols(), {});
+  for (int32_t i = 0; i < parser.num_cols(); ++i) {
+    auto visit = [&](const uint8_t* data, uint32_t size, bool is_quoted) -> Status {
+      (*values)[i].emplace_back(reinterpret_cast<const char*>(data), size);
+      (*quoted)[i].push_back(is_quoted);
+      return Status::OK();
+    };
+    ASSERT_OK(parser.VisitColumn(i, visit));
+  }
+}
+
+Status Parse(BlockParser* parser, const std::string& csv, int64_t* parsed_size) {
+  return parser->Parse(csv.data(), static_cast<int64_t>(csv.size()), parsed_size);
+}
+
+TEST(BlockParser, Basics) {
+  const std::string csv = "a,bb,\n\n1,\"2,\"\"3\",x\r\n,,long value past sixteen bytes";
+  BlockParser parser{ParseOptions()};
+  int64_t parsed_size;
+  ASSERT_OK(Parse(&parser, csv, &parsed_size));
+  ASSERT_EQ(static_cast<int64_t>(csv.size()), parsed_size);
+  ASSERT_EQ(3, parser.num_cols());
+  ASSERT_EQ(3, parser.num_rows());
+
+  std::vector<std::vector<std::string>> values;
+  std::vector<std::vector<bool>> quoted;
+  GetColumns(parser, &values, &quoted);
+  ASSERT_EQ(std::vector<std::string>({"a", "1", ""}), values[0]);
+  ASSERT_EQ(std::vector<std::string>({"bb", "2,\"3", ""}), values[1]);
+  ASSERT_EQ(std::vector<std::string>({"", "x", "long value past sixteen bytes"}),
+            values[2]);
+  ASSERT_EQ(std::vector<bool>({false, true, false}), quoted[1]);
+}
+
+TEST(BlockParser, Options) {
+  ParseOptions options;
+  options.delimiter = ';';
+  options.quoting = false;
+  options.escaping = true;
+  BlockParser parser(options);
+  int64_t parsed_size;
+  ASSERT_OK(Parse(&parser, "\"a;b\\;c\n", &parsed_size));
+  ASSERT_EQ(2, parser.num_cols());
+
+  std::vector<std::vector<std::string>> values;
+  std::vector<std::vector<bool>> quoted;
+  GetColumns(parser, &values, &quoted);
+  ASSERT_EQ(std::vector<std::string>({"\"a"}), values[0]);
+  ASSERT_EQ(std::vector<std::string>({"b;c"}), values[1]);
+}
+
+TEST(BlockParser, MaxRows) {
+  BlockParser parser(ParseOptions(), -1, 1);
+  int64_t parsed_size;
+  ASSERT_OK(Parse(&parser, "a,b\r\n1,2\n", &parsed_size));
+  ASSERT_EQ(1, parser.num_rows());
+  ASSERT_EQ(5, parsed_size);
+}
+
+TEST(BlockParser, Errors) {
+  int64_t parsed_size;
+  BlockParser parser(ParseOptions(), 2);
+  ASSERT_RAISES(Invalid, Parse(&parser, "a,b\n1,2,3\n", &parsed_size));
+  ASSERT_RAISES(Invalid, Parse(&parser, "a,\"b\n", &parsed_size));
+}
+
+Status Chunk(const ParseOptions& options, const std::string& csv, int64_t* size) {
+  return Chunker(options).Process(csv.data(), static_cast<int64_t>(csv.size()), size);
+}
+
+TEST(Chunker, Basics) {
+  ParseOptions options;
+  int64_t size;
+  ASSERT_OK(Chunk(options, "a,b\n1,\"2\n3\"", &size));
+  ASSERT_EQ(9, size);
+  ASSERT_OK(Chunk(options, "a,b", &size));
+  ASSERT_EQ(0, size);
+
+  // Only the newlines out of quotes end rows
+  options.newlines_in_values = true;
+  ASSERT_OK(Chunk(options, "a,b\n1,\"2\n3\"", &size));
+  ASSERT_EQ(4, size);
+  ASSERT_OK(Chunk(options, "1,\"2\n\"\"3\"\r\n4", &size));
+  ASSERT_EQ(11, size);
+}
+
+}  // namespace csv
+}  // namespace arrow
@@ -0,0 +1,153 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/csv/api.h"
+#include "arrow/io/memory.h"
+#include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
+#include "arrow/status.h"
+#include "arrow/test-util.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace csv {
+
+class TestStreamingReader : public ::testing::Test {
+ public:
+  Status ReadAll(const std::string& csv, std::shared_ptr<Schema>* schema,
+                 std::vector<std::shared_ptr<RecordBatch>>* batches) {
+    std::shared_ptr<Buffer> buffer;
+    RETURN_NOT_OK(Buffer::FromString(csv, &buffer));
+    auto input = std::make_shared<io::BufferReader>(buffer);
+    std::shared_ptr<RecordBatchReader> reader;
+    RETURN_NOT_OK(StreamingReader::Open(default_memory_pool(), input, read_options_,
+                                        parse_options_, convert_options_, &reader));
+    *schema = reader->schema();
+    batches->clear();
+    std::shared_ptr<RecordBatch> batch;
+    while (true) {
+      RETURN_NOT_OK(reader->ReadNext(&batch));
+      if (batch == nullptr) {
+        return Status::OK();
+      }
+      RETURN_NOT_OK(batch->Validate());
+      batches->push_back(batch);
+    }
+  }
+
+ protected:
+  ReadOptions read_options_;
+  ParseOptions parse_options_;
+  ConvertOptions convert_options_;
+};
+
+TEST_F(TestStreamingReader, InferTypes) {
+  const std::string csv =
+      "int,bool,float,time,str,null,given\n"
+      "1,true,1.5,2018-01-01,x,,7\n"
+      "NA,0,2,2018-01-01 10:00:00,\"y,z\",NA,8\n";
+  convert_options_.column_types["given"] = int8();
+
+  std::shared_ptr<Schema> schema;
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  ASSERT_OK(ReadAll(csv, &schema, &batches));
+
+  auto expected = ::arrow::schema(
+      {field("int", int64()), field("bool", boolean()), field("float", float64()),
+       field("time", timestamp(TimeUnit::SECOND)), field("str", utf8()),
+       field("null", null()), field("given", int8())});
+  ASSERT_TRUE(schema->Equals(*expected)) << schema->ToString();
+  ASSERT_EQ(1, batches.size());
+  ASSERT_EQ(2, batches[0]->num_rows());
+
+  std::shared_ptr<Array> ints, strs;
+  ArrayFromVector<Int64Type, int64_t>({true, false}, {1, 0}, &ints);
+  ArrayFromVector<StringType, std::string>({"x", "y,z"}, &strs);
+  ASSERT_ARRAYS_EQUAL(*ints, *batches[0]->column(0));
+  ASSERT_ARRAYS_EQUAL(*strs, *batches[0]->column(4));
+}
+
+TEST_F(TestStreamingReader, NoHeader) {
+  parse_options_.header_rows = 0;
+  std::shared_ptr<Schema> schema;
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  ASSERT_OK(ReadAll("1,a\n2,b", &schema, &batches));
+  ASSERT_EQ("f0", schema->field(0)->name());
+  ASSERT_EQ("f1", schema->field(1)->name());
+  // The last row, not ending with a newline, is read after the others
+  ASSERT_EQ(2, batches.size());
+  ASSERT_EQ(1, batches[1]->num_rows());
+
+  ASSERT_OK(ReadAll("", &schema, &batches));
+  ASSERT_EQ(0, schema->num_fields());
+  ASSERT_EQ(0, batches.size());
+}
+
+TEST_F(TestStreamingReader, SmallBlocks) {
+  // Rows longer than the blocks, which are parsed several at once
+  read_options_.block_size = 16;
+  parse_options_.newlines_in_values = true;
+  const int num_rows = 200;
+  std::stringstream ss;
+  ss << "value,padding\r\n";
+  for (int i = 0; i < num_rows; ++i) {
+    ss << i << ",\"" << std::string(i % 20, 'x') << "\n\"\r\n";
+  }
+
+  std::shared_ptr<Schema> schema;
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  ASSERT_OK(ReadAll(ss.str(), &schema, &batches));
+  ASSERT_TRUE(schema->field(0)->type()->Equals(int64()));
+  ASSERT_TRUE(schema->field(1)->type()->Equals(utf8()));
+
+  int64_t expected = 0;
+  for (const auto& batch : batches) {
+    const auto& values = static_cast<const Int64Array&>(*batch->column(0));
+    const auto& padding = static_cast<const StringArray&>(*batch->column(1));
+    for (int64_t i = 0; i < values.length(); ++i) {
+      ASSERT_EQ(std::string(expected % 20, 'x') + "\n", padding.GetString(i));
+      ASSERT_EQ(expected++, values.Value(i));
+    }
+  }
+  ASSERT_EQ(num_rows, expected);
+}
+
+TEST_F(TestStreamingReader, Errors) {
+  std::shared_ptr<Schema> schema;
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  ASSERT_RAISES(Invalid, ReadAll("a,b\n1,2\n3\n", &schema, &batches));
+
+  // Inferred from the first block only
+  read_options_.block_size = 8;
+  ASSERT_RAISES(Invalid, ReadAll("a\n1\n2\n3\nfoo\n", &schema, &batches));
+
+  convert_options_.column_types["a"] = decimal(10, 2);
+  ASSERT_RAISES(NotImplemented, ReadAll("a\n1\n", &schema, &batches));
+}
+
+}  // namespace csv
+}  // namespace arrow
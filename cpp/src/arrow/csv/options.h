@@ -0,0 +1,92 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_CSV_OPTIONS_H
+#define ARROW_CSV_OPTIONS_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class DataType;
+
+namespace csv {
+
+/// \brief How the text of a CSV file is split into rows and values
+struct ARROW_EXPORT ParseOptions {
+  /// The character between the values of a row
+  char delimiter = ',';
+
+  /// Whether values may be quoted, the delimiters and newlines between the
+  /// quotes being part of the value
+  bool quoting = true;
+  char quote_char = '"';
+  /// Whether two quote characters in a quoted value stand for one
+  bool double_quote = true;
+
+  /// Whether the character following the escape character is taken as is
+  bool escaping = false;
+  char escape_char = '\\';
+
+  /// Whether quoted values may span lines. Rows are then only told apart by
+  /// following the quotes from the start of each block, which is slower
+  bool newlines_in_values = false;
+
+  /// The rows at the start of the file that are not data, the last of them
+  /// naming the columns. With none, the columns are named "f0", "f1", ...
+  int32_t header_rows = 1;
+};
+
+/// \brief How the values of a CSV file are converted into arrays
+struct ARROW_EXPORT ConvertOptions {
+  /// The types of the columns of these names. Those of the other columns are
+  /// inferred from the first block: each is the first of null, int64,
+  /// boolean, float64, timestamp[s] and utf8 that all its values convert to
+  std::unordered_map<std::string, std::shared_ptr<DataType>> column_types;
+
+  /// The unquoted values taken to be null
+  std::vector<std::string> null_values = {"", "#N/A", "N/A", "NA", "NULL", "null"};
+
+  /// The values read as true and false in boolean columns
+  std::vector<std::string> true_values = {"1", "True", "TRUE", "true"};
+  std::vector<std::string> false_values = {"0", "False", "FALSE", "false"};
+
+  /// Whether the null values are null in string and binary columns too,
+  /// rather than strings
+  bool strings_can_be_null = false;
+};
+
+/// \brief How a CSV file is read
+struct ARROW_EXPORT ReadOptions {
+  /// The bytes read at a time. Each block, cut at its last whole row, is
+  /// parsed into a record batch of its own
+  int32_t block_size = 1 << 20;
+
+  /// Parse several blocks at once, on the CPU thread pool
+  bool use_threads = true;
+};
+
+}  // namespace csv
+}  // namespace arrow
+
+#endif  // ARROW_CSV_OPTIONS_H
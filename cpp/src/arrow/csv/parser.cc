@@ -0,0 +1,192 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/csv/parser.h"
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <sstream>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define ARROW_HAVE_SSE2 1
+#endif
+
+#include "arrow/util/bit-util.h"
+
+namespace arrow {
+namespace csv {
+
+namespace {
+
+// Finds the first of up to four characters in a run of bytes, sixteen bytes
+// at a time where SSE2 is available
+class CharFinder {
+ public:
+  CharFinder(char c0, char c1, char c2, char c3) : chars_{c0, c1, c2, c3} {
+    std::memset(table_, 0, sizeof(table_));
+    for (char c : chars_) {
+      table_[static_cast<uint8_t>(c)] = 1;
+    }
+  }
+
+  const char* Find(const char* p, const char* end) const {
+#ifdef ARROW_HAVE_SSE2
+    const __m128i c0 = _mm_set1_epi8(chars_[0]);
+    const __m128i c1 = _mm_set1_epi8(chars_[1]);
+    const __m128i c2 = _mm_set1_epi8(chars_[2]);
+    const __m128i c3 = _mm_set1_epi8(chars_[3]);
+    while (end - p >= 16) {
+      const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+      const __m128i matches =
+          _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, c0), _mm_cmpeq_epi8(v, c1)),
+                       _mm_or_si128(_mm_cmpeq_epi8(v, c2), _mm_cmpeq_epi8(v, c3)));
+      const int mask = _mm_movemask_epi8(matches);
+      if (mask != 0) {
+        return p + BitUtil::CountTrailingZeros(static_cast<uint32_t>(mask));
+      }
+      p += 16;
+    }
+#endif
+    while (p < end && !table_[static_cast<uint8_t>(*p)]) {
+      ++p;
+    }
+    return p;
+  }
+
+ private:
+  char chars_[4];
+  uint8_t table_[256];
+};
+
+}  // namespace
+
+BlockParser::BlockParser(const ParseOptions& options, int32_t num_cols,
+                         int64_t max_num_rows)
+    : options_(options),
+      num_cols_(num_cols),
+      max_num_rows_(max_num_rows),
+      num_rows_(0) {}
+
+Status BlockParser::FinishRow(int32_t num_values) {
+  if (num_cols_ == -1) {
+    num_cols_ = num_values;
+  } else if (num_values != num_cols_) {
+    std::stringstream ss;
+    ss << "Expected " << num_cols_ << " columns in CSV row, got " << num_values;
+    return Status::Invalid(ss.str());
+  }
+  ++num_rows_;
+  return Status::OK();
+}
+
+Status BlockParser::Parse(const char* data, int64_t size, int64_t* out_size) {
+  const char delimiter = options_.delimiter;
+  const char quote_char = options_.quote_char;
+  const bool escaping = options_.escaping;
+  const char escape_char = options_.escape_char;
+  // The characters ending a run of unquoted and of quoted text; repeating
+  // one stands for none
+  const CharFinder unquoted(delimiter, '\n', '\r', escaping ? escape_char : delimiter);
+  const CharFinder quoted(quote_char, escaping ? escape_char : quote_char, quote_char,
+                          quote_char);
+
+  num_rows_ = 0;
+  values_.clear();
+  values_.reserve(static_cast<size_t>(size));
+  ends_.assign(1, 0);
+  quoted_.clear();
+
+  const char* p = data;
+  const char* end = data + size;
+  while (p < end && (max_num_rows_ < 0 || num_rows_ < max_num_rows_)) {
+    if (*p == '\n' || *p == '\r') {
+      // An empty line
+      ++p;
+      continue;
+    }
+
+    int32_t num_values = 0;
+    while (true) {
+      bool is_quoted = false;
+      if (options_.quoting && p < end && *p == quote_char) {
+        is_quoted = true;
+        ++p;
+        while (true) {
+          const char* special = quoted.Find(p, end);
+          values_.append(p, special - p);
+          p = special;
+          if (p == end) {
+            return Status::Invalid(
+                "CSV quoted value not closed; newlines in values require "
+                "ParseOptions::newlines_in_values");
+          }
+          if (escaping && *p == escape_char) {
+            if (++p == end) {
+              return Status::Invalid("CSV escape character at end of data");
+            }
+            values_.push_back(*p++);
+          } else if (options_.double_quote && p + 1 < end && p[1] == quote_char) {
+            values_.push_back(quote_char);
+            p += 2;
+          } else {
+            ++p;
+            break;
+          }
+        }
+      }
+      // Unquoted text, or text following the closing quote, which is kept
+      while (true) {
+        const char* special = unquoted.Find(p, end);
+        values_.append(p, special - p);
+        p = special;
+        if (p < end && escaping && *p == escape_char) {
+          if (++p == end) {
+            return Status::Invalid("CSV escape character at end of data");
+          }
+          values_.push_back(*p++);
+          continue;
+        }
+        break;
+      }
+
+      if (values_.size() > std::numeric_limits<uint32_t>::max()) {
+        return Status::CapacityError("CSV block too large");
+      }
+      ends_.push_back(static_cast<uint32_t>(values_.size()));
+      quoted_.push_back(is_quoted);
+      ++num_values;
+
+      if (p < end && *p == delimiter) {
+        ++p;
+        continue;
+      }
+      // A newline, of which "\r\n" is one, or the end of the data
+      if (p < end && *p++ == '\r' && p < end && *p == '\n') {
+        ++p;
+      }
+      break;
+    }
+    RETURN_NOT_OK(FinishRow(num_values));
+  }
+  *out_size = p - data;
+  return Status::OK();
+}
+
+}  // namespace csv
+}  // namespace arrow
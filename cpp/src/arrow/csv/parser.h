@@ -0,0 +1,95 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_CSV_PARSER_H
+#define ARROW_CSV_PARSER_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "arrow/csv/options.h"
+#include "arrow/status.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace csv {
+
+/// \class BlockParser
+/// \brief Splits a block of CSV into rows of values
+///
+/// The values are unquoted and unescaped into memory of the parser, to be
+/// visited column by column. Empty lines are skipped.
+class ARROW_EXPORT BlockParser {
+ public:
+  /// \param[in] options how the block is split
+  /// \param[in] num_cols the values of each row, -1 for as many as the first
+  /// row has
+  /// \param[in] max_num_rows the rows to parse at most, -1 for all of them
+  explicit BlockParser(const ParseOptions& options, int32_t num_cols = -1,
+                       int64_t max_num_rows = -1);
+
+  /// \brief Parse the rows of a block, the last of which need not end with
+  /// a newline
+  ///
+  /// \param[in] data the block
+  /// \param[in] size the bytes of the block
+  /// \param[out] out_size the bytes parsed, less than size when max_num_rows
+  /// rows were
+  /// \return Status, Invalid when a row has another number of values than
+  /// the others or a quoted value does not end
+  Status Parse(const char* data, int64_t size, int64_t* out_size);
+
+  int32_t num_cols() const { return num_cols_; }
+  int64_t num_rows() const { return num_rows_; }
+
+  /// \brief Call visit(const uint8_t* data, uint32_t size, bool quoted) with
+  /// each value of a column, in order
+  template <typename Visitor>
+  Status VisitColumn(int32_t col, Visitor&& visit) const {
+    const auto data = reinterpret_cast<const uint8_t*>(values_.data());
+    for (int64_t row = 0; row < num_rows_; ++row) {
+      const int64_t index = row * num_cols_ + col;
+      const uint32_t start = ends_[index];
+      RETURN_NOT_OK(visit(data + start, ends_[index + 1] - start, quoted_[index] != 0));
+    }
+    return Status::OK();
+  }
+
+ private:
+  Status FinishRow(int32_t num_values);
+
+  ParseOptions options_;
+  int32_t num_cols_;
+  int64_t max_num_rows_;
+  int64_t num_rows_;
+
+  // The unquoted values, one after the other
+  std::string values_;
+  // Where each value ends in values_, after a leading 0
+  std::vector<uint32_t> ends_;
+  // Whether each value was quoted
+  std::vector<uint8_t> quoted_;
+
+  ARROW_DISALLOW_COPY_AND_ASSIGN(BlockParser);
+};
+
+}  // namespace csv
+}  // namespace arrow
+
+#endif  // ARROW_CSV_PARSER_H
@@ -0,0 +1,313 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/csv/reader.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/csv/chunker.h"
+#include "arrow/csv/converter.h"
+#include "arrow/csv/parser.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
+#include "arrow/status.h"
+#include "arrow/type.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread-pool.h"
+
+namespace arrow {
+namespace csv {
+
+namespace {
+
+// The types tried in turn for the columns not given one
+std::vector<std::shared_ptr<DataType>> InferenceCandidates() {
+  return {null(), int64(), boolean(), float64(), timestamp(TimeUnit::SECOND), utf8()};
+}
+
+}  // namespace
+
+class StreamingReader::StreamingReaderImpl {
+ public:
+  StreamingReaderImpl(MemoryPool* pool, const std::shared_ptr<io::InputStream>& input,
+                      const ReadOptions& read_options, const ParseOptions& parse_options,
+                      const ConvertOptions& convert_options)
+      : pool_(pool),
+        input_(input),
+        read_options_(read_options),
+        parse_options_(parse_options),
+        convert_options_(convert_options),
+        chunker_(parse_options),
+        num_cols_(-1),
+        eof_(false) {}
+
+  Status Init() {
+    if (read_options_.block_size <= 0) {
+      return Status::Invalid("Block size must be positive");
+    }
+    std::vector<std::string> names;
+    RETURN_NOT_OK(ReadHeader(&names));
+    if (first_block_ == nullptr) {
+      RETURN_NOT_OK(ReadBlock(&first_block_));
+    }
+
+    // The first block is parsed now to infer the types from, and again with
+    // the next ones
+    std::unique_ptr<BlockParser> parser;
+    if (first_block_ != nullptr) {
+      parser.reset(new BlockParser(parse_options_, num_cols_));
+      int64_t parsed_size;
+      RETURN_NOT_OK(parser->Parse(reinterpret_cast<const char*>(first_block_->data()),
+                                  first_block_->size(), &parsed_size));
+      num_cols_ = parser->num_cols();
+    }
+    num_cols_ = std::max(num_cols_, 0);
+    for (int32_t i = static_cast<int32_t>(names.size()); i < num_cols_; ++i) {
+      std::stringstream ss;
+      ss << "f" << i;
+      names.push_back(ss.str());
+    }
+
+    converters_.resize(num_cols_);
+    auto make_converter = [&](int i) -> Status {
+      auto it = convert_options_.column_types.find(names[i]);
+      if (it != convert_options_.column_types.end()) {
+        return Converter::Make(it->second, convert_options_, pool_, &converters_[i]);
+      }
+      return InferConverter(parser.get(), i, &converters_[i]);
+    };
+    if (read_options_.use_threads && num_cols_ > 1) {
+      RETURN_NOT_OK(ParallelFor(num_cols_, make_converter));
+    } else {
+      for (int i = 0; i < num_cols_; ++i) {
+        RETURN_NOT_OK(make_converter(i));
+      }
+    }
+
+    std::vector<std::shared_ptr<Field>> fields;
+    for (int i = 0; i < num_cols_; ++i) {
+      fields.push_back(field(names[i], converters_[i]->type()));
+    }
+    schema_ = ::arrow::schema(fields);
+    return Status::OK();
+  }
+
+  std::shared_ptr<Schema> schema() const { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* out) {
+    while (batches_.empty()) {
+      if (eof_ && first_block_ == nullptr && partial_ == nullptr) {
+        *out = nullptr;
+        return Status::OK();
+      }
+      RETURN_NOT_OK(ParseBlocks());
+    }
+    *out = batches_.front();
+    batches_.pop_front();
+    return Status::OK();
+  }
+
+ private:
+  // Parse the header rows, the column names being the values of the last;
+  // what follows them in the block they end in is kept as the first block
+  Status ReadHeader(std::vector<std::string>* names) {
+    int32_t rows_left = parse_options_.header_rows;
+    while (rows_left > 0) {
+      std::shared_ptr<Buffer> block;
+      RETURN_NOT_OK(ReadBlock(&block));
+      if (block == nullptr) {
+        return Status::OK();
+      }
+      BlockParser parser(parse_options_, -1, rows_left);
+      int64_t parsed_size;
+      RETURN_NOT_OK(parser.Parse(reinterpret_cast<const char*>(block->data()),
+                                 block->size(), &parsed_size));
+      rows_left -= static_cast<int32_t>(parser.num_rows());
+      if (rows_left == 0) {
+        num_cols_ = parser.num_cols();
+        names->resize(num_cols_);
+        for (int32_t i = 0; i < num_cols_; ++i) {
+          auto visit = [&](const uint8_t* data, uint32_t size, bool quoted) -> Status {
+            (*names)[i].assign(reinterpret_cast<const char*>(data), size);
+            return Status::OK();
+          };
+          RETURN_NOT_OK(parser.VisitColumn(i, visit));
+        }
+        if (parsed_size < block->size()) {
+          first_block_ = SliceBuffer(block, parsed_size, block->size() - parsed_size);
+        }
+      }
+    }
+    return Status::OK();
+  }
+
+  // The first of the candidate types all the values of the column in the
+  // parsed first block convert to
+  Status InferConverter(const BlockParser* parser, int32_t col,
+                        std::shared_ptr<Converter>* out) {
+    for (const auto& type : InferenceCandidates()) {
+      std::shared_ptr<Converter> converter;
+      RETURN_NOT_OK(Converter::Make(type, convert_options_, pool_, &converter));
+      std::shared_ptr<Array> array;
+      if (parser == nullptr || converter->Convert(*parser, col, &array).ok()) {
+        *out = converter;
+        return Status::OK();
+      }
+    }
+    return Status::UnknownError("CSV values not convertible to a string");
+  }
+
+  Status ParseBlock(const Buffer& block, std::shared_ptr<RecordBatch>* out) {
+    BlockParser parser(parse_options_, num_cols_);
+    int64_t parsed_size;
+    RETURN_NOT_OK(parser.Parse(reinterpret_cast<const char*>(block.data()),
+                               block.size(), &parsed_size));
+    std::vector<std::shared_ptr<Array>> columns(num_cols_);
+    for (int32_t i = 0; i < num_cols_; ++i) {
+      RETURN_NOT_OK(converters_[i]->Convert(parser, i, &columns[i]));
+    }
+    *out = RecordBatch::Make(schema_, parser.num_rows(), columns);
+    return Status::OK();
+  }
+
+  // Read a block for each thread of the CPU pool, and parse them at once
+  Status ParseBlocks() {
+    const int max_blocks = read_options_.use_threads ? GetCpuThreadPoolCapacity() : 1;
+    std::vector<std::shared_ptr<Buffer>> blocks;
+    while (static_cast<int>(blocks.size()) < std::max(max_blocks, 1)) {
+      std::shared_ptr<Buffer> block;
+      RETURN_NOT_OK(ReadBlock(&block));
+      if (block == nullptr) {
+        break;
+      }
+      blocks.push_back(block);
+    }
+
+    const auto num_blocks = static_cast<int>(blocks.size());
+    std::vector<std::shared_ptr<RecordBatch>> batches(num_blocks);
+    auto parse = [&](int i) -> Status { return ParseBlock(*blocks[i], &batches[i]); };
+    if (num_blocks > 1) {
+      RETURN_NOT_OK(ParallelFor(num_blocks, parse));
+    } else if (num_blocks == 1) {
+      RETURN_NOT_OK(parse(0));
+    }
+    for (const auto& batch : batches) {
+      // Blocks of empty lines only
+      if (batch->num_rows() > 0) {
+        batches_.push_back(batch);
+      }
+    }
+    return Status::OK();
+  }
+
+  // The next block of whole rows, null at the end of the input
+  Status ReadBlock(std::shared_ptr<Buffer>* out) {
+    if (first_block_ != nullptr) {
+      *out = first_block_;
+      first_block_.reset();
+      return Status::OK();
+    }
+    while (!eof_) {
+      std::shared_ptr<Buffer> data;
+      RETURN_NOT_OK(input_->Read(read_options_.block_size, &data));
+      if (data->size() == 0) {
+        eof_ = true;
+        break;
+      }
+      if (partial_ != nullptr) {
+        // The row the last block did not end, completed by this one
+        std::shared_ptr<Buffer> joined;
+        RETURN_NOT_OK(AllocateBuffer(pool_, partial_->size() + data->size(), &joined));
+        uint8_t* dest = joined->mutable_data();
+        std::memcpy(dest, partial_->data(), static_cast<size_t>(partial_->size()));
+        std::memcpy(dest + partial_->size(), data->data(),
+                    static_cast<size_t>(data->size()));
+        data = joined;
+        partial_.reset();
+      }
+      int64_t whole_size;
+      RETURN_NOT_OK(chunker_.Process(reinterpret_cast<const char*>(data->data()),
+                                     data->size(), &whole_size));
+      if (whole_size == 0) {
+        partial_ = data;
+        continue;
+      }
+      if (whole_size < data->size()) {
+        partial_ = SliceBuffer(data, whole_size, data->size() - whole_size);
+      }
+      *out = SliceBuffer(data, 0, whole_size);
+      return Status::OK();
+    }
+    // The last row need not end with a newline
+    *out = partial_;
+    partial_.reset();
+    return Status::OK();
+  }
+
+  MemoryPool* pool_;
+  std::shared_ptr<io::InputStream> input_;
+  const ReadOptions read_options_;
+  const ParseOptions parse_options_;
+  const ConvertOptions convert_options_;
+  const Chunker chunker_;
+
+  int32_t num_cols_;
+  std::shared_ptr<Schema> schema_;
+  std::vector<std::shared_ptr<Converter>> converters_;
+
+  bool eof_;
+  std::shared_ptr<Buffer> first_block_;
+  std::shared_ptr<Buffer> partial_;
+  std::deque<std::shared_ptr<RecordBatch>> batches_;
+};
+
+StreamingReader::StreamingReader() {}
+
+StreamingReader::~StreamingReader() {}
+
+Status StreamingReader::Open(MemoryPool* pool,
+                             const std::shared_ptr<io::InputStream>& input,
+                             const ReadOptions& read_options,
+                             const ParseOptions& parse_options,
+                             const ConvertOptions& convert_options,
+                             std::shared_ptr<RecordBatchReader>* out) {
+  std::shared_ptr<StreamingReader> reader(new StreamingReader());
+  reader->impl_.reset(new StreamingReaderImpl(pool, input, read_options, parse_options,
+                                              convert_options));
+  RETURN_NOT_OK(reader->impl_->Init());
+  *out = reader;
+  return Status::OK();
+}
+
+std::shared_ptr<Schema> StreamingReader::schema() const { return impl_->schema(); }
+
+Status StreamingReader::ReadNext(std::shared_ptr<RecordBatch>* batch) {
+  return impl_->ReadNext(batch);
+}
+
+}  // namespace csv
+}  // namespace arrow
@@ -0,0 +1,80 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_CSV_READER_H
+#define ARROW_CSV_READER_H
+
+#include <memory>
+
+#include "arrow/csv/options.h"
+#include "arrow/record_batch.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class MemoryPool;
+class Schema;
+class Status;
+
+namespace io {
+
+class InputStream;
+
+}  // namespace io
+
+namespace csv {
+
+/// \class StreamingReader
+/// \brief Reads a CSV file into record batches, one for each block
+///
+/// The blocks are cut at their last whole row and parsed several at once,
+/// on the CPU thread pool. The types of the columns not given in the
+/// ConvertOptions are inferred from the first block.
+class ARROW_EXPORT StreamingReader : public RecordBatchReader {
+ public:
+  ~StreamingReader() override;
+
+  /// \brief Start reading CSV, reading the header and inferring the types of
+  /// the columns
+  ///
+  /// \param[in] pool a MemoryPool to build the batches from
+  /// \param[in] input the CSV
+  /// \param[in] read_options see ReadOptions
+  /// \param[in] parse_options see ParseOptions
+  /// \param[in] convert_options see ConvertOptions
+  /// \param[out] out the reader
+  /// \return Status
+  static Status Open(MemoryPool* pool, const std::shared_ptr<io::InputStream>& input,
+                     const ReadOptions& read_options, const ParseOptions& parse_options,
+                     const ConvertOptions& convert_options,
+                     std::shared_ptr<RecordBatchReader>* out);
+
+  std::shared_ptr<Schema> schema() const override;
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* batch) override;
+
+ private:
+  StreamingReader();
+
+  class ARROW_NO_EXPORT StreamingReaderImpl;
+  std::unique_ptr<StreamingReaderImpl> impl_;
+};
+
+}  // namespace csv
+}  // namespace arrow
+
+#endif  // ARROW_CSV_READER_H
@@ -0,0 +1,254 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "arrow/array.h"
+#include "arrow/dataset/dataset.h"
+#include "arrow/dataset/file-ipc.h"
+#include "arrow/io/file.h"
+#include "arrow/ipc/feather.h"
+#include "arrow/ipc/test-common.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/record_batch.h"
+#include "arrow/status.h"
+#include "arrow/table.h"
+#include "arrow/test-util.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace dataset {
+
+class TestDataset : public ::testing::Test {
+ public:
+  void SetUp() override {
+    fs_ = std::make_shared<io::LocalFileSystem>();
+    root_ = "arrow-test-dataset";
+    DeleteRoot();
+    schema_ = ::arrow::schema({field("x", int32())});
+    formats_ = {std::make_shared<IpcFileFormat>(), std::make_shared<FeatherFileFormat>()};
+
+    ASSERT_OK(fs_->MakeDirectory(root_ + "/year=2017"));
+    ASSERT_OK(fs_->MakeDirectory(root_ + "/year=2018"));
+    ASSERT_NO_FATAL_FAILURE(
+        WriteIpcFile(root_ + "/year=2017/part-0.arrow", {{1, 2, 3}, {4, 5}}));
+    ASSERT_NO_FATAL_FAILURE(
+        WriteFeatherFile(root_ + "/year=2018/part-0.feather", {10, 20}));
+    // Left out of the dataset
+    ASSERT_NO_FATAL_FAILURE(WriteIpcFile(root_ + "/year=2018/_SUCCESS.arrow", {{0}}));
+    ASSERT_NO_FATAL_FAILURE(WriteIpcFile(root_ + "/year=2018/.part-0.arrow", {{0}}));
+    ASSERT_NO_FATAL_FAILURE(WriteIpcFile(root_ + "/year=2018/part-0.csv", {{0}}));
+  }
+
+  void TearDown() override { DeleteRoot(); }
+
+  void DeleteRoot() {
+    io::FileStatistics stat;
+    if (fs_->Stat(root_, &stat).ok()) {
+      ASSERT_OK(fs_->DeleteDirectory(root_));
+    }
+  }
+
+  std::shared_ptr<Array> MakeInt32(const std::vector<int32_t>& values) {
+    std::shared_ptr<Array> out;
+    ArrayFromVector<Int32Type, int32_t>(values, &out);
+    return out;
+  }
+
+  std::shared_ptr<Array> MakeInt64(const std::vector<int64_t>& values) {
+    std::shared_ptr<Array> out;
+    ArrayFromVector<Int64Type, int64_t>(values, &out);
+    return out;
+  }
+
+  // An IPC file of a batch per vector, with statistics
+  void WriteIpcFile(const std::string& path,
+                    const std::vector<std::vector<int32_t>>& batches) {
+    std::shared_ptr<io::OutputStream> sink;
+    ASSERT_OK(io::FileOutputStream::Open(path, &sink));
+    std::shared_ptr<ipc::RecordBatchWriter> writer;
+    ASSERT_OK(ipc::RecordBatchFileWriter::Open(sink.get(), schema_, &writer));
+    static_cast<ipc::RecordBatchFileWriter&>(*writer).set_write_statistics(true);
+    for (const auto& values : batches) {
+      auto batch = RecordBatch::Make(schema_, static_cast<int64_t>(values.size()),
+                                     {MakeInt32(values)});
+      ASSERT_OK(writer->WriteRecordBatch(*batch));
+    }
+    ASSERT_OK(writer->Close());
+    ASSERT_OK(sink->Close());
+  }
+
+  void WriteFeatherFile(const std::string& path, const std::vector<int32_t>& values) {
+    std::shared_ptr<io::OutputStream> sink;
+    ASSERT_OK(io::FileOutputStream::Open(path, &sink));
+    std::unique_ptr<ipc::feather::TableWriter> writer;
+    ASSERT_OK(ipc::feather::TableWriter::Open(sink, &writer));
+    writer->SetNumRows(static_cast<int64_t>(values.size()));
+    ASSERT_OK(writer->Append("x", *MakeInt32(values)));
+    ASSERT_OK(writer->Finalize());
+    ASSERT_OK(sink->Close());
+  }
+
+  void Discover(std::shared_ptr<Dataset>* out) {
+    ASSERT_OK(Dataset::Discover(fs_, root_, formats_, out));
+  }
+
+  void ScanAll(const Dataset& dataset, const ScanOptions& options,
+               std::shared_ptr<Table>* out) {
+    std::shared_ptr<RecordBatchReader> reader;
+    ASSERT_OK(dataset.Scan(options, &reader));
+    std::vector<std::shared_ptr<RecordBatch>> batches;
+    std::shared_ptr<RecordBatch> batch;
+    while (true) {
+      ASSERT_OK(reader->ReadNext(&batch));
+      if (batch == nullptr) {
+        break;
+      }
+      batches.push_back(batch);
+    }
+    ASSERT_OK(Table::FromRecordBatches(reader->schema(), batches, out));
+  }
+
+  void AssertColumn(const std::shared_ptr<Array>& expected, const Table& table, int i) {
+    std::shared_ptr<Table> combined;
+    ASSERT_OK(table.CombineChunks(default_memory_pool(), &combined));
+    test::AssertArraysEqual(*expected, *combined->column(i)->data()->chunk(0));
+  }
+
+ protected:
+  std::shared_ptr<io::LocalFileSystem> fs_;
+  std::string root_;
+  std::shared_ptr<Schema> schema_;
+  std::vector<std::shared_ptr<FileFormat>> formats_;
+};
+
+TEST_F(TestDataset, Discover) {
+  std::shared_ptr<Dataset> dataset;
+  ASSERT_NO_FATAL_FAILURE(Discover(&dataset));
+
+  auto expected_schema = ::arrow::schema({field("x", int32()), field("year", int64())});
+  ASSERT_TRUE(dataset->schema()->Equals(*expected_schema));
+  ASSERT_EQ(1, dataset->num_partition_fields());
+  const auto& fragments = dataset->fragments();
+  ASSERT_EQ(2, fragments.size());
+  ASSERT_EQ(root_ + "/year=2017/part-0.arrow", fragments[0].path);
+  ASSERT_EQ("arrow", fragments[0].format->extension());
+  ASSERT_EQ(std::vector<std::string>({"2017"}), fragments[0].partition_values);
+  ASSERT_EQ(root_ + "/year=2018/part-0.feather", fragments[1].path);
+  ASSERT_EQ("feather", fragments[1].format->extension());
+  ASSERT_EQ(std::vector<std::string>({"2018"}), fragments[1].partition_values);
+}
+
+TEST_F(TestDataset, DiscoverInconsistentPartitions) {
+  ASSERT_OK(fs_->MakeDirectory(root_ + "/other"));
+  ASSERT_NO_FATAL_FAILURE(WriteIpcFile(root_ + "/other/part-0.arrow", {{6}}));
+  std::shared_ptr<Dataset> dataset;
+  ASSERT_RAISES(Invalid, Dataset::Discover(fs_, root_, formats_, &dataset));
+}
+
+TEST_F(TestDataset, Scan) {
+  std::shared_ptr<Dataset> dataset;
+  ASSERT_NO_FATAL_FAILURE(Discover(&dataset));
+
+  for (bool use_threads : {false, true}) {
+    ScanOptions options;
+    options.use_threads = use_threads;
+    options.readahead = 1;
+    std::shared_ptr<Table> table;
+    ASSERT_NO_FATAL_FAILURE(ScanAll(*dataset, options, &table));
+    ASSERT_TRUE(table->schema()->Equals(*dataset->schema()));
+    ASSERT_NO_FATAL_FAILURE(AssertColumn(MakeInt32({1, 2, 3, 4, 5, 10, 20}), *table, 0));
+    ASSERT_NO_FATAL_FAILURE(AssertColumn(
+        MakeInt64({2017, 2017, 2017, 2017, 2017, 2018, 2018}), *table, 1));
+  }
+}
+
+TEST_F(TestDataset, Projection) {
+  std::shared_ptr<Dataset> dataset;
+  ASSERT_NO_FATAL_FAILURE(Discover(&dataset));
+
+  ScanOptions options;
+  options.columns = {"year", "x"};
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(ScanAll(*dataset, options, &table));
+  ASSERT_EQ(2, table->num_columns());
+  ASSERT_EQ("year", table->schema()->field(0)->name());
+  ASSERT_NO_FATAL_FAILURE(AssertColumn(MakeInt32({1, 2, 3, 4, 5, 10, 20}), *table, 1));
+
+  // Only partition columns
+  options.columns = {"year"};
+  ASSERT_NO_FATAL_FAILURE(ScanAll(*dataset, options, &table));
+  ASSERT_EQ(1, table->num_columns());
+  ASSERT_EQ(7, table->num_rows());
+
+  options.columns = {"missing"};
+  std::shared_ptr<RecordBatchReader> reader;
+  ASSERT_RAISES(Invalid, dataset->Scan(options, &reader));
+}
+
+TEST_F(TestDataset, PartitionPruning) {
+  std::shared_ptr<Dataset> dataset;
+  ASSERT_NO_FATAL_FAILURE(Discover(&dataset));
+
+  std::vector<int> selected;
+  ASSERT_OK(dataset->SelectFragments({Predicate("year", Predicate::GREATER, 2017)},
+                                     &selected));
+  ASSERT_EQ(std::vector<int>({1}), selected);
+
+  ScanOptions options;
+  options.predicates = {Predicate("year", Predicate::EQUAL, 2017)};
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(ScanAll(*dataset, options, &table));
+  ASSERT_NO_FATAL_FAILURE(AssertColumn(MakeInt32({1, 2, 3, 4, 5}), *table, 0));
+}
+
+TEST_F(TestDataset, StatisticsPruning) {
+  std::shared_ptr<Dataset> dataset;
+  ASSERT_NO_FATAL_FAILURE(Discover(&dataset));
+
+  // The first batch of the IPC file is skipped, the Feather file has no
+  // statistics
+  ScanOptions options;
+  options.predicates = {Predicate("x", Predicate::GREATER_EQUAL, 4)};
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(ScanAll(*dataset, options, &table));
+  ASSERT_NO_FATAL_FAILURE(AssertColumn(MakeInt32({4, 5, 10, 20}), *table, 0));
+}
+
+TEST(TestPredicate, MayMatch) {
+  Predicate less("x", Predicate::LESS, 5);
+  ASSERT_TRUE(less.MayMatch(int64_t(4), int64_t(10)));
+  ASSERT_FALSE(less.MayMatch(int64_t(5), int64_t(10)));
+  ASSERT_TRUE(less.MayMatch(4.5, 10.0));
+  ASSERT_TRUE(less.MayMatch(std::string("a"), std::string("b")));
+
+  Predicate not_equal("x", Predicate::NOT_EQUAL, 2.5);
+  ASSERT_FALSE(not_equal.MayMatch(2.5, 2.5));
+  ASSERT_TRUE(not_equal.MayMatch(int64_t(2), int64_t(3)));
+
+  Predicate equal("s", Predicate::EQUAL, std::string("m"));
+  ASSERT_TRUE(equal.MayMatch(std::string("a"), std::string("z")));
+  ASSERT_FALSE(equal.MayMatch(std::string("n"), std::string("z")));
+}
+
+}  // namespace dataset
+}  // namespace arrow
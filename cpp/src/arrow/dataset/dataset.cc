@@ -0,0 +1,504 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/dataset.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstdlib>
+#include <deque>
+#include <future>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/builder.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/record_batch.h"
+#include "arrow/status.h"
+#include "arrow/type.h"
+#include "arrow/util/thread-pool.h"
+
+namespace arrow {
+namespace dataset {
+
+// ----------------------------------------------------------------------
+// Predicate implementation
+
+namespace {
+
+// Whether some value in [min, max] may compare true with value
+template <typename T>
+bool BoundsMayMatch(Predicate::Op op, const T& min, const T& max, const T& value) {
+  switch (op) {
+    case Predicate::EQUAL:
+      return !(value < min) && !(max < value);
+    case Predicate::NOT_EQUAL:
+      return !(min == value && max == value);
+    case Predicate::LESS:
+      return min < value;
+    case Predicate::LESS_EQUAL:
+      return !(value < min);
+    case Predicate::GREATER:
+      return value < max;
+    case Predicate::GREATER_EQUAL:
+      return !(max < value);
+  }
+  return true;
+}
+
+}  // namespace
+
+Predicate::Predicate(const std::string& field_name, Op op, int32_t value)
+    : Predicate(field_name, op, static_cast<int64_t>(value)) {}
+
+Predicate::Predicate(const std::string& field_name, Op op, int64_t value)
+    : field_name(field_name), op(op), kind(INTEGER), int_value(value), double_value(0) {}
+
+Predicate::Predicate(const std::string& field_name, Op op, double value)
+    : field_name(field_name), op(op), kind(DOUBLE), int_value(0), double_value(value) {}
+
+Predicate::Predicate(const std::string& field_name, Op op, const std::string& value)
+    : field_name(field_name),
+      op(op),
+      kind(STRING),
+      int_value(0),
+      double_value(0),
+      string_value(value) {}
+
+bool Predicate::MayMatch(int64_t min, int64_t max) const {
+  switch (kind) {
+    case INTEGER:
+      return BoundsMayMatch(op, min, max, int_value);
+    case DOUBLE:
+      return MayMatch(static_cast<double>(min), static_cast<double>(max));
+    default:
+      return true;
+  }
+}
+
+bool Predicate::MayMatch(double min, double max) const {
+  const double value = kind == INTEGER ? static_cast<double>(int_value) : double_value;
+  if (kind == STRING || std::isnan(min) || std::isnan(max) || std::isnan(value)) {
+    return true;
+  }
+  return BoundsMayMatch(op, min, max, value);
+}
+
+bool Predicate::MayMatch(const std::string& min, const std::string& max) const {
+  if (kind != STRING) {
+    return true;
+  }
+  return BoundsMayMatch(op, min, max, string_value);
+}
+
+// ----------------------------------------------------------------------
+// Discovering the fragments of a dataset
+
+namespace {
+
+std::string BaseName(const std::string& path) {
+  const size_t end = path.find_last_not_of("/\\");
+  if (end == std::string::npos) {
+    return "";
+  }
+  const size_t begin = path.find_last_of("/\\", end);
+  return path.substr(begin == std::string::npos ? 0 : begin + 1, end - begin);
+}
+
+bool ParseInteger(const std::string& value, int64_t* out) {
+  if (value.empty()) {
+    return false;
+  }
+  char* end = nullptr;
+  errno = 0;
+  const long long result = std::strtoll(value.c_str(), &end, 10);  // NOLINT
+  if (errno != 0 || *end != '\0') {
+    return false;
+  }
+  *out = static_cast<int64_t>(result);
+  return true;
+}
+
+using PartitionKeys = std::vector<std::pair<std::string, std::string>>;
+
+struct PartitionedFile {
+  std::string path;
+  std::shared_ptr<FileFormat> format;
+  PartitionKeys keys;
+};
+
+class Discovery {
+ public:
+  Discovery(io::FileSystem* fs, const std::vector<std::shared_ptr<FileFormat>>& formats)
+      : fs_(fs), formats_(formats) {}
+
+  Status Walk(const std::string& dir, const PartitionKeys& keys,
+              std::vector<PartitionedFile>* out) {
+    std::vector<std::string> children;
+    RETURN_NOT_OK(fs_->GetChildren(dir, &children));
+    std::sort(children.begin(), children.end());
+    for (const std::string& child : children) {
+      const std::string name = BaseName(child);
+      if (name.empty() || name[0] == '.' || name[0] == '_') {
+        continue;
+      }
+      io::FileStatistics stat;
+      RETURN_NOT_OK(fs_->Stat(child, &stat));
+      if (stat.kind == io::ObjectType::DIRECTORY) {
+        PartitionKeys child_keys = keys;
+        const size_t equals = name.find('=');
+        if (equals != std::string::npos && equals > 0) {
+          child_keys.emplace_back(name.substr(0, equals), name.substr(equals + 1));
+        }
+        RETURN_NOT_OK(Walk(child, child_keys, out));
+        continue;
+      }
+      const size_t dot = name.rfind('.');
+      if (dot == std::string::npos) {
+        continue;
+      }
+      const std::string extension = name.substr(dot + 1);
+      for (const auto& format : formats_) {
+        if (format->extension() == extension) {
+          out->push_back({child, format, keys});
+          break;
+        }
+      }
+    }
+    return Status::OK();
+  }
+
+ private:
+  io::FileSystem* fs_;
+  const std::vector<std::shared_ptr<FileFormat>>& formats_;
+};
+
+}  // namespace
+
+Dataset::Dataset(const std::shared_ptr<io::FileSystem>& fs,
+                 const std::shared_ptr<Schema>& schema, int num_partition_fields,
+                 std::vector<Fragment> fragments)
+    : fs_(fs),
+      schema_(schema),
+      num_partition_fields_(num_partition_fields),
+      fragments_(std::move(fragments)) {}
+
+Status Dataset::Discover(const std::shared_ptr<io::FileSystem>& fs,
+                         const std::string& root,
+                         const std::vector<std::shared_ptr<FileFormat>>& formats,
+                         std::shared_ptr<Dataset>* out) {
+  std::vector<PartitionedFile> files;
+  Discovery discovery(fs.get(), formats);
+  RETURN_NOT_OK(discovery.Walk(root, {}, &files));
+  if (files.empty()) {
+    return Status::Invalid("No files of the dataset formats found in " + root);
+  }
+
+  // The partition keys of the first file are those of all of them
+  const PartitionKeys& keys = files[0].keys;
+  std::vector<bool> integer_keys(keys.size(), true);
+  std::vector<Fragment> fragments;
+  for (const PartitionedFile& file : files) {
+    bool same_keys = file.keys.size() == keys.size();
+    for (size_t k = 0; same_keys && k < keys.size(); ++k) {
+      same_keys = file.keys[k].first == keys[k].first;
+    }
+    if (!same_keys) {
+      return Status::Invalid("The partition keys of " + file.path +
+                             " differ from those of " + files[0].path);
+    }
+    Fragment fragment;
+    fragment.path = file.path;
+    fragment.format = file.format;
+    for (size_t k = 0; k < keys.size(); ++k) {
+      int64_t value;
+      integer_keys[k] = integer_keys[k] && ParseInteger(file.keys[k].second, &value);
+      fragment.partition_values.push_back(file.keys[k].second);
+    }
+    fragments.push_back(std::move(fragment));
+  }
+
+  std::shared_ptr<io::RandomAccessFile> first_file;
+  RETURN_NOT_OK(fs->OpenInputFile(files[0].path, &first_file));
+  std::shared_ptr<Schema> file_schema;
+  RETURN_NOT_OK(files[0].format->ReadSchema(first_file, &file_schema));
+  RETURN_NOT_OK(first_file->Close());
+
+  std::vector<std::shared_ptr<Field>> fields = file_schema->fields();
+  for (size_t k = 0; k < keys.size(); ++k) {
+    if (file_schema->GetFieldIndex(keys[k].first) >= 0) {
+      return Status::Invalid("The partition key " + keys[k].first +
+                             " is also a column of the files");
+    }
+    fields.push_back(field(keys[k].first, integer_keys[k] ? int64() : utf8()));
+  }
+  out->reset(new Dataset(fs, ::arrow::schema(fields), static_cast<int>(keys.size()),
+                         std::move(fragments)));
+  return Status::OK();
+}
+
+Status Dataset::SelectFragments(const std::vector<Predicate>& predicates,
+                                std::vector<int>* out) const {
+  const int num_file_fields = schema_->num_fields() - num_partition_fields_;
+  for (size_t i = 0; i < fragments_.size(); ++i) {
+    const Fragment& fragment = fragments_[i];
+    bool may_match = true;
+    for (const Predicate& predicate : predicates) {
+      const int64_t index = schema_->GetFieldIndex(predicate.field_name);
+      if (index < num_file_fields) {
+        continue;
+      }
+      const std::string& value = fragment.partition_values[index - num_file_fields];
+      int64_t int_value;
+      if (schema_->field(static_cast<int>(index))->type()->id() == Type::INT64 &&
+          ParseInteger(value, &int_value)) {
+        may_match = may_match && predicate.MayMatch(int_value, int_value);
+      } else {
+        may_match = may_match && predicate.MayMatch(value, value);
+      }
+    }
+    if (may_match) {
+      out->push_back(static_cast<int>(i));
+    }
+  }
+  return Status::OK();
+}
+
+// ----------------------------------------------------------------------
+// Scanning the fragments of a dataset
+
+namespace {
+
+// What the scan of each fragment needs, shared by the tasks of the scan
+struct ScanContext {
+  std::shared_ptr<io::FileSystem> fs;
+  std::shared_ptr<Schema> schema;
+  /// The fields of the batches, in output order
+  std::vector<std::shared_ptr<Field>> fields;
+  /// For each field, its index among the partition fields, or -1 if it is
+  /// read from the files
+  std::vector<int> partition_indices;
+  /// The names of the columns read from the files
+  std::vector<std::string> file_columns;
+  std::vector<Predicate> predicates;
+  MemoryPool* pool;
+};
+
+Status MakePartitionArray(const DataType& type, const std::string& value,
+                          int64_t length, MemoryPool* pool,
+                          std::shared_ptr<Array>* out) {
+  if (type.id() == Type::INT64) {
+    int64_t int_value = 0;
+    ParseInteger(value, &int_value);
+    Int64Builder builder(pool);
+    RETURN_NOT_OK(builder.Reserve(length));
+    for (int64_t i = 0; i < length; ++i) {
+      builder.UnsafeAppend(int_value);
+    }
+    return builder.Finish(out);
+  }
+  StringBuilder builder(pool);
+  RETURN_NOT_OK(builder.Reserve(length));
+  RETURN_NOT_OK(builder.ReserveData(length * static_cast<int64_t>(value.size())));
+  for (int64_t i = 0; i < length; ++i) {
+    RETURN_NOT_OK(builder.Append(value));
+  }
+  return builder.Finish(out);
+}
+
+// Read a fragment into batches of the output fields
+Status ScanFragment(const ScanContext& context, const Fragment& fragment,
+                    std::vector<std::shared_ptr<RecordBatch>>* out) {
+  std::shared_ptr<io::RandomAccessFile> file;
+  RETURN_NOT_OK(context.fs->OpenInputFile(fragment.path, &file));
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  RETURN_NOT_OK(fragment.format->Read(file, context.file_columns, context.predicates,
+                                      context.pool, &batches));
+
+  const std::shared_ptr<Schema> schema = ::arrow::schema(context.fields);
+  int64_t max_length = 0;
+  for (const auto& batch : batches) {
+    max_length = std::max(max_length, batch->num_rows());
+  }
+  // The partition columns of the longest batch, sliced for the others
+  std::vector<std::shared_ptr<Array>> partition_arrays(fragment.partition_values.size());
+
+  for (const auto& batch : batches) {
+    std::vector<std::shared_ptr<Array>> columns;
+    for (size_t j = 0; j < context.fields.size(); ++j) {
+      const Field& field = *context.fields[j];
+      const int partition_index = context.partition_indices[j];
+      if (partition_index >= 0) {
+        std::shared_ptr<Array>& array = partition_arrays[partition_index];
+        if (array == nullptr) {
+          RETURN_NOT_OK(MakePartitionArray(*field.type(),
+                                           fragment.partition_values[partition_index],
+                                           max_length, context.pool, &array));
+        }
+        columns.push_back(array->Slice(0, batch->num_rows()));
+        continue;
+      }
+      const int64_t i = batch->schema()->GetFieldIndex(field.name());
+      if (i < 0 || !batch->column(static_cast<int>(i))->type()->Equals(*field.type())) {
+        std::stringstream ss;
+        ss << "The column " << field.name() << " of " << fragment.path
+           << " is missing or not of type " << field.type()->ToString();
+        return Status::Invalid(ss.str());
+      }
+      columns.push_back(batch->column(static_cast<int>(i)));
+    }
+    out->push_back(RecordBatch::Make(schema, batch->num_rows(), columns));
+  }
+  return file->Close();
+}
+
+class ScanReader : public RecordBatchReader {
+ public:
+  ScanReader(const std::shared_ptr<const ScanContext>& context,
+             std::vector<Fragment> fragments, bool use_threads, int readahead)
+      : context_(context),
+        schema_(::arrow::schema(context->fields)),
+        fragments_(std::move(fragments)),
+        use_threads_(use_threads),
+        readahead_(std::max(readahead, 1)),
+        next_fragment_(0),
+        next_batch_(0) {}
+
+  ~ScanReader() override {
+    // The tasks only use the shared context, but are not left running
+    for (auto& task : tasks_) {
+      task.status.wait();
+    }
+  }
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* out) override {
+    while (next_batch_ == batches_.size()) {
+      batches_.clear();
+      next_batch_ = 0;
+      if (!use_threads_) {
+        if (next_fragment_ == fragments_.size()) {
+          out->reset();
+          return Status::OK();
+        }
+        RETURN_NOT_OK(ScanFragment(*context_, fragments_[next_fragment_++], &batches_));
+        continue;
+      }
+      SubmitTasks();
+      if (tasks_.empty()) {
+        out->reset();
+        return Status::OK();
+      }
+      Task task = std::move(tasks_.front());
+      tasks_.pop_front();
+      // Keep the readahead going while the batches of this one are consumed
+      SubmitTasks();
+      RETURN_NOT_OK(task.status.get());
+      batches_ = std::move(*task.batches);
+    }
+    *out = std::move(batches_[next_batch_++]);
+    return Status::OK();
+  }
+
+ private:
+  struct Task {
+    std::future<Status> status;
+    std::shared_ptr<std::vector<std::shared_ptr<RecordBatch>>> batches;
+  };
+
+  void SubmitTasks() {
+    auto pool = internal::GetIOThreadPool();
+    while (tasks_.size() < static_cast<size_t>(readahead_) &&
+           next_fragment_ < fragments_.size()) {
+      Task task;
+      task.batches = std::make_shared<std::vector<std::shared_ptr<RecordBatch>>>();
+      std::shared_ptr<const ScanContext> context = context_;
+      const Fragment& fragment = fragments_[next_fragment_++];
+      auto batches = task.batches;
+      task.status = pool->Submit([context, fragment, batches]() {
+        return ScanFragment(*context, fragment, batches.get());
+      });
+      tasks_.push_back(std::move(task));
+    }
+  }
+
+  std::shared_ptr<const ScanContext> context_;
+  std::shared_ptr<Schema> schema_;
+  std::vector<Fragment> fragments_;
+  bool use_threads_;
+  int readahead_;
+  size_t next_fragment_;
+
+  std::deque<Task> tasks_;
+  std::vector<std::shared_ptr<RecordBatch>> batches_;
+  size_t next_batch_;
+};
+
+}  // namespace
+
+Status Dataset::Scan(const ScanOptions& options,
+                     std::shared_ptr<RecordBatchReader>* out) const {
+  auto context = std::make_shared<ScanContext>();
+  context->fs = fs_;
+  context->predicates = options.predicates;
+  context->pool = options.pool;
+
+  const int num_file_fields = schema_->num_fields() - num_partition_fields_;
+  std::vector<int> indices;
+  if (options.columns.empty()) {
+    for (int i = 0; i < schema_->num_fields(); ++i) {
+      indices.push_back(i);
+    }
+  }
+  for (const std::string& name : options.columns) {
+    const int64_t i = schema_->GetFieldIndex(name);
+    if (i < 0) {
+      return Status::Invalid("No column named " + name + " in the dataset");
+    }
+    indices.push_back(static_cast<int>(i));
+  }
+  for (int i : indices) {
+    context->fields.push_back(schema_->field(i));
+    context->partition_indices.push_back(i < num_file_fields ? -1 : i - num_file_fields);
+    if (i < num_file_fields) {
+      context->file_columns.push_back(schema_->field(i)->name());
+    }
+  }
+  if (context->file_columns.empty() && num_file_fields > 0) {
+    // The number of rows of the batches is that of a column of the files
+    context->file_columns.push_back(schema_->field(0)->name());
+  }
+
+  std::vector<int> selected;
+  RETURN_NOT_OK(SelectFragments(options.predicates, &selected));
+  std::vector<Fragment> fragments;
+  for (int i : selected) {
+    fragments.push_back(fragments_[i]);
+  }
+  *out = std::make_shared<ScanReader>(context, std::move(fragments), options.use_threads,
+                                      options.readahead);
+  return Status::OK();
+}
+
+}  // namespace dataset
+}  // namespace arrow
@@ -0,0 +1,198 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// A dataset is a directory tree of files holding record batches of the same
+// schema, scanned together into a single stream of batches
+
+#ifndef ARROW_DATASET_DATASET_H
+#define ARROW_DATASET_DATASET_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Schema;
+class Status;
+
+namespace io {
+
+class FileSystem;
+class RandomAccessFile;
+
+}  // namespace io
+
+namespace dataset {
+
+/// \brief A comparison of a column with a literal, used to skip the files and
+/// the parts of files none of whose rows can satisfy it
+///
+/// Rows are not filtered: a scan returns all the rows of the parts it reads.
+struct ARROW_EXPORT Predicate {
+  enum Op { EQUAL, NOT_EQUAL, LESS, LESS_EQUAL, GREATER, GREATER_EQUAL };
+  enum Kind { INTEGER, DOUBLE, STRING };
+
+  Predicate(const std::string& field_name, Op op, int32_t value);
+  Predicate(const std::string& field_name, Op op, int64_t value);
+  Predicate(const std::string& field_name, Op op, double value);
+  Predicate(const std::string& field_name, Op op, const std::string& value);
+
+  /// \brief Whether some value between min and max, both included, may
+  /// satisfy the comparison
+  ///
+  /// Integer bounds are compared with a DOUBLE literal as doubles, and the
+  /// reverse. Bounds of another kind than the literal, otherwise, may match.
+  bool MayMatch(int64_t min, int64_t max) const;
+  bool MayMatch(double min, double max) const;
+  bool MayMatch(const std::string& min, const std::string& max) const;
+
+  std::string field_name;
+  Op op;
+  Kind kind;
+  int64_t int_value;
+  double double_value;
+  std::string string_value;
+};
+
+/// \class FileFormat
+/// \brief A format of the files of a dataset, told apart by their extension
+///
+/// The methods may be called from several threads at once.
+class ARROW_EXPORT FileFormat {
+ public:
+  virtual ~FileFormat() = default;
+
+  /// \brief The extension of the names of the files, without the dot
+  virtual std::string extension() const = 0;
+
+  /// \brief Read the schema of a file
+  virtual Status ReadSchema(const std::shared_ptr<io::RandomAccessFile>& file,
+                            std::shared_ptr<Schema>* out) const = 0;
+
+  /// \brief Read some columns of a file as record batches
+  ///
+  /// \param[in] file the file
+  /// \param[in] columns the names of the columns to read, which the batches
+  /// have in any order
+  /// \param[in] predicates the predicates on columns of the file whose
+  /// statistics, if the format has any, allow skipping parts of it
+  /// \param[in] pool a MemoryPool for the columns read
+  /// \param[out] out the batches read
+  /// \return Status
+  virtual Status Read(const std::shared_ptr<io::RandomAccessFile>& file,
+                      const std::vector<std::string>& columns,
+                      const std::vector<Predicate>& predicates, MemoryPool* pool,
+                      std::vector<std::shared_ptr<RecordBatch>>* out) const = 0;
+};
+
+/// \brief A file of a dataset
+struct ARROW_EXPORT Fragment {
+  std::string path;
+  std::shared_ptr<FileFormat> format;
+  /// \brief The values of the partition fields of the dataset, from the
+  /// key=value names of the directories above the file
+  std::vector<std::string> partition_values;
+};
+
+/// \brief Options of a scan of a Dataset
+struct ARROW_EXPORT ScanOptions {
+  /// The names of the columns to read, in the order of the batches, or all of
+  /// them if empty
+  std::vector<std::string> columns;
+  /// The predicates all rows must satisfy. Fragments are skipped by their
+  /// partition values, and parts of fragments by their statistics
+  std::vector<Predicate> predicates;
+  /// Read the fragments in parallel on the IO thread pool
+  bool use_threads = true;
+  /// The number of fragments read ahead of the one being consumed, the
+  /// batches of a fragment being held in memory until consumed
+  int readahead = 4;
+  MemoryPool* pool = default_memory_pool();
+};
+
+/// \class Dataset
+/// \brief The files of a directory tree, whose record batches are scanned as
+/// a single stream
+///
+/// Directories named key=value partition the dataset: the values become
+/// columns of the batches of the files below them, of type int64 if all of a
+/// key's values are integers and utf8 otherwise. Files and directories whose
+/// names begin with '.' or '_' are left out.
+class ARROW_EXPORT Dataset {
+ public:
+  /// \brief Find the files of a dataset
+  ///
+  /// The schema of the dataset is that of the first file found, in the
+  /// sorted order of the paths, followed by the partition fields. All files
+  /// must be below directories of the same partition keys.
+  ///
+  /// \param[in] fs the file system, such as io::LocalFileSystem or
+  /// io::HadoopFileSystem, wrapped in an io::CachedFileSystem when the tree is
+  /// discovered repeatedly
+  /// \param[in] root the path of the directory of the dataset
+  /// \param[in] formats the formats of the files, others being left out
+  /// \param[out] out the dataset
+  /// \return Status
+  static Status Discover(const std::shared_ptr<io::FileSystem>& fs,
+                         const std::string& root,
+                         const std::vector<std::shared_ptr<FileFormat>>& formats,
+                         std::shared_ptr<Dataset>* out);
+
+  std::shared_ptr<Schema> schema() const { return schema_; }
+
+  const std::vector<Fragment>& fragments() const { return fragments_; }
+
+  /// \brief The number of partition fields, at the end of the schema
+  int num_partition_fields() const { return num_partition_fields_; }
+
+  /// \brief The indices of the fragments whose partition values may satisfy
+  /// all of the predicates
+  Status SelectFragments(const std::vector<Predicate>& predicates,
+                         std::vector<int>* out) const;
+
+  /// \brief Scan the fragments into a single reader of record batches
+  ///
+  /// The batches of each fragment come in order, and the fragments in the
+  /// order of fragments(). All fragments must have the columns read, of the
+  /// types of the dataset schema; ReadNext fails otherwise.
+  ///
+  /// \param[in] options the options of the scan
+  /// \param[out] out the reader, which may outlive the dataset
+  /// \return Status
+  Status Scan(const ScanOptions& options, std::shared_ptr<RecordBatchReader>* out) const;
+
+ private:
+  Dataset(const std::shared_ptr<io::FileSystem>& fs,
+          const std::shared_ptr<Schema>& schema, int num_partition_fields,
+          std::vector<Fragment> fragments);
+
+  std::shared_ptr<io::FileSystem> fs_;
+  std::shared_ptr<Schema> schema_;
+  int num_partition_fields_;
+  std::vector<Fragment> fragments_;
+};
+
+}  // namespace dataset
+}  // namespace arrow
+
+#endif  // ARROW_DATASET_DATASET_H
@@ -0,0 +1,173 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/file-ipc.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/io/interfaces.h"
+#include "arrow/ipc/feather.h"
+#include "arrow/ipc/reader.h"
+#include "arrow/record_batch.h"
+#include "arrow/status.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+
+namespace arrow {
+namespace dataset {
+
+namespace {
+
+// The indices of the named columns in a schema
+Status GetColumnIndices(const Schema& schema, const std::vector<std::string>& columns,
+                        std::vector<int>* out) {
+  for (const std::string& name : columns) {
+    const int64_t i = schema.GetFieldIndex(name);
+    if (i < 0) {
+      return Status::Invalid("No column named " + name + " in the file");
+    }
+    out->push_back(static_cast<int>(i));
+  }
+  return Status::OK();
+}
+
+Status ReadBatches(const Table& table, std::vector<std::shared_ptr<RecordBatch>>* out) {
+  TableBatchReader reader(table);
+  std::shared_ptr<RecordBatch> batch;
+  while (true) {
+    RETURN_NOT_OK(reader.ReadNext(&batch));
+    if (batch == nullptr) {
+      return Status::OK();
+    }
+    out->push_back(batch);
+  }
+}
+
+// Whether the statistics of a batch allow some row to satisfy a predicate
+bool MayMatch(const Schema& schema, const std::vector<ipc::ColumnStatistics>& statistics,
+              const Predicate& predicate) {
+  const int64_t i = schema.GetFieldIndex(predicate.field_name);
+  if (i < 0 || !statistics[i].has_range) {
+    return true;
+  }
+  const ipc::ColumnStatistics& column = statistics[i];
+  if (is_floating(schema.field(static_cast<int>(i))->type()->id())) {
+    return predicate.MayMatch(column.float_min, column.float_max);
+  }
+  return predicate.MayMatch(column.int_min, column.int_max);
+}
+
+}  // namespace
+
+// ----------------------------------------------------------------------
+// IpcFileFormat implementation
+
+std::string IpcFileFormat::extension() const { return "arrow"; }
+
+Status IpcFileFormat::ReadSchema(const std::shared_ptr<io::RandomAccessFile>& file,
+                                 std::shared_ptr<Schema>* out) const {
+  std::shared_ptr<ipc::RecordBatchFileReader> reader;
+  RETURN_NOT_OK(ipc::RecordBatchFileReader::Open(file, &reader));
+  *out = reader->schema();
+  return Status::OK();
+}
+
+Status IpcFileFormat::Read(const std::shared_ptr<io::RandomAccessFile>& file,
+                           const std::vector<std::string>& columns,
+                           const std::vector<Predicate>& predicates, MemoryPool* pool,
+                           std::vector<std::shared_ptr<RecordBatch>>* out) const {
+  // The buffers are read from the file, which has its own pool
+  ARROW_UNUSED(pool);
+  std::shared_ptr<ipc::RecordBatchFileReader> reader;
+  RETURN_NOT_OK(ipc::RecordBatchFileReader::Open(file, &reader));
+  const Schema& schema = *reader->schema();
+  std::vector<int> indices;
+  RETURN_NOT_OK(GetColumnIndices(schema, columns, &indices));
+
+  const bool use_statistics = reader->has_statistics() && !predicates.empty();
+  std::vector<ipc::ColumnStatistics> statistics;
+  for (int i = 0; i < reader->num_record_batches(); ++i) {
+    if (use_statistics) {
+      statistics.clear();
+      RETURN_NOT_OK(reader->GetStatistics(i, &statistics));
+      bool may_match = true;
+      for (const Predicate& predicate : predicates) {
+        may_match = may_match && MayMatch(schema, statistics, predicate);
+      }
+      if (!may_match) {
+        continue;
+      }
+    }
+    std::shared_ptr<RecordBatch> batch;
+    RETURN_NOT_OK(reader->ReadRecordBatch(i, indices, &batch));
+    out->push_back(batch);
+  }
+  return Status::OK();
+}
+
+// ----------------------------------------------------------------------
+// FeatherFileFormat implementation
+
+std::string FeatherFileFormat::extension() const { return "feather"; }
+
+Status FeatherFileFormat::ReadSchema(const std::shared_ptr<io::RandomAccessFile>& file,
+                                     std::shared_ptr<Schema>* out) const {
+  std::unique_ptr<ipc::feather::TableReader> reader;
+  RETURN_NOT_OK(ipc::feather::TableReader::Open(file, &reader));
+  // The types of the columns are only known once they are read
+  std::vector<std::shared_ptr<Field>> fields;
+  for (int i = 0; i < reader->num_columns(); ++i) {
+    std::shared_ptr<Column> column;
+    RETURN_NOT_OK(reader->GetColumn(i, &column));
+    fields.push_back(column->field());
+  }
+  *out = ::arrow::schema(fields);
+  return Status::OK();
+}
+
+Status FeatherFileFormat::Read(const std::shared_ptr<io::RandomAccessFile>& file,
+                               const std::vector<std::string>& columns,
+                               const std::vector<Predicate>& predicates,
+                               MemoryPool* pool,
+                               std::vector<std::shared_ptr<RecordBatch>>* out) const {
+  ARROW_UNUSED(predicates);
+  ARROW_UNUSED(pool);
+  std::unique_ptr<ipc::feather::TableReader> reader;
+  RETURN_NOT_OK(ipc::feather::TableReader::Open(file, &reader));
+  std::vector<int> indices;
+  for (const std::string& name : columns) {
+    int index = -1;
+    for (int i = 0; i < reader->num_columns() && index < 0; ++i) {
+      if (reader->GetColumnName(i) == name) {
+        index = i;
+      }
+    }
+    if (index < 0) {
+      return Status::Invalid("No column named " + name + " in the file");
+    }
+    indices.push_back(index);
+  }
+  std::shared_ptr<Table> table;
+  RETURN_NOT_OK(reader->Read(indices, &table));
+  return ReadBatches(*table, out);
+}
+
+}  // namespace dataset
+}  // namespace arrow
@@ -0,0 +1,72 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_DATASET_FILE_IPC_H
+#define ARROW_DATASET_FILE_IPC_H
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/dataset/dataset.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace dataset {
+
+/// \class IpcFileFormat
+/// \brief Arrow IPC files, with extension "arrow"
+///
+/// Only the buffers of the columns read are read. A record batch is skipped
+/// when the statistics in the footer of the file, if it was written with
+/// them, show that its values of a column are outside the range of a
+/// predicate.
+class ARROW_EXPORT IpcFileFormat : public FileFormat {
+ public:
+  std::string extension() const override;
+
+  Status ReadSchema(const std::shared_ptr<io::RandomAccessFile>& file,
+                    std::shared_ptr<Schema>* out) const override;
+
+  Status Read(const std::shared_ptr<io::RandomAccessFile>& file,
+              const std::vector<std::string>& columns,
+              const std::vector<Predicate>& predicates, MemoryPool* pool,
+              std::vector<std::shared_ptr<RecordBatch>>* out) const override;
+};
+
+/// \class FeatherFileFormat
+/// \brief Feather files, with extension "feather"
+///
+/// Feather files have no statistics, so predicates skip none of their rows.
+/// Reading the schema reads the columns of the file.
+class ARROW_EXPORT FeatherFileFormat : public FileFormat {
+ public:
+  std::string extension() const override;
+
+  Status ReadSchema(const std::shared_ptr<io::RandomAccessFile>& file,
+                    std::shared_ptr<Schema>* out) const override;
+
+  Status Read(const std::shared_ptr<io::RandomAccessFile>& file,
+              const std::vector<std::string>& columns,
+              const std::vector<Predicate>& predicates, MemoryPool* pool,
+              std::vector<std::shared_ptr<RecordBatch>>* out) const override;
+};
+
+}  // namespace dataset
+}  // namespace arrow
+
+#endif  // ARROW_DATASET_FILE_IPC_H
@@ -0,0 +1,127 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/file-orc.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/adapters/orc/adapter.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/record_batch.h"
+#include "arrow/status.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace dataset {
+
+using adapters::orc::ORCFileReader;
+using adapters::orc::ORCPredicate;
+
+namespace {
+
+ORCPredicate::Op ToORCOp(Predicate::Op op) {
+  switch (op) {
+    case Predicate::EQUAL:
+      return ORCPredicate::EQUAL;
+    case Predicate::NOT_EQUAL:
+      return ORCPredicate::NOT_EQUAL;
+    case Predicate::LESS:
+      return ORCPredicate::LESS;
+    case Predicate::LESS_EQUAL:
+      return ORCPredicate::LESS_EQUAL;
+    case Predicate::GREATER:
+      return ORCPredicate::GREATER;
+    case Predicate::GREATER_EQUAL:
+      return ORCPredicate::GREATER_EQUAL;
+  }
+  return ORCPredicate::EQUAL;
+}
+
+// The predicates on columns of the file, as ORC stripe predicates
+void ToORCPredicates(const Schema& schema, const std::vector<Predicate>& predicates,
+                     std::vector<ORCPredicate>* out) {
+  for (const Predicate& predicate : predicates) {
+    const int64_t i = schema.GetFieldIndex(predicate.field_name);
+    if (i < 0) {
+      continue;
+    }
+    const int field_index = static_cast<int>(i);
+    const ORCPredicate::Op op = ToORCOp(predicate.op);
+    switch (predicate.kind) {
+      case Predicate::INTEGER:
+        out->emplace_back(field_index, op, predicate.int_value);
+        break;
+      case Predicate::DOUBLE:
+        out->emplace_back(field_index, op, predicate.double_value);
+        break;
+      case Predicate::STRING:
+        out->emplace_back(field_index, op, predicate.string_value);
+        break;
+    }
+  }
+}
+
+}  // namespace
+
+std::string ORCFileFormat::extension() const { return "orc"; }
+
+Status ORCFileFormat::ReadSchema(const std::shared_ptr<io::RandomAccessFile>& file,
+                                 std::shared_ptr<Schema>* out) const {
+  std::unique_ptr<ORCFileReader> reader;
+  RETURN_NOT_OK(ORCFileReader::Open(file, default_memory_pool(), &reader));
+  return reader->ReadSchema(out);
+}
+
+Status ORCFileFormat::Read(const std::shared_ptr<io::RandomAccessFile>& file,
+                           const std::vector<std::string>& columns,
+                           const std::vector<Predicate>& predicates, MemoryPool* pool,
+                           std::vector<std::shared_ptr<RecordBatch>>* out) const {
+  std::unique_ptr<ORCFileReader> reader;
+  RETURN_NOT_OK(ORCFileReader::Open(file, pool, &reader));
+  std::shared_ptr<Schema> schema;
+  RETURN_NOT_OK(reader->ReadSchema(&schema));
+
+  std::vector<int> indices;
+  for (const std::string& name : columns) {
+    const int64_t i = schema->GetFieldIndex(name);
+    if (i < 0) {
+      return Status::Invalid("No column named " + name + " in the file");
+    }
+    indices.push_back(static_cast<int>(i));
+  }
+  std::vector<ORCPredicate> orc_predicates;
+  ToORCPredicates(*schema, predicates, &orc_predicates);
+
+  std::shared_ptr<Table> table;
+  RETURN_NOT_OK(reader->ReadMatchingStripes(orc_predicates, indices, &table));
+  // One batch per stripe read
+  TableBatchReader batch_reader(*table);
+  std::shared_ptr<RecordBatch> batch;
+  while (true) {
+    RETURN_NOT_OK(batch_reader.ReadNext(&batch));
+    if (batch == nullptr) {
+      return Status::OK();
+    }
+    out->push_back(batch);
+  }
+}
+
+}  // namespace dataset
+}  // namespace arrow
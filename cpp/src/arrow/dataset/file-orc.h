@@ -0,0 +1,52 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_DATASET_FILE_ORC_H
+#define ARROW_DATASET_FILE_ORC_H
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/dataset/dataset.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace dataset {
+
+/// \class ORCFileFormat
+/// \brief ORC files, with extension "orc"
+///
+/// A stripe is skipped when its statistics show that a predicate is false or
+/// null for all of its rows, as with ORCFileReader::ReadMatchingStripes.
+class ARROW_EXPORT ORCFileFormat : public FileFormat {
+ public:
+  std::string extension() const override;
+
+  Status ReadSchema(const std::shared_ptr<io::RandomAccessFile>& file,
+                    std::shared_ptr<Schema>* out) const override;
+
+  Status Read(const std::shared_ptr<io::RandomAccessFile>& file,
+              const std::vector<std::string>& columns,
+              const std::vector<Predicate>& predicates, MemoryPool* pool,
+              std::vector<std::shared_ptr<RecordBatch>>* out) const override;
+};
+
+}  // namespace dataset
+}  // namespace arrow
+
+#endif  // ARROW_DATASET_FILE_ORC_H
@@ -19,10 +19,14 @@
 
 #include <cstdint>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "arrow/array.h"
+#include "arrow/io/memory.h"
+#include "arrow/ipc/writer.h"
 #include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
 #include "arrow/test-util.h"
 
 #include "arrow/gpu/cuda_api.h"
@@ -94,5 +98,174 @@ BENCHMARK(BM_Writer_Unbuffered)
     ->MinTime(1.0)
     ->UseRealTime();
 
+static void BM_Writer_BufferSize(benchmark::State& state) {
+  // 128MB
+  const int64_t kTotalBytes = 1 << 27;
+  const int64_t kChunkSize = 1 << 12;
+  CudaBufferWriterBenchmark(state, kTotalBytes, kChunkSize, state.range(0));
+}
+
+// Vary the buffer size from 64K to 32MB, for 4K chunk writes
+BENCHMARK(BM_Writer_BufferSize)
+    ->RangeMultiplier(8)
+    ->Range(1 << 16, 1 << 25)
+    ->MinTime(1.0)
+    ->UseRealTime();
+
+// ----------------------------------------------------------------------
+// Host/device copies
+
+static std::shared_ptr<CudaContext> GetContext() {
+  CudaDeviceManager* manager;
+  ABORT_NOT_OK(CudaDeviceManager::GetInstance(&manager));
+  std::shared_ptr<CudaContext> context;
+  ABORT_NOT_OK(manager->GetContext(kGpuNumber, &context));
+  return context;
+}
+
+// Host memory of the given size, pinned or else pageable
+static std::shared_ptr<Buffer> AllocateHostMemory(int64_t nbytes, bool pinned) {
+  if (pinned) {
+    CudaDeviceManager* manager;
+    ABORT_NOT_OK(CudaDeviceManager::GetInstance(&manager));
+    std::shared_ptr<CudaHostBuffer> buffer;
+    ABORT_NOT_OK(manager->AllocateHost(nbytes, &buffer));
+    test::random_bytes(nbytes, 0, buffer->mutable_data());
+    return buffer;
+  }
+  std::shared_ptr<ResizableBuffer> buffer;
+  ABORT_NOT_OK(test::MakeRandomByteBuffer(nbytes, default_memory_pool(), &buffer));
+  return buffer;
+}
+
+static void BM_CopyToDevice(benchmark::State& state) {
+  const int64_t nbytes = state.range(0);
+  const bool pinned = state.range(1) != 0;
+  std::shared_ptr<CudaBuffer> device_buffer;
+  ABORT_NOT_OK(GetContext()->Allocate(nbytes, &device_buffer));
+  std::shared_ptr<Buffer> host_buffer = AllocateHostMemory(nbytes, pinned);
+
+  while (state.KeepRunning()) {
+    ABORT_NOT_OK(device_buffer->CopyFromHost(0, host_buffer->data(), nbytes));
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * nbytes);
+}
+
+static void BM_CopyToHost(benchmark::State& state) {
+  const int64_t nbytes = state.range(0);
+  const bool pinned = state.range(1) != 0;
+  std::shared_ptr<CudaBuffer> device_buffer;
+  ABORT_NOT_OK(GetContext()->Allocate(nbytes, &device_buffer));
+  std::shared_ptr<Buffer> host_buffer = AllocateHostMemory(nbytes, pinned);
+
+  while (state.KeepRunning()) {
+    ABORT_NOT_OK(device_buffer->CopyToHost(0, nbytes, host_buffer->mutable_data()));
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * nbytes);
+}
+
+// Vary the copy size from 4K to 256MB, from pageable and pinned memory
+static void CopySizes(benchmark::internal::Benchmark* bench) {
+  for (int pinned = 0; pinned <= 1; ++pinned) {
+    for (int64_t nbytes = 1 << 12; nbytes <= 1 << 28; nbytes <<= 4) {
+      bench->Args({nbytes, pinned});
+    }
+  }
+}
+
+BENCHMARK(BM_CopyToDevice)->Apply(CopySizes)->MinTime(1.0)->UseRealTime();
+
+BENCHMARK(BM_CopyToHost)->Apply(CopySizes)->MinTime(1.0)->UseRealTime();
+
+// ----------------------------------------------------------------------
+// IPC
+
+// An IPC handle cannot be opened in the process that exported it, so only the
+// side of the exporter is measured: exporting a new buffer and serializing its
+// handle for another process
+static void BM_ExportForIpc(benchmark::State& state) {
+  const int64_t nbytes = state.range(0);
+  std::shared_ptr<CudaContext> context = GetContext();
+
+  while (state.KeepRunning()) {
+    state.PauseTiming();
+    // Exported memory is never freed, so each buffer is exported once
+    std::shared_ptr<CudaBuffer> device_buffer;
+    ABORT_NOT_OK(context->Allocate(nbytes, &device_buffer));
+    state.ResumeTiming();
+
+    std::shared_ptr<CudaIpcMemHandle> ipc_handle;
+    ABORT_NOT_OK(device_buffer->ExportForIpc(&ipc_handle));
+    std::shared_ptr<Buffer> serialized_handle;
+    ABORT_NOT_OK(ipc_handle->Serialize(default_memory_pool(), &serialized_handle));
+  }
+}
+
+BENCHMARK(BM_ExportForIpc)->Arg(1 << 20)->Iterations(100)->UseRealTime();
+
+// ----------------------------------------------------------------------
+// Record batches
+
+// Write a stream of record batches of int64 columns of random data
+static std::shared_ptr<Buffer> MakeRecordBatchStream(int64_t batch_size,
+                                                     int num_batches) {
+  const int kNumColumns = 4;
+  const int64_t length = batch_size / (kNumColumns * sizeof(int64_t));
+  std::vector<std::shared_ptr<Field>> fields;
+  std::vector<std::shared_ptr<Array>> columns;
+  for (int i = 0; i < kNumColumns; ++i) {
+    fields.push_back(field("f" + std::to_string(i), int64()));
+    std::shared_ptr<ResizableBuffer> values;
+    ABORT_NOT_OK(test::MakeRandomByteBuffer(length * sizeof(int64_t),
+                                            default_memory_pool(), &values));
+    columns.push_back(std::make_shared<Int64Array>(length, values));
+  }
+  std::shared_ptr<RecordBatch> batch =
+      RecordBatch::Make(schema(fields), length, columns);
+
+  std::shared_ptr<io::BufferOutputStream> sink;
+  ABORT_NOT_OK(io::BufferOutputStream::Create(0, default_memory_pool(), &sink));
+  std::shared_ptr<ipc::RecordBatchWriter> writer;
+  ABORT_NOT_OK(ipc::RecordBatchStreamWriter::Open(sink.get(), batch->schema(), &writer));
+  for (int i = 0; i < num_batches; ++i) {
+    ABORT_NOT_OK(writer->WriteRecordBatch(*batch));
+  }
+  ABORT_NOT_OK(writer->Close());
+  std::shared_ptr<Buffer> stream;
+  ABORT_NOT_OK(sink->Finish(&stream));
+  return stream;
+}
+
+static void BM_ReadRecordBatchStream(benchmark::State& state) {
+  // 8 batches of 32MB
+  const int64_t kBatchSize = 1 << 25;
+  const int kNumBatches = 8;
+  const int64_t staging_size = state.range(0);
+  std::shared_ptr<CudaContext> context = GetContext();
+  std::shared_ptr<Buffer> stream = MakeRecordBatchStream(kBatchSize, kNumBatches);
+  // Reuse the device memory of the bodies, as a pipeline would
+  std::shared_ptr<CudaMemoryPool> pool;
+  ABORT_NOT_OK(CudaMemoryPool::Make(context, 2 * kBatchSize, &pool));
+
+  while (state.KeepRunning()) {
+    io::BufferReader source(stream);
+    std::shared_ptr<RecordBatchReader> reader;
+    ABORT_NOT_OK(
+        CudaRecordBatchStreamReader::Open(&source, context, pool, staging_size, &reader));
+    std::shared_ptr<RecordBatch> batch;
+    do {
+      ABORT_NOT_OK(reader->ReadNext(&batch));
+    } while (batch != nullptr);
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * stream->size());
+}
+
+// Vary the size of the staging buffers from 256K to 16MB
+BENCHMARK(BM_ReadRecordBatchStream)
+    ->RangeMultiplier(4)
+    ->Range(1 << 18, 1 << 24)
+    ->MinTime(1.0)
+    ->UseRealTime();
+
 }  // namespace gpu
 }  // namespace arrow
@@ -21,6 +21,7 @@
 
 #include "gtest/gtest.h"
 
+#include "arrow/io/memory.h"
 #include "arrow/ipc/api.h"
 #include "arrow/ipc/test-common.h"
 #include "arrow/status.h"
@@ -123,6 +124,71 @@ TEST_F(TestCudaBuffer, FromBuffer) {
   AssertCudaBufferEquals(*result, host_buffer->data() + 11, kSize - 20);
 }
 
+TEST_F(TestCudaBuffer, MemoryType) {
+  const int64_t kSize = 1000;
+  std::shared_ptr<ResizableBuffer> host_buffer;
+  ASSERT_OK(test::MakeRandomByteBuffer(kSize, default_memory_pool(), &host_buffer));
+  ASSERT_EQ(MemoryType::HOST, host_buffer->memory_type());
+
+  // Host to device, then device to host through a generic slice
+  std::shared_ptr<CudaBuffer> device_buffer;
+  ASSERT_OK(context_->ViewOrCopyTo(host_buffer, &device_buffer));
+  ASSERT_EQ(MemoryType::CUDA_DEVICE, device_buffer->memory_type());
+  ASSERT_FALSE(device_buffer->is_cpu());
+  AssertCudaBufferEquals(*device_buffer, host_buffer->data(), kSize);
+
+  std::shared_ptr<Buffer> slice = SliceBuffer(device_buffer, 10, 100);
+  ASSERT_EQ(MemoryType::CUDA_DEVICE, slice->memory_type());
+  std::shared_ptr<Buffer> copy;
+  ASSERT_OK(ViewOrCopyToHost(slice, default_memory_pool(), &copy));
+  ASSERT_TRUE(copy->is_cpu());
+  ASSERT_EQ(0, std::memcmp(copy->data(), host_buffer->data() + 10, 100));
+  ASSERT_OK(slice->Copy(5, 10, &copy));
+  ASSERT_EQ(0, std::memcmp(copy->data(), host_buffer->data() + 15, 10));
+
+  // Buffers of the context are views
+  std::shared_ptr<CudaBuffer> view;
+  ASSERT_OK(context_->ViewOrCopyTo(slice, &view));
+  ASSERT_EQ(slice->data(), view->data());
+  ASSERT_EQ(100, view->size());
+
+  std::shared_ptr<CudaHostBuffer> pinned;
+  ASSERT_OK(AllocateCudaHostBuffer(kSize, &pinned));
+  ASSERT_EQ(MemoryType::PINNED_HOST, pinned->memory_type());
+  ASSERT_TRUE(pinned->is_cpu());
+  ASSERT_OK(ViewOrCopyToHost(pinned, default_memory_pool(), &copy));
+  ASSERT_EQ(pinned.get(), copy.get());
+}
+
+TEST_F(TestCudaBuffer, CopyAsync) {
+  const int64_t kSize = 1000;
+  std::shared_ptr<CudaBuffer> device_buffer;
+  ASSERT_OK(context_->Allocate(kSize, &device_buffer));
+  std::shared_ptr<CudaStream> stream;
+  ASSERT_OK(context_->CreateStream(&stream));
+
+  std::shared_ptr<CudaHostBuffer> host_buffer, host_result;
+  ASSERT_OK(manager_->AllocateHost(kSize, &host_buffer));
+  ASSERT_OK(manager_->AllocateHost(kSize, &host_result));
+  test::random_bytes(kSize, 0, host_buffer->mutable_data());
+
+  std::shared_ptr<CudaEvent> event;
+  ASSERT_OK(device_buffer->CopyFromHostAsync(0, host_buffer->data(), 500, stream.get(),
+                                             &event));
+  ASSERT_OK(device_buffer->CopyFromHostAsync(500, host_buffer->data() + 500,
+                                             kSize - 500, stream.get(), &event));
+  ASSERT_OK(event->Wait());
+  bool complete = false;
+  ASSERT_OK(event->IsComplete(&complete));
+  ASSERT_TRUE(complete);
+  AssertCudaBufferEquals(*device_buffer, host_buffer->data(), kSize);
+
+  ASSERT_OK(device_buffer->CopyToHostAsync(0, kSize, host_result->mutable_data(),
+                                           stream.get(), &event));
+  ASSERT_OK(stream->Synchronize());
+  ASSERT_EQ(0, std::memcmp(host_result->data(), host_buffer->data(), kSize));
+}
+
 // IPC only supported on Linux
 #if defined(__linux)
 
@@ -160,6 +226,72 @@ TEST_F(TestCudaBuffer, DISABLED_ExportForIpc) {
 
 #endif
 
+class TestCudaMemoryPool : public TestCudaBufferBase {
+ public:
+  void SetUp() {
+    TestCudaBufferBase::SetUp();
+    ASSERT_OK(CudaMemoryPool::Make(context_, 1 << 20, &pool_));
+  }
+
+ protected:
+  std::shared_ptr<CudaMemoryPool> pool_;
+};
+
+TEST_F(TestCudaMemoryPool, ReuseCachedMemory) {
+  const int64_t kSize = 1000;
+  std::shared_ptr<CudaBuffer> buffer;
+  ASSERT_OK(pool_->Allocate(kSize, &buffer));
+  ASSERT_EQ(kSize, buffer->size());
+  ASSERT_EQ(1024, pool_->bytes_allocated());
+  const uint8_t* data = buffer->data();
+
+  std::shared_ptr<ResizableBuffer> host_buffer;
+  ASSERT_OK(test::MakeRandomByteBuffer(kSize, default_memory_pool(), &host_buffer));
+  ASSERT_OK(buffer->CopyFromHost(0, host_buffer->data(), kSize));
+  AssertCudaBufferEquals(*buffer, host_buffer->data(), kSize);
+
+  // The memory of the buffer is reused by the next one of the same bin
+  buffer.reset();
+  ASSERT_EQ(0, pool_->bytes_allocated());
+  ASSERT_OK(pool_->Allocate(600, &buffer));
+  ASSERT_EQ(data, buffer->data());
+
+  CudaMemoryPoolStats stats = pool_->stats();
+  ASSERT_EQ(2, stats.num_allocations);
+  ASSERT_EQ(1, stats.num_cache_hits);
+  ASSERT_EQ(1, stats.num_device_allocations);
+  ASSERT_EQ(1024, stats.max_memory);
+  ASSERT_EQ(0, stats.bytes_cached);
+}
+
+TEST_F(TestCudaMemoryPool, ReleaseCached) {
+  std::shared_ptr<CudaBuffer> small_buffer, large_buffer;
+  ASSERT_OK(pool_->Allocate(100, &small_buffer));
+  // Memory beyond what the pool keeps is freed at once
+  ASSERT_OK(pool_->Allocate(2 << 20, &large_buffer));
+  const int64_t device_bytes = context_->bytes_allocated();
+  small_buffer.reset();
+  large_buffer.reset();
+  ASSERT_EQ(CudaMemoryPool::kMinBinSize, pool_->stats().bytes_cached);
+  ASSERT_EQ(device_bytes - (2 << 20), context_->bytes_allocated());
+
+  ASSERT_OK(pool_->ReleaseCached());
+  CudaMemoryPoolStats stats = pool_->stats();
+  ASSERT_EQ(0, stats.bytes_cached);
+  ASSERT_EQ(2, stats.num_device_frees);
+  ASSERT_EQ(device_bytes - (2 << 20) - CudaMemoryPool::kMinBinSize,
+            context_->bytes_allocated());
+}
+
+TEST_F(TestCudaMemoryPool, OutlivedByBuffers) {
+  std::shared_ptr<CudaBuffer> buffer;
+  ASSERT_OK(pool_->Allocate(100, &buffer));
+  const int64_t device_bytes = context_->bytes_allocated();
+  pool_.reset();
+  buffer.reset();
+  ASSERT_EQ(device_bytes - CudaMemoryPool::kMinBinSize, context_->bytes_allocated());
+}
+
 class TestCudaBufferWriter : public TestCudaBufferBase {
  public:
   void SetUp() { TestCudaBufferBase::SetUp(); }
@@ -343,5 +475,54 @@ TEST_F(TestCudaArrowIpc, BasicWriteRead) {
   ipc::CompareBatch(*batch, *cpu_batch);
 }
 
+TEST_F(TestCudaArrowIpc, StreamReader) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(ipc::MakeIntRecordBatch(&batch));
+
+  std::shared_ptr<io::BufferOutputStream> sink;
+  ASSERT_OK(io::BufferOutputStream::Create(0, pool_, &sink));
+  std::shared_ptr<ipc::RecordBatchWriter> writer;
+  ASSERT_OK(ipc::RecordBatchStreamWriter::Open(sink.get(), batch->schema(), &writer));
+  ASSERT_OK(writer->WriteRecordBatch(*batch));
+  ASSERT_OK(writer->WriteRecordBatch(*batch));
+  ASSERT_OK(writer->Close());
+  std::shared_ptr<Buffer> stream_buffer;
+  ASSERT_OK(sink->Finish(&stream_buffer));
+
+  // Small staging buffers, so that the bodies are copied in many chunks
+  io::BufferReader device_source(stream_buffer);
+  std::shared_ptr<RecordBatchReader> device_reader;
+  ASSERT_OK(CudaRecordBatchStreamReader::Open(&device_source, context_, nullptr, 64,
+                                              &device_reader));
+  ASSERT_TRUE(device_reader->schema()->Equals(*batch->schema()));
+  io::BufferReader host_source(stream_buffer);
+  std::shared_ptr<RecordBatchReader> host_reader;
+  ASSERT_OK(ipc::RecordBatchStreamReader::Open(&host_source, &host_reader));
+
+  std::shared_ptr<RecordBatch> device_batch, host_batch;
+  for (int i = 0; i < 2; ++i) {
+    ASSERT_OK(device_reader->ReadNext(&device_batch));
+    ASSERT_OK(host_reader->ReadNext(&host_batch));
+    ASSERT_EQ(host_batch->num_rows(), device_batch->num_rows());
+    for (int j = 0; j < host_batch->num_columns(); ++j) {
+      const auto& expected = host_batch->column_data(j)->buffers;
+      const auto& actual = device_batch->column_data(j)->buffers;
+      ASSERT_EQ(expected.size(), actual.size());
+      for (size_t k = 0; k < expected.size(); ++k) {
+        if (!expected[k]) {
+          ASSERT_EQ(nullptr, actual[k]);
+          continue;
+        }
+        std::shared_ptr<CudaBuffer> device_buffer;
+        ASSERT_OK(CudaBuffer::FromBuffer(actual[k], &device_buffer));
+        ASSERT_EQ(expected[k]->size(), device_buffer->size());
+        AssertCudaBufferEquals(*device_buffer, expected[k]->data(), expected[k]->size());
+      }
+    }
+  }
+  ASSERT_OK(device_reader->ReadNext(&device_batch));
+  ASSERT_EQ(nullptr, device_batch);
+}
+
 }  // namespace gpu
 }  // namespace arrow
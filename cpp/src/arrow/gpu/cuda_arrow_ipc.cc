@@ -17,22 +17,26 @@
 
 #include "arrow/gpu/cuda_arrow_ipc.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <memory>
 #include <sstream>
 #include <vector>
 
 #include "arrow/buffer.h"
+#include "arrow/io/interfaces.h"
 #include "arrow/ipc/Message_generated.h"
 #include "arrow/ipc/message.h"
 #include "arrow/ipc/reader.h"
 #include "arrow/ipc/writer.h"
 #include "arrow/record_batch.h"
 #include "arrow/status.h"
+#include "arrow/type.h"
 #include "arrow/util/visibility.h"
 
 #include "arrow/gpu/cuda_context.h"
 #include "arrow/gpu/cuda_memory.h"
+#include "arrow/gpu/cuda_memory_pool.h"
 
 namespace arrow {
 
@@ -106,5 +110,174 @@ Status ReadRecordBatch(const std::shared_ptr<Schema>& schema,
   return ipc::ReadRecordBatch(*message, schema, out);
 }
 
+// ----------------------------------------------------------------------
+// CudaRecordBatchStreamReader
+
+constexpr int64_t CudaRecordBatchStreamReader::kDefaultStagingSize;
+
+static bool HasDictionaries(const DataType& type) {
+  if (type.id() == Type::DICTIONARY) {
+    return true;
+  }
+  for (const auto& child : type.children()) {
+    if (HasDictionaries(*child->type())) {
+      return true;
+    }
+  }
+  return false;
+}
+
+class CudaRecordBatchStreamReader::CudaRecordBatchStreamReaderImpl {
+ public:
+  Status Open(io::InputStream* stream, const std::shared_ptr<CudaContext>& context,
+              const std::shared_ptr<CudaMemoryPool>& pool, int64_t staging_size) {
+    if (staging_size <= 0) {
+      return Status::Invalid("The staging buffers must not be empty");
+    }
+    stream_ = stream;
+    context_ = context;
+    pool_ = pool;
+    staging_size_ = staging_size;
+    RETURN_NOT_OK(ipc::ReadSchema(stream, &schema_));
+    for (const auto& field : schema_->fields()) {
+      if (HasDictionaries(*field->type())) {
+        return Status::NotImplemented(
+            "Reading dictionary-encoded fields onto the device is not supported");
+      }
+    }
+    RETURN_NOT_OK(CudaDeviceManager::GetInstance(&manager_));
+    return context_->CreateStream(&cuda_stream_);
+  }
+
+  std::shared_ptr<Schema> schema() const { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* batch) {
+    int32_t message_length = 0;
+    int64_t bytes_read = 0;
+    RETURN_NOT_OK(stream_->Read(sizeof(int32_t), &bytes_read,
+                                reinterpret_cast<uint8_t*>(&message_length)));
+    if (bytes_read != sizeof(int32_t) || message_length == 0) {
+      // End of stream
+      *batch = nullptr;
+      return Status::OK();
+    }
+
+    std::shared_ptr<Buffer> metadata;
+    RETURN_NOT_OK(stream_->Read(message_length, &metadata));
+    if (metadata->size() != message_length) {
+      std::stringstream ss;
+      ss << "Expected to read " << message_length << " metadata bytes, but "
+         << "only read " << metadata->size();
+      return Status::IOError(ss.str());
+    }
+    // Validate the metadata, without a body yet
+    std::unique_ptr<ipc::Message> message;
+    RETURN_NOT_OK(ipc::Message::Open(metadata, nullptr, &message));
+    if (message->type() == ipc::Message::DICTIONARY_BATCH) {
+      return Status::NotImplemented(
+          "Reading dictionary batches onto the device is not supported");
+    }
+    if (message->type() != ipc::Message::RECORD_BATCH) {
+      return Status::IOError("Message is not a record batch, likely malformed");
+    }
+
+    std::shared_ptr<CudaBuffer> body;
+    RETURN_NOT_OK(ReadBody(flatbuf::GetMessage(metadata->data())->bodyLength(), &body));
+    CudaBufferReader body_reader(body);
+    return ipc::ReadRecordBatch(*metadata, schema_, &body_reader, batch);
+  }
+
+ private:
+  // Copy the body of a message from the stream to the device
+  Status ReadBody(int64_t body_length, std::shared_ptr<CudaBuffer>* out) {
+    std::shared_ptr<CudaBuffer> body;
+    if (pool_) {
+      RETURN_NOT_OK(pool_->Allocate(body_length, &body));
+    } else {
+      // The driver does not allocate empty buffers
+      RETURN_NOT_OK(context_->Allocate(std::max<int64_t>(body_length, 1), &body));
+    }
+    Status s = CopyBody(body_length, body.get());
+    // The copies queued use the staging buffers and the body, so they must be
+    // done before either can be reused or freed, even if one failed
+    RETURN_NOT_OK(cuda_stream_->Synchronize());
+    events_[0].reset();
+    events_[1].reset();
+    RETURN_NOT_OK(s);
+    *out = body;
+    return Status::OK();
+  }
+
+  // Fill the staging buffers from the stream in turn, each while the copy
+  // from the other to the device is running
+  Status CopyBody(int64_t body_length, CudaBuffer* body) {
+    int which = 0;
+    for (int64_t position = 0; position < body_length; which ^= 1) {
+      const int64_t nbytes = std::min(staging_size_, body_length - position);
+      if (!staging_[which]) {
+        RETURN_NOT_OK(manager_->AllocateHost(staging_size_, &staging_[which]));
+      }
+      // Wait for the last copy from this staging buffer before refilling it
+      if (events_[which]) {
+        RETURN_NOT_OK(events_[which]->Wait());
+      }
+      int64_t bytes_read = 0;
+      RETURN_NOT_OK(stream_->Read(nbytes, &bytes_read, staging_[which]->mutable_data()));
+      if (bytes_read != nbytes) {
+        std::stringstream ss;
+        ss << "Expected to be able to read " << body_length
+           << " bytes for message body, got " << position + bytes_read;
+        return Status::IOError(ss.str());
+      }
+      RETURN_NOT_OK(body->CopyFromHostAsync(position, staging_[which]->data(), nbytes,
+                                            cuda_stream_.get(), &events_[which]));
+      position += nbytes;
+    }
+    return Status::OK();
+  }
+
+  io::InputStream* stream_;
+  std::shared_ptr<CudaContext> context_;
+  std::shared_ptr<CudaMemoryPool> pool_;
+  int64_t staging_size_;
+  CudaDeviceManager* manager_;
+  std::shared_ptr<Schema> schema_;
+  std::shared_ptr<CudaStream> cuda_stream_;
+  std::shared_ptr<CudaHostBuffer> staging_[2];
+  // The events recorded after the last copies from the staging buffers
+  std::shared_ptr<CudaEvent> events_[2];
+};
+
+CudaRecordBatchStreamReader::CudaRecordBatchStreamReader() {
+  impl_.reset(new CudaRecordBatchStreamReaderImpl());
+}
+
+CudaRecordBatchStreamReader::~CudaRecordBatchStreamReader() {}
+
+Status CudaRecordBatchStreamReader::Open(io::InputStream* stream,
+                                         const std::shared_ptr<CudaContext>& context,
+                                         std::shared_ptr<RecordBatchReader>* out) {
+  return Open(stream, context, nullptr, kDefaultStagingSize, out);
+}
+
+Status CudaRecordBatchStreamReader::Open(io::InputStream* stream,
+                                         const std::shared_ptr<CudaContext>& context,
+                                         const std::shared_ptr<CudaMemoryPool>& pool,
+                                         int64_t staging_size,
+                                         std::shared_ptr<RecordBatchReader>* out) {
+  std::shared_ptr<CudaRecordBatchStreamReader> reader(new CudaRecordBatchStreamReader());
+  RETURN_NOT_OK(reader->impl_->Open(stream, context, pool, staging_size));
+  *out = reader;
+  return Status::OK();
+}
+
+std::shared_ptr<Schema> CudaRecordBatchStreamReader::schema() const {
+  return impl_->schema();
+}
+
+Status CudaRecordBatchStreamReader::ReadNext(std::shared_ptr<RecordBatch>* batch) {
+  return impl_->ReadNext(batch);
+}
+
 }  // namespace gpu
 }  // namespace arrow
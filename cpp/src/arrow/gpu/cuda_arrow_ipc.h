@@ -22,6 +22,7 @@
 #include <memory>
 
 #include "arrow/buffer.h"
+#include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/util/visibility.h"
 
@@ -33,6 +34,12 @@ class MemoryPool;
 class RecordBatch;
 class Schema;
 
+namespace io {
+
+class InputStream;
+
+}  // namespace io
+
 namespace ipc {
 
 class Message;
@@ -71,6 +78,54 @@ Status ReadRecordBatch(const std::shared_ptr<Schema>& schema,
                        const std::shared_ptr<CudaBuffer>& buffer, MemoryPool* pool,
                        std::shared_ptr<RecordBatch>* out);
 
+class CudaMemoryPool;
+
+/// \class CudaRecordBatchStreamReader
+/// \brief Reads an IPC stream from host storage into device memory
+///
+/// The metadata of the messages is read and parsed on the host, while the body
+/// of each record batch is copied to the device through two pinned staging
+/// buffers: one is filled from the stream while the other is copied, so that no
+/// batch is staged whole on the host. The buffers of the record batches read
+/// are CudaBuffers. Dictionary-encoded fields are not supported
+class ARROW_EXPORT CudaRecordBatchStreamReader : public RecordBatchReader {
+ public:
+  /// The default size of each of the two staging buffers
+  static constexpr int64_t kDefaultStagingSize = 1 << 23;
+
+  ~CudaRecordBatchStreamReader() override;
+
+  /// \brief Read the schema of a stream, to read its record batches next
+  /// \param[in] stream the input stream, which must outlive the reader
+  /// \param[in] context the context of the device to read onto
+  /// \param[out] out the reader
+  /// \return Status
+  static Status Open(io::InputStream* stream, const std::shared_ptr<CudaContext>& context,
+                     std::shared_ptr<RecordBatchReader>* out);
+
+  /// \brief Read the schema of a stream, to read its record batches next
+  /// \param[in] stream the input stream, which must outlive the reader
+  /// \param[in] context the context of the device to read onto
+  /// \param[in] pool the pool to allocate the bodies from, or null to allocate
+  /// them from the context
+  /// \param[in] staging_size the size of each of the staging buffers
+  /// \param[out] out the reader
+  /// \return Status
+  static Status Open(io::InputStream* stream, const std::shared_ptr<CudaContext>& context,
+                     const std::shared_ptr<CudaMemoryPool>& pool, int64_t staging_size,
+                     std::shared_ptr<RecordBatchReader>* out);
+
+  std::shared_ptr<Schema> schema() const override;
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* batch) override;
+
+ private:
+  CudaRecordBatchStreamReader();
+
+  class CudaRecordBatchStreamReaderImpl;
+  std::unique_ptr<CudaRecordBatchStreamReaderImpl> impl_;
+};
+
 }  // namespace gpu
 }  // namespace arrow
 
@@ -26,6 +26,8 @@
 
 #include <cuda.h>
 
+#include "arrow/util/logging.h"
+
 #include "arrow/gpu/cuda_common.h"
 #include "arrow/gpu/cuda_memory.h"
 
@@ -83,6 +85,39 @@ class CudaContext::CudaContextImpl {
     return Status::OK();
   }
 
+  Status CopyHostToDeviceAsync(void* dst, const void* src, int64_t nbytes,
+                               CUstream stream) {
+    CU_RETURN_NOT_OK(cuCtxSetCurrent(context_));
+    CU_RETURN_NOT_OK(cuMemcpyHtoDAsync(reinterpret_cast<CUdeviceptr>(dst), src,
+                                       static_cast<size_t>(nbytes), stream));
+    return Status::OK();
+  }
+
+  Status CopyDeviceToHostAsync(void* dst, const void* src, int64_t nbytes,
+                               CUstream stream) {
+    CU_RETURN_NOT_OK(cuCtxSetCurrent(context_));
+    CU_RETURN_NOT_OK(cuMemcpyDtoHAsync(dst, reinterpret_cast<const CUdeviceptr>(src),
+                                       static_cast<size_t>(nbytes), stream));
+    return Status::OK();
+  }
+
+  Status CreateStream(CUstream* out) {
+    CU_RETURN_NOT_OK(cuCtxSetCurrent(context_));
+    CU_RETURN_NOT_OK(cuStreamCreate(out, CU_STREAM_NON_BLOCKING));
+    return Status::OK();
+  }
+
+  Status RecordEvent(CUstream stream, CUevent* out) {
+    CU_RETURN_NOT_OK(cuCtxSetCurrent(context_));
+    CU_RETURN_NOT_OK(cuEventCreate(out, CU_EVENT_DISABLE_TIMING));
+    CUresult result = cuEventRecord(*out, stream);
+    if (result != CUDA_SUCCESS) {
+      cuEventDestroy(*out);
+      CU_RETURN_NOT_OK(result);
+    }
+    return Status::OK();
+  }
+
   Status Free(void* device_ptr, int64_t nbytes) {
     CU_RETURN_NOT_OK(cuMemFree(reinterpret_cast<CUdeviceptr>(device_ptr)));
     bytes_allocated_ -= nbytes;
@@ -240,6 +275,33 @@ Status CudaContext::Allocate(int64_t nbytes, std::shared_ptr<CudaBuffer>* out) {
   return Status::OK();
 }
 
+Status CudaContext::ViewOrCopyTo(const std::shared_ptr<Buffer>& buffer,
+                                 std::shared_ptr<CudaBuffer>* out) {
+  std::shared_ptr<Buffer> host_buffer = buffer;
+  if (!buffer->is_cpu()) {
+    std::shared_ptr<CudaBuffer> device_buffer;
+    RETURN_NOT_OK(CudaBuffer::FromBuffer(buffer, &device_buffer));
+    if (device_buffer->context().get() == this) {
+      *out = std::move(device_buffer);
+      return Status::OK();
+    }
+    // Stage the copy from the other device in pinned host memory
+    std::shared_ptr<CudaHostBuffer> staging;
+    RETURN_NOT_OK(AllocateCudaHostBuffer(buffer->size(), &staging));
+    RETURN_NOT_OK(device_buffer->CopyToHost(0, buffer->size(), staging->mutable_data()));
+    host_buffer = staging;
+  }
+  std::shared_ptr<CudaBuffer> copy;
+  RETURN_NOT_OK(Allocate(host_buffer->size(), &copy));
+  RETURN_NOT_OK(copy->CopyFromHost(0, host_buffer->data(), host_buffer->size()));
+  *out = std::move(copy);
+  return Status::OK();
+}
+
+Status CudaContext::AllocateDeviceMemory(int64_t nbytes, uint8_t** out) {
+  return impl_->Allocate(nbytes, out);
+}
+
 Status CudaContext::ExportIpcBuffer(void* data,
                                     std::shared_ptr<CudaIpcMemHandle>* handle) {
   return impl_->ExportIpcBuffer(data, handle);
@@ -276,5 +338,77 @@ Status CudaContext::OpenIpcBuffer(const CudaIpcMemHandle& ipc_handle,
 
 int64_t CudaContext::bytes_allocated() const { return impl_->bytes_allocated(); }
 
+Status CudaContext::CreateStream(std::shared_ptr<CudaStream>* out) {
+  CUstream stream;
+  RETURN_NOT_OK(impl_->CreateStream(&stream));
+  *out = std::shared_ptr<CudaStream>(new CudaStream(this->shared_from_this(), stream));
+  return Status::OK();
+}
+
+Status CudaContext::CopyHostToDeviceAsync(void* dst, const void* src, int64_t nbytes,
+                                          CudaStream* stream) {
+  return impl_->CopyHostToDeviceAsync(dst, src, nbytes,
+                                      reinterpret_cast<CUstream>(stream->handle_));
+}
+
+Status CudaContext::CopyDeviceToHostAsync(void* dst, const void* src, int64_t nbytes,
+                                          CudaStream* stream) {
+  return impl_->CopyDeviceToHostAsync(dst, src, nbytes,
+                                      reinterpret_cast<CUstream>(stream->handle_));
+}
+
+// ----------------------------------------------------------------------
+// CudaStream and CudaEvent
+
+CudaStream::CudaStream(const std::shared_ptr<CudaContext>& context, void* handle)
+    : context_(context), handle_(handle) {}
+
+CudaStream::~CudaStream() {
+  // The work queued on the stream is still done
+  CUDA_DCHECK(cuStreamDestroy(reinterpret_cast<CUstream>(handle_)));
+}
+
+Status CudaStream::Synchronize() {
+  CU_RETURN_NOT_OK(cuStreamSynchronize(reinterpret_cast<CUstream>(handle_)));
+  return Status::OK();
+}
+
+Status CudaStream::RecordEvent(std::shared_ptr<CudaEvent>* out) {
+  CUevent event;
+  RETURN_NOT_OK(
+      context_->impl_->RecordEvent(reinterpret_cast<CUstream>(handle_), &event));
+  *out = std::shared_ptr<CudaEvent>(new CudaEvent(context_, event));
+  return Status::OK();
+}
+
+Status CudaStream::WaitEvent(const CudaEvent& event) {
+  CU_RETURN_NOT_OK(cuStreamWaitEvent(reinterpret_cast<CUstream>(handle_),
+                                     reinterpret_cast<CUevent>(event.handle_), 0));
+  return Status::OK();
+}
+
+CudaEvent::CudaEvent(const std::shared_ptr<CudaContext>& context, void* handle)
+    : context_(context), handle_(handle) {}
+
+CudaEvent::~CudaEvent() {
+  CUDA_DCHECK(cuEventDestroy(reinterpret_cast<CUevent>(handle_)));
+}
+
+Status CudaEvent::Wait() {
+  CU_RETURN_NOT_OK(cuEventSynchronize(reinterpret_cast<CUevent>(handle_)));
+  return Status::OK();
+}
+
+Status CudaEvent::IsComplete(bool* out) {
+  CUresult result = cuEventQuery(reinterpret_cast<CUevent>(handle_));
+  if (result == CUDA_ERROR_NOT_READY) {
+    *out = false;
+    return Status::OK();
+  }
+  CU_RETURN_NOT_OK(result);
+  *out = true;
+  return Status::OK();
+}
+
 }  // namespace gpu
 }  // namespace arrow
@@ -31,6 +31,8 @@ namespace gpu {
 
 // Forward declaration
 class CudaContext;
+class CudaMemoryPool;
+class CudaStream;
 
 class ARROW_EXPORT CudaDeviceManager {
  public:
@@ -62,6 +64,63 @@ class ARROW_EXPORT CudaDeviceManager {
 
 struct ARROW_EXPORT CudaDeviceInfo {};
 
+/// \class CudaEvent
+/// \brief A point in the work queued on a CUDA stream
+class ARROW_EXPORT CudaEvent {
+ public:
+  ~CudaEvent();
+
+  /// \brief Block until the work queued before the event is done
+  Status Wait();
+
+  /// \brief Tell whether the work queued before the event is done
+  /// \param[out] out whether it is done
+  /// \return Status
+  Status IsComplete(bool* out);
+
+ private:
+  CudaEvent(const std::shared_ptr<CudaContext>& context, void* handle);
+
+  std::shared_ptr<CudaContext> context_;
+  // The CUevent
+  void* handle_;
+
+  friend CudaStream;
+};
+
+/// \class CudaStream
+/// \brief A queue of work on a device, run in order and asynchronously with
+/// the host and with the other streams
+class ARROW_EXPORT CudaStream {
+ public:
+  ~CudaStream();
+
+  /// \brief Block until the work queued on the stream is done
+  Status Synchronize();
+
+  /// \brief Record an event after the work queued so far on the stream
+  /// \param[out] out the event
+  /// \return Status
+  Status RecordEvent(std::shared_ptr<CudaEvent>* out);
+
+  /// \brief Make the work queued from now on the stream wait for an event,
+  /// for example one recorded on another stream
+  /// \param[in] event the event to wait for
+  /// \return Status
+  Status WaitEvent(const CudaEvent& event);
+
+  std::shared_ptr<CudaContext> context() const { return context_; }
+
+ private:
+  CudaStream(const std::shared_ptr<CudaContext>& context, void* handle);
+
+  std::shared_ptr<CudaContext> context_;
+  // The CUstream
+  void* handle_;
+
+  friend CudaContext;
+};
+
 /// \class CudaContext
 /// \brief Friendlier interface to the CUDA driver API
 class ARROW_EXPORT CudaContext : public std::enable_shared_from_this<CudaContext> {
@@ -76,6 +135,23 @@ class ARROW_EXPORT CudaContext : public std::enable_shared_from_this<CudaContext
   /// \return Status
   Status Allocate(int64_t nbytes, std::shared_ptr<CudaBuffer>* out);
 
+  /// \brief Return the buffer itself if it is device memory of this context,
+  /// else a copy of it on the device of this context
+  ///
+  /// Host buffers of any memory type are copied to the device, as are
+  /// buffers of other contexts, through host memory.
+  ///
+  /// \param[in] buffer the buffer, or a slice of one
+  /// \param[out] out the buffer or its copy
+  /// \return Status
+  Status ViewOrCopyTo(const std::shared_ptr<Buffer>& buffer,
+                      std::shared_ptr<CudaBuffer>* out);
+
+  /// \brief Create a stream to queue asynchronous copies and kernels on
+  /// \param[out] out the stream
+  /// \return Status
+  Status CreateStream(std::shared_ptr<CudaStream>* out);
+
   /// \brief Open existing CUDA IPC memory handle
   /// \param[in] ipc_handle opaque pointer to CUipcMemHandle (driver API)
   /// \param[out] buffer a CudaBuffer referencing
@@ -88,9 +164,14 @@ class ARROW_EXPORT CudaContext : public std::enable_shared_from_this<CudaContext
  private:
   CudaContext();
 
+  Status AllocateDeviceMemory(int64_t nbytes, uint8_t** out);
   Status ExportIpcBuffer(void* data, std::shared_ptr<CudaIpcMemHandle>* handle);
   Status CopyHostToDevice(void* dst, const void* src, int64_t nbytes);
   Status CopyDeviceToHost(void* dst, const void* src, int64_t nbytes);
+  Status CopyHostToDeviceAsync(void* dst, const void* src, int64_t nbytes,
+                               CudaStream* stream);
+  Status CopyDeviceToHostAsync(void* dst, const void* src, int64_t nbytes,
+                               CudaStream* stream);
   Status Free(void* device_ptr, int64_t nbytes);
 
   class CudaContextImpl;
@@ -98,7 +179,9 @@ class ARROW_EXPORT CudaContext : public std::enable_shared_from_this<CudaContext
 
   friend CudaBuffer;
   friend CudaBufferReader;
+  friend CudaMemoryPool;
   friend CudaBufferWriter;
+  friend CudaStream;
   friend CudaDeviceManager::CudaDeviceManagerImpl;
 };
 
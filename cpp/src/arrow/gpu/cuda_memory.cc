@@ -75,7 +75,10 @@ const void* CudaIpcMemHandle::handle() const { return &impl_->ipc_handle; }
 CudaBuffer::CudaBuffer(uint8_t* data, int64_t size,
                        const std::shared_ptr<CudaContext>& context, bool own_data,
                        bool is_ipc)
-    : Buffer(data, size), context_(context), own_data_(own_data), is_ipc_(is_ipc) {
+    : Buffer(data, size, MemoryType::CUDA_DEVICE),
+      context_(context),
+      own_data_(own_data),
+      is_ipc_(is_ipc) {
   is_mutable_ = true;
   mutable_data_ = data;
 }
@@ -138,6 +141,23 @@ Status CudaBuffer::CopyFromHost(const int64_t position, const void* data,
   return context_->CopyHostToDevice(mutable_data_ + position, data, nbytes);
 }
 
+Status CudaBuffer::CopyToHostAsync(const int64_t position, const int64_t nbytes,
+                                   void* out, CudaStream* stream,
+                                   std::shared_ptr<CudaEvent>* event) const {
+  DCHECK_LE(nbytes, size_ - position) << "Copy would overflow buffer";
+  RETURN_NOT_OK(context_->CopyDeviceToHostAsync(out, data_ + position, nbytes, stream));
+  return stream->RecordEvent(event);
+}
+
+Status CudaBuffer::CopyFromHostAsync(const int64_t position, const void* data,
+                                     int64_t nbytes, CudaStream* stream,
+                                     std::shared_ptr<CudaEvent>* event) {
+  DCHECK_LE(nbytes, size_ - position) << "Copy would overflow buffer";
+  RETURN_NOT_OK(
+      context_->CopyHostToDeviceAsync(mutable_data_ + position, data, nbytes, stream));
+  return stream->RecordEvent(event);
+}
+
 Status CudaBuffer::ExportForIpc(std::shared_ptr<CudaIpcMemHandle>* handle) {
   if (is_ipc_) {
     return Status::Invalid("Buffer has already been exported for IPC");
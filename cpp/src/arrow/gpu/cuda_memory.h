@@ -30,7 +30,9 @@ namespace arrow {
 namespace gpu {
 
 class CudaContext;
+class CudaEvent;
 class CudaIpcMemHandle;
+class CudaStream;
 
 /// \class CudaBuffer
 /// \brief An Arrow buffer located on a GPU device
@@ -58,7 +60,8 @@ class ARROW_EXPORT CudaBuffer : public Buffer {
   /// \brief Copy memory from GPU device to CPU host
   /// \param[out] out a pre-allocated output buffer
   /// \return Status
-  Status CopyToHost(const int64_t position, const int64_t nbytes, void* out) const;
+  Status CopyToHost(const int64_t position, const int64_t nbytes,
+                    void* out) const override;
 
   /// \brief Copy memory to device at position
   /// \param[in] position start position to copy bytes
@@ -67,6 +70,33 @@ class ARROW_EXPORT CudaBuffer : public Buffer {
   /// \return Status
   Status CopyFromHost(const int64_t position, const void* data, int64_t nbytes);
 
+  /// \brief Queue a copy of device memory to the host on a stream
+  /// \param[in] position start position in the buffer
+  /// \param[in] nbytes number of bytes to copy
+  /// \param[out] out host memory to copy into
+  /// \param[in] stream the stream to queue the copy on
+  /// \param[out] event an event recorded after the copy
+  /// \return Status
+  ///
+  /// \note The copy only runs asynchronously with the host if the host memory
+  /// is pinned, as that of a CudaHostBuffer. Both the buffer and the host
+  /// memory must be kept until the event is complete
+  Status CopyToHostAsync(const int64_t position, const int64_t nbytes, void* out,
+                         CudaStream* stream, std::shared_ptr<CudaEvent>* event) const;
+
+  /// \brief Queue a copy of host memory to the device on a stream
+  /// \param[in] position start position to copy bytes
+  /// \param[in] data the host data to copy
+  /// \param[in] nbytes number of bytes to copy
+  /// \param[in] stream the stream to queue the copy on
+  /// \param[out] event an event recorded after the copy
+  /// \return Status
+  ///
+  /// \note As for CopyToHostAsync, the host memory should be pinned, and both
+  /// it and the buffer be kept until the event is complete
+  Status CopyFromHostAsync(const int64_t position, const void* data, int64_t nbytes,
+                           CudaStream* stream, std::shared_ptr<CudaEvent>* event);
+
   /// \brief Expose this device buffer as IPC memory which can be used in other processes
   /// \param[out] handle the exported IPC handle
   /// \return Status
@@ -89,7 +119,8 @@ class ARROW_EXPORT CudaBuffer : public Buffer {
 /// \brief Device-accessible CPU memory created using cudaHostAlloc
 class ARROW_EXPORT CudaHostBuffer : public MutableBuffer {
  public:
-  using MutableBuffer::MutableBuffer;
+  CudaHostBuffer(uint8_t* data, const int64_t size)
+      : MutableBuffer(data, size, MemoryType::PINNED_HOST) {}
   ~CudaHostBuffer();
 };
 
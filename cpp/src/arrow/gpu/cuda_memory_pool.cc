@@ -0,0 +1,224 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/gpu/cuda_memory_pool.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/logging.h"
+
+#include "arrow/gpu/cuda_context.h"
+
+namespace arrow {
+namespace gpu {
+
+constexpr int64_t CudaMemoryPool::kMinBinSize;
+constexpr int64_t CudaMemoryPool::kMaxBinSize;
+
+class CudaMemoryPool::CudaMemoryPoolImpl
+    : public std::enable_shared_from_this<CudaMemoryPoolImpl> {
+ public:
+  CudaMemoryPoolImpl(const std::shared_ptr<CudaContext>& context,
+                     int64_t max_cached_bytes)
+      : context_(context), max_cached_bytes_(max_cached_bytes), closed_(false) {
+    stats_ = CudaMemoryPoolStats{0, 0, 0, 0, 0, 0, 0};
+    for (int64_t size = kMinBinSize; size <= kMaxBinSize; size *= 2) {
+      bins_.emplace_back();
+    }
+  }
+
+  ~CudaMemoryPoolImpl() { DCHECK(ReleaseCached().ok()); }
+
+  /// A buffer whose memory goes back to the pool when it is destroyed
+  class PoolBuffer : public CudaBuffer {
+   public:
+    PoolBuffer(uint8_t* data, int64_t size, int64_t capacity,
+               const std::shared_ptr<CudaContext>& context,
+               const std::shared_ptr<CudaMemoryPoolImpl>& pool)
+        : CudaBuffer(data, size, context), capacity_(capacity), pool_(pool) {}
+
+    ~PoolBuffer() {
+      if (pool_) {
+        DCHECK(pool_->Release(mutable_data_, capacity_).ok());
+      }
+    }
+
+    // Exported memory may be opened by other processes at any time, so it is
+    // not reused, and like that of other exported buffers, never freed
+    Status ExportForIpc(std::shared_ptr<CudaIpcMemHandle>* handle) override {
+      RETURN_NOT_OK(CudaBuffer::ExportForIpc(handle));
+      pool_->Detach(capacity_);
+      pool_.reset();
+      return Status::OK();
+    }
+
+   private:
+    int64_t capacity_;
+    std::shared_ptr<CudaMemoryPoolImpl> pool_;
+  };
+
+  Status Allocate(int64_t nbytes, std::shared_ptr<CudaBuffer>* out) {
+    const int bin = GetBin(nbytes);
+    const int64_t capacity = bin < 0 ? std::max<int64_t>(nbytes, 1) : BinSize(bin);
+    uint8_t* data = nullptr;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stats_.num_allocations++;
+      if (bin >= 0 && !bins_[bin].empty()) {
+        data = bins_[bin].back();
+        bins_[bin].pop_back();
+        stats_.bytes_cached -= capacity;
+        stats_.num_cache_hits++;
+      }
+    }
+    const bool cache_hit = data != nullptr;
+    if (!cache_hit) {
+      Status s = context_->AllocateDeviceMemory(capacity, &data);
+      if (!s.ok()) {
+        // The device may have run out of memory because of the memory
+        // cached, which is freed before trying again
+        RETURN_NOT_OK(ReleaseCached());
+        RETURN_NOT_OK(context_->AllocateDeviceMemory(capacity, &data));
+      }
+    }
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!cache_hit) {
+        stats_.num_device_allocations++;
+      }
+      stats_.bytes_allocated += capacity;
+      stats_.max_memory = std::max(stats_.max_memory, stats_.bytes_allocated);
+    }
+    *out = std::make_shared<PoolBuffer>(data, nbytes, capacity, context_,
+                                        shared_from_this());
+    return Status::OK();
+  }
+
+  Status Release(uint8_t* data, int64_t capacity) {
+    const int bin = GetBin(capacity);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stats_.bytes_allocated -= capacity;
+      if (bin >= 0 && !closed_ && stats_.bytes_cached + capacity <= max_cached_bytes_) {
+        bins_[bin].push_back(data);
+        stats_.bytes_cached += capacity;
+        return Status::OK();
+      }
+      stats_.num_device_frees++;
+    }
+    return context_->Free(data, capacity);
+  }
+
+  void Detach(int64_t capacity) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stats_.bytes_allocated -= capacity;
+  }
+
+  Status ReleaseCached() {
+    std::vector<std::pair<uint8_t*, int64_t>> cached;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      for (size_t bin = 0; bin < bins_.size(); ++bin) {
+        for (uint8_t* data : bins_[bin]) {
+          cached.emplace_back(data, BinSize(static_cast<int>(bin)));
+        }
+        bins_[bin].clear();
+      }
+      stats_.bytes_cached = 0;
+      stats_.num_device_frees += static_cast<int64_t>(cached.size());
+    }
+    for (const auto& memory : cached) {
+      RETURN_NOT_OK(context_->Free(memory.first, memory.second));
+    }
+    return Status::OK();
+  }
+
+  Status Close() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      closed_ = true;
+    }
+    return ReleaseCached();
+  }
+
+  CudaMemoryPoolStats stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+  }
+
+ private:
+  // The bin of an allocation, or -1 if it is too large for any
+  static int GetBin(int64_t nbytes) {
+    if (nbytes > kMaxBinSize) {
+      return -1;
+    }
+    int bin = 0;
+    while (BinSize(bin) < nbytes) {
+      ++bin;
+    }
+    return bin;
+  }
+
+  static int64_t BinSize(int bin) { return kMinBinSize << bin; }
+
+  std::shared_ptr<CudaContext> context_;
+  int64_t max_cached_bytes_;
+  mutable std::mutex mutex_;
+  // Whether the pool was destroyed, after which no memory is cached
+  bool closed_;
+  // The cached memory of each bin
+  std::vector<std::vector<uint8_t*>> bins_;
+  CudaMemoryPoolStats stats_;
+};
+
+CudaMemoryPool::CudaMemoryPool() {}
+
+CudaMemoryPool::~CudaMemoryPool() { DCHECK(impl_->Close().ok()); }
+
+Status CudaMemoryPool::Make(const std::shared_ptr<CudaContext>& context,
+                            int64_t max_cached_bytes,
+                            std::shared_ptr<CudaMemoryPool>* out) {
+  if (max_cached_bytes < 0) {
+    return Status::Invalid("The memory cached cannot be negative");
+  }
+  std::shared_ptr<CudaMemoryPool> pool(new CudaMemoryPool());
+  pool->impl_ = std::make_shared<CudaMemoryPoolImpl>(context, max_cached_bytes);
+  *out = pool;
+  return Status::OK();
+}
+
+Status CudaMemoryPool::Allocate(int64_t nbytes, std::shared_ptr<CudaBuffer>* out) {
+  return impl_->Allocate(nbytes, out);
+}
+
+Status CudaMemoryPool::ReleaseCached() { return impl_->ReleaseCached(); }
+
+int64_t CudaMemoryPool::bytes_allocated() const {
+  return impl_->stats().bytes_allocated;
+}
+
+int64_t CudaMemoryPool::max_memory() const { return impl_->stats().max_memory; }
+
+CudaMemoryPoolStats CudaMemoryPool::stats() const { return impl_->stats(); }
+
+}  // namespace gpu
+}  // namespace arrow
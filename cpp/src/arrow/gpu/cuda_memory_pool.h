@@ -0,0 +1,109 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_GPU_CUDA_MEMORY_POOL_H
+#define ARROW_GPU_CUDA_MEMORY_POOL_H
+
+#include <cstdint>
+#include <memory>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+#include "arrow/gpu/cuda_memory.h"
+
+namespace arrow {
+namespace gpu {
+
+class CudaContext;
+
+/// \brief Statistics of a CudaMemoryPool
+struct ARROW_EXPORT CudaMemoryPoolStats {
+  /// The bytes held by the buffers of the pool, as rounded up to their bins
+  int64_t bytes_allocated;
+  /// The peak of bytes_allocated
+  int64_t max_memory;
+  /// The bytes of device memory kept for reuse, not held by any buffer
+  int64_t bytes_cached;
+  /// The number of buffers allocated
+  int64_t num_allocations;
+  /// The number of buffers allocated from cached memory
+  int64_t num_cache_hits;
+  /// The number of calls to cuMemAlloc
+  int64_t num_device_allocations;
+  /// The number of calls to cuMemFree
+  int64_t num_device_frees;
+};
+
+/// \class CudaMemoryPool
+/// \brief A caching allocator of the device memory of a context
+///
+/// cuMemAlloc and cuMemFree synchronize the device, so the memory of the
+/// buffers allocated from the pool is kept when they are destroyed, and reused
+/// for the next buffers of the same bin. The bins are the powers of two from
+/// kMinBinSize to kMaxBinSize; larger buffers are allocated on their own and
+/// freed with them. The memory of a buffer may be reused as soon as the buffer
+/// is destroyed, so it must outlive the asynchronous copies to and from it.
+///
+/// The pool may be destroyed before its buffers, whose memory is then freed
+/// with them.
+class ARROW_EXPORT CudaMemoryPool {
+ public:
+  static constexpr int64_t kMinBinSize = 512;
+  static constexpr int64_t kMaxBinSize = 256LL << 20;
+
+  /// \brief Create a pool which keeps up to max_cached_bytes of memory
+  /// \param[in] context the context to allocate device memory in
+  /// \param[in] max_cached_bytes the most memory kept for reuse
+  /// \param[out] out the pool
+  /// \return Status
+  static Status Make(const std::shared_ptr<CudaContext>& context,
+                     int64_t max_cached_bytes, std::shared_ptr<CudaMemoryPool>* out);
+
+  ~CudaMemoryPool();
+
+  /// \brief Allocate a buffer, from cached memory if there is some in its bin
+  /// \param[in] nbytes number of bytes
+  /// \param[out] out the allocated buffer
+  /// \return Status
+  ///
+  /// \note If the device is out of memory, the cached memory is freed and the
+  /// allocation retried
+  Status Allocate(int64_t nbytes, std::shared_ptr<CudaBuffer>* out);
+
+  /// \brief Free all of the memory that is kept for reuse
+  Status ReleaseCached();
+
+  /// \brief The bytes held by the buffers of the pool
+  int64_t bytes_allocated() const;
+
+  /// \brief The peak of bytes_allocated
+  int64_t max_memory() const;
+
+  CudaMemoryPoolStats stats() const;
+
+ private:
+  CudaMemoryPool();
+
+  class CudaMemoryPoolImpl;
+  std::shared_ptr<CudaMemoryPoolImpl> impl_;
+};
+
+}  // namespace gpu
+}  // namespace arrow
+
+#endif  // ARROW_GPU_CUDA_MEMORY_POOL_H
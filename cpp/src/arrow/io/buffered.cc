@@ -16,14 +16,18 @@
 // under the License.
 
 #include "arrow/io/buffered.h"
+#include "arrow/buffer.h"
+#include "arrow/memory_pool.h"
 #include "arrow/status.h"
 #include "arrow/util/logging.h"
 
+#include <algorithm>
 #include <cstring>
 #include <memory>
 #include <mutex>
 #include <string>
 #include <utility>
+#include <vector>
 
 namespace arrow {
 namespace io {
@@ -86,6 +90,33 @@ class BufferedOutputStream::Impl {
     return Status::OK();
   }
 
+  Status Writev(const std::vector<std::shared_ptr<Buffer>>& buffers) {
+    std::lock_guard<std::mutex> guard(lock_);
+    int64_t nbytes = 0;
+    for (const auto& buffer : buffers) {
+      nbytes += buffer->size();
+    }
+    if (nbytes + buffer_pos_ < BUFFER_SIZE) {
+      for (const auto& buffer : buffers) {
+        std::memcpy(buffer_data_ + buffer_pos_, buffer->data(), buffer->size());
+        buffer_pos_ += buffer->size();
+      }
+      return Status::OK();
+    }
+    // Hand the buffered bytes and the buffers to the raw stream at once
+    std::vector<std::shared_ptr<Buffer>> gathered;
+    gathered.reserve(buffers.size() + 1);
+    if (buffer_pos_ > 0) {
+      gathered.push_back(std::make_shared<Buffer>(
+          reinterpret_cast<const uint8_t*>(buffer_data_), buffer_pos_));
+    }
+    gathered.insert(gathered.end(), buffers.begin(), buffers.end());
+    raw_pos_ = -1;
+    RETURN_NOT_OK(raw_->Writev(gathered));
+    buffer_pos_ = 0;
+    return Status::OK();
+  }
+
   Status FlushUnlocked() {
     if (buffer_pos_ > 0) {
       // Invalidate cached raw pos
@@ -131,9 +162,211 @@ Status BufferedOutputStream::Write(const void* data, int64_t nbytes) {
   return impl_->Write(data, nbytes);
 }
 
+Status BufferedOutputStream::Writev(const std::vector<std::shared_ptr<Buffer>>& buffers) {
+  return impl_->Writev(buffers);
+}
+
 Status BufferedOutputStream::Flush() { return impl_->Flush(); }
 
 std::shared_ptr<OutputStream> BufferedOutputStream::raw() const { return impl_->raw(); }
 
+// ----------------------------------------------------------------------
+// BufferedInputStream implementation
+
+class BufferedInputStream::Impl {
+ public:
+  Impl(std::shared_ptr<InputStream> raw, int64_t buffer_size, MemoryPool* pool)
+      : raw_(std::move(raw)),
+        buffer_size_(buffer_size),
+        pool_(pool),
+        buffer_start_(0),
+        buffer_end_(0) {}
+
+  Status Init() { return AllocateBuffer(pool_, buffer_size_, &buffer_); }
+
+  Status Close() {
+    std::lock_guard<std::mutex> guard(lock_);
+    return raw_->Close();
+  }
+
+  Status Tell(int64_t* position) const {
+    std::lock_guard<std::mutex> guard(lock_);
+    int64_t raw_position;
+    RETURN_NOT_OK(raw_->Tell(&raw_position));
+    *position = raw_position - bytes_buffered_unlocked();
+    return Status::OK();
+  }
+
+  Status Read(int64_t nbytes, int64_t* bytes_read, void* out) {
+    std::lock_guard<std::mutex> guard(lock_);
+    return ReadUnlocked(nbytes, bytes_read, static_cast<uint8_t*>(out));
+  }
+
+  Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) {
+    std::lock_guard<std::mutex> guard(lock_);
+    if (nbytes < 0) {
+      return Status::Invalid("read count should be >= 0");
+    }
+    if (nbytes <= buffer_size_) {
+      // Zero-copy from the buffer
+      RETURN_NOT_OK(FillBufferUnlocked(nbytes));
+      const int64_t length = std::min(nbytes, bytes_buffered_unlocked());
+      *out = SliceBuffer(buffer_, buffer_start_, length);
+      buffer_start_ += length;
+      return Status::OK();
+    }
+    std::shared_ptr<ResizableBuffer> buffer;
+    RETURN_NOT_OK(AllocateResizableBuffer(pool_, nbytes, &buffer));
+    int64_t bytes_read;
+    RETURN_NOT_OK(ReadUnlocked(nbytes, &bytes_read, buffer->mutable_data()));
+    if (bytes_read < nbytes) {
+      RETURN_NOT_OK(buffer->Resize(bytes_read));
+    }
+    *out = std::move(buffer);
+    return Status::OK();
+  }
+
+  Status Peek(int64_t nbytes, std::shared_ptr<Buffer>* out) {
+    std::lock_guard<std::mutex> guard(lock_);
+    if (nbytes < 0) {
+      return Status::Invalid("peek count should be >= 0");
+    }
+    nbytes = std::min(nbytes, buffer_size_);
+    RETURN_NOT_OK(FillBufferUnlocked(nbytes));
+    *out = SliceBuffer(buffer_, buffer_start_,
+                       std::min(nbytes, bytes_buffered_unlocked()));
+    return Status::OK();
+  }
+
+  int64_t bytes_buffered() const {
+    std::lock_guard<std::mutex> guard(lock_);
+    return bytes_buffered_unlocked();
+  }
+
+  int64_t buffer_size() const { return buffer_size_; }
+
+  std::shared_ptr<InputStream> raw() const { return raw_; }
+
+ private:
+  int64_t bytes_buffered_unlocked() const { return buffer_end_ - buffer_start_; }
+
+  Status ReadUnlocked(int64_t nbytes, int64_t* bytes_read, uint8_t* out) {
+    if (nbytes < 0) {
+      return Status::Invalid("read count should be >= 0");
+    }
+    int64_t total = 0;
+    while (total < nbytes) {
+      if (bytes_buffered_unlocked() == 0) {
+        if (nbytes - total >= buffer_size_) {
+          // Direct read, the buffer would only add a copy
+          int64_t raw_bytes_read;
+          RETURN_NOT_OK(raw_->Read(nbytes - total, &raw_bytes_read, out + total));
+          total += raw_bytes_read;
+          break;
+        }
+        RETURN_NOT_OK(FillBufferUnlocked(1));
+        if (bytes_buffered_unlocked() == 0) {
+          // End of stream
+          break;
+        }
+      }
+      const int64_t length = std::min(nbytes - total, bytes_buffered_unlocked());
+      std::memcpy(out + total, buffer_->data() + buffer_start_, length);
+      buffer_start_ += length;
+      total += length;
+    }
+    *bytes_read = total;
+    return Status::OK();
+  }
+
+  // Read from the raw stream until at least nbytes are buffered, or the
+  // stream ends, first moving the unread bytes to the start of the buffer
+  Status FillBufferUnlocked(int64_t nbytes) {
+    DCHECK_LE(nbytes, buffer_size_);
+    if (bytes_buffered_unlocked() >= nbytes) {
+      return Status::OK();
+    }
+    const int64_t unread = bytes_buffered_unlocked();
+    if (buffer_.use_count() > 1) {
+      // Slices of the buffer were returned and are still in use
+      std::shared_ptr<Buffer> buffer;
+      RETURN_NOT_OK(AllocateBuffer(pool_, buffer_size_, &buffer));
+      std::memcpy(buffer->mutable_data(), buffer_->data() + buffer_start_, unread);
+      buffer_ = std::move(buffer);
+    } else if (buffer_start_ > 0) {
+      std::memmove(buffer_->mutable_data(), buffer_->data() + buffer_start_, unread);
+    }
+    buffer_start_ = 0;
+    buffer_end_ = unread;
+    while (buffer_end_ < nbytes) {
+      int64_t bytes_read;
+      RETURN_NOT_OK(raw_->Read(buffer_size_ - buffer_end_, &bytes_read,
+                               buffer_->mutable_data() + buffer_end_));
+      if (bytes_read == 0) {
+        break;
+      }
+      buffer_end_ += bytes_read;
+    }
+    return Status::OK();
+  }
+
+  std::shared_ptr<InputStream> raw_;
+  const int64_t buffer_size_;
+  MemoryPool* pool_;
+  std::shared_ptr<Buffer> buffer_;
+  // The unread bytes of the buffer
+  int64_t buffer_start_;
+  int64_t buffer_end_;
+  mutable std::mutex lock_;
+};
+
+constexpr int64_t BufferedInputStream::kDefaultBufferSize;
+
+BufferedInputStream::BufferedInputStream(std::unique_ptr<Impl> impl)
+    : impl_(std::move(impl)) {}
+
+BufferedInputStream::~BufferedInputStream() {}
+
+Status BufferedInputStream::Create(std::shared_ptr<InputStream> raw, int64_t buffer_size,
+                                   MemoryPool* pool,
+                                   std::shared_ptr<BufferedInputStream>* out) {
+  if (buffer_size <= 0) {
+    return Status::Invalid("buffer size should be > 0");
+  }
+  std::unique_ptr<Impl> impl(new Impl(std::move(raw), buffer_size, pool));
+  RETURN_NOT_OK(impl->Init());
+  *out = std::shared_ptr<BufferedInputStream>(new BufferedInputStream(std::move(impl)));
+  return Status::OK();
+}
+
+Status BufferedInputStream::Create(std::shared_ptr<InputStream> raw,
+                                   std::shared_ptr<BufferedInputStream>* out) {
+  return Create(std::move(raw), kDefaultBufferSize, default_memory_pool(), out);
+}
+
+Status BufferedInputStream::Close() { return impl_->Close(); }
+
+Status BufferedInputStream::Tell(int64_t* position) const {
+  return impl_->Tell(position);
+}
+
+Status BufferedInputStream::Read(int64_t nbytes, int64_t* bytes_read, void* out) {
+  return impl_->Read(nbytes, bytes_read, out);
+}
+
+Status BufferedInputStream::Read(int64_t nbytes, std::shared_ptr<Buffer>* out) {
+  return impl_->Read(nbytes, out);
+}
+
+Status BufferedInputStream::Peek(int64_t nbytes, std::shared_ptr<Buffer>* out) {
+  return impl_->Peek(nbytes, out);
+}
+
+int64_t BufferedInputStream::bytes_buffered() const { return impl_->bytes_buffered(); }
+
+int64_t BufferedInputStream::buffer_size() const { return impl_->buffer_size(); }
+
+std::shared_ptr<InputStream> BufferedInputStream::raw() const { return impl_->raw(); }
+
 }  // namespace io
 }  // namespace arrow
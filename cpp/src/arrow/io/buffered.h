@@ -22,12 +22,15 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "arrow/io/interfaces.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
 
+class Buffer;
+class MemoryPool;
 class Status;
 
 namespace io {
@@ -49,6 +52,10 @@ class ARROW_EXPORT BufferedOutputStream : public OutputStream {
   // Write bytes to the stream. Thread-safe
   Status Write(const void* data, int64_t nbytes) override;
 
+  // Copy small writes in, else write the buffered bytes and the buffers to
+  // the raw stream with a single Writev. Thread-safe
+  Status Writev(const std::vector<std::shared_ptr<Buffer>>& buffers) override;
+
   Status Flush() override;
 
   /// \brief Return the underlying raw output stream.
@@ -59,6 +66,72 @@ class ARROW_EXPORT BufferedOutputStream : public OutputStream {
   std::unique_ptr<Impl> impl_;
 };
 
+/// \class BufferedInputStream
+/// \brief An input stream reading from another in chunks of a fixed size
+///
+/// Small reads, as of the metadata of IPC messages, are then served from
+/// memory rather than each being a call into the raw stream.  Reads that fit
+/// in the buffer return a slice of it, so without copying; the buffer is
+/// only reused for the next chunk once no such slice remains alive, and
+/// reads larger than it go straight to the raw stream.
+class ARROW_EXPORT BufferedInputStream : public InputStream {
+ public:
+  static constexpr int64_t kDefaultBufferSize = 64 * 1024;
+
+  ~BufferedInputStream() override;
+
+  /// \brief Create a buffered input stream wrapping the given input stream
+  ///
+  /// \param[in] raw the stream to read from
+  /// \param[in] buffer_size the size of the chunks read from the raw stream
+  /// \param[in] pool the pool to allocate the buffer from
+  /// \param[out] out the buffered input stream
+  /// \return Status
+  static Status Create(std::shared_ptr<InputStream> raw, int64_t buffer_size,
+                       MemoryPool* pool, std::shared_ptr<BufferedInputStream>* out);
+
+  /// \brief Create a buffered input stream of the default buffer size,
+  /// allocated from the default memory pool
+  static Status Create(std::shared_ptr<InputStream> raw,
+                       std::shared_ptr<BufferedInputStream>* out);
+
+  // InputStream interface
+
+  /// \brief Close the buffered input stream.  This implicitly closes the
+  /// underlying raw input stream.
+  Status Close() override;
+
+  Status Tell(int64_t* position) const override;
+
+  Status Read(int64_t nbytes, int64_t* bytes_read, void* out) override;
+
+  /// \brief Read nbytes, without copying them if they fit in the buffer
+  Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) override;
+
+  /// \brief Return the next bytes of the stream without consuming them
+  ///
+  /// \param[in] nbytes the number of bytes to return, at most the buffer size
+  /// \param[out] out a slice of the buffer, shorter at the end of the stream
+  /// \return Status
+  Status Peek(int64_t nbytes, std::shared_ptr<Buffer>* out);
+
+  /// \brief The number of bytes read from the raw stream and not yet
+  /// consumed
+  int64_t bytes_buffered() const;
+
+  int64_t buffer_size() const;
+
+  /// \brief Return the underlying raw input stream.
+  std::shared_ptr<InputStream> raw() const;
+
+ private:
+  class ARROW_NO_EXPORT Impl;
+
+  explicit BufferedInputStream(std::unique_ptr<Impl> impl);
+
+  std::unique_ptr<Impl> impl_;
+};
+
 }  // namespace io
 }  // namespace arrow
 
@@ -0,0 +1,171 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/io/cached.h"
+
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "arrow/status.h"
+
+namespace arrow {
+namespace io {
+
+class CachedFileSystem::Impl {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  Impl(const std::shared_ptr<FileSystem>& fs, double ttl_seconds)
+      : fs_(fs),
+        ttl_(std::chrono::duration_cast<Clock::duration>(
+            std::chrono::duration<double>(ttl_seconds))),
+        num_hits_(0),
+        num_misses_(0) {}
+
+  FileSystem* fs() const { return fs_.get(); }
+
+  Status GetChildren(const std::string& path, std::vector<std::string>* listing) {
+    return Get(&children_, path, listing,
+               [this, &path](std::vector<std::string>* out) {
+                 return fs_->GetChildren(path, out);
+               });
+  }
+
+  Status Stat(const std::string& path, FileStatistics* stat) {
+    return Get(&stats_, path, stat, [this, &path](FileStatistics* out) {
+      return fs_->Stat(path, out);
+    });
+  }
+
+  void Invalidate() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    children_.clear();
+    stats_.clear();
+  }
+
+  int64_t num_hits() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return num_hits_;
+  }
+
+  int64_t num_misses() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return num_misses_;
+  }
+
+ private:
+  template <typename T>
+  struct Entry {
+    T value;
+    Clock::time_point expiry;
+  };
+
+  template <typename T>
+  using EntryMap = std::unordered_map<std::string, Entry<T>>;
+
+  // Answer from an unexpired entry, or fetch the value without holding the
+  // lock and keep it
+  template <typename T, typename Fetch>
+  Status Get(EntryMap<T>* entries, const std::string& path, T* out, Fetch&& fetch) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = entries->find(path);
+      if (it != entries->end()) {
+        if (Clock::now() < it->second.expiry) {
+          ++num_hits_;
+          *out = it->second.value;
+          return Status::OK();
+        }
+        entries->erase(it);
+      }
+      ++num_misses_;
+    }
+    // Fetch into a value of our own, as listings are appended to
+    T value{};
+    RETURN_NOT_OK(fetch(&value));
+    const Clock::time_point expiry = Clock::now() + ttl_;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      (*entries)[path] = Entry<T>{value, expiry};
+    }
+    *out = std::move(value);
+    return Status::OK();
+  }
+
+  std::shared_ptr<FileSystem> fs_;
+  Clock::duration ttl_;
+
+  mutable std::mutex mutex_;
+  EntryMap<std::vector<std::string>> children_;
+  EntryMap<FileStatistics> stats_;
+  int64_t num_hits_;
+  int64_t num_misses_;
+};
+
+CachedFileSystem::CachedFileSystem(const std::shared_ptr<FileSystem>& fs,
+                                   double ttl_seconds)
+    : impl_(new Impl(fs, ttl_seconds)) {}
+
+CachedFileSystem::~CachedFileSystem() {}
+
+Status CachedFileSystem::MakeDirectory(const std::string& path) {
+  Status st = impl_->fs()->MakeDirectory(path);
+  impl_->Invalidate();
+  return st;
+}
+
+Status CachedFileSystem::DeleteDirectory(const std::string& path) {
+  Status st = impl_->fs()->DeleteDirectory(path);
+  impl_->Invalidate();
+  return st;
+}
+
+Status CachedFileSystem::GetChildren(const std::string& path,
+                                     std::vector<std::string>* listing) {
+  std::vector<std::string> children;
+  RETURN_NOT_OK(impl_->GetChildren(path, &children));
+  listing->insert(listing->end(), children.begin(), children.end());
+  return Status::OK();
+}
+
+Status CachedFileSystem::Rename(const std::string& src, const std::string& dst) {
+  Status st = impl_->fs()->Rename(src, dst);
+  impl_->Invalidate();
+  return st;
+}
+
+Status CachedFileSystem::Stat(const std::string& path, FileStatistics* stat) {
+  return impl_->Stat(path, stat);
+}
+
+Status CachedFileSystem::OpenInputFile(const std::string& path,
+                                       std::shared_ptr<RandomAccessFile>* file) {
+  return impl_->fs()->OpenInputFile(path, file);
+}
+
+void CachedFileSystem::Invalidate() { impl_->Invalidate(); }
+
+int64_t CachedFileSystem::num_hits() const { return impl_->num_hits(); }
+
+int64_t CachedFileSystem::num_misses() const { return impl_->num_misses(); }
+
+}  // namespace io
+}  // namespace arrow
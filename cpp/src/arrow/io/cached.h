@@ -0,0 +1,89 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// File system caching the metadata of another
+
+#ifndef ARROW_IO_CACHED_H
+#define ARROW_IO_CACHED_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/io/interfaces.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Status;
+
+namespace io {
+
+/// \class CachedFileSystem
+/// \brief A file system keeping the results of Stat and GetChildren of
+/// another for some time
+///
+/// Finding the files of a dataset stats and lists every directory and file
+/// of its tree; doing it again, or from several scans, is then answered from
+/// memory rather than by the NameNode of HDFS or the local file system.
+/// Entries are kept for a time to live after they are fetched, errors are not
+/// kept. MakeDirectory, DeleteDirectory and Rename drop all the entries, as
+/// do changes made through the wrapped file system once the entries expire.
+///
+/// The methods may be called from several threads at once if those of the
+/// wrapped file system may.
+class ARROW_EXPORT CachedFileSystem : public FileSystem {
+ public:
+  /// \param[in] fs the file system whose metadata to cache
+  /// \param[in] ttl_seconds how long entries are kept after being fetched
+  CachedFileSystem(const std::shared_ptr<FileSystem>& fs, double ttl_seconds);
+
+  ~CachedFileSystem() override;
+
+  Status MakeDirectory(const std::string& path) override;
+
+  Status DeleteDirectory(const std::string& path) override;
+
+  Status GetChildren(const std::string& path, std::vector<std::string>* listing) override;
+
+  Status Rename(const std::string& src, const std::string& dst) override;
+
+  Status Stat(const std::string& path, FileStatistics* stat) override;
+
+  Status OpenInputFile(const std::string& path,
+                       std::shared_ptr<RandomAccessFile>* file) override;
+
+  /// \brief Drop all the entries
+  void Invalidate();
+
+  /// \brief The calls of Stat and GetChildren answered from the entries
+  int64_t num_hits() const;
+
+  /// \brief The calls of Stat and GetChildren passed to the wrapped file
+  /// system
+  int64_t num_misses() const;
+
+ private:
+  class ARROW_NO_EXPORT Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace io
+}  // namespace arrow
+
+#endif  // ARROW_IO_CACHED_H
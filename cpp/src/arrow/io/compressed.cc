@@ -0,0 +1,376 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "arrow/io/compressed.h"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include "arrow/buffer.h"
+#include "arrow/memory_pool.h"
+#include "arrow/status.h"
+#include "arrow/util/compression.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+namespace io {
+
+// ----------------------------------------------------------------------
+// CompressedOutputStream implementation
+
+class CompressedOutputStream::Impl {
+ public:
+  Impl(std::shared_ptr<OutputStream> raw, MemoryPool* pool)
+      : raw_(std::move(raw)),
+        pool_(pool),
+        is_open_(false),
+        compressed_pos_(0),
+        total_pos_(0) {}
+
+  ~Impl() { DCHECK(Close().ok()); }
+
+  Status Init(Codec* codec) {
+    RETURN_NOT_OK(codec->MakeCompressor(&compressor_));
+    RETURN_NOT_OK(AllocateResizableBuffer(pool_, kChunkSize, &compressed_));
+    is_open_ = true;
+    return Status::OK();
+  }
+
+  Status Close() {
+    std::lock_guard<std::mutex> guard(lock_);
+    if (is_open_) {
+      Status st = DrainUnlocked(&Compressor::End);
+      if (st.ok()) {
+        st = WriteCompressedUnlocked();
+      }
+      is_open_ = false;
+      RETURN_NOT_OK(raw_->Close());
+      return st;
+    }
+    return Status::OK();
+  }
+
+  Status Tell(int64_t* position) const {
+    std::lock_guard<std::mutex> guard(lock_);
+    *position = total_pos_;
+    return Status::OK();
+  }
+
+  Status Write(const void* data, int64_t nbytes) {
+    std::lock_guard<std::mutex> guard(lock_);
+    if (!is_open_) {
+      return Status::IOError("Cannot write to a closed stream");
+    }
+    auto input = reinterpret_cast<const uint8_t*>(data);
+    while (nbytes > 0) {
+      int64_t bytes_read, bytes_written;
+      RETURN_NOT_OK(compressor_->Compress(nbytes, input, room_unlocked(),
+                                          compressed_->mutable_data() + compressed_pos_,
+                                          &bytes_read, &bytes_written));
+      compressed_pos_ += bytes_written;
+      input += bytes_read;
+      nbytes -= bytes_read;
+      total_pos_ += bytes_read;
+      if (room_unlocked() == 0 || bytes_read == 0) {
+        RETURN_NOT_OK(MakeRoomUnlocked());
+      }
+    }
+    return Status::OK();
+  }
+
+  Status Flush() {
+    std::lock_guard<std::mutex> guard(lock_);
+    if (!is_open_) {
+      return Status::IOError("Cannot flush a closed stream");
+    }
+    RETURN_NOT_OK(DrainUnlocked(&Compressor::Flush));
+    RETURN_NOT_OK(WriteCompressedUnlocked());
+    return raw_->Flush();
+  }
+
+  std::shared_ptr<OutputStream> raw() const { return raw_; }
+
+ private:
+  int64_t room_unlocked() const { return compressed_->size() - compressed_pos_; }
+
+  // Write the compressed chunk to the raw stream
+  Status WriteCompressedUnlocked() {
+    if (compressed_pos_ > 0) {
+      RETURN_NOT_OK(raw_->Write(compressed_->data(), compressed_pos_));
+      compressed_pos_ = 0;
+    }
+    return Status::OK();
+  }
+
+  // Empty the chunk, or enlarge it if the compressor could not progress into
+  // an empty one
+  Status MakeRoomUnlocked() {
+    if (compressed_pos_ > 0) {
+      return WriteCompressedUnlocked();
+    }
+    return compressed_->Resize(compressed_->size() * 2);
+  }
+
+  // Call Flush or End until the compressor has written out all of its output
+  Status DrainUnlocked(Status (Compressor::*op)(int64_t, uint8_t*, int64_t*, bool*)) {
+    bool should_retry = true;
+    while (should_retry) {
+      int64_t bytes_written;
+      RETURN_NOT_OK(((*compressor_).*op)(room_unlocked(),
+                                         compressed_->mutable_data() + compressed_pos_,
+                                         &bytes_written, &should_retry));
+      compressed_pos_ += bytes_written;
+      if (should_retry) {
+        RETURN_NOT_OK(MakeRoomUnlocked());
+      }
+    }
+    return Status::OK();
+  }
+
+  std::shared_ptr<OutputStream> raw_;
+  MemoryPool* pool_;
+  std::shared_ptr<Compressor> compressor_;
+  bool is_open_;
+  std::shared_ptr<ResizableBuffer> compressed_;
+  int64_t compressed_pos_;
+  // The uncompressed bytes written
+  int64_t total_pos_;
+
+  mutable std::mutex lock_;
+};
+
+CompressedOutputStream::CompressedOutputStream(std::unique_ptr<Impl> impl)
+    : impl_(std::move(impl)) {}
+
+CompressedOutputStream::~CompressedOutputStream() {}
+
+Status CompressedOutputStream::Make(Codec* codec,
+                                    const std::shared_ptr<OutputStream>& raw,
+                                    MemoryPool* pool,
+                                    std::shared_ptr<CompressedOutputStream>* out) {
+  std::unique_ptr<Impl> impl(new Impl(raw, pool));
+  RETURN_NOT_OK(impl->Init(codec));
+  out->reset(new CompressedOutputStream(std::move(impl)));
+  return Status::OK();
+}
+
+Status CompressedOutputStream::Make(Codec* codec,
+                                    const std::shared_ptr<OutputStream>& raw,
+                                    std::shared_ptr<CompressedOutputStream>* out) {
+  return Make(codec, raw, default_memory_pool(), out);
+}
+
+Status CompressedOutputStream::Close() { return impl_->Close(); }
+
+Status CompressedOutputStream::Tell(int64_t* position) const {
+  return impl_->Tell(position);
+}
+
+Status CompressedOutputStream::Write(const void* data, int64_t nbytes) {
+  return impl_->Write(data, nbytes);
+}
+
+Status CompressedOutputStream::Flush() { return impl_->Flush(); }
+
+std::shared_ptr<OutputStream> CompressedOutputStream::raw() const { return impl_->raw(); }
+
+// ----------------------------------------------------------------------
+// CompressedInputStream implementation
+
+class CompressedInputStream::Impl {
+ public:
+  Impl(std::shared_ptr<InputStream> raw, MemoryPool* pool)
+      : raw_(std::move(raw)),
+        pool_(pool),
+        compressed_pos_(0),
+        decompressed_pos_(0),
+        decompressed_length_(0),
+        total_pos_(0),
+        stream_has_input_(false),
+        pending_output_(false) {}
+
+  Status Init(Codec* codec) {
+    RETURN_NOT_OK(codec->MakeDecompressor(&decompressor_));
+    return AllocateResizableBuffer(pool_, kChunkSize, &decompressed_);
+  }
+
+  Status Close() {
+    std::lock_guard<std::mutex> guard(lock_);
+    return raw_->Close();
+  }
+
+  Status Tell(int64_t* position) const {
+    std::lock_guard<std::mutex> guard(lock_);
+    *position = total_pos_;
+    return Status::OK();
+  }
+
+  Status Read(int64_t nbytes, int64_t* bytes_read, void* out) {
+    std::lock_guard<std::mutex> guard(lock_);
+    return ReadUnlocked(nbytes, bytes_read, static_cast<uint8_t*>(out));
+  }
+
+  Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) {
+    std::lock_guard<std::mutex> guard(lock_);
+    if (nbytes < 0) {
+      return Status::Invalid("read count should be >= 0");
+    }
+    std::shared_ptr<ResizableBuffer> buffer;
+    RETURN_NOT_OK(AllocateResizableBuffer(pool_, nbytes, &buffer));
+    int64_t bytes_read;
+    RETURN_NOT_OK(ReadUnlocked(nbytes, &bytes_read, buffer->mutable_data()));
+    if (bytes_read < nbytes) {
+      RETURN_NOT_OK(buffer->Resize(bytes_read));
+    }
+    *out = buffer;
+    return Status::OK();
+  }
+
+  std::shared_ptr<InputStream> raw() const { return raw_; }
+
+ private:
+  Status ReadUnlocked(int64_t nbytes, int64_t* bytes_read, uint8_t* out) {
+    int64_t total = 0;
+    while (total < nbytes) {
+      if (decompressed_pos_ == decompressed_length_) {
+        bool has_data;
+        RETURN_NOT_OK(DecompressUnlocked(&has_data));
+        if (!has_data) {
+          break;
+        }
+      }
+      const int64_t length =
+          std::min(nbytes - total, decompressed_length_ - decompressed_pos_);
+      memcpy(out + total, decompressed_->data() + decompressed_pos_, length);
+      decompressed_pos_ += length;
+      total += length;
+    }
+    total_pos_ += total;
+    *bytes_read = total;
+    return Status::OK();
+  }
+
+  // Decompress the next chunk of output, reading from the raw stream as
+  // needed. has_data is false at the end of the raw stream
+  Status DecompressUnlocked(bool* has_data) {
+    decompressed_pos_ = 0;
+    decompressed_length_ = 0;
+    while (true) {
+      // The decompressor may still hold output for input it has consumed
+      if (!pending_output_ &&
+          (compressed_ == nullptr || compressed_pos_ == compressed_->size())) {
+        RETURN_NOT_OK(raw_->Read(kChunkSize, &compressed_));
+        compressed_pos_ = 0;
+        if (compressed_->size() == 0) {
+          if (stream_has_input_ && !decompressor_->IsFinished()) {
+            return Status::IOError("Truncated compressed stream");
+          }
+          *has_data = false;
+          return Status::OK();
+        }
+      }
+      if (!pending_output_ && decompressor_->IsFinished()) {
+        // Another compressed stream follows the one which ended
+        RETURN_NOT_OK(decompressor_->Reset());
+        stream_has_input_ = false;
+      }
+
+      int64_t bytes_read, bytes_written;
+      RETURN_NOT_OK(decompressor_->Decompress(
+          compressed_->size() - compressed_pos_, compressed_->data() + compressed_pos_,
+          decompressed_->size(), decompressed_->mutable_data(), &bytes_read,
+          &bytes_written, &pending_output_));
+      compressed_pos_ += bytes_read;
+      if (bytes_read > 0) {
+        stream_has_input_ = true;
+      }
+      if (bytes_written > 0) {
+        decompressed_length_ = bytes_written;
+        *has_data = true;
+        return Status::OK();
+      }
+      if (pending_output_) {
+        RETURN_NOT_OK(decompressed_->Resize(decompressed_->size() * 2));
+      } else if (bytes_read == 0 && compressed_pos_ < compressed_->size() &&
+                 !decompressor_->IsFinished()) {
+        return Status::IOError("Compressed stream decompressor made no progress");
+      }
+    }
+  }
+
+  std::shared_ptr<InputStream> raw_;
+  MemoryPool* pool_;
+  std::shared_ptr<Decompressor> decompressor_;
+
+  // The chunk of compressed data last read from the raw stream
+  std::shared_ptr<Buffer> compressed_;
+  int64_t compressed_pos_;
+  std::shared_ptr<ResizableBuffer> decompressed_;
+  int64_t decompressed_pos_;
+  int64_t decompressed_length_;
+  // The uncompressed bytes read
+  int64_t total_pos_;
+  // Whether the current compressed stream was fed any input, so that a raw
+  // stream ending within it is told from one ending between streams
+  bool stream_has_input_;
+  // Whether the decompressor filled its output and may have more to write
+  bool pending_output_;
+
+  mutable std::mutex lock_;
+};
+
+CompressedInputStream::CompressedInputStream(std::unique_ptr<Impl> impl)
+    : impl_(std::move(impl)) {}
+
+CompressedInputStream::~CompressedInputStream() {}
+
+Status CompressedInputStream::Make(Codec* codec, const std::shared_ptr<InputStream>& raw,
+                                   MemoryPool* pool,
+                                   std::shared_ptr<CompressedInputStream>* out) {
+  std::unique_ptr<Impl> impl(new Impl(raw, pool));
+  RETURN_NOT_OK(impl->Init(codec));
+  out->reset(new CompressedInputStream(std::move(impl)));
+  return Status::OK();
+}
+
+Status CompressedInputStream::Make(Codec* codec, const std::shared_ptr<InputStream>& raw,
+                                   std::shared_ptr<CompressedInputStream>* out) {
+  return Make(codec, raw, default_memory_pool(), out);
+}
+
+Status CompressedInputStream::Close() { return impl_->Close(); }
+
+Status CompressedInputStream::Tell(int64_t* position) const {
+  return impl_->Tell(position);
+}
+
+Status CompressedInputStream::Read(int64_t nbytes, int64_t* bytes_read, void* out) {
+  return impl_->Read(nbytes, bytes_read, out);
+}
+
+Status CompressedInputStream::Read(int64_t nbytes, std::shared_ptr<Buffer>* out) {
+  return impl_->Read(nbytes, out);
+}
+
+std::shared_ptr<InputStream> CompressedInputStream::raw() const { return impl_->raw(); }
+
+}  // namespace io
+}  // namespace arrow
@@ -0,0 +1,145 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+// Compressed stream implementations
+
+#ifndef ARROW_IO_COMPRESSED_H
+#define ARROW_IO_COMPRESSED_H
+
+#include <memory>
+
+#include "arrow/io/interfaces.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Codec;
+class MemoryPool;
+class Status;
+
+namespace io {
+
+/// \class CompressedOutputStream
+/// \brief An output stream compressing the data written to it into another
+///
+/// The data is compressed with a streaming compressor of the codec, in chunks
+/// of kChunkSize bytes of compressed output, so in bounded memory.
+class ARROW_EXPORT CompressedOutputStream : public OutputStream {
+ public:
+  static constexpr int64_t kChunkSize = 64 * 1024;
+
+  ~CompressedOutputStream() override;
+
+  /// \brief Create a compressed output stream wrapping the given output stream
+  ///
+  /// \param[in] codec the codec to make the compressor with, which need not
+  /// outlive the stream
+  /// \param[in] raw the stream to write the compressed data to
+  /// \param[in] pool the pool to allocate the chunk buffer from
+  /// \param[out] out the compressed output stream
+  /// \return Status
+  static Status Make(Codec* codec, const std::shared_ptr<OutputStream>& raw,
+                     MemoryPool* pool, std::shared_ptr<CompressedOutputStream>* out);
+
+  /// \brief Create a compressed output stream allocating from the default
+  /// memory pool
+  static Status Make(Codec* codec, const std::shared_ptr<OutputStream>& raw,
+                     std::shared_ptr<CompressedOutputStream>* out);
+
+  // OutputStream interface
+
+  /// \brief End the compressed stream and close the underlying raw output
+  /// stream
+  Status Close() override;
+
+  /// \brief The number of uncompressed bytes written
+  Status Tell(int64_t* position) const override;
+
+  Status Write(const void* data, int64_t nbytes) override;
+
+  /// \brief Write out the compressed data of all the bytes written so far, so
+  /// they can be decompressed from the raw stream
+  Status Flush() override;
+
+  /// \brief Return the underlying raw output stream.
+  std::shared_ptr<OutputStream> raw() const;
+
+ private:
+  class ARROW_NO_EXPORT Impl;
+
+  explicit CompressedOutputStream(std::unique_ptr<Impl> impl);
+
+  std::unique_ptr<Impl> impl_;
+};
+
+/// \class CompressedInputStream
+/// \brief An input stream decompressing the data read from another
+///
+/// The raw stream is read and decompressed in chunks of kChunkSize bytes, so
+/// in bounded memory. Concatenated compressed streams, as of gzip members or
+/// zstd frames, are decompressed one after the other; a raw stream ending
+/// within a compressed stream is an error.
+class ARROW_EXPORT CompressedInputStream : public InputStream {
+ public:
+  static constexpr int64_t kChunkSize = 64 * 1024;
+
+  ~CompressedInputStream() override;
+
+  /// \brief Create a compressed input stream wrapping the given input stream
+  ///
+  /// \param[in] codec the codec to make the decompressor with, which need
+  /// not outlive the stream
+  /// \param[in] raw the stream to read the compressed data from
+  /// \param[in] pool the pool to allocate the buffers from
+  /// \param[out] out the compressed input stream
+  /// \return Status
+  static Status Make(Codec* codec, const std::shared_ptr<InputStream>& raw,
+                     MemoryPool* pool, std::shared_ptr<CompressedInputStream>* out);
+
+  /// \brief Create a compressed input stream allocating from the default
+  /// memory pool
+  static Status Make(Codec* codec, const std::shared_ptr<InputStream>& raw,
+                     std::shared_ptr<CompressedInputStream>* out);
+
+  // InputStream interface
+
+  /// \brief Close the underlying raw input stream
+  Status Close() override;
+
+  /// \brief The number of uncompressed bytes read
+  Status Tell(int64_t* position) const override;
+
+  Status Read(int64_t nbytes, int64_t* bytes_read, void* out) override;
+
+  Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) override;
+
+  /// \brief Return the underlying raw input stream.
+  std::shared_ptr<InputStream> raw() const;
+
+ private:
+  class ARROW_NO_EXPORT Impl;
+
+  explicit CompressedInputStream(std::unique_ptr<Impl> impl);
+
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace io
+}  // namespace arrow
+
+#endif  // ARROW_IO_COMPRESSED_H
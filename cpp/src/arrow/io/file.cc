@@ -149,6 +149,11 @@ class OSFile {
     return internal::FileWrite(fd_, reinterpret_cast<const uint8_t*>(data), length);
   }
 
+  Status Writev(const std::vector<std::shared_ptr<Buffer>>& buffers) {
+    std::lock_guard<std::mutex> guard(lock_);
+    return internal::FileWritev(fd_, buffers);
+  }
+
   int fd() const { return fd_; }
 
   bool is_open() const { return is_open_; }
@@ -187,10 +192,38 @@ class OSFile {
 
 class ReadableFile::ReadableFileImpl : public OSFile {
  public:
-  explicit ReadableFileImpl(MemoryPool* pool) : OSFile(), pool_(pool) {}
+  explicit ReadableFileImpl(MemoryPool* pool) : OSFile(), pool_(pool), position_(0) {}
 
   Status Open(const std::string& path) { return OpenReadable(path); }
-  Status Open(int fd) { return OpenReadable(fd); }
+  Status Open(int fd) {
+    RETURN_NOT_OK(OpenReadable(fd));
+    return internal::FileTell(fd, &position_);
+  }
+
+  // The position is kept here rather than by the OS, so that reads at a
+  // position, done with pread, neither use nor move it, and need no lock
+
+  Status Read(int64_t nbytes, int64_t* bytes_read, void* out) {
+    std::lock_guard<std::mutex> guard(position_lock_);
+    RETURN_NOT_OK(ReadAt(position_, nbytes, bytes_read, out));
+    position_ += *bytes_read;
+    return Status::OK();
+  }
+
+  Status Seek(int64_t position) {
+    if (position < 0) {
+      return Status::Invalid("Invalid position");
+    }
+    std::lock_guard<std::mutex> guard(position_lock_);
+    position_ = position;
+    return Status::OK();
+  }
+
+  Status Tell(int64_t* position) const {
+    std::lock_guard<std::mutex> guard(position_lock_);
+    *position = position_;
+    return Status::OK();
+  }
 
   Status ReadBuffer(int64_t nbytes, std::shared_ptr<Buffer>* out) {
     std::shared_ptr<ResizableBuffer> buffer;
@@ -222,6 +255,8 @@ class ReadableFile::ReadableFileImpl : public OSFile {
 
  private:
   MemoryPool* pool_;
+  int64_t position_;
+  mutable std::mutex position_lock_;
 };
 
 ReadableFile::ReadableFile(MemoryPool* pool) { impl_.reset(new ReadableFileImpl(pool)); }
@@ -253,7 +288,6 @@ Status ReadableFile::Close() { return impl_->Close(); }
 Status ReadableFile::Tell(int64_t* pos) const { return impl_->Tell(pos); }
 
 Status ReadableFile::Read(int64_t nbytes, int64_t* bytes_read, void* out) {
-  std::lock_guard<std::mutex> guard(impl_->lock());
   return impl_->Read(nbytes, bytes_read, out);
 }
 
@@ -268,7 +302,6 @@ Status ReadableFile::ReadAt(int64_t position, int64_t nbytes,
 }
 
 Status ReadableFile::Read(int64_t nbytes, std::shared_ptr<Buffer>* out) {
-  std::lock_guard<std::mutex> guard(impl_->lock());
   return impl_->ReadBuffer(nbytes, out);
 }
 
@@ -343,6 +376,10 @@ Status FileOutputStream::Write(const void* data, int64_t length) {
   return impl_->Write(data, length);
 }
 
+Status FileOutputStream::Writev(const std::vector<std::shared_ptr<Buffer>>& buffers) {
+  return impl_->Writev(buffers);
+}
+
 int FileOutputStream::file_descriptor() const { return impl_->fd(); }
 
 // ----------------------------------------------------------------------
@@ -361,7 +398,7 @@ class MemoryMappedFile::MemoryMap : public MutableBuffer {
     }
   }
 
-  Status Open(const std::string& path, FileMode::type mode) {
+  Status Open(const std::string& path, FileMode::type mode, bool populate) {
     file_.reset(new OSFile());
 
     if (mode != FileMode::READ) {
@@ -382,6 +419,12 @@ class MemoryMappedFile::MemoryMap : public MutableBuffer {
       is_mutable_ = false;
     }
 
+#ifdef MAP_POPULATE
+    if (populate) {
+      map_mode_ |= MAP_POPULATE;
+    }
+#endif
+
     // Memory mapping fails when file size is 0
     // delay it until the first resize
     if (file_->size() > 0) {
@@ -421,6 +464,40 @@ class MemoryMappedFile::MemoryMap : public MutableBuffer {
 
   std::mutex& resize_lock() { return resize_lock_; }
 
+  Status Advise(int64_t position, int64_t nbytes, MemoryAdvice::type advice) {
+#ifndef _WIN32
+    std::lock_guard<std::mutex> guard(resize_lock_);
+    nbytes = std::max<int64_t>(0, std::min(nbytes, size_ - position));
+    if (position < 0 || nbytes == 0) {
+      return Status::OK();
+    }
+    // madvise() wants a page-aligned address
+    static const int64_t page_size = static_cast<int64_t>(sysconf(_SC_PAGESIZE));
+    const int64_t start = position - position % page_size;
+    int flag = MADV_NORMAL;
+    switch (advice) {
+      case MemoryAdvice::WILL_NEED:
+        flag = MADV_WILLNEED;
+        break;
+      case MemoryAdvice::SEQUENTIAL:
+        flag = MADV_SEQUENTIAL;
+        break;
+      case MemoryAdvice::RANDOM:
+        flag = MADV_RANDOM;
+        break;
+      default:
+        break;
+    }
+    if (madvise(mutable_data_ + start, static_cast<size_t>(position + nbytes - start),
+                flag) != 0) {
+      std::stringstream ss;
+      ss << "madvise failed: " << std::strerror(errno);
+      return Status::IOError(ss.str());
+    }
+#endif
+    return Status::OK();
+  }
+
  private:
   // Resize the mmap and file to the specified size.
   Status ResizeMap(int64_t new_size) {
@@ -502,10 +579,15 @@ Status MemoryMappedFile::Create(const std::string& path, int64_t size,
 
 Status MemoryMappedFile::Open(const std::string& path, FileMode::type mode,
                               std::shared_ptr<MemoryMappedFile>* out) {
+  return Open(path, mode, false /* populate */, out);
+}
+
+Status MemoryMappedFile::Open(const std::string& path, FileMode::type mode,
+                              bool populate, std::shared_ptr<MemoryMappedFile>* out) {
   std::shared_ptr<MemoryMappedFile> result(new MemoryMappedFile());
 
   result->memory_map_.reset(new MemoryMap());
-  RETURN_NOT_OK(result->memory_map_->Open(path, mode));
+  RETURN_NOT_OK(result->memory_map_->Open(path, mode, populate));
 
   *out = result;
   return Status::OK();
@@ -567,6 +649,18 @@ Status MemoryMappedFile::Read(int64_t nbytes, std::shared_ptr<Buffer>* out) {
   return Status::OK();
 }
 
+Status MemoryMappedFile::Advise(int64_t position, int64_t nbytes,
+                                MemoryAdvice::type advice) {
+  return memory_map_->Advise(position, nbytes, advice);
+}
+
+Status MemoryMappedFile::WillNeed(const std::vector<ReadRange>& ranges) {
+  for (const ReadRange& range : ranges) {
+    RETURN_NOT_OK(Advise(range.offset, range.length, MemoryAdvice::WILL_NEED));
+  }
+  return Status::OK();
+}
+
 bool MemoryMappedFile::supports_zero_copy() const { return true; }
 
 Status MemoryMappedFile::WriteAt(int64_t position, const void* data, int64_t nbytes) {
@@ -622,5 +716,170 @@ Status MemoryMappedFile::Resize(int64_t new_size) {
 
 int MemoryMappedFile::file_descriptor() const { return memory_map_->fd(); }
 
+// ----------------------------------------------------------------------
+// MemoryMappedOutputStream implementation
+
+class MemoryMappedOutputStream::Impl {
+ public:
+  Impl() : position_(0), capacity_(0) {}
+
+  ~Impl() { DCHECK(Close().ok()); }
+
+  Status Open(const std::string& path, int64_t initial_capacity) {
+    if (initial_capacity <= 0) {
+      return Status::Invalid("initial capacity should be > 0");
+    }
+    RETURN_NOT_OK(MemoryMappedFile::Create(path, initial_capacity, &file_));
+    capacity_ = initial_capacity;
+    return Status::OK();
+  }
+
+  Status Close() {
+    if (file_ == nullptr) {
+      return Status::OK();
+    }
+    // The map is unmapped and the file closed once the last reference is gone
+    Status status = file_->Resize(position_);
+    file_.reset();
+    return status;
+  }
+
+  Status Tell(int64_t* position) const {
+    *position = position_;
+    return Status::OK();
+  }
+
+  Status Write(const void* data, int64_t nbytes) {
+    if (file_ == nullptr) {
+      return Status::IOError("OutputStream is closed");
+    }
+    if (position_ + nbytes > capacity_) {
+      const int64_t new_capacity = std::max(position_ + nbytes, capacity_ * 2);
+      RETURN_NOT_OK(file_->Resize(new_capacity));
+      capacity_ = new_capacity;
+    }
+    RETURN_NOT_OK(file_->Write(data, nbytes));
+    position_ += nbytes;
+    return Status::OK();
+  }
+
+  int64_t capacity() const { return capacity_; }
+
+ private:
+  std::shared_ptr<MemoryMappedFile> file_;
+  int64_t position_;
+  int64_t capacity_;
+};
+
+constexpr int64_t MemoryMappedOutputStream::kDefaultInitialCapacity;
+
+MemoryMappedOutputStream::MemoryMappedOutputStream() : impl_(new Impl()) {}
+
+MemoryMappedOutputStream::~MemoryMappedOutputStream() {}
+
+Status MemoryMappedOutputStream::Open(const std::string& path, int64_t initial_capacity,
+                                      std::shared_ptr<MemoryMappedOutputStream>* out) {
+  std::shared_ptr<MemoryMappedOutputStream> result(new MemoryMappedOutputStream());
+  RETURN_NOT_OK(result->impl_->Open(path, initial_capacity));
+  *out = result;
+  return Status::OK();
+}
+
+Status MemoryMappedOutputStream::Open(const std::string& path,
+                                      std::shared_ptr<MemoryMappedOutputStream>* out) {
+  return Open(path, kDefaultInitialCapacity, out);
+}
+
+Status MemoryMappedOutputStream::Close() { return impl_->Close(); }
+
+Status MemoryMappedOutputStream::Tell(int64_t* position) const {
+  return impl_->Tell(position);
+}
+
+Status MemoryMappedOutputStream::Write(const void* data, int64_t nbytes) {
+  return impl_->Write(data, nbytes);
+}
+
+int64_t MemoryMappedOutputStream::capacity() const { return impl_->capacity(); }
+
+// ----------------------------------------------------------------------
+// LocalFileSystem implementation
+
+LocalFileSystem::LocalFileSystem() : LocalFileSystem(default_memory_pool()) {}
+
+LocalFileSystem::LocalFileSystem(MemoryPool* pool) : pool_(pool) {}
+
+Status LocalFileSystem::MakeDirectory(const std::string& path) {
+  // Create the missing directories from the outermost one
+  size_t end = 0;
+  do {
+    end = path.find_first_of("/\\", end + 1);
+    const std::string parent = path.substr(0, end);
+    FileStatistics stat;
+    if (!Stat(parent, &stat).ok()) {
+      internal::PlatformFilename dir_name;
+      RETURN_NOT_OK(internal::FileNameFromString(parent, &dir_name));
+      RETURN_NOT_OK(internal::DirectoryCreate(dir_name));
+    } else if (stat.kind != ObjectType::DIRECTORY) {
+      return Status::IOError("Not a directory: " + parent);
+    }
+  } while (end != std::string::npos);
+  return Status::OK();
+}
+
+Status LocalFileSystem::DeleteDirectory(const std::string& path) {
+  std::vector<std::string> children;
+  RETURN_NOT_OK(GetChildren(path, &children));
+  for (const std::string& child : children) {
+    FileStatistics stat;
+    RETURN_NOT_OK(Stat(child, &stat));
+    if (stat.kind == ObjectType::DIRECTORY) {
+      RETURN_NOT_OK(DeleteDirectory(child));
+    } else {
+      internal::PlatformFilename file_name;
+      RETURN_NOT_OK(internal::FileNameFromString(child, &file_name));
+      RETURN_NOT_OK(internal::FileDelete(file_name));
+    }
+  }
+  internal::PlatformFilename dir_name;
+  RETURN_NOT_OK(internal::FileNameFromString(path, &dir_name));
+  return internal::DirectoryDelete(dir_name);
+}
+
+Status LocalFileSystem::GetChildren(const std::string& path,
+                                    std::vector<std::string>* listing) {
+  internal::PlatformFilename dir_name;
+  RETURN_NOT_OK(internal::FileNameFromString(path, &dir_name));
+  std::vector<std::string> names;
+  RETURN_NOT_OK(internal::DirectoryList(dir_name, &names));
+  std::sort(names.begin(), names.end());
+  const bool has_separator = !path.empty() && (path.back() == '/' || path.back() == '\\');
+  for (const std::string& name : names) {
+    listing->push_back(has_separator ? path + name : path + "/" + name);
+  }
+  return Status::OK();
+}
+
+Status LocalFileSystem::Rename(const std::string& src, const std::string& dst) {
+  internal::PlatformFilename src_name, dst_name;
+  RETURN_NOT_OK(internal::FileNameFromString(src, &src_name));
+  RETURN_NOT_OK(internal::FileNameFromString(dst, &dst_name));
+  return internal::FileRename(src_name, dst_name);
+}
+
+Status LocalFileSystem::Stat(const std::string& path, FileStatistics* stat) {
+  internal::PlatformFilename file_name;
+  RETURN_NOT_OK(internal::FileNameFromString(path, &file_name));
+  return internal::FileStat(file_name, stat);
+}
+
+Status LocalFileSystem::OpenInputFile(const std::string& path,
+                                      std::shared_ptr<RandomAccessFile>* file) {
+  std::shared_ptr<ReadableFile> readable;
+  RETURN_NOT_OK(ReadableFile::Open(path, pool_, &readable));
+  *file = readable;
+  return Status::OK();
+}
+
 }  // namespace io
 }  // namespace arrow
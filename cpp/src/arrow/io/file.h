@@ -23,6 +23,7 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "arrow/io/interfaces.h"
 #include "arrow/util/visibility.h"
@@ -94,6 +95,9 @@ class ARROW_EXPORT FileOutputStream : public OutputStream {
   // Write bytes to the stream. Thread-safe
   Status Write(const void* data, int64_t nbytes) override;
 
+  // Write buffers with writev, as few calls as IOV_MAX allows. Thread-safe
+  Status Writev(const std::vector<std::shared_ptr<Buffer>>& buffers) override;
+
   int file_descriptor() const;
 
  private:
@@ -104,6 +108,12 @@ class ARROW_EXPORT FileOutputStream : public OutputStream {
 };
 
 // Operating system file
+//
+// ReadAt is done with pread, using no lock nor the file position, so that any
+// number of threads can read at positions of the same ReadableFile at once,
+// while others read sequentially. Read, Seek and Tell share a position that
+// ReadableFile keeps itself, not the one of the file descriptor, and are
+// serialized with each other.
 class ARROW_EXPORT ReadableFile : public RandomAccessFile {
  public:
   ~ReadableFile() override;
@@ -144,15 +154,15 @@ class ARROW_EXPORT ReadableFile : public RandomAccessFile {
   Status Close() override;
   Status Tell(int64_t* position) const override;
 
-  // Read bytes from the file. Thread-safe
+  // Read bytes from the file at the current position. Thread-safe
   Status Read(int64_t nbytes, int64_t* bytes_read, void* buffer) override;
   Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) override;
 
-  /// \brief Thread-safe implementation of ReadAt
+  /// \brief Lock-free implementation of ReadAt, leaving the position unchanged
   Status ReadAt(int64_t position, int64_t nbytes, int64_t* bytes_read,
                 void* out) override;
 
-  /// \brief Thread-safe implementation of ReadAt
+  /// \brief Lock-free implementation of ReadAt, leaving the position unchanged
   Status ReadAt(int64_t position, int64_t nbytes, std::shared_ptr<Buffer>* out) override;
 
   Status GetSize(int64_t* size) override;
@@ -169,6 +179,22 @@ class ARROW_EXPORT ReadableFile : public RandomAccessFile {
   std::unique_ptr<ReadableFileImpl> impl_;
 };
 
+/// \brief How a range of a memory-mapped file is going to be accessed, as
+/// madvise() is told
+struct ARROW_EXPORT MemoryAdvice {
+  enum type {
+    /// No particular pattern
+    NORMAL,
+    /// Soon, so the kernel reads the pages ahead
+    WILL_NEED,
+    /// In order, so the kernel reads ahead aggressively and frees pages
+    /// behind
+    SEQUENTIAL,
+    /// At random, so the kernel does not read ahead
+    RANDOM
+  };
+};
+
 // A file interface that uses memory-mapped files for memory interactions,
 // supporting zero copy reads. The same class is used for both reading and
 // writing.
@@ -186,6 +212,11 @@ class ARROW_EXPORT MemoryMappedFile : public ReadWriteFileInterface {
   static Status Open(const std::string& path, FileMode::type mode,
                      std::shared_ptr<MemoryMappedFile>* out);
 
+  /// \brief Open a file, optionally with all its pages read and mapped
+  /// upfront (MAP_POPULATE), so that reads never wait on page faults
+  static Status Open(const std::string& path, FileMode::type mode, bool populate,
+                     std::shared_ptr<MemoryMappedFile>* out);
+
   Status Close() override;
 
   Status Tell(int64_t* position) const override;
@@ -210,6 +241,14 @@ class ARROW_EXPORT MemoryMappedFile : public ReadWriteFileInterface {
 
   bool supports_zero_copy() const override;
 
+  /// \brief Advise the kernel how a range of the map is going to be accessed.
+  /// A no-op where madvise() is not available. Thread-safe
+  Status Advise(int64_t position, int64_t nbytes, MemoryAdvice::type advice);
+
+  /// \brief Advise the kernel that the ranges will be needed soon, so that
+  /// their pages are read in the background. Thread-safe
+  Status WillNeed(const std::vector<ReadRange>& ranges) override;
+
   /// Write data at the current position in the file. Thread-safe
   Status Write(const void* data, int64_t nbytes) override;
 
@@ -233,6 +272,82 @@ class ARROW_EXPORT MemoryMappedFile : public ReadWriteFileInterface {
   std::shared_ptr<MemoryMap> memory_map_;
 };
 
+/// \class MemoryMappedOutputStream
+/// \brief An output stream writing to a memory-mapped file of a size not known
+/// upfront
+///
+/// The file and its map grow, by ftruncate and mremap, to twice their size
+/// whenever a write does not fit, and the file is truncated to the bytes
+/// written on Close.
+class ARROW_EXPORT MemoryMappedOutputStream : public OutputStream {
+ public:
+  static constexpr int64_t kDefaultInitialCapacity = 1 << 20;
+
+  /// \brief Closes the stream if not done yet
+  ~MemoryMappedOutputStream() override;
+
+  /// \brief Create a new file, or truncate an existing one, to write to
+  /// \param[in] path with UTF8 encoding
+  /// \param[in] initial_capacity the size the file is created with
+  /// \param[out] out MemoryMappedOutputStream instance
+  static Status Open(const std::string& path, int64_t initial_capacity,
+                     std::shared_ptr<MemoryMappedOutputStream>* out);
+
+  static Status Open(const std::string& path,
+                     std::shared_ptr<MemoryMappedOutputStream>* out);
+
+  /// \brief Truncate the file to the bytes written and unmap it
+  Status Close() override;
+
+  Status Tell(int64_t* position) const override;
+
+  Status Write(const void* data, int64_t nbytes) override;
+
+  using Writable::Write;
+
+  /// \brief The size of the file and its map, which writes fill without
+  /// growing them
+  int64_t capacity() const;
+
+ private:
+  MemoryMappedOutputStream();
+
+  class ARROW_NO_EXPORT Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+/// \class LocalFileSystem
+/// \brief The file system of the local machine, with paths in UTF-8
+///
+/// Files are opened for reading as ReadableFile.
+class ARROW_EXPORT LocalFileSystem : public FileSystem {
+ public:
+  LocalFileSystem();
+
+  /// \param[in] pool the MemoryPool of the files opened for reading
+  explicit LocalFileSystem(MemoryPool* pool);
+
+  /// \brief Create a directory and its missing parents
+  Status MakeDirectory(const std::string& path) override;
+
+  /// \brief Delete a directory and all of its contents
+  Status DeleteDirectory(const std::string& path) override;
+
+  /// \brief The paths of the entries of a directory, as the directory path
+  /// joined with their names by '/', in sorted order
+  Status GetChildren(const std::string& path, std::vector<std::string>* listing) override;
+
+  Status Rename(const std::string& src, const std::string& dst) override;
+
+  Status Stat(const std::string& path, FileStatistics* stat) override;
+
+  Status OpenInputFile(const std::string& path,
+                       std::shared_ptr<RandomAccessFile>* file) override;
+
+ private:
+  MemoryPool* pool_;
+};
+
 }  // namespace io
 }  // namespace arrow
 
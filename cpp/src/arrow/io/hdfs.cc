@@ -21,9 +21,16 @@
 #include <cerrno>
 #include <cstddef>
 #include <cstdint>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <future>
+#include <limits>
 #include <mutex>
 #include <sstream>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "arrow/buffer.h"
 #include "arrow/io/hdfs-internal.h"
@@ -31,6 +38,8 @@
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/task-group.h"
+#include "arrow/util/thread-pool.h"
 
 using std::size_t;
 
@@ -96,10 +105,20 @@ class HdfsAnyFileImpl {
 // Private implementation for read-only files
 class HdfsReadableFile::HdfsReadableFileImpl : public HdfsAnyFileImpl {
  public:
-  explicit HdfsReadableFileImpl(MemoryPool* pool) : pool_(pool) {}
+  explicit HdfsReadableFileImpl(MemoryPool* pool)
+      : pool_(pool),
+        block_size_(-1),
+        position_(0),
+        readahead_position_(0),
+        pending_position_(0) {}
 
   Status Close() {
     if (is_open_) {
+      {
+        // Fetches ahead read from the file
+        std::lock_guard<std::mutex> guard(lock_);
+        DiscardReadahead();
+      }
       int ret = driver_->CloseFile(fs_, file_);
       CHECK_FAILURE(ret, "CloseFile");
       is_open_ = false;
@@ -108,18 +127,16 @@ class HdfsReadableFile::HdfsReadableFileImpl : public HdfsAnyFileImpl {
   }
 
   Status ReadAt(int64_t position, int64_t nbytes, int64_t* bytes_read, void* buffer) {
-    tSize ret;
-    if (driver_->HasPread()) {
-      ret = driver_->Pread(fs_, file_, static_cast<tOffset>(position),
-                           reinterpret_cast<void*>(buffer), static_cast<tSize>(nbytes));
-    } else {
+    if (!driver_->HasPread()) {
       std::lock_guard<std::mutex> guard(lock_);
-      RETURN_NOT_OK(Seek(position));
-      return Read(nbytes, bytes_read, buffer);
+      RETURN_NOT_OK(HdfsAnyFileImpl::Seek(position));
+      return ReadSequential(nbytes, bytes_read, buffer);
     }
-    CHECK_FAILURE(ret, "read");
-    *bytes_read = ret;
-    return Status::OK();
+    if (options_.parallel_chunk_size > 0 && nbytes > options_.parallel_chunk_size) {
+      return ParallelReadAt(position, nbytes, bytes_read,
+                            reinterpret_cast<uint8_t*>(buffer));
+    }
+    return PreadFully(position, nbytes, bytes_read, reinterpret_cast<uint8_t*>(buffer));
   }
 
   Status ReadAt(int64_t position, int64_t nbytes, std::shared_ptr<Buffer>* out) {
@@ -139,16 +156,44 @@ class HdfsReadableFile::HdfsReadableFileImpl : public HdfsAnyFileImpl {
   }
 
   Status Read(int64_t nbytes, int64_t* bytes_read, void* buffer) {
+    if (!read_ahead()) {
+      return ReadSequential(nbytes, bytes_read, buffer);
+    }
+    std::lock_guard<std::mutex> guard(lock_);
+    uint8_t* out = reinterpret_cast<uint8_t*>(buffer);
     int64_t total_bytes = 0;
     while (total_bytes < nbytes) {
-      tSize ret = driver_->Read(
-          fs_, file_, reinterpret_cast<uint8_t*>(buffer) + total_bytes,
-          static_cast<tSize>(std::min<int64_t>(buffer_size_, nbytes - total_bytes)));
-      CHECK_FAILURE(ret, "read");
-      total_bytes += ret;
-      if (ret == 0) {
-        break;
+      if (!readahead_ || position_ < readahead_position_ ||
+          position_ >= readahead_position_ + readahead_->size()) {
+        const int64_t remaining = nbytes - total_bytes;
+        if (pending_.valid() && pending_position_ == position_) {
+          RETURN_NOT_OK(TakeReadahead());
+        } else if (remaining >= options_.readahead_size) {
+          // Not worth going through the read-ahead buffer
+          DiscardReadahead();
+          int64_t ret;
+          RETURN_NOT_OK(ReadAt(position_, remaining, &ret, out + total_bytes));
+          position_ += ret;
+          total_bytes += ret;
+          break;
+        } else {
+          DiscardReadahead();
+          RETURN_NOT_OK(StartReadahead(position_));
+          RETURN_NOT_OK(TakeReadahead());
+        }
+        if (readahead_->size() == 0) {
+          break;
+        }
+        // Fetch the next bytes while these are consumed
+        if (readahead_->size() == options_.readahead_size) {
+          RETURN_NOT_OK(StartReadahead(readahead_position_ + readahead_->size()));
+        }
       }
+      const int64_t offset = position_ - readahead_position_;
+      const int64_t ret = std::min(nbytes - total_bytes, readahead_->size() - offset);
+      std::memcpy(out + total_bytes, readahead_->data() + offset, ret);
+      position_ += ret;
+      total_bytes += ret;
     }
 
     *bytes_read = total_bytes;
@@ -169,6 +214,29 @@ class HdfsReadableFile::HdfsReadableFileImpl : public HdfsAnyFileImpl {
     return Status::OK();
   }
 
+  // With read-ahead, the position is kept here rather than by libhdfs, as
+  // the reads are positional
+  Status Seek(int64_t position) {
+    if (!read_ahead()) {
+      return HdfsAnyFileImpl::Seek(position);
+    }
+    if (position < 0) {
+      return Status::Invalid("Invalid position");
+    }
+    std::lock_guard<std::mutex> guard(lock_);
+    position_ = position;
+    return Status::OK();
+  }
+
+  Status Tell(int64_t* position) {
+    if (!read_ahead()) {
+      return HdfsAnyFileImpl::Tell(position);
+    }
+    std::lock_guard<std::mutex> guard(lock_);
+    *position = position_;
+    return Status::OK();
+  }
+
   Status GetSize(int64_t* size) {
     hdfsFileInfo* entry = driver_->GetPathInfo(fs_, path_.c_str());
     if (entry == nullptr) {
@@ -184,9 +252,157 @@ class HdfsReadableFile::HdfsReadableFileImpl : public HdfsAnyFileImpl {
 
   void set_buffer_size(int32_t buffer_size) { buffer_size_ = buffer_size; }
 
+  void set_options(const HdfsReadOptions& options) { options_ = options; }
+
  private:
+  bool read_ahead() const { return options_.readahead_size > 0 && driver_->HasPread(); }
+
+  Status ReadSequential(int64_t nbytes, int64_t* bytes_read, void* buffer) {
+    int64_t total_bytes = 0;
+    while (total_bytes < nbytes) {
+      tSize ret = driver_->Read(
+          fs_, file_, reinterpret_cast<uint8_t*>(buffer) + total_bytes,
+          static_cast<tSize>(std::min<int64_t>(buffer_size_, nbytes - total_bytes)));
+      CHECK_FAILURE(ret, "read");
+      total_bytes += ret;
+      if (ret == 0) {
+        break;
+      }
+    }
+
+    *bytes_read = total_bytes;
+    return Status::OK();
+  }
+
+  // hdfsPread may return fewer bytes than asked for before the end of the
+  // file, and takes at most 2GB at once
+  Status PreadFully(int64_t position, int64_t nbytes, int64_t* bytes_read,
+                    uint8_t* buffer) {
+    int64_t total_bytes = 0;
+    while (total_bytes < nbytes) {
+      tSize ret = driver_->Pread(
+          fs_, file_, static_cast<tOffset>(position + total_bytes), buffer + total_bytes,
+          static_cast<tSize>(std::min<int64_t>(std::numeric_limits<tSize>::max(),
+                                               nbytes - total_bytes)));
+      CHECK_FAILURE(ret, "read");
+      total_bytes += ret;
+      if (ret == 0) {
+        break;
+      }
+    }
+
+    *bytes_read = total_bytes;
+    return Status::OK();
+  }
+
+  Status GetBlockSize(int64_t* block_size) {
+    std::lock_guard<std::mutex> guard(block_size_lock_);
+    if (block_size_ == -1) {
+      hdfsFileInfo* entry = driver_->GetPathInfo(fs_, path_.c_str());
+      if (entry == nullptr) {
+        return Status::IOError("HDFS: GetPathInfo failed");
+      }
+      block_size_ = entry->mBlockSize;
+      driver_->FreeFileInfo(entry, 1);
+    }
+    *block_size = block_size_;
+    return Status::OK();
+  }
+
+  // Split the read at the HDFS block boundaries, so that each piece is served
+  // by a single datanode, and the pieces are fetched at once
+  Status ParallelReadAt(int64_t position, int64_t nbytes, int64_t* bytes_read,
+                        uint8_t* buffer) {
+    int64_t block_size;
+    RETURN_NOT_OK(GetBlockSize(&block_size));
+
+    std::vector<ReadRange> pieces;
+    const int64_t end = position + nbytes;
+    for (int64_t offset = position; offset < end;) {
+      int64_t piece_end = std::min(end, offset + options_.parallel_chunk_size);
+      if (block_size > 0) {
+        piece_end = std::min(piece_end, (offset / block_size + 1) * block_size);
+      }
+      pieces.push_back({offset, piece_end - offset});
+      offset = piece_end;
+    }
+
+    std::vector<int64_t> piece_bytes_read(pieces.size(), 0);
+    ::arrow::internal::TaskGroup group(::arrow::internal::GetIOThreadPool());
+    for (size_t i = 0; i < pieces.size(); ++i) {
+      group.Append([this, &pieces, &piece_bytes_read, position, buffer, i] {
+        const ReadRange& piece = pieces[i];
+        return PreadFully(piece.offset, piece.length, &piece_bytes_read[i],
+                          buffer + piece.offset - position);
+      });
+    }
+    RETURN_NOT_OK(group.Finish());
+
+    // A short piece is the end of the file
+    int64_t total_bytes = 0;
+    for (size_t i = 0; i < pieces.size(); ++i) {
+      total_bytes += piece_bytes_read[i];
+      if (piece_bytes_read[i] < pieces[i].length) {
+        break;
+      }
+    }
+    *bytes_read = total_bytes;
+    return Status::OK();
+  }
+
+  // The following are called with lock_ held
+
+  Status StartReadahead(int64_t position) {
+    DCHECK(!pending_.valid());
+    std::shared_ptr<ResizableBuffer> buffer;
+    RETURN_NOT_OK(AllocateResizableBuffer(pool_, options_.readahead_size, &buffer));
+    pending_position_ = position;
+    pending_buffer_ = buffer;
+    pending_ = ::arrow::internal::GetIOThreadPool()->Submit([this, buffer, position] {
+      int64_t bytes_read;
+      RETURN_NOT_OK(
+          PreadFully(position, buffer->size(), &bytes_read, buffer->mutable_data()));
+      return buffer->Resize(bytes_read, false);
+    });
+    return Status::OK();
+  }
+
+  Status TakeReadahead() {
+    Status st = pending_.get();
+    readahead_ = std::move(pending_buffer_);
+    readahead_position_ = pending_position_;
+    pending_buffer_.reset();
+    if (!st.ok()) {
+      readahead_.reset();
+    }
+    return st;
+  }
+
+  void DiscardReadahead() {
+    if (pending_.valid()) {
+      pending_.wait();
+      pending_ = std::future<Status>();
+      pending_buffer_.reset();
+    }
+    readahead_.reset();
+  }
+
   MemoryPool* pool_;
   int32_t buffer_size_;
+  HdfsReadOptions options_;
+
+  std::mutex block_size_lock_;
+  // -1 until known
+  int64_t block_size_;
+
+  // With read-ahead, the position of the file, the bytes fetched ahead from
+  // readahead_position_, and the pending fetch of those following them
+  int64_t position_;
+  std::shared_ptr<Buffer> readahead_;
+  int64_t readahead_position_;
+  std::future<Status> pending_;
+  std::shared_ptr<ResizableBuffer> pending_buffer_;
+  int64_t pending_position_;
 };
 
 HdfsReadableFile::HdfsReadableFile(MemoryPool* pool) {
@@ -232,19 +448,40 @@ Status HdfsReadableFile::Tell(int64_t* position) const { return impl_->Tell(posi
 // Private implementation for writeable-only files
 class HdfsOutputStream::HdfsOutputStreamImpl : public HdfsAnyFileImpl {
  public:
-  HdfsOutputStreamImpl() {}
+  HdfsOutputStreamImpl()
+      : position_(0), writing_(false), stopping_(false), background_status_() {}
+
+  ~HdfsOutputStreamImpl() { StopWriter(); }
+
+  // Start the background writer, if the options ask for one
+  void set_options(const HdfsWriteOptions& options) {
+    options_ = options;
+    options_.background_queue_size = std::max(options_.background_queue_size, 1);
+    if (background()) {
+      writer_ = std::thread([this] { WriteLoop(); });
+    }
+  }
 
   Status Close() {
     if (is_open_) {
-      RETURN_NOT_OK(Flush());
+      Status st = Flush();
+      StopWriter();
       int ret = driver_->CloseFile(fs_, file_);
-      CHECK_FAILURE(ret, "CloseFile");
       is_open_ = false;
+      RETURN_NOT_OK(st);
+      CHECK_FAILURE(ret, "CloseFile");
     }
     return Status::OK();
   }
 
   Status Flush() {
+    if (background()) {
+      std::lock_guard<std::mutex> guard(lock_);
+      RETURN_NOT_OK(EnqueueCurrent());
+      std::unique_lock<std::mutex> lock(queue_lock_);
+      producer_cv_.wait(lock, [this] { return queue_.empty() && !writing_; });
+      RETURN_NOT_OK(background_status_);
+    }
     int ret = driver_->Flush(fs_, file_);
     CHECK_FAILURE(ret, "Flush");
     return Status::OK();
@@ -252,12 +489,144 @@ class HdfsOutputStream::HdfsOutputStreamImpl : public HdfsAnyFileImpl {
 
   Status Write(const void* buffer, int64_t nbytes, int64_t* bytes_written) {
     std::lock_guard<std::mutex> guard(lock_);
+    if (background()) {
+      RETURN_NOT_OK(WriteBackground(reinterpret_cast<const uint8_t*>(buffer), nbytes));
+      *bytes_written = nbytes;
+      return Status::OK();
+    }
     tSize ret = driver_->Write(fs_, file_, reinterpret_cast<const void*>(buffer),
                                static_cast<tSize>(nbytes));
     CHECK_FAILURE(ret, "Write");
     *bytes_written = ret;
     return Status::OK();
   }
+
+  Status Tell(int64_t* offset) {
+    if (background()) {
+      std::lock_guard<std::mutex> guard(lock_);
+      *offset = position_;
+      return Status::OK();
+    }
+    return HdfsAnyFileImpl::Tell(offset);
+  }
+
+ private:
+  bool background() const { return options_.background_buffer_size > 0; }
+
+  // Copy into the buffer being filled, queueing it when full
+  Status WriteBackground(const uint8_t* data, int64_t nbytes) {
+    {
+      std::lock_guard<std::mutex> lock(queue_lock_);
+      RETURN_NOT_OK(background_status_);
+    }
+    while (nbytes > 0) {
+      if (!current_) {
+        RETURN_NOT_OK(AllocateResizableBuffer(
+            default_memory_pool(), options_.background_buffer_size, &current_));
+        RETURN_NOT_OK(current_->Resize(0, false));
+      }
+      const int64_t chunk =
+          std::min(nbytes, options_.background_buffer_size - current_->size());
+      const int64_t size = current_->size();
+      RETURN_NOT_OK(current_->Resize(size + chunk, false));
+      std::memcpy(current_->mutable_data() + size, data, chunk);
+      data += chunk;
+      nbytes -= chunk;
+      position_ += chunk;
+      if (current_->size() == options_.background_buffer_size) {
+        RETURN_NOT_OK(EnqueueCurrent());
+      }
+    }
+    return Status::OK();
+  }
+
+  // Hand the buffer being filled to the writer, waiting for room in the queue
+  Status EnqueueCurrent() {
+    if (!current_ || current_->size() == 0) {
+      return Status::OK();
+    }
+    std::unique_lock<std::mutex> lock(queue_lock_);
+    producer_cv_.wait(lock, [this] {
+      return !background_status_.ok() ||
+             queue_.size() < static_cast<size_t>(options_.background_queue_size);
+    });
+    RETURN_NOT_OK(background_status_);
+    queue_.push_back(std::move(current_));
+    current_.reset();
+    consumer_cv_.notify_one();
+    return Status::OK();
+  }
+
+  // Run on the background thread
+  void WriteLoop() {
+    while (true) {
+      std::shared_ptr<ResizableBuffer> buffer;
+      {
+        std::unique_lock<std::mutex> lock(queue_lock_);
+        consumer_cv_.wait(lock, [this] { return stopping_ || !queue_.empty(); });
+        if (queue_.empty()) {
+          return;
+        }
+        buffer = std::move(queue_.front());
+        queue_.pop_front();
+        writing_ = true;
+      }
+      Status st = WriteAll(buffer->data(), buffer->size());
+      {
+        std::lock_guard<std::mutex> lock(queue_lock_);
+        writing_ = false;
+        if (!st.ok()) {
+          // The data after the failed write is dropped
+          background_status_ = st;
+          queue_.clear();
+        }
+      }
+      producer_cv_.notify_all();
+    }
+  }
+
+  Status WriteAll(const uint8_t* data, int64_t nbytes) {
+    while (nbytes > 0) {
+      const tSize chunk = static_cast<tSize>(
+          std::min<int64_t>(nbytes, std::numeric_limits<tSize>::max()));
+      tSize ret = driver_->Write(fs_, file_, data, chunk);
+      CHECK_FAILURE(ret, "Write");
+      if (ret == 0) {
+        return Status::IOError("HDFS Write wrote no bytes");
+      }
+      data += ret;
+      nbytes -= ret;
+    }
+    return Status::OK();
+  }
+
+  void StopWriter() {
+    if (writer_.joinable()) {
+      {
+        std::lock_guard<std::mutex> lock(queue_lock_);
+        stopping_ = true;
+      }
+      consumer_cv_.notify_one();
+      writer_.join();
+    }
+  }
+
+  HdfsWriteOptions options_;
+
+  // The buffer being filled by Write, and the number of bytes written to the
+  // stream, both guarded by lock_
+  std::shared_ptr<ResizableBuffer> current_;
+  int64_t position_;
+
+  // The full buffers waiting to be written, and the state of the writer
+  std::mutex queue_lock_;
+  std::condition_variable consumer_cv_;
+  std::condition_variable producer_cv_;
+  std::deque<std::shared_ptr<ResizableBuffer>> queue_;
+  bool writing_;
+  bool stopping_;
+  Status background_status_;
+  std::thread writer_;
 };
 
 HdfsOutputStream::HdfsOutputStream() { impl_.reset(new HdfsOutputStreamImpl()); }
@@ -453,6 +822,7 @@ class HadoopFileSystem::HadoopFileSystemImpl {
   }
 
   Status OpenReadable(const std::string& path, int32_t buffer_size,
+                      const HdfsReadOptions& options,
                       std::shared_ptr<HdfsReadableFile>* file) {
     hdfsFile handle = driver_->OpenFile(fs_, path.c_str(), O_RDONLY, buffer_size, 0, 0);
 
@@ -471,12 +841,14 @@ class HadoopFileSystem::HadoopFileSystemImpl {
     *file = std::shared_ptr<HdfsReadableFile>(new HdfsReadableFile());
     (*file)->impl_->set_members(path, driver_, fs_, handle);
     (*file)->impl_->set_buffer_size(buffer_size);
+    (*file)->impl_->set_options(options);
 
     return Status::OK();
   }
 
   Status OpenWriteable(const std::string& path, bool append, int32_t buffer_size,
                        int16_t replication, int64_t default_block_size,
+                       const HdfsWriteOptions& options,
                        std::shared_ptr<HdfsOutputStream>* file) {
     int flags = O_WRONLY;
     if (append) flags |= O_APPEND;
@@ -495,6 +867,7 @@ class HadoopFileSystem::HadoopFileSystemImpl {
     // std::make_shared does not work with private ctors
     *file = std::shared_ptr<HdfsOutputStream>(new HdfsOutputStream());
     (*file)->impl_->set_members(path, driver_, fs_, handle);
+    (*file)->impl_->set_options(options);
 
     return Status::OK();
   }
@@ -585,8 +958,14 @@ Status HadoopFileSystem::ListDirectory(const std::string& path,
 }
 
 Status HadoopFileSystem::OpenReadable(const std::string& path, int32_t buffer_size,
+                                      const HdfsReadOptions& options,
                                       std::shared_ptr<HdfsReadableFile>* file) {
-  return impl_->OpenReadable(path, buffer_size, file);
+  return impl_->OpenReadable(path, buffer_size, options, file);
+}
+
+Status HadoopFileSystem::OpenReadable(const std::string& path, int32_t buffer_size,
+                                      std::shared_ptr<HdfsReadableFile>* file) {
+  return OpenReadable(path, buffer_size, HdfsReadOptions(), file);
 }
 
 Status HadoopFileSystem::OpenReadable(const std::string& path,
@@ -594,12 +973,29 @@ Status HadoopFileSystem::OpenReadable(const std::string& path,
   return OpenReadable(path, kDefaultHdfsBufferSize, file);
 }
 
+Status HadoopFileSystem::OpenInputFile(const std::string& path,
+                                       std::shared_ptr<RandomAccessFile>* file) {
+  std::shared_ptr<HdfsReadableFile> hdfs_file;
+  RETURN_NOT_OK(OpenReadable(path, &hdfs_file));
+  *file = hdfs_file;
+  return Status::OK();
+}
+
+Status HadoopFileSystem::OpenWriteable(const std::string& path, bool append,
+                                       int32_t buffer_size, int16_t replication,
+                                       int64_t default_block_size,
+                                       std::shared_ptr<HdfsOutputStream>* file) {
+  return OpenWriteable(path, append, buffer_size, replication, default_block_size,
+                       HdfsWriteOptions(), file);
+}
+
 Status HadoopFileSystem::OpenWriteable(const std::string& path, bool append,
                                        int32_t buffer_size, int16_t replication,
                                        int64_t default_block_size,
+                                       const HdfsWriteOptions& options,
                                        std::shared_ptr<HdfsOutputStream>* file) {
   return impl_->OpenWriteable(path, append, buffer_size, replication, default_block_size,
-                              file);
+                              options, file);
 }
 
 Status HadoopFileSystem::OpenWriteable(const std::string& path, bool append,
@@ -68,6 +68,33 @@ struct HdfsConnectionConfig {
   HdfsDriver driver;
 };
 
+/// \brief Options for reading an HDFS file
+///
+/// Both need a driver with positional reads, and are ignored otherwise.
+struct ARROW_EXPORT HdfsReadOptions {
+  /// ReadAt calls larger than this are split at the boundaries of the HDFS
+  /// blocks of the file, and then into pieces of at most this size, read
+  /// concurrently on the I/O thread pool. 0 to read in a single call
+  int64_t parallel_chunk_size = 8 << 20;
+
+  /// The bytes fetched ahead of Read calls on the I/O thread pool, so that
+  /// sequential reads rarely wait for the datanodes. 0 to fetch none
+  int64_t readahead_size = 0;
+};
+
+/// \brief Options for writing an HDFS file
+struct ARROW_EXPORT HdfsWriteOptions {
+  /// Writes are gathered into buffers of this size, which a background thread
+  /// writes to HDFS while the next ones fill, so that the writer does not wait
+  /// for the datanodes to acknowledge the packets. Errors of the background
+  /// writes are returned by the next Write, Flush or Close. 0 to write in the
+  /// calling thread
+  int64_t background_buffer_size = 0;
+
+  /// The most full buffers waiting to be written, after which Write blocks
+  int background_queue_size = 4;
+};
+
 class ARROW_EXPORT HadoopFileSystem : public FileSystem {
  public:
   ~HadoopFileSystem() override;
@@ -151,6 +178,13 @@ class ARROW_EXPORT HadoopFileSystem : public FileSystem {
 
   Status OpenReadable(const std::string& path, std::shared_ptr<HdfsReadableFile>* file);
 
+  Status OpenInputFile(const std::string& path,
+                       std::shared_ptr<RandomAccessFile>* file) override;
+
+  Status OpenReadable(const std::string& path, int32_t buffer_size,
+                      const HdfsReadOptions& options,
+                      std::shared_ptr<HdfsReadableFile>* file);
+
   // FileMode::WRITE options
   // @param path complete file path
   // @param buffer_size, 0 for default
@@ -163,6 +197,11 @@ class ARROW_EXPORT HadoopFileSystem : public FileSystem {
   Status OpenWriteable(const std::string& path, bool append,
                        std::shared_ptr<HdfsOutputStream>* file);
 
+  Status OpenWriteable(const std::string& path, bool append, int32_t buffer_size,
+                       int16_t replication, int64_t default_block_size,
+                       const HdfsWriteOptions& options,
+                       std::shared_ptr<HdfsOutputStream>* file);
+
  private:
   friend class HdfsReadableFile;
   friend class HdfsOutputStream;
@@ -223,8 +262,12 @@ class ARROW_EXPORT HdfsOutputStream : public OutputStream {
 
   Status Write(const void* buffer, int64_t nbytes, int64_t* bytes_written);
 
+  /// \brief Write out the buffered data, waiting for the background writes
+  /// if any, and flush the file
   Status Flush() override;
 
+  /// \brief The number of bytes written, including those buffered for the
+  /// background writes
   Status Tell(int64_t* position) const override;
 
  private:
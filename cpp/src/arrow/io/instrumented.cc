@@ -0,0 +1,400 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/io/instrumented.h"
+
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <sstream>
+#include <utility>
+
+#include "arrow/buffer.h"
+#include "arrow/status.h"
+
+namespace arrow {
+namespace io {
+
+constexpr int IOStatistics::kNumSizeBuckets;
+
+IOStatistics::IOStatistics()
+    : num_reads(0),
+      bytes_read(0),
+      read_nanos(0),
+      read_sizes(kNumSizeBuckets, 0),
+      num_writes(0),
+      bytes_written(0),
+      write_nanos(0),
+      write_sizes(kNumSizeBuckets, 0),
+      num_seeks(0),
+      seek_nanos(0),
+      num_errors(0) {}
+
+int IOStatistics::SizeBucket(int64_t nbytes) {
+  int bucket = 0;
+  while (nbytes > 0 && bucket < kNumSizeBuckets - 1) {
+    nbytes >>= 1;
+    ++bucket;
+  }
+  return bucket;
+}
+
+static void PrintHistogram(const std::vector<int64_t>& sizes, std::ostream* os) {
+  for (int i = 0; i < static_cast<int>(sizes.size()); ++i) {
+    if (sizes[i] == 0) {
+      continue;
+    }
+    *os << "\n  ";
+    if (i == 0) {
+      *os << "0";
+    } else if (i == IOStatistics::kNumSizeBuckets - 1) {
+      *os << ">= " << (int64_t(1) << (i - 1));
+    } else {
+      *os << "[" << (int64_t(1) << (i - 1)) << ", " << (int64_t(1) << i) << ")";
+    }
+    *os << " bytes: " << sizes[i];
+  }
+}
+
+std::string IOStatistics::ToString() const {
+  std::stringstream ss;
+  ss << "reads: " << num_reads << ", " << bytes_read << " bytes, "
+     << read_nanos / 1000 << " us";
+  PrintHistogram(read_sizes, &ss);
+  ss << "\nwrites: " << num_writes << ", " << bytes_written << " bytes, "
+     << write_nanos / 1000 << " us";
+  PrintHistogram(write_sizes, &ss);
+  ss << "\nseeks: " << num_seeks << ", " << seek_nanos / 1000 << " us";
+  ss << "\nerrors: " << num_errors;
+  return ss.str();
+}
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// The statistics of a stream or file, updated after each operation
+class StatisticsRecorder {
+ public:
+  // Run the operation and record it with the given function if it succeeds.
+  // Only the operation is timed, the lock is taken after it
+  template <typename Operation, typename Record>
+  Status Time(Operation&& operation, Record&& record) {
+    const auto start = Clock::now();
+    Status st = operation();
+    const int64_t nanos =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start)
+            .count();
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (st.ok()) {
+      record(nanos, &stats_);
+    } else {
+      ++stats_.num_errors;
+    }
+    return st;
+  }
+
+  Status TimeRead(int64_t nbytes, const int64_t* bytes_read,
+                  const std::function<Status()>& read) {
+    return Time(read, [nbytes, bytes_read](int64_t nanos, IOStatistics* stats) {
+      ++stats->num_reads;
+      stats->bytes_read += *bytes_read;
+      stats->read_nanos += nanos;
+      ++stats->read_sizes[IOStatistics::SizeBucket(nbytes)];
+    });
+  }
+
+  Status TimeWrite(int64_t nbytes, const std::function<Status()>& write) {
+    return Time(write, [nbytes](int64_t nanos, IOStatistics* stats) {
+      ++stats->num_writes;
+      stats->bytes_written += nbytes;
+      stats->write_nanos += nanos;
+      ++stats->write_sizes[IOStatistics::SizeBucket(nbytes)];
+    });
+  }
+
+  Status TimeSeek(const std::function<Status()>& seek) {
+    return Time(seek, [](int64_t nanos, IOStatistics* stats) {
+      ++stats->num_seeks;
+      stats->seek_nanos += nanos;
+    });
+  }
+
+  IOStatistics Snapshot() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+  }
+
+  void Reset() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stats_ = IOStatistics();
+  }
+
+ private:
+  mutable std::mutex mutex_;
+  IOStatistics stats_;
+};
+
+}  // namespace
+
+// ----------------------------------------------------------------------
+// InstrumentedInputStream
+
+class InstrumentedInputStream::Impl {
+ public:
+  explicit Impl(std::shared_ptr<InputStream> raw) : raw_(std::move(raw)) {}
+
+  Status Read(int64_t nbytes, int64_t* bytes_read, void* out) {
+    return recorder_.TimeRead(nbytes, bytes_read,
+                              [&] { return raw_->Read(nbytes, bytes_read, out); });
+  }
+
+  Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) {
+    int64_t bytes_read = 0;
+    return recorder_.TimeRead(nbytes, &bytes_read, [&] {
+      RETURN_NOT_OK(raw_->Read(nbytes, out));
+      bytes_read = (*out)->size();
+      return Status::OK();
+    });
+  }
+
+  const std::shared_ptr<InputStream>& raw() const { return raw_; }
+  StatisticsRecorder* recorder() { return &recorder_; }
+
+ private:
+  std::shared_ptr<InputStream> raw_;
+  StatisticsRecorder recorder_;
+};
+
+InstrumentedInputStream::InstrumentedInputStream(std::shared_ptr<InputStream> raw)
+    : impl_(new Impl(std::move(raw))) {}
+
+InstrumentedInputStream::~InstrumentedInputStream() {}
+
+Status InstrumentedInputStream::Close() { return impl_->raw()->Close(); }
+
+Status InstrumentedInputStream::Tell(int64_t* position) const {
+  return impl_->raw()->Tell(position);
+}
+
+Status InstrumentedInputStream::Read(int64_t nbytes, int64_t* bytes_read, void* out) {
+  return impl_->Read(nbytes, bytes_read, out);
+}
+
+Status InstrumentedInputStream::Read(int64_t nbytes, std::shared_ptr<Buffer>* out) {
+  return impl_->Read(nbytes, out);
+}
+
+IOStatistics InstrumentedInputStream::statistics() const {
+  return impl_->recorder()->Snapshot();
+}
+
+void InstrumentedInputStream::ResetStatistics() { impl_->recorder()->Reset(); }
+
+std::shared_ptr<InputStream> InstrumentedInputStream::raw() const {
+  return impl_->raw();
+}
+
+// ----------------------------------------------------------------------
+// InstrumentedRandomAccessFile
+
+class InstrumentedRandomAccessFile::Impl {
+ public:
+  explicit Impl(std::shared_ptr<RandomAccessFile> raw) : raw_(std::move(raw)) {}
+
+  Status Read(int64_t nbytes, int64_t* bytes_read, void* out) {
+    return recorder_.TimeRead(nbytes, bytes_read,
+                              [&] { return raw_->Read(nbytes, bytes_read, out); });
+  }
+
+  Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) {
+    int64_t bytes_read = 0;
+    return recorder_.TimeRead(nbytes, &bytes_read, [&] {
+      RETURN_NOT_OK(raw_->Read(nbytes, out));
+      bytes_read = (*out)->size();
+      return Status::OK();
+    });
+  }
+
+  Status ReadAt(int64_t position, int64_t nbytes, int64_t* bytes_read, void* out) {
+    return recorder_.TimeRead(nbytes, bytes_read, [&] {
+      return raw_->ReadAt(position, nbytes, bytes_read, out);
+    });
+  }
+
+  Status ReadAt(int64_t position, int64_t nbytes, std::shared_ptr<Buffer>* out) {
+    int64_t bytes_read = 0;
+    return recorder_.TimeRead(nbytes, &bytes_read, [&] {
+      RETURN_NOT_OK(raw_->ReadAt(position, nbytes, out));
+      bytes_read = (*out)->size();
+      return Status::OK();
+    });
+  }
+
+  Status ReadRanges(const std::vector<ReadRange>& ranges,
+                    const ReadRangesOptions& options,
+                    std::vector<std::shared_ptr<Buffer>>* out) {
+    return recorder_.Time(
+        [&] { return raw_->ReadRanges(ranges, options, out); },
+        [&](int64_t nanos, IOStatistics* stats) {
+          for (size_t i = 0; i < ranges.size(); ++i) {
+            ++stats->num_reads;
+            stats->bytes_read += (*out)[i]->size();
+            ++stats->read_sizes[IOStatistics::SizeBucket(ranges[i].length)];
+          }
+          stats->read_nanos += nanos;
+        });
+  }
+
+  Status Seek(int64_t position) {
+    return recorder_.TimeSeek([&] { return raw_->Seek(position); });
+  }
+
+  const std::shared_ptr<RandomAccessFile>& raw() const { return raw_; }
+  StatisticsRecorder* recorder() { return &recorder_; }
+
+ private:
+  std::shared_ptr<RandomAccessFile> raw_;
+  StatisticsRecorder recorder_;
+};
+
+InstrumentedRandomAccessFile::InstrumentedRandomAccessFile(
+    std::shared_ptr<RandomAccessFile> raw)
+    : impl_(new Impl(std::move(raw))) {}
+
+InstrumentedRandomAccessFile::~InstrumentedRandomAccessFile() {}
+
+Status InstrumentedRandomAccessFile::Close() { return impl_->raw()->Close(); }
+
+Status InstrumentedRandomAccessFile::Tell(int64_t* position) const {
+  return impl_->raw()->Tell(position);
+}
+
+Status InstrumentedRandomAccessFile::Seek(int64_t position) {
+  return impl_->Seek(position);
+}
+
+Status InstrumentedRandomAccessFile::GetSize(int64_t* size) {
+  return impl_->raw()->GetSize(size);
+}
+
+bool InstrumentedRandomAccessFile::supports_zero_copy() const {
+  return impl_->raw()->supports_zero_copy();
+}
+
+Status InstrumentedRandomAccessFile::Read(int64_t nbytes, int64_t* bytes_read,
+                                          void* out) {
+  return impl_->Read(nbytes, bytes_read, out);
+}
+
+Status InstrumentedRandomAccessFile::Read(int64_t nbytes, std::shared_ptr<Buffer>* out) {
+  return impl_->Read(nbytes, out);
+}
+
+Status InstrumentedRandomAccessFile::ReadAt(int64_t position, int64_t nbytes,
+                                            int64_t* bytes_read, void* out) {
+  return impl_->ReadAt(position, nbytes, bytes_read, out);
+}
+
+Status InstrumentedRandomAccessFile::ReadAt(int64_t position, int64_t nbytes,
+                                            std::shared_ptr<Buffer>* out) {
+  return impl_->ReadAt(position, nbytes, out);
+}
+
+Status InstrumentedRandomAccessFile::ReadRanges(
+    const std::vector<ReadRange>& ranges, const ReadRangesOptions& options,
+    std::vector<std::shared_ptr<Buffer>>* out) {
+  return impl_->ReadRanges(ranges, options, out);
+}
+
+Status InstrumentedRandomAccessFile::WillNeed(const std::vector<ReadRange>& ranges) {
+  return impl_->raw()->WillNeed(ranges);
+}
+
+IOStatistics InstrumentedRandomAccessFile::statistics() const {
+  return impl_->recorder()->Snapshot();
+}
+
+void InstrumentedRandomAccessFile::ResetStatistics() { impl_->recorder()->Reset(); }
+
+std::shared_ptr<RandomAccessFile> InstrumentedRandomAccessFile::raw() const {
+  return impl_->raw();
+}
+
+// ----------------------------------------------------------------------
+// InstrumentedOutputStream
+
+class InstrumentedOutputStream::Impl {
+ public:
+  explicit Impl(std::shared_ptr<OutputStream> raw) : raw_(std::move(raw)) {}
+
+  Status Write(const void* data, int64_t nbytes) {
+    return recorder_.TimeWrite(nbytes, [&] { return raw_->Write(data, nbytes); });
+  }
+
+  Status Writev(const std::vector<std::shared_ptr<Buffer>>& buffers) {
+    int64_t nbytes = 0;
+    for (const auto& buffer : buffers) {
+      nbytes += buffer->size();
+    }
+    return recorder_.TimeWrite(nbytes, [&] { return raw_->Writev(buffers); });
+  }
+
+  const std::shared_ptr<OutputStream>& raw() const { return raw_; }
+  StatisticsRecorder* recorder() { return &recorder_; }
+
+ private:
+  std::shared_ptr<OutputStream> raw_;
+  StatisticsRecorder recorder_;
+};
+
+InstrumentedOutputStream::InstrumentedOutputStream(std::shared_ptr<OutputStream> raw)
+    : impl_(new Impl(std::move(raw))) {
+  set_mode(FileMode::WRITE);
+}
+
+InstrumentedOutputStream::~InstrumentedOutputStream() {}
+
+Status InstrumentedOutputStream::Close() { return impl_->raw()->Close(); }
+
+Status InstrumentedOutputStream::Tell(int64_t* position) const {
+  return impl_->raw()->Tell(position);
+}
+
+Status InstrumentedOutputStream::Write(const void* data, int64_t nbytes) {
+  return impl_->Write(data, nbytes);
+}
+
+Status InstrumentedOutputStream::Writev(
+    const std::vector<std::shared_ptr<Buffer>>& buffers) {
+  return impl_->Writev(buffers);
+}
+
+Status InstrumentedOutputStream::Flush() { return impl_->raw()->Flush(); }
+
+IOStatistics InstrumentedOutputStream::statistics() const {
+  return impl_->recorder()->Snapshot();
+}
+
+void InstrumentedOutputStream::ResetStatistics() { impl_->recorder()->Reset(); }
+
+std::shared_ptr<OutputStream> InstrumentedOutputStream::raw() const {
+  return impl_->raw();
+}
+
+}  // namespace io
+}  // namespace arrow
@@ -0,0 +1,199 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Stream and file decorators recording statistics of the IO passing through
+
+#ifndef ARROW_IO_INSTRUMENTED_H
+#define ARROW_IO_INSTRUMENTED_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/io/interfaces.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Buffer;
+class Status;
+
+namespace io {
+
+/// \brief A snapshot of the statistics of an instrumented stream or file
+///
+/// The size histograms have a bucket per power of two: bucket 0 counts the
+/// operations of 0 bytes, bucket i those of [2^(i-1), 2^i) bytes, the last
+/// bucket those of more. Reads count the sizes requested, which show how the
+/// reader is buffered, and the bytes actually read.
+struct ARROW_EXPORT IOStatistics {
+  static constexpr int kNumSizeBuckets = 40;
+
+  IOStatistics();
+
+  /// \brief The histogram bucket of an operation of nbytes bytes
+  static int SizeBucket(int64_t nbytes);
+
+  /// Reads, ReadAt calls and ranges of ReadRanges calls
+  int64_t num_reads;
+  int64_t bytes_read;
+  int64_t read_nanos;
+  std::vector<int64_t> read_sizes;
+
+  /// Write calls, each Writev counting as a write of all its buffers
+  int64_t num_writes;
+  int64_t bytes_written;
+  int64_t write_nanos;
+  std::vector<int64_t> write_sizes;
+
+  int64_t num_seeks;
+  int64_t seek_nanos;
+
+  /// Reads, writes and seeks which failed, not counted above
+  int64_t num_errors;
+
+  /// \brief A human-readable summary, with the nonempty histogram buckets
+  std::string ToString() const;
+};
+
+/// \class InstrumentedInputStream
+/// \brief An input stream recording statistics of the reads of another
+///
+/// The statistics may be taken while another thread reads.
+class ARROW_EXPORT InstrumentedInputStream : public InputStream {
+ public:
+  explicit InstrumentedInputStream(std::shared_ptr<InputStream> raw);
+
+  ~InstrumentedInputStream() override;
+
+  // InputStream interface
+
+  Status Close() override;
+
+  Status Tell(int64_t* position) const override;
+
+  Status Read(int64_t nbytes, int64_t* bytes_read, void* out) override;
+
+  Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) override;
+
+  /// \brief The statistics recorded since the stream was made or reset
+  IOStatistics statistics() const;
+
+  void ResetStatistics();
+
+  /// \brief Return the underlying raw input stream.
+  std::shared_ptr<InputStream> raw() const;
+
+ private:
+  class ARROW_NO_EXPORT Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+/// \class InstrumentedRandomAccessFile
+/// \brief A file recording statistics of the reads and seeks of another
+///
+/// ReadRanges and WillNeed are passed to the wrapped file, so that its own
+/// implementations are kept; each range counts as a read. Thread-safe if the
+/// wrapped file is.
+class ARROW_EXPORT InstrumentedRandomAccessFile : public RandomAccessFile {
+ public:
+  explicit InstrumentedRandomAccessFile(std::shared_ptr<RandomAccessFile> raw);
+
+  ~InstrumentedRandomAccessFile() override;
+
+  // RandomAccessFile interface
+
+  Status Close() override;
+
+  Status Tell(int64_t* position) const override;
+
+  Status Seek(int64_t position) override;
+
+  Status GetSize(int64_t* size) override;
+
+  bool supports_zero_copy() const override;
+
+  Status Read(int64_t nbytes, int64_t* bytes_read, void* out) override;
+
+  Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) override;
+
+  Status ReadAt(int64_t position, int64_t nbytes, int64_t* bytes_read,
+                void* out) override;
+
+  Status ReadAt(int64_t position, int64_t nbytes, std::shared_ptr<Buffer>* out) override;
+
+  Status ReadRanges(const std::vector<ReadRange>& ranges,
+                    const ReadRangesOptions& options,
+                    std::vector<std::shared_ptr<Buffer>>* out) override;
+
+  Status WillNeed(const std::vector<ReadRange>& ranges) override;
+
+  /// \brief The statistics recorded since the file was made or reset
+  IOStatistics statistics() const;
+
+  void ResetStatistics();
+
+  /// \brief Return the underlying raw file.
+  std::shared_ptr<RandomAccessFile> raw() const;
+
+ private:
+  class ARROW_NO_EXPORT Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+/// \class InstrumentedOutputStream
+/// \brief An output stream recording statistics of the writes to another
+///
+/// The statistics may be taken while another thread writes.
+class ARROW_EXPORT InstrumentedOutputStream : public OutputStream {
+ public:
+  explicit InstrumentedOutputStream(std::shared_ptr<OutputStream> raw);
+
+  ~InstrumentedOutputStream() override;
+
+  // OutputStream interface
+
+  Status Close() override;
+
+  Status Tell(int64_t* position) const override;
+
+  Status Write(const void* data, int64_t nbytes) override;
+
+  using Writable::Write;
+
+  Status Writev(const std::vector<std::shared_ptr<Buffer>>& buffers) override;
+
+  Status Flush() override;
+
+  /// \brief The statistics recorded since the stream was made or reset
+  IOStatistics statistics() const;
+
+  void ResetStatistics();
+
+  /// \brief Return the underlying raw output stream.
+  std::shared_ptr<OutputStream> raw() const;
+
+ private:
+  class ARROW_NO_EXPORT Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace io
+}  // namespace arrow
+
+#endif  // ARROW_IO_INSTRUMENTED_H
@@ -17,11 +17,17 @@
 
 #include "arrow/io/interfaces.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <memory>
 #include <mutex>
+#include <utility>
+#include <vector>
 
+#include "arrow/buffer.h"
 #include "arrow/status.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
 
 namespace arrow {
 namespace io {
@@ -51,11 +57,100 @@ Status RandomAccessFile::ReadAt(int64_t position, int64_t nbytes,
   return Read(nbytes, out);
 }
 
+Status RandomAccessFile::ReadRanges(const std::vector<ReadRange>& ranges,
+                                    const ReadRangesOptions& options,
+                                    std::vector<std::shared_ptr<Buffer>>* out) {
+  if (supports_zero_copy()) {
+    out->resize(ranges.size());
+    for (size_t i = 0; i < ranges.size(); ++i) {
+      RETURN_NOT_OK(ReadAt(ranges[i].offset, ranges[i].length, &(*out)[i]));
+    }
+    return Status::OK();
+  }
+
+  const std::vector<ReadRange> merged = ::arrow::internal::CoalesceReadRanges(
+      ranges, options.hole_size_limit, options.range_size_limit);
+  std::vector<std::shared_ptr<Buffer>> merged_buffers(merged.size());
+  auto read_merged = [&](int i) {
+    return ReadAt(merged[i].offset, merged[i].length, &merged_buffers[i]);
+  };
+  const int num_merged = static_cast<int>(merged.size());
+  if (options.use_threads && num_merged > 1) {
+    RETURN_NOT_OK(ParallelFor(num_merged, read_merged));
+  } else {
+    for (int i = 0; i < num_merged; ++i) {
+      RETURN_NOT_OK(read_merged(i));
+    }
+  }
+
+  *out = ::arrow::internal::SliceCoalescedRanges(ranges, merged, merged_buffers);
+  return Status::OK();
+}
+
+Status RandomAccessFile::WillNeed(const std::vector<ReadRange>& ranges) {
+  return Status::OK();
+}
+
 Status Writable::Write(const std::string& data) {
   return Write(data.c_str(), static_cast<int64_t>(data.size()));
 }
 
+Status Writable::Writev(const std::vector<std::shared_ptr<Buffer>>& buffers) {
+  for (const auto& buffer : buffers) {
+    RETURN_NOT_OK(Write(buffer->data(), buffer->size()));
+  }
+  return Status::OK();
+}
+
 Status Writable::Flush() { return Status::OK(); }
 
 }  // namespace io
+
+namespace internal {
+
+std::vector<io::ReadRange> CoalesceReadRanges(std::vector<io::ReadRange> ranges,
+                                              int64_t hole_size_limit,
+                                              int64_t range_size_limit) {
+  std::sort(ranges.begin(), ranges.end(),
+            [](const io::ReadRange& a, const io::ReadRange& b) {
+              return a.offset < b.offset;
+            });
+  std::vector<io::ReadRange> merged;
+  for (const io::ReadRange& range : ranges) {
+    if (!merged.empty()) {
+      io::ReadRange& last = merged.back();
+      const int64_t last_end = last.offset + last.length;
+      const int64_t end = std::max(last_end, range.offset + range.length);
+      if (range.offset <= last_end + hole_size_limit &&
+          (end - last.offset <= range_size_limit || range.offset < last_end)) {
+        last.length = end - last.offset;
+        continue;
+      }
+    }
+    merged.push_back(range);
+  }
+  return merged;
+}
+
+std::vector<std::shared_ptr<Buffer>> SliceCoalescedRanges(
+    const std::vector<io::ReadRange>& ranges, const std::vector<io::ReadRange>& merged,
+    const std::vector<std::shared_ptr<Buffer>>& merged_buffers) {
+  std::vector<std::shared_ptr<Buffer>> out(ranges.size());
+  for (size_t i = 0; i < ranges.size(); ++i) {
+    const io::ReadRange& range = ranges[i];
+    // The merged range containing this one is the last one starting before it
+    auto it = std::upper_bound(
+        merged.begin(), merged.end(), range.offset,
+        [](int64_t offset, const io::ReadRange& other) { return offset < other.offset; });
+    DCHECK(it != merged.begin());
+    --it;
+    const std::shared_ptr<Buffer>& buffer = merged_buffers[it - merged.begin()];
+    const int64_t start = std::min(range.offset - it->offset, buffer->size());
+    const int64_t length = std::min(range.length, buffer->size() - start);
+    out[i] = SliceBuffer(buffer, start, length);
+  }
+  return out;
+}
+
+}  // namespace internal
 }  // namespace arrow
@@ -47,6 +47,8 @@ struct ARROW_EXPORT FileStatistics {
   ObjectType::type kind;
 };
 
+class RandomAccessFile;
+
 class ARROW_EXPORT FileSystem {
  public:
   virtual ~FileSystem() = default;
@@ -55,12 +57,17 @@ class ARROW_EXPORT FileSystem {
 
   virtual Status DeleteDirectory(const std::string& path) = 0;
 
+  /// \brief The paths of the entries of a directory
   virtual Status GetChildren(const std::string& path,
                              std::vector<std::string>* listing) = 0;
 
   virtual Status Rename(const std::string& src, const std::string& dst) = 0;
 
   virtual Status Stat(const std::string& path, FileStatistics* stat) = 0;
+
+  /// \brief Open a file for reading
+  virtual Status OpenInputFile(const std::string& path,
+                               std::shared_ptr<RandomAccessFile>* file) = 0;
 };
 
 class ARROW_EXPORT FileInterface {
@@ -92,6 +99,12 @@ class ARROW_EXPORT Writable {
 
   virtual Status Write(const void* data, int64_t nbytes) = 0;
 
+  /// \brief Write several buffers, in order, as successive calls to Write would
+  ///
+  /// The default implementation makes those calls. Files override it to write
+  /// all the buffers with a single system call, memory streams to grow once.
+  virtual Status Writev(const std::vector<std::shared_ptr<Buffer>>& buffers);
+
   /// \brief Flush buffered bytes, if any
   virtual Status Flush();
 
@@ -118,6 +131,26 @@ class ARROW_EXPORT InputStream : virtual public FileInterface, public Readable {
   InputStream() = default;
 };
 
+/// \brief A range of bytes of a file
+struct ARROW_EXPORT ReadRange {
+  int64_t offset;
+  int64_t length;
+};
+
+/// \brief Options of RandomAccessFile::ReadRanges
+struct ARROW_EXPORT ReadRangesOptions {
+  ReadRangesOptions()
+      : hole_size_limit(8192), range_size_limit(32 * 1024 * 1024), use_threads(true) {}
+
+  /// Ranges at most this many bytes apart are read together, the bytes between
+  /// them included
+  int64_t hole_size_limit;
+  /// Ranges are not merged into one longer than this
+  int64_t range_size_limit;
+  /// Whether to read the merged ranges concurrently, on the CPU thread pool
+  bool use_threads;
+};
+
 class ARROW_EXPORT RandomAccessFile : public InputStream, public Seekable {
  public:
   /// Necessary because we hold a std::unique_ptr
@@ -154,6 +187,29 @@ class ARROW_EXPORT RandomAccessFile : public InputStream, public Seekable {
   virtual Status ReadAt(int64_t position, int64_t nbytes,
                         std::shared_ptr<Buffer>* out) = 0;
 
+  /// \brief Read several ranges of the file
+  ///
+  /// The default implementation merges ranges close to each other into
+  /// larger ones, reads those with ReadAt, concurrently if so configured, and
+  /// returns slices of them. Files supporting zero-copy reads have each range
+  /// read by itself. Thread-safe if ReadAt is.
+  ///
+  /// \param[in] ranges the ranges to read, in any order, possibly overlapping
+  /// \param[in] options how to merge and read the ranges
+  /// \param[out] out a buffer per range, in the same order, shorter for ranges
+  /// past the end of the file
+  /// \return Status
+  virtual Status ReadRanges(const std::vector<ReadRange>& ranges,
+                            const ReadRangesOptions& options,
+                            std::vector<std::shared_ptr<Buffer>>* out);
+
+  /// \brief Hint that the ranges are about to be read
+  ///
+  /// Implementations may start reading them in the background, so that the
+  /// reads proper don't wait on the storage. The default implementation
+  /// does nothing.
+  virtual Status WillNeed(const std::vector<ReadRange>& ranges);
+
  protected:
   RandomAccessFile();
 
@@ -179,6 +235,26 @@ class ARROW_EXPORT ReadWriteFileInterface : public RandomAccessFile,
 using ReadableFileInterface = RandomAccessFile;
 
 }  // namespace io
+
+namespace internal {
+
+/// \brief Merge ranges at most hole_size_limit bytes apart into ranges up
+/// to range_size_limit bytes long, or longer if a single range is
+///
+/// \return the merged ranges, sorted by offset and disjoint
+ARROW_EXPORT
+std::vector<io::ReadRange> CoalesceReadRanges(std::vector<io::ReadRange> ranges,
+                                              int64_t hole_size_limit,
+                                              int64_t range_size_limit);
+
+/// \brief Slice each range from the buffer read for the merged range
+/// containing it, those being as CoalesceReadRanges returned
+ARROW_EXPORT
+std::vector<std::shared_ptr<Buffer>> SliceCoalescedRanges(
+    const std::vector<io::ReadRange>& ranges, const std::vector<io::ReadRange>& merged,
+    const std::vector<std::shared_ptr<Buffer>>& merged_buffers);
+
+}  // namespace internal
 }  // namespace arrow
 
 #endif  // ARROW_IO_INTERFACES_H
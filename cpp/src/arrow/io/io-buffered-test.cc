@@ -25,6 +25,7 @@
 #include "arrow/io/buffered.h"
 #include "arrow/io/file.h"
 #include "arrow/io/interfaces.h"
+#include "arrow/io/memory.h"
 #include "arrow/io/test-common.h"
 #include "arrow/status.h"
 #include "arrow/test-util.h"
@@ -188,6 +189,31 @@ TEST_F(TestBufferedOutputStream, LargeWrites) {
   AssertFileContents(path_, data);
 }
 
+TEST_F(TestBufferedOutputStream, Writev) {
+  OpenBuffered();
+
+  const std::string data = GenerateRandomData(100000);
+  const auto Slices = [&data](int64_t start, int64_t end, int64_t size) {
+    std::vector<std::shared_ptr<Buffer>> buffers;
+    for (int64_t offset = start; offset < end; offset += size) {
+      buffers.push_back(std::make_shared<Buffer>(
+          reinterpret_cast<const uint8_t*>(data.data()) + offset, size));
+    }
+    return buffers;
+  };
+  const auto small = Slices(0, 1000, 100);
+  const auto large = Slices(1000, 100000, 33000);
+
+  // Small writes stay buffered, large ones are written along with them
+  ASSERT_OK(stream_->Writev(small));
+  AssertTell(1000);
+  AssertFileContents(path_, "");
+  ASSERT_OK(stream_->Writev(large));
+  AssertTell(100000);
+  AssertFileContents(path_, data);
+  ASSERT_OK(stream_->Close());
+}
+
 TEST_F(TestBufferedOutputStream, Flush) {
   OpenBuffered();
 
@@ -238,5 +264,189 @@ TEST_F(TestBufferedOutputStream, TruncatesFile) {
   AssertFileContents(path_, "");
 }
 
+// ----------------------------------------------------------------------
+// Input tests
+
+static std::string AsString(const Buffer& buffer) {
+  return std::string(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+}
+
+// Counts the reads of the stream it wraps
+class CountingInputStream : public InputStream {
+ public:
+  explicit CountingInputStream(std::shared_ptr<InputStream> raw)
+      : raw_(std::move(raw)), num_reads_(0) {}
+
+  Status Close() override { return raw_->Close(); }
+
+  Status Tell(int64_t* position) const override { return raw_->Tell(position); }
+
+  Status Read(int64_t nbytes, int64_t* bytes_read, void* out) override {
+    ++num_reads_;
+    return raw_->Read(nbytes, bytes_read, out);
+  }
+
+  Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) override {
+    ++num_reads_;
+    return raw_->Read(nbytes, out);
+  }
+
+  int num_reads() const { return num_reads_; }
+
+ private:
+  std::shared_ptr<InputStream> raw_;
+  int num_reads_;
+};
+
+class TestBufferedInputStream : public ::testing::Test {
+ public:
+  void MakeStream(int64_t buffer_size) {
+    data_ = GenerateRandomData(kDataSize);
+    raw_ = std::make_shared<CountingInputStream>(
+        std::make_shared<BufferReader>(std::make_shared<Buffer>(data_)));
+    ASSERT_OK(
+        BufferedInputStream::Create(raw_, buffer_size, default_memory_pool(), &stream_));
+  }
+
+  void AssertTell(int64_t expected) {
+    int64_t position;
+    ASSERT_OK(stream_->Tell(&position));
+    ASSERT_EQ(expected, position);
+  }
+
+ protected:
+  static constexpr int64_t kDataSize = 10000;
+
+  std::string data_;
+  std::shared_ptr<CountingInputStream> raw_;
+  std::shared_ptr<BufferedInputStream> stream_;
+};
+
+constexpr int64_t TestBufferedInputStream::kDataSize;
+
+TEST_F(TestBufferedInputStream, InvalidBufferSize) {
+  std::shared_ptr<BufferedInputStream> stream;
+  auto raw = std::make_shared<BufferReader>(std::make_shared<Buffer>(""));
+  ASSERT_RAISES(Invalid,
+                BufferedInputStream::Create(raw, 0, default_memory_pool(), &stream));
+}
+
+TEST_F(TestBufferedInputStream, SmallReads) {
+  MakeStream(1024);
+  const int64_t chunk_sizes[] = {1, 3, 7, 100, 1000};
+  int64_t position = 0;
+  std::string contents;
+  for (int i = 0; position < kDataSize; ++i) {
+    const int64_t nbytes = chunk_sizes[i % 5];
+    char out[1000];
+    int64_t bytes_read;
+    ASSERT_OK(stream_->Read(nbytes, &bytes_read, out));
+    ASSERT_EQ(std::min(nbytes, kDataSize - position), bytes_read);
+    contents.append(out, bytes_read);
+    position += bytes_read;
+    AssertTell(position);
+  }
+  ASSERT_EQ(data_, contents);
+  // One read per buffer, and one finding the end of the stream
+  ASSERT_LE(raw_->num_reads(), kDataSize / 1024 + 2);
+
+  int64_t bytes_read;
+  char out[10];
+  ASSERT_OK(stream_->Read(10, &bytes_read, out));
+  ASSERT_EQ(0, bytes_read);
+}
+
+TEST_F(TestBufferedInputStream, LargeReads) {
+  MakeStream(1024);
+  std::vector<char> out(kDataSize);
+  int64_t bytes_read;
+  ASSERT_OK(stream_->Read(10, &bytes_read, out.data()));
+  ASSERT_OK(stream_->Read(5000, &bytes_read, out.data() + 10));
+  ASSERT_EQ(5000, bytes_read);
+  AssertTell(5010);
+
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(stream_->Read(kDataSize, &buffer));
+  ASSERT_EQ(kDataSize - 5010, buffer->size());
+  std::memcpy(out.data() + 5010, buffer->data(), buffer->size());
+  ASSERT_EQ(data_, std::string(out.data(), out.size()));
+  AssertTell(kDataSize);
+}
+
+TEST_F(TestBufferedInputStream, ZeroCopyReads) {
+  MakeStream(1024);
+  std::shared_ptr<Buffer> first, second;
+  ASSERT_OK(stream_->Read(100, &first));
+  ASSERT_OK(stream_->Read(200, &second));
+  ASSERT_EQ(1, raw_->num_reads());
+  // Both are slices of the same buffer
+  ASSERT_EQ(first->data() + 100, second->data());
+  ASSERT_EQ(data_.substr(0, 100), AsString(*first));
+  ASSERT_EQ(data_.substr(100, 200), AsString(*second));
+  ASSERT_EQ(724, stream_->bytes_buffered());
+
+  // Refilling the buffer leaves the slices intact
+  std::shared_ptr<Buffer> third;
+  ASSERT_OK(stream_->Read(1000, &third));
+  ASSERT_EQ(data_.substr(300, 1000), AsString(*third));
+  ASSERT_EQ(data_.substr(0, 100), AsString(*first));
+  ASSERT_EQ(data_.substr(100, 200), AsString(*second));
+  AssertTell(1300);
+}
+
+TEST_F(TestBufferedInputStream, Peek) {
+  MakeStream(1024);
+  std::shared_ptr<Buffer> peeked, read;
+  ASSERT_OK(stream_->Peek(10, &peeked));
+  ASSERT_EQ(data_.substr(0, 10), AsString(*peeked));
+  AssertTell(0);
+
+  ASSERT_OK(stream_->Read(1020, &read));
+  ASSERT_EQ(data_.substr(0, 1020), AsString(*read));
+  // Peeking across the end of the buffer reads more of the stream
+  ASSERT_OK(stream_->Peek(100, &peeked));
+  ASSERT_EQ(data_.substr(1020, 100), AsString(*peeked));
+  AssertTell(1020);
+
+  // At most the buffer size is returned
+  ASSERT_OK(stream_->Peek(5000, &peeked));
+  ASSERT_EQ(1024, peeked->size());
+  ASSERT_EQ(data_.substr(1020, 1024), AsString(*peeked));
+
+  int64_t bytes_read;
+  std::vector<char> out(kDataSize);
+  ASSERT_OK(stream_->Read(kDataSize, &bytes_read, out.data()));
+  ASSERT_EQ(kDataSize - 1020, bytes_read);
+  ASSERT_OK(stream_->Peek(10, &peeked));
+  ASSERT_EQ(0, peeked->size());
+}
+
+TEST_F(TestBufferedInputStream, FileRoundtrip) {
+  const std::string path = "arrow-test-io-buffered-input-stream.txt";
+  const std::string datastr = GenerateRandomData(100000);
+  {
+    std::shared_ptr<FileOutputStream> file;
+    ASSERT_OK(FileOutputStream::Open(path, &file));
+    ASSERT_OK(file->Write(datastr.data(), datastr.size()));
+    ASSERT_OK(file->Close());
+  }
+  std::shared_ptr<ReadableFile> file;
+  ASSERT_OK(ReadableFile::Open(path, &file));
+  std::shared_ptr<BufferedInputStream> stream;
+  ASSERT_OK(BufferedInputStream::Create(file, &stream));
+  ASSERT_EQ(BufferedInputStream::kDefaultBufferSize, stream->buffer_size());
+
+  std::string contents;
+  std::shared_ptr<Buffer> buffer;
+  do {
+    ASSERT_OK(stream->Read(333, &buffer));
+    contents += AsString(*buffer);
+  } while (buffer->size() > 0);
+  ASSERT_EQ(datastr, contents);
+
+  ASSERT_OK(stream->Close());
+  std::remove(path.c_str());
+}
+
 }  // namespace io
 }  // namespace arrow
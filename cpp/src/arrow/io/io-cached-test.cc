@@ -0,0 +1,122 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/io/cached.h"
+#include "arrow/io/file.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/status.h"
+#include "arrow/test-util.h"
+
+namespace arrow {
+namespace io {
+
+class TestCachedFileSystem : public ::testing::Test {
+ public:
+  void SetUp() override {
+    local_fs_ = std::make_shared<LocalFileSystem>();
+    root_ = "arrow-test-cached-fs";
+    DeleteRoot();
+    ASSERT_OK(local_fs_->MakeDirectory(root_ + "/a"));
+  }
+
+  void TearDown() override { DeleteRoot(); }
+
+  void DeleteRoot() {
+    FileStatistics stat;
+    if (local_fs_->Stat(root_, &stat).ok()) {
+      ASSERT_OK(local_fs_->DeleteDirectory(root_));
+    }
+  }
+
+ protected:
+  std::shared_ptr<LocalFileSystem> local_fs_;
+  std::string root_;
+};
+
+TEST_F(TestCachedFileSystem, Hits) {
+  CachedFileSystem fs(local_fs_, 3600);
+
+  FileStatistics stat;
+  ASSERT_OK(fs.Stat(root_ + "/a", &stat));
+  ASSERT_EQ(ObjectType::DIRECTORY, stat.kind);
+  ASSERT_OK(fs.Stat(root_ + "/a", &stat));
+  ASSERT_EQ(ObjectType::DIRECTORY, stat.kind);
+
+  std::vector<std::string> listing = {"kept"};
+  ASSERT_OK(fs.GetChildren(root_, &listing));
+  ASSERT_OK(fs.GetChildren(root_, &listing));
+  ASSERT_EQ(std::vector<std::string>({"kept", root_ + "/a", root_ + "/a"}), listing);
+
+  ASSERT_EQ(2, fs.num_hits());
+  ASSERT_EQ(2, fs.num_misses());
+
+  // Errors are not kept
+  ASSERT_RAISES(IOError, fs.Stat(root_ + "/b", &stat));
+  ASSERT_RAISES(IOError, fs.Stat(root_ + "/b", &stat));
+  ASSERT_EQ(4, fs.num_misses());
+}
+
+TEST_F(TestCachedFileSystem, Invalidation) {
+  CachedFileSystem fs(local_fs_, 3600);
+
+  std::vector<std::string> listing;
+  ASSERT_OK(fs.GetChildren(root_, &listing));
+  ASSERT_EQ(1, listing.size());
+
+  // Changes through the cached file system drop the entries
+  ASSERT_OK(fs.MakeDirectory(root_ + "/b"));
+  listing.clear();
+  ASSERT_OK(fs.GetChildren(root_, &listing));
+  ASSERT_EQ(std::vector<std::string>({root_ + "/a", root_ + "/b"}), listing);
+
+  // Changes made otherwise are not seen until then
+  ASSERT_OK(local_fs_->MakeDirectory(root_ + "/c"));
+  listing.clear();
+  ASSERT_OK(fs.GetChildren(root_, &listing));
+  ASSERT_EQ(2, listing.size());
+  fs.Invalidate();
+  listing.clear();
+  ASSERT_OK(fs.GetChildren(root_, &listing));
+  ASSERT_EQ(3, listing.size());
+}
+
+TEST_F(TestCachedFileSystem, Expiry) {
+  CachedFileSystem fs(local_fs_, 0.05);
+
+  std::vector<std::string> listing;
+  ASSERT_OK(fs.GetChildren(root_, &listing));
+  ASSERT_EQ(1, listing.size());
+  ASSERT_OK(local_fs_->MakeDirectory(root_ + "/b"));
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  listing.clear();
+  ASSERT_OK(fs.GetChildren(root_, &listing));
+  ASSERT_EQ(2, listing.size());
+  ASSERT_EQ(0, fs.num_hits());
+  ASSERT_EQ(2, fs.num_misses());
+}
+
+}  // namespace io
+}  // namespace arrow
@@ -0,0 +1,247 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/buffer.h"
+#include "arrow/io/compressed.h"
+#include "arrow/io/memory.h"
+#include "arrow/memory_pool.h"
+#include "arrow/status.h"
+#include "arrow/test-util.h"
+#include "arrow/util/compression.h"
+
+namespace arrow {
+namespace io {
+
+std::vector<uint8_t> MakeRandomData(int data_size) {
+  std::vector<uint8_t> data(data_size);
+  test::random_bytes(data_size, 1234, data.data());
+  return data;
+}
+
+std::vector<uint8_t> MakeCompressibleData(int data_size) {
+  std::string base_data =
+      "Apache Arrow is a cross-language development platform for in-memory data";
+  int nrepeats = static_cast<int>(1 + data_size / base_data.size());
+
+  std::vector<uint8_t> data(base_data.size() * nrepeats);
+  for (int i = 0; i < nrepeats; ++i) {
+    std::memcpy(data.data() + i * base_data.size(), base_data.data(), base_data.size());
+  }
+  data.resize(data_size);
+  return data;
+}
+
+std::shared_ptr<Buffer> CompressDataOneShot(Codec* codec,
+                                            const std::vector<uint8_t>& data) {
+  int64_t max_compressed_len =
+      codec->MaxCompressedLen(static_cast<int64_t>(data.size()), data.data());
+  std::shared_ptr<ResizableBuffer> compressed;
+  ABORT_NOT_OK(AllocateResizableBuffer(default_memory_pool(), max_compressed_len,
+                                       &compressed));
+  int64_t compressed_len;
+  ABORT_NOT_OK(codec->Compress(static_cast<int64_t>(data.size()), data.data(),
+                               max_compressed_len, compressed->mutable_data(),
+                               &compressed_len));
+  ABORT_NOT_OK(compressed->Resize(compressed_len));
+  return compressed;
+}
+
+// Read a compressed input stream to its end in reads of read_size bytes
+Status ReadAll(InputStream* stream, int64_t read_size, std::vector<uint8_t>* out) {
+  out->clear();
+  while (true) {
+    std::shared_ptr<Buffer> buf;
+    RETURN_NOT_OK(stream->Read(read_size, &buf));
+    if (buf->size() == 0) {
+      return Status::OK();
+    }
+    out->insert(out->end(), buf->data(), buf->data() + buf->size());
+  }
+}
+
+void CheckCompressedInputStream(Codec* codec, const std::vector<uint8_t>& data) {
+  std::shared_ptr<Buffer> compressed = CompressDataOneShot(codec, data);
+  auto buffer_reader = std::make_shared<BufferReader>(compressed);
+  std::shared_ptr<CompressedInputStream> stream;
+  ASSERT_OK(CompressedInputStream::Make(codec, buffer_reader, &stream));
+
+  std::vector<uint8_t> decompressed;
+  ASSERT_OK(ReadAll(stream.get(), 1000, &decompressed));
+  ASSERT_EQ(data, decompressed);
+
+  int64_t position;
+  ASSERT_OK(stream->Tell(&position));
+  ASSERT_EQ(static_cast<int64_t>(data.size()), position);
+}
+
+void CheckCompressedOutputStream(Codec* codec, const std::vector<uint8_t>& data,
+                                 bool do_flush) {
+  std::shared_ptr<BufferOutputStream> buffer_writer;
+  ASSERT_OK(BufferOutputStream::Create(1024, default_memory_pool(), &buffer_writer));
+  std::shared_ptr<CompressedOutputStream> stream;
+  ASSERT_OK(CompressedOutputStream::Make(codec, buffer_writer, &stream));
+
+  // Write in pieces of growing sizes
+  const uint8_t* input = data.data();
+  int64_t input_len = static_cast<int64_t>(data.size());
+  int64_t write_size = 1;
+  while (input_len > 0) {
+    int64_t nbytes = std::min(write_size, input_len);
+    ASSERT_OK(stream->Write(input, nbytes));
+    input += nbytes;
+    input_len -= nbytes;
+    write_size *= 3;
+    if (do_flush) {
+      ASSERT_OK(stream->Flush());
+    }
+  }
+  int64_t position;
+  ASSERT_OK(stream->Tell(&position));
+  ASSERT_EQ(static_cast<int64_t>(data.size()), position);
+  ASSERT_OK(stream->Close());
+
+  std::shared_ptr<Buffer> compressed;
+  ASSERT_OK(buffer_writer->Finish(&compressed));
+
+  auto buffer_reader = std::make_shared<BufferReader>(compressed);
+  std::shared_ptr<CompressedInputStream> input_stream;
+  ASSERT_OK(CompressedInputStream::Make(codec, buffer_reader, &input_stream));
+  std::vector<uint8_t> decompressed;
+  ASSERT_OK(ReadAll(input_stream.get(), 12345, &decompressed));
+  ASSERT_EQ(data, decompressed);
+}
+
+class CompressedStreamTest : public ::testing::TestWithParam<Compression::type> {
+ protected:
+  void SetUp() override { ASSERT_OK(Codec::Create(GetParam(), &codec_)); }
+
+  std::unique_ptr<Codec> codec_;
+};
+
+TEST_P(CompressedStreamTest, InputCompressibleData) {
+  CheckCompressedInputStream(codec_.get(), MakeCompressibleData(1000000));
+}
+
+TEST_P(CompressedStreamTest, InputRandomData) {
+  CheckCompressedInputStream(codec_.get(), MakeRandomData(200000));
+}
+
+TEST_P(CompressedStreamTest, InputEmptyData) {
+  CheckCompressedInputStream(codec_.get(), std::vector<uint8_t>());
+}
+
+TEST_P(CompressedStreamTest, InputConcatenatedStreams) {
+  auto data1 = MakeCompressibleData(100000);
+  auto data2 = MakeRandomData(100000);
+  std::shared_ptr<Buffer> compressed1 = CompressDataOneShot(codec_.get(), data1);
+  std::shared_ptr<Buffer> compressed2 = CompressDataOneShot(codec_.get(), data2);
+  std::vector<uint8_t> concatenated(compressed1->data(),
+                                    compressed1->data() + compressed1->size());
+  concatenated.insert(concatenated.end(), compressed2->data(),
+                      compressed2->data() + compressed2->size());
+
+  auto buffer_reader = std::make_shared<BufferReader>(
+      std::make_shared<Buffer>(concatenated.data(), concatenated.size()));
+  std::shared_ptr<CompressedInputStream> stream;
+  ASSERT_OK(CompressedInputStream::Make(codec_.get(), buffer_reader, &stream));
+  std::vector<uint8_t> decompressed;
+  ASSERT_OK(ReadAll(stream.get(), 777, &decompressed));
+
+  data1.insert(data1.end(), data2.begin(), data2.end());
+  ASSERT_EQ(data1, decompressed);
+}
+
+TEST_P(CompressedStreamTest, InputTruncatedData) {
+  std::shared_ptr<Buffer> compressed =
+      CompressDataOneShot(codec_.get(), MakeRandomData(100000));
+  auto truncated = SliceBuffer(compressed, 0, compressed->size() / 2);
+  auto buffer_reader = std::make_shared<BufferReader>(truncated);
+  std::shared_ptr<CompressedInputStream> stream;
+  ASSERT_OK(CompressedInputStream::Make(codec_.get(), buffer_reader, &stream));
+  std::vector<uint8_t> decompressed;
+  ASSERT_RAISES(IOError, ReadAll(stream.get(), 1000, &decompressed));
+}
+
+TEST_P(CompressedStreamTest, OutputCompressibleData) {
+  CheckCompressedOutputStream(codec_.get(), MakeCompressibleData(1000000), false);
+}
+
+TEST_P(CompressedStreamTest, OutputRandomData) {
+  CheckCompressedOutputStream(codec_.get(), MakeRandomData(200000), false);
+}
+
+TEST_P(CompressedStreamTest, OutputFlush) {
+  CheckCompressedOutputStream(codec_.get(), MakeCompressibleData(100000), true);
+}
+
+TEST_P(CompressedStreamTest, OutputFlushedDataIsReadable) {
+  // The raw stream stays open, so that the compressed one can be closed after
+  std::shared_ptr<ResizableBuffer> sink_buffer;
+  ASSERT_OK(AllocateResizableBuffer(default_memory_pool(), 1 << 20, &sink_buffer));
+  auto buffer_writer = std::make_shared<FixedSizeBufferWriter>(sink_buffer);
+  std::shared_ptr<CompressedOutputStream> stream;
+  ASSERT_OK(CompressedOutputStream::Make(codec_.get(), buffer_writer, &stream));
+  auto data = MakeCompressibleData(10000);
+  ASSERT_OK(stream->Write(data.data(), static_cast<int64_t>(data.size())));
+  ASSERT_OK(stream->Flush());
+
+  // The stream is not ended, yet everything written so far can be read back
+  int64_t flushed_size;
+  ASSERT_OK(buffer_writer->Tell(&flushed_size));
+  std::shared_ptr<Decompressor> decompressor;
+  ASSERT_OK(codec_->MakeDecompressor(&decompressor));
+  std::shared_ptr<Buffer> compressed = SliceBuffer(sink_buffer, 0, flushed_size);
+
+  std::vector<uint8_t> decompressed(data.size());
+  int64_t bytes_read, bytes_written;
+  bool need_more_output;
+  ASSERT_OK(decompressor->Decompress(compressed->size(), compressed->data(),
+                                     static_cast<int64_t>(decompressed.size()),
+                                     decompressed.data(), &bytes_read, &bytes_written,
+                                     &need_more_output));
+  ASSERT_EQ(compressed->size(), bytes_read);
+  ASSERT_EQ(static_cast<int64_t>(data.size()), bytes_written);
+  ASSERT_EQ(data, decompressed);
+  ASSERT_FALSE(decompressor->IsFinished());
+}
+
+INSTANTIATE_TEST_CASE_P(TestCompressedStreams, CompressedStreamTest,
+                        ::testing::Values(Compression::GZIP, Compression::ZSTD,
+                                          Compression::BROTLI));
+
+TEST(TestCompressedStreams, UnsupportedCodec) {
+  std::unique_ptr<Codec> codec;
+  ASSERT_OK(Codec::Create(Compression::SNAPPY, &codec));
+  auto buffer_reader =
+      std::make_shared<BufferReader>(std::make_shared<Buffer>(nullptr, 0));
+  std::shared_ptr<CompressedInputStream> stream;
+  ASSERT_RAISES(NotImplemented,
+                CompressedInputStream::Make(codec.get(), buffer_reader, &stream));
+}
+
+}  // namespace io
+}  // namespace arrow
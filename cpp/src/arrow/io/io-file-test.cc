@@ -33,6 +33,7 @@
 #include "arrow/io/file.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/io/test-common.h"
+#include "arrow/io/uring.h"
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
 #include "arrow/test-util.h"
@@ -266,6 +267,33 @@ TEST_F(TestFileOutputStream, Append) {
   AssertFileContents(path_, "testdata");
 }
 
+TEST_F(TestFileOutputStream, Writev) {
+  OpenFile();
+
+  // More buffers than a single writev call takes, some of them empty
+  std::vector<std::shared_ptr<Buffer>> buffers;
+  std::string expected;
+  for (int i = 0; i < 3000; ++i) {
+    std::string data = std::to_string(i) + (i % 3 == 0 ? "" : ",");
+    if (i % 7 == 0) {
+      data.clear();
+    }
+    std::shared_ptr<Buffer> buffer;
+    ASSERT_OK(Buffer::FromString(data, &buffer));
+    buffers.push_back(buffer);
+    expected += data;
+  }
+  ASSERT_OK(file_->Write("head", 4));
+  ASSERT_OK(file_->Writev(buffers));
+  ASSERT_OK(file_->Writev({}));
+
+  int64_t position;
+  ASSERT_OK(file_->Tell(&position));
+  ASSERT_EQ(static_cast<int64_t>(expected.size()) + 4, position);
+  ASSERT_OK(file_->Close());
+  AssertFileContents(path_, "head" + expected);
+}
+
 // ----------------------------------------------------------------------
 // File input tests
 
@@ -416,6 +444,61 @@ TEST_F(TestReadableFile, ReadAt) {
   ASSERT_TRUE(buffer2->Equals(expected));
 }
 
+TEST_F(TestReadableFile, ReadRanges) {
+  std::string data;
+  for (int i = 0; i < 10000; ++i) {
+    data += std::to_string(i);
+  }
+  {
+    std::ofstream stream(path_.c_str());
+    stream << data;
+  }
+  OpenFile();
+  const int64_t size = static_cast<int64_t>(data.size());
+
+  // Unordered, overlapping, and past the end of the file
+  const std::vector<ReadRange> ranges = {{5000, 100}, {10, 20},  {0, 5},
+                                         {20, 30},    {100, 10}, {size - 5, 10},
+                                         {size + 10, 5}};
+  for (bool use_threads : {false, true}) {
+    ReadRangesOptions options;
+    options.hole_size_limit = 64;
+    options.use_threads = use_threads;
+    std::vector<std::shared_ptr<Buffer>> buffers;
+    ASSERT_OK(file_->ReadRanges(ranges, options, &buffers));
+    ASSERT_EQ(ranges.size(), buffers.size());
+    for (size_t i = 0; i < ranges.size(); ++i) {
+      const auto& range = ranges[i];
+      const std::string expected =
+          range.offset < size ? data.substr(range.offset, range.length) : "";
+      ASSERT_EQ(expected, std::string(reinterpret_cast<const char*>(buffers[i]->data()),
+                                      buffers[i]->size()));
+    }
+  }
+}
+
+TEST(CoalesceReadRanges, Basics) {
+  auto check = [](std::vector<ReadRange> ranges, int64_t hole_size_limit,
+                  int64_t range_size_limit, std::vector<ReadRange> expected) {
+    auto merged =
+        ::arrow::internal::CoalesceReadRanges(ranges, hole_size_limit, range_size_limit);
+    ASSERT_EQ(expected.size(), merged.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+      ASSERT_EQ(expected[i].offset, merged[i].offset) << i;
+      ASSERT_EQ(expected[i].length, merged[i].length) << i;
+    }
+  };
+  check({}, 10, 100, {});
+  check({{110, 10}, {0, 10}, {15, 5}}, 10, 100, {{0, 20}, {110, 10}});
+  // Overlapping and contained ranges
+  check({{0, 50}, {10, 5}, {40, 20}}, 0, 100, {{0, 60}});
+  // Adjacent ranges are merged even without holes allowed
+  check({{0, 10}, {10, 10}, {21, 10}}, 0, 100, {{0, 20}, {21, 10}});
+  // But not beyond the size limit, unless they overlap
+  check({{0, 60}, {60, 60}, {100, 30}}, 10, 100, {{0, 60}, {60, 70}});
+  check({{0, 300}}, 10, 100, {{0, 300}});
+}
+
 TEST_F(TestReadableFile, NonExistentFile) {
   std::string path = "0xDEADBEEF.txt";
   Status s = ReadableFile::Open(path, &file_);
@@ -505,6 +588,241 @@ TEST_F(TestReadableFile, ThreadSafety) {
   ASSERT_EQ(niter * 2, correct_count);
 }
 
+TEST_F(TestReadableFile, ReadAtLeavesPosition) {
+  MakeTestFile();
+  OpenFile();
+
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(file_->Seek(2));
+  ASSERT_OK(file_->ReadAt(5, 3, &buffer));
+  ASSERT_OK(file_->Read(2, &buffer));
+  ASSERT_EQ(0, std::memcmp(buffer->data(), "st", 2));
+  int64_t position;
+  ASSERT_OK(file_->Tell(&position));
+  ASSERT_EQ(4, position);
+}
+
+TEST_F(TestReadableFile, ConcurrentReadAndReadAt) {
+  std::string data;
+  for (int i = 0; i < 10000; ++i) {
+    data += std::to_string(i % 10);
+  }
+  {
+    std::ofstream stream(path_.c_str());
+    stream << data;
+  }
+  OpenFile();
+
+  std::atomic<int> correct_count(0);
+  const int niter = 2000;
+  auto read_at = [&]() {
+    std::shared_ptr<Buffer> buffer;
+    for (int i = 0; i < niter; ++i) {
+      const int64_t offset = (i * 37) % 9990;
+      ASSERT_OK(file_->ReadAt(offset, 10, &buffer));
+      if (0 == std::memcmp(data.data() + offset, buffer->data(), 10)) {
+        correct_count += 1;
+      }
+    }
+  };
+  std::thread thread1(read_at);
+  std::thread thread2(read_at);
+
+  // Sequential reads on this thread are unaffected by the others
+  std::string contents;
+  std::shared_ptr<Buffer> buffer;
+  do {
+    ASSERT_OK(file_->Read(7, &buffer));
+    contents.append(reinterpret_cast<const char*>(buffer->data()), buffer->size());
+  } while (buffer->size() > 0);
+  thread1.join();
+  thread2.join();
+
+  ASSERT_EQ(data, contents);
+  ASSERT_EQ(niter * 2, correct_count);
+}
+
+// ----------------------------------------------------------------------
+// io_uring file tests
+
+class TestUringReadableFile : public FileTestFixture,
+                              public ::testing::WithParamInterface<bool> {
+ public:
+  void SetUp() override {
+    FileTestFixture::SetUp();
+    for (int i = 0; i < 100000; ++i) {
+      data_ += std::to_string(i);
+    }
+    std::ofstream stream(path_.c_str());
+    stream << data_;
+  }
+
+  void OpenFile() {
+    UringOptions options;
+    options.queue_depth = 4;
+    options.block_size = 3 * 4096;
+    options.direct_io = GetParam();
+    ASSERT_OK(UringReadableFile::Open(path_, options, default_memory_pool(), &file_));
+  }
+
+  std::string Substr(int64_t offset, int64_t length) {
+    return offset < size() ? data_.substr(offset, length) : "";
+  }
+
+  int64_t size() const { return static_cast<int64_t>(data_.size()); }
+
+ protected:
+  std::string data_;
+  std::shared_ptr<UringReadableFile> file_;
+};
+
+static std::string BufferToString(const Buffer& buffer) {
+  return std::string(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+}
+
+TEST_P(TestUringReadableFile, Reads) {
+  if (!UringReadableFile::IsSupported()) {
+    return;
+  }
+  OpenFile();
+  int64_t file_size;
+  ASSERT_OK(file_->GetSize(&file_size));
+  ASSERT_EQ(size(), file_size);
+
+  // Spanning several blocks, more than fit in the queue
+  std::vector<char> out(size());
+  int64_t bytes_read;
+  ASSERT_OK(file_->ReadAt(1000, 100000, &bytes_read, out.data()));
+  ASSERT_EQ(100000, bytes_read);
+  ASSERT_EQ(Substr(1000, 100000), std::string(out.data(), bytes_read));
+
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(file_->ReadAt(size() - 10, 100, &buffer));
+  ASSERT_EQ(Substr(size() - 10, 100), BufferToString(*buffer));
+  ASSERT_OK(file_->ReadAt(size() + 10, 100, &buffer));
+  ASSERT_EQ(0, buffer->size());
+
+  // Sequential reads
+  ASSERT_OK(file_->Seek(5));
+  ASSERT_OK(file_->Read(20, &buffer));
+  ASSERT_EQ(Substr(5, 20), BufferToString(*buffer));
+  ASSERT_OK(file_->Read(size(), &bytes_read, out.data()));
+  ASSERT_EQ(Substr(25, size()), std::string(out.data(), bytes_read));
+  int64_t position;
+  ASSERT_OK(file_->Tell(&position));
+  ASSERT_EQ(size(), position);
+
+  ASSERT_OK(file_->Close());
+  ASSERT_RAISES(IOError, file_->ReadAt(0, 10, &buffer));
+}
+
+TEST_P(TestUringReadableFile, ReadRanges) {
+  if (!UringReadableFile::IsSupported()) {
+    return;
+  }
+  OpenFile();
+  const std::vector<ReadRange> ranges = {{200000, 50000}, {10, 20}, {0, 5},
+                                         {20, 30},        {100, 10}, {size() - 5, 10},
+                                         {size() + 10, 5}};
+  ReadRangesOptions options;
+  options.hole_size_limit = 64;
+  std::vector<std::shared_ptr<Buffer>> buffers;
+  ASSERT_OK(file_->ReadRanges(ranges, options, &buffers));
+  ASSERT_EQ(ranges.size(), buffers.size());
+  for (size_t i = 0; i < ranges.size(); ++i) {
+    ASSERT_EQ(Substr(ranges[i].offset, ranges[i].length), BufferToString(*buffers[i]))
+        << i;
+  }
+}
+
+TEST_P(TestUringReadableFile, ThreadSafety) {
+  if (!UringReadableFile::IsSupported()) {
+    return;
+  }
+  OpenFile();
+  std::atomic<int> correct_count(0);
+  const int niter = 1000;
+  auto read_data = [&]() {
+    std::shared_ptr<Buffer> buffer;
+    for (int i = 0; i < niter; ++i) {
+      const int64_t offset = (i * 7919) % size();
+      ASSERT_OK(file_->ReadAt(offset, 100, &buffer));
+      if (Substr(offset, 100) == BufferToString(*buffer)) {
+        correct_count += 1;
+      }
+    }
+  };
+  std::thread thread1(read_data);
+  std::thread thread2(read_data);
+  thread1.join();
+  thread2.join();
+  ASSERT_EQ(niter * 2, correct_count);
+}
+
+INSTANTIATE_TEST_CASE_P(DirectIO, TestUringReadableFile, ::testing::Bool());
+
+// ----------------------------------------------------------------------
+// LocalFileSystem tests
+
+class TestLocalFileSystem : public ::testing::Test {
+ public:
+  void SetUp() override {
+    root_ = "arrow-test-local-fs";
+    if (FileExists(root_)) {
+      ASSERT_OK(fs_.DeleteDirectory(root_));
+    }
+  }
+
+  void TearDown() override {
+    if (FileExists(root_)) {
+      ASSERT_OK(fs_.DeleteDirectory(root_));
+    }
+  }
+
+  void WriteFile(const std::string& path, const std::string& data) {
+    std::shared_ptr<FileOutputStream> stream;
+    ASSERT_OK(FileOutputStream::Open(path, &stream));
+    ASSERT_OK(stream->Write(data.data(), static_cast<int64_t>(data.size())));
+    ASSERT_OK(stream->Close());
+  }
+
+ protected:
+  LocalFileSystem fs_;
+  std::string root_;
+};
+
+TEST_F(TestLocalFileSystem, Directories) {
+  ASSERT_OK(fs_.MakeDirectory(root_ + "/a/b"));
+  // Existing directories are left alone
+  ASSERT_OK(fs_.MakeDirectory(root_ + "/a"));
+  ASSERT_NO_FATAL_FAILURE(WriteFile(root_ + "/a/data", "some data"));
+
+  std::vector<std::string> children;
+  ASSERT_OK(fs_.GetChildren(root_ + "/a", &children));
+  ASSERT_EQ(std::vector<std::string>({root_ + "/a/b", root_ + "/a/data"}), children);
+
+  FileStatistics stat;
+  ASSERT_OK(fs_.Stat(root_ + "/a/b", &stat));
+  ASSERT_EQ(ObjectType::DIRECTORY, stat.kind);
+  ASSERT_OK(fs_.Stat(root_ + "/a/data", &stat));
+  ASSERT_EQ(ObjectType::FILE, stat.kind);
+  ASSERT_EQ(9, stat.size);
+  ASSERT_RAISES(IOError, fs_.Stat(root_ + "/a/missing", &stat));
+  ASSERT_RAISES(IOError, fs_.MakeDirectory(root_ + "/a/data/c"));
+
+  ASSERT_OK(fs_.Rename(root_ + "/a/data", root_ + "/a/b/moved"));
+  std::shared_ptr<RandomAccessFile> file;
+  ASSERT_RAISES(IOError, fs_.OpenInputFile(root_ + "/a/data", &file));
+  ASSERT_OK(fs_.OpenInputFile(root_ + "/a/b/moved", &file));
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(file->Read(4, &buffer));
+  ASSERT_EQ("some", std::string(reinterpret_cast<const char*>(buffer->data()), 4));
+  ASSERT_OK(file->Close());
+
+  ASSERT_OK(fs_.DeleteDirectory(root_ + "/a"));
+  ASSERT_FALSE(FileExists(root_ + "/a"));
+}
+
 // ----------------------------------------------------------------------
 // Pipe I/O tests using FileOutputStream
 // (cannot test using ReadableFile as it currently requires seeking)
@@ -909,6 +1227,85 @@ TEST_F(TestMemoryMappedFile, ReadOnly) {
   ASSERT_OK(rommap->Close());
 }
 
+TEST_F(TestMemoryMappedFile, AdviseAndPopulate) {
+  const int64_t buffer_size = 1 << 16;
+  std::vector<uint8_t> buffer(buffer_size);
+  test::random_bytes(buffer_size, 0, buffer.data());
+
+  std::string path = "io-memory-map-advise-test";
+  std::shared_ptr<MemoryMappedFile> rwmmap;
+  ASSERT_OK(InitMemoryMap(buffer_size, path, &rwmmap));
+  ASSERT_OK(rwmmap->Write(buffer.data(), buffer_size));
+  ASSERT_OK(rwmmap->Close());
+
+  std::shared_ptr<MemoryMappedFile> mmap;
+  ASSERT_OK(MemoryMappedFile::Open(path, FileMode::READ, true /* populate */, &mmap));
+  // Unaligned ranges, and ranges past the end of the map
+  ASSERT_OK(mmap->Advise(100, 5000, MemoryAdvice::SEQUENTIAL));
+  ASSERT_OK(mmap->Advise(0, buffer_size, MemoryAdvice::RANDOM));
+  ASSERT_OK(mmap->Advise(buffer_size - 10, 100, MemoryAdvice::NORMAL));
+  ASSERT_OK(mmap->Advise(buffer_size + 10, 100, MemoryAdvice::WILL_NEED));
+  ASSERT_OK(mmap->WillNeed({{10, 4000}, {20000, 30000}}));
+
+  std::shared_ptr<Buffer> out_buffer;
+  ASSERT_OK(mmap->ReadAt(0, buffer_size, &out_buffer));
+  ASSERT_EQ(0, memcmp(out_buffer->data(), buffer.data(), buffer_size));
+}
+
+TEST_F(TestMemoryMappedFile, OutputStreamGrows) {
+  std::string path = "io-memory-map-output-stream-test";
+  AppendFile(path);
+
+  std::shared_ptr<MemoryMappedOutputStream> stream;
+  ASSERT_RAISES(Invalid, MemoryMappedOutputStream::Open(path, 0, &stream));
+  ASSERT_OK(MemoryMappedOutputStream::Open(path, 100, &stream));
+  ASSERT_EQ(100, stream->capacity());
+
+  std::string expected;
+  for (int i = 0; i < 1000; ++i) {
+    const std::string chunk = std::to_string(i) + ",";
+    ASSERT_OK(stream->Write(chunk));
+    expected += chunk;
+  }
+  // A write larger than twice the capacity
+  const std::string large(10 * stream->capacity(), 'x');
+  ASSERT_OK(stream->Write(large));
+  expected += large;
+  ASSERT_GE(stream->capacity(), static_cast<int64_t>(expected.size()));
+
+  int64_t position;
+  ASSERT_OK(stream->Tell(&position));
+  ASSERT_EQ(static_cast<int64_t>(expected.size()), position);
+  ASSERT_OK(stream->Close());
+  ASSERT_OK(stream->Close());
+  ASSERT_RAISES(IOError, stream->Write(large));
+
+  // Truncated to the bytes written
+  std::shared_ptr<ReadableFile> file;
+  ASSERT_OK(ReadableFile::Open(path, &file));
+  int64_t size;
+  ASSERT_OK(file->GetSize(&size));
+  ASSERT_EQ(static_cast<int64_t>(expected.size()), size);
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(file->Read(size, &buffer));
+  ASSERT_EQ(expected, std::string(reinterpret_cast<const char*>(buffer->data()), size));
+}
+
+TEST_F(TestMemoryMappedFile, OutputStreamEmpty) {
+  std::string path = "io-memory-map-output-stream-empty-test";
+  AppendFile(path);
+  {
+    std::shared_ptr<MemoryMappedOutputStream> stream;
+    ASSERT_OK(MemoryMappedOutputStream::Open(path, &stream));
+    // Closed on destruction
+  }
+  std::shared_ptr<ReadableFile> file;
+  ASSERT_OK(ReadableFile::Open(path, &file));
+  int64_t size;
+  ASSERT_OK(file->GetSize(&size));
+  ASSERT_EQ(0, size);
+}
+
 TEST_F(TestMemoryMappedFile, DISABLED_ReadWriteOver4GbFile) {
   // ARROW-1096
   const int64_t buffer_size = 1000 * 1000;
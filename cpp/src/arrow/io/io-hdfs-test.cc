@@ -398,6 +398,87 @@ TYPED_TEST(TestHadoopFileSystem, LargeFile) {
   ASSERT_EQ(size, bytes_read);
 }
 
+TYPED_TEST(TestHadoopFileSystem, ReadOptions) {
+  SKIP_IF_NO_DRIVER();
+
+  ASSERT_OK(this->MakeScratchDir());
+
+  auto path = this->ScratchPath("test-read-options");
+  const int size = 1000000;
+
+  std::vector<uint8_t> data = RandomData(size);
+  ASSERT_OK(this->WriteDummyFile(path, data.data(), size));
+
+  HdfsReadOptions options;
+  options.parallel_chunk_size = 100000;
+  options.readahead_size = 30000;
+  std::shared_ptr<HdfsReadableFile> file;
+  ASSERT_OK(this->client_->OpenReadable(path, 1 << 16, options, &file));
+
+  // Split into concurrent reads, the last one short
+  std::vector<uint8_t> buffer(size);
+  int64_t bytes_read = 0;
+  ASSERT_OK(file->ReadAt(12345, size, &bytes_read, buffer.data()));
+  ASSERT_EQ(size - 12345, bytes_read);
+  ASSERT_EQ(0, std::memcmp(buffer.data(), data.data() + 12345, bytes_read));
+
+  // Sequential reads through the read-ahead buffer, and around it
+  int64_t position = 0;
+  for (int64_t nbytes : {1000, 50000, 7, 29000, 100000, 3}) {
+    ASSERT_OK(file->Read(nbytes, &bytes_read, buffer.data()));
+    ASSERT_EQ(nbytes, bytes_read);
+    ASSERT_EQ(0, std::memcmp(buffer.data(), data.data() + position, nbytes));
+    position += nbytes;
+  }
+  int64_t tell;
+  ASSERT_OK(file->Tell(&tell));
+  ASSERT_EQ(position, tell);
+
+  ASSERT_OK(file->Seek(size - 10));
+  ASSERT_OK(file->Read(100, &bytes_read, buffer.data()));
+  ASSERT_EQ(10, bytes_read);
+  ASSERT_EQ(0, std::memcmp(buffer.data(), data.data() + size - 10, bytes_read));
+  ASSERT_OK(file->Read(100, &bytes_read, buffer.data()));
+  ASSERT_EQ(0, bytes_read);
+}
+
+TYPED_TEST(TestHadoopFileSystem, BackgroundWrites) {
+  SKIP_IF_NO_DRIVER();
+
+  ASSERT_OK(this->MakeScratchDir());
+
+  auto path = this->ScratchPath("test-background-writes");
+  const int size = 1000000;
+  std::vector<uint8_t> data = RandomData(size);
+
+  HdfsWriteOptions options;
+  options.background_buffer_size = 65536;
+  options.background_queue_size = 2;
+  std::shared_ptr<HdfsOutputStream> out;
+  ASSERT_OK(this->client_->OpenWriteable(path, false, 0, 0, 0, options, &out));
+
+  // Writes smaller and larger than the buffers
+  int64_t position = 0;
+  for (int64_t nbytes : {1000, 200000, 7, 65536, 300000}) {
+    ASSERT_OK(out->Write(data.data() + position, nbytes));
+    position += nbytes;
+  }
+  int64_t tell;
+  ASSERT_OK(out->Tell(&tell));
+  ASSERT_EQ(position, tell);
+  ASSERT_OK(out->Flush());
+  ASSERT_OK(out->Write(data.data() + position, size - position));
+  ASSERT_OK(out->Close());
+
+  std::shared_ptr<HdfsReadableFile> file;
+  ASSERT_OK(this->client_->OpenReadable(path, &file));
+  std::vector<uint8_t> buffer(size);
+  int64_t bytes_read = 0;
+  ASSERT_OK(file->ReadAt(0, size, &bytes_read, buffer.data()));
+  ASSERT_EQ(size, bytes_read);
+  ASSERT_EQ(0, std::memcmp(buffer.data(), data.data(), size));
+}
+
 TYPED_TEST(TestHadoopFileSystem, RenameFile) {
   SKIP_IF_NO_DRIVER();
   ASSERT_OK(this->MakeScratchDir());
@@ -0,0 +1,167 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/buffer.h"
+#include "arrow/io/instrumented.h"
+#include "arrow/io/memory.h"
+#include "arrow/status.h"
+#include "arrow/test-util.h"
+
+namespace arrow {
+namespace io {
+
+static std::string AsString(const Buffer& buffer) {
+  return std::string(reinterpret_cast<const char*>(buffer.data()),
+                     static_cast<size_t>(buffer.size()));
+}
+
+TEST(TestIOStatistics, SizeBucket) {
+  ASSERT_EQ(0, IOStatistics::SizeBucket(0));
+  ASSERT_EQ(1, IOStatistics::SizeBucket(1));
+  ASSERT_EQ(2, IOStatistics::SizeBucket(2));
+  ASSERT_EQ(2, IOStatistics::SizeBucket(3));
+  ASSERT_EQ(3, IOStatistics::SizeBucket(4));
+  ASSERT_EQ(13, IOStatistics::SizeBucket(4096));
+  ASSERT_EQ(IOStatistics::kNumSizeBuckets - 1,
+            IOStatistics::SizeBucket(int64_t(1) << 50));
+}
+
+class TestInstrumented : public ::testing::Test {
+ public:
+  void SetUp() override {
+    data_ = "0123456789abcdefghijklmnopqrstuvwxyz";
+    buffer_ = std::make_shared<Buffer>(data_);
+  }
+
+ protected:
+  std::string data_;
+  std::shared_ptr<Buffer> buffer_;
+};
+
+TEST_F(TestInstrumented, InputStream) {
+  InstrumentedInputStream stream(std::make_shared<BufferReader>(buffer_));
+
+  uint8_t out[16];
+  int64_t bytes_read;
+  for (int i = 0; i < 4; ++i) {
+    ASSERT_OK(stream.Read(4, &bytes_read, out));
+    ASSERT_EQ(4, bytes_read);
+  }
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(stream.Read(64, &buffer));
+  ASSERT_EQ(20, buffer->size());
+  ASSERT_EQ(data_.substr(16), AsString(*buffer));
+
+  int64_t position;
+  ASSERT_OK(stream.Tell(&position));
+  ASSERT_EQ(36, position);
+
+  IOStatistics stats = stream.statistics();
+  ASSERT_EQ(5, stats.num_reads);
+  ASSERT_EQ(36, stats.bytes_read);
+  ASSERT_GE(stats.read_nanos, 0);
+  ASSERT_EQ(4, stats.read_sizes[IOStatistics::SizeBucket(4)]);
+  ASSERT_EQ(1, stats.read_sizes[IOStatistics::SizeBucket(64)]);
+  ASSERT_EQ(0, stats.num_writes);
+  ASSERT_EQ(0, stats.num_errors);
+
+  stream.ResetStatistics();
+  stats = stream.statistics();
+  ASSERT_EQ(0, stats.num_reads);
+  ASSERT_EQ(0, stats.bytes_read);
+  ASSERT_EQ(0, stats.read_sizes[IOStatistics::SizeBucket(4)]);
+}
+
+TEST_F(TestInstrumented, RandomAccessFile) {
+  auto raw = std::make_shared<BufferReader>(buffer_);
+  InstrumentedRandomAccessFile file(raw);
+  ASSERT_EQ(raw, file.raw());
+  ASSERT_TRUE(file.supports_zero_copy());
+
+  int64_t size;
+  ASSERT_OK(file.GetSize(&size));
+  ASSERT_EQ(36, size);
+
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(file.ReadAt(10, 6, &buffer));
+  ASSERT_EQ("abcdef", AsString(*buffer));
+  ASSERT_OK(file.Seek(30));
+  ASSERT_OK(file.Read(16, &buffer));
+  ASSERT_EQ("uvwxyz", AsString(*buffer));
+  ASSERT_RAISES(IOError, file.Seek(-1));
+
+  std::vector<std::shared_ptr<Buffer>> buffers;
+  ASSERT_OK(file.ReadRanges({{0, 2}, {4, 2}, {8, 1}}, ReadRangesOptions(), &buffers));
+  ASSERT_EQ(3, buffers.size());
+  ASSERT_EQ("45", AsString(*buffers[1]));
+
+  IOStatistics stats = file.statistics();
+  ASSERT_EQ(5, stats.num_reads);
+  ASSERT_EQ(6 + 6 + 5, stats.bytes_read);
+  ASSERT_EQ(1, stats.read_sizes[IOStatistics::SizeBucket(6)]);
+  ASSERT_EQ(1, stats.read_sizes[IOStatistics::SizeBucket(16)]);
+  ASSERT_EQ(2, stats.read_sizes[IOStatistics::SizeBucket(2)]);
+  ASSERT_EQ(1, stats.read_sizes[IOStatistics::SizeBucket(1)]);
+  ASSERT_EQ(1, stats.num_seeks);
+  ASSERT_EQ(1, stats.num_errors);
+}
+
+TEST_F(TestInstrumented, OutputStream) {
+  std::shared_ptr<BufferOutputStream> raw;
+  ASSERT_OK(BufferOutputStream::Create(64, default_memory_pool(), &raw));
+  InstrumentedOutputStream stream(raw);
+  ASSERT_EQ(FileMode::WRITE, stream.mode());
+
+  ASSERT_OK(stream.Write(data_.data(), 10));
+  ASSERT_OK(stream.Write(data_.substr(10, 3)));
+  const std::string first = "abc", second = "defgh";
+  ASSERT_OK(
+      stream.Writev({std::make_shared<Buffer>(first), std::make_shared<Buffer>(second)}));
+  ASSERT_OK(stream.Flush());
+
+  int64_t position;
+  ASSERT_OK(stream.Tell(&position));
+  ASSERT_EQ(21, position);
+
+  std::shared_ptr<Buffer> written;
+  ASSERT_OK(raw->Finish(&written));
+  ASSERT_EQ(data_.substr(0, 13) + "abcdefgh", AsString(*written));
+  ASSERT_RAISES(IOError, stream.Write(data_.data(), 4));
+
+  IOStatistics stats = stream.statistics();
+  ASSERT_EQ(3, stats.num_writes);
+  ASSERT_EQ(21, stats.bytes_written);
+  // The writes of 10 and 8 bytes fall in the same bucket
+  ASSERT_EQ(2, stats.write_sizes[IOStatistics::SizeBucket(10)]);
+  ASSERT_EQ(1, stats.write_sizes[IOStatistics::SizeBucket(3)]);
+  ASSERT_EQ(0, stats.num_reads);
+  ASSERT_EQ(1, stats.num_errors);
+
+  const std::string summary = stats.ToString();
+  ASSERT_NE(std::string::npos, summary.find("writes: 3, 21 bytes")) << summary;
+  ASSERT_NE(std::string::npos, summary.find("[8, 16) bytes: 2")) << summary;
+}
+
+}  // namespace io
+}  // namespace arrow
@@ -30,6 +30,7 @@
 #include "arrow/status.h"
 #include "arrow/test-util.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/memory.h"
 
 namespace arrow {
 namespace io {
@@ -82,6 +83,114 @@ TEST_F(TestBufferOutputStream, WriteAfterFinish) {
   ASSERT_RAISES(IOError, stream_->Write(data));
 }
 
+static std::string AsString(const Buffer& buffer) {
+  return std::string(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+}
+
+TEST_F(TestBufferOutputStream, Writev) {
+  ASSERT_OK(stream_->Write("head"));
+  std::vector<std::shared_ptr<Buffer>> buffers;
+  std::string expected = "head";
+  for (int i = 0; i < 100; ++i) {
+    const std::string data(i, static_cast<char>('a' + i % 26));
+    std::shared_ptr<Buffer> buffer;
+    ASSERT_OK(Buffer::FromString(data, &buffer));
+    buffers.push_back(buffer);
+    expected += data;
+  }
+  ASSERT_OK(stream_->Writev(buffers));
+
+  int64_t position;
+  ASSERT_OK(stream_->Tell(&position));
+  ASSERT_EQ(static_cast<int64_t>(expected.size()), position);
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(checked_cast<BufferOutputStream*>(stream_.get())->Finish(&buffer));
+  ASSERT_EQ(expected, AsString(*buffer));
+  ASSERT_RAISES(IOError, stream_->Writev(buffers));
+}
+
+TEST(TestChunkedBufferOutputStream, Blocks) {
+  std::shared_ptr<ChunkedBufferOutputStream> stream;
+  ASSERT_RAISES(Invalid, ChunkedBufferOutputStream::Create(0, default_memory_pool(),
+                                                           &stream));
+  ASSERT_OK(ChunkedBufferOutputStream::Create(1000, default_memory_pool(), &stream));
+
+  std::string expected;
+  for (int i = 0; i < 500; ++i) {
+    const std::string chunk = std::to_string(i) + ",";
+    ASSERT_OK(stream->Write(chunk));
+    expected += chunk;
+  }
+  // A write spanning several blocks
+  const std::string large(2500, 'x');
+  ASSERT_OK(stream->Write(large));
+  expected += large;
+  int64_t position;
+  ASSERT_OK(stream->Tell(&position));
+  ASSERT_EQ(static_cast<int64_t>(expected.size()), position);
+
+  std::vector<std::shared_ptr<Buffer>> blocks;
+  ASSERT_OK(stream->Finish(&blocks));
+  ASSERT_EQ((expected.size() + 999) / 1000, blocks.size());
+  std::string contents;
+  for (size_t i = 0; i < blocks.size(); ++i) {
+    if (i + 1 < blocks.size()) {
+      ASSERT_EQ(1000, blocks[i]->size());
+    }
+    contents += AsString(*blocks[i]);
+  }
+  ASSERT_EQ(expected, contents);
+  ASSERT_RAISES(IOError, stream->Write(large));
+}
+
+TEST(TestChunkedBufferOutputStream, Contiguous) {
+  std::shared_ptr<ChunkedBufferOutputStream> stream;
+  ASSERT_OK(ChunkedBufferOutputStream::Create(1000, default_memory_pool(), &stream));
+  const std::string data(2345, 'y');
+  ASSERT_OK(stream->Write(data));
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(stream->Finish(&buffer));
+  ASSERT_EQ(data, AsString(*buffer));
+
+  // A single block is returned without copying
+  ASSERT_OK(ChunkedBufferOutputStream::Create(1000, default_memory_pool(), &stream));
+  ASSERT_OK(stream->Write(data.substr(0, 10)));
+  ASSERT_OK(stream->Finish(&buffer));
+  ASSERT_EQ(data.substr(0, 10), AsString(*buffer));
+
+  ASSERT_OK(ChunkedBufferOutputStream::Create(1000, default_memory_pool(), &stream));
+  ASSERT_OK(stream->Finish(&buffer));
+  ASSERT_EQ(0, buffer->size());
+}
+
+TEST(TestChunkedBufferOutputStream, Writev) {
+  std::shared_ptr<ChunkedBufferOutputStream> stream;
+  ASSERT_OK(ChunkedBufferOutputStream::Create(1000, default_memory_pool(), &stream));
+  std::shared_ptr<Buffer> small, large;
+  ASSERT_OK(Buffer::FromString(std::string(300, 's'), &small));
+  ASSERT_OK(Buffer::FromString(std::string(600, 'l'), &large));
+  ASSERT_OK(stream->Writev({small, large, small, small}));
+
+  int64_t position;
+  ASSERT_OK(stream->Tell(&position));
+  ASSERT_EQ(1500, position);
+
+  // The large buffer is appended as it is, between two shorter blocks
+  std::vector<std::shared_ptr<Buffer>> blocks;
+  ASSERT_OK(stream->Finish(&blocks));
+  ASSERT_EQ(3, blocks.size());
+  ASSERT_EQ(std::string(300, 's'), AsString(*blocks[0]));
+  ASSERT_EQ(large.get(), blocks[1].get());
+  ASSERT_EQ(std::string(600, 's'), AsString(*blocks[2]));
+  ASSERT_RAISES(IOError, stream->Writev({small}));
+
+  ASSERT_OK(ChunkedBufferOutputStream::Create(1000, default_memory_pool(), &stream));
+  ASSERT_OK(stream->Writev({large}));
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(stream->Finish(&buffer));
+  ASSERT_EQ(large.get(), buffer.get());
+}
+
 TEST(TestFixedSizeBufferWriter, Basics) {
   std::shared_ptr<Buffer> buffer;
   ASSERT_OK(AllocateBuffer(1024, &buffer));
@@ -130,6 +239,21 @@ TEST(TestBufferReader, RetainParentReference) {
   ASSERT_EQ(0, std::memcmp(slice2->data(), data.c_str() + 4, 6));
 }
 
+TEST(TestBufferReader, ReadRanges) {
+  std::string data = "data to read in ranges";
+  auto buffer = std::make_shared<Buffer>(data);
+  BufferReader reader(buffer);
+
+  std::vector<std::shared_ptr<Buffer>> buffers;
+  ASSERT_OK(reader.ReadRanges({{8, 4}, {0, 4}, {20, 10}}, ReadRangesOptions(), &buffers));
+  ASSERT_EQ(3, buffers.size());
+  // Zero-copy slices of the buffer
+  ASSERT_EQ(buffer->data() + 8, buffers[0]->data());
+  ASSERT_EQ(4, buffers[0]->size());
+  ASSERT_EQ(buffer->data(), buffers[1]->data());
+  ASSERT_EQ(2, buffers[2]->size());
+}
+
 TEST(TestMemcopy, ParallelMemcopy) {
   for (int i = 0; i < 5; ++i) {
     // randomize size so the memcopy alignment is tested
@@ -151,5 +275,37 @@ TEST(TestMemcopy, ParallelMemcopy) {
   }
 }
 
+TEST(TestMemcopy, BulkMemcopy) {
+  ASSERT_GE(internal::GetBulkMemcopyMaxThreads(), 1);
+
+  const int64_t total_size = 5 * 1024 * 1024 + 64;
+  std::shared_ptr<Buffer> src, dst;
+  ASSERT_OK(AllocateBuffer(total_size, &src));
+  ASSERT_OK(AllocateBuffer(total_size, &dst));
+  test::random_bytes(total_size, 0, src->mutable_data());
+
+  // Unaligned ends, and sizes on either side of the threading cutoff
+  for (int64_t offset : {0, 1, 17}) {
+    for (int64_t nbytes : {0, 63, 1024 * 1024, 5 * 1024 * 1024 + 3}) {
+      memset(dst->mutable_data(), 0, total_size);
+      internal::BulkMemcopy(dst->mutable_data() + offset, src->data() + 3, nbytes);
+      ASSERT_EQ(0, memcmp(dst->data() + offset, src->data() + 3, nbytes));
+      ASSERT_EQ(0, dst->data()[offset + nbytes]);
+
+      memset(dst->mutable_data(), 0, total_size);
+      internal::StreamingMemcopy(dst->mutable_data() + offset, src->data() + 3,
+                                 nbytes);
+      ASSERT_EQ(0, memcmp(dst->data() + offset, src->data() + 3, nbytes));
+      ASSERT_EQ(0, dst->data()[offset + nbytes]);
+    }
+  }
+
+  // Threads chosen automatically by default
+  memset(dst->mutable_data(), 0, total_size);
+  io::FixedSizeBufferWriter writer(dst);
+  ASSERT_OK(writer.Write(src->data(), total_size));
+  ASSERT_EQ(0, memcmp(dst->data(), src->data(), total_size));
+}
+
 }  // namespace io
 }  // namespace arrow
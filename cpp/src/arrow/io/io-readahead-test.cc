@@ -0,0 +1,201 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "arrow/buffer.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/io/memory.h"
+#include "arrow/io/readahead.h"
+#include "arrow/status.h"
+#include "arrow/test-util.h"
+
+namespace arrow {
+namespace io {
+
+static std::string AsString(const Buffer& buffer) {
+  return std::string(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+}
+
+// Counts the reads of the stream it wraps, failing those past a given
+// position
+class TestInputStream : public InputStream {
+ public:
+  explicit TestInputStream(std::shared_ptr<InputStream> raw,
+                           int64_t fail_at = std::numeric_limits<int64_t>::max())
+      : raw_(std::move(raw)), fail_at_(fail_at), num_reads_(0) {}
+
+  Status Close() override { return raw_->Close(); }
+
+  Status Tell(int64_t* position) const override { return raw_->Tell(position); }
+
+  Status Read(int64_t nbytes, int64_t* bytes_read, void* out) override {
+    return Status::NotImplemented("copying reads");
+  }
+
+  Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) override {
+    ++num_reads_;
+    int64_t position;
+    RETURN_NOT_OK(raw_->Tell(&position));
+    if (position + nbytes > fail_at_) {
+      return Status::IOError("read failed");
+    }
+    return raw_->Read(nbytes, out);
+  }
+
+  int num_reads() const { return num_reads_; }
+
+ private:
+  std::shared_ptr<InputStream> raw_;
+  int64_t fail_at_;
+  std::atomic<int> num_reads_;
+};
+
+class TestReadaheadInputStream : public ::testing::Test {
+ public:
+  void MakeStream(int64_t block_size, int num_blocks,
+                  int64_t fail_at = std::numeric_limits<int64_t>::max()) {
+    data_.clear();
+    for (int i = 0; i < 1000; ++i) {
+      data_ += std::to_string(i);
+    }
+    raw_ = std::make_shared<TestInputStream>(
+        std::make_shared<BufferReader>(std::make_shared<Buffer>(data_)), fail_at);
+    ASSERT_OK(ReadaheadInputStream::Create(raw_, block_size, num_blocks, &stream_));
+  }
+
+  // Wait for the background thread to have made the given number of reads,
+  // then a little longer to catch it making more
+  void WaitForReads(int num_reads) {
+    for (int i = 0; i < 1000 && raw_->num_reads() < num_reads; ++i) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  }
+
+  void AssertTell(int64_t expected) {
+    int64_t position;
+    ASSERT_OK(stream_->Tell(&position));
+    ASSERT_EQ(expected, position);
+  }
+
+ protected:
+  std::string data_;
+  std::shared_ptr<TestInputStream> raw_;
+  std::shared_ptr<ReadaheadInputStream> stream_;
+};
+
+TEST_F(TestReadaheadInputStream, InvalidOptions) {
+  auto raw = std::make_shared<BufferReader>(std::make_shared<Buffer>(""));
+  std::shared_ptr<ReadaheadInputStream> stream;
+  ASSERT_RAISES(Invalid, ReadaheadInputStream::Create(raw, 0, 4, &stream));
+  ASSERT_RAISES(Invalid, ReadaheadInputStream::Create(raw, 1024, 0, &stream));
+}
+
+TEST_F(TestReadaheadInputStream, Reads) {
+  MakeStream(100, 3);
+  const int64_t size = static_cast<int64_t>(data_.size());
+  std::string contents;
+  int64_t position = 0;
+  const int64_t chunk_sizes[] = {1, 10, 99, 250};
+  for (int i = 0; position < size; ++i) {
+    const int64_t nbytes = chunk_sizes[i % 4];
+    char out[250];
+    int64_t bytes_read;
+    ASSERT_OK(stream_->Read(nbytes, &bytes_read, out));
+    ASSERT_EQ(std::min(nbytes, size - position), bytes_read);
+    contents.append(out, bytes_read);
+    position += bytes_read;
+    AssertTell(position);
+  }
+  ASSERT_EQ(data_, contents);
+
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(stream_->Read(10, &buffer));
+  ASSERT_EQ(0, buffer->size());
+  ASSERT_OK(stream_->ReadBlock(&buffer));
+  ASSERT_EQ(0, buffer->size());
+}
+
+TEST_F(TestReadaheadInputStream, BufferReads) {
+  MakeStream(100, 2);
+  std::shared_ptr<Buffer> first, second, third;
+  ASSERT_OK(stream_->Read(30, &first));
+  ASSERT_OK(stream_->Read(70, &second));
+  // Within a block, so without copying
+  ASSERT_EQ(first->data() + 30, second->data());
+  ASSERT_EQ(data_.substr(0, 30), AsString(*first));
+  ASSERT_EQ(data_.substr(30, 70), AsString(*second));
+
+  // Across blocks
+  ASSERT_OK(stream_->Read(150, &third));
+  ASSERT_EQ(data_.substr(100, 150), AsString(*third));
+  AssertTell(250);
+
+  ASSERT_OK(stream_->ReadBlock(&first));
+  ASSERT_EQ(data_.substr(250, 50), AsString(*first));
+  ASSERT_OK(stream_->ReadBlock(&first));
+  ASSERT_EQ(data_.substr(300, 100), AsString(*first));
+  AssertTell(400);
+}
+
+TEST_F(TestReadaheadInputStream, BoundedReadahead) {
+  MakeStream(10, 3);
+  WaitForReads(3);
+  ASSERT_EQ(3, raw_->num_reads());
+
+  // Consuming a block makes room for the next one
+  std::shared_ptr<Buffer> block;
+  ASSERT_OK(stream_->ReadBlock(&block));
+  ASSERT_EQ(data_.substr(0, 10), AsString(*block));
+  WaitForReads(4);
+  ASSERT_EQ(4, raw_->num_reads());
+}
+
+TEST_F(TestReadaheadInputStream, ReadError) {
+  MakeStream(100, 4, 250);
+  std::shared_ptr<Buffer> buffer;
+  // The blocks read before the error are returned first
+  ASSERT_OK(stream_->Read(200, &buffer));
+  ASSERT_EQ(data_.substr(0, 200), AsString(*buffer));
+  ASSERT_RAISES(IOError, stream_->Read(1, &buffer));
+  ASSERT_RAISES(IOError, stream_->ReadBlock(&buffer));
+}
+
+TEST_F(TestReadaheadInputStream, Close) {
+  MakeStream(10, 2);
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(stream_->Read(5, &buffer));
+  ASSERT_OK(stream_->Close());
+  ASSERT_OK(stream_->Close());
+  ASSERT_RAISES(IOError, stream_->Read(5, &buffer));
+
+  // Destroying the stream without closing it stops the thread
+  MakeStream(10, 2);
+  stream_.reset();
+}
+
+}  // namespace io
+}  // namespace arrow
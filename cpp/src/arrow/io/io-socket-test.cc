@@ -0,0 +1,155 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/buffer.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/io/socket.h"
+#include "arrow/status.h"
+#include "arrow/test-util.h"
+
+namespace arrow {
+namespace io {
+
+#ifndef _WIN32
+
+static std::string AsString(const Buffer& buffer) {
+  return std::string(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+}
+
+class TestTcpConnection : public ::testing::Test {
+ public:
+  void SetUp() override {
+    ASSERT_OK(TcpListener::Listen("127.0.0.1", 0, &listener_));
+    ASSERT_GT(listener_->port(), 0);
+  }
+
+  // Connect a client to the listener, accepting on another thread
+  void Connect() {
+    Status accept_status;
+    std::thread acceptor(
+        [this, &accept_status]() { accept_status = listener_->Accept(&server_); });
+    Status connect_status = TcpConnection::Connect("127.0.0.1", listener_->port(),
+                                                   &client_);
+    acceptor.join();
+    ASSERT_OK(connect_status);
+    ASSERT_OK(accept_status);
+  }
+
+ protected:
+  std::shared_ptr<TcpListener> listener_;
+  std::shared_ptr<TcpConnection> client_;
+  std::shared_ptr<TcpConnection> server_;
+};
+
+TEST_F(TestTcpConnection, RoundTrip) {
+  ASSERT_NO_FATAL_FAILURE(Connect());
+
+  auto out = client_->output_stream();
+  ASSERT_OK(out->Write("hello "));
+  ASSERT_OK(out->Write("world"));
+  int64_t position;
+  ASSERT_OK(out->Tell(&position));
+  ASSERT_EQ(11, position);
+  ASSERT_OK(client_->ShutdownOutput());
+
+  // Reads return what was asked for, whatever the segments the bytes arrive
+  // in, and less only at the end of the stream
+  auto in = server_->input_stream();
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(in->Read(8, &buffer));
+  ASSERT_EQ("hello wo", AsString(*buffer));
+  ASSERT_OK(in->Read(8, &buffer));
+  ASSERT_EQ("rld", AsString(*buffer));
+  ASSERT_OK(in->Read(8, &buffer));
+  ASSERT_EQ(0, buffer->size());
+  ASSERT_OK(in->Tell(&position));
+  ASSERT_EQ(11, position);
+
+  // The other direction is still open
+  ASSERT_OK(server_->output_stream()->Write("bye"));
+  ASSERT_OK(server_->Close());
+  ASSERT_OK(client_->input_stream()->Read(8, &buffer));
+  ASSERT_EQ("bye", AsString(*buffer));
+}
+
+TEST_F(TestTcpConnection, Writev) {
+  ASSERT_NO_FATAL_FAILURE(Connect());
+
+  // More buffers than a single call writes, and more bytes than the socket
+  // buffers hold, so that sends are partial
+  std::vector<std::shared_ptr<Buffer>> buffers;
+  std::string expected;
+  for (int i = 0; i < 3000; ++i) {
+    std::string data(i % 7 == 0 ? 0 : 1000 + i, static_cast<char>('a' + i % 26));
+    expected += data;
+    std::shared_ptr<Buffer> buffer;
+    ASSERT_OK(Buffer::FromString(data, &buffer));
+    buffers.push_back(buffer);
+  }
+
+  Status write_status;
+  std::thread writer([this, &buffers, &write_status]() {
+    write_status = client_->output_stream()->Writev(buffers);
+    if (write_status.ok()) {
+      write_status = client_->ShutdownOutput();
+    }
+  });
+  std::shared_ptr<Buffer> received;
+  Status read_status =
+      server_->input_stream()->Read(static_cast<int64_t>(expected.size()) + 1, &received);
+  writer.join();
+  ASSERT_OK(write_status);
+  ASSERT_OK(read_status);
+  ASSERT_EQ(expected.size(), static_cast<size_t>(received->size()));
+  ASSERT_TRUE(received->Equals(Buffer(expected)));
+}
+
+TEST_F(TestTcpConnection, CloseListener) {
+  std::shared_ptr<TcpConnection> connection;
+  Status accept_status;
+  std::thread acceptor([this, &connection, &accept_status]() {
+    accept_status = listener_->Accept(&connection);
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  ASSERT_OK(listener_->Close());
+  acceptor.join();
+  ASSERT_RAISES(IOError, accept_status);
+}
+
+TEST(TcpConnection, ConnectRefused) {
+  // A port just released is most likely not listened on
+  std::shared_ptr<TcpListener> listener;
+  ASSERT_OK(TcpListener::Listen("127.0.0.1", 0, &listener));
+  const int port = listener->port();
+  ASSERT_OK(listener->Close());
+  std::shared_ptr<TcpConnection> connection;
+  ASSERT_RAISES(IOError, TcpConnection::Connect("127.0.0.1", port, &connection));
+}
+
+#endif  // _WIN32
+
+}  // namespace io
+}  // namespace arrow
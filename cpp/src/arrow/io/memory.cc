@@ -59,7 +59,8 @@ BufferOutputStream::~BufferOutputStream() {
 }
 
 Status BufferOutputStream::Close() {
-  if (position_ < capacity_) {
+  // After Finish, the buffer belongs to the caller
+  if (is_open_ && position_ < capacity_) {
     return buffer_->Resize(position_, false);
   } else {
     return Status::OK();
@@ -91,6 +92,23 @@ Status BufferOutputStream::Write(const void* data, int64_t nbytes) {
   return Status::OK();
 }
 
+Status BufferOutputStream::Writev(const std::vector<std::shared_ptr<Buffer>>& buffers) {
+  if (ARROW_PREDICT_FALSE(!is_open_)) {
+    return Status::IOError("OutputStream is closed");
+  }
+  DCHECK(buffer_);
+  int64_t nbytes = 0;
+  for (const auto& buffer : buffers) {
+    nbytes += buffer->size();
+  }
+  RETURN_NOT_OK(Reserve(nbytes));
+  for (const auto& buffer : buffers) {
+    memcpy(mutable_data_ + position_, buffer->data(), buffer->size());
+    position_ += buffer->size();
+  }
+  return Status::OK();
+}
+
 Status BufferOutputStream::Reserve(int64_t nbytes) {
   int64_t new_capacity = capacity_;
   while (position_ + nbytes > new_capacity) {
@@ -104,6 +122,122 @@ Status BufferOutputStream::Reserve(int64_t nbytes) {
   return Status::OK();
 }
 
+// ----------------------------------------------------------------------
+// OutputStream that appends to a list of blocks
+
+constexpr int64_t ChunkedBufferOutputStream::kDefaultBlockSize;
+
+ChunkedBufferOutputStream::ChunkedBufferOutputStream(int64_t block_size,
+                                                     MemoryPool* pool)
+    : block_size_(std::max(kBufferMinimumSize, block_size)),
+      pool_(pool),
+      is_open_(true),
+      position_(0),
+      block_position_(0) {}
+
+Status ChunkedBufferOutputStream::Create(
+    int64_t block_size, MemoryPool* pool,
+    std::shared_ptr<ChunkedBufferOutputStream>* out) {
+  if (block_size <= 0) {
+    return Status::Invalid("block size should be > 0");
+  }
+  *out = std::make_shared<ChunkedBufferOutputStream>(block_size, pool);
+  return Status::OK();
+}
+
+ChunkedBufferOutputStream::~ChunkedBufferOutputStream() {}
+
+Status ChunkedBufferOutputStream::Close() {
+  if (is_open_) {
+    is_open_ = false;
+    return FinishBlock();
+  }
+  return Status::OK();
+}
+
+Status ChunkedBufferOutputStream::Tell(int64_t* position) const {
+  *position = position_;
+  return Status::OK();
+}
+
+Status ChunkedBufferOutputStream::Write(const void* data, int64_t nbytes) {
+  if (ARROW_PREDICT_FALSE(!is_open_)) {
+    return Status::IOError("OutputStream is closed");
+  }
+  const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
+  while (nbytes > 0) {
+    if (!block_ || block_position_ == block_size_) {
+      RETURN_NOT_OK(FinishBlock());
+      RETURN_NOT_OK(AllocateResizableBuffer(pool_, block_size_, &block_));
+    }
+    const int64_t length = std::min(nbytes, block_size_ - block_position_);
+    memcpy(block_->mutable_data() + block_position_, bytes, length);
+    block_position_ += length;
+    position_ += length;
+    bytes += length;
+    nbytes -= length;
+  }
+  return Status::OK();
+}
+
+Status ChunkedBufferOutputStream::Writev(
+    const std::vector<std::shared_ptr<Buffer>>& buffers) {
+  if (ARROW_PREDICT_FALSE(!is_open_)) {
+    return Status::IOError("OutputStream is closed");
+  }
+  for (const auto& buffer : buffers) {
+    if (buffer->size() >= block_size_ / 2) {
+      RETURN_NOT_OK(FinishBlock());
+      blocks_.push_back(buffer);
+      position_ += buffer->size();
+    } else {
+      RETURN_NOT_OK(Write(buffer->data(), buffer->size()));
+    }
+  }
+  return Status::OK();
+}
+
+Status ChunkedBufferOutputStream::FinishBlock() {
+  if (!block_) {
+    return Status::OK();
+  }
+  if (block_position_ < block_size_) {
+    RETURN_NOT_OK(block_->Resize(block_position_, false));
+  }
+  block_->ZeroPadding();
+  blocks_.push_back(std::move(block_));
+  block_.reset();
+  block_position_ = 0;
+  return Status::OK();
+}
+
+Status ChunkedBufferOutputStream::Finish(std::vector<std::shared_ptr<Buffer>>* result) {
+  RETURN_NOT_OK(Close());
+  *result = std::move(blocks_);
+  blocks_.clear();
+  return Status::OK();
+}
+
+Status ChunkedBufferOutputStream::Finish(std::shared_ptr<Buffer>* result) {
+  RETURN_NOT_OK(Close());
+  if (blocks_.size() == 1) {
+    *result = std::move(blocks_[0]);
+    blocks_.clear();
+    return Status::OK();
+  }
+  std::shared_ptr<Buffer> buffer;
+  RETURN_NOT_OK(AllocateBuffer(pool_, position_, &buffer));
+  uint8_t* out = buffer->mutable_data();
+  for (const auto& block : blocks_) {
+    memcpy(out, block->data(), block->size());
+    out += block->size();
+  }
+  blocks_.clear();
+  buffer->ZeroPadding();
+  *result = std::move(buffer);
+  return Status::OK();
+}
+
 // ----------------------------------------------------------------------
 // OutputStream that doesn't write anything
 
@@ -125,7 +259,8 @@ Status MockOutputStream::Write(const void* data, int64_t nbytes) {
 // ----------------------------------------------------------------------
 // In-memory buffer writer
 
-static constexpr int kMemcopyDefaultNumThreads = 1;
+// Zero threads has BulkMemcopy choose
+static constexpr int kMemcopyDefaultNumThreads = 0;
 static constexpr int64_t kMemcopyDefaultBlocksize = 64;
 static constexpr int64_t kMemcopyDefaultThreshold = 1024 * 1024;
 
@@ -164,7 +299,10 @@ class FixedSizeBufferWriter::FixedSizeBufferWriterImpl {
   }
 
   Status Write(const void* data, int64_t nbytes) {
-    if (nbytes > memcopy_threshold_ && memcopy_num_threads_ > 1) {
+    if (nbytes > memcopy_threshold_ && memcopy_num_threads_ == 0) {
+      internal::BulkMemcopy(mutable_data_ + position_,
+                            reinterpret_cast<const uint8_t*>(data), nbytes);
+    } else if (nbytes > memcopy_threshold_ && memcopy_num_threads_ > 1) {
       internal::parallel_memcopy(mutable_data_ + position_,
                                  reinterpret_cast<const uint8_t*>(data), nbytes,
                                  memcopy_blocksize_, memcopy_num_threads_);
@@ -22,6 +22,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 #include "arrow/io/interfaces.h"
 #include "arrow/util/visibility.h"
@@ -50,6 +51,9 @@ class ARROW_EXPORT BufferOutputStream : public OutputStream {
   Status Tell(int64_t* position) const override;
   Status Write(const void* data, int64_t nbytes) override;
 
+  /// \brief Copy the buffers in, growing the buffer at most once
+  Status Writev(const std::vector<std::shared_ptr<Buffer>>& buffers) override;
+
   /// Close the stream and return the buffer
   Status Finish(std::shared_ptr<Buffer>* result);
 
@@ -64,6 +68,63 @@ class ARROW_EXPORT BufferOutputStream : public OutputStream {
   uint8_t* mutable_data_;
 };
 
+/// \class ChunkedBufferOutputStream
+/// \brief An output stream appending into a list of blocks of a fixed size
+///
+/// Unlike BufferOutputStream, the bytes written are never copied as the
+/// stream grows. They can then be handed out as the blocks themselves, as
+/// for a scatter/gather send, or copied once into a single buffer.
+///
+/// Buffers of at least half a block given to Writev are not copied at all
+/// but appended to the list as they are, so they must not be modified
+/// afterwards.
+class ARROW_EXPORT ChunkedBufferOutputStream : public OutputStream {
+ public:
+  static constexpr int64_t kDefaultBlockSize = 1 << 20;
+
+  ChunkedBufferOutputStream(int64_t block_size, MemoryPool* pool);
+
+  static Status Create(int64_t block_size, MemoryPool* pool,
+                       std::shared_ptr<ChunkedBufferOutputStream>* out);
+
+  ~ChunkedBufferOutputStream() override;
+
+  // Implement the OutputStream interface
+
+  /// \brief Shrink the last block to the bytes written to it; no more
+  /// writes are accepted
+  Status Close() override;
+  Status Tell(int64_t* position) const override;
+  Status Write(const void* data, int64_t nbytes) override;
+  Status Writev(const std::vector<std::shared_ptr<Buffer>>& buffers) override;
+
+  using Writable::Write;
+
+  /// \brief Close the stream and return the blocks written, in order
+  ///
+  /// A block is shorter than the block size if it is the last one, or if it
+  /// was followed by a buffer appended by Writev.
+  Status Finish(std::vector<std::shared_ptr<Buffer>>* result);
+
+  /// \brief Close the stream and return the bytes written as a single
+  /// buffer, copied unless there is only one block
+  Status Finish(std::shared_ptr<Buffer>* result);
+
+ private:
+  const int64_t block_size_;
+  MemoryPool* pool_;
+  // Shrink the block being written to its bytes and append it to blocks_
+  Status FinishBlock();
+
+  std::vector<std::shared_ptr<Buffer>> blocks_;
+  // The block being written, if any
+  std::shared_ptr<ResizableBuffer> block_;
+  bool is_open_;
+  int64_t position_;
+  // The bytes written to block_
+  int64_t block_position_;
+};
+
 // \brief A helper class to tracks the size of allocations
 class ARROW_EXPORT MockOutputStream : public OutputStream {
  public:
@@ -93,6 +154,8 @@ class ARROW_EXPORT FixedSizeBufferWriter : public WriteableFile {
   Status Write(const void* data, int64_t nbytes) override;
   Status WriteAt(int64_t position, const void* data, int64_t nbytes) override;
 
+  /// \brief Set the number of threads large writes are copied with, by
+  /// default 0 to choose from the size of the write and the machine
   void set_memcopy_threads(int num_threads);
   void set_memcopy_blocksize(int64_t blocksize);
   void set_memcopy_threshold(int64_t threshold);
@@ -0,0 +1,282 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/io/readahead.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "arrow/buffer.h"
+#include "arrow/memory_pool.h"
+#include "arrow/status.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+namespace io {
+
+class ReadaheadInputStream::Impl {
+ public:
+  Impl(std::shared_ptr<InputStream> raw, int64_t block_size, int num_blocks)
+      : raw_(std::move(raw)),
+        block_size_(block_size),
+        num_blocks_(num_blocks),
+        position_(0),
+        stopping_(false),
+        finished_(false),
+        closed_(false) {}
+
+  ~Impl() { Stop(); }
+
+  void Start() { thread_ = std::thread([this] { ReadLoop(); }); }
+
+  Status Close() {
+    Stop();
+    std::lock_guard<std::mutex> guard(lock_);
+    if (closed_) {
+      return Status::OK();
+    }
+    closed_ = true;
+    blocks_.clear();
+    return raw_->Close();
+  }
+
+  Status Tell(int64_t* position) const {
+    std::lock_guard<std::mutex> guard(lock_);
+    *position = position_;
+    return Status::OK();
+  }
+
+  Status Read(int64_t nbytes, int64_t* bytes_read, void* out) {
+    std::unique_lock<std::mutex> lock(lock_);
+    return ReadUnlocked(&lock, nbytes, bytes_read, static_cast<uint8_t*>(out));
+  }
+
+  Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) {
+    std::unique_lock<std::mutex> lock(lock_);
+    if (nbytes < 0) {
+      return Status::Invalid("read count should be >= 0");
+    }
+    std::shared_ptr<Buffer> block;
+    RETURN_NOT_OK(WaitForBlock(&lock, &block));
+    if (block == nullptr || block->size() >= nbytes) {
+      // Zero-copy from a single block
+      return TakeFromBlock(nbytes, out);
+    }
+    std::shared_ptr<ResizableBuffer> buffer;
+    RETURN_NOT_OK(AllocateResizableBuffer(default_memory_pool(), nbytes, &buffer));
+    int64_t bytes_read;
+    RETURN_NOT_OK(ReadUnlocked(&lock, nbytes, &bytes_read, buffer->mutable_data()));
+    if (bytes_read < nbytes) {
+      RETURN_NOT_OK(buffer->Resize(bytes_read));
+    }
+    *out = std::move(buffer);
+    return Status::OK();
+  }
+
+  Status ReadBlock(std::shared_ptr<Buffer>* out) {
+    std::unique_lock<std::mutex> lock(lock_);
+    std::shared_ptr<Buffer> block;
+    RETURN_NOT_OK(WaitForBlock(&lock, &block));
+    return TakeFromBlock(block == nullptr ? 0 : block->size(), out);
+  }
+
+  int64_t block_size() const { return block_size_; }
+
+  int num_blocks() const { return num_blocks_; }
+
+  std::shared_ptr<InputStream> raw() const { return raw_; }
+
+ private:
+  // Run on the background thread
+  void ReadLoop() {
+    while (true) {
+      {
+        std::unique_lock<std::mutex> lock(lock_);
+        // The block about to be read counts as in flight
+        producer_cv_.wait(lock, [this] {
+          return stopping_ || static_cast<int>(blocks_.size()) < num_blocks_;
+        });
+        if (stopping_) {
+          return;
+        }
+      }
+      std::shared_ptr<Buffer> block;
+      Status status = raw_->Read(block_size_, &block);
+      std::lock_guard<std::mutex> guard(lock_);
+      if (!status.ok()) {
+        status_ = status;
+        finished_ = true;
+      } else if (block->size() == 0) {
+        finished_ = true;
+      } else {
+        blocks_.push_back(std::move(block));
+      }
+      consumer_cv_.notify_one();
+      if (finished_) {
+        return;
+      }
+    }
+  }
+
+  void Stop() {
+    {
+      std::lock_guard<std::mutex> guard(lock_);
+      stopping_ = true;
+    }
+    producer_cv_.notify_one();
+    if (thread_.joinable()) {
+      thread_.join();
+    }
+  }
+
+  // Wait for the next block to have been read, setting block to null at the
+  // end of the stream
+  Status WaitForBlock(std::unique_lock<std::mutex>* lock,
+                      std::shared_ptr<Buffer>* block) {
+    if (closed_) {
+      return Status::IOError("InputStream is closed");
+    }
+    consumer_cv_.wait(*lock, [this] { return !blocks_.empty() || finished_; });
+    if (blocks_.empty()) {
+      block->reset();
+      return status_;
+    }
+    *block = blocks_.front();
+    return Status::OK();
+  }
+
+  // Consume at most nbytes of the front block, if any
+  Status TakeFromBlock(int64_t nbytes, std::shared_ptr<Buffer>* out) {
+    if (blocks_.empty()) {
+      *out = std::make_shared<Buffer>(nullptr, 0);
+      return Status::OK();
+    }
+    std::shared_ptr<Buffer>& block = blocks_.front();
+    const int64_t length = std::min(nbytes, block->size());
+    if (length == block->size()) {
+      *out = std::move(block);
+      blocks_.pop_front();
+      producer_cv_.notify_one();
+    } else {
+      *out = SliceBuffer(block, 0, length);
+      block = SliceBuffer(block, length, block->size() - length);
+    }
+    position_ += length;
+    return Status::OK();
+  }
+
+  Status ReadUnlocked(std::unique_lock<std::mutex>* lock, int64_t nbytes,
+                      int64_t* bytes_read, uint8_t* out) {
+    if (nbytes < 0) {
+      return Status::Invalid("read count should be >= 0");
+    }
+    int64_t total = 0;
+    while (total < nbytes) {
+      std::shared_ptr<Buffer> block;
+      RETURN_NOT_OK(WaitForBlock(lock, &block));
+      if (block == nullptr) {
+        break;
+      }
+      std::shared_ptr<Buffer> chunk;
+      RETURN_NOT_OK(TakeFromBlock(nbytes - total, &chunk));
+      std::memcpy(out + total, chunk->data(), chunk->size());
+      total += chunk->size();
+    }
+    *bytes_read = total;
+    return Status::OK();
+  }
+
+  std::shared_ptr<InputStream> raw_;
+  const int64_t block_size_;
+  const int num_blocks_;
+
+  mutable std::mutex lock_;
+  // Signaled when a block was read or the raw stream ended
+  std::condition_variable consumer_cv_;
+  // Signaled when a block was consumed or reading should stop
+  std::condition_variable producer_cv_;
+  // The blocks read and not yet consumed, the front one possibly in part
+  std::deque<std::shared_ptr<Buffer>> blocks_;
+  int64_t position_;
+  // The error reading the raw stream, returned once the blocks are consumed
+  Status status_;
+  bool stopping_;
+  bool finished_;
+  bool closed_;
+  std::thread thread_;
+};
+
+constexpr int64_t ReadaheadInputStream::kDefaultBlockSize;
+constexpr int ReadaheadInputStream::kDefaultNumBlocks;
+
+ReadaheadInputStream::ReadaheadInputStream(std::unique_ptr<Impl> impl)
+    : impl_(std::move(impl)) {}
+
+ReadaheadInputStream::~ReadaheadInputStream() {}
+
+Status ReadaheadInputStream::Create(std::shared_ptr<InputStream> raw,
+                                    int64_t block_size, int num_blocks,
+                                    std::shared_ptr<ReadaheadInputStream>* out) {
+  if (block_size <= 0) {
+    return Status::Invalid("block size should be > 0");
+  }
+  if (num_blocks <= 0) {
+    return Status::Invalid("number of blocks should be > 0");
+  }
+  std::unique_ptr<Impl> impl(new Impl(std::move(raw), block_size, num_blocks));
+  impl->Start();
+  *out = std::shared_ptr<ReadaheadInputStream>(new ReadaheadInputStream(std::move(impl)));
+  return Status::OK();
+}
+
+Status ReadaheadInputStream::Create(std::shared_ptr<InputStream> raw,
+                                    std::shared_ptr<ReadaheadInputStream>* out) {
+  return Create(std::move(raw), kDefaultBlockSize, kDefaultNumBlocks, out);
+}
+
+Status ReadaheadInputStream::Close() { return impl_->Close(); }
+
+Status ReadaheadInputStream::Tell(int64_t* position) const {
+  return impl_->Tell(position);
+}
+
+Status ReadaheadInputStream::Read(int64_t nbytes, int64_t* bytes_read, void* out) {
+  return impl_->Read(nbytes, bytes_read, out);
+}
+
+Status ReadaheadInputStream::Read(int64_t nbytes, std::shared_ptr<Buffer>* out) {
+  return impl_->Read(nbytes, out);
+}
+
+Status ReadaheadInputStream::ReadBlock(std::shared_ptr<Buffer>* out) {
+  return impl_->ReadBlock(out);
+}
+
+int64_t ReadaheadInputStream::block_size() const { return impl_->block_size(); }
+
+int ReadaheadInputStream::num_blocks() const { return impl_->num_blocks(); }
+
+std::shared_ptr<InputStream> ReadaheadInputStream::raw() const { return impl_->raw(); }
+
+}  // namespace io
+}  // namespace arrow
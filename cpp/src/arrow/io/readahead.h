@@ -0,0 +1,105 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Input stream reading ahead on a background thread
+
+#ifndef ARROW_IO_READAHEAD_H
+#define ARROW_IO_READAHEAD_H
+
+#include <cstdint>
+#include <memory>
+
+#include "arrow/io/interfaces.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Buffer;
+class Status;
+
+namespace io {
+
+/// \class ReadaheadInputStream
+/// \brief An input stream reading the next blocks of another on a
+/// background thread
+///
+/// While the consumer decodes what it has read, up to a given number of
+/// blocks of the raw stream are being or have been read, so that the latency
+/// of the raw stream, as of one on network storage, overlaps with the work of
+/// the consumer.  The raw stream must not be used otherwise until this one is
+/// closed or destroyed.
+///
+/// An error reading the raw stream is returned by the read reaching it.
+class ARROW_EXPORT ReadaheadInputStream : public InputStream {
+ public:
+  static constexpr int64_t kDefaultBlockSize = 1 << 20;
+  static constexpr int kDefaultNumBlocks = 4;
+
+  ~ReadaheadInputStream() override;
+
+  /// \brief Create a stream reading ahead of the consumer of the given stream
+  ///
+  /// \param[in] raw the stream to read from
+  /// \param[in] block_size the number of bytes of each read of the raw stream
+  /// \param[in] num_blocks the most blocks in flight or waiting to be consumed
+  /// \param[out] out the read-ahead stream, its thread started
+  /// \return Status
+  static Status Create(std::shared_ptr<InputStream> raw, int64_t block_size,
+                       int num_blocks, std::shared_ptr<ReadaheadInputStream>* out);
+
+  static Status Create(std::shared_ptr<InputStream> raw,
+                       std::shared_ptr<ReadaheadInputStream>* out);
+
+  // InputStream interface
+
+  /// \brief Stop reading ahead and close the raw stream
+  Status Close() override;
+
+  /// \brief The number of bytes consumed
+  Status Tell(int64_t* position) const override;
+
+  Status Read(int64_t nbytes, int64_t* bytes_read, void* out) override;
+
+  /// \brief Read nbytes, without copying them if they are all within a block
+  Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) override;
+
+  /// \brief Return the unconsumed rest of the next block as read from the
+  /// raw stream, waiting for it if needed
+  ///
+  /// \param[out] out the block, of size 0 at the end of the stream
+  /// \return Status
+  Status ReadBlock(std::shared_ptr<Buffer>* out);
+
+  int64_t block_size() const;
+
+  int num_blocks() const;
+
+  /// \brief Return the underlying raw input stream.
+  std::shared_ptr<InputStream> raw() const;
+
+ private:
+  class ARROW_NO_EXPORT Impl;
+
+  explicit ReadaheadInputStream(std::unique_ptr<Impl> impl);
+
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace io
+}  // namespace arrow
+
+#endif  // ARROW_IO_READAHEAD_H
@@ -0,0 +1,450 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/io/socket.h"
+
+#ifndef _WIN32
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <mutex>
+#include <sstream>
+
+#include "arrow/buffer.h"
+#include "arrow/memory_pool.h"
+#include "arrow/status.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+namespace io {
+
+#ifndef _WIN32
+
+namespace {
+
+Status SocketError(const std::string& what) {
+  return Status::IOError(what + ": " + std::string(std::strerror(errno)));
+}
+
+// Resolve a host and port, for a passive socket if the host is empty
+Status ResolveAddress(const std::string& host, int port, bool passive,
+                      struct addrinfo** out) {
+  struct addrinfo hints;
+  std::memset(&hints, 0, sizeof(hints));
+  hints.ai_family = AF_UNSPEC;
+  hints.ai_socktype = SOCK_STREAM;
+  if (passive) {
+    hints.ai_flags = AI_PASSIVE;
+  }
+  const std::string service = std::to_string(port);
+  int ret = getaddrinfo(host.empty() ? nullptr : host.c_str(), service.c_str(), &hints,
+                        out);
+  if (ret != 0) {
+    std::stringstream ss;
+    ss << "Cannot resolve " << host << ":" << port << ": " << gai_strerror(ret);
+    return Status::IOError(ss.str());
+  }
+  return Status::OK();
+}
+
+}  // namespace
+
+class TcpConnection::TcpConnectionImpl {
+ public:
+  explicit TcpConnectionImpl(int fd) : fd_(fd) {}
+
+  ~TcpConnectionImpl() { DCHECK_OK(Close()); }
+
+  Status Close() {
+    std::lock_guard<std::mutex> guard(lock_);
+    if (fd_ != -1) {
+      int ret = close(fd_);
+      fd_ = -1;
+      if (ret == -1) {
+        return SocketError("Error closing socket");
+      }
+    }
+    return Status::OK();
+  }
+
+  Status ShutdownOutput() {
+    RETURN_NOT_OK(CheckOpen());
+    if (shutdown(fd_, SHUT_WR) == -1) {
+      return SocketError("Error shutting down socket");
+    }
+    return Status::OK();
+  }
+
+  Status CheckOpen() const {
+    if (fd_ == -1) {
+      return Status::IOError("Socket is closed");
+    }
+    return Status::OK();
+  }
+
+  // Receive until nbytes are read or the peer shuts its side down
+  Status Read(int64_t nbytes, int64_t* bytes_read, void* out) {
+    RETURN_NOT_OK(CheckOpen());
+    auto data = static_cast<uint8_t*>(out);
+    int64_t total = 0;
+    while (total < nbytes) {
+      const auto chunk = static_cast<size_t>(std::min<int64_t>(nbytes - total, INT_MAX));
+      ssize_t ret = recv(fd_, data + total, chunk, 0);
+      if (ret == -1) {
+        if (errno == EINTR) {
+          continue;
+        }
+        return SocketError("Error reading from socket");
+      }
+      if (ret == 0) {
+        break;
+      }
+      total += ret;
+    }
+    *bytes_read = total;
+    return Status::OK();
+  }
+
+  Status Write(const void* data, int64_t nbytes) {
+    RETURN_NOT_OK(CheckOpen());
+    auto bytes = static_cast<const uint8_t*>(data);
+    while (nbytes > 0) {
+      const size_t chunk = static_cast<size_t>(std::min<int64_t>(nbytes, INT_MAX));
+      // MSG_NOSIGNAL so that a peer gone away fails the write rather than
+      // raising SIGPIPE
+      ssize_t ret = send(fd_, bytes, chunk, MSG_NOSIGNAL);
+      if (ret == -1) {
+        if (errno == EINTR) {
+          continue;
+        }
+        return SocketError("Error writing to socket");
+      }
+      bytes += ret;
+      nbytes -= ret;
+    }
+    return Status::OK();
+  }
+
+  // Like FileWritev, with sendmsg for the MSG_NOSIGNAL flag writev lacks
+  Status Writev(const std::vector<std::shared_ptr<Buffer>>& buffers) {
+    RETURN_NOT_OK(CheckOpen());
+    std::vector<struct iovec> iovecs;
+    iovecs.reserve(buffers.size());
+    for (const auto& buffer : buffers) {
+      if (buffer->size() > 0) {
+        iovecs.push_back({const_cast<uint8_t*>(buffer->data()),
+                          static_cast<size_t>(buffer->size())});
+      }
+    }
+
+    size_t next = 0;
+    while (next < iovecs.size()) {
+      struct msghdr message;
+      std::memset(&message, 0, sizeof(message));
+      message.msg_iov = iovecs.data() + next;
+      message.msg_iovlen = std::min<size_t>(iovecs.size() - next, IOV_MAX);
+      ssize_t ret = sendmsg(fd_, &message, MSG_NOSIGNAL);
+      if (ret == -1) {
+        if (errno == EINTR) {
+          continue;
+        }
+        return SocketError("Error writing to socket");
+      }
+      auto written = static_cast<size_t>(ret);
+      while (next < iovecs.size() && written >= iovecs[next].iov_len) {
+        written -= iovecs[next].iov_len;
+        ++next;
+      }
+      if (written > 0) {
+        iovecs[next].iov_base = static_cast<uint8_t*>(iovecs[next].iov_base) + written;
+        iovecs[next].iov_len -= written;
+      }
+    }
+    return Status::OK();
+  }
+
+  class Input;
+  class Output;
+
+ private:
+  int fd_;
+  std::mutex lock_;
+};
+
+// The streams keep the socket open for as long as they are used
+
+class TcpConnection::TcpConnectionImpl::Input : public InputStream {
+ public:
+  explicit Input(std::shared_ptr<TcpConnectionImpl> impl)
+      : impl_(std::move(impl)), position_(0) {}
+
+  Status Close() override { return impl_->Close(); }
+
+  Status Tell(int64_t* position) const override {
+    *position = position_;
+    return Status::OK();
+  }
+
+  Status Read(int64_t nbytes, int64_t* bytes_read, void* out) override {
+    RETURN_NOT_OK(impl_->Read(nbytes, bytes_read, out));
+    position_ += *bytes_read;
+    return Status::OK();
+  }
+
+  Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) override {
+    std::shared_ptr<ResizableBuffer> buffer;
+    RETURN_NOT_OK(AllocateResizableBuffer(default_memory_pool(), nbytes, &buffer));
+    int64_t bytes_read = 0;
+    RETURN_NOT_OK(Read(nbytes, &bytes_read, buffer->mutable_data()));
+    if (bytes_read < nbytes) {
+      RETURN_NOT_OK(buffer->Resize(bytes_read));
+      buffer->ZeroPadding();
+    }
+    *out = buffer;
+    return Status::OK();
+  }
+
+ private:
+  std::shared_ptr<TcpConnectionImpl> impl_;
+  std::atomic<int64_t> position_;
+};
+
+class TcpConnection::TcpConnectionImpl::Output : public OutputStream {
+ public:
+  explicit Output(std::shared_ptr<TcpConnectionImpl> impl)
+      : impl_(std::move(impl)), position_(0) {
+    set_mode(FileMode::WRITE);
+  }
+
+  using Writable::Write;
+
+  Status Close() override { return impl_->Close(); }
+
+  Status Tell(int64_t* position) const override {
+    *position = position_;
+    return Status::OK();
+  }
+
+  Status Write(const void* data, int64_t nbytes) override {
+    RETURN_NOT_OK(impl_->Write(data, nbytes));
+    position_ += nbytes;
+    return Status::OK();
+  }
+
+  Status Writev(const std::vector<std::shared_ptr<Buffer>>& buffers) override {
+    RETURN_NOT_OK(impl_->Writev(buffers));
+    for (const auto& buffer : buffers) {
+      position_ += buffer->size();
+    }
+    return Status::OK();
+  }
+
+ private:
+  std::shared_ptr<TcpConnectionImpl> impl_;
+  std::atomic<int64_t> position_;
+};
+
+TcpConnection::TcpConnection(int fd) : impl_(new TcpConnectionImpl(fd)) {}
+
+TcpConnection::~TcpConnection() {}
+
+Status TcpConnection::Connect(const std::string& host, int port,
+                              std::shared_ptr<TcpConnection>* out) {
+  struct addrinfo* addresses;
+  RETURN_NOT_OK(ResolveAddress(host, port, false, &addresses));
+
+  int fd = -1;
+  int connect_errno = 0;
+  for (struct addrinfo* address = addresses; address != nullptr;
+       address = address->ai_next) {
+    fd = socket(address->ai_family, address->ai_socktype, address->ai_protocol);
+    if (fd == -1) {
+      connect_errno = errno;
+      continue;
+    }
+    if (connect(fd, address->ai_addr, address->ai_addrlen) == 0) {
+      break;
+    }
+    connect_errno = errno;
+    close(fd);
+    fd = -1;
+  }
+  freeaddrinfo(addresses);
+  if (fd == -1) {
+    errno = connect_errno;
+    std::stringstream ss;
+    ss << "Cannot connect to " << host << ":" << port;
+    return SocketError(ss.str());
+  }
+
+  // IPC messages are written whole, so there is nothing to gain from delaying
+  // the small ones
+  int one = 1;
+  setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+  out->reset(new TcpConnection(fd));
+  return Status::OK();
+}
+
+std::shared_ptr<InputStream> TcpConnection::input_stream() const {
+  return std::make_shared<TcpConnectionImpl::Input>(impl_);
+}
+
+std::shared_ptr<OutputStream> TcpConnection::output_stream() const {
+  return std::make_shared<TcpConnectionImpl::Output>(impl_);
+}
+
+Status TcpConnection::ShutdownOutput() { return impl_->ShutdownOutput(); }
+
+Status TcpConnection::Close() { return impl_->Close(); }
+
+TcpListener::TcpListener(int fd, int port) : fd_(fd), port_(port) {}
+
+TcpListener::~TcpListener() { DCHECK_OK(Close()); }
+
+Status TcpListener::Listen(const std::string& host, int port,
+                           std::shared_ptr<TcpListener>* out) {
+  struct addrinfo* addresses;
+  RETURN_NOT_OK(ResolveAddress(host, port, true, &addresses));
+
+  int fd = -1;
+  int listen_errno = 0;
+  for (struct addrinfo* address = addresses; address != nullptr;
+       address = address->ai_next) {
+    fd = socket(address->ai_family, address->ai_socktype, address->ai_protocol);
+    if (fd == -1) {
+      listen_errno = errno;
+      continue;
+    }
+    int one = 1;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    if (bind(fd, address->ai_addr, address->ai_addrlen) == 0 && listen(fd, 128) == 0) {
+      break;
+    }
+    listen_errno = errno;
+    close(fd);
+    fd = -1;
+  }
+  freeaddrinfo(addresses);
+  if (fd == -1) {
+    errno = listen_errno;
+    std::stringstream ss;
+    ss << "Cannot listen on " << host << ":" << port;
+    return SocketError(ss.str());
+  }
+
+  struct sockaddr_storage bound;
+  socklen_t bound_length = sizeof(bound);
+  if (getsockname(fd, reinterpret_cast<struct sockaddr*>(&bound), &bound_length) == -1) {
+    Status status = SocketError("Cannot get the address of socket");
+    close(fd);
+    return status;
+  }
+  int bound_port = bound.ss_family == AF_INET6
+                       ? ntohs(reinterpret_cast<struct sockaddr_in6*>(&bound)->sin6_port)
+                       : ntohs(reinterpret_cast<struct sockaddr_in*>(&bound)->sin_port);
+  out->reset(new TcpListener(fd, bound_port));
+  return Status::OK();
+}
+
+int TcpListener::port() const { return port_; }
+
+Status TcpListener::Accept(std::shared_ptr<TcpConnection>* out) {
+  while (true) {
+    int fd = accept(fd_, nullptr, nullptr);
+    if (fd == -1) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return SocketError("Error accepting connection");
+    }
+    int one = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    out->reset(new TcpConnection(fd));
+    return Status::OK();
+  }
+}
+
+Status TcpListener::Close() {
+  if (fd_ == -1) {
+    return Status::OK();
+  }
+  // Closing alone does not wake a thread blocked in accept on Linux, shutting
+  // the socket down does
+  shutdown(fd_, SHUT_RDWR);
+  int ret = close(fd_);
+  fd_ = -1;
+  if (ret == -1) {
+    return SocketError("Error closing socket");
+  }
+  return Status::OK();
+}
+
+#else  // _WIN32
+
+class TcpConnection::TcpConnectionImpl {};
+
+TcpConnection::TcpConnection(int fd) {}
+
+TcpConnection::~TcpConnection() {}
+
+Status TcpConnection::Connect(const std::string& host, int port,
+                              std::shared_ptr<TcpConnection>* out) {
+  return Status::NotImplemented("TCP sockets are not supported on Windows");
+}
+
+std::shared_ptr<InputStream> TcpConnection::input_stream() const { return nullptr; }
+
+std::shared_ptr<OutputStream> TcpConnection::output_stream() const { return nullptr; }
+
+Status TcpConnection::ShutdownOutput() {
+  return Status::NotImplemented("TCP sockets are not supported on Windows");
+}
+
+Status TcpConnection::Close() { return Status::OK(); }
+
+TcpListener::TcpListener(int fd, int port) : fd_(fd), port_(port) {}
+
+TcpListener::~TcpListener() {}
+
+Status TcpListener::Listen(const std::string& host, int port,
+                           std::shared_ptr<TcpListener>* out) {
+  return Status::NotImplemented("TCP sockets are not supported on Windows");
+}
+
+int TcpListener::port() const { return port_; }
+
+Status TcpListener::Accept(std::shared_ptr<TcpConnection>* out) {
+  return Status::NotImplemented("TCP sockets are not supported on Windows");
+}
+
+Status TcpListener::Close() { return Status::OK(); }
+
+#endif  // _WIN32
+
+}  // namespace io
+}  // namespace arrow
@@ -0,0 +1,121 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Byte streams over TCP connections
+
+#ifndef ARROW_IO_SOCKET_H
+#define ARROW_IO_SOCKET_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/io/interfaces.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Buffer;
+class Status;
+
+namespace io {
+
+/// \class TcpConnection
+/// \brief A connected TCP socket, read through an InputStream and written
+/// through an OutputStream
+///
+/// Writev sends its buffers to the kernel in a single gather write, so that
+/// IPC messages go out straight from the buffers of the record batches.
+/// One thread may read while another writes, but the streams are not
+/// otherwise thread-safe. Not available on Windows.
+class ARROW_EXPORT TcpConnection {
+ public:
+  ~TcpConnection();
+
+  /// \brief Connect to a TCP server
+  /// \param[in] host a host name or numeric address
+  /// \param[in] port the port of the server
+  /// \param[out] out the connection
+  /// \return Status
+  static Status Connect(const std::string& host, int port,
+                        std::shared_ptr<TcpConnection>* out);
+
+  /// \brief The stream of the bytes received. Reads return fewer bytes than
+  /// asked for only at the end of the stream, once the peer shut its side
+  /// down.
+  std::shared_ptr<InputStream> input_stream() const;
+
+  /// \brief The stream of the bytes to send
+  std::shared_ptr<OutputStream> output_stream() const;
+
+  /// \brief Tell the peer no more bytes are to be sent, while still
+  /// receiving its own
+  Status ShutdownOutput();
+
+  /// \brief Close the socket; closing either stream does so too
+  Status Close();
+
+ private:
+  class ARROW_NO_EXPORT TcpConnectionImpl;
+  explicit TcpConnection(int fd);
+  std::shared_ptr<TcpConnectionImpl> impl_;
+
+  friend class TcpListener;
+
+  ARROW_DISALLOW_COPY_AND_ASSIGN(TcpConnection);
+};
+
+/// \class TcpListener
+/// \brief A socket accepting TCP connections
+class ARROW_EXPORT TcpListener {
+ public:
+  ~TcpListener();
+
+  /// \brief Listen for connections
+  /// \param[in] host the address to listen on, such as "127.0.0.1", or
+  /// empty for all of them
+  /// \param[in] port the port to listen on, or 0 for one chosen by the system
+  /// \param[out] out the listener
+  /// \return Status
+  static Status Listen(const std::string& host, int port,
+                       std::shared_ptr<TcpListener>* out);
+
+  /// \brief The port listened on
+  int port() const;
+
+  /// \brief Wait for a connection
+  /// \return Status, IOError once the listener is closed
+  Status Accept(std::shared_ptr<TcpConnection>* out);
+
+  /// \brief Stop listening. Calls to Accept waiting on other threads return.
+  Status Close();
+
+ private:
+  TcpListener(int fd, int port);
+
+  int fd_;
+  int port_;
+
+  ARROW_DISALLOW_COPY_AND_ASSIGN(TcpListener);
+};
+
+}  // namespace io
+}  // namespace arrow
+
+#endif  // ARROW_IO_SOCKET_H
@@ -0,0 +1,609 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/io/uring.h"
+
+#ifdef __linux__
+#include <sys/syscall.h>
+#endif
+
+// io_uring is used through its system calls, as declared by the kernel
+// headers, rather than through liburing
+#if defined(__linux__) && defined(__NR_io_uring_setup) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#define ARROW_HAVE_IO_URING
+#endif
+#endif
+
+#ifdef ARROW_HAVE_IO_URING
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <mutex>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+#include "arrow/buffer.h"
+#include "arrow/memory_pool.h"
+#include "arrow/status.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/util/io-util.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+namespace io {
+
+#ifdef ARROW_HAVE_IO_URING
+
+namespace {
+
+// The alignment O_DIRECT requires of file offsets, lengths and addresses
+constexpr int64_t kDirectAlignment = 4096;
+
+Status ErrnoError(const char* operation, int errnum) {
+  std::stringstream ss;
+  ss << operation << " failed: " << std::strerror(errnum);
+  return Status::IOError(ss.str());
+}
+
+// A submission and a completion queue shared with the kernel
+class Ring {
+ public:
+  Ring()
+      : fd_(-1),
+        sq_ring_(MAP_FAILED),
+        cq_ring_(MAP_FAILED),
+        sqes_(static_cast<io_uring_sqe*>(MAP_FAILED)),
+        local_tail_(0),
+        unsubmitted_(0) {}
+
+  ~Ring() {
+    if (sqes_ != MAP_FAILED) {
+      munmap(sqes_, sqes_size_);
+    }
+    if (cq_ring_ != MAP_FAILED) {
+      munmap(cq_ring_, cq_ring_size_);
+    }
+    if (sq_ring_ != MAP_FAILED) {
+      munmap(sq_ring_, sq_ring_size_);
+    }
+    if (fd_ >= 0) {
+      close(fd_);
+    }
+  }
+
+  Status Init(unsigned entries) {
+    io_uring_params params;
+    std::memset(&params, 0, sizeof(params));
+    fd_ = static_cast<int>(syscall(__NR_io_uring_setup, entries, &params));
+    if (fd_ < 0) {
+      return ErrnoError("io_uring_setup", errno);
+    }
+    sq_entries_ = params.sq_entries;
+
+    sq_ring_size_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    cq_ring_size_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    sqes_size_ = params.sq_entries * sizeof(io_uring_sqe);
+    sq_ring_ = mmap(nullptr, sq_ring_size_, PROT_READ | PROT_WRITE,
+                    MAP_SHARED | MAP_POPULATE, fd_, IORING_OFF_SQ_RING);
+    cq_ring_ = mmap(nullptr, cq_ring_size_, PROT_READ | PROT_WRITE,
+                    MAP_SHARED | MAP_POPULATE, fd_, IORING_OFF_CQ_RING);
+    sqes_ = static_cast<io_uring_sqe*>(mmap(nullptr, sqes_size_, PROT_READ | PROT_WRITE,
+                                            MAP_SHARED | MAP_POPULATE, fd_,
+                                            IORING_OFF_SQES));
+    if (sq_ring_ == MAP_FAILED || cq_ring_ == MAP_FAILED || sqes_ == MAP_FAILED) {
+      return ErrnoError("mmap of io_uring queues", errno);
+    }
+
+    uint8_t* sq = static_cast<uint8_t*>(sq_ring_);
+    sq_tail_ = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+    sq_mask_ = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+    sq_array_ = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+    local_tail_ = *sq_tail_;
+    uint8_t* cq = static_cast<uint8_t*>(cq_ring_);
+    cq_head_ = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+    cq_tail_ = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+    cq_mask_ = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+    cqes_ = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+    return Status::OK();
+  }
+
+  unsigned sq_entries() const { return sq_entries_; }
+
+  Status RegisterBuffers(const std::vector<iovec>& buffers) {
+    if (syscall(__NR_io_uring_register, fd_, IORING_REGISTER_BUFFERS, buffers.data(),
+                static_cast<unsigned>(buffers.size())) < 0) {
+      return ErrnoError("io_uring_register", errno);
+    }
+    return Status::OK();
+  }
+
+  // The next submission queue entry, to be filled in before Enter is called.
+  // The caller ensures there are never more than sq_entries() in flight.
+  io_uring_sqe* NextEntry() {
+    const unsigned index = local_tail_++ & sq_mask_;
+    sq_array_[index] = index;
+    io_uring_sqe* sqe = &sqes_[index];
+    std::memset(sqe, 0, sizeof(*sqe));
+    ++unsubmitted_;
+    return sqe;
+  }
+
+  // Submit the entries filled in and wait for at least one completion.
+  // Entries the kernel does not take yet stay queued for the next call.
+  Status Enter() {
+    __atomic_store_n(sq_tail_, local_tail_, __ATOMIC_RELEASE);
+    while (true) {
+      const long ret = syscall(__NR_io_uring_enter, fd_, unsubmitted_, 1,  // NOLINT
+                               IORING_ENTER_GETEVENTS, nullptr, 0);
+      if (ret >= 0) {
+        unsubmitted_ -= static_cast<unsigned>(ret);
+        return Status::OK();
+      }
+      if (errno != EINTR) {
+        return ErrnoError("io_uring_enter", errno);
+      }
+    }
+  }
+
+  bool PopCompletion(uint64_t* user_data, int32_t* result) {
+    const unsigned head = *cq_head_;
+    if (head == __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE)) {
+      return false;
+    }
+    const io_uring_cqe& cqe = cqes_[head & cq_mask_];
+    *user_data = cqe.user_data;
+    *result = cqe.res;
+    __atomic_store_n(cq_head_, head + 1, __ATOMIC_RELEASE);
+    return true;
+  }
+
+ private:
+  int fd_;
+  unsigned sq_entries_;
+  void* sq_ring_;
+  size_t sq_ring_size_;
+  void* cq_ring_;
+  size_t cq_ring_size_;
+  io_uring_sqe* sqes_;
+  size_t sqes_size_;
+
+  unsigned* sq_tail_;
+  unsigned sq_mask_;
+  unsigned* sq_array_;
+  unsigned* cq_head_;
+  unsigned* cq_tail_;
+  unsigned cq_mask_;
+  io_uring_cqe* cqes_;
+  // The tail of the submission queue including the entries not yet published
+  // to the kernel, and the count of entries it has not taken yet
+  unsigned local_tail_;
+  unsigned unsubmitted_;
+};
+
+}  // namespace
+
+class UringReadableFile::UringReadableFileImpl {
+ public:
+  UringReadableFileImpl(const UringOptions& options, MemoryPool* pool)
+      : options_(options), pool_(pool), fd_(-1), position_(0) {}
+
+  ~UringReadableFileImpl() { DCHECK(Close().ok()); }
+
+  Status Open(const std::string& path) {
+    internal::PlatformFilename file_name;
+    RETURN_NOT_OK(internal::FileNameFromString(path, &file_name));
+    if (options_.direct_io) {
+      fd_ = open(file_name.c_str(), O_RDONLY | O_DIRECT);
+      if (fd_ < 0) {
+        std::stringstream ss;
+        ss << "Failed to open local file with O_DIRECT: " << path
+           << " , error: " << std::strerror(errno);
+        return Status::IOError(ss.str());
+      }
+    } else {
+      RETURN_NOT_OK(internal::FileOpenReadable(file_name, &fd_));
+    }
+    RETURN_NOT_OK(ring_.Init(static_cast<unsigned>(options_.queue_depth)));
+    if (options_.direct_io) {
+      RETURN_NOT_OK(RegisterDirectBuffers());
+    }
+    return Status::OK();
+  }
+
+  Status Close() {
+    std::lock_guard<std::mutex> guard(lock_);
+    if (fd_ >= 0) {
+      const int fd = fd_;
+      fd_ = -1;
+      return internal::FileClose(fd);
+    }
+    return Status::OK();
+  }
+
+  Status Tell(int64_t* position) const {
+    std::lock_guard<std::mutex> guard(lock_);
+    RETURN_NOT_OK(CheckOpen());
+    *position = position_;
+    return Status::OK();
+  }
+
+  Status Seek(int64_t position) {
+    std::lock_guard<std::mutex> guard(lock_);
+    RETURN_NOT_OK(CheckOpen());
+    if (position < 0) {
+      return Status::Invalid("Invalid position");
+    }
+    position_ = position;
+    return Status::OK();
+  }
+
+  Status GetSize(int64_t* size) {
+    std::lock_guard<std::mutex> guard(lock_);
+    RETURN_NOT_OK(CheckOpen());
+    return internal::FileGetSize(fd_, size);
+  }
+
+  Status Read(int64_t nbytes, int64_t* bytes_read, void* out) {
+    std::lock_guard<std::mutex> guard(lock_);
+    ReadRequest request{position_, nbytes, static_cast<uint8_t*>(out), 0};
+    RETURN_NOT_OK(ReadRequests(&request, 1));
+    position_ += request.bytes_read;
+    *bytes_read = request.bytes_read;
+    return Status::OK();
+  }
+
+  Status ReadAt(int64_t position, int64_t nbytes, int64_t* bytes_read, void* out) {
+    std::lock_guard<std::mutex> guard(lock_);
+    ReadRequest request{position, nbytes, static_cast<uint8_t*>(out), 0};
+    RETURN_NOT_OK(ReadRequests(&request, 1));
+    *bytes_read = request.bytes_read;
+    return Status::OK();
+  }
+
+  Status ReadBuffer(int64_t nbytes, std::shared_ptr<Buffer>* out) {
+    std::shared_ptr<ResizableBuffer> buffer;
+    RETURN_NOT_OK(AllocateResizableBuffer(pool_, nbytes, &buffer));
+    int64_t bytes_read;
+    RETURN_NOT_OK(Read(nbytes, &bytes_read, buffer->mutable_data()));
+    if (bytes_read < nbytes) {
+      RETURN_NOT_OK(buffer->Resize(bytes_read));
+      buffer->ZeroPadding();
+    }
+    *out = std::move(buffer);
+    return Status::OK();
+  }
+
+  // Read the ranges into buffers allocated from the pool, in a single batch
+  Status ReadBuffers(const std::vector<ReadRange>& ranges,
+                     std::vector<std::shared_ptr<Buffer>>* out) {
+    std::vector<std::shared_ptr<ResizableBuffer>> buffers(ranges.size());
+    std::vector<ReadRequest> requests(ranges.size());
+    for (size_t i = 0; i < ranges.size(); ++i) {
+      RETURN_NOT_OK(AllocateResizableBuffer(pool_, ranges[i].length, &buffers[i]));
+      requests[i] =
+          ReadRequest{ranges[i].offset, ranges[i].length, buffers[i]->mutable_data(), 0};
+    }
+    {
+      std::lock_guard<std::mutex> guard(lock_);
+      RETURN_NOT_OK(ReadRequests(requests.data(), requests.size()));
+    }
+    out->resize(ranges.size());
+    for (size_t i = 0; i < ranges.size(); ++i) {
+      if (requests[i].bytes_read < ranges[i].length) {
+        RETURN_NOT_OK(buffers[i]->Resize(requests[i].bytes_read));
+        buffers[i]->ZeroPadding();
+      }
+      (*out)[i] = std::move(buffers[i]);
+    }
+    return Status::OK();
+  }
+
+  int fd() const { return fd_; }
+
+ private:
+  struct ReadRequest {
+    int64_t offset;
+    int64_t length;
+    uint8_t* out;
+    int64_t bytes_read;
+  };
+
+  // A read request of at most a block, so a single submission queue entry
+  struct Block {
+    ReadRequest* request;
+    int64_t offset;
+    int64_t length;
+    uint8_t* out;
+    // The bytes read into out, or into the registered buffer with direct I/O
+    int64_t bytes_read;
+    // With direct I/O, the aligned range read and the registered buffer
+    int64_t aligned_offset;
+    int64_t aligned_length;
+    int slot;
+    iovec vec;
+  };
+
+  Status CheckOpen() const {
+    if (fd_ < 0) {
+      return Status::IOError("Operation on closed file");
+    }
+    return Status::OK();
+  }
+
+  int64_t slot_size() const { return options_.block_size + 2 * kDirectAlignment; }
+
+  Status RegisterDirectBuffers() {
+    const int num_slots = static_cast<int>(ring_.sq_entries());
+    RETURN_NOT_OK(AllocateBuffer(pool_, num_slots * slot_size() + kDirectAlignment,
+                                 &direct_buffers_));
+    const int64_t address = reinterpret_cast<int64_t>(direct_buffers_->data());
+    uint8_t* base = direct_buffers_->mutable_data() +
+                    (BitUtil::RoundUp(address, kDirectAlignment) - address);
+    std::vector<iovec> vecs(num_slots);
+    for (int i = 0; i < num_slots; ++i) {
+      vecs[i].iov_base = base + i * slot_size();
+      vecs[i].iov_len = static_cast<size_t>(slot_size());
+      free_slots_.push_back(i);
+    }
+    slots_ = vecs;
+    return ring_.RegisterBuffers(vecs);
+  }
+
+  void SubmitBlock(Block* block) {
+    io_uring_sqe* sqe = ring_.NextEntry();
+    sqe->fd = fd_;
+    sqe->user_data = reinterpret_cast<uint64_t>(block);
+    if (options_.direct_io) {
+      sqe->opcode = IORING_OP_READ_FIXED;
+      sqe->off = static_cast<uint64_t>(block->aligned_offset + block->bytes_read);
+      sqe->addr = reinterpret_cast<uint64_t>(
+          static_cast<uint8_t*>(slots_[block->slot].iov_base) + block->bytes_read);
+      sqe->len = static_cast<uint32_t>(block->aligned_length - block->bytes_read);
+      sqe->buf_index = static_cast<uint16_t>(block->slot);
+    } else {
+      block->vec.iov_base = block->out + block->bytes_read;
+      block->vec.iov_len = static_cast<size_t>(block->length - block->bytes_read);
+      sqe->opcode = IORING_OP_READV;
+      sqe->off = static_cast<uint64_t>(block->offset + block->bytes_read);
+      sqe->addr = reinterpret_cast<uint64_t>(&block->vec);
+      sqe->len = 1;
+    }
+  }
+
+  // Whether the block is to be read further after a read of result bytes
+  bool Advance(Block* block, int32_t result) {
+    if (result == 0) {
+      // End of file
+      return false;
+    }
+    block->bytes_read += result;
+    if (options_.direct_io) {
+      // A short read not ending on the alignment reached the end of file
+      return block->bytes_read < block->aligned_length &&
+             block->bytes_read % kDirectAlignment == 0;
+    }
+    return block->bytes_read < block->length;
+  }
+
+  void FinishBlock(Block* block) {
+    int64_t bytes_read = block->bytes_read;
+    if (options_.direct_io) {
+      const int64_t skip = block->offset - block->aligned_offset;
+      bytes_read = std::max<int64_t>(0, std::min(block->length, bytes_read - skip));
+      std::memcpy(block->out, static_cast<uint8_t*>(slots_[block->slot].iov_base) + skip,
+                  bytes_read);
+      free_slots_.push_back(block->slot);
+    }
+    block->request->bytes_read += bytes_read;
+  }
+
+  // Split the requests into blocks and keep as many in flight as the queue
+  // holds until all are read. Called with the lock held.
+  Status ReadRequests(ReadRequest* requests, size_t num_requests) {
+    RETURN_NOT_OK(CheckOpen());
+    std::vector<Block> blocks;
+    for (size_t i = 0; i < num_requests; ++i) {
+      ReadRequest* request = &requests[i];
+      if (request->offset < 0 || request->length < 0) {
+        return Status::Invalid("Invalid read range");
+      }
+      for (int64_t done = 0; done < request->length; done += options_.block_size) {
+        Block block;
+        block.request = request;
+        block.offset = request->offset + done;
+        block.length = std::min(options_.block_size, request->length - done);
+        block.out = request->out + done;
+        block.bytes_read = 0;
+        block.aligned_offset = block.offset & ~(kDirectAlignment - 1);
+        block.aligned_length = BitUtil::RoundUp(
+            block.offset + block.length - block.aligned_offset, kDirectAlignment);
+        block.slot = -1;
+        blocks.push_back(block);
+      }
+    }
+
+    Status status;
+    size_t next = 0;
+    unsigned in_flight = 0;
+    while ((status.ok() && next < blocks.size()) || in_flight > 0) {
+      while (status.ok() && next < blocks.size() && in_flight < ring_.sq_entries()) {
+        Block* block = &blocks[next++];
+        if (options_.direct_io) {
+          block->slot = free_slots_.back();
+          free_slots_.pop_back();
+        }
+        SubmitBlock(block);
+        ++in_flight;
+      }
+      Status enter_status = ring_.Enter();
+      if (!enter_status.ok()) {
+        // Nothing can be known of the reads in flight anymore
+        return enter_status;
+      }
+      uint64_t user_data;
+      int32_t result;
+      while (ring_.PopCompletion(&user_data, &result)) {
+        Block* block = reinterpret_cast<Block*>(user_data);
+        if (result == -EINTR || result == -EAGAIN) {
+          SubmitBlock(block);
+          continue;
+        }
+        if (result < 0) {
+          if (status.ok()) {
+            status = ErrnoError("io_uring read", -result);
+          }
+        } else if (Advance(block, result)) {
+          SubmitBlock(block);
+          continue;
+        }
+        FinishBlock(block);
+        --in_flight;
+      }
+    }
+    return status;
+  }
+
+  const UringOptions options_;
+  MemoryPool* pool_;
+  int fd_;
+  int64_t position_;
+  Ring ring_;
+  // With direct I/O, the buffers registered with the ring, a slot per entry
+  std::shared_ptr<Buffer> direct_buffers_;
+  std::vector<iovec> slots_;
+  std::vector<int> free_slots_;
+  mutable std::mutex lock_;
+};
+
+bool UringReadableFile::IsSupported() {
+  static const bool supported = Ring().Init(1).ok();
+  return supported;
+}
+
+Status UringReadableFile::Open(const std::string& path, const UringOptions& options,
+                               MemoryPool* pool,
+                               std::shared_ptr<UringReadableFile>* file) {
+  if (options.queue_depth <= 0 || options.block_size <= 0 ||
+      options.block_size > std::numeric_limits<int32_t>::max() / 2) {
+    return Status::Invalid("Invalid io_uring queue depth or block size");
+  }
+  std::unique_ptr<UringReadableFileImpl> impl(new UringReadableFileImpl(options, pool));
+  RETURN_NOT_OK(impl->Open(path));
+  file->reset(new UringReadableFile(std::move(impl)));
+  return Status::OK();
+}
+
+#else
+
+class UringReadableFile::UringReadableFileImpl {
+ public:
+  Status Close() { return Status::OK(); }
+  Status Tell(int64_t*) const { return Unsupported(); }
+  Status Seek(int64_t) { return Unsupported(); }
+  Status GetSize(int64_t*) { return Unsupported(); }
+  Status Read(int64_t, int64_t*, void*) { return Unsupported(); }
+  Status ReadBuffer(int64_t, std::shared_ptr<Buffer>*) { return Unsupported(); }
+  Status ReadAt(int64_t, int64_t, int64_t*, void*) { return Unsupported(); }
+  Status ReadBuffers(const std::vector<ReadRange>&,
+                     std::vector<std::shared_ptr<Buffer>>*) {
+    return Unsupported();
+  }
+  int fd() const { return -1; }
+
+ private:
+  static Status Unsupported() {
+    return Status::NotImplemented("io_uring is not supported by this build");
+  }
+};
+
+bool UringReadableFile::IsSupported() { return false; }
+
+Status UringReadableFile::Open(const std::string& path, const UringOptions& options,
+                               MemoryPool* pool,
+                               std::shared_ptr<UringReadableFile>* file) {
+  return Status::NotImplemented("io_uring is not supported by this build");
+}
+
+#endif  // ARROW_HAVE_IO_URING
+
+UringReadableFile::UringReadableFile(std::unique_ptr<UringReadableFileImpl> impl)
+    : impl_(std::move(impl)) {}
+
+UringReadableFile::~UringReadableFile() {}
+
+Status UringReadableFile::Open(const std::string& path,
+                               std::shared_ptr<UringReadableFile>* file) {
+  return Open(path, UringOptions(), default_memory_pool(), file);
+}
+
+Status UringReadableFile::Close() { return impl_->Close(); }
+
+Status UringReadableFile::Tell(int64_t* position) const { return impl_->Tell(position); }
+
+Status UringReadableFile::Seek(int64_t position) { return impl_->Seek(position); }
+
+Status UringReadableFile::GetSize(int64_t* size) { return impl_->GetSize(size); }
+
+Status UringReadableFile::Read(int64_t nbytes, int64_t* bytes_read, void* out) {
+  return impl_->Read(nbytes, bytes_read, out);
+}
+
+Status UringReadableFile::Read(int64_t nbytes, std::shared_ptr<Buffer>* out) {
+  return impl_->ReadBuffer(nbytes, out);
+}
+
+Status UringReadableFile::ReadAt(int64_t position, int64_t nbytes, int64_t* bytes_read,
+                                 void* out) {
+  return impl_->ReadAt(position, nbytes, bytes_read, out);
+}
+
+Status UringReadableFile::ReadAt(int64_t position, int64_t nbytes,
+                                 std::shared_ptr<Buffer>* out) {
+  std::vector<std::shared_ptr<Buffer>> buffers;
+  RETURN_NOT_OK(impl_->ReadBuffers({{position, nbytes}}, &buffers));
+  *out = std::move(buffers[0]);
+  return Status::OK();
+}
+
+Status UringReadableFile::ReadRanges(const std::vector<ReadRange>& ranges,
+                                     const ReadRangesOptions& options,
+                                     std::vector<std::shared_ptr<Buffer>>* out) {
+  const std::vector<ReadRange> merged = ::arrow::internal::CoalesceReadRanges(
+      ranges, options.hole_size_limit, options.range_size_limit);
+  std::vector<std::shared_ptr<Buffer>> merged_buffers;
+  RETURN_NOT_OK(impl_->ReadBuffers(merged, &merged_buffers));
+  *out = ::arrow::internal::SliceCoalescedRanges(ranges, merged, merged_buffers);
+  return Status::OK();
+}
+
+bool UringReadableFile::supports_zero_copy() const { return false; }
+
+int UringReadableFile::file_descriptor() const { return impl_->fd(); }
+
+}  // namespace io
+}  // namespace arrow
@@ -0,0 +1,119 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Local file reads through the io_uring interface of Linux
+
+#ifndef ARROW_IO_URING_H
+#define ARROW_IO_URING_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/io/interfaces.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Buffer;
+class MemoryPool;
+class Status;
+
+namespace io {
+
+/// \brief Options of UringReadableFile
+struct ARROW_EXPORT UringOptions {
+  UringOptions() : queue_depth(32), block_size(256 * 1024), direct_io(false) {}
+
+  /// The entries of the submission queue, so the most reads in flight
+  int queue_depth;
+  /// The most bytes a single read request is for, larger reads being split
+  /// into several submitted at once
+  int64_t block_size;
+  /// Whether to open the file with O_DIRECT, bypassing the page cache. Reads
+  /// then go through buffers registered with the kernel, allocated from the
+  /// memory pool, a block each for the reads in flight.
+  bool direct_io;
+};
+
+/// \class UringReadableFile
+/// \brief A local file read through io_uring
+///
+/// Reads are split into blocks submitted to the kernel together and waited
+/// for together, so that a single thread keeps many requests in flight on the
+/// device; ReadRanges submits the blocks of all its ranges in one batch. Only
+/// available on Linux 5.1 and later, see IsSupported.
+///
+/// The file can be used from several threads at once, their requests then
+/// taking turns on the queue.
+class ARROW_EXPORT UringReadableFile : public RandomAccessFile {
+ public:
+  ~UringReadableFile() override;
+
+  /// \brief Whether the build and the running kernel support io_uring
+  static bool IsSupported();
+
+  /// \brief Open a local file for reading
+  /// \param[in] path with UTF8 encoding
+  /// \param[in] options the queue depth and block size, and whether to
+  /// bypass the page cache
+  /// \param[in] pool a MemoryPool for memory allocations
+  /// \param[out] file UringReadableFile instance
+  /// \return Status, NotImplemented if io_uring is not supported
+  static Status Open(const std::string& path, const UringOptions& options,
+                     MemoryPool* pool, std::shared_ptr<UringReadableFile>* file);
+
+  /// \brief Open a local file for reading with the default options, allocating
+  /// memory from the default memory pool
+  static Status Open(const std::string& path, std::shared_ptr<UringReadableFile>* file);
+
+  Status Close() override;
+  Status Tell(int64_t* position) const override;
+
+  Status Read(int64_t nbytes, int64_t* bytes_read, void* buffer) override;
+  Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) override;
+
+  Status ReadAt(int64_t position, int64_t nbytes, int64_t* bytes_read,
+                void* out) override;
+  Status ReadAt(int64_t position, int64_t nbytes, std::shared_ptr<Buffer>* out) override;
+
+  /// \brief Read the ranges, merged as configured, in a single batch of
+  /// requests
+  Status ReadRanges(const std::vector<ReadRange>& ranges,
+                    const ReadRangesOptions& options,
+                    std::vector<std::shared_ptr<Buffer>>* out) override;
+
+  Status GetSize(int64_t* size) override;
+  Status Seek(int64_t position) override;
+
+  bool supports_zero_copy() const override;
+
+  int file_descriptor() const;
+
+ private:
+  class ARROW_NO_EXPORT UringReadableFileImpl;
+
+  explicit UringReadableFile(std::unique_ptr<UringReadableFileImpl> impl);
+
+  std::unique_ptr<UringReadableFileImpl> impl_;
+};
+
+}  // namespace io
+}  // namespace arrow
+
+#endif  // ARROW_IO_URING_H
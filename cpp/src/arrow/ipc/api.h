@@ -22,7 +22,9 @@
 #include "arrow/ipc/feather.h"
 #include "arrow/ipc/json.h"
 #include "arrow/ipc/message.h"
+#include "arrow/ipc/ndjson.h"
 #include "arrow/ipc/reader.h"
+#include "arrow/ipc/transport.h"
 #include "arrow/ipc/writer.h"
 
 #endif  // ARROW_IPC_API_H
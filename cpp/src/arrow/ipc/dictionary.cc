@@ -22,6 +22,7 @@
 #include <sstream>
 #include <utility>
 
+#include "arrow/concatenate.h"
 #include "arrow/status.h"
 
 namespace arrow {
@@ -80,5 +81,16 @@ Status DictionaryMemo::AddDictionary(int64_t id,
   return Status::OK();
 }
 
+Status DictionaryMemo::AddDictionaryDelta(int64_t id, const std::shared_ptr<Array>& delta,
+                                          MemoryPool* pool) {
+  std::shared_ptr<Array> dictionary;
+  RETURN_NOT_OK(GetDictionary(id, &dictionary));
+  RETURN_NOT_OK(Concatenate({dictionary, delta}, pool, &dictionary));
+  intptr_t address = reinterpret_cast<intptr_t>(dictionary.get());
+  id_to_dictionary_[id] = dictionary;
+  dictionary_to_id_[address] = id;
+  return Status::OK();
+}
+
 }  // namespace ipc
 }  // namespace arrow
@@ -32,6 +32,7 @@ namespace arrow {
 
 class Array;
 class Field;
+class MemoryPool;
 
 namespace ipc {
 
@@ -59,6 +60,12 @@ class ARROW_EXPORT DictionaryMemo {
   /// KeyError if that dictionary already exists
   Status AddDictionary(int64_t id, const std::shared_ptr<Array>& dictionary);
 
+  /// \brief Append the entries of a delta dictionary batch to the dictionary
+  /// of a particular id, into a new array allocated from pool. Returns
+  /// KeyError if there is no dictionary of that id
+  Status AddDictionaryDelta(int64_t id, const std::shared_ptr<Array>& delta,
+                            MemoryPool* pool);
+
   const DictionaryMap& id_to_dictionary() const { return id_to_dictionary_; }
 
   /// \brief The number of dictionaries stored in the memo
@@ -60,7 +60,10 @@ struct ARROW_EXPORT ArrayMetadata {
   bool Equals(const ArrayMetadata& other) const {
     return this->type == other.type && this->offset == other.offset &&
            this->length == other.length && this->null_count == other.null_count &&
-           this->total_bytes == other.total_bytes;
+           this->total_bytes == other.total_bytes &&
+           this->compression == other.compression &&
+           this->uncompressed_bytes == other.uncompressed_bytes &&
+           this->block_compressed == other.block_compressed;
   }
 
   fbs::Type type;
@@ -68,6 +71,12 @@ struct ARROW_EXPORT ArrayMetadata {
   int64_t length;
   int64_t null_count;
   int64_t total_bytes;
+
+  // The data is compressed unless UNCOMPRESSED, into total_bytes
+  fbs::CompressionType compression = fbs::CompressionType_UNCOMPRESSED;
+  int64_t uncompressed_bytes = 0;
+  // Whether the data is compressed in blocks, by CompressBlocks
+  bool block_compressed = false;
 };
 
 struct ARROW_EXPORT CategoryMetadata {
@@ -156,7 +165,9 @@ class ARROW_EXPORT TableMetadata {
 static inline flatbuffers::Offset<fbs::PrimitiveArray> GetPrimitiveArray(
     FBB& fbb, const ArrayMetadata& array) {
   return fbs::CreatePrimitiveArray(fbb, array.type, fbs::Encoding_PLAIN, array.offset,
-                                   array.length, array.null_count, array.total_bytes);
+                                   array.length, array.null_count, array.total_bytes,
+                                   array.compression, array.uncompressed_bytes,
+                                   array.block_compressed);
 }
 
 static inline fbs::TimeUnit ToFlatbufferEnum(TimeUnit::type unit) {
@@ -187,6 +198,9 @@ static inline void FromFlatbuffer(const fbs::PrimitiveArray* values, ArrayMetada
   out->length = values->length();
   out->null_count = values->null_count();
   out->total_bytes = values->total_bytes();
+  out->compression = values->compression();
+  out->uncompressed_bytes = values->uncompressed_bytes();
+  out->block_compressed = values->block_compressed();
 }
 
 class ARROW_EXPORT ColumnBuilder {
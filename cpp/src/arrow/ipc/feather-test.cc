@@ -24,6 +24,7 @@
 
 #include "gtest/gtest.h"
 
+#include "arrow/concatenate.h"
 #include "arrow/io/memory.h"
 #include "arrow/ipc/feather-internal.h"
 #include "arrow/ipc/feather.h"
@@ -32,6 +33,7 @@
 #include "arrow/table.h"
 #include "arrow/test-util.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/compression.h"
 
 namespace arrow {
 namespace ipc {
@@ -350,6 +352,24 @@ TEST_F(TestTableWriter, CategoryRoundtrip) {
   CheckBatch(*batch);
 }
 
+TEST_F(TestTableWriter, CategoryZeroCopy) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeDictionaryFlat(&batch));
+  CheckBatch(*batch);
+
+  // The indices are slices of the file, and the levels are read once
+  std::shared_ptr<Column> first, second;
+  ASSERT_OK(reader_->GetColumn(0, &first));
+  ASSERT_OK(reader_->GetColumn(0, &second));
+  const auto& first_type = checked_cast<const DictionaryType&>(*first->type());
+  const auto& second_type = checked_cast<const DictionaryType&>(*second->type());
+  ASSERT_EQ(first_type.dictionary().get(), second_type.dictionary().get());
+
+  const uint8_t* indices = first->data()->chunk(0)->data()->buffers[1]->data();
+  ASSERT_GE(indices, output_->data());
+  ASSERT_LT(indices, output_->data() + output_->size());
+}
+
 TEST_F(TestTableWriter, TimeTypes) {
   std::vector<bool> is_valid = {true, true, true, false, true, true, true};
   auto f0 = field("f0", date32());
@@ -422,6 +442,158 @@ TEST_F(TestTableWriter, PrimitiveNullRoundTrip) {
   }
 }
 
+TEST_F(TestTableWriter, ChunkedColumns) {
+  std::shared_ptr<RecordBatch> ints, strings, bools;
+  ASSERT_OK(MakeIntBatchSized(30, &ints));
+  ASSERT_OK(MakeStringTypesRecordBatch(&strings));
+  ASSERT_OK(MakeBooleanBatchSized(30, &bools));
+
+  // Chunks at bit offsets and with or without nulls, as those of slices are
+  std::vector<std::shared_ptr<ChunkedArray>> columns;
+  for (const auto& batch : {ints, strings, bools}) {
+    const auto& array = batch->column(0);
+    columns.push_back(std::make_shared<ChunkedArray>(
+        ArrayVector{array->Slice(0, 3), array->Slice(3, 0), array->Slice(5)}));
+  }
+  for (size_t i = 0; i < columns.size(); ++i) {
+    ASSERT_OK(writer_->Append("f" + std::to_string(i), *columns[i]));
+  }
+  Finish();
+
+  std::shared_ptr<Table> table;
+  ASSERT_OK(reader_->Read(&table, true));
+  ASSERT_EQ(3, table->num_columns());
+  for (size_t i = 0; i < columns.size(); ++i) {
+    std::shared_ptr<Array> expected;
+    ASSERT_OK(Concatenate(columns[i]->chunks(), default_memory_pool(), &expected));
+    ASSERT_EQ(1, table->column(static_cast<int>(i))->data()->num_chunks());
+    CheckArrays(*expected, *table->column(static_cast<int>(i))->data()->chunk(0));
+  }
+}
+
+TEST_F(TestTableWriter, ReadColumnSubset) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeIntBatchSized(30, &batch));
+  ASSERT_OK(writer_->Append("f0", *batch->column(0)));
+  ASSERT_OK(writer_->Append("f1", *batch->column(1)));
+  ASSERT_OK(writer_->Append("f2", *batch->column(0)));
+  Finish();
+
+  for (bool use_threads : {false, true}) {
+    std::shared_ptr<Table> table;
+    ASSERT_OK(reader_->Read({2, 1}, &table, use_threads));
+    ASSERT_EQ(2, table->num_columns());
+    ASSERT_EQ(30, table->num_rows());
+    ASSERT_EQ("f2", table->column(0)->name());
+    ASSERT_EQ("f1", table->column(1)->name());
+    CheckArrays(*batch->column(1), *table->column(1)->data()->chunk(0));
+  }
+
+  std::shared_ptr<Table> table;
+  ASSERT_RAISES(Invalid, reader_->Read({0, 3}, &table));
+}
+
+TEST_F(TestTableWriter, AppendColumns) {
+  std::shared_ptr<RecordBatch> ints;
+  ASSERT_OK(MakeIntBatchSized(10, &ints));
+  writer_->SetDescription("first");
+  ASSERT_OK(writer_->Append("f0", *ints->column(0)));
+  Finish();
+  const std::shared_ptr<Buffer> first = output_;
+
+  // Append to the file, as a file opened to append would
+  auto source = std::make_shared<io::BufferReader>(first);
+  std::shared_ptr<io::BufferOutputStream> appended;
+  ASSERT_OK(io::BufferOutputStream::Create(1024, default_memory_pool(), &appended));
+  std::unique_ptr<TableWriter> writer;
+  ASSERT_OK(TableWriter::OpenAppend(source, appended, &writer));
+  ASSERT_RAISES(Invalid, writer->Append("f1", *ints->column(1)->Slice(1)));
+  ASSERT_OK(writer->Append("f1", *ints->column(1)));
+  ASSERT_OK(writer->Finalize());
+  std::shared_ptr<Buffer> appended_bytes;
+  ASSERT_OK(appended->Finish(&appended_bytes));
+
+  std::shared_ptr<io::BufferOutputStream> file;
+  ASSERT_OK(io::BufferOutputStream::Create(1024, default_memory_pool(), &file));
+  ASSERT_OK(file->Write(first->data(), first->size()));
+  ASSERT_OK(file->Write(appended_bytes->data(), appended_bytes->size()));
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(file->Finish(&buffer));
+
+  ASSERT_OK(TableReader::Open(std::make_shared<io::BufferReader>(buffer), &reader_));
+  ASSERT_EQ("first", reader_->GetDescription());
+  ASSERT_EQ(2, reader_->num_columns());
+  std::shared_ptr<Table> table;
+  ASSERT_OK(reader_->Read(&table));
+  ASSERT_EQ("f0", table->column(0)->name());
+  ASSERT_EQ("f1", table->column(1)->name());
+  CheckArrays(*ints->column(0), *table->column(0)->data()->chunk(0));
+  CheckArrays(*ints->column(1), *table->column(1)->data()->chunk(0));
+}
+
+TEST_F(TestTableWriter, CompressedColumns) {
+  std::shared_ptr<RecordBatch> strings;
+  ASSERT_OK(MakeStringTypesRecordBatch(&strings));
+  std::vector<int64_t> values(10000);
+  for (size_t i = 0; i < values.size(); ++i) {
+    values[i] = static_cast<int64_t>(i % 7);
+  }
+  std::shared_ptr<Array> ints;
+  ArrayFromVector<Int64Type, int64_t>(values, &ints);
+
+  for (auto compression : {Compression::SNAPPY, Compression::GZIP, Compression::BROTLI,
+                           Compression::ZSTD, Compression::LZ4}) {
+    std::unique_ptr<Codec> codec;
+    if (!Codec::Create(compression, &codec).ok()) {
+      // Not built with this codec
+      continue;
+    }
+    SetUp();
+    ASSERT_OK(writer_->Append("ints", ChunkedArray({ints}), compression));
+    ASSERT_OK(writer_->Append("strings", ChunkedArray({strings->column(0)}),
+                              compression));
+    Finish();
+    // The repetitive values must have shrunk
+    ASSERT_LT(output_->size(), static_cast<int64_t>(values.size() * sizeof(int64_t)));
+
+    std::shared_ptr<Table> table;
+    ASSERT_OK(reader_->Read(&table, true));
+    CheckArrays(*ints, *table->column(0)->data()->chunk(0));
+    CheckArrays(*strings->column(0), *table->column(1)->data()->chunk(0));
+  }
+}
+
+TEST_F(TestTableWriter, CompressedColumnBlocks) {
+  // A column of several compression blocks, the last one partial
+  std::vector<int64_t> values(kDefaultCompressionBlockSize * 5 / 2 / sizeof(int64_t));
+  for (size_t i = 0; i < values.size(); ++i) {
+    values[i] = static_cast<int64_t>(i % 7);
+  }
+  std::shared_ptr<Array> ints;
+  ArrayFromVector<Int64Type, int64_t>(values, &ints);
+
+  for (auto compression : {Compression::LZ4, Compression::ZSTD, Compression::GZIP}) {
+    std::unique_ptr<Codec> codec;
+    if (!Codec::Create(compression, &codec).ok()) {
+      // Not built with this codec
+      continue;
+    }
+    SetUp();
+    ASSERT_OK(writer_->Append("ints", ChunkedArray({ints}), compression));
+    Finish();
+    ASSERT_LT(output_->size(), static_cast<int64_t>(values.size() * sizeof(int64_t)));
+
+    // The blocks of the single column are decompressed in parallel
+    std::shared_ptr<Table> table;
+    ASSERT_OK(reader_->Read({0}, &table, true));
+    CheckArrays(*ints, *table->column(0)->data()->chunk(0));
+
+    std::shared_ptr<Column> column;
+    ASSERT_OK(reader_->GetColumn(0, &column));
+    CheckArrays(*ints, *column->data()->chunk(0));
+  }
+}
+
 class TestTableWriterSlice : public TestTableWriter,
                              public ::testing::WithParamInterface<std::tuple<int, int>> {
  public:
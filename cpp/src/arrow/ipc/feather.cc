@@ -17,9 +17,12 @@
 
 #include "arrow/ipc/feather.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
+#include <limits>
 #include <memory>
+#include <mutex>
 #include <sstream>  // IWYU pragma: keep
 #include <string>
 #include <utility>
@@ -29,17 +32,22 @@
 
 #include "arrow/array.h"
 #include "arrow/buffer.h"
+#include "arrow/builder.h"
 #include "arrow/io/interfaces.h"
+#include "arrow/io/memory.h"
 #include "arrow/ipc/feather-internal.h"
 #include "arrow/ipc/feather_generated.h"
 #include "arrow/ipc/util.h"  // IWYU pragma: keep
+#include "arrow/memory_pool.h"
 #include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
 #include "arrow/type.h"
 #include "arrow/util/bit-util.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
 #include "arrow/visitor.h"
 
 namespace arrow {
@@ -76,57 +84,73 @@ static Status WritePadded(io::OutputStream* stream, const uint8_t* data, int64_t
   return Status::OK();
 }
 
-static Status WritePaddedWithOffset(io::OutputStream* stream, const uint8_t* data,
-                                    int64_t bit_offset, const int64_t length,
-                                    int64_t* bytes_written) {
-  data = data + bit_offset / 8;
-  uint8_t bit_shift = static_cast<uint8_t>(bit_offset % 8);
-  if (bit_offset == 0) {
-    RETURN_NOT_OK(stream->Write(data, length));
-  } else {
-    constexpr int64_t buffersize = 256;
-    uint8_t buffer[buffersize];
-    const uint8_t lshift = static_cast<uint8_t>(8 - bit_shift);
-    const uint8_t* buffer_end = buffer + buffersize;
-    uint8_t* buffer_it = buffer;
-
-    for (const uint8_t* end = data + length; data != end;) {
-      uint8_t r = static_cast<uint8_t>(*data++ >> bit_shift);
-      uint8_t l = static_cast<uint8_t>(*data << lshift);
-      uint8_t value = l | r;
-      *buffer_it++ = value;
-      if (buffer_it == buffer_end) {
-        RETURN_NOT_OK(stream->Write(buffer, buffersize));
-        buffer_it = buffer;
-      }
-    }
-    if (buffer_it != buffer) {
-      RETURN_NOT_OK(stream->Write(buffer, buffer_it - buffer));
-    }
-  }
-
-  int64_t remainder = PaddedLength(length) - length;
+// Write zeros up to the next aligned length, after nbytes of data
+static Status WritePadding(io::OutputStream* stream, int64_t nbytes) {
+  const int64_t remainder = PaddedLength(nbytes) - nbytes;
   if (remainder != 0) {
     RETURN_NOT_OK(stream->Write(kPaddingBytes, remainder));
   }
-  *bytes_written = length + remainder;
   return Status::OK();
 }
 
-/// For compability, we need to write any data sometimes just to keep producing
-/// files that can be read with an older reader.
-static Status WritePaddedBlank(io::OutputStream* stream, int64_t length,
-                               int64_t* bytes_written) {
-  const uint8_t null = 0;
-  for (int64_t i = 0; i < length; i++) {
-    RETURN_NOT_OK(stream->Write(&null, 1));
+static Status WriteZeros(io::OutputStream* stream, int64_t nbytes) {
+  while (nbytes > 0) {
+    const int64_t chunk_size = std::min<int64_t>(nbytes, kFeatherDefaultAlignment);
+    RETURN_NOT_OK(stream->Write(kPaddingBytes, chunk_size));
+    nbytes -= chunk_size;
   }
+  return Status::OK();
+}
 
-  int64_t remainder = PaddedLength(length) - length;
-  if (remainder != 0) {
-    RETURN_NOT_OK(stream->Write(kPaddingBytes, remainder));
+static Status ToFlatbuffer(Compression::type compression, fbs::CompressionType* out) {
+  switch (compression) {
+    case Compression::UNCOMPRESSED:
+      *out = fbs::CompressionType_UNCOMPRESSED;
+      break;
+    case Compression::SNAPPY:
+      *out = fbs::CompressionType_SNAPPY;
+      break;
+    case Compression::GZIP:
+      *out = fbs::CompressionType_GZIP;
+      break;
+    case Compression::BROTLI:
+      *out = fbs::CompressionType_BROTLI;
+      break;
+    case Compression::ZSTD:
+      *out = fbs::CompressionType_ZSTD;
+      break;
+    case Compression::LZ4:
+      *out = fbs::CompressionType_LZ4;
+      break;
+    default:
+      return Status::NotImplemented("Feather does not support this compression codec");
+  }
+  return Status::OK();
+}
+
+static Status FromFlatbuffer(fbs::CompressionType compression, Compression::type* out) {
+  switch (compression) {
+    case fbs::CompressionType_UNCOMPRESSED:
+      *out = Compression::UNCOMPRESSED;
+      break;
+    case fbs::CompressionType_SNAPPY:
+      *out = Compression::SNAPPY;
+      break;
+    case fbs::CompressionType_GZIP:
+      *out = Compression::GZIP;
+      break;
+    case fbs::CompressionType_BROTLI:
+      *out = Compression::BROTLI;
+      break;
+    case fbs::CompressionType_ZSTD:
+      *out = Compression::ZSTD;
+      break;
+    case fbs::CompressionType_LZ4:
+      *out = Compression::LZ4;
+      break;
+    default:
+      return Status::Invalid("Unrecognized compression type");
   }
-  *bytes_written = length + remainder;
   return Status::OK();
 }
 
@@ -266,46 +290,76 @@ std::unique_ptr<ColumnBuilder> TableBuilder::AddColumn(const std::string& name)
 // ----------------------------------------------------------------------
 // reader.cc
 
+// Read and verify the magic bytes and the footer of a file, and its metadata
+static Status ReadTableMetadata(io::RandomAccessFile* source,
+                                std::unique_ptr<TableMetadata>* out) {
+  int magic_size = static_cast<int>(strlen(kFeatherMagicBytes));
+  int footer_size = magic_size + static_cast<int>(sizeof(uint32_t));
+
+  // Pathological issue where the file is smaller than
+  int64_t size = 0;
+  RETURN_NOT_OK(source->GetSize(&size));
+  if (size < magic_size + footer_size) {
+    return Status::Invalid("File is too small to be a well-formed file");
+  }
+
+  std::shared_ptr<Buffer> buffer;
+  RETURN_NOT_OK(source->ReadAt(0, magic_size, &buffer));
+
+  if (memcmp(buffer->data(), kFeatherMagicBytes, magic_size)) {
+    return Status::Invalid("Not a feather file");
+  }
+
+  // Now get the footer and verify
+  RETURN_NOT_OK(source->ReadAt(size - footer_size, footer_size, &buffer));
+
+  if (memcmp(buffer->data() + sizeof(uint32_t), kFeatherMagicBytes, magic_size)) {
+    return Status::Invalid("Feather file footer incomplete");
+  }
+
+  uint32_t metadata_length = *reinterpret_cast<const uint32_t*>(buffer->data());
+  if (size < magic_size + footer_size + metadata_length) {
+    return Status::Invalid("File is smaller than indicated metadata size");
+  }
+  RETURN_NOT_OK(
+      source->ReadAt(size - footer_size - metadata_length, metadata_length, &buffer));
+
+  out->reset(new TableMetadata());
+  return (*out)->Open(buffer);
+}
+
 class TableReader::TableReaderImpl {
  public:
   TableReaderImpl() {}
 
   Status Open(const std::shared_ptr<io::RandomAccessFile>& source) {
     source_ = source;
+    RETURN_NOT_OK(ReadTableMetadata(source.get(), &metadata_));
+    column_types_.resize(static_cast<size_t>(metadata_->num_columns()));
+    return Status::OK();
+  }
 
-    int magic_size = static_cast<int>(strlen(kFeatherMagicBytes));
-    int footer_size = magic_size + static_cast<int>(sizeof(uint32_t));
-
-    // Pathological issue where the file is smaller than
-    int64_t size = 0;
-    RETURN_NOT_OK(source->GetSize(&size));
-    if (size < magic_size + footer_size) {
-      return Status::Invalid("File is too small to be a well-formed file");
-    }
-
-    std::shared_ptr<Buffer> buffer;
-    RETURN_NOT_OK(source->ReadAt(0, magic_size, &buffer));
-
-    if (memcmp(buffer->data(), kFeatherMagicBytes, magic_size)) {
-      return Status::Invalid("Not a feather file");
+  // The type of a column, decoded once: that of a category column holds its
+  // levels, read from the file
+  Status GetColumnType(int i, std::shared_ptr<DataType>* out) {
+    {
+      std::lock_guard<std::mutex> lock(column_types_mutex_);
+      *out = column_types_[i];
     }
-
-    // Now get the footer and verify
-    RETURN_NOT_OK(source->ReadAt(size - footer_size, footer_size, &buffer));
-
-    if (memcmp(buffer->data() + sizeof(uint32_t), kFeatherMagicBytes, magic_size)) {
-      return Status::Invalid("Feather file footer incomplete");
+    if (*out != nullptr) {
+      return Status::OK();
     }
-
-    uint32_t metadata_length = *reinterpret_cast<const uint32_t*>(buffer->data());
-    if (size < magic_size + footer_size + metadata_length) {
-      return Status::Invalid("File is smaller than indicated metadata size");
+    const fbs::Column* col_meta = metadata_->column(i);
+    RETURN_NOT_OK(GetDataType(col_meta->values(), col_meta->metadata_type(),
+                              col_meta->metadata(), out));
+    std::lock_guard<std::mutex> lock(column_types_mutex_);
+    // Keep the type decoded first if another thread decoded it too
+    if (column_types_[i] == nullptr) {
+      column_types_[i] = *out;
+    } else {
+      *out = column_types_[i];
     }
-    RETURN_NOT_OK(
-        source->ReadAt(size - footer_size - metadata_length, metadata_length, &buffer));
-
-    metadata_.reset(new TableMetadata());
-    return metadata_->Open(buffer);
+    return Status::OK();
   }
 
   Status GetDataType(const fbs::PrimitiveArray* values, fbs::TypeMetadata metadata_type,
@@ -322,9 +376,12 @@ class TableReader::TableReaderImpl {
         std::shared_ptr<DataType> index_type;
         RETURN_NOT_OK(GetDataType(values, fbs::TypeMetadata_NONE, nullptr, &index_type));
 
-        std::shared_ptr<Array> levels;
+        std::shared_ptr<DataType> levels_type;
         RETURN_NOT_OK(
-            LoadValues(meta->levels(), fbs::TypeMetadata_NONE, nullptr, &levels));
+            GetDataType(meta->levels(), fbs::TypeMetadata_NONE, nullptr, &levels_type));
+        std::shared_ptr<Array> levels;
+        // The type may be decoded from a task of the thread pool
+        RETURN_NOT_OK(LoadValues(meta->levels(), levels_type, false, &levels));
 
         *out = std::make_shared<DictionaryType>(index_type, levels, meta->ordered());
         break;
@@ -374,21 +431,23 @@ class TableReader::TableReaderImpl {
     return Status::OK();
   }
 
-  // Retrieve a primitive array from the data source
+  // Retrieve a primitive array from the data source, decompressing its blocks
+  // on the CPU thread pool if use_threads
   //
   // @returns: a Buffer instance, the precise type will depend on the kind of
   // input data source (which may or may not have memory-map like semantics)
-  Status LoadValues(const fbs::PrimitiveArray* meta, fbs::TypeMetadata metadata_type,
-                    const void* metadata, std::shared_ptr<Array>* out) {
-    std::shared_ptr<DataType> type;
-    RETURN_NOT_OK(GetDataType(meta, metadata_type, metadata, &type));
-
+  Status LoadValues(const fbs::PrimitiveArray* meta,
+                    const std::shared_ptr<DataType>& type, bool use_threads,
+                    std::shared_ptr<Array>* out) {
     std::vector<std::shared_ptr<Buffer>> buffers;
 
     // Buffer data from the source (may or may not perform a copy depending on
     // input source)
     std::shared_ptr<Buffer> buffer;
     RETURN_NOT_OK(source_->ReadAt(meta->offset(), meta->total_bytes(), &buffer));
+    if (meta->compression() != fbs::CompressionType_UNCOMPRESSED) {
+      RETURN_NOT_OK(Decompress(*meta, buffer, use_threads, &buffer));
+    }
 
     int64_t offset = 0;
 
@@ -415,6 +474,34 @@ class TableReader::TableReaderImpl {
     return Status::OK();
   }
 
+  Status Decompress(const fbs::PrimitiveArray& meta,
+                    const std::shared_ptr<Buffer>& compressed, bool use_threads,
+                    std::shared_ptr<Buffer>* out) {
+    Compression::type compression;
+    RETURN_NOT_OK(FromFlatbuffer(meta.compression(), &compression));
+    if (meta.block_compressed()) {
+      std::vector<std::shared_ptr<Buffer>> decompressed;
+      RETURN_NOT_OK(DecompressBlocks(compression, {compressed}, use_threads,
+                                     default_memory_pool(), &decompressed));
+      if (decompressed[0]->size() != meta.uncompressed_bytes()) {
+        return Status::IOError("Decompressed column does not have the expected size");
+      }
+      *out = decompressed[0];
+      return Status::OK();
+    }
+    std::unique_ptr<Codec> codec;
+    RETURN_NOT_OK(Codec::Create(compression, &codec));
+
+    std::shared_ptr<Buffer> decompressed;
+    RETURN_NOT_OK(AllocateBuffer(default_memory_pool(), meta.uncompressed_bytes(),
+                                 &decompressed));
+    RETURN_NOT_OK(codec->Decompress(compressed->size(), compressed->data(),
+                                    decompressed->size(),
+                                    decompressed->mutable_data()));
+    *out = decompressed;
+    return Status::OK();
+  }
+
   bool HasDescription() const { return metadata_->HasDescription(); }
 
   std::string GetDescription() const { return metadata_->GetDescription(); }
@@ -428,24 +515,74 @@ class TableReader::TableReaderImpl {
     return col_meta->name()->str();
   }
 
-  Status GetColumn(int i, std::shared_ptr<Column>* out) {
+  Status GetColumn(int i, bool use_threads, std::shared_ptr<Column>* out) {
     const fbs::Column* col_meta = metadata_->column(i);
 
     // auto user_meta = column->user_metadata();
     // if (user_meta->size() > 0) { user_metadata_ = user_meta->str(); }
 
+    std::shared_ptr<DataType> type;
+    RETURN_NOT_OK(GetColumnType(i, &type));
     std::shared_ptr<Array> values;
-    RETURN_NOT_OK(LoadValues(col_meta->values(), col_meta->metadata_type(),
-                             col_meta->metadata(), &values));
+    RETURN_NOT_OK(LoadValues(col_meta->values(), type, use_threads, &values));
     out->reset(new Column(col_meta->name()->str(), values));
     return Status::OK();
   }
 
+  Status Read(std::shared_ptr<Table>* out, bool use_threads) {
+    std::vector<int> indices(static_cast<size_t>(metadata_->num_columns()));
+    for (size_t i = 0; i < indices.size(); ++i) {
+      indices[i] = static_cast<int>(i);
+    }
+    return Read(indices, out, use_threads);
+  }
+
+  Status Read(const std::vector<int>& indices, std::shared_ptr<Table>* out,
+              bool use_threads) {
+    for (int index : indices) {
+      if (index < 0 || index >= metadata_->num_columns()) {
+        std::stringstream ss;
+        ss << "Column index " << index << " out of bounds, the file has "
+           << metadata_->num_columns() << " columns";
+        return Status::Invalid(ss.str());
+      }
+    }
+
+    const int num_columns = static_cast<int>(indices.size());
+    std::vector<std::shared_ptr<Column>> columns(num_columns);
+    // Columns are read, and decompressed, independently of each other. The
+    // blocks of a column are decompressed in parallel when a single column is
+    const bool parallel_columns = use_threads && num_columns > 1;
+    auto read_column = [&](int i) -> Status {
+      return GetColumn(indices[i], use_threads && !parallel_columns, &columns[i]);
+    };
+    if (parallel_columns) {
+      RETURN_NOT_OK(ParallelFor(num_columns, read_column));
+    } else {
+      for (int i = 0; i < num_columns; ++i) {
+        RETURN_NOT_OK(read_column(i));
+      }
+    }
+
+    std::vector<std::shared_ptr<Field>> fields;
+    for (const auto& column : columns) {
+      fields.push_back(column->field());
+    }
+    // The number of rows is only set by some writers
+    *out = Table::Make(::arrow::schema(fields), columns,
+                       num_columns == 0 ? metadata_->num_rows() : -1);
+    return Status::OK();
+  }
+
  private:
   std::shared_ptr<io::RandomAccessFile> source_;
   std::unique_ptr<TableMetadata> metadata_;
 
   std::shared_ptr<Schema> schema_;
+
+  // Guards column_types_, as columns may be read from several threads
+  std::mutex column_types_mutex_;
+  std::vector<std::shared_ptr<DataType>> column_types_;
 };
 
 // ----------------------------------------------------------------------
@@ -474,7 +611,16 @@ int64_t TableReader::num_columns() const { return impl_->num_columns(); }
 std::string TableReader::GetColumnName(int i) const { return impl_->GetColumnName(i); }
 
 Status TableReader::GetColumn(int i, std::shared_ptr<Column>* out) {
-  return impl_->GetColumn(i, out);
+  return impl_->GetColumn(i, false /* use_threads */, out);
+}
+
+Status TableReader::Read(std::shared_ptr<Table>* out, bool use_threads) {
+  return impl_->Read(out, use_threads);
+}
+
+Status TableReader::Read(const std::vector<int>& indices, std::shared_ptr<Table>* out,
+                         bool use_threads) {
+  return impl_->Read(indices, out, use_threads);
 }
 
 // ----------------------------------------------------------------------
@@ -536,15 +682,76 @@ static Status SanitizeUnsupportedTypes(const Array& values, std::shared_ptr<Arra
   }
 }
 
+// An output stream appending to a file, telling the positions written at in
+// the file. Those told by a stream appending to a file may not be, before it
+// first writes
+class FileAppendStream : public io::OutputStream {
+ public:
+  FileAppendStream(const std::shared_ptr<io::OutputStream>& stream, int64_t file_size)
+      : stream_(stream), position_(file_size) {}
+
+  Status Close() override { return stream_->Close(); }
+
+  Status Tell(int64_t* position) const override {
+    *position = position_;
+    return Status::OK();
+  }
+
+  Status Write(const void* data, int64_t nbytes) override {
+    RETURN_NOT_OK(stream_->Write(data, nbytes));
+    position_ += nbytes;
+    return Status::OK();
+  }
+
+  Status Flush() override { return stream_->Flush(); }
+
+ private:
+  std::shared_ptr<io::OutputStream> stream_;
+  int64_t position_;
+};
+
 class TableWriter::TableWriterImpl : public ArrayVisitor {
  public:
-  TableWriterImpl() : initialized_stream_(false), metadata_(0) {}
+  TableWriterImpl()
+      : initialized_stream_(false),
+        metadata_(0),
+        num_rows_(-1),
+        compression_(Compression::UNCOMPRESSED) {}
 
   Status Open(const std::shared_ptr<io::OutputStream>& stream) {
     stream_ = stream;
     return Status::OK();
   }
 
+  Status OpenAppend(const std::shared_ptr<io::RandomAccessFile>& source,
+                    const std::shared_ptr<io::OutputStream>& stream) {
+    std::unique_ptr<TableMetadata> existing;
+    RETURN_NOT_OK(ReadTableMetadata(source.get(), &existing));
+    if (existing->version() != kFeatherVersion) {
+      std::stringstream ss;
+      ss << "Cannot append to a file of Feather version " << existing->version();
+      return Status::Invalid(ss.str());
+    }
+    if (existing->HasDescription()) {
+      metadata_.SetDescription(existing->GetDescription());
+    }
+    metadata_.SetNumRows(existing->num_rows());
+    for (int i = 0; i < existing->num_columns(); ++i) {
+      RETURN_NOT_OK(AddExistingColumn(*existing->column(i)));
+    }
+    if (existing->num_columns() > 0) {
+      num_rows_ = existing->column(0)->values()->length();
+    }
+
+    int64_t size;
+    RETURN_NOT_OK(source->GetSize(&size));
+    stream_ = std::make_shared<FileAppendStream>(stream, size);
+    initialized_stream_ = true;
+    // The columns are aligned in the file, which other writers need not end at
+    // an aligned length
+    return WritePadding(stream_.get(), size);
+  }
+
   void SetDescription(const std::string& desc) { metadata_.SetDescription(desc); }
 
   void SetNumRows(int64_t num_rows) { metadata_.SetNumRows(num_rows); }
@@ -566,111 +773,203 @@ class TableWriter::TableWriterImpl : public ArrayVisitor {
     return stream_->Write(kFeatherMagicBytes, strlen(kFeatherMagicBytes));
   }
 
-  Status LoadArrayMetadata(const Array& values, ArrayMetadata* meta) {
-    if (!(is_primitive(values.type_id()) || is_binary_like(values.type_id()))) {
+  Status LoadArrayMetadata(const ArrayVector& chunks, ArrayMetadata* meta) {
+    const DataType& type = *chunks[0]->type();
+    if (!(is_primitive(type.id()) || is_binary_like(type.id()))) {
       std::stringstream ss;
-      ss << "Array is not primitive type: " << values.type()->ToString();
+      ss << "Array is not primitive type: " << type.ToString();
       return Status::Invalid(ss.str());
     }
 
-    meta->type = ToFlatbufferType(values.type_id());
+    meta->type = ToFlatbufferType(type.id());
 
     RETURN_NOT_OK(stream_->Tell(&meta->offset));
 
-    meta->length = values.length();
-    meta->null_count = values.null_count();
+    meta->length = 0;
+    meta->null_count = 0;
+    for (const auto& chunk : chunks) {
+      meta->length += chunk->length();
+      meta->null_count += chunk->null_count();
+    }
     meta->total_bytes = 0;
+    meta->compression = fbs::CompressionType_UNCOMPRESSED;
+    meta->uncompressed_bytes = 0;
+    meta->block_compressed = false;
 
     return Status::OK();
   }
 
-  Status WriteArray(const Array& values, ArrayMetadata* meta) {
-    RETURN_NOT_OK(CheckStarted());
-    RETURN_NOT_OK(LoadArrayMetadata(values, meta));
-
-    int64_t bytes_written;
-
-    // Write the null bitmask
-    if (values.null_count() > 0) {
-      // We assume there is one bit for each value in values.nulls,
-      // starting at the zero offset.
-      int64_t null_bitmap_size = GetOutputLength(BitUtil::BytesForBits(values.length()));
-      if (values.null_bitmap()) {
-        auto null_bitmap = values.null_bitmap();
-        RETURN_NOT_OK(WritePaddedWithOffset(stream_.get(), null_bitmap->data(),
-                                            values.offset(), null_bitmap_size,
-                                            &bytes_written));
-      } else {
-        RETURN_NOT_OK(WritePaddedBlank(stream_.get(), null_bitmap_size, &bytes_written));
+  // Write the bits of the chunks one after the other, from the null bitmaps
+  // or the values of boolean arrays
+  Status WriteBitmap(const ArrayVector& chunks, bool values, int64_t length,
+                     io::OutputStream* dst, int64_t* bytes_written) {
+    const int64_t nbytes = BitUtil::BytesForBits(length);
+    std::shared_ptr<Buffer> bitmap;
+    RETURN_NOT_OK(AllocateBuffer(default_memory_pool(), nbytes, &bitmap));
+    uint8_t* bits = bitmap->mutable_data();
+    memset(bits, 0, static_cast<size_t>(nbytes));
+
+    int64_t position = 0;
+    for (const auto& chunk : chunks) {
+      const uint8_t* source = chunk->null_bitmap_data();
+      if (values) {
+        const auto& data = checked_cast<const PrimitiveArray&>(*chunk).values();
+        source = data ? data->data() : nullptr;
       }
-      meta->total_bytes += bytes_written;
+      if (source != nullptr) {
+        CopyBitmap(source, chunk->offset(), chunk->length(), bits, position);
+      } else if (!values && chunk->null_count() == 0) {
+        BitUtil::SetBitsTo(bits, position, chunk->length(), true);
+      }
+      position += chunk->length();
     }
+    return WritePadded(dst, bits, nbytes, bytes_written);
+  }
 
-    int64_t values_bytes = 0;
-    int64_t bit_offset = 0;
-
-    const uint8_t* values_buffer = nullptr;
-
-    if (is_binary_like(values.type_id())) {
-      const auto& bin_values = checked_cast<const BinaryArray&>(values);
-
-      int64_t offset_bytes = sizeof(int32_t) * (values.length() + 1);
+  // Write the offsets of the binary chunks, from a first one of 0, and then
+  // their data
+  Status WriteBinaryValues(const ArrayVector& chunks, int64_t length,
+                           io::OutputStream* dst, int64_t* bytes_written) {
+    std::vector<int32_t> offsets;
+    offsets.reserve(static_cast<size_t>(length + 1));
+    offsets.push_back(0);
+    int64_t data_size = 0;
+    for (const auto& chunk : chunks) {
+      const auto& values = checked_cast<const BinaryArray&>(*chunk);
+      const int32_t* chunk_offsets =
+          values.value_offsets() ? values.raw_value_offsets() : nullptr;
+      for (int64_t i = 1; i <= values.length(); ++i) {
+        const int64_t end =
+            data_size + (chunk_offsets ? chunk_offsets[i] - chunk_offsets[0] : 0);
+        if (end > std::numeric_limits<int32_t>::max()) {
+          return Status::CapacityError("Feather binary column data over 2GB");
+        }
+        offsets.push_back(static_cast<int32_t>(end));
+      }
+      data_size = offsets.back();
+    }
 
-      if (bin_values.value_offsets()) {
-        values_bytes = bin_values.raw_value_offsets()[values.length()];
+    int64_t offsets_written;
+    RETURN_NOT_OK(WritePadded(dst, reinterpret_cast<const uint8_t*>(offsets.data()),
+                              static_cast<int64_t>(offsets.size() * sizeof(int32_t)),
+                              &offsets_written));
+    for (const auto& chunk : chunks) {
+      const auto& values = checked_cast<const BinaryArray&>(*chunk);
+      if (values.value_offsets() && values.value_data() && values.length() > 0) {
+        const int32_t start = values.value_offset(0);
+        RETURN_NOT_OK(dst->Write(values.value_data()->data() + start,
+                                 values.value_offset(values.length()) - start));
+      }
+    }
+    RETURN_NOT_OK(WritePadding(dst, data_size));
+    *bytes_written = offsets_written + PaddedLength(data_size);
+    return Status::OK();
+  }
 
-        // Write the variable-length offsets
+  Status WriteFixedWidthValues(const ArrayVector& chunks, int64_t length,
+                               io::OutputStream* dst, int64_t* bytes_written) {
+    const auto& fw_type = checked_cast<const FixedWidthType&>(*chunks[0]->type());
+    const int64_t byte_width = fw_type.bit_width() / 8;
+    for (const auto& chunk : chunks) {
+      const auto& values = checked_cast<const PrimitiveArray&>(*chunk);
+      const int64_t nbytes = values.length() * byte_width;
+      if (values.values()) {
         RETURN_NOT_OK(
-            WritePadded(stream_.get(),
-                        reinterpret_cast<const uint8_t*>(bin_values.raw_value_offsets()),
-                        offset_bytes, &bytes_written));
+            dst->Write(values.values()->data() + values.offset() * byte_width, nbytes));
       } else {
-        RETURN_NOT_OK(WritePaddedBlank(stream_.get(), offset_bytes, &bytes_written));
-      }
-      meta->total_bytes += bytes_written;
-
-      if (bin_values.value_data()) {
-        values_buffer = bin_values.value_data()->data();
+        RETURN_NOT_OK(WriteZeros(dst, nbytes));
       }
-    } else {
-      const auto& prim_values = checked_cast<const PrimitiveArray&>(values);
-      const auto& fw_type = checked_cast<const FixedWidthType&>(*values.type());
+    }
+    RETURN_NOT_OK(WritePadding(dst, length * byte_width));
+    *bytes_written = PaddedLength(length * byte_width);
+    return Status::OK();
+  }
 
-      values_bytes = BitUtil::BytesForBits(values.length() * fw_type.bit_width());
+  // Write the null bitmap, offsets and values of the chunks as those of a
+  // single array
+  Status WriteArrayData(const ArrayVector& chunks, const ArrayMetadata& meta,
+                        io::OutputStream* dst, int64_t* total_bytes) {
+    int64_t bytes_written;
+    *total_bytes = 0;
 
-      if (prim_values.values()) {
-        values_buffer = prim_values.values()->data() +
-                        (prim_values.offset() * fw_type.bit_width() / 8);
-        bit_offset = (prim_values.offset() * fw_type.bit_width()) % 8;
-      }
+    if (meta.null_count > 0) {
+      RETURN_NOT_OK(WriteBitmap(chunks, false, meta.length, dst, &bytes_written));
+      *total_bytes += bytes_written;
     }
-    if (values_buffer) {
-      RETURN_NOT_OK(WritePaddedWithOffset(stream_.get(), values_buffer, bit_offset,
-                                          values_bytes, &bytes_written));
+
+    const Type::type type_id = chunks[0]->type_id();
+    if (is_binary_like(type_id)) {
+      RETURN_NOT_OK(WriteBinaryValues(chunks, meta.length, dst, &bytes_written));
+    } else if (type_id == Type::BOOL) {
+      RETURN_NOT_OK(WriteBitmap(chunks, true, meta.length, dst, &bytes_written));
     } else {
-      RETURN_NOT_OK(WritePaddedBlank(stream_.get(), values_bytes, &bytes_written));
+      RETURN_NOT_OK(WriteFixedWidthValues(chunks, meta.length, dst, &bytes_written));
     }
-    meta->total_bytes += bytes_written;
+    *total_bytes += bytes_written;
+    return Status::OK();
+  }
 
+  Status WriteArray(const ArrayVector& chunks, ArrayMetadata* meta) {
+    RETURN_NOT_OK(CheckStarted());
+    RETURN_NOT_OK(LoadArrayMetadata(chunks, meta));
+
+    if (compression_ == Compression::UNCOMPRESSED) {
+      return WriteArrayData(chunks, *meta, stream_.get(), &meta->total_bytes);
+    }
+
+    // The array is laid out in memory to be compressed in blocks, and written
+    // as is if that does not make it smaller
+    std::shared_ptr<io::BufferOutputStream> raw_stream;
+    RETURN_NOT_OK(io::BufferOutputStream::Create(kFeatherDefaultAlignment,
+                                                 default_memory_pool(), &raw_stream));
+    int64_t raw_size;
+    RETURN_NOT_OK(WriteArrayData(chunks, *meta, raw_stream.get(), &raw_size));
+    std::shared_ptr<Buffer> raw;
+    RETURN_NOT_OK(raw_stream->Finish(&raw));
+
+    std::vector<std::shared_ptr<Buffer>> compressed;
+    RETURN_NOT_OK(CompressBlocks(compression_, kDefaultCompressionBlockSize, {raw},
+                                 true /* use_threads */, default_memory_pool(),
+                                 &compressed));
+    const int64_t compressed_size = compressed[0]->size();
+
+    int64_t bytes_written;
+    if (compressed_size >= raw_size) {
+      RETURN_NOT_OK(stream_->Write(raw->data(), raw->size()));
+      meta->total_bytes = raw->size();
+      return Status::OK();
+    }
+    RETURN_NOT_OK(WritePadded(stream_.get(), compressed[0]->data(), compressed_size,
+                              &bytes_written));
+    // The reader is given the exact size to decompress, the padding following
+    RETURN_NOT_OK(ToFlatbuffer(compression_, &meta->compression));
+    meta->total_bytes = compressed_size;
+    meta->uncompressed_bytes = raw_size;
+    meta->block_compressed = true;
     return Status::OK();
   }
 
-  Status WritePrimitiveValues(const Array& values) {
+  Status WritePrimitiveValues(const ArrayVector& chunks) {
     // Prepare metadata payload
     ArrayMetadata meta;
-    RETURN_NOT_OK(WriteArray(values, &meta));
+    RETURN_NOT_OK(WriteArray(chunks, &meta));
     current_column_->SetValues(meta);
     return Status::OK();
   }
 
+  // The visitors are called with the first chunk of the column, to write all
+  // of chunks_
+
   Status Visit(const NullArray& values) override {
-    std::shared_ptr<Array> sanitized_nulls;
-    RETURN_NOT_OK(SanitizeUnsupportedTypes(values, &sanitized_nulls));
-    return WritePrimitiveValues(*sanitized_nulls);
+    ArrayVector sanitized_nulls(chunks_.size());
+    for (size_t i = 0; i < chunks_.size(); ++i) {
+      RETURN_NOT_OK(SanitizeUnsupportedTypes(*chunks_[i], &sanitized_nulls[i]));
+    }
+    return WritePrimitiveValues(sanitized_nulls);
   }
 
 #define VISIT_PRIMITIVE(TYPE) \
-  Status Visit(const TYPE& values) override { return WritePrimitiveValues(values); }
+  Status Visit(const TYPE& values) override { return WritePrimitiveValues(chunks_); }
 
   VISIT_PRIMITIVE(BooleanArray)
   VISIT_PRIMITIVE(Int8Array)
@@ -695,32 +994,37 @@ class TableWriter::TableWriterImpl : public ArrayVisitor {
       return Status::Invalid("Category values must be integers");
     }
 
-    RETURN_NOT_OK(WritePrimitiveValues(*values.indices()));
+    // The chunks of a column have the same type, so the same dictionary
+    ArrayVector indices;
+    for (const auto& chunk : chunks_) {
+      indices.push_back(checked_cast<const DictionaryArray&>(*chunk).indices());
+    }
+    RETURN_NOT_OK(WritePrimitiveValues(indices));
 
     ArrayMetadata levels_meta;
     std::shared_ptr<Array> sanitized_dictionary;
     RETURN_NOT_OK(
         SanitizeUnsupportedTypes(*dict_type.dictionary(), &sanitized_dictionary));
-    RETURN_NOT_OK(WriteArray(*sanitized_dictionary, &levels_meta));
+    RETURN_NOT_OK(WriteArray({sanitized_dictionary}, &levels_meta));
     current_column_->SetCategory(levels_meta, dict_type.ordered());
     return Status::OK();
   }
 
   Status Visit(const TimestampArray& values) override {
-    RETURN_NOT_OK(WritePrimitiveValues(values));
+    RETURN_NOT_OK(WritePrimitiveValues(chunks_));
     const auto& ts_type = checked_cast<const TimestampType&>(*values.type());
     current_column_->SetTimestamp(ts_type.unit(), ts_type.timezone());
     return Status::OK();
   }
 
   Status Visit(const Date32Array& values) override {
-    RETURN_NOT_OK(WritePrimitiveValues(values));
+    RETURN_NOT_OK(WritePrimitiveValues(chunks_));
     current_column_->SetDate();
     return Status::OK();
   }
 
   Status Visit(const Time32Array& values) override {
-    RETURN_NOT_OK(WritePrimitiveValues(values));
+    RETURN_NOT_OK(WritePrimitiveValues(chunks_));
     auto unit = checked_cast<const Time32Type&>(*values.type()).unit();
     current_column_->SetTime(unit);
     return Status::OK();
@@ -730,9 +1034,28 @@ class TableWriter::TableWriterImpl : public ArrayVisitor {
     return Status::NotImplemented("time64");
   }
 
-  Status Append(const std::string& name, const Array& values) {
+  Status Append(const std::string& name, const ChunkedArray& values,
+                Compression::type compression) {
+    if (num_rows_ >= 0 && values.length() != num_rows_) {
+      std::stringstream ss;
+      ss << "Column '" << name << "' has " << values.length()
+         << " values, the columns of the file " << num_rows_;
+      return Status::Invalid(ss.str());
+    }
+    chunks_ = values.chunks();
+    if (chunks_.empty()) {
+      // An empty array of the type, to visit
+      std::unique_ptr<ArrayBuilder> builder;
+      std::shared_ptr<Array> empty;
+      RETURN_NOT_OK(MakeBuilder(default_memory_pool(), values.type(), &builder));
+      RETURN_NOT_OK(builder->Finish(&empty));
+      chunks_.push_back(empty);
+    }
+    compression_ = compression;
     current_column_ = metadata_.AddColumn(name);
-    RETURN_NOT_OK(values.Accept(this));
+    Status status = chunks_[0]->Accept(this);
+    chunks_.clear();
+    RETURN_NOT_OK(status);
     return current_column_->Finish();
   }
 
@@ -748,12 +1071,57 @@ class TableWriter::TableWriterImpl : public ArrayVisitor {
     return Status::OK();
   }
 
+  // Add the metadata of a column of the file appended to, whose data stays
+  // where it is
+  Status AddExistingColumn(const fbs::Column& column) {
+    std::unique_ptr<ColumnBuilder> builder = metadata_.AddColumn(column.name()->str());
+    ArrayMetadata values;
+    FromFlatbuffer(column.values(), &values);
+    builder->SetValues(values);
+    if (column.user_metadata() != nullptr) {
+      builder->SetUserMetadata(column.user_metadata()->str());
+    }
+
+    switch (column.metadata_type()) {
+      case fbs::TypeMetadata_CategoryMetadata: {
+        auto meta = static_cast<const fbs::CategoryMetadata*>(column.metadata());
+        ArrayMetadata levels;
+        FromFlatbuffer(meta->levels(), &levels);
+        builder->SetCategory(levels, meta->ordered());
+      } break;
+      case fbs::TypeMetadata_TimestampMetadata: {
+        auto meta = static_cast<const fbs::TimestampMetadata*>(column.metadata());
+        TimeUnit::type unit = FromFlatbufferEnum(meta->unit());
+        if (meta->timezone() != nullptr) {
+          builder->SetTimestamp(unit, meta->timezone()->str());
+        } else {
+          builder->SetTimestamp(unit);
+        }
+      } break;
+      case fbs::TypeMetadata_DateMetadata:
+        builder->SetDate();
+        break;
+      case fbs::TypeMetadata_TimeMetadata: {
+        auto meta = static_cast<const fbs::TimeMetadata*>(column.metadata());
+        builder->SetTime(FromFlatbufferEnum(meta->unit()));
+      } break;
+      default:
+        break;
+    }
+    return builder->Finish();
+  }
+
   std::shared_ptr<io::OutputStream> stream_;
 
   bool initialized_stream_;
   TableBuilder metadata_;
+  // The number of values of the columns of the file appended to, -1 if none
+  int64_t num_rows_;
 
   std::unique_ptr<ColumnBuilder> current_column_;
+  // The chunks and the compression of the column being appended
+  ArrayVector chunks_;
+  Compression::type compression_;
 
   Status AppendPrimitive(const PrimitiveArray& values, ArrayMetadata* out);
 };
@@ -768,12 +1136,25 @@ Status TableWriter::Open(const std::shared_ptr<io::OutputStream>& stream,
   return (*out)->impl_->Open(stream);
 }
 
+Status TableWriter::OpenAppend(const std::shared_ptr<io::RandomAccessFile>& source,
+                               const std::shared_ptr<io::OutputStream>& stream,
+                               std::unique_ptr<TableWriter>* out) {
+  out->reset(new TableWriter());
+  return (*out)->impl_->OpenAppend(source, stream);
+}
+
 void TableWriter::SetDescription(const std::string& desc) { impl_->SetDescription(desc); }
 
 void TableWriter::SetNumRows(int64_t num_rows) { impl_->SetNumRows(num_rows); }
 
 Status TableWriter::Append(const std::string& name, const Array& values) {
-  return impl_->Append(name, values);
+  return impl_->Append(name, ChunkedArray({MakeArray(values.data())}),
+                       Compression::UNCOMPRESSED);
+}
+
+Status TableWriter::Append(const std::string& name, const ChunkedArray& values,
+                           Compression::type compression) {
+  return impl_->Append(name, values, compression);
 }
 
 Status TableWriter::Finalize() { return impl_->Finalize(); }
@@ -24,14 +24,18 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
+#include "arrow/util/compression.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
 
 class Array;
+class ChunkedArray;
 class Column;
 class Status;
+class Table;
 
 namespace io {
 
@@ -89,8 +93,32 @@ class ARROW_EXPORT TableReader {
   /// \return Status
   ///
   /// This function is zero-copy if the file source supports zero-copy reads
+  /// and the column is not compressed
   Status GetColumn(int i, std::shared_ptr<Column>* out);
 
+  /// \brief Read all the columns of the file into a table
+  ///
+  /// \param[out] out the read table
+  /// \param[in] use_threads read and decompress the columns in parallel on
+  /// the CPU thread pool, or the blocks of the column if there is only one.
+  /// The file must then allow ReadAt to be called from several threads at
+  /// once, as the files of arrow::io do
+  /// \return Status
+  Status Read(std::shared_ptr<Table>* out, bool use_threads = false);
+
+  /// \brief Read some of the columns of the file into a table
+  ///
+  /// \param[in] indices the indices of the columns to read, in the order of
+  /// the columns of the table
+  /// \param[out] out the read table
+  /// \param[in] use_threads read and decompress the columns in parallel, as
+  /// with Read of all the columns
+  /// \return Status
+  ///
+  /// The columns are zero-copy, as with GetColumn, on a memory-mapped file
+  Status Read(const std::vector<int>& indices, std::shared_ptr<Table>* out,
+              bool use_threads = false);
+
  private:
   class ARROW_NO_EXPORT TableReaderImpl;
   std::unique_ptr<TableReaderImpl> impl_;
@@ -109,6 +137,22 @@ class ARROW_EXPORT TableWriter {
   static Status Open(const std::shared_ptr<io::OutputStream>& stream,
                      std::unique_ptr<TableWriter>* out);
 
+  /// \brief Create a new TableWriter adding columns to an existing file
+  ///
+  /// The columns are written after the end of the file, followed by metadata
+  /// holding those of the file and the added ones, which supersedes the
+  /// metadata the file ended with. The data in the file is not rewritten.
+  ///
+  /// \param[in] source the file to append to
+  /// \param[in] stream an output stream writing at the end of the file, as a
+  /// FileOutputStream opened to append
+  /// \param[out] out the returned table writer, whose appended columns must
+  /// have as many values as those of the file
+  /// \return Status
+  static Status OpenAppend(const std::shared_ptr<io::RandomAccessFile>& source,
+                           const std::shared_ptr<io::OutputStream>& stream,
+                           std::unique_ptr<TableWriter>* out);
+
   /// \brief Set the description field in the file metadata
   void SetDescription(const std::string& desc);
 
@@ -122,6 +166,21 @@ class ARROW_EXPORT TableWriter {
   /// \return Status
   Status Append(const std::string& name, const Array& values);
 
+  /// \brief Append a column to the file, optionally compressed
+  ///
+  /// The chunks are written one after the other as a single array, without
+  /// being concatenated in memory first.
+  ///
+  /// \param[in] name the column name
+  /// \param[in] values the column values
+  /// \param[in] compression the codec to compress the column with, which is
+  /// stored uncompressed if that does not make it smaller. Compressed columns
+  /// are laid out in memory, then compressed in blocks on the CPU thread pool,
+  /// and not readable by readers predating block compression
+  /// \return Status
+  Status Append(const std::string& name, const ChunkedArray& values,
+                Compression::type compression = Compression::UNCOMPRESSED);
+
   /// \brief Finalize the file by writing the file metadata and footer
   /// \return Status
   Status Finalize();
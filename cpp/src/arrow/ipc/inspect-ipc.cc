@@ -0,0 +1,298 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/io/file.h"
+#include "arrow/ipc/message.h"
+#include "arrow/ipc/reader.h"
+#include "arrow/record_batch.h"
+#include "arrow/status.h"
+#include "arrow/type.h"
+
+#include "arrow/util/io-util.h"
+
+namespace arrow {
+namespace ipc {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+int64_t ElapsedMicros(Clock::time_point start) {
+  return std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start)
+      .count();
+}
+
+// What was read of a message
+struct MessageInfo {
+  Message::Type type;
+  // Including the length prefix
+  int64_t metadata_size;
+  int64_t body_size;
+  int64_t read_micros;
+};
+
+// Reads the messages of another reader, recording their sizes and the time
+// taken to read them
+class RecordingMessageReader : public MessageReader {
+ public:
+  // With end >= 0, the messages end at that position of the stream, as they
+  // do at the footer of a file
+  RecordingMessageReader(io::InputStream* stream, int64_t end,
+                         std::vector<MessageInfo>* messages)
+      : stream_(stream), end_(end), messages_(messages) {
+    reader_ = MessageReader::Open(stream);
+  }
+
+  Status ReadNextMessage(std::unique_ptr<Message>* message) override {
+    if (end_ >= 0) {
+      int64_t position;
+      RETURN_NOT_OK(stream_->Tell(&position));
+      if (position >= end_) {
+        *message = nullptr;
+        return Status::OK();
+      }
+    }
+    const auto start = Clock::now();
+    RETURN_NOT_OK(reader_->ReadNextMessage(message));
+    if (*message != nullptr) {
+      const auto& body = (*message)->body();
+      messages_->push_back({(*message)->type(),
+                            static_cast<int64_t>(sizeof(int32_t)) +
+                                (*message)->metadata()->size(),
+                            body == nullptr ? 0 : body->size(), ElapsedMicros(start)});
+    }
+    return Status::OK();
+  }
+
+ private:
+  io::InputStream* stream_;
+  int64_t end_;
+  std::vector<MessageInfo>* messages_;
+  std::unique_ptr<MessageReader> reader_;
+};
+
+// The bytes of the buffers of an array, which the body of the message it was
+// read from holds with the padding between them
+int64_t GetBufferBytes(const ArrayData& data) {
+  int64_t size = 0;
+  for (const auto& buffer : data.buffers) {
+    if (buffer != nullptr) {
+      size += buffer->size();
+    }
+  }
+  for (const auto& child : data.child_data) {
+    size += GetBufferBytes(*child);
+  }
+  return size;
+}
+
+void CollectDictionaries(const Field& field, std::vector<const Field*>* out) {
+  if (field.type()->id() == Type::DICTIONARY) {
+    out->push_back(&field);
+  }
+  for (const auto& child : field.type()->children()) {
+    CollectDictionaries(*child, out);
+  }
+}
+
+struct Totals {
+  int64_t metadata_size = 0;
+  int64_t body_size = 0;
+  int64_t padding = 0;
+  int64_t dictionary_body_size = 0;
+  int64_t read_micros = 0;
+  int64_t decode_micros = 0;
+  int64_t num_rows = 0;
+};
+
+void PrintHeader() {
+  std::cout << std::setw(6) << "#" << std::setw(18) << "type" << std::setw(12)
+            << "metadata" << std::setw(12) << "body" << std::setw(10) << "padding"
+            << std::setw(10) << "rows" << std::setw(10) << "read_us" << std::setw(11)
+            << "decode_us" << std::endl;
+}
+
+// Print the messages read for a batch, or before the first, the time to
+// decode them being that taken less the time to read them
+void PrintMessages(const std::vector<MessageInfo>& messages, size_t first,
+                   const RecordBatch* batch, int64_t total_micros, Totals* totals) {
+  int64_t read_micros = 0;
+  for (size_t i = first; i < messages.size(); ++i) {
+    read_micros += messages[i].read_micros;
+  }
+  const int64_t decode_micros = std::max<int64_t>(total_micros - read_micros, 0);
+  totals->read_micros += read_micros;
+  totals->decode_micros += decode_micros;
+
+  for (size_t i = first; i < messages.size(); ++i) {
+    const MessageInfo& info = messages[i];
+    const bool is_batch = info.type == Message::RECORD_BATCH && batch != nullptr;
+    std::string padding = "-";
+    if (is_batch) {
+      int64_t buffer_bytes = 0;
+      for (int c = 0; c < batch->num_columns(); ++c) {
+        buffer_bytes += GetBufferBytes(*batch->column_data(c));
+      }
+      // Compressed bodies are smaller than their buffers, and not padded
+      if (buffer_bytes <= info.body_size) {
+        padding = std::to_string(info.body_size - buffer_bytes);
+        totals->padding += info.body_size - buffer_bytes;
+      }
+      totals->num_rows += batch->num_rows();
+    }
+    if (info.type == Message::DICTIONARY_BATCH) {
+      totals->dictionary_body_size += info.body_size;
+    }
+    totals->metadata_size += info.metadata_size;
+    totals->body_size += info.body_size;
+
+    const bool last = i + 1 == messages.size();
+    std::cout << std::setw(6) << i << std::setw(18) << FormatMessageType(info.type)
+              << std::setw(12) << info.metadata_size << std::setw(12) << info.body_size
+              << std::setw(10) << padding << std::setw(10)
+              << (is_batch ? std::to_string(batch->num_rows()) : "-") << std::setw(10)
+              << info.read_micros << std::setw(11)
+              << (last ? std::to_string(decode_micros) : "") << std::endl;
+  }
+}
+
+}  // namespace
+
+// Reads an IPC stream or file, printing the size of each message and the
+// time taken to read and decode it. The decoding time of the messages read
+// for a batch is printed once, with the last of them.
+Status Inspect(io::InputStream* stream, int64_t end, const std::string& format) {
+  std::vector<MessageInfo> messages;
+  std::unique_ptr<MessageReader> message_reader(
+      new RecordingMessageReader(stream, end, &messages));
+
+  std::cout << "Format: " << format << std::endl;
+  PrintHeader();
+  Totals totals;
+
+  auto start = Clock::now();
+  std::shared_ptr<RecordBatchReader> reader;
+  RETURN_NOT_OK(RecordBatchStreamReader::Open(std::move(message_reader), &reader));
+  PrintMessages(messages, 0, nullptr, ElapsedMicros(start), &totals);
+
+  int64_t num_batches = 0;
+  while (true) {
+    const size_t first = messages.size();
+    std::shared_ptr<RecordBatch> batch;
+    start = Clock::now();
+    RETURN_NOT_OK(reader->ReadNext(&batch));
+    const int64_t micros = ElapsedMicros(start);
+    if (batch == nullptr) {
+      break;
+    }
+    PrintMessages(messages, first, batch.get(), micros, &totals);
+    ++num_batches;
+  }
+
+  std::cout << std::endl
+            << "Messages: " << messages.size() << ", record batches: " << num_batches
+            << ", rows: " << totals.num_rows << std::endl
+            << "Metadata bytes: " << totals.metadata_size
+            << ", body bytes: " << totals.body_size
+            << ", body padding bytes: " << totals.padding << std::endl
+            << "Dictionary batch body bytes: " << totals.dictionary_body_size
+            << std::endl
+            << "Read: " << totals.read_micros << " us, decode: " << totals.decode_micros
+            << " us" << std::endl;
+
+  std::vector<const Field*> dictionary_fields;
+  for (const auto& field : reader->schema()->fields()) {
+    CollectDictionaries(*field, &dictionary_fields);
+  }
+  for (const Field* field : dictionary_fields) {
+    const auto& dictionary =
+        static_cast<const DictionaryType&>(*field->type()).dictionary();
+    std::cout << "Dictionary of field '" << field->name()
+              << "': " << dictionary->length() << " entries, "
+              << GetBufferBytes(*dictionary->data()) << " bytes" << std::endl;
+  }
+  return Status::OK();
+}
+
+Status InspectPath(const char* path) {
+  std::shared_ptr<io::ReadableFile> file;
+  RETURN_NOT_OK(io::ReadableFile::Open(path, &file));
+  int64_t size;
+  RETURN_NOT_OK(file->GetSize(&size));
+
+  // A file starts with the magic bytes, padded to 8 bytes, and ends with the
+  // footer, its length and the magic bytes; the messages are in between
+  const char kMagic[] = "ARROW1";
+  const int64_t kMagicSize = static_cast<int64_t>(strlen(kMagic));
+  char magic[sizeof(kMagic)] = {0};
+  int64_t bytes_read = 0;
+  if (size >= 2 * kMagicSize + 6) {
+    RETURN_NOT_OK(file->ReadAt(0, kMagicSize, &bytes_read, magic));
+  }
+  if (bytes_read != kMagicSize || std::memcmp(magic, kMagic, kMagicSize) != 0) {
+    return Inspect(file.get(), -1, "stream");
+  }
+
+  const int64_t footer_end = size - kMagicSize - static_cast<int64_t>(sizeof(int32_t));
+  int32_t footer_length;
+  RETURN_NOT_OK(
+      file->ReadAt(footer_end, sizeof(int32_t), &bytes_read, &footer_length));
+  const int64_t end = footer_end - footer_length;
+  if (footer_length <= 0 || end < 8) {
+    return Status::Invalid("File is too small to be an Arrow file");
+  }
+  RETURN_NOT_OK(file->Seek(8));
+  RETURN_NOT_OK(Inspect(file.get(), end, "file"));
+  std::cout << "Footer bytes: " << footer_length << std::endl;
+  return Status::OK();
+}
+
+}  // namespace ipc
+}  // namespace arrow
+
+int main(int argc, char** argv) {
+  if (argc > 2) {
+    std::cerr << "Usage: inspect-ipc [input arrow file or stream]" << std::endl
+              << "Reads a stream from stdin without an input" << std::endl;
+    return 1;
+  }
+  arrow::Status status;
+  if (argc == 2) {
+    status = arrow::ipc::InspectPath(argv[1]);
+  } else {
+    arrow::io::StdinStream input;
+    status = arrow::ipc::Inspect(&input, -1, "stream");
+  }
+  if (!status.ok()) {
+    std::cerr << "Could not inspect: " << status.ToString() << std::endl;
+    return 1;
+  }
+  return 0;
+}
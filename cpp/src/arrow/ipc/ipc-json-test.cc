@@ -294,6 +294,38 @@ TEST(TestJsonFileReadWrite, BasicRoundTrip) {
   }
 }
 
+TEST(TestJsonFileReadWrite, WideRoundTrip) {
+  // Enough columns for them to be written and read by several threads, in
+  // the order of the schema
+  const int num_rows = 100;
+  std::vector<std::shared_ptr<Field>> fields;
+  std::vector<std::shared_ptr<Array>> arrays;
+  for (int i = 0; i < 64; ++i) {
+    std::vector<bool> is_valid;
+    std::vector<int32_t> values;
+    test::random_is_valid(num_rows, 0.25, &is_valid);
+    test::randint(num_rows, 0, 100, &values);
+    std::shared_ptr<Array> array;
+    ArrayFromVector<Int32Type, int32_t>(is_valid, values, &array);
+    fields.push_back(field("f" + std::to_string(i), int32()));
+    arrays.push_back(array);
+  }
+  auto schema = ::arrow::schema(fields);
+  auto batch = RecordBatch::Make(schema, num_rows, arrays);
+
+  std::unique_ptr<JsonWriter> writer;
+  ASSERT_OK(JsonWriter::Open(schema, &writer));
+  ASSERT_OK(writer->WriteRecordBatch(*batch));
+  std::string result;
+  ASSERT_OK(writer->Finish(&result));
+
+  std::unique_ptr<JsonReader> reader;
+  ASSERT_OK(JsonReader::Open(std::make_shared<Buffer>(result), &reader));
+  std::shared_ptr<RecordBatch> out;
+  ASSERT_OK(reader->ReadRecordBatch(0, &out));
+  ASSERT_TRUE(out->Equals(*batch));
+}
+
 TEST(TestJsonFileReadWrite, MinimalFormatExample) {
   static const char* example = R"example(
 {
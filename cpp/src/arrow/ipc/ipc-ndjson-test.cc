@@ -0,0 +1,162 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/builder.h"
+#include "arrow/io/memory.h"
+#include "arrow/ipc/ndjson.h"
+#include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
+#include "arrow/status.h"
+#include "arrow/test-util.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace ipc {
+
+class TestNdjsonReader : public ::testing::Test {
+ public:
+  Status Open(const std::string& json, std::shared_ptr<RecordBatchReader>* reader) {
+    std::shared_ptr<Buffer> buffer;
+    RETURN_NOT_OK(Buffer::FromString(json, &buffer));
+    auto input = std::make_shared<io::BufferReader>(buffer);
+    return NdjsonReader::Open(default_memory_pool(), input, options_, reader);
+  }
+
+  Status ReadAll(const std::string& json, std::shared_ptr<Schema>* schema,
+                 std::vector<std::shared_ptr<RecordBatch>>* batches) {
+    std::shared_ptr<RecordBatchReader> reader;
+    RETURN_NOT_OK(Open(json, &reader));
+    *schema = reader->schema();
+    std::shared_ptr<RecordBatch> batch;
+    while (true) {
+      RETURN_NOT_OK(reader->ReadNext(&batch));
+      if (batch == nullptr) {
+        return Status::OK();
+      }
+      RETURN_NOT_OK(batch->Validate());
+      batches->push_back(batch);
+    }
+  }
+
+ protected:
+  NdjsonReadOptions options_;
+};
+
+TEST_F(TestNdjsonReader, InferSchema) {
+  const std::string json =
+      "{\"a\": 1, \"b\": \"x\", \"c\": [1, 2], \"d\": {\"e\": true}}\n"
+      "\n"
+      "{\"a\": 2.5, \"c\": [], \"d\": {\"e\": null, \"f\": \"y\"}, \"g\": null}\r\n"
+      "{\"b\": null, \"h\": false}";
+
+  std::shared_ptr<Schema> schema;
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  ASSERT_OK(ReadAll(json, &schema, &batches));
+
+  auto expected = ::arrow::schema(
+      {field("a", float64()), field("b", utf8()), field("c", list(int64())),
+       field("d", struct_({field("e", boolean()), field("f", utf8())})),
+       field("g", null()), field("h", boolean())});
+  ASSERT_TRUE(schema->Equals(*expected)) << schema->ToString();
+
+  ASSERT_EQ(1, batches.size());
+  const RecordBatch& batch = *batches[0];
+  ASSERT_EQ(3, batch.num_rows());
+
+  std::shared_ptr<Array> a, b, h;
+  ArrayFromVector<DoubleType, double>({true, true, false}, {1, 2.5, 0}, &a);
+  ArrayFromVector<StringType, std::string>({true, false, false}, {"x", "", ""}, &b);
+  ArrayFromVector<BooleanType, bool>({false, false, true}, {false, false, false}, &h);
+  ASSERT_ARRAYS_EQUAL(*a, *batch.column(0));
+  ASSERT_ARRAYS_EQUAL(*b, *batch.column(1));
+  ASSERT_ARRAYS_EQUAL(*h, *batch.column(5));
+  ASSERT_EQ(1, batch.column(2)->null_count());
+  ASSERT_EQ(1, batch.column(3)->null_count());
+  ASSERT_EQ(3, batch.column(4)->null_count());
+}
+
+TEST_F(TestNdjsonReader, GivenSchema) {
+  options_.schema = ::arrow::schema({field("b", int8()), field("a", utf8())});
+  const std::string json =
+      "{\"a\": \"x\", \"b\": -3, \"ignored\": [1]}\n"
+      "{\"a\": \"y\"}\n";
+
+  std::shared_ptr<Schema> schema;
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  ASSERT_OK(ReadAll(json, &schema, &batches));
+  ASSERT_TRUE(schema->Equals(*options_.schema));
+  ASSERT_EQ(1, batches.size());
+
+  std::shared_ptr<Array> b, a;
+  ArrayFromVector<Int8Type, int8_t>({true, false}, {-3, 0}, &b);
+  ArrayFromVector<StringType, std::string>({"x", "y"}, &a);
+  ASSERT_ARRAYS_EQUAL(*b, *batches[0]->column(0));
+  ASSERT_ARRAYS_EQUAL(*a, *batches[0]->column(1));
+}
+
+TEST_F(TestNdjsonReader, SmallBlocks) {
+  // Lines longer than the blocks, which are parsed several at once
+  options_.block_size = 16;
+  const int num_lines = 200;
+  std::stringstream ss;
+  for (int i = 0; i < num_lines; ++i) {
+    ss << "{\"value\": " << i << ", \"padding\": \"" << std::string(i % 40, 'x')
+       << "\"}\n";
+  }
+
+  std::shared_ptr<Schema> schema;
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  ASSERT_OK(ReadAll(ss.str(), &schema, &batches));
+  ASSERT_TRUE(schema->field(0)->type()->Equals(int64()));
+
+  int64_t expected = 0;
+  for (const auto& batch : batches) {
+    const auto& values = static_cast<const Int64Array&>(*batch->column(0));
+    for (int64_t i = 0; i < values.length(); ++i) {
+      ASSERT_EQ(expected++, values.Value(i));
+    }
+  }
+  ASSERT_EQ(num_lines, expected);
+}
+
+TEST_F(TestNdjsonReader, Errors) {
+  std::shared_ptr<Schema> schema;
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  ASSERT_RAISES(Invalid, ReadAll("{\"a\": 1}\n{\"a\": ", &schema, &batches));
+  ASSERT_RAISES(Invalid, ReadAll("[1, 2]\n", &schema, &batches));
+  // Inferred from the first line only
+  options_.inference_rows = 1;
+  ASSERT_RAISES(Invalid, ReadAll("{\"a\": 1}\n{\"a\": \"x\"}\n", &schema, &batches));
+
+  options_.schema = ::arrow::schema({field("a", uint8())});
+  ASSERT_RAISES(Invalid, ReadAll("{\"a\": 256}\n", &schema, &batches));
+  options_.schema = ::arrow::schema({field("a", decimal(10, 2))});
+  ASSERT_RAISES(NotImplemented, ReadAll("{\"a\": 1}\n", &schema, &batches));
+}
+
+}  // namespace ipc
+}  // namespace arrow
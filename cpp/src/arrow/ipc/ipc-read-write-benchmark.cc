@@ -18,114 +18,366 @@
 #include "benchmark/benchmark.h"
 
 #include <cstdint>
+#include <cstdio>
+#include <memory>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include "arrow/api.h"
+#include "arrow/io/file.h"
 #include "arrow/io/memory.h"
 #include "arrow/ipc/api.h"
+#include "arrow/ipc/test-common.h"
 #include "arrow/test-util.h"
 
 namespace arrow {
+namespace ipc {
 
-template <typename TYPE>
-std::shared_ptr<RecordBatch> MakeRecordBatch(int64_t total_size, int64_t num_fields) {
-  using T = typename TYPE::c_type;
-  size_t itemsize = sizeof(T);
-  int64_t length = total_size / num_fields / itemsize;
+// The kinds of columns of the batches benchmarked
+enum ColumnKind { kPrimitive, kString, kList, kDictionary, kStruct };
 
-  auto type = TypeTraits<TYPE>::type_singleton();
+static const char* kColumnKindNames[] = {"int64", "utf8", "list<int32>",
+                                         "dictionary<utf8>", "struct<int64, utf8>"};
 
+// Where the benchmarked files and streams are written to and read from
+enum Device { kMemory, kFile, kMemoryMap };
+
+static const char* kDeviceNames[] = {"memory", "file", "memory map"};
+
+enum Format { kStreamFormat, kFileFormat };
+
+static const char* kFormatNames[] = {"stream", "file"};
+
+static const char* kBenchmarkPath = "ipc-read-write-benchmark.arrow";
+
+static std::shared_ptr<Array> MakeInt64Column(int64_t length) {
   std::vector<bool> is_valid;
   test::random_is_valid(length, 0.1, &is_valid);
+  std::vector<int64_t> values;
+  test::randint<int64_t>(length, 0, 100, &values);
+  std::shared_ptr<Array> array;
+  ArrayFromVector<Int64Type, int64_t>(is_valid, values, &array);
+  return array;
+}
 
-  std::vector<T> values;
-  test::randint<T>(length, 0, 100, &values);
+static std::shared_ptr<Array> MakeStringColumn(int64_t length) {
+  std::shared_ptr<Array> array;
+  ABORT_NOT_OK((MakeRandomBinaryArray<StringBuilder, char>(
+      length, true, default_memory_pool(), &array)));
+  return array;
+}
 
-  typename TypeTraits<TYPE>::BuilderType builder(type, default_memory_pool());
-  for (size_t i = 0; i < values.size(); ++i) {
-    if (is_valid[i]) {
-      ABORT_NOT_OK(builder.Append(values[i]));
-    } else {
-      ABORT_NOT_OK(builder.AppendNull());
+static std::shared_ptr<Array> MakeColumn(ColumnKind kind, int64_t length) {
+  std::shared_ptr<Array> array;
+  switch (kind) {
+    case kPrimitive:
+      return MakeInt64Column(length);
+    case kString:
+      return MakeStringColumn(length);
+    case kList: {
+      // Lists of 5 values on average
+      std::shared_ptr<Array> values;
+      ABORT_NOT_OK(
+          MakeRandomInt32Array(length * 5, true, default_memory_pool(), &values));
+      ABORT_NOT_OK(MakeRandomListArray(values, static_cast<int>(length), true,
+                                       default_memory_pool(), &array));
+      return array;
+    }
+    case kDictionary: {
+      std::shared_ptr<Array> dictionary = MakeStringColumn(100);
+      std::vector<int32_t> indices;
+      test::randint<int32_t>(length, 0, 99, &indices);
+      std::shared_ptr<Array> index_array;
+      ArrayFromVector<Int32Type, int32_t>(indices, &index_array);
+      return std::make_shared<DictionaryArray>(::arrow::dictionary(int32(), dictionary),
+                                               index_array);
+    }
+    case kStruct: {
+      std::vector<std::shared_ptr<Array>> children = {MakeInt64Column(length),
+                                                      MakeStringColumn(length)};
+      auto type = struct_({field("a", int64()), field("b", utf8())});
+      return std::make_shared<StructArray>(type, length, children);
     }
   }
-  std::shared_ptr<Array> array;
-  ABORT_NOT_OK(builder.Finish(&array));
+  return array;
+}
 
-  ArrayVector arrays;
+static std::shared_ptr<RecordBatch> MakeBatch(ColumnKind kind, int num_columns,
+                                              int64_t length) {
   std::vector<std::shared_ptr<Field>> fields;
-  for (int64_t i = 0; i < num_fields; ++i) {
+  std::vector<std::shared_ptr<Array>> columns;
+  for (int i = 0; i < num_columns; ++i) {
     std::stringstream ss;
     ss << "f" << i;
-    fields.push_back(field(ss.str(), type));
-    arrays.push_back(array);
+    columns.push_back(MakeColumn(kind, length));
+    fields.push_back(field(ss.str(), columns.back()->type()));
   }
+  return RecordBatch::Make(::arrow::schema(fields), length, columns);
+}
+
+static int64_t BatchSize(const RecordBatch& batch) {
+  int64_t size;
+  ABORT_NOT_OK(GetRecordBatchSize(batch, &size));
+  return size;
+}
+
+// ----------------------------------------------------------------------
+// Single record batch messages, as the arguments (column kind, number of
+// columns, number of rows)
+
+static std::shared_ptr<RecordBatch> MakeBatch(const benchmark::State& state) {
+  return MakeBatch(static_cast<ColumnKind>(state.range(0)),
+                   static_cast<int>(state.range(1)), state.range(2));
+}
 
-  auto schema = std::make_shared<Schema>(fields);
-  return RecordBatch::Make(schema, length, arrays);
+static void SetMessageCounters(const RecordBatch& batch,
+                               benchmark::State& state) {  // NOLINT non-const reference
+  state.SetBytesProcessed(state.iterations() * BatchSize(batch));
+  state.SetItemsProcessed(state.iterations() * batch.num_rows());
+  state.SetLabel(kColumnKindNames[state.range(0)]);
 }
 
 static void BM_WriteRecordBatch(benchmark::State& state) {  // NOLINT non-const reference
-  // 1MB
-  constexpr int64_t kTotalSize = 1 << 20;
+  auto batch = MakeBatch(state);
 
   std::shared_ptr<ResizableBuffer> buffer;
-  ABORT_NOT_OK(AllocateResizableBuffer(kTotalSize & 2, &buffer));
-  auto record_batch = MakeRecordBatch<Int64Type>(kTotalSize, state.range(0));
+  ABORT_NOT_OK(AllocateResizableBuffer(BatchSize(*batch), &buffer));
 
   while (state.KeepRunning()) {
     io::BufferOutputStream stream(buffer);
     int32_t metadata_length;
     int64_t body_length;
-    if (!ipc::WriteRecordBatch(*record_batch, 0, &stream, &metadata_length, &body_length,
-                               default_memory_pool())
+    if (!WriteRecordBatch(*batch, 0, &stream, &metadata_length, &body_length,
+                          default_memory_pool())
              .ok()) {
       state.SkipWithError("Failed to write!");
     }
   }
-  state.SetBytesProcessed(int64_t(state.iterations()) * kTotalSize);
+  SetMessageCounters(*batch, state);
 }
 
 static void BM_ReadRecordBatch(benchmark::State& state) {  // NOLINT non-const reference
-  // 1MB
-  constexpr int64_t kTotalSize = 1 << 20;
+  auto batch = MakeBatch(state);
 
   std::shared_ptr<ResizableBuffer> buffer;
-  ABORT_NOT_OK(AllocateResizableBuffer(kTotalSize & 2, &buffer));
-  auto record_batch = MakeRecordBatch<Int64Type>(kTotalSize, state.range(0));
-
+  ABORT_NOT_OK(AllocateResizableBuffer(BatchSize(*batch), &buffer));
   io::BufferOutputStream stream(buffer);
-
   int32_t metadata_length;
   int64_t body_length;
-  if (!ipc::WriteRecordBatch(*record_batch, 0, &stream, &metadata_length, &body_length,
-                             default_memory_pool())
-           .ok()) {
-    state.SkipWithError("Failed to write!");
-  }
+  ABORT_NOT_OK(WriteRecordBatch(*batch, 0, &stream, &metadata_length, &body_length,
+                                default_memory_pool()));
 
   while (state.KeepRunning()) {
     std::shared_ptr<RecordBatch> result;
     io::BufferReader reader(buffer);
+    if (!ReadRecordBatch(batch->schema(), &reader, &result).ok()) {
+      state.SkipWithError("Failed to read!");
+    }
+  }
+  SetMessageCounters(*batch, state);
+}
+
+static void BM_GetRecordBatchSize(
+    benchmark::State& state) {  // NOLINT non-const reference
+  auto batch = MakeBatch(state);
+
+  while (state.KeepRunning()) {
+    int64_t size;
+    if (!GetRecordBatchSize(*batch, &size).ok()) {
+      state.SkipWithError("Failed to get the size!");
+    }
+    benchmark::DoNotOptimize(size);
+  }
+  state.SetItemsProcessed(state.iterations() * batch->num_rows());
+  state.SetLabel(kColumnKindNames[state.range(0)]);
+}
+
+// Batches of about as many values, in few long columns or many short ones
+static void MessageArguments(benchmark::internal::Benchmark* bench) {
+  for (int kind = kPrimitive; kind <= kStruct; ++kind) {
+    for (int num_columns : {1, 16, 256}) {
+      bench->Args({kind, num_columns, 64});
+      bench->Args({kind, num_columns, (1 << 16) / num_columns});
+    }
+  }
+}
+
+BENCHMARK(BM_WriteRecordBatch)->Apply(MessageArguments)->MinTime(1.0)->UseRealTime();
+
+BENCHMARK(BM_ReadRecordBatch)->Apply(MessageArguments)->MinTime(1.0)->UseRealTime();
+
+BENCHMARK(BM_GetRecordBatchSize)->Apply(MessageArguments)->MinTime(1.0)->UseRealTime();
 
-    if (!ipc::ReadRecordBatch(record_batch->schema(), &reader, &result).ok()) {
+// ----------------------------------------------------------------------
+// Whole streams and files, as the arguments (format, device, column kind)
+
+constexpr int kNumBatches = 16;
+constexpr int kNumColumns = 8;
+constexpr int64_t kBatchLength = 4096;
+
+static Status WriteBatches(Format format, io::OutputStream* sink,
+                           const std::shared_ptr<RecordBatch>& batch) {
+  std::shared_ptr<RecordBatchWriter> writer;
+  if (format == kStreamFormat) {
+    RETURN_NOT_OK(RecordBatchStreamWriter::Open(sink, batch->schema(), &writer));
+  } else {
+    RETURN_NOT_OK(RecordBatchFileWriter::Open(sink, batch->schema(), &writer));
+  }
+  for (int i = 0; i < kNumBatches; ++i) {
+    RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
+  }
+  return writer->Close();
+}
+
+// The size of the stream or file of the batches
+static int64_t WrittenSize(Format format, const std::shared_ptr<RecordBatch>& batch) {
+  std::shared_ptr<io::BufferOutputStream> stream;
+  ABORT_NOT_OK(io::BufferOutputStream::Create(0, default_memory_pool(), &stream));
+  ABORT_NOT_OK(WriteBatches(format, stream.get(), batch));
+  int64_t size;
+  ABORT_NOT_OK(stream->Tell(&size));
+  return size;
+}
+
+static Status OpenSink(Device device, int64_t size,
+                       std::shared_ptr<io::OutputStream>* out) {
+  switch (device) {
+    case kMemory: {
+      std::shared_ptr<io::BufferOutputStream> stream;
+      RETURN_NOT_OK(io::BufferOutputStream::Create(size, default_memory_pool(), &stream));
+      *out = stream;
+      return Status::OK();
+    }
+    case kFile:
+      return io::FileOutputStream::Open(kBenchmarkPath, out);
+    case kMemoryMap: {
+      std::shared_ptr<io::MemoryMappedFile> file;
+      RETURN_NOT_OK(io::MemoryMappedFile::Create(kBenchmarkPath, size, &file));
+      *out = file;
+      return Status::OK();
+    }
+  }
+  return Status::Invalid("Unknown device");
+}
+
+static Status OpenSource(Device device, const std::shared_ptr<Buffer>& buffer,
+                         std::shared_ptr<io::RandomAccessFile>* out) {
+  switch (device) {
+    case kMemory:
+      *out = std::make_shared<io::BufferReader>(buffer);
+      return Status::OK();
+    case kFile: {
+      std::shared_ptr<io::ReadableFile> file;
+      RETURN_NOT_OK(io::ReadableFile::Open(kBenchmarkPath, &file));
+      *out = file;
+      return Status::OK();
+    }
+    case kMemoryMap: {
+      std::shared_ptr<io::MemoryMappedFile> file;
+      RETURN_NOT_OK(
+          io::MemoryMappedFile::Open(kBenchmarkPath, io::FileMode::READ, &file));
+      *out = file;
+      return Status::OK();
+    }
+  }
+  return Status::Invalid("Unknown device");
+}
+
+static Status ReadBatches(Format format, io::RandomAccessFile* source,
+                          int64_t* num_rows) {
+  *num_rows = 0;
+  std::shared_ptr<RecordBatch> batch;
+  if (format == kStreamFormat) {
+    std::shared_ptr<RecordBatchReader> reader;
+    RETURN_NOT_OK(RecordBatchStreamReader::Open(source, &reader));
+    while (true) {
+      RETURN_NOT_OK(reader->ReadNext(&batch));
+      if (batch == nullptr) {
+        return Status::OK();
+      }
+      *num_rows += batch->num_rows();
+    }
+  }
+  std::shared_ptr<RecordBatchFileReader> reader;
+  RETURN_NOT_OK(RecordBatchFileReader::Open(source, &reader));
+  for (int i = 0; i < reader->num_record_batches(); ++i) {
+    RETURN_NOT_OK(reader->ReadRecordBatch(i, &batch));
+    *num_rows += batch->num_rows();
+  }
+  return Status::OK();
+}
+
+static void SetFormatCounters(int64_t size,
+                              benchmark::State& state) {  // NOLINT non-const reference
+  state.SetBytesProcessed(state.iterations() * size);
+  state.SetItemsProcessed(state.iterations() * kNumBatches * kBatchLength);
+  std::stringstream ss;
+  ss << kFormatNames[state.range(0)] << " " << kDeviceNames[state.range(1)] << " "
+     << kColumnKindNames[state.range(2)];
+  state.SetLabel(ss.str());
+}
+
+static void BM_WriteFormat(benchmark::State& state) {  // NOLINT non-const reference
+  const auto format = static_cast<Format>(state.range(0));
+  const auto device = static_cast<Device>(state.range(1));
+  auto batch = MakeBatch(static_cast<ColumnKind>(state.range(2)), kNumColumns,
+                         kBatchLength);
+  const int64_t size = WrittenSize(format, batch);
+
+  while (state.KeepRunning()) {
+    std::shared_ptr<io::OutputStream> sink;
+    if (!OpenSink(device, size, &sink).ok() ||
+        !WriteBatches(format, sink.get(), batch).ok() || !sink->Close().ok()) {
+      state.SkipWithError("Failed to write!");
+    }
+  }
+  std::remove(kBenchmarkPath);
+  SetFormatCounters(size, state);
+}
+
+static void BM_ReadFormat(benchmark::State& state) {  // NOLINT non-const reference
+  const auto format = static_cast<Format>(state.range(0));
+  const auto device = static_cast<Device>(state.range(1));
+  auto batch = MakeBatch(static_cast<ColumnKind>(state.range(2)), kNumColumns,
+                         kBatchLength);
+  const int64_t size = WrittenSize(format, batch);
+
+  std::shared_ptr<io::OutputStream> sink;
+  ABORT_NOT_OK(OpenSink(device, size, &sink));
+  ABORT_NOT_OK(WriteBatches(format, sink.get(), batch));
+  std::shared_ptr<Buffer> buffer;
+  if (device == kMemory) {
+    ABORT_NOT_OK(static_cast<io::BufferOutputStream&>(*sink).Finish(&buffer));
+  }
+  ABORT_NOT_OK(sink->Close());
+
+  while (state.KeepRunning()) {
+    std::shared_ptr<io::RandomAccessFile> source;
+    int64_t num_rows = 0;
+    if (!OpenSource(device, buffer, &source).ok() ||
+        !ReadBatches(format, source.get(), &num_rows).ok() ||
+        num_rows != kNumBatches * kBatchLength) {
       state.SkipWithError("Failed to read!");
     }
   }
-  state.SetBytesProcessed(int64_t(state.iterations()) * kTotalSize);
+  std::remove(kBenchmarkPath);
+  SetFormatCounters(size, state);
+}
+
+static void FormatArguments(benchmark::internal::Benchmark* bench) {
+  for (int format : {kStreamFormat, kFileFormat}) {
+    for (int device : {kMemory, kFile, kMemoryMap}) {
+      for (int kind = kPrimitive; kind <= kStruct; ++kind) {
+        bench->Args({format, device, kind});
+      }
+    }
+  }
 }
 
-BENCHMARK(BM_WriteRecordBatch)
-    ->RangeMultiplier(4)
-    ->Range(1, 1 << 13)
-    ->MinTime(1.0)
-    ->UseRealTime();
+BENCHMARK(BM_WriteFormat)->Apply(FormatArguments)->MinTime(1.0)->UseRealTime();
 
-BENCHMARK(BM_ReadRecordBatch)
-    ->RangeMultiplier(4)
-    ->Range(1, 1 << 13)
-    ->MinTime(1.0)
-    ->UseRealTime();
+BENCHMARK(BM_ReadFormat)->Apply(FormatArguments)->MinTime(1.0)->UseRealTime();
 
+}  // namespace ipc
 }  // namespace arrow
@@ -15,6 +15,8 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
+#include <cmath>
 #include <cstdint>
 #include <cstdio>
 #include <cstring>
@@ -34,11 +36,14 @@
 #include "arrow/ipc/util.h"
 #include "arrow/memory_pool.h"
 #include "arrow/pretty_print.h"
+#include "arrow/sparse_tensor.h"
 #include "arrow/status.h"
+#include "arrow/table.h"
 #include "arrow/tensor.h"
 #include "arrow/test-util.h"
 #include "arrow/util/bit-util.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/compression.h"
 
 namespace arrow {
 namespace ipc {
@@ -400,6 +405,29 @@ TEST_F(TestWriteRecordBatch, IntegerGetRecordBatchSize) {
   TestGetRecordBatchSize(batch);
 }
 
+TEST_F(TestWriteRecordBatch, SerializeIntoBuffer) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeListRecordBatch(&batch));
+  int64_t expected_size = 0;
+  ASSERT_OK(GetRecordBatchSize(*batch, &expected_size));
+
+  std::shared_ptr<Buffer> dst;
+  ASSERT_OK(AllocateBuffer(default_memory_pool(), expected_size + 64, &dst));
+  int64_t size = 0;
+  ASSERT_OK(SerializeRecordBatch(*batch, default_memory_pool(), dst, &size));
+  ASSERT_EQ(expected_size, size);
+
+  io::BufferReader buf_reader(SliceBuffer(dst, 0, size));
+  std::shared_ptr<RecordBatch> result;
+  ASSERT_OK(ReadRecordBatch(batch->schema(), &buf_reader, &result));
+  CheckReadResult(*result, *batch);
+
+  // Too small, by a byte
+  auto too_small = SliceMutableBuffer(dst, 0, size - 1);
+  ASSERT_RAISES(CapacityError,
+                SerializeRecordBatch(*batch, default_memory_pool(), too_small, &size));
+}
+
 class RecursionLimits : public ::testing::Test, public io::MemoryMapFixture {
  public:
   void SetUp() { pool_ = default_memory_pool(); }
@@ -569,6 +597,251 @@ TEST_P(TestFileFormat, RoundTrip) {
   }
 }
 
+TEST_P(TestFileFormat, ProjectedRoundTrip) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK((*GetParam())(&batch));  // NOLINT clang-tidy gtest issue
+
+  std::shared_ptr<RecordBatchWriter> writer;
+  ASSERT_OK(RecordBatchFileWriter::Open(sink_.get(), batch->schema(), &writer));
+  ASSERT_OK(writer->WriteRecordBatch(*batch));
+  ASSERT_OK(writer->Close());
+  ASSERT_OK(sink_->Close());
+
+  int64_t footer_offset;
+  ASSERT_OK(sink_->Tell(&footer_offset));
+  io::BufferReader buf_reader(buffer_);
+  std::shared_ptr<RecordBatchFileReader> reader;
+  ASSERT_OK(RecordBatchFileReader::Open(&buf_reader, footer_offset, &reader));
+
+  // Every column alone, then all of them in reverse order
+  std::vector<std::vector<int>> projections;
+  std::vector<int> reversed;
+  for (int i = 0; i < batch->num_columns(); ++i) {
+    projections.push_back({i});
+    reversed.insert(reversed.begin(), i);
+  }
+  projections.push_back(reversed);
+  projections.push_back({});
+
+  for (const auto& columns : projections) {
+    std::shared_ptr<RecordBatch> result;
+    ASSERT_OK(reader->ReadRecordBatch(0, columns, &result));
+    ASSERT_EQ(static_cast<int>(columns.size()), result->num_columns());
+    ASSERT_EQ(batch->num_rows(), result->num_rows());
+    for (size_t i = 0; i < columns.size(); ++i) {
+      ASSERT_TRUE(result->schema()->field(static_cast<int>(i))->Equals(
+          *batch->schema()->field(columns[i])));
+      AssertArraysEqual(*batch->column(columns[i]),
+                        *result->column(static_cast<int>(i)));
+    }
+  }
+
+  std::shared_ptr<RecordBatch> result;
+  ASSERT_RAISES(Invalid, reader->ReadRecordBatch(0, {batch->num_columns()}, &result));
+}
+
+TEST_P(TestFileFormat, LazyRoundTrip) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK((*GetParam())(&batch));  // NOLINT clang-tidy gtest issue
+
+  std::shared_ptr<RecordBatchWriter> writer;
+  ASSERT_OK(RecordBatchFileWriter::Open(sink_.get(), batch->schema(), &writer));
+  ASSERT_OK(writer->WriteRecordBatch(*batch));
+  ASSERT_OK(writer->WriteRecordBatch(*batch));
+  ASSERT_OK(writer->Close());
+  ASSERT_OK(sink_->Close());
+
+  int64_t footer_offset;
+  ASSERT_OK(sink_->Tell(&footer_offset));
+  io::BufferReader buf_reader(buffer_);
+  std::shared_ptr<RecordBatchFileReader> reader;
+  ASSERT_OK(RecordBatchFileReader::Open(&buf_reader, footer_offset, &reader));
+
+  for (int i = 0; i < reader->num_record_batches(); ++i) {
+    std::shared_ptr<RecordBatch> result;
+    ASSERT_OK(reader->ReadLazyRecordBatch(i, &result));
+    ASSERT_TRUE(result->schema()->Equals(*batch->schema()));
+    ASSERT_EQ(batch->num_rows(), result->num_rows());
+
+    // Columns are loaded in whatever order they are asked for
+    for (int j = batch->num_columns() - 1; j >= 0; --j) {
+      ASSERT_NE(nullptr, result->column(j));
+      AssertArraysEqual(*batch->column(j), *result->column(j));
+    }
+    ASSERT_OK(result->Validate());
+    CompareBatch(*batch, *result);
+
+    // Slices are lazy too, loading the columns of the whole batch
+    std::shared_ptr<RecordBatch> lazy;
+    ASSERT_OK(reader->ReadLazyRecordBatch(i, &lazy));
+    const int64_t offset = batch->num_rows() / 3;
+    CompareBatch(*batch->Slice(offset, 2), *lazy->Slice(offset, 2));
+    CompareBatch(*batch->Slice(offset), *lazy->Slice(offset));
+  }
+}
+
+TEST_F(TestFileFormat, ReadTable) {
+  BatchVector batches(10);
+  for (auto& batch : batches) {
+    ASSERT_OK(MakeIntRecordBatch(&batch));
+  }
+
+  std::shared_ptr<RecordBatchWriter> writer;
+  ASSERT_OK(RecordBatchFileWriter::Open(sink_.get(), batches[0]->schema(), &writer));
+  for (const auto& batch : batches) {
+    ASSERT_OK(writer->WriteRecordBatch(*batch));
+  }
+  ASSERT_OK(writer->Close());
+  ASSERT_OK(sink_->Close());
+
+  int64_t footer_offset;
+  ASSERT_OK(sink_->Tell(&footer_offset));
+  io::BufferReader buf_reader(buffer_);
+  std::shared_ptr<RecordBatchFileReader> reader;
+  ASSERT_OK(RecordBatchFileReader::Open(&buf_reader, footer_offset, &reader));
+
+  std::shared_ptr<Table> expected;
+  ASSERT_OK(Table::FromRecordBatches(batches, &expected));
+  for (bool use_threads : {false, true}) {
+    std::shared_ptr<Table> table;
+    ASSERT_OK(reader->ReadTable(&table, use_threads));
+    ASSERT_EQ(static_cast<int>(batches.size()), table->column(0)->data()->num_chunks());
+    ASSERT_TRUE(table->Equals(*expected));
+  }
+}
+
+TEST_F(TestFileFormat, Statistics) {
+  auto schema = ::arrow::schema({field("t", timestamp(TimeUnit::SECOND)),
+                                 field("x", float64()), field("s", utf8())});
+  // Batch i has times from 10 * i to 10 * i + 9, the last one has only nulls
+  BatchVector batches;
+  for (int i = 0; i < 5; ++i) {
+    std::vector<bool> is_valid(10, i < 4);
+    is_valid[0] = false;
+    std::vector<int64_t> times;
+    std::vector<double> xs;
+    for (int j = 0; j < 10; ++j) {
+      times.push_back(10 * i + j);
+      xs.push_back(j == 5 ? NAN : -1.5 * i);
+    }
+    std::shared_ptr<Array> t, x, s;
+    ArrayFromVector<TimestampType, int64_t>(schema->field(0)->type(), is_valid, times,
+                                            &t);
+    ArrayFromVector<DoubleType, double>(xs, &x);
+    ArrayFromVector<StringType, std::string>(std::vector<std::string>(10, "a"), &s);
+    batches.push_back(RecordBatch::Make(schema, 10, {t, x, s}));
+  }
+
+  auto read_file = [this](std::shared_ptr<RecordBatchFileReader>* reader) {
+    int64_t footer_offset;
+    ASSERT_OK(sink_->Tell(&footer_offset));
+    auto buf_reader = std::make_shared<io::BufferReader>(buffer_);
+    ASSERT_OK(RecordBatchFileReader::Open(buf_reader, footer_offset, reader));
+  };
+
+  std::shared_ptr<RecordBatchWriter> writer;
+  ASSERT_OK(RecordBatchFileWriter::Open(sink_.get(), schema, &writer));
+  checked_cast<RecordBatchFileWriter&>(*writer).set_write_statistics(true);
+  for (const auto& batch : batches) {
+    ASSERT_OK(writer->WriteRecordBatch(*batch));
+  }
+  ASSERT_OK(writer->Close());
+  ASSERT_OK(sink_->Close());
+  std::shared_ptr<RecordBatchFileReader> reader;
+  ASSERT_NO_FATAL_FAILURE(read_file(&reader));
+  ASSERT_TRUE(reader->has_statistics());
+
+  std::vector<ColumnStatistics> statistics;
+  ASSERT_OK(reader->GetStatistics(1, &statistics));
+  ASSERT_EQ(3, static_cast<int>(statistics.size()));
+  ASSERT_EQ(1, statistics[0].null_count);
+  ASSERT_TRUE(statistics[0].has_range);
+  ASSERT_EQ(11, statistics[0].int_min);
+  ASSERT_EQ(19, statistics[0].int_max);
+  ASSERT_TRUE(statistics[1].has_range);
+  ASSERT_EQ(-1.5, statistics[1].float_min);
+  ASSERT_EQ(-1.5, statistics[1].float_max);
+  ASSERT_FALSE(statistics[2].has_range);
+  ASSERT_OK(reader->GetStatistics(4, &statistics));
+  ASSERT_EQ(10, statistics[0].null_count);
+  ASSERT_FALSE(statistics[0].has_range);
+
+  std::vector<int> found;
+  ASSERT_OK(reader->FindRecordBatches(0, int64_t(15), int64_t(25), &found));
+  ASSERT_EQ(std::vector<int>({1, 2}), found);
+  ASSERT_OK(reader->FindRecordBatches(0, int64_t(10), int64_t(10), &found));
+  ASSERT_EQ(std::vector<int>(), found);
+  ASSERT_OK(reader->FindRecordBatches(0, int64_t(0), int64_t(100), &found));
+  ASSERT_EQ(std::vector<int>({0, 1, 2, 3}), found);
+  ASSERT_OK(reader->FindRecordBatches(1, -3.5, -1.0, &found));
+  ASSERT_EQ(std::vector<int>({1, 2}), found);
+  // No range is kept for strings
+  ASSERT_OK(reader->FindRecordBatches(2, int64_t(0), int64_t(0), &found));
+  ASSERT_EQ(5, static_cast<int>(found.size()));
+  ASSERT_RAISES(Invalid, reader->FindRecordBatches(1, int64_t(0), int64_t(0), &found));
+  ASSERT_RAISES(Invalid, reader->FindRecordBatches(0, 0.0, 1.0, &found));
+  ASSERT_RAISES(Invalid, reader->FindRecordBatches(3, 0.0, 1.0, &found));
+
+  // Without statistics, every batch may match
+  SetUp();
+  ASSERT_OK(RecordBatchFileWriter::Open(sink_.get(), schema, &writer));
+  for (const auto& batch : batches) {
+    ASSERT_OK(writer->WriteRecordBatch(*batch));
+  }
+  ASSERT_OK(writer->Close());
+  ASSERT_OK(sink_->Close());
+  ASSERT_NO_FATAL_FAILURE(read_file(&reader));
+  ASSERT_FALSE(reader->has_statistics());
+  ASSERT_RAISES(Invalid, reader->GetStatistics(0, &statistics));
+  ASSERT_OK(reader->FindRecordBatches(0, int64_t(15), int64_t(25), &found));
+  ASSERT_EQ(5, static_cast<int>(found.size()));
+}
+
+// A batch of one column of values easy to find in the written bytes
+static std::shared_ptr<RecordBatch> MakeChecksumBatch() {
+  std::vector<int64_t> values = {0x0123456789ABCDEF, 2, 3, 4, 5};
+  std::shared_ptr<Array> array;
+  ArrayFromVector<Int64Type, int64_t>(values, &array);
+  return RecordBatch::Make(::arrow::schema({field("f0", int64())}), 5, {array});
+}
+
+// Flip a bit of the first value of the batch in the written bytes
+static void CorruptChecksumBatch(ResizableBuffer* buffer) {
+  const int64_t value = 0x0123456789ABCDEF;
+  uint8_t pattern[sizeof(int64_t)];
+  std::memcpy(pattern, &value, sizeof(int64_t));
+  uint8_t* end = buffer->mutable_data() + buffer->size();
+  uint8_t* found = std::search(buffer->mutable_data(), end, pattern,
+                               pattern + sizeof(int64_t));
+  ASSERT_NE(end, found);
+  found[3] ^= 0x10;
+}
+
+TEST_F(TestFileFormat, Checksums) {
+  auto batch = MakeChecksumBatch();
+  std::shared_ptr<RecordBatchWriter> writer;
+  ASSERT_OK(RecordBatchFileWriter::Open(sink_.get(), batch->schema(), &writer));
+  checked_cast<RecordBatchFileWriter&>(*writer).set_checksum(true);
+  ASSERT_OK(writer->WriteRecordBatch(*batch));
+  ASSERT_OK(writer->Close());
+  ASSERT_OK(sink_->Close());
+
+  int64_t footer_offset;
+  ASSERT_OK(sink_->Tell(&footer_offset));
+  io::BufferReader buf_reader(buffer_);
+  std::shared_ptr<RecordBatchFileReader> reader;
+  ASSERT_OK(RecordBatchFileReader::Open(&buf_reader, footer_offset, &reader));
+  std::shared_ptr<RecordBatch> result;
+  ASSERT_OK(reader->ReadRecordBatch(0, &result));
+  CompareBatch(*batch, *result);
+
+  ASSERT_NO_FATAL_FAILURE(CorruptChecksumBatch(buffer_.get()));
+  ASSERT_RAISES(IOError, reader->ReadRecordBatch(0, &result));
+  reader->set_verify_checksums(false);
+  ASSERT_OK(reader->ReadRecordBatch(0, &result));
+  ASSERT_FALSE(result->Equals(*batch));
+}
+
 class TestStreamFormat : public ::testing::TestWithParam<MakeRecordBatch*> {
  public:
   void SetUp() {
@@ -583,6 +856,9 @@ class TestStreamFormat : public ::testing::TestWithParam<MakeRecordBatch*> {
     std::shared_ptr<RecordBatchWriter> writer;
     RETURN_NOT_OK(
         RecordBatchStreamWriter::Open(sink_.get(), batches[0]->schema(), &writer));
+    RETURN_NOT_OK(
+        checked_cast<RecordBatchStreamWriter&>(*writer).set_compression(compression_));
+    checked_cast<RecordBatchStreamWriter&>(*writer).set_checksum(checksum_);
 
     for (const auto& batch : batches) {
       RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
@@ -607,6 +883,9 @@ class TestStreamFormat : public ::testing::TestWithParam<MakeRecordBatch*> {
     return Status::OK();
   }
 
+  Compression::type compression_ = Compression::UNCOMPRESSED;
+  bool checksum_ = false;
+
  protected:
   MemoryPool* pool_;
 
@@ -690,6 +969,106 @@ TEST_F(TestStreamFormat, DictionaryRoundTrip) {
   CheckBatchDictionaries(*out_batches[0]);
 }
 
+TEST_F(TestStreamFormat, DictionaryDeltas) {
+  // Each batch has the dictionary of the one before, with more entries
+  std::vector<std::vector<std::string>> dict_values = {{"foo", "bar"},
+                                                       {"foo", "bar"},
+                                                       {"foo", "bar", "baz"},
+                                                       {"foo", "bar", "baz", "qux"}};
+  std::vector<std::vector<int32_t>> indices_values = {
+      {0, 1, 1}, {1, 0, 0}, {2, 0, 1}, {3, 2, 3}};
+
+  BatchVector batches;
+  std::shared_ptr<Array> dict;
+  for (size_t i = 0; i < dict_values.size(); ++i) {
+    if (i == 0 || dict_values[i] != dict_values[i - 1]) {
+      ArrayFromVector<StringType, std::string>(dict_values[i], &dict);
+    }
+    std::shared_ptr<Array> indices;
+    ArrayFromVector<Int32Type, int32_t>(indices_values[i], &indices);
+    auto type = arrow::dictionary(int32(), dict);
+    auto array = std::make_shared<DictionaryArray>(type, indices);
+    batches.push_back(RecordBatch::Make(::arrow::schema({field("f0", type)}),
+                                        array->length(), {array}));
+  }
+
+  BatchVector out_batches;
+  ASSERT_OK(RoundTripHelper(batches, &out_batches));
+  ASSERT_EQ(batches.size(), out_batches.size());
+  for (size_t i = 0; i < batches.size(); ++i) {
+    CompareBatch(*batches[i], *out_batches[i]);
+    const auto& out_type =
+        checked_cast<const DictionaryType&>(*out_batches[i]->schema()->field(0)->type());
+    AssertArraysEqual(*checked_cast<const DictionaryType&>(
+                           *batches[i]->schema()->field(0)->type())
+                           .dictionary(),
+                      *out_type.dictionary());
+  }
+}
+
+TEST_F(TestStreamFormat, DictionaryNotExtended) {
+  std::shared_ptr<Array> dict1, dict2, indices;
+  ArrayFromVector<StringType, std::string>({"foo", "bar"}, &dict1);
+  ArrayFromVector<StringType, std::string>({"bar", "foo", "baz"}, &dict2);
+  ArrayFromVector<Int32Type, int32_t>({0, 1}, &indices);
+
+  auto type1 = arrow::dictionary(int32(), dict1);
+  auto type2 = arrow::dictionary(int32(), dict2);
+  auto batch1 = RecordBatch::Make(::arrow::schema({field("f0", type1)}), 2,
+                                  {std::make_shared<DictionaryArray>(type1, indices)});
+  auto batch2 = RecordBatch::Make(::arrow::schema({field("f0", type2)}), 2,
+                                  {std::make_shared<DictionaryArray>(type2, indices)});
+
+  std::shared_ptr<RecordBatchWriter> writer;
+  ASSERT_OK(RecordBatchStreamWriter::Open(sink_.get(), batch1->schema(), &writer));
+  ASSERT_OK(writer->WriteRecordBatch(*batch1));
+  ASSERT_RAISES(Invalid, writer->WriteRecordBatch(*batch2));
+}
+
+TEST_F(TestStreamFormat, ReuseBuffers) {
+  const int num_batches = 5;
+  BatchVector batches(num_batches);
+  for (auto& batch : batches) {
+    ASSERT_OK(MakeListRecordBatch(&batch));
+  }
+
+  std::shared_ptr<RecordBatchWriter> writer;
+  ASSERT_OK(RecordBatchStreamWriter::Open(sink_.get(), batches[0]->schema(), &writer));
+  for (const auto& batch : batches) {
+    ASSERT_OK(writer->WriteRecordBatch(*batch));
+  }
+  ASSERT_OK(writer->Close());
+  ASSERT_OK(sink_->Close());
+
+  io::BufferReader buf_reader(buffer_);
+  StreamReadOptions options;
+  options.reuse_buffers = true;
+  std::shared_ptr<RecordBatchReader> reader;
+  ASSERT_OK(RecordBatchStreamReader::Open(&buf_reader, options, &reader));
+
+  // The first batch is kept, so that the second is read into new buffers;
+  // the others are dropped once checked
+  std::shared_ptr<RecordBatch> first;
+  ASSERT_OK(reader->ReadNext(&first));
+  CompareBatch(*batches[0], *first);
+  for (int i = 1; i < num_batches; ++i) {
+    std::shared_ptr<RecordBatch> batch;
+    ASSERT_OK(reader->ReadNext(&batch));
+    ASSERT_NE(nullptr, batch);
+    CompareBatch(*batches[i], *batch);
+  }
+  std::shared_ptr<RecordBatch> end;
+  ASSERT_OK(reader->ReadNext(&end));
+  ASSERT_EQ(nullptr, end);
+  CompareBatch(*batches[0], *first);
+
+  StreamReadStats stats = checked_cast<RecordBatchStreamReader&>(*reader).stats();
+  ASSERT_EQ(num_batches, stats.num_messages);
+  ASSERT_EQ(num_batches, stats.num_record_batches);
+  ASSERT_EQ((num_batches - 2) * batches[0]->num_columns(), stats.num_reused_array_data);
+  ASSERT_GE(stats.total_decode_nanos, stats.last_decode_nanos);
+}
+
 TEST_F(TestStreamFormat, WriteTable) {
   std::shared_ptr<RecordBatch> b1, b2, b3;
   ASSERT_OK(MakeIntRecordBatch(&b1));
@@ -704,6 +1083,190 @@ TEST_F(TestStreamFormat, WriteTable) {
   ASSERT_TRUE(b3->Equals(*out_batches[2]));
 }
 
+TEST_F(TestStreamFormat, CompressedRoundTrip) {
+  // The values span several compression blocks, the last one partial
+  std::vector<int64_t> values(kDefaultCompressionBlockSize * 5 / 2 / sizeof(int64_t), 0);
+  for (size_t i = 0; i < values.size(); ++i) {
+    values[i] = static_cast<int64_t>(i % 7);
+  }
+  std::shared_ptr<Array> array;
+  ArrayFromVector<Int64Type, int64_t>(values, &array);
+  auto schema = ::arrow::schema({field("f0", int64())});
+  auto batch = RecordBatch::Make(schema, static_cast<int64_t>(values.size()), {array});
+
+  for (auto compression : {Compression::SNAPPY, Compression::GZIP, Compression::BROTLI,
+                           Compression::ZSTD, Compression::LZ4}) {
+    std::unique_ptr<Codec> codec;
+    if (!Codec::Create(compression, &codec).ok()) {
+      // Not built with this codec
+      continue;
+    }
+    SetUp();
+    compression_ = compression;
+
+    BatchVector out_batches;
+    ASSERT_OK(RoundTripHelper({batch, batch}, &out_batches));
+    ASSERT_EQ(2, static_cast<int>(out_batches.size()));
+    for (const auto& out_batch : out_batches) {
+      CompareBatch(*batch, *out_batch);
+    }
+    // The repetitive values must have shrunk
+    ASSERT_LT(buffer_->size(), static_cast<int64_t>(values.size() * sizeof(int64_t)));
+  }
+}
+
+TEST_F(TestStreamFormat, ChecksumRoundTrip) {
+  checksum_ = true;
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeDictionary(&batch));
+
+  BatchVector out_batches;
+  ASSERT_OK(RoundTripHelper({batch, batch}, &out_batches));
+  ASSERT_EQ(2, static_cast<int>(out_batches.size()));
+  for (const auto& out_batch : out_batches) {
+    CompareBatch(*batch, *out_batch);
+  }
+  CheckBatchDictionaries(*out_batches[0]);
+
+  // Checksums are kept on compressed bodies too
+  std::unique_ptr<Codec> codec;
+  if (Codec::Create(Compression::ZSTD, &codec).ok()) {
+    SetUp();
+    compression_ = Compression::ZSTD;
+    out_batches.clear();
+    ASSERT_OK(RoundTripHelper({MakeChecksumBatch()}, &out_batches));
+    CompareBatch(*MakeChecksumBatch(), *out_batches[0]);
+  }
+}
+
+TEST_F(TestStreamFormat, ChecksumMismatch) {
+  auto batch = MakeChecksumBatch();
+  std::shared_ptr<RecordBatchWriter> writer;
+  ASSERT_OK(RecordBatchStreamWriter::Open(sink_.get(), batch->schema(), &writer));
+  checked_cast<RecordBatchStreamWriter&>(*writer).set_checksum(true);
+  ASSERT_OK(writer->WriteRecordBatch(*batch));
+  ASSERT_OK(writer->Close());
+  ASSERT_OK(sink_->Close());
+  ASSERT_NO_FATAL_FAILURE(CorruptChecksumBatch(buffer_.get()));
+
+  std::shared_ptr<RecordBatch> result;
+  {
+    io::BufferReader buf_reader(buffer_);
+    std::shared_ptr<RecordBatchReader> reader;
+    ASSERT_OK(RecordBatchStreamReader::Open(&buf_reader, &reader));
+    ASSERT_RAISES(IOError, reader->ReadNext(&result));
+  }
+
+  // Not verifying, the corrupt value is read as is
+  io::BufferReader buf_reader(buffer_);
+  StreamReadOptions options;
+  options.verify_checksums = false;
+  std::shared_ptr<RecordBatchReader> reader;
+  ASSERT_OK(RecordBatchStreamReader::Open(&buf_reader, options, &reader));
+  ASSERT_OK(reader->ReadNext(&result));
+  ASSERT_NE(nullptr, result);
+  ASSERT_FALSE(result->Equals(*batch));
+}
+
+TEST_F(TestStreamFormat, AsyncWriter) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeIntBatchSized(30, &batch));
+
+  std::shared_ptr<RecordBatchWriter> stream_writer, writer;
+  ASSERT_OK(RecordBatchStreamWriter::Open(sink_.get(), batch->schema(), &stream_writer));
+  ASSERT_OK(AsyncRecordBatchWriter::Open(stream_writer, 4, &writer));
+
+  const int num_batches = 20;
+  for (int i = 0; i < num_batches; ++i) {
+    ASSERT_OK(writer->WriteRecordBatch(*batch->Slice(i, 10)));
+  }
+  ASSERT_OK(writer->Close());
+  ASSERT_RAISES(Invalid, writer->WriteRecordBatch(*batch));
+  ASSERT_OK(sink_->Close());
+
+  io::BufferReader buf_reader(buffer_);
+  std::shared_ptr<RecordBatchReader> reader;
+  ASSERT_OK(RecordBatchStreamReader::Open(&buf_reader, &reader));
+  std::shared_ptr<RecordBatch> out_batch;
+  for (int i = 0; i < num_batches; ++i) {
+    ASSERT_OK(reader->ReadNext(&out_batch));
+    ASSERT_NE(nullptr, out_batch);
+    CompareBatch(*batch->Slice(i, 10), *out_batch);
+  }
+  ASSERT_OK(reader->ReadNext(&out_batch));
+  ASSERT_EQ(nullptr, out_batch);
+}
+
+TEST_F(TestStreamFormat, CoalescingWriter) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeIntBatchSized(30, &batch));
+
+  std::shared_ptr<RecordBatchWriter> stream_writer, writer;
+  ASSERT_OK(RecordBatchStreamWriter::Open(sink_.get(), batch->schema(), &stream_writer));
+  CoalesceOptions options;
+  options.max_rows = 25;
+  ASSERT_OK(CoalescingRecordBatchWriter::Open(stream_writer, options, &writer));
+
+  // Ten rows at a time, written as batches of 30, 30 then the 10 left
+  for (int i = 0; i < 7; ++i) {
+    ASSERT_OK(writer->WriteRecordBatch(*batch->Slice(i % 3 * 10, 10)));
+  }
+  ASSERT_OK(checked_cast<CoalescingRecordBatchWriter&>(*writer).Flush());
+  // Nothing held, and big enough to be written as is
+  ASSERT_OK(writer->WriteRecordBatch(*batch));
+  ASSERT_OK(writer->Close());
+  ASSERT_OK(sink_->Close());
+
+  io::BufferReader buf_reader(buffer_);
+  std::shared_ptr<RecordBatchReader> reader;
+  ASSERT_OK(RecordBatchStreamReader::Open(&buf_reader, &reader));
+  BatchVector out_batches;
+  std::shared_ptr<RecordBatch> out_batch;
+  while (true) {
+    ASSERT_OK(reader->ReadNext(&out_batch));
+    if (out_batch == nullptr) {
+      break;
+    }
+    out_batches.push_back(out_batch);
+  }
+  ASSERT_EQ(4, out_batches.size());
+  CompareBatch(*batch, *out_batches[0]);
+  CompareBatch(*batch, *out_batches[1]);
+  CompareBatch(*batch->Slice(0, 10), *out_batches[2]);
+  CompareBatch(*batch, *out_batches[3]);
+}
+
+class FailingOutputStream : public io::OutputStream {
+ public:
+  Status Close() override { return Status::OK(); }
+  Status Tell(int64_t* position) const override {
+    *position = 0;
+    return Status::OK();
+  }
+  Status Write(const void* data, int64_t nbytes) override {
+    return Status::IOError("Disk full");
+  }
+};
+
+TEST_F(TestStreamFormat, AsyncWriterFailure) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeIntRecordBatch(&batch));
+
+  FailingOutputStream sink;
+  std::shared_ptr<RecordBatchWriter> stream_writer, writer;
+  ASSERT_OK(RecordBatchStreamWriter::Open(&sink, batch->schema(), &stream_writer));
+  ASSERT_OK(AsyncRecordBatchWriter::Open(stream_writer, 1, &writer));
+
+  // The first write fails on the background thread, to be reported by a
+  // later write or by Close
+  Status status;
+  for (int i = 0; i < 100 && status.ok(); ++i) {
+    status = writer->WriteRecordBatch(*batch);
+  }
+  ASSERT_RAISES(IOError, writer->Close());
+  ASSERT_TRUE(status.ok() || status.IsIOError());
+}
+
 TEST_F(TestFileFormat, DictionaryRoundTrip) {
   std::shared_ptr<RecordBatch> batch;
   ASSERT_OK(MakeDictionary(&batch));
@@ -774,6 +1337,114 @@ TEST_F(TestTensorRoundTrip, NonContiguous) {
   CheckTensorRoundTrip(tensor);
 }
 
+TEST_F(TestTensorRoundTrip, NonContiguousPermuted) {
+  std::string path = "test-write-tensor-permuted";
+  constexpr int64_t kBufferSize = 1 << 20;
+  ASSERT_OK(io::MemoryMapFixture::InitMemoryMap(kBufferSize, path, &mmap_));
+
+  std::vector<int64_t> values;
+  test::randint(60, 0, 100, &values);
+
+  // The first two axes of a {3, 4, 5} row-major tensor swapped
+  auto data = test::GetBufferFromVector(values);
+  Tensor tensor(int64(), data, {4, 3, 5}, {40, 160, 8});
+  ASSERT_FALSE(tensor.is_contiguous());
+
+  CheckTensorRoundTrip(tensor);
+}
+
+class TestSparseTensorRoundTrip : public ::testing::Test, public IpcTestFixture {
+ public:
+  void SetUp() {
+    pool_ = default_memory_pool();
+    // A 10x20 matrix with a non-zero value in every seventh cell
+    std::vector<double> values(200, 0);
+    for (size_t i = 0; i < values.size(); i += 7) {
+      values[i] = static_cast<double>(i) + 0.5;
+    }
+    std::vector<int64_t> shape = {10, 20};
+    std::vector<std::string> dim_names = {"rows", "cols"};
+    dense_ = std::make_shared<Tensor>(float64(), test::GetBufferFromVector(values), shape,
+                                      std::vector<int64_t>{}, dim_names);
+  }
+  void TearDown() { io::MemoryMapFixture::TearDown(); }
+
+  void CheckSparseTensorRoundTrip(const SparseTensor& sparse_tensor) {
+    int32_t metadata_length;
+    int64_t body_length;
+
+    ASSERT_OK(mmap_->Seek(0));
+    ASSERT_OK(
+        WriteSparseTensor(sparse_tensor, mmap_.get(), &metadata_length, &body_length));
+
+    std::shared_ptr<SparseTensor> result;
+    ASSERT_OK(ReadSparseTensor(0, mmap_.get(), &result));
+    ASSERT_TRUE(sparse_tensor.Equals(*result));
+    ASSERT_EQ(sparse_tensor.dim_names(), result->dim_names());
+
+    std::shared_ptr<Tensor> dense;
+    ASSERT_OK(result->ToTensor(pool_, &dense));
+    ASSERT_TRUE(dense->Equals(*dense_));
+
+    std::unique_ptr<Message> message;
+    ASSERT_OK(GetSparseTensorMessage(sparse_tensor, pool_, &message));
+    ASSERT_EQ(Message::SPARSE_TENSOR, message->type());
+    ASSERT_OK(ReadSparseTensor(*message, &result));
+    ASSERT_TRUE(sparse_tensor.Equals(*result));
+  }
+
+ protected:
+  std::shared_ptr<Tensor> dense_;
+};
+
+TEST_F(TestSparseTensorRoundTrip, COO) {
+  ASSERT_OK(
+      io::MemoryMapFixture::InitMemoryMap(1 << 16, "test-write-sparse-coo", &mmap_));
+  std::shared_ptr<SparseTensor> sparse_tensor;
+  ASSERT_OK(MakeSparseCOOTensor(*dense_, pool_, &sparse_tensor));
+  CheckSparseTensorRoundTrip(*sparse_tensor);
+}
+
+TEST_F(TestSparseTensorRoundTrip, CSR) {
+  ASSERT_OK(
+      io::MemoryMapFixture::InitMemoryMap(1 << 16, "test-write-sparse-csr", &mmap_));
+  std::shared_ptr<SparseTensor> sparse_tensor;
+  ASSERT_OK(MakeSparseCSRTensor(*dense_, pool_, &sparse_tensor));
+  CheckSparseTensorRoundTrip(*sparse_tensor);
+
+  // Only the non-zero values are serialized
+  int64_t sparse_size, dense_size;
+  ASSERT_OK(GetSparseTensorSize(*sparse_tensor, &sparse_size));
+  ASSERT_OK(GetTensorSize(*dense_, &dense_size));
+  ASSERT_LT(sparse_size, dense_size);
+}
+
+TEST_F(TestSparseTensorRoundTrip, ZeroCopyRead) {
+  std::shared_ptr<SparseTensor> sparse_tensor;
+  ASSERT_OK(MakeSparseCOOTensor(*dense_, pool_, &sparse_tensor));
+
+  // As a sparse tensor in a plasma object, read through a BufferReader
+  int64_t size;
+  ASSERT_OK(GetSparseTensorSize(*sparse_tensor, &size));
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(AllocateBuffer(pool_, size, &buffer));
+  io::FixedSizeBufferWriter writer(buffer);
+  int32_t metadata_length;
+  int64_t body_length;
+  ASSERT_OK(WriteSparseTensor(*sparse_tensor, &writer, &metadata_length, &body_length));
+
+  io::BufferReader reader(buffer);
+  std::shared_ptr<SparseTensor> result;
+  ASSERT_OK(ReadSparseTensor(0, &reader, &result));
+  ASSERT_TRUE(sparse_tensor->Equals(*result));
+
+  const uint8_t* begin = buffer->data();
+  const uint8_t* end = begin + buffer->size();
+  const auto& index = checked_cast<const SparseCOOIndex&>(*result->sparse_index());
+  ASSERT_TRUE(result->raw_data() >= begin && result->raw_data() < end);
+  ASSERT_TRUE(index.indices()->raw_data() >= begin && index.indices()->raw_data() < end);
+}
+
 TEST(TestRecordBatchStreamReader, MalformedInput) {
   const std::string empty_str = "";
   const std::string garbage_str = "12345678";
@@ -790,5 +1461,55 @@ TEST(TestRecordBatchStreamReader, MalformedInput) {
   ASSERT_RAISES(Invalid, RecordBatchStreamReader::Open(&garbage_reader, &batch_reader));
 }
 
+#ifndef _WIN32
+
+TEST(TestRecordBatchStreamServer, ServeStreams) {
+  BatchVector batches(3);
+  for (auto& batch : batches) {
+    ASSERT_OK(MakeIntRecordBatch(&batch));
+  }
+  std::shared_ptr<Table> table;
+  ASSERT_OK(Table::FromRecordBatches(batches, &table));
+
+  auto handler = [&table](const std::string& ticket,
+                          std::shared_ptr<RecordBatchReader>* out) -> Status {
+    if (ticket != "a" && ticket != "b") {
+      return Status::KeyError("Unknown ticket " + ticket);
+    }
+    *out = std::make_shared<TableBatchReader>(*table);
+    return Status::OK();
+  };
+  std::shared_ptr<RecordBatchStreamServer> server;
+  ASSERT_OK(RecordBatchStreamServer::Start("127.0.0.1", 0, handler, 2, &server));
+  const int port = server->port();
+
+  std::shared_ptr<RecordBatchReader> reader;
+  ASSERT_OK(OpenRecordBatchStream("127.0.0.1", port, "a", &reader));
+  ASSERT_TRUE(reader->schema()->Equals(*table->schema()));
+  for (const auto& batch : batches) {
+    std::shared_ptr<RecordBatch> received;
+    ASSERT_OK(reader->ReadNext(&received));
+    ASSERT_NE(nullptr, received);
+    CompareBatch(*batch, *received);
+  }
+  std::shared_ptr<RecordBatch> end;
+  ASSERT_OK(reader->ReadNext(&end));
+  ASSERT_EQ(nullptr, end);
+
+  // The status of the handler reaches the client
+  ASSERT_RAISES(KeyError, OpenRecordBatchStream("127.0.0.1", port, "c", &reader));
+
+  // More streams at once than the server serves concurrently
+  std::shared_ptr<Table> fetched;
+  ASSERT_OK(ReadRecordBatchStreams("127.0.0.1", port, {"a", "b", "a"}, &fetched));
+  ASSERT_EQ(3 * table->num_rows(), fetched->num_rows());
+  ASSERT_TRUE(fetched->schema()->Equals(*table->schema()));
+
+  ASSERT_OK(server->Stop());
+  ASSERT_RAISES(IOError, OpenRecordBatchStream("127.0.0.1", port, "a", &reader));
+}
+
+#endif  // _WIN32
+
 }  // namespace ipc
 }  // namespace arrow
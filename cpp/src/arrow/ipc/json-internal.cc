@@ -28,6 +28,7 @@
 #include "arrow/array.h"
 #include "arrow/builder.h"
 #include "arrow/ipc/dictionary.h"
+#include "arrow/memory_pool.h"
 #include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
@@ -36,6 +37,7 @@
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/decimal.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
 #include "arrow/util/string.h"
 #include "arrow/visitor_inline.h"
 
@@ -177,6 +179,8 @@ class SchemaWriter {
   template <typename T>
   typename std::enable_if<std::is_base_of<NoExtraMeta, T>::value ||
                               std::is_base_of<ListType, T>::value ||
+                              std::is_base_of<LargeListType, T>::value ||
+                              std::is_base_of<RunLengthEncodedType, T>::value ||
                               std::is_base_of<StructType, T>::value,
                           void>::type
   WriteTypeMetadata(const T& type) {}
@@ -238,6 +242,11 @@ class SchemaWriter {
     writer_->Int(type.byte_width());
   }
 
+  void WriteTypeMetadata(const FixedSizeListType& type) {
+    writer_->Key("listSize");
+    writer_->Int(type.list_size());
+  }
+
   void WriteTypeMetadata(const Decimal128Type& type) {
     writer_->Key("precision");
     writer_->Int(type.precision());
@@ -308,6 +317,10 @@ class SchemaWriter {
   Status Visit(const TimeType& type) { return WritePrimitive("time", type); }
   Status Visit(const StringType& type) { return WriteVarBytes("utf8", type); }
   Status Visit(const BinaryType& type) { return WriteVarBytes("binary", type); }
+  Status Visit(const LargeStringType& type) { return WriteVarBytes("largeutf8", type); }
+  Status Visit(const LargeBinaryType& type) {
+    return WriteVarBytes("largebinary", type);
+  }
   Status Visit(const FixedSizeBinaryType& type) {
     return WritePrimitive("fixedsizebinary", type);
   }
@@ -321,6 +334,21 @@ class SchemaWriter {
     return Status::OK();
   }
 
+  Status Visit(const LargeListType& type) {
+    WriteName("largelist", type);
+    return Status::OK();
+  }
+
+  Status Visit(const FixedSizeListType& type) {
+    WriteName("fixedsizelist", type);
+    return Status::OK();
+  }
+
+  Status Visit(const RunLengthEncodedType& type) {
+    WriteName("runlengthencoded", type);
+    return Status::OK();
+  }
+
   Status Visit(const StructType& type) {
     WriteName("struct", type);
     return Status::OK();
@@ -413,13 +441,16 @@ class ArrayWriter {
 
   // Binary, encode to hexadecimal. UTF8 string write as is
   template <typename T>
-  typename std::enable_if<std::is_base_of<BinaryArray, T>::value, void>::type
+  typename std::enable_if<std::is_base_of<BinaryArray, T>::value ||
+                              std::is_base_of<LargeBinaryArray, T>::value,
+                          void>::type
   WriteDataValues(const T& arr) {
     for (int64_t i = 0; i < arr.length(); ++i) {
-      int32_t length;
+      typename T::TypeClass::offset_type length;
       const uint8_t* buf = arr.GetValue(i, &length);
 
-      if (std::is_base_of<StringArray, T>::value) {
+      if (std::is_base_of<StringArray, T>::value ||
+          std::is_base_of<LargeStringArray, T>::value) {
         // Presumed UTF-8
         writer_->String(reinterpret_cast<const char*>(buf), length);
       } else {
@@ -525,8 +556,10 @@ class ArrayWriter {
   }
 
   template <typename T>
-  typename std::enable_if<std::is_base_of<BinaryArray, T>::value, Status>::type Visit(
-      const T& array) {
+  typename std::enable_if<std::is_base_of<BinaryArray, T>::value ||
+                              std::is_base_of<LargeBinaryArray, T>::value,
+                          Status>::type
+  Visit(const T& array) {
     WriteValidityField(array);
     WriteIntegerField("OFFSET", array.raw_value_offsets(), array.length() + 1);
     WriteDataField(array);
@@ -545,6 +578,32 @@ class ArrayWriter {
     return WriteChildren(type.children(), {array.values()});
   }
 
+  Status Visit(const LargeListArray& array) {
+    WriteValidityField(array);
+    WriteIntegerField("OFFSET", array.raw_value_offsets(), array.length() + 1);
+    const auto& type = checked_cast<const LargeListType&>(*array.type());
+    return WriteChildren(type.children(), {array.values()});
+  }
+
+  Status Visit(const FixedSizeListArray& array) {
+    WriteValidityField(array);
+    const auto& type = checked_cast<const FixedSizeListType&>(*array.type());
+    std::shared_ptr<Array> values =
+        array.values()->Slice(array.value_offset(0), array.length() * array.list_size());
+    return WriteChildren(type.children(), {values});
+  }
+
+  Status Visit(const RunLengthEncodedArray& array) {
+    WriteValidityField(array);
+    std::shared_ptr<Buffer> run_ends;
+    std::shared_ptr<Array> values;
+    RETURN_NOT_OK(array.RebaseRuns(default_memory_pool(), &run_ends, &values));
+    WriteIntegerField("RUN_ENDS", reinterpret_cast<const int32_t*>(run_ends->data()),
+                      values->length());
+    const auto& type = checked_cast<const RunLengthEncodedType&>(*array.type());
+    return WriteChildren(type.children(), {values});
+  }
+
   Status Visit(const StructArray& array) {
     WriteValidityField(array);
     const auto& type = checked_cast<const StructType&>(*array.type());
@@ -808,6 +867,10 @@ static Status GetType(const RjObject& json_type,
     *type = utf8();
   } else if (type_name == "binary") {
     *type = binary();
+  } else if (type_name == "largeutf8") {
+    *type = large_utf8();
+  } else if (type_name == "largebinary") {
+    *type = large_binary();
   } else if (type_name == "fixedsizebinary") {
     return GetFixedSizeBinary(json_type, type);
   } else if (type_name == "decimal") {
@@ -825,6 +888,23 @@ static Status GetType(const RjObject& json_type,
       return Status::Invalid("List must have exactly one child");
     }
     *type = list(children[0]);
+  } else if (type_name == "largelist") {
+    if (children.size() != 1) {
+      return Status::Invalid("LargeList must have exactly one child");
+    }
+    *type = large_list(children[0]);
+  } else if (type_name == "fixedsizelist") {
+    if (children.size() != 1) {
+      return Status::Invalid("FixedSizeList must have exactly one child");
+    }
+    int32_t list_size;
+    RETURN_NOT_OK(GetObjectInt(json_type, "listSize", &list_size));
+    *type = fixed_size_list(children[0], list_size);
+  } else if (type_name == "runlengthencoded") {
+    if (children.size() != 1) {
+      return Status::Invalid("RunLengthEncoded must have exactly one child");
+    }
+    *type = std::make_shared<RunLengthEncodedType>(children[0]);
   } else if (type_name == "struct") {
     *type = struct_(children);
   } else if (type_name == "union") {
@@ -1006,8 +1086,10 @@ class ArrayReader {
   }
 
   template <typename T>
-  typename std::enable_if<std::is_base_of<BinaryType, T>::value, Status>::type Visit(
-      const T& type) {
+  typename std::enable_if<std::is_base_of<BinaryType, T>::value ||
+                              std::is_base_of<LargeBinaryType, T>::value,
+                          Status>::type
+  Visit(const T& type) {
     typename TypeTraits<T>::BuilderType builder(pool_);
 
     const auto& json_data = obj_->FindMember("DATA");
@@ -1025,7 +1107,8 @@ class ArrayReader {
 
       const rj::Value& val = json_data_arr[i];
       DCHECK(val.IsString());
-      if (std::is_base_of<StringType, T>::value) {
+      if (std::is_base_of<StringType, T>::value ||
+          std::is_base_of<LargeStringType, T>::value) {
         RETURN_NOT_OK(builder.Append(val.GetString()));
       } else {
         std::string hex_string = val.GetString();
@@ -1130,15 +1213,20 @@ class ArrayReader {
     T* values = reinterpret_cast<T*>(buffer->mutable_data());
     for (int i = 0; i < length; ++i) {
       const rj::Value& val = json_array[i];
-      DCHECK(val.IsInt());
-      values[i] = static_cast<T>(val.GetInt());
+      DCHECK(val.IsInt64());
+      values[i] = static_cast<T>(val.GetInt64());
     }
 
     *out = buffer;
     return Status::OK();
   }
 
-  Status Visit(const ListType& type) {
+  template <typename T>
+  typename std::enable_if<std::is_base_of<ListType, T>::value ||
+                              std::is_base_of<LargeListType, T>::value,
+                          Status>::type
+  Visit(const T& type) {
+    using offset_type = typename T::offset_type;
     int32_t null_count = 0;
     std::shared_ptr<Buffer> validity_buffer;
     RETURN_NOT_OK(GetValidityBuffer(is_valid_, &null_count, &validity_buffer));
@@ -1146,19 +1234,53 @@ class ArrayReader {
     const auto& json_offsets = obj_->FindMember("OFFSET");
     RETURN_NOT_ARRAY("OFFSET", json_offsets, *obj_);
     std::shared_ptr<Buffer> offsets_buffer;
-    RETURN_NOT_OK(GetIntArray<int32_t>(json_offsets->value.GetArray(), length_ + 1,
-                                       &offsets_buffer));
+    RETURN_NOT_OK(GetIntArray<offset_type>(json_offsets->value.GetArray(), length_ + 1,
+                                           &offsets_buffer));
 
     std::vector<std::shared_ptr<Array>> children;
     RETURN_NOT_OK(GetChildren(*obj_, type, &children));
     DCHECK_EQ(children.size(), 1);
 
-    result_ = std::make_shared<ListArray>(type_, length_, offsets_buffer, children[0],
-                                          validity_buffer, null_count);
+    result_ = std::make_shared<typename TypeTraits<T>::ArrayType>(
+        type_, length_, offsets_buffer, children[0], validity_buffer, null_count);
 
     return Status::OK();
   }
 
+  Status Visit(const FixedSizeListType& type) {
+    int32_t null_count = 0;
+    std::shared_ptr<Buffer> validity_buffer;
+    RETURN_NOT_OK(GetValidityBuffer(is_valid_, &null_count, &validity_buffer));
+
+    std::vector<std::shared_ptr<Array>> children;
+    RETURN_NOT_OK(GetChildren(*obj_, type, &children));
+    DCHECK_EQ(children.size(), 1);
+
+    result_ = std::make_shared<FixedSizeListArray>(type_, length_, children[0],
+                                                   validity_buffer, null_count);
+
+    return Status::OK();
+  }
+
+  Status Visit(const RunLengthEncodedType& type) {
+    // The validity is all set: null slots are runs of a null value
+    const auto& json_run_ends = obj_->FindMember("RUN_ENDS");
+    RETURN_NOT_ARRAY("RUN_ENDS", json_run_ends, *obj_);
+    const auto& json_run_ends_arr = json_run_ends->value.GetArray();
+    std::shared_ptr<Buffer> run_ends_buffer;
+    RETURN_NOT_OK(GetIntArray<int32_t>(json_run_ends_arr,
+                                       static_cast<int32_t>(json_run_ends_arr.Size()),
+                                       &run_ends_buffer));
+
+    std::vector<std::shared_ptr<Array>> children;
+    RETURN_NOT_OK(GetChildren(*obj_, type, &children));
+    DCHECK_EQ(children.size(), 1);
+
+    result_ = std::make_shared<RunLengthEncodedArray>(type_, length_, run_ends_buffer,
+                                                      children[0]);
+    return Status::OK();
+  }
+
   Status Visit(const StructType& type) {
     int32_t null_count = 0;
     std::shared_ptr<Buffer> validity_buffer;
@@ -1416,11 +1538,16 @@ Status ReadRecordBatch(const rj::Value& json_obj, const std::shared_ptr<Schema>&
   RETURN_NOT_ARRAY("columns", it, batch_obj);
   const auto& json_columns = it->value.GetArray();
 
+  if (static_cast<int>(json_columns.Size()) != schema->num_fields()) {
+    return Status::Invalid("Record batch has another number of columns than the schema");
+  }
+
+  // The document is only read, so the columns can be built in parallel
   std::vector<std::shared_ptr<Array>> columns(json_columns.Size());
-  for (int i = 0; i < static_cast<int>(columns.size()); ++i) {
+  RETURN_NOT_OK(ParallelFor(static_cast<int>(columns.size()), [&](int i) -> Status {
     const std::shared_ptr<DataType>& type = schema->field(i)->type();
-    RETURN_NOT_OK(ReadArray(pool, json_columns[i], type, &columns[i]));
-  }
+    return ReadArray(pool, json_columns[i], type, &columns[i]);
+  }));
 
   *batch = RecordBatch::Make(schema, num_rows, columns);
   return Status::OK();
@@ -1434,13 +1561,20 @@ Status WriteRecordBatch(const RecordBatch& batch, RjWriter* writer) {
   writer->Key("columns");
   writer->StartArray();
 
-  for (int i = 0; i < batch.num_columns(); ++i) {
+  // Each column is written to a string of its own in parallel, then the
+  // strings are spliced into the document in order
+  std::vector<rj::StringBuffer> column_json(batch.num_columns());
+  RETURN_NOT_OK(ParallelFor(batch.num_columns(), [&](int i) -> Status {
     const std::shared_ptr<Array>& column = batch.column(i);
 
     DCHECK_EQ(batch.num_rows(), column->length())
         << "Array length did not match record batch length";
 
-    RETURN_NOT_OK(WriteArray(batch.column_name(i), *column, writer));
+    RjWriter column_writer(column_json[i]);
+    return WriteArray(batch.column_name(i), *column, &column_writer);
+  }));
+  for (const rj::StringBuffer& json : column_json) {
+    writer->RawValue(json.GetString(), json.GetSize(), rj::kObjectType);
   }
 
   writer->EndArray();
@@ -18,6 +18,8 @@
 #include "arrow/ipc/json.h"
 
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <memory>
 #include <string>
 
@@ -102,8 +104,14 @@ class JsonReader::JsonReaderImpl {
       : pool_(pool), data_(data) {}
 
   Status ParseAndReadSchema() {
-    doc_.Parse(reinterpret_cast<const rj::Document::Ch*>(data_->data()),
-               static_cast<size_t>(data_->size()));
+    // Parsed in place, from a null-terminated copy of the data, so that the
+    // strings of the document, which hold most values of the format, are not
+    // allocated one by one
+    RETURN_NOT_OK(AllocateBuffer(pool_, data_->size() + 1, &parse_buffer_));
+    uint8_t* json = parse_buffer_->mutable_data();
+    std::memcpy(json, data_->data(), static_cast<size_t>(data_->size()));
+    json[data_->size()] = '\0';
+    doc_.ParseInsitu(reinterpret_cast<rj::Document::Ch*>(json));
     if (doc_.HasParseError()) {
       return Status::IOError("JSON parsing failed");
     }
@@ -134,6 +142,8 @@ class JsonReader::JsonReaderImpl {
  private:
   MemoryPool* pool_;
   std::shared_ptr<Buffer> data_;
+  // The strings of the document point into it
+  std::shared_ptr<Buffer> parse_buffer_;
   rj::Document doc_;
 
   const rj::Value* record_batches_;
@@ -19,6 +19,7 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <cstring>
 #include <memory>
 #include <sstream>
 #include <string>
@@ -29,8 +30,11 @@
 #include "arrow/ipc/Schema_generated.h"
 #include "arrow/ipc/metadata-internal.h"
 #include "arrow/ipc/util.h"
+#include "arrow/memory_pool.h"
 #include "arrow/status.h"
+#include "arrow/util/hash-util.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/tracing.h"
 
 namespace arrow {
 namespace ipc {
@@ -62,6 +66,8 @@ class Message::MessageImpl {
         return Message::RECORD_BATCH;
       case flatbuf::MessageHeader_Tensor:
         return Message::TENSOR;
+      case flatbuf::MessageHeader_SparseTensor:
+        return Message::SPARSE_TENSOR;
       default:
         return Message::NONE;
     }
@@ -73,6 +79,10 @@ class Message::MessageImpl {
 
   const void* header() const { return message_->header(); }
 
+  bool has_checksum() const {
+    return message_->checksum() == flatbuf::MessageChecksum_CRC32C;
+  }
+
   std::shared_ptr<Buffer> body() const { return body_; }
 
   std::shared_ptr<Buffer> metadata() const { return metadata_; }
@@ -109,6 +119,30 @@ MetadataVersion Message::metadata_version() const { return impl_->version(); }
 
 const void* Message::header() const { return impl_->header(); }
 
+bool Message::has_checksum() const { return impl_->has_checksum(); }
+
+Status Message::VerifyChecksums() const {
+  if (!has_checksum()) {
+    return Status::OK();
+  }
+  std::shared_ptr<Buffer> body = impl_->body();
+  if (body == nullptr || body->size() < internal::kChecksumSize) {
+    return Status::IOError("Body of " + FormatMessageType(type()) +
+                           " message too short to hold its checksums");
+  }
+  const int64_t data_size = body->size() - internal::kChecksumSize;
+  uint32_t expected[2];
+  std::memcpy(expected, body->data() + data_size, sizeof(expected));
+
+  const Buffer& metadata = *impl_->metadata();
+  if (HashUtil::Crc32c(body->data(), data_size, 0) != expected[0] ||
+      HashUtil::Crc32c(metadata.data(), metadata.size(), 0) != expected[1]) {
+    return Status::IOError("Checksum mismatch in " + FormatMessageType(type()) +
+                           " message");
+  }
+  return Status::OK();
+}
+
 bool Message::Equals(const Message& other) const {
   int64_t metadata_bytes = std::min(metadata()->size(), other.metadata()->size());
 
@@ -134,16 +168,20 @@ bool Message::Equals(const Message& other) const {
   }
 }
 
-Status Message::ReadFrom(const std::shared_ptr<Buffer>& metadata, io::InputStream* stream,
-                         std::unique_ptr<Message>* out) {
-  auto data = metadata->data();
-  flatbuffers::Verifier verifier(data, metadata->size(), 128);
+// Verify the Flatbuffer metadata of a message and get the length of its body
+static Status GetBodyLength(const Buffer& metadata, int64_t* body_length) {
+  flatbuffers::Verifier verifier(metadata.data(), metadata.size(), 128);
   if (!flatbuf::VerifyMessageBuffer(verifier)) {
     return Status::IOError("Invalid flatbuffers message.");
   }
-  auto fb_message = flatbuf::GetMessage(data);
+  *body_length = flatbuf::GetMessage(metadata.data())->bodyLength();
+  return Status::OK();
+}
 
-  int64_t body_length = fb_message->bodyLength();
+Status Message::ReadFrom(const std::shared_ptr<Buffer>& metadata, io::InputStream* stream,
+                         std::unique_ptr<Message>* out) {
+  int64_t body_length;
+  RETURN_NOT_OK(GetBodyLength(*metadata, &body_length));
 
   std::shared_ptr<Buffer> body;
   RETURN_NOT_OK(stream->Read(body_length, &body));
@@ -177,7 +215,7 @@ Status Message::ReadFrom(const int64_t offset, const std::shared_ptr<Buffer>& me
 
 Status Message::SerializeTo(io::OutputStream* file, int64_t* output_length) const {
   int32_t metadata_length = 0;
-  RETURN_NOT_OK(internal::WriteMessage(*metadata(), file, &metadata_length));
+  RETURN_NOT_OK(internal::WriteMessage(metadata(), file, &metadata_length));
 
   *output_length = metadata_length;
 
@@ -198,6 +236,10 @@ std::string FormatMessageType(Message::Type type) {
       return "record batch";
     case Message::DICTIONARY_BATCH:
       return "dictionary";
+    case Message::TENSOR:
+      return "tensor";
+    case Message::SPARSE_TENSOR:
+      return "sparse tensor";
     default:
       break;
   }
@@ -206,6 +248,7 @@ std::string FormatMessageType(Message::Type type) {
 
 Status ReadMessage(int64_t offset, int32_t metadata_length, io::RandomAccessFile* file,
                    std::unique_ptr<Message>* message) {
+  ARROW_TRACE_SPAN(span, "ipc", "ReadMessage");
   DCHECK_GT(static_cast<size_t>(metadata_length), sizeof(int32_t));
 
   std::shared_ptr<Buffer> buffer;
@@ -228,11 +271,15 @@ Status ReadMessage(int64_t offset, int32_t metadata_length, io::RandomAccessFile
   }
 
   auto metadata = SliceBuffer(buffer, 4, buffer->size() - 4);
-  return Message::ReadFrom(offset + metadata_length, metadata, file, message);
+  RETURN_NOT_OK(Message::ReadFrom(offset + metadata_length, metadata, file, message));
+  ARROW_TRACE_BYTES(span, metadata_length +
+                              ((*message)->body() ? (*message)->body()->size() : 0));
+  return Status::OK();
 }
 
 Status ReadMessage(io::InputStream* file, bool aligned,
                    std::unique_ptr<Message>* message) {
+  ARROW_TRACE_SPAN(span, "ipc", "ReadMessage");
   int32_t message_length = 0;
   int64_t bytes_read = 0;
   RETURN_NOT_OK(file->Read(sizeof(int32_t), &bytes_read,
@@ -268,7 +315,10 @@ Status ReadMessage(io::InputStream* file, bool aligned,
     RETURN_NOT_OK(file->Read(num_extra_bytes, &dummy_buffer));
   }
 
-  return Message::ReadFrom(metadata, file, message);
+  RETURN_NOT_OK(Message::ReadFrom(metadata, file, message));
+  ARROW_TRACE_BYTES(span, message_length +
+                              ((*message)->body() ? (*message)->body()->size() : 0));
+  return Status::OK();
 }
 
 Status ReadMessage(io::InputStream* file, std::unique_ptr<Message>* message) {
@@ -277,10 +327,33 @@ Status ReadMessage(io::InputStream* file, std::unique_ptr<Message>* message) {
 // ----------------------------------------------------------------------
 // Implement InputStream message reader
 
+// Read nbytes into scratch if nothing but it refers to its buffer any more,
+// and into a new buffer of scratch otherwise
+static Status ReadIntoScratch(io::InputStream* stream, int64_t nbytes,
+                              std::shared_ptr<ResizableBuffer>* scratch,
+                              std::shared_ptr<Buffer>* out) {
+  if (*scratch != nullptr && scratch->use_count() == 1) {
+    RETURN_NOT_OK((*scratch)->Resize(nbytes, false /* shrink_to_fit */));
+  } else {
+    RETURN_NOT_OK(AllocateResizableBuffer(default_memory_pool(), nbytes, scratch));
+  }
+  int64_t bytes_read = 0;
+  RETURN_NOT_OK(stream->Read(nbytes, &bytes_read, (*scratch)->mutable_data()));
+  if (bytes_read != nbytes) {
+    std::stringstream ss;
+    ss << "Expected to read " << nbytes << " message bytes, but only read "
+       << bytes_read;
+    return Status::IOError(ss.str());
+  }
+  *out = *scratch;
+  return Status::OK();
+}
+
 /// \brief Implementation of MessageReader that reads from InputStream
 class InputStreamMessageReader : public MessageReader {
  public:
-  explicit InputStreamMessageReader(io::InputStream* stream) : stream_(stream) {}
+  explicit InputStreamMessageReader(io::InputStream* stream, bool reuse_buffers = false)
+      : stream_(stream), reuse_buffers_(reuse_buffers) {}
 
   explicit InputStreamMessageReader(const std::shared_ptr<io::InputStream>& owned_stream)
       : InputStreamMessageReader(owned_stream.get()) {
@@ -290,18 +363,51 @@ class InputStreamMessageReader : public MessageReader {
   ~InputStreamMessageReader() {}
 
   Status ReadNextMessage(std::unique_ptr<Message>* message) {
-    return ReadMessage(stream_, message);
+    if (!reuse_buffers_) {
+      return ReadMessage(stream_, message);
+    }
+
+    int32_t message_length = 0;
+    int64_t bytes_read = 0;
+    RETURN_NOT_OK(stream_->Read(sizeof(int32_t), &bytes_read,
+                                reinterpret_cast<uint8_t*>(&message_length)));
+    if (bytes_read != sizeof(int32_t) || message_length == 0) {
+      // End of stream
+      *message = nullptr;
+      return Status::OK();
+    }
+
+    std::shared_ptr<Buffer> metadata;
+    RETURN_NOT_OK(
+        ReadIntoScratch(stream_, message_length, &metadata_scratch_, &metadata));
+    int64_t body_length;
+    RETURN_NOT_OK(GetBodyLength(*metadata, &body_length));
+    std::shared_ptr<Buffer> body;
+    RETURN_NOT_OK(ReadIntoScratch(stream_, body_length, &body_scratch_, &body));
+    return Message::Open(metadata, body, message);
   }
 
  private:
   io::InputStream* stream_;
   std::shared_ptr<io::InputStream> owned_stream_;
+
+  bool reuse_buffers_;
+  // The buffers of the last message, reused once it and the arrays read from
+  // it are gone
+  std::shared_ptr<ResizableBuffer> metadata_scratch_;
+  std::shared_ptr<ResizableBuffer> body_scratch_;
 };
 
 std::unique_ptr<MessageReader> MessageReader::Open(io::InputStream* stream) {
   return std::unique_ptr<MessageReader>(new InputStreamMessageReader(stream));
 }
 
+std::unique_ptr<MessageReader> MessageReader::Open(io::InputStream* stream,
+                                                   bool reuse_buffers) {
+  return std::unique_ptr<MessageReader>(
+      new InputStreamMessageReader(stream, reuse_buffers));
+}
+
 std::unique_ptr<MessageReader> MessageReader::Open(
     const std::shared_ptr<io::InputStream>& owned_stream) {
   return std::unique_ptr<MessageReader>(new InputStreamMessageReader(owned_stream));
@@ -69,7 +69,7 @@ constexpr int kMaxNestingDepth = 64;
 /// \brief An IPC message including metadata and body
 class ARROW_EXPORT Message {
  public:
-  enum Type { NONE, SCHEMA, DICTIONARY_BATCH, RECORD_BATCH, TENSOR };
+  enum Type { NONE, SCHEMA, DICTIONARY_BATCH, RECORD_BATCH, TENSOR, SPARSE_TENSOR };
 
   /// \brief Construct message, but do not validate
   ///
@@ -133,6 +133,17 @@ class ARROW_EXPORT Message {
 
   const void* header() const;
 
+  /// \brief Return true if the body of the message ends with the checksums
+  /// of the message
+  bool has_checksum() const;
+
+  /// \brief Check the checksums of the message against its body and
+  /// metadata
+  ///
+  /// \return Status, OK if the message has no checksums, IOError if they do
+  /// not match
+  Status VerifyChecksums() const;
+
   /// \brief Write length-prefixed metadata and body to output stream
   ///
   /// \param[in] file output stream to write to
@@ -159,6 +170,17 @@ class ARROW_EXPORT MessageReader {
   /// \brief Create MessageReader that reads from InputStream
   static std::unique_ptr<MessageReader> Open(io::InputStream* stream);
 
+  /// \brief Create MessageReader that reads from InputStream, optionally
+  /// into the buffers of the previous message
+  ///
+  /// With reuse_buffers, the metadata and body of a message are copied into
+  /// those of the previous message, if neither it nor anything sliced from it
+  /// is still alive, rather than into new allocations. This saves allocating
+  /// for streams of many small messages, but copies data streams supporting
+  /// zero-copy reads would not.
+  static std::unique_ptr<MessageReader> Open(io::InputStream* stream,
+                                             bool reuse_buffers);
+
   /// \brief Create MessageReader that reads from owned InputStream
   static std::unique_ptr<MessageReader> Open(
       const std::shared_ptr<io::InputStream>& owned_stream);
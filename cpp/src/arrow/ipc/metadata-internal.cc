@@ -23,6 +23,7 @@
 #include <sstream>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include <flatbuffers/flatbuffers.h>
 
@@ -31,10 +32,13 @@
 #include "arrow/io/interfaces.h"
 #include "arrow/ipc/File_generated.h"
 #include "arrow/ipc/Message_generated.h"
+#include "arrow/ipc/SparseTensor_generated.h"
 #include "arrow/ipc/Tensor_generated.h"
 #include "arrow/ipc/dictionary.h"
 #include "arrow/ipc/message.h"
+#include "arrow/ipc/reader.h"
 #include "arrow/ipc/util.h"
+#include "arrow/sparse_tensor.h"
 #include "arrow/status.h"
 #include "arrow/tensor.h"
 #include "arrow/type.h"
@@ -149,6 +153,33 @@ static Status ListToFlatbuffer(FBB& fbb, const DataType& type,
   return Status::OK();
 }
 
+static Status LargeListToFlatbuffer(FBB& fbb, const DataType& type,
+                                    std::vector<FieldOffset>* out_children,
+                                    DictionaryMemo* dictionary_memo, Offset* offset) {
+  RETURN_NOT_OK(AppendChildFields(fbb, type, out_children, dictionary_memo));
+  *offset = flatbuf::CreateLargeList(fbb).Union();
+  return Status::OK();
+}
+
+static Status FixedSizeListToFlatbuffer(FBB& fbb, const DataType& type,
+                                        std::vector<FieldOffset>* out_children,
+                                        DictionaryMemo* dictionary_memo,
+                                        Offset* offset) {
+  RETURN_NOT_OK(AppendChildFields(fbb, type, out_children, dictionary_memo));
+  const auto& list_type = checked_cast<const FixedSizeListType&>(type);
+  *offset = flatbuf::CreateFixedSizeList(fbb, list_type.list_size()).Union();
+  return Status::OK();
+}
+
+static Status RunLengthEncodedToFlatbuffer(FBB& fbb, const DataType& type,
+                                           std::vector<FieldOffset>* out_children,
+                                           DictionaryMemo* dictionary_memo,
+                                           Offset* offset) {
+  RETURN_NOT_OK(AppendChildFields(fbb, type, out_children, dictionary_memo));
+  *offset = flatbuf::CreateRunLengthEncoded(fbb).Union();
+  return Status::OK();
+}
+
 static Status StructToFlatbuffer(FBB& fbb, const DataType& type,
                                  std::vector<FieldOffset>* out_children,
                                  DictionaryMemo* dictionary_memo, Offset* offset) {
@@ -263,6 +294,9 @@ static Status TypeFromFlatbuffer(flatbuf::Type type, const void* type_data,
     case flatbuf::Type_Binary:
       *out = binary();
       return Status::OK();
+    case flatbuf::Type_LargeBinary:
+      *out = large_binary();
+      return Status::OK();
     case flatbuf::Type_FixedSizeBinary: {
       auto fw_binary = static_cast<const flatbuf::FixedSizeBinary*>(type_data);
       *out = fixed_size_binary(fw_binary->byteWidth());
@@ -271,6 +305,9 @@ static Status TypeFromFlatbuffer(flatbuf::Type type, const void* type_data,
     case flatbuf::Type_Utf8:
       *out = utf8();
       return Status::OK();
+    case flatbuf::Type_LargeUtf8:
+      *out = large_utf8();
+      return Status::OK();
     case flatbuf::Type_Bool:
       *out = boolean();
       return Status::OK();
@@ -327,6 +364,26 @@ static Status TypeFromFlatbuffer(flatbuf::Type type, const void* type_data,
       }
       *out = std::make_shared<ListType>(children[0]);
       return Status::OK();
+    case flatbuf::Type_LargeList:
+      if (children.size() != 1) {
+        return Status::Invalid("LargeList must have exactly 1 child field");
+      }
+      *out = std::make_shared<LargeListType>(children[0]);
+      return Status::OK();
+    case flatbuf::Type_FixedSizeList: {
+      if (children.size() != 1) {
+        return Status::Invalid("FixedSizeList must have exactly 1 child field");
+      }
+      auto list_type = static_cast<const flatbuf::FixedSizeList*>(type_data);
+      *out = std::make_shared<FixedSizeListType>(children[0], list_type->listSize());
+      return Status::OK();
+    }
+    case flatbuf::Type_RunLengthEncoded:
+      if (children.size() != 1) {
+        return Status::Invalid("RunLengthEncoded must have exactly 1 child field");
+      }
+      *out = std::make_shared<RunLengthEncodedType>(children[0]);
+      return Status::OK();
     case flatbuf::Type_Struct_:
       *out = std::make_shared<StructType>(children);
       return Status::OK();
@@ -398,10 +455,18 @@ static Status TypeToFlatbuffer(FBB& fbb, const DataType& type,
       *out_type = flatbuf::Type_Binary;
       *offset = flatbuf::CreateBinary(fbb).Union();
       break;
+    case Type::LARGE_BINARY:
+      *out_type = flatbuf::Type_LargeBinary;
+      *offset = flatbuf::CreateLargeBinary(fbb).Union();
+      break;
     case Type::STRING:
       *out_type = flatbuf::Type_Utf8;
       *offset = flatbuf::CreateUtf8(fbb).Union();
       break;
+    case Type::LARGE_STRING:
+      *out_type = flatbuf::Type_LargeUtf8;
+      *offset = flatbuf::CreateLargeUtf8(fbb).Union();
+      break;
     case Type::DATE32:
       *out_type = flatbuf::Type_Date;
       *offset = flatbuf::CreateDate(fbb, flatbuf::DateUnit_DAY).Union();
@@ -440,6 +505,17 @@ static Status TypeToFlatbuffer(FBB& fbb, const DataType& type,
     case Type::LIST:
       *out_type = flatbuf::Type_List;
       return ListToFlatbuffer(fbb, *value_type, children, dictionary_memo, offset);
+    case Type::LARGE_LIST:
+      *out_type = flatbuf::Type_LargeList;
+      return LargeListToFlatbuffer(fbb, *value_type, children, dictionary_memo, offset);
+    case Type::FIXED_SIZE_LIST:
+      *out_type = flatbuf::Type_FixedSizeList;
+      return FixedSizeListToFlatbuffer(fbb, *value_type, children, dictionary_memo,
+                                       offset);
+    case Type::RUN_LENGTH_ENCODED:
+      *out_type = flatbuf::Type_RunLengthEncoded;
+      return RunLengthEncodedToFlatbuffer(fbb, *value_type, children, dictionary_memo,
+                                          offset);
     case Type::STRUCT:
       *out_type = flatbuf::Type_Struct_;
       return StructToFlatbuffer(fbb, *value_type, children, dictionary_memo, offset);
@@ -696,19 +772,21 @@ static Status WriteFlatbufferBuilder(FBB& fbb, std::shared_ptr<Buffer>* out) {
 
 static Status WriteFBMessage(FBB& fbb, flatbuf::MessageHeader header_type,
                              flatbuffers::Offset<void> header, int64_t body_length,
-                             std::shared_ptr<Buffer>* out) {
-  auto message = flatbuf::CreateMessage(fbb, kCurrentMetadataVersion, header_type, header,
-                                        body_length);
+                             std::shared_ptr<Buffer>* out, bool checksum = false) {
+  auto message = flatbuf::CreateMessage(
+      fbb, kCurrentMetadataVersion, header_type, header, body_length,
+      checksum ? flatbuf::MessageChecksum_CRC32C : flatbuf::MessageChecksum_NONE);
   fbb.Finish(message);
   return WriteFlatbufferBuilder(fbb, out);
 }
 
 Status WriteSchemaMessage(const Schema& schema, DictionaryMemo* dictionary_memo,
-                          std::shared_ptr<Buffer>* out) {
+                          std::shared_ptr<Buffer>* out, bool checksum) {
   FBB fbb;
   flatbuffers::Offset<flatbuf::Schema> fb_schema;
   RETURN_NOT_OK(SchemaToFlatbuffer(fbb, schema, dictionary_memo, &fb_schema));
-  return WriteFBMessage(fbb, flatbuf::MessageHeader_Schema, fb_schema.Union(), 0, out);
+  return WriteFBMessage(fbb, flatbuf::MessageHeader_Schema, fb_schema.Union(),
+                        checksum ? kChecksumSize : 0, out, checksum);
 }
 
 using FieldNodeVector =
@@ -744,9 +822,81 @@ static Status WriteBuffers(FBB& fbb, const std::vector<BufferMetadata>& buffers,
   return Status::OK();
 }
 
+static Status CompressionToFlatbuffer(Compression::type compression,
+                                      flatbuf::CompressionType* out) {
+  switch (compression) {
+    case Compression::SNAPPY:
+      *out = flatbuf::CompressionType_SNAPPY;
+      break;
+    case Compression::GZIP:
+      *out = flatbuf::CompressionType_GZIP;
+      break;
+    case Compression::BROTLI:
+      *out = flatbuf::CompressionType_BROTLI;
+      break;
+    case Compression::ZSTD:
+      *out = flatbuf::CompressionType_ZSTD;
+      break;
+    case Compression::LZ4:
+      *out = flatbuf::CompressionType_LZ4;
+      break;
+    default:
+      return Status::Invalid("Unsupported codec for IPC body compression");
+  }
+  return Status::OK();
+}
+
+StatisticsRange::type GetStatisticsRange(Type::type id) {
+  switch (id) {
+    case Type::INT8:
+    case Type::UINT8:
+    case Type::INT16:
+    case Type::UINT16:
+    case Type::INT32:
+    case Type::UINT32:
+    case Type::INT64:
+    case Type::DATE32:
+    case Type::DATE64:
+    case Type::TIME32:
+    case Type::TIME64:
+    case Type::TIMESTAMP:
+      return StatisticsRange::INTEGER;
+    case Type::FLOAT:
+    case Type::DOUBLE:
+      return StatisticsRange::FLOATING;
+    default:
+      return StatisticsRange::NONE;
+  }
+}
+
+Status GetCompression(flatbuf::CompressionType compression, Compression::type* out) {
+  switch (compression) {
+    case flatbuf::CompressionType_SNAPPY:
+      *out = Compression::SNAPPY;
+      break;
+    case flatbuf::CompressionType_GZIP:
+      *out = Compression::GZIP;
+      break;
+    case flatbuf::CompressionType_BROTLI:
+      *out = Compression::BROTLI;
+      break;
+    case flatbuf::CompressionType_ZSTD:
+      *out = Compression::ZSTD;
+      break;
+    case flatbuf::CompressionType_LZ4:
+      *out = Compression::LZ4;
+      break;
+    default:
+      return Status::IOError("Unrecognized codec in IPC body compression metadata");
+  }
+  return Status::OK();
+}
+
 static Status MakeRecordBatch(FBB& fbb, int64_t length, int64_t body_length,
                               const std::vector<FieldMetadata>& nodes,
                               const std::vector<BufferMetadata>& buffers,
+                              Compression::type compression,
+                              const std::vector<int64_t>& uncompressed_lengths,
                               RecordBatchOffset* offset) {
   FieldNodeVector fb_nodes;
   BufferVector fb_buffers;
@@ -754,19 +904,49 @@ static Status MakeRecordBatch(FBB& fbb, int64_t length, int64_t body_length,
   RETURN_NOT_OK(WriteFieldNodes(fbb, nodes, &fb_nodes));
   RETURN_NOT_OK(WriteBuffers(fbb, buffers, &fb_buffers));
 
-  *offset = flatbuf::CreateRecordBatch(fbb, length, fb_nodes, fb_buffers);
+  flatbuffers::Offset<flatbuf::BodyCompression> fb_compression = 0;
+  if (compression != Compression::UNCOMPRESSED) {
+    DCHECK_EQ(buffers.size(), uncompressed_lengths.size());
+    flatbuf::CompressionType fb_codec;
+    RETURN_NOT_OK(CompressionToFlatbuffer(compression, &fb_codec));
+    fb_compression = flatbuf::CreateBodyCompression(
+        fbb, fb_codec, fbb.CreateVector(uncompressed_lengths),
+        flatbuf::BodyCompressionMethod_BLOCK);
+  }
+
+  *offset =
+      flatbuf::CreateRecordBatch(fbb, length, fb_nodes, fb_buffers, fb_compression);
   return Status::OK();
 }
 
+static Status MakeRecordBatch(FBB& fbb, int64_t length, int64_t body_length,
+                              const std::vector<FieldMetadata>& nodes,
+                              const std::vector<BufferMetadata>& buffers,
+                              RecordBatchOffset* offset) {
+  return MakeRecordBatch(fbb, length, body_length, nodes, buffers,
+                         Compression::UNCOMPRESSED, {}, offset);
+}
+
 Status WriteRecordBatchMessage(int64_t length, int64_t body_length,
                                const std::vector<FieldMetadata>& nodes,
                                const std::vector<BufferMetadata>& buffers,
                                std::shared_ptr<Buffer>* out) {
+  return WriteRecordBatchMessage(length, body_length, nodes, buffers,
+                                 Compression::UNCOMPRESSED, {}, out);
+}
+
+Status WriteRecordBatchMessage(int64_t length, int64_t body_length,
+                               const std::vector<FieldMetadata>& nodes,
+                               const std::vector<BufferMetadata>& buffers,
+                               Compression::type compression,
+                               const std::vector<int64_t>& uncompressed_lengths,
+                               std::shared_ptr<Buffer>* out, bool checksum) {
   FBB fbb;
   RecordBatchOffset record_batch;
-  RETURN_NOT_OK(MakeRecordBatch(fbb, length, body_length, nodes, buffers, &record_batch));
+  RETURN_NOT_OK(MakeRecordBatch(fbb, length, body_length, nodes, buffers, compression,
+                                uncompressed_lengths, &record_batch));
   return WriteFBMessage(fbb, flatbuf::MessageHeader_RecordBatch, record_batch.Union(),
-                        body_length, out);
+                        body_length, out, checksum);
 }
 
 Status WriteTensorMessage(const Tensor& tensor, int64_t buffer_start_offset,
@@ -798,16 +978,70 @@ Status WriteTensorMessage(const Tensor& tensor, int64_t buffer_start_offset,
                         body_length, out);
 }
 
-Status WriteDictionaryMessage(int64_t id, int64_t length, int64_t body_length,
+Status WriteSparseTensorMessage(const SparseTensor& sparse_tensor, int64_t body_length,
+                                const std::vector<BufferMetadata>& buffers,
+                                std::shared_ptr<Buffer>* out) {
+  using TensorDimOffset = flatbuffers::Offset<flatbuf::TensorDim>;
+  using SparseTensorOffset = flatbuffers::Offset<flatbuf::SparseTensor>;
+
+  FBB fbb;
+
+  flatbuf::Type fb_type_type;
+  Offset fb_type;
+  RETURN_NOT_OK(
+      TensorTypeToFlatbuffer(fbb, *sparse_tensor.type(), &fb_type_type, &fb_type));
+
+  std::vector<TensorDimOffset> dims;
+  for (int i = 0; i < sparse_tensor.ndim(); ++i) {
+    FBString name = fbb.CreateString(sparse_tensor.dim_name(i));
+    dims.push_back(flatbuf::CreateTensorDim(fbb, sparse_tensor.shape()[i], name));
+  }
+  auto fb_shape = fbb.CreateVector(dims);
+
+  std::vector<flatbuf::Buffer> fb_buffers;
+  for (const auto& buffer : buffers) {
+    fb_buffers.emplace_back(buffer.offset, buffer.length);
+  }
+
+  flatbuf::SparseTensorIndex fb_index_type;
+  Offset fb_index;
+  switch (sparse_tensor.format_id()) {
+    case SparseTensorFormat::COO:
+      DCHECK_EQ(buffers.size(), 2);
+      fb_index_type = flatbuf::SparseTensorIndex_SparseTensorIndexCOO;
+      fb_index = flatbuf::CreateSparseTensorIndexCOO(fbb, &fb_buffers[0]).Union();
+      break;
+    case SparseTensorFormat::CSR:
+      DCHECK_EQ(buffers.size(), 3);
+      fb_index_type = flatbuf::SparseTensorIndex_SparseMatrixIndexCSR;
+      fb_index =
+          flatbuf::CreateSparseMatrixIndexCSR(fbb, &fb_buffers[0], &fb_buffers[1])
+              .Union();
+      break;
+    default:
+      return Status::NotImplemented("Unsupported sparse tensor format");
+  }
+
+  SparseTensorOffset fb_sparse_tensor = flatbuf::CreateSparseTensor(
+      fbb, fb_type_type, fb_type, fb_shape, sparse_tensor.non_zero_length(),
+      fb_index_type, fb_index, &fb_buffers.back());
+
+  return WriteFBMessage(fbb, flatbuf::MessageHeader_SparseTensor,
+                        fb_sparse_tensor.Union(), body_length, out);
+}
+
+Status WriteDictionaryMessage(int64_t id, bool is_delta, int64_t length,
+                              int64_t body_length,
                               const std::vector<FieldMetadata>& nodes,
                               const std::vector<BufferMetadata>& buffers,
-                              std::shared_ptr<Buffer>* out) {
+                              std::shared_ptr<Buffer>* out, bool checksum) {
   FBB fbb;
   RecordBatchOffset record_batch;
   RETURN_NOT_OK(MakeRecordBatch(fbb, length, body_length, nodes, buffers, &record_batch));
-  auto dictionary_batch = flatbuf::CreateDictionaryBatch(fbb, id, record_batch).Union();
+  auto dictionary_batch =
+      flatbuf::CreateDictionaryBatch(fbb, id, record_batch, is_delta).Union();
   return WriteFBMessage(fbb, flatbuf::MessageHeader_DictionaryBatch, dictionary_batch,
-                        body_length, out);
+                        body_length, out, checksum);
 }
 
 static flatbuffers::Offset<flatbuffers::Vector<const flatbuf::Block*>>
@@ -821,8 +1055,31 @@ FileBlocksToFlatbuffer(FBB& fbb, const std::vector<FileBlock>& blocks) {
   return fbb.CreateVectorOfStructs(fb_blocks);
 }
 
+using BatchStatisticsOffset = flatbuffers::Offset<flatbuf::BatchStatistics>;
+using BatchStatisticsVector =
+    flatbuffers::Offset<flatbuffers::Vector<BatchStatisticsOffset>>;
+
+static BatchStatisticsVector BatchStatisticsToFlatbuffer(
+    FBB& fbb, const std::vector<std::vector<ColumnStatistics>>& statistics) {
+  std::vector<BatchStatisticsOffset> fb_batches;
+  fb_batches.reserve(statistics.size());
+  for (const auto& batch : statistics) {
+    std::vector<flatbuffers::Offset<flatbuf::ColumnStatistics>> fb_columns;
+    fb_columns.reserve(batch.size());
+    for (const ColumnStatistics& column : batch) {
+      fb_columns.push_back(flatbuf::CreateColumnStatistics(
+          fbb, column.null_count, column.has_range, column.int_min, column.int_max,
+          column.float_min, column.float_max));
+    }
+    fb_batches.push_back(
+        flatbuf::CreateBatchStatistics(fbb, fbb.CreateVector(fb_columns)));
+  }
+  return fbb.CreateVector(fb_batches);
+}
+
 Status WriteFileFooter(const Schema& schema, const std::vector<FileBlock>& dictionaries,
                        const std::vector<FileBlock>& record_batches,
+                       const std::vector<std::vector<ColumnStatistics>>& statistics,
                        DictionaryMemo* dictionary_memo, io::OutputStream* out) {
   FBB fbb;
 
@@ -846,8 +1103,14 @@ Status WriteFileFooter(const Schema& schema, const std::vector<FileBlock>& dicti
   auto fb_dictionaries = FileBlocksToFlatbuffer(fbb, dictionaries);
   auto fb_record_batches = FileBlocksToFlatbuffer(fbb, record_batches);
 
+  BatchStatisticsVector fb_statistics = 0;
+  if (!statistics.empty()) {
+    DCHECK_EQ(statistics.size(), record_batches.size());
+    fb_statistics = BatchStatisticsToFlatbuffer(fbb, statistics);
+  }
+
   auto footer = flatbuf::CreateFooter(fbb, kCurrentMetadataVersion, fb_schema,
-                                      fb_dictionaries, fb_record_batches);
+                                      fb_dictionaries, fb_record_batches, fb_statistics);
 
   fbb.Finish(footer);
 
@@ -950,17 +1213,63 @@ Status GetTensorMetadata(const Buffer& metadata, std::shared_ptr<DataType>* type
   return TypeFromFlatbuffer(tensor->type_type(), tensor->type(), {}, type);
 }
 
+Status GetSparseTensorMetadata(const Buffer& metadata, std::shared_ptr<DataType>* type,
+                               std::vector<int64_t>* shape,
+                               std::vector<std::string>* dim_names,
+                               int64_t* non_zero_length,
+                               SparseTensorFormat::type* format_id,
+                               std::vector<BufferMetadata>* buffers) {
+  auto message = flatbuf::GetMessage(metadata.data());
+  if (message->header_type() != flatbuf::MessageHeader_SparseTensor) {
+    return Status::IOError("Message is not a sparse tensor");
+  }
+  auto sparse_tensor = reinterpret_cast<const flatbuf::SparseTensor*>(message->header());
+
+  for (const auto dim : *sparse_tensor->shape()) {
+    shape->push_back(dim->size());
+    auto fb_name = dim->name();
+    dim_names->push_back(fb_name == nullptr ? "" : fb_name->str());
+  }
+  *non_zero_length = sparse_tensor->non_zero_length();
+
+  auto add_buffer = [buffers](const flatbuf::Buffer* buffer) {
+    if (buffer == nullptr) {
+      return Status::IOError("Buffer of sparse tensor was null");
+    }
+    buffers->push_back({buffer->offset(), buffer->length()});
+    return Status::OK();
+  };
+  switch (sparse_tensor->sparseIndex_type()) {
+    case flatbuf::SparseTensorIndex_SparseTensorIndexCOO: {
+      *format_id = SparseTensorFormat::COO;
+      auto index = sparse_tensor->sparseIndex_as_SparseTensorIndexCOO();
+      RETURN_NOT_OK(add_buffer(index->indicesBuffer()));
+      break;
+    }
+    case flatbuf::SparseTensorIndex_SparseMatrixIndexCSR: {
+      *format_id = SparseTensorFormat::CSR;
+      auto index = sparse_tensor->sparseIndex_as_SparseMatrixIndexCSR();
+      RETURN_NOT_OK(add_buffer(index->indptrBuffer()));
+      RETURN_NOT_OK(add_buffer(index->indicesBuffer()));
+      break;
+    }
+    default:
+      return Status::IOError("Unrecognized sparse tensor index");
+  }
+  RETURN_NOT_OK(add_buffer(sparse_tensor->data()));
+
+  return TypeFromFlatbuffer(sparse_tensor->type_type(), sparse_tensor->type(), {}, type);
+}
+
 // ----------------------------------------------------------------------
 // Implement message writing
 
-Status WriteMessage(const Buffer& message, io::OutputStream* file,
-                    int32_t* message_length) {
+Status GetMessageBuffers(const std::shared_ptr<Buffer>& message, int64_t start_offset,
+                         std::vector<std::shared_ptr<Buffer>>* out,
+                         int32_t* message_length) {
   // Need to write 4 bytes (message size), the message, plus padding to
   // end on an 8-byte offset
-  int64_t start_offset;
-  RETURN_NOT_OK(file->Tell(&start_offset));
-
-  int32_t padded_message_length = static_cast<int32_t>(message.size()) + 4;
+  int32_t padded_message_length = static_cast<int32_t>(message->size()) + 4;
   const int32_t remainder =
       (padded_message_length + static_cast<int32_t>(start_offset)) % 8;
   if (remainder != 0) {
@@ -971,22 +1280,35 @@ Status WriteMessage(const Buffer& message, io::OutputStream* file,
   // plus padding
   *message_length = padded_message_length;
 
-  // Write the flatbuffer size prefix including padding
-  int32_t flatbuffer_size = padded_message_length - 4;
-  RETURN_NOT_OK(file->Write(&flatbuffer_size, sizeof(int32_t)));
+  // The flatbuffer size prefix including padding
+  const int32_t flatbuffer_size = padded_message_length - 4;
+  std::shared_ptr<Buffer> prefix;
+  RETURN_NOT_OK(Buffer::FromString(
+      std::string(reinterpret_cast<const char*>(&flatbuffer_size), sizeof(int32_t)),
+      &prefix));
+  out->push_back(std::move(prefix));
 
-  // Write the flatbuffer
-  RETURN_NOT_OK(file->Write(message.data(), message.size()));
+  // The flatbuffer
+  out->push_back(message);
 
-  // Write any padding
-  int32_t padding = padded_message_length - static_cast<int32_t>(message.size()) - 4;
+  // Any padding
+  int32_t padding = padded_message_length - static_cast<int32_t>(message->size()) - 4;
   if (padding > 0) {
-    RETURN_NOT_OK(file->Write(kPaddingBytes, padding));
+    out->push_back(std::make_shared<Buffer>(kPaddingBytes, padding));
   }
-
   return Status::OK();
 }
 
+Status WriteMessage(const std::shared_ptr<Buffer>& message, io::OutputStream* file,
+                    int32_t* message_length) {
+  int64_t start_offset;
+  RETURN_NOT_OK(file->Tell(&start_offset));
+
+  std::vector<std::shared_ptr<Buffer>> buffers;
+  RETURN_NOT_OK(GetMessageBuffers(message, start_offset, &buffers, message_length));
+  return file->Writev(buffers);
+}
+
 }  // namespace internal
 }  // namespace ipc
 }  // namespace arrow
@@ -25,15 +25,20 @@
 #include <string>
 #include <vector>
 
+#include "arrow/ipc/Message_generated.h"
 #include "arrow/ipc/Schema_generated.h"
 #include "arrow/ipc/dictionary.h"
 #include "arrow/ipc/message.h"
+#include "arrow/sparse_tensor.h"
+#include "arrow/type.h"
+#include "arrow/util/compression.h"
 
 namespace arrow {
 
 class Buffer;
 class DataType;
 class Schema;
+class SparseTensor;
 class Status;
 class Tensor;
 
@@ -46,16 +51,33 @@ class OutputStream;
 }  // namespace io
 
 namespace ipc {
+
+struct ColumnStatistics;
+
 namespace internal {
 
 static constexpr flatbuf::MetadataVersion kCurrentMetadataVersion =
     flatbuf::MetadataVersion_V4;
 
+// The size of the checksums ending the body of a message written with them:
+// the CRC32C of the body before them, then that of the metadata
+static constexpr int64_t kChecksumSize = 8;
+
 static constexpr flatbuf::MetadataVersion kMinMetadataVersion =
     flatbuf::MetadataVersion_V4;
 
 MetadataVersion GetMetadataVersion(flatbuf::MetadataVersion version);
 
+/// \brief The codec of the body compression of a record batch
+Status GetCompression(flatbuf::CompressionType compression, Compression::type* out);
+
+/// \brief The values of a type ColumnStatistics keep the range of
+struct StatisticsRange {
+  enum type { NONE, INTEGER, FLOATING };
+};
+
+StatisticsRange::type GetStatisticsRange(Type::type id);
+
 static constexpr const char* kArrowMagicBytes = "ARROW1";
 
 struct FieldMetadata {
@@ -96,11 +118,28 @@ Status GetTensorMetadata(const Buffer& metadata, std::shared_ptr<DataType>* type
                          std::vector<int64_t>* shape, std::vector<int64_t>* strides,
                          std::vector<std::string>* dim_names);
 
+/// Read the metadata of a sparse tensor, with the locations in the body of its
+/// index buffers followed by that of its values
+Status GetSparseTensorMetadata(const Buffer& metadata, std::shared_ptr<DataType>* type,
+                               std::vector<int64_t>* shape,
+                               std::vector<std::string>* dim_names,
+                               int64_t* non_zero_length,
+                               SparseTensorFormat::type* format_id,
+                               std::vector<BufferMetadata>* buffers);
+
+/// Append the buffers of a serialized message metadata written at
+/// start_offset, as WriteMessage writes them, to out
+///
+/// The message itself is appended, not copied.
+Status GetMessageBuffers(const std::shared_ptr<Buffer>& message, int64_t start_offset,
+                         std::vector<std::shared_ptr<Buffer>>* out,
+                         int32_t* message_length);
+
 /// Write a serialized message metadata with a length-prefix and padding to an
 /// 8-byte offset
 ///
 /// <message_size: int32><message: const void*><padding>
-Status WriteMessage(const Buffer& message, io::OutputStream* file,
+Status WriteMessage(const std::shared_ptr<Buffer>& message, io::OutputStream* file,
                     int32_t* message_length);
 
 // Serialize arrow::Schema as a Flatbuffer
@@ -109,27 +148,48 @@ Status WriteMessage(const Buffer& message, io::OutputStream* file,
 // \param[inout] dictionary_memo class for tracking dictionaries and assigning
 // dictionary ids
 // \param[out] out the serialized arrow::Buffer
+// \param[in] checksum whether the message has a body of its checksums
 // \return Status outcome
 Status WriteSchemaMessage(const Schema& schema, DictionaryMemo* dictionary_memo,
-                          std::shared_ptr<Buffer>* out);
+                          std::shared_ptr<Buffer>* out, bool checksum = false);
 
 Status WriteRecordBatchMessage(const int64_t length, const int64_t body_length,
                                const std::vector<FieldMetadata>& nodes,
                                const std::vector<BufferMetadata>& buffers,
                                std::shared_ptr<Buffer>* out);
 
+/// \brief As above, for a body whose buffers are compressed with the given
+/// codec by CompressBlocks, uncompressed_lengths holding their decompressed
+/// lengths, or -1 for those stored uncompressed. With checksum, the body ends
+/// with the kChecksumSize bytes of the checksums of the message
+Status WriteRecordBatchMessage(const int64_t length, const int64_t body_length,
+                               const std::vector<FieldMetadata>& nodes,
+                               const std::vector<BufferMetadata>& buffers,
+                               Compression::type compression,
+                               const std::vector<int64_t>& uncompressed_lengths,
+                               std::shared_ptr<Buffer>* out, bool checksum = false);
+
 Status WriteTensorMessage(const Tensor& tensor, const int64_t buffer_start_offset,
                           std::shared_ptr<Buffer>* out);
 
+/// Write the metadata of a sparse tensor whose index buffers and values are at
+/// the given locations of the body, in the order of GetSparseTensorMetadata
+Status WriteSparseTensorMessage(const SparseTensor& sparse_tensor, int64_t body_length,
+                                const std::vector<BufferMetadata>& buffers,
+                                std::shared_ptr<Buffer>* out);
+
+/// \brief Write the footer of a file, with the statistics of its record
+/// batches unless statistics is empty
 Status WriteFileFooter(const Schema& schema, const std::vector<FileBlock>& dictionaries,
                        const std::vector<FileBlock>& record_batches,
+                       const std::vector<std::vector<ColumnStatistics>>& statistics,
                        DictionaryMemo* dictionary_memo, io::OutputStream* out);
 
-Status WriteDictionaryMessage(const int64_t id, const int64_t length,
+Status WriteDictionaryMessage(const int64_t id, const bool is_delta, const int64_t length,
                               const int64_t body_length,
                               const std::vector<FieldMetadata>& nodes,
                               const std::vector<BufferMetadata>& buffers,
-                              std::shared_ptr<Buffer>* out);
+                              std::shared_ptr<Buffer>* out, bool checksum = false);
 
 }  // namespace internal
 }  // namespace ipc
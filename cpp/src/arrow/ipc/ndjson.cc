@@ -0,0 +1,752 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/ipc/ndjson.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "arrow/ipc/json-internal.h"
+
+#include "rapidjson/error/en.h"
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/builder.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
+#include "arrow/status.h"
+#include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread-pool.h"
+
+namespace arrow {
+namespace ipc {
+
+namespace {
+
+// ----------------------------------------------------------------------
+// Lines
+
+bool IsBlank(const char* line, int64_t length) {
+  for (int64_t i = 0; i < length; ++i) {
+    if (line[i] != ' ' && line[i] != '\t' && line[i] != '\r') {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Calls visit(line, length) with each line of data that is not blank, until
+// it returns false
+template <typename Visitor>
+Status VisitLines(const Buffer& data, Visitor&& visit) {
+  const char* begin = reinterpret_cast<const char*>(data.data());
+  const char* end = begin + data.size();
+  while (begin < end) {
+    const auto length = static_cast<size_t>(end - begin);
+    const char* newline = static_cast<const char*>(std::memchr(begin, '\n', length));
+    const char* line_end = newline == nullptr ? end : newline;
+    if (!IsBlank(begin, line_end - begin)) {
+      bool more = true;
+      RETURN_NOT_OK(visit(begin, line_end - begin, &more));
+      if (!more) {
+        break;
+      }
+    }
+    begin = line_end + 1;
+  }
+  return Status::OK();
+}
+
+// Parse a line into the document, reusing the memory of the lines before
+Status ParseLine(const char* line, int64_t length, rj::Document* doc) {
+  doc->SetNull();
+  doc->GetAllocator().Clear();
+  doc->Parse(line, static_cast<size_t>(length));
+  if (doc->HasParseError()) {
+    std::stringstream ss;
+    ss << "Malformed JSON line, at offset " << doc->GetErrorOffset() << ": "
+       << rj::GetParseError_En(doc->GetParseError());
+    return Status::Invalid(ss.str());
+  }
+  if (!doc->IsObject()) {
+    return Status::Invalid("JSON line is not an object");
+  }
+  return Status::OK();
+}
+
+const char* GetKindName(const rj::Value& value) {
+  switch (value.GetType()) {
+    case rj::kNullType:
+      return "null";
+    case rj::kFalseType:
+    case rj::kTrueType:
+      return "boolean";
+    case rj::kObjectType:
+      return "object";
+    case rj::kArrayType:
+      return "array";
+    case rj::kStringType:
+      return "string";
+    case rj::kNumberType:
+      return "number";
+  }
+  return "unknown";
+}
+
+Status TypeMismatch(const DataType& type, const rj::Value& value) {
+  std::stringstream ss;
+  ss << "JSON " << GetKindName(value) << " cannot be read as " << type.ToString();
+  return Status::Invalid(ss.str());
+}
+
+// ----------------------------------------------------------------------
+// Schema inference
+
+Status InferType(const rj::Value& value, std::shared_ptr<DataType>* out);
+
+Status MergeTypes(const std::shared_ptr<DataType>& left,
+                  const std::shared_ptr<DataType>& right,
+                  std::shared_ptr<DataType>* out);
+
+// Merge a field into the fields of the same object seen so far, new names
+// being appended
+Status MergeField(const std::shared_ptr<Field>& field,
+                  std::vector<std::shared_ptr<Field>>* fields) {
+  for (auto& existing : *fields) {
+    if (existing->name() == field->name()) {
+      std::shared_ptr<DataType> type;
+      RETURN_NOT_OK(MergeTypes(existing->type(), field->type(), &type));
+      existing = ::arrow::field(field->name(), type);
+      return Status::OK();
+    }
+  }
+  fields->push_back(field);
+  return Status::OK();
+}
+
+Status MergeObject(const rj::Value& object, std::vector<std::shared_ptr<Field>>* fields) {
+  for (auto it = object.MemberBegin(); it != object.MemberEnd(); ++it) {
+    std::shared_ptr<DataType> type;
+    RETURN_NOT_OK(InferType(it->value, &type));
+    std::string name(it->name.GetString(), it->name.GetStringLength());
+    RETURN_NOT_OK(MergeField(::arrow::field(name, type), fields));
+  }
+  return Status::OK();
+}
+
+Status InferType(const rj::Value& value, std::shared_ptr<DataType>* out) {
+  switch (value.GetType()) {
+    case rj::kNullType:
+      *out = null();
+      break;
+    case rj::kFalseType:
+    case rj::kTrueType:
+      *out = boolean();
+      break;
+    case rj::kNumberType:
+      *out = value.IsInt64() ? int64() : float64();
+      break;
+    case rj::kStringType:
+      *out = utf8();
+      break;
+    case rj::kArrayType: {
+      std::shared_ptr<DataType> value_type = null();
+      for (const auto& element : value.GetArray()) {
+        std::shared_ptr<DataType> element_type;
+        RETURN_NOT_OK(InferType(element, &element_type));
+        RETURN_NOT_OK(MergeTypes(value_type, element_type, &value_type));
+      }
+      *out = list(value_type);
+      break;
+    }
+    case rj::kObjectType: {
+      std::vector<std::shared_ptr<Field>> fields;
+      RETURN_NOT_OK(MergeObject(value, &fields));
+      *out = struct_(fields);
+      break;
+    }
+  }
+  return Status::OK();
+}
+
+Status MergeTypes(const std::shared_ptr<DataType>& left,
+                  const std::shared_ptr<DataType>& right,
+                  std::shared_ptr<DataType>* out) {
+  if (left->id() == Type::NA) {
+    *out = right;
+    return Status::OK();
+  }
+  if (right->id() == Type::NA || left->Equals(*right)) {
+    *out = left;
+    return Status::OK();
+  }
+  if (left->id() == right->id()) {
+    if (left->id() == Type::LIST) {
+      std::shared_ptr<DataType> value_type;
+      RETURN_NOT_OK(MergeTypes(checked_cast<const ListType&>(*left).value_type(),
+                               checked_cast<const ListType&>(*right).value_type(),
+                               &value_type));
+      *out = list(value_type);
+      return Status::OK();
+    }
+    if (left->id() == Type::STRUCT) {
+      std::vector<std::shared_ptr<Field>> fields = left->children();
+      for (const auto& field : right->children()) {
+        RETURN_NOT_OK(MergeField(field, &fields));
+      }
+      *out = struct_(fields);
+      return Status::OK();
+    }
+  }
+  if ((left->id() == Type::INT64 && right->id() == Type::DOUBLE) ||
+      (left->id() == Type::DOUBLE && right->id() == Type::INT64)) {
+    *out = float64();
+    return Status::OK();
+  }
+  std::stringstream ss;
+  ss << "JSON values of both types " << left->ToString() << " and " << right->ToString();
+  return Status::Invalid(ss.str());
+}
+
+// ----------------------------------------------------------------------
+// Conversion of JSON values into builders
+
+class Converter {
+ public:
+  virtual ~Converter() = default;
+
+  // Append a JSON value, null or of the kind of the type
+  Status Append(const rj::Value& value) {
+    return value.IsNull() ? AppendNull() : AppendValue(value);
+  }
+
+  virtual Status AppendNull() = 0;
+
+ protected:
+  virtual Status AppendValue(const rj::Value& value) = 0;
+};
+
+Status MakeConverter(const std::shared_ptr<DataType>& type, ArrayBuilder* builder,
+                     std::unique_ptr<Converter>* out);
+
+template <typename BuilderType>
+class TypedConverter : public Converter {
+ public:
+  TypedConverter(const std::shared_ptr<DataType>& type, ArrayBuilder* builder)
+      : type_(type), builder_(checked_cast<BuilderType*>(builder)) {}
+
+  Status AppendNull() override { return builder_->AppendNull(); }
+
+ protected:
+  std::shared_ptr<DataType> type_;
+  BuilderType* builder_;
+};
+
+class NullConverter : public TypedConverter<NullBuilder> {
+ public:
+  using TypedConverter::TypedConverter;
+
+ protected:
+  Status AppendValue(const rj::Value& value) override {
+    return TypeMismatch(*type_, value);
+  }
+};
+
+class BooleanConverter : public TypedConverter<BooleanBuilder> {
+ public:
+  using TypedConverter::TypedConverter;
+
+ protected:
+  Status AppendValue(const rj::Value& value) override {
+    if (!value.IsBool()) {
+      return TypeMismatch(*type_, value);
+    }
+    return builder_->Append(value.GetBool());
+  }
+};
+
+template <typename c_type>
+typename std::enable_if<std::is_signed<c_type>::value, bool>::type GetInteger(
+    const rj::Value& value, c_type* out) {
+  if (!value.IsInt64()) {
+    return false;
+  }
+  const int64_t integer = value.GetInt64();
+  if (integer < std::numeric_limits<c_type>::min() ||
+      integer > std::numeric_limits<c_type>::max()) {
+    return false;
+  }
+  *out = static_cast<c_type>(integer);
+  return true;
+}
+
+template <typename c_type>
+typename std::enable_if<std::is_unsigned<c_type>::value, bool>::type GetInteger(
+    const rj::Value& value, c_type* out) {
+  if (!value.IsUint64()) {
+    return false;
+  }
+  const uint64_t integer = value.GetUint64();
+  if (integer > std::numeric_limits<c_type>::max()) {
+    return false;
+  }
+  *out = static_cast<c_type>(integer);
+  return true;
+}
+
+template <typename T>
+class IntegerConverter : public TypedConverter<NumericBuilder<T>> {
+ public:
+  using TypedConverter<NumericBuilder<T>>::TypedConverter;
+
+ protected:
+  Status AppendValue(const rj::Value& value) override {
+    typename T::c_type integer;
+    if (!GetInteger(value, &integer)) {
+      if (value.IsNumber()) {
+        std::stringstream ss;
+        ss << "JSON number out of the range of " << this->type_->ToString();
+        return Status::Invalid(ss.str());
+      }
+      return TypeMismatch(*this->type_, value);
+    }
+    return this->builder_->Append(integer);
+  }
+};
+
+template <typename T>
+class FloatingPointConverter : public TypedConverter<NumericBuilder<T>> {
+ public:
+  using TypedConverter<NumericBuilder<T>>::TypedConverter;
+
+ protected:
+  Status AppendValue(const rj::Value& value) override {
+    if (!value.IsNumber()) {
+      return TypeMismatch(*this->type_, value);
+    }
+    return this->builder_->Append(static_cast<typename T::c_type>(value.GetDouble()));
+  }
+};
+
+// For binary as well as utf8, StringBuilder being a BinaryBuilder
+class StringConverter : public TypedConverter<BinaryBuilder> {
+ public:
+  using TypedConverter::TypedConverter;
+
+ protected:
+  Status AppendValue(const rj::Value& value) override {
+    if (!value.IsString()) {
+      return TypeMismatch(*type_, value);
+    }
+    return builder_->Append(value.GetString(),
+                            static_cast<int32_t>(value.GetStringLength()));
+  }
+};
+
+class ListConverter : public TypedConverter<ListBuilder> {
+ public:
+  using TypedConverter::TypedConverter;
+
+  Status Init() {
+    const auto& list_type = checked_cast<const ListType&>(*type_);
+    return MakeConverter(list_type.value_type(), builder_->value_builder(),
+                         &value_converter_);
+  }
+
+ protected:
+  Status AppendValue(const rj::Value& value) override {
+    if (!value.IsArray()) {
+      return TypeMismatch(*type_, value);
+    }
+    RETURN_NOT_OK(builder_->Append());
+    for (const auto& element : value.GetArray()) {
+      RETURN_NOT_OK(value_converter_->Append(element));
+    }
+    return Status::OK();
+  }
+
+  std::unique_ptr<Converter> value_converter_;
+};
+
+bool IsName(const std::string& name, const rj::Value& key) {
+  return name.size() == key.GetStringLength() &&
+         std::memcmp(name.data(), key.GetString(), name.size()) == 0;
+}
+
+// Appends the members of JSON objects to the builders of fields, by name
+class FieldsConverter {
+ public:
+  Status Init(const std::vector<std::shared_ptr<Field>>& fields,
+              const std::vector<ArrayBuilder*>& builders) {
+    names_.resize(fields.size());
+    converters_.resize(fields.size());
+    for (size_t i = 0; i < fields.size(); ++i) {
+      names_[i] = fields[i]->name();
+      RETURN_NOT_OK(MakeConverter(fields[i]->type(), builders[i], &converters_[i]));
+    }
+    return Status::OK();
+  }
+
+  Status AppendObject(const rj::Value& object) {
+    const auto num_members = static_cast<size_t>(object.MemberCount());
+    for (size_t i = 0; i < names_.size(); ++i) {
+      // The keys of the lines tend to come in the same order, which saves
+      // looking them up
+      auto it = object.MemberEnd();
+      if (i < num_members) {
+        auto candidate = object.MemberBegin() + static_cast<std::ptrdiff_t>(i);
+        if (IsName(names_[i], candidate->name)) {
+          it = candidate;
+        }
+      }
+      if (it == object.MemberEnd()) {
+        it = object.FindMember(names_[i]);
+      }
+      if (it == object.MemberEnd()) {
+        RETURN_NOT_OK(converters_[i]->AppendNull());
+      } else {
+        RETURN_NOT_OK(converters_[i]->Append(it->value));
+      }
+    }
+    return Status::OK();
+  }
+
+  Status AppendNull() {
+    for (const auto& converter : converters_) {
+      RETURN_NOT_OK(converter->AppendNull());
+    }
+    return Status::OK();
+  }
+
+ private:
+  std::vector<std::string> names_;
+  std::vector<std::unique_ptr<Converter>> converters_;
+};
+
+class StructConverter : public TypedConverter<StructBuilder> {
+ public:
+  using TypedConverter::TypedConverter;
+
+  Status Init() {
+    std::vector<ArrayBuilder*> builders(builder_->num_fields());
+    for (int i = 0; i < builder_->num_fields(); ++i) {
+      builders[i] = builder_->field_builder(i);
+    }
+    return fields_.Init(type_->children(), builders);
+  }
+
+  Status AppendNull() override {
+    RETURN_NOT_OK(fields_.AppendNull());
+    return builder_->AppendNull();
+  }
+
+ protected:
+  Status AppendValue(const rj::Value& value) override {
+    if (!value.IsObject()) {
+      return TypeMismatch(*type_, value);
+    }
+    RETURN_NOT_OK(fields_.AppendObject(value));
+    return builder_->Append();
+  }
+
+  FieldsConverter fields_;
+};
+
+template <typename ConverterType>
+Status MakeTypedConverter(const std::shared_ptr<DataType>& type, ArrayBuilder* builder,
+                          std::unique_ptr<Converter>* out) {
+  out->reset(new ConverterType(type, builder));
+  return Status::OK();
+}
+
+template <typename ConverterType>
+Status MakeNestedConverter(const std::shared_ptr<DataType>& type, ArrayBuilder* builder,
+                           std::unique_ptr<Converter>* out) {
+  std::unique_ptr<ConverterType> converter(new ConverterType(type, builder));
+  RETURN_NOT_OK(converter->Init());
+  *out = std::move(converter);
+  return Status::OK();
+}
+
+Status MakeConverter(const std::shared_ptr<DataType>& type, ArrayBuilder* builder,
+                     std::unique_ptr<Converter>* out) {
+#define CONVERTER_CASE(ENUM, CONVERTER) \
+  case Type::ENUM:                      \
+    return MakeTypedConverter<CONVERTER>(type, builder, out);
+
+  switch (type->id()) {
+    CONVERTER_CASE(NA, NullConverter);
+    CONVERTER_CASE(BOOL, BooleanConverter);
+    CONVERTER_CASE(INT8, IntegerConverter<Int8Type>);
+    CONVERTER_CASE(INT16, IntegerConverter<Int16Type>);
+    CONVERTER_CASE(INT32, IntegerConverter<Int32Type>);
+    CONVERTER_CASE(INT64, IntegerConverter<Int64Type>);
+    CONVERTER_CASE(UINT8, IntegerConverter<UInt8Type>);
+    CONVERTER_CASE(UINT16, IntegerConverter<UInt16Type>);
+    CONVERTER_CASE(UINT32, IntegerConverter<UInt32Type>);
+    CONVERTER_CASE(UINT64, IntegerConverter<UInt64Type>);
+    CONVERTER_CASE(FLOAT, FloatingPointConverter<FloatType>);
+    CONVERTER_CASE(DOUBLE, FloatingPointConverter<DoubleType>);
+    CONVERTER_CASE(STRING, StringConverter);
+    CONVERTER_CASE(BINARY, StringConverter);
+    case Type::LIST:
+      return MakeNestedConverter<ListConverter>(type, builder, out);
+    case Type::STRUCT:
+      return MakeNestedConverter<StructConverter>(type, builder, out);
+    default:
+      break;
+  }
+#undef CONVERTER_CASE
+
+  std::stringstream ss;
+  ss << "Reading " << type->ToString() << " from JSON";
+  return Status::NotImplemented(ss.str());
+}
+
+// Parse the lines of a block into a record batch
+Status ParseBlock(MemoryPool* pool, const std::shared_ptr<Schema>& schema,
+                  const Buffer& block, std::shared_ptr<RecordBatch>* out) {
+  const int num_fields = schema->num_fields();
+  std::vector<std::unique_ptr<ArrayBuilder>> builders(num_fields);
+  std::vector<ArrayBuilder*> builder_ptrs(num_fields);
+  for (int i = 0; i < num_fields; ++i) {
+    RETURN_NOT_OK(MakeBuilder(pool, schema->field(i)->type(), &builders[i]));
+    builder_ptrs[i] = builders[i].get();
+  }
+  FieldsConverter converter;
+  RETURN_NOT_OK(converter.Init(schema->fields(), builder_ptrs));
+
+  rj::Document doc;
+  int64_t num_rows = 0;
+  RETURN_NOT_OK(VisitLines(block, [&](const char* line, int64_t length, bool*) -> Status {
+    RETURN_NOT_OK(ParseLine(line, length, &doc));
+    ++num_rows;
+    return converter.AppendObject(doc);
+  }));
+
+  std::vector<std::shared_ptr<Array>> columns(num_fields);
+  for (int i = 0; i < num_fields; ++i) {
+    RETURN_NOT_OK(builders[i]->Finish(&columns[i]));
+  }
+  *out = RecordBatch::Make(schema, num_rows, std::move(columns));
+  return Status::OK();
+}
+
+}  // namespace
+
+Status InferNdjsonSchema(const Buffer& data, int64_t max_rows,
+                         std::shared_ptr<Schema>* out) {
+  std::vector<std::shared_ptr<Field>> fields;
+  rj::Document doc;
+  int64_t num_rows = 0;
+  auto visit = [&](const char* line, int64_t length, bool* more) -> Status {
+    RETURN_NOT_OK(ParseLine(line, length, &doc));
+    *more = ++num_rows < max_rows;
+    return MergeObject(doc, &fields);
+  };
+  RETURN_NOT_OK(VisitLines(data, visit));
+  *out = ::arrow::schema(fields);
+  return Status::OK();
+}
+
+// ----------------------------------------------------------------------
+// Reader implementation
+
+class NdjsonReader::NdjsonReaderImpl {
+ public:
+  NdjsonReaderImpl(MemoryPool* pool, const std::shared_ptr<io::InputStream>& input,
+                   const NdjsonReadOptions& options)
+      : pool_(pool), input_(input), options_(options), eof_(false) {}
+
+  Status Init() {
+    if (options_.block_size <= 0) {
+      return Status::Invalid("Block size must be positive");
+    }
+    schema_ = options_.schema;
+    if (schema_ == nullptr) {
+      // The first block is read now to infer the schema from, and parsed
+      // with the next ones
+      RETURN_NOT_OK(ReadBlock(&first_block_));
+      if (first_block_ == nullptr) {
+        schema_ = ::arrow::schema(std::vector<std::shared_ptr<Field>>());
+      } else {
+        RETURN_NOT_OK(
+            InferNdjsonSchema(*first_block_, options_.inference_rows, &schema_));
+      }
+    }
+    // Fail early on the types that cannot be read
+    std::shared_ptr<RecordBatch> empty;
+    Buffer no_lines(nullptr, 0);
+    return ParseBlock(pool_, schema_, no_lines, &empty);
+  }
+
+  std::shared_ptr<Schema> schema() const { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* out) {
+    while (batches_.empty()) {
+      if (eof_ && first_block_ == nullptr) {
+        *out = nullptr;
+        return Status::OK();
+      }
+      RETURN_NOT_OK(ParseBlocks());
+    }
+    *out = batches_.front();
+    batches_.pop_front();
+    return Status::OK();
+  }
+
+ private:
+  // Read a block for each thread of the CPU pool, and parse them at once
+  Status ParseBlocks() {
+    const int max_blocks = options_.use_threads ? GetCpuThreadPoolCapacity() : 1;
+    std::vector<std::shared_ptr<Buffer>> blocks;
+    while (static_cast<int>(blocks.size()) < std::max(max_blocks, 1)) {
+      std::shared_ptr<Buffer> block;
+      RETURN_NOT_OK(ReadBlock(&block));
+      if (block == nullptr) {
+        break;
+      }
+      blocks.push_back(block);
+    }
+
+    const auto num_blocks = static_cast<int>(blocks.size());
+    std::vector<std::shared_ptr<RecordBatch>> batches(num_blocks);
+    auto parse = [&](int i) -> Status {
+      return ParseBlock(pool_, schema_, *blocks[i], &batches[i]);
+    };
+    if (num_blocks > 1) {
+      RETURN_NOT_OK(ParallelFor(num_blocks, parse));
+    } else if (num_blocks == 1) {
+      RETURN_NOT_OK(parse(0));
+    }
+    for (const auto& batch : batches) {
+      // Blocks of blank lines only
+      if (batch->num_rows() > 0) {
+        batches_.push_back(batch);
+      }
+    }
+    return Status::OK();
+  }
+
+  // The next block of whole lines, null at the end of the input
+  Status ReadBlock(std::shared_ptr<Buffer>* out) {
+    if (first_block_ != nullptr) {
+      *out = first_block_;
+      first_block_.reset();
+      return Status::OK();
+    }
+    while (!eof_) {
+      std::shared_ptr<Buffer> data;
+      RETURN_NOT_OK(input_->Read(options_.block_size, &data));
+      if (data->size() == 0) {
+        eof_ = true;
+        break;
+      }
+      // Cut after the last newline, the line it does not end being completed
+      // by the next reads
+      int64_t cut = data->size();
+      while (cut > 0 && data->data()[cut - 1] != '\n') {
+        --cut;
+      }
+      if (cut == 0) {
+        partial_.push_back(data);
+        continue;
+      }
+      partial_.push_back(SliceBuffer(data, 0, cut));
+      RETURN_NOT_OK(TakePartial(out));
+      if (cut < data->size()) {
+        partial_.push_back(SliceBuffer(data, cut, data->size() - cut));
+      }
+      return Status::OK();
+    }
+    // The last line need not end with a newline
+    if (partial_.empty()) {
+      *out = nullptr;
+      return Status::OK();
+    }
+    return TakePartial(out);
+  }
+
+  // The buffers read since the last block, as one
+  Status TakePartial(std::shared_ptr<Buffer>* out) {
+    if (partial_.size() == 1) {
+      *out = partial_[0];
+    } else {
+      int64_t size = 0;
+      for (const auto& buffer : partial_) {
+        size += buffer->size();
+      }
+      std::shared_ptr<Buffer> block;
+      RETURN_NOT_OK(AllocateBuffer(pool_, size, &block));
+      uint8_t* dest = block->mutable_data();
+      for (const auto& buffer : partial_) {
+        std::memcpy(dest, buffer->data(), static_cast<size_t>(buffer->size()));
+        dest += buffer->size();
+      }
+      *out = block;
+    }
+    partial_.clear();
+    return Status::OK();
+  }
+
+  MemoryPool* pool_;
+  std::shared_ptr<io::InputStream> input_;
+  const NdjsonReadOptions options_;
+  std::shared_ptr<Schema> schema_;
+
+  bool eof_;
+  std::shared_ptr<Buffer> first_block_;
+  std::vector<std::shared_ptr<Buffer>> partial_;
+  std::deque<std::shared_ptr<RecordBatch>> batches_;
+};
+
+NdjsonReader::NdjsonReader() {}
+
+NdjsonReader::~NdjsonReader() {}
+
+Status NdjsonReader::Open(MemoryPool* pool, const std::shared_ptr<io::InputStream>& input,
+                          const NdjsonReadOptions& options,
+                          std::shared_ptr<RecordBatchReader>* out) {
+  std::shared_ptr<NdjsonReader> reader(new NdjsonReader());
+  reader->impl_.reset(new NdjsonReaderImpl(pool, input, options));
+  RETURN_NOT_OK(reader->impl_->Init());
+  *out = reader;
+  return Status::OK();
+}
+
+std::shared_ptr<Schema> NdjsonReader::schema() const { return impl_->schema(); }
+
+Status NdjsonReader::ReadNext(std::shared_ptr<RecordBatch>* batch) {
+  return impl_->ReadNext(batch);
+}
+
+}  // namespace ipc
+}  // namespace arrow
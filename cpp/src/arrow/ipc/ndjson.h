@@ -0,0 +1,112 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Reading newline-delimited JSON (one JSON object per line) into record
+// batches
+
+#ifndef ARROW_IPC_NDJSON_H
+#define ARROW_IPC_NDJSON_H
+
+#include <cstdint>
+#include <memory>
+
+#include "arrow/record_batch.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Buffer;
+class MemoryPool;
+class Schema;
+class Status;
+
+namespace io {
+
+class InputStream;
+
+}  // namespace io
+
+namespace ipc {
+
+struct ARROW_EXPORT NdjsonReadOptions {
+  /// The bytes read at a time. Each block, cut at its last newline, is
+  /// parsed into a record batch of its own
+  int64_t block_size = 1 << 20;
+
+  /// The lines of the first block to infer the schema from, when none is
+  /// given
+  int64_t inference_rows = 1000;
+
+  /// Parse several blocks at once, on the CPU thread pool
+  bool use_threads = true;
+
+  /// The schema of the batches, inferred when null. The keys of a line not
+  /// in it are ignored, and those it misses are null
+  std::shared_ptr<Schema> schema;
+};
+
+/// \class NdjsonReader
+/// \brief Reads newline-delimited JSON, each line an object of the values of
+/// a row
+///
+/// When inferred, the fields of the schema are the keys of the sampled lines,
+/// in the order first seen: JSON booleans are read as boolean, integers as
+/// int64, other numbers as float64 (as are integers when some values of the
+/// key are not), strings as utf8, arrays as lists and objects as structs.
+/// Keys only ever null are of the null type. Given a schema, the same types
+/// can be read, along with the other integer types and float32, and binary.
+class ARROW_EXPORT NdjsonReader : public RecordBatchReader {
+ public:
+  ~NdjsonReader() override;
+
+  /// \brief Start reading newline-delimited JSON, inferring the schema if
+  /// none is given
+  ///
+  /// \param[in] pool a MemoryPool to build the batches from
+  /// \param[in] input the JSON
+  /// \param[in] options see NdjsonReadOptions
+  /// \param[out] out the reader
+  /// \return Status
+  static Status Open(MemoryPool* pool, const std::shared_ptr<io::InputStream>& input,
+                     const NdjsonReadOptions& options,
+                     std::shared_ptr<RecordBatchReader>* out);
+
+  std::shared_ptr<Schema> schema() const override;
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* batch) override;
+
+ private:
+  NdjsonReader();
+
+  class ARROW_NO_EXPORT NdjsonReaderImpl;
+  std::unique_ptr<NdjsonReaderImpl> impl_;
+};
+
+/// \brief Infer the schema of newline-delimited JSON, as NdjsonReader does
+///
+/// \param[in] data the JSON lines to infer the schema from
+/// \param[in] max_rows the lines to look at, at most
+/// \param[out] out the schema
+/// \return Status
+ARROW_EXPORT
+Status InferNdjsonSchema(const Buffer& data, int64_t max_rows,
+                         std::shared_ptr<Schema>* out);
+
+}  // namespace ipc
+}  // namespace arrow
+
+#endif  // ARROW_IPC_NDJSON_H
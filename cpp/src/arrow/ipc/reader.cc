@@ -17,8 +17,11 @@
 
 #include "arrow/ipc/reader.h"
 
+#include <algorithm>
+#include <chrono>
 #include <cstdint>
 #include <cstring>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <type_traits>
@@ -38,12 +41,19 @@
 #include "arrow/ipc/message.h"
 #include "arrow/ipc/metadata-internal.h"
 #include "arrow/ipc/util.h"
+#include "arrow/memory_pool.h"
 #include "arrow/record_batch.h"
+#include "arrow/sparse_tensor.h"
 #include "arrow/status.h"
+#include "arrow/table.h"
 #include "arrow/tensor.h"
 #include "arrow/type.h"
 #include "arrow/util/bit-util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/tracing.h"
 #include "arrow/visitor_inline.h"
 
 namespace arrow {
@@ -61,10 +71,94 @@ using internal::kArrowMagicBytes;
 /// Accessor class for flatbuffers metadata
 class IpcComponentSource {
  public:
-  IpcComponentSource(const flatbuf::RecordBatch* metadata, io::RandomAccessFile* file)
-      : metadata_(metadata), file_(file) {}
+  /// \param[in] body_offset the position of the message body in file
+  IpcComponentSource(const flatbuf::RecordBatch* metadata, io::RandomAccessFile* file,
+                     int64_t body_offset = 0)
+      : metadata_(metadata),
+        file_(file),
+        body_offset_(body_offset),
+        use_threads_(true),
+        recorded_(NULLPTR) {}
+
+  /// \brief Whether to read and decompress buffers on the CPU thread pool,
+  /// true by default
+  void set_use_threads(bool use_threads) { use_threads_ = use_threads; }
 
   Status GetBuffer(int buffer_index, std::shared_ptr<Buffer>* out) {
+    if (recorded_ != NULLPTR) {
+      recorded_->push_back(buffer_index);
+      *out = nullptr;
+      return Status::OK();
+    }
+    if (!prefetched_.empty()) {
+      if (buffer_index >= static_cast<int>(prefetched_.size())) {
+        return Status::IOError("Buffer index out of bounds, likely malformed");
+      }
+      *out = prefetched_[buffer_index];
+      return Status::OK();
+    }
+    return ReadBuffer(buffer_index, out);
+  }
+
+  /// \brief Instead of reading buffers, append the index of those asked for
+  /// to out, or stop doing so if out is null
+  void RecordBuffers(std::vector<int>* out) { recorded_ = out; }
+
+  /// \brief Read the given buffers ahead of loading the arrays, and
+  /// decompress them if the body is compressed
+  ///
+  /// The buffers are read with ReadRanges, which merges those close to each
+  /// other in the file, so that fetching a few columns takes few reads.
+  Status Prefetch(std::vector<int> buffer_indices) {
+    const auto buffers = metadata_->buffers();
+    const int num_buffers = static_cast<int>(buffers->size());
+    for (int i : buffer_indices) {
+      if (i < 0 || i >= num_buffers) {
+        return Status::IOError("Buffer index out of bounds, likely malformed");
+      }
+    }
+    std::sort(buffer_indices.begin(), buffer_indices.end());
+    buffer_indices.erase(std::unique(buffer_indices.begin(), buffer_indices.end()),
+                         buffer_indices.end());
+
+    std::vector<io::ReadRange> ranges;
+    std::vector<int> read_indices;
+    for (int i : buffer_indices) {
+      const flatbuf::Buffer* buffer = buffers->Get(i);
+      if (buffer->length() > 0) {
+        ranges.push_back({body_offset_ + buffer->offset(), buffer->length()});
+        read_indices.push_back(i);
+      }
+    }
+    std::vector<std::shared_ptr<Buffer>> data;
+    io::ReadRangesOptions options;
+    options.use_threads = use_threads_;
+    RETURN_NOT_OK(file_->ReadRanges(ranges, options, &data));
+
+    prefetched_.assign(num_buffers, nullptr);
+    for (size_t k = 0; k < ranges.size(); ++k) {
+      if (data[k]->size() < ranges[k].length) {
+        return Status::IOError("Record batch body ended early, likely truncated");
+      }
+      prefetched_[read_indices[k]] = data[k];
+    }
+    return Decompress(buffer_indices);
+  }
+
+  /// \brief Read all the buffers of a compressed body ahead of loading the
+  /// arrays, and decompress them
+  Status PrefetchCompressed() {
+    if (metadata_->compression() == nullptr) {
+      return Status::OK();
+    }
+    std::vector<int> buffer_indices(metadata_->buffers()->size());
+    for (size_t i = 0; i < buffer_indices.size(); ++i) {
+      buffer_indices[i] = static_cast<int>(i);
+    }
+    return Prefetch(std::move(buffer_indices));
+  }
+
+  Status ReadBuffer(int buffer_index, std::shared_ptr<Buffer>* out) {
     const flatbuf::Buffer* buffer = metadata_->buffers()->Get(buffer_index);
 
     if (buffer->length() == 0) {
@@ -74,7 +168,7 @@ class IpcComponentSource {
       DCHECK(BitUtil::IsMultipleOf8(buffer->offset()))
           << "Buffer " << buffer_index
           << " did not start on 8-byte aligned offset: " << buffer->offset();
-      return file_->ReadAt(buffer->offset(), buffer->length(), out);
+      return file_->ReadAt(body_offset_ + buffer->offset(), buffer->length(), out);
     }
   }
 
@@ -93,10 +187,102 @@ class IpcComponentSource {
   }
 
  private:
+  // Decompress the prefetched buffers, in parallel on the CPU thread pool
+  // unless disabled
+  Status Decompress(const std::vector<int>& buffer_indices) {
+    const flatbuf::BodyCompression* compression = metadata_->compression();
+    if (compression == nullptr) {
+      return Status::OK();
+    }
+    Compression::type codec_type;
+    RETURN_NOT_OK(internal::GetCompression(compression->codec(), &codec_type));
+    const auto lengths = compression->uncompressedLengths();
+    if (lengths == nullptr || lengths->size() != metadata_->buffers()->size()) {
+      return Status::IOError("Body compression metadata does not match the buffers");
+    }
+
+    if (compression->method() == flatbuf::BodyCompressionMethod_BLOCK) {
+      return DecompressBlockBuffers(codec_type, buffer_indices, *lengths);
+    }
+
+    auto decompress = [this, &buffer_indices, codec_type, lengths](int k) -> Status {
+      const int i = buffer_indices[k];
+      const int64_t length = lengths->Get(i);
+      if (length < 0 || prefetched_[i] == nullptr) {
+        return Status::OK();
+      }
+      std::unique_ptr<Codec> codec;
+      RETURN_NOT_OK(Codec::Create(codec_type, &codec));
+      std::shared_ptr<Buffer> buffer;
+      RETURN_NOT_OK(AllocateBuffer(default_memory_pool(), length, &buffer));
+      RETURN_NOT_OK(codec->Decompress(prefetched_[i]->size(), prefetched_[i]->data(),
+                                      length, buffer->mutable_data()));
+      prefetched_[i] = buffer;
+      return Status::OK();
+    };
+    if (use_threads_) {
+      return ParallelFor(static_cast<int>(buffer_indices.size()), decompress);
+    }
+    for (size_t k = 0; k < buffer_indices.size(); ++k) {
+      RETURN_NOT_OK(decompress(static_cast<int>(k)));
+    }
+    return Status::OK();
+  }
+
+  // Decompress the prefetched buffers compressed in blocks, the blocks of all
+  // of them at once
+  Status DecompressBlockBuffers(Compression::type codec_type,
+                                const std::vector<int>& buffer_indices,
+                                const flatbuffers::Vector<int64_t>& lengths) {
+    std::vector<int> indices;
+    std::vector<std::shared_ptr<Buffer>> inputs;
+    for (int i : buffer_indices) {
+      if (lengths.Get(i) >= 0 && prefetched_[i] != nullptr) {
+        indices.push_back(i);
+        inputs.push_back(prefetched_[i]);
+      }
+    }
+    std::vector<std::shared_ptr<Buffer>> outputs;
+    RETURN_NOT_OK(::arrow::DecompressBlocks(codec_type, inputs, use_threads_,
+                                            default_memory_pool(), &outputs));
+    for (size_t k = 0; k < indices.size(); ++k) {
+      if (outputs[k]->size() != lengths.Get(indices[k])) {
+        return Status::IOError("Decompressed buffer does not have the expected length");
+      }
+      prefetched_[indices[k]] = outputs[k];
+    }
+    return Status::OK();
+  }
+
   const flatbuf::RecordBatch* metadata_;
   io::RandomAccessFile* file_;
+  int64_t body_offset_;
+  bool use_threads_;
+  std::vector<int>* recorded_;
+  std::vector<std::shared_ptr<Buffer>> prefetched_;
 };
 
+// Whether nothing but data refers to its ArrayData any more, which is then
+// reset to be loaded again, its buffers released. Its vectors keep their
+// capacity, and so do its children, reset alike if unique and dropped
+// otherwise, for LoadChildren to reuse.
+static bool ResetIfUnique(const std::shared_ptr<ArrayData>& data) {
+  if (data == nullptr || data.use_count() != 1) {
+    return false;
+  }
+  data->type = nullptr;
+  data->length = 0;
+  data->null_count = 0;
+  data->offset = 0;
+  data->buffers.clear();
+  for (auto& child : data->child_data) {
+    if (!ResetIfUnique(child)) {
+      child = nullptr;
+    }
+  }
+  return true;
+}
+
 /// Bookkeeping struct for loading array objects from their constituent pieces of raw data
 ///
 /// The field_index and buffer_index are incremented in the ArrayLoader
@@ -181,11 +367,19 @@ class ArrayLoader {
   }
 
   Status LoadChildren(std::vector<std::shared_ptr<Field>> child_fields) {
+    // The children of reused ArrayData are reused too, where possible
+    std::vector<std::shared_ptr<ArrayData>> previous_children;
+    previous_children.swap(out_->child_data);
     out_->child_data.reserve(static_cast<int>(child_fields.size()));
 
-    for (const auto& child_field : child_fields) {
-      auto field_array = std::make_shared<ArrayData>();
-      RETURN_NOT_OK(LoadChild(*child_field.get(), field_array.get()));
+    for (size_t i = 0; i < child_fields.size(); ++i) {
+      std::shared_ptr<ArrayData> field_array;
+      if (i < previous_children.size() && ResetIfUnique(previous_children[i])) {
+        field_array = previous_children[i];
+      } else {
+        field_array = std::make_shared<ArrayData>();
+      }
+      RETURN_NOT_OK(LoadChild(*child_fields[i], field_array.get()));
       out_->child_data.emplace_back(field_array);
     }
     return Status::OK();
@@ -208,8 +402,10 @@ class ArrayLoader {
   }
 
   template <typename T>
-  typename std::enable_if<std::is_base_of<BinaryType, T>::value, Status>::type Visit(
-      const T& type) {
+  typename std::enable_if<std::is_base_of<BinaryType, T>::value ||
+                              std::is_base_of<LargeBinaryType, T>::value,
+                          Status>::type
+  Visit(const T& type) {
     return LoadBinary<T>();
   }
 
@@ -219,7 +415,42 @@ class ArrayLoader {
     return GetBuffer(context_->buffer_index++, &out_->buffers[1]);
   }
 
-  Status Visit(const ListType& type) {
+  template <typename T>
+  typename std::enable_if<std::is_base_of<ListType, T>::value ||
+                              std::is_base_of<LargeListType, T>::value,
+                          Status>::type
+  Visit(const T& type) {
+    out_->buffers.resize(2);
+
+    RETURN_NOT_OK(LoadCommon());
+    RETURN_NOT_OK(GetBuffer(context_->buffer_index++, &out_->buffers[1]));
+
+    const int num_children = type.num_children();
+    if (num_children != 1) {
+      std::stringstream ss;
+      ss << "Wrong number of children: " << num_children;
+      return Status::Invalid(ss.str());
+    }
+
+    return LoadChildren(type.children());
+  }
+
+  Status Visit(const FixedSizeListType& type) {
+    out_->buffers.resize(1);
+
+    RETURN_NOT_OK(LoadCommon());
+
+    const int num_children = type.num_children();
+    if (num_children != 1) {
+      std::stringstream ss;
+      ss << "Wrong number of children: " << num_children;
+      return Status::Invalid(ss.str());
+    }
+
+    return LoadChildren(type.children());
+  }
+
+  Status Visit(const RunLengthEncodedType& type) {
     out_->buffers.resize(2);
 
     RETURN_NOT_OK(LoadCommon());
@@ -290,40 +521,125 @@ Status ReadRecordBatch(const Message& message, const std::shared_ptr<Schema>& sc
 // ----------------------------------------------------------------------
 // Array loading
 
+// If reusable_columns is not null, the columns are loaded into the ArrayData
+// it holds where nothing else refers to them, counted in num_reused, and it
+// is then set to the columns of the batch
+static Status LoadRecordBatchFromSource(
+    const std::shared_ptr<Schema>& schema, int64_t num_rows, int max_recursion_depth,
+    IpcComponentSource* source, std::vector<std::shared_ptr<ArrayData>>* reusable_columns,
+    int64_t* num_reused, std::shared_ptr<RecordBatch>* out) {
+  ArrayLoaderContext context;
+  context.source = source;
+  context.field_index = 0;
+  context.buffer_index = 0;
+  context.max_recursion_depth = max_recursion_depth;
+
+  std::vector<std::shared_ptr<ArrayData>> arrays(schema->num_fields());
+  for (int i = 0; i < schema->num_fields(); ++i) {
+    std::shared_ptr<ArrayData> arr;
+    if (reusable_columns != NULLPTR &&
+        i < static_cast<int>(reusable_columns->size()) &&
+        ResetIfUnique((*reusable_columns)[i])) {
+      arr = std::move((*reusable_columns)[i]);
+      ++*num_reused;
+    } else {
+      arr = std::make_shared<ArrayData>();
+    }
+    RETURN_NOT_OK(LoadArray(schema->field(i)->type(), &context, arr.get()));
+    DCHECK_EQ(num_rows, arr->length) << "Array length did not match record batch length";
+    arrays[i] = std::move(arr);
+  }
+
+  if (reusable_columns != NULLPTR) {
+    *reusable_columns = arrays;
+  }
+  *out = RecordBatch::Make(schema, num_rows, std::move(arrays));
+  return Status::OK();
+}
+
 static Status LoadRecordBatchFromSource(const std::shared_ptr<Schema>& schema,
                                         int64_t num_rows, int max_recursion_depth,
                                         IpcComponentSource* source,
                                         std::shared_ptr<RecordBatch>* out) {
+  return LoadRecordBatchFromSource(schema, num_rows, max_recursion_depth, source,
+                                   NULLPTR, NULLPTR, out);
+}
+
+// Load only the given top-level fields of the schema, reading no buffers of
+// the others
+static Status LoadProjectedRecordBatch(const std::shared_ptr<Schema>& schema,
+                                       const std::vector<int>& columns,
+                                       int64_t num_rows, int max_recursion_depth,
+                                       IpcComponentSource* source,
+                                       std::shared_ptr<RecordBatch>* out) {
+  const int num_fields = schema->num_fields();
+  std::vector<bool> selected(num_fields, false);
+  for (int column : columns) {
+    if (column < 0 || column >= num_fields) {
+      std::stringstream ss;
+      ss << "Column index " << column << " out of range for a schema of "
+         << num_fields << " fields";
+      return Status::Invalid(ss.str());
+    }
+    selected[column] = true;
+  }
+
   ArrayLoaderContext context;
   context.source = source;
   context.field_index = 0;
   context.buffer_index = 0;
   context.max_recursion_depth = max_recursion_depth;
 
-  std::vector<std::shared_ptr<ArrayData>> arrays(schema->num_fields());
-  for (int i = 0; i < schema->num_fields(); ++i) {
+  // Walk the metadata of every field to find where its nodes and buffers
+  // start, noting the buffers the selected fields will ask for
+  std::vector<ArrayLoaderContext> field_starts(num_fields);
+  std::vector<int> needed_buffers;
+  std::vector<int> skipped_buffers;
+  for (int i = 0; i < num_fields; ++i) {
+    field_starts[i] = context;
+    source->RecordBuffers(selected[i] ? &needed_buffers : &skipped_buffers);
+    ArrayData unused;
+    Status status = LoadArray(schema->field(i)->type(), &context, &unused);
+    source->RecordBuffers(NULLPTR);
+    RETURN_NOT_OK(status);
+  }
+  RETURN_NOT_OK(source->Prefetch(std::move(needed_buffers)));
+
+  std::vector<std::shared_ptr<Field>> fields(columns.size());
+  std::vector<std::shared_ptr<ArrayData>> arrays(columns.size());
+  for (size_t i = 0; i < columns.size(); ++i) {
+    context = field_starts[columns[i]];
+    fields[i] = schema->field(columns[i]);
     auto arr = std::make_shared<ArrayData>();
-    RETURN_NOT_OK(LoadArray(schema->field(i)->type(), &context, arr.get()));
+    RETURN_NOT_OK(LoadArray(fields[i]->type(), &context, arr.get()));
     DCHECK_EQ(num_rows, arr->length) << "Array length did not match record batch length";
     arrays[i] = std::move(arr);
   }
 
-  *out = RecordBatch::Make(schema, num_rows, std::move(arrays));
+  *out = RecordBatch::Make(std::make_shared<Schema>(fields, schema->metadata()),
+                           num_rows, std::move(arrays));
   return Status::OK();
 }
 
 static inline Status ReadRecordBatch(const flatbuf::RecordBatch* metadata,
                                      const std::shared_ptr<Schema>& schema,
-                                     int max_recursion_depth, io::RandomAccessFile* file,
+                                     int max_recursion_depth, bool use_threads,
+                                     io::RandomAccessFile* file,
                                      std::shared_ptr<RecordBatch>* out) {
   IpcComponentSource source(metadata, file);
+  source.set_use_threads(use_threads);
+  RETURN_NOT_OK(source.PrefetchCompressed());
   return LoadRecordBatchFromSource(schema, metadata->length(), max_recursion_depth,
                                    &source, out);
 }
 
-Status ReadRecordBatch(const Buffer& metadata, const std::shared_ptr<Schema>& schema,
-                       int max_recursion_depth, io::RandomAccessFile* file,
-                       std::shared_ptr<RecordBatch>* out) {
+// With use_threads false, the batch is read without using the thread pools,
+// as when several batches are read in parallel
+static Status ReadRecordBatch(const Buffer& metadata,
+                              const std::shared_ptr<Schema>& schema,
+                              int max_recursion_depth, bool use_threads,
+                              io::RandomAccessFile* file,
+                              std::shared_ptr<RecordBatch>* out) {
   auto message = flatbuf::GetMessage(metadata.data());
   if (message->header_type() != flatbuf::MessageHeader_RecordBatch) {
     DCHECK_EQ(message->header_type(), flatbuf::MessageHeader_RecordBatch);
@@ -332,7 +648,216 @@ Status ReadRecordBatch(const Buffer& metadata, const std::shared_ptr<Schema>& sc
     return Status::IOError("Header-pointer of flatbuffer-encoded Message is null.");
   }
   auto batch = reinterpret_cast<const flatbuf::RecordBatch*>(message->header());
-  return ReadRecordBatch(batch, schema, max_recursion_depth, file, out);
+  return ReadRecordBatch(batch, schema, max_recursion_depth, use_threads, file, out);
+}
+
+Status ReadRecordBatch(const Buffer& metadata, const std::shared_ptr<Schema>& schema,
+                       int max_recursion_depth, io::RandomAccessFile* file,
+                       std::shared_ptr<RecordBatch>* out) {
+  return ReadRecordBatch(metadata, schema, max_recursion_depth, true, file, out);
+}
+
+// Read the given columns of a record batch whose body starts at body_offset
+// in file
+static Status ReadRecordBatch(const Buffer& metadata,
+                              const std::shared_ptr<Schema>& schema,
+                              const std::vector<int>& columns, int max_recursion_depth,
+                              io::RandomAccessFile* file, int64_t body_offset,
+                              std::shared_ptr<RecordBatch>* out) {
+  auto message = flatbuf::GetMessage(metadata.data());
+  if (message->header_type() != flatbuf::MessageHeader_RecordBatch ||
+      message->header() == nullptr) {
+    return Status::IOError("Message is not a record batch, likely malformed");
+  }
+  auto batch = reinterpret_cast<const flatbuf::RecordBatch*>(message->header());
+  IpcComponentSource source(batch, file, body_offset);
+  return LoadProjectedRecordBatch(schema, columns, batch->length(), max_recursion_depth,
+                                  &source, out);
+}
+
+// Find where the nodes and buffers of each top-level field start, walking
+// the metadata without reading any buffer. Where they start follows from the
+// types of the fields only, so is the same for every batch of a schema.
+static Status GetFieldStarts(const flatbuf::RecordBatch* metadata, const Schema& schema,
+                             std::vector<ArrayLoaderContext>* out) {
+  IpcComponentSource source(metadata, NULLPTR);
+  std::vector<int> unused_buffers;
+  source.RecordBuffers(&unused_buffers);
+
+  ArrayLoaderContext context;
+  context.source = &source;
+  context.field_index = 0;
+  context.buffer_index = 0;
+  context.max_recursion_depth = kMaxNestingDepth;
+
+  // The source of the contexts is to be replaced by that of each batch
+  out->resize(schema.num_fields());
+  for (int i = 0; i < schema.num_fields(); ++i) {
+    (*out)[i] = context;
+    ArrayData unused;
+    RETURN_NOT_OK(LoadArray(schema.field(i)->type(), &context, &unused));
+    unused_buffers.clear();
+  }
+  return Status::OK();
+}
+
+/// \class LazyRecordBatch
+/// \brief A record batch of a file, whose columns are loaded the first time
+/// they are accessed
+///
+/// The batch holds the metadata of its message. Loading a column decodes the
+/// metadata of that column alone and reads its buffers, which on a memory map
+/// are slices of the map. A column that cannot be loaded is null; Validate
+/// returns why. Slices of the batch are lazy too, offset rows into it.
+class LazyRecordBatch : public RecordBatch {
+ public:
+  LazyRecordBatch(const std::shared_ptr<Schema>& schema, int64_t offset,
+                  int64_t num_rows, std::shared_ptr<Message> message,
+                  const flatbuf::RecordBatch* metadata,
+                  std::shared_ptr<const std::vector<ArrayLoaderContext>> field_starts,
+                  io::RandomAccessFile* file,
+                  std::shared_ptr<io::RandomAccessFile> owned_file, int64_t body_offset)
+      : RecordBatch(schema, num_rows),
+        offset_(offset),
+        message_(std::move(message)),
+        metadata_(metadata),
+        field_starts_(std::move(field_starts)),
+        file_(file),
+        owned_file_(std::move(owned_file)),
+        body_offset_(body_offset),
+        columns_(schema->num_fields()),
+        boxed_columns_(schema->num_fields()) {}
+
+  std::shared_ptr<Array> column(int i) const override {
+    std::lock_guard<std::mutex> guard(lock_);
+    if (!boxed_columns_[i]) {
+      std::shared_ptr<ArrayData> data;
+      if (LoadColumn(i, &data).ok()) {
+        boxed_columns_[i] = MakeArray(data);
+      }
+    }
+    return boxed_columns_[i];
+  }
+
+  std::shared_ptr<ArrayData> column_data(int i) const override {
+    std::lock_guard<std::mutex> guard(lock_);
+    std::shared_ptr<ArrayData> data;
+    ARROW_UNUSED(LoadColumn(i, &data));
+    return data;
+  }
+
+  Status AddColumn(int i, const std::shared_ptr<Field>& field,
+                   const std::shared_ptr<Array>& column,
+                   std::shared_ptr<RecordBatch>* out) const override {
+    std::shared_ptr<RecordBatch> loaded;
+    RETURN_NOT_OK(Load(&loaded));
+    return loaded->AddColumn(i, field, column, out);
+  }
+
+  Status RemoveColumn(int i, std::shared_ptr<RecordBatch>* out) const override {
+    std::shared_ptr<RecordBatch> loaded;
+    RETURN_NOT_OK(Load(&loaded));
+    return loaded->RemoveColumn(i, out);
+  }
+
+  std::shared_ptr<RecordBatch> ReplaceSchemaMetadata(
+      const std::shared_ptr<const KeyValueMetadata>& metadata) const override {
+    return std::make_shared<LazyRecordBatch>(schema_->AddMetadata(metadata), offset_,
+                                             num_rows_, message_, metadata_,
+                                             field_starts_, file_, owned_file_,
+                                             body_offset_);
+  }
+
+  std::shared_ptr<RecordBatch> Slice(int64_t offset, int64_t length) const override {
+    return std::make_shared<LazyRecordBatch>(
+        schema_, offset_ + offset, std::min(num_rows_ - offset, length), message_,
+        metadata_, field_starts_, file_, owned_file_, body_offset_);
+  }
+
+  Status Validate() const override {
+    std::shared_ptr<RecordBatch> loaded;
+    RETURN_NOT_OK(Load(&loaded));
+    return loaded->Validate();
+  }
+
+ private:
+  // Load the column unless done already, lock_ held
+  Status LoadColumn(int i, std::shared_ptr<ArrayData>* out) const {
+    if (columns_[i] == nullptr) {
+      IpcComponentSource source(metadata_, file_, body_offset_);
+      // A column is small work, and may be asked for from the thread pool
+      source.set_use_threads(false);
+      const std::shared_ptr<DataType>& type = schema_->field(i)->type();
+      ArrayLoaderContext context = (*field_starts_)[i];
+      context.source = &source;
+      if (metadata_->compression() != nullptr) {
+        // Decompressing takes the buffers read ahead
+        std::vector<int> buffer_indices;
+        source.RecordBuffers(&buffer_indices);
+        ArrayData unused;
+        Status status = LoadArray(type, &context, &unused);
+        source.RecordBuffers(NULLPTR);
+        RETURN_NOT_OK(status);
+        RETURN_NOT_OK(source.Prefetch(std::move(buffer_indices)));
+        context = (*field_starts_)[i];
+        context.source = &source;
+      }
+      auto data = std::make_shared<ArrayData>();
+      RETURN_NOT_OK(LoadArray(type, &context, data.get()));
+      if (data->length != metadata_->length()) {
+        return Status::IOError("Array length did not match record batch length");
+      }
+      if (offset_ != 0 || num_rows_ != data->length) {
+        data = MakeArray(data)->Slice(offset_, num_rows_)->data();
+      }
+      columns_[i] = std::move(data);
+    }
+    *out = columns_[i];
+    return Status::OK();
+  }
+
+  // A batch of all the columns, loaded
+  Status Load(std::shared_ptr<RecordBatch>* out) const {
+    std::lock_guard<std::mutex> guard(lock_);
+    std::vector<std::shared_ptr<ArrayData>> columns(columns_.size());
+    for (size_t i = 0; i < columns_.size(); ++i) {
+      RETURN_NOT_OK(LoadColumn(static_cast<int>(i), &columns[i]));
+    }
+    *out = RecordBatch::Make(schema_, num_rows_, std::move(columns));
+    return Status::OK();
+  }
+
+  // The first row of the batch in that of the file
+  int64_t offset_;
+  std::shared_ptr<Message> message_;
+  const flatbuf::RecordBatch* metadata_;
+  std::shared_ptr<const std::vector<ArrayLoaderContext>> field_starts_;
+  io::RandomAccessFile* file_;
+  std::shared_ptr<io::RandomAccessFile> owned_file_;
+  int64_t body_offset_;
+
+  mutable std::mutex lock_;
+  mutable std::vector<std::shared_ptr<ArrayData>> columns_;
+  mutable std::vector<std::shared_ptr<Array>> boxed_columns_;
+};
+
+// Read a record batch into the ArrayData of the previous one, see
+// LoadRecordBatchFromSource
+static Status ReadRecordBatch(const Message& message,
+                              const std::shared_ptr<Schema>& schema,
+                              std::vector<std::shared_ptr<ArrayData>>* reusable_columns,
+                              int64_t* num_reused, std::shared_ptr<RecordBatch>* out) {
+  auto fb_message = flatbuf::GetMessage(message.metadata()->data());
+  if (fb_message->header_type() != flatbuf::MessageHeader_RecordBatch ||
+      fb_message->header() == nullptr) {
+    return Status::IOError("Message is not a record batch, likely malformed");
+  }
+  auto batch = reinterpret_cast<const flatbuf::RecordBatch*>(fb_message->header());
+  io::BufferReader reader(message.body());
+  IpcComponentSource source(batch, &reader);
+  RETURN_NOT_OK(source.PrefetchCompressed());
+  return LoadRecordBatchFromSource(schema, batch->length(), kMaxNestingDepth, &source,
+                                   reusable_columns, num_reused, out);
 }
 
 Status ReadDictionary(const Buffer& metadata, const DictionaryTypeMap& dictionary_types,
@@ -360,7 +885,7 @@ Status ReadDictionary(const Buffer& metadata, const DictionaryTypeMap& dictionar
   auto batch_meta =
       reinterpret_cast<const flatbuf::RecordBatch*>(dictionary_batch->data());
   RETURN_NOT_OK(
-      ReadRecordBatch(batch_meta, dummy_schema, kMaxNestingDepth, file, &batch));
+      ReadRecordBatch(batch_meta, dummy_schema, kMaxNestingDepth, true, file, &batch));
   if (batch->num_columns() != 1) {
     return Status::Invalid("Dictionary record batch must only contain one field");
   }
@@ -370,7 +895,8 @@ Status ReadDictionary(const Buffer& metadata, const DictionaryTypeMap& dictionar
 }
 
 static Status ReadMessageAndValidate(MessageReader* reader, Message::Type expected_type,
-                                     bool allow_null, std::unique_ptr<Message>* message) {
+                                     bool allow_null, std::unique_ptr<Message>* message,
+                                     bool verify_checksums = false) {
   RETURN_NOT_OK(reader->ReadNextMessage(message));
 
   if (!(*message) && !allow_null) {
@@ -390,6 +916,9 @@ static Status ReadMessageAndValidate(MessageReader* reader, Message::Type expect
        << ", was: " << (*message)->type();
     return Status::IOError(ss.str());
   }
+  if (verify_checksums) {
+    RETURN_NOT_OK((*message)->VerifyChecksums());
+  }
   return Status::OK();
 }
 
@@ -402,7 +931,8 @@ static inline FileBlock FileBlockFromFlatbuffer(const flatbuf::Block* block) {
 
 class RecordBatchStreamReader::RecordBatchStreamReaderImpl {
  public:
-  RecordBatchStreamReaderImpl() {}
+  explicit RecordBatchStreamReaderImpl(const StreamReadOptions& options)
+      : options_(options) {}
   ~RecordBatchStreamReaderImpl() {}
 
   Status Open(std::unique_ptr<MessageReader> message_reader) {
@@ -413,7 +943,7 @@ class RecordBatchStreamReader::RecordBatchStreamReaderImpl {
   Status ReadNextDictionary() {
     std::unique_ptr<Message> message;
     RETURN_NOT_OK(ReadMessageAndValidate(message_reader_.get(), Message::DICTIONARY_BATCH,
-                                         false, &message));
+                                         false, &message, options_.verify_checksums));
 
     io::BufferReader reader(message->body());
 
@@ -426,8 +956,8 @@ class RecordBatchStreamReader::RecordBatchStreamReaderImpl {
 
   Status ReadSchema() {
     std::unique_ptr<Message> message;
-    RETURN_NOT_OK(
-        ReadMessageAndValidate(message_reader_.get(), Message::SCHEMA, false, &message));
+    RETURN_NOT_OK(ReadMessageAndValidate(message_reader_.get(), Message::SCHEMA, false,
+                                         &message, options_.verify_checksums));
 
     if (message->header() == nullptr) {
       return Status::IOError("Header-pointer of flatbuffer-encoded Message is null.");
@@ -441,28 +971,108 @@ class RecordBatchStreamReader::RecordBatchStreamReaderImpl {
       RETURN_NOT_OK(ReadNextDictionary());
     }
 
-    return internal::GetSchema(message->header(), dictionary_memo_, &schema_);
+    RETURN_NOT_OK(internal::GetSchema(message->header(), dictionary_memo_, &schema_));
+    // Kept to rebuild the schema when dictionaries grow
+    schema_message_ = std::move(message);
+    return Status::OK();
+  }
+
+  Status ReadNextMessage(std::unique_ptr<Message>* message) {
+    RETURN_NOT_OK(message_reader_->ReadNextMessage(message));
+    if (*message != nullptr && options_.verify_checksums) {
+      RETURN_NOT_OK((*message)->VerifyChecksums());
+    }
+    return Status::OK();
+  }
+
+  // Append the entries of a delta dictionary batch to their dictionary, and
+  // update the schema with it
+  Status ReadDictionaryDelta(const Message& message) {
+    auto dictionary_batch = reinterpret_cast<const flatbuf::DictionaryBatch*>(
+        flatbuf::GetMessage(message.metadata()->data())->header());
+    if (dictionary_batch == nullptr || !dictionary_batch->isDelta()) {
+      return Status::NotImplemented(
+          "Dictionary batches following record batches in a stream must be deltas");
+    }
+
+    io::BufferReader reader(message.body());
+    std::shared_ptr<Array> delta;
+    int64_t id;
+    RETURN_NOT_OK(
+        ReadDictionary(*message.metadata(), dictionary_types_, &reader, &id, &delta));
+    RETURN_NOT_OK(dictionary_memo_.AddDictionaryDelta(id, delta, default_memory_pool()));
+    return internal::GetSchema(schema_message_->header(), dictionary_memo_, &schema_);
   }
 
   Status ReadNext(std::shared_ptr<RecordBatch>* batch) {
+    ARROW_TRACE_SPAN(span, "ipc", "RecordBatchStreamReader::ReadNext");
+    if (options_.reuse_buffers) {
+      // Release the buffers of the last batch if the caller is done with it,
+      // so that the message reader can reuse them
+      for (auto& column : columns_) {
+        if (!ResetIfUnique(column)) {
+          column = nullptr;
+        }
+      }
+    }
+
+    // Delta dictionary batches may precede the record batch
     std::unique_ptr<Message> message;
-    RETURN_NOT_OK(ReadMessageAndValidate(message_reader_.get(), Message::RECORD_BATCH,
-                                         true, &message));
+    RETURN_NOT_OK(ReadNextMessage(&message));
+    while (message != nullptr && message->type() == Message::DICTIONARY_BATCH) {
+      const auto start = std::chrono::steady_clock::now();
+      RETURN_NOT_OK(ReadDictionaryDelta(*message));
+      RecordDecodeTime(start);
+      RETURN_NOT_OK(ReadNextMessage(&message));
+    }
 
     if (message == nullptr) {
       // End of stream
       *batch = nullptr;
       return Status::OK();
     }
+    ARROW_TRACE_BYTES(span, message->body() ? message->body()->size() : 0);
+    if (message->type() != Message::RECORD_BATCH) {
+      std::stringstream ss;
+      ss << "Message not expected type: " << FormatMessageType(Message::RECORD_BATCH)
+         << ", was: " << message->type();
+      return Status::IOError(ss.str());
+    }
 
-    io::BufferReader reader(message->body());
-    return ReadRecordBatch(*message->metadata(), schema_, &reader, batch);
+    const auto start = std::chrono::steady_clock::now();
+    if (options_.reuse_buffers) {
+      RETURN_NOT_OK(ReadRecordBatch(*message, schema_, &columns_,
+                                    &stats_.num_reused_array_data, batch));
+    } else {
+      io::BufferReader reader(message->body());
+      RETURN_NOT_OK(ReadRecordBatch(*message->metadata(), schema_, &reader, batch));
+    }
+    ++stats_.num_record_batches;
+    RecordDecodeTime(start);
+    return Status::OK();
   }
 
   std::shared_ptr<Schema> schema() const { return schema_; }
 
+  StreamReadStats stats() const { return stats_; }
+
  private:
+  void RecordDecodeTime(std::chrono::steady_clock::time_point start) {
+    const int64_t nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                              std::chrono::steady_clock::now() - start)
+                              .count();
+    ++stats_.num_messages;
+    stats_.total_decode_nanos += nanos;
+    stats_.last_decode_nanos = nanos;
+  }
+
+  StreamReadOptions options_;
+  StreamReadStats stats_;
+  // The columns of the last batch, to load the next one into
+  std::vector<std::shared_ptr<ArrayData>> columns_;
+
   std::unique_ptr<MessageReader> message_reader_;
+  std::unique_ptr<Message> schema_message_;
 
   // dictionary_id -> type
   DictionaryTypeMap dictionary_types_;
@@ -470,16 +1080,21 @@ class RecordBatchStreamReader::RecordBatchStreamReaderImpl {
   std::shared_ptr<Schema> schema_;
 };
 
-RecordBatchStreamReader::RecordBatchStreamReader() {
-  impl_.reset(new RecordBatchStreamReaderImpl());
-}
+RecordBatchStreamReader::RecordBatchStreamReader() {}
 
 RecordBatchStreamReader::~RecordBatchStreamReader() {}
 
 Status RecordBatchStreamReader::Open(std::unique_ptr<MessageReader> message_reader,
                                      std::shared_ptr<RecordBatchReader>* reader) {
+  return Open(std::move(message_reader), StreamReadOptions(), reader);
+}
+
+Status RecordBatchStreamReader::Open(std::unique_ptr<MessageReader> message_reader,
+                                     const StreamReadOptions& options,
+                                     std::shared_ptr<RecordBatchReader>* reader) {
   // Private ctor
   auto result = std::shared_ptr<RecordBatchStreamReader>(new RecordBatchStreamReader());
+  result->impl_.reset(new RecordBatchStreamReaderImpl(options));
   RETURN_NOT_OK(result->impl_->Open(std::move(message_reader)));
   *reader = result;
   return Status::OK();
@@ -490,6 +1105,12 @@ Status RecordBatchStreamReader::Open(io::InputStream* stream,
   return Open(MessageReader::Open(stream), out);
 }
 
+Status RecordBatchStreamReader::Open(io::InputStream* stream,
+                                     const StreamReadOptions& options,
+                                     std::shared_ptr<RecordBatchReader>* out) {
+  return Open(MessageReader::Open(stream, options.reuse_buffers), options, out);
+}
+
 Status RecordBatchStreamReader::Open(const std::shared_ptr<io::InputStream>& stream,
                                      std::shared_ptr<RecordBatchReader>* out) {
   return Open(MessageReader::Open(stream), out);
@@ -503,12 +1124,20 @@ Status RecordBatchStreamReader::ReadNext(std::shared_ptr<RecordBatch>* batch) {
   return impl_->ReadNext(batch);
 }
 
+StreamReadStats RecordBatchStreamReader::stats() const { return impl_->stats(); }
+
 // ----------------------------------------------------------------------
 // Reader implementation
 
 class RecordBatchFileReader::RecordBatchFileReaderImpl {
  public:
-  RecordBatchFileReaderImpl() { dictionary_memo_ = std::make_shared<DictionaryMemo>(); }
+  RecordBatchFileReaderImpl() : verify_checksums_(true) {
+    dictionary_memo_ = std::make_shared<DictionaryMemo>();
+  }
+
+  void set_verify_checksums(bool verify_checksums) {
+    verify_checksums_ = verify_checksums;
+  }
 
   Status ReadFooter() {
     int magic_size = static_cast<int>(strlen(kArrowMagicBytes));
@@ -567,6 +1196,10 @@ class RecordBatchFileReader::RecordBatchFileReaderImpl {
   }
 
   Status ReadRecordBatch(int i, std::shared_ptr<RecordBatch>* batch) {
+    return ReadRecordBatch(i, true, batch);
+  }
+
+  Status ReadRecordBatch(int i, bool use_threads, std::shared_ptr<RecordBatch>* batch) {
     DCHECK_GE(i, 0);
     DCHECK_LT(i, num_record_batches());
     FileBlock block = record_batch(i);
@@ -575,11 +1208,78 @@ class RecordBatchFileReader::RecordBatchFileReaderImpl {
     DCHECK(BitUtil::IsMultipleOf8(block.metadata_length));
     DCHECK(BitUtil::IsMultipleOf8(block.body_length));
 
+    // Let files reading ahead, as memory maps do, fetch this batch and the
+    // next one while the caller works on the batches returned so far
+    std::vector<io::ReadRange> ranges = {
+        {block.offset, block.metadata_length + block.body_length}};
+    if (i + 1 < num_record_batches()) {
+      FileBlock next = record_batch(i + 1);
+      ranges.push_back({next.offset, next.metadata_length + next.body_length});
+    }
+    RETURN_NOT_OK(file_->WillNeed(ranges));
+
     std::unique_ptr<Message> message;
     RETURN_NOT_OK(ReadMessage(block.offset, block.metadata_length, file_, &message));
+    if (verify_checksums_) {
+      RETURN_NOT_OK(message->VerifyChecksums());
+    }
 
     io::BufferReader reader(message->body());
-    return ::arrow::ipc::ReadRecordBatch(*message->metadata(), schema_, &reader, batch);
+    return ::arrow::ipc::ReadRecordBatch(*message->metadata(), schema_, kMaxNestingDepth,
+                                         use_threads, &reader, batch);
+  }
+
+  Status ReadRecordBatch(int i, const std::vector<int>& columns,
+                         std::shared_ptr<RecordBatch>* batch) {
+    std::unique_ptr<Message> message;
+    int64_t body_offset;
+    RETURN_NOT_OK(ReadRecordBatchMetadata(i, &message, &body_offset));
+    return ::arrow::ipc::ReadRecordBatch(*message->metadata(), schema_, columns,
+                                         kMaxNestingDepth, file_, body_offset, batch);
+  }
+
+  Status ReadLazyRecordBatch(int i, std::shared_ptr<RecordBatch>* batch) {
+    std::unique_ptr<Message> message;
+    int64_t body_offset;
+    RETURN_NOT_OK(ReadRecordBatchMetadata(i, &message, &body_offset));
+    auto fb_message = flatbuf::GetMessage(message->metadata()->data());
+    if (fb_message->header_type() != flatbuf::MessageHeader_RecordBatch ||
+        fb_message->header() == nullptr) {
+      return Status::IOError("Message is not a record batch, likely malformed");
+    }
+    auto metadata = reinterpret_cast<const flatbuf::RecordBatch*>(fb_message->header());
+
+    std::shared_ptr<const std::vector<ArrayLoaderContext>> field_starts;
+    {
+      std::lock_guard<std::mutex> guard(field_starts_lock_);
+      if (field_starts_ == nullptr) {
+        auto starts = std::make_shared<std::vector<ArrayLoaderContext>>();
+        RETURN_NOT_OK(GetFieldStarts(metadata, *schema_, starts.get()));
+        field_starts_ = starts;
+      }
+      field_starts = field_starts_;
+    }
+    *batch = std::make_shared<LazyRecordBatch>(
+        schema_, 0, metadata->length(), std::shared_ptr<Message>(std::move(message)),
+        metadata, field_starts, file_, owned_file_, body_offset);
+    return Status::OK();
+  }
+
+  Status ReadTable(std::shared_ptr<Table>* out, bool use_threads) {
+    const int num_batches = num_record_batches();
+    std::vector<std::shared_ptr<RecordBatch>> batches(num_batches);
+    if (use_threads && num_batches > 1) {
+      // One task per batch; the batches are not themselves read with
+      // parallel tasks, which would wait on the pool from within it
+      RETURN_NOT_OK(ParallelFor(num_batches, [this, &batches](int i) {
+        return ReadRecordBatch(i, false, &batches[i]);
+      }));
+    } else {
+      for (int i = 0; i < num_batches; ++i) {
+        RETURN_NOT_OK(ReadRecordBatch(i, use_threads, &batches[i]));
+      }
+    }
+    return Table::FromRecordBatches(schema_, batches, out);
   }
 
   Status ReadSchema() {
@@ -595,6 +1295,8 @@ class RecordBatchFileReader::RecordBatchFileReaderImpl {
 
       std::unique_ptr<Message> message;
       RETURN_NOT_OK(ReadMessage(block.offset, block.metadata_length, file_, &message));
+      // Dictionaries are read on opening, before set_verify_checksums
+      RETURN_NOT_OK(message->VerifyChecksums());
 
       io::BufferReader reader(message->body());
 
@@ -623,7 +1325,110 @@ class RecordBatchFileReader::RecordBatchFileReaderImpl {
 
   std::shared_ptr<Schema> schema() const { return schema_; }
 
+  bool has_statistics() const { return footer_->statistics() != nullptr; }
+
+  Status GetStatistics(int i, std::vector<ColumnStatistics>* out) const {
+    out->resize(schema_->num_fields());
+    for (int column = 0; column < schema_->num_fields(); ++column) {
+      const flatbuf::ColumnStatistics* statistics;
+      RETURN_NOT_OK(GetColumnStatistics(i, column, &statistics));
+      ColumnStatistics& stats = (*out)[column];
+      stats.null_count = statistics->nullCount();
+      stats.has_range = statistics->hasRange();
+      stats.int_min = statistics->intMin();
+      stats.int_max = statistics->intMax();
+      stats.float_min = statistics->floatMin();
+      stats.float_max = statistics->floatMax();
+    }
+    return Status::OK();
+  }
+
+  template <typename T>
+  Status FindRecordBatches(int column, T lower, T upper, std::vector<int>* out) const {
+    if (column < 0 || column >= schema_->num_fields()) {
+      std::stringstream ss;
+      ss << "Column index " << column << " out of range for a schema of "
+         << schema_->num_fields() << " fields";
+      return Status::Invalid(ss.str());
+    }
+    const bool floating = std::is_floating_point<T>::value;
+    const auto range = internal::GetStatisticsRange(schema_->field(column)->type()->id());
+    if ((range == internal::StatisticsRange::FLOATING) != floating &&
+        range != internal::StatisticsRange::NONE) {
+      return Status::Invalid(floating ? "Column has no floating point values"
+                                      : "Column has floating point values");
+    }
+    out->clear();
+    for (int i = 0; i < num_record_batches(); ++i) {
+      if (has_statistics() && range != internal::StatisticsRange::NONE) {
+        const flatbuf::ColumnStatistics* statistics;
+        RETURN_NOT_OK(GetColumnStatistics(i, column, &statistics));
+        // Without a range, the values are all null
+        if (!statistics->hasRange()) {
+          continue;
+        }
+        T min, max;
+        if (floating) {
+          min = static_cast<T>(statistics->floatMin());
+          max = static_cast<T>(statistics->floatMax());
+        } else {
+          min = static_cast<T>(statistics->intMin());
+          max = static_cast<T>(statistics->intMax());
+        }
+        if (max < lower || min > upper) {
+          continue;
+        }
+      }
+      out->push_back(i);
+    }
+    return Status::OK();
+  }
+
  private:
+  Status GetColumnStatistics(int i, int column,
+                             const flatbuf::ColumnStatistics** out) const {
+    auto statistics = footer_->statistics();
+    if (statistics == nullptr) {
+      return Status::Invalid("File has no record batch statistics");
+    }
+    if (i < 0 || i >= static_cast<int>(statistics->size())) {
+      return Status::Invalid("Record batch index out of range of the statistics");
+    }
+    auto columns = statistics->Get(i)->columns();
+    if (columns == nullptr ||
+        static_cast<int>(columns->size()) != schema_->num_fields()) {
+      return Status::IOError("Statistics do not match the schema, likely malformed");
+    }
+    *out = columns->Get(column);
+    return Status::OK();
+  }
+
+  // Read the metadata of a record batch alone, and find where its body starts
+  Status ReadRecordBatchMetadata(int i, std::unique_ptr<Message>* message,
+                                 int64_t* body_offset) {
+    DCHECK_GE(i, 0);
+    DCHECK_LT(i, num_record_batches());
+    FileBlock block = record_batch(i);
+
+    DCHECK(BitUtil::IsMultipleOf8(block.offset));
+    DCHECK(BitUtil::IsMultipleOf8(block.metadata_length));
+    DCHECK(BitUtil::IsMultipleOf8(block.body_length));
+
+    std::shared_ptr<Buffer> buffer;
+    RETURN_NOT_OK(file_->ReadAt(block.offset, block.metadata_length, &buffer));
+    if (block.metadata_length <= static_cast<int32_t>(sizeof(int32_t)) ||
+        buffer->size() < block.metadata_length) {
+      std::stringstream ss;
+      ss << "Expected to read " << block.metadata_length << " metadata bytes but got "
+         << buffer->size();
+      return Status::Invalid(ss.str());
+    }
+    RETURN_NOT_OK(
+        Message::Open(SliceBuffer(buffer, 4, buffer->size() - 4), nullptr, message));
+    *body_offset = block.offset + block.metadata_length;
+    return Status::OK();
+  }
+
   io::RandomAccessFile* file_;
 
   std::shared_ptr<io::RandomAccessFile> owned_file_;
@@ -641,6 +1446,12 @@ class RecordBatchFileReader::RecordBatchFileReaderImpl {
 
   // Reconstructed schema, including any read dictionaries
   std::shared_ptr<Schema> schema_;
+
+  // Where the fields of lazy batches start, found with the first one read
+  std::shared_ptr<const std::vector<ArrayLoaderContext>> field_starts_;
+  std::mutex field_starts_lock_;
+
+  bool verify_checksums_;
 };
 
 RecordBatchFileReader::RecordBatchFileReader() {
@@ -689,6 +1500,47 @@ Status RecordBatchFileReader::ReadRecordBatch(int i,
   return impl_->ReadRecordBatch(i, batch);
 }
 
+Result<std::shared_ptr<RecordBatch>> RecordBatchFileReader::ReadRecordBatch(int i) {
+  std::shared_ptr<RecordBatch> batch;
+  RETURN_NOT_OK(impl_->ReadRecordBatch(i, &batch));
+  return std::move(batch);
+}
+
+Status RecordBatchFileReader::ReadTable(std::shared_ptr<Table>* out, bool use_threads) {
+  return impl_->ReadTable(out, use_threads);
+}
+
+Status RecordBatchFileReader::ReadRecordBatch(int i, const std::vector<int>& columns,
+                                              std::shared_ptr<RecordBatch>* batch) {
+  return impl_->ReadRecordBatch(i, columns, batch);
+}
+
+bool RecordBatchFileReader::has_statistics() const { return impl_->has_statistics(); }
+
+Status RecordBatchFileReader::GetStatistics(int i,
+                                            std::vector<ColumnStatistics>* out) const {
+  return impl_->GetStatistics(i, out);
+}
+
+Status RecordBatchFileReader::FindRecordBatches(int column, int64_t lower, int64_t upper,
+                                                std::vector<int>* out) const {
+  return impl_->FindRecordBatches(column, lower, upper, out);
+}
+
+Status RecordBatchFileReader::FindRecordBatches(int column, double lower, double upper,
+                                                std::vector<int>* out) const {
+  return impl_->FindRecordBatches(column, lower, upper, out);
+}
+
+Status RecordBatchFileReader::ReadLazyRecordBatch(int i,
+                                                  std::shared_ptr<RecordBatch>* batch) {
+  return impl_->ReadLazyRecordBatch(i, batch);
+}
+
+void RecordBatchFileReader::set_verify_checksums(bool verify_checksums) {
+  impl_->set_verify_checksums(verify_checksums);
+}
+
 static Status ReadContiguousPayload(io::InputStream* file, bool aligned,
                                     std::unique_ptr<Message>* message) {
   RETURN_NOT_OK(ReadMessage(file, aligned, message));
@@ -737,7 +1589,102 @@ Status ReadTensor(const Message& message, std::shared_ptr<Tensor>* out) {
   std::vector<std::string> dim_names;
   RETURN_NOT_OK(internal::GetTensorMetadata(*message.metadata(), &type, &shape, &strides,
                                             &dim_names));
-  *out = std::make_shared<Tensor>(type, message.body(), shape, strides, dim_names);
+  // The tensor is the body, as in a memory map or shared memory written to by
+  // WriteTensor, whose data is aligned; a body whose cells are not aligned is
+  // copied to one.
+  std::shared_ptr<Buffer> body = message.body();
+  if (body != nullptr && is_tensor_supported(type->id())) {
+    const int cell_size = checked_cast<const FixedWidthType&>(*type).bit_width() / 8;
+    if (reinterpret_cast<uintptr_t>(body->data()) % cell_size != 0) {
+      std::shared_ptr<Buffer> aligned;
+      RETURN_NOT_OK(AllocateBuffer(default_memory_pool(), body->size(), &aligned));
+      std::memcpy(aligned->mutable_data(), body->data(),
+                  static_cast<size_t>(body->size()));
+      body = aligned;
+    }
+  }
+  *out = std::make_shared<Tensor>(type, body, shape, strides, dim_names);
+  return Status::OK();
+}
+
+Status ReadSparseTensor(int64_t offset, io::RandomAccessFile* file,
+                        std::shared_ptr<SparseTensor>* out) {
+  // Respect alignment of SparseTensor messages (see WriteSparseTensor)
+  offset = PaddedLength(offset);
+  RETURN_NOT_OK(file->Seek(offset));
+
+  std::unique_ptr<Message> message;
+  RETURN_NOT_OK(ReadContiguousPayload(file, true /* aligned */, &message));
+  return ReadSparseTensor(*message, out);
+}
+
+Status ReadSparseTensor(const Message& message, std::shared_ptr<SparseTensor>* out) {
+  if (message.type() != Message::SPARSE_TENSOR) {
+    return Status::Invalid("Expected sparse tensor message, got " +
+                           FormatMessageType(message.type()));
+  }
+  std::shared_ptr<DataType> type;
+  std::vector<int64_t> shape;
+  std::vector<std::string> dim_names;
+  int64_t length;
+  SparseTensorFormat::type format_id;
+  std::vector<internal::BufferMetadata> buffer_meta;
+  RETURN_NOT_OK(internal::GetSparseTensorMetadata(*message.metadata(), &type, &shape,
+                                                  &dim_names, &length, &format_id,
+                                                  &buffer_meta));
+  if (!is_tensor_supported(type->id())) {
+    return Status::Invalid("Sparse tensor of unsupported type " + type->ToString());
+  }
+  if (format_id == SparseTensorFormat::CSR && shape.size() != 2) {
+    return Status::Invalid("CSR sparse tensor must have 2 dimensions");
+  }
+  const int64_t ndim = static_cast<int64_t>(shape.size());
+  const int64_t index_size = static_cast<int64_t>(sizeof(int64_t));
+  const auto& fw_type = checked_cast<const FixedWidthType&>(*type);
+  std::vector<int64_t> expected_sizes;
+  if (format_id == SparseTensorFormat::COO) {
+    expected_sizes.push_back(length * ndim * index_size);
+  } else {
+    expected_sizes.push_back((shape[0] + 1) * index_size);
+    expected_sizes.push_back(length * index_size);
+  }
+  expected_sizes.push_back(length * (fw_type.bit_width() / 8));
+
+  // The buffers are slices of the body, which is not copied; an unaligned
+  // body, as from a stream, is copied to keep the indices aligned
+  std::shared_ptr<Buffer> body = message.body();
+  const int64_t body_size = body == nullptr ? 0 : body->size();
+  if (body != nullptr && reinterpret_cast<uintptr_t>(body->data()) % index_size != 0) {
+    std::shared_ptr<Buffer> aligned;
+    RETURN_NOT_OK(AllocateBuffer(default_memory_pool(), body_size, &aligned));
+    std::memcpy(aligned->mutable_data(), body->data(), static_cast<size_t>(body_size));
+    body = aligned;
+  }
+  std::vector<std::shared_ptr<Buffer>> buffers;
+  for (size_t i = 0; i < buffer_meta.size(); ++i) {
+    const auto& meta = buffer_meta[i];
+    if (length < 0 || meta.length != expected_sizes[i] || meta.offset < 0 ||
+        meta.offset + meta.length > body_size) {
+      return Status::Invalid("Sparse tensor buffer out of bounds of the message body");
+    }
+    buffers.push_back(meta.length == 0 ? std::make_shared<Buffer>(nullptr, 0)
+                                       : SliceBuffer(body, meta.offset, meta.length));
+  }
+
+  std::shared_ptr<SparseIndex> sparse_index;
+  if (format_id == SparseTensorFormat::COO) {
+    auto coords = std::make_shared<Tensor>(int64(), buffers[0],
+                                           std::vector<int64_t>{length, ndim});
+    sparse_index = std::make_shared<SparseCOOIndex>(coords);
+  } else {
+    auto indptr =
+        std::make_shared<Tensor>(int64(), buffers[0], std::vector<int64_t>{shape[0] + 1});
+    auto indices =
+        std::make_shared<Tensor>(int64(), buffers[1], std::vector<int64_t>{length});
+    sparse_index = std::make_shared<SparseCSRIndex>(indptr, indices);
+  }
+  *out = std::make_shared<SparseTensor>(type, buffers.back(), shape, sparse_index,
+                                        dim_names);
   return Status::OK();
 }
 
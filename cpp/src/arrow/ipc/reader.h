@@ -22,16 +22,20 @@
 
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 #include "arrow/ipc/message.h"
 #include "arrow/record_batch.h"
+#include "arrow/result.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
 
 class Buffer;
 class Schema;
+class SparseTensor;
 class Status;
+class Table;
 class Tensor;
 
 namespace io {
@@ -45,12 +49,60 @@ namespace ipc {
 
 using RecordBatchReader = ::arrow::RecordBatchReader;
 
+/// \brief Options of RecordBatchStreamReader
+struct ARROW_EXPORT StreamReadOptions {
+  /// \brief Read messages into the buffers of the previous message, and load
+  /// record batches into the ArrayData of the previous batch, whenever the
+  /// caller no longer holds on to them
+  ///
+  /// This saves most allocations in streams of many small record batches
+  /// read one after the other. Only streams read from an InputStream reuse
+  /// message buffers, see MessageReader::Open.
+  bool reuse_buffers = false;
+
+  /// \brief Check the checksums of the messages written with them, see
+  /// RecordBatchStreamWriter::set_checksum, failing with IOError on mismatch
+  bool verify_checksums = true;
+};
+
+/// \brief What a RecordBatchStreamReader did so far
+struct ARROW_EXPORT StreamReadStats {
+  /// The messages read after the schema and its dictionaries
+  int64_t num_messages = 0;
+  int64_t num_record_batches = 0;
+  /// The ArrayData of columns reused from the previous batch
+  int64_t num_reused_array_data = 0;
+  /// The time taken to decode messages into record batches, reading them
+  /// from the stream excluded, in nanoseconds, in total and for the last one
+  int64_t total_decode_nanos = 0;
+  int64_t last_decode_nanos = 0;
+};
+
+/// \brief Statistics of a column in a record batch of a file, kept in the
+/// footer when the file is written with
+/// RecordBatchFileWriter::set_write_statistics
+struct ARROW_EXPORT ColumnStatistics {
+  int64_t null_count = 0;
+  /// \brief Whether the range of the non-null values is known: in int_min and
+  /// int_max for integer, date, time and timestamp columns, in float_min and
+  /// float_max for floating point ones. NaN values are left out
+  bool has_range = false;
+  int64_t int_min = 0;
+  int64_t int_max = 0;
+  double float_min = 0;
+  double float_max = 0;
+};
+
 /// \class RecordBatchStreamReader
 /// \brief Synchronous batch stream reader that reads from io::InputStream
 ///
 /// This class reads the schema (plus any dictionaries) as the first messages
 /// in the stream, followed by record batches. For more granular zero-copy
 /// reads see the ReadRecordBatch functions
+///
+/// Delta dictionary batches between record batches append entries to their
+/// dictionary; the record batches read next, and schema(), then have the
+/// grown dictionary.
 class ARROW_EXPORT RecordBatchStreamReader : public RecordBatchReader {
  public:
   ~RecordBatchStreamReader() override;
@@ -63,6 +115,16 @@ class ARROW_EXPORT RecordBatchStreamReader : public RecordBatchReader {
   static Status Open(std::unique_ptr<MessageReader> message_reader,
                      std::shared_ptr<RecordBatchReader>* out);
 
+  /// Create batch reader from generic MessageReader
+  ///
+  /// \param[in] message_reader a MessageReader implementation
+  /// \param[in] options how to read the record batches
+  /// \param[out] out the created RecordBatchReader object
+  /// \return Status
+  static Status Open(std::unique_ptr<MessageReader> message_reader,
+                     const StreamReadOptions& options,
+                     std::shared_ptr<RecordBatchReader>* out);
+
   /// \brief Record batch stream reader from InputStream
   ///
   /// \param[in] stream an input stream instance. Must stay alive throughout
@@ -71,6 +133,16 @@ class ARROW_EXPORT RecordBatchStreamReader : public RecordBatchReader {
   /// \return Status
   static Status Open(io::InputStream* stream, std::shared_ptr<RecordBatchReader>* out);
 
+  /// \brief Record batch stream reader from InputStream
+  ///
+  /// \param[in] stream an input stream instance. Must stay alive throughout
+  /// lifetime of stream reader
+  /// \param[in] options how to read the record batches
+  /// \param[out] out the created RecordBatchStreamReader object
+  /// \return Status
+  static Status Open(io::InputStream* stream, const StreamReadOptions& options,
+                     std::shared_ptr<RecordBatchReader>* out);
+
   /// \brief Open stream and retain ownership of stream object
   /// \param[in] stream the input stream
   /// \param[out] out the batch reader
@@ -83,6 +155,10 @@ class ARROW_EXPORT RecordBatchStreamReader : public RecordBatchReader {
 
   Status ReadNext(std::shared_ptr<RecordBatch>* batch) override;
 
+  /// \brief What the reader did so far, to tell the cost of decoding
+  /// messages
+  StreamReadStats stats() const;
+
  private:
   RecordBatchStreamReader();
 
@@ -153,6 +229,89 @@ class ARROW_EXPORT RecordBatchFileReader {
   /// \return Status
   Status ReadRecordBatch(int i, std::shared_ptr<RecordBatch>* batch);
 
+  /// \brief Read a particular record batch from the file. Does not copy memory
+  /// if the input source supports zero-copy.
+  ///
+  /// \param[in] i the index of the record batch to return
+  /// \return the read batch, or the error
+  Result<std::shared_ptr<RecordBatch>> ReadRecordBatch(int i);
+
+  /// \brief Read some columns of a particular record batch from the file
+  ///
+  /// Only the buffers of the selected columns are read, those close to each
+  /// other in the file at once, so that the cost of a read follows the size of
+  /// the columns rather than that of the whole batch.
+  ///
+  /// \param[in] i the index of the record batch to return
+  /// \param[in] columns the indices in the schema of the columns to read, in
+  /// the order they are to have in the returned batch
+  /// \param[out] batch the read batch, with a schema of the selected fields
+  /// \return Status
+  Status ReadRecordBatch(int i, const std::vector<int>& columns,
+                         std::shared_ptr<RecordBatch>* batch);
+
+  /// \brief Read a particular record batch from the file, loading each of its
+  /// columns only when first accessed
+  ///
+  /// Only the metadata of the batch is read. The first call to column or
+  /// column_data for a column decodes the metadata of that column and reads
+  /// its buffers, which a memory-mapped file does without copying, so using a
+  /// few columns of a batch of many costs little more than those columns. The
+  /// batch can be used from several threads at once. The file must stay open
+  /// for as long as columns are to be loaded.
+  ///
+  /// A column that cannot be loaded, the file being malformed, comes back
+  /// null; Validate loads all the columns and returns the error.
+  ///
+  /// \param[in] i the index of the record batch to return
+  /// \param[out] batch the batch, its columns not yet loaded
+  /// \return Status
+  Status ReadLazyRecordBatch(int i, std::shared_ptr<RecordBatch>* batch);
+
+  /// \brief Read all the record batches of the file into a table
+  ///
+  /// \param[out] out the read table, with a chunk per record batch
+  /// \param[in] use_threads read the batches in parallel on the CPU thread
+  /// pool. The file must then allow ReadAt to be called from several threads
+  /// at once, as the files of arrow::io do
+  /// \return Status
+  Status ReadTable(std::shared_ptr<Table>* out, bool use_threads = false);
+
+  /// \brief Check the checksums of the record batches read whole from now
+  /// on, failing with IOError on mismatch, on by default
+  ///
+  /// Those of the dictionaries are always checked, on opening. Batches read
+  /// by column are not checked, their body being read only in part.
+  void set_verify_checksums(bool verify_checksums);
+
+  /// \brief Whether the footer holds statistics of the record batches
+  bool has_statistics() const;
+
+  /// \brief The statistics of the columns of a record batch, from the footer
+  ///
+  /// \param[in] i the index of the record batch
+  /// \param[out] out one entry per field of the schema
+  /// \return Status, Invalid if the file has no statistics
+  Status GetStatistics(int i, std::vector<ColumnStatistics>* out) const;
+
+  /// \brief Find the record batches that may hold values of a column within a
+  /// range, going by the statistics in the footer, so as to read only those
+  ///
+  /// Every batch is found if the file has no statistics, or if the column is
+  /// of a type they have no range for.
+  ///
+  /// \param[in] column the index of the column in the schema
+  /// \param[in] lower the lower bound of the range, included
+  /// \param[in] upper the upper bound of the range, included
+  /// \param[out] out the indices of the batches found, in increasing order
+  /// \return Status, Invalid if the column has floating point values
+  Status FindRecordBatches(int column, int64_t lower, int64_t upper,
+                           std::vector<int>* out) const;
+
+  /// \brief As above, for a column of floating point values
+  Status FindRecordBatches(int column, double lower, double upper,
+                           std::vector<int>* out) const;
+
  private:
   RecordBatchFileReader();
 
@@ -237,6 +396,28 @@ Status ReadTensor(int64_t offset, io::RandomAccessFile* file,
 ARROW_EXPORT
 Status ReadTensor(const Message& message, std::shared_ptr<Tensor>* out);
 
+/// \brief EXPERIMENTAL: Read arrow::SparseTensor as encapsulated IPC message
+/// in file
+///
+/// The index and values are slices of the message body, so that reading from
+/// a memory map, or a BufferReader of a plasma object, does not copy them.
+///
+/// \param[in] offset the file location of the start of the message
+/// \param[in] file the file where the sparse tensor is located
+/// \param[out] out the read sparse tensor
+/// \return Status
+ARROW_EXPORT
+Status ReadSparseTensor(int64_t offset, io::RandomAccessFile* file,
+                        std::shared_ptr<SparseTensor>* out);
+
+/// \brief EXPERIMENTAL: Read arrow::SparseTensor from IPC message
+///
+/// \param[in] message a Message containing the sparse tensor metadata and body
+/// \param[out] out the read sparse tensor
+/// \return Status
+ARROW_EXPORT
+Status ReadSparseTensor(const Message& message, std::shared_ptr<SparseTensor>* out);
+
 }  // namespace ipc
 }  // namespace arrow
 
@@ -0,0 +1,250 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/ipc/transport.h"
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "arrow/io/interfaces.h"
+#include "arrow/io/socket.h"
+#include "arrow/ipc/reader.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/record_batch.h"
+#include "arrow/status.h"
+#include "arrow/table.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread-pool.h"
+
+namespace arrow {
+namespace ipc {
+
+namespace {
+
+Status ReadInt32(io::InputStream* stream, int32_t* out) {
+  int64_t bytes_read = 0;
+  RETURN_NOT_OK(stream->Read(sizeof(int32_t), &bytes_read, out));
+  if (bytes_read != sizeof(int32_t)) {
+    return Status::IOError("Connection closed before the end of the response");
+  }
+  return Status::OK();
+}
+
+// A string prefixed with its int32 length
+Status ReadString(io::InputStream* stream, std::string* out) {
+  int32_t length;
+  RETURN_NOT_OK(ReadInt32(stream, &length));
+  if (length < 0) {
+    return Status::IOError("Invalid string length on the wire");
+  }
+  out->resize(length);
+  int64_t bytes_read = 0;
+  RETURN_NOT_OK(stream->Read(length, &bytes_read, &(*out)[0]));
+  if (bytes_read != length) {
+    return Status::IOError("Connection closed before the end of the response");
+  }
+  return Status::OK();
+}
+
+Status WriteString(io::OutputStream* stream, const std::string& value) {
+  if (value.size() > static_cast<size_t>(std::numeric_limits<int32_t>::max())) {
+    return Status::Invalid("String too long to send");
+  }
+  const auto length = static_cast<int32_t>(value.size());
+  RETURN_NOT_OK(stream->Write(&length, sizeof(int32_t)));
+  return stream->Write(value.data(), length);
+}
+
+}  // namespace
+
+class RecordBatchStreamServer::RecordBatchStreamServerImpl {
+ public:
+  explicit RecordBatchStreamServerImpl(Handler handler)
+      : handler_(std::move(handler)), stopped_(false) {}
+
+  ~RecordBatchStreamServerImpl() { DCHECK_OK(Stop()); }
+
+  Status Start(const std::string& host, int port, int num_threads) {
+    RETURN_NOT_OK(io::TcpListener::Listen(host, port, &listener_));
+    RETURN_NOT_OK(internal::ThreadPool::Make(num_threads, &pool_));
+    acceptor_ = std::thread([this]() { AcceptConnections(); });
+    return Status::OK();
+  }
+
+  int port() const { return listener_->port(); }
+
+  Status Stop() {
+    if (stopped_.exchange(true)) {
+      return Status::OK();
+    }
+    Status status = listener_ ? listener_->Close() : Status::OK();
+    if (acceptor_.joinable()) {
+      acceptor_.join();
+    }
+    if (pool_) {
+      RETURN_NOT_OK(pool_->Shutdown());
+    }
+    return status;
+  }
+
+ private:
+  void AcceptConnections() {
+    while (!stopped_) {
+      std::shared_ptr<io::TcpConnection> connection;
+      if (!listener_->Accept(&connection).ok()) {
+        // The listener was closed, or is broken for good
+        return;
+      }
+      Status status = pool_->Spawn([this, connection]() {
+        // Nobody to tell but the client, who is told by the connection
+        // closing
+        ARROW_UNUSED(Serve(connection.get()));
+        ARROW_UNUSED(connection->Close());
+      });
+      if (!status.ok()) {
+        return;
+      }
+    }
+  }
+
+  Status Serve(io::TcpConnection* connection) {
+    std::shared_ptr<io::InputStream> input = connection->input_stream();
+    std::shared_ptr<io::OutputStream> output = connection->output_stream();
+
+    std::string ticket;
+    RETURN_NOT_OK(ReadString(input.get(), &ticket));
+
+    std::shared_ptr<RecordBatchReader> reader;
+    Status status = handler_(ticket, &reader);
+    if (status.ok() && reader == nullptr) {
+      status = Status::KeyError("No stream for ticket " + ticket);
+    }
+    const auto code = static_cast<int32_t>(status.code());
+    RETURN_NOT_OK(output->Write(&code, sizeof(int32_t)));
+    RETURN_NOT_OK(WriteString(output.get(), status.ok() ? "" : status.message()));
+    RETURN_NOT_OK(status);
+
+    std::shared_ptr<RecordBatchWriter> writer;
+    RETURN_NOT_OK(RecordBatchStreamWriter::Open(output.get(), reader->schema(), &writer));
+    std::shared_ptr<RecordBatch> batch;
+    while (true) {
+      RETURN_NOT_OK(reader->ReadNext(&batch));
+      if (batch == nullptr) {
+        break;
+      }
+      RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
+    }
+    RETURN_NOT_OK(writer->Close());
+    return connection->ShutdownOutput();
+  }
+
+  Handler handler_;
+  std::shared_ptr<io::TcpListener> listener_;
+  std::shared_ptr<internal::ThreadPool> pool_;
+  std::thread acceptor_;
+  std::atomic<bool> stopped_;
+};
+
+RecordBatchStreamServer::RecordBatchStreamServer() {}
+
+RecordBatchStreamServer::~RecordBatchStreamServer() {}
+
+Status RecordBatchStreamServer::Start(const std::string& host, int port,
+                                      Handler handler, int num_threads,
+                                      std::shared_ptr<RecordBatchStreamServer>* out) {
+  std::shared_ptr<RecordBatchStreamServer> server(new RecordBatchStreamServer());
+  server->impl_.reset(new RecordBatchStreamServerImpl(std::move(handler)));
+  RETURN_NOT_OK(server->impl_->Start(host, port, num_threads));
+  *out = server;
+  return Status::OK();
+}
+
+int RecordBatchStreamServer::port() const { return impl_->port(); }
+
+Status RecordBatchStreamServer::Stop() { return impl_->Stop(); }
+
+Status OpenRecordBatchStream(const std::string& host, int port,
+                             const std::string& ticket,
+                             std::shared_ptr<RecordBatchReader>* out) {
+  std::shared_ptr<io::TcpConnection> connection;
+  RETURN_NOT_OK(io::TcpConnection::Connect(host, port, &connection));
+  std::shared_ptr<io::InputStream> input = connection->input_stream();
+  std::shared_ptr<io::OutputStream> output = connection->output_stream();
+
+  RETURN_NOT_OK(WriteString(output.get(), ticket));
+  RETURN_NOT_OK(connection->ShutdownOutput());
+
+  int32_t code;
+  std::string message;
+  RETURN_NOT_OK(ReadInt32(input.get(), &code));
+  RETURN_NOT_OK(ReadString(input.get(), &message));
+  if (code != static_cast<int32_t>(StatusCode::OK)) {
+    return Status(static_cast<StatusCode>(code), message);
+  }
+  // The stream keeps the connection open for as long as the reader is used
+  return RecordBatchStreamReader::Open(input, out);
+}
+
+Status ReadRecordBatchStreams(const std::string& host, int port,
+                              const std::vector<std::string>& tickets,
+                              std::shared_ptr<Table>* out) {
+  if (tickets.empty()) {
+    return Status::Invalid("No tickets to fetch");
+  }
+  const auto num_streams = static_cast<int>(tickets.size());
+  std::vector<std::shared_ptr<Schema>> schemas(num_streams);
+  std::vector<std::vector<std::shared_ptr<RecordBatch>>> batches(num_streams);
+
+  // The fetches wait on the network, not the CPU, so each gets a thread of
+  // its own rather than one of the CPU pool
+  RETURN_NOT_OK(ParallelFor(num_streams, num_streams, [&](int i) -> Status {
+    std::shared_ptr<RecordBatchReader> reader;
+    RETURN_NOT_OK(OpenRecordBatchStream(host, port, tickets[i], &reader));
+    schemas[i] = reader->schema();
+    std::shared_ptr<RecordBatch> batch;
+    while (true) {
+      RETURN_NOT_OK(reader->ReadNext(&batch));
+      if (batch == nullptr) {
+        return Status::OK();
+      }
+      batches[i].push_back(batch);
+    }
+  }));
+
+  std::vector<std::shared_ptr<RecordBatch>> all_batches;
+  for (int i = 0; i < num_streams; ++i) {
+    if (!schemas[i]->Equals(*schemas[0])) {
+      std::stringstream ss;
+      ss << "Stream " << tickets[i] << " has another schema than stream "
+         << tickets[0];
+      return Status::Invalid(ss.str());
+    }
+    all_batches.insert(all_batches.end(), batches[i].begin(), batches[i].end());
+  }
+  return Table::FromRecordBatches(schemas[0], all_batches, out);
+}
+
+}  // namespace ipc
+}  // namespace arrow
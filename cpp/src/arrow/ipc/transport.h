@@ -0,0 +1,120 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Serving and fetching IPC streams of record batches over TCP
+
+#ifndef ARROW_IPC_TRANSPORT_H
+#define ARROW_IPC_TRANSPORT_H
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class RecordBatchReader;
+class Status;
+class Table;
+
+namespace ipc {
+
+/// \class RecordBatchStreamServer
+/// \brief Serves streams of record batches, each on a TCP connection of its
+/// own
+///
+/// A client sends a ticket, an opaque string naming the stream it wants,
+/// which the handler turns into a RecordBatchReader. The server answers with
+/// the status of the handler then, if it succeeded, the record batches in the
+/// IPC stream format. Their bodies are sent with a single gather write per
+/// message, straight from the buffers of the batches, without being copied
+/// into a contiguous message first.
+///
+/// On the wire, the request is the int32 length of the ticket followed by the
+/// ticket, and the response starts with the int32 code of the status and the
+/// int32 length of its message followed by the message.
+///
+/// Should reading the batches fail midway, the connection is closed without
+/// the end of the stream being marked. A client can fetch several streams at
+/// once over several connections; see ReadRecordBatchStreams.
+class ARROW_EXPORT RecordBatchStreamServer {
+ public:
+  using Handler = std::function<Status(const std::string& ticket,
+                                       std::shared_ptr<RecordBatchReader>* out)>;
+
+  ~RecordBatchStreamServer();
+
+  /// \brief Start serving on a background thread
+  /// \param[in] host the address to listen on, empty for all of them
+  /// \param[in] port the port to listen on, 0 for one chosen by the system
+  /// \param[in] handler returns the stream of a ticket. It is called from
+  /// several threads at once
+  /// \param[in] num_threads how many streams are served concurrently
+  /// \param[out] out the server
+  /// \return Status
+  static Status Start(const std::string& host, int port, Handler handler,
+                      int num_threads, std::shared_ptr<RecordBatchStreamServer>* out);
+
+  /// \brief The port served on
+  int port() const;
+
+  /// \brief Stop accepting connections and wait for the streams being
+  /// served to end
+  Status Stop();
+
+ private:
+  RecordBatchStreamServer();
+
+  class ARROW_NO_EXPORT RecordBatchStreamServerImpl;
+  std::unique_ptr<RecordBatchStreamServerImpl> impl_;
+
+  ARROW_DISALLOW_COPY_AND_ASSIGN(RecordBatchStreamServer);
+};
+
+/// \brief Fetch a stream of record batches from a RecordBatchStreamServer
+///
+/// \param[in] host the host of the server
+/// \param[in] port the port of the server
+/// \param[in] ticket the name of the stream
+/// \param[out] out the batches, read as they arrive. The reader owns the
+/// connection
+/// \return Status, that of the handler of the server when it failed
+ARROW_EXPORT
+Status OpenRecordBatchStream(const std::string& host, int port,
+                             const std::string& ticket,
+                             std::shared_ptr<RecordBatchReader>* out);
+
+/// \brief Fetch several streams of record batches of the same schema at
+/// once, each over a connection of its own, into a table
+///
+/// \param[in] host the host of the server
+/// \param[in] port the port of the server
+/// \param[in] tickets the names of the streams, at least one
+/// \param[out] out the batches of the streams, in the order of the tickets
+/// \return Status
+ARROW_EXPORT
+Status ReadRecordBatchStreams(const std::string& host, int port,
+                              const std::vector<std::string>& tickets,
+                              std::shared_ptr<Table>* out);
+
+}  // namespace ipc
+}  // namespace arrow
+
+#endif  // ARROW_IPC_TRANSPORT_H
@@ -18,28 +18,41 @@
 #include "arrow/ipc/writer.h"
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <cstdint>
 #include <cstring>
 #include <limits>
+#include <mutex>
 #include <sstream>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 
 #include "arrow/array.h"
 #include "arrow/buffer.h"
+#include "arrow/concatenate.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/io/memory.h"
 #include "arrow/ipc/message.h"
 #include "arrow/ipc/metadata-internal.h"
+#include "arrow/ipc/reader.h"
 #include "arrow/ipc/util.h"
 #include "arrow/memory_pool.h"
 #include "arrow/record_batch.h"
+#include "arrow/sparse_tensor.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
 #include "arrow/tensor.h"
 #include "arrow/type.h"
 #include "arrow/util/bit-util.h"
+#include "arrow/util/bounded-queue.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/compression.h"
+#include "arrow/util/hash-util.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/tracing.h"
 
 namespace arrow {
 namespace ipc {
@@ -87,6 +100,24 @@ inline Status GetTruncatedBuffer(int64_t offset, int64_t length,
   return Status::OK();
 }
 
+// Append the CRC32C of the body of a message, then that of its metadata, to
+// the payload of the message: payload[metadata_begin, body_begin) are the
+// metadata flatbuffer and its padding, the buffers after them the body
+static Status AppendChecksums(size_t metadata_begin, size_t body_begin, MemoryPool* pool,
+                              std::vector<std::shared_ptr<Buffer>>* payload) {
+  uint32_t checksums[2] = {0, 0};
+  for (size_t i = metadata_begin; i < payload->size(); ++i) {
+    const Buffer& buffer = *(*payload)[i];
+    uint32_t* checksum = &checksums[i < body_begin ? 1 : 0];
+    *checksum = HashUtil::Crc32c(buffer.data(), buffer.size(), *checksum);
+  }
+  std::shared_ptr<Buffer> trailer;
+  RETURN_NOT_OK(AllocateBuffer(pool, internal::kChecksumSize, &trailer));
+  std::memcpy(trailer->mutable_data(), checksums, sizeof(checksums));
+  payload->push_back(trailer);
+  return Status::OK();
+}
+
 static inline bool NeedTruncate(int64_t offset, const Buffer* buffer,
                                 int64_t min_length) {
   // buffer can be NULL
@@ -103,10 +134,18 @@ class RecordBatchSerializer : public ArrayVisitor {
       : pool_(pool),
         max_recursion_depth_(max_recursion_depth),
         buffer_start_offset_(buffer_start_offset),
-        allow_64bit_(allow_64bit) {
+        allow_64bit_(allow_64bit),
+        compression_(Compression::UNCOMPRESSED),
+        checksum_(false) {
     DCHECK_GT(max_recursion_depth, 0);
   }
 
+  // Compress each buffer of the body with the codec
+  void set_compression(Compression::type compression) { compression_ = compression; }
+
+  // End the body with the checksums of the message
+  void set_checksum(bool checksum) { checksum_ = checksum; }
+
   ~RecordBatchSerializer() override = default;
 
   Status VisitArray(const Array& arr) {
@@ -145,6 +184,18 @@ class RecordBatchSerializer : public ArrayVisitor {
       RETURN_NOT_OK(VisitArray(*batch.column(i)));
     }
 
+    // The bytes of device buffers are written, or compressed, from host
+    // copies of them
+    for (auto& buffer : buffers_) {
+      if (buffer && !buffer->is_cpu()) {
+        RETURN_NOT_OK(ViewOrCopyToHost(buffer, pool_, &buffer));
+      }
+    }
+
+    if (compression_ != Compression::UNCOMPRESSED) {
+      RETURN_NOT_OK(CompressBuffers());
+    }
+
     // The position for the start of a buffer relative to the passed frame of
     // reference. May be 0 or some other position in an address space
     int64_t offset = buffer_start_offset_;
@@ -168,44 +219,95 @@ class RecordBatchSerializer : public ArrayVisitor {
     }
 
     *body_length = offset - buffer_start_offset_;
+    if (checksum_) {
+      *body_length += internal::kChecksumSize;
+    }
     DCHECK(BitUtil::IsMultipleOf8(*body_length));
 
     return Status::OK();
   }
 
+  // The buffers are compressed in blocks, those of all the buffers in
+  // parallel, so that a large buffer is compressed on several threads. Those
+  // that don't shrink are kept uncompressed.
+  Status CompressBuffers() {
+    uncompressed_lengths_.assign(buffers_.size(), -1);
+    std::vector<int> indices;
+    std::vector<std::shared_ptr<Buffer>> inputs;
+    for (size_t i = 0; i < buffers_.size(); ++i) {
+      if (buffers_[i] && buffers_[i]->size() > 0) {
+        indices.push_back(static_cast<int>(i));
+        inputs.push_back(buffers_[i]);
+      }
+    }
+    std::vector<std::shared_ptr<Buffer>> compressed;
+    RETURN_NOT_OK(CompressBlocks(compression_, kDefaultCompressionBlockSize, inputs,
+                                 true /* use_threads */, pool_, &compressed));
+    for (size_t k = 0; k < indices.size(); ++k) {
+      if (compressed[k]->size() < inputs[k]->size()) {
+        uncompressed_lengths_[indices[k]] = inputs[k]->size();
+        buffers_[indices[k]] = compressed[k];
+      }
+    }
+    return Status::OK();
+  }
+
   // Override this for writing dictionary metadata
   virtual Status WriteMetadataMessage(int64_t num_rows, int64_t body_length,
                                       std::shared_ptr<Buffer>* out) {
+    if (compression_ != Compression::UNCOMPRESSED || checksum_) {
+      return WriteRecordBatchMessage(num_rows, body_length, field_nodes_, buffer_meta_,
+                                     compression_, uncompressed_lengths_, out, checksum_);
+    }
     return WriteRecordBatchMessage(num_rows, body_length, field_nodes_, buffer_meta_,
                                    out);
   }
 
   Status Write(const RecordBatch& batch, io::OutputStream* dst, int32_t* metadata_length,
                int64_t* body_length) {
-    RETURN_NOT_OK(Assemble(batch, body_length));
+    int64_t start_position;
+    RETURN_NOT_OK(dst->Tell(&start_position));
+
+    std::vector<std::shared_ptr<Buffer>> payload;
+    RETURN_NOT_OK(
+        GetPayload(batch, start_position, &payload, metadata_length, body_length));
+    RETURN_NOT_OK(dst->Writev(payload));
 
 #ifndef NDEBUG
-    int64_t start_position, current_position;
-    RETURN_NOT_OK(dst->Tell(&start_position));
+    int64_t current_position;
+    RETURN_NOT_OK(dst->Tell(&current_position));
+    DCHECK(BitUtil::IsMultipleOf8(current_position));
 #endif
 
+    return Status::OK();
+  }
+
+  // The buffers to write for the message of the batch, when written at
+  // start_position: the length-prefixed metadata, then the padded body
+  Status GetPayload(const RecordBatch& batch, int64_t start_position,
+                    std::vector<std::shared_ptr<Buffer>>* payload,
+                    int32_t* metadata_length, int64_t* body_length) {
+    RETURN_NOT_OK(Assemble(batch, body_length));
+
     // Now that we have computed the locations of all of the buffers in shared
-    // memory, the data header can be converted to a flatbuffer and written out
+    // memory, the data header can be converted to a flatbuffer. It is written
+    // along with the buffers in a single Writev
     //
     // Note: The memory written here is prefixed by the size of the flatbuffer
     // itself as an int32_t.
     std::shared_ptr<Buffer> metadata_fb;
     RETURN_NOT_OK(WriteMetadataMessage(batch.num_rows(), *body_length, &metadata_fb));
-    RETURN_NOT_OK(internal::WriteMessage(*metadata_fb, dst, metadata_length));
 
-#ifndef NDEBUG
-    RETURN_NOT_OK(dst->Tell(&current_position));
-    DCHECK(BitUtil::IsMultipleOf8(current_position));
-#endif
+    payload->reserve(payload->size() + buffers_.size() * 2 + 4);
+    // The metadata follows its size prefix
+    const size_t metadata_begin = payload->size() + 1;
+    RETURN_NOT_OK(internal::GetMessageBuffers(metadata_fb, start_position, payload,
+                                              metadata_length));
+    DCHECK(BitUtil::IsMultipleOf8(start_position + *metadata_length));
+    const size_t body_begin = payload->size();
 
-    // Now write the buffers
     for (size_t i = 0; i < buffers_.size(); ++i) {
-      const Buffer* buffer = buffers_[i].get();
+      const std::shared_ptr<Buffer>& buffer = buffers_[i];
       int64_t size = 0;
       int64_t padding = 0;
 
@@ -216,19 +318,19 @@ class RecordBatchSerializer : public ArrayVisitor {
       }
 
       if (size > 0) {
-        RETURN_NOT_OK(dst->Write(buffer->data(), size));
+        payload->push_back(buffer);
       }
 
       if (padding > 0) {
-        RETURN_NOT_OK(dst->Write(kPaddingBytes, padding));
+        payload->push_back(std::make_shared<Buffer>(kPaddingBytes, padding));
       }
     }
 
-#ifndef NDEBUG
-    RETURN_NOT_OK(dst->Tell(&current_position));
-    DCHECK(BitUtil::IsMultipleOf8(current_position));
-#endif
-
+    if (checksum_) {
+      // A pass over the body before writing it, the output streams not
+      // exposing the bytes as they go out
+      RETURN_NOT_OK(AppendChecksums(metadata_begin, body_begin, pool_, payload));
+    }
     return Status::OK();
   }
 
@@ -259,6 +361,7 @@ class RecordBatchSerializer : public ArrayVisitor {
   Status GetZeroBasedValueOffsets(const ArrayType& array,
                                   std::shared_ptr<Buffer>* value_offsets) {
     // Share slicing logic between ListArray and BinaryArray
+    using offset_type = typename ArrayType::TypeClass::offset_type;
 
     auto offsets = array.value_offsets();
 
@@ -268,11 +371,12 @@ class RecordBatchSerializer : public ArrayVisitor {
       // b) slice the values array accordingly
 
       std::shared_ptr<Buffer> shifted_offsets;
-      RETURN_NOT_OK(AllocateBuffer(pool_, sizeof(int32_t) * (array.length() + 1),
+      RETURN_NOT_OK(AllocateBuffer(pool_, sizeof(offset_type) * (array.length() + 1),
                                    &shifted_offsets));
 
-      int32_t* dest_offsets = reinterpret_cast<int32_t*>(shifted_offsets->mutable_data());
-      const int32_t start_offset = array.value_offset(0);
+      offset_type* dest_offsets =
+          reinterpret_cast<offset_type*>(shifted_offsets->mutable_data());
+      const offset_type start_offset = array.value_offset(0);
 
       for (int i = 0; i < array.length(); ++i) {
         dest_offsets[i] = array.value_offset(i) - start_offset;
@@ -286,9 +390,10 @@ class RecordBatchSerializer : public ArrayVisitor {
     return Status::OK();
   }
 
-  Status VisitBinary(const BinaryArray& array) {
+  template <typename ArrayType>
+  Status VisitBinary(const ArrayType& array) {
     std::shared_ptr<Buffer> value_offsets;
-    RETURN_NOT_OK(GetZeroBasedValueOffsets<BinaryArray>(array, &value_offsets));
+    RETURN_NOT_OK(GetZeroBasedValueOffsets<ArrayType>(array, &value_offsets));
     auto data = array.value_data();
 
     int64_t total_data_bytes = 0;
@@ -349,16 +454,18 @@ class RecordBatchSerializer : public ArrayVisitor {
 
   Status Visit(const BinaryArray& array) override { return VisitBinary(array); }
 
-  Status Visit(const ListArray& array) override {
+  template <typename ArrayType>
+  Status VisitList(const ArrayType& array) {
+    using offset_type = typename ArrayType::TypeClass::offset_type;
     std::shared_ptr<Buffer> value_offsets;
-    RETURN_NOT_OK(GetZeroBasedValueOffsets<ListArray>(array, &value_offsets));
+    RETURN_NOT_OK(GetZeroBasedValueOffsets<ArrayType>(array, &value_offsets));
     buffers_.push_back(value_offsets);
 
     --max_recursion_depth_;
     std::shared_ptr<Array> values = array.values();
 
-    int32_t values_offset = 0;
-    int32_t values_length = 0;
+    offset_type values_offset = 0;
+    offset_type values_length = 0;
     if (value_offsets) {
       values_offset = array.value_offset(0);
       values_length = array.value_offset(array.length()) - values_offset;
@@ -373,6 +480,41 @@ class RecordBatchSerializer : public ArrayVisitor {
     return Status::OK();
   }
 
+  Status Visit(const LargeStringArray& array) override { return VisitBinary(array); }
+
+  Status Visit(const LargeBinaryArray& array) override { return VisitBinary(array); }
+
+  Status Visit(const ListArray& array) override { return VisitList(array); }
+
+  Status Visit(const LargeListArray& array) override { return VisitList(array); }
+
+  Status Visit(const FixedSizeListArray& array) override {
+    --max_recursion_depth_;
+    std::shared_ptr<Array> values = array.values();
+    const int64_t values_offset = array.value_offset(0);
+    const int64_t values_length = array.length() * array.list_size();
+    if (values_offset != 0 || values_length < values->length()) {
+      // Must also slice the values
+      values = values->Slice(values_offset, values_length);
+    }
+    RETURN_NOT_OK(VisitArray(*values));
+    ++max_recursion_depth_;
+    return Status::OK();
+  }
+
+  Status Visit(const RunLengthEncodedArray& array) override {
+    // Write the runs of the slice only, with run ends counted from its offset
+    std::shared_ptr<Buffer> run_ends;
+    std::shared_ptr<Array> values;
+    RETURN_NOT_OK(array.RebaseRuns(pool_, &run_ends, &values));
+    buffers_.push_back(run_ends);
+
+    --max_recursion_depth_;
+    RETURN_NOT_OK(VisitArray(*values));
+    ++max_recursion_depth_;
+    return Status::OK();
+  }
+
   Status Visit(const StructArray& array) override {
     --max_recursion_depth_;
     for (int i = 0; i < array.num_fields(); ++i) {
@@ -497,6 +639,10 @@ class RecordBatchSerializer : public ArrayVisitor {
   int64_t max_recursion_depth_;
   int64_t buffer_start_offset_;
   bool allow_64bit_;
+
+  Compression::type compression_;
+  std::vector<int64_t> uncompressed_lengths_;
+  bool checksum_;
 };
 
 class DictionaryWriter : public RecordBatchSerializer {
@@ -505,13 +651,15 @@ class DictionaryWriter : public RecordBatchSerializer {
 
   Status WriteMetadataMessage(int64_t num_rows, int64_t body_length,
                               std::shared_ptr<Buffer>* out) override {
-    return WriteDictionaryMessage(dictionary_id_, num_rows, body_length, field_nodes_,
-                                  buffer_meta_, out);
+    return WriteDictionaryMessage(dictionary_id_, is_delta_, num_rows, body_length,
+                                  field_nodes_, buffer_meta_, out, checksum_);
   }
 
-  Status Write(int64_t dictionary_id, const std::shared_ptr<Array>& dictionary,
-               io::OutputStream* dst, int32_t* metadata_length, int64_t* body_length) {
+  Status Write(int64_t dictionary_id, bool is_delta,
+               const std::shared_ptr<Array>& dictionary, io::OutputStream* dst,
+               int32_t* metadata_length, int64_t* body_length) {
     dictionary_id_ = dictionary_id;
+    is_delta_ = is_delta;
 
     // Make a dummy record batch. A bit tedious as we have to make a schema
     auto schema = arrow::schema({arrow::field("dictionary", dictionary->type())});
@@ -522,6 +670,7 @@ class DictionaryWriter : public RecordBatchSerializer {
  private:
   // TODO(wesm): Setting this in Write is a bit unclean, but it works
   int64_t dictionary_id_;
+  bool is_delta_;
 };
 
 // Adds padding bytes if necessary to ensure all memory blocks are written on
@@ -571,25 +720,31 @@ Status WriteTensorHeader(const Tensor& tensor, io::OutputStream* dst,
                          int32_t* metadata_length, int64_t* body_length) {
   std::shared_ptr<Buffer> metadata;
   RETURN_NOT_OK(internal::WriteTensorMessage(tensor, 0, &metadata));
-  return internal::WriteMessage(*metadata, dst, metadata_length);
+  return internal::WriteMessage(metadata, dst, metadata_length);
 }
 
-Status WriteStridedTensorData(int dim_index, int64_t offset, int elem_size,
-                              const Tensor& tensor, uint8_t* scratch_space,
+// Slabs of the rows of a non-contiguous tensor are made contiguous before
+// being written, of about this many bytes
+constexpr int64_t kTensorSlabSize = 1 << 23;
+
+Status WriteStridedTensorData(const Tensor& tensor, MemoryPool* pool,
                               io::OutputStream* dst) {
-  if (dim_index == tensor.ndim() - 1) {
-    const uint8_t* data_ptr = tensor.raw_data() + offset;
-    const int64_t stride = tensor.strides()[dim_index];
-    for (int64_t i = 0; i < tensor.shape()[dim_index]; ++i) {
-      memcpy(scratch_space + i * elem_size, data_ptr, elem_size);
-      data_ptr += stride;
-    }
-    return dst->Write(scratch_space, elem_size * tensor.shape()[dim_index]);
+  if (tensor.size() == 0) {
+    return Status::OK();
   }
-  for (int64_t i = 0; i < tensor.shape()[dim_index]; ++i) {
-    RETURN_NOT_OK(WriteStridedTensorData(dim_index + 1, offset, elem_size, tensor,
-                                         scratch_space, dst));
-    offset += tensor.strides()[dim_index];
+  const auto& type = checked_cast<const FixedWidthType&>(*tensor.type());
+  const int64_t num_rows = tensor.ndim() == 0 ? 1 : tensor.shape()[0];
+  const int64_t row_size = tensor.size() / num_rows * (type.bit_width() / 8);
+  const int64_t slab_rows =
+      std::min(num_rows, std::max<int64_t>(1, kTensorSlabSize / row_size));
+
+  std::shared_ptr<Buffer> slab;
+  RETURN_NOT_OK(AllocateBuffer(pool, slab_rows * row_size, &slab));
+  for (int64_t begin = 0; begin < num_rows; begin += slab_rows) {
+    const int64_t end = std::min(num_rows, begin + slab_rows);
+    RETURN_NOT_OK(
+        ::arrow::internal::CopyTensorRowMajor(tensor, begin, end, slab->mutable_data()));
+    RETURN_NOT_OK(dst->Write(slab->data(), (end - begin) * row_size));
   }
   return Status::OK();
 }
@@ -599,20 +754,49 @@ Status GetContiguousTensor(const Tensor& tensor, MemoryPool* pool,
   const auto& type = checked_cast<const FixedWidthType&>(*tensor.type());
   const int elem_size = type.bit_width() / 8;
 
-  std::shared_ptr<Buffer> scratch_space;
-  RETURN_NOT_OK(AllocateBuffer(pool, tensor.shape()[tensor.ndim() - 1] * elem_size,
-                               &scratch_space));
+  std::shared_ptr<Buffer> contiguous_data;
+  RETURN_NOT_OK(AllocateBuffer(pool, tensor.size() * elem_size, &contiguous_data));
+  const int64_t num_rows = tensor.ndim() == 0 ? 1 : tensor.shape()[0];
+  RETURN_NOT_OK(::arrow::internal::CopyTensorRowMajor(tensor, 0, num_rows,
+                                             contiguous_data->mutable_data()));
 
-  std::shared_ptr<ResizableBuffer> contiguous_data;
-  RETURN_NOT_OK(
-      AllocateResizableBuffer(pool, tensor.size() * elem_size, &contiguous_data));
+  out->reset(new Tensor(tensor.type(), contiguous_data, tensor.shape()));
 
-  io::BufferOutputStream stream(contiguous_data);
-  RETURN_NOT_OK(WriteStridedTensorData(0, 0, elem_size, tensor,
-                                       scratch_space->mutable_data(), &stream));
+  return Status::OK();
+}
 
-  out->reset(new Tensor(tensor.type(), contiguous_data, tensor.shape()));
+// The body of a sparse tensor message is its index buffers followed by its
+// values, each starting on an aligned offset
+Status GetSparseTensorBody(const SparseTensor& sparse_tensor,
+                           std::vector<std::shared_ptr<Buffer>>* buffers,
+                           std::vector<internal::BufferMetadata>* buffer_meta,
+                           int64_t* body_length) {
+  const int64_t length = sparse_tensor.non_zero_length();
+  const int64_t index_size = static_cast<int64_t>(sizeof(int64_t));
+  std::vector<int64_t> sizes;
+  if (sparse_tensor.format_id() == SparseTensorFormat::COO) {
+    sizes.push_back(length * sparse_tensor.ndim() * index_size);
+  } else {
+    sizes.push_back((sparse_tensor.shape()[0] + 1) * index_size);
+    sizes.push_back(length * index_size);
+  }
+  const auto& type = checked_cast<const FixedWidthType&>(*sparse_tensor.type());
+  sizes.push_back(length * (type.bit_width() / 8));
+
+  std::vector<std::shared_ptr<Buffer>> sources = sparse_tensor.sparse_index()->buffers();
+  sources.push_back(sparse_tensor.data());
 
+  int64_t offset = 0;
+  for (size_t i = 0; i < sources.size(); ++i) {
+    const int64_t size = sizes[i];
+    if (size > 0 && (sources[i] == nullptr || sources[i]->size() < size)) {
+      return Status::Invalid("Sparse tensor buffer is smaller than its index implies");
+    }
+    buffers->push_back(size == 0 ? nullptr : SliceBuffer(sources[i], 0, size));
+    buffer_meta->push_back({offset, size});
+    offset += PaddedLength(size);
+  }
+  *body_length = offset;
   return Status::OK();
 }
 
@@ -637,22 +821,14 @@ Status WriteTensor(const Tensor& tensor, io::OutputStream* dst, int32_t* metadat
     }
   } else {
     Tensor dummy(tensor.type(), tensor.data(), tensor.shape());
-    const auto& type = checked_cast<const FixedWidthType&>(*tensor.type());
     RETURN_NOT_OK(WriteTensorHeader(dummy, dst, metadata_length, body_length));
     // It's important to align the stream position again so that the tensor data
     // is aligned.
     RETURN_NOT_OK(AlignStreamPosition(dst));
 
-    const int elem_size = type.bit_width() / 8;
-
-    // TODO(wesm): Do we care enough about this temporary allocation to pass in
-    // a MemoryPool to this function?
-    std::shared_ptr<Buffer> scratch_space;
-    RETURN_NOT_OK(
-        AllocateBuffer(tensor.shape()[tensor.ndim() - 1] * elem_size, &scratch_space));
-
-    return WriteStridedTensorData(0, 0, elem_size, tensor, scratch_space->mutable_data(),
-                                  dst);
+    const auto& type = checked_cast<const FixedWidthType&>(*tensor.type());
+    *body_length = tensor.size() * (type.bit_width() / 8);
+    return WriteStridedTensorData(tensor, default_memory_pool(), dst);
   }
 }
 
@@ -672,11 +848,70 @@ Status GetTensorMessage(const Tensor& tensor, MemoryPool* pool,
   return Status::OK();
 }
 
+Status WriteSparseTensor(const SparseTensor& sparse_tensor, io::OutputStream* dst,
+                         int32_t* metadata_length, int64_t* body_length) {
+  std::vector<std::shared_ptr<Buffer>> buffers;
+  std::vector<internal::BufferMetadata> buffer_meta;
+  RETURN_NOT_OK(GetSparseTensorBody(sparse_tensor, &buffers, &buffer_meta, body_length));
+
+  std::shared_ptr<Buffer> metadata;
+  RETURN_NOT_OK(internal::WriteSparseTensorMessage(sparse_tensor, *body_length,
+                                                   buffer_meta, &metadata));
+
+  // The body is aligned, as that of a tensor, so that the buffers are aligned
+  // in a memory map
+  RETURN_NOT_OK(AlignStreamPosition(dst));
+  RETURN_NOT_OK(internal::WriteMessage(metadata, dst, metadata_length));
+  RETURN_NOT_OK(AlignStreamPosition(dst));
+  for (size_t i = 0; i < buffers.size(); ++i) {
+    const int64_t size = buffer_meta[i].length;
+    if (size > 0) {
+      RETURN_NOT_OK(dst->Write(buffers[i]->data(), size));
+    }
+    const int64_t padding = PaddedLength(size) - size;
+    if (padding > 0) {
+      RETURN_NOT_OK(dst->Write(kPaddingBytes, padding));
+    }
+  }
+  return Status::OK();
+}
+
+Status GetSparseTensorMessage(const SparseTensor& sparse_tensor, MemoryPool* pool,
+                              std::unique_ptr<Message>* out) {
+  std::vector<std::shared_ptr<Buffer>> buffers;
+  std::vector<internal::BufferMetadata> buffer_meta;
+  int64_t body_length;
+  RETURN_NOT_OK(GetSparseTensorBody(sparse_tensor, &buffers, &buffer_meta, &body_length));
+
+  std::shared_ptr<Buffer> metadata;
+  RETURN_NOT_OK(internal::WriteSparseTensorMessage(sparse_tensor, body_length,
+                                                   buffer_meta, &metadata));
+
+  std::shared_ptr<Buffer> body;
+  RETURN_NOT_OK(AllocateBuffer(pool, body_length, &body));
+  uint8_t* body_data = body->mutable_data();
+  std::memset(body_data, 0, static_cast<size_t>(body_length));
+  for (size_t i = 0; i < buffers.size(); ++i) {
+    if (buffer_meta[i].length > 0) {
+      std::memcpy(body_data + buffer_meta[i].offset, buffers[i]->data(),
+                  static_cast<size_t>(buffer_meta[i].length));
+    }
+  }
+  out->reset(new Message(metadata, body));
+  return Status::OK();
+}
+
+// With is_delta, the dictionary holds entries to append to those of the
+// dictionary of the same id sent before; with checksum, the message ends with
+// its checksums
 Status WriteDictionary(int64_t dictionary_id, const std::shared_ptr<Array>& dictionary,
                        int64_t buffer_start_offset, io::OutputStream* dst,
-                       int32_t* metadata_length, int64_t* body_length, MemoryPool* pool) {
+                       int32_t* metadata_length, int64_t* body_length, MemoryPool* pool,
+                       bool is_delta = false, bool checksum = false) {
   DictionaryWriter writer(pool, buffer_start_offset, kMaxNestingDepth, false);
-  return writer.Write(dictionary_id, dictionary, dst, metadata_length, body_length);
+  writer.set_checksum(checksum);
+  return writer.Write(dictionary_id, is_delta, dictionary, dst, metadata_length,
+                      body_length);
 }
 
 Status GetRecordBatchSize(const RecordBatch& batch, int64_t* size) {
@@ -695,7 +930,26 @@ Status GetTensorSize(const Tensor& tensor, int64_t* size) {
   int32_t metadata_length = 0;
   int64_t body_length = 0;
   io::MockOutputStream dst;
-  RETURN_NOT_OK(WriteTensor(tensor, &dst, &metadata_length, &body_length));
+  if (tensor.is_contiguous()) {
+    RETURN_NOT_OK(WriteTensor(tensor, &dst, &metadata_length, &body_length));
+    *size = dst.GetExtentBytesWritten();
+    return Status::OK();
+  }
+  // Only the header is emulated, so as not to make the rows contiguous
+  Tensor dummy(tensor.type(), tensor.data(), tensor.shape());
+  RETURN_NOT_OK(WriteTensorHeader(dummy, &dst, &metadata_length, &body_length));
+  RETURN_NOT_OK(AlignStreamPosition(&dst));
+  const auto& type = checked_cast<const FixedWidthType&>(*tensor.type());
+  *size = dst.GetExtentBytesWritten() + tensor.size() * (type.bit_width() / 8);
+  return Status::OK();
+}
+
+Status GetSparseTensorSize(const SparseTensor& sparse_tensor, int64_t* size) {
+  // emulates the behavior of Write without actually writing
+  int32_t metadata_length = 0;
+  int64_t body_length = 0;
+  io::MockOutputStream dst;
+  RETURN_NOT_OK(WriteSparseTensor(sparse_tensor, &dst, &metadata_length, &body_length));
   *size = dst.GetExtentBytesWritten();
   return Status::OK();
 }
@@ -760,15 +1014,29 @@ class StreamBookKeeper {
 class SchemaWriter : public StreamBookKeeper {
  public:
   SchemaWriter(const Schema& schema, DictionaryMemo* dictionary_memo, MemoryPool* pool,
-               io::OutputStream* sink)
-      : StreamBookKeeper(sink), schema_(schema), dictionary_memo_(dictionary_memo) {}
+               io::OutputStream* sink, bool checksum = false)
+      : StreamBookKeeper(sink),
+        pool_(pool),
+        schema_(schema),
+        dictionary_memo_(dictionary_memo),
+        checksum_(checksum) {}
 
   Status WriteSchema() {
     std::shared_ptr<Buffer> schema_fb;
-    RETURN_NOT_OK(internal::WriteSchemaMessage(schema_, dictionary_memo_, &schema_fb));
+    RETURN_NOT_OK(
+        internal::WriteSchemaMessage(schema_, dictionary_memo_, &schema_fb, checksum_));
 
+    // With checksums, the body of the schema message is only them
+    int64_t start_position;
+    RETURN_NOT_OK(sink_->Tell(&start_position));
+    std::vector<std::shared_ptr<Buffer>> payload;
     int32_t metadata_length = 0;
-    RETURN_NOT_OK(internal::WriteMessage(*schema_fb, sink_, &metadata_length));
+    RETURN_NOT_OK(internal::GetMessageBuffers(schema_fb, start_position, &payload,
+                                              &metadata_length));
+    if (checksum_) {
+      RETURN_NOT_OK(AppendChecksums(1, payload.size(), pool_, &payload));
+    }
+    RETURN_NOT_OK(sink_->Writev(payload));
     RETURN_NOT_OK(UpdatePosition());
     DCHECK_EQ(0, position_ % 8) << "WriteSchema did not perform an aligned write";
     return Status::OK();
@@ -789,7 +1057,8 @@ class SchemaWriter : public StreamBookKeeper {
       // Frame of reference in file format is 0, see ARROW-384
       const int64_t buffer_start_offset = 0;
       RETURN_NOT_OK(WriteDictionary(entry.first, entry.second, buffer_start_offset, sink_,
-                                    &block->metadata_length, &block->body_length, pool_));
+                                    &block->metadata_length, &block->body_length, pool_,
+                                    false /* is_delta */, checksum_));
       RETURN_NOT_OK(UpdatePosition());
       DCHECK(position_ % 8 == 0) << "WriteDictionary did not perform aligned writes";
     }
@@ -808,21 +1077,39 @@ class SchemaWriter : public StreamBookKeeper {
   MemoryPool* pool_;
   const Schema& schema_;
   DictionaryMemo* dictionary_memo_;
+  bool checksum_;
 };
 
+// The dictionary types of a type and its children, depth-first, in the order
+// the schema metadata assigns them ids
+static void CollectDictionaryTypes(const DataType& type,
+                                   std::vector<const DictionaryType*>* out) {
+  if (type.id() == Type::DICTIONARY) {
+    out->push_back(&checked_cast<const DictionaryType&>(type));
+    return;
+  }
+  for (const auto& child : type.children()) {
+    CollectDictionaryTypes(*child->type(), out);
+  }
+}
+
 class RecordBatchStreamWriter::RecordBatchStreamWriterImpl : public StreamBookKeeper {
  public:
   RecordBatchStreamWriterImpl(io::OutputStream* sink,
-                              const std::shared_ptr<Schema>& schema)
+                              const std::shared_ptr<Schema>& schema,
+                              bool write_dictionary_deltas = true)
       : StreamBookKeeper(sink),
         schema_(schema),
         pool_(default_memory_pool()),
+        compression_(Compression::UNCOMPRESSED),
+        checksum_(false),
+        write_dictionary_deltas_(write_dictionary_deltas),
         started_(false) {}
 
   virtual ~RecordBatchStreamWriterImpl() = default;
 
   virtual Status Start() {
-    SchemaWriter schema_writer(*schema_, &dictionary_memo_, pool_, sink_);
+    SchemaWriter schema_writer(*schema_, &dictionary_memo_, pool_, sink_, checksum_);
     RETURN_NOT_OK(schema_writer.Write(&dictionaries_));
     started_ = true;
     return Status::OK();
@@ -845,17 +1132,72 @@ class RecordBatchStreamWriter::RecordBatchStreamWriterImpl : public StreamBookKe
     return Status::OK();
   }
 
+  // Send the entries the dictionaries of the batch have gained since they
+  // were last sent, as delta dictionary batches
+  Status WriteDictionaryDeltas(const RecordBatch& batch) {
+    if (batch.schema().get() == schema_.get()) {
+      return Status::OK();
+    }
+    std::vector<const DictionaryType*> stream_types;
+    std::vector<const DictionaryType*> batch_types;
+    for (const auto& field : schema_->fields()) {
+      CollectDictionaryTypes(*field->type(), &stream_types);
+    }
+    for (const auto& field : batch.schema()->fields()) {
+      CollectDictionaryTypes(*field->type(), &batch_types);
+    }
+    if (stream_types.size() != batch_types.size()) {
+      return Status::Invalid("Record batch does not have the dictionaries of the schema");
+    }
+
+    for (size_t i = 0; i < stream_types.size(); ++i) {
+      const int64_t id = dictionary_memo_.GetId(stream_types[i]->dictionary());
+      const std::shared_ptr<Array>& dictionary = batch_types[i]->dictionary();
+      auto it = sent_dictionaries_.find(id);
+      const std::shared_ptr<Array>& sent =
+          it == sent_dictionaries_.end() ? stream_types[i]->dictionary() : it->second;
+      if (dictionary.get() == sent.get()) {
+        continue;
+      }
+      if (dictionary->length() < sent->length() ||
+          !dictionary->RangeEquals(0, sent->length(), 0, sent)) {
+        std::stringstream ss;
+        ss << "Dictionary " << id << " of a stream can only gain new entries, "
+           << "appended to those sent before";
+        return Status::Invalid(ss.str());
+      }
+      if (dictionary->length() > sent->length()) {
+        int32_t metadata_length = 0;
+        int64_t body_length = 0;
+        RETURN_NOT_OK(WriteDictionary(id, dictionary->Slice(sent->length()), 0, sink_,
+                                      &metadata_length, &body_length, pool_,
+                                      true /* is_delta */, checksum_));
+        RETURN_NOT_OK(UpdatePosition());
+      }
+      sent_dictionaries_[id] = dictionary;
+    }
+    return Status::OK();
+  }
+
   Status WriteRecordBatch(const RecordBatch& batch, bool allow_64bit, FileBlock* block) {
+    ARROW_TRACE_SPAN(span, "ipc", "RecordBatchWriter::WriteRecordBatch");
     RETURN_NOT_OK(CheckStarted());
+    if (write_dictionary_deltas_) {
+      RETURN_NOT_OK(WriteDictionaryDeltas(batch));
+    }
     RETURN_NOT_OK(UpdatePosition());
 
     block->offset = position_;
 
     // Frame of reference in file format is 0, see ARROW-384
     const int64_t buffer_start_offset = 0;
-    RETURN_NOT_OK(arrow::ipc::WriteRecordBatch(
-        batch, buffer_start_offset, sink_, &block->metadata_length, &block->body_length,
-        pool_, kMaxNestingDepth, allow_64bit));
+    RecordBatchSerializer writer(pool_, buffer_start_offset, kMaxNestingDepth,
+                                 allow_64bit);
+    writer.set_compression(compression_);
+    writer.set_checksum(checksum_);
+    RETURN_NOT_OK(
+        writer.Write(batch, sink_, &block->metadata_length, &block->body_length));
+    ARROW_TRACE_BYTES(span, block->metadata_length + block->body_length);
     RETURN_NOT_OK(UpdatePosition());
 
     DCHECK(position_ % 8 == 0) << "WriteRecordBatch did not perform aligned writes";
@@ -872,15 +1214,33 @@ class RecordBatchStreamWriter::RecordBatchStreamWriterImpl : public StreamBookKe
 
   void set_memory_pool(MemoryPool* pool) { pool_ = pool; }
 
+  Status set_compression(Compression::type compression) {
+    if (compression != Compression::UNCOMPRESSED) {
+      // Fail now if the codec is not built
+      std::unique_ptr<Codec> codec;
+      RETURN_NOT_OK(Codec::Create(compression, &codec));
+    }
+    compression_ = compression;
+    return Status::OK();
+  }
+
+  void set_checksum(bool checksum) { checksum_ = checksum; }
+
  protected:
   std::shared_ptr<Schema> schema_;
   MemoryPool* pool_;
+  Compression::type compression_;
+  bool checksum_;
+  bool write_dictionary_deltas_;
   bool started_;
 
   // When writing out the schema, we keep track of all the dictionaries we
   // encounter, as they must be written out first in the stream
   DictionaryMemo dictionary_memo_;
 
+  // The dictionaries last sent by id, when they have grown since the schema
+  std::unordered_map<int64_t, std::shared_ptr<Array>> sent_dictionaries_;
+
   std::vector<FileBlock> dictionaries_;
   std::vector<FileBlock> record_batches_;
 };
@@ -898,6 +1258,14 @@ void RecordBatchStreamWriter::set_memory_pool(MemoryPool* pool) {
   impl_->set_memory_pool(pool);
 }
 
+Status RecordBatchStreamWriter::set_compression(Compression::type compression) {
+  return impl_->set_compression(compression);
+}
+
+void RecordBatchStreamWriter::set_checksum(bool checksum) {
+  impl_->set_checksum(checksum);
+}
+
 Status RecordBatchStreamWriter::Open(io::OutputStream* sink,
                                      const std::shared_ptr<Schema>& schema,
                                      std::shared_ptr<RecordBatchWriter>* out) {
@@ -913,13 +1281,102 @@ Status RecordBatchStreamWriter::Close() { return impl_->Close(); }
 // ----------------------------------------------------------------------
 // File writer implementation
 
+// The range of the non-null values of an array of T, NaN left out, stored as
+// Out; has_range stays false if there are none
+template <typename T, typename Out>
+static void GetValueRange(const ArrayData& data, Out* min, Out* max, bool* has_range) {
+  if (data.length == 0) {
+    return;
+  }
+  const T* values = reinterpret_cast<const T*>(data.buffers[1]->data()) + data.offset;
+  const uint8_t* valid_bits = data.buffers[0] ? data.buffers[0]->data() : NULLPTR;
+  for (int64_t i = 0; i < data.length; ++i) {
+    const T value = values[i];
+    if ((valid_bits != NULLPTR && !BitUtil::GetBit(valid_bits, data.offset + i)) ||
+        value != value) {
+      continue;
+    }
+    if (!*has_range) {
+      *min = *max = static_cast<Out>(value);
+      *has_range = true;
+    } else if (static_cast<Out>(value) < *min) {
+      *min = static_cast<Out>(value);
+    } else if (static_cast<Out>(value) > *max) {
+      *max = static_cast<Out>(value);
+    }
+  }
+}
+
+static ColumnStatistics GetColumnStatistics(const Array& array) {
+  ColumnStatistics out;
+  out.null_count = array.null_count();
+  const ArrayData& data = *array.data();
+  int64_t* int_min = &out.int_min;
+  int64_t* int_max = &out.int_max;
+  bool* has_range = &out.has_range;
+  switch (array.type_id()) {
+    case Type::INT8:
+      GetValueRange<int8_t>(data, int_min, int_max, has_range);
+      break;
+    case Type::UINT8:
+      GetValueRange<uint8_t>(data, int_min, int_max, has_range);
+      break;
+    case Type::INT16:
+      GetValueRange<int16_t>(data, int_min, int_max, has_range);
+      break;
+    case Type::UINT16:
+      GetValueRange<uint16_t>(data, int_min, int_max, has_range);
+      break;
+    case Type::INT32:
+    case Type::DATE32:
+    case Type::TIME32:
+      GetValueRange<int32_t>(data, int_min, int_max, has_range);
+      break;
+    case Type::UINT32:
+      GetValueRange<uint32_t>(data, int_min, int_max, has_range);
+      break;
+    case Type::INT64:
+    case Type::DATE64:
+    case Type::TIME64:
+    case Type::TIMESTAMP:
+      GetValueRange<int64_t>(data, int_min, int_max, has_range);
+      break;
+    case Type::FLOAT:
+      GetValueRange<float>(data, &out.float_min, &out.float_max, has_range);
+      break;
+    case Type::DOUBLE:
+      GetValueRange<double>(data, &out.float_min, &out.float_max, has_range);
+      break;
+    default:
+      // No range for other types, uint64 included as it does not fit
+      break;
+  }
+  return out;
+}
+
 class RecordBatchFileWriter::RecordBatchFileWriterImpl
     : public RecordBatchStreamWriter::RecordBatchStreamWriterImpl {
  public:
   using BASE = RecordBatchStreamWriter::RecordBatchStreamWriterImpl;
 
   RecordBatchFileWriterImpl(io::OutputStream* sink, const std::shared_ptr<Schema>& schema)
-      : BASE(sink, schema) {}
+      : BASE(sink, schema, false /* write_dictionary_deltas */),
+        write_statistics_(false) {}
+
+  Status WriteRecordBatch(const RecordBatch& batch, bool allow_64bit) {
+    if (write_statistics_) {
+      std::vector<ColumnStatistics> statistics(batch.num_columns());
+      for (int i = 0; i < batch.num_columns(); ++i) {
+        statistics[i] = GetColumnStatistics(*batch.column(i));
+      }
+      statistics_.push_back(std::move(statistics));
+    }
+    return BASE::WriteRecordBatch(batch, allow_64bit);
+  }
+
+  void set_write_statistics(bool write_statistics) {
+    write_statistics_ = write_statistics;
+  }
 
   Status Start() override {
     // It is only necessary to align to 8-byte boundary at the start of the file
@@ -936,7 +1393,11 @@ class RecordBatchFileWriter::RecordBatchFileWriterImpl
     RETURN_NOT_OK(UpdatePosition());
 
     int64_t initial_position = position_;
-    RETURN_NOT_OK(WriteFileFooter(*schema_, dictionaries_, record_batches_,
+    if (statistics_.size() != record_batches_.size()) {
+      // Statistics are kept for all the batches of a file or none
+      statistics_.clear();
+    }
+    RETURN_NOT_OK(WriteFileFooter(*schema_, dictionaries_, record_batches_, statistics_,
                                   &dictionary_memo_, sink_));
     RETURN_NOT_OK(UpdatePosition());
 
@@ -952,6 +1413,10 @@ class RecordBatchFileWriter::RecordBatchFileWriterImpl
     // Write magic bytes to end file
     return Write(kArrowMagicBytes, strlen(kArrowMagicBytes));
   }
+
+ private:
+  bool write_statistics_;
+  std::vector<std::vector<ColumnStatistics>> statistics_;
 };
 
 RecordBatchFileWriter::RecordBatchFileWriter() {}
@@ -975,22 +1440,379 @@ Status RecordBatchFileWriter::WriteRecordBatch(const RecordBatch& batch,
 
 Status RecordBatchFileWriter::Close() { return file_impl_->Close(); }
 
+Status RecordBatchFileWriter::set_compression(Compression::type compression) {
+  return file_impl_->set_compression(compression);
+}
+
+void RecordBatchFileWriter::set_checksum(bool checksum) {
+  file_impl_->set_checksum(checksum);
+}
+
+void RecordBatchFileWriter::set_write_statistics(bool write_statistics) {
+  file_impl_->set_write_statistics(write_statistics);
+}
+
+// ----------------------------------------------------------------------
+// Asynchronous writer implementation
+
+namespace {
+
+// A batch of the same arrays, which can be held on to past the call it was
+// given to
+std::shared_ptr<RecordBatch> ShareRecordBatch(const RecordBatch& batch) {
+  std::vector<std::shared_ptr<ArrayData>> columns(batch.num_columns());
+  for (int i = 0; i < batch.num_columns(); ++i) {
+    columns[i] = batch.column_data(i);
+  }
+  return RecordBatch::Make(batch.schema(), batch.num_rows(), std::move(columns));
+}
+
+}  // namespace
+
+class AsyncRecordBatchWriter::AsyncRecordBatchWriterImpl {
+ public:
+  struct QueuedBatch {
+    std::shared_ptr<RecordBatch> batch;
+    bool allow_64bit;
+  };
+
+  AsyncRecordBatchWriterImpl(const std::shared_ptr<RecordBatchWriter>& writer,
+                             int64_t queue_capacity)
+      : writer_(writer),
+        queue_(static_cast<size_t>(queue_capacity)),
+        failed_(false),
+        closed_(false) {}
+
+  ~AsyncRecordBatchWriterImpl() {
+    if (!closed_) {
+      failed_ = true;
+      ARROW_UNUSED(Close());
+    }
+  }
+
+  void Start() {
+    thread_ = std::thread([this]() { WriteQueued(); });
+  }
+
+  Status WriteRecordBatch(const RecordBatch& batch, bool allow_64bit) {
+    if (failed_) {
+      return error();
+    }
+    QueuedBatch queued = {ShareRecordBatch(batch), allow_64bit};
+    if (!queue_.Push(std::move(queued)).ok()) {
+      return Status::Invalid("Writing to a closed writer");
+    }
+    return Status::OK();
+  }
+
+  Status Close() {
+    if (closed_.exchange(true)) {
+      return Status::OK();
+    }
+    queue_.Close();
+    if (thread_.joinable()) {
+      thread_.join();
+    }
+    Status status = writer_->Close();
+    return failed_ ? error() : status;
+  }
+
+  void set_memory_pool(MemoryPool* pool) { writer_->set_memory_pool(pool); }
+
+ private:
+  void WriteQueued() {
+    QueuedBatch queued;
+    while (queue_.Pop(&queued)) {
+      if (failed_) {
+        // Dropped, as are all the batches after a failed write
+        continue;
+      }
+      Status status = writer_->WriteRecordBatch(*queued.batch, queued.allow_64bit);
+      queued.batch.reset();
+      if (!status.ok()) {
+        std::lock_guard<std::mutex> lock(error_mutex_);
+        error_ = status;
+        failed_ = true;
+      }
+    }
+  }
+
+  Status error() {
+    std::lock_guard<std::mutex> lock(error_mutex_);
+    return error_.ok() ? Status::Invalid("Writer closed before the batches were written")
+                       : error_;
+  }
+
+  std::shared_ptr<RecordBatchWriter> writer_;
+  BoundedQueue<QueuedBatch> queue_;
+  std::thread thread_;
+  std::atomic<bool> failed_;
+  std::atomic<bool> closed_;
+  std::mutex error_mutex_;
+  Status error_;
+};
+
+AsyncRecordBatchWriter::AsyncRecordBatchWriter() {}
+
+AsyncRecordBatchWriter::~AsyncRecordBatchWriter() {}
+
+Status AsyncRecordBatchWriter::Open(const std::shared_ptr<RecordBatchWriter>& writer,
+                                    int64_t queue_capacity,
+                                    std::shared_ptr<RecordBatchWriter>* out) {
+  if (queue_capacity <= 0) {
+    return Status::Invalid("Queue capacity must be positive");
+  }
+  auto result = std::shared_ptr<AsyncRecordBatchWriter>(new AsyncRecordBatchWriter());
+  result->impl_.reset(new AsyncRecordBatchWriterImpl(writer, queue_capacity));
+  result->impl_->Start();
+  *out = result;
+  return Status::OK();
+}
+
+Status AsyncRecordBatchWriter::WriteRecordBatch(const RecordBatch& batch,
+                                                bool allow_64bit) {
+  return impl_->WriteRecordBatch(batch, allow_64bit);
+}
+
+Status AsyncRecordBatchWriter::Close() { return impl_->Close(); }
+
+void AsyncRecordBatchWriter::set_memory_pool(MemoryPool* pool) {
+  impl_->set_memory_pool(pool);
+}
+
+// ----------------------------------------------------------------------
+// Coalescing writer implementation
+
+class CoalescingRecordBatchWriter::CoalescingRecordBatchWriterImpl {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  CoalescingRecordBatchWriterImpl(const std::shared_ptr<RecordBatchWriter>& writer,
+                                  const CoalesceOptions& options)
+      : writer_(writer),
+        options_(options),
+        pool_(default_memory_pool()),
+        pending_rows_(0),
+        pending_bytes_(0),
+        pending_64bit_(false),
+        closed_(false) {}
+
+  ~CoalescingRecordBatchWriterImpl() { ARROW_UNUSED(Close()); }
+
+  void Start() {
+    if (options_.max_latency_ms > 0) {
+      deadline_thread_ = std::thread([this]() { FlushOnDeadline(); });
+    }
+  }
+
+  Status WriteRecordBatch(const RecordBatch& batch, bool allow_64bit) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (closed_) {
+      return Status::Invalid("Writing to a closed writer");
+    }
+    RETURN_NOT_OK(deadline_error_);
+    if (!pending_.empty() && !batch.schema()->Equals(*pending_[0]->schema())) {
+      return Status::Invalid("Record batch has another schema than the previous ones");
+    }
+    int64_t size = 0;
+    RETURN_NOT_OK(GetRecordBatchSize(batch, &size));
+    if (pending_.empty() && ReachesLimit(batch.num_rows(), size)) {
+      return writer_->WriteRecordBatch(batch, allow_64bit);
+    }
+    if (pending_.empty()) {
+      first_pending_time_ = Clock::now();
+      deadline_changed_.notify_one();
+    }
+    pending_.push_back(ShareRecordBatch(batch));
+    pending_rows_ += batch.num_rows();
+    pending_bytes_ += size;
+    pending_64bit_ = pending_64bit_ || allow_64bit;
+    if (ReachesLimit(pending_rows_, pending_bytes_)) {
+      return FlushPending();
+    }
+    return Status::OK();
+  }
+
+  Status Flush() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    RETURN_NOT_OK(deadline_error_);
+    return FlushPending();
+  }
+
+  Status Close() {
+    Status status;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (closed_) {
+        return Status::OK();
+      }
+      closed_ = true;
+      status = deadline_error_.ok() ? FlushPending() : deadline_error_;
+      deadline_changed_.notify_one();
+    }
+    if (deadline_thread_.joinable()) {
+      deadline_thread_.join();
+    }
+    Status close_status = writer_->Close();
+    return status.ok() ? close_status : status;
+  }
+
+  void set_memory_pool(MemoryPool* pool) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    pool_ = pool;
+    writer_->set_memory_pool(pool);
+  }
+
+ private:
+  bool ReachesLimit(int64_t num_rows, int64_t num_bytes) const {
+    return num_rows >= options_.max_rows || num_bytes >= options_.max_bytes;
+  }
+
+  // To be called with mutex_ held
+  Status FlushPending() {
+    if (pending_.empty()) {
+      return Status::OK();
+    }
+    std::vector<std::shared_ptr<RecordBatch>> batches;
+    batches.swap(pending_);
+    const int64_t num_rows = pending_rows_;
+    const bool allow_64bit = pending_64bit_;
+    pending_rows_ = 0;
+    pending_bytes_ = 0;
+    pending_64bit_ = false;
+
+    if (batches.size() == 1) {
+      return writer_->WriteRecordBatch(*batches[0], allow_64bit);
+    }
+    const int num_columns = batches[0]->num_columns();
+    std::vector<std::shared_ptr<Array>> columns(num_columns);
+    std::vector<std::shared_ptr<Array>> chunks(batches.size());
+    for (int i = 0; i < num_columns; ++i) {
+      for (size_t j = 0; j < batches.size(); ++j) {
+        chunks[j] = batches[j]->column(i);
+      }
+      RETURN_NOT_OK(Concatenate(chunks, pool_, &columns[i]));
+    }
+    auto merged = RecordBatch::Make(batches[0]->schema(), num_rows, std::move(columns));
+    return writer_->WriteRecordBatch(*merged, allow_64bit);
+  }
+
+  void FlushOnDeadline() {
+    const auto latency = std::chrono::milliseconds(options_.max_latency_ms);
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!closed_) {
+      if (pending_.empty()) {
+        deadline_changed_.wait(lock);
+        continue;
+      }
+      const auto deadline = first_pending_time_ + latency;
+      if (Clock::now() < deadline) {
+        deadline_changed_.wait_until(lock, deadline);
+        continue;
+      }
+      Status status = FlushPending();
+      if (!status.ok() && deadline_error_.ok()) {
+        deadline_error_ = status;
+      }
+    }
+  }
+
+  std::shared_ptr<RecordBatchWriter> writer_;
+  const CoalesceOptions options_;
+  MemoryPool* pool_;
+
+  std::vector<std::shared_ptr<RecordBatch>> pending_;
+  int64_t pending_rows_;
+  int64_t pending_bytes_;
+  bool pending_64bit_;
+  Clock::time_point first_pending_time_;
+
+  bool closed_;
+  // The first error of a write on the latency deadline, returned by the
+  // next call
+  Status deadline_error_;
+  std::mutex mutex_;
+  std::condition_variable deadline_changed_;
+  std::thread deadline_thread_;
+};
+
+CoalescingRecordBatchWriter::CoalescingRecordBatchWriter() {}
+
+CoalescingRecordBatchWriter::~CoalescingRecordBatchWriter() {}
+
+Status CoalescingRecordBatchWriter::Open(const std::shared_ptr<RecordBatchWriter>& writer,
+                                         const CoalesceOptions& options,
+                                         std::shared_ptr<RecordBatchWriter>* out) {
+  if (options.max_rows <= 0 || options.max_bytes <= 0 || options.max_latency_ms < 0) {
+    return Status::Invalid("Coalescing limits must be positive");
+  }
+  auto result =
+      std::shared_ptr<CoalescingRecordBatchWriter>(new CoalescingRecordBatchWriter());
+  result->impl_.reset(new CoalescingRecordBatchWriterImpl(writer, options));
+  result->impl_->Start();
+  *out = result;
+  return Status::OK();
+}
+
+Status CoalescingRecordBatchWriter::WriteRecordBatch(const RecordBatch& batch,
+                                                     bool allow_64bit) {
+  return impl_->WriteRecordBatch(batch, allow_64bit);
+}
+
+Status CoalescingRecordBatchWriter::Flush() { return impl_->Flush(); }
+
+Status CoalescingRecordBatchWriter::Close() { return impl_->Close(); }
+
+void CoalescingRecordBatchWriter::set_memory_pool(MemoryPool* pool) {
+  impl_->set_memory_pool(pool);
+}
+
 // ----------------------------------------------------------------------
 // Serialization public APIs
 
+Status GetRecordBatchPayload(const RecordBatch& batch, MemoryPool* pool,
+                             std::vector<std::shared_ptr<Buffer>>* payload,
+                             int64_t* size) {
+  int32_t metadata_length = 0;
+  int64_t body_length = 0;
+  RecordBatchSerializer serializer(pool, 0, kMaxNestingDepth, true);
+  RETURN_NOT_OK(
+      serializer.GetPayload(batch, 0, payload, &metadata_length, &body_length));
+  *size = metadata_length + body_length;
+  return Status::OK();
+}
+
 Status SerializeRecordBatch(const RecordBatch& batch, MemoryPool* pool,
                             std::shared_ptr<Buffer>* out) {
+  std::vector<std::shared_ptr<Buffer>> payload;
   int64_t size = 0;
-  RETURN_NOT_OK(GetRecordBatchSize(batch, &size));
+  RETURN_NOT_OK(GetRecordBatchPayload(batch, pool, &payload, &size));
   std::shared_ptr<Buffer> buffer;
   RETURN_NOT_OK(AllocateBuffer(pool, size, &buffer));
 
   io::FixedSizeBufferWriter stream(buffer);
-  RETURN_NOT_OK(SerializeRecordBatch(batch, pool, &stream));
+  RETURN_NOT_OK(stream.Writev(payload));
   *out = buffer;
   return Status::OK();
 }
 
+Status SerializeRecordBatch(const RecordBatch& batch, MemoryPool* pool,
+                            const std::shared_ptr<Buffer>& dst, int64_t* size) {
+  if (!dst->is_mutable()) {
+    return Status::Invalid("Serializing into an immutable buffer");
+  }
+  std::vector<std::shared_ptr<Buffer>> payload;
+  RETURN_NOT_OK(GetRecordBatchPayload(batch, pool, &payload, size));
+  if (*size > dst->size()) {
+    std::stringstream ss;
+    ss << "Record batch takes " << *size << " bytes, more than the " << dst->size()
+       << " bytes of the buffer";
+    return Status::CapacityError(ss.str());
+  }
+  io::FixedSizeBufferWriter stream(dst);
+  return stream.Writev(payload);
+}
+
 Status SerializeRecordBatch(const RecordBatch& batch, MemoryPool* pool,
                             io::OutputStream* out) {
   int32_t metadata_length = 0;
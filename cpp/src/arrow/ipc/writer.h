@@ -26,6 +26,7 @@
 #include <vector>
 
 #include "arrow/ipc/message.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -36,6 +37,7 @@ class Field;
 class MemoryPool;
 class RecordBatch;
 class Schema;
+class SparseTensor;
 class Status;
 class Table;
 class Tensor;
@@ -102,6 +104,11 @@ class ARROW_EXPORT RecordBatchStreamWriter : public RecordBatchWriter {
 
   /// \brief Write a record batch to the stream
   ///
+  /// The dictionaries of the batch may have more entries than those of the
+  /// schema, or of the batches before, as long as they start with those: the
+  /// new entries are then sent alone, as delta dictionary batches, and the
+  /// indices written before stay valid.
+  ///
   /// \param[in] batch the record batch to write
   /// \param[in] allow_64bit allow array lengths over INT32_MAX - 1
   /// \return Status
@@ -113,6 +120,26 @@ class ARROW_EXPORT RecordBatchStreamWriter : public RecordBatchWriter {
 
   void set_memory_pool(MemoryPool* pool) override;
 
+  /// \brief Compress each buffer of the bodies of the record batches written
+  /// from now on with a codec
+  ///
+  /// The buffers are compressed in parallel on the CPU thread pool, and
+  /// those that would not shrink are written uncompressed. Dictionaries are
+  /// not compressed.
+  ///
+  /// \param[in] compression the codec, UNCOMPRESSED to stop compressing
+  /// \return Status, NotImplemented if the codec is not built
+  virtual Status set_compression(Compression::type compression);
+
+  /// \brief End each message written from now on, beginning by the schema,
+  /// with the CRC32C checksums of its body and metadata, off by default
+  ///
+  /// Readers verify the checksums by default, see
+  /// StreamReadOptions::verify_checksums, and readers not knowing of them
+  /// skip them. Computing the checksums takes a pass over each message.
+  /// Call before the first write to checksum the schema.
+  virtual void set_checksum(bool checksum);
+
  protected:
   RecordBatchStreamWriter();
   class ARROW_NO_EXPORT RecordBatchStreamWriterImpl;
@@ -148,12 +175,142 @@ class ARROW_EXPORT RecordBatchFileWriter : public RecordBatchStreamWriter {
   /// \return Status
   Status Close() override;
 
+  Status set_compression(Compression::type compression) override;
+
+  void set_checksum(bool checksum) override;
+
+  /// \brief Keep the null count of each column of the batches written next
+  /// in the footer, with the range of their values for integer, date, time,
+  /// timestamp and floating point columns, off by default
+  ///
+  /// Readers can then skip the batches outside of the range they look for,
+  /// see RecordBatchFileReader::FindRecordBatches. Computing the ranges takes
+  /// a pass over the values of those columns.
+  void set_write_statistics(bool write_statistics);
+
  private:
   RecordBatchFileWriter();
   class ARROW_NO_EXPORT RecordBatchFileWriterImpl;
   std::unique_ptr<RecordBatchFileWriterImpl> file_impl_;
 };
 
+/// \class AsyncRecordBatchWriter
+/// \brief Writes record batches with another writer, on a background thread
+///
+/// WriteRecordBatch queues the batch and returns, the batch then being
+/// serialized and written by a thread of the writer's own, so that producers
+/// do not wait on the disk or the network. They wait only while the queue is
+/// full, when they outpace the sink. The queued batches share the buffers of
+/// those given, which must be left unchanged until written.
+///
+/// Should writing a batch fail, the batches queued after it are dropped, and
+/// the next call to WriteRecordBatch, or Close, returns the error.
+class ARROW_EXPORT AsyncRecordBatchWriter : public RecordBatchWriter {
+ public:
+  /// \brief Drop the batches not yet written and close the wrapped writer,
+  /// if not done already
+  ~AsyncRecordBatchWriter() override;
+
+  /// \brief Write through a writer on a background thread
+  ///
+  /// \param[in] writer the writer to write with, used from the background
+  /// thread alone from now on
+  /// \param[in] queue_capacity the batches queued at most, rounded up to a
+  /// power of two
+  /// \param[out] out the asynchronous writer
+  /// \return Status
+  static Status Open(const std::shared_ptr<RecordBatchWriter>& writer,
+                     int64_t queue_capacity, std::shared_ptr<RecordBatchWriter>* out);
+
+  /// \brief Queue a record batch to be written
+  ///
+  /// Batches may be queued from several threads at once, and are written in
+  /// the order they are queued.
+  ///
+  /// \return Status, the error of a batch queued before if it failed
+  Status WriteRecordBatch(const RecordBatch& batch, bool allow_64bit = false) override;
+
+  /// \brief Wait for the queued batches to be written, then close the wrapped
+  /// writer
+  ///
+  /// \return Status, the first error of the background thread if any
+  Status Close() override;
+
+  /// \brief Set the memory pool of the wrapped writer; to be called before
+  /// the first batch is queued
+  void set_memory_pool(MemoryPool* pool) override;
+
+ private:
+  AsyncRecordBatchWriter();
+
+  class ARROW_NO_EXPORT AsyncRecordBatchWriterImpl;
+  std::unique_ptr<AsyncRecordBatchWriterImpl> impl_;
+};
+
+/// \brief When a CoalescingRecordBatchWriter writes the batches it holds
+struct ARROW_EXPORT CoalesceOptions {
+  /// Write once the batches held have this many rows
+  int64_t max_rows = 64 * 1024;
+
+  /// Write once the batches held take this many bytes, as measured by
+  /// GetRecordBatchSize
+  int64_t max_bytes = 1 << 20;
+
+  /// Write the batches held at the latest this many milliseconds after the
+  /// first of them was given, even if the writer is given no other batch. 0
+  /// to hold them for as long as neither limit above is reached
+  int64_t max_latency_ms = 0;
+};
+
+/// \class CoalescingRecordBatchWriter
+/// \brief Merges small record batches into larger ones for another writer
+///
+/// Every message of the IPC formats carries metadata, which for streams of
+/// tiny batches outweighs the data and slows scans down. This writer holds
+/// the batches it is given until they reach a number of rows or of bytes,
+/// then writes them to the wrapped writer as one batch, their columns
+/// concatenated. A batch reaching a limit by itself, when none is held, is
+/// written as is.
+///
+/// The batches held share the buffers of those given, which must be left
+/// unchanged until written.
+class ARROW_EXPORT CoalescingRecordBatchWriter : public RecordBatchWriter {
+ public:
+  ~CoalescingRecordBatchWriter() override;
+
+  /// \brief Coalesce the batches written to a writer
+  ///
+  /// \param[in] writer the writer to write the merged batches with
+  /// \param[in] options when to write the batches held
+  /// \param[out] out the coalescing writer
+  /// \return Status
+  static Status Open(const std::shared_ptr<RecordBatchWriter>& writer,
+                     const CoalesceOptions& options,
+                     std::shared_ptr<RecordBatchWriter>* out);
+
+  /// \brief Hold a record batch, writing those held if a limit is reached
+  ///
+  /// \return Status, that of an earlier write on the latency deadline if it
+  /// failed
+  Status WriteRecordBatch(const RecordBatch& batch, bool allow_64bit = false) override;
+
+  /// \brief Write the batches held, if any
+  Status Flush();
+
+  /// \brief Write the batches held, then close the wrapped writer
+  Status Close() override;
+
+  /// \brief Set the memory pool to concatenate the batches from, and of the
+  /// wrapped writer
+  void set_memory_pool(MemoryPool* pool) override;
+
+ private:
+  CoalescingRecordBatchWriter();
+
+  class ARROW_NO_EXPORT CoalescingRecordBatchWriterImpl;
+  std::unique_ptr<CoalescingRecordBatchWriterImpl> impl_;
+};
+
 /// \brief Low-level API for writing a record batch (without schema) to an OutputStream
 ///
 /// \param[in] batch the record batch to write
@@ -197,6 +354,40 @@ ARROW_EXPORT
 Status SerializeRecordBatch(const RecordBatch& batch, MemoryPool* pool,
                             std::shared_ptr<Buffer>* out);
 
+/// \brief Serialize record batch as encapsulated IPC message into memory
+/// allocated by the caller, such as shared memory or a memory map
+///
+/// The layout of the message is computed once, then the message written
+/// straight into the buffer, with no need to size it with
+/// GetRecordBatchSize first. The buffer need only be large enough: the
+/// message starts at its beginning, and its exact size is returned.
+///
+/// \param[in] batch the record batch
+/// \param[in] pool a MemoryPool to use for temporary allocations, if needed
+/// \param[in] dst a mutable buffer to write the message to
+/// \param[out] size the bytes of dst taken by the message
+/// \return Status, CapacityError with nothing written when dst is too small
+ARROW_EXPORT
+Status SerializeRecordBatch(const RecordBatch& batch, MemoryPool* pool,
+                            const std::shared_ptr<Buffer>& dst, int64_t* size);
+
+/// \brief Lay out record batch as encapsulated IPC message without writing it
+///
+/// The message is the concatenation of the returned buffers, which reference
+/// the memory of the batch wherever they can. Its size being known before any
+/// of it is written, the message can be written in one pass to memory
+/// allocated to fit it exactly, such as a shared memory object.
+///
+/// \param[in] batch the record batch
+/// \param[in] pool a MemoryPool to use for temporary allocations, if needed
+/// \param[out] payload the buffers of the message, to write in order
+/// \param[out] size the total size of the buffers
+/// \return Status
+ARROW_EXPORT
+Status GetRecordBatchPayload(const RecordBatch& batch, MemoryPool* pool,
+                             std::vector<std::shared_ptr<Buffer>>* payload,
+                             int64_t* size);
+
 /// \brief Write record batch to OutputStream
 ///
 /// \param[in] batch the record batch to write
@@ -204,8 +395,9 @@ Status SerializeRecordBatch(const RecordBatch& batch, MemoryPool* pool,
 /// \param[in] out the OutputStream to write the output to
 /// \return Status
 ///
-/// If writing to pre-allocated memory, you can use
-/// arrow::ipc::GetRecordBatchSize to compute how much space is required
+/// To write to pre-allocated memory, see the overload taking a mutable
+/// buffer, or use arrow::ipc::GetRecordBatchSize to compute how much space is
+/// required
 ARROW_EXPORT
 Status SerializeRecordBatch(const RecordBatch& batch, MemoryPool* pool,
                             io::OutputStream* out);
@@ -269,6 +461,42 @@ ARROW_EXPORT
 Status WriteTensor(const Tensor& tensor, io::OutputStream* dst, int32_t* metadata_length,
                    int64_t* body_length);
 
+/// \brief EXPERIMENTAL: Write arrow::SparseTensor as a contiguous message
+///
+/// Only the non-zero values and their index are written, each buffer
+/// starting on a 64-byte aligned offset of the aligned body, such that they
+/// can be read from a memory map or shared memory without copying.
+///
+/// \param[in] sparse_tensor the SparseTensor to write
+/// \param[in] dst the OutputStream to write to
+/// \param[out] metadata_length the actual metadata length
+/// \param[out] body_length the actual message body length
+/// \return Status
+///
+/// <metadata size><metadata><index buffers><values>
+ARROW_EXPORT
+Status WriteSparseTensor(const SparseTensor& sparse_tensor, io::OutputStream* dst,
+                         int32_t* metadata_length, int64_t* body_length);
+
+/// \brief EXPERIMENTAL: Convert arrow::SparseTensor to a Message
+///
+/// \param[in] sparse_tensor the SparseTensor to write
+/// \param[in] pool MemoryPool to allocate space for metadata and body
+/// \param[out] out the resulting Message
+/// \return Status
+ARROW_EXPORT
+Status GetSparseTensorMessage(const SparseTensor& sparse_tensor, MemoryPool* pool,
+                              std::unique_ptr<Message>* out);
+
+/// \brief Compute the number of bytes needed to write a sparse tensor
+/// including metadata, such as to create a plasma object of
+///
+/// \param[in] sparse_tensor the SparseTensor to write
+/// \param[out] size the size of the complete encapsulated message
+/// \return Status
+ARROW_EXPORT
+Status GetSparseTensorSize(const SparseTensor& sparse_tensor, int64_t* size);
+
 }  // namespace ipc
 }  // namespace arrow
 
@@ -16,6 +16,10 @@
 // under the License.
 
 #include <cstdint>
+#include <cstring>
+#include <limits>
+#include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -52,7 +56,7 @@ TEST(DefaultMemoryPoolDeathTest, FreeLargeMemory) {
 
 #ifndef NDEBUG
   EXPECT_DEATH(pool->Free(data, 120),
-               ".*Check failed: \\(bytes_allocated_\\) >= \\(size\\)");
+               ".*Check failed: \\(bytes_allocated\\(\\)\\) >= \\(size\\)");
 #endif
 
   pool->Free(data, 100);
@@ -112,4 +116,473 @@ TEST(ProxyMemoryPool, Logging) {
   ASSERT_EQ(0, pool->bytes_allocated());
   ASSERT_EQ(0, pp.bytes_allocated());
 }
+
+class TestMappedMemoryPool : public ::arrow::test::TestMemoryPoolBase {
+ public:
+  ::arrow::MemoryPool* memory_pool() override { return pool_.get(); }
+
+ protected:
+  static DefaultMemoryPoolOptions MappingOptions() {
+    DefaultMemoryPoolOptions options;
+    options.large_allocation_threshold = 16;
+    options.huge_pages = HugePages::MADVISE;
+    return options;
+  }
+
+  std::unique_ptr<MemoryPool> pool_ = NewDefaultMemoryPool(MappingOptions());
+};
+
+TEST_F(TestMappedMemoryPool, MemoryTracking) { this->TestMemoryTracking(); }
+
+TEST_F(TestMappedMemoryPool, OOM) {
+#ifndef ADDRESS_SANITIZER
+  this->TestOOM();
+#endif
+}
+
+TEST_F(TestMappedMemoryPool, Reallocate) { this->TestReallocate(); }
+
+TEST(DefaultMemoryPoolOptions, HugePages) {
+  for (auto huge_pages : {HugePages::NONE, HugePages::MADVISE, HugePages::HUGETLB}) {
+    DefaultMemoryPoolOptions options;
+    options.large_allocation_threshold = 1 << 20;
+    options.huge_pages = huge_pages;
+    std::unique_ptr<MemoryPool> pool = NewDefaultMemoryPool(options);
+
+    // Grow from the allocator into a mapping and back
+    uint8_t* data;
+    ASSERT_OK(pool->Allocate(1000, &data));
+    memset(data, 1, 1000);
+    ASSERT_OK(pool->Reallocate(1000, 3 << 20, &data));
+    if (huge_pages != HugePages::NONE) {
+      ASSERT_EQ(0, reinterpret_cast<uintptr_t>(data) % (2 << 20));
+    }
+    ASSERT_EQ(1, data[999]);
+    memset(data, 2, 3 << 20);
+    ASSERT_OK(pool->Reallocate(3 << 20, 100, &data));
+    ASSERT_EQ(2, data[99]);
+    ASSERT_EQ(100, pool->bytes_allocated());
+    pool->Free(data, 100);
+    ASSERT_EQ(3 << 20, pool->max_memory());
+  }
+}
+
+#ifdef __linux__
+TEST(DefaultMemoryPoolOptions, NumaNode) {
+  DefaultMemoryPoolOptions options;
+  options.large_allocation_threshold = 1 << 20;
+  options.numa_node = 0;
+  std::unique_ptr<MemoryPool> pool = NewDefaultMemoryPool(options);
+
+  uint8_t* data;
+  Status st = pool->Allocate(4 << 20, &data);
+  if (st.IsIOError()) {
+    // mbind may be disallowed, e.g. in containers
+    return;
+  }
+  ASSERT_OK(st);
+  memset(data, 0, 4 << 20);
+  pool->Free(data, 4 << 20);
+
+  options.numa_node = 100000;
+  pool = NewDefaultMemoryPool(options);
+  ASSERT_RAISES(Invalid, pool->Allocate(4 << 20, &data));
+}
+#endif
+
+#ifdef __linux__
+TEST(DefaultMemoryPoolOptions, RemapLargeAllocations) {
+  DefaultMemoryPoolOptions options;
+  options.large_allocation_threshold = 1 << 20;
+  std::unique_ptr<MemoryPool> pool = NewDefaultMemoryPool(options);
+
+  uint8_t* data;
+  ASSERT_OK(pool->Allocate(1 << 20, &data));
+  memset(data, 3, 1 << 20);
+  ASSERT_OK(pool->Reallocate(1 << 20, (1 << 20) + 10, &data));
+  ASSERT_EQ(3, data[(1 << 20) - 1]);
+  // Growing within the last page keeps the region in place
+  uint8_t* previous = data;
+  ASSERT_OK(pool->Reallocate((1 << 20) + 10, (1 << 20) + 20, &data));
+  ASSERT_EQ(previous, data);
+
+  ASSERT_OK(pool->Reallocate((1 << 20) + 20, 64 << 20, &data));
+  ASSERT_EQ(3, data[0]);
+  ASSERT_EQ(3, data[(1 << 20) - 1]);
+  data[(64 << 20) - 1] = 4;
+  ASSERT_OK(pool->Reallocate(64 << 20, 2 << 20, &data));
+  ASSERT_EQ(3, data[(1 << 20) - 1]);
+  ASSERT_EQ(2 << 20, pool->bytes_allocated());
+  pool->Free(data, 2 << 20);
+  ASSERT_EQ(0, pool->bytes_allocated());
+}
+#endif
+
+class TestShardedMemoryPool : public ::arrow::test::TestMemoryPoolBase {
+ public:
+  ::arrow::MemoryPool* memory_pool() override { return pool_.get(); }
+
+ protected:
+  std::unique_ptr<MemoryPool> pool_ = NewDefaultMemoryPool(MemoryPoolStatistics::SHARDED);
+};
+
+TEST_F(TestShardedMemoryPool, MemoryTracking) { this->TestMemoryTracking(); }
+
+TEST_F(TestShardedMemoryPool, OOM) {
+#ifndef ADDRESS_SANITIZER
+  this->TestOOM();
+#endif
+}
+
+TEST_F(TestShardedMemoryPool, Reallocate) { this->TestReallocate(); }
+
+TEST(ProxyMemoryPool, ShardedStatistics) {
+  ProxyMemoryPool pool(default_memory_pool(), MemoryPoolStatistics::SHARDED);
+
+  const int num_threads = 8;
+  std::vector<std::thread> threads;
+  for (int i = 0; i < num_threads; ++i) {
+    threads.emplace_back([&pool]() {
+      std::vector<uint8_t*> allocations;
+      for (int j = 0; j < 100; ++j) {
+        uint8_t* data;
+        ASSERT_OK(pool.Allocate(1000, &data));
+        allocations.push_back(data);
+      }
+      for (int j = 0; j < 50; ++j) {
+        pool.Free(allocations[j], 1000);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  ASSERT_EQ(num_threads * 50 * 1000, pool.bytes_allocated());
+  ASSERT_GE(pool.max_memory(), pool.bytes_allocated());
+
+  // Large updates are folded into the global counters right away
+  uint8_t* data;
+  ASSERT_OK(pool.Allocate(1 << 24, &data));
+  ASSERT_GE(pool.max_memory(), 1 << 24);
+  pool.Free(data, 1 << 24);
+  ASSERT_EQ(num_threads * 50 * 1000, pool.bytes_allocated());
+}
+class TestCachingMemoryPool : public ::arrow::test::TestMemoryPoolBase {
+ public:
+  ::arrow::MemoryPool* memory_pool() override { return &pool_; }
+
+ protected:
+  CachingMemoryPool pool_{default_memory_pool()};
+};
+
+TEST_F(TestCachingMemoryPool, MemoryTracking) { this->TestMemoryTracking(); }
+
+TEST_F(TestCachingMemoryPool, OOM) {
+#ifndef ADDRESS_SANITIZER
+  this->TestOOM();
+#endif
+}
+
+TEST_F(TestCachingMemoryPool, Reallocate) { this->TestReallocate(); }
+
+TEST(CachingMemoryPool, ReuseSizeClass) {
+  ProxyMemoryPool underlying(default_memory_pool());
+  CachingMemoryPool pool(&underlying);
+
+  uint8_t* data;
+  ASSERT_OK(pool.Allocate(100, &data));
+  ASSERT_EQ(0, pool.cache_hits());
+  ASSERT_EQ(1, pool.cache_misses());
+  ASSERT_EQ(100, pool.bytes_allocated());
+  ASSERT_EQ(128, underlying.bytes_allocated());
+
+  pool.Free(data, 100);
+  ASSERT_EQ(0, pool.bytes_allocated());
+  ASSERT_EQ(128, pool.bytes_retained());
+  ASSERT_EQ(128, underlying.bytes_allocated());
+
+  // Any size in the same class is served from the free list
+  uint8_t* data2;
+  ASSERT_OK(pool.Allocate(120, &data2));
+  ASSERT_EQ(data, data2);
+  ASSERT_EQ(1, pool.cache_hits());
+  ASSERT_EQ(0, pool.bytes_retained());
+
+  // Growing within the size class does not move the region
+  ASSERT_OK(pool.Reallocate(120, 128, &data2));
+  ASSERT_EQ(data, data2);
+
+  pool.Free(data2, 128);
+  pool.ReleaseUnused();
+  ASSERT_EQ(0, pool.bytes_retained());
+  ASSERT_EQ(0, underlying.bytes_allocated());
+  ASSERT_EQ(128, pool.max_memory());
+}
+
+TEST(CachingMemoryPool, RetainedBytesCap) {
+  ProxyMemoryPool underlying(default_memory_pool());
+  CachingMemoryPool pool(&underlying, 256);
+
+  uint8_t* data1;
+  uint8_t* data2;
+  ASSERT_OK(pool.Allocate(200, &data1));
+  ASSERT_OK(pool.Allocate(200, &data2));
+  ASSERT_EQ(512, underlying.bytes_allocated());
+
+  pool.Free(data1, 200);
+  // Retaining data2 as well would exceed the cap
+  pool.Free(data2, 200);
+  ASSERT_EQ(256, pool.bytes_retained());
+  ASSERT_EQ(256, underlying.bytes_allocated());
+}
+
+TEST(CachingMemoryPool, LargeAllocationsBypassCache) {
+  ProxyMemoryPool underlying(default_memory_pool());
+  CachingMemoryPool pool(&underlying);
+
+  const int64_t size = CachingMemoryPool::kMaxCachedSize + 1;
+  uint8_t* data;
+  ASSERT_OK(pool.Allocate(size, &data));
+  ASSERT_EQ(size, underlying.bytes_allocated());
+  ASSERT_EQ(0, pool.cache_misses());
+
+  pool.Free(data, size);
+  ASSERT_EQ(0, pool.bytes_retained());
+  ASSERT_EQ(0, underlying.bytes_allocated());
+}
+
+class TestArenaMemoryPool : public ::arrow::test::TestMemoryPoolBase {
+ public:
+  ::arrow::MemoryPool* memory_pool() override { return &pool_; }
+
+ protected:
+  ArenaMemoryPool pool_{default_memory_pool(), 4096};
+};
+
+TEST_F(TestArenaMemoryPool, MemoryTracking) { this->TestMemoryTracking(); }
+
+TEST_F(TestArenaMemoryPool, OOM) {
+#ifndef ADDRESS_SANITIZER
+  this->TestOOM();
+#endif
+}
+
+TEST_F(TestArenaMemoryPool, Reallocate) { this->TestReallocate(); }
+
+TEST(ArenaMemoryPool, BumpAllocation) {
+  ProxyMemoryPool underlying(default_memory_pool());
+  ArenaMemoryPool pool(&underlying, 1024);
+
+  uint8_t* data1;
+  uint8_t* data2;
+  ASSERT_OK(pool.Allocate(10, &data1));
+  ASSERT_OK(pool.Allocate(10, &data2));
+  ASSERT_EQ(data1 + 64, data2);
+  ASSERT_EQ(1024, underlying.bytes_allocated());
+
+  // The last allocation grows in place
+  ASSERT_OK(pool.Reallocate(10, 200, &data2));
+  ASSERT_EQ(data1 + 64, data2);
+
+  // A slab of its own for an oversized allocation
+  uint8_t* data3;
+  ASSERT_OK(pool.Allocate(2000, &data3));
+  ASSERT_EQ(3024, underlying.bytes_allocated());
+  ASSERT_EQ(3024, pool.bytes_reserved());
+  ASSERT_EQ(2210, pool.bytes_allocated());
+
+  pool.Free(data1, 10);
+  pool.Free(data2, 200);
+  pool.Free(data3, 2000);
+  ASSERT_EQ(0, pool.bytes_allocated());
+  ASSERT_EQ(3024, underlying.bytes_allocated());
+
+  // The first slab is kept around for reuse
+  pool.Reset();
+  ASSERT_EQ(1024, underlying.bytes_allocated());
+  ASSERT_EQ(3024, pool.max_memory());
+
+  uint8_t* data4;
+  ASSERT_OK(pool.Allocate(10, &data4));
+  ASSERT_EQ(data1, data4);
+  pool.Free(data4, 10);
+}
+
+TEST(ArenaMemoryPool, MultipleThreads) {
+  ProxyMemoryPool underlying(default_memory_pool());
+  ArenaMemoryPool pool(&underlying, 1024);
+
+  const int num_threads = 4;
+  std::vector<uint8_t*> first_allocations(num_threads);
+  std::vector<std::thread> threads;
+  for (int i = 0; i < num_threads; ++i) {
+    threads.emplace_back([&pool, &first_allocations, i]() {
+      for (int j = 0; j < 100; ++j) {
+        uint8_t* data;
+        ASSERT_OK(pool.Allocate(100, &data));
+        if (j == 0) {
+          first_allocations[i] = data;
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  // Each thread filled slabs of its own
+  ASSERT_EQ(num_threads * 100 * 100, pool.bytes_allocated());
+  ASSERT_EQ(num_threads * 13 * 1024, underlying.bytes_allocated());
+  for (int i = 1; i < num_threads; ++i) {
+    ASSERT_NE(first_allocations[0], first_allocations[i]);
+  }
+
+  pool.Reset();
+  ASSERT_EQ(0, pool.bytes_allocated());
+  ASSERT_EQ(num_threads * 1024, underlying.bytes_allocated());
+}
+
+class TestInstrumentedMemoryPool : public ::arrow::test::TestMemoryPoolBase {
+ public:
+  ::arrow::MemoryPool* memory_pool() override { return &pool_; }
+
+ protected:
+  InstrumentedMemoryPool pool_{default_memory_pool()};
+};
+
+TEST_F(TestInstrumentedMemoryPool, MemoryTracking) { this->TestMemoryTracking(); }
+
+TEST_F(TestInstrumentedMemoryPool, OOM) {
+#ifndef ADDRESS_SANITIZER
+  this->TestOOM();
+#endif
+}
+
+TEST_F(TestInstrumentedMemoryPool, Reallocate) { this->TestReallocate(); }
+
+TEST(InstrumentedMemoryPool, Statistics) {
+  InstrumentedMemoryPool pool(default_memory_pool());
+
+  uint8_t* data1;
+  uint8_t* data2;
+  ASSERT_OK(pool.Allocate(100, &data1));
+  ASSERT_OK(pool.Allocate(128, &data2));
+  ASSERT_OK(pool.Reallocate(100, 1000, &data1));
+
+  ASSERT_EQ(2, pool.num_allocations());
+  ASSERT_EQ(1, pool.num_reallocations());
+  ASSERT_EQ(100, pool.reallocated_bytes());
+
+  std::vector<int64_t> histogram = pool.size_histogram();
+  ASSERT_EQ(InstrumentedMemoryPool::kNumHistogramBuckets,
+            static_cast<int>(histogram.size()));
+  // Both 100 and 128 bytes fall into (64, 128]
+  ASSERT_EQ(2, histogram[7]);
+
+  pool.Free(data1, 1000);
+  pool.Free(data2, 128);
+  ASSERT_EQ(2, pool.num_frees());
+  ASSERT_EQ(0, pool.bytes_allocated());
+  ASSERT_EQ(1128, pool.max_memory());
+  ASSERT_GT(pool.allocation_rate(), 0);
+
+  pool.ResetStatistics();
+  ASSERT_EQ(0, pool.num_allocations());
+  ASSERT_EQ(0, pool.size_histogram()[7]);
+}
+
+TEST(InstrumentedMemoryPool, SampleLargeAllocations) {
+  InstrumentedMemoryPoolOptions options;
+  options.large_allocation_threshold = 4096;
+  options.sample_interval = 2;
+  options.max_samples = 2;
+  InstrumentedMemoryPool pool(default_memory_pool(), options);
+
+  for (int64_t size : {100, 5000, 6000, 7000, 8000, 9000}) {
+    uint8_t* data;
+    ASSERT_OK(pool.Allocate(size, &data));
+    pool.Free(data, size);
+  }
+
+  // Every other large allocation was sampled: 5000, 7000 and 9000. Only the
+  // last two are kept
+  std::vector<AllocationSample> samples = pool.samples();
+  ASSERT_EQ(2, samples.size());
+  ASSERT_EQ(7000, samples[0].size);
+  ASSERT_EQ(9000, samples[1].size);
+}
+
+class TestCappedMemoryPool : public ::arrow::test::TestMemoryPoolBase {
+ public:
+  ::arrow::MemoryPool* memory_pool() override { return &pool_; }
+
+ protected:
+  CappedMemoryPool pool_{default_memory_pool(), std::numeric_limits<int64_t>::max()};
+};
+
+TEST_F(TestCappedMemoryPool, MemoryTracking) { this->TestMemoryTracking(); }
+
+TEST_F(TestCappedMemoryPool, OOM) {
+#ifndef ADDRESS_SANITIZER
+  this->TestOOM();
+#endif
+}
+
+TEST_F(TestCappedMemoryPool, Reallocate) { this->TestReallocate(); }
+
+TEST(CappedMemoryPool, Limit) {
+  CappedMemoryPool pool(default_memory_pool(), 1000);
+
+  uint8_t* data1;
+  uint8_t* data2;
+  ASSERT_OK(pool.Allocate(600, &data1));
+  ASSERT_RAISES(OutOfMemory, pool.Allocate(600, &data2));
+  ASSERT_EQ(600, pool.bytes_allocated());
+
+  ASSERT_OK(pool.Allocate(400, &data2));
+  ASSERT_RAISES(OutOfMemory, pool.Reallocate(400, 401, &data2));
+  ASSERT_OK(pool.Reallocate(400, 100, &data2));
+  ASSERT_EQ(700, pool.bytes_allocated());
+
+  pool.Free(data1, 600);
+  pool.Free(data2, 100);
+  ASSERT_EQ(0, pool.bytes_allocated());
+  ASSERT_EQ(1000, pool.max_memory());
+}
+
+TEST(CappedMemoryPool, ReleaseCallback) {
+  CappedMemoryPool pool(default_memory_pool(), 1000);
+
+  std::vector<uint8_t*> cached;
+  for (int i = 0; i < 4; ++i) {
+    uint8_t* data;
+    ASSERT_OK(pool.Allocate(200, &data));
+    cached.push_back(data);
+  }
+
+  std::vector<int64_t> requests;
+  pool.set_release_callback([&](int64_t bytes_over_limit) {
+    requests.push_back(bytes_over_limit);
+    if (!cached.empty()) {
+      pool.Free(cached.back(), 200);
+      cached.pop_back();
+    }
+  });
+
+  // Needs two entries to be released
+  uint8_t* data;
+  ASSERT_OK(pool.Allocate(550, &data));
+  ASSERT_EQ(2, cached.size());
+  ASSERT_EQ(std::vector<int64_t>({350, 150}), requests);
+  ASSERT_EQ(950, pool.bytes_allocated());
+
+  // Cannot succeed even after releasing everything
+  uint8_t* data2;
+  ASSERT_RAISES(OutOfMemory, pool.Allocate(600, &data2));
+  ASSERT_EQ(0, cached.size());
+  ASSERT_EQ(550, pool.bytes_allocated());
+
+  pool.Free(data, 550);
+}
+
 }  // namespace arrow
@@ -20,14 +20,20 @@
 #include <algorithm>
 #include <atomic>
 #include <cerrno>
+#include <chrono>
 #include <cstdlib>
 #include <cstring>
+#include <deque>
 #include <iostream>
 #include <memory>
 #include <mutex>
 #include <sstream>  // IWYU pragma: keep
+#include <thread>
+#include <unordered_map>
+#include <vector>
 
 #include "arrow/status.h"
+#include "arrow/util/bit-util.h"
 #include "arrow/util/logging.h"
 
 #ifdef ARROW_JEMALLOC
@@ -37,6 +43,21 @@
 #include "jemalloc_ep/dist/include/jemalloc/jemalloc.h"
 #endif
 
+#if defined(__GLIBC__) || defined(__APPLE__)
+#include <execinfo.h>
+#define ARROW_HAVE_EXECINFO
+#endif
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <unistd.h>
+#define ARROW_HAVE_MMAP
+#endif
+
+#ifdef __linux__
+#include <sys/syscall.h>
+#endif
+
 namespace arrow {
 
 constexpr size_t kAlignment = 64;
@@ -80,6 +101,139 @@ Status AllocateAligned(int64_t size, uint8_t** out) {
 #endif
   return Status::OK();
 }
+
+void FreeAligned(uint8_t* buffer) {
+#ifdef _MSC_VER
+  _aligned_free(buffer);
+#elif defined(ARROW_JEMALLOC)
+  dallocx(buffer, MALLOCX_ALIGN(kAlignment));
+#else
+  std::free(buffer);
+#endif
+}
+
+#ifdef ARROW_HAVE_MMAP
+
+constexpr int64_t kHugePageSize = 2 << 20;
+
+// Size of the mapping backing a large allocation
+int64_t MappedSize(int64_t size, const DefaultMemoryPoolOptions& options) {
+  const int64_t granularity = options.huge_pages == HugePages::NONE
+                                  ? static_cast<int64_t>(sysconf(_SC_PAGESIZE))
+                                  : kHugePageSize;
+  return BitUtil::RoundUp(size, granularity);
+}
+
+Status BindToNumaNode(uint8_t* data, int64_t mapped_size, int numa_node) {
+#if defined(__linux__) && defined(SYS_mbind)
+  constexpr int kMaxNumaNodes = 1024;
+  constexpr int kBitsPerWord = static_cast<int>(sizeof(unsigned long) * 8);  // NOLINT
+  constexpr int kMpolBind = 2;
+  if (numa_node >= kMaxNumaNodes) {
+    std::stringstream ss;
+    ss << "invalid NUMA node: " << numa_node;
+    return Status::Invalid(ss.str());
+  }
+  unsigned long node_mask[kMaxNumaNodes / kBitsPerWord] = {};  // NOLINT
+  node_mask[numa_node / kBitsPerWord] = 1UL << (numa_node % kBitsPerWord);
+  if (syscall(SYS_mbind, data, static_cast<unsigned long>(mapped_size),  // NOLINT
+              kMpolBind, node_mask, kMaxNumaNodes + 1, 0) != 0) {
+    std::stringstream ss;
+    ss << "failed to bind memory to NUMA node " << numa_node << ": "
+       << std::strerror(errno);
+    return Status::IOError(ss.str());
+  }
+  return Status::OK();
+#else
+  return Status::NotImplemented("NUMA binding is only supported on Linux");
+#endif
+}
+
+// Map a large allocation directly from the OS so that huge page and NUMA
+// placement can be applied to it
+Status AllocateMapped(int64_t size, const DefaultMemoryPoolOptions& options,
+                      uint8_t** out) {
+  const int64_t mapped_size = MappedSize(size, options);
+  void* data = MAP_FAILED;
+#ifdef MAP_HUGETLB
+  if (options.huge_pages == HugePages::HUGETLB) {
+    // Falls back to madvise below if no huge pages are reserved
+    data = mmap(nullptr, static_cast<size_t>(mapped_size), PROT_READ | PROT_WRITE,
+                MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+  }
+#endif
+  if (data == MAP_FAILED) {
+    int64_t reserved_size = mapped_size;
+    if (options.huge_pages != HugePages::NONE) {
+      // Over-reserve so that the mapping can be trimmed to a huge page boundary
+      reserved_size += kHugePageSize;
+    }
+    uint8_t* reserved = reinterpret_cast<uint8_t*>(
+        mmap(nullptr, static_cast<size_t>(reserved_size), PROT_READ | PROT_WRITE,
+             MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+    if (reserved == MAP_FAILED) {
+      std::stringstream ss;
+      ss << "mmap of size " << size << " failed";
+      return Status::OutOfMemory(ss.str());
+    }
+    uint8_t* aligned = reserved;
+    if (options.huge_pages != HugePages::NONE) {
+      const uintptr_t address = reinterpret_cast<uintptr_t>(reserved);
+      aligned = reinterpret_cast<uint8_t*>(
+          BitUtil::RoundUp(static_cast<int64_t>(address), kHugePageSize));
+      if (aligned > reserved) {
+        munmap(reserved, static_cast<size_t>(aligned - reserved));
+      }
+      const int64_t tail = (reserved + reserved_size) - (aligned + mapped_size);
+      if (tail > 0) {
+        munmap(aligned + mapped_size, static_cast<size_t>(tail));
+      }
+#ifdef MADV_HUGEPAGE
+      madvise(aligned, static_cast<size_t>(mapped_size), MADV_HUGEPAGE);
+#endif
+    }
+    data = aligned;
+  }
+  if (options.numa_node >= 0) {
+    Status s =
+        BindToNumaNode(reinterpret_cast<uint8_t*>(data), mapped_size, options.numa_node);
+    if (!s.ok()) {
+      munmap(data, static_cast<size_t>(mapped_size));
+      return s;
+    }
+  }
+  *out = reinterpret_cast<uint8_t*>(data);
+  return Status::OK();
+}
+
+void FreeMapped(uint8_t* buffer, int64_t size, const DefaultMemoryPoolOptions& options) {
+  munmap(buffer, static_cast<size_t>(MappedSize(size, options)));
+}
+
+// Resize a mapping by remapping its pages rather than copying them. Returns
+// false if the kernel does not support it for this mapping.
+bool RemapMapped(int64_t old_size, int64_t new_size,
+                 const DefaultMemoryPoolOptions& options, uint8_t** ptr) {
+#if defined(__linux__) && defined(MREMAP_MAYMOVE)
+  const int64_t old_mapped_size = MappedSize(old_size, options);
+  const int64_t new_mapped_size = MappedSize(new_size, options);
+  if (old_mapped_size == new_mapped_size) {
+    return true;
+  }
+  void* data = mremap(*ptr, static_cast<size_t>(old_mapped_size),
+                      static_cast<size_t>(new_mapped_size), MREMAP_MAYMOVE);
+  if (data == MAP_FAILED) {
+    return false;
+  }
+  *ptr = reinterpret_cast<uint8_t*>(data);
+  return true;
+#else
+  return false;
+#endif
+}
+
+#endif  // defined(ARROW_HAVE_MMAP)
+
 }  // namespace
 
 MemoryPool::MemoryPool() {}
@@ -88,90 +242,212 @@ MemoryPool::~MemoryPool() {}
 
 int64_t MemoryPool::max_memory() const { return -1; }
 
+namespace {
+
+// Allocation statistics shared by DefaultMemoryPool and ProxyMemoryPool
+class MemoryPoolStats {
+ public:
+  explicit MemoryPoolStats(MemoryPoolStatistics::type mode) : mode_(mode) {}
+
+  void UpdateAllocatedBytes(int64_t diff) {
+    if (mode_ == MemoryPoolStatistics::SHARED) {
+      UpdateMaxMemory(bytes_allocated_ += diff);
+      return;
+    }
+    // Accumulate in this thread's shard, and only fold into the global
+    // counter once the pending amount exceeds the slack
+    Shard& shard = shards_[ThreadShardIndex()];
+    const int64_t pending =
+        shard.pending.fetch_add(diff, std::memory_order_relaxed) + diff;
+    if (pending > kShardSlack || pending < -kShardSlack) {
+      const int64_t flushed = shard.pending.exchange(0, std::memory_order_relaxed);
+      UpdateMaxMemory(bytes_allocated_ += flushed);
+    }
+  }
+
+  int64_t bytes_allocated() const {
+    int64_t total = bytes_allocated_.load();
+    if (mode_ == MemoryPoolStatistics::SHARDED) {
+      for (const Shard& shard : shards_) {
+        total += shard.pending.load(std::memory_order_relaxed);
+      }
+    }
+    return total;
+  }
+
+  int64_t max_memory() const {
+    if (mode_ == MemoryPoolStatistics::SHARED) {
+      return max_memory_.load();
+    }
+    return std::max(max_memory_.load(), bytes_allocated());
+  }
+
+ private:
+  static constexpr int kNumShards = 64;
+  static constexpr int64_t kShardSlack = 1 << 20;
+
+  // Padded to a cache line so that shards do not false-share
+  struct Shard {
+    std::atomic<int64_t> pending{0};
+    char padding[64 - sizeof(std::atomic<int64_t>)];
+  };
+
+  static int ThreadShardIndex() {
+    static std::atomic<int> next_index{0};
+    static thread_local int index = next_index++ % kNumShards;
+    return index;
+  }
+
+  void UpdateMaxMemory(int64_t allocated) {
+    int64_t max_memory = max_memory_.load();
+    while (allocated > max_memory &&
+           !max_memory_.compare_exchange_weak(max_memory, allocated)) {
+    }
+  }
+
+  const MemoryPoolStatistics::type mode_;
+  std::atomic<int64_t> bytes_allocated_{0};
+  std::atomic<int64_t> max_memory_{0};
+  Shard shards_[kNumShards];
+};
+
+}  // namespace
+
 class DefaultMemoryPool : public MemoryPool {
  public:
-  DefaultMemoryPool() : bytes_allocated_(0) { max_memory_ = 0; }
+  explicit DefaultMemoryPool(const DefaultMemoryPoolOptions& options)
+      : options_(options), stats_(options.stats) {}
 
   ~DefaultMemoryPool() override {}
 
   Status Allocate(int64_t size, uint8_t** out) override {
-    RETURN_NOT_OK(AllocateAligned(size, out));
-    bytes_allocated_ += size;
-
-    {
-      std::lock_guard<std::mutex> guard(lock_);
-      if (bytes_allocated_ > max_memory_) {
-        max_memory_ = bytes_allocated_.load();
-      }
-    }
+    RETURN_NOT_OK(AllocateInternal(size, out));
+    stats_.UpdateAllocatedBytes(size);
     return Status::OK();
   }
 
   Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override {
-#ifdef ARROW_JEMALLOC
-    uint8_t* previous_ptr = *ptr;
-    *ptr = reinterpret_cast<uint8_t*>(rallocx(*ptr, new_size, MALLOCX_ALIGN(kAlignment)));
-    if (*ptr == NULL) {
-      std::stringstream ss;
-      ss << "realloc of size " << new_size << " failed";
-      *ptr = previous_ptr;
-      return Status::OutOfMemory(ss.str());
+#ifdef ARROW_HAVE_MMAP
+    if (IsMapped(old_size) && IsMapped(new_size) &&
+        RemapMapped(old_size, new_size, options_, ptr)) {
+      stats_.UpdateAllocatedBytes(new_size - old_size);
+      return Status::OK();
     }
+#endif
+    if (IsMapped(old_size) || IsMapped(new_size)) {
+      RETURN_NOT_OK(ReallocateCopy(old_size, new_size, ptr));
+    } else {
+#ifdef ARROW_JEMALLOC
+      // Try to grow or shrink in place before letting rallocx move the region
+      if (xallocx(*ptr, static_cast<size_t>(new_size), 0, MALLOCX_ALIGN(kAlignment)) >=
+          static_cast<size_t>(new_size)) {
+        stats_.UpdateAllocatedBytes(new_size - old_size);
+        return Status::OK();
+      }
+      uint8_t* previous_ptr = *ptr;
+      *ptr =
+          reinterpret_cast<uint8_t*>(rallocx(*ptr, new_size, MALLOCX_ALIGN(kAlignment)));
+      if (*ptr == NULL) {
+        std::stringstream ss;
+        ss << "realloc of size " << new_size << " failed";
+        *ptr = previous_ptr;
+        return Status::OutOfMemory(ss.str());
+      }
 #else
-    // Note: We cannot use realloc() here as it doesn't guarantee alignment.
-
-    // Allocate new chunk
-    uint8_t* out = nullptr;
-    RETURN_NOT_OK(AllocateAligned(new_size, &out));
-    DCHECK(out);
-    // Copy contents and release old memory chunk
-    memcpy(out, *ptr, static_cast<size_t>(std::min(new_size, old_size)));
-#ifdef _MSC_VER
-    _aligned_free(*ptr);
-#else
-    std::free(*ptr);
-#endif  // defined(_MSC_VER)
-    *ptr = out;
+      // Note: We cannot use realloc() here as it doesn't guarantee alignment.
+      RETURN_NOT_OK(ReallocateCopy(old_size, new_size, ptr));
 #endif  // defined(ARROW_JEMALLOC)
-
-    bytes_allocated_ += new_size - old_size;
-    {
-      std::lock_guard<std::mutex> guard(lock_);
-      if (bytes_allocated_ > max_memory_) {
-        max_memory_ = bytes_allocated_.load();
-      }
     }
 
+    stats_.UpdateAllocatedBytes(new_size - old_size);
     return Status::OK();
   }
 
-  int64_t bytes_allocated() const override { return bytes_allocated_.load(); }
+  int64_t bytes_allocated() const override { return stats_.bytes_allocated(); }
 
   void Free(uint8_t* buffer, int64_t size) override {
-    DCHECK_GE(bytes_allocated_, size);
-#ifdef _MSC_VER
-    _aligned_free(buffer);
-#elif defined(ARROW_JEMALLOC)
-    dallocx(buffer, MALLOCX_ALIGN(kAlignment));
+    DCHECK_GE(bytes_allocated(), size);
+    FreeInternal(buffer, size);
+    stats_.UpdateAllocatedBytes(-size);
+  }
+
+  int64_t max_memory() const override { return stats_.max_memory(); }
+
+ private:
+  bool IsMapped(int64_t size) const {
+#ifdef ARROW_HAVE_MMAP
+    return options_.large_allocation_threshold > 0 &&
+           size >= options_.large_allocation_threshold;
 #else
-    std::free(buffer);
+    return false;
 #endif
-    bytes_allocated_ -= size;
   }
 
-  int64_t max_memory() const override { return max_memory_.load(); }
+  Status AllocateInternal(int64_t size, uint8_t** out) {
+#ifdef ARROW_HAVE_MMAP
+    if (IsMapped(size)) {
+      return AllocateMapped(size, options_, out);
+    }
+#endif
+    return AllocateAligned(size, out);
+  }
 
- private:
-  mutable std::mutex lock_;
-  std::atomic<int64_t> bytes_allocated_;
-  std::atomic<int64_t> max_memory_;
+  void FreeInternal(uint8_t* buffer, int64_t size) {
+#ifdef ARROW_HAVE_MMAP
+    if (IsMapped(size)) {
+      FreeMapped(buffer, size, options_);
+      return;
+    }
+#endif
+    FreeAligned(buffer);
+  }
+
+  Status ReallocateCopy(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+    // Allocate new chunk
+    uint8_t* out = nullptr;
+    RETURN_NOT_OK(AllocateInternal(new_size, &out));
+    DCHECK(out);
+    // Copy contents and release old memory chunk
+    memcpy(out, *ptr, static_cast<size_t>(std::min(new_size, old_size)));
+    FreeInternal(*ptr, old_size);
+    *ptr = out;
+    return Status::OK();
+  }
+
+  const DefaultMemoryPoolOptions options_;
+  MemoryPoolStats stats_;
 };
 
+namespace {
+
+DefaultMemoryPoolOptions GlobalMemoryPoolOptions() {
+  DefaultMemoryPoolOptions options;
+#if defined(__linux__) && !defined(ARROW_JEMALLOC)
+  // Map very large buffers directly, so that growing them remaps pages
+  // instead of copying the data
+  options.large_allocation_threshold = kDefaultMemoryPoolRemapThreshold;
+#endif
+  return options;
+}
+
+}  // namespace
+
 MemoryPool* default_memory_pool() {
-  static DefaultMemoryPool default_memory_pool_;
+  static DefaultMemoryPool default_memory_pool_{GlobalMemoryPoolOptions()};
   return &default_memory_pool_;
 }
 
+std::unique_ptr<MemoryPool> NewDefaultMemoryPool(
+    const DefaultMemoryPoolOptions& options) {
+  return std::unique_ptr<MemoryPool>(new DefaultMemoryPool(options));
+}
+
+std::unique_ptr<MemoryPool> NewDefaultMemoryPool(MemoryPoolStatistics::type stats_mode) {
+  DefaultMemoryPoolOptions options;
+  options.stats = stats_mode;
+  return NewDefaultMemoryPool(options);
+}
+
 LoggingMemoryPool::LoggingMemoryPool(MemoryPool* pool) : pool_(pool) {}
 
 Status LoggingMemoryPool::Allocate(int64_t size, uint8_t** out) {
@@ -206,28 +482,465 @@ int64_t LoggingMemoryPool::max_memory() const {
 
 class ProxyMemoryPool::ProxyMemoryPoolImpl {
  public:
-  explicit ProxyMemoryPoolImpl(MemoryPool* pool) : pool_(pool) {}
+  ProxyMemoryPoolImpl(MemoryPool* pool, MemoryPoolStatistics::type stats_mode)
+      : pool_(pool), stats_(stats_mode) {}
 
   Status Allocate(int64_t size, uint8_t** out) {
     RETURN_NOT_OK(pool_->Allocate(size, out));
-    bytes_allocated_ += size;
+    stats_.UpdateAllocatedBytes(size);
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+    RETURN_NOT_OK(pool_->Reallocate(old_size, new_size, ptr));
+    stats_.UpdateAllocatedBytes(new_size - old_size);
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size) {
+    pool_->Free(buffer, size);
+    stats_.UpdateAllocatedBytes(-size);
+  }
+
+  int64_t bytes_allocated() const { return stats_.bytes_allocated(); }
+
+  int64_t max_memory() const { return stats_.max_memory(); }
+
+ private:
+  MemoryPool* pool_;
+  MemoryPoolStats stats_;
+};
+
+ProxyMemoryPool::ProxyMemoryPool(MemoryPool* pool,
+                                 MemoryPoolStatistics::type stats_mode) {
+  impl_.reset(new ProxyMemoryPoolImpl(pool, stats_mode));
+}
+
+ProxyMemoryPool::~ProxyMemoryPool() {}
+
+Status ProxyMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  return impl_->Allocate(size, out);
+}
+
+Status ProxyMemoryPool::Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, ptr);
+}
+
+void ProxyMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  return impl_->Free(buffer, size);
+}
+
+int64_t ProxyMemoryPool::bytes_allocated() const { return impl_->bytes_allocated(); }
+
+int64_t ProxyMemoryPool::max_memory() const { return impl_->max_memory(); }
+
+// ----------------------------------------------------------------------
+// CachingMemoryPool implementation
+
+constexpr int64_t CachingMemoryPool::kMaxCachedSize;
+constexpr int64_t CachingMemoryPool::kDefaultMaxRetainedBytes;
+
+class CachingMemoryPool::CachingMemoryPoolImpl {
+ public:
+  static constexpr int kMinSizeClassLog2 = 6;
+  static constexpr int kNumSizeClasses = 24 - kMinSizeClassLog2 + 1;
+
+  CachingMemoryPoolImpl(MemoryPool* pool, int64_t max_retained_bytes)
+      : pool_(pool),
+        max_retained_bytes_(max_retained_bytes),
+        free_lists_(kNumSizeClasses) {
+    static_assert((1LL << (kMinSizeClassLog2 + kNumSizeClasses - 1)) == kMaxCachedSize,
+                  "size classes must cover kMaxCachedSize");
+  }
+
+  ~CachingMemoryPoolImpl() { ReleaseUnused(); }
+
+  Status Allocate(int64_t size, uint8_t** out) {
+    const int size_class = SizeClass(size);
+    if (size_class < 0) {
+      RETURN_NOT_OK(pool_->Allocate(size, out));
+    } else {
+      bool hit = false;
+      {
+        std::lock_guard<std::mutex> guard(lock_);
+        std::vector<uint8_t*>& free_list = free_lists_[size_class];
+        if (!free_list.empty()) {
+          *out = free_list.back();
+          free_list.pop_back();
+          bytes_retained_ -= ClassSize(size_class);
+          hit = true;
+        }
+      }
+      if (hit) {
+        ++cache_hits_;
+      } else {
+        ++cache_misses_;
+        RETURN_NOT_OK(pool_->Allocate(ClassSize(size_class), out));
+      }
+    }
+    UpdateAllocatedBytes(size);
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+    const int old_class = SizeClass(old_size);
+    const int new_class = SizeClass(new_size);
+    if (old_class < 0 && new_class < 0) {
+      RETURN_NOT_OK(pool_->Reallocate(old_size, new_size, ptr));
+      UpdateAllocatedBytes(new_size - old_size);
+    } else if (old_class == new_class) {
+      // The existing region is large enough for either size
+      UpdateAllocatedBytes(new_size - old_size);
+    } else {
+      uint8_t* out = nullptr;
+      RETURN_NOT_OK(Allocate(new_size, &out));
+      memcpy(out, *ptr, static_cast<size_t>(std::min(new_size, old_size)));
+      Free(*ptr, old_size);
+      *ptr = out;
+    }
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size) {
+    DCHECK_GE(bytes_allocated_, size);
+    bytes_allocated_ -= size;
+
+    const int size_class = SizeClass(size);
+    if (size_class < 0) {
+      pool_->Free(buffer, size);
+      return;
+    }
+    const int64_t class_size = ClassSize(size_class);
     {
       std::lock_guard<std::mutex> guard(lock_);
-      if (bytes_allocated_ > max_memory_) {
-        max_memory_ = bytes_allocated_.load();
+      if (bytes_retained_ + class_size <= max_retained_bytes_) {
+        free_lists_[size_class].push_back(buffer);
+        bytes_retained_ += class_size;
+        return;
+      }
+    }
+    pool_->Free(buffer, class_size);
+  }
+
+  void ReleaseUnused() {
+    std::lock_guard<std::mutex> guard(lock_);
+    for (int i = 0; i < kNumSizeClasses; ++i) {
+      for (uint8_t* buffer : free_lists_[i]) {
+        pool_->Free(buffer, ClassSize(i));
+      }
+      free_lists_[i].clear();
+    }
+    bytes_retained_ = 0;
+  }
+
+  int64_t bytes_allocated() const { return bytes_allocated_.load(); }
+
+  int64_t max_memory() const { return max_memory_.load(); }
+
+  int64_t bytes_retained() const {
+    std::lock_guard<std::mutex> guard(lock_);
+    return bytes_retained_;
+  }
+
+  int64_t cache_hits() const { return cache_hits_.load(); }
+
+  int64_t cache_misses() const { return cache_misses_.load(); }
+
+ private:
+  // Return the size class index for an allocation, or -1 if the allocation
+  // is not cacheable
+  static int SizeClass(int64_t size) {
+    if (size > kMaxCachedSize) {
+      return -1;
+    }
+    const int64_t min_size = int64_t(1) << kMinSizeClassLog2;
+    return BitUtil::Log2(static_cast<uint64_t>(std::max(size, min_size))) -
+           kMinSizeClassLog2;
+  }
+
+  static int64_t ClassSize(int size_class) {
+    return int64_t(1) << (size_class + kMinSizeClassLog2);
+  }
+
+  void UpdateAllocatedBytes(int64_t diff) {
+    bytes_allocated_ += diff;
+    int64_t allocated = bytes_allocated_.load();
+    int64_t max_memory = max_memory_.load();
+    while (allocated > max_memory &&
+           !max_memory_.compare_exchange_weak(max_memory, allocated)) {
+    }
+  }
+
+  MemoryPool* pool_;
+  const int64_t max_retained_bytes_;
+
+  mutable std::mutex lock_;
+  std::vector<std::vector<uint8_t*>> free_lists_;
+  int64_t bytes_retained_ = 0;
+
+  std::atomic<int64_t> bytes_allocated_{0};
+  std::atomic<int64_t> max_memory_{0};
+  std::atomic<int64_t> cache_hits_{0};
+  std::atomic<int64_t> cache_misses_{0};
+};
+
+CachingMemoryPool::CachingMemoryPool(MemoryPool* pool, int64_t max_retained_bytes) {
+  impl_.reset(new CachingMemoryPoolImpl(pool, max_retained_bytes));
+}
+
+CachingMemoryPool::~CachingMemoryPool() {}
+
+Status CachingMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  return impl_->Allocate(size, out);
+}
+
+Status CachingMemoryPool::Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, ptr);
+}
+
+void CachingMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  return impl_->Free(buffer, size);
+}
+
+int64_t CachingMemoryPool::bytes_allocated() const { return impl_->bytes_allocated(); }
+
+int64_t CachingMemoryPool::max_memory() const { return impl_->max_memory(); }
+
+int64_t CachingMemoryPool::bytes_retained() const { return impl_->bytes_retained(); }
+
+int64_t CachingMemoryPool::cache_hits() const { return impl_->cache_hits(); }
+
+int64_t CachingMemoryPool::cache_misses() const { return impl_->cache_misses(); }
+
+void CachingMemoryPool::ReleaseUnused() { impl_->ReleaseUnused(); }
+
+// ----------------------------------------------------------------------
+// ArenaMemoryPool implementation
+
+constexpr int64_t ArenaMemoryPool::kDefaultSlabSize;
+
+class ArenaMemoryPool::ArenaMemoryPoolImpl {
+ public:
+  ArenaMemoryPoolImpl(MemoryPool* pool, int64_t slab_size)
+      : pool_(pool), slab_size_(slab_size), id_(next_id_++) {}
+
+  ~ArenaMemoryPoolImpl() {
+    for (auto& entry : arenas_) {
+      ReleaseSlabs(entry.second.get(), 0);
+    }
+  }
+
+  Status Allocate(int64_t size, uint8_t** out) {
+    ThreadArena* arena = GetThreadArena();
+    if (size > slab_size_) {
+      // Oversized allocations get a slab of their own, which does not disturb
+      // the current bump position
+      RETURN_NOT_OK(pool_->Allocate(size, out));
+      arena->large_slabs.push_back({*out, size});
+      UpdateReservedBytes(size);
+    } else {
+      const int64_t nbytes = std::max(BitUtil::RoundUpToMultipleOf64(size),
+                                      static_cast<int64_t>(kAlignment));
+      if (arena->slabs.empty() || arena->position + nbytes > slab_size_) {
+        uint8_t* data = nullptr;
+        RETURN_NOT_OK(pool_->Allocate(slab_size_, &data));
+        arena->slabs.push_back({data, slab_size_});
+        arena->position = 0;
+        UpdateReservedBytes(slab_size_);
       }
+      *out = arena->slabs.back().data + arena->position;
+      arena->position += nbytes;
+      arena->last_allocation = *out;
     }
+    arena->bytes_allocated += size;
     return Status::OK();
   }
 
   Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
-    RETURN_NOT_OK(pool_->Reallocate(old_size, new_size, ptr));
-    bytes_allocated_ += new_size - old_size;
-    {
+    ThreadArena* arena = GetThreadArena();
+    if (*ptr == arena->last_allocation && new_size <= slab_size_) {
+      // The most recent bump allocation can be resized in place as long as
+      // it still fits in the current slab
+      const int64_t start = *ptr - arena->slabs.back().data;
+      const int64_t end = start + std::max(BitUtil::RoundUpToMultipleOf64(new_size),
+                                           static_cast<int64_t>(kAlignment));
+      if (end <= slab_size_) {
+        arena->position = end;
+        arena->bytes_allocated += new_size - old_size;
+        return Status::OK();
+      }
+    }
+    if (new_size <= old_size) {
+      arena->bytes_allocated += new_size - old_size;
+      return Status::OK();
+    }
+    uint8_t* out = nullptr;
+    RETURN_NOT_OK(Allocate(new_size, &out));
+    memcpy(out, *ptr, static_cast<size_t>(old_size));
+    Free(*ptr, old_size);
+    *ptr = out;
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size) { GetThreadArena()->bytes_allocated -= size; }
+
+  void Reset() {
+    std::lock_guard<std::mutex> guard(lock_);
+    for (auto& entry : arenas_) {
+      ReleaseSlabs(entry.second.get(), 1);
+    }
+  }
+
+  int64_t bytes_allocated() const {
+    std::lock_guard<std::mutex> guard(lock_);
+    int64_t total = 0;
+    for (const auto& entry : arenas_) {
+      total += entry.second->bytes_allocated.load();
+    }
+    return total;
+  }
+
+  int64_t max_memory() const { return max_memory_.load(); }
+
+  int64_t bytes_reserved() const { return bytes_reserved_.load(); }
+
+ private:
+  struct Slab {
+    uint8_t* data;
+    int64_t size;
+  };
+
+  struct ThreadArena {
+    std::vector<Slab> slabs;
+    std::vector<Slab> large_slabs;
+    // Offset of the next allocation in slabs.back()
+    int64_t position = 0;
+    uint8_t* last_allocation = nullptr;
+    // Only touched by the owning thread, except when Free() is called from
+    // a different thread
+    std::atomic<int64_t> bytes_allocated{0};
+  };
+
+  ThreadArena* GetThreadArena() {
+    // Each thread remembers the arena it used last, keyed by pool id so that
+    // a pool created at the address of a destroyed one is not confused with it
+    struct CachedArena {
+      int64_t pool_id;
+      ThreadArena* arena;
+    };
+    static thread_local CachedArena cached = {-1, nullptr};
+    if (cached.pool_id != id_) {
       std::lock_guard<std::mutex> guard(lock_);
-      if (bytes_allocated_ > max_memory_) {
-        max_memory_ = bytes_allocated_.load();
+      std::unique_ptr<ThreadArena>& arena = arenas_[std::this_thread::get_id()];
+      if (!arena) {
+        arena.reset(new ThreadArena());
+      }
+      cached = {id_, arena.get()};
+    }
+    return cached.arena;
+  }
+
+  // Return all but the first num_kept regular slabs to the underlying pool
+  void ReleaseSlabs(ThreadArena* arena, size_t num_kept) {
+    int64_t released = 0;
+    for (const Slab& slab : arena->large_slabs) {
+      pool_->Free(slab.data, slab.size);
+      released += slab.size;
+    }
+    arena->large_slabs.clear();
+    while (arena->slabs.size() > num_kept) {
+      const Slab& slab = arena->slabs.back();
+      pool_->Free(slab.data, slab.size);
+      released += slab.size;
+      arena->slabs.pop_back();
+    }
+    arena->position = 0;
+    arena->last_allocation = nullptr;
+    arena->bytes_allocated = 0;
+    bytes_reserved_ -= released;
+  }
+
+  void UpdateReservedBytes(int64_t diff) {
+    bytes_reserved_ += diff;
+    int64_t reserved = bytes_reserved_.load();
+    int64_t max_memory = max_memory_.load();
+    while (reserved > max_memory &&
+           !max_memory_.compare_exchange_weak(max_memory, reserved)) {
+    }
+  }
+
+  static std::atomic<int64_t> next_id_;
+
+  MemoryPool* pool_;
+  const int64_t slab_size_;
+  const int64_t id_;
+
+  mutable std::mutex lock_;
+  std::unordered_map<std::thread::id, std::unique_ptr<ThreadArena>> arenas_;
+
+  std::atomic<int64_t> bytes_reserved_{0};
+  std::atomic<int64_t> max_memory_{0};
+};
+
+std::atomic<int64_t> ArenaMemoryPool::ArenaMemoryPoolImpl::next_id_{0};
+
+ArenaMemoryPool::ArenaMemoryPool(MemoryPool* pool, int64_t slab_size) {
+  impl_.reset(new ArenaMemoryPoolImpl(pool, slab_size));
+}
+
+ArenaMemoryPool::~ArenaMemoryPool() {}
+
+Status ArenaMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  return impl_->Allocate(size, out);
+}
+
+Status ArenaMemoryPool::Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, ptr);
+}
+
+void ArenaMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  return impl_->Free(buffer, size);
+}
+
+int64_t ArenaMemoryPool::bytes_allocated() const { return impl_->bytes_allocated(); }
+
+int64_t ArenaMemoryPool::max_memory() const { return impl_->max_memory(); }
+
+int64_t ArenaMemoryPool::bytes_reserved() const { return impl_->bytes_reserved(); }
+
+void ArenaMemoryPool::Reset() { impl_->Reset(); }
+
+// ----------------------------------------------------------------------
+// CappedMemoryPool implementation
+
+class CappedMemoryPool::CappedMemoryPoolImpl {
+ public:
+  CappedMemoryPoolImpl(MemoryPool* pool, int64_t bytes_limit)
+      : pool_(pool), bytes_limit_(bytes_limit) {}
+
+  Status Allocate(int64_t size, uint8_t** out) {
+    RETURN_NOT_OK(Reserve(size));
+    Status s = pool_->Allocate(size, out);
+    if (!s.ok()) {
+      bytes_allocated_ -= size;
+    }
+    return s;
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+    const int64_t growth = new_size - old_size;
+    if (growth > 0) {
+      RETURN_NOT_OK(Reserve(growth));
+    }
+    Status s = pool_->Reallocate(old_size, new_size, ptr);
+    if (!s.ok()) {
+      if (growth > 0) {
+        bytes_allocated_ -= growth;
       }
+      return s;
+    }
+    if (growth < 0) {
+      bytes_allocated_ += growth;
     }
     return Status::OK();
   }
@@ -241,33 +954,291 @@ class ProxyMemoryPool::ProxyMemoryPoolImpl {
 
   int64_t max_memory() const { return max_memory_.load(); }
 
+  int64_t bytes_limit() const { return bytes_limit_; }
+
+  void set_release_callback(ReleaseCallback callback) {
+    release_callback_ = std::move(callback);
+  }
+
  private:
-  mutable std::mutex lock_;
+  bool TryReserve(int64_t size, int64_t* allocated) {
+    *allocated = bytes_allocated_.load();
+    while (*allocated <= bytes_limit_ - size) {
+      if (bytes_allocated_.compare_exchange_weak(*allocated, *allocated + size)) {
+        *allocated += size;
+        int64_t max_memory = max_memory_.load();
+        while (*allocated > max_memory &&
+               !max_memory_.compare_exchange_weak(max_memory, *allocated)) {
+        }
+        return true;
+      }
+    }
+    return false;
+  }
+
+  Status Reserve(int64_t size) {
+    int64_t allocated;
+    while (!TryReserve(size, &allocated)) {
+      if (!release_callback_ || size > bytes_limit_) {
+        return LimitExceeded(size, allocated);
+      }
+      release_callback_(allocated + size - bytes_limit_);
+      if (bytes_allocated_.load() >= allocated) {
+        // The callback could not release anything
+        return LimitExceeded(size, allocated);
+      }
+    }
+    return Status::OK();
+  }
+
+  Status LimitExceeded(int64_t size, int64_t allocated) const {
+    std::stringstream ss;
+    ss << "allocation of " << size << " bytes would exceed the memory limit of "
+       << bytes_limit_ << " bytes (" << allocated << " bytes allocated)";
+    return Status::OutOfMemory(ss.str());
+  }
+
   MemoryPool* pool_;
+  const int64_t bytes_limit_;
+  ReleaseCallback release_callback_;
+
   std::atomic<int64_t> bytes_allocated_{0};
   std::atomic<int64_t> max_memory_{0};
 };
 
-ProxyMemoryPool::ProxyMemoryPool(MemoryPool* pool) {
-  impl_.reset(new ProxyMemoryPoolImpl(pool));
+CappedMemoryPool::CappedMemoryPool(MemoryPool* pool, int64_t bytes_limit) {
+  impl_.reset(new CappedMemoryPoolImpl(pool, bytes_limit));
 }
 
-ProxyMemoryPool::~ProxyMemoryPool() {}
+CappedMemoryPool::~CappedMemoryPool() {}
 
-Status ProxyMemoryPool::Allocate(int64_t size, uint8_t** out) {
+Status CappedMemoryPool::Allocate(int64_t size, uint8_t** out) {
   return impl_->Allocate(size, out);
 }
 
-Status ProxyMemoryPool::Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+Status CappedMemoryPool::Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
   return impl_->Reallocate(old_size, new_size, ptr);
 }
 
-void ProxyMemoryPool::Free(uint8_t* buffer, int64_t size) {
+void CappedMemoryPool::Free(uint8_t* buffer, int64_t size) {
   return impl_->Free(buffer, size);
 }
 
-int64_t ProxyMemoryPool::bytes_allocated() const { return impl_->bytes_allocated(); }
+int64_t CappedMemoryPool::bytes_allocated() const { return impl_->bytes_allocated(); }
 
-int64_t ProxyMemoryPool::max_memory() const { return impl_->max_memory(); }
+int64_t CappedMemoryPool::max_memory() const { return impl_->max_memory(); }
+
+int64_t CappedMemoryPool::bytes_limit() const { return impl_->bytes_limit(); }
+
+void CappedMemoryPool::set_release_callback(ReleaseCallback callback) {
+  impl_->set_release_callback(std::move(callback));
+}
+
+// ----------------------------------------------------------------------
+// InstrumentedMemoryPool implementation
+
+constexpr int InstrumentedMemoryPool::kNumHistogramBuckets;
+
+class InstrumentedMemoryPool::InstrumentedMemoryPoolImpl {
+ public:
+  InstrumentedMemoryPoolImpl(MemoryPool* pool,
+                             const InstrumentedMemoryPoolOptions& options)
+      : pool_(pool), options_(options), stats_(MemoryPoolStatistics::SHARED) {
+    ResetStatistics();
+  }
+
+  Status Allocate(int64_t size, uint8_t** out) {
+    RETURN_NOT_OK(pool_->Allocate(size, out));
+    stats_.UpdateAllocatedBytes(size);
+    num_allocations_.fetch_add(1, std::memory_order_relaxed);
+    histogram_[HistogramBucket(size)].fetch_add(1, std::memory_order_relaxed);
+    MaybeSample(size);
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+    RETURN_NOT_OK(pool_->Reallocate(old_size, new_size, ptr));
+    stats_.UpdateAllocatedBytes(new_size - old_size);
+    num_reallocations_.fetch_add(1, std::memory_order_relaxed);
+    reallocated_bytes_.fetch_add(std::min(old_size, new_size),
+                                 std::memory_order_relaxed);
+    if (new_size > old_size) {
+      MaybeSample(new_size);
+    }
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size) {
+    pool_->Free(buffer, size);
+    stats_.UpdateAllocatedBytes(-size);
+    num_frees_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  int64_t bytes_allocated() const { return stats_.bytes_allocated(); }
+
+  int64_t max_memory() const { return stats_.max_memory(); }
+
+  int64_t num_allocations() const { return num_allocations_.load(); }
+
+  int64_t num_reallocations() const { return num_reallocations_.load(); }
+
+  int64_t num_frees() const { return num_frees_.load(); }
+
+  int64_t reallocated_bytes() const { return reallocated_bytes_.load(); }
+
+  double allocation_rate() const {
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start_time_;
+    if (elapsed.count() <= 0) {
+      return 0;
+    }
+    return static_cast<double>(num_allocations_.load()) / elapsed.count();
+  }
+
+  std::vector<int64_t> size_histogram() const {
+    std::vector<int64_t> result(kNumHistogramBuckets);
+    for (int i = 0; i < kNumHistogramBuckets; ++i) {
+      result[i] = histogram_[i].load(std::memory_order_relaxed);
+    }
+    return result;
+  }
+
+  std::vector<AllocationSample> samples() const {
+    std::vector<AllocationSample> result;
+    std::lock_guard<std::mutex> guard(samples_lock_);
+    for (const RawSample& raw : samples_) {
+      AllocationSample sample;
+      sample.size = raw.size;
+#ifdef ARROW_HAVE_EXECINFO
+      char** symbols = backtrace_symbols(raw.frames.data(),
+                                         static_cast<int>(raw.frames.size()));
+      if (symbols != nullptr) {
+        sample.frames.assign(symbols, symbols + raw.frames.size());
+        std::free(symbols);
+      }
+#endif
+      result.push_back(std::move(sample));
+    }
+    return result;
+  }
+
+  void ResetStatistics() {
+    num_allocations_ = 0;
+    num_reallocations_ = 0;
+    num_frees_ = 0;
+    reallocated_bytes_ = 0;
+    num_large_allocations_ = 0;
+    for (auto& bucket : histogram_) {
+      bucket = 0;
+    }
+    {
+      std::lock_guard<std::mutex> guard(samples_lock_);
+      samples_.clear();
+    }
+    start_time_ = std::chrono::steady_clock::now();
+  }
+
+ private:
+  static constexpr int kMaxFrames = 32;
+
+  struct RawSample {
+    int64_t size;
+    std::vector<void*> frames;
+  };
+
+  static int HistogramBucket(int64_t size) {
+    return size <= 1 ? 0 : BitUtil::Log2(static_cast<uint64_t>(size));
+  }
+
+  void MaybeSample(int64_t size) {
+    if (options_.sample_interval <= 0 || size < options_.large_allocation_threshold) {
+      return;
+    }
+    if (num_large_allocations_.fetch_add(1) % options_.sample_interval != 0) {
+      return;
+    }
+    RawSample sample;
+    sample.size = size;
+#ifdef ARROW_HAVE_EXECINFO
+    void* frames[kMaxFrames];
+    const int num_frames = backtrace(frames, kMaxFrames);
+    sample.frames.assign(frames, frames + num_frames);
+#endif
+    std::lock_guard<std::mutex> guard(samples_lock_);
+    samples_.push_back(std::move(sample));
+    while (static_cast<int64_t>(samples_.size()) > options_.max_samples) {
+      samples_.pop_front();
+    }
+  }
+
+  MemoryPool* pool_;
+  const InstrumentedMemoryPoolOptions options_;
+  MemoryPoolStats stats_;
+
+  std::atomic<int64_t> num_allocations_;
+  std::atomic<int64_t> num_reallocations_;
+  std::atomic<int64_t> num_frees_;
+  std::atomic<int64_t> reallocated_bytes_;
+  std::atomic<int64_t> num_large_allocations_;
+  std::atomic<int64_t> histogram_[kNumHistogramBuckets];
+  std::chrono::steady_clock::time_point start_time_;
+
+  mutable std::mutex samples_lock_;
+  std::deque<RawSample> samples_;
+};
+
+InstrumentedMemoryPool::InstrumentedMemoryPool(
+    MemoryPool* pool, const InstrumentedMemoryPoolOptions& options) {
+  impl_.reset(new InstrumentedMemoryPoolImpl(pool, options));
+}
+
+InstrumentedMemoryPool::~InstrumentedMemoryPool() {}
+
+Status InstrumentedMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  return impl_->Allocate(size, out);
+}
+
+Status InstrumentedMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                          uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, ptr);
+}
+
+void InstrumentedMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  return impl_->Free(buffer, size);
+}
+
+int64_t InstrumentedMemoryPool::bytes_allocated() const {
+  return impl_->bytes_allocated();
+}
+
+int64_t InstrumentedMemoryPool::max_memory() const { return impl_->max_memory(); }
+
+int64_t InstrumentedMemoryPool::num_allocations() const {
+  return impl_->num_allocations();
+}
+
+int64_t InstrumentedMemoryPool::num_reallocations() const {
+  return impl_->num_reallocations();
+}
+
+int64_t InstrumentedMemoryPool::num_frees() const { return impl_->num_frees(); }
+
+int64_t InstrumentedMemoryPool::reallocated_bytes() const {
+  return impl_->reallocated_bytes();
+}
+
+double InstrumentedMemoryPool::allocation_rate() const {
+  return impl_->allocation_rate();
+}
+
+std::vector<int64_t> InstrumentedMemoryPool::size_histogram() const {
+  return impl_->size_histogram();
+}
+
+std::vector<AllocationSample> InstrumentedMemoryPool::samples() const {
+  return impl_->samples();
+}
+
+void InstrumentedMemoryPool::ResetStatistics() { impl_->ResetStatistics(); }
 
 }  // namespace arrow
@@ -19,7 +19,10 @@
 #define ARROW_MEMORY_POOL_H
 
 #include <cstdint>
+#include <functional>
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "arrow/util/visibility.h"
 
@@ -27,6 +30,19 @@ namespace arrow {
 
 class Status;
 
+/// \brief How a memory pool keeps track of its allocation statistics
+struct MemoryPoolStatistics {
+  enum type {
+    /// A single set of counters updated by all threads. max_memory() is exact.
+    SHARED,
+    /// Counters sharded across threads and aggregated when read, so that
+    /// accounting does not contend between cores. bytes_allocated() stays
+    /// exact, while max_memory() may miss short-lived peaks of up to 1 MB per
+    /// active thread.
+    SHARDED
+  };
+};
+
 /// Base class for memory allocation.
 ///
 /// Besides tracking the number of allocated bytes, the allocator also should
@@ -92,7 +108,9 @@ class ARROW_EXPORT LoggingMemoryPool : public MemoryPool {
 /// calls. Actual allocation is delegated to MemoryPool class.
 class ARROW_EXPORT ProxyMemoryPool : public MemoryPool {
  public:
-  explicit ProxyMemoryPool(MemoryPool* pool);
+  explicit ProxyMemoryPool(
+      MemoryPool* pool,
+      MemoryPoolStatistics::type stats_mode = MemoryPoolStatistics::SHARED);
   ~ProxyMemoryPool() override;
 
   Status Allocate(int64_t size, uint8_t** out) override;
@@ -109,8 +127,258 @@ class ARROW_EXPORT ProxyMemoryPool : public MemoryPool {
   std::unique_ptr<ProxyMemoryPoolImpl> impl_;
 };
 
+/// Derived class for memory allocation.
+///
+/// Rounds allocations up to power-of-two size classes (at least 64 bytes) and
+/// keeps freed regions in per-class free lists, so that repeated allocation
+/// and release of similarly sized buffers does not go back to the underlying
+/// allocator. Regions larger than kMaxCachedSize are never cached. The total
+/// size of regions held in free lists is bounded by max_retained_bytes.
+class ARROW_EXPORT CachingMemoryPool : public MemoryPool {
+ public:
+  static constexpr int64_t kMaxCachedSize = 1LL << 24;
+  static constexpr int64_t kDefaultMaxRetainedBytes = 1LL << 26;
+
+  explicit CachingMemoryPool(MemoryPool* pool,
+                             int64_t max_retained_bytes = kDefaultMaxRetainedBytes);
+  ~CachingMemoryPool() override;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  /// Number of bytes currently held in the free lists
+  int64_t bytes_retained() const;
+
+  /// Number of allocations served from the free lists
+  int64_t cache_hits() const;
+
+  /// Number of cacheable allocations that went to the underlying pool
+  int64_t cache_misses() const;
+
+  /// Return all cached regions to the underlying pool
+  void ReleaseUnused();
+
+ private:
+  class CachingMemoryPoolImpl;
+  std::unique_ptr<CachingMemoryPoolImpl> impl_;
+};
+
+/// Derived class for memory allocation.
+///
+/// Bump-allocates out of slabs obtained from the underlying pool. Each thread
+/// allocates from its own slabs, so allocations from different threads do not
+/// contend with each other. Free() only updates the statistics; memory is
+/// reclaimed all at once by Reset(). Allocations larger than the slab size
+/// receive a dedicated slab.
+///
+/// This is meant for short-lived scratch memory, e.g. per-batch kernel
+/// evaluation through a compute::FunctionContext.
+class ARROW_EXPORT ArenaMemoryPool : public MemoryPool {
+ public:
+  static constexpr int64_t kDefaultSlabSize = 1LL << 20;
+
+  explicit ArenaMemoryPool(MemoryPool* pool, int64_t slab_size = kDefaultSlabSize);
+  ~ArenaMemoryPool() override;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  /// The number of bytes that were allocated and not yet free'd
+  int64_t bytes_allocated() const override;
+
+  /// Return the peak number of bytes held in slabs
+  int64_t max_memory() const override;
+
+  /// The number of bytes currently held in slabs
+  int64_t bytes_reserved() const;
+
+  /// \brief Invalidate all memory allocated from this pool
+  ///
+  /// Each thread keeps its first slab for reuse, the other slabs are returned
+  /// to the underlying pool. Must not be called concurrently with other
+  /// methods, and no region allocated before the call may be used after it.
+  void Reset();
+
+ private:
+  class ArenaMemoryPoolImpl;
+  std::unique_ptr<ArenaMemoryPoolImpl> impl_;
+};
+
+/// Derived class for memory allocation.
+///
+/// Enforces a byte budget on the allocations going through it to the wrapped
+/// pool. An allocation that would exceed the budget fails with
+/// Status::OutOfMemory. If a release callback is set, it is first given a
+/// chance to free memory allocated through this pool (e.g. by spilling or
+/// dropping caches), and the allocation is retried as long as the callback
+/// makes progress.
+class ARROW_EXPORT CappedMemoryPool : public MemoryPool {
+ public:
+  /// \brief Called with the number of bytes by which an allocation exceeds
+  /// the limit. Must not allocate from this pool
+  using ReleaseCallback = std::function<void(int64_t bytes_over_limit)>;
+
+  CappedMemoryPool(MemoryPool* pool, int64_t bytes_limit);
+  ~CappedMemoryPool() override;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  int64_t bytes_limit() const;
+
+  /// \brief Register the callback invoked before failing an allocation
+  ///
+  /// Not thread-safe with respect to concurrent allocations.
+  void set_release_callback(ReleaseCallback callback);
+
+ private:
+  class CappedMemoryPoolImpl;
+  std::unique_ptr<CappedMemoryPoolImpl> impl_;
+};
+
+/// \brief Options for InstrumentedMemoryPool
+struct ARROW_EXPORT InstrumentedMemoryPoolOptions {
+  /// Allocations of at least this many bytes are eligible for call-site
+  /// sampling
+  int64_t large_allocation_threshold = 1 << 20;
+
+  /// Capture the call stack of every N-th large allocation. 0 disables
+  /// sampling
+  int64_t sample_interval = 0;
+
+  /// Number of most recent samples that are kept
+  int64_t max_samples = 64;
+};
+
+/// \brief An allocation whose call stack was captured by InstrumentedMemoryPool
+struct ARROW_EXPORT AllocationSample {
+  int64_t size;
+  /// Symbolized stack frames, innermost first. Empty if stack traces are not
+  /// supported on this platform
+  std::vector<std::string> frames;
+};
+
+/// Derived class for memory allocation.
+///
+/// Records statistics about the calls going through it to the wrapped pool
+/// without locking on the allocation path: a histogram of allocation sizes
+/// by power of two, call counts and the number of bytes copied by
+/// reallocations. Optionally the call stacks of a sample of large
+/// allocations are captured to attribute memory spikes.
+class ARROW_EXPORT InstrumentedMemoryPool : public MemoryPool {
+ public:
+  /// Histogram bucket i counts allocations of size in (2^(i-1), 2^i]
+  static constexpr int kNumHistogramBuckets = 64;
+
+  explicit InstrumentedMemoryPool(
+      MemoryPool* pool,
+      const InstrumentedMemoryPoolOptions& options = InstrumentedMemoryPoolOptions());
+  ~InstrumentedMemoryPool() override;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  /// Number of successful Allocate calls
+  int64_t num_allocations() const;
+
+  /// Number of successful Reallocate calls
+  int64_t num_reallocations() const;
+
+  /// Number of Free calls
+  int64_t num_frees() const;
+
+  /// \brief Number of bytes that reallocations had to preserve
+  ///
+  /// This is an upper bound on the bytes copied, as the wrapped pool may be
+  /// able to resize some regions in place.
+  int64_t reallocated_bytes() const;
+
+  /// Allocations per second since construction or the last ResetStatistics()
+  double allocation_rate() const;
+
+  /// Allocation counts per size bucket, see kNumHistogramBuckets
+  std::vector<int64_t> size_histogram() const;
+
+  /// The most recently sampled large allocations, oldest first
+  std::vector<AllocationSample> samples() const;
+
+  /// Reset all counters except bytes_allocated() and max_memory()
+  void ResetStatistics();
+
+ private:
+  class InstrumentedMemoryPoolImpl;
+  std::unique_ptr<InstrumentedMemoryPoolImpl> impl_;
+};
+
 ARROW_EXPORT MemoryPool* default_memory_pool();
 
+/// \brief Huge page policy for large allocations of the default allocator
+struct HugePages {
+  enum type {
+    /// Regular pages
+    NONE,
+    /// Align mappings to 2 MB and advise the kernel to back them with
+    /// transparent huge pages (madvise MADV_HUGEPAGE)
+    MADVISE,
+    /// Map from the reserved huge page pool (MAP_HUGETLB), falling back to
+    /// MADVISE if no huge pages are reserved
+    HUGETLB
+  };
+};
+
+/// \brief Threshold above which default_memory_pool() maps allocations
+/// directly, on Linux builds without jemalloc
+constexpr int64_t kDefaultMemoryPoolRemapThreshold = 1LL << 25;
+
+/// \brief Options for pools created by NewDefaultMemoryPool
+struct ARROW_EXPORT DefaultMemoryPoolOptions {
+  MemoryPoolStatistics::type stats = MemoryPoolStatistics::SHARED;
+
+  /// Allocations of at least this many bytes bypass the allocator (including
+  /// jemalloc) and are mapped directly from the OS, so that the huge page and
+  /// NUMA policies below apply to them. On Linux, reallocations between such
+  /// sizes remap pages with mremap instead of copying. 0 disables direct
+  /// mappings. Ignored on Windows
+  int64_t large_allocation_threshold = 0;
+
+  /// Huge page policy for directly mapped allocations
+  HugePages::type huge_pages = HugePages::NONE;
+
+  /// Bind directly mapped allocations to this NUMA node (Linux only), or -1
+  /// to use the default policy of the calling thread
+  int numa_node = -1;
+};
+
+/// \brief Create a new pool using the same allocator as default_memory_pool()
+/// but with its own statistics and placement options
+ARROW_EXPORT std::unique_ptr<MemoryPool> NewDefaultMemoryPool(
+    const DefaultMemoryPoolOptions& options);
+
+/// \brief Create a new pool using the same allocator as default_memory_pool()
+/// but with its own statistics
+ARROW_EXPORT std::unique_ptr<MemoryPool> NewDefaultMemoryPool(
+    MemoryPoolStatistics::type stats_mode);
+
 #ifdef ARROW_NO_DEFAULT_MEMORY_POOL
 #define ARROW_MEMORY_POOL_DEFAULT
 #else
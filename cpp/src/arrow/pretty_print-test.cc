@@ -21,6 +21,7 @@
 #include <cstring>
 #include <memory>
 #include <sstream>
+#include <string>
 #include <vector>
 
 #include "gtest/gtest.h"
@@ -28,6 +29,8 @@
 #include "arrow/array.h"
 #include "arrow/builder.h"
 #include "arrow/pretty_print.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
 #include "arrow/test-util.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
@@ -431,6 +434,82 @@ TEST_F(TestPrettyPrint, ChunkedArrayPrimitiveType) {
   CheckStream(chunked_array_2, {0}, expected_2);
 }
 
+TEST_F(TestPrettyPrint, RecordBatchAndTableWindow) {
+  std::vector<bool> is_valid = {true, true, false, true, false};
+  std::vector<int32_t> values = {0, 1, 2, 3, 4};
+  std::vector<std::string> strings = {"a", "b", "c", "d", "e"};
+  std::shared_ptr<Array> ints, strs;
+  ArrayFromVector<Int32Type, int32_t>(is_valid, values, &ints);
+  ArrayFromVector<StringType, std::string>(strings, &strs);
+  auto schema = ::arrow::schema({field("ints", int32()), field("strs", utf8())});
+  auto batch = RecordBatch::Make(schema, 5, {ints, strs});
+
+  static const char* expected = R"expected(ints:   [
+    0,
+    ...
+    null
+  ]
+strs:   [
+    "a",
+    ...
+    "e"
+  ]
+)expected";
+  CheckStream(*batch, {0, 1}, expected);
+
+  std::shared_ptr<Table> table;
+  ASSERT_OK(Table::FromRecordBatches({batch, batch, batch}, &table));
+  static const char* expected_table = R"expected(ints:   [
+    [
+      0,
+      ...
+      null
+    ],
+  ...
+    [
+      0,
+      ...
+      null
+    ]
+  ]
+strs:   [
+    [
+      "a",
+      ...
+      "e"
+    ],
+  ...
+    [
+      "a",
+      ...
+      "e"
+    ]
+  ]
+)expected";
+  CheckStream(*table, {0, 1}, expected_table);
+}
+
+TEST_F(TestPrettyPrint, LargeOutput) {
+  // More output than the buffer gathering it, and a value larger than it
+  const int64_t length = 2000;
+  std::vector<std::string> strings;
+  std::string expected = "[\n";
+  for (int64_t i = 0; i < length; ++i) {
+    strings.push_back(std::string(static_cast<size_t>(i == 1000 ? 10000 : i % 7), 'x'));
+    expected += "  \"" + strings.back() + "\"" + (i + 1 < length ? ",\n" : "\n");
+  }
+  expected += "]";
+  std::shared_ptr<Array> array;
+  ArrayFromVector<StringType, std::string>(strings, &array);
+  CheckStream(*array, {0, static_cast<int>(length)}, expected.c_str());
+
+  // Only the window of the values is printed
+  std::string result;
+  ASSERT_OK(PrettyPrint(*array, {0, 10}, &result));
+  ASSERT_EQ(std::string::npos, result.find(strings[1000]));
+  ASSERT_LT(result.size(), 200u);
+}
+
 TEST_F(TestPrettyPrint, SchemaWithDictionary) {
   std::vector<bool> is_valid = {true, true, false, true, true, true};
 
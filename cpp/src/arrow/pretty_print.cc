@@ -15,6 +15,9 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
 #include <memory>
 #include <ostream>
 #include <sstream>
@@ -22,6 +25,7 @@
 #include <vector>
 
 #include "arrow/array.h"
+#include "arrow/memory_pool.h"
 #include "arrow/pretty_print.h"
 #include "arrow/record_batch.h"
 #include "arrow/status.h"
@@ -35,13 +39,41 @@
 
 namespace arrow {
 
+// The output is gathered in a buffer and written to the sink in large pieces,
+// rather than through the stream one value at a time
 class PrettyPrinter {
  public:
+  static constexpr size_t kBufferSize = 4096;
+
   PrettyPrinter(int indent, int indent_size, int window, std::ostream* sink)
-      : indent_(indent), indent_size_(indent_size), window_(window), sink_(sink) {}
+      : indent_(indent),
+        indent_size_(indent_size),
+        window_(window),
+        sink_(sink),
+        buffer_(&own_buffer_) {
+    own_buffer_.reserve(kBufferSize);
+  }
+
+  // A printer of a part of the output of parent, sharing its buffer
+  PrettyPrinter(const PrettyPrinter& parent, int indent)
+      : indent_(indent),
+        indent_size_(parent.indent_size_),
+        window_(parent.window_),
+        sink_(parent.sink_),
+        buffer_(parent.buffer_) {}
+
+  ~PrettyPrinter() {
+    if (buffer_ == &own_buffer_) {
+      FlushBuffer();
+    }
+  }
 
-  void Write(const char* data);
-  void Write(const std::string& data);
+  void Write(const char* data, size_t length);
+  void Write(const char* data) { Write(data, std::strlen(data)); }
+  void Write(const std::string& data) { Write(data.data(), data.size()); }
+  void WriteInteger(int64_t value);
+  void WriteFloatingPoint(double value);
+  void WriteHex(const uint8_t* data, int32_t length);
   void WriteIndented(const char* data);
   void WriteIndented(const std::string& data);
   void Newline();
@@ -49,20 +81,30 @@ class PrettyPrinter {
   void OpenArray(const Array& array);
   void CloseArray(const Array& array);
 
-  void Flush() { (*sink_) << std::flush; }
+  void Flush() {
+    FlushBuffer();
+    (*sink_) << std::flush;
+  }
 
  protected:
+  void FlushBuffer() {
+    sink_->write(buffer_->data(), static_cast<std::streamsize>(buffer_->size()));
+    buffer_->clear();
+  }
+
   int indent_;
   int indent_size_;
   int window_;
   std::ostream* sink_;
+  std::string own_buffer_;
+  std::string* buffer_;
 };
 
 void PrettyPrinter::OpenArray(const Array& array) {
   Indent();
-  (*sink_) << "[";
+  Write("[");
   if (array.length() > 0) {
-    (*sink_) << "\n";
+    Write("\n");
     indent_ += indent_size_;
   }
 }
@@ -72,11 +114,54 @@ void PrettyPrinter::CloseArray(const Array& array) {
     indent_ -= indent_size_;
     Indent();
   }
-  (*sink_) << "]";
+  Write("]");
+}
+
+void PrettyPrinter::Write(const char* data, size_t length) {
+  if (buffer_->size() + length > kBufferSize) {
+    FlushBuffer();
+    if (length > kBufferSize) {
+      sink_->write(data, static_cast<std::streamsize>(length));
+      return;
+    }
+  }
+  buffer_->append(data, length);
 }
 
-void PrettyPrinter::Write(const char* data) { (*sink_) << data; }
-void PrettyPrinter::Write(const std::string& data) { (*sink_) << data; }
+void PrettyPrinter::WriteInteger(int64_t value) {
+  char digits[24];
+  char* end = digits + sizeof(digits);
+  char* begin = end;
+  uint64_t magnitude =
+      value < 0 ? 0 - static_cast<uint64_t>(value) : static_cast<uint64_t>(value);
+  do {
+    *--begin = static_cast<char>('0' + magnitude % 10);
+    magnitude /= 10;
+  } while (magnitude != 0);
+  if (value < 0) {
+    *--begin = '-';
+  }
+  Write(begin, static_cast<size_t>(end - begin));
+}
+
+void PrettyPrinter::WriteFloatingPoint(double value) {
+  // The default format of std::ostream
+  char digits[32];
+  const int length = snprintf(digits, sizeof(digits), "%g", value);
+  Write(digits, static_cast<size_t>(length));
+}
+
+void PrettyPrinter::WriteHex(const uint8_t* data, int32_t length) {
+  char hex[64];
+  for (int32_t i = 0; i < length;) {
+    size_t num_chars = 0;
+    for (; i < length && num_chars < sizeof(hex); ++i) {
+      hex[num_chars++] = kAsciiTable[data[i] >> 4];
+      hex[num_chars++] = kAsciiTable[data[i] & 15];
+    }
+    Write(hex, num_chars);
+  }
+}
 
 void PrettyPrinter::WriteIndented(const char* data) {
   Indent();
@@ -89,13 +174,15 @@ void PrettyPrinter::WriteIndented(const std::string& data) {
 }
 
 void PrettyPrinter::Newline() {
-  (*sink_) << "\n";
+  Write("\n");
   Indent();
 }
 
 void PrettyPrinter::Indent() {
-  for (int i = 0; i < indent_; ++i) {
-    (*sink_) << " ";
+  static const char kSpaces[] = "                                ";
+  constexpr int kNumSpaces = static_cast<int>(sizeof(kSpaces) - 1);
+  for (int remaining = indent_; remaining > 0; remaining -= kNumSpaces) {
+    Write(kSpaces, static_cast<size_t>(std::min(remaining, kNumSpaces)));
   }
 }
 
@@ -105,67 +192,106 @@ class ArrayPrinter : public PrettyPrinter {
                const std::string& null_rep, std::ostream* sink)
       : PrettyPrinter(indent, indent_size, window, sink),
         array_(array),
-        null_rep_(null_rep) {}
+        null_rep_(null_rep),
+        skip_comma_(true) {}
 
-  template <typename FormatFunction>
-  void WriteValues(const Array& array, FormatFunction&& func) {
-    bool skip_comma = true;
-    for (int64_t i = 0; i < array.length(); ++i) {
-      if (skip_comma) {
-        skip_comma = false;
-      } else {
-        (*sink_) << ",\n";
-      }
-      Indent();
-      if ((i >= window_) && (i < (array.length() - window_))) {
-        (*sink_) << "...\n";
-        i = array.length() - window_ - 1;
-        skip_comma = true;
-      } else if (array.IsNull(i)) {
-        (*sink_) << null_rep_;
-      } else {
-        func(i);
-      }
+  // A printer of an array nested in the output of parent
+  ArrayPrinter(const PrettyPrinter& parent, const Array& array, int indent,
+               const std::string& null_rep)
+      : PrettyPrinter(parent, indent),
+        array_(array),
+        null_rep_(null_rep),
+        skip_comma_(true) {}
+
+  // Start writing a value, after the previous one if any
+  void BeginValue() {
+    if (skip_comma_) {
+      skip_comma_ = false;
+    } else {
+      Write(",\n");
+    }
+    Indent();
+  }
+
+  // Write the values of the window at each end of the array, visited with
+  // VisitArrayValuesInline: write_func(i, value...) writes each valid value
+  // after BeginValue
+  template <typename T, typename WriteFunction>
+  void WriteValues(const T& array, WriteFunction&& write_func) {
+    using TypeClass = typename T::TypeClass;
+    auto write_null = [this](int64_t) {
+      BeginValue();
+      Write(null_rep_);
+      return true;
+    };
+    const ArrayData& data = *array.data();
+    const int64_t length = array.length();
+    skip_comma_ = true;
+    if (length > 2 * static_cast<int64_t>(window_)) {
+      VisitArrayValuesInline<TypeClass>(data, 0, window_, write_func, write_null);
+      BeginValue();
+      Write("...\n");
+      skip_comma_ = true;
+      VisitArrayValuesInline<TypeClass>(data, length - window_, window_, write_func,
+                                        write_null);
+    } else {
+      VisitArrayValuesInline<TypeClass>(data, write_func, write_null);
     }
-    (*sink_) << "\n";
+    Write("\n");
   }
 
   template <typename T>
   inline typename std::enable_if<IsInteger<T>::value, Status>::type WriteDataValues(
       const T& array) {
-    const auto data = array.raw_values();
-    WriteValues(array, [&](int64_t i) { (*sink_) << static_cast<int64_t>(data[i]); });
+    using c_type = typename T::TypeClass::c_type;
+    WriteValues(array, [this](int64_t, c_type value) {
+      BeginValue();
+      WriteInteger(static_cast<int64_t>(value));
+      return true;
+    });
     return Status::OK();
   }
 
   template <typename T>
   inline typename std::enable_if<IsFloatingPoint<T>::value, Status>::type WriteDataValues(
       const T& array) {
-    const auto data = array.raw_values();
-    WriteValues(array, [&](int64_t i) { (*sink_) << data[i]; });
+    using c_type = typename T::TypeClass::c_type;
+    WriteValues(array, [this](int64_t, c_type value) {
+      BeginValue();
+      WriteFloatingPoint(value);
+      return true;
+    });
     return Status::OK();
   }
 
   // String (Utf8)
   template <typename T>
-  inline typename std::enable_if<std::is_same<StringArray, T>::value, Status>::type
+  inline typename std::enable_if<std::is_same<StringArray, T>::value ||
+                                     std::is_same<LargeStringArray, T>::value,
+                                 Status>::type
   WriteDataValues(const T& array) {
-    WriteValues(array, [&](int64_t i) {
-      int32_t length;
-      const char* buf = reinterpret_cast<const char*>(array.GetValue(i, &length));
-      (*sink_) << "\"" << std::string(buf, length) << "\"";
+    using offset_type = typename T::TypeClass::offset_type;
+    WriteValues(array, [this](int64_t, const uint8_t* value, offset_type length) {
+      BeginValue();
+      Write("\"");
+      Write(reinterpret_cast<const char*>(value), static_cast<size_t>(length));
+      Write("\"");
+      return true;
     });
     return Status::OK();
   }
 
   // Binary
   template <typename T>
-  inline typename std::enable_if<std::is_same<BinaryArray, T>::value, Status>::type
+  inline typename std::enable_if<std::is_same<BinaryArray, T>::value ||
+                                     std::is_same<LargeBinaryArray, T>::value,
+                                 Status>::type
   WriteDataValues(const T& array) {
-    WriteValues(array, [&](int64_t i) {
-      int32_t length;
-      const uint8_t* buf = array.GetValue(i, &length);
-      (*sink_) << HexEncode(buf, length);
+    using offset_type = typename T::TypeClass::offset_type;
+    WriteValues(array, [this](int64_t, const uint8_t* value, offset_type length) {
+      BeginValue();
+      WriteHex(value, length);
+      return true;
     });
     return Status::OK();
   }
@@ -174,56 +300,71 @@ class ArrayPrinter : public PrettyPrinter {
   inline
       typename std::enable_if<std::is_same<FixedSizeBinaryArray, T>::value, Status>::type
       WriteDataValues(const T& array) {
-    int32_t width = array.byte_width();
-    WriteValues(array,
-                [&](int64_t i) { (*sink_) << HexEncode(array.GetValue(i), width); });
+    const int32_t width = array.byte_width();
+    WriteValues(array, [this, width](int64_t, const uint8_t* value) {
+      BeginValue();
+      WriteHex(value, width);
+      return true;
+    });
     return Status::OK();
   }
 
   template <typename T>
   inline typename std::enable_if<std::is_same<Decimal128Array, T>::value, Status>::type
   WriteDataValues(const T& array) {
-    WriteValues(array, [&](int64_t i) { (*sink_) << array.FormatValue(i); });
+    WriteValues(array, [this, &array](int64_t i, const uint8_t*) {
+      BeginValue();
+      Write(array.FormatValue(i));
+      return true;
+    });
     return Status::OK();
   }
 
   template <typename T>
   inline typename std::enable_if<std::is_base_of<BooleanArray, T>::value, Status>::type
   WriteDataValues(const T& array) {
-    WriteValues(array, [&](int64_t i) { Write(array.Value(i) ? "true" : "false"); });
+    WriteValues(array, [this](int64_t, bool value) {
+      BeginValue();
+      Write(value ? "true" : "false");
+      return true;
+    });
     return Status::OK();
   }
 
   template <typename T>
-  inline typename std::enable_if<std::is_base_of<ListArray, T>::value, Status>::type
+  inline typename std::enable_if<std::is_base_of<ListArray, T>::value ||
+                                     std::is_base_of<LargeListArray, T>::value ||
+                                     std::is_base_of<FixedSizeListArray, T>::value,
+                                 Status>::type
   WriteDataValues(const T& array) {
     bool skip_comma = true;
     for (int64_t i = 0; i < array.length(); ++i) {
       if (skip_comma) {
         skip_comma = false;
       } else {
-        (*sink_) << ",\n";
+        Write(",\n");
       }
       if ((i >= window_) && (i < (array.length() - window_))) {
         Indent();
-        (*sink_) << "...\n";
+        Write("...\n");
         i = array.length() - window_ - 1;
         skip_comma = true;
       } else if (array.IsNull(i)) {
         Indent();
-        (*sink_) << null_rep_;
+        Write(null_rep_);
       } else {
         std::shared_ptr<Array> slice =
             array.values()->Slice(array.value_offset(i), array.value_length(i));
-        RETURN_NOT_OK(PrettyPrint(*slice, {indent_, window_}, sink_));
+        RETURN_NOT_OK(PrintNested(*slice, indent_));
       }
     }
-    (*sink_) << "\n";
+    Write("\n");
     return Status::OK();
   }
 
   Status Visit(const NullArray& array) {
-    (*sink_) << array.length() << " nulls";
+    WriteInteger(array.length());
+    Write(" nulls");
     return Status::OK();
   }
 
@@ -231,7 +372,10 @@ class ArrayPrinter : public PrettyPrinter {
   typename std::enable_if<std::is_base_of<PrimitiveArray, T>::value ||
                               std::is_base_of<FixedSizeBinaryArray, T>::value ||
                               std::is_base_of<BinaryArray, T>::value ||
-                              std::is_base_of<ListArray, T>::value,
+                              std::is_base_of<LargeBinaryArray, T>::value ||
+                              std::is_base_of<ListArray, T>::value ||
+                              std::is_base_of<LargeListArray, T>::value ||
+                              std::is_base_of<FixedSizeListArray, T>::value,
                           Status>::type
   Visit(const T& array) {
     OpenArray(array);
@@ -250,16 +394,18 @@ class ArrayPrinter : public PrettyPrinter {
                        int64_t length) {
     for (size_t i = 0; i < fields.size(); ++i) {
       Newline();
-      std::stringstream ss;
-      ss << "-- child " << i << " type: " << fields[i]->type()->ToString() << "\n";
-      Write(ss.str());
+      Write("-- child ");
+      WriteInteger(static_cast<int64_t>(i));
+      Write(" type: ");
+      Write(fields[i]->type()->ToString());
+      Write("\n");
 
       std::shared_ptr<Array> field = fields[i];
       if (offset != 0) {
         field = field->Slice(offset, length);
       }
 
-      RETURN_NOT_OK(PrettyPrint(*field, indent_ + indent_size_, sink_));
+      RETURN_NOT_OK(PrintNested(*field, indent_ + indent_size_));
     }
     return Status::OK();
   }
@@ -280,14 +426,14 @@ class ArrayPrinter : public PrettyPrinter {
     Newline();
     Write("-- type_ids: ");
     UInt8Array type_ids(array.length(), array.type_ids(), nullptr, 0, array.offset());
-    RETURN_NOT_OK(PrettyPrint(type_ids, indent_ + indent_size_, sink_));
+    RETURN_NOT_OK(PrintNested(type_ids, indent_ + indent_size_));
 
     if (array.mode() == UnionMode::DENSE) {
       Newline();
       Write("-- value_offsets: ");
       Int32Array value_offsets(array.length(), array.value_offsets(), nullptr, 0,
                                array.offset());
-      RETURN_NOT_OK(PrettyPrint(value_offsets, indent_ + indent_size_, sink_));
+      RETURN_NOT_OK(PrintNested(value_offsets, indent_ + indent_size_));
     }
 
     // Print the children without any offset, because the type ids are absolute
@@ -299,25 +445,45 @@ class ArrayPrinter : public PrettyPrinter {
     return PrintChildren(children, 0, array.length() + array.offset());
   }
 
+  Status Visit(const RunLengthEncodedArray& array) {
+    // Show the runs of the slice only, as if it were unsliced
+    std::shared_ptr<Buffer> run_ends;
+    std::shared_ptr<Array> values;
+    RETURN_NOT_OK(array.RebaseRuns(default_memory_pool(), &run_ends, &values));
+
+    Newline();
+    Write("-- run_ends:\n");
+    Int32Array run_ends_array(values->length(), run_ends);
+    RETURN_NOT_OK(PrintNested(run_ends_array, indent_ + indent_size_));
+
+    Newline();
+    Write("-- values:\n");
+    return PrintNested(*values, indent_ + indent_size_);
+  }
+
   Status Visit(const DictionaryArray& array) {
     Newline();
     Write("-- dictionary:\n");
-    RETURN_NOT_OK(PrettyPrint(*array.dictionary(), indent_ + indent_size_, sink_));
+    RETURN_NOT_OK(PrintNested(*array.dictionary(), indent_ + indent_size_));
 
     Newline();
     Write("-- indices:\n");
-    return PrettyPrint(*array.indices(), indent_ + indent_size_, sink_);
+    return PrintNested(*array.indices(), indent_ + indent_size_);
   }
 
-  Status Print() {
-    RETURN_NOT_OK(VisitArrayInline(array_, this));
-    Flush();
-    return Status::OK();
+  // Print an array shown as a part of this one, with the same options
+  Status PrintNested(const Array& array, int indent) {
+    ArrayPrinter printer(*this, array, indent, null_rep_);
+    return printer.Print();
   }
 
+  Status Print() { return VisitArrayInline(array_, this); }
+
  private:
   const Array& array_;
-  std::string null_rep_;
+  const std::string& null_rep_;
+  // Whether the next value is the first of a run, not preceded by a comma
+  bool skip_comma_;
 };
 
 Status ArrayPrinter::WriteValidityBitmap(const Array& array) {
@@ -328,7 +494,7 @@ Status ArrayPrinter::WriteValidityBitmap(const Array& array) {
     Newline();
     BooleanArray is_valid(array.length(), array.null_bitmap(), nullptr, 0,
                           array.offset());
-    return PrettyPrint(is_valid, indent_ + indent_size_, sink_);
+    return PrintNested(is_valid, indent_ + indent_size_);
   } else {
     Write(" all not null");
     return Status::OK();
@@ -336,15 +502,16 @@ Status ArrayPrinter::WriteValidityBitmap(const Array& array) {
 }
 
 Status PrettyPrint(const Array& arr, int indent, std::ostream* sink) {
-  ArrayPrinter printer(arr, indent, 2, 10, "null", sink);
-  return printer.Print();
+  return PrettyPrint(arr, PrettyPrintOptions(indent), sink);
 }
 
 Status PrettyPrint(const Array& arr, const PrettyPrintOptions& options,
                    std::ostream* sink) {
   ArrayPrinter printer(arr, options.indent, options.indent_size, options.window,
                        options.null_rep, sink);
-  return printer.Print();
+  RETURN_NOT_OK(printer.Print());
+  printer.Flush();
+  return Status::OK();
 }
 
 Status PrettyPrint(const Array& arr, const PrettyPrintOptions& options,
@@ -355,43 +522,62 @@ Status PrettyPrint(const Array& arr, const PrettyPrintOptions& options,
   return Status::OK();
 }
 
-Status PrettyPrint(const ChunkedArray& chunked_arr, const PrettyPrintOptions& options,
-                   std::ostream* sink) {
-  int num_chunks = chunked_arr.num_chunks();
-  int indent = options.indent;
-  int window = options.window;
-
-  for (int i = 0; i < indent; ++i) {
-    (*sink) << " ";
-  }
-  (*sink) << "[\n";
-  bool skip_comma = true;
-  for (int i = 0; i < num_chunks; ++i) {
-    if (skip_comma) {
-      skip_comma = false;
-    } else {
-      (*sink) << ",\n";
-    }
-    if ((i >= window) && (i < (num_chunks - window))) {
-      for (int i = 0; i < indent; ++i) {
-        (*sink) << " ";
+namespace {
+
+class ChunkedArrayPrinter : public PrettyPrinter {
+ public:
+  ChunkedArrayPrinter(const ChunkedArray& chunked_arr, const PrettyPrintOptions& options,
+                      std::ostream* sink)
+      : PrettyPrinter(options.indent, options.indent_size, options.window, sink),
+        chunked_arr_(chunked_arr),
+        null_rep_(options.null_rep) {}
+
+  // A printer of a column nested in the output of parent
+  ChunkedArrayPrinter(const PrettyPrinter& parent, const ChunkedArray& chunked_arr,
+                      int indent, const std::string& null_rep)
+      : PrettyPrinter(parent, indent), chunked_arr_(chunked_arr), null_rep_(null_rep) {}
+
+  Status Print() {
+    const int num_chunks = chunked_arr_.num_chunks();
+
+    Indent();
+    Write("[\n");
+    bool skip_comma = true;
+    for (int i = 0; i < num_chunks; ++i) {
+      if (skip_comma) {
+        skip_comma = false;
+      } else {
+        Write(",\n");
+      }
+      if ((i >= window_) && (i < (num_chunks - window_))) {
+        Indent();
+        Write("...\n");
+        i = num_chunks - window_ - 1;
+        skip_comma = true;
+      } else {
+        ArrayPrinter printer(*this, *chunked_arr_.chunk(i), indent_ + indent_size_,
+                             null_rep_);
+        RETURN_NOT_OK(printer.Print());
       }
-      (*sink) << "...\n";
-      i = num_chunks - window - 1;
-      skip_comma = true;
-    } else {
-      ArrayPrinter printer(*chunked_arr.chunk(i), indent + options.indent_size,
-                           options.indent_size, window, options.null_rep, sink);
-      RETURN_NOT_OK(printer.Print());
     }
+    Write("\n");
+    Indent();
+    Write("]");
+    return Status::OK();
   }
-  (*sink) << "\n";
 
-  for (int i = 0; i < indent; ++i) {
-    (*sink) << " ";
-  }
-  (*sink) << "]";
+ private:
+  const ChunkedArray& chunked_arr_;
+  const std::string& null_rep_;
+};
 
+}  // namespace
+
+Status PrettyPrint(const ChunkedArray& chunked_arr, const PrettyPrintOptions& options,
+                   std::ostream* sink) {
+  ChunkedArrayPrinter printer(chunked_arr, options, sink);
+  RETURN_NOT_OK(printer.Print());
+  printer.Flush();
   return Status::OK();
 }
 
@@ -404,13 +590,38 @@ Status PrettyPrint(const ChunkedArray& chunked_arr, const PrettyPrintOptions& op
 }
 
 Status PrettyPrint(const RecordBatch& batch, int indent, std::ostream* sink) {
+  return PrettyPrint(batch, PrettyPrintOptions(indent), sink);
+}
+
+Status PrettyPrint(const RecordBatch& batch, const PrettyPrintOptions& options,
+                   std::ostream* sink) {
+  PrettyPrinter printer(0, options.indent_size, options.window, sink);
   for (int i = 0; i < batch.num_columns(); ++i) {
-    const std::string& name = batch.column_name(i);
-    (*sink) << name << ": ";
-    RETURN_NOT_OK(PrettyPrint(*batch.column(i), indent + 2, sink));
-    (*sink) << "\n";
+    printer.Write(batch.column_name(i));
+    printer.Write(": ");
+    ArrayPrinter column_printer(printer, *batch.column(i),
+                                options.indent + options.indent_size, options.null_rep);
+    RETURN_NOT_OK(column_printer.Print());
+    printer.Write("\n");
+  }
+  printer.Flush();
+  return Status::OK();
+}
+
+Status PrettyPrint(const Table& table, const PrettyPrintOptions& options,
+                   std::ostream* sink) {
+  PrettyPrinter printer(0, options.indent_size, options.window, sink);
+  for (int i = 0; i < table.num_columns(); ++i) {
+    const Column& column = *table.column(i);
+    printer.Write(column.name());
+    printer.Write(": ");
+    ChunkedArrayPrinter column_printer(printer, *column.data(),
+                                       options.indent + options.indent_size,
+                                       options.null_rep);
+    RETURN_NOT_OK(column_printer.Print());
+    printer.Write("\n");
   }
-  (*sink) << std::flush;
+  printer.Flush();
   return Status::OK();
 }
 
@@ -420,9 +631,11 @@ Status DebugPrint(const Array& arr, int indent) {
 
 class SchemaPrinter : public PrettyPrinter {
  public:
-  SchemaPrinter(const Schema& schema, int indent, int indent_size, int window,
+  SchemaPrinter(const Schema& schema, const PrettyPrintOptions& options,
                 std::ostream* sink)
-      : PrettyPrinter(indent, indent_size, window, sink), schema_(schema) {}
+      : PrettyPrinter(options.indent, options.indent_size, options.window, sink),
+        schema_(schema),
+        null_rep_(options.null_rep) {}
 
   Status PrintType(const DataType& type);
   Status PrintField(const Field& field);
@@ -440,6 +653,7 @@ class SchemaPrinter : public PrettyPrinter {
 
  private:
   const Schema& schema_;
+  const std::string& null_rep_;
 };
 
 Status SchemaPrinter::PrintType(const DataType& type) {
@@ -449,7 +663,9 @@ Status SchemaPrinter::PrintType(const DataType& type) {
     Newline();
     Write("dictionary:\n");
     const auto& dict_type = checked_cast<const DictionaryType&>(type);
-    RETURN_NOT_OK(PrettyPrint(*dict_type.dictionary(), indent_ + indent_size_, sink_));
+    ArrayPrinter printer(*this, *dict_type.dictionary(), indent_ + indent_size_,
+                         null_rep_);
+    RETURN_NOT_OK(printer.Print());
     indent_ -= indent_size_;
   } else {
     for (int i = 0; i < type.num_children(); ++i) {
@@ -475,8 +691,7 @@ Status SchemaPrinter::PrintField(const Field& field) {
 
 Status PrettyPrint(const Schema& schema, const PrettyPrintOptions& options,
                    std::ostream* sink) {
-  SchemaPrinter printer(schema, options.indent, options.indent_size, options.window,
-                        sink);
+  SchemaPrinter printer(schema, options, sink);
   return printer.Print();
 }
 
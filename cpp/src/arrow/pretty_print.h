@@ -45,6 +45,10 @@ struct PrettyPrintOptions {
   int indent_size;
 
   /// Maximum number of elements to show at the beginning and at the end.
+  ///
+  /// Applies to each array on its own: to each column of a record batch or a
+  /// table, each chunk of a chunked array and each nested child or list value,
+  /// so the output is bounded whatever the length of the data.
   int window;
 
   /// String to use for representing a null value, defaults to "null"
@@ -55,6 +59,16 @@ struct PrettyPrintOptions {
 ARROW_EXPORT
 Status PrettyPrint(const RecordBatch& batch, int indent, std::ostream* sink);
 
+/// \brief Print human-readable representation of RecordBatch
+ARROW_EXPORT
+Status PrettyPrint(const RecordBatch& batch, const PrettyPrintOptions& options,
+                   std::ostream* sink);
+
+/// \brief Print human-readable representation of Table
+ARROW_EXPORT
+Status PrettyPrint(const Table& table, const PrettyPrintOptions& options,
+                   std::ostream* sink);
+
 /// \brief Print human-readable representation of Array
 ARROW_EXPORT
 Status PrettyPrint(const Array& arr, int indent, std::ostream* sink);
@@ -24,10 +24,12 @@
 #include <algorithm>
 #include <cmath>
 #include <cstdint>
+#include <cstring>
 #include <memory>
 #include <sstream>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "arrow/array.h"
@@ -38,6 +40,7 @@
 #include "arrow/util/bit-util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/decimal.h"
+#include "arrow/util/hash-util.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/parallel.h"
@@ -64,6 +67,10 @@ using internal::kPandasTimestampNull;
 using compute::Datum;
 using compute::FunctionContext;
 
+// The number of rows of the ranges a long column is split into, to convert
+// them on different threads
+static constexpr int64_t kRowsPerTask = 1 << 20;
+
 // ----------------------------------------------------------------------
 // Utility code
 
@@ -216,6 +223,20 @@ class PandasBlock {
   virtual Status Write(const std::shared_ptr<Column>& col, int64_t abs_placement,
                        int64_t rel_placement) = 0;
 
+  // Whether a column can be written by ranges of rows, in parallel, with
+  // WriteRows and then SetPlacement
+  virtual bool supports_row_ranges() const { return false; }
+
+  // Write a slice of a column from the row `row_offset` of the block
+  virtual Status WriteRows(const std::shared_ptr<Column>& col, int64_t rel_placement,
+                           int64_t row_offset) {
+    return Status::NotImplemented("Block cannot be written by ranges of rows");
+  }
+
+  void SetPlacement(int64_t abs_placement, int64_t rel_placement) {
+    placement_data_[rel_placement] = abs_placement;
+  }
+
   PyObject* block_arr() const { return block_arr_.obj(); }
 
   virtual Status GetPyResult(PyObject** output) {
@@ -282,6 +303,22 @@ class PandasBlock {
   ARROW_DISALLOW_COPY_AND_ASSIGN(PandasBlock);
 };
 
+// A block of values converted independently of each other, so that the ranges
+// of rows of a long column can be converted on different threads
+class RowRangeBlock : public PandasBlock {
+ public:
+  using PandasBlock::PandasBlock;
+
+  Status Write(const std::shared_ptr<Column>& col, int64_t abs_placement,
+               int64_t rel_placement) override {
+    RETURN_NOT_OK(WriteRows(col, rel_placement, 0));
+    SetPlacement(abs_placement, rel_placement);
+    return Status::OK();
+  }
+
+  bool supports_row_ranges() const override { return true; }
+};
+
 template <typename T>
 inline const T* GetPrimitiveValues(const Array& arr) {
   if (arr.length() == 0) {
@@ -388,9 +425,84 @@ static Status ConvertIntegerObjects(PandasOptions options, const ChunkedArray& d
   return Status::OK();
 }
 
+// A value of a binary-like array, compared and hashed on the bytes of its
+// Arrow buffer
+struct BinaryValue {
+  const uint8_t* data;
+  int32_t length;
+
+  bool operator==(const BinaryValue& other) const {
+    return length == other.length && memcmp(data, other.data, length) == 0;
+  }
+};
+
+struct BinaryValueHash {
+  size_t operator()(const BinaryValue& value) const {
+    return HashUtil::Hash(value.data, value.length, 0);
+  }
+};
+
+// Convert binary-like values to one Python object per distinct value. The
+// values are deduplicated before taking the GIL, which is then held only to
+// create the objects and give out their references.
+template <typename Type>
+inline Status ConvertBinaryLikeDeduplicated(const ChunkedArray& data,
+                                            PyObject** out_values) {
+  using ArrayType = typename TypeTraits<Type>::ArrayType;
+  constexpr int64_t kNullIndex = -1;
+
+  std::unordered_map<BinaryValue, int64_t, BinaryValueHash> memo;
+  std::vector<BinaryValue> uniques;
+  // The index in uniques of each value
+  std::vector<int64_t> indices;
+  indices.reserve(data.length());
+
+  const bool has_nulls = data.null_count() > 0;
+  for (int c = 0; c < data.num_chunks(); c++) {
+    const auto& arr = checked_cast<const ArrayType&>(*data.chunk(c));
+    for (int64_t i = 0; i < arr.length(); ++i) {
+      if (has_nulls && arr.IsNull(i)) {
+        indices.push_back(kNullIndex);
+        continue;
+      }
+      BinaryValue value;
+      value.data = arr.GetValue(i, &value.length);
+      auto it = memo.emplace(value, static_cast<int64_t>(uniques.size()));
+      if (it.second) {
+        uniques.push_back(value);
+      }
+      indices.push_back(it.first->second);
+    }
+  }
+
+  PyAcquireGIL lock;
+  std::vector<OwnedRef> objects(uniques.size());
+  for (size_t i = 0; i < uniques.size(); ++i) {
+    const BinaryValue& value = uniques[i];
+    objects[i].reset(WrapBytes<ArrayType>::Wrap(value.data, value.length));
+    if (!objects[i]) {
+      PyErr_Clear();
+      std::stringstream ss;
+      ss << "Wrapping "
+         << std::string(reinterpret_cast<const char*>(value.data), value.length)
+         << " failed";
+      return Status::UnknownError(ss.str());
+    }
+  }
+  for (int64_t index : indices) {
+    PyObject* obj = index == kNullIndex ? Py_None : objects[index].obj();
+    Py_INCREF(obj);
+    *out_values++ = obj;
+  }
+  return Status::OK();
+}
+
 template <typename Type>
 inline Status ConvertBinaryLike(PandasOptions options, const ChunkedArray& data,
                                 PyObject** out_values) {
+  if (options.deduplicate_objects) {
+    return ConvertBinaryLikeDeduplicated<Type>(data, out_values);
+  }
   using ArrayType = typename TypeTraits<Type>::ArrayType;
   PyAcquireGIL lock;
   for (int c = 0; c < data.num_chunks(); c++) {
@@ -780,19 +892,19 @@ class ObjectBlock : public PandasBlock {
 };
 
 template <int ARROW_TYPE, typename C_TYPE>
-class IntBlock : public PandasBlock {
+class IntBlock : public RowRangeBlock {
  public:
-  using PandasBlock::PandasBlock;
+  using RowRangeBlock::RowRangeBlock;
   Status Allocate() override {
     return AllocateNDArray(internal::arrow_traits<ARROW_TYPE>::npy_type);
   }
 
-  Status Write(const std::shared_ptr<Column>& col, int64_t abs_placement,
-               int64_t rel_placement) override {
+  Status WriteRows(const std::shared_ptr<Column>& col, int64_t rel_placement,
+                   int64_t row_offset) override {
     Type::type type = col->type()->id();
 
     C_TYPE* out_buffer =
-        reinterpret_cast<C_TYPE*>(block_data_) + rel_placement * num_rows_;
+        reinterpret_cast<C_TYPE*>(block_data_) + rel_placement * num_rows_ + row_offset;
 
     const ChunkedArray& data = *col->data().get();
 
@@ -804,7 +916,6 @@ class IntBlock : public PandasBlock {
     }
 
     ConvertIntegerNoNullsSameType<C_TYPE>(options_, data, out_buffer);
-    placement_data_[rel_placement] = abs_placement;
     return Status::OK();
   }
 };
@@ -818,13 +929,13 @@ using Int32Block = IntBlock<Type::INT32, int32_t>;
 using UInt64Block = IntBlock<Type::UINT64, uint64_t>;
 using Int64Block = IntBlock<Type::INT64, int64_t>;
 
-class Float16Block : public PandasBlock {
+class Float16Block : public RowRangeBlock {
  public:
-  using PandasBlock::PandasBlock;
+  using RowRangeBlock::RowRangeBlock;
   Status Allocate() override { return AllocateNDArray(NPY_FLOAT16); }
 
-  Status Write(const std::shared_ptr<Column>& col, int64_t abs_placement,
-               int64_t rel_placement) override {
+  Status WriteRows(const std::shared_ptr<Column>& col, int64_t rel_placement,
+                   int64_t row_offset) override {
     Type::type type = col->type()->id();
 
     if (type != Type::HALF_FLOAT) {
@@ -835,21 +946,20 @@ class Float16Block : public PandasBlock {
     }
 
     npy_half* out_buffer =
-        reinterpret_cast<npy_half*>(block_data_) + rel_placement * num_rows_;
+        reinterpret_cast<npy_half*>(block_data_) + rel_placement * num_rows_ + row_offset;
 
     ConvertNumericNullable<npy_half>(*col->data().get(), NPY_HALF_NAN, out_buffer);
-    placement_data_[rel_placement] = abs_placement;
     return Status::OK();
   }
 };
 
-class Float32Block : public PandasBlock {
+class Float32Block : public RowRangeBlock {
  public:
-  using PandasBlock::PandasBlock;
+  using RowRangeBlock::RowRangeBlock;
   Status Allocate() override { return AllocateNDArray(NPY_FLOAT32); }
 
-  Status Write(const std::shared_ptr<Column>& col, int64_t abs_placement,
-               int64_t rel_placement) override {
+  Status WriteRows(const std::shared_ptr<Column>& col, int64_t rel_placement,
+                   int64_t row_offset) override {
     Type::type type = col->type()->id();
 
     if (type != Type::FLOAT) {
@@ -859,25 +969,25 @@ class Float32Block : public PandasBlock {
       return Status::NotImplemented(ss.str());
     }
 
-    float* out_buffer = reinterpret_cast<float*>(block_data_) + rel_placement * num_rows_;
+    float* out_buffer =
+        reinterpret_cast<float*>(block_data_) + rel_placement * num_rows_ + row_offset;
 
     ConvertNumericNullable<float>(*col->data().get(), NAN, out_buffer);
-    placement_data_[rel_placement] = abs_placement;
     return Status::OK();
   }
 };
 
-class Float64Block : public PandasBlock {
+class Float64Block : public RowRangeBlock {
  public:
-  using PandasBlock::PandasBlock;
+  using RowRangeBlock::RowRangeBlock;
   Status Allocate() override { return AllocateNDArray(NPY_FLOAT64); }
 
-  Status Write(const std::shared_ptr<Column>& col, int64_t abs_placement,
-               int64_t rel_placement) override {
+  Status WriteRows(const std::shared_ptr<Column>& col, int64_t rel_placement,
+                   int64_t row_offset) override {
     Type::type type = col->type()->id();
 
     double* out_buffer =
-        reinterpret_cast<double*>(block_data_) + rel_placement * num_rows_;
+        reinterpret_cast<double*>(block_data_) + rel_placement * num_rows_ + row_offset;
 
     const ChunkedArray& data = *col->data().get();
 
@@ -917,18 +1027,17 @@ class Float64Block : public PandasBlock {
 
 #undef INTEGER_CASE
 
-    placement_data_[rel_placement] = abs_placement;
     return Status::OK();
   }
 };
 
-class BoolBlock : public PandasBlock {
+class BoolBlock : public RowRangeBlock {
  public:
-  using PandasBlock::PandasBlock;
+  using RowRangeBlock::RowRangeBlock;
   Status Allocate() override { return AllocateNDArray(NPY_BOOL); }
 
-  Status Write(const std::shared_ptr<Column>& col, int64_t abs_placement,
-               int64_t rel_placement) override {
+  Status WriteRows(const std::shared_ptr<Column>& col, int64_t rel_placement,
+                   int64_t row_offset) override {
     Type::type type = col->type()->id();
 
     if (type != Type::BOOL) {
@@ -939,17 +1048,16 @@ class BoolBlock : public PandasBlock {
     }
 
     uint8_t* out_buffer =
-        reinterpret_cast<uint8_t*>(block_data_) + rel_placement * num_rows_;
+        reinterpret_cast<uint8_t*>(block_data_) + rel_placement * num_rows_ + row_offset;
 
     ConvertBooleanNoNulls(options_, *col->data(), out_buffer);
-    placement_data_[rel_placement] = abs_placement;
     return Status::OK();
   }
 };
 
-class DatetimeBlock : public PandasBlock {
+class DatetimeBlock : public RowRangeBlock {
  public:
-  using PandasBlock::PandasBlock;
+  using RowRangeBlock::RowRangeBlock;
   Status AllocateDatetime(int ndim) {
     RETURN_NOT_OK(AllocateNDArray(NPY_DATETIME, ndim));
 
@@ -962,12 +1070,12 @@ class DatetimeBlock : public PandasBlock {
 
   Status Allocate() override { return AllocateDatetime(2); }
 
-  Status Write(const std::shared_ptr<Column>& col, int64_t abs_placement,
-               int64_t rel_placement) override {
+  Status WriteRows(const std::shared_ptr<Column>& col, int64_t rel_placement,
+                   int64_t row_offset) override {
     Type::type type = col->type()->id();
 
     int64_t* out_buffer =
-        reinterpret_cast<int64_t*>(block_data_) + rel_placement * num_rows_;
+        reinterpret_cast<int64_t*>(block_data_) + rel_placement * num_rows_ + row_offset;
 
     const ChunkedArray& data = *col->data();
 
@@ -999,7 +1107,6 @@ class DatetimeBlock : public PandasBlock {
       return Status::NotImplemented(ss.str());
     }
 
-    placement_data_[rel_placement] = abs_placement;
     return Status::OK();
   }
 };
@@ -1033,10 +1140,175 @@ class DatetimeTZBlock : public DatetimeBlock {
   std::string timezone_;
 };
 
+// ----------------------------------------------------------------------
+// Categorical columns
+//
+// The categorical columns are made of chunks sharing a single dictionary. The
+// columns to encode are dictionary-encoded chunk by chunk, and the chunks
+// with other dictionaries than the first are transposed onto the union of the
+// dictionaries, rather than the columns being encoded again as a whole.
+
+// Run func(i) for every i in [0, num_tasks), on the thread pool if use_threads
+template <typename Function>
+static Status RunTasks(bool use_threads, int num_tasks, Function&& func) {
+  if (use_threads) {
+    return ParallelFor(num_tasks, std::forward<Function>(func));
+  }
+  for (int i = 0; i < num_tasks; ++i) {
+    RETURN_NOT_OK(func(i));
+  }
+  return Status::OK();
+}
+
+template <typename IndexType>
+static Status CheckIndices(const Array& indices, int64_t dict_length) {
+  using T = typename IndexType::c_type;
+  const T* values = checked_cast<const NumericArray<IndexType>&>(indices).raw_values();
+  for (int64_t i = 0; i < indices.length(); ++i) {
+    if (indices.IsValid(i) && (values[i] < 0 || values[i] >= dict_length)) {
+      std::stringstream ss;
+      ss << "Out of bounds dictionary index: " << static_cast<int64_t>(values[i]);
+      return Status::Invalid(ss.str());
+    }
+  }
+  return Status::OK();
+}
+
+static Status CheckDictionaryIndices(const DictionaryArray& arr) {
+  const int64_t dict_length = arr.dictionary()->length();
+  switch (arr.dict_type()->index_type()->id()) {
+    case Type::INT8:
+      return CheckIndices<Int8Type>(*arr.indices(), dict_length);
+    case Type::INT16:
+      return CheckIndices<Int16Type>(*arr.indices(), dict_length);
+    case Type::INT32:
+      return CheckIndices<Int32Type>(*arr.indices(), dict_length);
+    case Type::INT64:
+      return CheckIndices<Int64Type>(*arr.indices(), dict_length);
+    default: {
+      std::stringstream ss;
+      ss << "Categorical index type not supported: "
+         << arr.dict_type()->index_type()->ToString();
+      return Status::NotImplemented(ss.str());
+    }
+  }
+}
+
+// Make the categorical columns of the given columns, dictionary-encoding
+// those that are not dictionary columns yet
+static Status MakeCategoricalColumns(const PandasOptions& options, MemoryPool* pool,
+                                     std::vector<std::shared_ptr<Column>>* columns) {
+  struct ChunkTask {
+    size_t column;
+    int chunk;
+  };
+
+  std::vector<ArrayVector> chunks(columns->size());
+  std::vector<ChunkTask> encode_tasks;
+  for (size_t i = 0; i < columns->size(); ++i) {
+    const auto& col = (*columns)[i];
+    chunks[i] = col->data()->chunks();
+    if (col->type()->id() == Type::DICTIONARY) {
+      continue;
+    }
+    if (options.zero_copy_only) {
+      return Status::Invalid(
+          "Need to allocate categorical memory, "
+          "but only zero-copy conversions allowed.");
+    }
+    for (int c = 0; c < col->data()->num_chunks(); ++c) {
+      encode_tasks.push_back({i, c});
+    }
+  }
+
+  auto EncodeChunk = [&](int i) {
+    const ChunkTask& task = encode_tasks[i];
+    FunctionContext ctx(pool);
+    Datum out;
+    RETURN_NOT_OK(compute::DictionaryEncode(
+        &ctx, Datum(chunks[task.column][task.chunk]->data()), &out));
+    chunks[task.column][task.chunk] = out.make_array();
+    return Status::OK();
+  };
+  RETURN_NOT_OK(RunTasks(options.use_threads, static_cast<int>(encode_tasks.size()),
+                         EncodeChunk));
+
+  // The dictionary type of each column, and the transpose maps of its chunks
+  // if they have different dictionaries
+  std::vector<std::shared_ptr<DataType>> types(columns->size());
+  std::vector<std::vector<std::shared_ptr<Buffer>>> transpose_maps(columns->size());
+  std::vector<size_t> unify_tasks;
+  for (size_t i = 0; i < columns->size(); ++i) {
+    if (chunks[i].empty()) {
+      types[i] = (*columns)[i]->type();
+      continue;
+    }
+    types[i] = chunks[i][0]->type();
+    for (const auto& chunk : chunks[i]) {
+      if (!chunk->type()->Equals(*types[i])) {
+        unify_tasks.push_back(i);
+        break;
+      }
+    }
+  }
+
+  auto UnifyColumn = [&](int i) {
+    const size_t column = unify_tasks[i];
+    std::vector<std::shared_ptr<DataType>> chunk_types;
+    for (const auto& chunk : chunks[column]) {
+      chunk_types.push_back(chunk->type());
+    }
+    FunctionContext ctx(pool);
+    return compute::UnifyDictionaries(&ctx, chunk_types, &types[column],
+                                      &transpose_maps[column]);
+  };
+  RETURN_NOT_OK(
+      RunTasks(options.use_threads, static_cast<int>(unify_tasks.size()), UnifyColumn));
+
+  std::vector<ChunkTask> transpose_tasks;
+  for (size_t column : unify_tasks) {
+    if (options.zero_copy_only) {
+      return Status::Invalid(
+          "Need to unify the dictionaries of the chunks of a categorical column, "
+          "but only zero-copy conversions allowed.");
+    }
+    for (int c = 0; c < static_cast<int>(chunks[column].size()); ++c) {
+      if (!chunks[column][c]->type()->Equals(*types[column])) {
+        transpose_tasks.push_back({column, c});
+      }
+    }
+  }
+
+  auto TransposeChunk = [&](int i) {
+    const ChunkTask& task = transpose_tasks[i];
+    const auto& chunk =
+        checked_cast<const DictionaryArray&>(*chunks[task.column][task.chunk]);
+    RETURN_NOT_OK(CheckDictionaryIndices(chunk));
+    const auto transpose_map = reinterpret_cast<const int32_t*>(
+        transpose_maps[task.column][task.chunk]->data());
+    return chunk.Transpose(pool, types[task.column], transpose_map,
+                           &chunks[task.column][task.chunk]);
+  };
+  RETURN_NOT_OK(RunTasks(options.use_threads, static_cast<int>(transpose_tasks.size()),
+                         TransposeChunk));
+
+  for (size_t i = 0; i < columns->size(); ++i) {
+    const auto& col = (*columns)[i];
+    if (types[i] == col->type()) {
+      continue;
+    }
+    auto field = std::make_shared<Field>(col->name(), types[i], col->field()->nullable(),
+                                         col->field()->metadata());
+    auto data = std::make_shared<ChunkedArray>(chunks[i], types[i]);
+    (*columns)[i] = std::make_shared<Column>(field, data);
+  }
+  return Status::OK();
+}
+
 class CategoricalBlock : public PandasBlock {
  public:
-  explicit CategoricalBlock(PandasOptions options, MemoryPool* pool, int64_t num_rows)
-      : PandasBlock(options, num_rows, 1), pool_(pool), needs_copy_(false) {}
+  CategoricalBlock(PandasOptions options, int64_t num_rows)
+      : PandasBlock(options, num_rows, 1) {}
 
   Status Allocate() override {
     return Status::NotImplemented(
@@ -1058,32 +1330,15 @@ class CategoricalBlock : public PandasBlock {
     const auto indices_first =
         std::static_pointer_cast<ArrayType>(dict_arr_first.indices());
 
-    auto CheckIndices = [](const ArrayType& arr, int64_t dict_length) {
-      const T* values = arr.raw_values();
-      for (int64_t i = 0; i < arr.length(); ++i) {
-        if (arr.IsValid(i) && (values[i] < 0 || values[i] >= dict_length)) {
-          std::stringstream ss;
-          ss << "Out of bounds dictionary index: " << static_cast<int64_t>(values[i]);
-          return Status::Invalid(ss.str());
-        }
-      }
-      return Status::OK();
-    };
-
-    if (!needs_copy_ && data.num_chunks() == 1 && indices_first->null_count() == 0) {
-      RETURN_NOT_OK(CheckIndices(*indices_first, dict_arr_first.dictionary()->length()));
+    if (data.num_chunks() == 1 && indices_first->null_count() == 0) {
+      RETURN_NOT_OK(CheckDictionaryIndices(dict_arr_first));
       RETURN_NOT_OK(AllocateNDArrayFromIndices<T>(npy_type, indices_first));
     } else {
       if (options_.zero_copy_only) {
         std::stringstream ss;
-        if (needs_copy_) {
-          ss << "Need to allocate categorical memory, "
-             << "but only zero-copy conversions allowed.";
-        } else {
-          ss << "Needed to copy " << data.num_chunks() << " chunks with "
-             << indices_first->null_count()
-             << " indices nulls, but zero_copy_only was True";
-        }
+        ss << "Needed to copy " << data.num_chunks() << " chunks with "
+           << indices_first->null_count()
+           << " indices nulls, but zero_copy_only was True";
         return Status::Invalid(ss.str());
       }
       RETURN_NOT_OK(AllocateNDArray(npy_type, 1));
@@ -1098,7 +1353,7 @@ class CategoricalBlock : public PandasBlock {
         const auto& indices = checked_cast<const ArrayType&>(*dict_arr.indices());
         auto in_values = reinterpret_cast<const T*>(indices.raw_values());
 
-        RETURN_NOT_OK(CheckIndices(indices, dict_arr.dictionary()->length()));
+        RETURN_NOT_OK(CheckDictionaryIndices(dict_arr));
         // Null is -1 in CategoricalBlock
         for (int i = 0; i < arr->length(); ++i) {
           *out_values++ = indices.IsNull(i) ? -1 : in_values[i];
@@ -1109,37 +1364,23 @@ class CategoricalBlock : public PandasBlock {
     return Status::OK();
   }
 
+  // Write a categorical column, as made by MakeCategoricalColumns
   Status Write(const std::shared_ptr<Column>& col, int64_t abs_placement,
                int64_t rel_placement) override {
-    std::shared_ptr<Column> converted_col;
-    if (options_.strings_to_categorical &&
-        (col->type()->id() == Type::STRING || col->type()->id() == Type::BINARY)) {
-      needs_copy_ = true;
-      compute::FunctionContext ctx(pool_);
-
-      Datum out;
-      RETURN_NOT_OK(compute::DictionaryEncode(&ctx, Datum(col->data()), &out));
-      DCHECK_EQ(out.kind(), Datum::CHUNKED_ARRAY);
-      converted_col =
-          std::make_shared<Column>(field(col->name(), out.type()), out.chunked_array());
-    } else {
-      converted_col = col;
-    }
-
-    const auto& dict_type = checked_cast<const DictionaryType&>(*converted_col->type());
+    const auto& dict_type = checked_cast<const DictionaryType&>(*col->type());
 
     switch (dict_type.index_type()->id()) {
       case Type::INT8:
-        RETURN_NOT_OK(WriteIndices<Int8Type>(converted_col));
+        RETURN_NOT_OK(WriteIndices<Int8Type>(col));
         break;
       case Type::INT16:
-        RETURN_NOT_OK(WriteIndices<Int16Type>(converted_col));
+        RETURN_NOT_OK(WriteIndices<Int16Type>(col));
         break;
       case Type::INT32:
-        RETURN_NOT_OK(WriteIndices<Int32Type>(converted_col));
+        RETURN_NOT_OK(WriteIndices<Int32Type>(col));
         break;
       case Type::INT64:
-        RETURN_NOT_OK(WriteIndices<Int64Type>(converted_col));
+        RETURN_NOT_OK(WriteIndices<Int64Type>(col));
         break;
       default: {
         std::stringstream ss;
@@ -1230,10 +1471,8 @@ class CategoricalBlock : public PandasBlock {
     return Status::OK();
   }
 
-  MemoryPool* pool_;
   OwnedRefNoGIL dictionary_;
   bool ordered_;
-  bool needs_copy_;
 };
 
 Status MakeBlock(PandasOptions options, PandasBlock::type type, int64_t num_rows,
@@ -1391,7 +1630,7 @@ class DataFrameBlockCreator {
       int block_placement = 0;
       std::shared_ptr<PandasBlock> block;
       if (output_type == PandasBlock::CATEGORICAL) {
-        block = std::make_shared<CategoricalBlock>(options_, pool_, table_->num_rows());
+        block = std::make_shared<CategoricalBlock>(options_, table_->num_rows());
         categorical_blocks_[i] = block;
       } else if (output_type == PandasBlock::DATETIME_WITH_TZ) {
         const auto& ts_type = checked_cast<const TimestampType&>(*col->type());
@@ -1458,7 +1697,7 @@ class DataFrameBlockCreator {
     };
 
     if (options_.use_threads) {
-      return ParallelFor(table_->num_columns(), WriteColumn);
+      return WriteTableToBlocksParallel();
     } else {
       for (int i = 0; i < table_->num_columns(); ++i) {
         RETURN_NOT_OK(WriteColumn(i));
@@ -1467,6 +1706,46 @@ class DataFrameBlockCreator {
     }
   }
 
+  // Write the columns on the thread pool, splitting the long columns of the
+  // blocks that support it into ranges of rows, so that a table of a few
+  // columns still occupies all the threads. The tasks are listed ahead, as
+  // a task waiting for tasks of its own could leave the pool without threads.
+  Status WriteTableToBlocksParallel() {
+    struct WriteTask {
+      std::shared_ptr<PandasBlock> block;
+      int column;
+      // The first row of the range, or -1 to write the whole column
+      int64_t row_offset;
+    };
+
+    const int64_t num_rows = table_->num_rows();
+    std::vector<WriteTask> tasks;
+    for (int i = 0; i < table_->num_columns(); ++i) {
+      std::shared_ptr<PandasBlock> block;
+      RETURN_NOT_OK(GetBlock(i, &block));
+      if (block->supports_row_ranges() && num_rows > kRowsPerTask) {
+        block->SetPlacement(i, column_block_placement_[i]);
+        for (int64_t offset = 0; offset < num_rows; offset += kRowsPerTask) {
+          tasks.push_back({block, i, offset});
+        }
+      } else {
+        tasks.push_back({block, i, -1});
+      }
+    }
+
+    auto RunTask = [this, &tasks](int i) {
+      const auto& task = tasks[i];
+      std::shared_ptr<Column> col = this->table_->column(task.column);
+      const int64_t rel_placement = this->column_block_placement_[task.column];
+      if (task.row_offset < 0) {
+        return task.block->Write(col, task.column, rel_placement);
+      }
+      return task.block->WriteRows(col->Slice(task.row_offset, kRowsPerTask),
+                                   rel_placement, task.row_offset);
+    };
+    return ParallelFor(static_cast<int>(tasks.size()), RunTask);
+  }
+
   Status AppendBlocks(const BlockMap& blocks, PyObject* list) {
     for (const auto& it : blocks) {
       PyObject* item;
@@ -1817,8 +2096,11 @@ class ArrowDeserializer {
   }
 
   Status Visit(const DictionaryType& type) {
-    auto block = std::make_shared<CategoricalBlock>(options_, nullptr, col_->length());
-    RETURN_NOT_OK(block->Write(col_, 0, 0));
+    std::vector<std::shared_ptr<Column>> columns = {col_};
+    RETURN_NOT_OK(MakeCategoricalColumns(options_, default_memory_pool(), &columns));
+
+    auto block = std::make_shared<CategoricalBlock>(options_, col_->length());
+    RETURN_NOT_OK(block->Write(columns[0], 0, 0));
 
     PyAcquireGIL lock;
     result_ = PyDict_New();
@@ -1834,6 +2116,22 @@ class ArrowDeserializer {
 
   Status Visit(const UnionType& type) { return Status::NotImplemented("union type"); }
 
+  Status Visit(const LargeBinaryType& type) {
+    return Status::NotImplemented(type.ToString());
+  }
+
+  Status Visit(const LargeListType& type) {
+    return Status::NotImplemented(type.ToString());
+  }
+
+  Status Visit(const FixedSizeListType& type) {
+    return Status::NotImplemented(type.ToString());
+  }
+
+  Status Visit(const RunLengthEncodedType& type) {
+    return Status::NotImplemented(type.ToString());
+  }
+
   Status Convert(PyObject** out) {
     RETURN_NOT_OK(VisitTypeInline(*col_->type(), this));
     *out = result_;
@@ -1872,6 +2170,52 @@ Status ConvertColumnToPandas(PandasOptions options, const std::shared_ptr<Column
   return converter.Convert(out);
 }
 
+Status ConvertArrayToNumPyMasked(const std::shared_ptr<Array>& arr, PyObject* py_ref,
+                                 PyObject** out_values, PyObject** out_mask) {
+  if (!is_integer(arr->type_id()) && !is_floating(arr->type_id())) {
+    std::stringstream ss;
+    ss << "Masked NumPy conversion is only supported for integer and floating point "
+       << "types, got " << arr->type()->ToString();
+    return Status::NotImplemented(ss.str());
+  }
+
+  // Without its validity bitmap, the array converts zero-copy
+  std::shared_ptr<ArrayData> values_data = arr->data()->Copy();
+  values_data->buffers[0] = nullptr;
+  values_data->null_count = 0;
+
+  PandasOptions options;
+  options.zero_copy_only = true;
+  OwnedRefNoGIL values;
+  RETURN_NOT_OK(
+      ConvertArrayToPandas(options, MakeArray(values_data), py_ref, values.ref()));
+
+  OwnedRefNoGIL mask;
+  {
+    PyAcquireGIL lock;
+    // A failed zero-copy conversion leaves its error set
+    RETURN_IF_PYERROR();
+    npy_intp dims[1] = {static_cast<npy_intp>(arr->length())};
+    mask.reset(PyArray_SimpleNew(1, dims, NPY_BOOL));
+    RETURN_IF_PYERROR();
+  }
+
+  // The mask is filled without the GIL, as the ndarray is not shared yet
+  auto mask_values = reinterpret_cast<uint8_t*>(
+      PyArray_DATA(reinterpret_cast<PyArrayObject*>(mask.obj())));
+  if (arr->null_count() == 0) {
+    memset(mask_values, 0, static_cast<size_t>(arr->length()));
+  } else {
+    for (int64_t i = 0; i < arr->length(); ++i) {
+      mask_values[i] = static_cast<uint8_t>(arr->IsNull(i));
+    }
+  }
+
+  *out_values = values.detach();
+  *out_mask = mask.detach();
+  return Status::OK();
+}
+
 Status ConvertTableToPandas(PandasOptions options, const std::shared_ptr<Table>& table,
                             MemoryPool* pool, PyObject** out) {
   return ConvertTableToPandas(options, std::unordered_set<std::string>(), table, pool,
@@ -1882,21 +2226,26 @@ Status ConvertTableToPandas(PandasOptions options,
                             const std::unordered_set<std::string>& categorical_columns,
                             const std::shared_ptr<Table>& table, MemoryPool* pool,
                             PyObject** out) {
+  // The categorical columns of the table, and the columns to encode
+  std::vector<int> column_indices;
+  std::vector<std::shared_ptr<Column>> columns;
+  for (int i = 0; i < table->num_columns(); i++) {
+    const auto& col = table->column(i);
+    const Type::type type_id = col->type()->id();
+    if (type_id == Type::DICTIONARY || categorical_columns.count(col->name()) ||
+        (options.strings_to_categorical &&
+         (type_id == Type::STRING || type_id == Type::BINARY))) {
+      column_indices.push_back(i);
+      columns.push_back(col);
+    }
+  }
+  RETURN_NOT_OK(MakeCategoricalColumns(options, pool, &columns));
+
   std::shared_ptr<Table> current_table = table;
-  if (!categorical_columns.empty()) {
-    FunctionContext ctx;
-    for (int i = 0; i < table->num_columns(); i++) {
-      const Column& col = *table->column(i);
-      if (categorical_columns.count(col.name())) {
-        Datum out;
-        RETURN_NOT_OK(DictionaryEncode(&ctx, Datum(col.data()), &out));
-        std::shared_ptr<ChunkedArray> array = out.chunked_array();
-        auto field = std::make_shared<Field>(
-            col.name(), array->type(), col.field()->nullable(), col.field()->metadata());
-        auto column = std::make_shared<Column>(field, array);
-        RETURN_NOT_OK(current_table->RemoveColumn(i, &current_table));
-        RETURN_NOT_OK(current_table->AddColumn(i, column, &current_table));
-      }
+  for (size_t i = 0; i < columns.size(); ++i) {
+    if (columns[i] != table->column(column_indices[i])) {
+      RETURN_NOT_OK(
+          current_table->SetColumn(column_indices[i], columns[i], &current_table));
     }
   }
 
@@ -47,12 +47,16 @@ struct PandasOptions {
   bool zero_copy_only;
   bool integer_object_nulls;
   bool use_threads;
+  /// If true, the repeated values of string and binary columns converted
+  /// to objects share a single Python object
+  bool deduplicate_objects;
 
   PandasOptions()
       : strings_to_categorical(false),
         zero_copy_only(false),
         integer_object_nulls(false),
-        use_threads(false) {}
+        use_threads(false),
+        deduplicate_objects(false) {}
 };
 
 ARROW_EXPORT
@@ -68,6 +72,18 @@ ARROW_EXPORT
 Status ConvertColumnToPandas(PandasOptions options, const std::shared_ptr<Column>& col,
                              PyObject* py_ref, PyObject** out);
 
+/// \brief Convert an integer or floating point array with nulls to NumPy
+/// without copying its values, which are viewed as they are in the null slots
+///
+/// \param[in] arr the array
+/// \param[in] py_ref the Python object owning the array, kept alive by the
+/// view of its values, may be null
+/// \param[out] out_values a read-only ndarray viewing the values
+/// \param[out] out_mask a new boolean ndarray, true where the values are null
+ARROW_EXPORT
+Status ConvertArrayToNumPyMasked(const std::shared_ptr<Array>& arr, PyObject* py_ref,
+                                 PyObject** out_values, PyObject** out_mask);
+
 // Convert a whole table as efficiently as possible to a pandas.DataFrame.
 //
 // The returned Python object is a list of tuples consisting of the exact 2D
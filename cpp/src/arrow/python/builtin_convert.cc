@@ -20,6 +20,7 @@
 #include <datetime.h>
 
 #include <algorithm>
+#include <cmath>
 #include <limits>
 #include <map>
 #include <sstream>
@@ -908,6 +909,155 @@ Status AppendPySequence(PyObject* obj, int64_t size,
   return converter->AppendMultiple(obj, size);
 }
 
+// ----------------------------------------------------------------------
+// Single-pass conversion of lists and tuples of builtin objects
+//
+// A list of ints, floats or bytes is converted as the type of its first
+// non-null element, reading the objects directly, without inferring the type
+// over the whole sequence first. On any element of another type, the
+// conversion is given up and the sequence converted in two passes, so the
+// type and the conversion are those of the inference.
+
+enum class SpeculativeType { NONE, INT64, DOUBLE, BINARY };
+
+static bool IsPyIntegerExact(PyObject* obj) {
+#if PYARROW_IS_PY2
+  return PyLong_CheckExact(obj) || PyInt_CheckExact(obj);
+#else
+  return PyLong_CheckExact(obj);
+#endif
+}
+
+static SpeculativeType GetSpeculativeType(PyObject* seq, int64_t size) {
+  for (int64_t i = 0; i < size; ++i) {
+    PyObject* obj = PySequence_Fast_GET_ITEM(seq, i);
+    if (obj == Py_None) {
+      continue;
+    }
+    if (IsPyIntegerExact(obj)) {
+      return SpeculativeType::INT64;
+    } else if (PyFloat_CheckExact(obj)) {
+      // A NaN is inferred as a null, so may be in a list of ints
+      return std::isnan(PyFloat_AS_DOUBLE(obj)) ? SpeculativeType::NONE
+                                                : SpeculativeType::DOUBLE;
+    } else if (PyBytes_CheckExact(obj)) {
+      return SpeculativeType::BINARY;
+    }
+    return SpeculativeType::NONE;
+  }
+  return SpeculativeType::NONE;
+}
+
+static Status AppendPyIntegersExact(PyObject* seq, int64_t size, Int64Builder* builder,
+                                    bool* mismatch) {
+  RETURN_NOT_OK(builder->Reserve(size));
+  for (int64_t i = 0; i < size; ++i) {
+    PyObject* obj = PySequence_Fast_GET_ITEM(seq, i);
+    if (obj == Py_None) {
+      builder->UnsafeAppendToBitmap(false);
+      continue;
+    }
+#if PYARROW_IS_PY2
+    if (PyInt_CheckExact(obj)) {
+      builder->UnsafeAppend(static_cast<int64_t>(PyInt_AS_LONG(obj)));
+      continue;
+    }
+#endif
+    if (!PyLong_CheckExact(obj)) {
+      *mismatch = true;
+      return Status::OK();
+    }
+    int overflow = 0;
+    const auto value = PyLong_AsLongLongAndOverflow(obj, &overflow);
+    if (overflow) {
+      // The inferred conversion raises the overflow
+      *mismatch = true;
+      return Status::OK();
+    }
+    builder->UnsafeAppend(static_cast<int64_t>(value));
+  }
+  return Status::OK();
+}
+
+static Status AppendPyFloatsExact(PyObject* seq, int64_t size, bool from_pandas,
+                                  DoubleBuilder* builder, bool* mismatch) {
+  RETURN_NOT_OK(builder->Reserve(size));
+  for (int64_t i = 0; i < size; ++i) {
+    PyObject* obj = PySequence_Fast_GET_ITEM(seq, i);
+    if (obj == Py_None) {
+      builder->UnsafeAppendToBitmap(false);
+    } else if (PyFloat_CheckExact(obj)) {
+      const double value = PyFloat_AS_DOUBLE(obj);
+      if (from_pandas && std::isnan(value)) {
+        builder->UnsafeAppendToBitmap(false);
+      } else {
+        builder->UnsafeAppend(value);
+      }
+    } else if (IsPyIntegerExact(obj)) {
+      // Ints are inferred as floats along with floats
+      const double value = PyFloat_AsDouble(obj);
+      RETURN_IF_PYERROR();
+      builder->UnsafeAppend(value);
+    } else {
+      *mismatch = true;
+      return Status::OK();
+    }
+  }
+  return Status::OK();
+}
+
+static Status AppendPyBytesExact(PyObject* seq, int64_t size, BinaryBuilder* builder,
+                                 bool* mismatch) {
+  RETURN_NOT_OK(builder->Reserve(size));
+  for (int64_t i = 0; i < size; ++i) {
+    PyObject* obj = PySequence_Fast_GET_ITEM(seq, i);
+    if (obj == Py_None) {
+      RETURN_NOT_OK(builder->AppendNull());
+      continue;
+    }
+    if (!PyBytes_CheckExact(obj)) {
+      *mismatch = true;
+      return Status::OK();
+    }
+    const int64_t length = static_cast<int64_t>(PyBytes_GET_SIZE(obj));
+    if (ARROW_PREDICT_FALSE(builder->value_data_length() + length > kBinaryMemoryLimit)) {
+      return Status::CapacityError("Maximum array size reached (2GB)");
+    }
+    RETURN_NOT_OK(builder->Append(PyBytes_AS_STRING(obj), static_cast<int32_t>(length)));
+  }
+  return Status::OK();
+}
+
+// Convert a list or tuple in a single pass if possible, or else set *out to null
+static Status ConvertPySequenceSpeculative(PyObject* seq, int64_t size,
+                                           MemoryPool* pool, bool from_pandas,
+                                           std::shared_ptr<Array>* out) {
+  out->reset();
+  if (!(PyList_Check(seq) || PyTuple_Check(seq))) {
+    return Status::OK();
+  }
+  bool mismatch = false;
+  switch (GetSpeculativeType(seq, size)) {
+    case SpeculativeType::INT64: {
+      Int64Builder builder(pool);
+      RETURN_NOT_OK(AppendPyIntegersExact(seq, size, &builder, &mismatch));
+      return mismatch ? Status::OK() : builder.Finish(out);
+    }
+    case SpeculativeType::DOUBLE: {
+      DoubleBuilder builder(pool);
+      RETURN_NOT_OK(AppendPyFloatsExact(seq, size, from_pandas, &builder, &mismatch));
+      return mismatch ? Status::OK() : builder.Finish(out);
+    }
+    case SpeculativeType::BINARY: {
+      BinaryBuilder builder(pool);
+      RETURN_NOT_OK(AppendPyBytesExact(seq, size, &builder, &mismatch));
+      return mismatch ? Status::OK() : builder.Finish(out);
+    }
+    default:
+      return Status::OK();
+  }
+}
+
 static Status ConvertPySequenceReal(PyObject* obj, int64_t size,
                                     const std::shared_ptr<DataType>* type,
                                     MemoryPool* pool, bool from_pandas,
@@ -922,6 +1072,10 @@ static Status ConvertPySequenceReal(PyObject* obj, int64_t size,
   RETURN_NOT_OK(ConvertToSequenceAndInferSize(obj, &seq, &size));
   tmp_seq_nanny.reset(seq);
   if (type == nullptr) {
+    RETURN_NOT_OK(ConvertPySequenceSpeculative(seq, size, pool, from_pandas, out));
+    if (*out != nullptr) {
+      return Status::OK();
+    }
     RETURN_NOT_OK(InferArrowType(seq, &real_type));
   } else {
     real_type = *type;
@@ -17,12 +17,15 @@
 
 #include "arrow/python/io.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <memory>
 #include <mutex>
 #include <string>
 
+#include "arrow/buffer.h"
 #include "arrow/io/memory.h"
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
@@ -115,47 +118,146 @@ class PythonFile {
 // ----------------------------------------------------------------------
 // Seekable input stream
 
-PyReadableFile::PyReadableFile(PyObject* file) { file_.reset(new PythonFile(file)); }
+// The size of the blocks read ahead from the Python file, and the least
+// reads are made in directly
+static constexpr int64_t kReadBufferSize = 1 << 16;
+
+PyReadableFile::PyReadableFile(PyObject* file) : read_buffer_offset_(0), position_(-1) {
+  file_.reset(new PythonFile(file));
+}
 
 PyReadableFile::~PyReadableFile() {}
 
 Status PyReadableFile::Close() {
+  read_buffer_.reset();
   PyAcquireGIL lock;
   return file_->Close();
 }
 
 Status PyReadableFile::Seek(int64_t position) {
+  if (read_buffer_ && position_ >= 0) {
+    // A seek within the read buffer
+    const int64_t buffer_start = position_ - read_buffer_offset_;
+    if (position >= buffer_start && position <= buffer_start + read_buffer_->size()) {
+      read_buffer_offset_ = position - buffer_start;
+      position_ = position;
+      return Status::OK();
+    }
+  }
+  read_buffer_.reset();
+  position_ = -1;
   PyAcquireGIL lock;
-  return file_->Seek(position, 0);
+  RETURN_NOT_OK(file_->Seek(position, 0));
+  position_ = position;
+  return Status::OK();
 }
 
 Status PyReadableFile::Tell(int64_t* position) const {
-  PyAcquireGIL lock;
-  return file_->Tell(position);
+  if (position_ < 0) {
+    PyAcquireGIL lock;
+    int64_t file_position;
+    RETURN_NOT_OK(file_->Tell(&file_position));
+    position_ = file_position - buffered();
+  }
+  *position = position_;
+  return Status::OK();
 }
 
-Status PyReadableFile::Read(int64_t nbytes, int64_t* bytes_read, void* out) {
+Status PyReadableFile::FillReadBuffer() {
+  DCHECK_EQ(buffered(), 0);
+  read_buffer_.reset();
+  read_buffer_offset_ = 0;
+
   PyAcquireGIL lock;
+  OwnedRef bytes_obj;
+  RETURN_NOT_OK(file_->Read(kReadBufferSize, bytes_obj.ref()));
+  DCHECK(bytes_obj.obj() != NULL);
+  return PyBuffer::FromPyObject(bytes_obj.obj(), &read_buffer_);
+}
 
-  PyObject* bytes_obj = NULL;
-  RETURN_NOT_OK(file_->Read(nbytes, &bytes_obj));
-  DCHECK(bytes_obj != NULL);
+int64_t PyReadableFile::ReadBuffered(int64_t nbytes, uint8_t* out) {
+  const int64_t nbytes_buffered = std::min(nbytes, buffered());
+  if (nbytes_buffered > 0) {
+    std::memcpy(out, read_buffer_->data() + read_buffer_offset_, nbytes_buffered);
+    read_buffer_offset_ += nbytes_buffered;
+    if (position_ >= 0) {
+      position_ += nbytes_buffered;
+    }
+  }
+  return nbytes_buffered;
+}
 
-  *bytes_read = PyBytes_GET_SIZE(bytes_obj);
-  std::memcpy(out, PyBytes_AS_STRING(bytes_obj), *bytes_read);
-  Py_XDECREF(bytes_obj);
+Status PyReadableFile::Read(int64_t nbytes, int64_t* bytes_read, void* out) {
+  auto out_data = reinterpret_cast<uint8_t*>(out);
+  int64_t total_read = ReadBuffered(nbytes, out_data);
+
+  while (total_read < nbytes) {
+    const int64_t nbytes_left = nbytes - total_read;
+    if (nbytes_left >= kReadBufferSize) {
+      // Large reads are made directly, without copying them to the buffer
+      PyAcquireGIL lock;
+
+      PyObject* bytes_obj = NULL;
+      RETURN_NOT_OK(file_->Read(nbytes_left, &bytes_obj));
+      DCHECK(bytes_obj != NULL);
+
+      const int64_t nbytes_direct = PyBytes_GET_SIZE(bytes_obj);
+      std::memcpy(out_data + total_read, PyBytes_AS_STRING(bytes_obj), nbytes_direct);
+      Py_XDECREF(bytes_obj);
+      if (position_ >= 0) {
+        position_ += nbytes_direct;
+      }
+      total_read += nbytes_direct;
+      break;
+    }
+    RETURN_NOT_OK(FillReadBuffer());
+    const int64_t nbytes_buffered = ReadBuffered(nbytes_left, out_data + total_read);
+    if (nbytes_buffered == 0) {
+      // End of file
+      break;
+    }
+    total_read += nbytes_buffered;
+  }
 
+  *bytes_read = total_read;
   return Status::OK();
 }
 
 Status PyReadableFile::Read(int64_t nbytes, std::shared_ptr<Buffer>* out) {
-  PyAcquireGIL lock;
+  if (buffered() == 0 && nbytes >= kReadBufferSize) {
+    PyAcquireGIL lock;
 
-  OwnedRef bytes_obj;
-  RETURN_NOT_OK(file_->Read(nbytes, bytes_obj.ref()));
-  DCHECK(bytes_obj.obj() != NULL);
+    OwnedRef bytes_obj;
+    RETURN_NOT_OK(file_->Read(nbytes, bytes_obj.ref()));
+    DCHECK(bytes_obj.obj() != NULL);
+
+    RETURN_NOT_OK(PyBuffer::FromPyObject(bytes_obj.obj(), out));
+    if (position_ >= 0) {
+      position_ += (*out)->size();
+    }
+    return Status::OK();
+  }
 
-  return PyBuffer::FromPyObject(bytes_obj.obj(), out);
+  if (buffered() == 0) {
+    RETURN_NOT_OK(FillReadBuffer());
+  }
+  if (buffered() >= nbytes || buffered() == 0) {
+    // A slice of the read buffer, which is empty at the end of the file
+    *out = SliceBuffer(read_buffer_, read_buffer_offset_, std::min(nbytes, buffered()));
+    read_buffer_offset_ += (*out)->size();
+    if (position_ >= 0) {
+      position_ += (*out)->size();
+    }
+    return Status::OK();
+  }
+
+  std::shared_ptr<ResizableBuffer> buffer;
+  RETURN_NOT_OK(AllocateResizableBuffer(get_memory_pool(), nbytes, &buffer));
+  int64_t bytes_read = 0;
+  RETURN_NOT_OK(Read(nbytes, &bytes_read, buffer->mutable_data()));
+  RETURN_NOT_OK(buffer->Resize(bytes_read));
+  *out = buffer;
+  return Status::OK();
 }
 
 Status PyReadableFile::ReadAt(int64_t position, int64_t nbytes, int64_t* bytes_read,
@@ -173,6 +275,7 @@ Status PyReadableFile::ReadAt(int64_t position, int64_t nbytes,
 }
 
 Status PyReadableFile::GetSize(int64_t* size) {
+  // The Python file is restored to its own position, ahead of this file
   PyAcquireGIL lock;
 
   int64_t current_position = -1;
@@ -36,6 +36,10 @@ namespace py {
 
 class ARROW_NO_EXPORT PythonFile;
 
+// A file reading from a Python file-like object. The small reads, such as the
+// IPC readers make for metadata, are served from a block read ahead from the
+// file, without taking the GIL, and the seeks within it don't call Python.
+// The Python file is thus positioned ahead of this file.
 class ARROW_EXPORT PyReadableFile : public io::RandomAccessFile {
  public:
   explicit PyReadableFile(PyObject* file);
@@ -62,7 +66,23 @@ class ARROW_EXPORT PyReadableFile : public io::RandomAccessFile {
   bool supports_zero_copy() const override;
 
  private:
+  // The bytes read ahead that were not read yet
+  int64_t buffered() const {
+    return read_buffer_ ? read_buffer_->size() - read_buffer_offset_ : 0;
+  }
+
+  // Read a block from the Python file into the read buffer
+  Status FillReadBuffer();
+
+  // Copy up to nbytes from the read buffer, returning how many
+  int64_t ReadBuffered(int64_t nbytes, uint8_t* out);
+
   std::unique_ptr<PythonFile> file_;
+  std::shared_ptr<Buffer> read_buffer_;
+  int64_t read_buffer_offset_;
+  // The position of this file, or -1 until known, as it is only known from
+  // the Python file once it was told or sought
+  mutable int64_t position_;
 };
 
 class ARROW_EXPORT PyOutputStream : public io::OutputStream {
@@ -27,6 +27,7 @@
 #include <cstdint>
 #include <limits>
 #include <memory>
+#include <numeric>
 #include <sstream>
 #include <string>
 #include <utility>
@@ -42,6 +43,7 @@
 #include "arrow/util/decimal.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/parallel.h"
 #include "arrow/visitor_inline.h"
 
 #include "arrow/compute/context.h"
@@ -70,6 +72,13 @@ namespace {
 
 constexpr int64_t kMillisecondsInDay = 86400000;
 
+// The number of values of each task of the parallel bitmap scans, a multiple
+// of 8 so that the tasks write distinct bytes of the bitmap
+constexpr int64_t kScanTaskLength = 1 << 20;
+
+// The largest chunk converted from an ndarray whose values need copying
+constexpr int64_t kMaxNativeChunkLength = 1 << 26;
+
 inline bool PyObject_is_integer(PyObject* obj) {
   return !PyBool_Check(obj) && PyArray_IsIntegerScalar(obj);
 }
@@ -102,19 +111,45 @@ Status AllocateNullBitmap(MemoryPool* pool, int64_t length,
   return Status::OK();
 }
 
+// Fill the bitmap of `length` values with calls to `scan(offset, length,
+// bitmap)`, each setting the bits of the values [offset, offset + length)
+// from the first bit of the bitmap it is given. Large inputs are split into
+// ranges scanned on the CPU thread pool. The sum of the counts the scans
+// return is stored in `out_count`.
+template <typename ScanFunction>
+Status ScanToBitmap(int64_t length, uint8_t* bitmap, ScanFunction&& scan,
+                    int64_t* out_count) {
+  if (length <= kScanTaskLength) {
+    *out_count = scan(0, length, bitmap);
+    return Status::OK();
+  }
+  const int num_tasks =
+      static_cast<int>((length + kScanTaskLength - 1) / kScanTaskLength);
+  std::vector<int64_t> counts(num_tasks, 0);
+  RETURN_NOT_OK(ParallelFor(num_tasks, [&](int i) {
+    const int64_t offset = i * kScanTaskLength;
+    counts[i] = scan(offset, std::min(kScanTaskLength, length - offset),
+                     bitmap + offset / 8);
+    return Status::OK();
+  }));
+  *out_count = std::accumulate(counts.begin(), counts.end(), static_cast<int64_t>(0));
+  return Status::OK();
+}
+
 // ----------------------------------------------------------------------
 // Conversion from NumPy-in-Pandas to Arrow null bitmap
 
+// Returns null count
 template <int TYPE>
-inline int64_t ValuesToBitmap(PyArrayObject* arr, uint8_t* bitmap) {
+inline int64_t ValuesToBitmap(
+    const Ndarray1DIndexer<typename internal::npy_traits<TYPE>::value_type>& values,
+    int64_t offset, int64_t length, uint8_t* bitmap) {
   typedef internal::npy_traits<TYPE> traits;
-  typedef typename traits::value_type T;
 
   int64_t null_count = 0;
 
-  Ndarray1DIndexer<T> values(arr);
-  for (int i = 0; i < values.size(); ++i) {
-    if (traits::isnull(values[i])) {
+  for (int64_t i = 0; i < length; ++i) {
+    if (traits::isnull(values[offset + i])) {
       ++null_count;
     } else {
       BitUtil::SetBit(bitmap, i);
@@ -150,8 +185,16 @@ class NumPyNullsConverter {
         (use_pandas_null_sentinels_ && traits::supports_nulls);
 
     if (null_sentinels_possible) {
-      RETURN_NOT_OK(AllocateNullBitmap(pool_, PyArray_SIZE(arr), &null_bitmap_));
-      null_count_ = ValuesToBitmap<TYPE>(arr, null_bitmap_->mutable_data());
+      const int64_t length = PyArray_SIZE(arr);
+      RETURN_NOT_OK(AllocateNullBitmap(pool_, length, &null_bitmap_));
+      // The indexer is shared by the scans, as it holds a reference to the
+      // ndarray, which the threads of the pool cannot take without the GIL
+      Ndarray1DIndexer<typename traits::value_type> values(arr);
+      auto scan = [&values](int64_t offset, int64_t length, uint8_t* bitmap) {
+        return ValuesToBitmap<TYPE>(values, offset, length, bitmap);
+      };
+      RETURN_NOT_OK(
+          ScanToBitmap(length, null_bitmap_->mutable_data(), scan, &null_count_));
     }
     return Status::OK();
   }
@@ -174,12 +217,12 @@ class NumPyNullsConverter {
 };
 
 // Returns null count
-int64_t MaskToBitmap(PyArrayObject* mask, int64_t length, uint8_t* bitmap) {
+int64_t MaskRangeToBitmap(const Ndarray1DIndexer<uint8_t>& mask_values, int64_t offset,
+                          int64_t length, uint8_t* bitmap) {
   int64_t null_count = 0;
 
-  Ndarray1DIndexer<uint8_t> mask_values(mask);
-  for (int i = 0; i < length; ++i) {
-    if (mask_values[i]) {
+  for (int64_t i = 0; i < length; ++i) {
+    if (mask_values[offset + i]) {
       ++null_count;
       BitUtil::ClearBit(bitmap, i);
     } else {
@@ -189,6 +232,15 @@ int64_t MaskToBitmap(PyArrayObject* mask, int64_t length, uint8_t* bitmap) {
   return null_count;
 }
 
+Status MaskToBitmap(PyArrayObject* mask, int64_t length, uint8_t* bitmap,
+                    int64_t* null_count) {
+  Ndarray1DIndexer<uint8_t> mask_values(mask);
+  auto scan = [&mask_values](int64_t offset, int64_t length, uint8_t* bitmap) {
+    return MaskRangeToBitmap(mask_values, offset, length, bitmap);
+  };
+  return ScanToBitmap(length, bitmap, scan, null_count);
+}
+
 }  // namespace
 
 /// Append as many string objects from NumPy arrays to a `BinaryBuilder` as we
@@ -369,6 +421,8 @@ class NumPyConverter {
 
   Status Visit(const FixedSizeBinaryType& type);
 
+  Status Visit(const LargeBinaryType& type) { return TypeNotImplemented(type.ToString()); }
+
   Status Visit(const Decimal128Type& type) { return TypeNotImplemented(type.ToString()); }
 
   Status Visit(const DictionaryType& type) { return TypeNotImplemented(type.ToString()); }
@@ -427,11 +481,58 @@ class NumPyConverter {
     return Status::OK();
   }
 
+  // Whether the values need copying, rather than wrapping the memory of the
+  // ndarray
+  template <typename ArrowType>
+  Status NeedsCopy(bool* out) {
+    std::shared_ptr<DataType> input_type;
+    RETURN_NOT_OK(NumPyDtypeToArrow(reinterpret_cast<PyObject*>(dtype_), &input_type));
+    *out = is_strided() || std::is_same<ArrowType, BooleanType>::value ||
+           !input_type->Equals(*type_);
+    return Status::OK();
+  }
+
+  // Convert a large ndarray whose values need copying by chunks, each from a
+  // view of the ndarray, rather than allocating all of the copy at once
+  template <typename ArrowType>
+  Status VisitNativeChunked() {
+    for (int64_t offset = 0; offset < length_; offset += kMaxNativeChunkLength) {
+      const int64_t end = std::min(offset + kMaxNativeChunkLength, length_);
+      OwnedRefNoGIL chunk_arr;
+      OwnedRefNoGIL chunk_mask;
+      {
+        PyAcquireGIL lock;
+        chunk_arr.reset(
+            PySequence_GetSlice(reinterpret_cast<PyObject*>(arr_), offset, end));
+        RETURN_IF_PYERROR();
+        if (mask_ != nullptr) {
+          chunk_mask.reset(
+              PySequence_GetSlice(reinterpret_cast<PyObject*>(mask_), offset, end));
+          RETURN_IF_PYERROR();
+        }
+      }
+      NumPyConverter converter(pool_, chunk_arr.obj(), chunk_mask.obj(), type_,
+                               use_pandas_null_sentinels_);
+      RETURN_NOT_OK(converter.VisitNative<ArrowType>());
+      out_arrays_.insert(out_arrays_.end(), converter.result().begin(),
+                         converter.result().end());
+    }
+    return Status::OK();
+  }
+
   template <typename ArrowType>
   Status VisitNative() {
+    if (length_ > kMaxNativeChunkLength) {
+      bool needs_copy = false;
+      RETURN_NOT_OK(NeedsCopy<ArrowType>(&needs_copy));
+      if (needs_copy) {
+        return VisitNativeChunked<ArrowType>();
+      }
+    }
+
     if (mask_ != nullptr) {
       RETURN_NOT_OK(InitNullBitmap());
-      null_count_ = MaskToBitmap(mask_, length_, null_bitmap_data_);
+      RETURN_NOT_OK(MaskToBitmap(mask_, length_, null_bitmap_data_, &null_count_));
     } else {
       RETURN_NOT_OK(NumPyNullsConverter::Convert(pool_, arr_, use_pandas_null_sentinels_,
                                                  &null_bitmap_, &null_count_));
@@ -625,16 +726,20 @@ inline Status NumPyConverter::ConvertData<BooleanType>(std::shared_ptr<Buffer>*
   std::shared_ptr<Buffer> buffer;
   RETURN_NOT_OK(AllocateBuffer(pool_, nbytes, &buffer));
 
-  Ndarray1DIndexer<uint8_t> values(arr_);
-
   uint8_t* bitmap = buffer->mutable_data();
-
   memset(bitmap, 0, nbytes);
-  for (int i = 0; i < length_; ++i) {
-    if (values[i] > 0) {
-      BitUtil::SetBit(bitmap, i);
+
+  Ndarray1DIndexer<uint8_t> values(arr_);
+  auto scan = [&values](int64_t offset, int64_t length, uint8_t* bitmap) {
+    for (int64_t i = 0; i < length; ++i) {
+      if (values[offset + i] > 0) {
+        BitUtil::SetBit(bitmap, i);
+      }
     }
-  }
+    return static_cast<int64_t>(0);
+  };
+  int64_t unused_count;
+  RETURN_NOT_OK(ScanToBitmap(length_, bitmap, scan, &unused_count));
 
   *data = buffer;
   return Status::OK();
@@ -1671,7 +1776,7 @@ Status NumPyConverter::Visit(const StructType& type) {
   {
     if (mask_ != nullptr) {
       RETURN_NOT_OK(InitNullBitmap());
-      null_count = MaskToBitmap(mask_, length_, null_bitmap_data_);
+      RETURN_NOT_OK(MaskToBitmap(mask_, length_, null_bitmap_data_, &null_count));
     }
     groups.push_back({std::make_shared<BooleanArray>(length_, null_bitmap_)});
   }
@@ -0,0 +1,346 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/python/platform.h"
+
+#include "benchmark/benchmark.h"
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/builder.h"
+#include "arrow/table.h"
+#include "arrow/test-util.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/thread-pool.h"
+
+#include "arrow/python/arrow_to_pandas.h"
+#include "arrow/python/arrow_to_python.h"
+#include "arrow/python/builtin_convert.h"
+#include "arrow/python/common.h"
+#include "arrow/python/numpy_interop.h"
+#include "arrow/python/numpy_to_arrow.h"
+#include "arrow/python/python_to_arrow.h"
+
+namespace arrow {
+namespace py {
+
+constexpr int64_t kLength = 1 << 20;
+constexpr int kNumColumns = 8;
+constexpr double kNullProbability = 0.1;
+
+// The main thread of the benchmarks runs without the GIL, so the Python
+// objects are made and released holding it, and the conversions are called
+// without it, as pyarrow calls them
+
+// ----------------------------------------------------------------------
+// Arrow to pandas
+
+static std::shared_ptr<Array> MakeArray(const std::shared_ptr<DataType>& type,
+                                        int64_t length, uint32_t seed) {
+  std::vector<bool> is_valid;
+  test::random_is_valid(length, kNullProbability, &is_valid);
+  std::shared_ptr<Array> out;
+  switch (type->id()) {
+    case Type::INT64: {
+      std::vector<int64_t> values;
+      test::randint(length, 0LL, 1LL << 40, &values);
+      ArrayFromVector<Int64Type, int64_t>(is_valid, values, &out);
+      break;
+    }
+    case Type::DOUBLE: {
+      std::vector<double> values;
+      test::random_real(length, seed, -1000.0, 1000.0, &values);
+      ArrayFromVector<DoubleType, double>(is_valid, values, &out);
+      break;
+    }
+    case Type::STRING: {
+      // Strings of a few digits, of which there are many repeats
+      std::vector<int64_t> ints;
+      test::randint(length, 0LL, 10000LL, &ints);
+      std::vector<std::string> values;
+      for (int64_t value : ints) {
+        values.push_back(std::to_string(value));
+      }
+      ArrayFromVector<StringType, std::string>(is_valid, values, &out);
+      break;
+    }
+    default:
+      DCHECK(false) << "No benchmark array of type " << type->ToString();
+  }
+  return out;
+}
+
+static std::shared_ptr<Table> MakeTable(const std::shared_ptr<DataType>& type) {
+  std::vector<std::shared_ptr<Field>> fields;
+  std::vector<std::shared_ptr<Array>> arrays;
+  for (int i = 0; i < kNumColumns; ++i) {
+    fields.push_back(field("f" + std::to_string(i), type));
+    arrays.push_back(MakeArray(type, kLength / kNumColumns, i));
+  }
+  return Table::Make(schema(fields), arrays);
+}
+
+static void BM_ConvertTableToPandas(
+    benchmark::State& state,  // NOLINT non-const reference
+    const std::shared_ptr<DataType>& type) {
+  const int nthreads = static_cast<int>(state.range(0));
+  const auto table = MakeTable(type);
+
+  PandasOptions options;
+  options.use_threads = nthreads > 1;
+  const int capacity = GetCpuThreadPoolCapacity();
+  ABORT_NOT_OK(SetCpuThreadPoolCapacity(nthreads));
+
+  while (state.KeepRunning()) {
+    PyObject* out;
+    ABORT_NOT_OK(ConvertTableToPandas(options, table, default_memory_pool(), &out));
+    PyAcquireGIL lock;
+    Py_DECREF(out);
+  }
+  ABORT_NOT_OK(SetCpuThreadPoolCapacity(capacity));
+  state.SetItemsProcessed(state.iterations() * kLength);
+}
+
+BENCHMARK_CAPTURE(BM_ConvertTableToPandas, int64, int64())
+    ->Arg(1)
+    ->Arg(4)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+
+BENCHMARK_CAPTURE(BM_ConvertTableToPandas, double, float64())
+    ->Arg(1)
+    ->Arg(4)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+
+BENCHMARK_CAPTURE(BM_ConvertTableToPandas, string, utf8())
+    ->Arg(1)
+    ->Arg(4)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+
+// ----------------------------------------------------------------------
+// NumPy to Arrow
+
+static void BM_NdarrayToArrowDouble(
+    benchmark::State& state) {  // NOLINT non-const reference
+  OwnedRefNoGIL ndarray;
+  {
+    PyAcquireGIL lock;
+    npy_intp dims[1] = {kLength};
+    ndarray.reset(PyArray_SimpleNew(1, dims, NPY_FLOAT64));
+    DCHECK(ndarray.obj() != nullptr);
+    std::vector<double> values;
+    test::random_real(kLength, 0, -1000.0, 1000.0, &values);
+    std::vector<bool> is_valid;
+    test::random_is_valid(kLength, kNullProbability, &is_valid);
+    auto data = reinterpret_cast<double*>(
+        PyArray_DATA(reinterpret_cast<PyArrayObject*>(ndarray.obj())));
+    for (int64_t i = 0; i < kLength; ++i) {
+      data[i] = is_valid[i] ? values[i] : NAN;
+    }
+  }
+
+  while (state.KeepRunning()) {
+    std::shared_ptr<ChunkedArray> out;
+    ABORT_NOT_OK(NdarrayToArrow(default_memory_pool(), ndarray.obj(), Py_None,
+                                true /* use_pandas_null_sentinels */, float64(), &out));
+  }
+  state.SetBytesProcessed(state.iterations() * kLength * sizeof(double));
+}
+
+static void BM_NdarrayToArrowString(
+    benchmark::State& state) {  // NOLINT non-const reference
+  OwnedRefNoGIL ndarray;
+  {
+    PyAcquireGIL lock;
+    OwnedRef list(PyList_New(kLength));
+    for (int64_t i = 0; i < kLength; ++i) {
+      PyObject* value =
+          (i % 10 == 0) ? Py_None : PyUnicode_FromString(std::to_string(i).c_str());
+      if (value == Py_None) {
+        Py_INCREF(value);
+      }
+      PyList_SET_ITEM(list.obj(), i, value);
+    }
+    ndarray.reset(PyArray_FromAny(list.obj(), PyArray_DescrFromType(NPY_OBJECT), 1, 1,
+                                  NPY_ARRAY_DEFAULT, nullptr));
+    DCHECK(ndarray.obj() != nullptr);
+  }
+
+  while (state.KeepRunning()) {
+    std::shared_ptr<ChunkedArray> out;
+    ABORT_NOT_OK(NdarrayToArrow(default_memory_pool(), ndarray.obj(), Py_None,
+                                true /* use_pandas_null_sentinels */, utf8(), &out));
+  }
+  state.SetItemsProcessed(state.iterations() * kLength);
+}
+
+BENCHMARK(BM_NdarrayToArrowDouble)->Unit(benchmark::kMicrosecond)->UseRealTime();
+BENCHMARK(BM_NdarrayToArrowString)->Unit(benchmark::kMicrosecond)->UseRealTime();
+
+// ----------------------------------------------------------------------
+// Python sequences to Arrow
+
+enum class SequenceType { INT, FLOAT, STRING };
+
+static PyObject* MakeSequenceItem(SequenceType type, int64_t i) {
+  if (i % 10 == 0) {
+    Py_INCREF(Py_None);
+    return Py_None;
+  }
+  switch (type) {
+    case SequenceType::INT:
+      return PyLong_FromLongLong(i);
+    case SequenceType::FLOAT:
+      return PyFloat_FromDouble(static_cast<double>(i) / 3);
+    default:
+      return PyUnicode_FromString(std::to_string(i % 10000).c_str());
+  }
+}
+
+static void BM_ConvertPySequence(
+    benchmark::State& state,  // NOLINT non-const reference
+    SequenceType sequence_type, const std::shared_ptr<DataType>& type) {
+  // Whether to infer the type of the sequence
+  const bool infer_type = state.range(0) != 0;
+  OwnedRefNoGIL list;
+  {
+    PyAcquireGIL lock;
+    list.reset(PyList_New(kLength));
+    for (int64_t i = 0; i < kLength; ++i) {
+      PyList_SET_ITEM(list.obj(), i, MakeSequenceItem(sequence_type, i));
+    }
+  }
+
+  while (state.KeepRunning()) {
+    std::shared_ptr<Array> out;
+    if (infer_type) {
+      ABORT_NOT_OK(ConvertPySequence(list.obj(), default_memory_pool(), true, &out));
+    } else {
+      ABORT_NOT_OK(
+          ConvertPySequence(list.obj(), type, default_memory_pool(), true, &out));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kLength);
+}
+
+BENCHMARK_CAPTURE(BM_ConvertPySequence, int, SequenceType::INT, int64())
+    ->Arg(0)
+    ->Arg(1)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+
+BENCHMARK_CAPTURE(BM_ConvertPySequence, float, SequenceType::FLOAT, float64())
+    ->Arg(0)
+    ->Arg(1)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+
+BENCHMARK_CAPTURE(BM_ConvertPySequence, string, SequenceType::STRING, utf8())
+    ->Arg(0)
+    ->Arg(1)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+
+// ----------------------------------------------------------------------
+// Serialization
+
+constexpr int64_t kNumRecords = 1 << 14;
+
+// A list of records and of a large ndarray, wrapped in a list as pyarrow
+// serializes it
+static PyObject* MakeSerializationObject() {
+  PyObject* records = PyList_New(kNumRecords);
+  for (int64_t i = 0; i < kNumRecords; ++i) {
+    PyObject* record = PyDict_New();
+    OwnedRef int_value(PyLong_FromLongLong(i));
+    OwnedRef float_value(PyFloat_FromDouble(static_cast<double>(i) / 3));
+    OwnedRef string_value(PyUnicode_FromString(std::to_string(i).c_str()));
+    PyDict_SetItemString(record, "int", int_value.obj());
+    PyDict_SetItemString(record, "float", float_value.obj());
+    PyDict_SetItemString(record, "string", string_value.obj());
+    PyList_SET_ITEM(records, i, record);
+  }
+  npy_intp dims[1] = {kLength};
+  PyObject* ndarray = PyArray_ZEROS(1, dims, NPY_FLOAT64, 0);
+
+  PyObject* value = PyList_New(2);
+  PyList_SET_ITEM(value, 0, records);
+  PyList_SET_ITEM(value, 1, ndarray);
+  PyObject* wrapped_value = PyList_New(1);
+  PyList_SET_ITEM(wrapped_value, 0, value);
+  return wrapped_value;
+}
+
+static void BM_SerializeObject(
+    benchmark::State& state) {  // NOLINT non-const reference
+  OwnedRefNoGIL value;
+  {
+    PyAcquireGIL lock;
+    value.reset(MakeSerializationObject());
+  }
+
+  while (state.KeepRunning()) {
+    SerializedPyObject serialized;
+    ABORT_NOT_OK(SerializeObject(Py_None, value.obj(), &serialized));
+    PyAcquireGIL lock;
+    serialized.batch.reset();
+    serialized.tensors.clear();
+    serialized.buffers.clear();
+  }
+  state.SetItemsProcessed(state.iterations() * kNumRecords);
+}
+
+static void BM_DeserializeObject(
+    benchmark::State& state) {  // NOLINT non-const reference
+  SerializedPyObject serialized;
+  {
+    OwnedRefNoGIL value;
+    {
+      PyAcquireGIL lock;
+      value.reset(MakeSerializationObject());
+    }
+    ABORT_NOT_OK(SerializeObject(Py_None, value.obj(), &serialized));
+  }
+
+  while (state.KeepRunning()) {
+    PyObject* out;
+    ABORT_NOT_OK(DeserializeObject(Py_None, serialized, Py_None, &out));
+    PyAcquireGIL lock;
+    Py_DECREF(out);
+  }
+  {
+    PyAcquireGIL lock;
+    serialized.batch.reset();
+    serialized.tensors.clear();
+    serialized.buffers.clear();
+  }
+  state.SetItemsProcessed(state.iterations() * kNumRecords);
+}
+
+BENCHMARK(BM_SerializeObject)->Unit(benchmark::kMicrosecond)->UseRealTime();
+BENCHMARK(BM_DeserializeObject)->Unit(benchmark::kMicrosecond)->UseRealTime();
+
+}  // namespace py
+}  // namespace arrow
@@ -19,6 +19,7 @@
 #include "arrow/python/numpy_interop.h"
 
 #include <cstdint>
+#include <cstring>
 #include <limits>
 #include <memory>
 #include <sstream>
@@ -36,7 +37,9 @@
 #include "arrow/memory_pool.h"
 #include "arrow/record_batch.h"
 #include "arrow/tensor.h"
+#include "arrow/util/bit-util.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
 
 #include "arrow/python/common.h"
 #include "arrow/python/helpers.h"
@@ -740,14 +743,42 @@ Status WriteTensorHeader(std::shared_ptr<DataType> dtype,
   return serialized_tensor.WriteTo(dst);
 }
 
-Status SerializedPyObject::WriteTo(io::OutputStream* dst) {
-  int32_t num_tensors = static_cast<int32_t>(this->tensors.size());
-  int32_t num_buffers = static_cast<int32_t>(this->buffers.size());
+namespace {
+
+// Write the counts of tensors and buffers and the record batch, which precede
+// the tensors and buffers
+Status WriteSerializedHeader(const SerializedPyObject& obj, io::OutputStream* dst) {
+  int32_t num_tensors = static_cast<int32_t>(obj.tensors.size());
+  int32_t num_buffers = static_cast<int32_t>(obj.buffers.size());
   RETURN_NOT_OK(
       dst->Write(reinterpret_cast<const uint8_t*>(&num_tensors), sizeof(int32_t)));
   RETURN_NOT_OK(
       dst->Write(reinterpret_cast<const uint8_t*>(&num_buffers), sizeof(int32_t)));
-  RETURN_NOT_OK(ipc::WriteRecordBatchStream({this->batch}, dst));
+  return ipc::WriteRecordBatchStream({obj.batch}, dst);
+}
+
+Status WriteSerializedBuffer(const Buffer& buffer, io::OutputStream* dst) {
+  int64_t size = buffer.size();
+  RETURN_NOT_OK(dst->Write(reinterpret_cast<const uint8_t*>(&size), sizeof(int64_t)));
+  return dst->Write(buffer.data(), size);
+}
+
+// The tensors and buffers larger than this are copied one at a time by
+// BulkMemcopy, which uses as many threads as the copy benefits from
+constexpr int64_t kBulkComponentSize = 1 << 20;
+
+// A tensor or buffer of a serialized object, and the range it is written to
+struct SerializedComponent {
+  const Tensor* tensor;
+  const Buffer* buffer;
+  int64_t offset;
+  int64_t size;
+};
+
+}  // namespace
+
+Status SerializedPyObject::WriteTo(io::OutputStream* dst) {
+  RETURN_NOT_OK(WriteSerializedHeader(*this, dst));
 
   int32_t metadata_length;
   int64_t body_length;
@@ -756,14 +787,75 @@ Status SerializedPyObject::WriteTo(io::OutputStream* dst) {
   }
 
   for (const auto& buffer : this->buffers) {
-    int64_t size = buffer->size();
-    RETURN_NOT_OK(dst->Write(reinterpret_cast<const uint8_t*>(&size), sizeof(int64_t)));
-    RETURN_NOT_OK(dst->Write(buffer->data(), size));
+    RETURN_NOT_OK(WriteSerializedBuffer(*buffer, dst));
   }
 
   return Status::OK();
 }
 
+Status SerializedPyObject::WriteToBuffer(const std::shared_ptr<Buffer>& dst) {
+  // The writer does not check its bounds
+  io::MockOutputStream header_size;
+  RETURN_NOT_OK(WriteSerializedHeader(*this, &header_size));
+  int64_t position = header_size.GetExtentBytesWritten();
+  if (position > dst->size()) {
+    return Status::Invalid("Buffer too small for the serialized object");
+  }
+  io::FixedSizeBufferWriter header_stream(dst);
+  RETURN_NOT_OK(WriteSerializedHeader(*this, &header_stream));
+
+  // Lay the tensors and buffers out where WriteTo writes them, the tensors
+  // being aligned to 8 bytes
+  std::vector<SerializedComponent> components;
+  for (const auto& tensor : this->tensors) {
+    const int64_t offset = BitUtil::RoundUpToMultipleOf8(position);
+    int64_t size;
+    RETURN_NOT_OK(ipc::GetTensorSize(*tensor, &size));
+    if (offset + size > dst->size()) {
+      return Status::Invalid("Buffer too small for the serialized object");
+    }
+    // The padding WriteTo would write
+    memset(dst->mutable_data() + position, 0, static_cast<size_t>(offset - position));
+    components.push_back({tensor.get(), nullptr, offset, size});
+    position = offset + size;
+  }
+  for (const auto& buffer : this->buffers) {
+    const int64_t size = static_cast<int64_t>(sizeof(int64_t)) + buffer->size();
+    components.push_back({nullptr, buffer.get(), position, size});
+    position += size;
+  }
+  if (position > dst->size()) {
+    return Status::Invalid("Buffer too small for the serialized object");
+  }
+
+  auto WriteComponent = [&dst](const SerializedComponent& component) {
+    io::FixedSizeBufferWriter stream(
+        SliceMutableBuffer(dst, component.offset, component.size));
+    if (component.size <= kBulkComponentSize) {
+      // Copied on a thread of the pool already
+      stream.set_memcopy_threads(1);
+    }
+    if (component.tensor != nullptr) {
+      int32_t metadata_length;
+      int64_t body_length;
+      return ipc::WriteTensor(*component.tensor, &stream, &metadata_length,
+                              &body_length);
+    }
+    return WriteSerializedBuffer(*component.buffer, &stream);
+  };
+
+  std::vector<const SerializedComponent*> small_components;
+  for (const auto& component : components) {
+    if (component.size <= kBulkComponentSize) {
+      small_components.push_back(&component);
+    } else {
+      RETURN_NOT_OK(WriteComponent(component));
+    }
+  }
+  return ParallelFor(static_cast<int>(small_components.size()),
+                     [&](int i) { return WriteComponent(*small_components[i]); });
+}
+
 Status SerializedPyObject::GetComponents(MemoryPool* memory_pool, PyObject** out) {
   PyAcquireGIL py_gil;
 
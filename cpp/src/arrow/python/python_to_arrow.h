@@ -57,6 +57,18 @@ struct ARROW_EXPORT SerializedPyObject {
   /// \return Status
   Status WriteTo(io::OutputStream* dst);
 
+  /// \brief Write serialized Python object to a buffer, as WriteTo would,
+  /// copying the tensors and buffers in parallel
+  ///
+  /// The tensors and buffers larger than a megabyte are copied one at a time
+  /// with all of the memory bandwidth, and the smaller ones on the threads of
+  /// the CPU thread pool.
+  ///
+  /// \param[in] dst a mutable buffer of at least the size WriteTo writes, as
+  /// counted by an io::MockOutputStream
+  /// \return Status
+  Status WriteToBuffer(const std::shared_ptr<Buffer>& dst);
+
   /// \brief Convert SerializedPyObject to a dict containing the message
   /// components as Buffer instances with minimal memory allocation
   ///
@@ -27,6 +27,7 @@
 #include "arrow/array.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
+#include "arrow/util/bounded-queue.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/stl.h"
 
@@ -139,7 +140,7 @@ class SimpleRecordBatch : public RecordBatch {
       auto new_data = std::make_shared<ArrayData>(*field);
       new_data->length = col_length;
       new_data->offset = col_offset;
-      new_data->null_count = kUnknownNullCount;
+      new_data->null_count = internal::SliceNullCount(*field, col_length);
       arrays.emplace_back(new_data);
     }
     int64_t num_rows = std::min(num_rows_ - offset, length);
@@ -249,4 +250,24 @@ Status RecordBatch::Validate() const {
 
 RecordBatchReader::~RecordBatchReader() {}
 
+Result<std::shared_ptr<RecordBatch>> RecordBatchReader::Next() {
+  std::shared_ptr<RecordBatch> batch;
+  RETURN_NOT_OK(ReadNext(&batch));
+  return std::move(batch);
+}
+
+RecordBatchQueueReader::RecordBatchQueueReader(
+    const std::shared_ptr<Schema>& schema, const std::shared_ptr<RecordBatchQueue>& queue)
+    : schema_(schema), queue_(queue) {}
+
+std::shared_ptr<Schema> RecordBatchQueueReader::schema() const { return schema_; }
+
+Status RecordBatchQueueReader::ReadNext(std::shared_ptr<RecordBatch>* batch) {
+  if (!queue_->Pop(batch)) {
+    // Closed and drained
+    batch->reset();
+  }
+  return Status::OK();
+}
+
 }  // namespace arrow
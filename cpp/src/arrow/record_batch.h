@@ -24,6 +24,7 @@
 #include <vector>
 
 #include "arrow/array.h"
+#include "arrow/result.h"
 #include "arrow/type.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/visibility.h"
@@ -176,6 +177,40 @@ class ARROW_EXPORT RecordBatchReader {
   /// \param[out] batch the next loaded batch, null at end of stream
   /// \return Status
   virtual Status ReadNext(std::shared_ptr<RecordBatch>* batch) = 0;
+
+  /// \brief Read the next record batch in the stream
+  ///
+  /// \return the next loaded batch, null at end of stream, or the error
+  Result<std::shared_ptr<RecordBatch>> Next();
+};
+
+template <typename T>
+class BoundedQueue;
+
+/// \brief A queue to pass record batches from the threads of a pipeline
+/// stage to those of the next, see arrow/util/bounded-queue.h
+using RecordBatchQueue = BoundedQueue<std::shared_ptr<RecordBatch>>;
+
+/// \brief Read the record batches pushed to a RecordBatchQueue, as the
+/// consumer of a pipeline stage
+///
+/// Several readers may share a queue, each batch being read by one of them.
+/// Reading waits for the producers to push a batch, and reaches the end of
+/// the stream once the queue is closed and drained.
+class ARROW_EXPORT RecordBatchQueueReader : public RecordBatchReader {
+ public:
+  /// \param[in] schema the schema of the batches pushed to the queue
+  /// \param[in] queue the queue to read from
+  RecordBatchQueueReader(const std::shared_ptr<Schema>& schema,
+                         const std::shared_ptr<RecordBatchQueue>& queue);
+
+  std::shared_ptr<Schema> schema() const override;
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* batch) override;
+
+ private:
+  std::shared_ptr<Schema> schema_;
+  std::shared_ptr<RecordBatchQueue> queue_;
 };
 
 }  // namespace arrow
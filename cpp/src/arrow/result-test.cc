@@ -0,0 +1,155 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <limits>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/builder.h"
+#include "arrow/record_batch.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/table.h"
+#include "arrow/test-util.h"
+
+namespace arrow {
+
+static Result<std::unique_ptr<int>> MakeInt(int value) {
+  if (value < 0) {
+    return Status::Invalid("negative");
+  }
+  return std::unique_ptr<int>(new int(value));
+}
+
+static Status AddInts(int a, int b, int* out) {
+  ARROW_ASSIGN_OR_RAISE(auto x, MakeInt(a));
+  ARROW_ASSIGN_OR_RAISE(std::unique_ptr<int> y, MakeInt(b));
+  *out = *x + *y;
+  return Status::OK();
+}
+
+static Result<int> AddIntsResult(int a, int b) {
+  int out;
+  ARROW_ASSIGN_OR_RAISE(auto x, MakeInt(a));
+  RETURN_NOT_OK(AddInts(a, b, &out));
+  return out + *x - a;
+}
+
+TEST(ResultTest, ValueAndError) {
+  Result<std::unique_ptr<int>> result = MakeInt(3);
+  ASSERT_TRUE(result.ok());
+  ASSERT_OK(result.status());
+  ASSERT_EQ(3, *result.ValueOrDie());
+  ASSERT_EQ(3, **result);
+
+  std::unique_ptr<int> value = std::move(result).ValueOrDie();
+  ASSERT_EQ(3, *value);
+
+  Result<std::unique_ptr<int>> error = MakeInt(-1);
+  ASSERT_FALSE(error.ok());
+  ASSERT_RAISES(Invalid, error.status());
+  ASSERT_EQ("negative", error.status().message());
+  ASSERT_RAISES(Invalid, std::move(error).Value(&value));
+  ASSERT_EQ(3, *value);
+
+  ASSERT_OK(MakeInt(4).Value(&value));
+  ASSERT_EQ(4, *value);
+}
+
+TEST(ResultTest, FromOkStatus) {
+  Result<int> result(Status::OK());
+  ASSERT_FALSE(result.ok());
+  ASSERT_TRUE(result.status().IsUnknownError());
+}
+
+TEST(ResultTest, Move) {
+  Result<std::shared_ptr<std::string>> result(std::make_shared<std::string>("abc"));
+  std::weak_ptr<std::string> weak = *result;
+  Result<std::shared_ptr<std::string>> moved(std::move(result));
+  ASSERT_EQ("abc", **moved);
+  ASSERT_EQ(1, weak.use_count());
+
+  Result<std::shared_ptr<std::string>> error(Status::IOError("error"));
+  moved = std::move(error);
+  ASSERT_TRUE(moved.status().IsIOError());
+  // The value was released on assignment
+  ASSERT_TRUE(weak.expired());
+}
+
+TEST(ResultTest, AssignOrRaise) {
+  int out = 0;
+  ASSERT_OK(AddInts(1, 2, &out));
+  ASSERT_EQ(3, out);
+  ASSERT_RAISES(Invalid, AddInts(1, -2, &out));
+  ASSERT_RAISES(Invalid, AddInts(-1, 2, &out));
+
+  Result<int> sum = AddIntsResult(2, 5);
+  ASSERT_OK(sum.status());
+  ASSERT_EQ(7, *sum);
+  ASSERT_RAISES(Invalid, AddIntsResult(2, -5).status());
+}
+
+TEST(ResultTest, AllocateBuffer) {
+  Result<std::shared_ptr<Buffer>> buffer = AllocateBuffer(100);
+  ASSERT_OK(buffer.status());
+  ASSERT_EQ(100, (*buffer)->size());
+  ASSERT_TRUE((*buffer)->is_mutable());
+
+  Result<std::shared_ptr<ResizableBuffer>> resizable =
+      AllocateResizableBuffer(10, default_memory_pool());
+  ASSERT_OK(resizable.status());
+  ASSERT_OK((*resizable)->Resize(1000));
+  ASSERT_EQ(1000, (*resizable)->size());
+
+  ASSERT_RAISES(OutOfMemory,
+                AllocateBuffer(std::numeric_limits<int64_t>::max()).status());
+}
+
+TEST(ResultTest, BuilderFinish) {
+  Int32Builder builder;
+  ASSERT_OK(builder.Append(1));
+  ASSERT_OK(builder.AppendNull());
+  Result<std::shared_ptr<Array>> array = builder.Finish();
+  ASSERT_OK(array.status());
+  ASSERT_EQ(2, (*array)->length());
+  ASSERT_EQ(1, (*array)->null_count());
+}
+
+TEST(ResultTest, RecordBatchReaderNext) {
+  Int32Builder builder;
+  ASSERT_OK(builder.Append(1));
+  std::shared_ptr<Array> array;
+  ASSERT_OK(builder.Finish(&array));
+  auto batch = RecordBatch::Make(::arrow::schema({field("f0", int32())}), 1, {array});
+  auto table = Table::Make(batch->schema(), std::vector<std::shared_ptr<Array>>{array});
+
+  TableBatchReader reader(*table);
+  Result<std::shared_ptr<RecordBatch>> next = reader.Next();
+  ASSERT_OK(next.status());
+  ASSERT_TRUE((*next)->Equals(*batch));
+  next = reader.Next();
+  ASSERT_OK(next.status());
+  ASSERT_EQ(nullptr, *next);
+}
+
+}  // namespace arrow
@@ -0,0 +1,195 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_RESULT_H
+#define ARROW_RESULT_H
+
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "arrow/status.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+namespace internal {
+
+ARROW_EXPORT ARROW_NORETURN void DieWithStatus(const Status& status);
+
+}  // namespace internal
+
+/// \class Result
+/// \brief Either a value or the error Status of the operation that failed to
+/// produce it
+///
+/// Returning a Result<T> spares callers the default-constructed value that
+/// an out-parameter needs, and lets the value be moved out of the Result:
+///
+///   Result<std::shared_ptr<Buffer>> result = AllocateBuffer(size, pool);
+///   if (!result.ok()) {
+///     return result.status();
+///   }
+///   std::shared_ptr<Buffer> buffer = std::move(result).ValueOrDie();
+///
+/// or, in a function returning Status or a Result,
+///
+///   ARROW_ASSIGN_OR_RAISE(auto buffer, AllocateBuffer(size, pool));
+///
+/// A Result is move-only, the value being moved from one to the other.
+template <typename T>
+class Result {
+  static_assert(!std::is_same<T, Status>::value, "Result<Status> is not meaningful");
+  static_assert(!std::is_reference<T>::value, "Result<T&> is not supported");
+
+  template <typename U>
+  struct IsValue {
+    using D = typename std::decay<U>::type;
+    static constexpr bool value = std::is_convertible<U&&, T>::value &&
+                                  !std::is_same<D, Status>::value &&
+                                  !std::is_same<D, Result>::value;
+  };
+
+ public:
+  /// \brief Construct from an error; an OK status, which holds no value, is
+  /// turned into an UnknownError
+  Result(const Status& status)  // NOLINT runtime/explicit
+      : status_(ARROW_PREDICT_TRUE(!status.ok())
+                    ? status
+                    : Status::UnknownError("Result constructed from an OK status")) {}
+
+  Result(Status&& status)  // NOLINT runtime/explicit
+      : status_(std::move(status)) {
+    if (ARROW_PREDICT_FALSE(status_.ok())) {
+      status_ = Status::UnknownError("Result constructed from an OK status");
+    }
+  }
+
+  /// \brief Construct from a value, or anything convertible to one, such as
+  /// the shared_ptr of a subclass
+  template <typename U, typename = typename std::enable_if<IsValue<U>::value>::type>
+  Result(U&& value)  // NOLINT runtime/explicit
+  {
+    new (&value_) T(std::forward<U>(value));
+  }
+
+  Result(Result&& other) noexcept(std::is_nothrow_move_constructible<T>::value)
+      : status_(other.status_) {
+    if (status_.ok()) {
+      new (&value_) T(std::move(other.value_));
+    }
+  }
+
+  Result& operator=(Result&& other) noexcept(
+      std::is_nothrow_move_constructible<T>::value) {
+    if (this != &other) {
+      Destroy();
+      status_ = other.status_;
+      if (status_.ok()) {
+        new (&value_) T(std::move(other.value_));
+      }
+    }
+    return *this;
+  }
+
+  ~Result() { Destroy(); }
+
+  /// \brief Whether the Result holds a value
+  bool ok() const { return status_.ok(); }
+
+  /// \brief OK if the Result holds a value, else the error
+  const Status& status() const { return status_; }
+
+  /// \brief The value held, aborting the process if there is none
+  const T& ValueOrDie() const& {
+    CheckValue();
+    return value_;
+  }
+  T& ValueOrDie() & {
+    CheckValue();
+    return value_;
+  }
+  T ValueOrDie() && {
+    CheckValue();
+    return std::move(value_);
+  }
+
+  /// \brief Move the value held into out
+  ///
+  /// \return Status, the error without touching out if there is no value
+  Status Value(T* out) && {
+    if (ARROW_PREDICT_FALSE(!ok())) {
+      return status_;
+    }
+    *out = std::move(value_);
+    return Status::OK();
+  }
+
+  /// \brief Move the value out, which must be there
+  T MoveValueUnsafe() { return std::move(value_); }
+
+  const T& operator*() const& { return ValueOrDie(); }
+  T& operator*() & { return ValueOrDie(); }
+  T operator*() && { return std::move(*this).ValueOrDie(); }
+
+  const T* operator->() const { return &ValueOrDie(); }
+  T* operator->() { return &ValueOrDie(); }
+
+ private:
+  void CheckValue() const {
+    if (ARROW_PREDICT_FALSE(!ok())) {
+      internal::DieWithStatus(status_);
+    }
+  }
+
+  void Destroy() {
+    if (status_.ok()) {
+      value_.~T();
+    }
+  }
+
+  Status status_;
+  // Constructed only when status_ is OK
+  union {
+    T value_;
+  };
+
+  ARROW_DISALLOW_COPY_AND_ASSIGN(Result);
+};
+
+}  // namespace arrow
+
+#define ARROW_ASSIGN_OR_RAISE_NAME(x, y) ARROW_CONCAT(x, y)
+#define ARROW_CONCAT(x, y) x##y
+
+#define ARROW_ASSIGN_OR_RAISE_IMPL(result_name, lhs, rexpr) \
+  auto result_name = (rexpr);                               \
+  RETURN_NOT_OK(result_name.status());                      \
+  lhs = std::move(result_name).MoveValueUnsafe();
+
+/// \brief Evaluate rexpr, a Result, and assign its value to lhs, or return
+/// its error from the enclosing function
+///
+/// lhs may declare a variable, as in ARROW_ASSIGN_OR_RAISE(auto x, F()).
+/// The macro expands to several statements, so cannot be the body of an
+/// unbraced if or loop.
+#define ARROW_ASSIGN_OR_RAISE(lhs, rexpr) \
+  ARROW_ASSIGN_OR_RAISE_IMPL(             \
+      ARROW_ASSIGN_OR_RAISE_NAME(_error_or_value, __COUNTER__), lhs, rexpr)
+
+#endif  // ARROW_RESULT_H
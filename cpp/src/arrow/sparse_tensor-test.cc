@@ -0,0 +1,157 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+// Unit tests for SparseTensor and its indices
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/buffer.h"
+#include "arrow/memory_pool.h"
+#include "arrow/sparse_tensor.h"
+#include "arrow/tensor.h"
+#include "arrow/test-util.h"
+#include "arrow/type.h"
+
+namespace arrow {
+
+template <typename T>
+std::vector<T> BufferValues(const Buffer& buffer) {
+  auto data = reinterpret_cast<const T*>(buffer.data());
+  return std::vector<T>(data, data + buffer.size() / sizeof(T));
+}
+
+class TestSparseTensor : public ::testing::Test {
+ public:
+  void SetUp() {
+    // A 2x3x4 tensor with 6 non-zero values
+    values_ = {1, 0, 2, 0, 0, 3, 0, 4, 0, 0, 0, 0,
+               5, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0};
+    dense_ = std::make_shared<Tensor>(int64(), test::GetBufferFromVector(values_),
+                                      std::vector<int64_t>{2, 3, 4});
+  }
+
+ protected:
+  std::vector<int64_t> values_;
+  std::shared_ptr<Tensor> dense_;
+};
+
+TEST_F(TestSparseTensor, COOFromDense) {
+  std::shared_ptr<SparseTensor> sparse;
+  ASSERT_OK(MakeSparseCOOTensor(*dense_, default_memory_pool(), &sparse));
+
+  ASSERT_EQ(SparseTensorFormat::COO, sparse->format_id());
+  ASSERT_EQ(6, sparse->non_zero_length());
+  ASSERT_EQ(24, sparse->size());
+  ASSERT_EQ(3, sparse->ndim());
+
+  const auto& index = checked_cast<const SparseCOOIndex&>(*sparse->sparse_index());
+  ASSERT_EQ(std::vector<int64_t>({6, 3}), index.indices()->shape());
+  std::vector<int64_t> expected_coords = {0, 0, 0, 0, 0, 2, 0, 1, 1,
+                                          0, 1, 3, 1, 0, 0, 1, 2, 1};
+  ASSERT_EQ(expected_coords, BufferValues<int64_t>(*index.indices()->data()));
+  ASSERT_EQ(std::vector<int64_t>({1, 2, 3, 4, 5, 6}),
+            BufferValues<int64_t>(*sparse->data()));
+
+  std::shared_ptr<Tensor> roundtrip;
+  ASSERT_OK(sparse->ToTensor(default_memory_pool(), &roundtrip));
+  ASSERT_TRUE(roundtrip->Equals(*dense_));
+}
+
+TEST_F(TestSparseTensor, CSRFromDense) {
+  std::vector<double> values = {0, 1.5, 0, 0, 0, 0, -2, 0, 3};
+  Tensor dense(float64(), test::GetBufferFromVector(values), {3, 3}, {},
+               {"rows", "cols"});
+
+  std::shared_ptr<SparseTensor> sparse;
+  ASSERT_OK(MakeSparseCSRTensor(dense, default_memory_pool(), &sparse));
+
+  ASSERT_EQ(SparseTensorFormat::CSR, sparse->format_id());
+  ASSERT_EQ(3, sparse->non_zero_length());
+  ASSERT_EQ("cols", sparse->dim_name(1));
+
+  const auto& index = checked_cast<const SparseCSRIndex&>(*sparse->sparse_index());
+  // The middle row is empty
+  ASSERT_EQ(std::vector<int64_t>({0, 1, 1, 3}),
+            BufferValues<int64_t>(*index.indptr()->data()));
+  ASSERT_EQ(std::vector<int64_t>({1, 0, 2}),
+            BufferValues<int64_t>(*index.indices()->data()));
+  ASSERT_EQ(std::vector<double>({1.5, -2, 3}), BufferValues<double>(*sparse->data()));
+
+  std::shared_ptr<Tensor> roundtrip;
+  ASSERT_OK(sparse->ToTensor(default_memory_pool(), &roundtrip));
+  ASSERT_TRUE(roundtrip->Equals(dense));
+  ASSERT_EQ("rows", roundtrip->dim_name(0));
+
+  ASSERT_RAISES(Invalid, MakeSparseCSRTensor(*dense_, default_memory_pool(), &sparse));
+}
+
+TEST_F(TestSparseTensor, FromStridedDense) {
+  // The transpose of the tensor, as a column-major view of its cells
+  Tensor transposed(int64(), dense_->data(), {4, 3, 2}, {8, 32, 96});
+  std::shared_ptr<SparseTensor> sparse;
+  ASSERT_OK(MakeSparseCOOTensor(transposed, default_memory_pool(), &sparse));
+  ASSERT_EQ(6, sparse->non_zero_length());
+  ASSERT_EQ(std::vector<int64_t>({1, 5, 3, 6, 2, 4}),
+            BufferValues<int64_t>(*sparse->data()));
+
+  std::shared_ptr<Tensor> roundtrip;
+  ASSERT_OK(sparse->ToTensor(default_memory_pool(), &roundtrip));
+  ASSERT_TRUE(roundtrip->is_row_major());
+  std::vector<int64_t> expected(24);
+  ASSERT_OK(internal::CopyTensorRowMajor(transposed, 0, 4,
+                                         reinterpret_cast<uint8_t*>(expected.data())));
+  ASSERT_EQ(expected, BufferValues<int64_t>(*roundtrip->data()));
+}
+
+TEST_F(TestSparseTensor, Equals) {
+  std::shared_ptr<SparseTensor> coo1, coo2, csr;
+  ASSERT_OK(MakeSparseCOOTensor(*dense_, default_memory_pool(), &coo1));
+  ASSERT_OK(MakeSparseCOOTensor(*dense_, default_memory_pool(), &coo2));
+  ASSERT_TRUE(coo1->Equals(*coo2));
+
+  std::vector<int64_t> other_values = values_;
+  other_values[2] = 7;
+  Tensor other(int64(), test::GetBufferFromVector(other_values), dense_->shape());
+  ASSERT_OK(MakeSparseCOOTensor(other, default_memory_pool(), &coo2));
+  ASSERT_FALSE(coo1->Equals(*coo2));
+
+  Tensor matrix(int64(), dense_->data(), {6, 4});
+  ASSERT_OK(MakeSparseCOOTensor(matrix, default_memory_pool(), &coo2));
+  ASSERT_FALSE(coo1->Equals(*coo2));
+  ASSERT_OK(MakeSparseCSRTensor(matrix, default_memory_pool(), &csr));
+  ASSERT_FALSE(coo2->Equals(*csr));
+}
+
+TEST(TestSparseTensorEdgeCases, AllZeros) {
+  std::vector<float> values = {0, -0.0f, 0, 0};
+  Tensor dense(float32(), test::GetBufferFromVector(values), {2, 2});
+
+  std::shared_ptr<SparseTensor> sparse;
+  ASSERT_OK(MakeSparseCSRTensor(dense, default_memory_pool(), &sparse));
+  ASSERT_EQ(0, sparse->non_zero_length());
+
+  std::shared_ptr<Tensor> roundtrip;
+  ASSERT_OK(sparse->ToTensor(default_memory_pool(), &roundtrip));
+  // The negative zero is not stored
+  ASSERT_EQ(std::vector<float>(4, 0), BufferValues<float>(*roundtrip->data()));
+}
+
+}  // namespace arrow
@@ -0,0 +1,348 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include "arrow/sparse_tensor.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "arrow/buffer.h"
+#include "arrow/memory_pool.h"
+#include "arrow/status.h"
+#include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+
+namespace {
+
+bool IndexTensorEquals(const Tensor& left, const Tensor& right) {
+  return left.shape() == right.shape() && left.Equals(right);
+}
+
+int64_t CellSize(const DataType& type) {
+  return checked_cast<const FixedWidthType&>(type).bit_width() / 8;
+}
+
+// Call visit with the index and address of each cell of a tensor of any
+// strides, in row-major order
+template <typename Visitor>
+void VisitCellsRowMajor(const Tensor& tensor, Visitor&& visit) {
+  if (tensor.size() == 0) {
+    return;
+  }
+  const auto& shape = tensor.shape();
+  const auto& strides = tensor.strides();
+  const int ndim = tensor.ndim();
+  const uint8_t* data = tensor.raw_data();
+
+  std::vector<int64_t> index(ndim, 0);
+  int64_t offset = 0;
+  while (true) {
+    visit(index.data(), data + offset);
+    int i = ndim - 1;
+    for (; i >= 0; --i) {
+      offset += strides[i];
+      if (++index[i] < shape[i]) {
+        break;
+      }
+      offset -= strides[i] * shape[i];
+      index[i] = 0;
+    }
+    if (i < 0) {
+      return;
+    }
+  }
+}
+
+// Floating point cells are compared by value, so that negative zeros are not
+// stored; half floats, which have no C type, are compared by bits
+template <typename CType>
+bool IsNonZeroCell(const uint8_t* cell) {
+  CType value;
+  std::memcpy(&value, cell, sizeof(CType));
+  return value != 0;
+}
+
+using IsNonZeroFunction = bool (*)(const uint8_t*);
+
+Status GetIsNonZero(const DataType& type, IsNonZeroFunction* out) {
+  switch (type.id()) {
+    case Type::FLOAT:
+      *out = IsNonZeroCell<float>;
+      break;
+    case Type::DOUBLE:
+      *out = IsNonZeroCell<double>;
+      break;
+    case Type::UINT8:
+    case Type::INT8:
+      *out = IsNonZeroCell<uint8_t>;
+      break;
+    case Type::UINT16:
+    case Type::INT16:
+    case Type::HALF_FLOAT:
+      *out = IsNonZeroCell<uint16_t>;
+      break;
+    case Type::UINT32:
+    case Type::INT32:
+      *out = IsNonZeroCell<uint32_t>;
+      break;
+    case Type::UINT64:
+    case Type::INT64:
+      *out = IsNonZeroCell<uint64_t>;
+      break;
+    default:
+      return Status::NotImplemented("Sparse tensors of type " + type.ToString());
+  }
+  return Status::OK();
+}
+
+int64_t CountNonZero(const Tensor& tensor, IsNonZeroFunction is_non_zero) {
+  int64_t count = 0;
+  VisitCellsRowMajor(tensor, [&](const int64_t*, const uint8_t* cell) {
+    count += is_non_zero(cell);
+  });
+  return count;
+}
+
+std::shared_ptr<Tensor> MakeIndexTensor(const std::shared_ptr<Buffer>& data,
+                                        const std::vector<int64_t>& shape) {
+  return std::make_shared<Tensor>(int64(), data, shape);
+}
+
+}  // namespace
+
+// ----------------------------------------------------------------------
+// Sparse indices
+
+SparseCOOIndex::SparseCOOIndex(const std::shared_ptr<Tensor>& coords)
+    : SparseIndex(SparseTensorFormat::COO, coords->shape()[0]), coords_(coords) {
+  DCHECK_EQ(coords->type_id(), Type::INT64);
+  DCHECK_EQ(coords->ndim(), 2);
+  DCHECK(coords->is_row_major());
+}
+
+bool SparseCOOIndex::Equals(const SparseIndex& other) const {
+  if (other.format_id() != SparseTensorFormat::COO) {
+    return false;
+  }
+  const auto& other_coo = checked_cast<const SparseCOOIndex&>(other);
+  return IndexTensorEquals(*coords_, *other_coo.coords_);
+}
+
+std::vector<std::shared_ptr<Buffer>> SparseCOOIndex::buffers() const {
+  return {coords_->data()};
+}
+
+SparseCSRIndex::SparseCSRIndex(const std::shared_ptr<Tensor>& indptr,
+                               const std::shared_ptr<Tensor>& indices)
+    : SparseIndex(SparseTensorFormat::CSR, indices->shape()[0]),
+      indptr_(indptr),
+      indices_(indices) {
+  DCHECK_EQ(indptr->type_id(), Type::INT64);
+  DCHECK_EQ(indptr->ndim(), 1);
+  DCHECK_EQ(indices->type_id(), Type::INT64);
+  DCHECK_EQ(indices->ndim(), 1);
+}
+
+bool SparseCSRIndex::Equals(const SparseIndex& other) const {
+  if (other.format_id() != SparseTensorFormat::CSR) {
+    return false;
+  }
+  const auto& other_csr = checked_cast<const SparseCSRIndex&>(other);
+  return IndexTensorEquals(*indptr_, *other_csr.indptr_) &&
+         IndexTensorEquals(*indices_, *other_csr.indices_);
+}
+
+std::vector<std::shared_ptr<Buffer>> SparseCSRIndex::buffers() const {
+  return {indptr_->data(), indices_->data()};
+}
+
+// ----------------------------------------------------------------------
+// SparseTensor
+
+SparseTensor::SparseTensor(const std::shared_ptr<DataType>& type,
+                           const std::shared_ptr<Buffer>& data,
+                           const std::vector<int64_t>& shape,
+                           const std::shared_ptr<SparseIndex>& sparse_index,
+                           const std::vector<std::string>& dim_names)
+    : type_(type),
+      data_(data),
+      shape_(shape),
+      sparse_index_(sparse_index),
+      dim_names_(dim_names) {
+  DCHECK(is_tensor_supported(type->id()));
+  DCHECK(sparse_index->format_id() != SparseTensorFormat::CSR || shape.size() == 2);
+}
+
+const std::string& SparseTensor::dim_name(int i) const {
+  static const std::string kEmpty = "";
+  if (dim_names_.size() == 0) {
+    return kEmpty;
+  } else {
+    DCHECK_LT(i, static_cast<int>(dim_names_.size()));
+    return dim_names_[i];
+  }
+}
+
+int64_t SparseTensor::size() const {
+  return std::accumulate(shape_.begin(), shape_.end(), 1LL, std::multiplies<int64_t>());
+}
+
+bool SparseTensor::Equals(const SparseTensor& other) const {
+  if (this == &other) {
+    return true;
+  }
+  if (!type_->Equals(*other.type_) || shape_ != other.shape_ ||
+      !sparse_index_->Equals(*other.sparse_index_)) {
+    return false;
+  }
+  const int64_t values_size = non_zero_length() * CellSize(*type_);
+  return values_size == 0 ||
+         std::memcmp(data_->data(), other.data_->data(),
+                     static_cast<size_t>(values_size)) == 0;
+}
+
+Status SparseTensor::ToTensor(MemoryPool* pool, std::shared_ptr<Tensor>* out) const {
+  const int64_t cell_size = CellSize(*type_);
+  std::shared_ptr<Buffer> dense;
+  RETURN_NOT_OK(AllocateBuffer(pool, size() * cell_size, &dense));
+  uint8_t* dense_data = dense->mutable_data();
+  std::memset(dense_data, 0, static_cast<size_t>(dense->size()));
+
+  const uint8_t* values = data_ == nullptr ? nullptr : data_->data();
+  const int64_t length = non_zero_length();
+  if (format_id() == SparseTensorFormat::COO) {
+    const auto& index = checked_cast<const SparseCOOIndex&>(*sparse_index_);
+    const auto coords = reinterpret_cast<const int64_t*>(index.indices()->raw_data());
+    const int dims = ndim();
+    for (int64_t i = 0; i < length; ++i) {
+      int64_t offset = 0;
+      for (int d = 0; d < dims; ++d) {
+        offset = offset * shape_[d] + coords[i * dims + d];
+      }
+      std::memcpy(dense_data + offset * cell_size, values + i * cell_size,
+                  static_cast<size_t>(cell_size));
+    }
+  } else {
+    const auto& index = checked_cast<const SparseCSRIndex&>(*sparse_index_);
+    const auto indptr = reinterpret_cast<const int64_t*>(index.indptr()->raw_data());
+    const auto indices = reinterpret_cast<const int64_t*>(index.indices()->raw_data());
+    const int64_t num_cols = shape_[1];
+    for (int64_t row = 0; row < shape_[0]; ++row) {
+      for (int64_t i = indptr[row]; i < indptr[row + 1]; ++i) {
+        const int64_t offset = row * num_cols + indices[i];
+        std::memcpy(dense_data + offset * cell_size, values + i * cell_size,
+                    static_cast<size_t>(cell_size));
+      }
+    }
+  }
+  *out = std::make_shared<Tensor>(type_, dense, shape_, std::vector<int64_t>{},
+                                  dim_names_);
+  return Status::OK();
+}
+
+// ----------------------------------------------------------------------
+// Conversion from dense tensors
+
+Status MakeSparseCOOTensor(const Tensor& tensor, MemoryPool* pool,
+                           std::shared_ptr<SparseTensor>* out) {
+  IsNonZeroFunction is_non_zero;
+  RETURN_NOT_OK(GetIsNonZero(*tensor.type(), &is_non_zero));
+  const int64_t length = CountNonZero(tensor, is_non_zero);
+
+  const int ndim = tensor.ndim();
+  const int64_t cell_size = CellSize(*tensor.type());
+  std::shared_ptr<Buffer> coords_data, values;
+  RETURN_NOT_OK(AllocateBuffer(pool, length * ndim * sizeof(int64_t), &coords_data));
+  RETURN_NOT_OK(AllocateBuffer(pool, length * cell_size, &values));
+
+  auto coords = reinterpret_cast<int64_t*>(coords_data->mutable_data());
+  uint8_t* values_out = values->mutable_data();
+  VisitCellsRowMajor(tensor, [&](const int64_t* index, const uint8_t* cell) {
+    if (is_non_zero(cell)) {
+      std::copy(index, index + ndim, coords);
+      coords += ndim;
+      std::memcpy(values_out, cell, static_cast<size_t>(cell_size));
+      values_out += cell_size;
+    }
+  });
+
+  auto sparse_index =
+      std::make_shared<SparseCOOIndex>(MakeIndexTensor(coords_data, {length, ndim}));
+  std::vector<std::string> dim_names;
+  for (int i = 0; i < ndim && !tensor.dim_name(i).empty(); ++i) {
+    dim_names.push_back(tensor.dim_name(i));
+  }
+  *out = std::make_shared<SparseTensor>(tensor.type(), values, tensor.shape(),
+                                        sparse_index, dim_names);
+  return Status::OK();
+}
+
+Status MakeSparseCSRTensor(const Tensor& tensor, MemoryPool* pool,
+                           std::shared_ptr<SparseTensor>* out) {
+  if (tensor.ndim() != 2) {
+    std::stringstream ss;
+    ss << "CSR sparse tensors must have 2 dimensions, got " << tensor.ndim();
+    return Status::Invalid(ss.str());
+  }
+  IsNonZeroFunction is_non_zero;
+  RETURN_NOT_OK(GetIsNonZero(*tensor.type(), &is_non_zero));
+  const int64_t length = CountNonZero(tensor, is_non_zero);
+
+  const int64_t num_rows = tensor.shape()[0];
+  const int64_t cell_size = CellSize(*tensor.type());
+  std::shared_ptr<Buffer> indptr_data, indices_data, values;
+  RETURN_NOT_OK(AllocateBuffer(pool, (num_rows + 1) * sizeof(int64_t), &indptr_data));
+  RETURN_NOT_OK(AllocateBuffer(pool, length * sizeof(int64_t), &indices_data));
+  RETURN_NOT_OK(AllocateBuffer(pool, length * cell_size, &values));
+
+  auto indptr = reinterpret_cast<int64_t*>(indptr_data->mutable_data());
+  auto indices = reinterpret_cast<int64_t*>(indices_data->mutable_data());
+  uint8_t* values_out = values->mutable_data();
+  std::fill(indptr, indptr + num_rows + 1, 0);
+  int64_t count = 0;
+  VisitCellsRowMajor(tensor, [&](const int64_t* index, const uint8_t* cell) {
+    if (is_non_zero(cell)) {
+      indices[count++] = index[1];
+      std::memcpy(values_out, cell, static_cast<size_t>(cell_size));
+      values_out += cell_size;
+    }
+    // The end of a row is that of its last cell
+    indptr[index[0] + 1] = count;
+  });
+
+  auto sparse_index =
+      std::make_shared<SparseCSRIndex>(MakeIndexTensor(indptr_data, {num_rows + 1}),
+                                       MakeIndexTensor(indices_data, {length}));
+  std::vector<std::string> dim_names;
+  if (!tensor.dim_name(0).empty() || !tensor.dim_name(1).empty()) {
+    dim_names = {tensor.dim_name(0), tensor.dim_name(1)};
+  }
+  *out = std::make_shared<SparseTensor>(tensor.type(), values, tensor.shape(),
+                                        sparse_index, dim_names);
+  return Status::OK();
+}
+
+}  // namespace arrow
@@ -0,0 +1,188 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#ifndef ARROW_SPARSE_TENSOR_H
+#define ARROW_SPARSE_TENSOR_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/buffer.h"
+#include "arrow/tensor.h"
+#include "arrow/type.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class MemoryPool;
+class Status;
+
+struct SparseTensorFormat {
+  /// EXPERIMENTAL: The layouts of the indices of sparse tensors
+  enum type {
+    /// Coordinate list: the index of each non-zero value along every dimension
+    COO,
+    /// Compressed sparse row: the offsets of the rows of a matrix in the
+    /// column indices of its non-zero values
+    CSR
+  };
+};
+
+/// \brief EXPERIMENTAL: The base class of the indices of the non-zero values
+/// of a sparse tensor
+class ARROW_EXPORT SparseIndex {
+ public:
+  virtual ~SparseIndex() = default;
+
+  /// The layout of the index
+  SparseTensorFormat::type format_id() const { return format_id_; }
+
+  /// The number of non-zero values indexed
+  int64_t non_zero_length() const { return non_zero_length_; }
+
+  virtual bool Equals(const SparseIndex& other) const = 0;
+
+  /// The buffers of the index, in the order they are serialized in
+  virtual std::vector<std::shared_ptr<Buffer>> buffers() const = 0;
+
+ protected:
+  SparseIndex(SparseTensorFormat::type format_id, int64_t non_zero_length)
+      : format_id_(format_id), non_zero_length_(non_zero_length) {}
+
+  SparseTensorFormat::type format_id_;
+  int64_t non_zero_length_;
+};
+
+/// \brief EXPERIMENTAL: The coordinates of the non-zero values of a tensor
+///
+/// The coordinates are an int64 row-major tensor of shape
+/// [non_zero_length, ndim], in the order of the values.
+class ARROW_EXPORT SparseCOOIndex : public SparseIndex {
+ public:
+  explicit SparseCOOIndex(const std::shared_ptr<Tensor>& coords);
+
+  const std::shared_ptr<Tensor>& indices() const { return coords_; }
+
+  bool Equals(const SparseIndex& other) const override;
+
+  std::vector<std::shared_ptr<Buffer>> buffers() const override;
+
+ private:
+  std::shared_ptr<Tensor> coords_;
+};
+
+/// \brief EXPERIMENTAL: The compressed sparse rows of a matrix
+///
+/// indptr is an int64 vector of the number of rows plus one offsets, such
+/// that the values of row i are those in [indptr[i], indptr[i + 1]); indices
+/// is the int64 vector of the columns of the values.
+class ARROW_EXPORT SparseCSRIndex : public SparseIndex {
+ public:
+  SparseCSRIndex(const std::shared_ptr<Tensor>& indptr,
+                 const std::shared_ptr<Tensor>& indices);
+
+  const std::shared_ptr<Tensor>& indptr() const { return indptr_; }
+  const std::shared_ptr<Tensor>& indices() const { return indices_; }
+
+  bool Equals(const SparseIndex& other) const override;
+
+  std::vector<std::shared_ptr<Buffer>> buffers() const override;
+
+ private:
+  std::shared_ptr<Tensor> indptr_;
+  std::shared_ptr<Tensor> indices_;
+};
+
+/// \brief EXPERIMENTAL: A tensor storing only its non-zero values
+///
+/// The data buffer holds the non_zero_length values, in the order of the
+/// sparse index. The buffers may be slices of a memory map or of a plasma
+/// object, as read by ipc::ReadSparseTensor.
+class ARROW_EXPORT SparseTensor {
+ public:
+  SparseTensor(const std::shared_ptr<DataType>& type, const std::shared_ptr<Buffer>& data,
+               const std::vector<int64_t>& shape,
+               const std::shared_ptr<SparseIndex>& sparse_index,
+               const std::vector<std::string>& dim_names = {});
+
+  std::shared_ptr<DataType> type() const { return type_; }
+  std::shared_ptr<Buffer> data() const { return data_; }
+
+  const uint8_t* raw_data() const { return data_->data(); }
+
+  const std::vector<int64_t>& shape() const { return shape_; }
+
+  const std::shared_ptr<SparseIndex>& sparse_index() const { return sparse_index_; }
+
+  SparseTensorFormat::type format_id() const { return sparse_index_->format_id(); }
+
+  int ndim() const { return static_cast<int>(shape_.size()); }
+
+  const std::string& dim_name(int i) const;
+
+  const std::vector<std::string>& dim_names() const { return dim_names_; }
+
+  /// Total number of value cells in the dense tensor
+  int64_t size() const;
+
+  /// Number of non-zero values
+  int64_t non_zero_length() const { return sparse_index_->non_zero_length(); }
+
+  /// True if the tensors have the same type, shape, index and values; two
+  /// tensors with the same dense values in different formats are not equal
+  bool Equals(const SparseTensor& other) const;
+
+  /// \brief Make the dense row-major tensor of the values
+  Status ToTensor(MemoryPool* pool, std::shared_ptr<Tensor>* out) const;
+
+ private:
+  std::shared_ptr<DataType> type_;
+  std::shared_ptr<Buffer> data_;
+  std::vector<int64_t> shape_;
+  std::shared_ptr<SparseIndex> sparse_index_;
+  std::vector<std::string> dim_names_;
+
+  ARROW_DISALLOW_COPY_AND_ASSIGN(SparseTensor);
+};
+
+/// \brief EXPERIMENTAL: Make the COO sparse tensor of the non-zero values of
+/// a dense tensor of any strides
+///
+/// \param[in] tensor the dense tensor
+/// \param[in] pool the pool to allocate the index and values from
+/// \param[out] out the sparse tensor, with coordinates in row-major order
+/// \return Status
+ARROW_EXPORT
+Status MakeSparseCOOTensor(const Tensor& tensor, MemoryPool* pool,
+                           std::shared_ptr<SparseTensor>* out);
+
+/// \brief EXPERIMENTAL: Make the CSR sparse tensor of the non-zero values of
+/// a dense matrix of any strides
+///
+/// \param[in] tensor the dense tensor, which must have two dimensions
+/// \param[in] pool the pool to allocate the index and values from
+/// \param[out] out the sparse tensor
+/// \return Status
+ARROW_EXPORT
+Status MakeSparseCSRTensor(const Tensor& tensor, MemoryPool* pool,
+                           std::shared_ptr<SparseTensor>* out);
+
+}  // namespace arrow
+
+#endif  // ARROW_SPARSE_TENSOR_H
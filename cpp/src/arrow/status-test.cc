@@ -16,6 +16,8 @@
 // under the License.
 
 #include <sstream>
+#include <string>
+#include <utility>
 
 #include <gtest/gtest.h>
 
@@ -40,6 +42,29 @@ TEST(StatusTest, TestToString) {
   ASSERT_EQ(file_error.ToString(), ss.str());
 }
 
+TEST(StatusTest, CopyAndMove) {
+  const std::string long_message(1000, 'x');
+  Status error = Status::Invalid(long_message);
+
+  Status copied(error);
+  ASSERT_TRUE(copied.IsInvalid());
+  ASSERT_EQ(long_message, copied.message());
+  copied = Status::IOError("");
+  ASSERT_TRUE(copied.IsIOError());
+  ASSERT_EQ("", copied.message());
+  copied = error;
+  ASSERT_EQ(long_message, copied.message());
+  copied = Status::OK();
+  ASSERT_TRUE(copied.ok());
+  ASSERT_EQ("", copied.message());
+
+  Status moved(std::move(error));
+  ASSERT_TRUE(error.ok());
+  ASSERT_EQ(long_message, moved.message());
+  moved = Status::KeyError("key");
+  ASSERT_EQ("Key error: key", moved.ToString());
+}
+
 TEST(StatusTest, AndStatus) {
   Status a = Status::OK();
   Status b = Status::OK();
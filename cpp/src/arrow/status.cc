@@ -13,22 +13,40 @@
 #include "arrow/status.h"
 
 #include <assert.h>
+#include <new>
 
 namespace arrow {
 
-Status::Status(StatusCode code, const std::string& msg) {
+Status::Status(StatusCode code, const std::string& msg)
+    : state_(MakeState(code, msg.data(), msg.size())) {
   assert(code != StatusCode::OK);
-  state_ = new State;
-  state_->code = code;
-  state_->msg = msg;
+}
+
+Status::State* Status::MakeState(StatusCode code, const char* msg, size_t msg_size) {
+  void* block = ::operator new(sizeof(State) + msg_size);
+  State* state = new (block) State;
+  state->code = code;
+  state->msg_size = msg_size;
+  std::memcpy(state + 1, msg, msg_size);
+  return state;
+}
+
+Status::State* Status::CopyState(const State* state) {
+  return MakeState(state->code, state->msg(), state->msg_size);
+}
+
+void Status::DeleteState() {
+  // State is trivially destructible
+  ::operator delete(state_);
+  state_ = nullptr;
 }
 
 void Status::CopyFrom(const Status& s) {
-  delete state_;
-  if (s.state_ == nullptr) {
-    state_ = nullptr;
-  } else {
-    state_ = new State(*s.state_);
+  if (state_ != nullptr) {
+    DeleteState();
+  }
+  if (s.state_ != nullptr) {
+    state_ = CopyState(s.state_);
   }
 }
 
@@ -97,7 +115,7 @@ std::string Status::ToString() const {
     return result;
   }
   result += ": ";
-  result += state_->msg;
+  result.append(state_->msg(), state_->msg_size);
   return result;
 }
 
@@ -51,13 +51,13 @@
 
 #endif  // ARROW_EXTRA_ERROR_CONTEXT
 
-#define RETURN_NOT_OK_ELSE(s, else_) \
-  do {                               \
-    ::arrow::Status _s = (s);        \
-    if (!_s.ok()) {                  \
-      else_;                         \
-      return _s;                     \
-    }                                \
+#define RETURN_NOT_OK_ELSE(s, else_)     \
+  do {                                   \
+    ::arrow::Status _s = (s);            \
+    if (ARROW_PREDICT_FALSE(!_s.ok())) { \
+      else_;                             \
+      return _s;                         \
+    }                                    \
   } while (false)
 
 // This is used by other codebases. The macros above
@@ -213,21 +213,29 @@ class ARROW_EXPORT Status {
 
   StatusCode code() const { return ok() ? StatusCode::OK : state_->code; }
 
-  std::string message() const { return ok() ? "" : state_->msg; }
+  std::string message() const {
+    return ok() ? std::string() : std::string(state_->msg(), state_->msg_size);
+  }
 
  private:
+  // The code and the message of an error, allocated in a single block with
+  // the characters of the message following the struct
   struct State {
     StatusCode code;
-    std::string msg;
+    size_t msg_size;
+
+    const char* msg() const { return reinterpret_cast<const char*>(this + 1); }
   };
   // OK status has a `NULL` state_.  Otherwise, `state_` points to
   // a `State` structure containing the error code and message(s)
   State* state_;
 
-  void DeleteState() {
-    delete state_;
-    state_ = NULL;
-  }
+  // The error paths, kept out of line so that the OK paths inlined in
+  // callers stay small
+  ARROW_NOINLINE static State* MakeState(StatusCode code, const char* msg,
+                                         size_t msg_size);
+  ARROW_NOINLINE static State* CopyState(const State* state);
+  ARROW_NOINLINE void DeleteState();
   void CopyFrom(const Status& s);
   void MoveFrom(Status& s);
 };
@@ -238,13 +246,15 @@ static inline std::ostream& operator<<(std::ostream& os, const Status& x) {
 }
 
 inline void Status::MoveFrom(Status& s) {
-  delete state_;
+  if (ARROW_PREDICT_FALSE(state_ != NULL)) {
+    DeleteState();
+  }
   state_ = s.state_;
   s.state_ = NULL;
 }
 
 inline Status::Status(const Status& s)
-    : state_((s.state_ == NULL) ? NULL : new State(*s.state_)) {}
+    : state_(ARROW_PREDICT_TRUE(s.state_ == NULL) ? NULL : CopyState(s.state_)) {}
 
 inline Status& Status::operator=(const Status& s) {
   // The following condition catches both aliasing (when this == &s),
@@ -15,9 +15,16 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <cstdint>
+#include <numeric>
+#include <string>
+#include <tuple>
+#include <vector>
+
 #include "gtest/gtest.h"
 
 #include "arrow/stl.h"
+#include "arrow/test-util.h"
 
 namespace arrow {
 namespace stl {
@@ -74,5 +81,90 @@ TEST(TestSchemaFromTuple, NestedList) {
   ASSERT_TRUE(expected_schema.Equals(*schema));
 }
 
+using RowType = std::tuple<int8_t, uint32_t, double, bool, std::string,
+                           std::vector<std::vector<int64_t>>>;
+
+static std::vector<RowType> MakeRows() {
+  return {RowType(1, 10, 1.5, true, "a", {{1, 2}, {}}),
+          RowType(-2, 20, -0.25, false, "", {}), RowType(3, 30, 4.0, true, "ccc", {{3}})};
+}
+
+TEST(TestTableFromTupleRange, PrimitiveAndNestedTypes) {
+  const std::vector<std::string> names = {"i8", "u32", "f64", "bool", "str", "lists"};
+  std::shared_ptr<Table> table;
+  ASSERT_OK(TableFromTupleRange(default_memory_pool(), MakeRows(), names, &table));
+  ASSERT_OK(table->Validate());
+  ASSERT_TRUE(table->schema()->Equals(*SchemaFromTuple<RowType>::MakeSchema(names)));
+  ASSERT_EQ(3, table->num_rows());
+
+  auto strings =
+      std::static_pointer_cast<StringArray>(table->column(4)->data()->chunk(0));
+  ASSERT_EQ("ccc", strings->GetString(2));
+  auto lists = std::static_pointer_cast<ListArray>(table->column(5)->data()->chunk(0));
+  ASSERT_EQ(2, lists->value_length(0));
+  ASSERT_EQ(0, lists->value_length(1));
+
+  ASSERT_RAISES(Invalid,
+                TableFromTupleRange(default_memory_pool(), MakeRows(), {"a"}, &table));
+}
+
+TEST(TestTupleRangeFromTable, Roundtrip) {
+  const std::vector<std::string> names = {"i8", "u32", "f64", "bool", "str", "lists"};
+  std::shared_ptr<Table> table;
+  ASSERT_OK(TableFromTupleRange(default_memory_pool(), MakeRows(), names, &table));
+
+  // Across several chunks
+  std::shared_ptr<Table> chunked;
+  ASSERT_OK(ConcatenateTables({table, table}, &chunked));
+  table = chunked;
+  std::vector<RowType> rows(6);
+  ASSERT_OK(TupleRangeFromTable(*table, &rows));
+  std::vector<RowType> expected = MakeRows();
+  const std::vector<RowType> once = MakeRows();
+  expected.insert(expected.end(), once.begin(), once.end());
+  ASSERT_EQ(expected, rows);
+
+  // Mismatched range or types
+  std::vector<RowType> too_few(2);
+  ASSERT_RAISES(Invalid, TupleRangeFromTable(*table, &too_few));
+  std::vector<std::tuple<int8_t, int32_t, double, bool, std::string,
+                         std::vector<std::vector<int64_t>>>>
+      other_types(6);
+  ASSERT_RAISES(TypeError, TupleRangeFromTable(*table, &other_types));
+  std::vector<std::tuple<int8_t>> too_narrow(6);
+  ASSERT_RAISES(Invalid, TupleRangeFromTable(*table, &too_narrow));
+}
+
+TEST(TestTupleRangeFromTable, Nulls) {
+  std::shared_ptr<Array> array;
+  ArrayFromVector<Int64Type, int64_t>({true, false}, {1, 2}, &array);
+  auto table = Table::Make(::arrow::schema({field("f", int64())}), {array});
+  std::vector<std::tuple<int64_t>> rows(2);
+  ASSERT_RAISES(Invalid, TupleRangeFromTable(*table, &rows));
+}
+
+TEST(TestColumnView, Iterate) {
+  std::shared_ptr<Array> a1, a2, a3;
+  ArrayFromVector<DoubleType, double>({1.5, 2.5}, &a1);
+  ArrayFromVector<DoubleType, double>({}, &a2);
+  ArrayFromVector<DoubleType, double>({4.0}, &a3);
+  ChunkedArray data({a1, a2, a3});
+
+  ColumnView<double> view;
+  ASSERT_OK(ColumnView<double>::Make(data, &view));
+  ASSERT_EQ(3, view.size());
+  ASSERT_EQ(std::vector<double>({1.5, 2.5, 4.0}),
+            std::vector<double>(view.begin(), view.end()));
+  ASSERT_EQ(8.0, std::accumulate(view.begin(), view.end(), 0.0));
+  ASSERT_EQ(3, std::distance(view.begin(), view.end()));
+
+  ColumnView<std::string> strings;
+  ASSERT_RAISES(TypeError, ColumnView<std::string>::Make(data, &strings));
+
+  ChunkedArray empty({a2});
+  ASSERT_OK(ColumnView<double>::Make(empty, &view));
+  ASSERT_TRUE(view.begin() == view.end());
+}
+
 }  // namespace stl
 }  // namespace arrow
@@ -18,12 +18,23 @@
 #ifndef ARROW_STL_H
 #define ARROW_STL_H
 
+#include <cstddef>
+#include <iterator>
 #include <memory>
+#include <sstream>
 #include <string>
 #include <tuple>
+#include <type_traits>
 #include <vector>
 
+#include "arrow/array.h"
+#include "arrow/builder.h"
+#include "arrow/memory_pool.h"
+#include "arrow/status.h"
+#include "arrow/table.h"
 #include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
 
 namespace arrow {
 
@@ -32,14 +43,27 @@ class Schema;
 namespace stl {
 
 /// Traits meta class to map standard C/C++ types to equivalent Arrow types.
+///
+/// Besides the Arrow type, each specialization appends a value to the builder
+/// of its BuilderType with AppendRow and reads one from an array of its
+/// ArrayType with GetEntry, non-virtually.
 template <typename T>
 struct ConversionTraits {};
 
-#define ARROW_STL_CONVERSION(c_type, ArrowType_) \
-  template <>                                    \
-  struct ConversionTraits<c_type> {              \
-    using ArrowType = ArrowType_;                \
-    constexpr static bool nullable = false;      \
+#define ARROW_STL_CONVERSION(c_type, ArrowType_)                 \
+  template <>                                                    \
+  struct ConversionTraits<c_type> {                              \
+    using ArrowType = ArrowType_;                                \
+    using BuilderType = TypeTraits<ArrowType_>::BuilderType;     \
+    using ArrayType = TypeTraits<ArrowType_>::ArrayType;         \
+    constexpr static bool nullable = false;                      \
+                                                                 \
+    static Status AppendRow(BuilderType& builder, c_type cell) { \
+      return builder.Append(cell);                               \
+    }                                                            \
+    static c_type GetEntry(const ArrayType& array, int64_t j) {  \
+      return array.Value(j);                                     \
+    }                                                            \
   };
 
 ARROW_STL_CONVERSION(bool, BooleanType)
@@ -53,12 +77,50 @@ ARROW_STL_CONVERSION(uint32_t, UInt32Type)
 ARROW_STL_CONVERSION(uint64_t, UInt64Type)
 ARROW_STL_CONVERSION(float, FloatType)
 ARROW_STL_CONVERSION(double, DoubleType)
-ARROW_STL_CONVERSION(std::string, StringType)
+
+template <>
+struct ConversionTraits<std::string> {
+  using ArrowType = StringType;
+  using BuilderType = StringBuilder;
+  using ArrayType = StringArray;
+  constexpr static bool nullable = false;
+
+  static Status AppendRow(BuilderType& builder, const std::string& cell) {
+    return builder.Append(cell);
+  }
+  static std::string GetEntry(const ArrayType& array, int64_t j) {
+    return array.GetString(j);
+  }
+};
 
 template <typename value_c_type>
 struct ConversionTraits<std::vector<value_c_type>> {
-  using ArrowType = meta::ListType<typename ConversionTraits<value_c_type>::ArrowType>;
+  using ValueTraits = ConversionTraits<value_c_type>;
+  using ArrowType = meta::ListType<typename ValueTraits::ArrowType>;
+  using BuilderType = ListBuilder;
+  using ArrayType = ListArray;
   constexpr static bool nullable = false;
+
+  static Status AppendRow(BuilderType& builder, const std::vector<value_c_type>& cell) {
+    auto& value_builder = checked_cast<
+        typename ValueTraits::BuilderType&>(*builder.value_builder());
+    RETURN_NOT_OK(builder.Append());
+    for (const value_c_type& value : cell) {
+      RETURN_NOT_OK(ValueTraits::AppendRow(value_builder, value));
+    }
+    return Status::OK();
+  }
+  static std::vector<value_c_type> GetEntry(const ArrayType& array, int64_t j) {
+    const std::shared_ptr<Array> values = array.values();
+    const auto& typed_values =
+        checked_cast<const typename ValueTraits::ArrayType&>(*values);
+    std::vector<value_c_type> cell;
+    cell.reserve(static_cast<size_t>(array.value_length(j)));
+    for (int64_t k = array.value_offset(j); k < array.value_offset(j + 1); ++k) {
+      cell.push_back(ValueTraits::GetEntry(typed_values, k));
+    }
+    return cell;
+  }
 };
 
 /// Build an arrow::Schema based upon the types defined in a std::tuple-like structure.
@@ -148,6 +210,245 @@ struct SchemaFromTuple<Tuple, 0> {
 };
 /// @endcond
 
+namespace detail {
+
+// Whether type is the Arrow type of the C++ type T
+template <typename T>
+bool IsConversionType(const DataType& type) {
+  return type.Equals(typename ConversionTraits<T>::ArrowType());
+}
+
+// Convert the columns of the elements 0 to N - 1 of the tuples
+template <typename Tuple, std::size_t N = std::tuple_size<Tuple>::value>
+struct TupleColumns {
+  using Element = typename std::tuple_element<N - 1, Tuple>::type;
+  using Traits = ConversionTraits<Element>;
+  using Previous = TupleColumns<Tuple, N - 1>;
+
+  static Status AppendRow(const std::vector<std::unique_ptr<ArrayBuilder>>& builders,
+                          const Tuple& row) {
+    RETURN_NOT_OK(Previous::AppendRow(builders, row));
+    auto& builder =
+        checked_cast<typename Traits::BuilderType&>(*builders[N - 1]);
+    return Traits::AppendRow(builder, std::get<N - 1>(row));
+  }
+
+  static Status CheckTypes(const Table& table) {
+    RETURN_NOT_OK(Previous::CheckTypes(table));
+    const Column& column = *table.column(static_cast<int>(N - 1));
+    if (!IsConversionType<Element>(*column.type())) {
+      std::stringstream ss;
+      ss << "Column '" << column.name() << "' of type " << column.type()->ToString()
+         << " does not match the C++ type of its tuple element";
+      return Status::TypeError(ss.str());
+    }
+    if (column.null_count() != 0) {
+      std::stringstream ss;
+      ss << "Column '" << column.name() << "' has nulls, tuple elements cannot be null";
+      return Status::Invalid(ss.str());
+    }
+    return Status::OK();
+  }
+
+  // Write each column as a whole, walking its chunks once
+  template <typename Iterator>
+  static void GetRows(const Table& table, Iterator rows) {
+    Previous::GetRows(table, rows);
+    const ChunkedArray& data = *table.column(static_cast<int>(N - 1))->data();
+    for (const std::shared_ptr<Array>& chunk : data.chunks()) {
+      const auto& array =
+          checked_cast<const typename Traits::ArrayType&>(*chunk);
+      for (int64_t j = 0; j < array.length(); ++j, ++rows) {
+        std::get<N - 1>(*rows) = Traits::GetEntry(array, j);
+      }
+    }
+  }
+};
+
+template <typename Tuple>
+struct TupleColumns<Tuple, 0> {
+  static Status AppendRow(const std::vector<std::unique_ptr<ArrayBuilder>>& builders,
+                          const Tuple& row) {
+    return Status::OK();
+  }
+
+  static Status CheckTypes(const Table& table) { return Status::OK(); }
+
+  template <typename Iterator>
+  static void GetRows(const Table& table, Iterator rows) {}
+};
+
+}  // namespace detail
+
+/// \brief Build a Table from a range of std::tuple-like rows
+///
+/// The columns are built by the builders of the types given by
+/// ConversionTraits, each value appended without virtual dispatch.
+///
+/// \code{.cpp}
+/// std::vector<std::tuple<int64_t, std::string>> rows = {{1, "a"}, {2, "b"}};
+/// std::shared_ptr<Table> table;
+/// RETURN_NOT_OK(TableFromTupleRange(default_memory_pool(), rows, {"id", "name"},
+///                                   &table));
+/// \endcode
+///
+/// \param[in] pool the pool to allocate the columns from
+/// \param[in] rows the range of tuples, one per row
+/// \param[in] names the names of the columns
+/// \param[out] table the resulting table
+template <typename Range>
+Status TableFromTupleRange(MemoryPool* pool, const Range& rows,
+                           const std::vector<std::string>& names,
+                           std::shared_ptr<Table>* table) {
+  using row_type = typename std::decay<decltype(*std::begin(rows))>::type;
+  constexpr std::size_t n_columns = std::tuple_size<row_type>::value;
+  if (names.size() != n_columns) {
+    return Status::Invalid("There must be one name per tuple element");
+  }
+
+  std::shared_ptr<Schema> schema = SchemaFromTuple<row_type>::MakeSchema(names);
+  std::vector<std::unique_ptr<ArrayBuilder>> builders(n_columns);
+  for (std::size_t i = 0; i < n_columns; ++i) {
+    RETURN_NOT_OK(MakeBuilder(pool, schema->field(static_cast<int>(i))->type(),
+                              &builders[i]));
+  }
+  for (const row_type& row : rows) {
+    RETURN_NOT_OK(detail::TupleColumns<row_type>::AppendRow(builders, row));
+  }
+
+  std::vector<std::shared_ptr<Array>> arrays(n_columns);
+  for (std::size_t i = 0; i < n_columns; ++i) {
+    RETURN_NOT_OK(builders[i]->Finish(&arrays[i]));
+  }
+  *table = Table::Make(schema, arrays);
+  return Status::OK();
+}
+
+/// \brief Write the rows of a Table into a range of std::tuple-like rows
+///
+/// The range must already have one tuple per row, its elements are assigned.
+/// The columns must have the Arrow types of the tuple elements given by
+/// ConversionTraits, and no nulls.
+///
+/// \param[in] table the table to convert
+/// \param[in,out] rows the range of tuples to write
+template <typename Range>
+Status TupleRangeFromTable(const Table& table, Range* rows) {
+  using row_type = typename std::decay<decltype(*std::begin(*rows))>::type;
+  constexpr std::size_t n_columns = std::tuple_size<row_type>::value;
+  if (table.num_columns() != static_cast<int>(n_columns)) {
+    std::stringstream ss;
+    ss << "Table has " << table.num_columns() << " columns but the tuples have "
+       << n_columns << " elements";
+    return Status::Invalid(ss.str());
+  }
+  const auto n_rows = std::distance(std::begin(*rows), std::end(*rows));
+  if (static_cast<int64_t>(n_rows) != table.num_rows()) {
+    std::stringstream ss;
+    ss << "Table has " << table.num_rows() << " rows but the range has " << n_rows;
+    return Status::Invalid(ss.str());
+  }
+  RETURN_NOT_OK(detail::TupleColumns<row_type>::CheckTypes(table));
+  detail::TupleColumns<row_type>::GetRows(table, std::begin(*rows));
+  return Status::OK();
+}
+
+/// \brief A view of the values of a chunked column as the C++ type T, read
+/// from the arrays without copying them
+///
+/// The iterators are STL-compatible forward iterators. The view refers to the
+/// chunks of the column, which must outlive it.
+///
+/// \code{.cpp}
+/// ColumnView<double> view;
+/// RETURN_NOT_OK(ColumnView<double>::Make(*table->column(0)->data(), &view));
+/// double total = std::accumulate(view.begin(), view.end(), 0.0);
+/// \endcode
+template <typename T>
+class ColumnView {
+ public:
+  using Traits = ConversionTraits<T>;
+  using ArrayType = typename Traits::ArrayType;
+
+  class const_iterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T*;
+    using reference = T;
+
+    const_iterator() = default;
+
+    T operator*() const { return Traits::GetEntry(*(*chunks_)[chunk_], index_); }
+
+    const_iterator& operator++() {
+      ++index_;
+      SkipExhaustedChunks();
+      return *this;
+    }
+
+    const_iterator operator++(int) {
+      const_iterator copy = *this;
+      ++*this;
+      return copy;
+    }
+
+    bool operator==(const const_iterator& other) const {
+      return chunk_ == other.chunk_ && index_ == other.index_;
+    }
+    bool operator!=(const const_iterator& other) const { return !(*this == other); }
+
+   private:
+    friend class ColumnView;
+
+    const_iterator(const std::vector<const ArrayType*>* chunks, size_t chunk)
+        : chunks_(chunks), chunk_(chunk), index_(0) {
+      SkipExhaustedChunks();
+    }
+
+    void SkipExhaustedChunks() {
+      while (chunk_ < chunks_->size() && index_ == (*chunks_)[chunk_]->length()) {
+        ++chunk_;
+        index_ = 0;
+      }
+    }
+
+    const std::vector<const ArrayType*>* chunks_ = NULLPTR;
+    size_t chunk_ = 0;
+    int64_t index_ = 0;
+  };
+
+  ColumnView() = default;
+
+  /// \brief Make a view of data, which must have the Arrow type of T
+  static Status Make(const ChunkedArray& data, ColumnView* out) {
+    if (!detail::IsConversionType<T>(*data.type())) {
+      std::stringstream ss;
+      ss << "Cannot view an array of type " << data.type()->ToString()
+         << " as another C++ type";
+      return Status::TypeError(ss.str());
+    }
+    out->chunks_.clear();
+    for (const std::shared_ptr<Array>& chunk : data.chunks()) {
+      out->chunks_.push_back(
+          &checked_cast<const ArrayType&>(*chunk));
+    }
+    out->length_ = data.length();
+    return Status::OK();
+  }
+
+  const_iterator begin() const { return const_iterator(&chunks_, 0); }
+  const_iterator end() const { return const_iterator(&chunks_, chunks_.size()); }
+
+  /// \brief The number of values, null slots reading as the value under them
+  int64_t size() const { return length_; }
+
+ private:
+  std::vector<const ArrayType*> chunks_;
+  int64_t length_ = 0;
+};
+
 }  // namespace stl
 }  // namespace arrow
 
@@ -110,6 +110,25 @@ TEST_F(TestChunkedArray, EqualsDifferingLengths) {
   ASSERT_TRUE(one_->Equals(*another_.get()));
 }
 
+TEST_F(TestChunkedArray, ApproxEquals) {
+  std::vector<bool> is_valid = {true, false, true, true};
+  std::shared_ptr<Array> array, close, far;
+  ArrayFromVector<DoubleType, double>(is_valid, {1.0, 2.0, 3.0, 4.0}, &array);
+  ArrayFromVector<DoubleType, double>(is_valid, {1.0, 5.0, 3.000001, 4.0}, &close);
+  ArrayFromVector<DoubleType, double>(is_valid, {1.0, 2.0, 3.1, 4.0}, &far);
+
+  // Chunked differently
+  arrays_one_ = {array, array};
+  arrays_another_ = {close->Slice(0, 1), close->Slice(1), close};
+  Construct();
+  ASSERT_FALSE(one_->Equals(*another_));
+  ASSERT_TRUE(one_->ApproxEquals(*another_));
+
+  arrays_another_ = {array->Slice(0, 3), far, array->Slice(3)};
+  Construct();
+  ASSERT_FALSE(one_->ApproxEquals(*another_));
+}
+
 TEST_F(TestChunkedArray, SliceEquals) {
   arrays_one_.push_back(MakeRandomArray<Int32Array>(100));
   arrays_one_.push_back(MakeRandomArray<Int32Array>(50));
@@ -360,6 +379,37 @@ TEST_F(TestTable, Equals) {
   ASSERT_FALSE(table_->Equals(*other));
 }
 
+TEST_F(TestTable, EqualsUseThreads) {
+  const int ncolumns = 100;
+  const int64_t length = 1000;
+  std::vector<std::shared_ptr<Field>> fields;
+  std::vector<std::shared_ptr<Column>> columns, other_columns;
+  for (int i = 0; i < ncolumns; ++i) {
+    fields.push_back(field("f" + std::to_string(i), int32()));
+    auto array = MakeRandomArray<Int32Array>(length, 10);
+    columns.push_back(std::make_shared<Column>(fields.back(), array));
+    // Chunked differently
+    other_columns.push_back(std::make_shared<Column>(
+        fields.back(), ArrayVector{array->Slice(0, 300), array->Slice(300)}));
+  }
+  auto wide_schema = ::arrow::schema(fields);
+  auto table = Table::Make(wide_schema, columns);
+  auto other = Table::Make(wide_schema, other_columns);
+  for (bool use_threads : {false, true}) {
+    ASSERT_TRUE(table->Equals(*other, use_threads));
+    ASSERT_TRUE(table->ApproxEquals(*other, use_threads));
+  }
+
+  // A difference in a single column
+  other_columns[ncolumns / 2] = std::make_shared<Column>(
+      fields[ncolumns / 2], MakeRandomArray<Int32Array>(length, 10));
+  other = Table::Make(wide_schema, other_columns);
+  for (bool use_threads : {false, true}) {
+    ASSERT_FALSE(table->Equals(*other, use_threads));
+    ASSERT_FALSE(table->ApproxEquals(*other, use_threads));
+  }
+}
+
 TEST_F(TestTable, FromRecordBatches) {
   const int64_t length = 10;
   MakeExample1(length);
@@ -404,6 +454,49 @@ TEST_F(TestTable, FromRecordBatchesZeroLength) {
   ASSERT_TRUE(result->schema()->Equals(*schema_));
 }
 
+TEST_F(TestTable, WideTableUseThreads) {
+  // Every other column a struct of two fields
+  const int ncolumns = 300;
+  const int64_t length = 10;
+  std::vector<std::shared_ptr<Field>> fields, flat_fields;
+  std::vector<std::shared_ptr<Array>> arrays, flat_arrays;
+  for (int i = 0; i < ncolumns; ++i) {
+    auto child = MakeRandomArray<Int32Array>(length, 2);
+    const std::string name = "f" + std::to_string(i);
+    if (i % 2 == 0) {
+      fields.push_back(field(name, int32()));
+      arrays.push_back(child);
+      flat_fields.push_back(fields.back());
+      flat_arrays.push_back(child);
+    } else {
+      std::vector<std::shared_ptr<Field>> children = {field("a", int32()),
+                                                      field("b", int32())};
+      fields.push_back(field(name, struct_(children)));
+      arrays.push_back(std::make_shared<StructArray>(fields.back()->type(), length,
+                                                     ArrayVector{child, child}));
+      for (const auto& child_field : children) {
+        flat_fields.push_back(field(name + "." + child_field->name(), int32()));
+        flat_arrays.push_back(child);
+      }
+    }
+  }
+  auto wide_schema = ::arrow::schema(fields);
+  auto batch = RecordBatch::Make(wide_schema, length, arrays);
+
+  std::shared_ptr<Table> expected, result, flattened;
+  ASSERT_OK(Table::FromRecordBatches({batch, batch}, &expected));
+  ASSERT_OK(Table::FromRecordBatches({batch, batch}, &result, true /* use_threads */));
+  ASSERT_EQ(2, result->column(ncolumns - 1)->data()->num_chunks());
+  test::AssertTablesEqual(*expected, *result);
+
+  auto batch_flat = RecordBatch::Make(::arrow::schema(flat_fields), length, flat_arrays);
+  ASSERT_OK(Table::FromRecordBatches({batch_flat, batch_flat}, &expected));
+  ASSERT_OK(result->Flatten(default_memory_pool(), &flattened, true /* use_threads */));
+  ASSERT_EQ(ncolumns * 3 / 2, flattened->num_columns());
+  ASSERT_TRUE(flattened->schema()->Equals(*expected->schema()));
+  test::AssertTablesEqual(*expected, *flattened);
+}
+
 TEST_F(TestTable, ConcatenateTables) {
   const int64_t length = 10;
 
@@ -435,6 +528,26 @@ TEST_F(TestTable, ConcatenateTables) {
   ASSERT_RAISES(Invalid, ConcatenateTables({t1, t3}, &result));
 }
 
+TEST_F(TestTable, CombineChunks) {
+  auto a1 = MakeRandomArray<Int32Array>(10);
+  auto a2 = MakeRandomArray<Int32Array>(20);
+  auto a3 = MakeRandomArray<Int32Array>(30);
+
+  auto sch = arrow::schema({field("f1", int32()), field("f2", int32())});
+  auto table = Table::Make(
+      sch, {column(sch->field(0), {a1, a2}), column(sch->field(1), {a3})});
+
+  for (bool use_threads : {false, true}) {
+    std::shared_ptr<Table> combined;
+    ASSERT_OK(table->CombineChunks(default_memory_pool(), &combined, use_threads));
+    ASSERT_OK(combined->Validate());
+    ASSERT_TRUE(combined->Equals(*table));
+    ASSERT_EQ(1, combined->column(0)->data()->num_chunks());
+    // Not copied
+    ASSERT_EQ(table->column(1), combined->column(1));
+  }
+}
+
 TEST_F(TestTable, RemoveColumn) {
   const int64_t length = 10;
   MakeExample1(length);
@@ -465,6 +578,72 @@ TEST_F(TestTable, RemoveColumn) {
   ASSERT_TRUE(result->Equals(*expected));
 }
 
+TEST_F(TestTable, Slice) {
+  const int64_t length = 10;
+  MakeExample1(length);
+
+  auto table = Table::Make(schema_, columns_);
+
+  auto sliced = table->Slice(2, 6);
+  ASSERT_OK(sliced->Validate());
+  ASSERT_EQ(6, sliced->num_rows());
+  ASSERT_EQ(3, sliced->num_columns());
+  for (int i = 0; i < sliced->num_columns(); ++i) {
+    ASSERT_TRUE(sliced->column(i)->Equals(table->column(i)->Slice(2, 6)));
+  }
+  // Columns are sliced once
+  ASSERT_EQ(sliced->column(1), sliced->column(1));
+
+  // Slices of slices are slices of the original table
+  auto twice = sliced->Slice(1);
+  ASSERT_EQ(5, twice->num_rows());
+  ASSERT_TRUE(twice->Equals(*table->Slice(3, 5)));
+
+  // Out of range lengths are clamped
+  ASSERT_EQ(2, table->Slice(8, 10)->num_rows());
+  ASSERT_EQ(0, sliced->Slice(10)->num_rows());
+
+  // A full slice shares the columns
+  auto full = table->Slice(0);
+  ASSERT_EQ(table->column(0), full->column(0));
+
+  std::shared_ptr<Table> result;
+  ASSERT_OK(sliced->RemoveColumn(0, &result));
+  ASSERT_OK(result->Validate());
+  ASSERT_EQ(2, result->num_columns());
+  ASSERT_TRUE(result->column(0)->Equals(table->column(1)->Slice(2, 6)));
+
+  ASSERT_OK(sliced->AddColumn(0, sliced->column(2), &result));
+  ASSERT_OK(result->Validate());
+  ASSERT_EQ(4, result->num_columns());
+  ASSERT_RAISES(Invalid, sliced->AddColumn(0, table->column(0), &result));
+}
+
+TEST_F(TestTable, SelectColumns) {
+  const int64_t length = 10;
+  MakeExample1(length);
+
+  auto table = Table::Make(schema_, columns_);
+
+  std::shared_ptr<Table> result;
+  ASSERT_OK(table->SelectColumns({2, 0}, &result));
+  auto ex_schema = ::arrow::schema({schema_->field(2), schema_->field(0)});
+  auto expected = Table::Make(ex_schema, {table->column(2), table->column(0)});
+  ASSERT_TRUE(result->Equals(*expected));
+
+  // Selecting from a slice composes with it
+  ASSERT_OK(table->Slice(4)->SelectColumns({1, 1}, &result));
+  ASSERT_OK(result->Validate());
+  ex_schema = ::arrow::schema({schema_->field(1), schema_->field(1)});
+  expected =
+      Table::Make(ex_schema, {table->column(1)->Slice(4), table->column(1)->Slice(4)});
+  ASSERT_TRUE(result->Equals(*expected));
+  ASSERT_TRUE(result->Slice(1, 2)->Equals(*expected->Slice(1, 2)));
+
+  ASSERT_RAISES(Invalid, table->SelectColumns({3}, &result));
+  ASSERT_RAISES(Invalid, table->Slice(1)->SelectColumns({-1}, &result));
+}
+
 TEST_F(TestTable, SetColumn) {
   const int64_t length = 10;
   MakeExample1(length);
@@ -830,4 +1009,53 @@ TEST_F(TestTableBatchReader, Chunksize) {
   ASSERT_EQ(nullptr, batch);
 }
 
+TEST_F(TestTableBatchReader, MinChunksize) {
+  auto a1 = MakeRandomArray<Int32Array>(5);
+  auto a2 = MakeRandomArray<Int32Array>(5);
+  auto a3 = MakeRandomArray<Int32Array>(30);
+  auto b = MakeRandomArray<Int32Array>(40);
+
+  auto sch = arrow::schema({field("f1", int32()), field("f2", int32())});
+  auto t1 = Table::Make(
+      sch, {column(sch->field(0), {a1, a2, a3}), column(sch->field(1), {b})});
+  std::shared_ptr<Table> combined;
+  ASSERT_OK(t1->CombineChunks(default_memory_pool(), &combined));
+  auto expected = combined->column(0)->data()->chunk(0);
+
+  TableBatchReader i1(*t1);
+  i1.set_min_chunksize(12);
+
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(i1.ReadNext(&batch));
+  ASSERT_OK(batch->Validate());
+  ASSERT_EQ(12, batch->num_rows());
+  ASSERT_TRUE(batch->column(0)->Equals(expected->Slice(0, 12)));
+  // The column which has enough rows in its chunk is only sliced
+  ASSERT_EQ(b->data()->buffers[1], batch->column_data(1)->buffers[1]);
+  ASSERT_TRUE(batch->column(1)->Equals(b->Slice(0, 12)));
+
+  ASSERT_OK(i1.ReadNext(&batch));
+  ASSERT_OK(batch->Validate());
+  ASSERT_EQ(28, batch->num_rows());
+  ASSERT_EQ(a3->data()->buffers[1], batch->column_data(0)->buffers[1]);
+  ASSERT_TRUE(batch->column(0)->Equals(expected->Slice(12)));
+
+  ASSERT_OK(i1.ReadNext(&batch));
+  ASSERT_EQ(nullptr, batch);
+
+  // The maximum chunksize wins
+  TableBatchReader i2(*t1);
+  i2.set_chunksize(8);
+  i2.set_min_chunksize(12);
+  for (int64_t offset = 0; offset < 40; offset += 8) {
+    ASSERT_OK(i2.ReadNext(&batch));
+    ASSERT_OK(batch->Validate());
+    ASSERT_EQ(8, batch->num_rows());
+    ASSERT_TRUE(batch->column(0)->Equals(expected->Slice(offset, 8)));
+    ASSERT_TRUE(batch->column(1)->Equals(b->Slice(offset, 8)));
+  }
+  ASSERT_OK(i2.ReadNext(&batch));
+  ASSERT_EQ(nullptr, batch);
+}
+
 }  // namespace arrow
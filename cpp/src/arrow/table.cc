@@ -18,17 +18,22 @@
 #include "arrow/table.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstdlib>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <utility>
 
 #include "arrow/array.h"
+#include "arrow/compare.h"
+#include "arrow/concatenate.h"
 #include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
 #include "arrow/util/stl.h"
 
 namespace arrow {
@@ -36,78 +41,107 @@ namespace arrow {
 // ----------------------------------------------------------------------
 // ChunkedArray and Column methods
 
-ChunkedArray::ChunkedArray(const ArrayVector& chunks) : chunks_(chunks) {
+ChunkedArray::ChunkedArray(ArrayVector chunks) : chunks_(std::move(chunks)) {
   length_ = 0;
   null_count_ = 0;
-  DCHECK_GT(chunks.size(), 0)
+  DCHECK_GT(chunks_.size(), 0)
       << "cannot construct ChunkedArray from empty vector and omitted type";
-  type_ = chunks[0]->type();
-  for (const std::shared_ptr<Array>& chunk : chunks) {
+  type_ = chunks_[0]->type();
+  for (const std::shared_ptr<Array>& chunk : chunks_) {
     length_ += chunk->length();
     null_count_ += chunk->null_count();
   }
 }
 
-ChunkedArray::ChunkedArray(const ArrayVector& chunks,
-                           const std::shared_ptr<DataType>& type)
-    : chunks_(chunks), type_(type) {
+ChunkedArray::ChunkedArray(ArrayVector chunks, const std::shared_ptr<DataType>& type)
+    : chunks_(std::move(chunks)), type_(type) {
   length_ = 0;
   null_count_ = 0;
-  for (const std::shared_ptr<Array>& chunk : chunks) {
+  for (const std::shared_ptr<Array>& chunk : chunks_) {
     length_ += chunk->length();
     null_count_ += chunk->null_count();
   }
 }
 
-bool ChunkedArray::Equals(const ChunkedArray& other) const {
-  if (length_ != other.length()) {
+namespace {
+
+// Compare the contents of two chunked arrays independently of their chunk
+// sizes, a piece shared by a chunk of each at a time.  Whole chunks are
+// compared as such and others sliced, so that the comparison can use the
+// fast paths of ArrayEquals.  Gives up, returning false, once cancelled is
+// set.
+template <typename CompareArrays>
+bool ChunkedEquals(const ChunkedArray& left, const ChunkedArray& right,
+                   CompareArrays&& compare,
+                   const std::atomic<bool>* cancelled = nullptr) {
+  if (left.length() != right.length()) {
     return false;
   }
-  if (null_count_ != other.null_count()) {
+  if (left.null_count() != right.null_count()) {
     return false;
   }
-  if (length_ == 0) {
-    return type_->Equals(other.type_);
+  if (left.length() == 0) {
+    return left.type()->Equals(right.type());
   }
 
-  // Check contents of the underlying arrays. This checks for equality of
-  // the underlying data independently of the chunk size.
-  int this_chunk_idx = 0;
-  int64_t this_start_idx = 0;
-  int other_chunk_idx = 0;
-  int64_t other_start_idx = 0;
+  int left_chunk_idx = 0;
+  int64_t left_start_idx = 0;
+  int right_chunk_idx = 0;
+  int64_t right_start_idx = 0;
 
   int64_t elements_compared = 0;
-  while (elements_compared < length_) {
-    const std::shared_ptr<Array> this_array = chunks_[this_chunk_idx];
-    const std::shared_ptr<Array> other_array = other.chunk(other_chunk_idx);
-    int64_t common_length = std::min(this_array->length() - this_start_idx,
-                                     other_array->length() - other_start_idx);
-    if (!this_array->RangeEquals(this_start_idx, this_start_idx + common_length,
-                                 other_start_idx, other_array)) {
+  while (elements_compared < left.length()) {
+    if (cancelled != nullptr && cancelled->load()) {
+      return false;
+    }
+    const std::shared_ptr<Array> left_array = left.chunk(left_chunk_idx);
+    const std::shared_ptr<Array> right_array = right.chunk(right_chunk_idx);
+    int64_t common_length = std::min(left_array->length() - left_start_idx,
+                                     right_array->length() - right_start_idx);
+    if (common_length == left_array->length() &&
+        common_length == right_array->length()) {
+      if (!compare(*left_array, *right_array)) {
+        return false;
+      }
+    } else if (!compare(*left_array->Slice(left_start_idx, common_length),
+                        *right_array->Slice(right_start_idx, common_length))) {
       return false;
     }
 
     elements_compared += common_length;
 
     // If we have exhausted the current chunk, proceed to the next one individually.
-    if (this_start_idx + common_length == this_array->length()) {
-      this_chunk_idx++;
-      this_start_idx = 0;
+    if (left_start_idx + common_length == left_array->length()) {
+      left_chunk_idx++;
+      left_start_idx = 0;
     } else {
-      this_start_idx += common_length;
+      left_start_idx += common_length;
     }
 
-    if (other_start_idx + common_length == other_array->length()) {
-      other_chunk_idx++;
-      other_start_idx = 0;
+    if (right_start_idx + common_length == right_array->length()) {
+      right_chunk_idx++;
+      right_start_idx = 0;
     } else {
-      other_start_idx += common_length;
+      right_start_idx += common_length;
     }
   }
   return true;
 }
 
+bool ArraysEqual(const Array& left, const Array& right) {
+  return ArrayEquals(left, right);
+}
+
+bool ArraysApproxEqual(const Array& left, const Array& right) {
+  return ArrayApproxEquals(left, right);
+}
+
+}  // namespace
+
+bool ChunkedArray::Equals(const ChunkedArray& other) const {
+  return ChunkedEquals(*this, other, ArraysEqual);
+}
+
 bool ChunkedArray::Equals(const std::shared_ptr<ChunkedArray>& other) const {
   if (this == other.get()) {
     return true;
@@ -118,6 +152,10 @@ bool ChunkedArray::Equals(const std::shared_ptr<ChunkedArray>& other) const {
   return Equals(*other.get());
 }
 
+bool ChunkedArray::ApproxEquals(const ChunkedArray& other) const {
+  return ChunkedEquals(*this, other, ArraysApproxEqual);
+}
+
 std::shared_ptr<ChunkedArray> ChunkedArray::Slice(int64_t offset, int64_t length) const {
   DCHECK_LE(offset, length_);
 
@@ -129,7 +167,13 @@ std::shared_ptr<ChunkedArray> ChunkedArray::Slice(int64_t offset, int64_t length
 
   ArrayVector new_chunks;
   while (curr_chunk < num_chunks() && length > 0) {
-    new_chunks.push_back(chunk(curr_chunk)->Slice(offset, length));
+    const std::shared_ptr<Array>& current = chunk(curr_chunk);
+    // Chunks wholly within the slice are shared rather than sliced
+    if (offset == 0 && length >= current->length()) {
+      new_chunks.push_back(current);
+    } else {
+      new_chunks.push_back(current->Slice(offset, length));
+    }
     length -= chunk(curr_chunk)->length() - offset;
     offset = 0;
     curr_chunk++;
@@ -167,10 +211,10 @@ Status ChunkedArray::Flatten(MemoryPool* pool,
       }
     }
   }
-  for (const auto& vec : flattened_chunks) {
-    flattened.emplace_back(std::make_shared<ChunkedArray>(vec));
+  for (auto& vec : flattened_chunks) {
+    flattened.emplace_back(std::make_shared<ChunkedArray>(std::move(vec)));
   }
-  *out = flattened;
+  *out = std::move(flattened);
   return Status::OK();
 }
 
@@ -205,7 +249,7 @@ Status Column::Flatten(MemoryPool* pool,
   for (size_t i = 0; i < flattened_fields.size(); ++i) {
     flattened.push_back(std::make_shared<Column>(flattened_fields[i], flattened_data[i]));
   }
-  *out = flattened;
+  *out = std::move(flattened);
   return Status::OK();
 }
 
@@ -227,6 +271,13 @@ bool Column::Equals(const std::shared_ptr<Column>& other) const {
   return Equals(*other.get());
 }
 
+bool Column::ApproxEquals(const Column& other) const {
+  if (!field_->Equals(other.field())) {
+    return false;
+  }
+  return data_->ApproxEquals(*other.data());
+}
+
 Status Column::ValidateData() {
   for (int i = 0; i < data_->num_chunks(); ++i) {
     std::shared_ptr<DataType> type = data_->chunk(i)->type();
@@ -335,15 +386,25 @@ class SimpleTable : public Table {
     return Table::Make(new_schema, columns_);
   }
 
-  Status Flatten(MemoryPool* pool, std::shared_ptr<Table>* out) const override {
+  Status Flatten(MemoryPool* pool, std::shared_ptr<Table>* out,
+                 bool use_threads) const override {
+    const int ncolumns = num_columns();
+    std::vector<std::vector<std::shared_ptr<Column>>> new_columns(ncolumns);
+    auto FlattenOne = [&](int i) { return columns_[i]->Flatten(pool, &new_columns[i]); };
+    if (use_threads) {
+      RETURN_NOT_OK(ParallelFor(ncolumns, FlattenOne));
+    } else {
+      for (int i = 0; i < ncolumns; ++i) {
+        RETURN_NOT_OK(FlattenOne(i));
+      }
+    }
+
     std::vector<std::shared_ptr<Field>> flattened_fields;
     std::vector<std::shared_ptr<Column>> flattened_columns;
-    for (const auto& column : columns_) {
-      std::vector<std::shared_ptr<Column>> new_columns;
-      RETURN_NOT_OK(column->Flatten(pool, &new_columns));
-      for (const auto& new_col : new_columns) {
+    for (auto& columns : new_columns) {
+      for (auto& new_col : columns) {
         flattened_fields.push_back(new_col->field());
-        flattened_columns.push_back(new_col);
+        flattened_columns.push_back(std::move(new_col));
       }
     }
     auto flattened_schema =
@@ -389,8 +450,174 @@ class SimpleTable : public Table {
   std::vector<std::shared_ptr<Column>> columns_;
 };
 
+using ColumnVector = std::vector<std::shared_ptr<Column>>;
+
+// Check the column indices of a selection against the number of columns and
+// gather the selected fields
+static Status SelectFields(const Schema& schema, const std::vector<int>& indices,
+                           std::shared_ptr<Schema>* out) {
+  std::vector<std::shared_ptr<Field>> fields;
+  fields.reserve(indices.size());
+  for (int i : indices) {
+    if (i < 0 || i >= schema.num_fields()) {
+      std::stringstream ss;
+      ss << "Column index " << i << " out of bounds for a table of "
+         << schema.num_fields() << " columns";
+      return Status::Invalid(ss.str());
+    }
+    fields.push_back(schema.field(i));
+  }
+  *out = std::make_shared<Schema>(fields, schema.metadata());
+  return Status::OK();
+}
+
+/// \class TableView
+/// \brief A lazy table of a range of rows of some columns of another
+///
+/// The columns are shared with the viewed table and only sliced when
+/// accessed, once each. Views of a view refer to the same columns, so that
+/// chains of slices and selections don't slice at every step.
+class TableView : public Table {
+ public:
+  TableView(const std::shared_ptr<Schema>& schema,
+            const std::shared_ptr<const ColumnVector>& columns, int64_t offset,
+            int64_t num_rows)
+      : columns_(columns), offset_(offset), sliced_(columns->size()) {
+    schema_ = schema;
+    num_rows_ = num_rows;
+  }
+
+  using Table::Slice;
+
+  std::shared_ptr<Column> column(int i) const override {
+    const std::shared_ptr<Column>& col = (*columns_)[i];
+    if (offset_ == 0 && num_rows_ == col->length()) {
+      return col;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (sliced_[i] == nullptr) {
+      sliced_[i] = col->Slice(offset_, num_rows_);
+    }
+    return sliced_[i];
+  }
+
+  std::shared_ptr<Table> Slice(int64_t offset, int64_t length) const override {
+    offset = std::min(offset, num_rows_);
+    length = std::min(length, num_rows_ - offset);
+    return std::make_shared<TableView>(schema_, columns_, offset_ + offset, length);
+  }
+
+  Status SelectColumns(const std::vector<int>& indices,
+                       std::shared_ptr<Table>* out) const override {
+    std::shared_ptr<Schema> new_schema;
+    RETURN_NOT_OK(SelectFields(*schema_, indices, &new_schema));
+    auto selected = std::make_shared<ColumnVector>();
+    selected->reserve(indices.size());
+    for (int i : indices) {
+      selected->push_back((*columns_)[i]);
+    }
+    *out = std::make_shared<TableView>(new_schema, selected, offset_, num_rows_);
+    return Status::OK();
+  }
+
+  Status RemoveColumn(int i, std::shared_ptr<Table>* out) const override {
+    if (i < 0 || i >= num_columns()) {
+      return Status::Invalid("Column index out of bounds");
+    }
+    std::vector<int> indices;
+    for (int j = 0; j < num_columns(); ++j) {
+      if (j != i) {
+        indices.push_back(j);
+      }
+    }
+    return SelectColumns(indices, out);
+  }
+
+  Status AddColumn(int i, const std::shared_ptr<Column>& col,
+                   std::shared_ptr<Table>* out) const override {
+    return Materialize()->AddColumn(i, col, out);
+  }
+
+  Status SetColumn(int i, const std::shared_ptr<Column>& col,
+                   std::shared_ptr<Table>* out) const override {
+    return Materialize()->SetColumn(i, col, out);
+  }
+
+  std::shared_ptr<Table> ReplaceSchemaMetadata(
+      const std::shared_ptr<const KeyValueMetadata>& metadata) const override {
+    auto new_schema = schema_->AddMetadata(metadata);
+    return std::make_shared<TableView>(new_schema, columns_, offset_, num_rows_);
+  }
+
+  Status Flatten(MemoryPool* pool, std::shared_ptr<Table>* out,
+                 bool use_threads) const override {
+    return Materialize()->Flatten(pool, out, use_threads);
+  }
+
+  Status Validate() const override {
+    if (static_cast<int>(columns_->size()) != schema_->num_fields()) {
+      return Status::Invalid("Number of columns did not match schema");
+    }
+    for (int i = 0; i < num_columns(); ++i) {
+      const Column& col = *(*columns_)[i];
+      if (!col.field()->Equals(*schema_->field(i))) {
+        std::stringstream ss;
+        ss << "Column field " << i << " named " << col.name()
+           << " is inconsistent with schema";
+        return Status::Invalid(ss.str());
+      }
+      if (col.length() < offset_ + num_rows_) {
+        std::stringstream ss;
+        ss << "Column " << i << " named " << col.name() << " of length "
+           << col.length() << " is too short for rows " << offset_ << " to "
+           << offset_ + num_rows_;
+        return Status::Invalid(ss.str());
+      }
+    }
+    return Status::OK();
+  }
+
+ private:
+  // A table of the sliced columns, for the operations which produce new ones
+  std::shared_ptr<Table> Materialize() const {
+    ColumnVector columns(columns_->size());
+    for (int i = 0; i < num_columns(); ++i) {
+      columns[i] = column(i);
+    }
+    return Table::Make(schema_, columns, num_rows_);
+  }
+
+  std::shared_ptr<const ColumnVector> columns_;
+  int64_t offset_;
+  mutable std::mutex mutex_;
+  mutable ColumnVector sliced_;
+};
+
 Table::Table() {}
 
+std::shared_ptr<Table> Table::Slice(int64_t offset, int64_t length) const {
+  auto columns = std::make_shared<ColumnVector>(num_columns());
+  for (int i = 0; i < num_columns(); ++i) {
+    (*columns)[i] = column(i);
+  }
+  offset = std::min(offset, num_rows_);
+  length = std::min(length, num_rows_ - offset);
+  return std::make_shared<TableView>(schema_, columns, offset, length);
+}
+
+Status Table::SelectColumns(const std::vector<int>& indices,
+                            std::shared_ptr<Table>* out) const {
+  std::shared_ptr<Schema> new_schema;
+  RETURN_NOT_OK(SelectFields(*schema_, indices, &new_schema));
+  ColumnVector columns;
+  columns.reserve(indices.size());
+  for (int i : indices) {
+    columns.push_back(column(i));
+  }
+  *out = Table::Make(new_schema, columns, num_rows_);
+  return Status::OK();
+}
+
 std::shared_ptr<Table> Table::Make(const std::shared_ptr<Schema>& schema,
                                    const std::vector<std::shared_ptr<Column>>& columns,
                                    int64_t num_rows) {
@@ -405,7 +632,7 @@ std::shared_ptr<Table> Table::Make(const std::shared_ptr<Schema>& schema,
 
 Status Table::FromRecordBatches(const std::shared_ptr<Schema>& schema,
                                 const std::vector<std::shared_ptr<RecordBatch>>& batches,
-                                std::shared_ptr<Table>* table) {
+                                std::shared_ptr<Table>* table, bool use_threads) {
   const int nbatches = static_cast<int>(batches.size());
   const int ncolumns = static_cast<int>(schema->num_fields());
 
@@ -420,26 +647,35 @@ Status Table::FromRecordBatches(const std::shared_ptr<Schema>& schema,
   }
 
   std::vector<std::shared_ptr<Column>> columns(ncolumns);
-  std::vector<std::shared_ptr<Array>> column_arrays(nbatches);
-
-  for (int i = 0; i < ncolumns; ++i) {
+  auto GatherColumn = [&](int i) {
+    ArrayVector column_arrays(nbatches);
     for (int j = 0; j < nbatches; ++j) {
       column_arrays[j] = batches[j]->column(i);
     }
-    columns[i] = std::make_shared<Column>(schema->field(i), column_arrays);
+    const std::shared_ptr<Field> field = schema->field(i);
+    columns[i] = std::make_shared<Column>(
+        field, std::make_shared<ChunkedArray>(std::move(column_arrays), field->type()));
+    return Status::OK();
+  };
+  if (use_threads) {
+    RETURN_NOT_OK(ParallelFor(ncolumns, GatherColumn));
+  } else {
+    for (int i = 0; i < ncolumns; ++i) {
+      RETURN_NOT_OK(GatherColumn(i));
+    }
   }
 
-  *table = Table::Make(schema, columns);
+  *table = Table::Make(schema, std::move(columns));
   return Status::OK();
 }
 
 Status Table::FromRecordBatches(const std::vector<std::shared_ptr<RecordBatch>>& batches,
-                                std::shared_ptr<Table>* table) {
+                                std::shared_ptr<Table>* table, bool use_threads) {
   if (batches.size() == 0) {
     return Status::Invalid("Must pass at least one record batch");
   }
 
-  return FromRecordBatches(batches[0]->schema(), batches, table);
+  return FromRecordBatches(batches[0]->schema(), batches, table, use_threads);
 }
 
 Status ConcatenateTables(const std::vector<std::shared_ptr<Table>>& tables,
@@ -479,23 +715,82 @@ Status ConcatenateTables(const std::vector<std::shared_ptr<Table>>& tables,
   return Status::OK();
 }
 
-bool Table::Equals(const Table& other) const {
-  if (this == &other) {
+namespace {
+
+template <typename CompareArrays>
+bool TablesEqual(const Table& left, const Table& right, bool use_threads,
+                 CompareArrays&& compare) {
+  if (&left == &right) {
     return true;
   }
-  if (!schema_->Equals(*other.schema())) {
+  if (!left.schema()->Equals(*right.schema())) {
     return false;
   }
-  if (this->num_columns() != other.num_columns()) {
+  if (left.num_columns() != right.num_columns()) {
     return false;
   }
 
-  for (int i = 0; i < this->num_columns(); i++) {
-    if (!this->column(i)->Equals(other.column(i))) {
-      return false;
+  // Set at the first difference, for the columns still being compared to
+  // give up
+  std::atomic<bool> differs(false);
+  auto CompareColumn = [&](int i) {
+    const Column& left_column = *left.column(i);
+    const Column& right_column = *right.column(i);
+    if (!left_column.field()->Equals(right_column.field()) ||
+        !ChunkedEquals(*left_column.data(), *right_column.data(), compare, &differs)) {
+      differs = true;
+      // Only to skip the columns not yet started
+      return Status::Invalid("Columns differ");
+    }
+    return Status::OK();
+  };
+  if (use_threads) {
+    ARROW_UNUSED(ParallelFor(left.num_columns(), CompareColumn));
+  } else {
+    for (int i = 0; i < left.num_columns(); ++i) {
+      if (!CompareColumn(i).ok()) {
+        break;
+      }
     }
   }
-  return true;
+  return !differs;
+}
+
+}  // namespace
+
+bool Table::Equals(const Table& other, bool use_threads) const {
+  return TablesEqual(*this, other, use_threads, ArraysEqual);
+}
+
+bool Table::ApproxEquals(const Table& other, bool use_threads) const {
+  return TablesEqual(*this, other, use_threads, ArraysApproxEqual);
+}
+
+Status Table::CombineChunks(MemoryPool* pool, std::shared_ptr<Table>* out,
+                            bool use_threads) const {
+  const int ncolumns = num_columns();
+  std::vector<std::shared_ptr<Column>> columns(ncolumns);
+  auto CombineOne = [&](int i) {
+    std::shared_ptr<Column> col = column(i);
+    const ArrayVector& chunks = col->data()->chunks();
+    if (chunks.size() <= 1) {
+      columns[i] = std::move(col);
+      return Status::OK();
+    }
+    std::shared_ptr<Array> combined;
+    RETURN_NOT_OK(Concatenate(chunks, pool, &combined));
+    columns[i] = std::make_shared<Column>(col->field(), combined);
+    return Status::OK();
+  };
+  if (use_threads) {
+    RETURN_NOT_OK(ParallelFor(ncolumns, CombineOne));
+  } else {
+    for (int i = 0; i < ncolumns; ++i) {
+      RETURN_NOT_OK(CombineOne(i));
+    }
+  }
+  *out = Table::Make(schema_, columns, num_rows_);
+  return Status::OK();
 }
 
 // ----------------------------------------------------------------------
@@ -509,55 +804,40 @@ class TableBatchReader::TableBatchReaderImpl {
         chunk_numbers_(table.num_columns(), 0),
         chunk_offsets_(table.num_columns(), 0),
         absolute_row_position_(0),
-        max_chunksize_(std::numeric_limits<int64_t>::max()) {
+        max_chunksize_(std::numeric_limits<int64_t>::max()),
+        min_chunksize_(0),
+        pool_(default_memory_pool()) {
     for (int i = 0; i < table.num_columns(); ++i) {
       column_data_[i] = table.column(i)->data().get();
     }
   }
 
   Status ReadNext(std::shared_ptr<RecordBatch>* out) {
-    if (absolute_row_position_ == table_.num_rows()) {
+    const int64_t rows_remaining = table_.num_rows() - absolute_row_position_;
+    if (rows_remaining == 0) {
       *out = nullptr;
       return Status::OK();
     }
 
     // Determine the minimum contiguous slice across all columns
-    int64_t chunksize = std::min(table_.num_rows(), max_chunksize_);
-    std::vector<const Array*> chunks(table_.num_columns());
+    int64_t chunksize = std::min(rows_remaining, max_chunksize_);
     for (int i = 0; i < table_.num_columns(); ++i) {
-      auto chunk = column_data_[i]->chunk(chunk_numbers_[i]).get();
-      int64_t chunk_remaining = chunk->length() - chunk_offsets_[i];
-
-      if (chunk_remaining < chunksize) {
-        chunksize = chunk_remaining;
-      }
-
-      chunks[i] = chunk;
+      const Array& chunk = *column_data_[i]->chunk(chunk_numbers_[i]);
+      chunksize = std::min(chunksize, chunk.length() - chunk_offsets_[i]);
     }
 
-    // Slice chunks and advance chunk index as appropriate
     std::vector<std::shared_ptr<ArrayData>> batch_data(table_.num_columns());
-
-    for (int i = 0; i < table_.num_columns(); ++i) {
-      // Exhausted chunk
-      const Array* chunk = chunks[i];
-      const int64_t offset = chunk_offsets_[i];
-      std::shared_ptr<ArrayData> slice_data;
-      if ((chunk->length() - offset) == chunksize) {
-        ++chunk_numbers_[i];
-        chunk_offsets_[i] = 0;
-        if (offset > 0) {
-          // Need to slice
-          slice_data = chunk->Slice(offset, chunksize)->data();
-        } else {
-          // No slice
-          slice_data = chunk->data();
-        }
-      } else {
-        chunk_offsets_[i] += chunksize;
-        slice_data = chunk->Slice(offset, chunksize)->data();
+    if (chunksize < min_chunksize_ && chunksize < rows_remaining &&
+        chunksize < max_chunksize_) {
+      // Too short, gather the rows of the next chunks
+      chunksize = std::min({min_chunksize_, max_chunksize_, rows_remaining});
+      for (int i = 0; i < table_.num_columns(); ++i) {
+        RETURN_NOT_OK(NextConcatenatedSlice(i, chunksize, &batch_data[i]));
+      }
+    } else {
+      for (int i = 0; i < table_.num_columns(); ++i) {
+        batch_data[i] = NextSlice(i, chunksize);
       }
-      batch_data[i] = std::move(slice_data);
     }
 
     absolute_row_position_ += chunksize;
@@ -570,13 +850,60 @@ class TableBatchReader::TableBatchReaderImpl {
 
   void set_chunksize(int64_t chunksize) { max_chunksize_ = chunksize; }
 
+  void set_min_chunksize(int64_t min_chunksize, MemoryPool* pool) {
+    min_chunksize_ = min_chunksize;
+    pool_ = pool;
+  }
+
  private:
+  // Slice up to length rows of the current chunk of column i, advancing to
+  // the next chunk once exhausted. A whole chunk is not sliced
+  std::shared_ptr<ArrayData> NextSlice(int i, int64_t length) {
+    const Array& chunk = *column_data_[i]->chunk(chunk_numbers_[i]);
+    const int64_t offset = chunk_offsets_[i];
+    length = std::min(length, chunk.length() - offset);
+    if (offset + length == chunk.length()) {
+      // Exhausted chunk
+      ++chunk_numbers_[i];
+      chunk_offsets_[i] = 0;
+      if (offset == 0) {
+        return chunk.data();
+      }
+    } else {
+      chunk_offsets_[i] += length;
+    }
+    return chunk.Slice(offset, length)->data();
+  }
+
+  // The next length rows of column i, concatenated from the slices of its
+  // chunks unless the current one has enough of them
+  Status NextConcatenatedSlice(int i, int64_t length, std::shared_ptr<ArrayData>* out) {
+    ArrayVector slices;
+    while (length > 0) {
+      std::shared_ptr<ArrayData> slice = NextSlice(i, length);
+      length -= slice->length;
+      if (slice->length > 0) {
+        slices.push_back(MakeArray(slice));
+      }
+    }
+    if (slices.size() == 1) {
+      *out = slices[0]->data();
+      return Status::OK();
+    }
+    std::shared_ptr<Array> concatenated;
+    RETURN_NOT_OK(Concatenate(slices, pool_, &concatenated));
+    *out = concatenated->data();
+    return Status::OK();
+  }
+
   const Table& table_;
   std::vector<ChunkedArray*> column_data_;
   std::vector<int> chunk_numbers_;
   std::vector<int64_t> chunk_offsets_;
   int64_t absolute_row_position_;
   int64_t max_chunksize_;
+  int64_t min_chunksize_;
+  MemoryPool* pool_;
 };
 
 TableBatchReader::TableBatchReader(const Table& table) {
@@ -591,6 +918,10 @@ void TableBatchReader::set_chunksize(int64_t chunksize) {
   impl_->set_chunksize(chunksize);
 }
 
+void TableBatchReader::set_min_chunksize(int64_t min_chunksize, MemoryPool* pool) {
+  impl_->set_min_chunksize(min_chunksize, pool);
+}
+
 Status TableBatchReader::ReadNext(std::shared_ptr<RecordBatch>* out) {
   return impl_->ReadNext(out);
 }
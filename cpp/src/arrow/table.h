@@ -24,6 +24,7 @@
 #include <vector>
 
 #include "arrow/array.h"
+#include "arrow/memory_pool.h"
 #include "arrow/record_batch.h"
 #include "arrow/type.h"
 #include "arrow/util/macros.h"
@@ -39,8 +40,8 @@ class Status;
 /// as one large array
 class ARROW_EXPORT ChunkedArray {
  public:
-  explicit ChunkedArray(const ArrayVector& chunks);
-  ChunkedArray(const ArrayVector& chunks, const std::shared_ptr<DataType>& type);
+  explicit ChunkedArray(ArrayVector chunks);
+  ChunkedArray(ArrayVector chunks, const std::shared_ptr<DataType>& type);
 
   /// \return the total length of the chunked array; computed on construction
   int64_t length() const { return length_; }
@@ -81,6 +82,10 @@ class ARROW_EXPORT ChunkedArray {
   bool Equals(const ChunkedArray& other) const;
   bool Equals(const std::shared_ptr<ChunkedArray>& other) const;
 
+  /// \brief Determine if the contents are equal, floating point values
+  /// within an absolute difference of 1e-5, however either is chunked
+  bool ApproxEquals(const ChunkedArray& other) const;
+
  protected:
   ArrayVector chunks_;
   int64_t length_;
@@ -148,6 +153,7 @@ class ARROW_EXPORT Column {
 
   bool Equals(const Column& other) const;
   bool Equals(const std::shared_ptr<Column>& other) const;
+  bool ApproxEquals(const Column& other) const;
 
   /// \brief Verify that the column's array data is consistent with the passed
   /// field's metadata
@@ -189,10 +195,12 @@ class ARROW_EXPORT Table {
   ///
   /// \param[in] batches a std::vector of record batches
   /// \param[out] table the returned table
+  /// \param[in] use_threads gather the columns in parallel on the CPU thread
+  /// pool, worth it for wide tables
   /// \return Status Returns Status::Invalid if there is some problem
   static Status FromRecordBatches(
       const std::vector<std::shared_ptr<RecordBatch>>& batches,
-      std::shared_ptr<Table>* table);
+      std::shared_ptr<Table>* table, bool use_threads = false);
 
   /// Construct table from RecordBatches, using supplied schema. There may be
   /// zero record batches
@@ -200,11 +208,13 @@ class ARROW_EXPORT Table {
   /// \param[in] schema the arrow::Schema for each batch
   /// \param[in] batches a std::vector of record batches
   /// \param[out] table the returned table
+  /// \param[in] use_threads gather the columns in parallel on the CPU thread
+  /// pool, worth it for wide tables
   /// \return Status
   static Status FromRecordBatches(
       const std::shared_ptr<Schema>& schema,
       const std::vector<std::shared_ptr<RecordBatch>>& batches,
-      std::shared_ptr<Table>* table);
+      std::shared_ptr<Table>* table, bool use_threads = false);
 
   /// \return the table's schema
   std::shared_ptr<Schema> schema() const { return schema_; }
@@ -213,6 +223,33 @@ class ARROW_EXPORT Table {
   /// \return the i-th column
   virtual std::shared_ptr<Column> column(int i) const = 0;
 
+  /// \brief Construct a zero-copy slice of the table with the indicated
+  /// offset and length
+  ///
+  /// The columns are sliced lazily, each the first time it is accessed.
+  /// Slicing a slice, or selecting some of its columns, composes with it
+  /// instead of slicing the columns again.
+  ///
+  /// \param[in] offset the position of the first row in the constructed
+  /// slice
+  /// \param[in] length the number of rows of the slice. If there are not
+  /// enough rows in the table, the length will be adjusted accordingly
+  ///
+  /// \return a new object wrapped in std::shared_ptr<Table>
+  virtual std::shared_ptr<Table> Slice(int64_t offset, int64_t length) const;
+
+  /// \brief Slice from offset until end of the table
+  std::shared_ptr<Table> Slice(int64_t offset) const { return Slice(offset, num_rows_); }
+
+  /// \brief Select the columns at the given indices, in order, producing a
+  /// new Table which shares them
+  ///
+  /// \param[in] indices the indices of the selected columns, which may repeat
+  /// \param[out] out The returned table
+  /// \return Status::Invalid if an index is out of bounds
+  virtual Status SelectColumns(const std::vector<int>& indices,
+                               std::shared_ptr<Table>* out) const;
+
   /// \brief Remove column from the table, producing a new Table
   virtual Status RemoveColumn(int i, std::shared_ptr<Table>* out) const = 0;
 
@@ -237,11 +274,25 @@ class ARROW_EXPORT Table {
   ///
   /// \param[in] pool The pool for buffer allocations, if any
   /// \param[out] out The returned table
-  virtual Status Flatten(MemoryPool* pool, std::shared_ptr<Table>* out) const = 0;
+  /// \param[in] use_threads flatten the columns in parallel on the CPU thread pool
+  virtual Status Flatten(MemoryPool* pool, std::shared_ptr<Table>* out,
+                         bool use_threads = false) const = 0;
 
   /// \brief Perform any checks to validate the input arguments
   virtual Status Validate() const = 0;
 
+  /// \brief Make each column a single chunk, producing a new Table
+  ///
+  /// The chunks of each column are concatenated with a single allocation per
+  /// buffer. The columns which already are a single chunk are not copied.
+  ///
+  /// \param[in] pool The pool to allocate the combined columns from
+  /// \param[out] out The returned table
+  /// \param[in] use_threads combine the columns in parallel on the CPU thread
+  /// pool
+  Status CombineChunks(MemoryPool* pool, std::shared_ptr<Table>* out,
+                       bool use_threads = false) const;
+
   /// \return the number of columns in the table
   int num_columns() const { return schema_->num_fields(); }
 
@@ -249,7 +300,15 @@ class ARROW_EXPORT Table {
   int64_t num_rows() const { return num_rows_; }
 
   /// \brief Determine if semantic contents of tables are exactly equal
-  bool Equals(const Table& other) const;
+  ///
+  /// \param[in] other the table to compare with
+  /// \param[in] use_threads compare the columns in parallel on the CPU thread
+  /// pool, stopping them all at the first difference
+  bool Equals(const Table& other, bool use_threads = false) const;
+
+  /// \brief Determine if the tables are equal, floating point values within
+  /// an absolute difference of 1e-5
+  bool ApproxEquals(const Table& other, bool use_threads = false) const;
 
  protected:
   Table();
@@ -273,8 +332,22 @@ class ARROW_EXPORT TableBatchReader : public RecordBatchReader {
 
   Status ReadNext(std::shared_ptr<RecordBatch>* out) override;
 
+  /// \brief Read batches of at most chunksize rows
   void set_chunksize(int64_t chunksize);
 
+  /// \brief Read batches of at least min_chunksize rows (but at most the
+  /// chunksize) from tables chunked in fewer rows
+  ///
+  /// Batches are still zero-copy slices of the chunks while those are long
+  /// enough. When they are not, the columns whose current chunk is too short
+  /// are concatenated from the slices of their next chunks; the others are
+  /// sliced. Only the last batch may be shorter.
+  ///
+  /// \param[in] min_chunksize the minimum number of rows of the batches
+  /// \param[in] pool the pool to allocate the concatenated columns from
+  void set_min_chunksize(int64_t min_chunksize,
+                         MemoryPool* pool = default_memory_pool());
+
  private:
   class TableBatchReaderImpl;
   std::unique_ptr<TableBatchReaderImpl> impl_;
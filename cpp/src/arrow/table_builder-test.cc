@@ -15,6 +15,8 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <cstddef>
+#include <cstring>
 #include <memory>
 #include <string>
 #include <vector>
@@ -30,6 +32,7 @@
 #include "arrow/test-util.h"
 #include "arrow/type.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/cpu-info.h"
 
 namespace arrow {
 
@@ -145,4 +148,291 @@ TEST_F(TestRecordBatchBuilder, InvalidFieldLength) {
   ASSERT_RAISES(Invalid, builder->Flush(&dummy));
 }
 
+TEST_F(TestRecordBatchBuilder, FlushByRows) {
+  auto schema = ExampleSchema1();
+
+  std::unique_ptr<RecordBatchBuilder> builder;
+  ASSERT_OK(RecordBatchBuilder::Make(schema, pool_, &builder));
+  builder->SetMaxBatchSize(3);
+  ASSERT_EQ(3, builder->max_batch_rows());
+  ASSERT_EQ(0, builder->max_batch_bytes());
+
+  std::vector<bool> is_valid = {false, true, true, true, true, false, true, true};
+  std::vector<int32_t> f0_values = {0, 1, 2, 3, 4, 5, 6, 7};
+  std::vector<std::string> f1_values = {"a", "b", "c", "d", "e", "f", "g", "h"};
+  std::vector<std::vector<int8_t>> f2_values = {{}, {0}, {}, {1, 2}, {3}, {}, {}, {4}};
+
+  Int32Builder ex_b0;
+  StringBuilder ex_b1;
+  ListBuilder ex_b2(pool_, std::unique_ptr<Int8Builder>(new Int8Builder(pool_)));
+  AppendValues<Int32Builder, int32_t>(&ex_b0, f0_values, is_valid);
+  AppendValues<StringBuilder, std::string>(&ex_b1, f1_values, is_valid);
+  AppendList<Int8Builder, int8_t>(&ex_b2, f2_values, is_valid);
+  std::shared_ptr<Array> a0, a1, a2;
+  ASSERT_OK(ex_b0.Finish(&a0));
+  ASSERT_OK(ex_b1.Finish(&a1));
+  ASSERT_OK(ex_b2.Finish(&a2));
+  auto expected = RecordBatch::Make(schema, 8, {a0, a1, a2});
+
+  // Append row by row, a batch being queued every 3 rows
+  for (size_t i = 0; i < f0_values.size(); ++i) {
+    const std::vector<bool> row_is_valid = {is_valid[i]};
+    AppendValues<Int32Builder, int32_t>(builder->GetFieldAs<Int32Builder>(0),
+                                        {f0_values[i]}, row_is_valid);
+    ASSERT_OK(builder->FlushIfFull());
+    AppendValues<StringBuilder, std::string>(builder->GetFieldAs<StringBuilder>(1),
+                                             {f1_values[i]}, row_is_valid);
+    AppendList<Int8Builder, int8_t>(builder->GetFieldAs<ListBuilder>(2), {f2_values[i]},
+                                    row_is_valid);
+    ASSERT_OK(builder->FlushIfFull());
+    ASSERT_EQ(static_cast<int64_t>(i + 1) / 3, builder->num_queued_batches());
+  }
+  ASSERT_OK(builder->FlushAll());
+  ASSERT_EQ(3, builder->num_queued_batches());
+
+  std::shared_ptr<RecordBatch> batch;
+  for (int64_t offset : {0, 3, 6}) {
+    ASSERT_OK(builder->ReadNext(&batch));
+    ASSERT_BATCHES_EQUAL(*expected->Slice(offset, 3), *batch);
+  }
+  ASSERT_OK(builder->ReadNext(&batch));
+  ASSERT_EQ(nullptr, batch);
+}
+
+TEST_F(TestRecordBatchBuilder, FlushByBytes) {
+  auto schema = ::arrow::schema({field("f0", int64()), field("f1", utf8())});
+
+  std::unique_ptr<RecordBatchBuilder> builder;
+  ASSERT_OK(RecordBatchBuilder::Make(schema, pool_, &builder));
+  builder->SetMaxBatchSize(0, 1000);
+
+  // Rows of 8 + 4 + 10 bytes, and their bits of validity
+  const std::string value(10, 'x');
+  for (int64_t i = 0; i < 1000; ++i) {
+    ASSERT_OK(builder->GetFieldAs<Int64Builder>(0)->Append(i));
+    ASSERT_OK(builder->GetFieldAs<StringBuilder>(1)->Append(value));
+    ASSERT_OK(builder->FlushIfFull());
+  }
+  ASSERT_OK(builder->FlushAll());
+
+  // Batches are flushed once they reach 1000 bytes, at 45 rows
+  ASSERT_EQ(23, builder->num_queued_batches());
+  int64_t num_rows = 0;
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(builder->ReadNext(&batch));
+  while (batch != nullptr) {
+    ASSERT_EQ(std::min<int64_t>(45, 1000 - num_rows), batch->num_rows());
+    const auto& values = checked_cast<const Int64Array&>(*batch->column(0));
+    for (int64_t i = 0; i < batch->num_rows(); ++i) {
+      ASSERT_EQ(num_rows + i, values.Value(i));
+    }
+    num_rows += batch->num_rows();
+    ASSERT_OK(builder->ReadNext(&batch));
+  }
+  ASSERT_EQ(1000, num_rows);
+}
+
+TEST_F(TestRecordBatchBuilder, FlushByBytesInBulk) {
+  auto schema = ::arrow::schema({field("f0", int64())});
+
+  std::unique_ptr<RecordBatchBuilder> builder;
+  ASSERT_OK(RecordBatchBuilder::Make(schema, pool_, &builder));
+  builder->SetMaxBatchSize(0, 8000);
+
+  // About 81800 bytes of values and validity, split into 10 batches
+  std::vector<int64_t> values(10063);
+  ASSERT_OK(builder->AppendColumnValues<Int64Builder>(0, values));
+  ASSERT_EQ(10, builder->num_queued_batches());
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(builder->ReadNext(&batch));
+  ASSERT_EQ(1007, batch->num_rows());
+}
+
+TEST_F(TestRecordBatchBuilder, AppendColumnValues) {
+  auto schema = ::arrow::schema({field("f0", int32()), field("f1", utf8())});
+
+  std::unique_ptr<RecordBatchBuilder> builder;
+  ASSERT_OK(RecordBatchBuilder::Make(schema, pool_, &builder));
+  builder->SetMaxBatchSize(4);
+
+  std::vector<int32_t> f0_values = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  std::vector<std::string> f1_values = {"a", "b", "c", "d", "e", "f", "g", "h", "i", "j"};
+  std::vector<uint8_t> valid_bytes = {1, 1, 0, 1, 1, 1, 1, 0, 1, 1};
+
+  // The rows are complete once both fields are appended
+  ASSERT_OK(builder->AppendColumnValues<Int32Builder>(0, f0_values.data(), 10,
+                                                      valid_bytes.data()));
+  ASSERT_EQ(0, builder->num_queued_batches());
+  ASSERT_OK(builder->AppendColumnValues<StringBuilder>(1, f1_values, valid_bytes.data()));
+  ASSERT_EQ(3, builder->num_queued_batches());
+
+  std::shared_ptr<Array> a0, a1;
+  ArrayFromVector<Int32Type, int32_t>(
+      {true, true, false, true, true, true, true, false, true, true}, f0_values, &a0);
+  ArrayFromVector<StringType, std::string>(
+      {true, true, false, true, true, true, true, false, true, true}, f1_values, &a1);
+  auto expected = RecordBatch::Make(schema, 10, {a0, a1});
+
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(builder->ReadNext(&batch));
+  ASSERT_BATCHES_EQUAL(*expected->Slice(0, 4), *batch);
+  ASSERT_OK(builder->ReadNext(&batch));
+  ASSERT_BATCHES_EQUAL(*expected->Slice(4, 4), *batch);
+  ASSERT_OK(builder->ReadNext(&batch));
+  ASSERT_BATCHES_EQUAL(*expected->Slice(8, 2), *batch);
+  ASSERT_OK(builder->ReadNext(&batch));
+  ASSERT_EQ(nullptr, batch);
+
+  // Flushing a partly appended row fails
+  ASSERT_OK(builder->AppendColumnValues<Int32Builder>(0, f0_values.data(), 1));
+  ASSERT_RAISES(Invalid, builder->FlushAll());
+}
+
+struct PackedRow {
+  int32_t f0;
+  double f1;
+  bool f2;
+  int16_t f3;
+  int64_t f4;
+  uint8_t f5[3];
+  float f6;
+};
+
+class TestRowTranspose : public TestBase {
+ public:
+  void SetUp() {
+    TestBase::SetUp();
+    schema_ = ::arrow::schema(
+        {field("f0", int32()), field("f1", float64()), field("f2", boolean()),
+         field("f3", int16()), field("f4", timestamp(TimeUnit::MILLI)),
+         field("f5", fixed_size_binary(3)), field("f6", float32())});
+    layout_.row_stride = sizeof(PackedRow);
+    layout_.field_offsets = {offsetof(PackedRow, f0), offsetof(PackedRow, f1),
+                             offsetof(PackedRow, f2), offsetof(PackedRow, f3),
+                             offsetof(PackedRow, f4), offsetof(PackedRow, f5),
+                             offsetof(PackedRow, f6)};
+
+    // Rows spanning several blocks, and not a multiple of the AVX2 vectors
+    rows_.resize(1003);
+    std::memset(rows_.data(), 0, rows_.size() * sizeof(PackedRow));
+    for (size_t i = 0; i < rows_.size(); ++i) {
+      PackedRow& row = rows_[i];
+      row.f0 = static_cast<int32_t>(i) * 7 - 1000;
+      row.f1 = static_cast<double>(i) / 4;
+      row.f2 = i % 3 == 0;
+      row.f3 = static_cast<int16_t>(i);
+      row.f4 = static_cast<int64_t>(i) << 33;
+      row.f5[0] = static_cast<uint8_t>(i);
+      row.f5[1] = static_cast<uint8_t>(i >> 8);
+      row.f5[2] = 0xAB;
+      row.f6 = static_cast<float>(i) * 0.5f;
+    }
+  }
+
+  // The record batch of the rows, built value by value
+  std::shared_ptr<RecordBatch> MakeExpected() {
+    std::vector<int32_t> v0;
+    std::vector<double> v1;
+    std::vector<bool> v2;
+    std::vector<int16_t> v3;
+    std::vector<int64_t> v4;
+    std::vector<float> v6;
+    FixedSizeBinaryBuilder b5(fixed_size_binary(3), pool_);
+    for (const auto& row : rows_) {
+      v0.push_back(row.f0);
+      v1.push_back(row.f1);
+      v2.push_back(row.f2);
+      v3.push_back(row.f3);
+      v4.push_back(row.f4);
+      v6.push_back(row.f6);
+      ABORT_NOT_OK(b5.Append(row.f5));
+    }
+    std::vector<std::shared_ptr<Array>> columns(7);
+    ArrayFromVector<Int32Type, int32_t>(v0, &columns[0]);
+    ArrayFromVector<DoubleType, double>(v1, &columns[1]);
+    ArrayFromVector<BooleanType, bool>(v2, &columns[2]);
+    ArrayFromVector<Int16Type, int16_t>(v3, &columns[3]);
+    ArrayFromVector<TimestampType, int64_t>(timestamp(TimeUnit::MILLI), v4, &columns[4]);
+    ABORT_NOT_OK(b5.Finish(&columns[5]));
+    ArrayFromVector<FloatType, float>(v6, &columns[6]);
+    return RecordBatch::Make(schema_, static_cast<int64_t>(rows_.size()), columns);
+  }
+
+  void AssertRowsEqual(const PackedRow* expected, const PackedRow* actual,
+                       int64_t length) {
+    for (int64_t i = 0; i < length; ++i) {
+      ASSERT_EQ(expected[i].f0, actual[i].f0);
+      ASSERT_EQ(expected[i].f1, actual[i].f1);
+      ASSERT_EQ(expected[i].f2, actual[i].f2);
+      ASSERT_EQ(expected[i].f3, actual[i].f3);
+      ASSERT_EQ(expected[i].f4, actual[i].f4);
+      ASSERT_EQ(0, std::memcmp(expected[i].f5, actual[i].f5, 3));
+      ASSERT_EQ(expected[i].f6, actual[i].f6);
+    }
+  }
+
+ protected:
+  std::shared_ptr<Schema> schema_;
+  RowLayout layout_;
+  std::vector<PackedRow> rows_;
+};
+
+TEST_F(TestRowTranspose, Roundtrip) {
+  auto expected = MakeExpected();
+  auto data = reinterpret_cast<const uint8_t*>(rows_.data());
+
+  CpuInfo::Init();
+  const bool has_avx2 = CpuInfo::IsSupported(CpuInfo::AVX2);
+  for (bool use_avx2 : {true, false}) {
+    if (has_avx2) {
+      CpuInfo::EnableFeature(CpuInfo::AVX2, use_avx2);
+    }
+    for (int64_t length : {0, 1, 64, 1003}) {
+      std::shared_ptr<RecordBatch> batch;
+      ASSERT_OK(RecordBatchFromRows(schema_, layout_, data, length, pool_, &batch));
+      ASSERT_BATCHES_EQUAL(*expected->Slice(0, length), *batch);
+      for (int i = 0; i < batch->num_columns(); ++i) {
+        ASSERT_EQ(0, batch->column(i)->null_count());
+      }
+
+      std::vector<PackedRow> out(length);
+      ASSERT_OK(
+          RecordBatchToRows(*batch, layout_, reinterpret_cast<uint8_t*>(out.data())));
+      AssertRowsEqual(rows_.data(), out.data(), length);
+    }
+  }
+  if (has_avx2) {
+    CpuInfo::EnableFeature(CpuInfo::AVX2, true);
+  }
+}
+
+TEST_F(TestRowTranspose, SlicedToRows) {
+  // Offsets of the boolean arrays off a byte of their bitmap
+  auto sliced = MakeExpected()->Slice(5, 900);
+  std::vector<PackedRow> out(900);
+  ASSERT_OK(RecordBatchToRows(*sliced, layout_, reinterpret_cast<uint8_t*>(out.data())));
+  AssertRowsEqual(rows_.data() + 5, out.data(), 900);
+}
+
+TEST_F(TestRowTranspose, InvalidLayouts) {
+  auto data = reinterpret_cast<const uint8_t*>(rows_.data());
+  std::shared_ptr<RecordBatch> batch;
+
+  RowLayout layout = layout_;
+  layout.field_offsets.pop_back();
+  ASSERT_RAISES(Invalid, RecordBatchFromRows(schema_, layout, data, 10, pool_, &batch));
+
+  layout = layout_;
+  layout.field_offsets[6] = sizeof(PackedRow) - 2;
+  ASSERT_RAISES(Invalid, RecordBatchFromRows(schema_, layout, data, 10, pool_, &batch));
+
+  layout = layout_;
+  layout.row_stride = 0;
+  ASSERT_RAISES(Invalid, RecordBatchFromRows(schema_, layout, data, 10, pool_, &batch));
+
+  auto strings = ::arrow::schema({field("f0", utf8())});
+  layout = RowLayout{8, {0}};
+  ASSERT_RAISES(Invalid, RecordBatchFromRows(strings, layout, data, 10, pool_, &batch));
+}
+
 }  // namespace arrow
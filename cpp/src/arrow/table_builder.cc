@@ -19,6 +19,8 @@
 
 #include <algorithm>
 #include <cstdlib>
+#include <cstring>
+#include <limits>
 #include <memory>
 #include <sstream>
 #include <utility>
@@ -29,16 +31,63 @@
 #include "arrow/status.h"
 #include "arrow/table.h"
 #include "arrow/type.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/cpu-info.h"
 #include "arrow/util/logging.h"
 
+#ifdef ARROW_HAVE_AVX2
+#include "arrow/util/gather-avx2.h"
+#endif
+
 namespace arrow {
 
+namespace {
+
+// An estimate of the size of the buffers of the array a builder would
+// finish, from the lengths of its values and of those of its children
+int64_t EstimateBuilderSize(ArrayBuilder* builder) {
+  const int64_t length = builder->length();
+  const DataType& type = *builder->type();
+  int64_t size = BitUtil::BytesForBits(length);
+  switch (type.id()) {
+    case Type::BINARY:
+    case Type::STRING:
+      size += length * sizeof(int32_t) +
+              checked_cast<BinaryBuilder*>(builder)->value_data_length();
+      break;
+    case Type::LIST:
+      size += length * sizeof(int32_t) +
+              EstimateBuilderSize(checked_cast<ListBuilder*>(builder)->value_builder());
+      break;
+    case Type::STRUCT:
+      for (int i = 0; i < builder->num_children(); ++i) {
+        size += EstimateBuilderSize(builder->child(i));
+      }
+      break;
+    default: {
+      const auto fixed_width = dynamic_cast<const FixedWidthType*>(&type);
+      if (fixed_width != nullptr) {
+        size += BitUtil::BytesForBits(length * fixed_width->bit_width());
+      }
+      break;
+    }
+  }
+  return size;
+}
+
+}  // namespace
+
 // ----------------------------------------------------------------------
 // RecordBatchBuilder
 
 RecordBatchBuilder::RecordBatchBuilder(const std::shared_ptr<Schema>& schema,
                                        MemoryPool* pool, int64_t initial_capacity)
-    : schema_(schema), initial_capacity_(initial_capacity), pool_(pool) {}
+    : schema_(schema),
+      initial_capacity_(initial_capacity),
+      pool_(pool),
+      max_batch_rows_(0),
+      max_batch_bytes_(0) {}
 
 Status RecordBatchBuilder::Make(const std::shared_ptr<Schema>& schema, MemoryPool* pool,
                                 std::unique_ptr<RecordBatchBuilder>* builder) {
@@ -78,6 +127,90 @@ Status RecordBatchBuilder::Flush(std::shared_ptr<RecordBatch>* batch) {
   return Flush(true, batch);
 }
 
+void RecordBatchBuilder::SetMaxBatchSize(int64_t max_rows, int64_t max_bytes) {
+  DCHECK_GE(max_rows, 0) << "Maximum batch size must not be negative";
+  DCHECK_GE(max_bytes, 0) << "Maximum batch size must not be negative";
+  max_batch_rows_ = max_rows;
+  max_batch_bytes_ = max_bytes;
+}
+
+int64_t RecordBatchBuilder::GetRowsPerBatch() const {
+  if (this->num_fields() == 0) {
+    return 0;
+  }
+  const int64_t length = raw_field_builders_[0]->length();
+  for (int i = 1; i < this->num_fields(); ++i) {
+    if (raw_field_builders_[i]->length() != length) {
+      return 0;
+    }
+  }
+
+  int64_t rows_per_batch = 0;
+  if (max_batch_rows_ > 0 && length >= max_batch_rows_) {
+    rows_per_batch = max_batch_rows_;
+  }
+  if (max_batch_bytes_ > 0 && length > 0) {
+    int64_t size = 0;
+    for (int i = 0; i < this->num_fields(); ++i) {
+      size += EstimateBuilderSize(raw_field_builders_[i]);
+    }
+    if (size >= max_batch_bytes_) {
+      // Rows appended in bulk are split into as many batches as the maximum
+      // size fits in their estimated size
+      const int64_t num_batches = size / max_batch_bytes_;
+      const int64_t rows = (length + num_batches - 1) / num_batches;
+      rows_per_batch = rows_per_batch > 0 ? std::min(rows_per_batch, rows) : rows;
+    }
+  }
+  return rows_per_batch;
+}
+
+Status RecordBatchBuilder::FlushQueued(int64_t rows_per_batch) {
+  std::shared_ptr<RecordBatch> batch;
+  RETURN_NOT_OK(Flush(&batch));
+  if (batch->num_rows() <= rows_per_batch) {
+    queued_batches_.push_back(std::move(batch));
+    return Status::OK();
+  }
+  for (int64_t offset = 0; offset < batch->num_rows(); offset += rows_per_batch) {
+    queued_batches_.push_back(batch->Slice(offset, rows_per_batch));
+  }
+  return Status::OK();
+}
+
+Status RecordBatchBuilder::FlushIfFull() {
+  const int64_t rows_per_batch = GetRowsPerBatch();
+  if (rows_per_batch == 0) {
+    return Status::OK();
+  }
+  return FlushQueued(rows_per_batch);
+}
+
+Status RecordBatchBuilder::FlushAll() {
+  if (this->num_fields() == 0) {
+    return Status::OK();
+  }
+  int64_t length = 0;
+  for (int i = 0; i < this->num_fields(); ++i) {
+    length = std::max(length, raw_field_builders_[i]->length());
+  }
+  if (length == 0) {
+    return Status::OK();
+  }
+  const int64_t rows_per_batch = GetRowsPerBatch();
+  return FlushQueued(rows_per_batch > 0 ? rows_per_batch : length);
+}
+
+Status RecordBatchBuilder::ReadNext(std::shared_ptr<RecordBatch>* batch) {
+  if (queued_batches_.empty()) {
+    batch->reset();
+  } else {
+    *batch = std::move(queued_batches_.front());
+    queued_batches_.pop_front();
+  }
+  return Status::OK();
+}
+
 void RecordBatchBuilder::SetInitialCapacity(int64_t capacity) {
   DCHECK_GT(capacity, 0) << "Initial capacity must be positive";
   initial_capacity_ = capacity;
@@ -100,4 +233,211 @@ Status RecordBatchBuilder::InitBuilders() {
   return Status::OK();
 }
 
+// ----------------------------------------------------------------------
+// Transposing packed rows
+
+namespace {
+
+// The rows of a block take about half of a typical L1 data cache
+constexpr int64_t kRowBlockBytes = 16 * 1024;
+
+// The number of bytes of a value of each field in the rows, validating the
+// layout against the schema
+Status GetRowFieldWidths(const Schema& schema, const RowLayout& layout,
+                         std::vector<int64_t>* widths) {
+  if (static_cast<int>(layout.field_offsets.size()) != schema.num_fields()) {
+    std::stringstream ss;
+    ss << "Row layout has " << layout.field_offsets.size() << " field offsets for "
+       << schema.num_fields() << " fields";
+    return Status::Invalid(ss.str());
+  }
+  if (layout.row_stride <= 0) {
+    return Status::Invalid("Row stride must be positive");
+  }
+  widths->resize(schema.num_fields());
+  for (int i = 0; i < schema.num_fields(); ++i) {
+    const DataType& type = *schema.field(i)->type();
+    const auto fixed_width = dynamic_cast<const FixedWidthType*>(&type);
+    if (type.id() == Type::BOOL) {
+      (*widths)[i] = 1;
+    } else if (fixed_width != nullptr && type.id() != Type::NA &&
+               type.id() != Type::DICTIONARY && fixed_width->bit_width() % 8 == 0) {
+      (*widths)[i] = fixed_width->bit_width() / 8;
+    } else {
+      return Status::Invalid("Cannot transpose rows with a field of type " +
+                             type.ToString());
+    }
+    if (layout.field_offsets[i] < 0 ||
+        layout.field_offsets[i] + (*widths)[i] > layout.row_stride) {
+      std::stringstream ss;
+      ss << "Field " << i << " at offset " << layout.field_offsets[i]
+         << " is out of a row of " << layout.row_stride << " bytes";
+      return Status::Invalid(ss.str());
+    }
+  }
+  return Status::OK();
+}
+
+// An even number of bytes of bitmap per block
+int64_t GetRowsPerBlock(int64_t row_stride) {
+  return std::max<int64_t>(64, kRowBlockBytes / row_stride / 64 * 64);
+}
+
+#ifdef ARROW_HAVE_AVX2
+// The features are checked on each call rather than once, so that tests can
+// toggle them with CpuInfo::EnableFeature
+bool UseAvx2() {
+  if (!CpuInfo::initialized()) {
+    CpuInfo::Init();
+  }
+  return CpuInfo::IsSupported(CpuInfo::AVX2);
+}
+#endif
+
+template <int64_t kWidth>
+void GatherValues(const uint8_t* data, int64_t stride, int64_t length, uint8_t* out) {
+  for (int64_t i = 0; i < length; ++i, data += stride, out += kWidth) {
+    std::memcpy(out, data, kWidth);
+  }
+}
+
+template <int64_t kWidth>
+void ScatterValues(const uint8_t* values, int64_t stride, int64_t length,
+                   uint8_t* data) {
+  for (int64_t i = 0; i < length; ++i, data += stride, values += kWidth) {
+    std::memcpy(data, values, kWidth);
+  }
+}
+
+// Gather the values of a field of length rows into out, of width bytes each
+void GatherField(const uint8_t* data, int64_t stride, int64_t width, int64_t length,
+                 uint8_t* out) {
+#ifdef ARROW_HAVE_AVX2
+  if ((width == 4 || width == 8) && stride <= std::numeric_limits<int32_t>::max() / 8 &&
+      UseAvx2()) {
+    if (width == 4) {
+      internal::GatherStrided32Avx2(data, static_cast<int32_t>(stride), length,
+                                    reinterpret_cast<uint32_t*>(out));
+    } else {
+      internal::GatherStrided64Avx2(data, static_cast<int32_t>(stride), length,
+                                    reinterpret_cast<uint64_t*>(out));
+    }
+    return;
+  }
+#endif
+  switch (width) {
+    case 1:
+      return GatherValues<1>(data, stride, length, out);
+    case 2:
+      return GatherValues<2>(data, stride, length, out);
+    case 4:
+      return GatherValues<4>(data, stride, length, out);
+    case 8:
+      return GatherValues<8>(data, stride, length, out);
+    case 16:
+      return GatherValues<16>(data, stride, length, out);
+    default:
+      for (int64_t i = 0; i < length; ++i, data += stride, out += width) {
+        std::memcpy(out, data, width);
+      }
+  }
+}
+
+void ScatterField(const uint8_t* values, int64_t stride, int64_t width, int64_t length,
+                  uint8_t* data) {
+  switch (width) {
+    case 1:
+      return ScatterValues<1>(values, stride, length, data);
+    case 2:
+      return ScatterValues<2>(values, stride, length, data);
+    case 4:
+      return ScatterValues<4>(values, stride, length, data);
+    case 8:
+      return ScatterValues<8>(values, stride, length, data);
+    case 16:
+      return ScatterValues<16>(values, stride, length, data);
+    default:
+      for (int64_t i = 0; i < length; ++i, data += stride, values += width) {
+        std::memcpy(data, values, width);
+      }
+  }
+}
+
+}  // namespace
+
+Status RecordBatchFromRows(const std::shared_ptr<Schema>& schema,
+                           const RowLayout& layout, const uint8_t* rows,
+                           int64_t num_rows, MemoryPool* pool,
+                           std::shared_ptr<RecordBatch>* out) {
+  std::vector<int64_t> widths;
+  RETURN_NOT_OK(GetRowFieldWidths(*schema, layout, &widths));
+
+  const int num_fields = schema->num_fields();
+  std::vector<std::shared_ptr<Buffer>> buffers(num_fields);
+  for (int i = 0; i < num_fields; ++i) {
+    const bool is_bool = schema->field(i)->type()->id() == Type::BOOL;
+    const int64_t size = is_bool ? BitUtil::BytesForBits(num_rows) : num_rows * widths[i];
+    RETURN_NOT_OK(AllocateBuffer(pool, size, &buffers[i]));
+    if (is_bool && size > 0) {
+      std::memset(buffers[i]->mutable_data(), 0, size);
+    }
+  }
+
+  const int64_t stride = layout.row_stride;
+  const int64_t rows_per_block = GetRowsPerBlock(stride);
+  for (int64_t start = 0; start < num_rows; start += rows_per_block) {
+    const int64_t length = std::min(rows_per_block, num_rows - start);
+    const uint8_t* block = rows + start * stride;
+    for (int i = 0; i < num_fields; ++i) {
+      const uint8_t* data = block + layout.field_offsets[i];
+      uint8_t* values = buffers[i]->mutable_data();
+      if (schema->field(i)->type()->id() == Type::BOOL) {
+        // Blocks start on a byte of the bitmap
+        uint8_t* bitmap = values + start / 8;
+        for (int64_t j = 0; j < length; ++j) {
+          bitmap[j / 8] |= static_cast<uint8_t>((data[j * stride] != 0) << (j % 8));
+        }
+      } else {
+        GatherField(data, stride, widths[i], length, values + start * widths[i]);
+      }
+    }
+  }
+
+  std::vector<std::shared_ptr<Array>> columns(num_fields);
+  for (int i = 0; i < num_fields; ++i) {
+    columns[i] = MakeArray(
+        ArrayData::Make(schema->field(i)->type(), num_rows, {nullptr, buffers[i]}, 0));
+  }
+  *out = RecordBatch::Make(schema, num_rows, std::move(columns));
+  return Status::OK();
+}
+
+Status RecordBatchToRows(const RecordBatch& batch, const RowLayout& layout,
+                         uint8_t* rows) {
+  std::vector<int64_t> widths;
+  RETURN_NOT_OK(GetRowFieldWidths(*batch.schema(), layout, &widths));
+
+  const int64_t num_rows = batch.num_rows();
+  const int64_t stride = layout.row_stride;
+  const int64_t rows_per_block = GetRowsPerBlock(stride);
+  for (int64_t start = 0; start < num_rows; start += rows_per_block) {
+    const int64_t length = std::min(rows_per_block, num_rows - start);
+    uint8_t* block = rows + start * stride;
+    for (int i = 0; i < batch.num_columns(); ++i) {
+      const ArrayData& column = *batch.column_data(i);
+      uint8_t* data = block + layout.field_offsets[i];
+      const uint8_t* values = column.buffers[1]->data();
+      if (column.type->id() == Type::BOOL) {
+        for (int64_t j = 0; j < length; ++j) {
+          data[j * stride] = BitUtil::GetBit(values, column.offset + start + j);
+        }
+      } else {
+        ScatterField(values + (column.offset + start) * widths[i], stride, widths[i],
+                     length, data);
+      }
+    }
+  }
+  return Status::OK();
+}
+
 }  // namespace arrow
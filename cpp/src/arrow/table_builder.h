@@ -19,8 +19,10 @@
 #define ARROW_TABLE_BUILDER_H
 
 #include <cstdint>
+#include <deque>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "arrow/status.h"
@@ -38,6 +40,10 @@ class Schema;
 /// \class RecordBatchBuilder
 /// \brief Helper class for creating record batches iteratively given a known
 /// schema
+///
+/// Batches are either flushed by hand, or split off automatically once the
+/// rows appended reach a maximum batch size set with SetMaxBatchSize, then
+/// read in order with ReadNext.
 class RecordBatchBuilder {
  public:
   /// \brief Create an initialize a RecordBatchBuilder
@@ -80,6 +86,61 @@ class RecordBatchBuilder {
   /// \return Status
   Status Flush(std::shared_ptr<RecordBatch>* batch);
 
+  /// \brief Append values to a field, as by the AppendValues method of its
+  /// builder, then flush the complete rows if they reach the maximum batch
+  /// size
+  ///
+  /// \param i the field index
+  /// \param args the arguments of BuilderType::AppendValues
+  /// \return Status
+  template <typename BuilderType, typename... Args>
+  Status AppendColumnValues(int i, Args&&... args) {
+    RETURN_NOT_OK(GetFieldAs<BuilderType>(i)->AppendValues(std::forward<Args>(args)...));
+    return FlushIfFull();
+  }
+
+  /// \brief Set the maximum size of the batches split off automatically
+  ///
+  /// \param[in] max_rows the maximum number of rows of a batch, 0 for no
+  /// maximum
+  /// \param[in] max_bytes the estimated size of the buffers of the rows
+  /// appended at which they are flushed, 0 for no maximum. The estimate
+  /// counts the bytes of the values, offsets and validity bitmaps.
+  void SetMaxBatchSize(int64_t max_rows, int64_t max_bytes = 0);
+
+  /// \brief The maximum number of rows of a batch, 0 for no maximum
+  int64_t max_batch_rows() const { return max_batch_rows_; }
+
+  /// \brief The estimated size at which batches are flushed, 0 for no maximum
+  int64_t max_batch_bytes() const { return max_batch_bytes_; }
+
+  /// \brief Flush the rows appended into batches of the maximum size if they
+  /// reach it
+  ///
+  /// Does nothing while the fields have different lengths, that is while a
+  /// row is partly appended. The batches are queued to be read by ReadNext.
+  /// Rows appended in bulk are split into several batches, those beyond a
+  /// multiple of the maximum number of rows making a smaller last one.
+  ///
+  /// \return Status
+  Status FlushIfFull();
+
+  /// \brief Flush the rows appended, if any, into queued batches of at most
+  /// the maximum size, as at the end of the stream
+  Status FlushAll();
+
+  /// \brief Read the next queued batch
+  ///
+  /// \param[out] batch the oldest batch queued by FlushIfFull or FlushAll,
+  /// null if there is none
+  /// \return Status
+  Status ReadNext(std::shared_ptr<RecordBatch>* batch);
+
+  /// \brief The number of batches queued and not yet read
+  int64_t num_queued_batches() const {
+    return static_cast<int64_t>(queued_batches_.size());
+  }
+
   /// \brief Set the initial capacity for new builders
   void SetInitialCapacity(int64_t capacity);
 
@@ -99,14 +160,66 @@ class RecordBatchBuilder {
   Status CreateBuilders();
   Status InitBuilders();
 
+  // The number of rows of the batches to split the appended rows into, 0 if
+  // they don't reach the maximum batch size or aren't complete
+  int64_t GetRowsPerBatch() const;
+  Status FlushQueued(int64_t rows_per_batch);
+
   std::shared_ptr<Schema> schema_;
   int64_t initial_capacity_;
   MemoryPool* pool_;
+  int64_t max_batch_rows_;
+  int64_t max_batch_bytes_;
+  std::deque<std::shared_ptr<RecordBatch>> queued_batches_;
 
   std::vector<std::unique_ptr<ArrayBuilder>> field_builders_;
   std::vector<ArrayBuilder*> raw_field_builders_;
 };
 
+/// \brief Where the fields of a schema are in packed rows, such as arrays of
+/// C structs
+struct ARROW_EXPORT RowLayout {
+  /// The number of bytes from the start of a row to that of the next
+  int64_t row_stride;
+  /// The byte offset of each field of the schema in a row
+  std::vector<int64_t> field_offsets;
+};
+
+/// \brief Transpose packed rows into a record batch
+///
+/// The fields must be fixed-width: a value takes the bytes of its type, in
+/// the byte order of the machine, except booleans which take a byte,
+/// nonzero for true. The rows are transposed a block at a time, so that a block
+/// stays in cache while its fields are gathered. The arrays have no nulls.
+///
+/// \param[in] schema the schema of the record batch
+/// \param[in] layout where the fields are in the rows
+/// \param[in] rows the first row
+/// \param[in] num_rows the number of rows
+/// \param[in] pool A MemoryPool to use for allocations
+/// \param[out] out the resulting RecordBatch
+/// \return Status
+ARROW_EXPORT
+Status RecordBatchFromRows(const std::shared_ptr<Schema>& schema,
+                           const RowLayout& layout, const uint8_t* rows,
+                           int64_t num_rows, MemoryPool* pool,
+                           std::shared_ptr<RecordBatch>* out);
+
+/// \brief Transpose a record batch into packed rows, the reverse of
+/// RecordBatchFromRows
+///
+/// Nulls are not represented: the bytes of the values of null slots are
+/// copied as they are. The bytes of the rows outside of the fields are left
+/// unchanged.
+///
+/// \param[in] batch the record batch, of fixed-width fields
+/// \param[in] layout where to write the fields in the rows
+/// \param[out] rows the first of batch.num_rows() rows
+/// \return Status
+ARROW_EXPORT
+Status RecordBatchToRows(const RecordBatch& batch, const RowLayout& layout,
+                         uint8_t* rows);
+
 }  // namespace arrow
 
 #endif  // ARROW_TABLE_BUILDER_H
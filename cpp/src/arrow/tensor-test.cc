@@ -105,4 +105,71 @@ TEST(TestTensor, ZeroDimensionalTensor) {
   ASSERT_EQ(t.strides().size(), 1);
 }
 
+// A transposed view of row-major values of the given shape, in reverse
+template <typename T>
+void CheckTransposedCopy(const std::shared_ptr<DataType>& type,
+                         const std::vector<int64_t>& shape, int64_t begin, int64_t end,
+                         bool use_threads) {
+  int64_t size = 1;
+  for (int64_t dim : shape) {
+    size *= dim;
+  }
+  std::vector<T> values(static_cast<size_t>(size));
+  for (int64_t i = 0; i < size; ++i) {
+    values[i] = static_cast<T>(i * 7 + 3);
+  }
+  // Transposed, the row-major strides are reversed
+  std::vector<int64_t> strides(shape.size());
+  int64_t stride = sizeof(T);
+  for (size_t i = 0; i < shape.size(); ++i) {
+    strides[i] = stride;
+    stride *= shape[i];
+  }
+  Tensor tensor(type, test::GetBufferFromVector(values), shape, strides);
+
+  const int64_t row_cells = size / shape[0];
+  std::vector<T> out(static_cast<size_t>((end - begin) * row_cells));
+  ASSERT_OK(internal::CopyTensorRowMajor(tensor, begin, end,
+                                         reinterpret_cast<uint8_t*>(out.data()),
+                                         use_threads));
+  for (int64_t i = 0; i < static_cast<int64_t>(out.size()); ++i) {
+    // The row-major index of the cell, and its offset in the values
+    int64_t index = begin * row_cells + i;
+    int64_t offset = 0;
+    for (int dim = static_cast<int>(shape.size()) - 1; dim >= 0; --dim) {
+      offset += (index % shape[dim]) * (strides[dim] / static_cast<int64_t>(sizeof(T)));
+      index /= shape[dim];
+    }
+    ASSERT_EQ(values[offset], out[i]) << "at " << i;
+  }
+}
+
+TEST(TestTensor, CopyRowMajor) {
+  CheckTransposedCopy<int8_t>(int8(), {37, 45}, 0, 37, false);
+  CheckTransposedCopy<int16_t>(int16(), {3, 40, 50}, 1, 3, false);
+  CheckTransposedCopy<float>(float32(), {2, 3, 4, 5}, 0, 2, false);
+  // Enough bytes to copy on several threads
+  CheckTransposedCopy<int32_t>(int32(), {2048, 1100}, 0, 2048, true);
+  CheckTransposedCopy<int32_t>(int32(), {2048, 1100}, 10, 2000, true);
+
+  // The only cell of a zero-dimensional tensor
+  std::vector<int64_t> value = {42};
+  Tensor scalar(int64(), test::GetBufferFromVector(value), {});
+  int64_t out = 0;
+  ASSERT_OK(internal::CopyTensorRowMajor(scalar, 0, 0, reinterpret_cast<uint8_t*>(&out)));
+  ASSERT_EQ(42, out);
+
+  // Every other cell
+  std::vector<int64_t> values = {1, 2, 3, 4, 5, 6};
+  Tensor strided(int64(), test::GetBufferFromVector(values), {3}, {16});
+  std::vector<int64_t> cells(2);
+  ASSERT_OK(internal::CopyTensorRowMajor(strided, 1, 3,
+                                         reinterpret_cast<uint8_t*>(cells.data())));
+  ASSERT_EQ(std::vector<int64_t>({3, 5}), cells);
+
+  Tensor tensor(int64(), test::GetBufferFromVector(value), {1});
+  ASSERT_RAISES(Invalid, internal::CopyTensorRowMajor(tensor, 0, 2,
+                                                      reinterpret_cast<uint8_t*>(&out)));
+}
+
 }  // namespace arrow
@@ -17,7 +17,9 @@
 
 #include "arrow/tensor.h"
 
+#include <algorithm>
 #include <cstdint>
+#include <cstring>
 #include <functional>
 #include <memory>
 #include <numeric>
@@ -29,6 +31,7 @@
 #include "arrow/type.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
 
 namespace arrow {
 
@@ -120,4 +123,155 @@ Type::type Tensor::type_id() const { return type_->id(); }
 
 bool Tensor::Equals(const Tensor& other) const { return TensorEquals(*this, other); }
 
+// ----------------------------------------------------------------------
+// Strided copies
+
+namespace {
+
+// Cells on a side of the tiles of strided matrix copies: a tile of the widest
+// cells, with that of the destination, fits in 16KB of L1 cache
+constexpr int64_t kCopyTileSize = 32;
+
+// Copies of fewer bytes are not split among threads
+constexpr int64_t kParallelCopyThreshold = 1 << 22;
+
+// Copy a matrix of cells of type T with the given strides in bytes into dst,
+// in row-major order
+template <typename T>
+void CopyStridedMatrix(const uint8_t* src, int64_t rows, int64_t cols,
+                       int64_t row_stride, int64_t col_stride, uint8_t* dst) {
+  constexpr int64_t cell_size = static_cast<int64_t>(sizeof(T));
+  if (col_stride == cell_size) {
+    for (int64_t i = 0; i < rows; ++i) {
+      std::memcpy(dst + i * cols * cell_size, src + i * row_stride,
+                  static_cast<size_t>(cols * cell_size));
+    }
+    return;
+  }
+  for (int64_t row_tile = 0; row_tile < rows; row_tile += kCopyTileSize) {
+    const int64_t row_end = std::min(rows, row_tile + kCopyTileSize);
+    for (int64_t col_tile = 0; col_tile < cols; col_tile += kCopyTileSize) {
+      const int64_t col_end = std::min(cols, col_tile + kCopyTileSize);
+      for (int64_t i = row_tile; i < row_end; ++i) {
+        const uint8_t* src_row = src + i * row_stride;
+        uint8_t* dst_row = dst + i * cols * cell_size;
+        for (int64_t j = col_tile; j < col_end; ++j) {
+          // Cells need not be aligned in the source
+          std::memcpy(dst_row + j * cell_size, src_row + j * col_stride, sizeof(T));
+        }
+      }
+    }
+  }
+}
+
+// Copy the dimensions from dim on of the tensor cell at src into dst
+template <typename T>
+void CopyStridedDimensions(const Tensor& tensor, int dim, const uint8_t* src,
+                           uint8_t* dst) {
+  const auto& shape = tensor.shape();
+  const auto& strides = tensor.strides();
+  if (dim == tensor.ndim() - 2) {
+    CopyStridedMatrix<T>(src, shape[dim], shape[dim + 1], strides[dim],
+                         strides[dim + 1], dst);
+    return;
+  }
+  int64_t dst_stride = static_cast<int64_t>(sizeof(T));
+  for (int i = dim + 1; i < tensor.ndim(); ++i) {
+    dst_stride *= shape[i];
+  }
+  for (int64_t i = 0; i < shape[dim]; ++i) {
+    CopyStridedDimensions<T>(tensor, dim + 1, src + i * strides[dim],
+                             dst + i * dst_stride);
+  }
+}
+
+template <typename T>
+void CopyStridedRange(const Tensor& tensor, int64_t begin, int64_t end, uint8_t* dst) {
+  const uint8_t* src = tensor.raw_data();
+  const auto& shape = tensor.shape();
+  const auto& strides = tensor.strides();
+  switch (tensor.ndim()) {
+    case 0:
+      std::memcpy(dst, src, sizeof(T));
+      break;
+    case 1:
+      CopyStridedMatrix<T>(src + begin * strides[0], 1, end - begin, 0, strides[0], dst);
+      break;
+    case 2:
+      CopyStridedMatrix<T>(src + begin * strides[0], end - begin, shape[1], strides[0],
+                           strides[1], dst);
+      break;
+    default: {
+      const int64_t row_size = tensor.size() / shape[0] * static_cast<int64_t>(sizeof(T));
+      for (int64_t i = begin; i < end; ++i) {
+        CopyStridedDimensions<T>(tensor, 1, src + i * strides[0],
+                                 dst + (i - begin) * row_size);
+      }
+    }
+  }
+}
+
+void CopyStridedRange(const Tensor& tensor, int cell_size, int64_t begin, int64_t end,
+                      uint8_t* dst) {
+  switch (cell_size) {
+    case 1:
+      return CopyStridedRange<uint8_t>(tensor, begin, end, dst);
+    case 2:
+      return CopyStridedRange<uint16_t>(tensor, begin, end, dst);
+    case 4:
+      return CopyStridedRange<uint32_t>(tensor, begin, end, dst);
+    default:
+      return CopyStridedRange<uint64_t>(tensor, begin, end, dst);
+  }
+}
+
+}  // namespace
+
+namespace internal {
+
+Status CopyTensorRowMajor(const Tensor& tensor, int64_t begin, int64_t end, uint8_t* out,
+                          bool use_threads) {
+  if (!is_tensor_supported(tensor.type_id())) {
+    return Status::NotImplemented("Cannot copy a tensor of type " +
+                                  tensor.type()->ToString());
+  }
+  if (tensor.size() == 0) {
+    return Status::OK();
+  }
+  const auto& type = checked_cast<const FixedWidthType&>(*tensor.type());
+  const int cell_size = type.bit_width() / 8;
+  if (tensor.ndim() == 0) {
+    CopyStridedRange(tensor, cell_size, 0, 1, out);
+    return Status::OK();
+  }
+  if (begin < 0 || end > tensor.shape()[0] || begin > end) {
+    return Status::Invalid("Tensor indices out of bounds");
+  }
+
+  const int64_t row_size = tensor.size() / tensor.shape()[0] * cell_size;
+  const int64_t num_rows = end - begin;
+  int64_t num_tasks = 1;
+  if (use_threads) {
+    num_tasks = std::min<int64_t>({num_rows, GetCpuThreadPoolCapacity(),
+                                   num_rows * row_size / kParallelCopyThreshold});
+  }
+  if (num_tasks <= 1) {
+    CopyStridedRange(tensor, cell_size, begin, end, out);
+    return Status::OK();
+  }
+  // The threads write rows of their own
+  const int64_t rows_per_task = (num_rows + num_tasks - 1) / num_tasks;
+  return ParallelFor(static_cast<int>(num_tasks), [&](int i) -> Status {
+    const int64_t task_begin = begin + i * rows_per_task;
+    const int64_t task_end = std::min(end, task_begin + rows_per_task);
+    if (task_begin < task_end) {
+      CopyStridedRange(tensor, cell_size, task_begin, task_end,
+                       out + (task_begin - begin) * row_size);
+    }
+    return Status::OK();
+  });
+}
+
+}  // namespace internal
+
 }  // namespace arrow
@@ -30,6 +30,8 @@
 
 namespace arrow {
 
+class Status;
+
 static inline bool is_tensor_supported(Type::type type_id) {
   switch (type_id) {
     case Type::UINT8:
@@ -114,6 +116,28 @@ class ARROW_EXPORT Tensor {
   ARROW_DISALLOW_COPY_AND_ASSIGN(Tensor);
 };
 
+namespace internal {
+
+/// \brief Copy a tensor of any strides into row-major order
+///
+/// Copies the cells at the indices [begin, end) of the first dimension, or
+/// the only cell of a zero-dimensional tensor. The innermost two dimensions
+/// are copied in tiles, so that transposing strides read and write whole
+/// cache lines. Copies of several megabytes are split among the threads of
+/// the CPU pool with use_threads.
+///
+/// \param[in] tensor the tensor to copy
+/// \param[in] begin the first index of the first dimension to copy
+/// \param[in] end one past the last index of the first dimension to copy
+/// \param[out] out the destination, of (end - begin) times the size of the
+/// other dimensions cells
+/// \param[in] use_threads whether to copy on several threads
+ARROW_EXPORT
+Status CopyTensorRowMajor(const Tensor& tensor, int64_t begin, int64_t end, uint8_t* out,
+                          bool use_threads = true);
+
+}  // namespace internal
+
 }  // namespace arrow
 
 #endif  // ARROW_TENSOR_H
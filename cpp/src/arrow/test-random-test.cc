@@ -0,0 +1,145 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <unordered_set>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/table.h"
+#include "arrow/test-random.h"
+#include "arrow/test-util.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace test {
+
+// Longer than a chunk, and not a multiple of it
+static constexpr int64_t kLength = 3 * RandomArrayGenerator::kChunkSize + 123;
+
+TEST(RandomArrayGenerator, Numeric) {
+  RandomArrayGenerator gen(42);
+  std::shared_ptr<Array> array;
+  ASSERT_OK(gen.Numeric<Int8Type>(kLength, -3, 5, 0.25, &array));
+  ASSERT_OK(ValidateArray(*array));
+  ASSERT_EQ(kLength, array->length());
+  ASSERT_NEAR(0.25, static_cast<double>(array->null_count()) / kLength, 0.01);
+
+  const auto& ints = checked_cast<const Int8Array&>(*array);
+  std::unordered_set<int> seen;
+  for (int64_t i = 0; i < kLength; ++i) {
+    ASSERT_GE(ints.Value(i), -3);
+    ASSERT_LE(ints.Value(i), 5);
+    seen.insert(ints.Value(i));
+  }
+  ASSERT_EQ(9, seen.size());
+
+  ASSERT_OK(gen.Numeric<DoubleType>(kLength, 0.5, 1.0, 0, &array));
+  ASSERT_EQ(0, array->null_count());
+  const auto& doubles = checked_cast<const DoubleArray&>(*array);
+  for (int64_t i = 0; i < kLength; ++i) {
+    ASSERT_GE(doubles.Value(i), 0.5);
+    ASSERT_LE(doubles.Value(i), 1.0);
+  }
+}
+
+TEST(RandomArrayGenerator, Seeds) {
+  RandomArrayGenerator gen(7);
+  RandomArrayGenerator same_gen(7);
+  RandomArrayGenerator other_gen(8);
+  std::shared_ptr<Array> first, second, other;
+  ASSERT_OK(gen.Numeric<Int64Type>(kLength, 0, 1 << 20, 0.1, &first));
+  ASSERT_OK(same_gen.Numeric<Int64Type>(kLength, 0, 1 << 20, 0.1, &second));
+  ASSERT_OK(other_gen.Numeric<Int64Type>(kLength, 0, 1 << 20, 0.1, &other));
+  ASSERT_ARRAYS_EQUAL(*first, *second);
+  ASSERT_FALSE(first->Equals(other));
+
+  // The next array continues the stream
+  ASSERT_OK(gen.Numeric<Int64Type>(kLength, 0, 1 << 20, 0.1, &second));
+  ASSERT_FALSE(first->Equals(second));
+}
+
+TEST(RandomArrayGenerator, Boolean) {
+  RandomArrayGenerator gen(0);
+  std::shared_ptr<Array> array;
+  ASSERT_OK(gen.Boolean(kLength, 0.9, 0.1, &array));
+  ASSERT_OK(ValidateArray(*array));
+  const auto& bools = checked_cast<const BooleanArray&>(*array);
+  int64_t num_true = 0;
+  for (int64_t i = 0; i < kLength; ++i) {
+    num_true += bools.IsValid(i) && bools.Value(i);
+  }
+  ASSERT_NEAR(0.1, static_cast<double>(array->null_count()) / kLength, 0.01);
+  ASSERT_NEAR(0.81, static_cast<double>(num_true) / kLength, 0.01);
+}
+
+TEST(RandomArrayGenerator, String) {
+  RandomArrayGenerator gen(0);
+  std::shared_ptr<Array> array;
+  ASSERT_OK(gen.String(kLength, 2, 6, 0.5, &array));
+  ASSERT_OK(ValidateArray(*array));
+  ASSERT_NEAR(0.5, static_cast<double>(array->null_count()) / kLength, 0.01);
+  const auto& strings = checked_cast<const StringArray&>(*array);
+  for (int64_t i = 0; i < kLength; ++i) {
+    if (strings.IsValid(i)) {
+      ASSERT_GE(strings.value_length(i), 2);
+      ASSERT_LE(strings.value_length(i), 6);
+    }
+  }
+
+  // Any distribution of the lengths
+  ASSERT_OK(gen.String(kLength, std::geometric_distribution<int32_t>(0.2), 0, &array));
+  ASSERT_EQ(0, array->null_count());
+  const auto& geometric = checked_cast<const StringArray&>(*array);
+  ASSERT_NEAR(4.0, static_cast<double>(geometric.value_data()->size()) / kLength, 0.1);
+
+  ASSERT_OK(gen.StringWithRepeats(kLength, 10, 0, 3, 0.01, &array));
+  ASSERT_OK(ValidateArray(*array));
+  const auto& repeats = checked_cast<const StringArray&>(*array);
+  std::unordered_set<std::string> seen;
+  for (int64_t i = 0; i < kLength; ++i) {
+    if (repeats.IsValid(i)) {
+      seen.insert(repeats.GetString(i));
+    }
+  }
+  ASSERT_LE(seen.size(), 10);
+  ASSERT_RAISES(Invalid, gen.StringWithRepeats(kLength, 0, 0, 3, 0.01, &array));
+}
+
+TEST(RandomArrayGenerator, Chunked) {
+  RandomArrayGenerator gen(0);
+  auto make_chunk = [&gen](int64_t length, std::shared_ptr<Array>* out) {
+    return gen.Numeric<Int32Type>(length, 0, 100, 0.1, out);
+  };
+  std::shared_ptr<ChunkedArray> chunked;
+  ASSERT_OK(gen.Chunked(kLength, 1000, make_chunk, &chunked));
+  ASSERT_EQ(kLength, chunked->length());
+  ASSERT_EQ((kLength + 999) / 1000, chunked->num_chunks());
+  ASSERT_EQ(kLength % 1000, chunked->chunk(chunked->num_chunks() - 1)->length());
+
+  ASSERT_OK(gen.Chunked(0, 1000, make_chunk, &chunked));
+  ASSERT_EQ(1, chunked->num_chunks());
+  ASSERT_TRUE(chunked->type()->Equals(int32()));
+  ASSERT_RAISES(Invalid, gen.Chunked(kLength, 0, make_chunk, &chunked));
+}
+
+}  // namespace test
+}  // namespace arrow
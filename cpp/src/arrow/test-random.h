@@ -0,0 +1,221 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_TEST_RANDOM_H_
+#define ARROW_TEST_RANDOM_H_
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/builder.h"
+#include "arrow/memory_pool.h"
+#include "arrow/status.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/lazy.h"
+#include "arrow/util/macros.h"
+
+namespace arrow {
+namespace test {
+
+/// \brief Random arrays for tests and benchmarks, reproducible from a seed
+///
+/// The values are drawn one chunk at a time and appended straight to a
+/// builder, so no vector of the whole input is materialized next to it. All
+/// the arrays of a generator are drawn from a single stream: generators with
+/// the same seed produce the same arrays when called in the same order.
+class RandomArrayGenerator {
+ public:
+  /// The number of values drawn and appended at a time
+  static constexpr int64_t kChunkSize = 1 << 16;
+
+  explicit RandomArrayGenerator(uint32_t seed, MemoryPool* pool = default_memory_pool())
+      : engine_(seed), pool_(pool) {}
+
+  /// \brief Booleans, true with the given probability
+  Status Boolean(int64_t length, double true_probability, double null_probability,
+                 std::shared_ptr<Array>* out) {
+    std::bernoulli_distribution values(true_probability);
+    BooleanBuilder builder(pool_);
+    RETURN_NOT_OK(AppendChunks(length, null_probability, &values, &builder));
+    return builder.Finish(out);
+  }
+
+  /// \brief Numbers drawn uniformly from [min, max]
+  ///
+  /// The cardinality of integers is bounded by the width of the range.
+  template <typename ArrowType>
+  Status Numeric(int64_t length, typename ArrowType::c_type min,
+                 typename ArrowType::c_type max, double null_probability,
+                 std::shared_ptr<Array>* out) {
+    using c_type = typename ArrowType::c_type;
+    // uniform_int_distribution is not defined for the 8-bit types
+    using Distribution = typename std::conditional<
+        std::is_floating_point<c_type>::value, std::uniform_real_distribution<c_type>,
+        std::uniform_int_distribution<typename std::conditional<
+            std::is_signed<c_type>::value, int64_t, uint64_t>::type>>::type;
+    Distribution values(min, max);
+    typename TypeTraits<ArrowType>::BuilderType builder(
+        TypeTraits<ArrowType>::type_singleton(), pool_);
+    RETURN_NOT_OK(AppendChunks<c_type>(length, null_probability, &values, &builder));
+    return builder.Finish(out);
+  }
+
+  /// \brief Strings of random letters, whose lengths are drawn from the given
+  /// distribution and clamped to be non-negative
+  template <typename LengthDistribution>
+  Status String(int64_t length, LengthDistribution lengths, double null_probability,
+                std::shared_ptr<Array>* out) {
+    StringBuilder builder(pool_);
+    std::bernoulli_distribution is_valid(1.0 - null_probability);
+    std::string value;
+    for (int64_t start = 0; start < length; start += kChunkSize) {
+      const int64_t chunk_length = ChunkLength(start, length);
+      RETURN_NOT_OK(builder.Reserve(chunk_length));
+      for (int64_t i = 0; i < chunk_length; ++i) {
+        if (null_probability > 0 && !is_valid(engine_)) {
+          RETURN_NOT_OK(builder.AppendNull());
+          continue;
+        }
+        DrawString(std::max<int64_t>(0, static_cast<int64_t>(lengths(engine_))), &value);
+        RETURN_NOT_OK(builder.Append(value));
+      }
+    }
+    return builder.Finish(out);
+  }
+
+  /// \brief Strings whose lengths are drawn uniformly from [min_length,
+  /// max_length]
+  Status String(int64_t length, int32_t min_length, int32_t max_length,
+                double null_probability, std::shared_ptr<Array>* out) {
+    return String(length, std::uniform_int_distribution<int32_t>(min_length, max_length),
+                  null_probability, out);
+  }
+
+  /// \brief Strings drawn uniformly from `unique` distinct strings, whose
+  /// lengths are drawn uniformly from [min_length, max_length]
+  ///
+  /// Only the distinct strings are materialized, so the cardinality should be
+  /// small next to the length.
+  Status StringWithRepeats(int64_t length, int64_t unique, int32_t min_length,
+                           int32_t max_length, double null_probability,
+                           std::shared_ptr<Array>* out) {
+    if (unique <= 0) {
+      return Status::Invalid("StringWithRepeats needs at least one distinct string");
+    }
+    std::uniform_int_distribution<int32_t> lengths(min_length, max_length);
+    std::vector<std::string> uniques(static_cast<size_t>(unique));
+    for (auto& value : uniques) {
+      DrawString(lengths(engine_), &value);
+    }
+
+    std::uniform_int_distribution<int64_t> draws(0, unique - 1);
+    std::bernoulli_distribution is_valid(1.0 - null_probability);
+    StringBuilder builder(pool_);
+    for (int64_t start = 0; start < length; start += kChunkSize) {
+      const int64_t chunk_length = ChunkLength(start, length);
+      RETURN_NOT_OK(builder.Reserve(chunk_length));
+      for (int64_t i = 0; i < chunk_length; ++i) {
+        if (null_probability > 0 && !is_valid(engine_)) {
+          RETURN_NOT_OK(builder.AppendNull());
+        } else {
+          RETURN_NOT_OK(builder.Append(uniques[static_cast<size_t>(draws(engine_))]));
+        }
+      }
+    }
+    return builder.Finish(out);
+  }
+
+  /// \brief A chunked array of the given length, whose chunks of at most
+  /// chunk_length are made by make_chunk(chunk_length, &chunk)
+  ///
+  /// This bounds the memory held by a builder while generating inputs too
+  /// large for a single array.
+  template <typename MakeChunk>
+  Status Chunked(int64_t length, int64_t chunk_length, MakeChunk&& make_chunk,
+                 std::shared_ptr<ChunkedArray>* out) {
+    if (chunk_length <= 0) {
+      return Status::Invalid("Chunk length must be positive");
+    }
+    ArrayVector chunks;
+    int64_t start = 0;
+    // An empty array still has a chunk to give it its type
+    do {
+      std::shared_ptr<Array> chunk;
+      RETURN_NOT_OK(make_chunk(std::min(chunk_length, length - start), &chunk));
+      chunks.push_back(chunk);
+      start += chunk_length;
+    } while (start < length);
+    *out = std::make_shared<ChunkedArray>(chunks);
+    return Status::OK();
+  }
+
+ private:
+  // Append the values of each chunk through a lazy range, the validity
+  // following, or none if there are no nulls
+  template <typename ValueType = bool, typename Distribution, typename Builder>
+  Status AppendChunks(int64_t length, double null_probability, Distribution* values,
+                      Builder* builder) {
+    std::bernoulli_distribution is_valid(1.0 - null_probability);
+    std::mt19937* engine = &engine_;
+    auto value_range = internal::MakeLazyRange(
+        [=](int64_t) { return static_cast<ValueType>((*values)(*engine)); }, length);
+    auto valid_range = internal::MakeLazyRange(
+        [&](int64_t) { return is_valid(*engine); }, length);
+    for (int64_t start = 0; start < length; start += kChunkSize) {
+      const int64_t chunk_length = ChunkLength(start, length);
+      auto begin = value_range.begin() + start;
+      if (null_probability > 0) {
+        RETURN_NOT_OK(builder->AppendValues(begin, begin + chunk_length,
+                                            valid_range.begin() + start));
+      } else {
+        RETURN_NOT_OK(builder->AppendValues(begin, begin + chunk_length));
+      }
+    }
+    return Status::OK();
+  }
+
+  static int64_t ChunkLength(int64_t start, int64_t length) {
+    return length - start < kChunkSize ? length - start : kChunkSize;
+  }
+
+  void DrawString(int64_t length, std::string* out) {
+    std::uniform_int_distribution<int> letters('a', 'z');
+    out->resize(static_cast<size_t>(length));
+    for (auto& c : *out) {
+      c = static_cast<char>(letters(engine_));
+    }
+  }
+
+  std::mt19937 engine_;
+  MemoryPool* pool_;
+
+  ARROW_DISALLOW_COPY_AND_ASSIGN(RandomArrayGenerator);
+};
+
+}  // namespace test
+}  // namespace arrow
+
+#endif  // ARROW_TEST_RANDOM_H_
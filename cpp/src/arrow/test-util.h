@@ -412,7 +412,7 @@ void ArrayFromVector(const std::vector<bool>& is_valid, const std::vector<C_TYPE
 template <typename TYPE, typename C_TYPE>
 void ArrayFromVector(const std::vector<C_TYPE>& values, std::shared_ptr<Array>* out) {
   typename TypeTraits<TYPE>::BuilderType builder;
-  for (auto& value : values) {
+  for (const auto& value : values) {
     ASSERT_OK(builder.Append(value));
   }
   ASSERT_OK(builder.Finish(out));
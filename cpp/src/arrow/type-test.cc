@@ -248,6 +248,55 @@ TEST_F(TestSchema, TestRemoveMetadata) {
   ASSERT_TRUE(new_schema->metadata() == nullptr);
 }
 
+TEST_F(TestSchema, Fingerprint) {
+  auto f0 = field("f0", int32());
+  auto f1 = field("f1", list(timestamp(TimeUnit::MILLI, "UTC")), false);
+  auto schema = ::arrow::schema({f0, f1});
+  ASSERT_FALSE(schema->fingerprint().empty());
+
+  // Equal schemas built separately have equal fingerprints
+  auto schema2 = ::arrow::schema({field("f0", int32()),
+                                  field("f1", list(timestamp(TimeUnit::MILLI, "UTC")),
+                                        false)});
+  ASSERT_EQ(schema->fingerprint(), schema2->fingerprint());
+  ASSERT_TRUE(schema->Equals(*schema2));
+
+  // Any difference in the fields shows in the fingerprint
+  std::vector<std::shared_ptr<Schema>> others = {
+      ::arrow::schema({f0}),
+      ::arrow::schema({f1, f0}),
+      ::arrow::schema({field("f", int32()), f1}),
+      ::arrow::schema({field("f0", int32(), false), f1}),
+      ::arrow::schema({field("f0", int64()), f1}),
+      ::arrow::schema({f0, field("f1", list(timestamp(TimeUnit::MILLI)), false)}),
+      ::arrow::schema({f0->AddMetadata(key_value_metadata({{"a", "b"}})), f1})};
+  for (const auto& other : others) {
+    ASSERT_NE(schema->fingerprint(), other->fingerprint()) << other->ToString();
+    ASSERT_FALSE(schema->Equals(*other)) << other->ToString();
+  }
+
+  // The schema metadata is compared on its own
+  auto with_metadata = schema->AddMetadata(key_value_metadata({{"a", "b"}}));
+  ASSERT_EQ(schema->fingerprint(), with_metadata->fingerprint());
+  ASSERT_FALSE(schema->Equals(*with_metadata));
+  ASSERT_TRUE(schema->Equals(*with_metadata, false));
+}
+
+TEST_F(TestSchema, FingerprintDictionary) {
+  // Dictionary types are compared by their values, so schemas with such
+  // fields have no fingerprint and compare their fields
+  std::shared_ptr<Array> dict1, dict2;
+  ArrayFromVector<Int32Type, int32_t>({1, 2}, &dict1);
+  ArrayFromVector<Int32Type, int32_t>({1, 3}, &dict2);
+  auto schema1 = ::arrow::schema({field("f0", dictionary(int8(), dict1))});
+  auto schema2 = ::arrow::schema({field("f0", dictionary(int8(), dict2))});
+  ASSERT_EQ("", schema1->fingerprint());
+  ASSERT_EQ("", field("f", struct_({schema1->field(0)}))->fingerprint());
+  ASSERT_FALSE(schema1->Equals(*schema2));
+  auto schema3 = ::arrow::schema({field("f0", dictionary(int8(), dict1))});
+  ASSERT_TRUE(schema1->Equals(*schema3));
+}
+
 #define PRIMITIVE_TEST(KLASS, ENUM, NAME)        \
   TEST(TypesTest, TestPrimitive_##ENUM) {        \
     KLASS tp;                                    \
@@ -286,6 +335,19 @@ TEST(TestStringType, ToString) {
   ASSERT_EQ(str.ToString(), std::string("string"));
 }
 
+TEST(TestLargeBinaryType, ToString) {
+  LargeBinaryType t1;
+  LargeStringType t2;
+  EXPECT_TRUE(t1.Equals(LargeBinaryType()));
+  EXPECT_FALSE(t1.Equals(t2));
+  EXPECT_FALSE(t1.Equals(BinaryType()));
+  EXPECT_FALSE(t2.Equals(StringType()));
+  ASSERT_EQ(t1.id(), Type::LARGE_BINARY);
+  ASSERT_EQ(t2.id(), Type::LARGE_STRING);
+  ASSERT_EQ("large_binary", t1.ToString());
+  ASSERT_EQ("large_string", t2.ToString());
+}
+
 TEST(TestFixedSizeBinaryType, ToString) {
   auto t = fixed_size_binary(10);
   ASSERT_EQ(t->id(), Type::FIXED_SIZE_BINARY);
@@ -322,6 +384,44 @@ TEST(TestListType, Basics) {
   ASSERT_EQ("list<item: list<item: string>>", lt2.ToString());
 }
 
+TEST(TestLargeListType, Basics) {
+  LargeListType list_type(utf8());
+  ASSERT_EQ(list_type.id(), Type::LARGE_LIST);
+  ASSERT_EQ("large_list", list_type.name());
+  ASSERT_EQ("large_list<item: string>", list_type.ToString());
+  ASSERT_EQ(Type::STRING, list_type.value_type()->id());
+
+  ASSERT_TRUE(large_list(utf8())->Equals(list_type));
+  ASSERT_FALSE(large_list(binary())->Equals(list_type));
+  ASSERT_FALSE(list(utf8())->Equals(list_type));
+}
+
+TEST(TestFixedSizeListType, Basics) {
+  FixedSizeListType list_type(int16(), 3);
+  ASSERT_EQ(list_type.id(), Type::FIXED_SIZE_LIST);
+  ASSERT_EQ(3, list_type.list_size());
+  ASSERT_EQ("fixed_size_list", list_type.name());
+  ASSERT_EQ("fixed_size_list<item: int16>[3]", list_type.ToString());
+
+  ASSERT_TRUE(fixed_size_list(int16(), 3)->Equals(list_type));
+  ASSERT_FALSE(fixed_size_list(int16(), 4)->Equals(list_type));
+  ASSERT_FALSE(fixed_size_list(int32(), 3)->Equals(list_type));
+  ASSERT_NE(fixed_size_list(int16(), 4)->fingerprint(), list_type.fingerprint());
+}
+
+TEST(TestRunLengthEncodedType, Basics) {
+  RunLengthEncodedType rle_type(int16());
+  ASSERT_EQ(rle_type.id(), Type::RUN_LENGTH_ENCODED);
+  ASSERT_TRUE(rle_type.value_type()->Equals(int16()));
+  ASSERT_EQ("run_length_encoded", rle_type.name());
+  ASSERT_EQ("run_length_encoded<values: int16>", rle_type.ToString());
+
+  ASSERT_TRUE(run_length_encoded(int16())->Equals(rle_type));
+  ASSERT_FALSE(run_length_encoded(int32())->Equals(rle_type));
+  ASSERT_FALSE(list(int16())->Equals(rle_type));
+  ASSERT_NE(run_length_encoded(int32())->fingerprint(), rle_type.fingerprint());
+}
+
 TEST(TestDateTypes, Attrs) {
   auto t1 = date32();
   auto t2 = date64();
@@ -386,6 +486,23 @@ TEST(TestTimestampType, ToString) {
   ASSERT_EQ("timestamp[us]", t4->ToString());
 }
 
+TEST(TestParametricTypes, Interned) {
+  // The factory functions return one instance for equal parameters
+  ASSERT_EQ(timestamp(TimeUnit::MILLI), timestamp(TimeUnit::MILLI));
+  ASSERT_EQ(timestamp(TimeUnit::MILLI), timestamp(TimeUnit::MILLI, ""));
+  ASSERT_EQ(timestamp(TimeUnit::NANO, "UTC"), timestamp(TimeUnit::NANO, "UTC"));
+  ASSERT_NE(timestamp(TimeUnit::NANO, "UTC"), timestamp(TimeUnit::NANO));
+  ASSERT_NE(timestamp(TimeUnit::NANO), timestamp(TimeUnit::MICRO));
+  ASSERT_EQ(time32(TimeUnit::SECOND), time32(TimeUnit::SECOND));
+  ASSERT_EQ(time64(TimeUnit::NANO), time64(TimeUnit::NANO));
+  ASSERT_EQ(fixed_size_binary(16), fixed_size_binary(16));
+  ASSERT_NE(fixed_size_binary(16), fixed_size_binary(8));
+  ASSERT_EQ(decimal(12, 2), decimal(12, 2));
+  ASSERT_NE(decimal(12, 2), decimal(12, 3));
+  ASSERT_EQ("timestamp[ns, tz=UTC]", timestamp(TimeUnit::NANO, "UTC")->ToString());
+  ASSERT_EQ("decimal(12, 3)", decimal(12, 3)->ToString());
+}
+
 TEST(TestNestedType, Equals) {
   auto create_struct = [](std::string inner_name,
                           std::string struct_name) -> shared_ptr<Field> {
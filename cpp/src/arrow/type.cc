@@ -18,6 +18,8 @@
 #include "arrow/type.h"
 
 #include <climits>
+#include <map>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <utility>
@@ -31,9 +33,155 @@
 #include "arrow/util/logging.h"
 #include "arrow/util/stl.h"
 #include "arrow/visitor.h"
+#include "arrow/visitor_inline.h"
 
 namespace arrow {
 
+// ----------------------------------------------------------------------
+// Fingerprints
+
+namespace detail {
+
+Fingerprintable::~Fingerprintable() { delete fingerprint_.load(); }
+
+Fingerprintable& Fingerprintable::operator=(const Fingerprintable&) {
+  delete fingerprint_.exchange(NULLPTR);
+  return *this;
+}
+
+const std::string& Fingerprintable::fingerprint() const {
+  std::string* fingerprint = fingerprint_.load(std::memory_order_acquire);
+  if (fingerprint == NULLPTR) {
+    // Concurrent first uses may each compute it, the first one stored is kept
+    std::unique_ptr<std::string> computed(new std::string(ComputeFingerprint()));
+    if (fingerprint_.compare_exchange_strong(fingerprint, computed.get(),
+                                             std::memory_order_acq_rel)) {
+      fingerprint = computed.release();
+    }
+  }
+  return *fingerprint;
+}
+
+}  // namespace detail
+
+namespace {
+
+// Strings are prefixed with their length, so that no name or value can be
+// mistaken for the delimiters around it
+void AppendFingerprint(const std::string& value, std::string* out) {
+  out->append(std::to_string(value.size()));
+  out->push_back(':');
+  out->append(value);
+}
+
+void AppendFingerprint(const KeyValueMetadata& metadata, std::string* out) {
+  out->push_back('M');
+  out->append(std::to_string(metadata.size()));
+  for (int64_t i = 0; i < metadata.size(); ++i) {
+    AppendFingerprint(metadata.key(i), out);
+    AppendFingerprint(metadata.value(i), out);
+  }
+}
+
+// Appends the parameters and children of a type to its fingerprint, exactly
+// those that TypeEquals compares
+class TypeFingerprintVisitor {
+ public:
+  explicit TypeFingerprintVisitor(std::string* out) : out_(out) {}
+
+  template <typename T>
+  typename std::enable_if<std::is_base_of<NoExtraMeta, T>::value ||
+                              std::is_base_of<PrimitiveCType, T>::value,
+                          Status>::type
+  Visit(const T&) {
+    return Status::OK();
+  }
+
+  template <typename T>
+  typename std::enable_if<std::is_base_of<TimeType, T>::value ||
+                              std::is_base_of<DateType, T>::value,
+                          Status>::type
+  Visit(const T& type) {
+    AppendParameter(static_cast<int>(type.unit()));
+    return Status::OK();
+  }
+
+  Status Visit(const TimestampType& type) {
+    out_->push_back('[');
+    out_->append(std::to_string(static_cast<int>(type.unit())));
+    out_->push_back(',');
+    AppendFingerprint(type.timezone(), out_);
+    out_->push_back(']');
+    return Status::OK();
+  }
+
+  Status Visit(const FixedSizeBinaryType& type) {
+    AppendParameter(type.byte_width());
+    return Status::OK();
+  }
+
+  Status Visit(const Decimal128Type& type) {
+    out_->push_back('[');
+    out_->append(std::to_string(type.precision()));
+    out_->push_back(',');
+    out_->append(std::to_string(type.scale()));
+    out_->push_back(']');
+    return Status::OK();
+  }
+
+  Status Visit(const ListType& type) { return VisitChildren(type); }
+
+  Status Visit(const LargeListType& type) { return VisitChildren(type); }
+
+  Status Visit(const FixedSizeListType& type) {
+    AppendParameter(type.list_size());
+    return VisitChildren(type);
+  }
+
+  Status Visit(const RunLengthEncodedType& type) { return VisitChildren(type); }
+
+  Status Visit(const StructType& type) { return VisitChildren(type); }
+
+  Status Visit(const UnionType& type) {
+    out_->push_back('[');
+    out_->append(std::to_string(static_cast<int>(type.mode())));
+    for (uint8_t code : type.type_codes()) {
+      out_->push_back(',');
+      out_->append(std::to_string(static_cast<int>(code)));
+    }
+    out_->push_back(']');
+    return VisitChildren(type);
+  }
+
+  Status Visit(const DictionaryType&) {
+    return Status::NotImplemented("Dictionary types are compared by their values");
+  }
+
+ private:
+  void AppendParameter(int value) {
+    out_->push_back('[');
+    out_->append(std::to_string(value));
+    out_->push_back(']');
+  }
+
+  Status VisitChildren(const DataType& type) {
+    out_->push_back('{');
+    for (const auto& child : type.children()) {
+      const std::string& child_fingerprint = child->fingerprint();
+      if (child_fingerprint.empty()) {
+        return Status::NotImplemented("Child without a fingerprint");
+      }
+      out_->append(child_fingerprint);
+    }
+    out_->push_back('}');
+    return Status::OK();
+  }
+
+  std::string* out_;
+};
+
+}  // namespace
+
 bool Field::HasMetadata() const {
   return (metadata_ != nullptr) && (metadata_->size() > 0);
 }
@@ -83,6 +231,22 @@ bool Field::Equals(const std::shared_ptr<Field>& other) const {
   return Equals(*other.get());
 }
 
+std::string Field::ComputeFingerprint() const {
+  const std::string& type_fingerprint = type_->fingerprint();
+  if (type_fingerprint.empty()) {
+    return "";
+  }
+  std::string result = nullable_ ? "F" : "N";
+  AppendFingerprint(name_, &result);
+  result.push_back('(');
+  result.append(type_fingerprint);
+  result.push_back(')');
+  if (HasMetadata()) {
+    AppendFingerprint(*metadata_, &result);
+  }
+  return result;
+}
+
 std::string Field::ToString() const {
   std::stringstream ss;
   ss << this->name_ << ": " << this->type_->ToString();
@@ -103,6 +267,15 @@ bool DataType::Equals(const std::shared_ptr<DataType>& other) const {
   return Equals(*other.get());
 }
 
+std::string DataType::ComputeFingerprint() const {
+  std::string result = std::to_string(static_cast<int>(id_));
+  TypeFingerprintVisitor visitor(&result);
+  if (!VisitTypeInline(*this, &visitor).ok()) {
+    return "";
+  }
+  return result;
+}
+
 std::string BooleanType::ToString() const { return name(); }
 
 FloatingPoint::Precision HalfFloatType::precision() const { return FloatingPoint::HALF; }
@@ -121,6 +294,28 @@ std::string ListType::ToString() const {
 
 std::string BinaryType::ToString() const { return std::string("binary"); }
 
+std::string LargeStringType::ToString() const { return std::string("large_string"); }
+
+std::string LargeListType::ToString() const {
+  std::stringstream s;
+  s << "large_list<" << value_field()->ToString() << ">";
+  return s.str();
+}
+
+std::string FixedSizeListType::ToString() const {
+  std::stringstream s;
+  s << "fixed_size_list<" << value_field()->ToString() << ">[" << list_size_ << "]";
+  return s.str();
+}
+
+std::string RunLengthEncodedType::ToString() const {
+  std::stringstream s;
+  s << "run_length_encoded<" << value_field()->ToString() << ">";
+  return s.str();
+}
+
+std::string LargeBinaryType::ToString() const { return std::string("large_binary"); }
+
 int FixedSizeBinaryType::bit_width() const { return CHAR_BIT * byte_width(); }
 
 std::string FixedSizeBinaryType::ToString() const {
@@ -297,10 +492,18 @@ bool Schema::Equals(const Schema& other, bool check_metadata) const {
   if (num_fields() != other.num_fields()) {
     return false;
   }
-  for (int i = 0; i < num_fields(); ++i) {
-    if (!field(i)->Equals(*other.field(i).get())) {
+  const std::string& fingerprint = this->fingerprint();
+  const std::string& other_fingerprint = other.fingerprint();
+  if (!fingerprint.empty() && !other_fingerprint.empty()) {
+    if (fingerprint != other_fingerprint) {
       return false;
     }
+  } else {
+    for (int i = 0; i < num_fields(); ++i) {
+      if (!field(i)->Equals(*other.field(i).get())) {
+        return false;
+      }
+    }
   }
 
   // check metadata equality
@@ -315,6 +518,18 @@ bool Schema::Equals(const Schema& other, bool check_metadata) const {
   }
 }
 
+std::string Schema::ComputeFingerprint() const {
+  std::string result = "S";
+  for (const auto& field : fields_) {
+    const std::string& field_fingerprint = field->fingerprint();
+    if (field_fingerprint.empty()) {
+      return "";
+    }
+    result.append(field_fingerprint);
+  }
+  return result;
+}
+
 std::shared_ptr<Field> Schema::GetFieldByName(const std::string& name) const {
   int64_t i = GetFieldIndex(name);
   return i == -1 ? nullptr : fields_[i];
@@ -422,6 +637,11 @@ ACCEPT_VISITOR(BinaryType);
 ACCEPT_VISITOR(FixedSizeBinaryType);
 ACCEPT_VISITOR(StringType);
 ACCEPT_VISITOR(ListType);
+ACCEPT_VISITOR(LargeBinaryType);
+ACCEPT_VISITOR(LargeStringType);
+ACCEPT_VISITOR(LargeListType);
+ACCEPT_VISITOR(FixedSizeListType);
+ACCEPT_VISITOR(RunLengthEncodedType);
 ACCEPT_VISITOR(StructType);
 ACCEPT_VISITOR(Decimal128Type);
 ACCEPT_VISITOR(UnionType);
@@ -454,27 +674,61 @@ TYPE_FACTORY(float32, FloatType);
 TYPE_FACTORY(float64, DoubleType);
 TYPE_FACTORY(utf8, StringType);
 TYPE_FACTORY(binary, BinaryType);
+TYPE_FACTORY(large_utf8, LargeStringType);
+TYPE_FACTORY(large_binary, LargeBinaryType);
 TYPE_FACTORY(date64, Date64Type);
 TYPE_FACTORY(date32, Date32Type);
 
+namespace {
+
+// Hash-consing of the parametric types without children: their factory
+// functions return one instance for equal parameters as long as it is in use,
+// rather than allocating a type per call
+template <typename Key>
+class TypeCache {
+ public:
+  template <typename MakeType>
+  std::shared_ptr<DataType> Get(const Key& key, MakeType&& make_type) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::weak_ptr<DataType>& cached = types_[key];
+    std::shared_ptr<DataType> type = cached.lock();
+    if (!type) {
+      // Not allocated along with its control block, which the cache keeps
+      // alive after the type is released
+      type.reset(make_type());
+      cached = type;
+    }
+    return type;
+  }
+
+ private:
+  std::mutex mutex_;
+  std::map<Key, std::weak_ptr<DataType>> types_;
+};
+
+}  // namespace
+
 std::shared_ptr<DataType> fixed_size_binary(int32_t byte_width) {
-  return std::make_shared<FixedSizeBinaryType>(byte_width);
+  static TypeCache<int32_t> cache;
+  return cache.Get(byte_width, [&]() { return new FixedSizeBinaryType(byte_width); });
 }
 
-std::shared_ptr<DataType> timestamp(TimeUnit::type unit) {
-  return std::make_shared<TimestampType>(unit);
-}
+std::shared_ptr<DataType> timestamp(TimeUnit::type unit) { return timestamp(unit, ""); }
 
 std::shared_ptr<DataType> timestamp(TimeUnit::type unit, const std::string& timezone) {
-  return std::make_shared<TimestampType>(unit, timezone);
+  static TypeCache<std::pair<TimeUnit::type, std::string>> cache;
+  return cache.Get(std::make_pair(unit, timezone),
+                   [&]() { return new TimestampType(unit, timezone); });
 }
 
 std::shared_ptr<DataType> time32(TimeUnit::type unit) {
-  return std::make_shared<Time32Type>(unit);
+  static TypeCache<TimeUnit::type> cache;
+  return cache.Get(unit, [&]() { return new Time32Type(unit); });
 }
 
 std::shared_ptr<DataType> time64(TimeUnit::type unit) {
-  return std::make_shared<Time64Type>(unit);
+  static TypeCache<TimeUnit::type> cache;
+  return cache.Get(unit, [&]() { return new Time64Type(unit); });
 }
 
 std::shared_ptr<DataType> list(const std::shared_ptr<DataType>& value_type) {
@@ -485,6 +739,29 @@ std::shared_ptr<DataType> list(const std::shared_ptr<Field>& value_field) {
   return std::make_shared<ListType>(value_field);
 }
 
+std::shared_ptr<DataType> large_list(const std::shared_ptr<DataType>& value_type) {
+  return std::make_shared<LargeListType>(value_type);
+}
+
+std::shared_ptr<DataType> large_list(const std::shared_ptr<Field>& value_field) {
+  return std::make_shared<LargeListType>(value_field);
+}
+
+std::shared_ptr<DataType> fixed_size_list(const std::shared_ptr<DataType>& value_type,
+                                          int32_t list_size) {
+  return std::make_shared<FixedSizeListType>(value_type, list_size);
+}
+
+std::shared_ptr<DataType> fixed_size_list(const std::shared_ptr<Field>& value_field,
+                                          int32_t list_size) {
+  return std::make_shared<FixedSizeListType>(value_field, list_size);
+}
+
+std::shared_ptr<DataType> run_length_encoded(
+    const std::shared_ptr<DataType>& value_type) {
+  return std::make_shared<RunLengthEncodedType>(value_type);
+}
+
 std::shared_ptr<DataType> struct_(const std::vector<std::shared_ptr<Field>>& fields) {
   return std::make_shared<StructType>(fields);
 }
@@ -521,7 +798,9 @@ std::shared_ptr<Field> field(const std::string& name,
 }
 
 std::shared_ptr<DataType> decimal(int32_t precision, int32_t scale) {
-  return std::make_shared<Decimal128Type>(precision, scale);
+  static TypeCache<std::pair<int32_t, int32_t>> cache;
+  return cache.Get(std::make_pair(precision, scale),
+                   [&]() { return new Decimal128Type(precision, scale); });
 }
 
 std::string Decimal128Type::ToString() const {
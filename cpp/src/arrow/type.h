@@ -18,6 +18,7 @@
 #ifndef ARROW_TYPE_H
 #define ARROW_TYPE_H
 
+#include <atomic>
 #include <climits>
 #include <cstdint>
 #include <memory>
@@ -130,11 +131,58 @@ struct Type {
     DICTIONARY,
 
     /// Map, a repeated struct logical type
-    MAP
+    MAP,
+
+    /// A list of some logical data type, of the same number of values in
+    /// every slot
+    FIXED_SIZE_LIST,
+
+    /// UTF8 variable-length string as List<Char>, with 64-bit offsets
+    LARGE_STRING,
+
+    /// Variable-length bytes (no guarantee of UTF8-ness), with 64-bit offsets
+    LARGE_BINARY,
+
+    /// A list of some logical data type, with 64-bit offsets
+    LARGE_LIST,
+
+    /// Runs of equal values of some logical data type, each stored once with
+    /// the position where its run ends
+    RUN_LENGTH_ENCODED
   };
 };
 
-class ARROW_EXPORT DataType {
+namespace detail {
+
+/// \brief Base class for the immutable objects having a fingerprint
+///
+/// Equal objects have equal fingerprints, so that comparing the cached
+/// fingerprints of two objects settles their equality at once. The
+/// fingerprint is computed on first use. It is empty for the objects that
+/// cannot be fingerprinted, such as dictionary types, whose equality depends
+/// on the dictionary values.
+class ARROW_EXPORT Fingerprintable {
+ public:
+  virtual ~Fingerprintable();
+
+  /// \brief The fingerprint of the object, empty if it has none
+  const std::string& fingerprint() const;
+
+ protected:
+  Fingerprintable() : fingerprint_(NULLPTR) {}
+  // Copies compute their own fingerprint
+  Fingerprintable(const Fingerprintable&) : fingerprint_(NULLPTR) {}
+  Fingerprintable& operator=(const Fingerprintable&);
+
+  virtual std::string ComputeFingerprint() const = 0;
+
+ private:
+  mutable std::atomic<std::string*> fingerprint_;
+};
+
+}  // namespace detail
+
+class ARROW_EXPORT DataType : public detail::Fingerprintable {
  public:
   explicit DataType(Type::type id) : id_(id) {}
   virtual ~DataType();
@@ -166,6 +214,8 @@ class ARROW_EXPORT DataType {
   Type::type id() const { return id_; }
 
  protected:
+  std::string ComputeFingerprint() const override;
+
   Type::type id_;
   std::vector<std::shared_ptr<Field>> children_;
 
@@ -224,7 +274,7 @@ class NoExtraMeta {};
 
 // A field is a piece of metadata that includes (for now) a name and a data
 // type
-class ARROW_EXPORT Field {
+class ARROW_EXPORT Field : public detail::Fingerprintable {
  public:
   Field(const std::string& name, const std::shared_ptr<DataType>& type,
         bool nullable = true,
@@ -250,6 +300,9 @@ class ARROW_EXPORT Field {
   std::shared_ptr<DataType> type() const { return type_; }
   bool nullable() const { return nullable_; }
 
+ protected:
+  std::string ComputeFingerprint() const override;
+
  private:
   // Field name
   std::string name_;
@@ -387,6 +440,7 @@ class ARROW_EXPORT DoubleType
 class ARROW_EXPORT ListType : public NestedType {
  public:
   static constexpr Type::type type_id = Type::LIST;
+  using offset_type = int32_t;
 
   // List can contain any other logical value type
   explicit ListType(const std::shared_ptr<DataType>& value_type)
@@ -406,6 +460,90 @@ class ARROW_EXPORT ListType : public NestedType {
   std::string name() const override { return "list"; }
 };
 
+/// \brief A list type with 64-bit offsets, for lists whose values do not fit
+/// in the 32-bit offsets of ListType
+class ARROW_EXPORT LargeListType : public NestedType {
+ public:
+  static constexpr Type::type type_id = Type::LARGE_LIST;
+  using offset_type = int64_t;
+
+  explicit LargeListType(const std::shared_ptr<DataType>& value_type)
+      : LargeListType(std::make_shared<Field>("item", value_type)) {}
+
+  explicit LargeListType(const std::shared_ptr<Field>& value_field)
+      : NestedType(Type::LARGE_LIST) {
+    children_ = {value_field};
+  }
+
+  std::shared_ptr<Field> value_field() const { return children_[0]; }
+
+  std::shared_ptr<DataType> value_type() const { return children_[0]->type(); }
+
+  Status Accept(TypeVisitor* visitor) const override;
+  std::string ToString() const override;
+
+  std::string name() const override { return "large_list"; }
+};
+
+/// \brief A list type of the same number of values in every slot
+///
+/// The values of slot i are at positions [i * list_size, (i + 1) * list_size)
+/// of the child, so no offsets are stored.
+class ARROW_EXPORT FixedSizeListType : public NestedType {
+ public:
+  static constexpr Type::type type_id = Type::FIXED_SIZE_LIST;
+
+  FixedSizeListType(const std::shared_ptr<DataType>& value_type, int32_t list_size)
+      : FixedSizeListType(std::make_shared<Field>("item", value_type), list_size) {}
+
+  FixedSizeListType(const std::shared_ptr<Field>& value_field, int32_t list_size)
+      : NestedType(Type::FIXED_SIZE_LIST), list_size_(list_size) {
+    children_ = {value_field};
+  }
+
+  std::shared_ptr<Field> value_field() const { return children_[0]; }
+
+  std::shared_ptr<DataType> value_type() const { return children_[0]->type(); }
+
+  int32_t list_size() const { return list_size_; }
+
+  Status Accept(TypeVisitor* visitor) const override;
+  std::string ToString() const override;
+
+  std::string name() const override { return "fixed_size_list"; }
+
+ protected:
+  int32_t list_size_;
+};
+
+/// \brief Concrete type class for run-length-encoded data
+///
+/// The array has a value per run in its child, and an int32 buffer of the
+/// position where each run ends, exclusive and counted from the start of the
+/// unsliced array. The array itself has no validity bitmap: null slots are
+/// runs of a null value.
+class ARROW_EXPORT RunLengthEncodedType : public NestedType {
+ public:
+  static constexpr Type::type type_id = Type::RUN_LENGTH_ENCODED;
+
+  explicit RunLengthEncodedType(const std::shared_ptr<DataType>& value_type)
+      : RunLengthEncodedType(std::make_shared<Field>("values", value_type)) {}
+
+  explicit RunLengthEncodedType(const std::shared_ptr<Field>& value_field)
+      : NestedType(Type::RUN_LENGTH_ENCODED) {
+    children_ = {value_field};
+  }
+
+  std::shared_ptr<Field> value_field() const { return children_[0]; }
+
+  std::shared_ptr<DataType> value_type() const { return children_[0]->type(); }
+
+  Status Accept(TypeVisitor* visitor) const override;
+  std::string ToString() const override;
+
+  std::string name() const override { return "run_length_encoded"; }
+};
+
 namespace meta {
 
 /// Additional ListType class that can be instantiated with only compile-time arguments.
@@ -423,6 +561,7 @@ class ARROW_EXPORT ListType : public ::arrow::ListType {
 class ARROW_EXPORT BinaryType : public DataType, public NoExtraMeta {
  public:
   static constexpr Type::type type_id = Type::BINARY;
+  using offset_type = int32_t;
 
   BinaryType() : BinaryType(Type::BINARY) {}
 
@@ -468,6 +607,39 @@ class ARROW_EXPORT StringType : public BinaryType {
   std::string name() const override { return "utf8"; }
 };
 
+/// \brief Variable-length bytes with 64-bit offsets, for values that do not
+/// fit in the 32-bit offsets of BinaryType
+///
+/// It is not a subclass of BinaryType, so that code written for 32-bit
+/// offsets cannot be handed 64-bit ones by mistake.
+class ARROW_EXPORT LargeBinaryType : public DataType, public NoExtraMeta {
+ public:
+  static constexpr Type::type type_id = Type::LARGE_BINARY;
+  using offset_type = int64_t;
+
+  LargeBinaryType() : LargeBinaryType(Type::LARGE_BINARY) {}
+
+  Status Accept(TypeVisitor* visitor) const override;
+  std::string ToString() const override;
+  std::string name() const override { return "large_binary"; }
+
+ protected:
+  // Allow subclasses to change the logical type.
+  explicit LargeBinaryType(Type::type logical_type) : DataType(logical_type) {}
+};
+
+// UTF-8 encoded strings with 64-bit offsets
+class ARROW_EXPORT LargeStringType : public LargeBinaryType {
+ public:
+  static constexpr Type::type type_id = Type::LARGE_STRING;
+
+  LargeStringType() : LargeBinaryType(Type::LARGE_STRING) {}
+
+  Status Accept(TypeVisitor* visitor) const override;
+  std::string ToString() const override;
+  std::string name() const override { return "large_utf8"; }
+};
+
 class ARROW_EXPORT StructType : public NestedType {
  public:
   static constexpr Type::type type_id = Type::STRUCT;
@@ -741,7 +913,7 @@ class ARROW_EXPORT DictionaryType : public FixedWidthType {
 /// \class Schema
 /// \brief Sequence of arrow::Field objects describing the columns of a record
 /// batch or table data structure
-class ARROW_EXPORT Schema {
+class ARROW_EXPORT Schema : public detail::Fingerprintable {
  public:
   explicit Schema(const std::vector<std::shared_ptr<Field>>& fields,
                   const std::shared_ptr<const KeyValueMetadata>& metadata = NULLPTR);
@@ -752,6 +924,9 @@ class ARROW_EXPORT Schema {
   virtual ~Schema() = default;
 
   /// Returns true if all of the schema fields are equal
+  ///
+  /// Schemas that both have a fingerprint compare their fingerprints rather
+  /// than each field, so that repeated comparisons are cheap.
   bool Equals(const Schema& other, bool check_metadata = true) const;
 
   /// Return the ith schema element. Does not boundscheck
@@ -795,6 +970,10 @@ class ARROW_EXPORT Schema {
   /// \brief Return the number of fields (columns) in the schema
   int num_fields() const { return static_cast<int>(fields_.size()); }
 
+ protected:
+  // The fingerprint of the fields, the metadata of the schema being left out
+  std::string ComputeFingerprint() const override;
+
  private:
   std::vector<std::shared_ptr<Field>> fields_;
 
@@ -823,6 +1002,28 @@ std::shared_ptr<DataType> list(const std::shared_ptr<Field>& value_type);
 ARROW_EXPORT
 std::shared_ptr<DataType> list(const std::shared_ptr<DataType>& value_type);
 
+/// \brief Make an instance of LargeListType
+ARROW_EXPORT
+std::shared_ptr<DataType> large_list(const std::shared_ptr<Field>& value_type);
+
+/// \brief Make an instance of LargeListType
+ARROW_EXPORT
+std::shared_ptr<DataType> large_list(const std::shared_ptr<DataType>& value_type);
+
+/// \brief Make an instance of FixedSizeListType
+ARROW_EXPORT
+std::shared_ptr<DataType> fixed_size_list(const std::shared_ptr<Field>& value_type,
+                                          int32_t list_size);
+
+/// \brief Make an instance of FixedSizeListType
+ARROW_EXPORT
+std::shared_ptr<DataType> fixed_size_list(const std::shared_ptr<DataType>& value_type,
+                                          int32_t list_size);
+
+/// \brief Make an instance of RunLengthEncodedType
+ARROW_EXPORT
+std::shared_ptr<DataType> run_length_encoded(const std::shared_ptr<DataType>& value_type);
+
 /// \brief Make an instance of TimestampType
 ARROW_EXPORT
 std::shared_ptr<DataType> timestamp(TimeUnit::type unit);
@@ -66,10 +66,30 @@ class StringType;
 class StringArray;
 class StringBuilder;
 
+class LargeBinaryType;
+class LargeBinaryArray;
+class LargeBinaryBuilder;
+
+class LargeStringType;
+class LargeStringArray;
+class LargeStringBuilder;
+
 class ListType;
 class ListArray;
 class ListBuilder;
 
+class LargeListType;
+class LargeListArray;
+class LargeListBuilder;
+
+class FixedSizeListType;
+class FixedSizeListArray;
+class FixedSizeListBuilder;
+
+class RunLengthEncodedType;
+class RunLengthEncodedArray;
+class RunLengthEncodedBuilder;
+
 class StructType;
 class StructArray;
 class StructBuilder;
@@ -151,6 +171,8 @@ std::shared_ptr<DataType> ARROW_EXPORT float32();
 std::shared_ptr<DataType> ARROW_EXPORT float64();
 std::shared_ptr<DataType> ARROW_EXPORT utf8();
 std::shared_ptr<DataType> ARROW_EXPORT binary();
+std::shared_ptr<DataType> ARROW_EXPORT large_utf8();
+std::shared_ptr<DataType> ARROW_EXPORT large_binary();
 
 std::shared_ptr<DataType> ARROW_EXPORT date32();
 std::shared_ptr<DataType> ARROW_EXPORT date64();
@@ -269,6 +269,22 @@ struct TypeTraits<BinaryType> {
   static inline std::shared_ptr<DataType> type_singleton() { return binary(); }
 };
 
+template <>
+struct TypeTraits<LargeStringType> {
+  using ArrayType = LargeStringArray;
+  using BuilderType = LargeStringBuilder;
+  constexpr static bool is_parameter_free = true;
+  static inline std::shared_ptr<DataType> type_singleton() { return large_utf8(); }
+};
+
+template <>
+struct TypeTraits<LargeBinaryType> {
+  using ArrayType = LargeBinaryArray;
+  using BuilderType = LargeBinaryBuilder;
+  constexpr static bool is_parameter_free = true;
+  static inline std::shared_ptr<DataType> type_singleton() { return large_binary(); }
+};
+
 template <>
 struct TypeTraits<FixedSizeBinaryType> {
   using ArrayType = FixedSizeBinaryArray;
@@ -283,6 +299,27 @@ struct TypeTraits<ListType> {
   constexpr static bool is_parameter_free = false;
 };
 
+template <>
+struct TypeTraits<LargeListType> {
+  using ArrayType = LargeListArray;
+  using BuilderType = LargeListBuilder;
+  constexpr static bool is_parameter_free = false;
+};
+
+template <>
+struct TypeTraits<FixedSizeListType> {
+  using ArrayType = FixedSizeListArray;
+  using BuilderType = FixedSizeListBuilder;
+  constexpr static bool is_parameter_free = false;
+};
+
+template <>
+struct TypeTraits<RunLengthEncodedType> {
+  using ArrayType = RunLengthEncodedArray;
+  using BuilderType = RunLengthEncodedBuilder;
+  constexpr static bool is_parameter_free = false;
+};
+
 template <>
 struct TypeTraits<StructType> {
   using ArrayType = StructArray;
@@ -349,6 +386,10 @@ template <typename T>
 using enable_if_binary =
     typename std::enable_if<std::is_base_of<BinaryType, T>::value>::type;
 
+template <typename T>
+using enable_if_large_binary =
+    typename std::enable_if<std::is_base_of<LargeBinaryType, T>::value>::type;
+
 template <typename T>
 using enable_if_boolean =
     typename std::enable_if<std::is_same<BooleanType, T>::value>::type;
@@ -360,6 +401,14 @@ using enable_if_fixed_size_binary =
 template <typename T>
 using enable_if_list = typename std::enable_if<std::is_base_of<ListType, T>::value>::type;
 
+template <typename T>
+using enable_if_large_list =
+    typename std::enable_if<std::is_base_of<LargeListType, T>::value>::type;
+
+template <typename T>
+using enable_if_fixed_size_list =
+    typename std::enable_if<std::is_base_of<FixedSizeListType, T>::value>::type;
+
 template <typename T>
 using enable_if_number = typename std::enable_if<is_number<T>::value>::type;
 
@@ -496,6 +545,17 @@ static inline bool is_binary_like(Type::type type_id) {
   return false;
 }
 
+static inline bool is_large_binary_like(Type::type type_id) {
+  switch (type_id) {
+    case Type::LARGE_BINARY:
+    case Type::LARGE_STRING:
+      return true;
+    default:
+      break;
+  }
+  return false;
+}
+
 static inline bool is_dictionary(Type::type type_id) {
   return type_id == Type::DICTIONARY;
 }
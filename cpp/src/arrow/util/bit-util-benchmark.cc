@@ -236,6 +236,27 @@ BENCHMARK(BM_CopyBitmap)
     ->MinTime(1.0)
     ->Unit(benchmark::kMicrosecond);
 
+static void BM_CountSetBits(benchmark::State& state) {  // NOLINT non-const reference
+  const int kBufferSize = static_cast<int>(state.range(0));
+  std::shared_ptr<Buffer> buffer = CreateRandomBuffer(kBufferSize);
+
+  const int64_t offset = state.range(1);
+  const int64_t num_bits = kBufferSize * 8 - offset;
+  int64_t count = 0;
+  while (state.KeepRunning()) {
+    count += CountSetBits(buffer->data(), offset, num_bits);
+  }
+  benchmark::DoNotOptimize(count);
+  state.SetBytesProcessed(state.iterations() * kBufferSize);
+}
+
+BENCHMARK(BM_CountSetBits)
+    ->Args({1000, 0})
+    ->Args({100000, 0})
+    ->Args({100000, 3})
+    ->MinTime(1.0)
+    ->Unit(benchmark::kMicrosecond);
+
 BENCHMARK(BM_NaiveBitmapReader)
     ->Args({100000})
     ->MinTime(1.0)
@@ -401,6 +401,148 @@ TEST(BitmapAnd, Unaligned) {
   }
 }
 
+TEST(BitmapAnd, UnalignedWords) {
+  const int64_t length = 300;
+  std::vector<uint8_t> left(100);
+  std::vector<uint8_t> right(100);
+  test::random_bytes(left.size(), 0, left.data());
+  test::random_bytes(right.size(), 1, right.data());
+
+  for (int64_t left_offset : {0, 3, 64, 77}) {
+    for (int64_t right_offset : {1, 8, 45}) {
+      for (int64_t out_offset : {0, 16, 5}) {
+        std::shared_ptr<Buffer> out;
+        ASSERT_OK(BitmapAnd(default_memory_pool(), left.data(), left_offset,
+                            right.data(), right_offset, length, out_offset, &out));
+        for (int64_t i = 0; i < length; ++i) {
+          ASSERT_EQ(BitUtil::GetBit(left.data(), left_offset + i) &&
+                        BitUtil::GetBit(right.data(), right_offset + i),
+                    BitUtil::GetBit(out->data(), out_offset + i));
+        }
+      }
+    }
+  }
+}
+
+typedef Status (*BitmapOpFunc)(MemoryPool*, const uint8_t*, int64_t, const uint8_t*,
+                               int64_t, int64_t, int64_t, std::shared_ptr<Buffer>*);
+typedef void (*BitmapOpIntoFunc)(const uint8_t*, int64_t, const uint8_t*, int64_t,
+                                 int64_t, int64_t, uint8_t*);
+
+void CheckBitmapOp(BitmapOpFunc op, BitmapOpIntoFunc op_into,
+                   std::function<bool(bool, bool)> expected_op) {
+  const int64_t length = 300;
+  std::vector<uint8_t> left(100);
+  std::vector<uint8_t> right(100);
+  test::random_bytes(left.size(), 0, left.data());
+  test::random_bytes(right.size(), 1, right.data());
+
+  for (int64_t left_offset : {0, 3, 8, 64, 77}) {
+    for (int64_t right_offset : {0, 1, 8, 45, 67}) {
+      for (int64_t out_offset : {0, 5, 16, 67}) {
+        for (int64_t op_length : {int64_t(0), int64_t(7), int64_t(70), length}) {
+          std::shared_ptr<Buffer> out;
+          ASSERT_OK(op(default_memory_pool(), left.data(), left_offset, right.data(),
+                       right_offset, op_length, out_offset, &out));
+          // Into an existing bitmap, whose other bits are left as they are
+          std::vector<uint8_t> into(100, 0xA5);
+          op_into(left.data(), left_offset, right.data(), right_offset, op_length,
+                  out_offset, into.data());
+          for (int64_t i = 0; i < op_length; ++i) {
+            const bool expected =
+                expected_op(BitUtil::GetBit(left.data(), left_offset + i),
+                            BitUtil::GetBit(right.data(), right_offset + i));
+            ASSERT_EQ(expected, BitUtil::GetBit(out->data(), out_offset + i));
+            ASSERT_EQ(expected, BitUtil::GetBit(into.data(), out_offset + i));
+          }
+          for (int64_t i = 0; i < 800; ++i) {
+            if (i < out_offset || i >= out_offset + op_length) {
+              ASSERT_EQ(BitUtil::GetBit(into.data(), i), (0xA5 >> (i % 8)) & 1)
+                  << "clobbered bit #" << i;
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+Status InvertBitmapFunc(MemoryPool* pool, const uint8_t* left, int64_t left_offset,
+                        const uint8_t*, int64_t, int64_t length, int64_t out_offset,
+                        std::shared_ptr<Buffer>* out) {
+  return InvertBitmap(pool, left, left_offset, length, out_offset, out);
+}
+
+void InvertBitmapIntoFunc(const uint8_t* left, int64_t left_offset, const uint8_t*,
+                          int64_t, int64_t length, int64_t out_offset, uint8_t* out) {
+  InvertBitmap(left, left_offset, length, out_offset, out);
+}
+
+TEST(BitmapOps, And) {
+  CheckBitmapOp(BitmapAnd, BitmapAnd, [](bool l, bool r) { return l && r; });
+}
+
+TEST(BitmapOps, Or) {
+  CheckBitmapOp(BitmapOr, BitmapOr, [](bool l, bool r) { return l || r; });
+}
+
+TEST(BitmapOps, Xor) {
+  CheckBitmapOp(BitmapXor, BitmapXor, [](bool l, bool r) { return l != r; });
+}
+
+TEST(BitmapOps, AndNot) {
+  CheckBitmapOp(BitmapAndNot, BitmapAndNot, [](bool l, bool r) { return l && !r; });
+}
+
+TEST(BitmapOps, Invert) {
+  CheckBitmapOp(InvertBitmapFunc, InvertBitmapIntoFunc, [](bool l, bool) { return !l; });
+}
+
+TEST(BitBlockCounter, Blocks) {
+  std::vector<uint8_t> bitmap(200);
+  test::random_bytes(bitmap.size(), 0, bitmap.data());
+  // Runs of set and cleared bits, for whole blocks of each
+  memset(bitmap.data() + 40, 0xFF, 40);
+  memset(bitmap.data() + 100, 0, 40);
+
+  for (int64_t offset : {0, 1, 7, 8, 63, 64, 65}) {
+    for (int64_t length : {0, 1, 63, 64, 65, 255, 256, 257, 1300}) {
+      for (int block_size : {64, 256}) {
+        internal::BitBlockCounter counter(bitmap.data(), offset, length);
+        int64_t position = 0;
+        internal::BitBlockCount block;
+        do {
+          block = block_size == 64 ? counter.NextWord() : counter.NextFourWords();
+          ASSERT_EQ(std::min<int64_t>(block_size, length - position), block.length);
+          ASSERT_EQ(CountSetBits(bitmap.data(), offset + position, block.length),
+                    block.popcount);
+          position += block.length;
+        } while (block.length > 0);
+        ASSERT_EQ(length, position);
+      }
+    }
+  }
+
+  // Whole blocks of set and of cleared bits
+  internal::BitBlockCounter counter(bitmap.data(), 40 * 8, 80 * 8);
+  ASSERT_TRUE(counter.NextFourWords().AllSet());
+  ASSERT_TRUE(counter.NextWord().AllSet());
+  internal::BitBlockCounter counter2(bitmap.data(), 100 * 8, 40 * 8);
+  ASSERT_TRUE(counter2.NextFourWords().NoneSet());
+  ASSERT_TRUE(counter2.NextWord().NoneSet());
+}
+
+TEST(BitBlockCounter, NullBitmap) {
+  internal::BitBlockCounter counter(nullptr, 13, 300);
+  auto block = counter.NextFourWords();
+  ASSERT_EQ(256, block.length);
+  ASSERT_TRUE(block.AllSet());
+  block = counter.NextWord();
+  ASSERT_EQ(44, block.length);
+  ASSERT_TRUE(block.AllSet());
+  ASSERT_EQ(0, counter.NextWord().length);
+}
+
 static inline int64_t SlowCountBits(const uint8_t* data, int64_t bit_offset,
                                     int64_t length) {
   int64_t count = 0;
@@ -430,6 +572,88 @@ TEST(BitUtilTests, TestCountSetBits) {
   }
 }
 
+TEST(BitUtilTests, TestCountSetBitsLarge) {
+  // Large enough for the AVX2 kernel, whose blocks of 16 vectors are 512 bytes
+  const int kBufferSize = 5000;
+  std::vector<uint8_t> buffer(kBufferSize);
+  test::random_bytes(kBufferSize, 0, buffer.data());
+  const int64_t num_bits = kBufferSize * 8;
+
+  CpuInfo::Init();
+  const bool has_avx2 = CpuInfo::IsSupported(CpuInfo::AVX2);
+  for (bool use_avx2 : {true, false}) {
+    if (has_avx2) {
+      CpuInfo::EnableFeature(CpuInfo::AVX2, use_avx2);
+    }
+    for (int64_t offset : {0, 5, 64, 100, 4097}) {
+      for (int64_t length : {num_bits - offset, int64_t(4096), int64_t(4096 * 8 + 7)}) {
+        ASSERT_EQ(SlowCountBits(buffer.data(), offset, length),
+                  CountSetBits(buffer.data(), offset, length));
+      }
+    }
+  }
+  if (has_avx2) {
+    CpuInfo::EnableFeature(CpuInfo::AVX2, true);
+  }
+}
+
+TEST(BitUtilTests, TestBitmapCounts) {
+  const int64_t kBlockBits = internal::BitmapCounts::kBlockBits;
+  const int kBufferSize = static_cast<int>(5 * kBlockBits / 8 + 100);
+  std::vector<uint8_t> buffer(kBufferSize);
+  test::random_bytes(kBufferSize, 0, buffer.data());
+  const int64_t num_bits = kBufferSize * 8;
+
+  internal::BitmapCounts counts(buffer.data(), num_bits);
+  ASSERT_EQ(num_bits, counts.length());
+  for (int64_t offset : {int64_t(0), int64_t(1), int64_t(100), kBlockBits - 1, kBlockBits,
+                         kBlockBits + 3, 3 * kBlockBits}) {
+    for (int64_t length : {int64_t(0), int64_t(1), int64_t(64), kBlockBits,
+                           kBlockBits + 1, 2 * kBlockBits + 100, num_bits - offset}) {
+      if (offset + length > num_bits) {
+        continue;
+      }
+      ASSERT_EQ(SlowCountBits(buffer.data(), offset, length),
+                counts.CountSetBits(buffer.data(), offset, length))
+          << offset << " " << length;
+    }
+  }
+}
+
+TEST(BitUtilTests, TestPackBytesToBitmap) {
+  const int kNumBytes = 300;
+  std::vector<uint8_t> bytes(kNumBytes);
+  test::random_bytes(kNumBytes, 0, bytes.data());
+  // Make roughly a third of the bytes zero
+  for (auto& byte : bytes) {
+    byte = static_cast<uint8_t>(byte % 3 == 0 ? 0 : byte);
+  }
+
+  std::vector<int64_t> lengths = {0, 1, 7, 8, 15, 16, 17, 64, 133, kNumBytes};
+  std::vector<int64_t> offsets = {0, 1, 5, 8, 11, 64};
+  for (int64_t length : lengths) {
+    for (int64_t offset : offsets) {
+      // Fill with ones so that cleared bits and untouched bits are both checked
+      std::vector<uint8_t> bitmap(BitUtil::BytesForBits(kNumBytes + 64) + 1, 0xFF);
+      const int64_t num_zeros =
+          PackBytesToBitmap(bytes.data(), length, bitmap.data(), offset);
+
+      int64_t expected_zeros = 0;
+      for (int64_t i = 0; i < length; ++i) {
+        expected_zeros += bytes[i] == 0;
+        ASSERT_EQ(bytes[i] != 0, BitUtil::GetBit(bitmap.data(), offset + i));
+      }
+      ASSERT_EQ(expected_zeros, num_zeros);
+      for (int64_t i = 0; i < offset; ++i) {
+        ASSERT_TRUE(BitUtil::GetBit(bitmap.data(), i));
+      }
+      for (int64_t i = offset + length; i < offset + length + 8; ++i) {
+        ASSERT_TRUE(BitUtil::GetBit(bitmap.data(), i));
+      }
+    }
+  }
+}
+
 TEST(BitUtilTests, TestCopyBitmap) {
   const int kBufferSize = 1000;
 
@@ -456,6 +680,80 @@ TEST(BitUtilTests, TestCopyBitmap) {
   }
 }
 
+TEST(BitUtilTests, TestCopyBitmapToOffset) {
+  const int kBufferSize = 100;
+  std::vector<uint8_t> src(kBufferSize);
+  test::random_bytes(kBufferSize, 0, src.data());
+
+  std::vector<int64_t> lengths = {0, 5, 8, 63, 64, 200, kBufferSize * 8 - 20};
+  std::vector<int64_t> offsets = {0, 3, 8, 13};
+  for (int64_t length : lengths) {
+    for (int64_t offset : offsets) {
+      for (int64_t dest_offset : offsets) {
+        std::vector<uint8_t> dest(kBufferSize + 2, 0xFF);
+        CopyBitmap(src.data(), offset, length, dest.data(), dest_offset);
+        for (int64_t i = 0; i < dest_offset; ++i) {
+          ASSERT_TRUE(BitUtil::GetBit(dest.data(), i));
+        }
+        for (int64_t i = 0; i < length; ++i) {
+          ASSERT_EQ(BitUtil::GetBit(src.data(), offset + i),
+                    BitUtil::GetBit(dest.data(), dest_offset + i));
+        }
+        for (int64_t i = dest_offset + length; i < dest_offset + length + 8; ++i) {
+          ASSERT_TRUE(BitUtil::GetBit(dest.data(), i));
+        }
+      }
+    }
+  }
+}
+
+TEST(BitUtilTests, TestBitmapEquals) {
+  const int kBufferSize = 100;
+  std::vector<uint8_t> left(kBufferSize);
+  test::random_bytes(kBufferSize, 0, left.data());
+
+  std::vector<int64_t> lengths = {0, 5, 64, 65, 200, kBufferSize * 8 - 20};
+  std::vector<int64_t> offsets = {0, 3, 8, 13};
+  for (int64_t length : lengths) {
+    for (int64_t left_offset : offsets) {
+      for (int64_t right_offset : offsets) {
+        std::vector<uint8_t> right(kBufferSize + 2, 0);
+        CopyBitmap(left.data(), left_offset, length, right.data(), right_offset);
+        ASSERT_TRUE(BitmapEquals(left.data(), left_offset, right.data(), right_offset,
+                                 length));
+        if (length == 0) {
+          continue;
+        }
+        // Flip the first and the last bit of the range in turn
+        for (int64_t i : {int64_t(0), length - 1}) {
+          BitUtil::SetBitTo(right.data(), right_offset + i,
+                            !BitUtil::GetBit(right.data(), right_offset + i));
+          ASSERT_FALSE(BitmapEquals(left.data(), left_offset, right.data(),
+                                    right_offset, length));
+          BitUtil::SetBitTo(right.data(), right_offset + i,
+                            !BitUtil::GetBit(right.data(), right_offset + i));
+        }
+      }
+    }
+  }
+}
+
+TEST(BitUtilTests, TestSetBitsTo) {
+  const int kBufferSize = 16;
+  for (int64_t length : {0, 1, 7, 8, 9, 64, 100}) {
+    for (int64_t offset : {0, 3, 8, 13}) {
+      for (bool bits_are_set : {false, true}) {
+        std::vector<uint8_t> bits(kBufferSize, bits_are_set ? 0x00 : 0xFF);
+        BitUtil::SetBitsTo(bits.data(), offset, length, bits_are_set);
+        for (int64_t i = 0; i < kBufferSize * 8; ++i) {
+          const bool in_range = i >= offset && i < offset + length;
+          ASSERT_EQ(in_range == bits_are_set, BitUtil::GetBit(bits.data(), i));
+        }
+      }
+    }
+  }
+}
+
 TEST(BitUtil, Ceil) {
   EXPECT_EQ(BitUtil::Ceil(0, 1), 0);
   EXPECT_EQ(BitUtil::Ceil(1, 1), 1);
@@ -23,6 +23,11 @@
 #define __builtin_popcountll _mm_popcnt_u64
 #endif
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define ARROW_HAVE_SSE2 1
+#endif
+
 #include <algorithm>
 #include <cstring>
 #include <vector>
@@ -31,8 +36,13 @@
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
 #include "arrow/util/bit-util.h"
+#include "arrow/util/cpu-info.h"
 #include "arrow/util/logging.h"
 
+#ifdef ARROW_HAVE_AVX2
+#include "arrow/util/bit-util-avx2.h"
+#endif
+
 namespace arrow {
 
 void BitUtil::FillBitsFromBytes(const std::vector<uint8_t>& bytes, uint8_t* bits) {
@@ -57,6 +67,18 @@ Status BitUtil::BytesToBits(const std::vector<uint8_t>& bytes, MemoryPool* pool,
   return Status::OK();
 }
 
+#ifdef ARROW_HAVE_AVX2
+// Below this many 64-bit words, the hardware popcount of each word is faster
+static constexpr int64_t kMinAvx2CountWords = 64;
+
+static inline bool UseAvx2() {
+  if (!CpuInfo::initialized()) {
+    CpuInfo::Init();
+  }
+  return CpuInfo::IsSupported(CpuInfo::AVX2);
+}
+#endif
+
 int64_t CountSetBits(const uint8_t* data, int64_t bit_offset, int64_t length) {
   constexpr int64_t pop_len = sizeof(uint64_t) * 8;
 
@@ -81,6 +103,15 @@ int64_t CountSetBits(const uint8_t* data, int64_t bit_offset, int64_t length) {
 
   const uint64_t* end = u64_data + fast_counts;
 
+#ifdef ARROW_HAVE_AVX2
+  if (fast_counts >= kMinAvx2CountWords && UseAvx2()) {
+    const int64_t avx2_words = fast_counts / 4 * 4;
+    count += internal::CountSetBitsAvx2(reinterpret_cast<const uint8_t*>(u64_data),
+                                        avx2_words * 8);
+    u64_data += avx2_words;
+  }
+#endif
+
   // popcount as much as possible with the widest possible count
   for (auto iter = u64_data; iter < end; ++iter) {
     count += __builtin_popcountll(*iter);
@@ -98,6 +129,61 @@ int64_t CountSetBits(const uint8_t* data, int64_t bit_offset, int64_t length) {
   return count;
 }
 
+namespace internal {
+
+BitBlockCount BitBlockCounter::NextBlock(int64_t block_size) {
+  const int64_t length = std::min(block_size, bits_remaining_);
+  int64_t popcount = length;
+  if (bitmap_ != nullptr) {
+    if (length == block_size) {
+      popcount = 0;
+      for (int64_t i = 0; i < block_size; i += 64) {
+        popcount += __builtin_popcountll(LoadBitmapWord(bitmap_, offset_ + i));
+      }
+    } else {
+      popcount = CountSetBits(bitmap_, offset_, length);
+    }
+  }
+  offset_ += length;
+  bits_remaining_ -= length;
+  return {static_cast<int16_t>(length), static_cast<int16_t>(popcount)};
+}
+
+BitBlockCount BitBlockCounter::NextWord() { return NextBlock(64); }
+
+BitBlockCount BitBlockCounter::NextFourWords() { return NextBlock(256); }
+
+constexpr int64_t BitmapCounts::kBlockBits;
+
+BitmapCounts::BitmapCounts(const uint8_t* bitmap, int64_t length) : length_(length) {
+  const int64_t num_blocks = length / kBlockBits;
+  prefix_counts_.resize(static_cast<size_t>(num_blocks + 1));
+  int64_t count = 0;
+  for (int64_t i = 0; i < num_blocks; ++i) {
+    prefix_counts_[i] = count;
+    count += ::arrow::CountSetBits(bitmap, i * kBlockBits, kBlockBits);
+  }
+  prefix_counts_[num_blocks] = count;
+}
+
+int64_t BitmapCounts::CountSetBits(const uint8_t* bitmap, int64_t offset,
+                                   int64_t length) const {
+  DCHECK_LE(offset + length, length_);
+  const int64_t end = offset + length;
+  const int64_t first_block = BitUtil::Ceil(offset, kBlockBits);
+  const int64_t last_block = end / kBlockBits;
+  if (first_block >= last_block) {
+    return ::arrow::CountSetBits(bitmap, offset, length);
+  }
+  const int64_t blocks_start = first_block * kBlockBits;
+  const int64_t blocks_end = last_block * kBlockBits;
+  return ::arrow::CountSetBits(bitmap, offset, blocks_start - offset) +
+         prefix_counts_[last_block] - prefix_counts_[first_block] +
+         ::arrow::CountSetBits(bitmap, blocks_end, end - blocks_end);
+}
+
+}  // namespace internal
+
 Status GetEmptyBitmap(MemoryPool* pool, int64_t length, std::shared_ptr<Buffer>* result) {
   RETURN_NOT_OK(AllocateBuffer(pool, BitUtil::BytesForBits(length), result));
   memset((*result)->mutable_data(), 0, static_cast<size_t>((*result)->size()));
@@ -108,40 +194,99 @@ Status CopyBitmap(MemoryPool* pool, const uint8_t* data, int64_t offset, int64_t
                   std::shared_ptr<Buffer>* out) {
   std::shared_ptr<Buffer> buffer;
   RETURN_NOT_OK(GetEmptyBitmap(pool, length, &buffer));
-  uint8_t* dest = buffer->mutable_data();
+  CopyBitmap(data, offset, length, buffer->mutable_data(), 0);
+  *out = buffer;
+  return Status::OK();
+}
 
-  int64_t byte_offset = offset / 8;
-  int64_t bit_offset = offset % 8;
-  int64_t num_bytes = BitUtil::BytesForBits(length);
-  int64_t bits_to_zero = num_bytes * 8 - length;
+void CopyBitmap(const uint8_t* data, int64_t offset, int64_t length, uint8_t* dest,
+                int64_t dest_offset) {
+  int64_t i = 0;
 
-  if (bit_offset > 0) {
-    uint32_t carry_mask = BitUtil::kBitmask[bit_offset] - 1U;
-    uint32_t carry_shift = 8U - static_cast<uint32_t>(bit_offset);
+  // Leading bits until the destination is byte-aligned
+  for (; i < length && (dest_offset + i) % 8 != 0; ++i) {
+    BitUtil::SetBitTo(dest, dest_offset + i, BitUtil::GetBit(data, offset + i));
+  }
 
-    uint32_t carry = 0U;
-    if (BitUtil::BytesForBits(length + bit_offset) > num_bytes) {
-      carry = (data[byte_offset + num_bytes] & carry_mask) << carry_shift;
+  // Whole destination bytes, shifting the source 64 bits at a time if it is
+  // not aligned as well
+  uint8_t* out = dest + (dest_offset + i) / 8;
+  const int64_t src_bit = offset + i;
+  const uint8_t* in = data + src_bit / 8;
+  const int shift = static_cast<int>(src_bit % 8);
+  int64_t num_bytes = (length - i) / 8;
+  if (shift == 0) {
+    std::memcpy(out, in, static_cast<size_t>(num_bytes));
+  } else {
+    const int64_t num_words = num_bytes / 8;
+    for (int64_t j = 0; j < num_words; ++j) {
+      const uint64_t word =
+          BitUtil::ToLittleEndian(internal::LoadBitmapWord(in + j * 8, shift));
+      std::memcpy(out + j * 8, &word, sizeof(word));
     }
-
-    int64_t i = num_bytes - 1;
-    while (i + 1 > 0) {
-      uint8_t cur_byte = data[byte_offset + i];
-      dest[i] = static_cast<uint8_t>((cur_byte >> bit_offset) | carry);
-      carry = (cur_byte & carry_mask) << carry_shift;
-      --i;
+    for (int64_t j = num_words * 8; j < num_bytes; ++j) {
+      out[j] = static_cast<uint8_t>((in[j] >> shift) | (in[j + 1] << (8 - shift)));
     }
-  } else {
-    std::memcpy(dest, data + byte_offset, static_cast<size_t>(num_bytes));
   }
+  i += num_bytes * 8;
+
+  // Trailing bits
+  for (; i < length; ++i) {
+    BitUtil::SetBitTo(dest, dest_offset + i, BitUtil::GetBit(data, offset + i));
+  }
+}
+
+namespace {
 
-  for (int64_t i = length; i < length + bits_to_zero; ++i) {
-    // Both branches may copy extra bits - unsetting to match specification.
-    BitUtil::SetBitTo(dest, i, false);
+// Pack 8 bytes into one bitmap byte, written so the compiler can vectorize it
+inline uint8_t PackEightBytes(const uint8_t* bytes) {
+  uint8_t packed = 0;
+  for (int i = 0; i < 8; ++i) {
+    packed = static_cast<uint8_t>(packed | ((bytes[i] != 0) << i));
   }
+  return packed;
+}
 
-  *out = buffer;
-  return Status::OK();
+}  // namespace
+
+int64_t PackBytesToBitmap(const uint8_t* bytes, int64_t length, uint8_t* bitmap,
+                          int64_t bit_offset) {
+  int64_t num_set = 0;
+  int64_t i = 0;
+
+  // Leading bits until the destination is byte-aligned
+  for (; i < length && (bit_offset + i) % 8 != 0; ++i) {
+    const bool is_set = bytes[i] != 0;
+    BitUtil::SetBitTo(bitmap, bit_offset + i, is_set);
+    num_set += is_set;
+  }
+
+  uint8_t* out = bitmap + (bit_offset + i) / 8;
+#ifdef ARROW_HAVE_SSE2
+  // movemask gathers the high bit of each byte comparison in LSB order, which
+  // matches the bitmap layout
+  const __m128i zero = _mm_setzero_si128();
+  for (; i + 16 <= length; i += 16) {
+    const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + i));
+    const int mask = ~_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, zero)) & 0xFFFF;
+    *out++ = static_cast<uint8_t>(mask);
+    *out++ = static_cast<uint8_t>(mask >> 8);
+    num_set += __builtin_popcount(mask);
+  }
+#endif
+  for (; i + 8 <= length; i += 8) {
+    const uint8_t packed = PackEightBytes(bytes + i);
+    *out++ = packed;
+    num_set += __builtin_popcount(packed);
+  }
+
+  // Trailing bits
+  for (; i < length; ++i) {
+    const bool is_set = bytes[i] != 0;
+    BitUtil::SetBitTo(bitmap, bit_offset + i, is_set);
+    num_set += is_set;
+  }
+  return length - num_set;
 }
 
 bool BitmapEquals(const uint8_t* left, int64_t left_offset, const uint8_t* right,
@@ -162,8 +307,15 @@ bool BitmapEquals(const uint8_t* left, int64_t left_offset, const uint8_t* right
     return true;
   }
 
-  // Unaligned slow case
-  for (int64_t i = 0; i < bit_length; ++i) {
+  // Unaligned, compare 64 bits at a time shifted into place
+  int64_t i = 0;
+  for (; i + 64 <= bit_length; i += 64) {
+    if (internal::LoadBitmapWord(left, left_offset + i) !=
+        internal::LoadBitmapWord(right, right_offset + i)) {
+      return false;
+    }
+  }
+  for (; i < bit_length; ++i) {
     if (BitUtil::GetBit(left, left_offset + i) !=
         BitUtil::GetBit(right, right_offset + i)) {
       return false;
@@ -174,30 +326,60 @@ bool BitmapEquals(const uint8_t* left, int64_t left_offset, const uint8_t* right
 
 namespace {
 
-void AlignedBitmapAnd(const uint8_t* left, int64_t left_offset, const uint8_t* right,
-                      int64_t right_offset, uint8_t* out, int64_t out_offset,
-                      int64_t length) {
-  DCHECK_EQ(left_offset % 8, right_offset % 8);
-  DCHECK_EQ(left_offset % 8, out_offset % 8);
+// The bitwise operations, on whole bytes and words as well as single bits
+struct AndOp {
+  template <typename T>
+  static T Call(T left, T right) {
+    return static_cast<T>(left & right);
+  }
+};
 
-  const int64_t nbytes = BitUtil::BytesForBits(length + left_offset);
-  left += left_offset / 8;
-  right += right_offset / 8;
-  out += out_offset / 8;
-  for (int64_t i = 0; i < nbytes; ++i) {
-    out[i] = left[i] & right[i];
+struct OrOp {
+  template <typename T>
+  static T Call(T left, T right) {
+    return static_cast<T>(left | right);
   }
-}
+};
 
-void UnalignedBitmapAnd(const uint8_t* left, int64_t left_offset, const uint8_t* right,
-                        int64_t right_offset, uint8_t* out, int64_t out_offset,
-                        int64_t length) {
+struct XorOp {
+  template <typename T>
+  static T Call(T left, T right) {
+    return static_cast<T>(left ^ right);
+  }
+};
+
+struct AndNotOp {
+  template <typename T>
+  static T Call(T left, T right) {
+    return static_cast<T>(left & ~right);
+  }
+};
+
+// Unary, the right operand is ignored
+struct NotOp {
+  template <typename T>
+  static T Call(T left, T) {
+    return static_cast<T>(~left);
+  }
+};
+
+template <typename Op>
+void BitmapOpBits(const uint8_t* left, int64_t left_offset, const uint8_t* right,
+                  int64_t right_offset, int64_t length, int64_t out_offset,
+                  uint8_t* out) {
+  if (length == 0) {
+    return;
+  }
   auto left_reader = internal::BitmapReader(left, left_offset, length);
   auto right_reader = internal::BitmapReader(right, right_offset, length);
   auto writer = internal::BitmapWriter(out, out_offset, length);
   for (int64_t i = 0; i < length; ++i) {
-    if (left_reader.IsSet() && right_reader.IsSet()) {
+    const uint8_t bit = Op::Call(static_cast<uint8_t>(left_reader.IsSet()),
+                                 static_cast<uint8_t>(right_reader.IsSet()));
+    if (bit & 1) {
       writer.Set();
+    } else {
+      writer.Clear();
     }
     left_reader.Next();
     right_reader.Next();
@@ -206,24 +388,112 @@ void UnalignedBitmapAnd(const uint8_t* left, int64_t left_offset, const uint8_t*
   writer.Finish();
 }
 
+// The bits are combined one at a time up to a byte boundary of the output,
+// then a byte at a time when the inputs are also at a byte boundary, and
+// otherwise 64 bits at a time shifted into place from the inputs. The bits
+// of the output outside of its range are left unchanged
+template <typename Op>
+void BitmapOp(const uint8_t* left, int64_t left_offset, const uint8_t* right,
+              int64_t right_offset, int64_t length, int64_t out_offset, uint8_t* out) {
+  int64_t position = std::min(length, (8 - out_offset % 8) % 8);
+  BitmapOpBits<Op>(left, left_offset, right, right_offset, position, out_offset, out);
+
+  uint8_t* dest = out + (out_offset + position) / 8;
+  if ((left_offset + position) % 8 == 0 && (right_offset + position) % 8 == 0) {
+    // A loop the compiler vectorizes
+    const uint8_t* left_bytes = left + (left_offset + position) / 8;
+    const uint8_t* right_bytes = right + (right_offset + position) / 8;
+    const int64_t nbytes = (length - position) / 8;
+    for (int64_t i = 0; i < nbytes; ++i) {
+      dest[i] = Op::Call(left_bytes[i], right_bytes[i]);
+    }
+    position += nbytes * 8;
+  } else {
+    const int64_t nwords = (length - position) / 64;
+    for (int64_t i = 0; i < nwords; ++i, position += 64) {
+      const uint64_t word =
+          Op::Call(internal::LoadBitmapWord(left, left_offset + position),
+                   internal::LoadBitmapWord(right, right_offset + position));
+      const uint64_t le_word = BitUtil::ToLittleEndian(word);
+      std::memcpy(dest + i * 8, &le_word, sizeof(le_word));
+    }
+  }
+
+  BitmapOpBits<Op>(left, left_offset + position, right, right_offset + position,
+                   length - position, out_offset + position, out);
+}
+
+template <typename Op>
+Status BitmapOp(MemoryPool* pool, const uint8_t* left, int64_t left_offset,
+                const uint8_t* right, int64_t right_offset, int64_t length,
+                int64_t out_offset, std::shared_ptr<Buffer>* out_buffer) {
+  RETURN_NOT_OK(GetEmptyBitmap(pool, length + out_offset, out_buffer));
+  BitmapOp<Op>(left, left_offset, right, right_offset, length, out_offset,
+               (*out_buffer)->mutable_data());
+  return Status::OK();
+}
+
 }  // namespace
 
 Status BitmapAnd(MemoryPool* pool, const uint8_t* left, int64_t left_offset,
                  const uint8_t* right, int64_t right_offset, int64_t length,
                  int64_t out_offset, std::shared_ptr<Buffer>* out_buffer) {
-  if ((out_offset % 8 == left_offset % 8) && (out_offset % 8 == right_offset % 8)) {
-    // Fast case: can use bytewise AND
-    const int64_t phys_bits = length + out_offset;
-    RETURN_NOT_OK(GetEmptyBitmap(pool, phys_bits, out_buffer));
-    AlignedBitmapAnd(left, left_offset, right, right_offset,
-                     (*out_buffer)->mutable_data(), out_offset, length);
-  } else {
-    // Unaligned
-    RETURN_NOT_OK(GetEmptyBitmap(pool, length + out_offset, out_buffer));
-    UnalignedBitmapAnd(left, left_offset, right, right_offset,
-                       (*out_buffer)->mutable_data(), out_offset, length);
-  }
-  return Status::OK();
+  return BitmapOp<AndOp>(pool, left, left_offset, right, right_offset, length,
+                         out_offset, out_buffer);
+}
+
+Status BitmapOr(MemoryPool* pool, const uint8_t* left, int64_t left_offset,
+                const uint8_t* right, int64_t right_offset, int64_t length,
+                int64_t out_offset, std::shared_ptr<Buffer>* out_buffer) {
+  return BitmapOp<OrOp>(pool, left, left_offset, right, right_offset, length,
+                        out_offset, out_buffer);
+}
+
+Status BitmapXor(MemoryPool* pool, const uint8_t* left, int64_t left_offset,
+                 const uint8_t* right, int64_t right_offset, int64_t length,
+                 int64_t out_offset, std::shared_ptr<Buffer>* out_buffer) {
+  return BitmapOp<XorOp>(pool, left, left_offset, right, right_offset, length,
+                         out_offset, out_buffer);
+}
+
+Status BitmapAndNot(MemoryPool* pool, const uint8_t* left, int64_t left_offset,
+                    const uint8_t* right, int64_t right_offset, int64_t length,
+                    int64_t out_offset, std::shared_ptr<Buffer>* out_buffer) {
+  return BitmapOp<AndNotOp>(pool, left, left_offset, right, right_offset, length,
+                            out_offset, out_buffer);
+}
+
+Status InvertBitmap(MemoryPool* pool, const uint8_t* data, int64_t offset,
+                    int64_t length, int64_t out_offset,
+                    std::shared_ptr<Buffer>* out_buffer) {
+  return BitmapOp<NotOp>(pool, data, offset, data, offset, length, out_offset,
+                         out_buffer);
+}
+
+void BitmapAnd(const uint8_t* left, int64_t left_offset, const uint8_t* right,
+               int64_t right_offset, int64_t length, int64_t out_offset, uint8_t* out) {
+  BitmapOp<AndOp>(left, left_offset, right, right_offset, length, out_offset, out);
+}
+
+void BitmapOr(const uint8_t* left, int64_t left_offset, const uint8_t* right,
+              int64_t right_offset, int64_t length, int64_t out_offset, uint8_t* out) {
+  BitmapOp<OrOp>(left, left_offset, right, right_offset, length, out_offset, out);
+}
+
+void BitmapXor(const uint8_t* left, int64_t left_offset, const uint8_t* right,
+               int64_t right_offset, int64_t length, int64_t out_offset, uint8_t* out) {
+  BitmapOp<XorOp>(left, left_offset, right, right_offset, length, out_offset, out);
+}
+
+void BitmapAndNot(const uint8_t* left, int64_t left_offset, const uint8_t* right,
+                  int64_t right_offset, int64_t length, int64_t out_offset,
+                  uint8_t* out) {
+  BitmapOp<AndNotOp>(left, left_offset, right, right_offset, length, out_offset, out);
+}
+
+void InvertBitmap(const uint8_t* data, int64_t offset, int64_t length,
+                  int64_t out_offset, uint8_t* out) {
+  BitmapOp<NotOp>(data, offset, data, offset, length, out_offset, out);
 }
 
 }  // namespace arrow
@@ -45,6 +45,10 @@
 #if defined(_MSC_VER)
 #include <intrin.h>
 #pragma intrinsic(_BitScanReverse)
+#pragma intrinsic(_BitScanForward)
+#if defined(_M_X64)
+#pragma intrinsic(_BitScanForward64)
+#endif
 #define ARROW_BYTE_SWAP64 _byteswap_uint64
 #define ARROW_BYTE_SWAP32 _byteswap_ulong
 #else
@@ -53,6 +57,7 @@
 #endif
 
 #include <cstdint>
+#include <cstring>
 #include <limits>
 #include <memory>
 #include <type_traits>
@@ -138,6 +143,22 @@ static inline void SetBitTo(uint8_t* bits, int64_t i, bool bit_is_set) {
                  kBitmask[i % 8];
 }
 
+/// Set or clear the bits [start_offset, start_offset + length), whole bytes at
+/// a time where possible
+static inline void SetBitsTo(uint8_t* bits, int64_t start_offset, int64_t length,
+                             bool bits_are_set) {
+  int64_t i = start_offset;
+  const int64_t end = start_offset + length;
+  for (; i < end && i % 8 != 0; ++i) {
+    SetBitTo(bits, i, bits_are_set);
+  }
+  const int64_t whole_bytes = (end - i) / 8;
+  std::memset(bits + i / 8, bits_are_set ? 0xFF : 0, static_cast<size_t>(whole_bytes));
+  for (i += whole_bytes * 8; i < end; ++i) {
+    SetBitTo(bits, i, bits_are_set);
+  }
+}
+
 // Returns the minimum number of bits needed to represent the value of 'x'
 static inline int NumRequiredBits(uint64_t x) {
   for (int i = 63; i >= 0; --i) {
@@ -307,6 +328,39 @@ static inline int64_t CountLeadingZeros(uint32_t value) {
 #endif
 }
 
+/// \brief Count the number of trailing zeros in a non-zero 32 bit integer.
+static inline int64_t CountTrailingZeros(uint32_t value) {
+#if defined(__clang__) || defined(__GNUC__)
+  return static_cast<int64_t>(__builtin_ctz(value));
+#elif defined(_MSC_VER)
+  unsigned long index;                                        // NOLINT
+  _BitScanForward(&index, static_cast<unsigned long>(value));  // NOLINT
+  return static_cast<int64_t>(index);
+#else
+  int64_t bitpos = 0;
+  while ((value & 1) == 0) {
+    value >>= 1;
+    ++bitpos;
+  }
+  return bitpos;
+#endif
+}
+
+/// \brief Count the number of trailing zeros in a non-zero 64 bit integer.
+static inline int64_t CountTrailingZeros(uint64_t value) {
+#if defined(__clang__) || defined(__GNUC__)
+  return static_cast<int64_t>(__builtin_ctzll(value));
+#elif defined(_MSC_VER) && defined(_M_X64)
+  unsigned long index;               // NOLINT
+  _BitScanForward64(&index, value);  // NOLINT
+  return static_cast<int64_t>(index);
+#else
+  const auto low = static_cast<uint32_t>(value);
+  return low != 0 ? CountTrailingZeros(low)
+                  : 32LL + CountTrailingZeros(static_cast<uint32_t>(value >> 32));
+#endif
+}
+
 /// Swaps the byte order (i.e. endianess)
 static inline int64_t ByteSwap(int64_t value) { return ARROW_BYTE_SWAP64(value); }
 static inline uint64_t ByteSwap(uint64_t value) {
@@ -418,6 +472,20 @@ Status BytesToBits(const std::vector<uint8_t>&, MemoryPool*, std::shared_ptr<Buf
 
 namespace internal {
 
+/// \brief Load the 64 bits of a bitmap starting at an arbitrary bit offset,
+/// all of which must lie within the bitmap
+static inline uint64_t LoadBitmapWord(const uint8_t* bitmap, int64_t bit_offset) {
+  const uint8_t* bytes = bitmap + bit_offset / 8;
+  const int shift = static_cast<int>(bit_offset % 8);
+  uint64_t word;
+  std::memcpy(&word, bytes, sizeof(word));
+  word = BitUtil::FromLittleEndian(word);
+  if (shift != 0) {
+    word = (word >> shift) | (static_cast<uint64_t>(bytes[8]) << (64 - shift));
+  }
+  return word;
+}
+
 class BitmapReader {
  public:
   BitmapReader(const uint8_t* bitmap, int64_t start_offset, int64_t length)
@@ -642,6 +710,67 @@ void GenerateBitsUnrolled(uint8_t* bitmap, int64_t start_offset, int64_t length,
   }
 }
 
+/// \brief The number of bits of a block of a bitmap and how many are set
+struct BitBlockCount {
+  int16_t length;
+  int16_t popcount;
+
+  bool NoneSet() const { return popcount == 0; }
+  bool AllSet() const { return popcount == length; }
+};
+
+/// \brief Walk a bitmap in blocks of 64 or 256 bits, counting the set bits of
+/// each block
+///
+/// Kernels can take a dense path over the blocks where all of the bits are set
+/// and skip the blocks where none are, rather than testing each bit. The last
+/// block is shorter, then the blocks are of length 0. A null bitmap has all of
+/// its bits set.
+class ARROW_EXPORT BitBlockCounter {
+ public:
+  BitBlockCounter(const uint8_t* bitmap, int64_t start_offset, int64_t length)
+      : bitmap_(bitmap), offset_(start_offset), bits_remaining_(length) {}
+
+  /// \brief Count the next 64 bits
+  BitBlockCount NextWord();
+
+  /// \brief Count the next 256 bits
+  BitBlockCount NextFourWords();
+
+ private:
+  BitBlockCount NextBlock(int64_t block_size);
+
+  const uint8_t* bitmap_;
+  int64_t offset_;
+  int64_t bits_remaining_;
+};
+
+/// \brief The number of set bits of a bitmap before each of its blocks of 4096
+/// bits
+///
+/// Counts the set bits of any range of the bitmap from the prefix sums of the
+/// blocks it covers, and only popcounts the partial blocks at its edges. The
+/// bitmap must not change after it has been counted.
+class ARROW_EXPORT BitmapCounts {
+ public:
+  static constexpr int64_t kBlockBits = 4096;
+
+  /// \brief Count the set bits of the first length bits of a bitmap
+  BitmapCounts(const uint8_t* bitmap, int64_t length);
+
+  /// \brief The number of bits of the bitmap that were counted
+  int64_t length() const { return length_; }
+
+  /// \brief The number of set bits of [offset, offset + length) of the
+  /// counted bitmap, which must be within its first length() bits
+  int64_t CountSetBits(const uint8_t* bitmap, int64_t offset, int64_t length) const;
+
+ private:
+  int64_t length_;
+  // The number of set bits before each block, and of all the full blocks
+  std::vector<int64_t> prefix_counts_;
+};
+
 }  // namespace internal
 
 // ----------------------------------------------------------------------
@@ -663,6 +792,19 @@ ARROW_EXPORT
 Status CopyBitmap(MemoryPool* pool, const uint8_t* bitmap, int64_t offset, int64_t length,
                   std::shared_ptr<Buffer>* out);
 
+/// Copy a bit range of an existing bitmap into a bit range of another one
+///
+/// Bits of the destination outside of the copied range are left unchanged.
+///
+/// \param[in] bitmap source data
+/// \param[in] offset bit offset into the source data
+/// \param[in] length number of bits to copy
+/// \param[out] dest destination data
+/// \param[in] dest_offset bit offset into the destination data
+ARROW_EXPORT
+void CopyBitmap(const uint8_t* bitmap, int64_t offset, int64_t length, uint8_t* dest,
+                int64_t dest_offset);
+
 /// Compute the number of 1's in the given data array
 ///
 /// \param[in] data a packed LSB-ordered bitmap as a byte array
@@ -673,15 +815,109 @@ Status CopyBitmap(MemoryPool* pool, const uint8_t* bitmap, int64_t offset, int64
 ARROW_EXPORT
 int64_t CountSetBits(const uint8_t* data, int64_t bit_offset, int64_t length);
 
+/// Pack an array of bytes into a bitmap, one bit per byte
+///
+/// Non-zero bytes set the corresponding bit and zero bytes clear it. Bits
+/// outside of the written range are left unchanged.
+///
+/// \param[in] bytes the source bytes
+/// \param[in] length the number of bytes to pack
+/// \param[out] bitmap the destination bitmap
+/// \param[in] bit_offset a bitwise offset into the destination bitmap
+///
+/// \return The number of zero bytes, i.e. bits that were cleared
+ARROW_EXPORT
+int64_t PackBytesToBitmap(const uint8_t* bytes, int64_t length, uint8_t* bitmap,
+                          int64_t bit_offset);
+
 ARROW_EXPORT
 bool BitmapEquals(const uint8_t* left, int64_t left_offset, const uint8_t* right,
                   int64_t right_offset, int64_t bit_length);
 
+/// \brief Compute the bitwise AND of two bit ranges into a new bitmap
+///
+/// The offsets of the inputs and the output are arbitrary. The bits are
+/// combined 64 at a time, shifted into place when the offsets differ.
+///
+/// \param[in] pool memory pool to allocate the output from
+/// \param[in] left the left bitmap
+/// \param[in] left_offset bit offset into the left bitmap
+/// \param[in] right the right bitmap
+/// \param[in] right_offset bit offset into the right bitmap
+/// \param[in] length the number of bits to combine
+/// \param[in] out_offset bit offset into the output of the first bit, the
+/// bits before it are cleared
+/// \param[out] out_buffer the output, of length + out_offset bits
 ARROW_EXPORT
 Status BitmapAnd(MemoryPool* pool, const uint8_t* left, int64_t left_offset,
                  const uint8_t* right, int64_t right_offset, int64_t length,
                  int64_t out_offset, std::shared_ptr<Buffer>* out_buffer);
 
+/// \brief Compute the bitwise OR of two bit ranges into a new bitmap, as with
+/// BitmapAnd
+ARROW_EXPORT
+Status BitmapOr(MemoryPool* pool, const uint8_t* left, int64_t left_offset,
+                const uint8_t* right, int64_t right_offset, int64_t length,
+                int64_t out_offset, std::shared_ptr<Buffer>* out_buffer);
+
+/// \brief Compute the bitwise XOR of two bit ranges into a new bitmap, as with
+/// BitmapAnd
+ARROW_EXPORT
+Status BitmapXor(MemoryPool* pool, const uint8_t* left, int64_t left_offset,
+                 const uint8_t* right, int64_t right_offset, int64_t length,
+                 int64_t out_offset, std::shared_ptr<Buffer>* out_buffer);
+
+/// \brief Compute left AND NOT right of two bit ranges into a new bitmap, as
+/// with BitmapAnd
+ARROW_EXPORT
+Status BitmapAndNot(MemoryPool* pool, const uint8_t* left, int64_t left_offset,
+                    const uint8_t* right, int64_t right_offset, int64_t length,
+                    int64_t out_offset, std::shared_ptr<Buffer>* out_buffer);
+
+/// \brief Compute the bitwise NOT of a bit range into a new bitmap, as with
+/// BitmapAnd
+ARROW_EXPORT
+Status InvertBitmap(MemoryPool* pool, const uint8_t* data, int64_t offset,
+                    int64_t length, int64_t out_offset,
+                    std::shared_ptr<Buffer>* out_buffer);
+
+/// \brief Compute the bitwise AND of two bit ranges into a bit range of an
+/// existing bitmap
+///
+/// Bits of the output outside of the written range are left unchanged.
+///
+/// \param[in] left the left bitmap
+/// \param[in] left_offset bit offset into the left bitmap
+/// \param[in] right the right bitmap
+/// \param[in] right_offset bit offset into the right bitmap
+/// \param[in] length the number of bits to combine
+/// \param[in] out_offset bit offset into the output
+/// \param[out] out the output bitmap
+ARROW_EXPORT
+void BitmapAnd(const uint8_t* left, int64_t left_offset, const uint8_t* right,
+               int64_t right_offset, int64_t length, int64_t out_offset, uint8_t* out);
+
+/// \brief Compute the bitwise OR of two bit ranges into an existing bitmap
+ARROW_EXPORT
+void BitmapOr(const uint8_t* left, int64_t left_offset, const uint8_t* right,
+              int64_t right_offset, int64_t length, int64_t out_offset, uint8_t* out);
+
+/// \brief Compute the bitwise XOR of two bit ranges into an existing bitmap
+ARROW_EXPORT
+void BitmapXor(const uint8_t* left, int64_t left_offset, const uint8_t* right,
+               int64_t right_offset, int64_t length, int64_t out_offset, uint8_t* out);
+
+/// \brief Compute left AND NOT right of two bit ranges into an existing bitmap
+ARROW_EXPORT
+void BitmapAndNot(const uint8_t* left, int64_t left_offset, const uint8_t* right,
+                  int64_t right_offset, int64_t length, int64_t out_offset,
+                  uint8_t* out);
+
+/// \brief Compute the bitwise NOT of a bit range into an existing bitmap
+ARROW_EXPORT
+void InvertBitmap(const uint8_t* data, int64_t offset, int64_t length,
+                  int64_t out_offset, uint8_t* out);
+
 }  // namespace arrow
 
 #endif  // ARROW_UTIL_BIT_UTIL_H
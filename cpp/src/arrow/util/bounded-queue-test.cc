@@ -0,0 +1,178 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/record_batch.h"
+#include "arrow/status.h"
+#include "arrow/test-util.h"
+#include "arrow/type.h"
+#include "arrow/util/bounded-queue.h"
+
+namespace arrow {
+
+TEST(TestBoundedQueue, TryPushPop) {
+  BoundedQueue<std::unique_ptr<int>> queue(3);
+  ASSERT_EQ(4, queue.capacity());
+
+  std::unique_ptr<int> value;
+  ASSERT_FALSE(queue.TryPop(&value));
+  for (int i = 0; i < 4; ++i) {
+    ASSERT_TRUE(queue.TryPush(std::unique_ptr<int>(new int(i))));
+  }
+  // Full: the value is left to the caller
+  value.reset(new int(4));
+  ASSERT_FALSE(queue.TryPush(std::move(value)));
+  ASSERT_NE(nullptr, value);
+
+  for (int round = 0; round < 3; ++round) {
+    // First in first out, across the end of the ring buffer
+    ASSERT_TRUE(queue.TryPop(&value));
+    ASSERT_EQ(round, *value);
+    ASSERT_TRUE(queue.TryPush(std::unique_ptr<int>(new int(round + 4))));
+  }
+  for (int i = 3; i < 7; ++i) {
+    ASSERT_TRUE(queue.Pop(&value));
+    ASSERT_EQ(i, *value);
+  }
+  ASSERT_FALSE(queue.TryPop(&value));
+}
+
+TEST(TestBoundedQueue, Close) {
+  BoundedQueue<int> queue(4);
+  ASSERT_OK(queue.Push(1));
+  ASSERT_OK(queue.Push(2));
+  queue.Close();
+  ASSERT_TRUE(queue.closed());
+  ASSERT_RAISES(Invalid, queue.Push(3));
+  ASSERT_FALSE(queue.TryPush(3));
+
+  // What was pushed before closing is still popped
+  int value;
+  ASSERT_TRUE(queue.Pop(&value));
+  ASSERT_EQ(1, value);
+  ASSERT_TRUE(queue.Pop(&value));
+  ASSERT_EQ(2, value);
+  ASSERT_FALSE(queue.Pop(&value));
+
+  // Closing wakes up waiting consumers
+  BoundedQueue<int> empty_queue(4);
+  std::thread consumer([&] { ASSERT_FALSE(empty_queue.Pop(&value)); });
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  empty_queue.Close();
+  consumer.join();
+}
+
+TEST(TestBoundedQueue, Backpressure) {
+  BoundedQueue<int> queue(2);
+  ASSERT_OK(queue.Push(0));
+  ASSERT_OK(queue.Push(1));
+  std::atomic<bool> pushed(false);
+  std::thread producer([&] {
+    ASSERT_OK(queue.Push(2));
+    pushed = true;
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  ASSERT_FALSE(pushed);
+  int value;
+  ASSERT_TRUE(queue.Pop(&value));
+  producer.join();
+  ASSERT_TRUE(pushed);
+}
+
+TEST(TestBoundedQueue, MultipleProducersConsumers) {
+  const int num_producers = 4;
+  const int num_consumers = 4;
+  const int num_values = 20000;
+  BoundedQueue<int> queue(16);
+
+  std::vector<std::atomic<int>> seen(num_producers * num_values);
+  for (auto& count : seen) {
+    count = 0;
+  }
+  std::atomic<int> producers_left(num_producers);
+  std::vector<std::thread> threads;
+  for (int i = 0; i < num_producers; ++i) {
+    threads.emplace_back([&, i] {
+      for (int j = 0; j < num_values; ++j) {
+        const int value = i * num_values + j;
+        // Both the blocking and the non-blocking variant
+        if (j % 2 == 0 || !queue.TryPush(int(value))) {
+          ASSERT_OK(queue.Push(value));
+        }
+      }
+      if (--producers_left == 0) {
+        queue.Close();
+      }
+    });
+  }
+  for (int i = 0; i < num_consumers; ++i) {
+    threads.emplace_back([&] {
+      int value;
+      int last_seen[num_producers] = {-1, -1, -1, -1};
+      while (queue.Pop(&value)) {
+        ++seen[value];
+        // Each producer's values come out in order
+        ASSERT_GT(value % num_values, last_seen[value / num_values]);
+        last_seen[value / num_values] = value % num_values;
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (const auto& count : seen) {
+    ASSERT_EQ(1, count);
+  }
+}
+
+TEST(TestRecordBatchQueueReader, ReadUntilClosed) {
+  auto schema = ::arrow::schema({field("f0", int32())});
+  auto queue = std::make_shared<RecordBatchQueue>(4);
+  const int num_batches = 100;
+
+  std::thread producer([&] {
+    for (int i = 0; i < num_batches; ++i) {
+      std::shared_ptr<Array> array;
+      ArrayFromVector<Int32Type, int32_t>({i}, &array);
+      ASSERT_OK(queue->Push(RecordBatch::Make(schema, 1, {array})));
+    }
+    queue->Close();
+  });
+
+  RecordBatchQueueReader reader(schema, queue);
+  ASSERT_TRUE(reader.schema()->Equals(*schema));
+  std::shared_ptr<RecordBatch> batch;
+  for (int i = 0; i < num_batches; ++i) {
+    ASSERT_OK(reader.ReadNext(&batch));
+    ASSERT_NE(nullptr, batch);
+    const auto& values = static_cast<const Int32Array&>(*batch->column(0));
+    ASSERT_EQ(i, values.Value(0));
+  }
+  ASSERT_OK(reader.ReadNext(&batch));
+  ASSERT_EQ(nullptr, batch);
+  producer.join();
+}
+
+}  // namespace arrow
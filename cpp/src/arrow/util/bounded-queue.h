@@ -0,0 +1,267 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_UTIL_BOUNDED_QUEUE_H
+#define ARROW_UTIL_BOUNDED_QUEUE_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include "arrow/status.h"
+#include "arrow/util/macros.h"
+
+namespace arrow {
+
+/// \brief A bounded first in first out queue for any number of producer and
+/// consumer threads
+///
+/// Pushing and popping are lock-free: each slot of a ring buffer carries a
+/// sequence number telling whether it holds a value and of which turn, and
+/// producers and consumers claim slots by incrementing their position with a
+/// compare-and-swap.  Push() and Pop() block while the queue is full or
+/// empty, pausing the producers of a pipeline stage that runs ahead of its
+/// consumers; their waiting, and waking them up, only locks a mutex when a
+/// thread has to wait.
+///
+/// Close() ends the stream: pushing then fails, and popping fails once the
+/// values already pushed are all popped.  Producers close the queue once
+/// done; a value pushed concurrently may or may not be accepted.
+template <typename T>
+class BoundedQueue {
+ public:
+  /// \brief Make a queue of at least the given capacity, rounded up to a
+  /// power of two
+  explicit BoundedQueue(size_t capacity)
+      : capacity_(RoundUpCapacity(capacity)),
+        mask_(capacity_ - 1),
+        cells_(new Cell[capacity_]),
+        enqueue_pos_(0),
+        dequeue_pos_(0),
+        closed_(false),
+        num_waiting_producers_(0),
+        num_waiting_consumers_(0) {
+    for (size_t i = 0; i < capacity_; ++i) {
+      cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  size_t capacity() const { return capacity_; }
+
+  bool closed() const { return closed_.load(); }
+
+  /// \brief Push a value, if there is room and the queue isn't closed
+  ///
+  /// \return whether the value was moved into the queue
+  bool TryPush(T&& value) {
+    if (!PushUnnotified(&value)) {
+      return false;
+    }
+    Notify(&num_waiting_consumers_, &not_empty_);
+    return true;
+  }
+
+  /// \brief Push a value, waiting for room
+  ///
+  /// \return Status, Invalid if the queue is closed
+  Status Push(T value) {
+    if (TryPush(std::move(value))) {
+      return Status::OK();
+    }
+    bool pushed;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      ++num_waiting_producers_;
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      while (!(pushed = PushUnnotified(&value)) && !closed_.load()) {
+        not_full_.wait(lock);
+      }
+      --num_waiting_producers_;
+    }
+    if (!pushed) {
+      return Status::Invalid("Push to a closed queue");
+    }
+    Notify(&num_waiting_consumers_, &not_empty_);
+    return Status::OK();
+  }
+
+  /// \brief Pop the oldest value, if any
+  ///
+  /// \return whether a value was popped into out
+  bool TryPop(T* out) {
+    if (!PopUnnotified(out)) {
+      return false;
+    }
+    Notify(&num_waiting_producers_, &not_full_);
+    return true;
+  }
+
+  /// \brief Pop the oldest value, waiting for one
+  ///
+  /// \return whether a value was popped into out, false once the queue is
+  /// closed and empty
+  bool Pop(T* out) {
+    if (TryPop(out)) {
+      return true;
+    }
+    bool popped;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      ++num_waiting_consumers_;
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      while (!(popped = PopUnnotified(out))) {
+        if (closed_.load()) {
+          // Values pushed before closing are visible by now
+          popped = PopUnnotified(out);
+          break;
+        }
+        not_empty_.wait(lock);
+      }
+      --num_waiting_consumers_;
+    }
+    if (popped) {
+      Notify(&num_waiting_producers_, &not_full_);
+    }
+    return popped;
+  }
+
+  /// \brief Stop accepting values, and wake up the threads waiting
+  void Close() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    closed_.store(true);
+    not_full_.notify_all();
+    not_empty_.notify_all();
+  }
+
+ private:
+  // Push or pop without waking up the threads waiting for it, as when
+  // holding the mutex
+  bool PushUnnotified(T* value) {
+    if (closed_.load(std::memory_order_relaxed)) {
+      return false;
+    }
+    size_t pos = enqueue_pos_.value.load(std::memory_order_relaxed);
+    Cell* cell;
+    while (true) {
+      cell = &cells_[pos & mask_];
+      const size_t sequence = cell->sequence.load(std::memory_order_acquire);
+      const intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+      if (diff == 0) {
+        if (enqueue_pos_.value.compare_exchange_weak(pos, pos + 1,
+                                                     std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (diff < 0) {
+        // Full
+        return false;
+      } else {
+        pos = enqueue_pos_.value.load(std::memory_order_relaxed);
+      }
+    }
+    cell->value = std::move(*value);
+    cell->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+  }
+
+  bool PopUnnotified(T* out) {
+    size_t pos = dequeue_pos_.value.load(std::memory_order_relaxed);
+    Cell* cell;
+    while (true) {
+      cell = &cells_[pos & mask_];
+      const size_t sequence = cell->sequence.load(std::memory_order_acquire);
+      const intptr_t diff =
+          static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1);
+      if (diff == 0) {
+        if (dequeue_pos_.value.compare_exchange_weak(pos, pos + 1,
+                                                     std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (diff < 0) {
+        // Empty
+        return false;
+      } else {
+        pos = dequeue_pos_.value.load(std::memory_order_relaxed);
+      }
+    }
+    *out = std::move(cell->value);
+    // Don't keep what the value owns alive until the slot is reused
+    cell->value = T();
+    cell->sequence.store(pos + capacity_, std::memory_order_release);
+    return true;
+  }
+
+  static constexpr size_t kCacheLineSize = 64;
+
+  struct Cell {
+    std::atomic<size_t> sequence;
+    T value;
+  };
+
+  static size_t RoundUpCapacity(size_t capacity) {
+    size_t result = 2;
+    while (result < capacity) {
+      result *= 2;
+    }
+    return result;
+  }
+
+  // Wake up a thread waiting on cv, if any.  Together with the fence of the
+  // waiting thread, between counting itself as waiting and checking the queue
+  // once more, this ensures that either the waiting thread sees the change or
+  // it gets notified.
+  void Notify(std::atomic<int>* num_waiting, std::condition_variable* cv) {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (num_waiting->load(std::memory_order_relaxed) > 0) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      cv->notify_one();
+    }
+  }
+
+  const size_t capacity_;
+  const size_t mask_;
+  std::unique_ptr<Cell[]> cells_;
+
+  // Alone on its cache line, so that producers and consumers don't contend
+  // for one
+  struct PaddedPosition {
+    explicit PaddedPosition(size_t pos) : value(pos) {}
+
+    char padding_before[kCacheLineSize];
+    std::atomic<size_t> value;
+    char padding_after[kCacheLineSize - sizeof(std::atomic<size_t>)];
+  };
+
+  PaddedPosition enqueue_pos_;
+  PaddedPosition dequeue_pos_;
+  std::atomic<bool> closed_;
+
+  std::atomic<int> num_waiting_producers_;
+  std::atomic<int> num_waiting_consumers_;
+  std::mutex mutex_;
+  std::condition_variable not_full_;
+  std::condition_variable not_empty_;
+
+  ARROW_DISALLOW_COPY_AND_ASSIGN(BoundedQueue);
+};
+
+}  // namespace arrow
+
+#endif  // ARROW_UTIL_BOUNDED_QUEUE_H
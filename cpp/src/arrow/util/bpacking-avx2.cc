@@ -0,0 +1,153 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// This file is compiled with -mavx2, its functions must only be called when
+// the CPU supports AVX2
+
+#include "arrow/util/bpacking-avx2.h"
+
+#include <immintrin.h>
+#include <cstring>
+
+#include "arrow/util/bpacking.h"
+
+namespace arrow {
+namespace internal {
+
+namespace {
+
+// The widest values unpacked with AVX2: a value and the up to 7 bits before
+// it in its first byte must fit in a 32-bit lane. Wider values are unpacked
+// with the scalar kernels
+constexpr int kMaxAvx2BitWidth = 25;
+
+// Groups of 8 values of num_bits bits take exactly num_bits bytes, so each
+// group is byte-aligned. The two 128-bit halves of a vector are loaded with
+// the first and the last 4 values of a group, whose bytes are then shuffled
+// within each half to one 32-bit lane per value, and shifted and masked into
+// place.
+struct UnpackKernel {
+  __m256i shuffle;
+  __m256i shifts;
+  __m256i mask;
+  // The offset of the bytes of the last 4 values in the group
+  int high_offset;
+};
+
+struct UnpackKernels {
+  UnpackKernels() {
+    for (int num_bits = 1; num_bits <= kMaxAvx2BitWidth; ++num_bits) {
+      UnpackKernel& kernel = kernels[num_bits];
+      kernel.high_offset = 4 * num_bits / 8;
+      alignas(32) uint8_t shuffle[32];
+      alignas(32) uint32_t shifts[8];
+      for (int j = 0; j < 8; ++j) {
+        const int lane_offset = j < 4 ? 0 : kernel.high_offset;
+        const int bit = j * num_bits - 8 * lane_offset;
+        for (int k = 0; k < 4; ++k) {
+          shuffle[4 * j + k] = static_cast<uint8_t>(bit / 8 + k);
+        }
+        shifts[j] = static_cast<uint32_t>(bit % 8);
+      }
+      kernel.shuffle = _mm256_load_si256(reinterpret_cast<const __m256i*>(shuffle));
+      kernel.shifts = _mm256_load_si256(reinterpret_cast<const __m256i*>(shifts));
+      kernel.mask = _mm256_set1_epi32(static_cast<int>((1U << num_bits) - 1));
+    }
+  }
+
+  UnpackKernel kernels[kMaxAvx2BitWidth + 1];
+};
+
+const UnpackKernel& GetUnpackKernel(int num_bits) {
+  static const UnpackKernels unpack_kernels;
+  return unpack_kernels.kernels[num_bits];
+}
+
+inline void Unpack8(const UnpackKernel& kernel, const uint8_t* in, uint32_t* out) {
+  const __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in));
+  const __m128i high =
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + kernel.high_offset));
+  __m256i values = _mm256_inserti128_si256(_mm256_castsi128_si256(low), high, 1);
+  values = _mm256_shuffle_epi8(values, kernel.shuffle);
+  values = _mm256_srlv_epi32(values, kernel.shifts);
+  values = _mm256_and_si256(values, kernel.mask);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), values);
+}
+
+}  // namespace
+
+int unpack32_avx2(const uint32_t* in, uint32_t* out, int batch_size, int num_bits) {
+  if (num_bits == 0 || num_bits > kMaxAvx2BitWidth) {
+    return unpack32(in, out, batch_size, num_bits);
+  }
+  batch_size = batch_size / 32 * 32;
+  const UnpackKernel& kernel = GetUnpackKernel(num_bits);
+  const uint8_t* data = reinterpret_cast<const uint8_t*>(in);
+
+  // Each 32 values take 4 groups of num_bits bytes. The 16-byte loads of the
+  // last groups would read past the input, so those are copied to a padded
+  // buffer first
+  const int chunk_size = 4 * num_bits;
+  const int64_t size = static_cast<int64_t>(batch_size / 32) * chunk_size;
+  const int read_size = 3 * num_bits + kernel.high_offset + 16;
+  uint8_t padded[4 * kMaxAvx2BitWidth + 32] = {};
+
+  for (int64_t offset = 0; offset < size; offset += chunk_size, out += 32) {
+    const uint8_t* chunk = data + offset;
+    if (offset + read_size > size) {
+      memcpy(padded, chunk, chunk_size);
+      chunk = padded;
+    }
+    Unpack8(kernel, chunk, out);
+    Unpack8(kernel, chunk + num_bits, out + 8);
+    Unpack8(kernel, chunk + 2 * num_bits, out + 16);
+    Unpack8(kernel, chunk + 3 * num_bits, out + 24);
+  }
+  return batch_size;
+}
+
+void gather_dictionary32_avx2(const uint32_t* dictionary, const int* indices,
+                              int length, uint32_t* out) {
+  const int* base = reinterpret_cast<const int*>(dictionary);
+  int i = 0;
+  for (; i + 8 <= length; i += 8) {
+    const __m256i index =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices + i));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i),
+                        _mm256_i32gather_epi32(base, index, 4));
+  }
+  for (; i < length; ++i) {
+    out[i] = dictionary[indices[i]];
+  }
+}
+
+void gather_dictionary64_avx2(const uint64_t* dictionary, const int* indices,
+                              int length, uint64_t* out) {
+  const long long* base = reinterpret_cast<const long long*>(dictionary);  // NOLINT
+  int i = 0;
+  for (; i + 4 <= length; i += 4) {
+    const __m128i index = _mm_loadu_si128(reinterpret_cast<const __m128i*>(indices + i));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i),
+                        _mm256_i32gather_epi64(base, index, 8));
+  }
+  for (; i < length; ++i) {
+    out[i] = dictionary[indices[i]];
+  }
+}
+
+}  // namespace internal
+}  // namespace arrow
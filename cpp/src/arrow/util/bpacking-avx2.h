@@ -0,0 +1,40 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// The AVX2 kernels of bpacking-simd.h, only to be called when the CPU
+// supports AVX2
+
+#ifndef ARROW_UTIL_BPACKING_AVX2_H
+#define ARROW_UTIL_BPACKING_AVX2_H
+
+#include <cstdint>
+
+namespace arrow {
+namespace internal {
+
+int unpack32_avx2(const uint32_t* in, uint32_t* out, int batch_size, int num_bits);
+
+void gather_dictionary32_avx2(const uint32_t* dictionary, const int* indices,
+                              int length, uint32_t* out);
+
+void gather_dictionary64_avx2(const uint64_t* dictionary, const int* indices,
+                              int length, uint64_t* out);
+
+}  // namespace internal
+}  // namespace arrow
+
+#endif  // ARROW_UTIL_BPACKING_AVX2_H
@@ -0,0 +1,75 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/bpacking-simd.h"
+
+#include "arrow/util/bpacking.h"
+#include "arrow/util/cpu-info.h"
+
+#ifdef ARROW_HAVE_AVX2
+#include "arrow/util/bpacking-avx2.h"
+#endif
+
+namespace arrow {
+namespace internal {
+
+#ifdef ARROW_HAVE_AVX2
+// The features are checked on each call rather than once, so that tests can
+// toggle them with CpuInfo::EnableFeature
+static inline bool UseAvx2() {
+  if (!CpuInfo::initialized()) {
+    CpuInfo::Init();
+  }
+  return CpuInfo::IsSupported(CpuInfo::AVX2);
+}
+#endif
+
+int unpack32_simd(const uint32_t* in, uint32_t* out, int batch_size, int num_bits) {
+#ifdef ARROW_HAVE_AVX2
+  if (UseAvx2()) {
+    return unpack32_avx2(in, out, batch_size, num_bits);
+  }
+#endif
+  return unpack32(in, out, batch_size, num_bits);
+}
+
+void gather_dictionary32(const uint32_t* dictionary, const int* indices, int length,
+                         uint32_t* out) {
+#ifdef ARROW_HAVE_AVX2
+  if (UseAvx2()) {
+    return gather_dictionary32_avx2(dictionary, indices, length, out);
+  }
+#endif
+  for (int i = 0; i < length; ++i) {
+    out[i] = dictionary[indices[i]];
+  }
+}
+
+void gather_dictionary64(const uint64_t* dictionary, const int* indices, int length,
+                         uint64_t* out) {
+#ifdef ARROW_HAVE_AVX2
+  if (UseAvx2()) {
+    return gather_dictionary64_avx2(dictionary, indices, length, out);
+  }
+#endif
+  for (int i = 0; i < length; ++i) {
+    out[i] = dictionary[indices[i]];
+  }
+}
+
+}  // namespace internal
+}  // namespace arrow
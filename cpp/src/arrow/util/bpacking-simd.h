@@ -0,0 +1,51 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Bit unpacking and dictionary gathering with SIMD kernels, selected at
+// runtime from the features of the CPU
+
+#ifndef ARROW_UTIL_BPACKING_SIMD_H
+#define ARROW_UTIL_BPACKING_SIMD_H
+
+#include <cstdint>
+
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace internal {
+
+/// \brief Like unpack32, with AVX2 kernels when the CPU supports them
+///
+/// Unpacks the largest multiple of 32 values of at most batch_size, and
+/// returns their number.
+ARROW_EXPORT
+int unpack32_simd(const uint32_t* in, uint32_t* out, int batch_size, int num_bits);
+
+/// \brief Look up the 4-byte values of a dictionary, out[i] = dictionary[indices[i]]
+ARROW_EXPORT
+void gather_dictionary32(const uint32_t* dictionary, const int* indices, int length,
+                         uint32_t* out);
+
+/// \brief Look up the 8-byte values of a dictionary, out[i] = dictionary[indices[i]]
+ARROW_EXPORT
+void gather_dictionary64(const uint64_t* dictionary, const int* indices, int length,
+                         uint64_t* out);
+
+}  // namespace internal
+}  // namespace arrow
+
+#endif  // ARROW_UTIL_BPACKING_SIMD_H
@@ -0,0 +1,219 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "arrow/test-util.h"
+#include "arrow/util/compression.h"
+
+namespace arrow {
+
+// The values of a column buffer, 8MB of them
+constexpr int64_t kBufferSize = 1 << 23;
+
+enum class DataKind { SORTED_INTS, RANDOM_DOUBLES, DICTIONARY_INDICES, STRINGS };
+
+template <typename T>
+static std::vector<uint8_t> ToBytes(const std::vector<T>& values) {
+  std::vector<uint8_t> bytes(values.size() * sizeof(T));
+  memcpy(bytes.data(), values.data(), bytes.size());
+  return bytes;
+}
+
+static std::vector<uint8_t> MakeData(DataKind kind) {
+  std::mt19937_64 rng(42);
+  switch (kind) {
+    case DataKind::SORTED_INTS: {
+      // Timestamps or row ids: increasing by small steps
+      std::vector<int64_t> values(kBufferSize / sizeof(int64_t));
+      std::uniform_int_distribution<int64_t> step(0, 100);
+      int64_t value = 1500000000000LL;
+      for (auto& v : values) {
+        value += step(rng);
+        v = value;
+      }
+      return ToBytes(values);
+    }
+    case DataKind::RANDOM_DOUBLES: {
+      std::vector<double> values(kBufferSize / sizeof(double));
+      std::normal_distribution<double> dist(100.0, 15.0);
+      for (auto& v : values) {
+        v = dist(rng);
+      }
+      return ToBytes(values);
+    }
+    case DataKind::DICTIONARY_INDICES: {
+      // The int32 indices of a dictionary of 30 values, some more frequent
+      std::vector<int32_t> values(kBufferSize / sizeof(int32_t));
+      std::geometric_distribution<int32_t> dist(0.2);
+      for (auto& v : values) {
+        v = std::min(dist(rng), 29);
+      }
+      return ToBytes(values);
+    }
+    case DataKind::STRINGS: {
+      // The character data of a column of words and short sentences
+      const std::vector<std::string> words = {
+          "apache", "arrow", "columnar", "memory", "format", "data",     "the",
+          "of",     "and",   "query",    "engine", "vector", "parquet", "file",
+          "stream", "batch", "schema",   "field",  "null",   "value"};
+      std::uniform_int_distribution<size_t> word(0, words.size() - 1);
+      std::uniform_int_distribution<int> length(1, 6);
+      std::string data;
+      data.reserve(kBufferSize + 64);
+      while (static_cast<int64_t>(data.size()) < kBufferSize) {
+        const int num_words = length(rng);
+        for (int i = 0; i < num_words; ++i) {
+          data += words[word(rng)];
+          data += i + 1 < num_words ? " " : ".";
+        }
+      }
+      data.resize(kBufferSize);
+      return std::vector<uint8_t>(data.begin(), data.end());
+    }
+  }
+  return {};
+}
+
+static const std::vector<uint8_t>& GetData(DataKind kind) {
+  // Generated once per kind, for all of the benchmarks
+  static std::vector<uint8_t> data[4];
+  std::vector<uint8_t>& out = data[static_cast<int>(kind)];
+  if (out.empty()) {
+    out = MakeData(kind);
+  }
+  return out;
+}
+
+// The benchmarks take the compression level as argument, -1 for the default
+// one of the codec
+static Status MakeCodec(Compression::type type, int64_t level,
+                        std::unique_ptr<Codec>* out) {
+  const int compression_level =
+      level == -1 ? kUseDefaultCompressionLevel : static_cast<int>(level);
+  return Codec::Create(type, compression_level, out);
+}
+
+static std::vector<uint8_t> Compress(Codec* codec, const std::vector<uint8_t>& data) {
+  const int64_t max_length =
+      codec->MaxCompressedLen(static_cast<int64_t>(data.size()), data.data());
+  std::vector<uint8_t> compressed(max_length);
+  int64_t length = 0;
+  ABORT_NOT_OK(codec->Compress(static_cast<int64_t>(data.size()), data.data(),
+                               max_length, compressed.data(), &length));
+  compressed.resize(length);
+  return compressed;
+}
+
+template <Compression::type CODEC, DataKind KIND>
+static void BM_Compress(benchmark::State& state) {  // NOLINT non-const reference
+  std::unique_ptr<Codec> codec;
+  if (!MakeCodec(CODEC, state.range(0), &codec).ok()) {
+    state.SkipWithError("Codec not built");
+    return;
+  }
+  const std::vector<uint8_t>& data = GetData(KIND);
+  const int64_t max_length =
+      codec->MaxCompressedLen(static_cast<int64_t>(data.size()), data.data());
+  std::vector<uint8_t> compressed(max_length);
+
+  int64_t length = 0;
+  while (state.KeepRunning()) {
+    ABORT_NOT_OK(codec->Compress(static_cast<int64_t>(data.size()), data.data(),
+                                 max_length, compressed.data(), &length));
+  }
+  state.SetBytesProcessed(state.iterations() * data.size());
+  state.counters["ratio"] = static_cast<double>(data.size()) / length;
+}
+
+template <Compression::type CODEC, DataKind KIND>
+static void BM_Decompress(benchmark::State& state) {  // NOLINT non-const reference
+  std::unique_ptr<Codec> codec;
+  if (!MakeCodec(CODEC, state.range(0), &codec).ok()) {
+    state.SkipWithError("Codec not built");
+    return;
+  }
+  const std::vector<uint8_t>& data = GetData(KIND);
+  const std::vector<uint8_t> compressed = Compress(codec.get(), data);
+  std::vector<uint8_t> decompressed(data.size());
+
+  while (state.KeepRunning()) {
+    ABORT_NOT_OK(codec->Decompress(static_cast<int64_t>(compressed.size()),
+                                   compressed.data(),
+                                   static_cast<int64_t>(decompressed.size()),
+                                   decompressed.data()));
+  }
+  // Throughput in uncompressed bytes, to compare with compression
+  state.SetBytesProcessed(state.iterations() * data.size());
+  state.counters["ratio"] = static_cast<double>(data.size()) / compressed.size();
+}
+
+static void DefaultLevel(benchmark::internal::Benchmark* bench) { bench->Arg(-1); }
+
+static void GZipLevels(benchmark::internal::Benchmark* bench) {
+  for (int level : {1, 6, 9}) {
+    bench->Arg(level);
+  }
+}
+
+static void BrotliLevels(benchmark::internal::Benchmark* bench) {
+  for (int level : {1, 5, 8}) {
+    bench->Arg(level);
+  }
+}
+
+static void ZSTDLevels(benchmark::internal::Benchmark* bench) {
+  for (int level : {1, 3, 9}) {
+    bench->Arg(level);
+  }
+}
+
+#define COMPRESSION_BENCHMARKS(CODEC, KIND, LEVELS)                     \
+  BENCHMARK_TEMPLATE(BM_Compress, Compression::CODEC, DataKind::KIND)   \
+      ->Apply(LEVELS)                                                   \
+      ->ArgName("level")                                                \
+      ->MinTime(1.0)                                                    \
+      ->Unit(benchmark::kMicrosecond)                                   \
+      ->UseRealTime();                                                  \
+  BENCHMARK_TEMPLATE(BM_Decompress, Compression::CODEC, DataKind::KIND) \
+      ->Apply(LEVELS)                                                   \
+      ->ArgName("level")                                                \
+      ->MinTime(1.0)                                                    \
+      ->Unit(benchmark::kMicrosecond)                                   \
+      ->UseRealTime()
+
+#define CODEC_BENCHMARKS(CODEC, LEVELS)                       \
+  COMPRESSION_BENCHMARKS(CODEC, SORTED_INTS, LEVELS);         \
+  COMPRESSION_BENCHMARKS(CODEC, RANDOM_DOUBLES, LEVELS);      \
+  COMPRESSION_BENCHMARKS(CODEC, DICTIONARY_INDICES, LEVELS);  \
+  COMPRESSION_BENCHMARKS(CODEC, STRINGS, LEVELS)
+
+CODEC_BENCHMARKS(SNAPPY, DefaultLevel);
+CODEC_BENCHMARKS(GZIP, GZipLevels);
+CODEC_BENCHMARKS(BROTLI, BrotliLevels);
+CODEC_BENCHMARKS(ZSTD, ZSTDLevels);
+CODEC_BENCHMARKS(LZ4, DefaultLevel);
+
+}  // namespace arrow
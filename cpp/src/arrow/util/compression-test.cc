@@ -22,6 +22,8 @@
 
 #include <gtest/gtest.h>
 
+#include "arrow/buffer.h"
+#include "arrow/memory_pool.h"
 #include "arrow/test-util.h"
 #include "arrow/util/compression.h"
 
@@ -88,4 +90,97 @@ TEST(TestCompressors, ZSTD) { CheckCodec<Compression::ZSTD>(); }
 
 TEST(TestCompressors, Lz4) { CheckCodec<Compression::LZ4>(); }
 
+TEST(TestCompressors, CompressionLevels) {
+  vector<uint8_t> data(100000);
+  for (size_t i = 0; i < data.size(); ++i) {
+    data[i] = static_cast<uint8_t>(i % 251 + i % 7);
+  }
+  for (auto type : {Compression::GZIP, Compression::BROTLI, Compression::ZSTD}) {
+    std::unique_ptr<Codec> fast, small;
+    if (!Codec::Create(type, 1, &fast).ok()) {
+      // Not built with this codec
+      continue;
+    }
+    ASSERT_OK(Codec::Create(type, 9, &small));
+    for (Codec* codec : {fast.get(), small.get()}) {
+      const int64_t max_length = codec->MaxCompressedLen(data.size(), data.data());
+      vector<uint8_t> compressed(max_length);
+      int64_t length;
+      ASSERT_OK(codec->Compress(data.size(), data.data(), max_length, compressed.data(),
+                                &length));
+      vector<uint8_t> decompressed(data.size());
+      ASSERT_OK(codec->Decompress(length, compressed.data(), decompressed.size(),
+                                  decompressed.data()));
+      ASSERT_EQ(data, decompressed);
+    }
+  }
+
+  std::unique_ptr<Codec> codec;
+  ASSERT_RAISES(Invalid, Codec::Create(Compression::SNAPPY, 1, &codec));
+  ASSERT_RAISES(Invalid, Codec::Create(Compression::LZ4, 1, &codec));
+}
+
+template <Compression::type CODEC>
+void CheckBlocks(bool use_threads) {
+  // Random data is stored as is, repeated data compressed; the sizes are not
+  // multiples of the block size
+  const int64_t kBlockSize = 4096;
+  std::vector<std::shared_ptr<Buffer>> inputs;
+  for (int64_t data_size : {0, 100, 50000}) {
+    std::shared_ptr<Buffer> random;
+    ASSERT_OK(AllocateBuffer(default_memory_pool(), data_size, &random));
+    test::random_bytes(data_size, 1234, random->mutable_data());
+    inputs.push_back(random);
+
+    std::shared_ptr<Buffer> repeated;
+    ASSERT_OK(AllocateBuffer(default_memory_pool(), data_size, &repeated));
+    for (int64_t i = 0; i < data_size; ++i) {
+      repeated->mutable_data()[i] = static_cast<uint8_t>(i % 7);
+    }
+    inputs.push_back(repeated);
+  }
+
+  std::vector<std::shared_ptr<Buffer>> frames;
+  ASSERT_OK(CompressBlocks(CODEC, kBlockSize, inputs, use_threads, default_memory_pool(),
+                           &frames));
+  ASSERT_EQ(inputs.size(), frames.size());
+  // Twelve blocks of repeated bytes shrink
+  ASSERT_LT(frames.back()->size(), inputs.back()->size());
+
+  std::vector<std::shared_ptr<Buffer>> outputs;
+  ASSERT_OK(
+      DecompressBlocks(CODEC, frames, use_threads, default_memory_pool(), &outputs));
+  ASSERT_EQ(inputs.size(), outputs.size());
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    ASSERT_TRUE(outputs[i]->Equals(*inputs[i]));
+  }
+
+  // Cut off within the last block
+  std::vector<std::shared_ptr<Buffer>> truncated = {
+      SliceBuffer(frames.back(), 0, frames.back()->size() - 1)};
+  ASSERT_RAISES(IOError, DecompressBlocks(CODEC, truncated, use_threads,
+                                          default_memory_pool(), &outputs));
+}
+
+TEST(TestCompressors, SnappyBlocks) {
+  CheckBlocks<Compression::SNAPPY>(false);
+  CheckBlocks<Compression::SNAPPY>(true);
+}
+
+TEST(TestCompressors, ZSTDBlocks) {
+  CheckBlocks<Compression::ZSTD>(false);
+  CheckBlocks<Compression::ZSTD>(true);
+}
+
+TEST(TestCompressors, Lz4Blocks) {
+  CheckBlocks<Compression::LZ4>(false);
+  CheckBlocks<Compression::LZ4>(true);
+}
+
+TEST(TestCompressors, BlocksNeedACodec) {
+  std::vector<std::shared_ptr<Buffer>> outputs;
+  ASSERT_RAISES(Invalid, CompressBlocks(Compression::UNCOMPRESSED, 4096, {}, false,
+                                        default_memory_pool(), &outputs));
+}
+
 }  // namespace arrow
@@ -17,7 +17,11 @@
 
 #include "arrow/util/compression.h"
 
+#include <algorithm>
+#include <cstring>
 #include <memory>
+#include <sstream>
+#include <vector>
 
 #ifdef ARROW_WITH_BROTLI
 #include "arrow/util/compression_brotli.h"
@@ -39,13 +43,43 @@
 #include "arrow/util/compression_zstd.h"
 #endif
 
+#include "arrow/buffer.h"
+#include "arrow/memory_pool.h"
 #include "arrow/status.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/parallel.h"
 
 namespace arrow {
 
+Compressor::~Compressor() {}
+
+Decompressor::~Decompressor() {}
+
 Codec::~Codec() {}
 
+Status Codec::MakeCompressor(std::shared_ptr<Compressor>* ARROW_ARG_UNUSED(out)) {
+  std::stringstream ss;
+  ss << "Streaming compression is not supported by the " << name() << " codec";
+  return Status::NotImplemented(ss.str());
+}
+
+Status Codec::MakeDecompressor(std::shared_ptr<Decompressor>* ARROW_ARG_UNUSED(out)) {
+  std::stringstream ss;
+  ss << "Streaming decompression is not supported by the " << name() << " codec";
+  return Status::NotImplemented(ss.str());
+}
+
 Status Codec::Create(Compression::type codec_type, std::unique_ptr<Codec>* result) {
+  return Create(codec_type, kUseDefaultCompressionLevel, result);
+}
+
+Status Codec::Create(Compression::type codec_type, int compression_level,
+                     std::unique_ptr<Codec>* result) {
+  if (compression_level != kUseDefaultCompressionLevel &&
+      (codec_type == Compression::SNAPPY || codec_type == Compression::LZ4)) {
+    return Status::Invalid("Snappy and LZ4 have no compression levels");
+  }
   switch (codec_type) {
     case Compression::UNCOMPRESSED:
       break;
@@ -58,7 +92,7 @@ Status Codec::Create(Compression::type codec_type, std::unique_ptr<Codec>* resul
       break;
     case Compression::GZIP:
 #ifdef ARROW_WITH_ZLIB
-      result->reset(new GZipCodec());
+      result->reset(new GZipCodec(GZipCodec::GZIP, compression_level));
 #else
       return Status::NotImplemented("Gzip codec support not built");
 #endif
@@ -67,7 +101,7 @@ Status Codec::Create(Compression::type codec_type, std::unique_ptr<Codec>* resul
       return Status::NotImplemented("LZO codec not implemented");
     case Compression::BROTLI:
 #ifdef ARROW_WITH_BROTLI
-      result->reset(new BrotliCodec());
+      result->reset(new BrotliCodec(compression_level));
 #else
       return Status::NotImplemented("Brotli codec support not built");
 #endif
@@ -81,7 +115,7 @@ Status Codec::Create(Compression::type codec_type, std::unique_ptr<Codec>* resul
       break;
     case Compression::ZSTD:
 #ifdef ARROW_WITH_ZSTD
-      result->reset(new ZSTDCodec());
+      result->reset(new ZSTDCodec(compression_level));
 #else
       return Status::NotImplemented("ZSTD codec support not built");
 #endif
@@ -92,4 +126,174 @@ Status Codec::Create(Compression::type codec_type, std::unique_ptr<Codec>* resul
   return Status::OK();
 }
 
+// ----------------------------------------------------------------------
+// Block compression
+
+namespace {
+
+// A block of a buffer to compress or decompress
+struct CompressionBlock {
+  int buffer;
+  const uint8_t* input;
+  int64_t input_length;
+  // The offset of the block in the decompressed buffer
+  int64_t output_offset;
+  int64_t output_length;
+};
+
+constexpr int64_t kBlockFrameHeaderSize = sizeof(int64_t);
+constexpr int64_t kBlockMetadataSize = 2 * sizeof(int64_t);
+
+template <typename FUNCTION>
+Status RunBlockTasks(int num_tasks, bool use_threads, FUNCTION&& func) {
+  if (use_threads && num_tasks > 1) {
+    return ParallelFor(num_tasks, func);
+  }
+  for (int i = 0; i < num_tasks; ++i) {
+    RETURN_NOT_OK(func(i));
+  }
+  return Status::OK();
+}
+
+}  // namespace
+
+Status CompressBlocks(Compression::type codec, int64_t block_size,
+                      const std::vector<std::shared_ptr<Buffer>>& inputs,
+                      bool use_threads, MemoryPool* pool,
+                      std::vector<std::shared_ptr<Buffer>>* outputs) {
+  if (codec == Compression::UNCOMPRESSED) {
+    return Status::Invalid("Block compression needs a codec");
+  }
+  if (block_size <= 0) {
+    return Status::Invalid("The compression block size must be positive");
+  }
+  std::vector<CompressionBlock> blocks;
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    const int64_t size = inputs[i]->size();
+    for (int64_t offset = 0; offset < size; offset += block_size) {
+      blocks.push_back({static_cast<int>(i), inputs[i]->data() + offset,
+                        std::min(block_size, size - offset), offset, 0});
+    }
+  }
+
+  // Each block is compressed into a buffer of its own, then the frames are
+  // assembled from them
+  std::vector<std::shared_ptr<Buffer>> compressed(blocks.size());
+  auto compress = [&](int k) -> Status {
+    CompressionBlock& block = blocks[k];
+    // Codecs may keep state, so each task has its own
+    std::unique_ptr<Codec> block_codec;
+    RETURN_NOT_OK(Codec::Create(codec, &block_codec));
+    const int64_t max_length =
+        block_codec->MaxCompressedLen(block.input_length, block.input);
+    std::shared_ptr<ResizableBuffer> buffer;
+    RETURN_NOT_OK(AllocateResizableBuffer(pool, max_length, &buffer));
+    int64_t length;
+    RETURN_NOT_OK(block_codec->Compress(block.input_length, block.input, max_length,
+                                        buffer->mutable_data(), &length));
+    if (length < block.input_length) {
+      RETURN_NOT_OK(buffer->Resize(length));
+      compressed[k] = buffer;
+      block.output_length = length;
+    } else {
+      block.output_length = block.input_length;
+    }
+    return Status::OK();
+  };
+  RETURN_NOT_OK(RunBlockTasks(static_cast<int>(blocks.size()), use_threads, compress));
+
+  std::vector<int64_t> num_blocks(inputs.size(), 0);
+  std::vector<int64_t> frame_sizes(inputs.size(), kBlockFrameHeaderSize);
+  for (const CompressionBlock& block : blocks) {
+    ++num_blocks[block.buffer];
+    frame_sizes[block.buffer] += kBlockMetadataSize + block.output_length;
+  }
+  outputs->resize(inputs.size());
+  std::vector<uint8_t*> metadata(inputs.size());
+  std::vector<uint8_t*> data(inputs.size());
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    std::shared_ptr<Buffer> frame;
+    RETURN_NOT_OK(AllocateBuffer(pool, frame_sizes[i], &frame));
+    metadata[i] = frame->mutable_data();
+    memcpy(metadata[i], &num_blocks[i], sizeof(int64_t));
+    metadata[i] += kBlockFrameHeaderSize;
+    data[i] = metadata[i] + num_blocks[i] * kBlockMetadataSize;
+    (*outputs)[i] = frame;
+  }
+  for (size_t k = 0; k < blocks.size(); ++k) {
+    const CompressionBlock& block = blocks[k];
+    const int i = block.buffer;
+    memcpy(metadata[i], &block.input_length, sizeof(int64_t));
+    memcpy(metadata[i] + sizeof(int64_t), &block.output_length, sizeof(int64_t));
+    metadata[i] += kBlockMetadataSize;
+    const uint8_t* block_data =
+        compressed[k] != nullptr ? compressed[k]->data() : block.input;
+    memcpy(data[i], block_data, block.output_length);
+    data[i] += block.output_length;
+  }
+  return Status::OK();
+}
+
+Status DecompressBlocks(Compression::type codec,
+                        const std::vector<std::shared_ptr<Buffer>>& inputs,
+                        bool use_threads, MemoryPool* pool,
+                        std::vector<std::shared_ptr<Buffer>>* outputs) {
+  if (codec == Compression::UNCOMPRESSED) {
+    return Status::Invalid("Block compression needs a codec");
+  }
+  std::vector<CompressionBlock> blocks;
+  std::vector<int64_t> decompressed_sizes(inputs.size());
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    const Buffer& frame = *inputs[i];
+    int64_t num_blocks;
+    if (frame.size() < kBlockFrameHeaderSize) {
+      return Status::IOError("Compressed block frame is truncated");
+    }
+    memcpy(&num_blocks, frame.data(), sizeof(int64_t));
+    if (num_blocks < 0 ||
+        num_blocks > (frame.size() - kBlockFrameHeaderSize) / kBlockMetadataSize) {
+      return Status::IOError("Compressed block frame is truncated");
+    }
+    const uint8_t* metadata = frame.data() + kBlockFrameHeaderSize;
+    int64_t input_offset = kBlockFrameHeaderSize + num_blocks * kBlockMetadataSize;
+    int64_t output_offset = 0;
+    for (int64_t j = 0; j < num_blocks; ++j) {
+      int64_t lengths[2];
+      memcpy(lengths, metadata + j * kBlockMetadataSize, kBlockMetadataSize);
+      const int64_t output_length = lengths[0];
+      const int64_t input_length = lengths[1];
+      if (output_length <= 0 || input_length <= 0 || input_length > output_length ||
+          input_length > frame.size() - input_offset) {
+        return Status::IOError("Compressed block frame is malformed");
+      }
+      blocks.push_back({static_cast<int>(i), frame.data() + input_offset, input_length,
+                        output_offset, output_length});
+      input_offset += input_length;
+      output_offset += output_length;
+    }
+    decompressed_sizes[i] = output_offset;
+  }
+
+  outputs->resize(inputs.size());
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    std::shared_ptr<Buffer> buffer;
+    RETURN_NOT_OK(AllocateBuffer(pool, decompressed_sizes[i], &buffer));
+    (*outputs)[i] = buffer;
+  }
+  auto decompress = [&](int k) -> Status {
+    const CompressionBlock& block = blocks[k];
+    uint8_t* output = (*outputs)[block.buffer]->mutable_data() + block.output_offset;
+    if (block.input_length == block.output_length) {
+      // Stored as is
+      memcpy(output, block.input, block.input_length);
+      return Status::OK();
+    }
+    std::unique_ptr<Codec> block_codec;
+    RETURN_NOT_OK(Codec::Create(codec, &block_codec));
+    return block_codec->Decompress(block.input_length, block.input, block.output_length,
+                                   output);
+  };
+  return RunBlockTasks(static_cast<int>(blocks.size()), use_threads, decompress);
+}
+
 }  // namespace arrow
@@ -19,23 +19,113 @@
 #define ARROW_UTIL_COMPRESSION_H
 
 #include <cstdint>
+#include <limits>
 #include <memory>
+#include <vector>
 
 #include "arrow/status.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
 
+class Buffer;
+class MemoryPool;
+
 struct Compression {
   enum type { UNCOMPRESSED, SNAPPY, GZIP, BROTLI, ZSTD, LZ4, LZO };
 };
 
+/// \brief A streaming compressor, for data too large or too incremental to
+/// compress in one shot
+///
+/// The compressor keeps its context from one call to the next, and from one
+/// stream to the next when Reset.
+class ARROW_EXPORT Compressor {
+ public:
+  virtual ~Compressor();
+
+  /// \brief Compress some input
+  ///
+  /// The input is consumed as far as the output has room for. If bytes_read
+  /// is 0 on return, the output buffer needs emptying or enlarging.
+  ///
+  /// \param[in] input_len the number of bytes of input
+  /// \param[in] input the input
+  /// \param[in] output_len the number of bytes of room in the output
+  /// \param[out] output the output buffer
+  /// \param[out] bytes_read the number of bytes of input consumed
+  /// \param[out] bytes_written the number of bytes written to output
+  /// \return Status
+  virtual Status Compress(int64_t input_len, const uint8_t* input, int64_t output_len,
+                          uint8_t* output, int64_t* bytes_read,
+                          int64_t* bytes_written) = 0;
+
+  /// \brief Write out the compressed data of all of the input so far
+  ///
+  /// If should_retry is true on return, Flush must be called again with an
+  /// emptied or larger output buffer.
+  virtual Status Flush(int64_t output_len, uint8_t* output, int64_t* bytes_written,
+                       bool* should_retry) = 0;
+
+  /// \brief End the compressed stream, writing out whatever remains of it
+  ///
+  /// If should_retry is true on return, End must be called again with an
+  /// emptied or larger output buffer.
+  virtual Status End(int64_t output_len, uint8_t* output, int64_t* bytes_written,
+                     bool* should_retry) = 0;
+
+  /// \brief Start a new compressed stream, reusing the context of the last
+  virtual Status Reset() = 0;
+};
+
+/// \brief A streaming decompressor
+///
+/// The decompressor keeps its context from one call to the next, and from one
+/// stream to the next when Reset.
+class ARROW_EXPORT Decompressor {
+ public:
+  virtual ~Decompressor();
+
+  /// \brief Decompress some input
+  ///
+  /// \param[in] input_len the number of bytes of input
+  /// \param[in] input the input
+  /// \param[in] output_len the number of bytes of room in the output
+  /// \param[out] output the output buffer
+  /// \param[out] bytes_read the number of bytes of input consumed
+  /// \param[out] bytes_written the number of bytes written to output
+  /// \param[out] need_more_output whether decompressed data remains pending
+  /// for lack of room in the output
+  /// \return Status
+  virtual Status Decompress(int64_t input_len, const uint8_t* input, int64_t output_len,
+                            uint8_t* output, int64_t* bytes_read, int64_t* bytes_written,
+                            bool* need_more_output) = 0;
+
+  /// \brief Whether the end of the compressed stream was reached
+  virtual bool IsFinished() = 0;
+
+  /// \brief Start on a new compressed stream, reusing the context of the last
+  virtual Status Reset() = 0;
+};
+
+/// \brief The compression level meaning the default one of the codec
+constexpr int kUseDefaultCompressionLevel = std::numeric_limits<int>::min();
+
 class ARROW_EXPORT Codec {
  public:
   virtual ~Codec();
 
   static Status Create(Compression::type codec, std::unique_ptr<Codec>* out);
 
+  /// \brief Create a codec compressing at the given level
+  ///
+  /// The levels are those of the compression libraries: 0 to 9 for gzip, 0 to
+  /// 11 for brotli, 1 to 22 for zstd, the higher the smaller and slower.
+  /// Snappy and LZ4 have no levels, and return Invalid unless the level is
+  /// kUseDefaultCompressionLevel.
+  static Status Create(Compression::type codec, int compression_level,
+                       std::unique_ptr<Codec>* out);
+
   virtual Status Decompress(int64_t input_len, const uint8_t* input, int64_t output_len,
                             uint8_t* output_buffer) = 0;
 
@@ -45,9 +135,63 @@ class ARROW_EXPORT Codec {
 
   virtual int64_t MaxCompressedLen(int64_t input_len, const uint8_t* input) = 0;
 
+  /// \brief Create a streaming compressor of the format of the codec
+  ///
+  /// Returns NotImplemented for the codecs without a streaming format.
+  virtual Status MakeCompressor(std::shared_ptr<Compressor>* out);
+
+  /// \brief Create a streaming decompressor of the format of the codec
+  ///
+  /// Returns NotImplemented for the codecs without a streaming format.
+  virtual Status MakeDecompressor(std::shared_ptr<Decompressor>* out);
+
   virtual const char* name() const = 0;
 };
 
+/// \brief The default size of the blocks of CompressBlocks, in bytes
+constexpr int64_t kDefaultCompressionBlockSize = 1 << 20;
+
+/// \brief Compress buffers as independent blocks, so that a large buffer is
+/// compressed, and decompressed, on several threads
+///
+/// Each input is cut into blocks of block_size bytes, the last one shorter,
+/// and the blocks of all of the inputs are compressed as separate tasks. Each
+/// output is a frame: the int64 number of blocks, then the int64
+/// uncompressed and compressed length of each block, then the compressed
+/// blocks. A block that would not shrink is stored as is, its two lengths
+/// equal.
+///
+/// \param[in] codec the codec to compress the blocks with
+/// \param[in] block_size the number of bytes of input of each block
+/// \param[in] inputs the buffers to compress
+/// \param[in] use_threads whether to compress on the CPU thread pool, which
+/// must be false when called from a task of that pool
+/// \param[in] pool the pool to allocate the frames from
+/// \param[out] outputs the frame of each input
+/// \return Status
+ARROW_EXPORT
+Status CompressBlocks(Compression::type codec, int64_t block_size,
+                      const std::vector<std::shared_ptr<Buffer>>& inputs,
+                      bool use_threads, MemoryPool* pool,
+                      std::vector<std::shared_ptr<Buffer>>* outputs);
+
+/// \brief Decompress frames written by CompressBlocks
+///
+/// The frames may be followed by padding, which is ignored.
+///
+/// \param[in] codec the codec the blocks were compressed with
+/// \param[in] inputs the frames to decompress
+/// \param[in] use_threads whether to decompress on the CPU thread pool, which
+/// must be false when called from a task of that pool
+/// \param[in] pool the pool to allocate the decompressed buffers from
+/// \param[out] outputs the decompressed data of each frame
+/// \return Status, IOError if a frame is malformed
+ARROW_EXPORT
+Status DecompressBlocks(Compression::type codec,
+                        const std::vector<std::shared_ptr<Buffer>>& inputs,
+                        bool use_threads, MemoryPool* pool,
+                        std::vector<std::shared_ptr<Buffer>>* outputs);
+
 }  // namespace arrow
 
 #endif
@@ -19,6 +19,8 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <memory>
+#include <sstream>
 
 #include <brotli/decode.h>
 #include <brotli/encode.h>
@@ -26,14 +28,152 @@
 
 #include "arrow/status.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/tracing.h"
 
 namespace arrow {
 
 // ----------------------------------------------------------------------
 // Brotli implementation
 
+// The default quality of one-shot and streaming compression. We use 8 as it
+// is the best trade-off for Parquet workload
+static constexpr int kBrotliDefaultQuality = 8;
+
+class BrotliCompressor : public Compressor {
+ public:
+  explicit BrotliCompressor(int quality) : quality_(quality), state_(nullptr) {}
+
+  ~BrotliCompressor() override {
+    if (state_ != nullptr) {
+      BrotliEncoderDestroyInstance(state_);
+    }
+  }
+
+  Status Init() {
+    state_ = BrotliEncoderCreateInstance(nullptr, nullptr, nullptr);
+    if (state_ == nullptr) {
+      return Status::OutOfMemory("BrotliEncoderCreateInstance failed");
+    }
+    if (!BrotliEncoderSetParameter(state_, BROTLI_PARAM_QUALITY, quality_)) {
+      return Status::IOError("BrotliEncoderSetParameter failed");
+    }
+    return Status::OK();
+  }
+
+  Status Compress(int64_t input_len, const uint8_t* input, int64_t output_len,
+                  uint8_t* output, int64_t* bytes_read, int64_t* bytes_written) override {
+    size_t avail_in = static_cast<size_t>(input_len);
+    size_t avail_out = static_cast<size_t>(output_len);
+    RETURN_NOT_OK(
+        Process(BROTLI_OPERATION_PROCESS, &avail_in, input, &avail_out, output));
+    *bytes_read = input_len - static_cast<int64_t>(avail_in);
+    *bytes_written = output_len - static_cast<int64_t>(avail_out);
+    return Status::OK();
+  }
+
+  Status Flush(int64_t output_len, uint8_t* output, int64_t* bytes_written,
+               bool* should_retry) override {
+    size_t avail_in = 0;
+    size_t avail_out = static_cast<size_t>(output_len);
+    RETURN_NOT_OK(
+        Process(BROTLI_OPERATION_FLUSH, &avail_in, nullptr, &avail_out, output));
+    *bytes_written = output_len - static_cast<int64_t>(avail_out);
+    *should_retry = BrotliEncoderHasMoreOutput(state_) == BROTLI_TRUE;
+    return Status::OK();
+  }
+
+  Status End(int64_t output_len, uint8_t* output, int64_t* bytes_written,
+             bool* should_retry) override {
+    size_t avail_in = 0;
+    size_t avail_out = static_cast<size_t>(output_len);
+    RETURN_NOT_OK(
+        Process(BROTLI_OPERATION_FINISH, &avail_in, nullptr, &avail_out, output));
+    *bytes_written = output_len - static_cast<int64_t>(avail_out);
+    *should_retry = BrotliEncoderIsFinished(state_) == BROTLI_FALSE;
+    return Status::OK();
+  }
+
+  // The encoder has no reset, so a new one is created
+  Status Reset() override {
+    BrotliEncoderDestroyInstance(state_);
+    return Init();
+  }
+
+ private:
+  Status Process(BrotliEncoderOperation op, size_t* avail_in, const uint8_t* input,
+                 size_t* avail_out, uint8_t* output) {
+    const uint8_t* next_in = input;
+    uint8_t* next_out = output;
+    if (!BrotliEncoderCompressStream(state_, op, avail_in, &next_in, avail_out,
+                                     &next_out, nullptr)) {
+      return Status::IOError("Brotli compression failure.");
+    }
+    return Status::OK();
+  }
+
+  int quality_;
+  BrotliEncoderState* state_;
+};
+
+class BrotliDecompressor : public Decompressor {
+ public:
+  BrotliDecompressor() : state_(nullptr) {}
+
+  ~BrotliDecompressor() override {
+    if (state_ != nullptr) {
+      BrotliDecoderDestroyInstance(state_);
+    }
+  }
+
+  Status Init() {
+    state_ = BrotliDecoderCreateInstance(nullptr, nullptr, nullptr);
+    if (state_ == nullptr) {
+      return Status::OutOfMemory("BrotliDecoderCreateInstance failed");
+    }
+    return Status::OK();
+  }
+
+  Status Decompress(int64_t input_len, const uint8_t* input, int64_t output_len,
+                    uint8_t* output, int64_t* bytes_read, int64_t* bytes_written,
+                    bool* need_more_output) override {
+    size_t avail_in = static_cast<size_t>(input_len);
+    size_t avail_out = static_cast<size_t>(output_len);
+    const uint8_t* next_in = input;
+    uint8_t* next_out = output;
+    BrotliDecoderResult ret = BrotliDecoderDecompressStream(
+        state_, &avail_in, &next_in, &avail_out, &next_out, nullptr);
+    if (ret == BROTLI_DECODER_RESULT_ERROR) {
+      std::stringstream ss;
+      ss << "Brotli decompress failed: "
+         << BrotliDecoderErrorString(BrotliDecoderGetErrorCode(state_));
+      return Status::IOError(ss.str());
+    }
+    *bytes_read = input_len - static_cast<int64_t>(avail_in);
+    *bytes_written = output_len - static_cast<int64_t>(avail_out);
+    *need_more_output = ret == BROTLI_DECODER_RESULT_NEEDS_MORE_OUTPUT;
+    return Status::OK();
+  }
+
+  bool IsFinished() override { return BrotliDecoderIsFinished(state_) == BROTLI_TRUE; }
+
+  // The decoder has no reset, so a new one is created
+  Status Reset() override {
+    BrotliDecoderDestroyInstance(state_);
+    return Init();
+  }
+
+ private:
+  BrotliDecoderState* state_;
+};
+
+BrotliCodec::BrotliCodec(int compression_level)
+    : quality_(compression_level == kUseDefaultCompressionLevel ? kBrotliDefaultQuality
+                                                               : compression_level) {}
+
 Status BrotliCodec::Decompress(int64_t input_len, const uint8_t* input,
                                int64_t output_len, uint8_t* output_buffer) {
+  ARROW_TRACE_SPAN(span, "codec", "BrotliCodec::Decompress");
+  ARROW_TRACE_BYTES(span, input_len);
   std::size_t output_size = output_len;
   if (BrotliDecoderDecompress(input_len, input, &output_size, output_buffer) !=
       BROTLI_DECODER_RESULT_SUCCESS) {
@@ -50,15 +190,30 @@ int64_t BrotliCodec::MaxCompressedLen(int64_t input_len,
 Status BrotliCodec::Compress(int64_t input_len, const uint8_t* input,
                              int64_t output_buffer_len, uint8_t* output_buffer,
                              int64_t* output_length) {
+  ARROW_TRACE_SPAN(span, "codec", "BrotliCodec::Compress");
+  ARROW_TRACE_BYTES(span, input_len);
   std::size_t output_len = output_buffer_len;
-  // TODO: Make quality configurable. We use 8 as a default as it is the best
-  //       trade-off for Parquet workload
-  if (BrotliEncoderCompress(8, BROTLI_DEFAULT_WINDOW, BROTLI_DEFAULT_MODE, input_len,
-                            input, &output_len, output_buffer) == BROTLI_FALSE) {
+  if (BrotliEncoderCompress(quality_, BROTLI_DEFAULT_WINDOW, BROTLI_DEFAULT_MODE,
+                            input_len, input, &output_len,
+                            output_buffer) == BROTLI_FALSE) {
     return Status::IOError("Brotli compression failure.");
   }
   *output_length = output_len;
   return Status::OK();
 }
 
+Status BrotliCodec::MakeCompressor(std::shared_ptr<Compressor>* out) {
+  auto compressor = std::make_shared<BrotliCompressor>(quality_);
+  RETURN_NOT_OK(compressor->Init());
+  *out = compressor;
+  return Status::OK();
+}
+
+Status BrotliCodec::MakeDecompressor(std::shared_ptr<Decompressor>* out) {
+  auto decompressor = std::make_shared<BrotliDecompressor>();
+  RETURN_NOT_OK(decompressor->Init());
+  *out = decompressor;
+  return Status::OK();
+}
+
 }  // namespace arrow
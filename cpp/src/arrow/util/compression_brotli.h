@@ -19,6 +19,7 @@
 #define ARROW_UTIL_COMPRESSION_BROTLI_H
 
 #include <cstdint>
+#include <memory>
 
 #include "arrow/status.h"
 #include "arrow/util/compression.h"
@@ -29,6 +30,8 @@ namespace arrow {
 // Brotli codec.
 class ARROW_EXPORT BrotliCodec : public Codec {
  public:
+  explicit BrotliCodec(int compression_level = kUseDefaultCompressionLevel);
+
   Status Decompress(int64_t input_len, const uint8_t* input, int64_t output_len,
                     uint8_t* output_buffer) override;
 
@@ -37,7 +40,14 @@ class ARROW_EXPORT BrotliCodec : public Codec {
 
   int64_t MaxCompressedLen(int64_t input_len, const uint8_t* input) override;
 
+  Status MakeCompressor(std::shared_ptr<Compressor>* out) override;
+
+  Status MakeDecompressor(std::shared_ptr<Decompressor>* out) override;
+
   const char* name() const override { return "brotli"; }
+
+ private:
+  int quality_;
 };
 
 }  // namespace arrow
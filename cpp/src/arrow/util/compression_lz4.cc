@@ -23,6 +23,7 @@
 
 #include "arrow/status.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/tracing.h"
 
 namespace arrow {
 
@@ -31,6 +32,8 @@ namespace arrow {
 
 Status Lz4Codec::Decompress(int64_t input_len, const uint8_t* input, int64_t output_len,
                             uint8_t* output_buffer) {
+  ARROW_TRACE_SPAN(span, "codec", "Lz4Codec::Decompress");
+  ARROW_TRACE_BYTES(span, input_len);
   int64_t decompressed_size = LZ4_decompress_safe(
       reinterpret_cast<const char*>(input), reinterpret_cast<char*>(output_buffer),
       static_cast<int>(input_len), static_cast<int>(output_len));
@@ -48,6 +51,8 @@ int64_t Lz4Codec::MaxCompressedLen(int64_t input_len,
 Status Lz4Codec::Compress(int64_t input_len, const uint8_t* input,
                           int64_t output_buffer_len, uint8_t* output_buffer,
                           int64_t* output_length) {
+  ARROW_TRACE_SPAN(span, "codec", "Lz4Codec::Compress");
+  ARROW_TRACE_BYTES(span, input_len);
   *output_length = LZ4_compress_default(
       reinterpret_cast<const char*>(input), reinterpret_cast<char*>(output_buffer),
       static_cast<int>(input_len), static_cast<int>(output_buffer_len));
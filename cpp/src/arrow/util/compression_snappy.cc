@@ -24,6 +24,7 @@
 
 #include "arrow/status.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/tracing.h"
 
 using std::size_t;
 
@@ -35,6 +36,8 @@ namespace arrow {
 Status SnappyCodec::Decompress(int64_t input_len, const uint8_t* input,
                                int64_t ARROW_ARG_UNUSED(output_len),
                                uint8_t* output_buffer) {
+  ARROW_TRACE_SPAN(span, "codec", "SnappyCodec::Decompress");
+  ARROW_TRACE_BYTES(span, input_len);
   if (!snappy::RawUncompress(reinterpret_cast<const char*>(input),
                              static_cast<size_t>(input_len),
                              reinterpret_cast<char*>(output_buffer))) {
@@ -51,6 +54,8 @@ int64_t SnappyCodec::MaxCompressedLen(int64_t input_len,
 Status SnappyCodec::Compress(int64_t input_len, const uint8_t* input,
                              int64_t ARROW_ARG_UNUSED(output_buffer_len),
                              uint8_t* output_buffer, int64_t* output_length) {
+  ARROW_TRACE_SPAN(span, "codec", "SnappyCodec::Compress");
+  ARROW_TRACE_BYTES(span, input_len);
   size_t output_len;
   snappy::RawCompress(reinterpret_cast<const char*>(input),
                       static_cast<size_t>(input_len),
@@ -17,8 +17,10 @@
 
 #include "arrow/util/compression_zlib.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
+#include <limits>
 #include <memory>
 #include <sstream>
 #include <string>
@@ -28,6 +30,7 @@
 
 #include "arrow/status.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/tracing.h"
 
 namespace arrow {
 
@@ -46,10 +49,186 @@ static constexpr int GZIP_CODEC = 16;
 // Determine if this is libz or gzip from header.
 static constexpr int DETECT_CODEC = 32;
 
+static int CompressionWindowBits(GZipCodec::Format format) {
+  if (format == GZipCodec::DEFLATE) {
+    return -WINDOW_BITS;
+  } else if (format == GZipCodec::GZIP) {
+    return WINDOW_BITS + GZIP_CODEC;
+  }
+  return WINDOW_BITS;
+}
+
+static int DecompressionWindowBits(GZipCodec::Format format) {
+  // Detect zlib or gzip from the header, deflate having none
+  return format == GZipCodec::DEFLATE ? -WINDOW_BITS : WINDOW_BITS | DETECT_CODEC;
+}
+
+static Status ZlibError(const char* prefix, const z_stream& stream) {
+  std::stringstream ss;
+  ss << prefix;
+  if (stream.msg != NULL) {
+    ss << stream.msg;
+  }
+  return Status::IOError(ss.str());
+}
+
+// zlib counts bytes in 32 bits, so larger buffers are consumed in parts
+static constexpr int64_t kMaxZlibBytes = std::numeric_limits<uInt>::max();
+
+class GZipCompressor : public Compressor {
+ public:
+  GZipCompressor(GZipCodec::Format format, int compression_level)
+      : format_(format), compression_level_(compression_level), initialized_(false) {}
+
+  ~GZipCompressor() override {
+    if (initialized_) {
+      (void)deflateEnd(&stream_);
+    }
+  }
+
+  Status Init() {
+    DCHECK(!initialized_);
+    memset(&stream_, 0, sizeof(stream_));
+    if (deflateInit2(&stream_, compression_level_, Z_DEFLATED,
+                     CompressionWindowBits(format_), 9, Z_DEFAULT_STRATEGY) != Z_OK) {
+      return ZlibError("zlib deflateInit failed: ", stream_);
+    }
+    initialized_ = true;
+    return Status::OK();
+  }
+
+  Status Compress(int64_t input_len, const uint8_t* input, int64_t output_len,
+                  uint8_t* output, int64_t* bytes_read, int64_t* bytes_written) override {
+    DCHECK(initialized_) << "Called on non-initialized stream";
+    input_len = std::min(input_len, kMaxZlibBytes);
+    output_len = std::min(output_len, kMaxZlibBytes);
+    stream_.next_in = const_cast<Bytef*>(reinterpret_cast<const Bytef*>(input));
+    stream_.avail_in = static_cast<uInt>(input_len);
+    stream_.next_out = reinterpret_cast<Bytef*>(output);
+    stream_.avail_out = static_cast<uInt>(output_len);
+
+    // Z_BUF_ERROR only means that no progress was possible
+    int ret = deflate(&stream_, Z_NO_FLUSH);
+    if (ret != Z_OK && ret != Z_BUF_ERROR) {
+      return ZlibError("zlib compress failed: ", stream_);
+    }
+    *bytes_read = input_len - stream_.avail_in;
+    *bytes_written = output_len - stream_.avail_out;
+    return Status::OK();
+  }
+
+  Status Flush(int64_t output_len, uint8_t* output, int64_t* bytes_written,
+               bool* should_retry) override {
+    return FlushOrEnd(Z_SYNC_FLUSH, output_len, output, bytes_written, should_retry);
+  }
+
+  Status End(int64_t output_len, uint8_t* output, int64_t* bytes_written,
+             bool* should_retry) override {
+    return FlushOrEnd(Z_FINISH, output_len, output, bytes_written, should_retry);
+  }
+
+  Status Reset() override {
+    if (deflateReset(&stream_) != Z_OK) {
+      return ZlibError("zlib deflateReset failed: ", stream_);
+    }
+    return Status::OK();
+  }
+
+ private:
+  Status FlushOrEnd(int flush, int64_t output_len, uint8_t* output,
+                    int64_t* bytes_written, bool* should_retry) {
+    DCHECK(initialized_) << "Called on non-initialized stream";
+    output_len = std::min(output_len, kMaxZlibBytes);
+    stream_.next_in = nullptr;
+    stream_.avail_in = 0;
+    stream_.next_out = reinterpret_cast<Bytef*>(output);
+    stream_.avail_out = static_cast<uInt>(output_len);
+
+    int ret = deflate(&stream_, flush);
+    if (ret != Z_OK && ret != Z_BUF_ERROR && ret != Z_STREAM_END) {
+      return ZlibError("zlib flush failed: ", stream_);
+    }
+    *bytes_written = output_len - stream_.avail_out;
+    if (flush == Z_FINISH) {
+      *should_retry = ret != Z_STREAM_END;
+    } else {
+      // If the output was filled, some may remain to flush
+      *should_retry = stream_.avail_out == 0;
+    }
+    return Status::OK();
+  }
+
+  z_stream stream_;
+  GZipCodec::Format format_;
+  int compression_level_;
+  bool initialized_;
+};
+
+class GZipDecompressor : public Decompressor {
+ public:
+  explicit GZipDecompressor(GZipCodec::Format format)
+      : format_(format), initialized_(false), finished_(false) {}
+
+  ~GZipDecompressor() override {
+    if (initialized_) {
+      (void)inflateEnd(&stream_);
+    }
+  }
+
+  Status Init() {
+    DCHECK(!initialized_);
+    memset(&stream_, 0, sizeof(stream_));
+    if (inflateInit2(&stream_, DecompressionWindowBits(format_)) != Z_OK) {
+      return ZlibError("zlib inflateInit failed: ", stream_);
+    }
+    initialized_ = true;
+    return Status::OK();
+  }
+
+  Status Decompress(int64_t input_len, const uint8_t* input, int64_t output_len,
+                    uint8_t* output, int64_t* bytes_read, int64_t* bytes_written,
+                    bool* need_more_output) override {
+    DCHECK(initialized_) << "Called on non-initialized stream";
+    input_len = std::min(input_len, kMaxZlibBytes);
+    output_len = std::min(output_len, kMaxZlibBytes);
+    stream_.next_in = const_cast<Bytef*>(reinterpret_cast<const Bytef*>(input));
+    stream_.avail_in = static_cast<uInt>(input_len);
+    stream_.next_out = reinterpret_cast<Bytef*>(output);
+    stream_.avail_out = static_cast<uInt>(output_len);
+
+    int ret = inflate(&stream_, Z_SYNC_FLUSH);
+    if (ret != Z_OK && ret != Z_BUF_ERROR && ret != Z_STREAM_END) {
+      return ZlibError("zlib inflate failed: ", stream_);
+    }
+    finished_ = ret == Z_STREAM_END;
+    *bytes_read = input_len - stream_.avail_in;
+    *bytes_written = output_len - stream_.avail_out;
+    *need_more_output = !finished_ && stream_.avail_out == 0;
+    return Status::OK();
+  }
+
+  bool IsFinished() override { return finished_; }
+
+  Status Reset() override {
+    if (inflateReset(&stream_) != Z_OK) {
+      return ZlibError("zlib inflateReset failed: ", stream_);
+    }
+    finished_ = false;
+    return Status::OK();
+  }
+
+ private:
+  z_stream stream_;
+  GZipCodec::Format format_;
+  bool initialized_;
+  bool finished_;
+};
+
 class GZipCodec::GZipCodecImpl {
  public:
-  explicit GZipCodecImpl(GZipCodec::Format format)
+  GZipCodecImpl(GZipCodec::Format format, int compression_level)
       : format_(format),
+        compression_level_(compression_level),
         compressor_initialized_(false),
         decompressor_initialized_(false) {}
 
@@ -70,7 +249,7 @@ class GZipCodec::GZipCodecImpl {
     } else if (format_ == GZIP) {
       window_bits += GZIP_CODEC;
     }
-    if ((ret = deflateInit2(&stream_, Z_DEFAULT_COMPRESSION, Z_DEFLATED, window_bits, 9,
+    if ((ret = deflateInit2(&stream_, compression_level_, Z_DEFLATED, window_bits, 9,
                             Z_DEFAULT_STRATEGY)) != Z_OK) {
       std::stringstream ss;
       ss << "zlib deflateInit failed: " << std::string(stream_.msg);
@@ -216,6 +395,7 @@ class GZipCodec::GZipCodecImpl {
   // Realistically, this will always be GZIP, but we leave the option open to
   // configure
   GZipCodec::Format format_;
+  int compression_level_;
 
   // These variables are mutually exclusive. When the codec is in "compressor"
   // state, compressor_initialized_ is true while decompressor_initialized_ is
@@ -228,12 +408,20 @@ class GZipCodec::GZipCodecImpl {
   bool decompressor_initialized_;
 };
 
-GZipCodec::GZipCodec(Format format) { impl_.reset(new GZipCodecImpl(format)); }
+GZipCodec::GZipCodec(Format format, int compression_level)
+    : format_(format),
+      compression_level_(compression_level == kUseDefaultCompressionLevel
+                             ? Z_DEFAULT_COMPRESSION
+                             : compression_level) {
+  impl_.reset(new GZipCodecImpl(format_, compression_level_));
+}
 
 GZipCodec::~GZipCodec() {}
 
 Status GZipCodec::Decompress(int64_t input_length, const uint8_t* input,
                              int64_t output_buffer_len, uint8_t* output) {
+  ARROW_TRACE_SPAN(span, "codec", "GZipCodec::Decompress");
+  ARROW_TRACE_BYTES(span, input_length);
   return impl_->Decompress(input_length, input, output_buffer_len, output);
 }
 
@@ -244,9 +432,25 @@ int64_t GZipCodec::MaxCompressedLen(int64_t input_length, const uint8_t* input)
 Status GZipCodec::Compress(int64_t input_length, const uint8_t* input,
                            int64_t output_buffer_len, uint8_t* output,
                            int64_t* output_length) {
+  ARROW_TRACE_SPAN(span, "codec", "GZipCodec::Compress");
+  ARROW_TRACE_BYTES(span, input_length);
   return impl_->Compress(input_length, input, output_buffer_len, output, output_length);
 }
 
+Status GZipCodec::MakeCompressor(std::shared_ptr<Compressor>* out) {
+  auto compressor = std::make_shared<GZipCompressor>(format_, compression_level_);
+  RETURN_NOT_OK(compressor->Init());
+  *out = compressor;
+  return Status::OK();
+}
+
+Status GZipCodec::MakeDecompressor(std::shared_ptr<Decompressor>* out) {
+  auto decompressor = std::make_shared<GZipDecompressor>(format_);
+  RETURN_NOT_OK(decompressor->Init());
+  *out = decompressor;
+  return Status::OK();
+}
+
 const char* GZipCodec::name() const { return "gzip"; }
 
 }  // namespace arrow
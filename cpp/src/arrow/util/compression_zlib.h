@@ -37,7 +37,8 @@ class ARROW_EXPORT GZipCodec : public Codec {
     GZIP,
   };
 
-  explicit GZipCodec(Format format = GZIP);
+  explicit GZipCodec(Format format = GZIP,
+                     int compression_level = kUseDefaultCompressionLevel);
   ~GZipCodec() override;
 
   Status Decompress(int64_t input_len, const uint8_t* input, int64_t output_len,
@@ -48,9 +49,16 @@ class ARROW_EXPORT GZipCodec : public Codec {
 
   int64_t MaxCompressedLen(int64_t input_len, const uint8_t* input) override;
 
+  Status MakeCompressor(std::shared_ptr<Compressor>* out) override;
+
+  Status MakeDecompressor(std::shared_ptr<Decompressor>* out) override;
+
   const char* name() const override;
 
  private:
+  Format format_;
+  int compression_level_;
+
   // The gzip compressor is stateful
   class GZipCodecImpl;
   std::unique_ptr<GZipCodecImpl> impl_;
@@ -19,11 +19,14 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <memory>
+#include <sstream>
 
 #include <zstd.h>
 
 #include "arrow/status.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/tracing.h"
 
 using std::size_t;
 
@@ -32,11 +35,152 @@ namespace arrow {
 // ----------------------------------------------------------------------
 // ZSTD implementation
 
+// The default compression level of ZSTD streams and one-shot calls
+static constexpr int kZSTDDefaultCompressionLevel = 1;
+
+static Status ZSTDError(size_t ret, const char* prefix) {
+  std::stringstream ss;
+  ss << prefix << ZSTD_getErrorName(ret);
+  return Status::IOError(ss.str());
+}
+
+class ZSTDCompressor : public Compressor {
+ public:
+  explicit ZSTDCompressor(int compression_level)
+      : compression_level_(compression_level), stream_(ZSTD_createCStream()) {}
+
+  ~ZSTDCompressor() override { ZSTD_freeCStream(stream_); }
+
+  Status Init() {
+    if (stream_ == nullptr) {
+      return Status::OutOfMemory("ZSTD_createCStream failed");
+    }
+    return Reset();
+  }
+
+  Status Compress(int64_t input_len, const uint8_t* input, int64_t output_len,
+                  uint8_t* output, int64_t* bytes_read, int64_t* bytes_written) override {
+    ZSTD_inBuffer in_buf = {input, static_cast<size_t>(input_len), 0};
+    ZSTD_outBuffer out_buf = {output, static_cast<size_t>(output_len), 0};
+    size_t ret = ZSTD_compressStream(stream_, &out_buf, &in_buf);
+    if (ZSTD_isError(ret)) {
+      return ZSTDError(ret, "ZSTD compress failed: ");
+    }
+    *bytes_read = static_cast<int64_t>(in_buf.pos);
+    *bytes_written = static_cast<int64_t>(out_buf.pos);
+    return Status::OK();
+  }
+
+  Status Flush(int64_t output_len, uint8_t* output, int64_t* bytes_written,
+               bool* should_retry) override {
+    ZSTD_outBuffer out_buf = {output, static_cast<size_t>(output_len), 0};
+    size_t ret = ZSTD_flushStream(stream_, &out_buf);
+    if (ZSTD_isError(ret)) {
+      return ZSTDError(ret, "ZSTD flush failed: ");
+    }
+    // The return value is the number of bytes left to flush
+    *bytes_written = static_cast<int64_t>(out_buf.pos);
+    *should_retry = ret > 0;
+    return Status::OK();
+  }
+
+  Status End(int64_t output_len, uint8_t* output, int64_t* bytes_written,
+             bool* should_retry) override {
+    ZSTD_outBuffer out_buf = {output, static_cast<size_t>(output_len), 0};
+    size_t ret = ZSTD_endStream(stream_, &out_buf);
+    if (ZSTD_isError(ret)) {
+      return ZSTDError(ret, "ZSTD end failed: ");
+    }
+    *bytes_written = static_cast<int64_t>(out_buf.pos);
+    *should_retry = ret > 0;
+    return Status::OK();
+  }
+
+  // Initializing the stream again keeps its allocated context
+  Status Reset() override {
+    size_t ret = ZSTD_initCStream(stream_, compression_level_);
+    if (ZSTD_isError(ret)) {
+      return ZSTDError(ret, "ZSTD init failed: ");
+    }
+    return Status::OK();
+  }
+
+ private:
+  int compression_level_;
+  ZSTD_CStream* stream_;
+};
+
+class ZSTDDecompressor : public Decompressor {
+ public:
+  ZSTDDecompressor() : stream_(ZSTD_createDStream()), finished_(false) {}
+
+  ~ZSTDDecompressor() override { ZSTD_freeDStream(stream_); }
+
+  Status Init() {
+    if (stream_ == nullptr) {
+      return Status::OutOfMemory("ZSTD_createDStream failed");
+    }
+    return Reset();
+  }
+
+  Status Decompress(int64_t input_len, const uint8_t* input, int64_t output_len,
+                    uint8_t* output, int64_t* bytes_read, int64_t* bytes_written,
+                    bool* need_more_output) override {
+    ZSTD_inBuffer in_buf = {input, static_cast<size_t>(input_len), 0};
+    ZSTD_outBuffer out_buf = {output, static_cast<size_t>(output_len), 0};
+    size_t ret = ZSTD_decompressStream(stream_, &out_buf, &in_buf);
+    if (ZSTD_isError(ret)) {
+      return ZSTDError(ret, "ZSTD decompress failed: ");
+    }
+    // 0 is returned once a frame is fully decoded and flushed
+    finished_ = ret == 0;
+    *bytes_read = static_cast<int64_t>(in_buf.pos);
+    *bytes_written = static_cast<int64_t>(out_buf.pos);
+    *need_more_output = !finished_ && out_buf.pos == out_buf.size;
+    return Status::OK();
+  }
+
+  bool IsFinished() override { return finished_; }
+
+  Status Reset() override {
+    size_t ret = ZSTD_initDStream(stream_);
+    if (ZSTD_isError(ret)) {
+      return ZSTDError(ret, "ZSTD init failed: ");
+    }
+    finished_ = false;
+    return Status::OK();
+  }
+
+ private:
+  ZSTD_DStream* stream_;
+  bool finished_;
+};
+
+ZSTDCodec::ZSTDCodec(int compression_level)
+    : compression_level_(compression_level == kUseDefaultCompressionLevel
+                             ? kZSTDDefaultCompressionLevel
+                             : compression_level),
+      compress_context_(nullptr),
+      decompress_context_(nullptr) {}
+
+ZSTDCodec::~ZSTDCodec() {
+  ZSTD_freeCCtx(compress_context_);
+  ZSTD_freeDCtx(decompress_context_);
+}
+
 Status ZSTDCodec::Decompress(int64_t input_len, const uint8_t* input, int64_t output_len,
                              uint8_t* output_buffer) {
-  int64_t decompressed_size =
-      ZSTD_decompress(output_buffer, static_cast<size_t>(output_len), input,
-                      static_cast<size_t>(input_len));
+  ARROW_TRACE_SPAN(span, "codec", "ZSTDCodec::Decompress");
+  ARROW_TRACE_BYTES(span, input_len);
+  if (decompress_context_ == nullptr) {
+    decompress_context_ = ZSTD_createDCtx();
+    if (decompress_context_ == nullptr) {
+      return Status::OutOfMemory("ZSTD_createDCtx failed");
+    }
+  }
+  int64_t decompressed_size = ZSTD_decompressDCtx(
+      decompress_context_, output_buffer, static_cast<size_t>(output_len), input,
+      static_cast<size_t>(input_len));
   if (decompressed_size != output_len) {
     return Status::IOError("Corrupt ZSTD compressed data.");
   }
@@ -51,12 +195,35 @@ int64_t ZSTDCodec::MaxCompressedLen(int64_t input_len,
 Status ZSTDCodec::Compress(int64_t input_len, const uint8_t* input,
                            int64_t output_buffer_len, uint8_t* output_buffer,
                            int64_t* output_length) {
-  *output_length = ZSTD_compress(output_buffer, static_cast<size_t>(output_buffer_len),
-                                 input, static_cast<size_t>(input_len), 1);
+  ARROW_TRACE_SPAN(span, "codec", "ZSTDCodec::Compress");
+  ARROW_TRACE_BYTES(span, input_len);
+  if (compress_context_ == nullptr) {
+    compress_context_ = ZSTD_createCCtx();
+    if (compress_context_ == nullptr) {
+      return Status::OutOfMemory("ZSTD_createCCtx failed");
+    }
+  }
+  *output_length = ZSTD_compressCCtx(
+      compress_context_, output_buffer, static_cast<size_t>(output_buffer_len), input,
+      static_cast<size_t>(input_len), compression_level_);
   if (ZSTD_isError(*output_length)) {
     return Status::IOError("ZSTD compression failure.");
   }
   return Status::OK();
 }
 
+Status ZSTDCodec::MakeCompressor(std::shared_ptr<Compressor>* out) {
+  auto compressor = std::make_shared<ZSTDCompressor>(compression_level_);
+  RETURN_NOT_OK(compressor->Init());
+  *out = compressor;
+  return Status::OK();
+}
+
+Status ZSTDCodec::MakeDecompressor(std::shared_ptr<Decompressor>* out) {
+  auto decompressor = std::make_shared<ZSTDDecompressor>();
+  RETURN_NOT_OK(decompressor->Init());
+  *out = decompressor;
+  return Status::OK();
+}
+
 }  // namespace arrow
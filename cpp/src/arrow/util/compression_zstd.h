@@ -19,16 +19,23 @@
 #define ARROW_UTIL_COMPRESSION_ZSTD_H
 
 #include <cstdint>
+#include <memory>
 
 #include "arrow/status.h"
 #include "arrow/util/compression.h"
 #include "arrow/util/visibility.h"
 
+struct ZSTD_CCtx_s;
+struct ZSTD_DCtx_s;
+
 namespace arrow {
 
 // ZSTD codec.
 class ARROW_EXPORT ZSTDCodec : public Codec {
  public:
+  explicit ZSTDCodec(int compression_level = kUseDefaultCompressionLevel);
+  ~ZSTDCodec() override;
+
   Status Decompress(int64_t input_len, const uint8_t* input, int64_t output_len,
                     uint8_t* output_buffer) override;
 
@@ -37,7 +44,18 @@ class ARROW_EXPORT ZSTDCodec : public Codec {
 
   int64_t MaxCompressedLen(int64_t input_len, const uint8_t* input) override;
 
+  Status MakeCompressor(std::shared_ptr<Compressor>* out) override;
+
+  Status MakeDecompressor(std::shared_ptr<Decompressor>* out) override;
+
   const char* name() const override { return "zstd"; }
+
+ private:
+  int compression_level_;
+  // The contexts of one-shot calls, created on first use and kept for the
+  // next ones, so the codec is not thread-safe
+  ZSTD_CCtx_s* compress_context_;
+  ZSTD_DCtx_s* decompress_context_;
 };
 
 }  // namespace arrow
@@ -73,6 +73,8 @@ static struct {
     {"sse4_1", CpuInfo::SSE4_1},
     {"sse4_2", CpuInfo::SSE4_2},
     {"popcnt", CpuInfo::POPCNT},
+    {"avx2", CpuInfo::AVX2},
+    {"avx512f", CpuInfo::AVX512},
 };
 static const int64_t num_flags = sizeof(flag_mappings) / sizeof(flag_mappings[0]);
 
@@ -177,6 +179,16 @@ bool RetrieveCPUInfo(int64_t* hardware_flags, std::string* model_name) {
   if (features_ECX[19]) *hardware_flags |= CpuInfo::SSE4_1;
   if (features_ECX[20]) *hardware_flags |= CpuInfo::SSE4_2;
   if (features_ECX[23]) *hardware_flags |= CpuInfo::POPCNT;
+
+  // The extended features, usable only if the OS saves the registers they use
+  const bool os_saves_avx = features_ECX[27] && (_xgetbv(0) & 0x6) == 0x6;
+  const bool os_saves_avx512 = os_saves_avx && (_xgetbv(0) & 0xe0) == 0xe0;
+  if (highest_valid_id >= 7 && os_saves_avx) {
+    __cpuidex(cpu_info.data(), 7, 0);
+    std::bitset<32> features_EBX = cpu_info[1];
+    if (features_EBX[5]) *hardware_flags |= CpuInfo::AVX2;
+    if (features_EBX[16] && os_saves_avx512) *hardware_flags |= CpuInfo::AVX512;
+  }
   return true;
 }
 #endif
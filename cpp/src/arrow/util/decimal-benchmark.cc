@@ -17,6 +17,8 @@
 
 #include "benchmark/benchmark.h"
 
+#include <cstdint>
+#include <random>
 #include <string>
 #include <vector>
 
@@ -26,6 +28,34 @@
 namespace arrow {
 namespace Decimal {
 
+constexpr int64_t kDecimalBenchmarkLength = 1024;
+
+// Random values of at most precision digits, half of them negative
+static std::vector<Decimal128> MakeRandomDecimals(int64_t length, int32_t precision) {
+  std::mt19937_64 rng(42);
+  const int32_t low_digits = precision < 18 ? precision : 18;
+  uint64_t low_bound = 1;
+  for (int32_t i = 0; i < low_digits; ++i) {
+    low_bound *= 10;
+  }
+  Decimal128 high_bound = 1;
+  for (int32_t i = low_digits; i < precision; ++i) {
+    high_bound *= 10;
+  }
+
+  std::vector<Decimal128> values(length);
+  for (auto& value : values) {
+    Decimal128 high, remainder;
+    ARROW_UNUSED(Decimal128(0, rng()).Divide(high_bound, &high, &remainder));
+    value = remainder * Decimal128(static_cast<int64_t>(low_bound)) +
+            Decimal128(static_cast<int64_t>(rng() % low_bound));
+    if (rng() & 1) {
+      value.Negate();
+    }
+  }
+  return values;
+}
+
 static void BM_FromString(benchmark::State& state) {  // NOLINT non-const reference
   std::vector<std::string> values = {"0", "1.23", "12.345e6", "-12.345e-6"};
 
@@ -39,7 +69,92 @@ static void BM_FromString(benchmark::State& state) {  // NOLINT non-const refere
   state.SetItemsProcessed(state.iterations() * values.size());
 }
 
+// Strings of state.range(0) digits, two of them after the decimal point
+static void BM_FromStringPrecision(benchmark::State& state) {  // NOLINT non-const ref
+  const auto precision = static_cast<int32_t>(state.range(0));
+  std::vector<std::string> values;
+  for (const auto& value : MakeRandomDecimals(kDecimalBenchmarkLength, precision)) {
+    values.push_back(value.ToString(2));
+  }
+
+  while (state.KeepRunning()) {
+    for (const auto& value : values) {
+      Decimal128 dec;
+      ARROW_UNUSED(Decimal128::FromString(value.data(), value.size(), &dec));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+static void BM_ToString(benchmark::State& state) {  // NOLINT non-const reference
+  const auto precision = static_cast<int32_t>(state.range(0));
+  const auto values = MakeRandomDecimals(kDecimalBenchmarkLength, precision);
+  char buffer[Decimal128::kMaxStringLength];
+
+  while (state.KeepRunning()) {
+    for (const auto& value : values) {
+      benchmark::DoNotOptimize(value.ToString(2, buffer));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+// Products of two values of state.range(0) digits
+static void BM_Multiply(benchmark::State& state) {  // NOLINT non-const reference
+  const auto precision = static_cast<int32_t>(state.range(0));
+  const auto left = MakeRandomDecimals(kDecimalBenchmarkLength, precision);
+  const auto right = MakeRandomDecimals(kDecimalBenchmarkLength + 1, precision);
+
+  while (state.KeepRunning()) {
+    for (int64_t i = 0; i < kDecimalBenchmarkLength; ++i) {
+      benchmark::DoNotOptimize(left[i] * right[i + 1]);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kDecimalBenchmarkLength);
+}
+
+// Quotients of values of state.range(0) digits by divisors of state.range(1)
+// digits
+static void BM_Divide(benchmark::State& state) {  // NOLINT non-const reference
+  const auto dividends =
+      MakeRandomDecimals(kDecimalBenchmarkLength, static_cast<int32_t>(state.range(0)));
+  auto divisors =
+      MakeRandomDecimals(kDecimalBenchmarkLength, static_cast<int32_t>(state.range(1)));
+  for (auto& divisor : divisors) {
+    if (divisor == 0) {
+      divisor = 1;
+    }
+  }
+
+  while (state.KeepRunning()) {
+    for (int64_t i = 0; i < kDecimalBenchmarkLength; ++i) {
+      Decimal128 quotient, remainder;
+      ARROW_UNUSED(dividends[i].Divide(divisors[i], &quotient, &remainder));
+      benchmark::DoNotOptimize(quotient);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kDecimalBenchmarkLength);
+}
+
 BENCHMARK(BM_FromString)->Repetitions(3)->Unit(benchmark::kMicrosecond);
 
+// Values fitting in 32 bits, in 64 bits, and at the maximum precision
+BENCHMARK(BM_FromStringPrecision)
+    ->Arg(9)
+    ->Arg(18)
+    ->Arg(38)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_ToString)->Arg(9)->Arg(18)->Arg(38)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_Multiply)->Arg(9)->Arg(19)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_Divide)
+    ->Args({18, 9})
+    ->Args({38, 9})
+    ->Args({38, 19})
+    ->Args({38, 30})
+    ->Unit(benchmark::kMicrosecond);
+
 }  // namespace Decimal
 }  // namespace arrow
@@ -259,6 +259,17 @@ TEST(Decimal128Test, Division) {
   ASSERT_EQ(expected_value, result);
 }
 
+TEST(Decimal128Test, Multiplication) {
+  // Products whose middle 32-bit words carry
+  const Decimal128 ten_to_19("10000000000000000000");
+  ASSERT_EQ(Decimal128("-250000000000000000000"), Decimal128(-25) * ten_to_19);
+  ASSERT_EQ(Decimal128("250000000000000000000"), Decimal128(-25) * -ten_to_19);
+  const Decimal128 left("99999999999999999999");
+  const Decimal128 right("-99999999999999999");
+  ASSERT_EQ(Decimal128("-9999999999999999899900000000000000001"), left * right);
+  ASSERT_EQ(Decimal128("9999999999999999899900000000000000001"), -left * right);
+}
+
 TEST(Decimal128Test, PrintLargePositiveValue) {
   const std::string string_value("99999999999999999999999999999999999999");
   const Decimal128 value(string_value);
@@ -298,6 +309,10 @@ TEST_P(Decimal128PrintingTest, Print) {
   const Decimal128 value(test_value);
   const std::string printed_value = value.ToString(scale);
   ASSERT_EQ(expected_string, printed_value);
+
+  char buffer[Decimal128::kMaxStringLength];
+  const int32_t length = value.ToString(scale, buffer);
+  ASSERT_EQ(expected_string, std::string(buffer, length));
 }
 
 INSTANTIATE_TEST_CASE_P(Decimal128PrintingTest, Decimal128PrintingTest,
@@ -323,6 +338,13 @@ TEST_P(Decimal128ParsingTest, Parse) {
   ASSERT_OK(Decimal128::FromString(test_string, &value, NULLPTR, &scale));
   ASSERT_EQ(value.low_bits(), expected_low_bits);
   ASSERT_EQ(expected_scale, scale);
+
+  // From characters followed by others
+  const std::string padded = test_string + "99";
+  ASSERT_OK(Decimal128::FromString(padded.data(), test_string.size(), &value, NULLPTR,
+                                   &scale));
+  ASSERT_EQ(value.low_bits(), expected_low_bits);
+  ASSERT_EQ(expected_scale, scale);
 }
 
 INSTANTIATE_TEST_CASE_P(Decimal128ParsingTest, Decimal128ParsingTest,
@@ -380,6 +402,46 @@ TEST(Decimal128Test, TestNoDecimalPointExponential) {
   ASSERT_EQ(0, scale);
 }
 
+TEST(Decimal128Test, StringRoundtripAroundInt64Digits) {
+  // Values parsed and printed in 64 bits and in 128 bits
+  for (const std::string string_value :
+       {"0", "-1", "999999999999999999", "-999999999999999999", "1000000000000000000",
+        "9223372036854775807", "9223372036854775808", "-9223372036854775808",
+        "-9223372036854775809", "123456789012345678901234567890123456",
+        "1234567890123456789012345678901234567", "99999999999999999999999999999999999999",
+        "-170141183460469231731687303715884105728"}) {
+    Decimal128 value;
+    int32_t precision;
+    int32_t scale;
+    ASSERT_OK(Decimal128::FromString(string_value.data(), string_value.size(), &value,
+                                     &precision, &scale));
+    ASSERT_EQ(0, scale);
+    ASSERT_EQ(Decimal128(string_value), value);
+
+    char buffer[Decimal128::kMaxStringLength];
+    ASSERT_EQ(string_value, std::string(buffer, value.ToString(0, buffer)));
+    ASSERT_EQ(string_value, value.ToIntegerString());
+  }
+}
+
+TEST(Decimal128Test, StringRoundtripWithScale) {
+  for (const std::string string_value :
+       {"0.01", "-0.5", "12345678901234567.8", "-1234567890123456789.012345",
+        "0.00000000000000000000012345678901234567", "-99999999999999999999.999999"}) {
+    Decimal128 value;
+    int32_t precision;
+    int32_t scale;
+    ASSERT_OK(Decimal128::FromString(string_value.data(), string_value.size(), &value,
+                                     &precision, &scale));
+    char buffer[Decimal128::kMaxStringLength];
+    const std::string printed(buffer, value.ToString(scale, buffer));
+    ASSERT_EQ(value.ToString(scale), printed);
+    Decimal128 reparsed;
+    ASSERT_OK(Decimal128::FromString(printed, &reparsed));
+    ASSERT_EQ(value, reparsed);
+  }
+}
+
 TEST(Decimal128Test, TestFromBigEndian) {
   // We test out a variety of scenarios:
   //
@@ -96,47 +96,72 @@ void Decimal128::ToBytes(uint8_t* out) const {
   reinterpret_cast<int64_t*>(out)[1] = BitUtil::ToLittleEndian(high_bits_);
 }
 
-static constexpr Decimal128 kTenTo36(static_cast<int64_t>(0xC097CE7BC90715),
-                                     0xB34B9F1000000000);
 static constexpr Decimal128 kTenTo18(0xDE0B6B3A7640000);
 
-std::string Decimal128::ToIntegerString() const {
-  Decimal128 remainder;
-  std::stringstream buf;
-  bool need_fill = false;
+namespace {
 
-  // get anything above 10 ** 36 and print it
-  Decimal128 top;
-  Status s = Divide(kTenTo36, &top, &remainder);
-  DCHECK(s.ok()) << s.message();
+// The number of characters of the integer string of a Decimal128, with the
+// sign: 39 digits and a minus sign
+constexpr int32_t kMaxIntegerStringLength = 40;
 
-  if (top != 0) {
-    buf << static_cast<int64_t>(top);
-    remainder.Abs();
-    need_fill = true;
-  }
+// Write the digits of value backwards from end, padded with zeros to at least
+// min_digits, and return where they start
+inline char* FormatDigitsBackwards(uint64_t value, int min_digits, char* end) {
+  do {
+    *--end = static_cast<char>('0' + value % 10);
+    value /= 10;
+    --min_digits;
+  } while (value != 0 || min_digits > 0);
+  return end;
+}
+
+inline uint64_t UnsignedAbs(int64_t value) {
+  return value < 0 ? ~static_cast<uint64_t>(value) + 1 : static_cast<uint64_t>(value);
+}
 
-  // now get anything above 10 ** 18 and print it
-  Decimal128 tail;
-  s = remainder.Divide(kTenTo18, &top, &tail);
+// Write the integer string of value to out, and return its length
+int32_t FormatInteger(const Decimal128& value, char* out) {
+  char buffer[kMaxIntegerStringLength];
+  char* const end = buffer + kMaxIntegerStringLength;
+  char* start;
+  const auto low = static_cast<int64_t>(value.low_bits());
 
-  if (need_fill || top != 0) {
-    if (need_fill) {
-      buf << std::setw(18) << std::setfill('0');
+  if (value.high_bits() == (low < 0 ? -1 : 0)) {
+    // The value fits in 64 bits
+    start = FormatDigitsBackwards(UnsignedAbs(low), 1, end);
+  } else {
+    // Split the value into chunks of 18 digits. The quotients and remainders
+    // have the sign of the value, so that the smallest value needs no
+    // negation.
+    Decimal128 quotient, tail, head, middle;
+    Status s = value.Divide(kTenTo18, &quotient, &tail);
+    DCHECK(s.ok()) << s.message();
+    s = quotient.Divide(kTenTo18, &head, &middle);
+    DCHECK(s.ok()) << s.message();
+
+    start = FormatDigitsBackwards(UnsignedAbs(static_cast<int64_t>(tail)), 18, end);
+    if (head != 0) {
+      start = FormatDigitsBackwards(UnsignedAbs(static_cast<int64_t>(middle)), 18, start);
+      start = FormatDigitsBackwards(UnsignedAbs(static_cast<int64_t>(head)), 1, start);
     } else {
-      need_fill = true;
-      tail.Abs();
+      start = FormatDigitsBackwards(UnsignedAbs(static_cast<int64_t>(middle)), 1, start);
     }
-
-    buf << static_cast<int64_t>(top);
   }
-
-  // finally print the tail, which is less than 10**18
-  if (need_fill) {
-    buf << std::setw(18) << std::setfill('0');
+  if (value < 0) {
+    *--start = '-';
   }
-  buf << static_cast<int64_t>(tail);
-  return buf.str();
+  const auto length = static_cast<int32_t>(end - start);
+  std::memcpy(out, start, length);
+  return length;
+}
+
+}  // namespace
+
+constexpr int32_t Decimal128::kMaxStringLength;
+
+std::string Decimal128::ToIntegerString() const {
+  char buffer[kMaxIntegerStringLength];
+  return std::string(buffer, FormatInteger(*this, buffer));
 }
 
 Decimal128::operator int64_t() const {
@@ -147,64 +172,67 @@ Decimal128::operator int64_t() const {
   return static_cast<int64_t>(low_bits_);
 }
 
-static std::string ToStringNegativeScale(const std::string& str,
-                                         int32_t adjusted_exponent, bool is_negative) {
-  std::stringstream buf;
-
-  size_t offset = 0;
-  buf << str[offset++];
-
-  if (is_negative) {
-    buf << str[offset++];
-  }
-
-  buf << '.' << str.substr(offset, std::string::npos) << 'E' << std::showpos
-      << adjusted_exponent;
-  return buf.str();
+std::string Decimal128::ToString(int32_t scale) const {
+  char buffer[kMaxStringLength];
+  return std::string(buffer, ToString(scale, buffer));
 }
 
-std::string Decimal128::ToString(int32_t scale) const {
-  const std::string str(ToIntegerString());
+int32_t Decimal128::ToString(int32_t scale, char* out) const {
+  char str[kMaxIntegerStringLength];
+  const int32_t len = FormatInteger(*this, str);
 
   if (scale == 0) {
-    return str;
+    std::memcpy(out, str, len);
+    return len;
   }
 
-  const bool is_negative = *this < 0;
-
-  const auto len = static_cast<int32_t>(str.size());
+  const bool is_negative = str[0] == '-';
   const auto is_negative_offset = static_cast<int32_t>(is_negative);
   const int32_t adjusted_exponent = -scale + (len - 1 - is_negative_offset);
+  char* p = out;
 
   /// Note that the -6 is taken from the Java BigDecimal documentation.
   if (scale < 0 || adjusted_exponent < -6) {
-    return ToStringNegativeScale(str, adjusted_exponent, is_negative);
-  }
-
-  if (is_negative) {
-    if (len - 1 > scale) {
-      const auto n = static_cast<size_t>(len - scale);
-      return str.substr(0, n) + "." + str.substr(n, static_cast<size_t>(scale));
+    // As 1.2345E+2, keeping the digits of the integer string
+    int32_t offset = 0;
+    *p++ = str[offset++];
+    if (is_negative) {
+      *p++ = str[offset++];
     }
-
-    if (len - 1 == scale) {
-      return "-0." + str.substr(1, std::string::npos);
-    }
-
-    std::string result("-0." + std::string(static_cast<size_t>(scale - len + 1), '0'));
-    return result + str.substr(1, std::string::npos);
+    *p++ = '.';
+    std::memcpy(p, str + offset, len - offset);
+    p += len - offset;
+    *p++ = 'E';
+    *p++ = adjusted_exponent < 0 ? '-' : '+';
+    char exponent[16];
+    char* const exponent_end = exponent + sizeof(exponent);
+    const char* exponent_start =
+        FormatDigitsBackwards(UnsignedAbs(adjusted_exponent), 1, exponent_end);
+    std::memcpy(p, exponent_start, exponent_end - exponent_start);
+    p += exponent_end - exponent_start;
+    return static_cast<int32_t>(p - out);
   }
 
-  if (len > scale) {
-    const auto n = static_cast<size_t>(len - scale);
-    return str.substr(0, n) + "." + str.substr(n, static_cast<size_t>(scale));
-  }
-
-  if (len == scale) {
-    return "0." + str;
+  if (is_negative) {
+    *p++ = '-';
+  }
+  const char* digits = str + is_negative_offset;
+  const int32_t num_digits = len - is_negative_offset;
+  if (num_digits > scale) {
+    std::memcpy(p, digits, num_digits - scale);
+    p += num_digits - scale;
+    *p++ = '.';
+    std::memcpy(p, digits + num_digits - scale, scale);
+    p += scale;
+  } else {
+    *p++ = '0';
+    *p++ = '.';
+    std::memset(p, '0', scale - num_digits);
+    p += scale - num_digits;
+    std::memcpy(p, digits, num_digits);
+    p += num_digits;
   }
-
-  return "0." + std::string(static_cast<size_t>(scale - len), '0') + str;
+  return static_cast<int32_t>(p - out);
 }
 
 static constexpr auto kInt64DecimalDigits =
@@ -229,37 +257,37 @@ static constexpr int64_t kPowersOfTen[kInt64DecimalDigits + 1] = {1LL,
                                                                   100000000000000000LL,
                                                                   1000000000000000000LL};
 
-static void StringToInteger(const std::string& str, Decimal128* out) {
-  using std::size_t;
-
-  DCHECK_NE(out, nullptr) << "Decimal128 output variable cannot be nullptr";
-  DCHECK_EQ(*out, 0)
-      << "When converting a string to Decimal128 the initial output must be 0";
-
-  const size_t length = str.length();
+namespace {
 
-  DCHECK_GT(length, 0) << "length of parsed decimal string should be greater than 0";
+// The value of at most 18 digits
+inline uint64_t ParseDigits(const char* s, size_t length, uint64_t value = 0) {
+  for (size_t i = 0; i < length; ++i) {
+    value = value * 10 + static_cast<uint64_t>(s[i] - '0');
+  }
+  return value;
+}
 
+// Append the digits to out, as out * 10^length + digits, 18 at a time
+void ShiftAndAdd(const char* digits, size_t length, Decimal128* out) {
   for (size_t posn = 0; posn < length;) {
     const size_t group = std::min(kInt64DecimalDigits, length - posn);
-    const int64_t chunk = std::stoll(str.substr(posn, group));
-    const int64_t multiple = kPowersOfTen[group];
-
-    *out *= multiple;
-    *out += chunk;
-
+    *out *= kPowersOfTen[group];
+    *out += static_cast<int64_t>(ParseDigits(digits + posn, group));
     posn += group;
   }
 }
 
-namespace {
-
+// The parts of a decimal string, pointing into it
 struct DecimalComponents {
-  std::string sign;
-  std::string whole_digits;
-  std::string fractional_digits;
-  std::string exponent_sign;
-  std::string exponent_digits;
+  bool is_negative = false;
+  const char* whole_digits = NULLPTR;
+  size_t num_whole_digits = 0;
+  const char* fractional_digits = NULLPTR;
+  size_t num_fractional_digits = 0;
+  bool has_exponent = false;
+  bool is_negative_exponent = false;
+  const char* exponent_digits = NULLPTR;
+  size_t num_exponent_digits = 0;
 };
 
 inline bool IsSign(char c) { return c == '-' || c == '+'; }
@@ -270,14 +298,16 @@ inline bool IsDigit(char c) { return c >= '0' && c <= '9'; }
 
 inline bool StartsExponent(char c) { return c == 'e' || c == 'E'; }
 
-inline size_t ParseDigitsRun(const char* s, size_t start, size_t size, std::string* out) {
+inline size_t ParseDigitsRun(const char* s, size_t start, size_t size,
+                             const char** digits, size_t* num_digits) {
   size_t pos;
   for (pos = start; pos < size; ++pos) {
     if (!IsDigit(s[pos])) {
       break;
     }
   }
-  *out = std::string(s + start, pos - start);
+  *digits = s + start;
+  *num_digits = pos - start;
   return pos;
 }
 
@@ -289,22 +319,23 @@ bool ParseDecimalComponents(const char* s, size_t size, DecimalComponents* out)
   }
   // Sign of the number
   if (IsSign(s[pos])) {
-    out->sign = std::string(s + pos, 1);
+    out->is_negative = s[pos] == '-';
     ++pos;
   }
   // First run of digits
-  pos = ParseDigitsRun(s, pos, size, &out->whole_digits);
+  pos = ParseDigitsRun(s, pos, size, &out->whole_digits, &out->num_whole_digits);
   if (pos == size) {
-    return !out->whole_digits.empty();
+    return out->num_whole_digits != 0;
   }
   // Optional dot (if given in fractional form)
   bool has_dot = IsDot(s[pos]);
   if (has_dot) {
     // Second run of digits
     ++pos;
-    pos = ParseDigitsRun(s, pos, size, &out->fractional_digits);
+    pos = ParseDigitsRun(s, pos, size, &out->fractional_digits,
+                         &out->num_fractional_digits);
   }
-  if (out->whole_digits.empty() && out->fractional_digits.empty()) {
+  if (out->num_whole_digits == 0 && out->num_fractional_digits == 0) {
     // Need at least some digits (whole or fractional)
     return false;
   }
@@ -317,13 +348,15 @@ bool ParseDecimalComponents(const char* s, size_t size, DecimalComponents* out)
     if (pos == size) {
       return false;
     }
+    out->has_exponent = true;
     // Optional exponent sign
     if (IsSign(s[pos])) {
-      out->exponent_sign = std::string(s + pos, 1);
+      out->is_negative_exponent = s[pos] == '-';
       ++pos;
     }
-    pos = ParseDigitsRun(s, pos, size, &out->exponent_digits);
-    if (out->exponent_digits.empty()) {
+    pos = ParseDigitsRun(s, pos, size, &out->exponent_digits,
+                         &out->num_exponent_digits);
+    if (out->num_exponent_digits == 0) {
       // Need some exponent digits
       return false;
     }
@@ -331,47 +364,76 @@ bool ParseDecimalComponents(const char* s, size_t size, DecimalComponents* out)
   return pos == size;
 }
 
+// The value of the exponent digits, false if it doesn't fit in an int32_t
+bool ParseExponent(const DecimalComponents& dec, int32_t* out) {
+  int64_t value = 0;
+  for (size_t i = 0; i < dec.num_exponent_digits; ++i) {
+    value = value * 10 + (dec.exponent_digits[i] - '0');
+    if (value > std::numeric_limits<int32_t>::max()) {
+      return false;
+    }
+  }
+  *out = static_cast<int32_t>(dec.is_negative_exponent ? -value : value);
+  return true;
+}
+
 }  // namespace
 
 Status Decimal128::FromString(const std::string& s, Decimal128* out, int32_t* precision,
                               int32_t* scale) {
-  if (s.empty()) {
+  return FromString(s.data(), s.size(), out, precision, scale);
+}
+
+Status Decimal128::FromString(const char* s, size_t length, Decimal128* out,
+                              int32_t* precision, int32_t* scale) {
+  if (length == 0) {
     return Status::Invalid("Empty string cannot be converted to decimal");
   }
 
   DecimalComponents dec;
-  if (!ParseDecimalComponents(s.data(), s.size(), &dec)) {
+  int32_t exponent = 0;
+  if (!ParseDecimalComponents(s, length, &dec) ||
+      (dec.has_exponent && !ParseExponent(dec, &exponent))) {
     std::stringstream ss;
-    ss << "The string '" << s << "' is not a valid decimal number";
+    ss << "The string '" << std::string(s, length) << "' is not a valid decimal number";
     return Status::Invalid(ss.str());
   }
-  std::string exponent_value = dec.exponent_sign + dec.exponent_digits;
 
   // Count number of significant digits (without leading zeros)
-  size_t first_non_zero = dec.whole_digits.find_first_not_of('0');
-  size_t significant_digits = dec.fractional_digits.size();
-  if (first_non_zero != std::string::npos) {
-    significant_digits += dec.whole_digits.size() - first_non_zero;
+  size_t leading_zeros = 0;
+  while (leading_zeros < dec.num_whole_digits &&
+         dec.whole_digits[leading_zeros] == '0') {
+    ++leading_zeros;
   }
+  const size_t significant_digits =
+      dec.num_fractional_digits + dec.num_whole_digits - leading_zeros;
 
   if (precision != nullptr) {
     *precision = static_cast<int32_t>(significant_digits);
   }
 
   if (scale != nullptr) {
-    if (!exponent_value.empty()) {
-      auto adjusted_exponent = static_cast<int32_t>(std::stol(exponent_value));
+    if (dec.has_exponent) {
       auto len = static_cast<int32_t>(significant_digits);
-      *scale = -adjusted_exponent + len - 1;
+      *scale = -exponent + len - 1;
     } else {
-      *scale = static_cast<int32_t>(dec.fractional_digits.size());
+      *scale = static_cast<int32_t>(dec.num_fractional_digits);
     }
   }
 
   if (out != nullptr) {
-    *out = 0;
-    StringToInteger(dec.whole_digits + dec.fractional_digits, out);
-    if (dec.sign == "-") {
+    if (dec.num_whole_digits + dec.num_fractional_digits <= kInt64DecimalDigits) {
+      // The digits fit in 64 bits
+      const uint64_t value =
+          ParseDigits(dec.fractional_digits, dec.num_fractional_digits,
+                      ParseDigits(dec.whole_digits, dec.num_whole_digits));
+      *out = static_cast<int64_t>(value);
+    } else {
+      *out = 0;
+      ShiftAndAdd(dec.whole_digits, dec.num_whole_digits, out);
+      ShiftAndAdd(dec.fractional_digits, dec.num_fractional_digits, out);
+    }
+    if (dec.is_negative) {
       out->Negate();
     }
 
@@ -500,9 +562,6 @@ Decimal128& Decimal128::operator*=(const Decimal128& right) {
   low_bits_ += sum << 32;
 
   high_bits_ = static_cast<int64_t>(sum < product ? kCarryBit : 0);
-  if (sum < product) {
-    high_bits_ += kCarryBit;
-  }
 
   high_bits_ += static_cast<int64_t>(sum >> 32);
   high_bits_ += L1 * R3 + L2 * R2 + L3 * R1;
@@ -38,6 +38,9 @@ namespace arrow {
 /// Adapted from the Apache ORC C++ implementation
 class ARROW_EXPORT Decimal128 {
  public:
+  /// \brief The largest number of characters written by ToString(scale, out)
+  static constexpr int32_t kMaxStringLength = 64;
+
   /// \brief Create an Decimal128 from the two's complement representation.
   constexpr Decimal128(int64_t high, uint64_t low) noexcept
       : high_bits_(high), low_bits_(low) {}
@@ -115,6 +118,14 @@ class ARROW_EXPORT Decimal128 {
   /// scale.
   std::string ToString(int32_t scale) const;
 
+  /// \brief Like ToString(scale), writing the string to a caller buffer
+  ///
+  /// Converts without allocating, as when formatting many values.
+  /// \param scale the scale of the value
+  /// \param out where to write the string, of at least kMaxStringLength chars
+  /// \return the length of the string, which isn't null-terminated
+  int32_t ToString(int32_t scale, char* out) const;
+
   /// \brief Convert the value to an integer string
   std::string ToIntegerString() const;
 
@@ -126,6 +137,13 @@ class ARROW_EXPORT Decimal128 {
   static Status FromString(const std::string& s, Decimal128* out,
                            int32_t* precision = NULLPTR, int32_t* scale = NULLPTR);
 
+  /// \brief Like FromString(s, ...), from the length characters at s
+  ///
+  /// Converts without allocating, as when parsing many values. Values of up
+  /// to 18 digits are parsed in 64 bits.
+  static Status FromString(const char* s, size_t length, Decimal128* out,
+                           int32_t* precision = NULLPTR, int32_t* scale = NULLPTR);
+
   /// \brief Convert from a big endian byte representation. The length must be
   ///        between 1 and 16
   /// \return error status if the length is an invalid value
@@ -0,0 +1,198 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/status.h"
+#include "arrow/test-util.h"
+#include "arrow/util/future.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/thread-pool.h"
+
+namespace arrow {
+
+using internal::ThreadPool;
+
+static std::shared_ptr<ThreadPool> MakeThreadPool(int threads) {
+  std::shared_ptr<ThreadPool> pool;
+  ARROW_CHECK_OK(ThreadPool::Make(threads, &pool));
+  return pool;
+}
+
+TEST(TestFuture, MarkFinished) {
+  auto future = Future<int>::Make();
+  ASSERT_TRUE(future.is_valid());
+  ASSERT_FALSE(future.is_finished());
+  std::thread thread([future]() mutable { future.MarkFinished(42); });
+  int value = 0;
+  ASSERT_OK(future.Get(&value));
+  ASSERT_EQ(42, value);
+  ASSERT_TRUE(future.is_finished());
+  thread.join();
+
+  auto failed = Future<int>::MakeFinished(Status::IOError("read failed"));
+  ASSERT_RAISES(IOError, failed.Wait());
+  value = 0;
+  ASSERT_RAISES(IOError, failed.Get(&value));
+  ASSERT_EQ(0, value);
+
+  ASSERT_OK(Future<>::MakeFinished().Wait());
+  ASSERT_FALSE(Future<int>().is_valid());
+}
+
+TEST(TestFuture, Callbacks) {
+  auto future = Future<std::string>::Make();
+  std::vector<std::string> seen;
+  future.AddCallback([&seen](const Status& status, const std::string& value) {
+    seen.push_back(value);
+  });
+  ASSERT_TRUE(seen.empty());
+  future.MarkFinished("a");
+  ASSERT_EQ(std::vector<std::string>{"a"}, seen);
+
+  // Once finished, callbacks run at once
+  future.AddCallback([&seen](const Status& status, const std::string& value) {
+    seen.push_back(value + "b");
+  });
+  ASSERT_EQ(std::vector<std::string>({"a", "ab"}), seen);
+}
+
+TEST(TestFuture, Then) {
+  auto future = Future<int>::Make();
+  auto doubled = future.Then([](int x) { return 2 * x; });
+  auto described = doubled.Then([](int x) { return std::to_string(x); });
+  auto checked = described.Then([](const std::string& s) {
+    return s == "42" ? Status::OK() : Status::Invalid("got " + s);
+  });
+  auto async = checked.Then([]() { return Future<int>::MakeFinished(7); });
+  future.MarkFinished(21);
+
+  std::string description;
+  ASSERT_OK(described.Get(&description));
+  ASSERT_EQ("42", description);
+  ASSERT_OK(checked.Wait());
+  int value;
+  ASSERT_OK(async.Get(&value));
+  ASSERT_EQ(7, value);
+}
+
+TEST(TestFuture, ThenPropagatesErrors) {
+  auto future = Future<int>::Make();
+  std::atomic<int> calls(0);
+  auto next = future
+                  .Then([&calls](int x) {
+                    ++calls;
+                    return x;
+                  })
+                  .Then([&calls](int x) {
+                    ++calls;
+                    return Status::OK();
+                  });
+  future.MarkFinished(Status::IOError("corrupt"));
+  ASSERT_RAISES(IOError, next.Wait());
+  ASSERT_EQ(0, calls);
+
+  auto failing = Future<int>::MakeFinished(1).Then(
+      [](int) { return Future<int>::MakeFinished(Status::Invalid("bad")); });
+  ASSERT_RAISES(Invalid, failing.Wait());
+}
+
+TEST(TestFuture, Executor) {
+  auto pool = MakeThreadPool(2);
+  auto future = Future<int>::Make();
+  const auto this_thread = std::this_thread::get_id();
+  std::atomic<bool> on_pool(false);
+  auto next = future.Then(
+      [&](int x) {
+        on_pool = std::this_thread::get_id() != this_thread;
+        return x + 1;
+      },
+      pool.get());
+  future.MarkFinished(1);
+  int value;
+  ASSERT_OK(next.Get(&value));
+  ASSERT_EQ(2, value);
+  ASSERT_TRUE(on_pool);
+
+  auto async = RunAsync(pool.get(), [] {
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    return 3;
+  });
+  ASSERT_OK(async.Get(&value));
+  ASSERT_EQ(3, value);
+
+  // Callbacks that can't go to the pool run inline
+  ASSERT_OK(pool->Shutdown());
+  ASSERT_RAISES(Invalid, RunAsync(pool.get(), [] { return 1; }).Wait());
+  auto inline_next =
+      Future<int>::MakeFinished(5).Then([](int x) { return x; }, pool.get());
+  ASSERT_OK(inline_next.Get(&value));
+  ASSERT_EQ(5, value);
+}
+
+TEST(TestFuture, All) {
+  auto pool = MakeThreadPool(4);
+  std::vector<Future<int>> futures;
+  for (int i = 0; i < 20; ++i) {
+    futures.push_back(RunAsync(pool.get(), [i] {
+      std::this_thread::sleep_for(std::chrono::milliseconds(20 - i));
+      return i * i;
+    }));
+  }
+  std::vector<int> values;
+  ASSERT_OK(All(futures).Get(&values));
+  ASSERT_EQ(20, values.size());
+  for (int i = 0; i < 20; ++i) {
+    ASSERT_EQ(i * i, values[i]);
+  }
+
+  std::vector<Future<int>> some_fail = {Future<int>::Make(),
+                                        Future<int>::MakeFinished(Status::IOError("x"))};
+  // Fails without waiting for the unfinished future
+  ASSERT_RAISES(IOError, All(some_fail).Wait());
+  some_fail[0].MarkFinished(1);
+
+  ASSERT_OK(All(std::vector<Future<int>>()).Get(&values));
+  ASSERT_TRUE(values.empty());
+}
+
+TEST(TestFuture, Any) {
+  std::vector<Future<int>> futures = {Future<int>::Make(), Future<int>::Make(),
+                                      Future<int>::Make()};
+  auto any = Any(futures);
+  futures[1].MarkFinished(Status::IOError("x"));
+  ASSERT_FALSE(any.is_finished());
+  futures[2].MarkFinished(2);
+  int value;
+  ASSERT_OK(any.Get(&value));
+  ASSERT_EQ(2, value);
+  futures[0].MarkFinished(0);
+
+  std::vector<Future<int>> all_fail = {Future<int>::MakeFinished(Status::IOError("x")),
+                                       Future<int>::MakeFinished(Status::Invalid("y"))};
+  ASSERT_RAISES(IOError, Any(all_fail).Wait());
+  ASSERT_RAISES(Invalid, Any(std::vector<Future<int>>()).Wait());
+}
+
+}  // namespace arrow
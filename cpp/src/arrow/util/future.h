@@ -0,0 +1,404 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_UTIL_FUTURE_H
+#define ARROW_UTIL_FUTURE_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/thread-pool.h"
+
+namespace arrow {
+
+template <typename T>
+class Future;
+
+namespace detail {
+
+// The value of a future that only reports success or failure
+struct Empty {};
+
+template <typename T>
+struct FutureState {
+  using Callback = std::function<void(const Status&, const T&)>;
+
+  struct CallbackRecord {
+    Callback callback;
+    internal::ThreadPool* executor;
+  };
+
+  FutureState() : finished(false) {}
+
+  std::mutex mutex;
+  std::condition_variable cv;
+  bool finished;
+  // Immutable once finished
+  Status status;
+  T value;
+  std::vector<CallbackRecord> callbacks;
+};
+
+// Calling a continuation with the value of a future, if it has one
+template <typename T>
+struct ContinuationCall {
+  template <typename Function>
+  using Result = typename std::result_of<Function && (const T&)>::type;
+
+  template <typename Function>
+  static Result<Function> Call(Function& func, const T& value) {
+    return func(value);
+  }
+};
+
+template <>
+struct ContinuationCall<Empty> {
+  template <typename Function>
+  using Result = typename std::result_of<Function && ()>::type;
+
+  template <typename Function>
+  static Result<Function> Call(Function& func, const Empty&) {
+    return func();
+  }
+};
+
+// Finishing a future with the result of a continuation: a value, a Status,
+// or another future to wait for
+template <typename R>
+struct ContinuationResult {
+  using FutureType = Future<R>;
+
+  static void Finish(R result, FutureType* out) { out->MarkFinished(std::move(result)); }
+};
+
+template <>
+struct ContinuationResult<Status> {
+  using FutureType = Future<Empty>;
+
+  static inline void Finish(Status result, FutureType* out);
+};
+
+template <typename U>
+struct ContinuationResult<Future<U>> {
+  using FutureType = Future<U>;
+
+  static void Finish(Future<U> result, FutureType* out) {
+    FutureType next = *out;
+    result.AddCallback([next](const Status& status, const U& value) mutable {
+      if (status.ok()) {
+        next.MarkFinished(value);
+      } else {
+        next.MarkFinished(status);
+      }
+    });
+  }
+};
+
+}  // namespace detail
+
+/// \brief The result of an asynchronous computation: a Status and, on
+/// success, a value of type T, available once the future is finished
+///
+/// Futures are cheap to copy, the copies sharing the result. Besides being
+/// waited for, they can be given callbacks and continuations to run once
+/// they finish, inline or on a thread pool, so that computations can be
+/// chained without blocking a thread on each step. T must be default
+/// constructible; Future<> only reports success or failure.
+template <typename T = detail::Empty>
+class Future {
+ public:
+  using ValueType = T;
+  using State = detail::FutureState<T>;
+
+  /// \brief An invalid future, to be assigned a valid one
+  Future() = default;
+
+  /// \brief Make an unfinished future, to be finished with MarkFinished
+  static Future Make() { return Future(std::make_shared<State>()); }
+
+  /// \brief Make a future already finished with a value
+  static Future MakeFinished(T value = T()) {
+    Future future = Make();
+    future.MarkFinished(std::move(value));
+    return future;
+  }
+
+  /// \brief Make a future already finished with a status
+  static Future MakeFinished(const Status& status) {
+    Future future = Make();
+    future.MarkFinished(status);
+    return future;
+  }
+
+  bool is_valid() const { return state_ != NULLPTR; }
+
+  /// \brief Finish the future successfully with a value
+  void MarkFinished(T value = T()) { Finish(Status::OK(), std::move(value)); }
+
+  /// \brief Finish the future with a status, normally an error
+  void MarkFinished(const Status& status) { Finish(status, T()); }
+
+  bool is_finished() const {
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    return state_->finished;
+  }
+
+  /// \brief Wait for the future to finish and return its status
+  Status Wait() const {
+    std::unique_lock<std::mutex> lock(state_->mutex);
+    state_->cv.wait(lock, [this] { return state_->finished; });
+    return state_->status;
+  }
+
+  /// \brief Wait for the future to finish and get its value
+  ///
+  /// \return the status of the future, out being set only if it's OK
+  Status Get(T* out) const {
+    RETURN_NOT_OK(Wait());
+    *out = state_->value;
+    return Status::OK();
+  }
+
+  /// \brief Call a callback with the status and value once the future has
+  /// finished, or now if it has
+  ///
+  /// \param[in] callback a `void(const Status&, const T&)` callable
+  /// \param[in] executor the thread pool to run the callback on, or null to
+  /// run it in the thread finishing the future. A callback that can't be
+  /// spawned, because the thread pool is shutting down, is run there too.
+  template <typename Callback>
+  void AddCallback(Callback&& callback, internal::ThreadPool* executor = NULLPTR) const {
+    typename State::CallbackRecord record{std::forward<Callback>(callback), executor};
+    {
+      std::lock_guard<std::mutex> lock(state_->mutex);
+      if (!state_->finished) {
+        state_->callbacks.push_back(std::move(record));
+        return;
+      }
+    }
+    RunCallback(state_, std::move(record));
+  }
+
+  /// \brief Chain a continuation to run on the value once the future has
+  /// succeeded
+  ///
+  /// The continuation takes the value, or nothing for Future<>. What it
+  /// returns finishes the future returned: a value of type U a Future<U>, a
+  /// Status a Future<>, and a Future<U> a Future<U> once it has finished
+  /// itself. If this future fails, the continuation isn't called and the
+  /// returned future fails with the same status.
+  ///
+  /// \param[in] func the continuation
+  /// \param[in] executor the thread pool to run the continuation on, or null
+  /// to run it in the thread finishing this future
+  template <typename Function,
+            typename Call = detail::ContinuationCall<T>,
+            typename Result = typename std::decay<
+                typename Call::template Result<Function>>::type,
+            typename Next = typename detail::ContinuationResult<Result>::FutureType>
+  Next Then(Function&& func, internal::ThreadPool* executor = NULLPTR) const {
+    Next next = Next::Make();
+    using Callable = typename std::decay<Function>::type;
+    Callable continuation(std::forward<Function>(func));
+    AddCallback(
+        [next, continuation](const Status& status, const T& value) mutable {
+          if (!status.ok()) {
+            next.MarkFinished(status);
+            return;
+          }
+          detail::ContinuationResult<Result>::Finish(Call::Call(continuation, value),
+                                                     &next);
+        },
+        executor);
+    return next;
+  }
+
+ private:
+  template <typename U>
+  friend class Future;
+
+  explicit Future(std::shared_ptr<State> state) : state_(std::move(state)) {}
+
+  void Finish(const Status& status, T&& value) {
+    std::vector<typename State::CallbackRecord> callbacks;
+    {
+      std::lock_guard<std::mutex> lock(state_->mutex);
+      DCHECK(!state_->finished) << "Future finished twice";
+      state_->status = status;
+      state_->value = std::move(value);
+      state_->finished = true;
+      callbacks.swap(state_->callbacks);
+    }
+    state_->cv.notify_all();
+    for (auto& record : callbacks) {
+      RunCallback(state_, std::move(record));
+    }
+  }
+
+  static void RunCallback(const std::shared_ptr<State>& state,
+                          typename State::CallbackRecord&& record) {
+    if (record.executor != NULLPTR) {
+      // Kept to run inline if it can't be spawned
+      auto callback =
+          std::make_shared<typename State::Callback>(std::move(record.callback));
+      Status spawned = record.executor->Spawn(
+          [state, callback] { (*callback)(state->status, state->value); });
+      if (spawned.ok()) {
+        return;
+      }
+      record.callback = std::move(*callback);
+    }
+    record.callback(state->status, state->value);
+  }
+
+  std::shared_ptr<State> state_;
+};
+
+namespace detail {
+
+void ContinuationResult<Status>::Finish(Status result, Future<Empty>* out) {
+  if (result.ok()) {
+    out->MarkFinished();
+  } else {
+    out->MarkFinished(result);
+  }
+}
+
+}  // namespace detail
+
+/// \brief A future of the values of all the futures, failing with the first
+/// of them to fail
+template <typename T>
+Future<std::vector<T>> All(const std::vector<Future<T>>& futures) {
+  struct AllState {
+    explicit AllState(size_t n) : values(n), remaining(n) {}
+
+    std::mutex mutex;
+    std::vector<T> values;
+    size_t remaining;
+  };
+
+  auto out = Future<std::vector<T>>::Make();
+  if (futures.empty()) {
+    out.MarkFinished();
+    return out;
+  }
+  auto state = std::make_shared<AllState>(futures.size());
+  for (size_t i = 0; i < futures.size(); ++i) {
+    futures[i].AddCallback([out, state, i](const Status& status, const T& value) mutable {
+      std::unique_lock<std::mutex> lock(state->mutex);
+      if (state->remaining == 0) {
+        // Already failed
+        return;
+      }
+      if (!status.ok()) {
+        state->remaining = 0;
+        lock.unlock();
+        out.MarkFinished(status);
+        return;
+      }
+      state->values[i] = value;
+      if (--state->remaining == 0) {
+        std::vector<T> values = std::move(state->values);
+        lock.unlock();
+        out.MarkFinished(std::move(values));
+      }
+    });
+  }
+  return out;
+}
+
+/// \brief A future of the value of the first of the futures to succeed, or
+/// of the first error if they all fail
+template <typename T>
+Future<T> Any(const std::vector<Future<T>>& futures) {
+  struct AnyState {
+    explicit AnyState(size_t n) : remaining(n), finished(false) {}
+
+    std::mutex mutex;
+    size_t remaining;
+    bool finished;
+    Status first_error;
+  };
+
+  auto out = Future<T>::Make();
+  if (futures.empty()) {
+    out.MarkFinished(Status::Invalid("Any() of no futures"));
+    return out;
+  }
+  auto state = std::make_shared<AnyState>(futures.size());
+  for (const auto& future : futures) {
+    future.AddCallback([out, state](const Status& status, const T& value) mutable {
+      std::unique_lock<std::mutex> lock(state->mutex);
+      --state->remaining;
+      if (state->finished) {
+        return;
+      }
+      if (status.ok()) {
+        state->finished = true;
+        lock.unlock();
+        out.MarkFinished(value);
+        return;
+      }
+      if (state->first_error.ok()) {
+        state->first_error = status;
+      }
+      if (state->remaining == 0) {
+        state->finished = true;
+        const Status error = state->first_error;
+        lock.unlock();
+        out.MarkFinished(error);
+      }
+    });
+  }
+  return out;
+}
+
+/// \brief Run a function on a thread pool, returning a future of its result
+///
+/// The function takes no arguments, and what it returns finishes the
+/// future as with Future::Then(). If the function can't be spawned, the
+/// future fails with the reason.
+template <typename Function,
+          typename Result = typename std::decay<
+              typename detail::ContinuationCall<detail::Empty>::Result<Function>>::type,
+          typename Next = typename detail::ContinuationResult<Result>::FutureType>
+Next RunAsync(internal::ThreadPool* executor, Function&& func) {
+  Next next = Next::Make();
+  using Callable = typename std::decay<Function>::type;
+  Callable callable(std::forward<Function>(func));
+  Status spawned = executor->Spawn([next, callable]() mutable {
+    detail::ContinuationResult<Result>::Finish(callable(), &next);
+  });
+  if (!spawned.ok()) {
+    next.MarkFinished(spawned);
+  }
+  return next;
+}
+
+}  // namespace arrow
+
+#endif  // ARROW_UTIL_FUTURE_H
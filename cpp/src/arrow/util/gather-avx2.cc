@@ -0,0 +1,62 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// This file is compiled with -mavx2, its functions must only be called when
+// the CPU supports AVX2
+
+#include "arrow/util/gather-avx2.h"
+
+#include <immintrin.h>
+#include <cstring>
+
+namespace arrow {
+namespace internal {
+
+void GatherStrided32Avx2(const uint8_t* data, int32_t stride, int64_t length,
+                         uint32_t* out) {
+  const __m256i offsets = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7),
+                                             _mm256_set1_epi32(stride));
+  const int64_t step = 8 * static_cast<int64_t>(stride);
+  int64_t i = 0;
+  for (; i + 8 <= length; i += 8, data += step) {
+    const int* base = reinterpret_cast<const int*>(data);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i),
+                        _mm256_i32gather_epi32(base, offsets, 1));
+  }
+  for (; i < length; ++i, data += stride) {
+    memcpy(out + i, data, sizeof(uint32_t));
+  }
+}
+
+void GatherStrided64Avx2(const uint8_t* data, int32_t stride, int64_t length,
+                         uint64_t* out) {
+  const __m128i offsets =
+      _mm_mullo_epi32(_mm_setr_epi32(0, 1, 2, 3), _mm_set1_epi32(stride));
+  const int64_t step = 4 * static_cast<int64_t>(stride);
+  int64_t i = 0;
+  for (; i + 4 <= length; i += 4, data += step) {
+    const long long* base = reinterpret_cast<const long long*>(data);  // NOLINT
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i),
+                        _mm256_i32gather_epi64(base, offsets, 1));
+  }
+  for (; i < length; ++i, data += stride) {
+    memcpy(out + i, data, sizeof(uint64_t));
+  }
+}
+
+}  // namespace internal
+}  // namespace arrow
@@ -0,0 +1,41 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Strided gathers with AVX2, only to be called when the CPU supports AVX2
+
+#ifndef ARROW_UTIL_GATHER_AVX2_H
+#define ARROW_UTIL_GATHER_AVX2_H
+
+#include <cstdint>
+
+namespace arrow {
+namespace internal {
+
+// Gather the 4-byte values at data + i * stride into out[i], for i below
+// length. 8 * stride must fit in an int32_t
+void GatherStrided32Avx2(const uint8_t* data, int32_t stride, int64_t length,
+                         uint32_t* out);
+
+// Gather the 8-byte values at data + i * stride into out[i], for i below
+// length. 4 * stride must fit in an int32_t
+void GatherStrided64Avx2(const uint8_t* data, int32_t stride, int64_t length,
+                         uint64_t* out);
+
+}  // namespace internal
+}  // namespace arrow
+
+#endif  // ARROW_UTIL_GATHER_AVX2_H
@@ -0,0 +1,124 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/memory_pool.h"
+#include "arrow/status.h"
+#include "arrow/test-util.h"
+#include "arrow/util/hash-util.h"
+#include "arrow/util/hash.h"
+
+namespace arrow {
+namespace internal {
+
+// Memoize values in a vector and look them up through the table
+class ValueMemo {
+ public:
+  ValueMemo() : table_(default_memory_pool()) {}
+
+  Status Init(int64_t capacity) { return table_.Init(capacity); }
+
+  Status GetOrInsert(int64_t value, uint32_t hash, int32_t* memo_index) {
+    int64_t pos;
+    auto equal = [&](int32_t index) { return values_[index] == value; };
+    *memo_index = table_.Find(hash, equal, &pos);
+    if (*memo_index == GroupHashTable::kNotFound) {
+      *memo_index = static_cast<int32_t>(values_.size());
+      values_.push_back(value);
+      return table_.Insert(pos, hash, *memo_index);
+    }
+    return Status::OK();
+  }
+
+  const GroupHashTable& table() const { return table_; }
+
+ private:
+  GroupHashTable table_;
+  std::vector<int64_t> values_;
+};
+
+uint32_t HashInt(int64_t value) { return HashUtil::Hash(&value, sizeof(value), 0); }
+
+TEST(GroupHashTable, FindAndGrow) {
+  ValueMemo memo;
+  ASSERT_OK(memo.Init(32));
+  ASSERT_EQ(32, memo.table().capacity());
+
+  const int64_t kNumValues = 10000;
+  int32_t memo_index;
+  for (int64_t i = 0; i < kNumValues; ++i) {
+    ASSERT_OK(memo.GetOrInsert(i * 7, HashInt(i * 7), &memo_index));
+    ASSERT_EQ(i, memo_index);
+  }
+  ASSERT_EQ(kNumValues, memo.table().size());
+  ASSERT_GE(memo.table().capacity(), kNumValues);
+
+  // All values are still found after the table grew
+  for (int64_t i = kNumValues - 1; i >= 0; --i) {
+    ASSERT_OK(memo.GetOrInsert(i * 7, HashInt(i * 7), &memo_index));
+    ASSERT_EQ(i, memo_index);
+  }
+  ASSERT_EQ(kNumValues, memo.table().size());
+}
+
+TEST(GroupHashTable, HashCollisions) {
+  // Values with equal hashes are told apart by the equality callable, and
+  // probing carries on across groups
+  ValueMemo memo;
+  ASSERT_OK(memo.Init(16));
+
+  const int64_t kNumValues = 100;
+  int32_t memo_index;
+  for (int64_t i = 0; i < kNumValues; ++i) {
+    const uint32_t hash = (i % 2 == 0) ? 42 : 0xFFFFFFFF;
+    ASSERT_OK(memo.GetOrInsert(i, hash, &memo_index));
+    ASSERT_EQ(i, memo_index);
+  }
+  for (int64_t i = 0; i < kNumValues; ++i) {
+    const uint32_t hash = (i % 2 == 0) ? 42 : 0xFFFFFFFF;
+    ASSERT_OK(memo.GetOrInsert(i, hash, &memo_index));
+    ASSERT_EQ(i, memo_index);
+  }
+  ASSERT_EQ(kNumValues, memo.table().size());
+}
+
+TEST(HashUtil, Crc32c) {
+  // The check value of CRC32C
+  const char* digits = "123456789";
+  ASSERT_EQ(0xE3069283, HashUtil::Crc32c(digits, 9, 0));
+  ASSERT_EQ(0, HashUtil::Crc32c(digits, 0, 0));
+
+  // Checksums in pieces of any alignment are those of the whole
+  std::vector<uint8_t> data(1000);
+  test::random_bytes(1000, 0, data.data());
+  const uint32_t whole = HashUtil::Crc32c(data.data(), 1000, 0);
+  for (int64_t split : {1, 7, 8, 333, 999}) {
+    uint32_t crc = HashUtil::Crc32c(data.data(), split, 0);
+    crc = HashUtil::Crc32c(data.data() + split, 1000 - split, crc);
+    ASSERT_EQ(whole, crc) << "split at " << split;
+  }
+
+  data[500] ^= 1;
+  ASSERT_NE(whole, HashUtil::Crc32c(data.data(), 1000, 0));
+}
+
+}  // namespace internal
+}  // namespace arrow
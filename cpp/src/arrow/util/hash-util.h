@@ -21,6 +21,7 @@
 #define ARROW_UTIL_HASH_UTIL_H
 
 #include <cstdint>
+#include <cstring>
 
 #include "arrow/util/cpu-info.h"
 #include "arrow/util/logging.h"
@@ -120,6 +121,45 @@ class HashUtil {
     return hash;
   }
 
+  /// Compute the CRC32C (Castagnoli) checksum of data, continuing the
+  /// checksum crc of the data before it, 0 to start. Unlike CrcHash, this is
+  /// the standard checksum, so that data checksummed in pieces gets that of
+  /// the whole. Uses SSE4.2 when built with ARROW_USE_SSE and supported by
+  /// the CPU, tables otherwise.
+  static uint32_t Crc32c(const void* data, int64_t bytes, uint32_t crc) {
+    crc = ~crc;
+    const uint8_t* s = reinterpret_cast<const uint8_t*>(data);
+#ifdef ARROW_USE_SSE
+    if (ARROW_PREDICT_TRUE(CpuInfo::IsSupported(CpuInfo::SSE4_2))) {
+      for (; bytes >= 8; bytes -= 8, s += 8) {
+        uint64_t word;
+        memcpy(&word, s, sizeof(word));
+        crc = static_cast<uint32_t>(SSE4_crc32_u64(crc, word));
+      }
+      for (; bytes > 0; --bytes, ++s) {
+        crc = SSE4_crc32_u8(crc, *s);
+      }
+      return ~crc;
+    }
+#endif
+    // Slicing by 8: a word at a time through 8 tables
+    const Crc32cTables& tables = GetCrc32cTables();
+    for (; bytes >= 8; bytes -= 8, s += 8) {
+      uint32_t low, high;
+      memcpy(&low, s, sizeof(low));
+      memcpy(&high, s + 4, sizeof(high));
+      low ^= crc;
+      crc = tables.entries[7][low & 0xff] ^ tables.entries[6][(low >> 8) & 0xff] ^
+            tables.entries[5][(low >> 16) & 0xff] ^ tables.entries[4][low >> 24] ^
+            tables.entries[3][high & 0xff] ^ tables.entries[2][(high >> 8) & 0xff] ^
+            tables.entries[1][(high >> 16) & 0xff] ^ tables.entries[0][high >> 24];
+    }
+    for (; bytes > 0; --bytes, ++s) {
+      crc = tables.entries[0][(crc ^ *s) & 0xff] ^ (crc >> 8);
+    }
+    return ~crc;
+  }
+
   static const uint64_t MURMUR_PRIME = 0xc6a4a7935bd1e995;
   static const int MURMUR_R = 47;
 
@@ -210,7 +250,7 @@ class HashUtil {
   /// to prevent accidental key collisions. (See IMPALA-219 for more details).
   static uint32_t Hash(const void* data, int32_t bytes, uint32_t seed) {
 #ifdef ARROW_USE_SSE
-    if (LIKELY(CpuInfo::IsSupported(CpuInfo::SSE4_2))) {
+    if (ARROW_PREDICT_TRUE(CpuInfo::IsSupported(CpuInfo::SSE4_2))) {
       return CrcHash(data, bytes, seed);
     } else {
       return MurmurHash2_64(data, bytes, seed);
@@ -231,6 +271,16 @@ class HashUtil {
     return seed ^ (HASH_COMBINE_SEED + value + (seed << 6) + (seed >> 2));
   }
 
+  /// The 64-bit version of HASH_COMBINE_SEED, 2^64 / (golden ratio).
+  static const uint64_t HASH_COMBINE_SEED64 = 0x9e3779b97f4a7c15ULL;
+
+  /// Combine 64-bit hashes 'value' and 'seed' to get a new hash value, like
+  /// HashCombine32(). Combining is not commutative, so the order of the
+  /// combined hashes matters.
+  static inline uint64_t HashCombine64(uint64_t value, uint64_t seed) {
+    return seed ^ (HASH_COMBINE_SEED64 + value + (seed << 6) + (seed >> 2));
+  }
+
   // Get 32 more bits of randomness from a 32-bit hash:
   static inline uint32_t Rehash32to32(const uint32_t hash) {
     // Constants generated by uuidgen(1) with the -r flag
@@ -251,6 +301,33 @@ class HashUtil {
     const uint64_t hash2 = (static_cast<uint64_t>(hash) * m2 + a2) >> 32;
     return hash1 | (hash2 << 32);
   }
+
+ private:
+  // The tables of the reflected CRC32C polynomial: entries[0] that of a byte,
+  // entries[k] that of a byte followed by k zero bytes
+  struct Crc32cTables {
+    uint32_t entries[8][256];
+    Crc32cTables() {
+      for (uint32_t i = 0; i < 256; ++i) {
+        uint32_t crc = i;
+        for (int bit = 0; bit < 8; ++bit) {
+          crc = (crc >> 1) ^ (0x82F63B78 & (0 - (crc & 1)));
+        }
+        entries[0][i] = crc;
+      }
+      for (int k = 1; k < 8; ++k) {
+        for (uint32_t i = 0; i < 256; ++i) {
+          const uint32_t prev = entries[k - 1][i];
+          entries[k][i] = entries[0][prev & 0xff] ^ (prev >> 8);
+        }
+      }
+    }
+  };
+
+  static const Crc32cTables& GetCrc32cTables() {
+    static const Crc32cTables tables;
+    return tables;
+  }
 };
 
 }  // namespace arrow
@@ -17,8 +17,12 @@
 
 #include "arrow/util/hash.h"
 
+#include <algorithm>
+#include <cstring>
+
 #include "arrow/buffer.h"
 #include "arrow/status.h"
+#include "arrow/util/logging.h"
 
 namespace arrow {
 namespace internal {
@@ -34,5 +38,69 @@ Status NewHashTable(int64_t size, MemoryPool* pool, std::shared_ptr<Buffer>* out
   return Status::OK();
 }
 
+// ----------------------------------------------------------------------
+// GroupHashTable implementation
+
+// Grow once more than 7/8 of the slots are used. Probes end at the first group
+// with an empty slot, so this keeps them short even at a high load.
+static constexpr int64_t kGroupHashTableLoadNumerator = 7;
+static constexpr int64_t kGroupHashTableLoadDenominator = 8;
+
+constexpr int64_t GroupHashTable::kGroupSize;
+constexpr int32_t GroupHashTable::kNotFound;
+constexpr uint8_t GroupHashTable::kEmptyControl;
+
+GroupHashTable::GroupHashTable(MemoryPool* pool)
+    : pool_(pool),
+      controls_(nullptr),
+      entries_(nullptr),
+      capacity_(0),
+      size_(0),
+      load_threshold_(0),
+      group_mask_(0) {}
+
+Status GroupHashTable::Init(int64_t capacity) {
+  size_ = 0;
+  return Allocate(BitUtil::NextPower2(std::max(capacity, kGroupSize)));
+}
+
+Status GroupHashTable::Allocate(int64_t capacity) {
+  DCHECK_EQ(capacity, BitUtil::NextPower2(capacity));
+  RETURN_NOT_OK(AllocateBuffer(pool_, capacity, &controls_buffer_));
+  RETURN_NOT_OK(AllocateBuffer(pool_, capacity * sizeof(Entry), &entries_buffer_));
+  controls_ = controls_buffer_->mutable_data();
+  entries_ = reinterpret_cast<Entry*>(entries_buffer_->mutable_data());
+  std::memset(controls_, kEmptyControl, static_cast<size_t>(capacity));
+
+  capacity_ = capacity;
+  load_threshold_ =
+      capacity * kGroupHashTableLoadNumerator / kGroupHashTableLoadDenominator;
+  group_mask_ = capacity / kGroupSize - 1;
+  return Status::OK();
+}
+
+Status GroupHashTable::Grow() {
+  std::shared_ptr<Buffer> old_controls_buffer = controls_buffer_;
+  std::shared_ptr<Buffer> old_entries_buffer = entries_buffer_;
+  const uint8_t* old_controls = controls_;
+  const Entry* old_entries = entries_;
+  const int64_t old_capacity = capacity_;
+
+  RETURN_NOT_OK(Allocate(old_capacity * 2));
+
+  // The memoized values are distinct, so each entry goes to the first empty
+  // slot of its probe sequence without comparing values
+  for (int64_t i = 0; i < old_capacity; ++i) {
+    if (old_controls[i] == kEmptyControl) {
+      continue;
+    }
+    int64_t pos;
+    Find(old_entries[i].hash, [](int32_t) { return false; }, &pos);
+    controls_[pos] = ControlByte(old_entries[i].hash);
+    entries_[pos] = old_entries[i];
+  }
+  return Status::OK();
+}
+
 }  // namespace internal
 }  // namespace arrow
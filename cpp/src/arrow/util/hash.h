@@ -22,11 +22,20 @@
 #include <limits>
 #include <memory>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define ARROW_HAVE_SSE2 1
+#endif
+
+#include "arrow/status.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
+
 namespace arrow {
 
 class Buffer;
 class MemoryPool;
-class Status;
 
 typedef int32_t hash_slot_t;
 static constexpr hash_slot_t kHashSlotEmpty = std::numeric_limits<int32_t>::max();
@@ -82,6 +91,130 @@ namespace internal {
 
 Status NewHashTable(int64_t size, MemoryPool* pool, std::shared_ptr<Buffer>* out);
 
+/// \brief An open-addressing table mapping value hashes to memo table indices
+///
+/// Slots are arranged in groups of kGroupSize. Each slot has a control byte
+/// holding the top 7 bits of its hash, or an empty marker, and a lookup
+/// compares the control bytes of a whole group at once (with SSE2 where
+/// available), so full hashes and values are only compared for likely
+/// matches. Full hashes are stored next to the memo indices, so growing the
+/// table never rehashes the memoized values.
+///
+/// The table does not own the values: the caller stores them in insertion
+/// order and decides equality through the callable passed to Find.
+class ARROW_EXPORT GroupHashTable {
+ public:
+  static constexpr int64_t kGroupSize = 16;
+  static constexpr int32_t kNotFound = -1;
+
+  explicit GroupHashTable(MemoryPool* pool);
+
+  /// \brief Allocate an empty table with room for at least the given number
+  /// of slots
+  Status Init(int64_t capacity = kInitialHashTableSize);
+
+  /// \brief Look up the memo index of a value
+  ///
+  /// \param[in] hash the hash of the value
+  /// \param[in] equal callable taking a memo index and returning whether the
+  /// memoized value at that index equals the value looked up
+  /// \param[out] insert_pos if the value is not found, the slot to pass to Insert
+  /// \return the memo index of the value, or kNotFound
+  template <typename Equal>
+  int32_t Find(uint32_t hash, Equal&& equal, int64_t* insert_pos) const {
+    const uint8_t control = ControlByte(hash);
+    int64_t group = hash & group_mask_;
+    for (int64_t step = 1;; ++step) {
+      const int64_t base = group * kGroupSize;
+      for (uint32_t matches = MatchControl(controls_ + base, control); matches != 0;
+           matches &= matches - 1) {
+        const Entry& entry = entries_[base + BitUtil::CountTrailingZeros(matches)];
+        if (entry.hash == hash && equal(entry.memo_index)) {
+          return entry.memo_index;
+        }
+      }
+      // Nothing is ever deleted, so a group with an empty slot ends the probe
+      const uint32_t empty = MatchEmpty(controls_ + base);
+      if (empty != 0) {
+        *insert_pos = base + BitUtil::CountTrailingZeros(empty);
+        return kNotFound;
+      }
+      // Triangular probing visits every group of a power-of-2 table
+      group = (group + step) & group_mask_;
+    }
+  }
+
+  /// \brief Insert a memo index at the slot returned by a failed Find
+  ///
+  /// The table may grow, which invalidates previously returned slots.
+  Status Insert(int64_t pos, uint32_t hash, int32_t memo_index) {
+    controls_[pos] = ControlByte(hash);
+    entries_[pos].hash = hash;
+    entries_[pos].memo_index = memo_index;
+    if (ARROW_PREDICT_FALSE(++size_ > load_threshold_)) {
+      return Grow();
+    }
+    return Status::OK();
+  }
+
+  /// \brief The number of memo indices in the table
+  int64_t size() const { return size_; }
+
+  /// \brief The number of slots in the table
+  int64_t capacity() const { return capacity_; }
+
+ private:
+  struct Entry {
+    uint32_t hash;
+    int32_t memo_index;
+  };
+
+  static constexpr uint8_t kEmptyControl = 0x80;
+
+  // The low bits of the hash choose the group, the top 7 bits are kept in the
+  // control byte
+  static uint8_t ControlByte(uint32_t hash) { return static_cast<uint8_t>(hash >> 25); }
+
+  // Bitmask of the slots in the group whose control byte equals control
+  static uint32_t MatchControl(const uint8_t* controls, uint8_t control) {
+#ifdef ARROW_HAVE_SSE2
+    const __m128i group = _mm_load_si128(reinterpret_cast<const __m128i*>(controls));
+    return static_cast<uint32_t>(_mm_movemask_epi8(
+        _mm_cmpeq_epi8(group, _mm_set1_epi8(static_cast<char>(control)))));
+#else
+    uint32_t mask = 0;
+    for (int i = 0; i < kGroupSize; ++i) {
+      mask |= static_cast<uint32_t>(controls[i] == control) << i;
+    }
+    return mask;
+#endif
+  }
+
+  // Bitmask of the empty slots in the group
+  static uint32_t MatchEmpty(const uint8_t* controls) {
+#ifdef ARROW_HAVE_SSE2
+    // Only the empty marker has its high bit set
+    const __m128i group = _mm_load_si128(reinterpret_cast<const __m128i*>(controls));
+    return static_cast<uint32_t>(_mm_movemask_epi8(group));
+#else
+    return MatchControl(controls, kEmptyControl);
+#endif
+  }
+
+  Status Allocate(int64_t capacity);
+  Status Grow();
+
+  MemoryPool* pool_;
+  std::shared_ptr<Buffer> controls_buffer_;
+  std::shared_ptr<Buffer> entries_buffer_;
+  uint8_t* controls_;
+  Entry* entries_;
+  int64_t capacity_;
+  int64_t size_;
+  int64_t load_threshold_;
+  int64_t group_mask_;
+};
+
 }  // namespace internal
 }  // namespace arrow
 
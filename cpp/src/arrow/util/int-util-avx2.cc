@@ -0,0 +1,108 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// This file is compiled with -mavx2, its functions must only be called when
+// the CPU supports AVX2
+
+#include "arrow/util/int-util-avx2.h"
+
+#include <immintrin.h>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+namespace arrow {
+namespace internal {
+
+namespace {
+
+inline __m256i Load(const void* values, int64_t i) {
+  return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values) + i);
+}
+
+// The four values at values + 4 * i, those whose valid byte is zero set to 0
+template <bool kHasValidBytes>
+inline __m256i LoadValid(const void* values, const uint8_t* valid_bytes, int64_t i) {
+  const __m256i v = Load(values, i);
+  if (!kHasValidBytes) {
+    return v;
+  }
+  int32_t valid;
+  std::memcpy(&valid, valid_bytes + 4 * i, sizeof(valid));
+  const __m256i valid64 = _mm256_cvtepu8_epi64(_mm_cvtsi32_si128(valid));
+  const __m256i is_null = _mm256_cmpeq_epi64(valid64, _mm256_setzero_si256());
+  return _mm256_andnot_si256(is_null, v);
+}
+
+template <bool kHasValidBytes>
+void IntMinMax(const int64_t* values, const uint8_t* valid_bytes, int64_t length,
+               int64_t* min, int64_t* max) {
+  __m256i lo = _mm256_set1_epi64x(*min);
+  __m256i hi = _mm256_set1_epi64x(*max);
+  for (int64_t i = 0; i < length / 4; ++i) {
+    const __m256i v = LoadValid<kHasValidBytes>(values, valid_bytes, i);
+    lo = _mm256_blendv_epi8(lo, v, _mm256_cmpgt_epi64(lo, v));
+    hi = _mm256_blendv_epi8(hi, v, _mm256_cmpgt_epi64(v, hi));
+  }
+  alignas(32) int64_t lo_lanes[4];
+  alignas(32) int64_t hi_lanes[4];
+  _mm256_store_si256(reinterpret_cast<__m256i*>(lo_lanes), lo);
+  _mm256_store_si256(reinterpret_cast<__m256i*>(hi_lanes), hi);
+  *min = *std::min_element(lo_lanes, lo_lanes + 4);
+  *max = *std::max_element(hi_lanes, hi_lanes + 4);
+}
+
+// AVX2 only compares signed integers: flipping the sign bit maps the order
+// of the unsigned integers onto that of the signed ones
+template <bool kHasValidBytes>
+void UIntMax(const uint64_t* values, const uint8_t* valid_bytes, int64_t length,
+             uint64_t* max) {
+  const __m256i sign = _mm256_set1_epi64x(std::numeric_limits<int64_t>::min());
+  __m256i hi = _mm256_xor_si256(_mm256_set1_epi64x(static_cast<int64_t>(*max)), sign);
+  for (int64_t i = 0; i < length / 4; ++i) {
+    const __m256i v =
+        _mm256_xor_si256(LoadValid<kHasValidBytes>(values, valid_bytes, i), sign);
+    hi = _mm256_blendv_epi8(hi, v, _mm256_cmpgt_epi64(v, hi));
+  }
+  alignas(32) uint64_t hi_lanes[4];
+  _mm256_store_si256(reinterpret_cast<__m256i*>(hi_lanes), _mm256_xor_si256(hi, sign));
+  *max = *std::max_element(hi_lanes, hi_lanes + 4);
+}
+
+}  // namespace
+
+void IntMinMaxAvx2(const int64_t* values, const uint8_t* valid_bytes, int64_t length,
+                   int64_t* min, int64_t* max) {
+  if (valid_bytes == nullptr) {
+    IntMinMax<false>(values, valid_bytes, length, min, max);
+  } else {
+    IntMinMax<true>(values, valid_bytes, length, min, max);
+  }
+}
+
+void UIntMaxAvx2(const uint64_t* values, const uint8_t* valid_bytes, int64_t length,
+                 uint64_t* max) {
+  if (valid_bytes == nullptr) {
+    UIntMax<false>(values, valid_bytes, length, max);
+  } else {
+    UIntMax<true>(values, valid_bytes, length, max);
+  }
+}
+
+}  // namespace internal
+}  // namespace arrow
@@ -0,0 +1,42 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// The AVX2 kernels of int-util.cc, only to be called when the CPU supports
+// AVX2
+
+#ifndef ARROW_UTIL_INT_UTIL_AVX2_H
+#define ARROW_UTIL_INT_UTIL_AVX2_H
+
+#include <cstdint>
+
+namespace arrow {
+namespace internal {
+
+// Lower min and raise max to the minimum and maximum of the values whose
+// valid byte is nonzero, the others taken as 0; length a multiple of 4
+void IntMinMaxAvx2(const int64_t* values, const uint8_t* valid_bytes, int64_t length,
+                   int64_t* min, int64_t* max);
+
+// Raise max to the maximum of the values whose valid byte is nonzero; length
+// a multiple of 4
+void UIntMaxAvx2(const uint64_t* values, const uint8_t* valid_bytes, int64_t length,
+                 uint64_t* max);
+
+}  // namespace internal
+}  // namespace arrow
+
+#endif  // ARROW_UTIL_INT_UTIL_AVX2_H
@@ -0,0 +1,133 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/util/cpu-info.h"
+#include "arrow/util/int-util.h"
+
+namespace arrow {
+namespace internal {
+
+// Run the test body with and without the AVX2 kernels, if the CPU supports
+// them
+template <typename Body>
+void WithAndWithoutAvx2(Body&& body) {
+  CpuInfo::Init();
+  const bool has_avx2 = CpuInfo::IsSupported(CpuInfo::AVX2);
+  for (bool use_avx2 : {true, false}) {
+    if (has_avx2) {
+      CpuInfo::EnableFeature(CpuInfo::AVX2, use_avx2);
+    }
+    body();
+  }
+  if (has_avx2) {
+    CpuInfo::EnableFeature(CpuInfo::AVX2, true);
+  }
+}
+
+// The width of length small values, one of which, at position, is value
+static uint8_t IntWidthWith(int64_t value, int64_t length, int64_t position,
+                            const uint8_t* valid_bytes = nullptr) {
+  std::vector<int64_t> values(length, 1);
+  values[position] = value;
+  return DetectIntWidth(values.data(), valid_bytes, length);
+}
+
+static uint8_t UIntWidthWith(uint64_t value, int64_t length, int64_t position,
+                             const uint8_t* valid_bytes = nullptr) {
+  std::vector<uint64_t> values(length, 1);
+  values[position] = value;
+  return DetectUIntWidth(values.data(), valid_bytes, length);
+}
+
+TEST(IntUtil, DetectIntWidth) {
+  WithAndWithoutAvx2([] {
+    ASSERT_EQ(1, DetectIntWidth(nullptr, nullptr, 0));
+    ASSERT_EQ(4, DetectIntWidth(nullptr, nullptr, 0, 4));
+    // Lengths with and without a tail after the vectors, and over several blocks
+    for (int64_t length : {1, 3, 4, 7, 64, 1023, 1025, 3000}) {
+      for (int64_t position : {int64_t(0), length / 2, length - 1}) {
+        ASSERT_EQ(1, IntWidthWith(-128, length, position));
+        ASSERT_EQ(1, IntWidthWith(127, length, position));
+        ASSERT_EQ(2, IntWidthWith(-129, length, position));
+        ASSERT_EQ(2, IntWidthWith(128, length, position));
+        ASSERT_EQ(2, IntWidthWith(std::numeric_limits<int16_t>::min(), length, position));
+        ASSERT_EQ(4, IntWidthWith(std::numeric_limits<int16_t>::max() + 1, length,
+                                  position));
+        ASSERT_EQ(4, IntWidthWith(std::numeric_limits<int32_t>::min(), length, position));
+        ASSERT_EQ(8, IntWidthWith(int64_t(std::numeric_limits<int32_t>::max()) + 1,
+                                  length, position));
+        ASSERT_EQ(8, IntWidthWith(std::numeric_limits<int64_t>::min(), length, position));
+      }
+    }
+  });
+}
+
+TEST(IntUtil, DetectUIntWidth) {
+  WithAndWithoutAvx2([] {
+    ASSERT_EQ(1, DetectUIntWidth(nullptr, nullptr, 0));
+    for (int64_t length : {1, 3, 4, 7, 64, 1023, 1025, 3000}) {
+      for (int64_t position : {int64_t(0), length / 2, length - 1}) {
+        ASSERT_EQ(1, UIntWidthWith(255, length, position));
+        ASSERT_EQ(2, UIntWidthWith(256, length, position));
+        ASSERT_EQ(4, UIntWidthWith(65536, length, position));
+        ASSERT_EQ(8, UIntWidthWith(uint64_t(1) << 32, length, position));
+        ASSERT_EQ(8, UIntWidthWith(std::numeric_limits<uint64_t>::max(), length,
+                                   position));
+      }
+    }
+  });
+}
+
+TEST(IntUtil, DetectWidthValidBytes) {
+  WithAndWithoutAvx2([] {
+    for (int64_t length : {1, 5, 8, 1500}) {
+      std::vector<uint8_t> valid_bytes(length, 1);
+      const int64_t position = length - 1;
+      valid_bytes[position] = 0;
+      ASSERT_EQ(1, IntWidthWith(std::numeric_limits<int64_t>::min(), length, position,
+                                valid_bytes.data()));
+      ASSERT_EQ(1, UIntWidthWith(std::numeric_limits<uint64_t>::max(), length, position,
+                                 valid_bytes.data()));
+      valid_bytes[position] = 2;
+      ASSERT_EQ(8, IntWidthWith(std::numeric_limits<int64_t>::min(), length, position,
+                                valid_bytes.data()));
+      ASSERT_EQ(8, UIntWidthWith(std::numeric_limits<uint64_t>::max(), length, position,
+                                 valid_bytes.data()));
+    }
+  });
+}
+
+TEST(IntUtil, DowncastInts) {
+  std::vector<int64_t> values = {0, -1, 127, -128, 5, 6, 7, 8, 9};
+  std::vector<int8_t> narrow(values.size());
+  DowncastInts(values.data(), narrow.data(), static_cast<int64_t>(values.size()));
+  ASSERT_EQ(std::vector<int8_t>({0, -1, 127, -128, 5, 6, 7, 8, 9}), narrow);
+
+  std::vector<uint64_t> uvalues = {0, 1, 65535, 4, 5};
+  std::vector<uint16_t> unarrow(uvalues.size());
+  DowncastInts(uvalues.data(), unarrow.data(), static_cast<int64_t>(uvalues.size()));
+  ASSERT_EQ(std::vector<uint16_t>({0, 1, 65535, 4, 5}), unarrow);
+}
+
+}  // namespace internal
+}  // namespace arrow
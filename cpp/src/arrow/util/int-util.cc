@@ -0,0 +1,192 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/int-util.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+#include "arrow/util/cpu-info.h"
+
+#ifdef ARROW_HAVE_AVX2
+#include "arrow/util/int-util-avx2.h"
+#endif
+
+namespace arrow {
+namespace internal {
+
+namespace {
+
+// The values are scanned a block at a time, so that the scan stops soon after
+// a value needs 8 bytes
+constexpr int64_t kDetectBlockLength = 1024;
+
+#ifdef ARROW_HAVE_AVX2
+// The features are checked on each call rather than once, so that tests can
+// toggle them with CpuInfo::EnableFeature
+bool UseAvx2() {
+  if (!CpuInfo::initialized()) {
+    CpuInfo::Init();
+  }
+  return CpuInfo::IsSupported(CpuInfo::AVX2);
+}
+#endif
+
+// Lower min and raise max to the minimum and maximum of the valid values, the
+// others taken as 0, which fits any width
+void IntMinMax(const int64_t* values, const uint8_t* valid_bytes, int64_t length,
+               int64_t* min, int64_t* max) {
+  int64_t i = 0;
+#ifdef ARROW_HAVE_AVX2
+  if (UseAvx2()) {
+    i = length / 4 * 4;
+    IntMinMaxAvx2(values, valid_bytes, i, min, max);
+  }
+#endif
+  int64_t lo = *min;
+  int64_t hi = *max;
+  if (valid_bytes == nullptr) {
+    for (; i < length; ++i) {
+      lo = std::min(lo, values[i]);
+      hi = std::max(hi, values[i]);
+    }
+  } else {
+    for (; i < length; ++i) {
+      const int64_t value = valid_bytes[i] ? values[i] : 0;
+      lo = std::min(lo, value);
+      hi = std::max(hi, value);
+    }
+  }
+  *min = lo;
+  *max = hi;
+}
+
+void UIntMax(const uint64_t* values, const uint8_t* valid_bytes, int64_t length,
+             uint64_t* max) {
+  int64_t i = 0;
+#ifdef ARROW_HAVE_AVX2
+  if (UseAvx2()) {
+    i = length / 4 * 4;
+    UIntMaxAvx2(values, valid_bytes, i, max);
+  }
+#endif
+  uint64_t hi = *max;
+  if (valid_bytes == nullptr) {
+    for (; i < length; ++i) {
+      hi = std::max(hi, values[i]);
+    }
+  } else {
+    for (; i < length; ++i) {
+      hi = std::max(hi, valid_bytes[i] ? values[i] : 0);
+    }
+  }
+  *max = hi;
+}
+
+template <typename Int>
+bool Fits(int64_t min, int64_t max) {
+  return min >= static_cast<int64_t>(std::numeric_limits<Int>::min()) &&
+         max <= static_cast<int64_t>(std::numeric_limits<Int>::max());
+}
+
+uint8_t IntWidth(int64_t min, int64_t max) {
+  if (Fits<int8_t>(min, max)) {
+    return 1;
+  } else if (Fits<int16_t>(min, max)) {
+    return 2;
+  } else if (Fits<int32_t>(min, max)) {
+    return 4;
+  } else {
+    return 8;
+  }
+}
+
+uint8_t UIntWidth(uint64_t max) {
+  if (max <= std::numeric_limits<uint8_t>::max()) {
+    return 1;
+  } else if (max <= std::numeric_limits<uint16_t>::max()) {
+    return 2;
+  } else if (max <= std::numeric_limits<uint32_t>::max()) {
+    return 4;
+  } else {
+    return 8;
+  }
+}
+
+template <typename Source, typename Dest>
+void Downcast(const Source* source, Dest* dest, int64_t length) {
+  for (int64_t i = 0; i < length; ++i) {
+    dest[i] = static_cast<Dest>(source[i]);
+  }
+}
+
+}  // namespace
+
+uint8_t DetectIntWidth(const int64_t* values, const uint8_t* valid_bytes,
+                       int64_t length, uint8_t min_width) {
+  uint8_t width = min_width;
+  for (int64_t offset = 0; offset < length && width < 8; offset += kDetectBlockLength) {
+    const int64_t block_length = std::min(kDetectBlockLength, length - offset);
+    int64_t min = 0;
+    int64_t max = 0;
+    IntMinMax(values + offset, valid_bytes ? valid_bytes + offset : nullptr,
+              block_length, &min, &max);
+    width = std::max(width, IntWidth(min, max));
+  }
+  return width;
+}
+
+uint8_t DetectUIntWidth(const uint64_t* values, const uint8_t* valid_bytes,
+                        int64_t length, uint8_t min_width) {
+  uint8_t width = min_width;
+  for (int64_t offset = 0; offset < length && width < 8; offset += kDetectBlockLength) {
+    const int64_t block_length = std::min(kDetectBlockLength, length - offset);
+    uint64_t max = 0;
+    UIntMax(values + offset, valid_bytes ? valid_bytes + offset : nullptr, block_length,
+            &max);
+    width = std::max(width, UIntWidth(max));
+  }
+  return width;
+}
+
+void DowncastInts(const int64_t* source, int8_t* dest, int64_t length) {
+  Downcast(source, dest, length);
+}
+
+void DowncastInts(const int64_t* source, int16_t* dest, int64_t length) {
+  Downcast(source, dest, length);
+}
+
+void DowncastInts(const int64_t* source, int32_t* dest, int64_t length) {
+  Downcast(source, dest, length);
+}
+
+void DowncastInts(const uint64_t* source, uint8_t* dest, int64_t length) {
+  Downcast(source, dest, length);
+}
+
+void DowncastInts(const uint64_t* source, uint16_t* dest, int64_t length) {
+  Downcast(source, dest, length);
+}
+
+void DowncastInts(const uint64_t* source, uint32_t* dest, int64_t length) {
+  Downcast(source, dest, length);
+}
+
+}  // namespace internal
+}  // namespace arrow
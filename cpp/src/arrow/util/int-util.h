@@ -0,0 +1,63 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Width detection and narrowing of integers, for the adaptive integer builders
+
+#ifndef ARROW_UTIL_INT_UTIL_H
+#define ARROW_UTIL_INT_UTIL_H
+
+#include <cstdint>
+
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace internal {
+
+/// \brief The smallest width, in bytes and at least min_width, of the
+/// integers holding the values whose valid byte is nonzero
+///
+/// All the values are considered if valid_bytes is null. The minimum and
+/// maximum of the values are computed a block at a time, with AVX2 if
+/// supported, and the rest of the values skipped once the width is 8.
+ARROW_EXPORT
+uint8_t DetectIntWidth(const int64_t* values, const uint8_t* valid_bytes,
+                       int64_t length, uint8_t min_width = 1);
+
+/// \brief The smallest width, in bytes and at least min_width, of the
+/// unsigned integers holding the values whose valid byte is nonzero
+ARROW_EXPORT
+uint8_t DetectUIntWidth(const uint64_t* values, const uint8_t* valid_bytes,
+                        int64_t length, uint8_t min_width = 1);
+
+/// \brief Narrow the values, which must fit, into dest
+ARROW_EXPORT
+void DowncastInts(const int64_t* source, int8_t* dest, int64_t length);
+ARROW_EXPORT
+void DowncastInts(const int64_t* source, int16_t* dest, int64_t length);
+ARROW_EXPORT
+void DowncastInts(const int64_t* source, int32_t* dest, int64_t length);
+ARROW_EXPORT
+void DowncastInts(const uint64_t* source, uint8_t* dest, int64_t length);
+ARROW_EXPORT
+void DowncastInts(const uint64_t* source, uint16_t* dest, int64_t length);
+ARROW_EXPORT
+void DowncastInts(const uint64_t* source, uint32_t* dest, int64_t length);
+
+}  // namespace internal
+}  // namespace arrow
+
+#endif  // ARROW_UTIL_INT_UTIL_H
@@ -0,0 +1,168 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/buffer.h"
+#include "arrow/memory_pool.h"
+#include "arrow/test-util.h"
+#include "arrow/util/integer-encoding.h"
+
+using std::vector;
+
+namespace arrow {
+
+static const IntegerEncoding::type kEncodings[] = {
+    IntegerEncoding::FRAME_OF_REFERENCE, IntegerEncoding::DELTA, IntegerEncoding::RLE};
+
+template <typename T>
+void CheckRoundtrip(IntegerEncoding::type encoding, const vector<T>& values,
+                    std::shared_ptr<Buffer>* encoded = nullptr) {
+  const int64_t length = static_cast<int64_t>(values.size());
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(EncodeIntegers(encoding, values.data(), length, default_memory_pool(),
+                           &buffer));
+  vector<T> decoded(values.size());
+  ASSERT_OK(DecodeIntegers(encoding, *buffer, length, decoded.data()));
+  ASSERT_EQ(values, decoded);
+  if (encoded != nullptr) {
+    *encoded = buffer;
+  }
+}
+
+template <typename T>
+vector<T> MakeRandom(int64_t length, T min, T max) {
+  std::mt19937_64 rng(42);
+  std::uniform_int_distribution<T> dist(min, max);
+  vector<T> values(length);
+  for (auto& v : values) {
+    v = dist(rng);
+  }
+  return values;
+}
+
+template <typename T>
+class TestIntegerEncoding : public ::testing::Test {};
+
+typedef ::testing::Types<int32_t, int64_t> IntegerTypes;
+
+TYPED_TEST_CASE(TestIntegerEncoding, IntegerTypes);
+
+TYPED_TEST(TestIntegerEncoding, Empty) {
+  for (auto encoding : kEncodings) {
+    CheckRoundtrip(encoding, vector<TypeParam>());
+  }
+}
+
+TYPED_TEST(TestIntegerEncoding, Lengths) {
+  // Around the lengths of the frames
+  for (int64_t length : {1, 2, 31, 127, 128, 129, 1000}) {
+    const auto values = MakeRandom<TypeParam>(length, -50, 1000);
+    for (auto encoding : kEncodings) {
+      CheckRoundtrip(encoding, values);
+    }
+  }
+}
+
+TYPED_TEST(TestIntegerEncoding, Constant) {
+  const vector<TypeParam> values(1000, -7);
+  for (auto encoding : kEncodings) {
+    std::shared_ptr<Buffer> encoded;
+    CheckRoundtrip(encoding, values, &encoded);
+    ASSERT_LT(encoded->size(), 100);
+  }
+}
+
+TYPED_TEST(TestIntegerEncoding, BitWidths) {
+  for (int bit_width = 1; bit_width < 32; ++bit_width) {
+    const TypeParam max = static_cast<TypeParam>((int64_t(1) << bit_width) - 1);
+    const auto values = MakeRandom<TypeParam>(300, 0, max);
+    for (auto encoding : kEncodings) {
+      CheckRoundtrip(encoding, values);
+    }
+  }
+}
+
+TYPED_TEST(TestIntegerEncoding, ExtremeValues) {
+  // Differences spanning the whole range of the type
+  const TypeParam lo = std::numeric_limits<TypeParam>::min();
+  const TypeParam hi = std::numeric_limits<TypeParam>::max();
+  const auto values = MakeRandom<TypeParam>(1000, lo, hi);
+  CheckRoundtrip(IntegerEncoding::FRAME_OF_REFERENCE, values);
+  CheckRoundtrip(IntegerEncoding::DELTA, values);
+  CheckRoundtrip(IntegerEncoding::FRAME_OF_REFERENCE, vector<TypeParam>{lo, hi, 0});
+  CheckRoundtrip(IntegerEncoding::DELTA, vector<TypeParam>{lo, hi, lo, 0, hi});
+}
+
+TYPED_TEST(TestIntegerEncoding, Truncated) {
+  const auto values = MakeRandom<TypeParam>(1000, 0, 1000);
+  vector<TypeParam> decoded(values.size());
+  for (auto encoding : kEncodings) {
+    std::shared_ptr<Buffer> encoded;
+    CheckRoundtrip(encoding, values, &encoded);
+    auto truncated = SliceBuffer(encoded, 0, encoded->size() / 2);
+    ASSERT_RAISES(IOError, DecodeIntegers(encoding, *truncated,
+                                          static_cast<int64_t>(values.size()),
+                                          decoded.data()));
+  }
+}
+
+TEST(IntegerEncoding, DeltaOfSortedValues) {
+  // Timestamps increasing by small steps pack in a few bits each
+  vector<int64_t> values(10000);
+  std::mt19937_64 rng(42);
+  std::uniform_int_distribution<int64_t> step(0, 100);
+  int64_t value = 1500000000000LL;
+  for (auto& v : values) {
+    value += step(rng);
+    v = value;
+  }
+  std::shared_ptr<Buffer> encoded;
+  CheckRoundtrip(IntegerEncoding::DELTA, values, &encoded);
+  ASSERT_LT(encoded->size(), static_cast<int64_t>(values.size()));
+}
+
+TEST(IntegerEncoding, RleOfRuns) {
+  vector<int32_t> values;
+  for (int32_t run = 0; run < 100; ++run) {
+    values.insert(values.end(), 1000 + run % 7, run % 3);
+  }
+  std::shared_ptr<Buffer> encoded;
+  CheckRoundtrip(IntegerEncoding::RLE, values, &encoded);
+  ASSERT_LT(encoded->size(), 1000);
+}
+
+TEST(IntegerEncoding, RleSegments) {
+  // Longer than a segment of the run length encoding
+  const auto values = MakeRandom<int64_t>(200000, -3, 3);
+  CheckRoundtrip(IntegerEncoding::RLE, values);
+}
+
+TEST(IntegerEncoding, RleNeedsNarrowRange) {
+  const vector<int64_t> values = {0, int64_t(1) << 40};
+  std::shared_ptr<Buffer> encoded;
+  ASSERT_RAISES(Invalid, EncodeIntegers(IntegerEncoding::RLE, values.data(), 2,
+                                        default_memory_pool(), &encoded));
+}
+
+}  // namespace arrow
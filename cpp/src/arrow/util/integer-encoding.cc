@@ -0,0 +1,400 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/integer-encoding.h"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "arrow/buffer.h"
+#include "arrow/memory_pool.h"
+#include "arrow/status.h"
+#include "arrow/util/bit-stream-utils.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/rle-encoding.h"
+
+namespace arrow {
+
+namespace {
+
+// The number of values of a frame of reference block, a multiple of the 32
+// values unpacked at once by BitReader::GetBatch
+constexpr int64_t kFrameLength = 128;
+
+// The number of values of a run length encoded segment, bounding the size of
+// the buffers given to the bit writers and readers
+constexpr int64_t kRleSegmentLength = 1 << 16;
+
+// The bit width of a frame stored as raw 64-bit differences
+constexpr int kRawBitWidth = 64;
+
+// The differences to the minimum are computed on the unsigned type, where
+// they can not overflow
+template <typename T>
+using Unsigned = typename std::make_unsigned<T>::type;
+
+template <typename T>
+void MinMax(const T* values, int64_t length, T* min, T* max) {
+  T lo = values[0], hi = values[0];
+  for (int64_t i = 1; i < length; ++i) {
+    lo = std::min(lo, values[i]);
+    hi = std::max(hi, values[i]);
+  }
+  *min = lo;
+  *max = hi;
+}
+
+template <typename T>
+int BitWidth(T min, T max) {
+  using U = Unsigned<T>;
+  return BitUtil::NumRequiredBits(static_cast<U>(static_cast<U>(max) - min));
+}
+
+// ----------------------------------------------------------------------
+// Frame of reference
+
+template <typename T>
+constexpr int64_t MaxFrameSize(int64_t length) {
+  return sizeof(T) + 1 + length * static_cast<int64_t>(sizeof(T));
+}
+
+template <typename T>
+int64_t MaxFramesSize(int64_t length) {
+  const int64_t num_frames = BitUtil::Ceil(length, kFrameLength);
+  return num_frames * MaxFrameSize<T>(0) + length * static_cast<int64_t>(sizeof(T));
+}
+
+// A frame is its minimum value, the bit width of the differences to it, then
+// the differences bit-packed, or as raw 64-bit values if wider than the 32
+// bits of BitWriter
+template <typename T>
+int64_t EncodeFrame(const T* values, int64_t length, uint8_t* out) {
+  using U = Unsigned<T>;
+  T min, max;
+  MinMax(values, length, &min, &max);
+  const int bit_width = BitWidth(min, max);
+  memcpy(out, &min, sizeof(T));
+  uint8_t* data = out + sizeof(T) + 1;
+
+  if (bit_width == 0) {
+    // All of the values are the minimum
+    out[sizeof(T)] = 0;
+    return data - out;
+  }
+  if (bit_width > 32) {
+    out[sizeof(T)] = kRawBitWidth;
+    for (int64_t i = 0; i < length; ++i) {
+      const U diff = static_cast<U>(static_cast<U>(values[i]) - min);
+      memcpy(data + i * sizeof(U), &diff, sizeof(U));
+    }
+    return data - out + length * static_cast<int64_t>(sizeof(U));
+  }
+  out[sizeof(T)] = static_cast<uint8_t>(bit_width);
+  BitWriter writer(data, static_cast<int>(BitUtil::Ceil(length * bit_width, 8)));
+  for (int64_t i = 0; i < length; ++i) {
+    writer.PutValue(static_cast<U>(static_cast<U>(values[i]) - min), bit_width);
+  }
+  writer.Flush();
+  return data - out + writer.bytes_written();
+}
+
+template <typename T>
+Status DecodeFrame(const uint8_t* data, int64_t size, int64_t length, T* out,
+                   int64_t* frame_size) {
+  using U = Unsigned<T>;
+  if (size < MaxFrameSize<T>(0)) {
+    return Status::IOError("Integer encoded frame is truncated");
+  }
+  T min;
+  memcpy(&min, data, sizeof(T));
+  const int bit_width = data[sizeof(T)];
+  data += MaxFrameSize<T>(0);
+  size -= MaxFrameSize<T>(0);
+
+  if (bit_width == 0) {
+    std::fill(out, out + length, min);
+    *frame_size = MaxFrameSize<T>(0);
+    return Status::OK();
+  }
+  if (bit_width == kRawBitWidth && sizeof(T) == sizeof(uint64_t)) {
+    const int64_t nbytes = length * static_cast<int64_t>(sizeof(U));
+    if (size < nbytes) {
+      return Status::IOError("Integer encoded frame is truncated");
+    }
+    U diffs[kFrameLength];
+    memcpy(diffs, data, nbytes);
+    for (int64_t i = 0; i < length; ++i) {
+      out[i] = static_cast<T>(static_cast<U>(static_cast<U>(min) + diffs[i]));
+    }
+    *frame_size = MaxFrameSize<T>(0) + nbytes;
+    return Status::OK();
+  }
+  if (bit_width > 32) {
+    return Status::IOError("Integer encoded frame has an invalid bit width");
+  }
+
+  const int64_t nbytes = BitUtil::Ceil(length * bit_width, 8);
+  if (size < nbytes) {
+    return Status::IOError("Integer encoded frame is truncated");
+  }
+  // The unpacking kernels of GetBatch work on 32-bit values, the reference is
+  // then added back in a loop the compiler vectorizes
+  uint32_t diffs[kFrameLength];
+  BitReader reader(data, static_cast<int>(nbytes));
+  if (reader.GetBatch(bit_width, diffs, static_cast<int>(length)) != length) {
+    return Status::IOError("Integer encoded frame is truncated");
+  }
+  for (int64_t i = 0; i < length; ++i) {
+    out[i] = static_cast<T>(static_cast<U>(static_cast<U>(min) + diffs[i]));
+  }
+  *frame_size = MaxFrameSize<T>(0) + nbytes;
+  return Status::OK();
+}
+
+template <typename T>
+int64_t EncodeFrames(const T* values, int64_t length, uint8_t* out) {
+  uint8_t* pos = out;
+  for (int64_t offset = 0; offset < length; offset += kFrameLength) {
+    pos += EncodeFrame(values + offset, std::min(kFrameLength, length - offset), pos);
+  }
+  return pos - out;
+}
+
+template <typename T>
+Status DecodeFrames(const uint8_t* data, int64_t size, int64_t length, T* out) {
+  for (int64_t offset = 0; offset < length; offset += kFrameLength) {
+    int64_t frame_size;
+    RETURN_NOT_OK(DecodeFrame(data, size, std::min(kFrameLength, length - offset),
+                              out + offset, &frame_size));
+    data += frame_size;
+    size -= frame_size;
+  }
+  return Status::OK();
+}
+
+// ----------------------------------------------------------------------
+// Delta
+
+template <typename T>
+int64_t MaxDeltaSize(int64_t length) {
+  return length == 0 ? 0 : sizeof(T) + MaxFramesSize<T>(length - 1);
+}
+
+// The first value, then the frames of the differences between consecutive
+// values, wrapping around on overflow
+template <typename T>
+int64_t EncodeDelta(const T* values, int64_t length, uint8_t* out) {
+  using U = Unsigned<T>;
+  if (length == 0) {
+    return 0;
+  }
+  memcpy(out, values, sizeof(T));
+  uint8_t* pos = out + sizeof(T);
+  T deltas[kFrameLength];
+  for (int64_t offset = 1; offset < length; offset += kFrameLength) {
+    const int64_t frame_length = std::min(kFrameLength, length - offset);
+    for (int64_t i = 0; i < frame_length; ++i) {
+      const U value = static_cast<U>(values[offset + i]);
+      const U previous = static_cast<U>(values[offset + i - 1]);
+      deltas[i] = static_cast<T>(static_cast<U>(value - previous));
+    }
+    pos += EncodeFrame(deltas, frame_length, pos);
+  }
+  return pos - out;
+}
+
+template <typename T>
+Status DecodeDelta(const uint8_t* data, int64_t size, int64_t length, T* out) {
+  using U = Unsigned<T>;
+  if (length == 0) {
+    return Status::OK();
+  }
+  if (size < static_cast<int64_t>(sizeof(T))) {
+    return Status::IOError("Delta encoded integers are truncated");
+  }
+  memcpy(out, data, sizeof(T));
+  RETURN_NOT_OK(
+      DecodeFrames(data + sizeof(T), size - sizeof(T), length - 1, out + 1));
+  U sum = static_cast<U>(out[0]);
+  for (int64_t i = 1; i < length; ++i) {
+    sum = static_cast<U>(sum + static_cast<U>(out[i]));
+    out[i] = static_cast<T>(sum);
+  }
+  return Status::OK();
+}
+
+// ----------------------------------------------------------------------
+// Run length encoding
+
+// The minimum value and the bit width of the differences to it, then
+// segments of kRleSegmentLength values: the int32 size of the segment, then
+// the differences run length encoded
+template <typename T>
+Status EncodeRle(const T* values, int64_t length, MemoryPool* pool,
+                 std::shared_ptr<Buffer>* out) {
+  using U = Unsigned<T>;
+  T min = 0, max = 0;
+  if (length > 0) {
+    MinMax(values, length, &min, &max);
+  }
+  // RleEncoder does not support a zero bit width
+  const int bit_width = std::max(BitWidth(min, max), 1);
+  if (bit_width > 32) {
+    return Status::Invalid("RLE encoded integers must span at most 32 bits");
+  }
+
+  const int64_t num_segments = BitUtil::Ceil(length, kRleSegmentLength);
+  const int max_segment_size =
+      RleEncoder::MaxBufferSize(bit_width, static_cast<int>(kRleSegmentLength)) +
+      RleEncoder::MinBufferSize(bit_width);
+  const int64_t max_size =
+      sizeof(T) + 1 + num_segments * (sizeof(int32_t) + max_segment_size);
+  std::shared_ptr<ResizableBuffer> buffer;
+  RETURN_NOT_OK(AllocateResizableBuffer(pool, max_size, &buffer));
+
+  uint8_t* pos = buffer->mutable_data();
+  memcpy(pos, &min, sizeof(T));
+  pos[sizeof(T)] = static_cast<uint8_t>(bit_width);
+  pos += sizeof(T) + 1;
+  for (int64_t offset = 0; offset < length; offset += kRleSegmentLength) {
+    const int64_t segment_length = std::min(kRleSegmentLength, length - offset);
+    RleEncoder encoder(pos + sizeof(int32_t), max_segment_size, bit_width);
+    for (int64_t i = 0; i < segment_length; ++i) {
+      const bool fits =
+          encoder.Put(static_cast<U>(static_cast<U>(values[offset + i]) - min));
+      DCHECK(fits);
+      ARROW_UNUSED(fits);
+    }
+    const int32_t segment_size = encoder.Flush();
+    memcpy(pos, &segment_size, sizeof(int32_t));
+    pos += sizeof(int32_t) + segment_size;
+  }
+  RETURN_NOT_OK(buffer->Resize(pos - buffer->data()));
+  *out = buffer;
+  return Status::OK();
+}
+
+template <typename T>
+Status DecodeRle(const uint8_t* data, int64_t size, int64_t length, T* out) {
+  using U = Unsigned<T>;
+  constexpr int64_t kHeaderSize = sizeof(T) + 1;
+  if (size < kHeaderSize) {
+    return Status::IOError("RLE encoded integers are truncated");
+  }
+  T min;
+  memcpy(&min, data, sizeof(T));
+  const int bit_width = data[sizeof(T)];
+  if (bit_width < 1 || bit_width > 32) {
+    return Status::IOError("RLE encoded integers have an invalid bit width");
+  }
+  data += kHeaderSize;
+  size -= kHeaderSize;
+
+  std::vector<uint32_t> diffs(static_cast<size_t>(std::min(length, kRleSegmentLength)));
+  for (int64_t offset = 0; offset < length; offset += kRleSegmentLength) {
+    const int64_t segment_length = std::min(kRleSegmentLength, length - offset);
+    int32_t segment_size;
+    if (size < static_cast<int64_t>(sizeof(int32_t))) {
+      return Status::IOError("RLE encoded integers are truncated");
+    }
+    memcpy(&segment_size, data, sizeof(int32_t));
+    data += sizeof(int32_t);
+    size -= sizeof(int32_t);
+    if (segment_size < 0 || segment_size > size) {
+      return Status::IOError("RLE encoded integers are truncated");
+    }
+    RleDecoder decoder(data, segment_size, bit_width);
+    if (decoder.GetBatch(diffs.data(), static_cast<int>(segment_length)) !=
+        segment_length) {
+      return Status::IOError("RLE encoded integers are truncated");
+    }
+    T* segment_out = out + offset;
+    for (int64_t i = 0; i < segment_length; ++i) {
+      segment_out[i] = static_cast<T>(static_cast<U>(static_cast<U>(min) + diffs[i]));
+    }
+    data += segment_size;
+    size -= segment_size;
+  }
+  return Status::OK();
+}
+
+// ----------------------------------------------------------------------
+
+template <typename T>
+Status Encode(IntegerEncoding::type encoding, const T* values, int64_t length,
+              MemoryPool* pool, std::shared_ptr<Buffer>* out) {
+  if (encoding == IntegerEncoding::RLE) {
+    return EncodeRle(values, length, pool, out);
+  }
+  const bool delta = encoding == IntegerEncoding::DELTA;
+  if (!delta && encoding != IntegerEncoding::FRAME_OF_REFERENCE) {
+    return Status::Invalid("Unrecognized integer encoding");
+  }
+  std::shared_ptr<ResizableBuffer> buffer;
+  RETURN_NOT_OK(AllocateResizableBuffer(
+      pool, delta ? MaxDeltaSize<T>(length) : MaxFramesSize<T>(length), &buffer));
+  const int64_t size = delta ? EncodeDelta(values, length, buffer->mutable_data())
+                             : EncodeFrames(values, length, buffer->mutable_data());
+  RETURN_NOT_OK(buffer->Resize(size));
+  *out = buffer;
+  return Status::OK();
+}
+
+template <typename T>
+Status Decode(IntegerEncoding::type encoding, const Buffer& encoded, int64_t length,
+              T* out) {
+  switch (encoding) {
+    case IntegerEncoding::FRAME_OF_REFERENCE:
+      return DecodeFrames(encoded.data(), encoded.size(), length, out);
+    case IntegerEncoding::DELTA:
+      return DecodeDelta(encoded.data(), encoded.size(), length, out);
+    case IntegerEncoding::RLE:
+      return DecodeRle(encoded.data(), encoded.size(), length, out);
+    default:
+      break;
+  }
+  return Status::Invalid("Unrecognized integer encoding");
+}
+
+}  // namespace
+
+Status EncodeIntegers(IntegerEncoding::type encoding, const int32_t* values,
+                      int64_t length, MemoryPool* pool, std::shared_ptr<Buffer>* out) {
+  return Encode(encoding, values, length, pool, out);
+}
+
+Status EncodeIntegers(IntegerEncoding::type encoding, const int64_t* values,
+                      int64_t length, MemoryPool* pool, std::shared_ptr<Buffer>* out) {
+  return Encode(encoding, values, length, pool, out);
+}
+
+Status DecodeIntegers(IntegerEncoding::type encoding, const Buffer& encoded,
+                      int64_t length, int32_t* out) {
+  return Decode(encoding, encoded, length, out);
+}
+
+Status DecodeIntegers(IntegerEncoding::type encoding, const Buffer& encoded,
+                      int64_t length, int64_t* out) {
+  return Decode(encoding, encoded, length, out);
+}
+
+}  // namespace arrow
@@ -0,0 +1,87 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_UTIL_INTEGER_ENCODING_H
+#define ARROW_UTIL_INTEGER_ENCODING_H
+
+#include <cstdint>
+#include <memory>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Buffer;
+class MemoryPool;
+
+/// \brief Lightweight encodings of integer values, much cheaper to decode than
+/// general-purpose compression but only effective on suitable data
+struct IntegerEncoding {
+  enum type {
+    /// Blocks of 128 values, each stored as its minimum and the difference of
+    /// every value to it, bit-packed with as many bits as the largest needs.
+    /// Suits values of a narrow range, such as dictionary indices
+    FRAME_OF_REFERENCE,
+    /// The first value, then the differences between consecutive values
+    /// encoded as with FRAME_OF_REFERENCE. Suits sorted values, such as
+    /// timestamps or row ids
+    DELTA,
+    /// The difference of the values to their minimum, in runs of repeated
+    /// values and bit-packed runs as in Parquet. Suits values in long runs.
+    /// The values must span at most 32 bits
+    RLE
+  };
+};
+
+/// \brief Encode integer values
+///
+/// \param[in] encoding the encoding to use
+/// \param[in] values the values to encode
+/// \param[in] length the number of values
+/// \param[in] pool the pool to allocate the encoded buffer from
+/// \param[out] out the encoded values
+/// \return Status
+ARROW_EXPORT
+Status EncodeIntegers(IntegerEncoding::type encoding, const int32_t* values,
+                      int64_t length, MemoryPool* pool, std::shared_ptr<Buffer>* out);
+
+ARROW_EXPORT
+Status EncodeIntegers(IntegerEncoding::type encoding, const int64_t* values,
+                      int64_t length, MemoryPool* pool, std::shared_ptr<Buffer>* out);
+
+/// \brief Decode integer values encoded by EncodeIntegers
+///
+/// Returns IOError if the encoded data is malformed or does not hold length
+/// values.
+///
+/// \param[in] encoding the encoding of the values
+/// \param[in] encoded the encoded values
+/// \param[in] length the number of values
+/// \param[out] out the decoded values, with room for length of them
+/// \return Status
+ARROW_EXPORT
+Status DecodeIntegers(IntegerEncoding::type encoding, const Buffer& encoded,
+                      int64_t length, int32_t* out);
+
+ARROW_EXPORT
+Status DecodeIntegers(IntegerEncoding::type encoding, const Buffer& encoded,
+                      int64_t length, int64_t* out);
+
+}  // namespace arrow
+
+#endif  // ARROW_UTIL_INTEGER_ENCODING_H
@@ -26,7 +26,9 @@
 
 #include <algorithm>
 #include <cerrno>
+#include <climits>
 #include <sstream>
+#include <vector>
 
 #include <fcntl.h>
 #include <stdlib.h>
@@ -66,8 +68,14 @@
 #undef Realloc
 #undef Free
 #else  // POSIX-like platforms
+#include <dirent.h>
 #include <sys/mman.h>
+#include <sys/uio.h>
 #include <unistd.h>
+
+#ifndef IOV_MAX
+#define IOV_MAX 1024
+#endif
 #endif
 
 // POSIX systems do not have this
@@ -332,6 +340,111 @@ Status FileClose(int fd) {
   return Status::OK();
 }
 
+Status FileDelete(const PlatformFilename& file_name) {
+  int ret;
+
+#if defined(_MSC_VER)
+  ret = _wunlink(file_name.wstring().c_str());
+#else
+  ret = unlink(file_name.c_str());
+#endif
+
+  return CheckFileOpResult(ret, errno, file_name, "delete");
+}
+
+Status FileRename(const PlatformFilename& src, const PlatformFilename& dst) {
+  int ret;
+
+#if defined(_MSC_VER)
+  ret = _wrename(src.wstring().c_str(), dst.wstring().c_str());
+#else
+  ret = rename(src.c_str(), dst.c_str());
+#endif
+
+  return CheckFileOpResult(ret, errno, src, "rename");
+}
+
+Status FileStat(const PlatformFilename& file_name, io::FileStatistics* stat) {
+  int ret;
+
+#if defined(_MSC_VER)
+  struct _stat64 st;
+  ret = _wstat64(file_name.wstring().c_str(), &st);
+#else
+  struct stat st;
+  ret = ::stat(file_name.c_str(), &st);
+#endif
+
+  RETURN_NOT_OK(CheckFileOpResult(ret, errno, file_name, "stat"));
+  if (st.st_mode & S_IFDIR) {
+    stat->kind = io::ObjectType::DIRECTORY;
+    stat->size = 0;
+  } else {
+    stat->kind = io::ObjectType::FILE;
+    stat->size = static_cast<int64_t>(st.st_size);
+  }
+  return Status::OK();
+}
+
+//
+// Directories
+//
+
+Status DirectoryCreate(const PlatformFilename& dir_name) {
+  int ret;
+
+#if defined(_MSC_VER)
+  ret = _wmkdir(dir_name.wstring().c_str());
+#elif defined(__MINGW32__)
+  ret = mkdir(dir_name.c_str());
+#else
+  ret = mkdir(dir_name.c_str(), S_IRWXU | S_IRGRP | S_IXGRP | S_IROTH | S_IXOTH);
+#endif
+
+  return CheckFileOpResult(ret, errno, dir_name, "create directory");
+}
+
+Status DirectoryDelete(const PlatformFilename& dir_name) {
+  int ret;
+
+#if defined(_MSC_VER)
+  ret = _wrmdir(dir_name.wstring().c_str());
+#else
+  ret = rmdir(dir_name.c_str());
+#endif
+
+  return CheckFileOpResult(ret, errno, dir_name, "delete directory");
+}
+
+Status DirectoryList(const PlatformFilename& dir_name, std::vector<std::string>* names) {
+#if defined(_MSC_VER)
+  try {
+    for (const auto& entry : boost::filesystem::directory_iterator(dir_name)) {
+      names->push_back(entry.path().filename().string());
+    }
+  } catch (boost::filesystem::filesystem_error& e) {
+    return Status::IOError(e.what());
+  }
+#else
+  DIR* dir = opendir(dir_name.c_str());
+  if (dir == nullptr) {
+    return CheckFileOpResult(-1, errno, dir_name, "list directory");
+  }
+  errno = 0;
+  struct dirent* entry;
+  while ((entry = readdir(dir)) != nullptr) {
+    if (strcmp(entry->d_name, ".") != 0 && strcmp(entry->d_name, "..") != 0) {
+      names->push_back(entry->d_name);
+    }
+  }
+  const int errno_actual = errno;
+  closedir(dir);
+  RETURN_NOT_OK(CheckFileOpResult(errno_actual != 0 ? -1 : 0, errno_actual, dir_name,
+                                  "list directory"));
+#endif
+  return Status::OK();
+}
+
 //
 // Seeking and telling
 //
@@ -442,6 +555,11 @@ Status FileReadAt(int fd, uint8_t* buffer, int64_t position, int64_t nbytes,
         std::min(static_cast<int64_t>(ARROW_MAX_IO_CHUNKSIZE), nbytes - *bytes_read);
     int64_t ret = pread_compat(fd, buffer, chunksize, position);
 
+#ifndef _MSC_VER
+    if (ret == -1 && errno == EINTR) {
+      continue;
+    }
+#endif
     if (ret == -1) {
       *bytes_read = ret;
       break;
@@ -493,6 +611,49 @@ Status FileWrite(int fd, const uint8_t* buffer, const int64_t nbytes) {
   return Status::OK();
 }
 
+Status FileWritev(int fd, const std::vector<std::shared_ptr<Buffer>>& buffers) {
+#if defined(_WIN32)
+  for (const auto& buffer : buffers) {
+    RETURN_NOT_OK(FileWrite(fd, buffer->data(), buffer->size()));
+  }
+  return Status::OK();
+#else
+  std::vector<struct iovec> iovecs;
+  iovecs.reserve(buffers.size());
+  for (const auto& buffer : buffers) {
+    if (buffer->size() > 0) {
+      iovecs.push_back({const_cast<uint8_t*>(buffer->data()),
+                        static_cast<size_t>(buffer->size())});
+    }
+  }
+
+  // A call writes at most IOV_MAX buffers and may write only part of them, so
+  // keep on from where it stopped
+  size_t next = 0;
+  while (next < iovecs.size()) {
+    const int count = static_cast<int>(std::min<size_t>(iovecs.size() - next, IOV_MAX));
+    ssize_t ret = writev(fd, iovecs.data() + next, count);
+    if (ret == -1) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return Status::IOError(std::string("Error writing bytes from file: ") +
+                             std::string(strerror(errno)));
+    }
+    auto written = static_cast<size_t>(ret);
+    while (next < iovecs.size() && written >= iovecs[next].iov_len) {
+      written -= iovecs[next].iov_len;
+      ++next;
+    }
+    if (written > 0) {
+      iovecs[next].iov_base = static_cast<uint8_t*>(iovecs[next].iov_base) + written;
+      iovecs[next].iov_len -= written;
+    }
+  }
+  return Status::OK();
+#endif
+}
+
 Status FileTruncate(int fd, const int64_t size) {
   int ret, errno_actual;
 
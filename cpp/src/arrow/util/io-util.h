@@ -21,6 +21,7 @@
 #include <iostream>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "arrow/buffer.h"
 #include "arrow/io/interfaces.h"
@@ -153,6 +154,8 @@ Status FileRead(int fd, uint8_t* buffer, const int64_t nbytes, int64_t* bytes_re
 Status FileReadAt(int fd, uint8_t* buffer, int64_t position, int64_t nbytes,
                   int64_t* bytes_read);
 Status FileWrite(int fd, const uint8_t* buffer, const int64_t nbytes);
+// Write the buffers in order, with as few system calls as the platform allows
+Status FileWritev(int fd, const std::vector<std::shared_ptr<Buffer>>& buffers);
 Status FileTruncate(int fd, const int64_t size);
 
 Status FileTell(int fd, int64_t* pos);
@@ -162,6 +165,15 @@ Status FileGetSize(int fd, int64_t* size);
 
 Status FileClose(int fd);
 
+Status FileDelete(const PlatformFilename& file_name);
+Status FileRename(const PlatformFilename& src, const PlatformFilename& dst);
+Status FileStat(const PlatformFilename& file_name, io::FileStatistics* stat);
+
+Status DirectoryCreate(const PlatformFilename& dir_name);
+Status DirectoryDelete(const PlatformFilename& dir_name);
+// The names of the entries of a directory, "." and ".." excluded
+Status DirectoryList(const PlatformFilename& dir_name, std::vector<std::string>* names);
+
 Status CreatePipe(int fd[2]);
 
 Status MemoryMapRemap(void* addr, size_t old_size, size_t new_size, int fildes,
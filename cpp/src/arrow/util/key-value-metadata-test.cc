@@ -22,6 +22,7 @@
 
 #include <gtest/gtest.h>
 
+#include "arrow/test-util.h"
 #include "arrow/util/key_value_metadata.h"
 
 namespace arrow {
@@ -84,6 +85,50 @@ TEST(KeyValueMetadataTest, Copy) {
   ASSERT_TRUE(metadata.Equals(*metadata2));
 }
 
+TEST(KeyValueMetadataTest, CopyOnWrite) {
+  KeyValueMetadata metadata({"foo", "bar"}, {"bizz", "buzz"});
+  auto metadata2 = metadata.Copy();
+  ASSERT_EQ(&metadata.key(0), &metadata2->key(0));
+
+  // Appending to either copy leaves the other alone
+  metadata2->Append("purple", "orange");
+  metadata.Append("blue", "red");
+  ASSERT_EQ(3, metadata.size());
+  ASSERT_EQ(3, metadata2->size());
+  ASSERT_EQ("blue", metadata.key(2));
+  ASSERT_EQ("purple", metadata2->key(2));
+  ASSERT_EQ(-1, metadata.FindKey("purple"));
+  ASSERT_EQ(2, metadata2->FindKey("purple"));
+  ASSERT_FALSE(metadata.Equals(*metadata2));
+}
+
+TEST(KeyValueMetadataTest, FindKey) {
+  KeyValueMetadata metadata({"foo", "bar", "foo"}, {"bizz", "buzz", "fizz"});
+  ASSERT_EQ(0, metadata.FindKey("foo"));
+  ASSERT_EQ(1, metadata.FindKey("bar"));
+  ASSERT_EQ(-1, metadata.FindKey("baz"));
+  ASSERT_TRUE(metadata.Contains("bar"));
+  ASSERT_FALSE(metadata.Contains(""));
+
+  std::string value;
+  ASSERT_OK(metadata.Get("foo", &value));
+  ASSERT_EQ("bizz", value);
+  ASSERT_RAISES(KeyError, metadata.Get("baz", &value));
+
+  // Appended keys are found once the index is built
+  metadata.Append("baz", "bazz");
+  metadata.Append("bar", "bozz");
+  ASSERT_EQ(3, metadata.FindKey("baz"));
+  ASSERT_EQ(1, metadata.FindKey("bar"));
+
+  // And by the copies
+  auto metadata2 = metadata.Copy();
+  metadata2->Append("qux", "quux");
+  ASSERT_EQ(5, metadata2->FindKey("qux"));
+  ASSERT_EQ(3, metadata2->FindKey("baz"));
+  ASSERT_EQ(-1, metadata.FindKey("qux"));
+}
+
 TEST(KeyValueMetadataTest, Equals) {
   std::vector<std::string> keys = {"foo", "bar"};
   std::vector<std::string> values = {"bizz", "buzz"};
@@ -16,6 +16,7 @@
 // under the License.
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <sstream>
 #include <utility>
@@ -47,18 +48,98 @@ static std::vector<std::string> UnorderedMapValues(
   return values;
 }
 
-KeyValueMetadata::KeyValueMetadata() : keys_(), values_() {}
+// The pairs, shared between copies of the metadata. They are only modified
+// while unshared, and hold a hash index of the keys built on the first lookup.
+class KeyValueMetadata::Pairs {
+ public:
+  Pairs() : index_(nullptr) {}
+
+  Pairs(std::vector<std::string> keys, std::vector<std::string> values)
+      : keys_(std::move(keys)), values_(std::move(values)), index_(nullptr) {
+    DCHECK_EQ(keys_.size(), values_.size());
+  }
+
+  // Copies build their own index
+  Pairs(const Pairs& other)
+      : keys_(other.keys_), values_(other.values_), index_(nullptr) {}
+
+  ~Pairs() { delete index_.load(); }
+
+  Pairs& operator=(const Pairs&) = delete;
+
+  void Append(const std::string& key, const std::string& value) {
+    keys_.push_back(key);
+    values_.push_back(value);
+    Index* index = index_.load(std::memory_order_acquire);
+    if (index != nullptr) {
+      // Lookups find the first pair with a key
+      index->emplace(key, static_cast<int64_t>(keys_.size()) - 1);
+    }
+  }
+
+  void reserve(size_t n) {
+    keys_.reserve(n);
+    values_.reserve(n);
+  }
+
+  int64_t FindKey(const std::string& key) const {
+    const Index& index = GetIndex();
+    auto it = index.find(key);
+    return it == index.end() ? -1 : it->second;
+  }
+
+  const std::vector<std::string>& keys() const { return keys_; }
+  const std::vector<std::string>& values() const { return values_; }
+
+ private:
+  using Index = std::unordered_map<std::string, int64_t>;
+
+  const Index& GetIndex() const {
+    Index* index = index_.load(std::memory_order_acquire);
+    if (index != nullptr) {
+      return *index;
+    }
+    std::unique_ptr<Index> built(new Index());
+    built->reserve(keys_.size());
+    for (size_t i = 0; i < keys_.size(); ++i) {
+      built->emplace(keys_[i], static_cast<int64_t>(i));
+    }
+    // Another thread may have built the index meanwhile
+    if (index_.compare_exchange_strong(index, built.get(), std::memory_order_acq_rel)) {
+      index = built.release();
+    }
+    return *index;
+  }
+
+  std::vector<std::string> keys_;
+  std::vector<std::string> values_;
+  mutable std::atomic<Index*> index_;
+};
+
+KeyValueMetadata::KeyValueMetadata() : pairs_(std::make_shared<Pairs>()) {}
 
 KeyValueMetadata::KeyValueMetadata(
     const std::unordered_map<std::string, std::string>& map)
-    : keys_(UnorderedMapKeys(map)), values_(UnorderedMapValues(map)) {
-  DCHECK_EQ(keys_.size(), values_.size());
-}
+    : pairs_(std::make_shared<Pairs>(UnorderedMapKeys(map), UnorderedMapValues(map))) {}
 
 KeyValueMetadata::KeyValueMetadata(const std::vector<std::string>& keys,
                                    const std::vector<std::string>& values)
-    : keys_(keys), values_(values) {
-  DCHECK_EQ(keys.size(), values.size());
+    : pairs_(std::make_shared<Pairs>(keys, values)) {}
+
+KeyValueMetadata::KeyValueMetadata(std::vector<std::string>&& keys,
+                                   std::vector<std::string>&& values)
+    : pairs_(std::make_shared<Pairs>(std::move(keys), std::move(values))) {}
+
+KeyValueMetadata::KeyValueMetadata(const std::shared_ptr<Pairs>& pairs)
+    : pairs_(pairs) {}
+
+KeyValueMetadata::~KeyValueMetadata() = default;
+
+KeyValueMetadata::Pairs* KeyValueMetadata::MutablePairs() {
+  if (pairs_.use_count() > 1) {
+    pairs_ = std::make_shared<Pairs>(*pairs_);
+  }
+  return pairs_.get();
 }
 
 void KeyValueMetadata::ToUnorderedMap(
@@ -72,42 +153,58 @@ void KeyValueMetadata::ToUnorderedMap(
 }
 
 void KeyValueMetadata::Append(const std::string& key, const std::string& value) {
-  keys_.push_back(key);
-  values_.push_back(value);
+  MutablePairs()->Append(key, value);
 }
 
 void KeyValueMetadata::reserve(int64_t n) {
   DCHECK_GE(n, 0);
-  const auto m = static_cast<size_t>(n);
-  keys_.reserve(m);
-  values_.reserve(m);
+  MutablePairs()->reserve(static_cast<size_t>(n));
 }
 
 int64_t KeyValueMetadata::size() const {
-  DCHECK_EQ(keys_.size(), values_.size());
-  return static_cast<int64_t>(keys_.size());
+  return static_cast<int64_t>(pairs_->keys().size());
 }
 
-std::string KeyValueMetadata::key(int64_t i) const {
+const std::string& KeyValueMetadata::key(int64_t i) const {
   DCHECK_GE(i, 0);
-  DCHECK_LT(static_cast<size_t>(i), keys_.size());
-  return keys_[i];
+  DCHECK_LT(static_cast<size_t>(i), pairs_->keys().size());
+  return pairs_->keys()[i];
 }
 
-std::string KeyValueMetadata::value(int64_t i) const {
+const std::string& KeyValueMetadata::value(int64_t i) const {
   DCHECK_GE(i, 0);
-  DCHECK_LT(static_cast<size_t>(i), values_.size());
-  return values_[i];
+  DCHECK_LT(static_cast<size_t>(i), pairs_->values().size());
+  return pairs_->values()[i];
+}
+
+const std::vector<std::string>& KeyValueMetadata::keys() const {
+  return pairs_->keys();
+}
+
+const std::vector<std::string>& KeyValueMetadata::values() const {
+  return pairs_->values();
+}
+
+int64_t KeyValueMetadata::FindKey(const std::string& key) const {
+  return pairs_->FindKey(key);
+}
+
+Status KeyValueMetadata::Get(const std::string& key, std::string* out) const {
+  const int64_t i = FindKey(key);
+  if (i < 0) {
+    return Status::KeyError("Key not found in metadata: " + key);
+  }
+  *out = value(i);
+  return Status::OK();
 }
 
 std::shared_ptr<KeyValueMetadata> KeyValueMetadata::Copy() const {
-  return std::make_shared<KeyValueMetadata>(keys_, values_);
+  return std::shared_ptr<KeyValueMetadata>(new KeyValueMetadata(pairs_));
 }
 
 bool KeyValueMetadata::Equals(const KeyValueMetadata& other) const {
-  return size() == other.size() &&
-         std::equal(keys_.cbegin(), keys_.cend(), other.keys_.cbegin()) &&
-         std::equal(values_.cbegin(), values_.cend(), other.values_.cbegin());
+  return this == &other || pairs_ == other.pairs_ ||
+         (keys() == other.keys() && values() == other.values());
 }
 
 std::string KeyValueMetadata::ToString() const {
@@ -115,7 +212,7 @@ std::string KeyValueMetadata::ToString() const {
 
   buffer << "\n-- metadata --";
   for (int64_t i = 0; i < size(); ++i) {
-    buffer << "\n" << keys_[i] << ": " << values_[i];
+    buffer << "\n" << key(i) << ": " << value(i);
   }
 
   return buffer.str();
@@ -24,18 +24,25 @@
 #include <unordered_map>
 #include <vector>
 
+#include "arrow/status.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
 
+/// \brief An ordered sequence of string key-value pairs
+///
+/// The pairs are held in a shared representation: Copy() shares it, and it
+/// is only copied when a shared instance is appended to. Keys are looked up
+/// through a hash index, built on the first lookup.
 class ARROW_EXPORT KeyValueMetadata {
  public:
   KeyValueMetadata();
   KeyValueMetadata(const std::vector<std::string>& keys,
                    const std::vector<std::string>& values);
+  KeyValueMetadata(std::vector<std::string>&& keys, std::vector<std::string>&& values);
   explicit KeyValueMetadata(const std::unordered_map<std::string, std::string>& map);
-  virtual ~KeyValueMetadata() = default;
+  virtual ~KeyValueMetadata();
 
   void ToUnorderedMap(std::unordered_map<std::string, std::string>* out) const;
 
@@ -44,17 +51,39 @@ class ARROW_EXPORT KeyValueMetadata {
   void reserve(int64_t n);
   int64_t size() const;
 
-  std::string key(int64_t i) const;
-  std::string value(int64_t i) const;
+  const std::string& key(int64_t i) const;
+  const std::string& value(int64_t i) const;
+
+  const std::vector<std::string>& keys() const;
+  const std::vector<std::string>& values() const;
+
+  /// \brief The index of the first pair with the given key, or -1 if there
+  /// is none
+  int64_t FindKey(const std::string& key) const;
+
+  /// \brief Whether a pair has the given key
+  bool Contains(const std::string& key) const { return FindKey(key) >= 0; }
 
+  /// \brief The value of the first pair with the given key
+  ///
+  /// \return KeyError if no pair has the key
+  Status Get(const std::string& key, std::string* out) const;
+
+  /// \brief A copy sharing the pairs of this instance
   std::shared_ptr<KeyValueMetadata> Copy() const;
 
   bool Equals(const KeyValueMetadata& other) const;
   std::string ToString() const;
 
  private:
-  std::vector<std::string> keys_;
-  std::vector<std::string> values_;
+  class Pairs;
+
+  explicit KeyValueMetadata(const std::shared_ptr<Pairs>& pairs);
+
+  // Make the pairs unshared before they are modified
+  Pairs* MutablePairs();
+
+  std::shared_ptr<Pairs> pairs_;
 
   ARROW_DISALLOW_COPY_AND_ASSIGN(KeyValueMetadata);
 };
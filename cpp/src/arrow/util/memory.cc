@@ -0,0 +1,217 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/memory.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/cpu-info.h"
+#include "arrow/util/task-group.h"
+#include "arrow/util/thread-pool.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define ARROW_HAVE_SSE2 1
+#endif
+
+namespace arrow {
+namespace internal {
+
+namespace {
+
+// Below this, a thread doesn't pay for its scheduling
+constexpr int64_t kMinBytesPerThread = 1 << 20;
+
+int64_t LastLevelCacheSize() {
+  if (!CpuInfo::initialized()) {
+    CpuInfo::Init();
+  }
+  return CpuInfo::CacheSize(CpuInfo::L3_CACHE);
+}
+
+void CopyChunk(uint8_t* dst, const uint8_t* src, int64_t nbytes, bool streaming) {
+  if (streaming) {
+    StreamingMemcopy(dst, src, nbytes);
+  } else {
+    std::memcpy(dst, src, nbytes);
+  }
+}
+
+// Copy in num_threads chunks, all but the first on the CPU thread pool.
+// Chunks start at cache line boundaries of the destination, so that no two
+// threads write the same line.
+void CopyInChunks(uint8_t* dst, const uint8_t* src, int64_t nbytes, int num_threads,
+                  bool streaming) {
+  constexpr uintptr_t kLineSize = 64;
+  const uintptr_t base = reinterpret_cast<uintptr_t>(dst);
+  const int64_t chunk_size = (nbytes + num_threads - 1) / num_threads;
+  const auto chunk_begin = [=](int i) {
+    const uintptr_t aligned = (base + i * chunk_size + kLineSize - 1) & ~(kLineSize - 1);
+    return std::min(nbytes, static_cast<int64_t>(aligned - base));
+  };
+
+  TaskGroup group;
+  for (int i = 1; i < num_threads; ++i) {
+    const int64_t begin = chunk_begin(i);
+    const int64_t length = chunk_begin(i + 1) - begin;
+    group.Append([=] {
+      CopyChunk(dst + begin, src + begin, length, streaming);
+      return Status::OK();
+    });
+  }
+  CopyChunk(dst, src, chunk_begin(1), streaming);
+  ARROW_UNUSED(group.Finish());
+}
+
+// The smallest number of threads within 10% of the best copy bandwidth, on
+// copies large enough to miss the caches
+int CalibrateMemcopyThreads() {
+  const int capacity = GetCpuThreadPoolCapacity();
+  if (capacity <= 1) {
+    return 1;
+  }
+  constexpr int64_t kCopySize = 32 << 20;
+  std::unique_ptr<uint8_t[]> src(new uint8_t[kCopySize]);
+  std::unique_ptr<uint8_t[]> dst(new uint8_t[kCopySize]);
+  // Fault the pages in beforehand
+  std::memset(src.get(), 1, kCopySize);
+  std::memset(dst.get(), 0, kCopySize);
+
+  std::vector<std::pair<int, double>> timings;
+  for (int threads = 1;; threads = std::min(threads * 2, capacity)) {
+    double best = 0;
+    for (int run = 0; run < 2; ++run) {
+      const auto start = std::chrono::steady_clock::now();
+      CopyInChunks(dst.get(), src.get(), kCopySize, threads, false);
+      const std::chrono::duration<double> elapsed =
+          std::chrono::steady_clock::now() - start;
+      best = run == 0 ? elapsed.count() : std::min(best, elapsed.count());
+    }
+    timings.emplace_back(threads, best);
+    if (threads == capacity) {
+      break;
+    }
+  }
+  double fastest = timings[0].second;
+  for (const auto& timing : timings) {
+    fastest = std::min(fastest, timing.second);
+  }
+  for (const auto& timing : timings) {
+    if (timing.second <= fastest * 1.1) {
+      return timing.first;
+    }
+  }
+  return 1;
+}
+
+}  // namespace
+
+void StreamingMemcopy(uint8_t* dst, const uint8_t* src, int64_t nbytes) {
+#ifdef ARROW_HAVE_SSE2
+  // Up to a 16-byte boundary of the destination, as streaming stores must be
+  // aligned
+  const int64_t head = std::min(
+      nbytes, static_cast<int64_t>((16 - (reinterpret_cast<uintptr_t>(dst) & 15)) & 15));
+  std::memcpy(dst, src, head);
+  int64_t i = head;
+  for (; i + 64 <= nbytes; i += 64) {
+    const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 16));
+    const __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 32));
+    const __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 48));
+    _mm_stream_si128(reinterpret_cast<__m128i*>(dst + i), a);
+    _mm_stream_si128(reinterpret_cast<__m128i*>(dst + i + 16), b);
+    _mm_stream_si128(reinterpret_cast<__m128i*>(dst + i + 32), c);
+    _mm_stream_si128(reinterpret_cast<__m128i*>(dst + i + 48), d);
+  }
+  // Order the streaming stores before any later store, as other threads
+  // may read the destination once the copy is done
+  _mm_sfence();
+  std::memcpy(dst + i, src + i, nbytes - i);
+#else
+  std::memcpy(dst, src, nbytes);
+#endif
+}
+
+int GetBulkMemcopyMaxThreads() {
+  static const int max_threads = CalibrateMemcopyThreads();
+  return max_threads;
+}
+
+void BulkMemcopy(uint8_t* dst, const uint8_t* src, int64_t nbytes) {
+  if (nbytes < 2 * kMinBytesPerThread) {
+    std::memcpy(dst, src, nbytes);
+    return;
+  }
+  const bool streaming = nbytes > LastLevelCacheSize();
+  const int num_threads = static_cast<int>(
+      std::min<int64_t>(GetBulkMemcopyMaxThreads(), nbytes / kMinBytesPerThread));
+  if (num_threads <= 1) {
+    CopyChunk(dst, src, nbytes, streaming);
+  } else {
+    CopyInChunks(dst, src, nbytes, num_threads, streaming);
+  }
+}
+
+static uint8_t* pointer_logical_and(const uint8_t* address, uintptr_t bits) {
+  uintptr_t value = reinterpret_cast<uintptr_t>(address);
+  return reinterpret_cast<uint8_t*>(value & bits);
+}
+
+void parallel_memcopy(uint8_t* dst, const uint8_t* src, int64_t nbytes,
+                      uintptr_t block_size, int num_threads) {
+  const bool streaming = nbytes > LastLevelCacheSize();
+
+  uint8_t* left = pointer_logical_and(src + block_size - 1, ~(block_size - 1));
+  uint8_t* right = pointer_logical_and(src + nbytes, ~(block_size - 1));
+  int64_t num_blocks = (right - left) / block_size;
+
+  // Update right address
+  right = right - (num_blocks % num_threads) * block_size;
+
+  // Now we divide these blocks between available threads. The remainder is
+  // handled separately.
+  int64_t chunk_size = (right - left) / num_threads;
+  int64_t prefix = left - src;
+  int64_t suffix = src + nbytes - right;
+  // Now the data layout is | prefix | k * num_threads * block_size | suffix |.
+  // We have chunk_size = k * block_size, therefore the data layout is
+  // | prefix | num_threads * chunk_size | suffix |.
+  // Each thread gets a "chunk" of k blocks.
+
+  // Start all parallel memcpy tasks and handle leftovers while threads run.
+  TaskGroup group;
+  for (int i = 0; i < num_threads; i++) {
+    group.Append([=] {
+      CopyChunk(dst + prefix + i * chunk_size, left + i * chunk_size, chunk_size,
+                streaming);
+      return Status::OK();
+    });
+  }
+  memcpy(dst, src, prefix);
+  memcpy(dst + prefix + num_threads * chunk_size, right, suffix);
+  ARROW_UNUSED(group.Finish());
+}
+
+}  // namespace internal
+}  // namespace arrow
@@ -18,57 +18,31 @@
 #ifndef ARROW_UTIL_MEMORY_H
 #define ARROW_UTIL_MEMORY_H
 
-#include <thread>
-#include <vector>
+#include <cstdint>
 
-#include "arrow/util/thread-pool.h"
+#include "arrow/util/visibility.h"
 
 namespace arrow {
 namespace internal {
 
-uint8_t* pointer_logical_and(const uint8_t* address, uintptr_t bits) {
-  uintptr_t value = reinterpret_cast<uintptr_t>(address);
-  return reinterpret_cast<uint8_t*>(value & bits);
-}
-
 // A helper function for doing memcpy with multiple threads. This is required
 // to saturate the memory bandwidth of modern cpus.
-void parallel_memcopy(uint8_t* dst, const uint8_t* src, int64_t nbytes,
-                      uintptr_t block_size, int num_threads) {
-  // XXX This function is really using `num_threads + 1` threads.
-  auto pool = GetCpuThreadPool();
-
-  uint8_t* left = pointer_logical_and(src + block_size - 1, ~(block_size - 1));
-  uint8_t* right = pointer_logical_and(src + nbytes, ~(block_size - 1));
-  int64_t num_blocks = (right - left) / block_size;
-
-  // Update right address
-  right = right - (num_blocks % num_threads) * block_size;
-
-  // Now we divide these blocks between available threads. The remainder is
-  // handled separately.
-  int64_t chunk_size = (right - left) / num_threads;
-  int64_t prefix = left - src;
-  int64_t suffix = src + nbytes - right;
-  // Now the data layout is | prefix | k * num_threads * block_size | suffix |.
-  // We have chunk_size = k * block_size, therefore the data layout is
-  // | prefix | num_threads * chunk_size | suffix |.
-  // Each thread gets a "chunk" of k blocks.
-
-  // Start all parallel memcpy tasks and handle leftovers while threads run.
-  std::vector<std::future<void*>> futures;
-
-  for (int i = 0; i < num_threads; i++) {
-    futures.push_back(pool->Submit(memcpy, dst + prefix + i * chunk_size,
-                                   left + i * chunk_size, chunk_size));
-  }
-  memcpy(dst, src, prefix);
-  memcpy(dst + prefix + num_threads * chunk_size, right, suffix);
-
-  for (auto& fut : futures) {
-    fut.get();
-  }
-}
+ARROW_EXPORT void parallel_memcopy(uint8_t* dst, const uint8_t* src, int64_t nbytes,
+                                   uintptr_t block_size, int num_threads);
+
+// Copy memory as fast as the machine allows, choosing the number of threads
+// from the size of the copy and the memory bandwidth of the machine.  Copies
+// larger than the last level cache bypass it with non-temporal stores, so as
+// not to evict the data of every other thread.
+ARROW_EXPORT void BulkMemcopy(uint8_t* dst, const uint8_t* src, int64_t nbytes);
+
+// The most threads BulkMemcopy uses: those beyond which copying gets no
+// faster, as measured once on first use.
+ARROW_EXPORT int GetBulkMemcopyMaxThreads();
+
+// Copy with non-temporal stores, leaving the destination out of the caches
+// (x86 only, elsewhere a plain memcpy).
+ARROW_EXPORT void StreamingMemcopy(uint8_t* dst, const uint8_t* src, int64_t nbytes);
 
 }  // namespace internal
 }  // namespace arrow
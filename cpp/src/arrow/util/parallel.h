@@ -24,26 +24,23 @@
 #include <vector>
 
 #include "arrow/status.h"
+#include "arrow/util/task-group.h"
 #include "arrow/util/thread-pool.h"
 
 namespace arrow {
 
 // A parallelizer that takes a `Status(int)` function and calls it with
 // arguments between 0 and `num_tasks - 1`, on an arbitrary number of threads.
+// Once a call fails, the calls not yet started are skipped and the first
+// error is returned.
 
 template <class FUNCTION>
 Status ParallelFor(int num_tasks, FUNCTION&& func) {
-  auto pool = internal::GetCpuThreadPool();
-  std::vector<std::future<Status>> futures(num_tasks);
-
-  for (int i = 0; i < num_tasks; ++i) {
-    futures[i] = pool->Submit(func, i);
-  }
-  auto st = Status::OK();
-  for (auto& fut : futures) {
-    st &= fut.get();
+  internal::TaskGroup group;
+  for (int i = 0; i < num_tasks && group.ok(); ++i) {
+    group.Append([&func, i] { return func(i); });
   }
-  return st;
+  return group.Finish();
 }
 
 // A variant of ParallelFor() with an explicit number of dedicated threads.
@@ -0,0 +1,170 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "arrow/util/parsing.h"
+
+namespace arrow {
+namespace internal {
+
+template <typename T>
+void AssertParsesInteger(const std::string& s, T expected) {
+  T value = 0;
+  ASSERT_TRUE(ParseInteger(s.data(), s.length(), &value)) << s;
+  ASSERT_EQ(expected, value) << s;
+}
+
+template <typename T>
+void AssertParsesFloat(const std::string& s, T expected) {
+  T value = 0;
+  ASSERT_TRUE(ParseFloat(s.data(), s.length(), &value)) << s;
+  ASSERT_EQ(expected, value) << s;
+}
+
+template <typename T>
+void AssertInvalid(const std::string& s) {
+  T value;
+  ASSERT_FALSE(ParseInteger(s.data(), s.length(), &value)) << s;
+}
+
+template <typename T>
+void AssertInvalidFloat(const std::string& s) {
+  T value;
+  ASSERT_FALSE(ParseFloat(s.data(), s.length(), &value)) << s;
+}
+
+TEST(ParseInteger, Bounds) {
+  AssertParsesInteger<int8_t>("-128", -128);
+  AssertParsesInteger<int8_t>("127", 127);
+  AssertInvalid<int8_t>("128");
+  AssertInvalid<int8_t>("-129");
+  AssertParsesInteger<uint8_t>("255", 255);
+  AssertInvalid<uint8_t>("256");
+  AssertInvalid<uint8_t>("-0");
+
+  AssertParsesInteger<int64_t>("-9223372036854775808",
+                               std::numeric_limits<int64_t>::min());
+  AssertParsesInteger<int64_t>("9223372036854775807",
+                               std::numeric_limits<int64_t>::max());
+  AssertInvalid<int64_t>("9223372036854775808");
+  AssertParsesInteger<uint64_t>("18446744073709551615",
+                                std::numeric_limits<uint64_t>::max());
+  AssertInvalid<uint64_t>("18446744073709551616");
+  AssertInvalid<uint64_t>("99999999999999999999");
+  AssertInvalid<uint64_t>("100000000000000000000");
+}
+
+TEST(ParseInteger, Format) {
+  AssertParsesInteger<int32_t>("0", 0);
+  AssertParsesInteger<int32_t>("-0", 0);
+  AssertParsesInteger<uint64_t>("000000000000000000000000042", 42);
+  AssertInvalid<int32_t>("");
+  AssertInvalid<int32_t>("-");
+  AssertInvalid<int32_t>("+1");
+  AssertInvalid<int32_t>(" 1");
+  AssertInvalid<int32_t>("1 ");
+  AssertInvalid<int32_t>("1a");
+  AssertInvalid<int32_t>("1.0");
+}
+
+TEST(ParseFloat, Values) {
+  AssertParsesFloat<double>("0", 0.0);
+  AssertParsesFloat<double>("-1.25", -1.25);
+  AssertParsesFloat<double>("+.5", 0.5);
+  AssertParsesFloat<double>("5.", 5.0);
+  AssertParsesFloat<double>("0.1", 0.1);
+  AssertParsesFloat<double>("1e22", 1e22);
+  AssertParsesFloat<double>("1.7976931348623157e308", 1.7976931348623157e308);
+  AssertParsesFloat<double>("4.9e-324", 4.9e-324);
+  AssertParsesFloat<double>("0.000000000000000000000000000001", 1e-30);
+  AssertParsesFloat<double>("12345678901234567890123", 12345678901234567890123.0);
+  AssertParsesFloat<double>("-inf", -INFINITY);
+  AssertParsesFloat<float>("0.1", 0.1f);
+  AssertParsesFloat<float>("16777217", 16777217.0f);
+  AssertParsesFloat<float>("1.17549435e-38", 1.17549435e-38f);
+
+  double value;
+  ASSERT_TRUE(ParseFloat("nan", 3, &value));
+  ASSERT_TRUE(std::isnan(value));
+  ASSERT_TRUE(ParseFloat("-0", 2, &value));
+  ASSERT_TRUE(std::signbit(value));
+}
+
+TEST(ParseFloat, Format) {
+  AssertInvalidFloat<double>("");
+  AssertInvalidFloat<double>(".");
+  AssertInvalidFloat<double>("-");
+  AssertInvalidFloat<double>(" 1");
+  AssertInvalidFloat<double>("1 ");
+  AssertInvalidFloat<double>("1e");
+  AssertInvalidFloat<double>("1e+");
+  AssertInvalidFloat<double>("1.2.3");
+  AssertInvalidFloat<double>("0x1p3");
+  AssertInvalidFloat<double>("infinit");
+}
+
+TEST(ParseTimestamp, Values) {
+  int64_t value;
+  ASSERT_TRUE(ParseTimestamp("1970-01-01", 10, TimeUnit::SECOND, &value));
+  ASSERT_EQ(0, value);
+  ASSERT_TRUE(ParseTimestamp("1970-01-02T00:00:01Z", 20, TimeUnit::MILLI, &value));
+  ASSERT_EQ(86401000, value);
+  ASSERT_TRUE(ParseTimestamp("1900-03-01 00:00:00", 19, TimeUnit::SECOND, &value));
+  ASSERT_EQ(-2203891200LL, value);
+  ASSERT_TRUE(ParseTimestamp("2262-04-11T23:47:16", 19, TimeUnit::NANO, &value));
+  ASSERT_EQ(9223372036000000000LL, value);
+  ASSERT_FALSE(ParseTimestamp("2262-04-11T23:47:17", 19, TimeUnit::NANO, &value));
+
+  ASSERT_EQ(0, DaysSinceEpoch(1970, 1, 1));
+  ASSERT_EQ(-719528, DaysSinceEpoch(0, 1, 1));
+  ASSERT_EQ(2932896, DaysSinceEpoch(9999, 12, 31));
+}
+
+TEST(ParseTimestamp, Format) {
+  const char* invalid[] = {"",
+                           "1970-01-0",
+                           "1970-01-011",
+                           "1970/01/01",
+                           "197a-01-01",
+                           "1970-0:-01",
+                           "1970-01-01T00:00",
+                           "1970-01-01t00:00:00",
+                           "1970-01-01T00-00-00",
+                           "1970-01-01T0 :00:00",
+                           "1970-00-01",
+                           "1970-01-00",
+                           "1900-02-29",
+                           "1970-04-31",
+                           "1970-01-01T23:60:00",
+                           "1970-01-01T23:00:60"};
+  for (const char* s : invalid) {
+    int64_t value;
+    ASSERT_FALSE(ParseTimestamp(s, std::strlen(s), TimeUnit::SECOND, &value)) << s;
+  }
+  int64_t value;
+  ASSERT_TRUE(ParseTimestamp("2000-02-29", 10, TimeUnit::SECOND, &value));
+}
+
+}  // namespace internal
+}  // namespace arrow
@@ -0,0 +1,328 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Parsing of values from text that is not null-terminated, such as the
+// values of a StringArray. Every function returns false if the whole of the
+// text is not a value of the requested type, leading or trailing whitespace
+// included.
+
+#ifndef ARROW_UTIL_PARSING_H
+#define ARROW_UTIL_PARSING_H
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <type_traits>
+
+#include "arrow/type.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/util/macros.h"
+
+namespace arrow {
+namespace internal {
+
+namespace detail {
+
+inline bool ParseDigit(char c, uint8_t* out) {
+  *out = static_cast<uint8_t>(c - '0');
+  return *out <= 9;
+}
+
+// Whether the characters of s[0, 8) selected by mask, a byte of 0xff each,
+// are decimal digits. The eight are tested at once: a digit has a high nibble
+// of 3 and stays so when 6 is added to it.
+inline bool AreDigits(const char* s, uint64_t mask) {
+  uint64_t word;
+  std::memcpy(&word, s, sizeof(word));
+  word = BitUtil::FromLittleEndian(word);
+  const uint64_t high = 0xf0f0f0f0f0f0f0f0ULL & mask;
+  const uint64_t zeros = 0x3030303030303030ULL & mask;
+  const uint64_t sixes = 0x0606060606060606ULL & mask;
+  return (word & high) == zeros && ((word + sixes) & high) == zeros;
+}
+
+template <typename T>
+struct FloatParsing {};
+
+// Integers up to kMaxExactMantissa and powers of ten up to kMaxExactPower are
+// exact in the floating point type, so that their product or quotient is
+// correctly rounded
+template <>
+struct FloatParsing<double> {
+  static constexpr uint64_t kMaxExactMantissa = 1ULL << 53;
+  static constexpr int kMaxExactPower = 22;
+
+  static double Parse(const char* s, char** end) { return std::strtod(s, end); }
+};
+
+template <>
+struct FloatParsing<float> {
+  static constexpr uint64_t kMaxExactMantissa = 1ULL << 24;
+  static constexpr int kMaxExactPower = 10;
+
+  static float Parse(const char* s, char** end) { return std::strtof(s, end); }
+};
+
+template <typename T>
+inline T ExactPowerOfTen(int exponent) {
+  static const T kPowers[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+                              1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                              1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+  return kPowers[exponent];
+}
+
+// Through the C library, from a null-terminated copy
+template <typename T>
+bool ParseFloatSlow(const char* s, size_t length, T* out) {
+  if (length == 0 || s[0] == ' ' || (s[0] >= '\t' && s[0] <= '\r')) {
+    return false;
+  }
+  const std::string copy(s, length);
+  char* end;
+  *out = FloatParsing<T>::Parse(copy.c_str(), &end);
+  return end == copy.c_str() + length;
+}
+
+}  // namespace detail
+
+/// \brief Parse the decimal digits of s, without a sign
+template <typename T>
+typename std::enable_if<std::is_unsigned<T>::value, bool>::type ParseUnsigned(
+    const char* s, size_t length, T* out) {
+  if (length == 0) {
+    return false;
+  }
+  // Leading zeros don't count towards the 20 digits of the largest uint64_t
+  size_t i = 0;
+  while (i < length - 1 && s[i] == '0') {
+    ++i;
+  }
+  if (length - i > 20) {
+    return false;
+  }
+  // Up to 19 digits can't overflow
+  const size_t end = std::min(length, i + 19);
+  uint64_t value = 0;
+  uint8_t digit;
+  for (; i < end; ++i) {
+    if (ARROW_PREDICT_FALSE(!detail::ParseDigit(s[i], &digit))) {
+      return false;
+    }
+    value = value * 10 + digit;
+  }
+  if (i < length) {
+    if (!detail::ParseDigit(s[i], &digit) ||
+        value > (std::numeric_limits<uint64_t>::max() - digit) / 10) {
+      return false;
+    }
+    value = value * 10 + digit;
+  }
+  if (value > std::numeric_limits<T>::max()) {
+    return false;
+  }
+  *out = static_cast<T>(value);
+  return true;
+}
+
+/// \brief Parse a decimal integer, with a leading '-' if negative
+template <typename T>
+typename std::enable_if<std::is_integral<T>::value, bool>::type ParseInteger(
+    const char* s, size_t length, T* out) {
+  using U = typename std::make_unsigned<T>::type;
+
+  const bool negative = std::is_signed<T>::value && length > 0 && s[0] == '-';
+  U magnitude;
+  if (!ParseUnsigned(s + negative, length - negative, &magnitude)) {
+    return false;
+  }
+  // The magnitude of the minimum of a signed type is one more than the maximum
+  const uint64_t limit =
+      static_cast<uint64_t>(std::numeric_limits<T>::max()) + (negative ? 1 : 0);
+  if (magnitude > limit) {
+    return false;
+  }
+  *out = negative ? static_cast<T>(static_cast<U>(~magnitude + 1))
+                  : static_cast<T>(magnitude);
+  return true;
+}
+
+/// \brief Parse a floating point number as strtod does, but not hexadecimal
+/// ones, nor with leading whitespace
+///
+/// Decimals with up to 19 significant digits and a small exponent, the common
+/// case, are converted by a single correctly rounded multiplication or
+/// division; the C library converts the others.
+template <typename T>
+typename std::enable_if<std::is_floating_point<T>::value, bool>::type ParseFloat(
+    const char* s, size_t length, T* out) {
+  size_t i = 0;
+  bool negative = false;
+  if (i < length && (s[i] == '-' || s[i] == '+')) {
+    negative = s[i] == '-';
+    ++i;
+  }
+
+  uint64_t mantissa = 0;
+  int num_digits = 0;
+  int exponent = 0;
+  bool has_digits = false;
+  uint8_t digit;
+  for (; i < length && detail::ParseDigit(s[i], &digit); ++i) {
+    if (++num_digits > 19) {
+      return detail::ParseFloatSlow(s, length, out);
+    }
+    mantissa = mantissa * 10 + digit;
+    num_digits -= mantissa == 0;
+    has_digits = true;
+  }
+  if (i < length && s[i] == '.') {
+    for (++i; i < length && detail::ParseDigit(s[i], &digit); ++i) {
+      if (++num_digits > 19) {
+        return detail::ParseFloatSlow(s, length, out);
+      }
+      mantissa = mantissa * 10 + digit;
+      num_digits -= mantissa == 0;
+      --exponent;
+      has_digits = true;
+    }
+  }
+  if (!has_digits) {
+    // Infinities and NaNs
+    return detail::ParseFloatSlow(s, length, out);
+  }
+  if (i < length && (s[i] == 'e' || s[i] == 'E')) {
+    ++i;
+    bool negative_exponent = false;
+    if (i < length && (s[i] == '-' || s[i] == '+')) {
+      negative_exponent = s[i] == '-';
+      ++i;
+    }
+    if (i == length) {
+      return false;
+    }
+    int explicit_exponent = 0;
+    for (; i < length && detail::ParseDigit(s[i], &digit); ++i) {
+      explicit_exponent = std::min(explicit_exponent * 10 + digit, 100000);
+    }
+    exponent += negative_exponent ? -explicit_exponent : explicit_exponent;
+  }
+  if (i != length) {
+    return false;
+  }
+
+  using Parsing = detail::FloatParsing<T>;
+  if (mantissa > Parsing::kMaxExactMantissa || exponent > Parsing::kMaxExactPower ||
+      exponent < -Parsing::kMaxExactPower) {
+    return detail::ParseFloatSlow(s, length, out);
+  }
+  T value = static_cast<T>(mantissa);
+  if (exponent < 0) {
+    value /= detail::ExactPowerOfTen<T>(-exponent);
+  } else {
+    value *= detail::ExactPowerOfTen<T>(exponent);
+  }
+  *out = negative ? -value : value;
+  return true;
+}
+
+/// \brief The days from 1970-01-01 to a date of the proleptic Gregorian
+/// calendar
+inline int64_t DaysSinceEpoch(int64_t year, int64_t month, int64_t day) {
+  // Counting from March 1st of year 0, in eras of 400 years
+  year -= month <= 2;
+  const int64_t era = (year >= 0 ? year : year - 399) / 400;
+  const int64_t year_of_era = year - era * 400;
+  const int64_t day_of_year = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+  const int64_t day_of_era =
+      year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+  return era * 146097 + day_of_era - 719468;
+}
+
+/// \brief Parse an ISO-8601 date or date and time, as "YYYY-MM-DD" or
+/// "YYYY-MM-DDThh:mm:ss", optionally followed by 'Z', into a count of units
+/// since the UNIX epoch
+///
+/// The date and time may also be separated by a space. Times are taken to be
+/// UTC; fractions of seconds and time zone offsets are not supported.
+inline bool ParseTimestamp(const char* s, size_t length, TimeUnit::type unit,
+                           int64_t* out) {
+  // The digits of "YYYY-MM-" and of "YY-MM-DD", "DDThh:mm" and "hh:mm:ss"
+  constexpr uint64_t kYearMonthDigits = 0x00ffff00ffffffffULL;
+  constexpr uint64_t kPairsDigits = 0xffff00ffff00ffffULL;
+
+  if (length > 0 && s[length - 1] == 'Z') {
+    --length;
+  }
+  if (length != 10 && length != 19) {
+    return false;
+  }
+  if (!detail::AreDigits(s, kYearMonthDigits) ||
+      !detail::AreDigits(s + 2, kPairsDigits) || s[4] != '-' || s[7] != '-') {
+    return false;
+  }
+  const auto value = [s](int position, int num_digits) {
+    int64_t result = 0;
+    for (int i = position; i < position + num_digits; ++i) {
+      result = result * 10 + (s[i] - '0');
+    }
+    return result;
+  };
+
+  const int64_t year = value(0, 4);
+  const int64_t month = value(5, 2);
+  const int64_t day = value(8, 2);
+  static const int64_t kDaysInMonth[] = {31, 28, 31, 30, 31, 30,
+                                         31, 31, 30, 31, 30, 31};
+  const bool is_leap = (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+  if (month < 1 || month > 12 || day < 1 ||
+      day > kDaysInMonth[month - 1] + (month == 2 && is_leap)) {
+    return false;
+  }
+  int64_t seconds = DaysSinceEpoch(year, month, day) * 86400;
+
+  if (length == 19) {
+    if ((s[10] != 'T' && s[10] != ' ') || s[13] != ':' || s[16] != ':' ||
+        !detail::AreDigits(s + 8, kPairsDigits) ||
+        !detail::AreDigits(s + 11, kPairsDigits)) {
+      return false;
+    }
+    const int64_t hours = value(11, 2);
+    const int64_t minutes = value(14, 2);
+    const int64_t secs = value(17, 2);
+    if (hours > 23 || minutes > 59 || secs > 59) {
+      return false;
+    }
+    seconds += hours * 3600 + minutes * 60 + secs;
+  }
+
+  static const int64_t kUnitsPerSecond[] = {1, 1000, 1000000, 1000000000};
+  const int64_t factor = kUnitsPerSecond[static_cast<int>(unit)];
+  if (seconds > std::numeric_limits<int64_t>::max() / factor ||
+      seconds < std::numeric_limits<int64_t>::min() / factor) {
+    return false;
+  }
+  *out = seconds * factor;
+  return true;
+}
+
+}  // namespace internal
+}  // namespace arrow
+
+#endif  // ARROW_UTIL_PARSING_H
@@ -28,6 +28,9 @@
 
 #include "arrow/util/bit-stream-utils.h"
 #include "arrow/util/bit-util.h"
+#include "arrow/util/bpacking-simd.h"
+#include "arrow/util/bpacking.h"
+#include "arrow/util/cpu-info.h"
 #include "arrow/util/rle-encoding.h"
 
 using std::vector;
@@ -464,4 +467,96 @@ TEST(BitRle, Overflow) {
   }
 }
 
+
+// Runs the function with and without the AVX2 kernels, when the CPU has them
+template <typename FUNCTION>
+void WithAndWithoutAvx2(FUNCTION&& func) {
+  CpuInfo::Init();
+  func();
+  if (CpuInfo::IsSupported(CpuInfo::AVX2)) {
+    CpuInfo::EnableFeature(CpuInfo::AVX2, false);
+    func();
+    CpuInfo::EnableFeature(CpuInfo::AVX2, true);
+  }
+}
+
+TEST(BitPacking, Unpack32Simd) {
+  std::mt19937 rng(42);
+  for (int num_bits = 0; num_bits <= 32; ++num_bits) {
+    const int num_values = 5 * 32;
+    const uint64_t max = num_bits == 32 ? 0xFFFFFFFF : (1ULL << num_bits) - 1;
+    std::uniform_int_distribution<uint64_t> dist(0, max);
+    vector<uint32_t> values(num_values);
+    vector<uint32_t> packed(num_values);
+    BitWriter writer(reinterpret_cast<uint8_t*>(packed.data()), num_values * 4);
+    for (auto& v : values) {
+      v = static_cast<uint32_t>(dist(rng));
+      ASSERT_TRUE(writer.PutValue(v, num_bits));
+    }
+    writer.Flush();
+    // The packed values fill the input exactly, as reads past them would be
+    // caught by the sanitizers
+    packed.resize(num_values * num_bits / 32);
+
+    WithAndWithoutAvx2([&]() {
+      // A batch size that is not a multiple of 32 unpacks fewer values
+      vector<uint32_t> unpacked(num_values, 0xDEADBEEF);
+      ASSERT_EQ(num_values - 32, internal::unpack32_simd(packed.data(), unpacked.data(),
+                                                         num_values - 1, num_bits));
+      ASSERT_EQ(num_values, internal::unpack32_simd(packed.data(), unpacked.data(),
+                                                    num_values, num_bits));
+      ASSERT_EQ(values, unpacked) << "num_bits " << num_bits;
+    });
+  }
+}
+
+template <typename T>
+void CheckGetBatchWithDict(const vector<T>& dictionary) {
+  const int bit_width = 4;
+  const int num_values = 1000;
+  // Long runs and literal runs of all lengths
+  vector<int> indices;
+  std::mt19937 rng(42);
+  std::uniform_int_distribution<int> dist(0, static_cast<int>(dictionary.size()) - 1);
+  while (static_cast<int>(indices.size()) < num_values) {
+    indices.insert(indices.end(), indices.size() % 3 == 0 ? 20 : 1, dist(rng));
+  }
+  indices.resize(num_values);
+
+  vector<uint8_t> buffer(RleEncoder::MaxBufferSize(bit_width, num_values) +
+                         RleEncoder::MinBufferSize(bit_width));
+  RleEncoder encoder(buffer.data(), static_cast<int>(buffer.size()), bit_width);
+  vector<T> expected;
+  for (int index : indices) {
+    ASSERT_TRUE(encoder.Put(index));
+    expected.push_back(dictionary[index]);
+  }
+  const int encoded_size = encoder.Flush();
+
+  WithAndWithoutAvx2([&]() {
+    RleDecoder decoder(buffer.data(), encoded_size, bit_width);
+    vector<T> values(num_values);
+    ASSERT_EQ(num_values,
+              decoder.GetBatchWithDict(dictionary.data(), values.data(), num_values));
+    ASSERT_EQ(expected, values);
+  });
+}
+
+TEST(Rle, GetBatchWithDict) {
+  vector<int32_t> dict32;
+  vector<int64_t> dict64;
+  vector<double> dict_double;
+  vector<vector<int>> dict_vector;
+  for (int i = 0; i < 16; ++i) {
+    dict32.push_back(i * 1000 - 7);
+    dict64.push_back((int64_t(1) << 40) + i);
+    dict_double.push_back(i / 3.0);
+    dict_vector.push_back(vector<int>(i % 4, i));
+  }
+  CheckGetBatchWithDict(dict32);
+  CheckGetBatchWithDict(dict64);
+  CheckGetBatchWithDict(dict_double);
+  CheckGetBatchWithDict(dict_vector);
+}
+
 }  // namespace arrow
@@ -23,9 +23,11 @@
 
 #include <math.h>
 #include <algorithm>
+#include <type_traits>
 
 #include "arrow/util/bit-stream-utils.h"
 #include "arrow/util/bit-util.h"
+#include "arrow/util/bpacking-simd.h"
 #include "arrow/util/macros.h"
 
 namespace arrow {
@@ -309,6 +311,28 @@ inline int RleDecoder::GetBatch(T* values, int batch_size) {
   return values_read;
 }
 
+namespace detail {
+
+// Look up the values of the indices in the dictionary, with SIMD gathers for
+// the 4 and 8-byte numeric types
+template <typename T>
+inline void GatherDictionary(const T* dictionary, const int* indices, int length,
+                             T* out) {
+  if (std::is_arithmetic<T>::value && sizeof(T) == 4) {
+    internal::gather_dictionary32(reinterpret_cast<const uint32_t*>(dictionary), indices,
+                                  length, reinterpret_cast<uint32_t*>(out));
+  } else if (std::is_arithmetic<T>::value && sizeof(T) == 8) {
+    internal::gather_dictionary64(reinterpret_cast<const uint64_t*>(dictionary), indices,
+                                  length, reinterpret_cast<uint64_t*>(out));
+  } else {
+    for (int i = 0; i < length; ++i) {
+      out[i] = dictionary[indices[i]];
+    }
+  }
+}
+
+}  // namespace detail
+
 template <typename T>
 inline int RleDecoder::GetBatchWithDict(const T* dictionary, T* values, int batch_size) {
   DCHECK_GE(bit_width_, 0);
@@ -331,9 +355,7 @@ inline int RleDecoder::GetBatchWithDict(const T* dictionary, T* values, int batc
       literal_batch = std::min(literal_batch, buffer_size);
       int actual_read = bit_reader_.GetBatch(bit_width_, &indices[0], literal_batch);
       DCHECK_EQ(actual_read, literal_batch);
-      for (int i = 0; i < literal_batch; ++i) {
-        values[values_read + i] = dictionary[indices[i]];
-      }
+      detail::GatherDictionary(dictionary, indices, literal_batch, values + values_read);
       literal_count_ -= literal_batch;
       values_read += literal_batch;
     } else {
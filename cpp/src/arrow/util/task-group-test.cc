@@ -0,0 +1,138 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "arrow/status.h"
+#include "arrow/test-util.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/task-group.h"
+#include "arrow/util/thread-pool.h"
+
+namespace arrow {
+namespace internal {
+
+static std::shared_ptr<ThreadPool> MakeThreadPool(int threads) {
+  std::shared_ptr<ThreadPool> pool;
+  ARROW_CHECK_OK(ThreadPool::Make(threads, &pool));
+  return pool;
+}
+
+TEST(TestTaskGroup, Success) {
+  auto pool = MakeThreadPool(4);
+  std::atomic<int> count(0);
+  TaskGroup group(pool.get());
+  for (int i = 0; i < 1000; ++i) {
+    group.Append([&count] {
+      ++count;
+      return Status::OK();
+    });
+  }
+  ASSERT_OK(group.Finish());
+  ASSERT_EQ(count, 1000);
+  ASSERT_TRUE(group.ok());
+
+  // The group can be reused once finished
+  group.Append([&count] {
+    ++count;
+    return Status::OK();
+  });
+  ASSERT_OK(group.Finish());
+  ASSERT_EQ(count, 1001);
+}
+
+TEST(TestTaskGroup, NestedTasks) {
+  auto pool = MakeThreadPool(4);
+  std::atomic<int> count(0);
+  TaskGroup group(pool.get());
+  // A tree of tasks of depth 4 and fan-out 5, appended by their parents
+  std::function<Status(int)> spawn = [&](int depth) {
+    ++count;
+    if (depth < 4) {
+      for (int i = 0; i < 5; ++i) {
+        group.Append([&spawn, depth] { return spawn(depth + 1); });
+      }
+    }
+    return Status::OK();
+  };
+  group.Append([&spawn] { return spawn(0); });
+  ASSERT_OK(group.Finish());
+  ASSERT_EQ(count, 1 + 5 + 25 + 125 + 625);
+}
+
+TEST(TestTaskGroup, FirstErrorCancels) {
+  auto pool = MakeThreadPool(2);
+  std::atomic<int> num_run(0);
+  TaskGroup group(pool.get());
+  group.Append([&num_run] {
+    ++num_run;
+    return Status::IOError("corrupt batch");
+  });
+  // Once the error is seen, the tasks not yet started are skipped
+  for (int i = 0; i < 1000; ++i) {
+    group.Append([&num_run] {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      ++num_run;
+      return Status::Invalid("later error");
+    });
+  }
+  Status st = group.Finish();
+  ASSERT_TRUE(st.IsIOError() || st.IsInvalid()) << st.ToString();
+  ASSERT_FALSE(group.ok());
+  ASSERT_LT(num_run, 1001);
+
+  // No task is appended after an error
+  const int before = num_run;
+  group.Append([&num_run] {
+    ++num_run;
+    return Status::OK();
+  });
+  ASSERT_EQ(st.code(), group.Finish().code());
+  ASSERT_EQ(before, num_run);
+}
+
+TEST(TestTaskGroup, PoolShutdown) {
+  auto pool = MakeThreadPool(2);
+  ASSERT_OK(pool->Shutdown());
+  TaskGroup group(pool.get());
+  group.Append([] { return Status::OK(); });
+  ASSERT_RAISES(Invalid, group.Finish());
+}
+
+TEST(TestParallelFor, StopsOnError) {
+  std::atomic<int> num_run(0);
+  Status st = ParallelFor(10000, [&num_run](int i) {
+    ++num_run;
+    if (i == 0) {
+      return Status::IOError("corrupt batch");
+    }
+    std::this_thread::sleep_for(std::chrono::microseconds(100));
+    return Status::OK();
+  });
+  ASSERT_RAISES(IOError, st);
+  ASSERT_LT(num_run, 10000);
+}
+
+}  // namespace internal
+}  // namespace arrow
@@ -0,0 +1,83 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/task-group.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <utility>
+
+namespace arrow {
+namespace internal {
+
+struct TaskGroup::State {
+  State() : num_pending(0), ok(true) {}
+
+  std::atomic<int64_t> num_pending;
+  std::atomic<bool> ok;
+
+  std::mutex mutex;
+  std::condition_variable cv;
+  // The first error, guarded by the mutex
+  Status status;
+};
+
+TaskGroup::TaskGroup() : TaskGroup(GetCpuThreadPool()) {}
+
+TaskGroup::TaskGroup(ThreadPool* pool) : pool_(pool), state_(new State()) {}
+
+TaskGroup::~TaskGroup() { ARROW_UNUSED(Finish()); }
+
+bool TaskGroup::ok() const { return state_->ok.load(); }
+
+Status TaskGroup::Finish() {
+  std::unique_lock<std::mutex> lock(state_->mutex);
+  state_->cv.wait(lock, [this] { return state_->num_pending.load() == 0; });
+  return state_->status;
+}
+
+void TaskGroup::TaskStarted(State* state) { ++state->num_pending; }
+
+bool TaskGroup::ShouldRun(State* state) { return state->ok.load(); }
+
+void TaskGroup::TaskFinished(State* state, Status status) {
+  if (ARROW_PREDICT_FALSE(!status.ok())) {
+    std::lock_guard<std::mutex> lock(state->mutex);
+    if (state->status.ok()) {
+      state->status = std::move(status);
+      state->ok = false;
+    }
+  }
+  if (--state->num_pending == 0) {
+    // Locking orders the decrement with the check in Finish(), so that the
+    // notification isn't missed
+    std::lock_guard<std::mutex> lock(state->mutex);
+    state->cv.notify_all();
+  }
+}
+
+void TaskGroup::AppendReal(Task task) {
+  Status status = pool_->Spawn(std::move(task));
+  if (!status.ok()) {
+    // The task was dropped unrun
+    TaskFinished(state_.get(), std::move(status));
+  }
+}
+
+}  // namespace internal
+}  // namespace arrow
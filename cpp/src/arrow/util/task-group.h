@@ -0,0 +1,97 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_UTIL_TASK_GROUP_H
+#define ARROW_UTIL_TASK_GROUP_H
+
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "arrow/status.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/thread-pool.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace internal {
+
+// A group of `Status()` tasks run on a ThreadPool, to be waited for together.
+//
+// Tasks may append further tasks to their group, which Finish() then also
+// waits for.  After a task fails, the tasks of the group that haven't
+// started yet are skipped, and running ones can poll ok() to give up early;
+// Finish() returns the first error.  Unlike Submit(), appending a task
+// doesn't allocate a future.
+class ARROW_EXPORT TaskGroup {
+ public:
+  // A group of tasks on the global thread pool for CPU-bound tasks
+  TaskGroup();
+  explicit TaskGroup(ThreadPool* pool);
+
+  // Wait for the tasks to finish
+  ~TaskGroup();
+
+  // Add a task to run on the thread pool, unless a task has already failed
+  template <typename Function>
+  void Append(Function&& func) {
+    if (!ok()) {
+      return;
+    }
+    using Callable = typename std::decay<Function>::type;
+    TaskStarted(state_.get());
+    AppendReal(GroupTask<Callable>{state_, std::forward<Function>(func)});
+  }
+
+  // Whether no task has failed so far.  Long-running tasks can check this
+  // to stop once their results are known to be discarded.
+  bool ok() const;
+
+  // Wait for all the tasks to finish, those appended by other tasks
+  // included, and return the first error if any
+  Status Finish();
+
+ private:
+  struct State;
+
+  template <typename Function>
+  struct GroupTask {
+    std::shared_ptr<State> state;
+    Function func;
+
+    void operator()() {
+      TaskFinished(state.get(), ShouldRun(state.get()) ? func() : Status::OK());
+    }
+  };
+
+  static void TaskStarted(State* state);
+  static bool ShouldRun(State* state);
+  static void TaskFinished(State* state, Status status);
+
+  void AppendReal(Task task);
+
+  ThreadPool* pool_;
+  std::shared_ptr<State> state_;
+
+  ARROW_DISALLOW_COPY_AND_ASSIGN(TaskGroup);
+};
+
+}  // namespace internal
+}  // namespace arrow
+
+#endif  // ARROW_UTIL_TASK_GROUP_H
@@ -15,9 +15,19 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <chrono>
 #include <functional>
+#include <memory>
+#include <mutex>
+#include <set>
 #include <thread>
 #include <vector>
 
@@ -252,6 +262,79 @@ TEST_F(TestThreadPool, SetCapacity) {
   ASSERT_OK(pool->Shutdown());
 }
 
+#ifdef __linux__
+
+// The CPUs the calling thread may run on
+static std::set<int> GetThreadCpus() {
+  std::set<int> cpus;
+  cpu_set_t cpu_set;
+  if (pthread_getaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set) == 0) {
+    for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+      if (CPU_ISSET(cpu, &cpu_set)) {
+        cpus.insert(cpu);
+      }
+    }
+  }
+  return cpus;
+}
+
+TEST_F(TestThreadPool, Affinity) {
+  const std::set<int> process_cpus = GetThreadCpus();
+  ASSERT_FALSE(process_cpus.empty());
+  const int first_cpu = *process_cpus.begin();
+
+  // Round-robin over a single CPU
+  CpuAffinity affinity;
+  affinity.cpus = {first_cpu};
+  std::shared_ptr<ThreadPool> pool;
+  ASSERT_OK(ThreadPool::Make(3, affinity, &pool));
+  for (int i = 0; i < 6; ++i) {
+    ASSERT_EQ(std::set<int>{first_cpu}, pool->Submit(GetThreadCpus).get());
+  }
+  // Workers launched as the capacity grows are pinned too
+  ASSERT_OK(pool->SetCapacity(5));
+  ASSERT_EQ(pool->GetActualCapacity(), 5);
+  for (int i = 0; i < 10; ++i) {
+    ASSERT_EQ(std::set<int>{first_cpu}, pool->Submit(GetThreadCpus).get());
+  }
+  ASSERT_OK(pool->Shutdown());
+
+  // A mask of all the CPUs of the process
+  affinity.pinning = CpuPinning::MASK;
+  affinity.cpus.clear();
+  ASSERT_OK(ThreadPool::Make(2, affinity, &pool));
+  ASSERT_EQ(process_cpus, pool->Submit(GetThreadCpus).get());
+  ASSERT_OK(pool->Shutdown());
+
+  affinity.cpus = {-1};
+  ASSERT_RAISES(Invalid, ThreadPool::Make(2, affinity, &pool));
+}
+
+TEST_F(TestThreadPool, NumaNodes) {
+  const int num_nodes = GetNumaNodeCount();
+  ASSERT_GE(num_nodes, 1);
+  for (int node = 0; node < num_nodes; ++node) {
+    std::vector<int> cpus;
+    ASSERT_OK(GetNumaNodeCpus(node, &cpus));
+    // Memory-only nodes have no CPUs to make a pool of
+    if (cpus.empty()) {
+      continue;
+    }
+    std::shared_ptr<ThreadPool> pool;
+    ASSERT_OK(ThreadPool::MakeForNumaNode(node, 2, &pool));
+    const std::set<int> worker_cpus = pool->Submit(GetThreadCpus).get();
+    for (int cpu : worker_cpus) {
+      ASSERT_NE(std::find(cpus.begin(), cpus.end(), cpu), cpus.end());
+    }
+    ASSERT_OK(pool->Shutdown());
+  }
+  std::vector<int> cpus;
+  ASSERT_RAISES(Invalid, GetNumaNodeCpus(num_nodes, &cpus));
+  ASSERT_RAISES(Invalid, GetNumaNodeCpus(-1, &cpus));
+}
+
+#endif
+
 // Test Submit() functionality
 
 TEST_F(TestThreadPool, Submit) {
@@ -282,6 +365,136 @@ TEST_F(TestThreadPool, Submit) {
   }
 }
 
+TEST_F(TestThreadPool, NestedSpawn) {
+  // Tasks spawned from a worker land in its own queue, and the other
+  // workers must steal them
+  auto pool = this->MakeThreadPool(4);
+  std::mutex mutex;
+  std::set<std::thread::id> thread_ids;
+  std::atomic<int> count(0);
+  ASSERT_OK(pool->Spawn([&] {
+    for (int i = 0; i < 40; ++i) {
+      ASSERT_OK(pool->Spawn([&] {
+        sleep_for(0.002);
+        {
+          std::lock_guard<std::mutex> lock(mutex);
+          thread_ids.insert(std::this_thread::get_id());
+        }
+        ++count;
+      }));
+    }
+  }));
+  busy_wait(5.0, [&] { return count == 40; });
+  ASSERT_OK(pool->Shutdown());
+  ASSERT_EQ(count, 40);
+  ASSERT_GT(thread_ids.size(), 1);
+}
+
+TEST_F(TestThreadPool, Stats) {
+  auto pool = this->MakeThreadPool(2);
+  std::atomic<int> count(0);
+  // Not recording
+  ASSERT_OK(pool->Spawn([&] { ++count; }));
+  busy_wait(5.0, [&] { return count == 1; });
+
+  pool->SetStatsEnabled(true);
+  for (int i = 0; i < 10; ++i) {
+    ASSERT_OK(pool->Spawn([&] {
+      sleep_for(0.002);
+      ++count;
+    }));
+  }
+  ASSERT_GT(pool->GetStats().queue_depth, 0);
+  busy_wait(5.0, [&] { return count == 11; });
+  // Let the workers finish recording
+  sleep_for(0.05);
+
+  ThreadPoolStats stats = pool->GetStats();
+  ASSERT_EQ(stats.queue_depth, 0);
+  ASSERT_EQ(stats.queue_time.count, 10);
+  ASSERT_EQ(stats.run_time.count, 10);
+  ASSERT_GE(stats.run_time.total_nanos, 10 * 2000000);
+  ASSERT_GE(stats.run_time.Quantile(0.5), 2000000);
+  ASSERT_GE(stats.run_time.Quantile(1.0), stats.run_time.Quantile(0.5));
+  ASSERT_EQ(stats.workers.size(), 2);
+  int64_t tasks_executed = 0;
+  for (const auto& worker : stats.workers) {
+    tasks_executed += worker.tasks_executed;
+    ASSERT_GT(worker.idle_nanos, 0);
+  }
+  ASSERT_EQ(tasks_executed, 10);
+
+  pool->ResetStats();
+  pool->SetStatsEnabled(false);
+  ASSERT_OK(pool->Spawn([&] { ++count; }));
+  busy_wait(5.0, [&] { return count == 12; });
+  stats = pool->GetStats();
+  ASSERT_EQ(stats.run_time.count, 0);
+  ASSERT_EQ(stats.workers[0].tasks_executed + stats.workers[1].tasks_executed, 0);
+  ASSERT_OK(pool->Shutdown());
+}
+
+TEST(DurationHistogram, Quantile) {
+  DurationHistogram histogram;
+  ASSERT_EQ(histogram.Quantile(0.5), 0);
+  histogram.buckets[3] = 9;
+  histogram.buckets[10] = 1;
+  histogram.count = 10;
+  ASSERT_EQ(histogram.Quantile(0.0), 15);
+  ASSERT_EQ(histogram.Quantile(0.5), 15);
+  ASSERT_EQ(histogram.Quantile(0.95), 2047);
+  ASSERT_EQ(histogram.Quantile(1.0), 2047);
+}
+
+TEST(TestTask, Callables) {
+  int value = 0;
+
+  // Small enough to be stored inline
+  Task small([&value] { value += 1; });
+  ASSERT_TRUE(static_cast<bool>(small));
+  small();
+  ASSERT_EQ(value, 1);
+
+  // Too large to be stored inline
+  std::array<int, 64> values;
+  values.fill(2);
+  Task large([&value, values] { value += values[63]; });
+  large();
+  ASSERT_EQ(value, 3);
+
+  // Move-only
+  std::unique_ptr<int> pointer(new int(4));
+  struct MoveOnly {
+    std::unique_ptr<int> pointer;
+    int* out;
+    void operator()() { *out += *pointer; }
+  };
+  Task move_only(MoveOnly{std::move(pointer), &value});
+
+  Task moved(std::move(move_only));
+  ASSERT_FALSE(static_cast<bool>(move_only));
+  moved();
+  ASSERT_EQ(value, 7);
+
+  moved = std::move(large);
+  ASSERT_FALSE(static_cast<bool>(large));
+  moved();
+  ASSERT_EQ(value, 9);
+}
+
+TEST(TestTask, Destroys) {
+  auto shared = std::make_shared<int>(0);
+  {
+    Task small([shared] {});
+    std::array<int, 64> values;
+    Task large([shared, values] {});
+    ASSERT_EQ(shared.use_count(), 3);
+    Task moved(std::move(large));
+    ASSERT_EQ(shared.use_count(), 3);
+  }
+  ASSERT_EQ(shared.use_count(), 1);
+}
+
 TEST(TestGlobalThreadPool, Capacity) {
   // Sanity check
   auto pool = GetCpuThreadPool();
@@ -327,5 +540,34 @@ TEST(TestGlobalThreadPool, Capacity) {
   ASSERT_OK(DelEnvVar("OMP_THREAD_LIMIT"));
 }
 
+TEST(TestGlobalThreadPool, IOCapacity) {
+  auto cpu_pool = GetCpuThreadPool();
+  auto io_pool = GetIOThreadPool();
+  ASSERT_NE(cpu_pool, io_pool);
+  const int cpu_capacity = cpu_pool->GetCapacity();
+  const int io_capacity = io_pool->GetCapacity();
+  ASSERT_GT(io_capacity, 0);
+  ASSERT_EQ(GetIOThreadPoolCapacity(), io_capacity);
+
+  // The capacities are tuned independently
+  ASSERT_OK(SetIOThreadPoolCapacity(io_capacity + 3));
+  ASSERT_EQ(GetIOThreadPoolCapacity(), io_capacity + 3);
+  ASSERT_EQ(io_pool->GetActualCapacity(), io_capacity + 3);
+  ASSERT_EQ(GetCpuThreadPoolCapacity(), cpu_capacity);
+  ASSERT_RAISES(Invalid, SetIOThreadPoolCapacity(0));
+  ASSERT_OK(SetIOThreadPoolCapacity(io_capacity));
+
+  auto fut = io_pool->Submit(add<int>, 4, 5);
+  ASSERT_EQ(fut.get(), 9);
+
+  ASSERT_OK(DelEnvVar("ARROW_IO_THREADS"));
+  ASSERT_EQ(ThreadPool::DefaultIOCapacity(), 8);
+  ASSERT_OK(SetEnvVar("ARROW_IO_THREADS", "32"));
+  ASSERT_EQ(ThreadPool::DefaultIOCapacity(), 32);
+  ASSERT_OK(SetEnvVar("ARROW_IO_THREADS", "x"));
+  ASSERT_EQ(ThreadPool::DefaultIOCapacity(), 8);
+  ASSERT_OK(DelEnvVar("ARROW_IO_THREADS"));
+}
+
 }  // namespace internal
 }  // namespace arrow
@@ -18,19 +18,263 @@
 #include "arrow/util/thread-pool.h"
 #include "arrow/util/io-util.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/tracing.h"
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <cstring>
 #include <deque>
+#include <fstream>
+#include <memory>
 #include <mutex>
+#include <sstream>
 #include <string>
 #include <thread>
+#include <utility>
+#include <vector>
 
 namespace arrow {
 namespace internal {
 
+namespace {
+
+int64_t NowNanos() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+int DurationBucket(int64_t nanos) {
+  int bucket = 0;
+  for (uint64_t value = static_cast<uint64_t>(nanos) >> 1; value != 0; value >>= 1) {
+    ++bucket;
+  }
+  return std::min(bucket, DurationHistogram::kNumBuckets - 1);
+}
+
+// A DurationHistogram that workers record into as others read it
+class AtomicDurationHistogram {
+ public:
+  AtomicDurationHistogram() { Reset(); }
+
+  // Only called by the worker owning the histogram, so that no
+  // read-modify-write is needed
+  void Record(int64_t nanos) {
+    Increment(&buckets_[DurationBucket(nanos)], 1);
+    Increment(&count_, 1);
+    Increment(&total_nanos_, nanos);
+  }
+
+  void AddTo(DurationHistogram* out) const {
+    for (int i = 0; i < DurationHistogram::kNumBuckets; ++i) {
+      out->buckets[i] += buckets_[i].load(std::memory_order_relaxed);
+    }
+    out->count += count_.load(std::memory_order_relaxed);
+    out->total_nanos += total_nanos_.load(std::memory_order_relaxed);
+  }
+
+  void Reset() {
+    for (auto& bucket : buckets_) {
+      bucket.store(0, std::memory_order_relaxed);
+    }
+    count_.store(0, std::memory_order_relaxed);
+    total_nanos_.store(0, std::memory_order_relaxed);
+  }
+
+  static void Increment(std::atomic<int64_t>* counter, int64_t value) {
+    counter->store(counter->load(std::memory_order_relaxed) + value,
+                   std::memory_order_relaxed);
+  }
+
+ private:
+  std::atomic<int64_t> buckets_[DurationHistogram::kNumBuckets];
+  std::atomic<int64_t> count_;
+  std::atomic<int64_t> total_nanos_;
+};
+
+}  // namespace
+
+int64_t DurationHistogram::Quantile(double q) const {
+  const int64_t rank = static_cast<int64_t>(q * static_cast<double>(count));
+  int64_t seen = 0;
+  for (int i = 0; i < kNumBuckets; ++i) {
+    seen += buckets[i];
+    if (seen > rank || (seen == count && seen > 0)) {
+      return (int64_t(1) << (i + 1)) - 1;
+    }
+  }
+  return 0;
+}
+
+namespace detail {
+
+// The statistics of the workers owning a queue, written by them only
+struct WorkerCounters {
+  WorkerCounters() { Reset(); }
+
+  void Reset() {
+    tasks_executed.store(0, std::memory_order_relaxed);
+    busy_nanos.store(0, std::memory_order_relaxed);
+    idle_nanos.store(0, std::memory_order_relaxed);
+    idle_since.store(0, std::memory_order_relaxed);
+    queue_time.Reset();
+    run_time.Reset();
+  }
+
+  std::atomic<int64_t> tasks_executed;
+  std::atomic<int64_t> busy_nanos;
+  std::atomic<int64_t> idle_nanos;
+  // When the worker started waiting for tasks, if it is
+  std::atomic<int64_t> idle_since;
+  AtomicDurationHistogram queue_time;
+  AtomicDurationHistogram run_time;
+};
+
+// The task queues of a worker.  The worker runs the tasks it spawned itself
+// last in first out, so that their data is likely still in cache, and those
+// spawned from other threads first in first out, in the order they were
+// submitted; other workers steal the oldest ones.  The lock is per worker,
+// and so is rarely contended.
+class WorkQueue {
+ public:
+  explicit WorkQueue(WorkQueue* next) : next(next), in_use(false) {}
+
+  // A task and when it was spawned, if statistics were being recorded then
+  struct Entry {
+    Task task;
+    int64_t spawn_nanos;
+  };
+
+  void Push(Entry&& entry, bool local) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    (local ? local_tasks_ : submitted_tasks_).push_back(std::move(entry));
+  }
+
+  // Take a task as the owner
+  bool Pop(Entry* out) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!local_tasks_.empty()) {
+      *out = std::move(local_tasks_.back());
+      local_tasks_.pop_back();
+      return true;
+    }
+    return PopFront(&submitted_tasks_, out);
+  }
+
+  // Take a task as another worker
+  bool Steal(Entry* out) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return PopFront(&submitted_tasks_, out) || PopFront(&local_tasks_, out);
+  }
+
+  int64_t Clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const int64_t num_tasks =
+        static_cast<int64_t>(local_tasks_.size() + submitted_tasks_.size());
+    local_tasks_.clear();
+    submitted_tasks_.clear();
+    return num_tasks;
+  }
+
+  // The next queue of the pool, immutable once the queue is published
+  WorkQueue* const next;
+  // Whether a worker owns the queue, guarded by the pool mutex
+  bool in_use;
+  WorkerCounters counters;
+
+ private:
+  static bool PopFront(std::deque<Entry>* tasks, Entry* out) {
+    if (tasks->empty()) {
+      return false;
+    }
+    *out = std::move(tasks->front());
+    tasks->pop_front();
+    return true;
+  }
+
+  std::mutex mutex_;
+  std::deque<Entry> local_tasks_;
+  std::deque<Entry> submitted_tasks_;
+};
+
+}  // namespace detail
+
+using detail::WorkQueue;
+
+namespace {
+
+// The pool and queue of the worker running on this thread, if any
+thread_local const void* current_pool_state = nullptr;
+thread_local WorkQueue* current_queue = nullptr;
+
+// Run a task, recording its statistics into those of the worker
+void RunAndRecord(WorkQueue::Entry* entry, detail::WorkerCounters* counters) {
+  const int64_t start = NowNanos();
+  // Unless it was spawned before recording started
+  if (entry->spawn_nanos != 0) {
+    counters->queue_time.Record(start - entry->spawn_nanos);
+  }
+  entry->task();
+  const int64_t run_nanos = NowNanos() - start;
+  counters->run_time.Record(run_nanos);
+  AtomicDurationHistogram::Increment(&counters->tasks_executed, 1);
+  AtomicDurationHistogram::Increment(&counters->busy_nanos, run_nanos);
+}
+
+}  // namespace
+
 struct ThreadPool::State {
-  State() : desired_capacity_(0), please_shutdown_(false), quick_shutdown_(false) {}
+  State()
+      : queues_(nullptr),
+        num_queues_(0),
+        next_queue_(0),
+        num_pending_(0),
+        num_sleeping_(0),
+        desired_capacity_(0),
+        secede_requested_(false),
+        please_shutdown_(false),
+        quick_shutdown_(false),
+        stats_enabled_(false) {}
+
+  bool stats_enabled() const { return stats_enabled_.load(std::memory_order_relaxed); }
+
+  // Look for a task in the worker's own queue, then in those of the others
+  bool TakeTask(WorkQueue* own, WorkQueue::Entry* out) {
+    if (own->Pop(out)) {
+      --num_pending_;
+      return true;
+    }
+    for (WorkQueue* queue = own->next; queue != nullptr; queue = queue->next) {
+      if (queue->Steal(out)) {
+        --num_pending_;
+        return true;
+      }
+    }
+    for (WorkQueue* queue = queues_.load(); queue != own; queue = queue->next) {
+      if (queue->Steal(out)) {
+        --num_pending_;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // The queue for a task spawned outside of the workers, in turn
+  WorkQueue* NextQueue() {
+    const int index = static_cast<int>(next_queue_++ % num_queues_.load());
+    WorkQueue* queue = queues_.load();
+    for (int i = 0; i < index && queue->next != nullptr; ++i) {
+      queue = queue->next;
+    }
+    return queue;
+  }
 
   std::mutex mutex_;
   std::condition_variable cv_;
@@ -39,13 +283,36 @@ struct ThreadPool::State {
   std::list<std::thread> workers_;
   // Trashcan for finished threads
   std::vector<std::thread> finished_workers_;
-  std::deque<std::function<void()>> pending_tasks_;
+
+  // The task queues, linked from the most recently created one.  They are
+  // only ever added, under the mutex, so that workers can walk the list
+  // without locking, and are reused by new workers once theirs have exited.
+  std::atomic<WorkQueue*> queues_;
+  std::vector<std::unique_ptr<WorkQueue>> owned_queues_;
+  std::atomic<int> num_queues_;
+  std::atomic<uint64_t> next_queue_;
+
+  // Number of tasks spawned and not yet taken from a queue.  Spawning counts
+  // a task before checking for shutdown, and workers check both before
+  // sleeping or exiting, so that no task is left behind.
+  std::atomic<int64_t> num_pending_;
+  // Number of workers waiting on cv_, so that spawning only takes the mutex
+  // to wake one up when there is one
+  std::atomic<int> num_sleeping_;
 
   // Desired number of threads
   int desired_capacity_;
+  // Where to pin workers, if anywhere, and the next CPU to pin one to
+  bool pin_workers_ = false;
+  CpuAffinity affinity_;
+  size_t next_cpu_ = 0;
+  // Whether there may be more workers than desired
+  std::atomic<bool> secede_requested_;
   // Are we shutting down?
-  bool please_shutdown_;
-  bool quick_shutdown_;
+  std::atomic<bool> please_shutdown_;
+  std::atomic<bool> quick_shutdown_;
+  // Whether to record the statistics of the workers
+  std::atomic<bool> stats_enabled_;
 };
 
 ThreadPool::ThreadPool()
@@ -75,6 +342,7 @@ Status ThreadPool::SetCapacity(int threads) {
     LaunchWorkersUnlocked(diff);
   } else if (diff < 0) {
     // Wake threads to ask them to stop
+    state_->secede_requested_ = true;
     state_->cv_.notify_all();
   }
   return Status::OK();
@@ -96,14 +364,16 @@ Status ThreadPool::Shutdown(bool wait) {
   if (state_->please_shutdown_) {
     return Status::Invalid("Shutdown() already called");
   }
-  state_->please_shutdown_ = true;
   state_->quick_shutdown_ = !wait;
+  state_->please_shutdown_ = true;
   state_->cv_.notify_all();
   state_->cv_shutdown_.wait(lock, [this] { return state_->workers_.empty(); });
   if (!state_->quick_shutdown_) {
-    DCHECK_EQ(state_->pending_tasks_.size(), 0);
+    DCHECK_EQ(state_->num_pending_.load(), 0);
   } else {
-    state_->pending_tasks_.clear();
+    for (auto& queue : state_->owned_queues_) {
+      state_->num_pending_ -= queue->Clear();
+    }
   }
   CollectFinishedWorkersUnlocked();
   return Status::OK();
@@ -120,15 +390,60 @@ void ThreadPool::CollectFinishedWorkersUnlocked() {
 void ThreadPool::LaunchWorkersUnlocked(int threads) {
   std::shared_ptr<State> state = sp_state_;
 
+  auto queue_it = state_->owned_queues_.begin();
   for (int i = 0; i < threads; i++) {
+    // Reuse the queue of a worker that has exited, or add one
+    while (queue_it != state_->owned_queues_.end() && (*queue_it)->in_use) {
+      ++queue_it;
+    }
+    WorkQueue* queue;
+    if (queue_it != state_->owned_queues_.end()) {
+      queue = queue_it->get();
+    } else {
+      state_->owned_queues_.emplace_back(new WorkQueue(state_->queues_.load()));
+      queue_it = --state_->owned_queues_.end();
+      queue = queue_it->get();
+      state_->queues_.store(queue);
+      ++state_->num_queues_;
+    }
+    queue->in_use = true;
+
     state_->workers_.emplace_back();
     auto it = --(state_->workers_.end());
-    *it = std::thread([state, it] { WorkerLoop(state, it); });
+    *it = std::thread([state, it, queue] { WorkerLoop(state, it, queue); });
+    PinWorkerUnlocked(&*it);
   }
 }
 
+void ThreadPool::PinWorkerUnlocked(std::thread* thread) {
+  if (!state_->pin_workers_) {
+    return;
+  }
+#ifdef __linux__
+  const std::vector<int>& cpus = state_->affinity_.cpus;
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  if (state_->affinity_.pinning == CpuPinning::ROUND_ROBIN) {
+    CPU_SET(cpus[state_->next_cpu_++ % cpus.size()], &cpu_set);
+  } else {
+    for (int cpu : cpus) {
+      CPU_SET(cpu, &cpu_set);
+    }
+  }
+  const int error =
+      pthread_setaffinity_np(thread->native_handle(), sizeof(cpu_set), &cpu_set);
+  if (error != 0) {
+    // The worker still runs, just unpinned
+    ARROW_LOG(WARNING) << "Failed to pin thread pool worker: " << std::strerror(error);
+  }
+#endif
+}
+
 void ThreadPool::WorkerLoop(std::shared_ptr<State> state,
-                            std::list<std::thread>::iterator it) {
+                            std::list<std::thread>::iterator it, WorkQueue* queue) {
+  current_pool_state = state.get();
+  current_queue = queue;
+
   std::unique_lock<std::mutex> lock(state->mutex_);
 
   // Since we hold the lock, `it` now points to the correct thread object
@@ -137,37 +452,66 @@ void ThreadPool::WorkerLoop(std::shared_ptr<State> state,
 
   // If too many threads, we should secede from the pool
   const auto should_secede = [&]() -> bool {
-    return state->workers_.size() > static_cast<size_t>(state->desired_capacity_);
+    if (state->workers_.size() > static_cast<size_t>(state->desired_capacity_)) {
+      return true;
+    }
+    state->secede_requested_ = false;
+    return false;
   };
 
   while (true) {
     // By the time this thread is started, some tasks may have been pushed
     // or shutdown could even have been requested.  So we only wait on the
     // condition variable at the end of the loop.
-
-    // Execute pending tasks if any
-    while (!state->pending_tasks_.empty() && !state->quick_shutdown_) {
-      // We check this opportunistically at each loop iteration since
-      // it releases the lock below.
-      if (should_secede()) {
-        break;
-      }
-      {
-        std::function<void()> task = std::move(state->pending_tasks_.front());
-        state->pending_tasks_.pop_front();
-        lock.unlock();
-        task();
+    lock.unlock();
+
+    // Execute pending tasks if any, without holding the pool mutex
+    WorkQueue::Entry entry;
+    while (!state->quick_shutdown_ && !state->secede_requested_ &&
+           state->TakeTask(queue, &entry)) {
+      ARROW_TRACE_SPAN(span, "thread_pool", "ThreadPool::Task");
+      if (state->stats_enabled()) {
+        RunAndRecord(&entry, &queue->counters);
+      } else {
+        entry.task();
       }
-      lock.lock();
+      entry.task = Task();
     }
-    // Now either the queue is empty *or* a quick shutdown was requested
-    if (state->please_shutdown_ || should_secede()) {
+
+    lock.lock();
+    // Now either no task was found, a quick shutdown was requested or
+    // there may be too many workers
+    if (state->quick_shutdown_ || should_secede()) {
+      break;
+    }
+    if (state->num_pending_ > 0) {
+      continue;
+    }
+    if (state->please_shutdown_) {
       break;
     }
     // Wait for next wakeup
-    state->cv_.wait(lock);
+    const int64_t wait_start = state->stats_enabled() ? NowNanos() : 0;
+    queue->counters.idle_since.store(wait_start, std::memory_order_relaxed);
+    ++state->num_sleeping_;
+    state->cv_.wait(lock, [&] {
+      return state->num_pending_ > 0 || state->please_shutdown_ ||
+             state->secede_requested_;
+    });
+    --state->num_sleeping_;
+    if (wait_start != 0) {
+      queue->counters.idle_since.store(0, std::memory_order_relaxed);
+      AtomicDurationHistogram::Increment(&queue->counters.idle_nanos,
+                                         NowNanos() - wait_start);
+    }
   }
 
+  // Tasks left in the queue stay counted as pending, for the other workers
+  // to steal
+  queue->in_use = false;
+  current_pool_state = nullptr;
+  current_queue = nullptr;
+
   // We're done.  Move our thread object to the trashcan of finished
   // workers.  This has two motivations:
   // 1) the thread object doesn't get destroyed before this function finishes
@@ -184,19 +528,58 @@ void ThreadPool::WorkerLoop(std::shared_ptr<State> state,
   }
 }
 
-Status ThreadPool::SpawnReal(std::function<void()> task) {
-  {
+Status ThreadPool::SpawnReal(Task task) {
+  ++state_->num_pending_;
+  if (state_->please_shutdown_) {
+    --state_->num_pending_;
+    return Status::Invalid("operation forbidden during or after shutdown");
+  }
+  WorkQueue::Entry entry{std::move(task), state_->stats_enabled() ? NowNanos() : 0};
+  if (current_pool_state == state_) {
+    current_queue->Push(std::move(entry), true /* local */);
+  } else {
+    state_->NextQueue()->Push(std::move(entry), false /* local */);
+  }
+  if (state_->num_sleeping_ > 0) {
     std::lock_guard<std::mutex> lock(state_->mutex_);
-    if (state_->please_shutdown_) {
-      return Status::Invalid("operation forbidden during or after shutdown");
-    }
-    CollectFinishedWorkersUnlocked();
-    state_->pending_tasks_.push_back(std::move(task));
+    state_->cv_.notify_one();
   }
-  state_->cv_.notify_one();
   return Status::OK();
 }
 
+void ThreadPool::SetStatsEnabled(bool enabled) { state_->stats_enabled_ = enabled; }
+
+ThreadPoolStats ThreadPool::GetStats() {
+  ThreadPoolStats stats;
+  stats.queue_depth = std::max<int64_t>(0, state_->num_pending_.load());
+  std::lock_guard<std::mutex> lock(state_->mutex_);
+  const int64_t now = NowNanos();
+  // From the oldest queue
+  for (const auto& queue : state_->owned_queues_) {
+    const detail::WorkerCounters& counters = queue->counters;
+    ThreadPoolWorkerStats worker;
+    worker.tasks_executed = counters.tasks_executed.load(std::memory_order_relaxed);
+    worker.busy_nanos = counters.busy_nanos.load(std::memory_order_relaxed);
+    worker.idle_nanos = counters.idle_nanos.load(std::memory_order_relaxed);
+    // Including the current wait
+    const int64_t idle_since = counters.idle_since.load(std::memory_order_relaxed);
+    if (idle_since != 0) {
+      worker.idle_nanos += now - idle_since;
+    }
+    stats.workers.push_back(worker);
+    counters.queue_time.AddTo(&stats.queue_time);
+    counters.run_time.AddTo(&stats.run_time);
+  }
+  return stats;
+}
+
+void ThreadPool::ResetStats() {
+  std::lock_guard<std::mutex> lock(state_->mutex_);
+  for (auto& queue : state_->owned_queues_) {
+    queue->counters.Reset();
+  }
+}
+
 Status ThreadPool::Make(int threads, std::shared_ptr<ThreadPool>* out) {
   auto pool = std::shared_ptr<ThreadPool>(new ThreadPool());
   RETURN_NOT_OK(pool->SetCapacity(threads));
@@ -204,6 +587,143 @@ Status ThreadPool::Make(int threads, std::shared_ptr<ThreadPool>* out) {
   return Status::OK();
 }
 
+#ifdef __linux__
+
+namespace {
+
+// The CPUs this process may run on
+std::vector<int> GetProcessCpus() {
+  std::vector<int> cpus;
+  cpu_set_t cpu_set;
+  if (sched_getaffinity(0, sizeof(cpu_set), &cpu_set) == 0) {
+    for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+      if (CPU_ISSET(cpu, &cpu_set)) {
+        cpus.push_back(cpu);
+      }
+    }
+  }
+  return cpus;
+}
+
+// Parse a list of CPUs or nodes as in sysfs, as "0-3,8,10-11"
+bool ParseCpuList(const std::string& list, std::vector<int>* out) {
+  std::vector<int> values;
+  std::stringstream ss(list);
+  std::string range;
+  while (std::getline(ss, range, ',')) {
+    int first, last;
+    char dash;
+    std::stringstream range_ss(range);
+    if (!(range_ss >> first)) {
+      return false;
+    }
+    if (range_ss >> dash) {
+      if (dash != '-' || !(range_ss >> last) || last < first) {
+        return false;
+      }
+    } else {
+      last = first;
+    }
+    for (int value = first; value <= last; ++value) {
+      values.push_back(value);
+    }
+  }
+  *out = std::move(values);
+  return true;
+}
+
+// A list in a sysfs file, empty for memory-only NUMA nodes
+bool ReadSysfsList(const std::string& path, std::vector<int>* out) {
+  std::ifstream file(path);
+  std::string line;
+  if (!file) {
+    return false;
+  }
+  std::getline(file, line);
+  return ParseCpuList(line, out);
+}
+
+}  // namespace
+
+int GetNumaNodeCount() {
+  std::vector<int> nodes;
+  if (!ReadSysfsList("/sys/devices/system/node/online", &nodes) || nodes.empty()) {
+    return 1;
+  }
+  return *std::max_element(nodes.begin(), nodes.end()) + 1;
+}
+
+Status GetNumaNodeCpus(int node, std::vector<int>* cpus) {
+  if (node < 0 || node >= GetNumaNodeCount()) {
+    std::stringstream ss;
+    ss << "invalid NUMA node: " << node;
+    return Status::Invalid(ss.str());
+  }
+  std::stringstream path;
+  path << "/sys/devices/system/node/node" << node << "/cpulist";
+  if (ReadSysfsList(path.str(), cpus)) {
+    return Status::OK();
+  }
+  if (node == 0) {
+    // Not a NUMA machine, or no sysfs: all the CPUs are on the one node
+    *cpus = GetProcessCpus();
+    return Status::OK();
+  }
+  return Status::IOError("failed to read the CPUs of NUMA node from " + path.str());
+}
+
+Status ThreadPool::Make(int threads, const CpuAffinity& affinity,
+                        std::shared_ptr<ThreadPool>* out) {
+  auto pool = std::shared_ptr<ThreadPool>(new ThreadPool());
+  State* state = pool->state_;
+  state->affinity_ = affinity;
+  if (state->affinity_.cpus.empty()) {
+    state->affinity_.cpus = GetProcessCpus();
+    if (state->affinity_.cpus.empty()) {
+      return Status::IOError("failed to get the CPUs of the process");
+    }
+  }
+  for (int cpu : state->affinity_.cpus) {
+    if (cpu < 0 || cpu >= CPU_SETSIZE) {
+      std::stringstream ss;
+      ss << "invalid CPU number: " << cpu;
+      return Status::Invalid(ss.str());
+    }
+  }
+  state->pin_workers_ = true;
+  RETURN_NOT_OK(pool->SetCapacity(threads));
+  *out = std::move(pool);
+  return Status::OK();
+}
+
+#else
+
+int GetNumaNodeCount() { return 1; }
+
+Status GetNumaNodeCpus(int node, std::vector<int>* cpus) {
+  return Status::NotImplemented("NUMA topology is only available on Linux");
+}
+
+Status ThreadPool::Make(int threads, const CpuAffinity& affinity,
+                        std::shared_ptr<ThreadPool>* out) {
+  return Status::NotImplemented("CPU affinity is only supported on Linux");
+}
+
+#endif
+
+Status ThreadPool::MakeForNumaNode(int node, int threads,
+                                   std::shared_ptr<ThreadPool>* out) {
+  CpuAffinity affinity;
+  affinity.pinning = CpuPinning::MASK;
+  RETURN_NOT_OK(GetNumaNodeCpus(node, &affinity.cpus));
+  if (affinity.cpus.empty()) {
+    std::stringstream ss;
+    ss << "NUMA node " << node << " has no CPUs";
+    return Status::Invalid(ss.str());
+  }
+  return Make(threads, affinity, out);
+}
+
 // ----------------------------------------------------------------------
 // Global thread pool
 
@@ -243,10 +763,15 @@ int ThreadPool::DefaultCapacity() {
   return capacity;
 }
 
+int ThreadPool::DefaultIOCapacity() {
+  const int capacity = ParseOMPEnvVar("ARROW_IO_THREADS");
+  return capacity > 0 ? capacity : 8;
+}
+
 // Helper for the singleton pattern
-std::shared_ptr<ThreadPool> ThreadPool::MakeCpuThreadPool() {
+std::shared_ptr<ThreadPool> ThreadPool::MakeGlobalThreadPool(int threads) {
   std::shared_ptr<ThreadPool> pool;
-  DCHECK_OK(ThreadPool::Make(ThreadPool::DefaultCapacity(), &pool));
+  DCHECK_OK(ThreadPool::Make(threads, &pool));
   // On Windows, the global ThreadPool destructor may be called after
   // non-main threads have been killed by the OS, and hang in a condition
   // variable.
@@ -258,7 +783,14 @@ std::shared_ptr<ThreadPool> ThreadPool::MakeCpuThreadPool() {
 }
 
 ThreadPool* GetCpuThreadPool() {
-  static std::shared_ptr<ThreadPool> singleton = ThreadPool::MakeCpuThreadPool();
+  static std::shared_ptr<ThreadPool> singleton =
+      ThreadPool::MakeGlobalThreadPool(ThreadPool::DefaultCapacity());
+  return singleton.get();
+}
+
+ThreadPool* GetIOThreadPool() {
+  static std::shared_ptr<ThreadPool> singleton =
+      ThreadPool::MakeGlobalThreadPool(ThreadPool::DefaultIOCapacity());
   return singleton.get();
 }
 
@@ -270,4 +802,10 @@ Status SetCpuThreadPoolCapacity(int threads) {
   return internal::GetCpuThreadPool()->SetCapacity(threads);
 }
 
+int GetIOThreadPoolCapacity() { return internal::GetIOThreadPool()->GetCapacity(); }
+
+Status SetIOThreadPoolCapacity(int threads) {
+  return internal::GetIOThreadPool()->SetCapacity(threads);
+}
+
 }  // namespace arrow
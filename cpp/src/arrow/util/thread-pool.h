@@ -18,11 +18,13 @@
 #ifndef ARROW_UTIL_THREAD_POOL_H
 #define ARROW_UTIL_THREAD_POOL_H
 
+#include <cstddef>
 #include <exception>
 #include <functional>
 #include <future>
 #include <list>
 #include <memory>
+#include <new>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -41,30 +43,209 @@ ARROW_EXPORT int GetCpuThreadPoolCapacity();
 // for CPU-bound tasks.
 ARROW_EXPORT Status SetCpuThreadPoolCapacity(int threads);
 
+// Get the number of worker threads used by the process-global thread pool
+// for blocking I/O, such as reads from files and HDFS.  Kept apart from the
+// CPU pool so that tasks waiting on I/O don't hold up CPU-bound ones, its
+// capacity defaults to the ARROW_IO_THREADS environment variable, or 8.
+ARROW_EXPORT int GetIOThreadPoolCapacity();
+
+// Set the number of worker threads used by the process-global thread pool
+// for blocking I/O.
+ARROW_EXPORT Status SetIOThreadPoolCapacity(int threads);
+
 namespace internal {
 
 namespace detail {
 
-// Needed because std::packaged_task is not copyable and hence not convertible
-// to std::function.
-template <typename R, typename... Args>
-struct packaged_task_wrapper {
-  using PackagedTask = std::packaged_task<R(Args...)>;
+class WorkQueue;
+
+}  // namespace detail
+
+// A type-erased callable to run once, as a task of a ThreadPool
+//
+// Unlike std::function, it can hold move-only callables such as
+// std::packaged_task, and keeps those of a few pointers in size, the
+// captures of most lambdas, inline rather than on the heap.
+class Task {
+ public:
+  Task() noexcept : ops_(NULLPTR) {}
+
+  template <typename Function,
+            typename = typename std::enable_if<!std::is_same<
+                typename std::decay<Function>::type, Task>::value>::type>
+  Task(Function&& func) {  // NOLINT runtime/explicit
+    using Callable = typename std::decay<Function>::type;
+    using Ops = typename std::conditional<IsInline<Callable>::value, InlineOps<Callable>,
+                                          HeapOps<Callable>>::type;
+    Ops::Construct(&storage_, std::forward<Function>(func));
+    ops_ = Ops::Get();
+  }
+
+  Task(Task&& other) noexcept : ops_(other.ops_) {
+    if (ops_ != NULLPTR) {
+      ops_->move(&other.storage_, &storage_);
+      other.ops_ = NULLPTR;
+    }
+  }
+
+  Task& operator=(Task&& other) noexcept {
+    if (this != &other) {
+      Reset();
+      if (other.ops_ != NULLPTR) {
+        other.ops_->move(&other.storage_, &storage_);
+        ops_ = other.ops_;
+        other.ops_ = NULLPTR;
+      }
+    }
+    return *this;
+  }
+
+  ~Task() { Reset(); }
+
+  explicit operator bool() const { return ops_ != NULLPTR; }
+
+  void operator()() { ops_->invoke(&storage_); }
+
+ private:
+  static constexpr size_t kInlineSize = 6 * sizeof(void*);
+  using Storage = typename std::aligned_storage<kInlineSize>::type;
+
+  struct Ops {
+    void (*invoke)(void* storage);
+    // Move the callable to uninitialized storage, destroying the original
+    void (*move)(void* from, void* to);
+    void (*destroy)(void* storage);
+  };
+
+  template <typename Callable>
+  struct IsInline {
+    static constexpr bool value = sizeof(Callable) <= sizeof(Storage) &&
+                                  alignof(Callable) <= alignof(Storage) &&
+                                  std::is_nothrow_move_constructible<Callable>::value;
+  };
+
+  template <typename Callable>
+  struct InlineOps {
+    template <typename Function>
+    static void Construct(void* storage, Function&& func) {
+      new (storage) Callable(std::forward<Function>(func));
+    }
+    static void Invoke(void* storage) { (*static_cast<Callable*>(storage))(); }
+    static void Move(void* from, void* to) {
+      new (to) Callable(std::move(*static_cast<Callable*>(from)));
+      static_cast<Callable*>(from)->~Callable();
+    }
+    static void Destroy(void* storage) { static_cast<Callable*>(storage)->~Callable(); }
+    static const Ops* Get() {
+      static const Ops ops = {&Invoke, &Move, &Destroy};
+      return &ops;
+    }
+  };
+
+  template <typename Callable>
+  struct HeapOps {
+    template <typename Function>
+    static void Construct(void* storage, Function&& func) {
+      *static_cast<Callable**>(storage) = new Callable(std::forward<Function>(func));
+    }
+    static void Invoke(void* storage) { (**static_cast<Callable**>(storage))(); }
+    static void Move(void* from, void* to) {
+      *static_cast<Callable**>(to) = *static_cast<Callable**>(from);
+    }
+    static void Destroy(void* storage) { delete *static_cast<Callable**>(storage); }
+    static const Ops* Get() {
+      static const Ops ops = {&Invoke, &Move, &Destroy};
+      return &ops;
+    }
+  };
 
-  explicit packaged_task_wrapper(PackagedTask&& task)
-      : task_(std::make_shared<PackagedTask>(std::forward<PackagedTask>(task))) {}
+  void Reset() {
+    if (ops_ != NULLPTR) {
+      ops_->destroy(&storage_);
+      ops_ = NULLPTR;
+    }
+  }
+
+  Storage storage_;
+  const Ops* ops_;
 
-  void operator()(Args&&... args) { return (*task_)(std::forward<Args>(args)...); }
-  std::shared_ptr<PackagedTask> task_;
+  ARROW_DISALLOW_COPY_AND_ASSIGN(Task);
 };
 
-}  // namespace detail
+// How the workers of a thread pool are placed on the CPUs of a CpuAffinity
+struct ARROW_EXPORT CpuPinning {
+  enum type {
+    // Each worker is pinned to a single CPU, taking the CPUs in turn
+    ROUND_ROBIN,
+    // Every worker may run on any of the CPUs
+    MASK
+  };
+};
+
+// The CPUs the workers of a thread pool run on (Linux only).  Pinning
+// workers next to the memory they process avoids cross-socket traffic.
+struct ARROW_EXPORT CpuAffinity {
+  CpuPinning::type pinning = CpuPinning::ROUND_ROBIN;
+  // The CPU numbers, as the OS counts them; all of them if empty
+  std::vector<int> cpus;
+};
+
+// Get the number of NUMA nodes of the machine, 1 if it isn't NUMA or this
+// can't be determined.
+ARROW_EXPORT int GetNumaNodeCount();
+
+// Get the CPUs of a NUMA node (Linux only).
+ARROW_EXPORT Status GetNumaNodeCpus(int node, std::vector<int>* cpus);
+
+// A histogram of durations, in buckets of powers of two nanoseconds
+struct ARROW_EXPORT DurationHistogram {
+  static constexpr int kNumBuckets = 40;
+
+  // The number of durations in [2^i, 2^(i+1)) nanoseconds in bucket i, the
+  // first also counting those under a nanosecond and the last, from about
+  // 9 minutes, any longer ones
+  int64_t buckets[kNumBuckets] = {};
+  int64_t count = 0;
+  int64_t total_nanos = 0;
+
+  // An upper bound of the q-quantile of the durations, in nanoseconds
+  int64_t Quantile(double q) const;
+};
+
+// What the workers of a ThreadPool that owned one of its task queues did
+struct ARROW_EXPORT ThreadPoolWorkerStats {
+  int64_t tasks_executed = 0;
+  // Time spent running tasks, and waiting for some to be spawned
+  int64_t busy_nanos = 0;
+  int64_t idle_nanos = 0;
+};
+
+// A snapshot of the activity of a ThreadPool
+struct ARROW_EXPORT ThreadPoolStats {
+  // The number of tasks spawned and not yet started, always recorded
+  int64_t queue_depth = 0;
+  // The time from spawning tasks to starting them, and that they ran for
+  DurationHistogram queue_time;
+  DurationHistogram run_time;
+  // Per task queue; there is one per worker, kept when the capacity shrinks
+  std::vector<ThreadPoolWorkerStats> workers;
+};
 
 class ARROW_EXPORT ThreadPool {
  public:
   // Construct a thread pool with the given number of worker threads
   static Status Make(int threads, std::shared_ptr<ThreadPool>* out);
 
+  // Construct a thread pool whose workers are pinned to CPUs.  Workers
+  // launched later on, as the capacity grows, are pinned alike.
+  static Status Make(int threads, const CpuAffinity& affinity,
+                     std::shared_ptr<ThreadPool>* out);
+
+  // Construct a thread pool whose workers run on the CPUs of a NUMA node,
+  // to process data allocated there (see DefaultMemoryPoolOptions::numa_node).
+  // One such pool can be made per node.
+  static Status MakeForNumaNode(int node, int threads, std::shared_ptr<ThreadPool>* out);
+
   // Destroy thread pool; the pool will first be shut down
   ~ThreadPool();
 
@@ -82,6 +263,20 @@ class ARROW_EXPORT ThreadPool {
   // This is exposed as a static method to help with testing.
   static int DefaultCapacity();
 
+  // Default capacity of a thread pool for I/O-bound tasks.
+  static int DefaultIOCapacity();
+
+  // Start or stop recording the statistics of GetStats(), but for the queue
+  // depth.  Recording reads the clock twice per task, and is off by default.
+  void SetStatsEnabled(bool enabled);
+
+  // Get what the pool did while recording statistics, since it was made or
+  // ResetStats() was last called.  As workers keep running meanwhile, the
+  // figures may be slightly inconsistent with each other.
+  ThreadPoolStats GetStats();
+
+  void ResetStats();
+
   // Shutdown the pool.  Once the pool starts shutting down, new tasks
   // cannot be submitted anymore.
   // If "wait" is true, shutdown waits for all pending tasks to be finished.
@@ -90,9 +285,13 @@ class ARROW_EXPORT ThreadPool {
   Status Shutdown(bool wait = true);
 
   // Spawn a fire-and-forget task on one of the workers.
+  // Each worker has its own task queue.  Tasks spawned from a worker are
+  // pushed onto its queue and run newest first, while idle workers steal
+  // the oldest ones; tasks spawned from other threads are dealt out to the
+  // queues in turn and run in the order they were spawned.
   template <typename Function>
   Status Spawn(Function&& func) {
-    return SpawnReal(std::forward<Function>(func));
+    return SpawnReal(Task(std::forward<Function>(func)));
   }
 
   // Submit a callable and arguments for execution.  Return a future that
@@ -110,7 +309,7 @@ class ARROW_EXPORT ThreadPool {
     auto task = PackagedTask(std::bind(std::forward<Function>(func), args...));
     auto fut = task.get_future();
 
-    Status st = SpawnReal(detail::packaged_task_wrapper<Result>(std::move(task)));
+    Status st = SpawnReal(Task(std::move(task)));
     if (!st.ok()) {
       // This happens when Submit() is called after Shutdown()
       throw std::runtime_error(st.ToString());
@@ -121,7 +320,10 @@ class ARROW_EXPORT ThreadPool {
  protected:
   FRIEND_TEST(TestThreadPool, SetCapacity);
   FRIEND_TEST(TestGlobalThreadPool, Capacity);
+  FRIEND_TEST(TestGlobalThreadPool, IOCapacity);
+  FRIEND_TEST(TestThreadPool, Affinity);
   friend ARROW_EXPORT ThreadPool* GetCpuThreadPool();
+  friend ARROW_EXPORT ThreadPool* GetIOThreadPool();
 
   struct State;
 
@@ -129,20 +331,23 @@ class ARROW_EXPORT ThreadPool {
 
   ARROW_DISALLOW_COPY_AND_ASSIGN(ThreadPool);
 
-  Status SpawnReal(std::function<void()> task);
+  Status SpawnReal(Task task);
   // Collect finished worker threads, making sure the OS threads have exited
   void CollectFinishedWorkersUnlocked();
   // Launch a given number of additional workers
   void LaunchWorkersUnlocked(int threads);
+  // Pin a newly launched worker as the affinity of the pool says
+  void PinWorkerUnlocked(std::thread* thread);
   // Get the current actual capacity
   int GetActualCapacity();
 
   // The worker loop is a static method so that it can keep running
   // after the ThreadPool is destroyed
   static void WorkerLoop(std::shared_ptr<State> state,
-                         std::list<std::thread>::iterator it);
+                         std::list<std::thread>::iterator it, detail::WorkQueue* queue);
 
-  static std::shared_ptr<ThreadPool> MakeCpuThreadPool();
+  // Make a process-global thread pool
+  static std::shared_ptr<ThreadPool> MakeGlobalThreadPool(int threads);
 
   const std::shared_ptr<State> sp_state_;
   State* const state_;
@@ -152,6 +357,10 @@ class ARROW_EXPORT ThreadPool {
 // Return the process-global thread pool for CPU-bound tasks.
 ARROW_EXPORT ThreadPool* GetCpuThreadPool();
 
+// Return the process-global thread pool for blocking I/O.  Tasks that wait
+// on reads or writes belong there rather than in the CPU pool.
+ARROW_EXPORT ThreadPool* GetIOThreadPool();
+
 }  // namespace internal
 }  // namespace arrow
 
@@ -0,0 +1,161 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/test-util.h"
+#include "arrow/util/tracing.h"
+
+namespace arrow {
+namespace tracing {
+
+class TestTracing : public ::testing::Test {
+ public:
+  void TearDown() override {
+    Disable();
+    Clear();
+  }
+};
+
+TEST_F(TestTracing, NotRecordedUnlessEnabled) {
+  ASSERT_FALSE(IsEnabled());
+  {
+    Span span("test", "disabled");
+    ASSERT_FALSE(span.active());
+  }
+  ASSERT_TRUE(GetSpans().empty());
+}
+
+TEST_F(TestTracing, RecordSpans) {
+  Enable();
+  {
+    Span outer("test", "outer");
+    ASSERT_TRUE(outer.active());
+    outer.set_bytes(42);
+    { Span inner("test", "inner"); }
+  }
+  Disable();
+  { Span span("test", "after"); }
+
+  auto spans = GetSpans();
+  ASSERT_EQ(2, spans.size());
+  ASSERT_STREQ("outer", spans[0].name);
+  ASSERT_STREQ("test", spans[0].category);
+  ASSERT_EQ(42, spans[0].bytes);
+  ASSERT_STREQ("inner", spans[1].name);
+  ASSERT_EQ(-1, spans[1].bytes);
+  // The inner span lies within the outer one
+  ASSERT_GE(spans[1].start_nanos, spans[0].start_nanos);
+  ASSERT_LE(spans[1].start_nanos + spans[1].duration_nanos,
+            spans[0].start_nanos + spans[0].duration_nanos);
+
+  Clear();
+  ASSERT_TRUE(GetSpans().empty());
+}
+
+TEST_F(TestTracing, RingKeepsLastSpans) {
+  static const char* kNames[] = {"0", "1", "2", "3", "4", "5", "6"};
+  Enable(4);
+  for (const char* name : kNames) {
+    Span span("test", name);
+  }
+  auto spans = GetSpans();
+  ASSERT_EQ(4, spans.size());
+  for (int i = 0; i < 4; ++i) {
+    ASSERT_STREQ(kNames[3 + i], spans[i].name);
+  }
+}
+
+TEST_F(TestTracing, SpansOfThreads) {
+  Enable();
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i) {
+    threads.emplace_back([]() {
+      for (int j = 0; j < 100; ++j) {
+        Span span("test", "thread");
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  // The spans outlive their threads
+  auto spans = GetSpans();
+  ASSERT_EQ(400, spans.size());
+  std::vector<int> per_thread_id;
+  for (const auto& span : spans) {
+    if (span.thread_id >= static_cast<int32_t>(per_thread_id.size())) {
+      per_thread_id.resize(span.thread_id + 1);
+    }
+    ++per_thread_id[span.thread_id];
+  }
+  int num_threads = 0;
+  for (int count : per_thread_id) {
+    if (count > 0) {
+      ASSERT_EQ(100, count);
+      ++num_threads;
+    }
+  }
+  ASSERT_EQ(4, num_threads);
+}
+
+TEST_F(TestTracing, ChromeTrace) {
+  Enable();
+  {
+    Span span("ipc", "Read\"Quoted\"");
+    span.set_bytes(1024);
+  }
+  { Span span("compute", "Kernel"); }
+  std::stringstream ss;
+  WriteChromeTrace(&ss);
+  const std::string trace = ss.str();
+
+  ASSERT_EQ(0, trace.find("{\"traceEvents\":["));
+  ASSERT_NE(std::string::npos,
+            trace.find("\"name\":\"Read\\\"Quoted\\\"\",\"cat\":\"ipc\""));
+  ASSERT_NE(std::string::npos, trace.find("\"args\":{\"bytes\":1024}"));
+  ASSERT_NE(std::string::npos, trace.find("\"name\":\"Kernel\",\"cat\":\"compute\""));
+  int num_events = 0;
+  for (size_t pos = trace.find("\"ph\":\"X\""); pos != std::string::npos;
+       pos = trace.find("\"ph\":\"X\"", pos + 1)) {
+    ++num_events;
+  }
+  ASSERT_EQ(2, num_events);
+}
+
+TEST_F(TestTracing, Macros) {
+  Enable();
+  {
+    ARROW_TRACE_SPAN(span, "test", "macro");
+    ARROW_TRACE_BYTES(span, 7);
+  }
+#ifdef ARROW_TRACING
+  auto spans = GetSpans();
+  ASSERT_EQ(1, spans.size());
+  ASSERT_EQ(7, spans[0].bytes);
+#else
+  ASSERT_TRUE(GetSpans().empty());
+#endif
+}
+
+}  // namespace tracing
+}  // namespace arrow
@@ -0,0 +1,181 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/tracing.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+
+namespace arrow {
+namespace tracing {
+
+namespace {
+
+std::atomic<bool> enabled(false);
+// The number of spans each thread keeps
+std::atomic<int64_t> ring_capacity(kDefaultSpansPerThread);
+
+int64_t NowNanos() {
+  static const auto epoch = std::chrono::steady_clock::now();
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now() - epoch)
+      .count();
+}
+
+// The spans of a thread. The lock is only contended when the spans are
+// collected or cleared.
+struct ThreadSpans {
+  explicit ThreadSpans(int32_t id) : thread_id(id) {}
+
+  std::mutex mutex;
+  std::vector<SpanRecord> ring;
+  // The number of spans recorded, of which the ring keeps the last
+  int64_t num_recorded = 0;
+  const int32_t thread_id;
+};
+
+// The spans of every thread that recorded some, kept once the threads exit
+struct Registry {
+  std::mutex mutex;
+  std::vector<std::shared_ptr<ThreadSpans>> threads;
+};
+
+Registry* GetRegistry() {
+  static Registry registry;
+  return &registry;
+}
+
+ThreadSpans* GetThreadSpans() {
+  static thread_local std::shared_ptr<ThreadSpans> spans;
+  if (spans == nullptr) {
+    Registry* registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry->mutex);
+    spans = std::make_shared<ThreadSpans>(static_cast<int32_t>(registry->threads.size()));
+    registry->threads.push_back(spans);
+  }
+  return spans.get();
+}
+
+void WriteJsonString(const char* str, std::ostream* out) {
+  *out << '"';
+  for (const char* c = str; *c != '\0'; ++c) {
+    if (*c == '"' || *c == '\\') {
+      *out << '\\';
+    }
+    *out << *c;
+  }
+  *out << '"';
+}
+
+}  // namespace
+
+void Enable(int64_t spans_per_thread) {
+  Clear();
+  ring_capacity.store(std::max<int64_t>(spans_per_thread, 1));
+  enabled.store(true);
+}
+
+void Disable() { enabled.store(false); }
+
+bool IsEnabled() { return enabled.load(std::memory_order_relaxed); }
+
+void Clear() {
+  Registry* registry = GetRegistry();
+  std::lock_guard<std::mutex> lock(registry->mutex);
+  for (const auto& thread : registry->threads) {
+    std::lock_guard<std::mutex> thread_lock(thread->mutex);
+    thread->ring.clear();
+    thread->num_recorded = 0;
+  }
+}
+
+std::vector<SpanRecord> GetSpans() {
+  std::vector<SpanRecord> spans;
+  {
+    Registry* registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry->mutex);
+    for (const auto& thread : registry->threads) {
+      std::lock_guard<std::mutex> thread_lock(thread->mutex);
+      spans.insert(spans.end(), thread->ring.begin(), thread->ring.end());
+    }
+  }
+  std::stable_sort(spans.begin(), spans.end(),
+                   [](const SpanRecord& left, const SpanRecord& right) {
+                     return left.start_nanos < right.start_nanos;
+                   });
+  return spans;
+}
+
+void WriteChromeTrace(std::ostream* out) {
+  // Complete ("X") events, timed in microseconds
+  *out << "{\"traceEvents\":[";
+  bool first = true;
+  for (const SpanRecord& span : GetSpans()) {
+    *out << (first ? "\n" : ",\n") << "{\"name\":";
+    WriteJsonString(span.name, out);
+    *out << ",\"cat\":";
+    WriteJsonString(span.category, out);
+    *out << ",\"ph\":\"X\",\"ts\":" << static_cast<double>(span.start_nanos) / 1000
+         << ",\"dur\":" << static_cast<double>(span.duration_nanos) / 1000
+         << ",\"pid\":0,\"tid\":" << span.thread_id;
+    if (span.bytes >= 0) {
+      *out << ",\"args\":{\"bytes\":" << span.bytes << "}";
+    }
+    *out << "}";
+    first = false;
+  }
+  *out << "\n],\"displayTimeUnit\":\"ns\"}\n";
+}
+
+Status WriteChromeTrace(const std::string& path) {
+  std::ofstream out(path);
+  if (!out) {
+    return Status::IOError("Could not open " + path + " to write the trace to");
+  }
+  WriteChromeTrace(&out);
+  out.close();
+  if (!out) {
+    return Status::IOError("Could not write the trace to " + path);
+  }
+  return Status::OK();
+}
+
+int64_t Span::Start() { return IsEnabled() ? NowNanos() : -1; }
+
+void Span::Record() {
+  const int64_t end_nanos = NowNanos();
+  ThreadSpans* spans = GetThreadSpans();
+  const SpanRecord record = {category_, name_,  start_nanos_, end_nanos - start_nanos_,
+                             bytes_,    spans->thread_id};
+  const auto capacity = static_cast<size_t>(ring_capacity.load());
+
+  std::lock_guard<std::mutex> lock(spans->mutex);
+  if (spans->ring.size() < capacity) {
+    spans->ring.push_back(record);
+  } else {
+    spans->ring[spans->num_recorded % capacity] = record;
+  }
+  ++spans->num_recorded;
+}
+
+}  // namespace tracing
+}  // namespace arrow
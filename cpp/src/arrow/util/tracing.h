@@ -0,0 +1,139 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Lightweight tracing of where the time of a pipeline goes
+//
+// Spans are the intervals of time that the instrumented operations took,
+// with the number of bytes they processed. Once compiled in, with the
+// ARROW_TRACING build option, they are only recorded after tracing::Enable,
+// each thread keeping the last of its spans in a ring buffer of its own.
+// The spans recorded can be written out in the JSON format of the Chrome
+// trace viewer (chrome://tracing, or https://ui.perfetto.dev).
+
+#ifndef ARROW_UTIL_TRACING_H
+#define ARROW_UTIL_TRACING_H
+
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace tracing {
+
+/// The number of spans that each thread keeps by default
+constexpr int64_t kDefaultSpansPerThread = 1 << 16;
+
+/// \brief Start recording spans, discarding those recorded before
+///
+/// \param[in] spans_per_thread the number of spans each thread keeps, the
+/// oldest being overwritten by newer ones
+ARROW_EXPORT void Enable(int64_t spans_per_thread = kDefaultSpansPerThread);
+
+/// \brief Stop recording spans, keeping those recorded
+ARROW_EXPORT void Disable();
+
+ARROW_EXPORT bool IsEnabled();
+
+/// \brief Discard the spans recorded
+ARROW_EXPORT void Clear();
+
+struct ARROW_EXPORT SpanRecord {
+  const char* category;
+  const char* name;
+  /// Since the first span of the process
+  int64_t start_nanos;
+  int64_t duration_nanos;
+  /// -1 if the span processed no bytes that were counted
+  int64_t bytes;
+  /// Numbered in the order the threads recorded their first span
+  int32_t thread_id;
+};
+
+/// \brief The spans recorded by all threads, in order of their start
+ARROW_EXPORT std::vector<SpanRecord> GetSpans();
+
+/// \brief Write the spans recorded as a Chrome trace JSON document
+ARROW_EXPORT void WriteChromeTrace(std::ostream* out);
+
+/// \brief Write the spans recorded as a Chrome trace JSON file
+ARROW_EXPORT Status WriteChromeTrace(const std::string& path);
+
+/// \brief The time an operation takes, recorded when it goes out of scope
+///
+/// The category and name must be string literals, or otherwise outlive the
+/// spans recorded. Use the ARROW_TRACE_ macros rather than this class to
+/// instrument code, so that the instrumentation is compiled out of builds
+/// without tracing.
+class ARROW_EXPORT Span {
+ public:
+  Span(const char* category, const char* name)
+      : category_(category), name_(name), bytes_(-1), start_nanos_(Start()) {}
+
+  ~Span() {
+    if (start_nanos_ >= 0) {
+      Record();
+    }
+  }
+
+  /// Whether the span is being recorded, so that the bytes are worth counting
+  bool active() const { return start_nanos_ >= 0; }
+
+  void set_bytes(int64_t bytes) { bytes_ = bytes; }
+
+ private:
+  // The time now if tracing is enabled, otherwise -1
+  static int64_t Start();
+  void Record();
+
+  const char* category_;
+  const char* name_;
+  int64_t bytes_;
+  const int64_t start_nanos_;
+
+  ARROW_DISALLOW_COPY_AND_ASSIGN(Span);
+};
+
+}  // namespace tracing
+}  // namespace arrow
+
+#ifdef ARROW_TRACING
+
+/// Trace the rest of the enclosing scope as a span named SPAN in the code
+#define ARROW_TRACE_SPAN(SPAN, CATEGORY, NAME) \
+  ::arrow::tracing::Span SPAN(CATEGORY, NAME)
+
+/// Set the bytes processed by a span, evaluated only if it is being recorded
+#define ARROW_TRACE_BYTES(SPAN, BYTES) \
+  do {                                 \
+    if (SPAN.active()) {               \
+      SPAN.set_bytes(BYTES);           \
+    }                                  \
+  } while (false)
+
+#else
+
+#define ARROW_TRACE_SPAN(SPAN, CATEGORY, NAME)
+#define ARROW_TRACE_BYTES(SPAN, BYTES)
+
+#endif  // ARROW_TRACING
+
+#endif  // ARROW_UTIL_TRACING_H
@@ -44,6 +44,8 @@ ARRAY_VISITOR_DEFAULT(HalfFloatArray);
 ARRAY_VISITOR_DEFAULT(FloatArray);
 ARRAY_VISITOR_DEFAULT(DoubleArray);
 ARRAY_VISITOR_DEFAULT(BinaryArray);
+ARRAY_VISITOR_DEFAULT(LargeStringArray);
+ARRAY_VISITOR_DEFAULT(LargeBinaryArray);
 ARRAY_VISITOR_DEFAULT(StringArray);
 ARRAY_VISITOR_DEFAULT(FixedSizeBinaryArray);
 ARRAY_VISITOR_DEFAULT(Date32Array);
@@ -53,6 +55,9 @@ ARRAY_VISITOR_DEFAULT(Time64Array);
 ARRAY_VISITOR_DEFAULT(TimestampArray);
 ARRAY_VISITOR_DEFAULT(IntervalArray);
 ARRAY_VISITOR_DEFAULT(ListArray);
+ARRAY_VISITOR_DEFAULT(LargeListArray);
+ARRAY_VISITOR_DEFAULT(FixedSizeListArray);
+ARRAY_VISITOR_DEFAULT(RunLengthEncodedArray);
 ARRAY_VISITOR_DEFAULT(StructArray);
 ARRAY_VISITOR_DEFAULT(UnionArray);
 ARRAY_VISITOR_DEFAULT(DictionaryArray);
@@ -83,6 +88,8 @@ TYPE_VISITOR_DEFAULT(FloatType);
 TYPE_VISITOR_DEFAULT(DoubleType);
 TYPE_VISITOR_DEFAULT(StringType);
 TYPE_VISITOR_DEFAULT(BinaryType);
+TYPE_VISITOR_DEFAULT(LargeStringType);
+TYPE_VISITOR_DEFAULT(LargeBinaryType);
 TYPE_VISITOR_DEFAULT(FixedSizeBinaryType);
 TYPE_VISITOR_DEFAULT(Date64Type);
 TYPE_VISITOR_DEFAULT(Date32Type);
@@ -92,6 +99,9 @@ TYPE_VISITOR_DEFAULT(TimestampType);
 TYPE_VISITOR_DEFAULT(IntervalType);
 TYPE_VISITOR_DEFAULT(Decimal128Type);
 TYPE_VISITOR_DEFAULT(ListType);
+TYPE_VISITOR_DEFAULT(LargeListType);
+TYPE_VISITOR_DEFAULT(FixedSizeListType);
+TYPE_VISITOR_DEFAULT(RunLengthEncodedType);
 TYPE_VISITOR_DEFAULT(StructType);
 TYPE_VISITOR_DEFAULT(UnionType);
 TYPE_VISITOR_DEFAULT(DictionaryType);
@@ -43,6 +43,8 @@ class ARROW_EXPORT ArrayVisitor {
   virtual Status Visit(const DoubleArray& array);
   virtual Status Visit(const StringArray& array);
   virtual Status Visit(const BinaryArray& array);
+  virtual Status Visit(const LargeStringArray& array);
+  virtual Status Visit(const LargeBinaryArray& array);
   virtual Status Visit(const FixedSizeBinaryArray& array);
   virtual Status Visit(const Date32Array& array);
   virtual Status Visit(const Date64Array& array);
@@ -52,6 +54,9 @@ class ARROW_EXPORT ArrayVisitor {
   virtual Status Visit(const IntervalArray& array);
   virtual Status Visit(const Decimal128Array& array);
   virtual Status Visit(const ListArray& array);
+  virtual Status Visit(const LargeListArray& array);
+  virtual Status Visit(const FixedSizeListArray& array);
+  virtual Status Visit(const RunLengthEncodedArray& array);
   virtual Status Visit(const StructArray& array);
   virtual Status Visit(const UnionArray& array);
   virtual Status Visit(const DictionaryArray& type);
@@ -76,6 +81,8 @@ class ARROW_EXPORT TypeVisitor {
   virtual Status Visit(const DoubleType& type);
   virtual Status Visit(const StringType& type);
   virtual Status Visit(const BinaryType& type);
+  virtual Status Visit(const LargeStringType& type);
+  virtual Status Visit(const LargeBinaryType& type);
   virtual Status Visit(const FixedSizeBinaryType& type);
   virtual Status Visit(const Date64Type& type);
   virtual Status Visit(const Date32Type& type);
@@ -85,6 +92,9 @@ class ARROW_EXPORT TypeVisitor {
   virtual Status Visit(const IntervalType& type);
   virtual Status Visit(const Decimal128Type& type);
   virtual Status Visit(const ListType& type);
+  virtual Status Visit(const LargeListType& type);
+  virtual Status Visit(const FixedSizeListType& type);
+  virtual Status Visit(const RunLengthEncodedType& type);
   virtual Status Visit(const StructType& type);
   virtual Status Visit(const UnionType& type);
   virtual Status Visit(const DictionaryType& type);
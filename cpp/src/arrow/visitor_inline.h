@@ -20,10 +20,16 @@
 #ifndef ARROW_VISITOR_INLINE_H
 #define ARROW_VISITOR_INLINE_H
 
+#include <cstdint>
+#include <utility>
+
 #include "arrow/array.h"
+#include "arrow/buffer.h"
 #include "arrow/status.h"
 #include "arrow/tensor.h"
 #include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit-util.h"
 #include "arrow/util/checked_cast.h"
 
 namespace arrow {
@@ -50,6 +56,8 @@ inline Status VisitTypeInline(const DataType& type, VISITOR* visitor) {
     TYPE_VISIT_INLINE(DoubleType);
     TYPE_VISIT_INLINE(StringType);
     TYPE_VISIT_INLINE(BinaryType);
+    TYPE_VISIT_INLINE(LargeStringType);
+    TYPE_VISIT_INLINE(LargeBinaryType);
     TYPE_VISIT_INLINE(FixedSizeBinaryType);
     TYPE_VISIT_INLINE(Date32Type);
     TYPE_VISIT_INLINE(Date64Type);
@@ -58,6 +66,9 @@ inline Status VisitTypeInline(const DataType& type, VISITOR* visitor) {
     TYPE_VISIT_INLINE(Time64Type);
     TYPE_VISIT_INLINE(Decimal128Type);
     TYPE_VISIT_INLINE(ListType);
+    TYPE_VISIT_INLINE(LargeListType);
+    TYPE_VISIT_INLINE(FixedSizeListType);
+    TYPE_VISIT_INLINE(RunLengthEncodedType);
     TYPE_VISIT_INLINE(StructType);
     TYPE_VISIT_INLINE(UnionType);
     TYPE_VISIT_INLINE(DictionaryType);
@@ -92,6 +103,8 @@ inline Status VisitArrayInline(const Array& array, VISITOR* visitor) {
     ARRAY_VISIT_INLINE(DoubleType);
     ARRAY_VISIT_INLINE(StringType);
     ARRAY_VISIT_INLINE(BinaryType);
+    ARRAY_VISIT_INLINE(LargeStringType);
+    ARRAY_VISIT_INLINE(LargeBinaryType);
     ARRAY_VISIT_INLINE(FixedSizeBinaryType);
     ARRAY_VISIT_INLINE(Date32Type);
     ARRAY_VISIT_INLINE(Date64Type);
@@ -100,6 +113,9 @@ inline Status VisitArrayInline(const Array& array, VISITOR* visitor) {
     ARRAY_VISIT_INLINE(Time64Type);
     ARRAY_VISIT_INLINE(Decimal128Type);
     ARRAY_VISIT_INLINE(ListType);
+    ARRAY_VISIT_INLINE(LargeListType);
+    ARRAY_VISIT_INLINE(FixedSizeListType);
+    ARRAY_VISIT_INLINE(RunLengthEncodedType);
     ARRAY_VISIT_INLINE(StructType);
     ARRAY_VISIT_INLINE(UnionType);
     ARRAY_VISIT_INLINE(DictionaryType);
@@ -109,6 +125,166 @@ inline Status VisitArrayInline(const Array& array, VISITOR* visitor) {
   return Status::NotImplemented("Type not implemented");
 }
 
+namespace internal {
+
+// The values of buffer i of data from its offset, null if there is no buffer
+template <typename C>
+const C* ArrayDataValues(const ::arrow::ArrayData& data, int i) {
+  const std::shared_ptr<Buffer>& buffer = data.buffers[i];
+  return buffer == NULLPTR ? NULLPTR
+                           : reinterpret_cast<const C*>(buffer->data()) + data.offset;
+}
+
+// Read the value of a slot of ArrayData of type T and pass it on to a visit
+// function, as func(i, value) or func(i, data, length) for binary types
+template <typename T, typename Enable = void>
+struct ArrayValueReader {};
+
+template <typename T>
+struct ArrayValueReader<T, enable_if_has_c_type<T>> {
+  explicit ArrayValueReader(const ::arrow::ArrayData& data)
+      : values(ArrayDataValues<typename T::c_type>(data, 1)) {}
+
+  template <typename Func>
+  bool Visit(int64_t i, Func&& func) const {
+    return func(i, values[i]);
+  }
+
+  const typename T::c_type* values;
+};
+
+template <typename T>
+struct ArrayValueReader<T, enable_if_boolean<T>> {
+  explicit ArrayValueReader(const ::arrow::ArrayData& data)
+      : values(data.buffers[1] == NULLPTR ? NULLPTR : data.buffers[1]->data()),
+        offset(data.offset) {}
+
+  template <typename Func>
+  bool Visit(int64_t i, Func&& func) const {
+    return func(i, BitUtil::GetBit(values, offset + i));
+  }
+
+  const uint8_t* values;
+  int64_t offset;
+};
+
+template <typename T>
+struct ArrayValueReader<T, enable_if_binary<T>> {
+  explicit ArrayValueReader(const ::arrow::ArrayData& data)
+      : offsets(ArrayDataValues<int32_t>(data, 1)),
+        values(data.buffers[2] == NULLPTR ? NULLPTR : data.buffers[2]->data()) {}
+
+  template <typename Func>
+  bool Visit(int64_t i, Func&& func) const {
+    return func(i, values + offsets[i], offsets[i + 1] - offsets[i]);
+  }
+
+  const int32_t* offsets;
+  const uint8_t* values;
+};
+
+template <typename T>
+struct ArrayValueReader<T, enable_if_large_binary<T>> {
+  explicit ArrayValueReader(const ::arrow::ArrayData& data)
+      : offsets(ArrayDataValues<int64_t>(data, 1)),
+        values(data.buffers[2] == NULLPTR ? NULLPTR : data.buffers[2]->data()) {}
+
+  template <typename Func>
+  bool Visit(int64_t i, Func&& func) const {
+    return func(i, values + offsets[i], offsets[i + 1] - offsets[i]);
+  }
+
+  const int64_t* offsets;
+  const uint8_t* values;
+};
+
+template <typename T>
+struct ArrayValueReader<T, enable_if_fixed_size_binary<T>> {
+  explicit ArrayValueReader(const ::arrow::ArrayData& data)
+      : byte_width(checked_cast<const FixedSizeBinaryType&>(*data.type).byte_width()),
+        values(data.buffers[1] == NULLPTR
+                   ? NULLPTR
+                   : data.buffers[1]->data() + data.offset * byte_width) {}
+
+  template <typename Func>
+  bool Visit(int64_t i, Func&& func) const {
+    return func(i, values + i * byte_width);
+  }
+
+  int32_t byte_width;
+  const uint8_t* values;
+};
+
+}  // namespace internal
+
+/// \brief Visit the slots [offset, offset + length) of data, an array of type
+/// T, with valid_func for the valid ones and null_func(i) for the nulls
+///
+/// valid_func is called as valid_func(i, value) with the C value, or the bool,
+/// of the slot, or as valid_func(i, data, length) for binary types and
+/// valid_func(i, data) for fixed-size binary types; the length of a large
+/// binary value is an int64_t. i is the index of the slot
+/// in data. Both functions return whether to go on with the visit.
+///
+/// Arrays without nulls are visited by a loop without any null check; the
+/// others by blocks of their validity bitmap, only the blocks which mix valid
+/// slots and nulls testing each bit.
+///
+/// \return false if a function stopped the visit
+template <typename T, typename ValidFunc, typename NullFunc>
+bool VisitArrayValuesInline(const ArrayData& data, int64_t offset, int64_t length,
+                            ValidFunc&& valid_func, NullFunc&& null_func) {
+  const internal::ArrayValueReader<T> reader(data);
+  const int64_t end = offset + length;
+  if (data.null_count == 0 || data.buffers[0] == NULLPTR) {
+    for (int64_t i = offset; i < end; ++i) {
+      if (!reader.Visit(i, valid_func)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  const uint8_t* bitmap = data.buffers[0]->data();
+  internal::BitBlockCounter counter(bitmap, data.offset + offset, length);
+  for (int64_t i = offset; i < end;) {
+    const internal::BitBlockCount block = counter.NextFourWords();
+    const int64_t block_end = i + block.length;
+    if (block.AllSet()) {
+      for (; i < block_end; ++i) {
+        if (!reader.Visit(i, valid_func)) {
+          return false;
+        }
+      }
+    } else if (block.NoneSet()) {
+      for (; i < block_end; ++i) {
+        if (!null_func(i)) {
+          return false;
+        }
+      }
+    } else {
+      for (; i < block_end; ++i) {
+        const bool keep_going = BitUtil::GetBit(bitmap, data.offset + i)
+                                    ? reader.Visit(i, valid_func)
+                                    : null_func(i);
+        if (!keep_going) {
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+
+/// \brief Visit all of the slots of data, an array of type T
+template <typename T, typename ValidFunc, typename NullFunc>
+bool VisitArrayValuesInline(const ArrayData& data, ValidFunc&& valid_func,
+                            NullFunc&& null_func) {
+  return VisitArrayValuesInline<T>(data, 0, data.length,
+                                   std::forward<ValidFunc>(valid_func),
+                                   std::forward<NullFunc>(null_func));
+}
+
 }  // namespace arrow
 
 #endif  // ARROW_VISITOR_INLINE_H
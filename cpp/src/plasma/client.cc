@@ -23,14 +23,17 @@
 #include <Win32_Interop/win32_types.h>
 #endif
 
+#include <errno.h>
 #include <fcntl.h>
 #include <netinet/in.h>
+#include <poll.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <strings.h>
 #include <sys/ioctl.h>
 #include <sys/mman.h>
 #include <sys/socket.h>
+#include <sys/stat.h>
 #include <sys/types.h>
 #include <sys/un.h>
 #include <time.h>
@@ -44,6 +47,13 @@
 #include <vector>
 
 #include "arrow/buffer.h"
+#include "arrow/io/memory.h"
+#include "arrow/ipc/reader.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
+#include "arrow/util/cpu-info.h"
+#include "arrow/util/memory.h"
 #include "arrow/util/thread-pool.h"
 
 #include "plasma/common.h"
@@ -52,6 +62,7 @@
 #include "plasma/malloc.h"
 #include "plasma/plasma.h"
 #include "plasma/protocol.h"
+#include "plasma/ring.h"
 
 #ifdef PLASMA_GPU
 #include "arrow/gpu/cuda_api.h"
@@ -67,6 +78,11 @@ using arrow::gpu::CudaDeviceManager;
 
 #define XXH64_DEFAULT_SEED 0
 
+#if defined(__GNUC__) && defined(__x86_64__)
+#include <nmmintrin.h>
+#define PLASMA_HAVE_CRC32C
+#endif
+
 namespace fb = plasma::flatbuf;
 
 namespace plasma {
@@ -78,10 +94,15 @@ using arrow::MutableBuffer;
 
 typedef struct XXH64_state_s XXH64_state_t;
 
-// Number of threads used for hash computations.
-constexpr int64_t kHashingConcurrency = 8;
+// Hashes a chunk of the data of an object.
+typedef uint64_t (*BlockHashFunction)(const uint8_t* data, int64_t nbytes);
+
 constexpr int64_t kBytesInMB = 1 << 20;
 
+// The data of an object is hashed in chunks of at least kBytesInMB, with at
+// most this many chunks.
+constexpr int64_t kMaxHashingChunks = 64;
+
 // Use 100MB as an overestimate of the L3 cache size.
 constexpr int64_t kL3CacheSizeBytes = 100000000;
 
@@ -89,18 +110,31 @@ constexpr int64_t kL3CacheSizeBytes = 100000000;
 // GPU support
 
 #ifdef PLASMA_GPU
-struct GpuProcessHandle {
-  /// Pointer to CUDA buffer that is backing this GPU object.
-  std::shared_ptr<CudaBuffer> ptr;
-  /// Number of client using this GPU object.
-  int client_count;
-};
-
-// This is necessary as IPC handles can only be mapped once per process.
-// Thus if multiple clients in the same process get the same gpu object,
-// they need to access the same mapped CudaBuffer.
-static std::unordered_map<ObjectID, GpuProcessHandle*> gpu_object_map;
+// IPC handles can only be opened once per process, and opening one is
+// expensive. The store sub-allocates the objects on a GPU from large blocks
+// that it keeps, so each block is opened once, when the first object in it is
+// used by a client of the process, and the buffer of an object is a slice of
+// it. The blocks are keyed by their serialized IPC handles.
+static std::unordered_map<std::string, std::shared_ptr<CudaBuffer>> gpu_block_map;
 static std::mutex gpu_mutex;
+
+static Status OpenGpuObject(CudaDeviceManager* manager, const PlasmaObject& object,
+                            std::shared_ptr<CudaBuffer>* out) {
+  std::shared_ptr<Buffer> handle;
+  RETURN_NOT_OK(object.ipc_handle->Serialize(arrow::default_memory_pool(), &handle));
+  std::lock_guard<std::mutex> lock(gpu_mutex);
+  const std::string key(reinterpret_cast<const char*>(handle->data()),
+                        static_cast<size_t>(handle->size()));
+  std::shared_ptr<CudaBuffer>& block = gpu_block_map[key];
+  if (block == nullptr) {
+    std::shared_ptr<CudaContext> context;
+    RETURN_NOT_OK(manager->GetContext(object.device_num - 1, &context));
+    RETURN_NOT_OK(context->OpenIpcBuffer(*object.ipc_handle, &block));
+  }
+  *out = std::make_shared<CudaBuffer>(block, object.data_offset,
+                                      object.data_size + object.metadata_size);
+  return Status::OK();
+}
 #endif
 
 // ----------------------------------------------------------------------
@@ -156,8 +190,13 @@ struct ClientMmapTableEntry {
   /// The length of the memory-mapped file.
   size_t length;
   /// The number of objects in this memory-mapped file that are currently being
-  /// used by the client. When this count reaches zeros, we unmap the file.
+  /// used by the client. When this count reaches zeros, we unmap the file,
+  /// unless the client keeps the files mapped.
   int count;
+  /// The identity of the file, to tell whether the store reused its file
+  /// descriptor for another file while the client used none of its objects.
+  dev_t device;
+  ino_t inode;
 };
 
 class PlasmaClient::Impl : public std::enable_shared_from_this<PlasmaClient::Impl> {
@@ -174,31 +213,69 @@ class PlasmaClient::Impl : public std::enable_shared_from_this<PlasmaClient::Imp
   Status Create(const ObjectID& object_id, int64_t data_size, const uint8_t* metadata,
                 int64_t metadata_size, std::shared_ptr<Buffer>* data, int device_num = 0);
 
+  Status Create(const std::vector<ObjectID>& object_ids,
+                const std::vector<int64_t>& data_sizes,
+                const std::vector<std::string>& metadata,
+                std::vector<std::shared_ptr<Buffer>>* data);
+
   Status Get(const std::vector<ObjectID>& object_ids, int64_t timeout_ms,
              std::vector<ObjectBuffer>* object_buffers);
 
   Status Get(const ObjectID* object_ids, int64_t num_objects, int64_t timeout_ms,
              ObjectBuffer* object_buffers);
 
+  Status PutRecordBatch(const ObjectID& object_id, const arrow::RecordBatch& batch);
+
+  Status GetRecordBatch(const ObjectID& object_id, int64_t timeout_ms,
+                        std::shared_ptr<arrow::RecordBatch>* batch);
+
+  Status ConnectAsync(int* fd);
+
+  Status GetAsync(const std::vector<ObjectID>& object_ids, int64_t timeout_ms,
+                  GetCallback callback);
+
+  Status ProcessAsyncReplies(int* num_replies);
+
   Status Release(const ObjectID& object_id);
 
+  Status Release(const std::vector<ObjectID>& object_ids);
+
   Status Contains(const ObjectID& object_id, bool* has_object);
 
   Status Abort(const ObjectID& object_id);
 
   Status Seal(const ObjectID& object_id);
 
+  Status Seal(const std::vector<ObjectID>& object_ids);
+
   Status Delete(const std::vector<ObjectID>& object_ids);
 
   Status Evict(int64_t num_bytes, int64_t& num_bytes_evicted);
 
   Status Hash(const ObjectID& object_id, uint8_t* digest);
 
+  Status UseReleaseRing(int64_t capacity);
+
+  Status SetDigestType(DigestType type);
+
+  Status SetKeepMapped(bool keep_mapped);
+
+  Status SetClientOptions(const std::string& client_name, int64_t output_memory_quota);
+
+  Status GetQuotaStats(std::vector<QuotaStats>* stats);
+
+  Status Reserve(int64_t data_size, int64_t metadata_size, int64_t count,
+                 int64_t* num_reserved);
+
+  Status GetStoreStats(PlasmaStoreStats* stats);
+
   Status Subscribe(int* fd);
 
   Status GetNotification(int fd, ObjectID* object_id, int64_t* data_size,
                          int64_t* metadata_size);
 
+  Status GetNotifications(int fd, std::vector<ObjectNotification>* notifications);
+
   Status Disconnect();
 
   Status Fetch(int num_object_ids, const ObjectID* object_ids);
@@ -223,7 +300,23 @@ class PlasmaClient::Impl : public std::enable_shared_from_this<PlasmaClient::Imp
   /// @param object_id The object ID whose data we should unmap.
   Status UnmapObject(const ObjectID& object_id);
 
-  Status PerformRelease(const ObjectID& object_id);
+  Status PerformRelease(const ObjectID& object_id,
+                        std::vector<ObjectID>* released = nullptr);
+
+  Status Release(const ObjectID& object_id, std::vector<ObjectID>* released);
+
+  /// Fill the buffers of the objects of a get reply, whose file descriptors
+  /// are then read from a connection to the store.
+  ///
+  /// @param held If not null, the objects whose count the client incremented
+  ///        when it sent the request, which are removed as their buffers take
+  ///        over the count.
+  Status ProcessGetReply(
+      int conn, std::vector<uint8_t>* buffer, const ObjectID* object_ids,
+      int64_t num_objects,
+      const std::function<std::shared_ptr<Buffer>(
+          const ObjectID&, const std::shared_ptr<Buffer>&)>& wrap_buffer,
+      std::unordered_set<ObjectID>* held, ObjectBuffer* object_buffers);
 
   /// Common helper for Get() variants
   Status GetBuffers(const ObjectID* object_ids, int64_t num_objects, int64_t timeout_ms,
@@ -235,14 +328,21 @@ class PlasmaClient::Impl : public std::enable_shared_from_this<PlasmaClient::Imp
 
   uint8_t* LookupMmappedFile(int store_fd_val);
 
+  Status UnmapUnusedFiles();
+
   void IncrementObjectCount(const ObjectID& object_id, PlasmaObject* object,
                             bool is_sealed);
 
-  bool ComputeObjectHashParallel(XXH64_state_t* hash_state, const unsigned char* data,
-                                 int64_t nbytes);
+  void ComputeObjectHashParallel(XXH64_state_t* hash_state, BlockHashFunction hash_block,
+                                 const unsigned char* data, int64_t nbytes,
+                                 int num_chunks);
 
   uint64_t ComputeObjectHash(const ObjectBuffer& obj_buffer);
 
+  /// The digest an object is sealed with, as the digest type of the client
+  /// asks.
+  Status SealDigest(const ObjectID& object_id, uint8_t* digest);
+
   /// File descriptor of the Unix domain socket that connects to the store.
   int store_conn_;
   /// File descriptor of the Unix domain socket that connects to the manager.
@@ -272,6 +372,31 @@ class PlasmaClient::Impl : public std::enable_shared_from_this<PlasmaClient::Imp
   int64_t store_capacity_;
   /// A hash set to record the ids that users want to delete but still in use.
   std::unordered_set<ObjectID> deletion_cache_;
+  /// The ring of released objects shared with the store, if any.
+  std::unique_ptr<ReleaseRing> release_ring_;
+  /// How the digests of the objects sealed by the client are computed.
+  DigestType digest_type_;
+  /// Whether the memory-mapped files are kept until the client disconnects.
+  bool keep_mapped_;
+  /// The socket that the replies to asynchronous get requests come on, or -1.
+  int async_conn_;
+  /// An asynchronous get request that has not been replied to.
+  struct AsyncGetRequest {
+    std::vector<ObjectID> object_ids;
+    /// The objects in use when the request was sent, held until the reply.
+    std::unordered_set<ObjectID> held;
+    GetCallback callback;
+  };
+  /// The asynchronous get requests waiting for their replies, by ID.
+  std::unordered_map<int64_t, AsyncGetRequest> async_gets_;
+  /// The ID of the next asynchronous get request.
+  int64_t next_async_get_id_;
+  /// The notifications received on each subscription socket that
+  /// GetNotification() has not returned yet.
+  std::unordered_map<int, std::deque<ObjectNotification>> notifications_;
+  /// The schemas parsed by GetRecordBatch() of the objects in use, which are
+  /// dropped with the objects as they cannot change until then.
+  std::unordered_map<ObjectID, std::shared_ptr<arrow::Schema>> schemas_;
 
 #ifdef PLASMA_GPU
   /// Cuda Device Manager.
@@ -281,7 +406,11 @@ class PlasmaClient::Impl : public std::enable_shared_from_this<PlasmaClient::Imp
 
 PlasmaBuffer::~PlasmaBuffer() { ARROW_UNUSED(client_->Release(object_id_)); }
 
-PlasmaClient::Impl::Impl() {
+PlasmaClient::Impl::Impl()
+    : digest_type_(DigestType::XXH64),
+      keep_mapped_(false),
+      async_conn_(-1),
+      next_async_get_id_(1) {
 #ifdef PLASMA_GPU
   DCHECK_OK(CudaDeviceManager::GetInstance(&manager_));
 #endif
@@ -294,6 +423,19 @@ PlasmaClient::Impl::~Impl() {}
 // pointer in a hash table.
 uint8_t* PlasmaClient::Impl::LookupOrMmap(int fd, int store_fd_val, int64_t map_size) {
   auto entry = mmap_table_.find(store_fd_val);
+  struct stat file_info;
+  if (entry != mmap_table_.end() && entry->second.count == 0) {
+    // A file kept mapped without objects in use may have been released by
+    // the store, which may have reused its file descriptor.
+    ARROW_CHECK(fstat(fd, &file_info) == 0);
+    if (file_info.st_dev != entry->second.device ||
+        file_info.st_ino != entry->second.inode) {
+      ARROW_CHECK(munmap(entry->second.pointer,
+                         entry->second.length - kMmapRegionsGap) == 0);
+      mmap_table_.erase(entry);
+      entry = mmap_table_.end();
+    }
+  }
   if (entry != mmap_table_.end()) {
     close(fd);
     return entry->second.pointer;
@@ -306,12 +448,15 @@ uint8_t* PlasmaClient::Impl::LookupOrMmap(int fd, int store_fd_val, int64_t map_
     if (result == MAP_FAILED) {
       ARROW_LOG(FATAL) << "mmap failed";
     }
+    ARROW_CHECK(fstat(fd, &file_info) == 0);
     close(fd);  // Closing this fd has an effect on performance.
 
     ClientMmapTableEntry& entry = mmap_table_[store_fd_val];
     entry.pointer = result;
     entry.length = map_size;
     entry.count = 0;
+    entry.device = file_info.st_dev;
+    entry.inode = file_info.st_ino;
     return result;
   }
 }
@@ -391,23 +536,21 @@ Status PlasmaClient::Impl::Create(const ObjectID& object_id, int64_t data_size,
     // The metadata should come right after the data.
     ARROW_CHECK(object.metadata_offset == object.data_offset + data_size);
     *data = std::make_shared<MutableBuffer>(
-        LookupOrMmap(fd, store_fd, mmap_size) + object.data_offset, data_size);
+        LookupOrMmap(fd, store_fd, mmap_size) + object.data_offset, data_size,
+        arrow::MemoryType::SHARED_HOST);
     // If plasma_create is being called from a transfer, then we will not copy the
     // metadata here. The metadata will be written along with the data streamed
     // from the transfer.
     if (metadata != NULL) {
       // Copy the metadata to the buffer.
-      memcpy((*data)->mutable_data() + object.data_size, metadata, metadata_size);
+      arrow::internal::BulkMemcopy((*data)->mutable_data() + object.data_size,
+                                   metadata, metadata_size);
     }
   } else {
 #ifdef PLASMA_GPU
-    std::lock_guard<std::mutex> lock(gpu_mutex);
-    std::shared_ptr<CudaContext> context;
-    RETURN_NOT_OK(manager_->GetContext(device_num - 1, &context));
-    GpuProcessHandle* handle = new GpuProcessHandle();
-    RETURN_NOT_OK(context->OpenIpcBuffer(*object.ipc_handle, &handle->ptr));
-    gpu_object_map[object_id] = handle;
-    *data = handle->ptr;
+    std::shared_ptr<CudaBuffer> gpu_buffer;
+    RETURN_NOT_OK(OpenGpuObject(manager_, object, &gpu_buffer));
+    *data = gpu_buffer;
     if (metadata != NULL) {
       // Copy the metadata to the buffer.
       CudaBufferWriter writer(std::dynamic_pointer_cast<CudaBuffer>(*data));
@@ -432,6 +575,57 @@ Status PlasmaClient::Impl::Create(const ObjectID& object_id, int64_t data_size,
   return Status::OK();
 }
 
+Status PlasmaClient::Impl::Create(const std::vector<ObjectID>& object_ids,
+                                  const std::vector<int64_t>& data_sizes,
+                                  const std::vector<std::string>& metadata,
+                                  std::vector<std::shared_ptr<Buffer>>* data) {
+  if (data_sizes.size() != object_ids.size() || metadata.size() != object_ids.size()) {
+    return Status::Invalid(
+        "Create() called with different numbers of objects, sizes and metadata");
+  }
+  std::vector<int64_t> metadata_sizes;
+  for (const std::string& object_metadata : metadata) {
+    metadata_sizes.push_back(static_cast<int64_t>(object_metadata.size()));
+  }
+  RETURN_NOT_OK(
+      SendCreateBatchRequest(store_conn_, object_ids, data_sizes, metadata_sizes));
+  std::vector<uint8_t> buffer;
+  RETURN_NOT_OK(PlasmaReceive(store_conn_, MessageType::PlasmaCreateBatchReply, &buffer));
+  std::vector<ObjectID> ids;
+  std::vector<PlasmaObject> objects;
+  std::vector<int> store_fds;
+  std::vector<int64_t> mmap_sizes;
+  // If the reply included an error, then none of the objects was created and
+  // the store will not send file descriptors.
+  RETURN_NOT_OK(ReadCreateBatchReply(buffer.data(), buffer.size(), &ids, &objects,
+                                     &store_fds, &mmap_sizes));
+  for (size_t i = 0; i < store_fds.size(); i++) {
+    int fd = recv_fd(store_conn_);
+    ARROW_CHECK(fd >= 0) << "recv not successful";
+    LookupOrMmap(fd, store_fds[i], mmap_sizes[i]);
+  }
+
+  data->clear();
+  for (size_t i = 0; i < object_ids.size(); i++) {
+    PlasmaObject* object = &objects[i];
+    ARROW_CHECK(ids[i] == object_ids[i]);
+    ARROW_CHECK(object->data_size == data_sizes[i]);
+    // The metadata should come right after the data.
+    ARROW_CHECK(object->metadata_offset == object->data_offset + data_sizes[i]);
+    uint8_t* pointer = LookupMmappedFile(object->store_fd) + object->data_offset;
+    data->push_back(std::make_shared<MutableBuffer>(pointer, data_sizes[i],
+                                                    arrow::MemoryType::SHARED_HOST));
+    arrow::internal::BulkMemcopy(pointer + object->data_size,
+                                 reinterpret_cast<const uint8_t*>(metadata[i].data()),
+                                 metadata_sizes[i]);
+    // As with the objects created one at a time, the extra reference is
+    // released when the object is sealed.
+    IncrementObjectCount(object_ids[i], object, false);
+    IncrementObjectCount(object_ids[i], object, false);
+  }
+  return Status::OK();
+}
+
 Status PlasmaClient::Impl::GetBuffers(
     const ObjectID* object_ids, int64_t num_objects, int64_t timeout_ms,
     const std::function<std::shared_ptr<Buffer>(
@@ -456,10 +650,13 @@ Status PlasmaClient::Impl::GetBuffers(
       if (object->device_num == 0) {
         uint8_t* data = LookupMmappedFile(object->store_fd);
         physical_buf = std::make_shared<Buffer>(
-            data + object->data_offset, object->data_size + object->metadata_size);
+            data + object->data_offset, object->data_size + object->metadata_size,
+            arrow::MemoryType::SHARED_HOST);
       } else {
 #ifdef PLASMA_GPU
-        physical_buf = gpu_object_map.find(object_ids[i])->second->ptr;
+        std::shared_ptr<CudaBuffer> gpu_buffer;
+        RETURN_NOT_OK(OpenGpuObject(manager_, *object, &gpu_buffer));
+        physical_buf = gpu_buffer;
 #else
         ARROW_LOG(FATAL) << "Arrow GPU library is not enabled.";
 #endif
@@ -484,19 +681,29 @@ Status PlasmaClient::Impl::GetBuffers(
   RETURN_NOT_OK(SendGetRequest(store_conn_, &object_ids[0], num_objects, timeout_ms));
   std::vector<uint8_t> buffer;
   RETURN_NOT_OK(PlasmaReceive(store_conn_, MessageType::PlasmaGetReply, &buffer));
+  return ProcessGetReply(store_conn_, &buffer, object_ids, num_objects, wrap_buffer,
+                         nullptr, object_buffers);
+}
+
+Status PlasmaClient::Impl::ProcessGetReply(
+    int conn, std::vector<uint8_t>* buffer, const ObjectID* object_ids,
+    int64_t num_objects,
+    const std::function<std::shared_ptr<Buffer>(
+        const ObjectID&, const std::shared_ptr<Buffer>&)>& wrap_buffer,
+    std::unordered_set<ObjectID>* held, ObjectBuffer* object_buffers) {
   std::vector<ObjectID> received_object_ids(num_objects);
   std::vector<PlasmaObject> object_data(num_objects);
   PlasmaObject* object;
   std::vector<int> store_fds;
   std::vector<int64_t> mmap_sizes;
-  RETURN_NOT_OK(ReadGetReply(buffer.data(), buffer.size(), received_object_ids.data(),
+  RETURN_NOT_OK(ReadGetReply(buffer->data(), buffer->size(), received_object_ids.data(),
                              object_data.data(), num_objects, store_fds, mmap_sizes));
 
   // We mmap all of the file descriptors here so that we can avoid look them up
   // in the subsequent loop based on just the store file descriptor and without
   // having to know the relevant file descriptor received from recv_fd.
   for (size_t i = 0; i < store_fds.size(); i++) {
-    int fd = recv_fd(store_conn_);
+    int fd = recv_fd(conn);
     ARROW_CHECK(fd >= 0);
     LookupOrMmap(fd, store_fds[i], mmap_sizes[i]);
   }
@@ -519,22 +726,13 @@ Status PlasmaClient::Impl::GetBuffers(
       if (object->device_num == 0) {
         uint8_t* data = LookupMmappedFile(object->store_fd);
         physical_buf = std::make_shared<Buffer>(
-            data + object->data_offset, object->data_size + object->metadata_size);
+            data + object->data_offset, object->data_size + object->metadata_size,
+            arrow::MemoryType::SHARED_HOST);
       } else {
 #ifdef PLASMA_GPU
-        std::lock_guard<std::mutex> lock(gpu_mutex);
-        auto handle = gpu_object_map.find(object_ids[i]);
-        if (handle == gpu_object_map.end()) {
-          std::shared_ptr<CudaContext> context;
-          RETURN_NOT_OK(manager_->GetContext(object->device_num - 1, &context));
-          GpuProcessHandle* obj_handle = new GpuProcessHandle();
-          RETURN_NOT_OK(context->OpenIpcBuffer(*object->ipc_handle, &obj_handle->ptr));
-          gpu_object_map[object_ids[i]] = obj_handle;
-          physical_buf = obj_handle->ptr;
-        } else {
-          handle->second->client_count += 1;
-          physical_buf = handle->second->ptr;
-        }
+        std::shared_ptr<CudaBuffer> gpu_buffer;
+        RETURN_NOT_OK(OpenGpuObject(manager_, *object, &gpu_buffer));
+        physical_buf = gpu_buffer;
 #else
         ARROW_LOG(FATAL) << "Arrow GPU library is not enabled.";
 #endif
@@ -546,8 +744,11 @@ Status PlasmaClient::Impl::GetBuffers(
           SliceBuffer(physical_buf, object->data_size, object->metadata_size);
       object_buffers[i].device_num = object->device_num;
       // Increment the count of the number of instances of this object that this
-      // client is using. Cache the reference to the object.
-      IncrementObjectCount(received_object_ids[i], object, true);
+      // client is using, unless it was held for the reply. Cache the reference
+      // to the object.
+      if (held == nullptr || held->erase(received_object_ids[i]) == 0) {
+        IncrementObjectCount(received_object_ids[i], object, true);
+      }
     } else {
       // The object was not retrieved.  The caller can detect this condition
       // by checking the boolean value of the metadata/data buffers.
@@ -576,6 +777,149 @@ Status PlasmaClient::Impl::Get(const ObjectID* object_ids, int64_t num_objects,
   return GetBuffers(object_ids, num_objects, timeout_ms, wrap_buffer, out);
 }
 
+Status PlasmaClient::Impl::ConnectAsync(int* fd) {
+  if (async_conn_ < 0) {
+    int sock[2];
+    if (socketpair(AF_UNIX, SOCK_STREAM, 0, sock) != 0) {
+      return Status::IOError("Failed to create the socket of asynchronous gets");
+    }
+    RETURN_NOT_OK(SendConnectAsyncRequest(store_conn_));
+    // The store sends its replies on the other end, as it does on its
+    // connection.
+    ARROW_CHECK(send_fd(store_conn_, sock[1]) >= 0);
+    close(sock[1]);
+    async_conn_ = sock[0];
+  }
+  *fd = async_conn_;
+  return Status::OK();
+}
+
+Status PlasmaClient::Impl::GetAsync(const std::vector<ObjectID>& object_ids,
+                                    int64_t timeout_ms, GetCallback callback) {
+  int fd;
+  RETURN_NOT_OK(ConnectAsync(&fd));
+  const int64_t request_id = next_async_get_id_++;
+  AsyncGetRequest& request = async_gets_[request_id];
+  request.object_ids = object_ids;
+  request.callback = std::move(callback);
+  // Hold the objects in use until the reply, as releasing them before it
+  // could reach the store before the request, leaving the reply with objects
+  // that the client no longer holds in the store.
+  for (const auto& object_id : object_ids) {
+    auto object_entry = objects_in_use_.find(object_id);
+    if (object_entry != objects_in_use_.end() && request.held.insert(object_id).second) {
+      object_entry->second->count++;
+    }
+  }
+  Status s = SendGetRequest(store_conn_, object_ids.data(), object_ids.size(),
+                            timeout_ms, request_id);
+  if (!s.ok()) {
+    std::unordered_set<ObjectID> held = std::move(request.held);
+    async_gets_.erase(request_id);
+    for (const auto& object_id : held) {
+      RETURN_NOT_OK(Release(object_id));
+    }
+  }
+  return s;
+}
+
+Status PlasmaClient::Impl::ProcessAsyncReplies(int* num_replies) {
+  *num_replies = 0;
+  if (async_conn_ < 0) {
+    return Status::OK();
+  }
+  const auto wrap_buffer = [=](const ObjectID& object_id,
+                               const std::shared_ptr<Buffer>& buffer) {
+    return std::make_shared<PlasmaBuffer>(shared_from_this(), object_id, buffer);
+  };
+  while (true) {
+    struct pollfd poll_fd = {async_conn_, POLLIN, 0};
+    int ready = poll(&poll_fd, 1, 0);
+    if (ready < 0 && errno == EINTR) {
+      continue;
+    }
+    if (ready < 0) {
+      return Status::IOError("Failed to poll the socket of asynchronous gets");
+    }
+    if (ready == 0) {
+      return Status::OK();
+    }
+    // A reply and its file descriptors are sent at once, so that reading
+    // them once the socket is readable does not block for long.
+    std::vector<uint8_t> buffer;
+    RETURN_NOT_OK(PlasmaReceive(async_conn_, MessageType::PlasmaGetReply, &buffer));
+    int64_t request_id, num_objects;
+    RETURN_NOT_OK(
+        ReadGetReplyHeader(buffer.data(), buffer.size(), &request_id, &num_objects));
+    auto it = async_gets_.find(request_id);
+    ARROW_CHECK(it != async_gets_.end()) << "Reply to an unknown asynchronous get";
+    AsyncGetRequest request = std::move(it->second);
+    async_gets_.erase(it);
+    ARROW_CHECK(static_cast<size_t>(num_objects) == request.object_ids.size());
+
+    std::vector<ObjectBuffer> object_buffers(num_objects);
+    RETURN_NOT_OK(ProcessGetReply(async_conn_, &buffer, request.object_ids.data(),
+                                  num_objects, wrap_buffer, &request.held,
+                                  object_buffers.data()));
+    // The objects held that the reply does not have were not sealed yet.
+    for (const auto& object_id : request.held) {
+      RETURN_NOT_OK(Release(object_id));
+    }
+    ++*num_replies;
+    request.callback(std::move(object_buffers));
+  }
+}
+
+Status PlasmaClient::Impl::PutRecordBatch(const ObjectID& object_id,
+                                          const arrow::RecordBatch& batch) {
+  arrow::MemoryPool* pool = arrow::default_memory_pool();
+  std::shared_ptr<Buffer> schema;
+  RETURN_NOT_OK(arrow::ipc::SerializeSchema(*batch.schema(), pool, &schema));
+  std::vector<std::shared_ptr<Buffer>> payload;
+  int64_t size = 0;
+  RETURN_NOT_OK(arrow::ipc::GetRecordBatchPayload(batch, pool, &payload, &size));
+
+  std::shared_ptr<Buffer> data;
+  RETURN_NOT_OK(Create(object_id, size, schema->data(), schema->size(), &data));
+  Status s;
+  {
+    arrow::io::FixedSizeBufferWriter stream(data);
+    s = stream.Writev(payload);
+  }
+  data.reset();
+  if (!s.ok()) {
+    RETURN_NOT_OK(Abort(object_id));
+    return s;
+  }
+  RETURN_NOT_OK(Seal(object_id));
+  return Release(object_id);
+}
+
+Status PlasmaClient::Impl::GetRecordBatch(const ObjectID& object_id, int64_t timeout_ms,
+                                          std::shared_ptr<arrow::RecordBatch>* batch) {
+  std::vector<ObjectBuffer> object_buffers;
+  RETURN_NOT_OK(Get({object_id}, timeout_ms, &object_buffers));
+  const ObjectBuffer& object_buffer = object_buffers[0];
+  if (object_buffer.data == nullptr) {
+    return Status::PlasmaObjectNonexistent("The record batch was not found in time");
+  }
+  if (object_buffer.device_num != 0) {
+    return Status::Invalid("Record batches are only read from objects on the host");
+  }
+
+  auto it = schemas_.find(object_id);
+  if (it == schemas_.end()) {
+    std::shared_ptr<arrow::Schema> schema;
+    arrow::io::BufferReader schema_reader(object_buffer.metadata);
+    RETURN_NOT_OK(arrow::ipc::ReadSchema(&schema_reader, &schema));
+    it = schemas_.emplace(object_id, schema).first;
+  }
+  // The reader slices the buffer of the object, so that the arrays of the
+  // batch keep the object in use.
+  arrow::io::BufferReader reader(object_buffer.data);
+  return arrow::ipc::ReadRecordBatch(it->second, &reader, batch);
+}
+
 Status PlasmaClient::Impl::UnmapObject(const ObjectID& object_id) {
   auto object_entry = objects_in_use_.find(object_id);
   ARROW_CHECK(object_entry != objects_in_use_.end());
@@ -588,7 +932,7 @@ Status PlasmaClient::Impl::UnmapObject(const ObjectID& object_id) {
   auto entry = mmap_table_.find(fd);
   ARROW_CHECK(entry != mmap_table_.end());
   ARROW_CHECK(entry->second.count >= 1);
-  if (entry->second.count == 1) {
+  if (entry->second.count == 1 && !keep_mapped_) {
     // If no other objects are being used, then unmap the file.
     // We subtract kMmapRegionsGap from the length that was added
     // in fake_mmap in malloc.h, to make the size page-aligned again.
@@ -608,6 +952,7 @@ Status PlasmaClient::Impl::UnmapObject(const ObjectID& object_id) {
   DCHECK_GE(in_use_object_bytes_, 0);
   // Remove the entry from the hash table of objects currently in use.
   objects_in_use_.erase(object_id);
+  schemas_.erase(object_id);
   return Status::OK();
 }
 
@@ -620,7 +965,10 @@ Status PlasmaClient::Impl::UnmapObject(const ObjectID& object_id) {
 /// releasing the object when the client is truly done with the object.
 ///
 /// @param object_id The object ID to attempt to release.
-Status PlasmaClient::Impl::PerformRelease(const ObjectID& object_id) {
+/// @param released If not null, the objects whose release is to be sent to
+///        the store in a single message, which this one is added to.
+Status PlasmaClient::Impl::PerformRelease(const ObjectID& object_id,
+                                          std::vector<ObjectID>* released) {
   // Decrement the count of the number of instances of this object that are
   // being used by this client. The corresponding increment should have happened
   // in PlasmaClient::Get.
@@ -632,7 +980,13 @@ Status PlasmaClient::Impl::PerformRelease(const ObjectID& object_id) {
   if (object_entry->second->count == 0) {
     // Tell the store that the client no longer needs the object.
     RETURN_NOT_OK(UnmapObject(object_id));
-    RETURN_NOT_OK(SendReleaseRequest(store_conn_, object_id));
+    if (release_ring_ != nullptr && release_ring_->Push(object_id)) {
+      // The store takes the release from the ring.
+    } else if (released != nullptr) {
+      released->push_back(object_id);
+    } else {
+      RETURN_NOT_OK(SendReleaseRequest(store_conn_, object_id));
+    }
     auto iter = deletion_cache_.find(object_id);
     if (iter != deletion_cache_.end()) {
       deletion_cache_.erase(object_id);
@@ -643,10 +997,27 @@ Status PlasmaClient::Impl::PerformRelease(const ObjectID& object_id) {
 }
 
 Status PlasmaClient::Impl::Release(const ObjectID& object_id) {
+  return Release(object_id, nullptr);
+}
+
+Status PlasmaClient::Impl::Release(const std::vector<ObjectID>& object_ids) {
+  // The objects that are released in the store are sent in a single message.
+  std::vector<ObjectID> released;
+  for (const auto& object_id : object_ids) {
+    RETURN_NOT_OK(Release(object_id, &released));
+  }
+  if (released.size() > 0) {
+    RETURN_NOT_OK(SendReleaseBatchRequest(store_conn_, released));
+  }
+  return Status::OK();
+}
+
+Status PlasmaClient::Impl::Release(const ObjectID& object_id,
+                                   std::vector<ObjectID>* released) {
   // If an object is in the deletion cache, handle it directly without waiting.
   auto iter = deletion_cache_.find(object_id);
   if (iter != deletion_cache_.end()) {
-    RETURN_NOT_OK(PerformRelease(object_id));
+    RETURN_NOT_OK(PerformRelease(object_id, released));
     return Status::OK();
   }
   // If the client is already disconnected, ignore release requests.
@@ -665,7 +1036,7 @@ Status PlasmaClient::Impl::Release(const ObjectID& object_id) {
           release_history_.size() > config_.release_delay) &&
          release_history_.size() > 0) {
     // Perform a release for the object ID for the first pending release.
-    RETURN_NOT_OK(PerformRelease(release_history_.back()));
+    RETURN_NOT_OK(PerformRelease(release_history_.back(), released));
     // Remove the last entry from the release history.
     release_history_.pop_back();
   }
@@ -705,47 +1076,75 @@ Status PlasmaClient::Impl::Contains(const ObjectID& object_id, bool* has_object)
   return Status::OK();
 }
 
-static void ComputeBlockHash(const unsigned char* data, int64_t nbytes, uint64_t* hash) {
-  XXH64_state_t hash_state;
-  XXH64_reset(&hash_state, XXH64_DEFAULT_SEED);
-  XXH64_update(&hash_state, data, nbytes);
-  *hash = XXH64_digest(&hash_state);
+static uint64_t Xxh64BlockHash(const uint8_t* data, int64_t nbytes) {
+  return XXH64(data, static_cast<size_t>(nbytes), XXH64_DEFAULT_SEED);
 }
 
-bool PlasmaClient::Impl::ComputeObjectHashParallel(XXH64_state_t* hash_state,
+#ifdef PLASMA_HAVE_CRC32C
+// Compiled for SSE4.2 whatever the flags of the build, to be called only once
+// the CPU is known to have it.
+__attribute__((target("sse4.2"))) static uint64_t Crc32cBlockHash(const uint8_t* data,
+                                                                  int64_t nbytes) {
+  uint64_t crc = 0xFFFFFFFF;
+  for (; nbytes >= 8; data += 8, nbytes -= 8) {
+    uint64_t word;
+    memcpy(&word, data, sizeof(word));
+    crc = _mm_crc32_u64(crc, word);
+  }
+  uint32_t crc32 = static_cast<uint32_t>(crc);
+  for (; nbytes > 0; data++, nbytes--) {
+    crc32 = _mm_crc32_u8(crc32, *data);
+  }
+  return crc32 ^ 0xFFFFFFFF;
+}
+#endif
+
+static BlockHashFunction GetBlockHashFunction(DigestType type) {
+#ifdef PLASMA_HAVE_CRC32C
+  if (type == DigestType::CRC32C) {
+    if (!arrow::CpuInfo::initialized()) {
+      arrow::CpuInfo::Init();
+    }
+    if (arrow::CpuInfo::IsSupported(arrow::CpuInfo::SSE4_2)) {
+      return Crc32cBlockHash;
+    }
+  }
+#endif
+  return Xxh64BlockHash;
+}
+
+void PlasmaClient::Impl::ComputeObjectHashParallel(XXH64_state_t* hash_state,
+                                                   BlockHashFunction hash_block,
                                                    const unsigned char* data,
-                                                   int64_t nbytes) {
+                                                   int64_t nbytes, int num_chunks) {
   // Note that this function will likely be faster if the address of data is
   // aligned on a 64-byte boundary.
   auto pool = arrow::internal::GetCpuThreadPool();
 
-  const int num_threads = kHashingConcurrency;
-  uint64_t threadhash[num_threads + 1];
-  const uint64_t data_address = reinterpret_cast<uint64_t>(data);
-  const uint64_t num_blocks = nbytes / kBlockSize;
-  const uint64_t chunk_size = (num_blocks / num_threads) * kBlockSize;
-  const uint64_t right_address = data_address + chunk_size * num_threads;
-  const uint64_t suffix = (data_address + nbytes) - right_address;
-  // Now the data layout is | k * num_threads * block_size | suffix | ==
-  // | num_threads * chunk_size | suffix |, where chunk_size = k * block_size.
-  // Each thread gets a "chunk" of k blocks, except the suffix thread.
+  std::vector<uint64_t> chunk_hashes(num_chunks + 1);
+  const int64_t num_blocks = nbytes / kBlockSize;
+  const int64_t chunk_size = (num_blocks / num_chunks) * kBlockSize;
+  const unsigned char* suffix = data + chunk_size * num_chunks;
+  // Now the data layout is | k * num_chunks * block_size | suffix | ==
+  // | num_chunks * chunk_size | suffix |, where chunk_size = k * block_size.
+  // The suffix is hashed on its own, as if it were another chunk.
 
   std::vector<std::future<void>> futures;
-  for (int i = 0; i < num_threads; i++) {
-    futures.push_back(pool->Submit(
-        ComputeBlockHash, reinterpret_cast<uint8_t*>(data_address) + i * chunk_size,
-        chunk_size, &threadhash[i]));
+  for (int i = 1; i < num_chunks; i++) {
+    futures.push_back(pool->Submit([hash_block, data, chunk_size, i, &chunk_hashes]() {
+      chunk_hashes[i] = hash_block(data + i * chunk_size, chunk_size);
+    }));
   }
-  ComputeBlockHash(reinterpret_cast<uint8_t*>(right_address), suffix,
-                   &threadhash[num_threads]);
+  // The calling thread hashes a chunk too rather than wait idle.
+  chunk_hashes[0] = hash_block(data, chunk_size);
+  chunk_hashes[num_chunks] = hash_block(suffix, data + nbytes - suffix);
 
   for (auto& fut : futures) {
     fut.get();
   }
 
-  XXH64_update(hash_state, reinterpret_cast<unsigned char*>(threadhash),
-               sizeof(threadhash));
-  return true;
+  XXH64_update(hash_state, reinterpret_cast<unsigned char*>(chunk_hashes.data()),
+               chunk_hashes.size() * sizeof(uint64_t));
 }
 
 uint64_t PlasmaClient::Impl::ComputeObjectHash(const ObjectBuffer& obj_buffer) {
@@ -757,14 +1156,20 @@ uint64_t PlasmaClient::Impl::ComputeObjectHash(const ObjectBuffer& obj_buffer) {
     return 0;
   }
   XXH64_reset(&hash_state, XXH64_DEFAULT_SEED);
-  if (obj_buffer.data->size() >= kBytesInMB) {
+  // The chunks depend only on the size of the data, as equal objects must
+  // have equal digests whatever the number of threads.
+  const int64_t nbytes = obj_buffer.data->size();
+  const int num_chunks =
+      static_cast<int>(std::min(kMaxHashingChunks, nbytes / kBytesInMB));
+  const BlockHashFunction hash_block = GetBlockHashFunction(digest_type_);
+  if (num_chunks >= 2 || hash_block != Xxh64BlockHash) {
     ComputeObjectHashParallel(
-        &hash_state, reinterpret_cast<const unsigned char*>(obj_buffer.data->data()),
-        obj_buffer.data->size());
+        &hash_state, hash_block,
+        reinterpret_cast<const unsigned char*>(obj_buffer.data->data()), nbytes,
+        std::max(num_chunks, 1));
   } else {
     XXH64_update(&hash_state,
-                 reinterpret_cast<const unsigned char*>(obj_buffer.data->data()),
-                 obj_buffer.data->size());
+                 reinterpret_cast<const unsigned char*>(obj_buffer.data->data()), nbytes);
   }
   XXH64_update(&hash_state,
                reinterpret_cast<const unsigned char*>(obj_buffer.metadata->data()),
@@ -772,6 +1177,14 @@ uint64_t PlasmaClient::Impl::ComputeObjectHash(const ObjectBuffer& obj_buffer) {
   return XXH64_digest(&hash_state);
 }
 
+Status PlasmaClient::Impl::SealDigest(const ObjectID& object_id, uint8_t* digest) {
+  if (digest_type_ == DigestType::NONE) {
+    memset(digest, 0, kDigestSize);
+    return Status::OK();
+  }
+  return Hash(object_id, digest);
+}
+
 Status PlasmaClient::Impl::Seal(const ObjectID& object_id) {
   // Make sure this client has a reference to the object before sending the
   // request to Plasma.
@@ -788,7 +1201,7 @@ Status PlasmaClient::Impl::Seal(const ObjectID& object_id) {
   object_entry->second->is_sealed = true;
   /// Send the seal request to Plasma.
   static unsigned char digest[kDigestSize];
-  RETURN_NOT_OK(Hash(object_id, &digest[0]));
+  RETURN_NOT_OK(SealDigest(object_id, &digest[0]));
   RETURN_NOT_OK(SendSealRequest(store_conn_, object_id, &digest[0]));
   // We call PlasmaClient::Release to decrement the number of instances of this
   // object
@@ -798,6 +1211,34 @@ Status PlasmaClient::Impl::Seal(const ObjectID& object_id) {
   return Release(object_id);
 }
 
+Status PlasmaClient::Impl::Seal(const std::vector<ObjectID>& object_ids) {
+  // Check all the objects before sealing any of them.
+  std::unordered_set<ObjectID> sealed;
+  for (const auto& object_id : object_ids) {
+    auto object_entry = objects_in_use_.find(object_id);
+    if (object_entry == objects_in_use_.end()) {
+      return Status::PlasmaObjectNonexistent(
+          "Seal() called on an object without a reference to it");
+    }
+    if (object_entry->second->is_sealed || !sealed.insert(object_id).second) {
+      return Status::PlasmaObjectAlreadySealed(
+          "Seal() called on an already sealed object");
+    }
+  }
+
+  std::vector<std::string> digests;
+  for (const auto& object_id : object_ids) {
+    objects_in_use_[object_id]->is_sealed = true;
+    std::string digest(kDigestSize, '\0');
+    RETURN_NOT_OK(SealDigest(object_id, reinterpret_cast<uint8_t*>(&digest[0])));
+    digests.push_back(std::move(digest));
+  }
+  RETURN_NOT_OK(SendSealBatchRequest(store_conn_, object_ids, digests));
+  // Release the references of the objects taken when they were created, as
+  // Seal of a single object does.
+  return Release(object_ids);
+}
+
 Status PlasmaClient::Impl::Abort(const ObjectID& object_id) {
   auto object_entry = objects_in_use_.find(object_id);
   ARROW_CHECK(object_entry != objects_in_use_.end())
@@ -876,6 +1317,84 @@ Status PlasmaClient::Impl::Hash(const ObjectID& object_id, uint8_t* digest) {
   return Status::OK();
 }
 
+Status PlasmaClient::Impl::SetClientOptions(const std::string& client_name,
+                                            int64_t output_memory_quota) {
+  RETURN_NOT_OK(SendSetOptionsRequest(store_conn_, client_name, output_memory_quota));
+  std::vector<uint8_t> buffer;
+  RETURN_NOT_OK(PlasmaReceive(store_conn_, MessageType::PlasmaSetOptionsReply, &buffer));
+  return ReadSetOptionsReply(buffer.data(), buffer.size());
+}
+
+Status PlasmaClient::Impl::GetQuotaStats(std::vector<QuotaStats>* stats) {
+  RETURN_NOT_OK(SendQuotaStatsRequest(store_conn_));
+  std::vector<uint8_t> buffer;
+  RETURN_NOT_OK(PlasmaReceive(store_conn_, MessageType::PlasmaQuotaStatsReply, &buffer));
+  return ReadQuotaStatsReply(buffer.data(), buffer.size(), stats);
+}
+
+Status PlasmaClient::Impl::Reserve(int64_t data_size, int64_t metadata_size,
+                                   int64_t count, int64_t* num_reserved) {
+  if (count < 0) {
+    return Status::Invalid("Cannot reserve a negative number of objects");
+  }
+  RETURN_NOT_OK(SendReserveRequest(store_conn_, data_size, metadata_size, count));
+  std::vector<uint8_t> buffer;
+  RETURN_NOT_OK(PlasmaReceive(store_conn_, MessageType::PlasmaReserveReply, &buffer));
+  return ReadReserveReply(buffer.data(), buffer.size(), num_reserved);
+}
+
+Status PlasmaClient::Impl::GetStoreStats(PlasmaStoreStats* stats) {
+  RETURN_NOT_OK(SendStoreStatsRequest(store_conn_));
+  std::vector<uint8_t> buffer;
+  RETURN_NOT_OK(PlasmaReceive(store_conn_, MessageType::PlasmaStoreStatsReply, &buffer));
+  return ReadStoreStatsReply(buffer.data(), buffer.size(), stats);
+}
+
+Status PlasmaClient::Impl::SetDigestType(DigestType type) {
+  digest_type_ = type;
+  return Status::OK();
+}
+
+Status PlasmaClient::Impl::SetKeepMapped(bool keep_mapped) {
+  keep_mapped_ = keep_mapped;
+  return keep_mapped ? Status::OK() : UnmapUnusedFiles();
+}
+
+Status PlasmaClient::Impl::UnmapUnusedFiles() {
+  for (auto it = mmap_table_.begin(); it != mmap_table_.end();) {
+    if (it->second.count == 0) {
+      if (munmap(it->second.pointer, it->second.length - kMmapRegionsGap) == -1) {
+        return Status::IOError("Error during munmap");
+      }
+      it = mmap_table_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  return Status::OK();
+}
+
+Status PlasmaClient::Impl::UseReleaseRing(int64_t capacity) {
+  if (release_ring_ != nullptr) {
+    return Status::Invalid("The client already uses a release ring");
+  }
+  std::unique_ptr<ReleaseRing> ring;
+  RETURN_NOT_OK(ReleaseRing::Create(capacity, &ring));
+  RETURN_NOT_OK(SendReleaseRingRequest(store_conn_, capacity));
+  // Send the file descriptor of the ring, which the store maps.
+  ARROW_CHECK(send_fd(store_conn_, ring->fd()) >= 0);
+  std::vector<uint8_t> buffer;
+  RETURN_NOT_OK(
+      PlasmaReceive(store_conn_, MessageType::PlasmaReleaseRingReply, &buffer));
+  bool accepted;
+  RETURN_NOT_OK(ReadReleaseRingReply(buffer.data(), buffer.size(), &accepted));
+  if (!accepted) {
+    return Status::IOError("The plasma store could not map the release ring");
+  }
+  release_ring_ = std::move(ring);
+  return Status::OK();
+}
+
 Status PlasmaClient::Impl::Subscribe(int* fd) {
   int sock[2];
   // Create a non-blocking socket pair. This will only be used to send
@@ -898,19 +1417,54 @@ Status PlasmaClient::Impl::Subscribe(int* fd) {
 
 Status PlasmaClient::Impl::GetNotification(int fd, ObjectID* object_id,
                                            int64_t* data_size, int64_t* metadata_size) {
-  auto notification = ReadMessageAsync(fd);
-  if (notification == NULL) {
+  auto& pending = notifications_[fd];
+  if (pending.empty()) {
+    std::vector<ObjectNotification> notifications;
+    Status s = GetNotifications(fd, &notifications);
+    if (!s.ok()) {
+      notifications_.erase(fd);
+      return s;
+    }
+    pending.insert(pending.end(), notifications.begin(), notifications.end());
+  }
+  const ObjectNotification& notification = pending.front();
+  *object_id = notification.object_id;
+  *data_size = notification.data_size;
+  *metadata_size = notification.metadata_size;
+  pending.pop_front();
+  return Status::OK();
+}
+
+Status PlasmaClient::Impl::GetNotifications(
+    int fd, std::vector<ObjectNotification>* notifications) {
+  notifications->clear();
+  // Those left by GetNotification() come first, as they were received first.
+  auto it = notifications_.find(fd);
+  if (it != notifications_.end()) {
+    notifications->assign(it->second.begin(), it->second.end());
+    notifications_.erase(it);
+    if (!notifications->empty()) {
+      return Status::OK();
+    }
+  }
+  auto message = ReadMessageAsync(fd);
+  if (message == NULL) {
     return Status::IOError("Failed to read object notification from Plasma socket");
   }
-  auto object_info = flatbuffers::GetRoot<fb::ObjectInfo>(notification.get());
-  ARROW_CHECK(object_info->object_id()->size() == sizeof(ObjectID));
-  memcpy(object_id, object_info->object_id()->data(), sizeof(ObjectID));
-  if (object_info->is_deletion()) {
-    *data_size = -1;
-    *metadata_size = -1;
-  } else {
-    *data_size = object_info->data_size();
-    *metadata_size = object_info->metadata_size();
+  auto batch = flatbuffers::GetRoot<fb::ObjectInfoBatch>(message.get());
+  notifications->reserve(batch->objects()->size());
+  for (const auto object_info : *batch->objects()) {
+    ObjectNotification notification;
+    ARROW_CHECK(object_info->object_id()->size() == sizeof(ObjectID));
+    memcpy(&notification.object_id, object_info->object_id()->data(), sizeof(ObjectID));
+    if (object_info->is_deletion()) {
+      notification.data_size = -1;
+      notification.metadata_size = -1;
+    } else {
+      notification.data_size = object_info->data_size();
+      notification.metadata_size = object_info->metadata_size();
+    }
+    notifications->push_back(notification);
   }
   return Status::OK();
 }
@@ -944,6 +1498,14 @@ Status PlasmaClient::Impl::Disconnect() {
   // that were in use by us when handling the SIGPIPE.
   close(store_conn_);
   store_conn_ = -1;
+  release_ring_.reset();
+  // The files kept mapped without objects in use are no longer needed.
+  RETURN_NOT_OK(UnmapUnusedFiles());
+  if (async_conn_ >= 0) {
+    close(async_conn_);
+    async_conn_ = -1;
+    async_gets_.clear();
+  }
   if (manager_conn_ >= 0) {
     close(manager_conn_);
     manager_conn_ = -1;
@@ -953,7 +1515,9 @@ Status PlasmaClient::Impl::Disconnect() {
 
 Status PlasmaClient::Impl::Transfer(const char* address, int port,
                                     const ObjectID& object_id) {
-  return SendDataRequest(manager_conn_, object_id, address, port);
+  // Without a manager, the store sends the object itself.
+  return SendDataRequest(manager_conn_ >= 0 ? manager_conn_ : store_conn_, object_id,
+                         address, port);
 }
 
 Status PlasmaClient::Impl::Fetch(int num_object_ids, const ObjectID* object_ids) {
@@ -1049,10 +1613,42 @@ Status PlasmaClient::Get(const ObjectID* object_ids, int64_t num_objects,
   return impl_->Get(object_ids, num_objects, timeout_ms, object_buffers);
 }
 
+Status PlasmaClient::Create(const std::vector<ObjectID>& object_ids,
+                            const std::vector<int64_t>& data_sizes,
+                            const std::vector<std::string>& metadata,
+                            std::vector<std::shared_ptr<Buffer>>* data) {
+  return impl_->Create(object_ids, data_sizes, metadata, data);
+}
+
+Status PlasmaClient::ConnectAsync(int* fd) { return impl_->ConnectAsync(fd); }
+
+Status PlasmaClient::GetAsync(const std::vector<ObjectID>& object_ids,
+                              int64_t timeout_ms, GetCallback callback) {
+  return impl_->GetAsync(object_ids, timeout_ms, std::move(callback));
+}
+
+Status PlasmaClient::ProcessAsyncReplies(int* num_replies) {
+  return impl_->ProcessAsyncReplies(num_replies);
+}
+
+Status PlasmaClient::PutRecordBatch(const ObjectID& object_id,
+                                    const arrow::RecordBatch& batch) {
+  return impl_->PutRecordBatch(object_id, batch);
+}
+
+Status PlasmaClient::GetRecordBatch(const ObjectID& object_id, int64_t timeout_ms,
+                                    std::shared_ptr<arrow::RecordBatch>* batch) {
+  return impl_->GetRecordBatch(object_id, timeout_ms, batch);
+}
+
 Status PlasmaClient::Release(const ObjectID& object_id) {
   return impl_->Release(object_id);
 }
 
+Status PlasmaClient::Release(const std::vector<ObjectID>& object_ids) {
+  return impl_->Release(object_ids);
+}
+
 Status PlasmaClient::Contains(const ObjectID& object_id, bool* has_object) {
   return impl_->Contains(object_id, has_object);
 }
@@ -1061,6 +1657,10 @@ Status PlasmaClient::Abort(const ObjectID& object_id) { return impl_->Abort(obje
 
 Status PlasmaClient::Seal(const ObjectID& object_id) { return impl_->Seal(object_id); }
 
+Status PlasmaClient::Seal(const std::vector<ObjectID>& object_ids) {
+  return impl_->Seal(object_ids);
+}
+
 Status PlasmaClient::Delete(const ObjectID& object_id) {
   return impl_->Delete(std::vector<ObjectID>{object_id});
 }
@@ -1077,6 +1677,36 @@ Status PlasmaClient::Hash(const ObjectID& object_id, uint8_t* digest) {
   return impl_->Hash(object_id, digest);
 }
 
+Status PlasmaClient::SetDigestType(DigestType type) {
+  return impl_->SetDigestType(type);
+}
+
+Status PlasmaClient::SetKeepMapped(bool keep_mapped) {
+  return impl_->SetKeepMapped(keep_mapped);
+}
+
+Status PlasmaClient::UseReleaseRing(int64_t capacity) {
+  return impl_->UseReleaseRing(capacity);
+}
+
+Status PlasmaClient::SetClientOptions(const std::string& client_name,
+                                      int64_t output_memory_quota) {
+  return impl_->SetClientOptions(client_name, output_memory_quota);
+}
+
+Status PlasmaClient::GetQuotaStats(std::vector<QuotaStats>* stats) {
+  return impl_->GetQuotaStats(stats);
+}
+
+Status PlasmaClient::Reserve(int64_t data_size, int64_t metadata_size, int64_t count,
+                             int64_t* num_reserved) {
+  return impl_->Reserve(data_size, metadata_size, count, num_reserved);
+}
+
+Status PlasmaClient::GetStoreStats(PlasmaStoreStats* stats) {
+  return impl_->GetStoreStats(stats);
+}
+
 Status PlasmaClient::Subscribe(int* fd) { return impl_->Subscribe(fd); }
 
 Status PlasmaClient::GetNotification(int fd, ObjectID* object_id, int64_t* data_size,
@@ -1084,6 +1714,11 @@ Status PlasmaClient::GetNotification(int fd, ObjectID* object_id, int64_t* data_
   return impl_->GetNotification(fd, object_id, data_size, metadata_size);
 }
 
+Status PlasmaClient::GetNotifications(int fd,
+                                      std::vector<ObjectNotification>* notifications) {
+  return impl_->GetNotifications(fd, notifications);
+}
+
 Status PlasmaClient::Disconnect() { return impl_->Disconnect(); }
 
 Status PlasmaClient::Fetch(int num_object_ids, const ObjectID* object_ids) {
@@ -29,6 +29,12 @@
 #include "arrow/util/visibility.h"
 #include "plasma/common.h"
 
+namespace arrow {
+
+class RecordBatch;
+
+}  // namespace arrow
+
 using arrow::Buffer;
 using arrow::Status;
 
@@ -43,6 +49,21 @@ constexpr int64_t kDeprecatedPlasmaDefaultReleaseDelay = 64;
 /// and unmapping objects and evicting data from processor caches.
 constexpr int64_t kPlasmaDefaultReleaseDelay = 64;
 
+/// The number of object IDs that the ring of released objects holds by default.
+constexpr int64_t kPlasmaDefaultReleaseRingCapacity = 4096;
+
+/// How the digests of the objects that a client seals are computed.
+enum class DigestType {
+  /// XXH64, the default.
+  XXH64,
+  /// CRC32C, with the instruction of SSE4.2, which is faster. Where the CPU
+  /// does not have it, XXH64 is used instead.
+  CRC32C,
+  /// No digest, which makes sealing large objects much faster. Their digest
+  /// is then zero, which tells nothing of their contents.
+  NONE
+};
+
 /// Object buffer data structure.
 struct ObjectBuffer {
   /// The data buffer.
@@ -53,6 +74,21 @@ struct ObjectBuffer {
   int device_num;
 };
 
+/// A notification about an object sealed or deleted in the store.
+struct ObjectNotification {
+  /// The ID of the object.
+  ObjectID object_id;
+  /// The size of the data of the object, or -1 if it was deleted.
+  int64_t data_size;
+  /// The size of the metadata of the object, or -1 if it was deleted.
+  int64_t metadata_size;
+};
+
+/// The callback of an asynchronous get, which is given the buffers of the
+/// objects in the same order as their IDs. Those of the objects that were not
+/// sealed before the timeout are null, as with Get().
+using GetCallback = std::function<void(std::vector<ObjectBuffer> object_buffers)>;
+
 class ARROW_EXPORT PlasmaClient {
  public:
   PlasmaClient();
@@ -99,6 +135,24 @@ class ARROW_EXPORT PlasmaClient {
   Status Create(const ObjectID& object_id, int64_t data_size, const uint8_t* metadata,
                 int64_t metadata_size, std::shared_ptr<Buffer>* data, int device_num = 0);
 
+  /// Create several objects on the host with a single request to the store.
+  ///
+  /// \param object_ids The IDs of the objects to create.
+  /// \param data_sizes The sizes in bytes of the space to be allocated for
+  ///        the data of each object.
+  /// \param metadata The metadata of each object, which is copied to it.
+  /// \param data The addresses of the newly created objects will be written
+  ///        here, in the same order as their IDs.
+  /// \return The return status. If one of the objects cannot be created, none
+  ///         of them is.
+  ///
+  /// As with Create of a single object, each object must be released once it
+  /// is done with, and either sealed or aborted.
+  Status Create(const std::vector<ObjectID>& object_ids,
+                const std::vector<int64_t>& data_sizes,
+                const std::vector<std::string>& metadata,
+                std::vector<std::shared_ptr<Buffer>>* data);
+
   /// Get some objects from the Plasma Store. This function will block until the
   /// objects have all been created and sealed in the Plasma Store or the
   /// timeout expires.
@@ -131,6 +185,67 @@ class ARROW_EXPORT PlasmaClient {
   Status Get(const ObjectID* object_ids, int64_t num_objects, int64_t timeout_ms,
              ObjectBuffer* object_buffers);
 
+  /// Create an object holding a record batch, and seal it. The schema of the
+  /// batch is the metadata of the object, and the batch its data, both as
+  /// Arrow IPC messages. The batch is laid out once and written straight into
+  /// the object, which is created to fit it exactly.
+  ///
+  /// \param object_id The ID of the object to create.
+  /// \param batch The record batch, which must not hold dictionaries.
+  /// \return The return status. The object is aborted if it cannot be
+  ///         written.
+  Status PutRecordBatch(const ObjectID& object_id, const arrow::RecordBatch& batch);
+
+  /// Get a record batch put with PutRecordBatch(). This function will block
+  /// until the object is sealed in the Plasma Store or the timeout expires.
+  ///
+  /// \param object_id The ID of the object to get.
+  /// \param timeout_ms The amount of time in milliseconds to wait before this
+  ///        request times out. If this value is -1, then no timeout is set.
+  /// \param[out] batch The record batch, whose buffers point into the memory
+  ///        of the object.
+  /// \return The return status, PlasmaObjectNonexistent on timeout.
+  ///
+  /// The object is released once the batch and all of its buffers get out of
+  /// scope. The schema of the object is parsed once, and kept for as long as
+  /// the client holds the object.
+  Status GetRecordBatch(const ObjectID& object_id, int64_t timeout_ms,
+                        std::shared_ptr<arrow::RecordBatch>* batch);
+
+  /// Get the socket that the replies to asynchronous gets come on, connecting
+  /// it first if needed. It becomes readable when replies arrive, so that an
+  /// event loop can wait for it along with others, then call
+  /// ProcessAsyncReplies().
+  ///
+  /// \param fd Out parameter for the file descriptor of the socket, which
+  ///        belongs to the client.
+  /// \return The return status.
+  Status ConnectAsync(int* fd);
+
+  /// Ask for some objects without waiting for them. The store replies once
+  /// they have all been sealed or the timeout expires, and the callback is
+  /// called with their buffers by ProcessAsyncReplies(). Any number of these
+  /// requests can be outstanding at once.
+  ///
+  /// \param object_ids The IDs of the objects to get.
+  /// \param timeout_ms The amount of time in milliseconds to wait before this
+  ///        request times out. If this value is -1, then no timeout is set.
+  /// \param callback The function called with the objects.
+  /// \return The return status.
+  ///
+  /// Objects are automatically released by the client when their buffers
+  /// get out of scope, as with Get().
+  Status GetAsync(const std::vector<ObjectID>& object_ids, int64_t timeout_ms,
+                  GetCallback callback);
+
+  /// Call the callbacks of the asynchronous gets whose replies have arrived,
+  /// without waiting for others. The callbacks may make requests of their
+  /// own.
+  ///
+  /// \param num_replies Out parameter for the number of callbacks called.
+  /// \return The return status.
+  Status ProcessAsyncReplies(int* num_replies);
+
   /// Tell Plasma that the client no longer needs the object. This should be
   /// called after Get() or Create() when the client is done with the object.
   /// After this call, the buffer returned by Get() is no longer valid.
@@ -139,6 +254,13 @@ class ARROW_EXPORT PlasmaClient {
   /// \return The return status.
   Status Release(const ObjectID& object_id);
 
+  /// Tell Plasma that the client no longer needs several objects, sending a
+  /// single message for those that it releases in the store.
+  ///
+  /// \param object_ids The IDs of the objects that are no longer needed.
+  /// \return The return status.
+  Status Release(const std::vector<ObjectID>& object_ids);
+
   /// Check if the object store contains a particular object and the object has
   /// been sealed. The result will be stored in has_object.
   ///
@@ -168,6 +290,13 @@ class ARROW_EXPORT PlasmaClient {
   /// \return The return status.
   Status Seal(const ObjectID& object_id);
 
+  /// Seal several objects in the object store with a single message.
+  ///
+  /// \param object_ids The IDs of the objects to seal. None of them is sealed
+  ///        if one is not in use by the client or already sealed.
+  /// \return The return status.
+  Status Seal(const std::vector<ObjectID>& object_ids);
+
   /// Delete an object from the object store. This currently assumes that the
   /// object is present, has been sealed and not used by another client. Otherwise,
   /// it is a no operation.
@@ -204,6 +333,82 @@ class ARROW_EXPORT PlasmaClient {
   /// \return The return status.
   Status Hash(const ObjectID& object_id, uint8_t* digest);
 
+  /// Choose how this client computes the digests of the objects it seals,
+  /// and those that Hash() returns. The data of large objects is hashed in
+  /// chunks, on the threads of the CPU thread pool.
+  ///
+  /// \param type How the digests are computed. Clients comparing the digests
+  ///        of objects must use the same. Hash() uses XXH64 if this is NONE.
+  /// \return The return status.
+  Status SetDigestType(DigestType type);
+
+  /// Choose whether this client keeps the memory-mapped files of the store
+  /// mapped while it uses none of their objects. The store maps at most its
+  /// capacity, so keeping them takes no more address space than it, and gets
+  /// and releases then no longer map and unmap them.
+  ///
+  /// \param keep_mapped Whether the files are kept mapped until the client is
+  ///        disconnected. If false, those that are not in use are unmapped.
+  /// \return The return status.
+  Status SetKeepMapped(bool keep_mapped);
+
+  /// Release objects through a ring in memory shared with the store instead
+  /// of a message on the socket each, which saves the system calls of the
+  /// client and the store for every release. The store takes the releases
+  /// from the ring before any other request of the client, and every few
+  /// milliseconds otherwise.
+  ///
+  /// \param capacity The number of releases that the ring holds. Those made
+  /// while it is full are sent on the socket.
+  /// \return The return status.
+  Status UseReleaseRing(int64_t capacity = kPlasmaDefaultReleaseRingCapacity);
+
+  /// Name the client, so that the objects it creates from now on are
+  /// accounted to that name, and limit the memory of the objects of the name.
+  /// When they would exceed the quota, the unused ones are evicted, least
+  /// recently used first, and creating an object fails if that is not enough.
+  /// The names over their quota are also the first to have objects evicted
+  /// when the store is full.
+  ///
+  /// \param client_name The name of the client. Clients of the same name
+  /// share the quota, as the last of them set it.
+  /// \param output_memory_quota The number of bytes that the objects of the
+  /// name may use, or -1 if they are not limited.
+  /// \return The return status.
+  Status SetClientOptions(const std::string& client_name, int64_t output_memory_quota);
+
+  /// Get the memory used by the objects of each client name.
+  ///
+  /// \param stats Out parameter for the memory used by the objects of each
+  /// name that a client took.
+  /// \return The return status.
+  Status GetQuotaStats(std::vector<QuotaStats>* stats);
+
+  /// Have the store keep memory for objects of a size, so that creating them
+  /// takes no work of its allocator. The memory of the objects of the size
+  /// that are deleted is kept for the next ones too. The memory kept is not
+  /// evicted, and the store does not evict objects to make room for it.
+  ///
+  /// \param data_size The size in bytes of the data of the objects.
+  /// \param metadata_size The size in bytes of the metadata of the objects.
+  /// \param count The number of objects to keep memory for, which replaces
+  ///        that of a previous call for the same sizes. If this is 0, the
+  ///        memory is given back.
+  /// \param num_reserved Out parameter for the number of objects that memory
+  ///        is kept for, fewer than count if the memory of the store ran out.
+  /// \return The return status.
+  Status Reserve(int64_t data_size, int64_t metadata_size, int64_t count,
+                 int64_t* num_reserved);
+
+  /// Get the counters of the store: its objects and memory, how often get
+  /// requests found their objects, the objects evicted, and the number and
+  /// the time taken of the requests of each type. The counters are cheap
+  /// enough for the store to always keep them.
+  ///
+  /// \param stats Out parameter for the counters.
+  /// \return The return status.
+  Status GetStoreStats(PlasmaStoreStats* stats);
+
   /// Subscribe to notifications when objects are sealed in the object store.
   /// Whenever an object is sealed, a message will be written to the client
   /// socket that is returned by this method.
@@ -224,6 +429,17 @@ class ARROW_EXPORT PlasmaClient {
   Status GetNotification(int fd, ObjectID* object_id, int64_t* data_size,
                          int64_t* metadata_size);
 
+  /// Receive the next notifications for this client if Subscribe has been
+  /// called. The store sends the notifications of objects sealed or deleted
+  /// together in a single message, which this decodes at once. It blocks
+  /// until there is one.
+  ///
+  /// \param fd The file descriptor we are reading the notifications from.
+  /// \param notifications Out parameter, the notifications in the order of
+  ///        the events, which are at least one.
+  /// \return The return status.
+  Status GetNotifications(int fd, std::vector<ObjectNotification>* notifications);
+
   /// Disconnect from the local plasma instance, including the local store and
   /// manager.
   ///
@@ -291,10 +507,14 @@ class ARROW_EXPORT PlasmaClient {
   Status Wait(int64_t num_object_requests, ObjectRequest* object_requests,
               int num_ready_objects, int64_t timeout_ms, int* num_objects_ready);
 
-  /// Transfer local object to a different plasma manager.
+  /// Transfer local object to a different plasma manager. Without a manager,
+  /// the store sends the object to the store listening for transfers (with -r)
+  /// at the address, which seals it once it is received. The object must be
+  /// sealed, and this returns before it is sent.
   ///
-  /// \param addr IP address of the plasma manager we are transfering to.
-  /// \param port Port of the plasma manager we are transfering to.
+  /// \param addr IP address of the plasma manager or store we are transfering
+  ///        to.
+  /// \param port Port of the plasma manager or store we are transfering to.
   /// \param object_id ObjectID of the object we are transfering.
   /// \return The return status.
   Status Transfer(const char* addr, int port, const ObjectID& object_id);
@@ -328,6 +548,7 @@ class ARROW_EXPORT PlasmaClient {
   FRIEND_TEST(TestPlasmaStore, GetTest);
   FRIEND_TEST(TestPlasmaStore, LegacyGetTest);
   FRIEND_TEST(TestPlasmaStore, AbortTest);
+  FRIEND_TEST(TestPlasmaStoreSharded, GetAcrossThreadsTest);
 
   /// This is a helper method that flushes all pending release calls to the
   /// store.
@@ -20,6 +20,7 @@
 
 #include <cstring>
 #include <string>
+#include <vector>
 // TODO(pcm): Convert getopt and sscanf in the store to use more idiomatic C++
 // and get rid of the next three lines:
 #ifndef __STDC_FORMAT_MACROS
@@ -83,6 +84,64 @@ struct ObjectRequest {
   ObjectLocation location;
 };
 
+/// The requests of a type that the store handled.
+struct MessageStats {
+  /// The name of the type of the requests.
+  std::string type;
+  /// The number of requests handled.
+  int64_t count;
+  /// The total time taken to handle them, in microseconds.
+  int64_t total_micros;
+  /// The longest time taken to handle one, in microseconds.
+  int64_t max_micros;
+};
+
+/// The counters of a store.
+struct PlasmaStoreStats {
+  /// The number of objects in the store, sealed or not.
+  int64_t num_objects;
+  /// The memory capacity of the store.
+  int64_t memory_capacity;
+  /// The number of bytes of the objects.
+  int64_t memory_used;
+  /// The number of bytes that the allocator mapped, more than those of the
+  /// objects as it aligns them, and fragments the memory as they are freed.
+  int64_t footprint;
+  /// The number of bytes allocated of those mapped.
+  int64_t allocated;
+  /// The number of objects asked for by get requests that were in the store.
+  int64_t get_hits;
+  /// The number of objects that get requests waited for.
+  int64_t get_misses;
+  /// The number of get requests that have not returned yet.
+  int64_t num_pending_get_requests;
+  /// The number of objects evicted.
+  int64_t num_evicted;
+  /// The number of bytes of the objects evicted.
+  int64_t bytes_evicted;
+  /// The number of objects spilled to the external store.
+  int64_t num_spilled;
+  /// The number of objects restored from the external store.
+  int64_t num_restored;
+  /// The requests handled, for each type of which there were some.
+  std::vector<MessageStats> messages;
+};
+
+/// The memory used by the objects that the clients of a name created.
+struct QuotaStats {
+  /// The name of the clients.
+  std::string client_name;
+  /// The number of bytes that the objects of the name may use, or -1 if they
+  /// are not limited.
+  int64_t quota;
+  /// The number of bytes that the objects of the name use.
+  int64_t bytes_used;
+  /// The number of objects of the name in the store.
+  int64_t num_objects;
+  /// The number of bytes of the objects of the name that were evicted.
+  int64_t bytes_evicted;
+};
+
 /// Globally accessible reference to plasma store configuration.
 /// TODO(pcm): This can be avoided with some refactoring of existing code
 /// by making it possible to pass a context object through dlmalloc.
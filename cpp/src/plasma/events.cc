@@ -20,6 +20,10 @@
 #include <utility>
 
 #include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "arrow/util/logging.h"
 
 namespace plasma {
 
@@ -35,7 +39,21 @@ int EventLoop::TimerEventCallback(aeEventLoop* loop, TimerID timer_id, void* con
 
 constexpr int kInitialEventLoopSize = 1024;
 
-EventLoop::EventLoop() { loop_ = aeCreateEventLoop(kInitialEventLoopSize); }
+EventLoop::EventLoop() {
+  loop_ = aeCreateEventLoop(kInitialEventLoopSize);
+  ARROW_CHECK(pipe(post_fds_) == 0);
+  for (int fd : post_fds_) {
+    ARROW_CHECK(fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK) == 0);
+  }
+  ARROW_CHECK(AddFileEvent(post_fds_[0], kEventLoopRead,
+                           [this](int events) { RunPostedCallbacks(); }));
+}
+
+EventLoop::~EventLoop() {
+  aeDeleteEventLoop(loop_);
+  close(post_fds_[0]);
+  close(post_fds_[1]);
+}
 
 bool EventLoop::AddFileEvent(int fd, int events, const FileCallback& callback) {
   if (file_callbacks_.find(fd) != file_callbacks_.end()) {
@@ -66,13 +84,39 @@ void EventLoop::RemoveFileEvent(int fd) {
   file_callbacks_.erase(fd);
 }
 
-void EventLoop::Start() { aeMain(loop_); }
+void EventLoop::Post(const std::function<void()>& callback) {
+  {
+    std::lock_guard<std::mutex> lock(posted_mutex_);
+    posted_callbacks_.push_back(callback);
+  }
+  char byte = 0;
+  if (write(post_fds_[1], &byte, 1) < 0) {
+    // The pipe is only full if the loop has yet to read it, and run the
+    // callback with the others.
+    DCHECK(errno == EAGAIN || errno == EWOULDBLOCK);
+  }
+}
 
-void EventLoop::Stop() {
-  aeStop(loop_);
-  aeDeleteEventLoop(loop_);
+void EventLoop::RunPostedCallbacks() {
+  // Empty the pipe before taking the callbacks, so that those posted after
+  // wake the loop up again.
+  char buffer[64];
+  while (read(post_fds_[0], buffer, sizeof(buffer)) > 0) {
+  }
+  std::vector<std::function<void()>> callbacks;
+  {
+    std::lock_guard<std::mutex> lock(posted_mutex_);
+    callbacks.swap(posted_callbacks_);
+  }
+  for (const auto& callback : callbacks) {
+    callback();
+  }
 }
 
+void EventLoop::Start() { aeMain(loop_); }
+
+void EventLoop::Stop() { aeStop(loop_); }
+
 int64_t EventLoop::AddTimer(int64_t timeout, const TimerCallback& callback) {
   auto data = std::unique_ptr<TimerCallback>(new TimerCallback(callback));
   void* context = reinterpret_cast<void*>(data.get());
@@ -20,7 +20,9 @@
 
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <unordered_map>
+#include <vector>
 
 extern "C" {
 #include "ae/ae.h"
@@ -55,6 +57,8 @@ class EventLoop {
 
   EventLoop();
 
+  ~EventLoop();
+
   /// Add a new file event handler to the event loop.
   ///
   /// @param fd The file descriptor we are listening to.
@@ -82,10 +86,18 @@ class EventLoop {
   /// @return The ae.c error code. TODO(pcm): needs to be standardized
   int RemoveTimer(int64_t timer_id);
 
+  /// Run a callback on the thread of the event loop. This is the only method
+  /// that can be called from other threads than the one running the loop.
+  ///
+  /// @param callback The callback, which is run after the events that the
+  ///        loop is handling, in the order of the calls to Post.
+  void Post(const std::function<void()>& callback);
+
   /// \brief Run the event loop.
   void Start();
 
-  /// \brief Stop the event loop
+  /// \brief Stop the event loop, making Start return. The loop is deleted
+  /// with this object.
   void Stop();
 
  private:
@@ -93,7 +105,13 @@ class EventLoop {
 
   static int TimerEventCallback(aeEventLoop* loop, TimerID timer_id, void* context);
 
+  void RunPostedCallbacks();
+
   aeEventLoop* loop_;
+  /// A pipe written to by Post to wake the loop up.
+  int post_fds_[2];
+  std::mutex posted_mutex_;
+  std::vector<std::function<void()>> posted_callbacks_;
   std::unordered_map<int, std::unique_ptr<FileCallback>> file_callbacks_;
   std::unordered_map<int64_t, std::unique_ptr<TimerCallback>> timer_callbacks_;
 };
@@ -17,6 +17,9 @@
 
 #include "plasma/eviction_policy.h"
 
+#include <inttypes.h>
+#include <stdio.h>
+
 #include <algorithm>
 
 namespace plasma {
@@ -48,29 +51,165 @@ int64_t LRUCache::ChooseObjectsToEvict(int64_t num_bytes_required,
   return bytes_evicted;
 }
 
+void PriorityCache::Add(const ObjectID& key, int64_t size, double priority) {
+  auto it = item_map_.find(key);
+  ARROW_CHECK(it == item_map_.end());
+  // Items of the same priority are inserted after those already there.
+  item_map_.emplace(key, items_.emplace(priority, std::make_pair(key, size)));
+}
+
+void PriorityCache::Remove(const ObjectID& key) {
+  auto it = item_map_.find(key);
+  ARROW_CHECK(it != item_map_.end());
+  items_.erase(it->second);
+  item_map_.erase(it);
+}
+
+int64_t PriorityCache::ChooseObjectsToEvict(int64_t num_bytes_required,
+                                            std::vector<ObjectID>* objects_to_evict,
+                                            double* last_priority) {
+  int64_t bytes_evicted = 0;
+  for (auto it = items_.begin(); bytes_evicted < num_bytes_required && it != items_.end();
+       ++it) {
+    objects_to_evict->push_back(it->second.first);
+    bytes_evicted += it->second.second;
+    *last_priority = it->first;
+  }
+  return bytes_evicted;
+}
+
 EvictionPolicy::EvictionPolicy(PlasmaStoreInfo* store_info)
     : memory_used_(0), store_info_(store_info) {}
 
-int64_t EvictionPolicy::ChooseObjectsToEvict(int64_t num_bytes_required,
-                                             std::vector<ObjectID>* objects_to_evict) {
-  int64_t bytes_evicted =
-      cache_.ChooseObjectsToEvict(num_bytes_required, objects_to_evict);
-  /* Update the LRU cache. */
-  for (auto& object_id : *objects_to_evict) {
-    cache_.Remove(object_id);
+Status EvictionPolicy::Make(const std::string& name, PlasmaStoreInfo* store_info,
+                            std::unique_ptr<EvictionPolicy>* policy) {
+  const std::string ttl_prefix = "ttl:";
+  if (name == "lru") {
+    policy->reset(new LRUEvictionPolicy(store_info));
+  } else if (name == "lfu") {
+    policy->reset(new LFUEvictionPolicy(store_info));
+  } else if (name == "gds") {
+    policy->reset(new GreedyDualSizeEvictionPolicy(store_info));
+  } else if (name.compare(0, ttl_prefix.size(), ttl_prefix) == 0) {
+    int64_t ttl_ms;
+    char extra;
+    if (sscanf(name.c_str() + ttl_prefix.size(), "%" SCNd64 "%c", &ttl_ms, &extra) != 1 ||
+        ttl_ms <= 0) {
+      return Status::Invalid("Invalid time to live in eviction policy " + name);
+    }
+    policy->reset(new TTLEvictionPolicy(store_info, ttl_ms));
+  } else {
+    return Status::Invalid("Unknown eviction policy " + name);
+  }
+  return Status::OK();
+}
+
+void EvictionPolicy::Evict(int64_t bytes_evicted,
+                           const std::vector<ObjectID>& objects_to_evict) {
+  for (auto& object_id : objects_to_evict) {
+    Remove(object_id, true);
+    RemoveOwner(object_id, true);
   }
   /* Update the number of bytes used. */
   memory_used_ -= bytes_evicted;
   ARROW_CHECK(memory_used_ >= 0);
+}
+
+int64_t EvictionPolicy::EvictFromQuota(Quota* quota, int64_t num_bytes_required,
+                                       std::vector<ObjectID>* objects_to_evict) {
+  std::vector<ObjectID> chosen;
+  int64_t bytes_evicted = quota->unused.ChooseObjectsToEvict(num_bytes_required, &chosen);
+  Evict(bytes_evicted, chosen);
+  objects_to_evict->insert(objects_to_evict->end(), chosen.begin(), chosen.end());
+  return bytes_evicted;
+}
+
+void EvictionPolicy::RemoveOwner(const ObjectID& object_id, bool evicted) {
+  auto it = owners_.find(object_id);
+  if (it == owners_.end()) {
+    return;
+  }
+  Quota* quota = it->second.quota;
+  quota->unused.Remove(object_id);
+  quota->bytes_used -= it->second.size;
+  quota->num_objects--;
+  if (evicted) {
+    quota->bytes_evicted += it->second.size;
+  }
+  owners_.erase(it);
+}
+
+int64_t EvictionPolicy::ChooseObjectsToEvict(int64_t num_bytes_required,
+                                             std::vector<ObjectID>* objects_to_evict) {
+  // The objects of the names over their quota are evicted first, down to it.
+  int64_t bytes_evicted = 0;
+  for (auto& entry : quotas_) {
+    Quota& quota = entry.second;
+    if (bytes_evicted >= num_bytes_required) {
+      break;
+    }
+    if (quota.limit >= 0 && quota.bytes_used > quota.limit) {
+      bytes_evicted += EvictFromQuota(
+          &quota,
+          std::min(quota.bytes_used - quota.limit, num_bytes_required - bytes_evicted),
+          objects_to_evict);
+    }
+  }
+  if (bytes_evicted < num_bytes_required) {
+    std::vector<ObjectID> chosen;
+    int64_t bytes_chosen = Choose(num_bytes_required - bytes_evicted, &chosen);
+    Evict(bytes_chosen, chosen);
+    objects_to_evict->insert(objects_to_evict->end(), chosen.begin(), chosen.end());
+    bytes_evicted += bytes_chosen;
+  }
+  return bytes_evicted;
+}
+
+int64_t EvictionPolicy::ChooseExpiredObjects(std::vector<ObjectID>* objects_to_evict) {
+  int64_t bytes_evicted = ChooseExpired(objects_to_evict);
+  Evict(bytes_evicted, *objects_to_evict);
   return bytes_evicted;
 }
 
-void EvictionPolicy::ObjectCreated(const ObjectID& object_id) {
-  auto entry = store_info_->objects[object_id].get();
-  cache_.Add(object_id, entry->info.data_size + entry->info.metadata_size);
-  int64_t size = entry->info.data_size + entry->info.metadata_size;
+void EvictionPolicy::ObjectCreated(const ObjectID& object_id, int64_t size,
+                                   const std::string& owner) {
+  Add(object_id, size);
   memory_used_ += size;
   ARROW_CHECK(memory_used_ <= store_info_->memory_capacity);
+  if (!owner.empty()) {
+    Quota& quota = quotas_[owner];
+    quota.bytes_used += size;
+    quota.num_objects++;
+    quota.unused.Add(object_id, size);
+    owners_[object_id] = {&quota, size};
+  }
+}
+
+void EvictionPolicy::SetQuota(const std::string& owner, int64_t quota) {
+  quotas_[owner].limit = quota;
+}
+
+bool EvictionPolicy::EnforceQuota(const std::string& owner, int64_t size,
+                                  std::vector<ObjectID>* objects_to_evict) {
+  auto it = owner.empty() ? quotas_.end() : quotas_.find(owner);
+  if (it == quotas_.end() || it->second.limit < 0) {
+    return true;
+  }
+  Quota& quota = it->second;
+  if (size > quota.limit) {
+    return false;
+  }
+  const int64_t excess = quota.bytes_used + size - quota.limit;
+  return excess <= 0 || EvictFromQuota(&quota, excess, objects_to_evict) >= excess;
+}
+
+void EvictionPolicy::GetQuotaStats(std::vector<QuotaStats>* stats) const {
+  stats->clear();
+  for (const auto& entry : quotas_) {
+    const Quota& quota = entry.second;
+    stats->push_back({entry.first, quota.limit, quota.bytes_used, quota.num_objects,
+                      quota.bytes_evicted});
+  }
 }
 
 bool EvictionPolicy::RequireSpace(int64_t size, std::vector<ObjectID>* objects_to_evict) {
@@ -90,25 +229,131 @@ bool EvictionPolicy::RequireSpace(int64_t size, std::vector<ObjectID>* objects_t
 
 void EvictionPolicy::BeginObjectAccess(const ObjectID& object_id,
                                        std::vector<ObjectID>* objects_to_evict) {
-  /* If the object is in the LRU cache, remove it. */
-  cache_.Remove(object_id);
+  /* The object may no longer be evicted. */
+  Remove(object_id, false);
+  auto it = owners_.find(object_id);
+  if (it != owners_.end()) {
+    it->second.quota->unused.Remove(object_id);
+  }
 }
 
-void EvictionPolicy::EndObjectAccess(const ObjectID& object_id,
+void EvictionPolicy::EndObjectAccess(const ObjectID& object_id, int64_t size,
                                      std::vector<ObjectID>* objects_to_evict) {
-  auto entry = store_info_->objects[object_id].get();
-  /* Add the object to the LRU cache.*/
-  cache_.Add(object_id, entry->info.data_size + entry->info.metadata_size);
+  /* The object may be evicted again. */
+  Add(object_id, size);
+  auto it = owners_.find(object_id);
+  if (it != owners_.end()) {
+    it->second.quota->unused.Add(object_id, size);
+  }
 }
 
-void EvictionPolicy::RemoveObject(const ObjectID& object_id) {
-  /* If the object is in the LRU cache, remove it. */
-  cache_.Remove(object_id);
+void EvictionPolicy::RemoveObject(const ObjectID& object_id, int64_t size) {
+  Remove(object_id, true);
+  RemoveOwner(object_id, false);
 
-  auto entry = store_info_->objects[object_id].get();
-  int64_t size = entry->info.data_size + entry->info.metadata_size;
   ARROW_CHECK(memory_used_ >= size);
   memory_used_ -= size;
 }
 
+// LRU
+
+void LRUEvictionPolicy::Add(const ObjectID& object_id, int64_t size) {
+  cache_.Add(object_id, size);
+}
+
+void LRUEvictionPolicy::Remove(const ObjectID& object_id, bool deleted) {
+  cache_.Remove(object_id);
+}
+
+int64_t LRUEvictionPolicy::Choose(int64_t num_bytes_required,
+                                  std::vector<ObjectID>* objects_to_evict) {
+  return cache_.ChooseObjectsToEvict(num_bytes_required, objects_to_evict);
+}
+
+// LFU with dynamic aging
+
+void LFUEvictionPolicy::Add(const ObjectID& object_id, int64_t size) {
+  cache_.Add(object_id, size, age_ + static_cast<double>(uses_[object_id]));
+}
+
+void LFUEvictionPolicy::Remove(const ObjectID& object_id, bool deleted) {
+  cache_.Remove(object_id);
+  if (deleted) {
+    uses_.erase(object_id);
+  } else {
+    uses_[object_id]++;
+  }
+}
+
+int64_t LFUEvictionPolicy::Choose(int64_t num_bytes_required,
+                                  std::vector<ObjectID>* objects_to_evict) {
+  return cache_.ChooseObjectsToEvict(num_bytes_required, objects_to_evict, &age_);
+}
+
+// GreedyDual-Size
+
+void GreedyDualSizeEvictionPolicy::Add(const ObjectID& object_id, int64_t size) {
+  // The cost of missing an object is the same whatever its size, that of
+  // creating it again.
+  const double cost = 1.0;
+  const int64_t nonzero_size = std::max<int64_t>(size, 1);
+  cache_.Add(object_id, size, age_ + cost / static_cast<double>(nonzero_size));
+}
+
+void GreedyDualSizeEvictionPolicy::Remove(const ObjectID& object_id, bool deleted) {
+  cache_.Remove(object_id);
+}
+
+int64_t GreedyDualSizeEvictionPolicy::Choose(int64_t num_bytes_required,
+                                             std::vector<ObjectID>* objects_to_evict) {
+  return cache_.ChooseObjectsToEvict(num_bytes_required, objects_to_evict, &age_);
+}
+
+// Time to live
+
+int64_t TTLEvictionPolicy::expiry_period_ms() const {
+  // Objects are evicted at most a second after they expire.
+  return std::min<int64_t>(ttl_ms_, 1000);
+}
+
+void TTLEvictionPolicy::Add(const ObjectID& object_id, int64_t size) {
+  ARROW_CHECK(item_map_.find(object_id) == item_map_.end());
+  item_list_.push_front({object_id, size, Clock::now()});
+  item_map_.emplace(object_id, item_list_.begin());
+}
+
+void TTLEvictionPolicy::Remove(const ObjectID& object_id, bool deleted) {
+  auto it = item_map_.find(object_id);
+  ARROW_CHECK(it != item_map_.end());
+  item_list_.erase(it->second);
+  item_map_.erase(it);
+}
+
+int64_t TTLEvictionPolicy::Choose(int64_t num_bytes_required,
+                                  std::vector<ObjectID>* objects_to_evict) {
+  int64_t bytes_evicted = 0;
+  auto it = item_list_.end();
+  while (bytes_evicted < num_bytes_required && it != item_list_.begin()) {
+    it--;
+    objects_to_evict->push_back(it->object_id);
+    bytes_evicted += it->size;
+  }
+  return bytes_evicted;
+}
+
+int64_t TTLEvictionPolicy::ChooseExpired(std::vector<ObjectID>* objects_to_evict) {
+  const auto expired_before = Clock::now() - std::chrono::milliseconds(ttl_ms_);
+  int64_t bytes_evicted = 0;
+  auto it = item_list_.end();
+  while (it != item_list_.begin()) {
+    it--;
+    if (it->unused_since > expired_before) {
+      break;
+    }
+    objects_to_evict->push_back(it->object_id);
+    bytes_evicted += it->size;
+  }
+  return bytes_evicted;
+}
+
 }  // namespace plasma
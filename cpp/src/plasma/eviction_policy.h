@@ -18,16 +18,23 @@
 #ifndef PLASMA_EVICTION_POLICY_H
 #define PLASMA_EVICTION_POLICY_H
 
+#include <chrono>
 #include <list>
+#include <map>
+#include <memory>
+#include <string>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include "arrow/status.h"
 #include "plasma/common.h"
 #include "plasma/plasma.h"
 
 namespace plasma {
 
+using arrow::Status;
+
 // ==== The eviction policy ====
 //
 // This file contains declaration for all functions and data structures that
@@ -55,7 +62,39 @@ class LRUCache {
   std::unordered_map<ObjectID, ItemList::iterator> item_map_;
 };
 
-/// The eviction policy.
+/// A cache evicting the items of the lowest priority first, and of those the
+/// ones added first.
+class PriorityCache {
+ public:
+  PriorityCache() {}
+
+  void Add(const ObjectID& key, int64_t size, double priority);
+
+  void Remove(const ObjectID& key);
+
+  /// @param last_priority The priority of the last item chosen, if any, is
+  ///        written here.
+  int64_t ChooseObjectsToEvict(int64_t num_bytes_required,
+                               std::vector<ObjectID>* objects_to_evict,
+                               double* last_priority);
+
+ private:
+  /// The items in the cache and their sizes, ordered by priority.
+  typedef std::multimap<double, std::pair<ObjectID, int64_t>> ItemMap;
+  ItemMap items_;
+  /// A hash table mapping the object ID of an object in the cache to its
+  /// location in items_.
+  std::unordered_map<ObjectID, ItemMap::iterator> item_map_;
+};
+
+/// The eviction policy. It keeps track of the memory used by the objects, and
+/// chooses the objects to evict among those that are not in use, in an order
+/// that the implementations define.
+///
+/// The objects created by named clients are also accounted to their name, whose
+/// memory may be limited by a quota. A name over its quota has its own objects
+/// evicted, least recently used first, before the store needs the space of
+/// any other.
 class EvictionPolicy {
  public:
   /// Construct an eviction policy.
@@ -64,13 +103,60 @@ class EvictionPolicy {
   ///        to the eviction policy.
   explicit EvictionPolicy(PlasmaStoreInfo* store_info);
 
+  virtual ~EvictionPolicy() {}
+
+  /// Make an eviction policy.
+  ///
+  /// @param name The name of the policy, one of:
+  ///  - "lru", to evict the objects used least recently first.
+  ///  - "lfu", to evict the objects used least often first, counting the uses
+  ///    since the last eviction more, so that objects once often used age.
+  ///  - "gds", to evict the largest objects first, of those used least
+  ///    recently (GreedyDual-Size).
+  ///  - "ttl:<ms>", to evict the objects used least recently first, and those
+  ///    unused for this many milliseconds even if space is not needed.
+  /// @param store_info Information about the Plasma store that is exposed
+  ///        to the eviction policy.
+  /// @param policy The eviction policy made is written here.
+  /// @return The return status.
+  static Status Make(const std::string& name, PlasmaStoreInfo* store_info,
+                     std::unique_ptr<EvictionPolicy>* policy);
+
   /// This method will be called whenever an object is first created in order to
   /// add it to the LRU cache. This is done so that the first time, the Plasma
   /// store calls begin_object_access, we can remove the object from the LRU
   /// cache.
   ///
   /// @param object_id The object ID of the object that was created.
-  void ObjectCreated(const ObjectID& object_id);
+  /// @param size The size in bytes of the object, including both data and
+  ///        metadata.
+  /// @param owner The name of the client that created the object, if any.
+  void ObjectCreated(const ObjectID& object_id, int64_t size,
+                     const std::string& owner = "");
+
+  /// Set the quota of the objects of a client name, which applies to those
+  /// already created.
+  ///
+  /// @param owner The name of the clients.
+  /// @param quota The number of bytes that the objects of the name may use, or
+  ///        -1 if they are not limited.
+  void SetQuota(const std::string& owner, int64_t quota);
+
+  /// This method will be called before a client creates an object, to evict
+  /// objects of its name until the new one fits in its quota. As with
+  /// RequireSpace, the objects chosen will be evicted by the caller.
+  ///
+  /// @param owner The name of the client, if any.
+  /// @param size The size in bytes of the new object, including both data and
+  ///        metadata.
+  /// @param objects_to_evict The object IDs that were chosen for eviction will
+  ///        be stored into this vector.
+  /// @return True if the object fits in the quota, or there is none.
+  bool EnforceQuota(const std::string& owner, int64_t size,
+                    std::vector<ObjectID>* objects_to_evict);
+
+  /// Get the memory used by the objects of each client name.
+  void GetQuotaStats(std::vector<QuotaStats>* stats) const;
 
   /// This method will be called when the Plasma store needs more space, perhaps
   /// to create a new object. When this method is called, the eviction
@@ -101,9 +187,10 @@ class EvictionPolicy {
   /// fact be evicted from the Plasma store by the caller.
   ///
   /// @param object_id The ID of the object that is no longer being used.
+  /// @param size The size in bytes of the object.
   /// @param objects_to_evict The object IDs that were chosen for eviction will
   ///        be stored into this vector.
-  void EndObjectAccess(const ObjectID& object_id,
+  void EndObjectAccess(const ObjectID& object_id, int64_t size,
                        std::vector<ObjectID>* objects_to_evict);
 
   /// Choose some objects to evict from the Plasma store. When this method is
@@ -120,20 +207,192 @@ class EvictionPolicy {
   int64_t ChooseObjectsToEvict(int64_t num_bytes_required,
                                std::vector<ObjectID>* objects_to_evict);
 
+  /// This method will be called every expiry_period_ms() milliseconds, to
+  /// choose the objects that expired. As with ChooseObjectsToEvict, they will
+  /// be evicted by the caller.
+  ///
+  /// @param objects_to_evict The object IDs that were chosen for eviction will
+  ///        be stored into this vector.
+  /// @return The total number of bytes of space chosen to be evicted.
+  int64_t ChooseExpiredObjects(std::vector<ObjectID>* objects_to_evict);
+
   /// This method will be called when an object is going to be removed
   ///
   /// @param object_id The ID of the object that is now being used.
-  void RemoveObject(const ObjectID& object_id);
+  /// @param size The size in bytes of the object.
+  void RemoveObject(const ObjectID& object_id, int64_t size);
+
+  /// The number of bytes of the objects in the store.
+  int64_t memory_used() const { return memory_used_; }
+
+  /// How often objects expire, in milliseconds, or -1 if they do not.
+  virtual int64_t expiry_period_ms() const { return -1; }
+
+ protected:
+  /// Add an object that is not in use, which may be evicted until it is
+  /// removed.
+  ///
+  /// @param object_id The ID of the object.
+  /// @param size The size in bytes of the object.
+  virtual void Add(const ObjectID& object_id, int64_t size) = 0;
+
+  /// Remove an object that was added.
+  ///
+  /// @param object_id The ID of the object.
+  /// @param deleted True if the object is removed from the store, false if
+  ///        it is used again.
+  virtual void Remove(const ObjectID& object_id, bool deleted) = 0;
+
+  /// Choose objects that were added to be evicted, in the order of the policy.
+  ///
+  /// @param num_bytes_required The number of bytes of space to try to free up.
+  /// @param objects_to_evict The object IDs that were chosen for eviction will
+  ///        be stored into this vector.
+  /// @return The total number of bytes of space chosen to be evicted.
+  virtual int64_t Choose(int64_t num_bytes_required,
+                         std::vector<ObjectID>* objects_to_evict) = 0;
+
+  /// Choose the objects that were added and expired, if objects expire.
+  virtual int64_t ChooseExpired(std::vector<ObjectID>* objects_to_evict) { return 0; }
 
  private:
+  /// The objects of a client name.
+  struct Quota {
+    Quota() : limit(-1), bytes_used(0), num_objects(0), bytes_evicted(0) {}
+
+    /// The number of bytes that the objects may use, or -1.
+    int64_t limit;
+    int64_t bytes_used;
+    int64_t num_objects;
+    int64_t bytes_evicted;
+    /// The objects that are not in use, in LRU order.
+    LRUCache unused;
+  };
+
+  /// The name that an object is accounted to.
+  struct Owner {
+    Quota* quota;
+    int64_t size;
+  };
+
+  /// Remove the objects chosen to be evicted and the memory they use.
+  void Evict(int64_t bytes_evicted, const std::vector<ObjectID>& objects_to_evict);
+
+  /// Choose and remove unused objects of a name, least recently used first.
+  int64_t EvictFromQuota(Quota* quota, int64_t num_bytes_required,
+                         std::vector<ObjectID>* objects_to_evict);
+
+  /// Stop accounting an object that is removed to its name, if any.
+  void RemoveOwner(const ObjectID& object_id, bool evicted);
+
   /// The amount of memory (in bytes) currently being used.
   int64_t memory_used_;
   /// Pointer to the plasma store info.
   PlasmaStoreInfo* store_info_;
+  /// The objects of each client name. Names are kept once seen, as the
+  /// addresses of their quotas are.
+  std::unordered_map<std::string, Quota> quotas_;
+  /// The name of each object that a named client created.
+  std::unordered_map<ObjectID, Owner> owners_;
+};
+
+/// Evict the objects used least recently first.
+class LRUEvictionPolicy : public EvictionPolicy {
+ public:
+  explicit LRUEvictionPolicy(PlasmaStoreInfo* store_info) : EvictionPolicy(store_info) {}
+
+ protected:
+  void Add(const ObjectID& object_id, int64_t size) override;
+  void Remove(const ObjectID& object_id, bool deleted) override;
+  int64_t Choose(int64_t num_bytes_required,
+                 std::vector<ObjectID>* objects_to_evict) override;
+
+ private:
   /// Datastructure for the LRU cache.
   LRUCache cache_;
 };
 
+/// Evict the objects used least often first. The priority of an object is its
+/// number of uses plus the priority of the last object evicted when it was last
+/// used, so that objects used often long ago eventually give way to those used
+/// since (LFU with dynamic aging).
+class LFUEvictionPolicy : public EvictionPolicy {
+ public:
+  explicit LFUEvictionPolicy(PlasmaStoreInfo* store_info)
+      : EvictionPolicy(store_info), age_(0) {}
+
+ protected:
+  void Add(const ObjectID& object_id, int64_t size) override;
+  void Remove(const ObjectID& object_id, bool deleted) override;
+  int64_t Choose(int64_t num_bytes_required,
+                 std::vector<ObjectID>* objects_to_evict) override;
+
+ private:
+  /// The objects not in use, by priority.
+  PriorityCache cache_;
+  /// The number of times each object in the store was used.
+  std::unordered_map<ObjectID, int64_t> uses_;
+  /// The priority of the last object evicted.
+  double age_;
+};
+
+/// Evict the objects of the lowest priority first, which is the inverse of
+/// their size plus the priority of the last object evicted when they were last
+/// used (GreedyDual-Size). Large objects are evicted before the small ones
+/// used as recently.
+class GreedyDualSizeEvictionPolicy : public EvictionPolicy {
+ public:
+  explicit GreedyDualSizeEvictionPolicy(PlasmaStoreInfo* store_info)
+      : EvictionPolicy(store_info), age_(0) {}
+
+ protected:
+  void Add(const ObjectID& object_id, int64_t size) override;
+  void Remove(const ObjectID& object_id, bool deleted) override;
+  int64_t Choose(int64_t num_bytes_required,
+                 std::vector<ObjectID>* objects_to_evict) override;
+
+ private:
+  /// The objects not in use, by priority.
+  PriorityCache cache_;
+  /// The priority of the last object evicted.
+  double age_;
+};
+
+/// Evict the objects used least recently first, and the objects unused for
+/// longer than a time to live whether space is needed or not.
+class TTLEvictionPolicy : public EvictionPolicy {
+ public:
+  TTLEvictionPolicy(PlasmaStoreInfo* store_info, int64_t ttl_ms)
+      : EvictionPolicy(store_info), ttl_ms_(ttl_ms) {}
+
+  int64_t expiry_period_ms() const override;
+
+ protected:
+  void Add(const ObjectID& object_id, int64_t size) override;
+  void Remove(const ObjectID& object_id, bool deleted) override;
+  int64_t Choose(int64_t num_bytes_required,
+                 std::vector<ObjectID>* objects_to_evict) override;
+  int64_t ChooseExpired(std::vector<ObjectID>* objects_to_evict) override;
+
+ private:
+  using Clock = std::chrono::steady_clock;
+
+  struct Item {
+    ObjectID object_id;
+    int64_t size;
+    /// When the object stopped being used.
+    Clock::time_point unused_since;
+  };
+
+  /// The time to live of the objects not in use, in milliseconds.
+  int64_t ttl_ms_;
+  /// The objects not in use, in LRU order.
+  typedef std::list<Item> ItemList;
+  ItemList item_list_;
+  /// The location of the objects in item_list_.
+  std::unordered_map<ObjectID, ItemList::iterator> item_map_;
+};
+
 }  // namespace plasma
 
 #endif  // PLASMA_EVICTION_POLICY_H
@@ -0,0 +1,230 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "plasma/external_store.h"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#include "arrow/util/task-group.h"
+#include "arrow/util/thread-pool.h"
+
+namespace plasma {
+
+namespace {
+
+constexpr char kMagic[8] = "PLASMA1";
+
+// The header of the file of an object, whose data starts at the next multiple
+// of 64 bytes, the alignment of the buffers of Arrow.
+struct FileHeader {
+  char magic[sizeof(kMagic)];
+  int64_t data_size;
+  int64_t metadata_size;
+  uint8_t digest[kDigestSize];
+};
+
+constexpr int64_t kDataOffset = 64;
+
+static_assert(sizeof(FileHeader) <= kDataOffset, "the header must fit before the data");
+
+// Write or read all of a range of a file, which pwrite and pread may do in
+// several calls.
+template <typename Function>
+Status TransferAll(Function&& transfer, uint8_t* data, int64_t size, int64_t offset,
+                   const char* action) {
+  while (size > 0) {
+    ssize_t n = transfer(data, static_cast<size_t>(size), static_cast<off_t>(offset));
+    if (n < 0 && errno == EINTR) {
+      continue;
+    }
+    if (n <= 0) {
+      return Status::IOError(std::string("Failed to ") + action +
+                             " an object of the external store: " +
+                             (n < 0 ? std::strerror(errno) : "unexpected end of file"));
+    }
+    data += n;
+    size -= n;
+    offset += n;
+  }
+  return Status::OK();
+}
+
+}  // namespace
+
+ExternalStore::ExternalStore(const std::string& directory,
+                             std::shared_ptr<arrow::internal::ThreadPool> pool)
+    : directory_(directory), pool_(std::move(pool)) {}
+
+ExternalStore::~ExternalStore() {
+  // The objects are lost with the store, as their IDs are.
+  for (const auto& entry : objects_) {
+    unlink(GetPath(entry.first).c_str());
+  }
+}
+
+Status ExternalStore::Open(const std::string& directory, int num_threads,
+                           std::unique_ptr<ExternalStore>* out) {
+  struct stat info;
+  if (stat(directory.c_str(), &info) != 0 || !S_ISDIR(info.st_mode)) {
+    return Status::IOError("The directory of the external store does not exist: " +
+                           directory);
+  }
+  std::shared_ptr<arrow::internal::ThreadPool> pool;
+  RETURN_NOT_OK(arrow::internal::ThreadPool::Make(num_threads, &pool));
+  out->reset(new ExternalStore(directory, std::move(pool)));
+  return Status::OK();
+}
+
+std::string ExternalStore::GetPath(const ObjectID& object_id) const {
+  return directory_ + "/" + object_id.hex();
+}
+
+Status ExternalStore::Write(const ExternalObject& object) {
+  FileHeader header;
+  std::memset(&header, 0, sizeof(header));
+  std::memcpy(header.magic, kMagic, sizeof(kMagic));
+  header.data_size = object.data_size;
+  header.metadata_size = object.metadata_size;
+  std::memcpy(header.digest, object.digest.data(),
+              std::min<size_t>(object.digest.size(), kDigestSize));
+
+  // The file is written under another name first, so that a file under the
+  // name of an object is always complete.
+  const std::string path = GetPath(object.object_id);
+  const std::string temporary_path = path + ".tmp";
+  int fd = open(temporary_path.c_str(), O_CREAT | O_TRUNC | O_WRONLY, S_IRUSR | S_IWUSR);
+  if (fd < 0) {
+    return Status::IOError("Failed to create a file of the external store: " +
+                           temporary_path);
+  }
+  auto write = [fd](uint8_t* data, size_t size, off_t offset) {
+    return pwrite(fd, data, size, offset);
+  };
+  Status s = TransferAll(write, reinterpret_cast<uint8_t*>(&header), sizeof(header), 0,
+                         "write");
+  if (s.ok()) {
+    s = TransferAll(write, object.pointer, object.data_size + object.metadata_size,
+                    kDataOffset, "write");
+  }
+  if (close(fd) != 0 && s.ok()) {
+    s = Status::IOError("Failed to close a file of the external store");
+  }
+  if (s.ok() && std::rename(temporary_path.c_str(), path.c_str()) != 0) {
+    s = Status::IOError("Failed to rename a file of the external store: " + path);
+  }
+  if (!s.ok()) {
+    unlink(temporary_path.c_str());
+  }
+  return s;
+}
+
+Status ExternalStore::Read(const ExternalObject& object) {
+  const std::string path = GetPath(object.object_id);
+  int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return Status::IOError("Failed to open a file of the external store: " + path);
+  }
+  auto read = [fd](uint8_t* data, size_t size, off_t offset) {
+    return pread(fd, data, size, offset);
+  };
+  FileHeader header;
+  Status s =
+      TransferAll(read, reinterpret_cast<uint8_t*>(&header), sizeof(header), 0, "read");
+  if (s.ok() && (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0 ||
+                 header.data_size != object.data_size ||
+                 header.metadata_size != object.metadata_size)) {
+    s = Status::IOError("The file of an object of the external store is corrupt: " +
+                        path);
+  }
+  if (s.ok()) {
+    s = TransferAll(read, object.pointer, object.data_size + object.metadata_size,
+                    kDataOffset, "read");
+  }
+  close(fd);
+  return s;
+}
+
+Status ExternalStore::Put(const std::vector<ExternalObject>& objects) {
+  std::vector<const ExternalObject*> to_write;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& object : objects) {
+      if (objects_.count(object.object_id) == 0) {
+        to_write.push_back(&object);
+      }
+    }
+  }
+  // Each task records its object, so that the objects written are kept even
+  // if others fail.
+  arrow::internal::TaskGroup tasks(pool_.get());
+  for (const ExternalObject* object : to_write) {
+    tasks.Append([this, object]() {
+      RETURN_NOT_OK(Write(*object));
+      ExternalObject entry = *object;
+      entry.pointer = nullptr;
+      std::lock_guard<std::mutex> lock(mutex_);
+      objects_[object->object_id] = entry;
+      return Status::OK();
+    });
+  }
+  return tasks.Finish();
+}
+
+Status ExternalStore::Get(const std::vector<ExternalObject>& objects) {
+  arrow::internal::TaskGroup tasks(pool_.get());
+  for (const auto& object : objects) {
+    tasks.Append([this, &object]() { return Read(object); });
+  }
+  RETURN_NOT_OK(tasks.Finish());
+  for (const auto& object : objects) {
+    Remove(object.object_id);
+  }
+  return Status::OK();
+}
+
+bool ExternalStore::Contains(const ObjectID& object_id, ExternalObject* object) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = objects_.find(object_id);
+  if (it == objects_.end()) {
+    return false;
+  }
+  if (object != nullptr) {
+    *object = it->second;
+  }
+  return true;
+}
+
+bool ExternalStore::Remove(const ObjectID& object_id) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (objects_.erase(object_id) == 0) {
+      return false;
+    }
+  }
+  unlink(GetPath(object_id).c_str());
+  return true;
+}
+
+}  // namespace plasma
@@ -0,0 +1,124 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef PLASMA_EXTERNAL_STORE_H
+#define PLASMA_EXTERNAL_STORE_H
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "arrow/status.h"
+#include "plasma/common.h"
+
+namespace arrow {
+namespace internal {
+
+class ThreadPool;
+
+}  // namespace internal
+}  // namespace arrow
+
+namespace plasma {
+
+using arrow::Status;
+
+/// An object that is written to or read from the external store, with the
+/// memory that holds its data followed by its metadata.
+struct ExternalObject {
+  ObjectID object_id;
+  uint8_t* pointer;
+  int64_t data_size;
+  int64_t metadata_size;
+  std::string digest;
+};
+
+/// A directory, on a local disk, that the store spills the objects it evicts
+/// to, and restores them from when they are asked for again. Each object is a
+/// file of its own holding a header, then its data and metadata as they are in
+/// memory, at an aligned offset so that they can be mapped as they are.
+/// Objects are written and read on a bounded number of threads, to have
+/// several requests in flight without flooding the disk.
+class ExternalStore {
+ public:
+  ~ExternalStore();
+
+  /// Create the external store in a directory, which must exist.
+  ///
+  /// @param directory The directory of the files of the objects.
+  /// @param num_threads The number of objects written or read at once.
+  /// @param out The external store.
+  /// @return The return status.
+  static Status Open(const std::string& directory, int num_threads,
+                     std::unique_ptr<ExternalStore>* out);
+
+  /// Write objects to the store, in parallel, and wait for them to be
+  /// written. Objects that are already in the store are skipped, as objects
+  /// never change.
+  ///
+  /// @param objects The objects to write.
+  /// @return The return status, an error if any of the objects could not be
+  ///         written. The others are in the store.
+  Status Put(const std::vector<ExternalObject>& objects);
+
+  /// Read objects from the store, in parallel, into the memory of each, and
+  /// remove them from the store once they are all read.
+  ///
+  /// @param objects The objects to read, whose sizes must be those that the
+  ///        store holds.
+  /// @return The return status, an error if any of the objects could not be
+  ///         read. The objects are then all kept in the store.
+  Status Get(const std::vector<ExternalObject>& objects);
+
+  /// Check whether the store holds an object.
+  ///
+  /// @param object_id The ID of the object.
+  /// @param object If not null, set to the sizes and the digest of the object,
+  ///        to allocate its memory before getting it.
+  /// @return Whether the store holds the object.
+  bool Contains(const ObjectID& object_id, ExternalObject* object = nullptr);
+
+  /// Remove an object from the store.
+  ///
+  /// @param object_id The ID of the object.
+  /// @return Whether the store held the object.
+  bool Remove(const ObjectID& object_id);
+
+ private:
+  ExternalStore(const std::string& directory,
+                std::shared_ptr<arrow::internal::ThreadPool> pool);
+
+  std::string GetPath(const ObjectID& object_id) const;
+
+  Status Write(const ExternalObject& object);
+
+  Status Read(const ExternalObject& object);
+
+  std::string directory_;
+  std::shared_ptr<arrow::internal::ThreadPool> pool_;
+  /// Protects objects_, as the store is used by all the event loops.
+  std::mutex mutex_;
+  /// The objects in the store, with their pointers left null.
+  std::unordered_map<ObjectID, ExternalObject> objects_;
+};
+
+}  // namespace plasma
+
+#endif  // PLASMA_EXTERNAL_STORE_H
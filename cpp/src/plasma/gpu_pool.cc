@@ -0,0 +1,121 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "plasma/gpu_pool.h"
+
+#include <algorithm>
+#include <iterator>
+#include <sstream>
+
+#include "arrow/util/logging.h"
+#include "plasma/plasma.h"
+
+namespace plasma {
+
+static int64_t AlignToBlockSize(int64_t size) {
+  return (std::max<int64_t>(size, 1) + kBlockSize - 1) / kBlockSize * kBlockSize;
+}
+
+BlockAllocator::BlockAllocator(int64_t capacity) : capacity_(capacity), allocated_(0) {
+  if (capacity > 0) {
+    free_ranges_[0] = capacity;
+  }
+}
+
+int64_t BlockAllocator::Allocate(int64_t size) {
+  size = AlignToBlockSize(size);
+  for (auto it = free_ranges_.begin(); it != free_ranges_.end(); ++it) {
+    if (it->second < size) {
+      continue;
+    }
+    const int64_t offset = it->first;
+    const int64_t remaining = it->second - size;
+    free_ranges_.erase(it);
+    if (remaining > 0) {
+      free_ranges_[offset + size] = remaining;
+    }
+    allocated_ += size;
+    return offset;
+  }
+  return -1;
+}
+
+void BlockAllocator::Free(int64_t offset, int64_t size) {
+  size = AlignToBlockSize(size);
+  DCHECK(offset >= 0 && offset + size <= capacity_);
+  allocated_ -= size;
+  auto next = free_ranges_.lower_bound(offset);
+  DCHECK(next == free_ranges_.end() || next->first >= offset + size);
+  // Merge the range with the free ranges around it.
+  if (next != free_ranges_.end() && next->first == offset + size) {
+    size += next->second;
+    next = free_ranges_.erase(next);
+  }
+  if (next != free_ranges_.begin()) {
+    auto previous = std::prev(next);
+    DCHECK(previous->first + previous->second <= offset);
+    if (previous->first + previous->second == offset) {
+      previous->second += size;
+      return;
+    }
+  }
+  free_ranges_[offset] = size;
+}
+
+#ifdef PLASMA_GPU
+
+GpuAllocation::~GpuAllocation() { pool_->Free(block_, offset_, size_); }
+
+GpuMemoryPool::GpuMemoryPool(const std::shared_ptr<arrow::gpu::CudaContext>& context,
+                             int64_t block_size)
+    : context_(context), block_size_(block_size) {}
+
+Status GpuMemoryPool::Allocate(int64_t size, std::unique_ptr<GpuAllocation>* out) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (size_t i = 0; i < blocks_.size(); ++i) {
+    const int64_t offset = blocks_[i]->allocator.Allocate(size);
+    if (offset != -1) {
+      out->reset(new GpuAllocation(this, i, blocks_[i]->ipc_handle, offset, size));
+      return Status::OK();
+    }
+  }
+  const int64_t capacity = std::max(block_size_, AlignToBlockSize(size));
+  std::shared_ptr<arrow::gpu::CudaBuffer> buffer;
+  Status s = context_->Allocate(capacity, &buffer);
+  if (!s.ok()) {
+    std::stringstream ss;
+    ss << "Could not allocate a block of " << capacity
+       << " bytes on the GPU: " << s.ToString();
+    return Status::OutOfMemory(ss.str());
+  }
+  std::shared_ptr<arrow::gpu::CudaIpcMemHandle> ipc_handle;
+  RETURN_NOT_OK(buffer->ExportForIpc(&ipc_handle));
+  blocks_.emplace_back(new Block{buffer, ipc_handle, BlockAllocator(capacity)});
+  const int64_t offset = blocks_.back()->allocator.Allocate(size);
+  DCHECK_EQ(0, offset);
+  out->reset(new GpuAllocation(this, blocks_.size() - 1, ipc_handle, offset, size));
+  return Status::OK();
+}
+
+void GpuMemoryPool::Free(size_t block, int64_t offset, int64_t size) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  blocks_[block]->allocator.Free(offset, size);
+}
+
+#endif  // PLASMA_GPU
+
+}  // namespace plasma
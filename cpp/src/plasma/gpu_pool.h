@@ -0,0 +1,149 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef PLASMA_GPU_POOL_H
+#define PLASMA_GPU_POOL_H
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "arrow/status.h"
+
+#ifdef PLASMA_GPU
+#include "arrow/gpu/cuda_api.h"
+#endif
+
+namespace plasma {
+
+using arrow::Status;
+
+/// Sub-allocates ranges of a block of memory, keeping its bookkeeping apart
+/// from the memory, which for a device the host cannot write to. The ranges
+/// are aligned to kBlockSize, and taken first fit from the free ranges, which
+/// are coalesced as they are freed.
+class BlockAllocator {
+ public:
+  /// @param capacity The number of bytes of the block.
+  explicit BlockAllocator(int64_t capacity);
+
+  /// Allocate a range of the block.
+  ///
+  /// @param size The number of bytes of the range.
+  /// @return The offset of the range in the block, or -1 if it does not fit.
+  int64_t Allocate(int64_t size);
+
+  /// Free a range that Allocate gave.
+  ///
+  /// @param offset The offset of the range.
+  /// @param size The number of bytes of the range.
+  void Free(int64_t offset, int64_t size);
+
+  int64_t capacity() const { return capacity_; }
+
+  int64_t allocated() const { return allocated_; }
+
+ private:
+  int64_t capacity_;
+  int64_t allocated_;
+  /// The offsets of the free ranges, and their sizes.
+  std::map<int64_t, int64_t> free_ranges_;
+};
+
+#ifdef PLASMA_GPU
+
+class GpuMemoryPool;
+
+/// The range of a block of a GPU memory pool holding an object, which is
+/// given back to the pool when this is destroyed.
+class GpuAllocation {
+ public:
+  ~GpuAllocation();
+
+  /// The IPC handle of the block, which the clients open once for all of the
+  /// objects in it.
+  const std::shared_ptr<arrow::gpu::CudaIpcMemHandle>& ipc_handle() const {
+    return ipc_handle_;
+  }
+
+  /// The offset of the object in the block.
+  int64_t offset() const { return offset_; }
+
+ private:
+  friend class GpuMemoryPool;
+
+  GpuAllocation(GpuMemoryPool* pool, size_t block,
+                const std::shared_ptr<arrow::gpu::CudaIpcMemHandle>& ipc_handle,
+                int64_t offset, int64_t size)
+      : pool_(pool), block_(block), ipc_handle_(ipc_handle), offset_(offset),
+        size_(size) {}
+
+  GpuMemoryPool* pool_;
+  size_t block_;
+  std::shared_ptr<arrow::gpu::CudaIpcMemHandle> ipc_handle_;
+  int64_t offset_;
+  int64_t size_;
+};
+
+/// The memory of the objects on a GPU. Opening an IPC handle in a client is
+/// expensive, so the objects are sub-allocated from large blocks, each
+/// exported for IPC once, rather than allocated one by one. The blocks are
+/// kept for the lifetime of the store, so that a handle a client opened and
+/// cached is never reused for other memory.
+class GpuMemoryPool {
+ public:
+  /// @param context The context of the GPU.
+  /// @param block_size The number of bytes of the blocks, unless an object
+  ///        needs a larger one of its own.
+  GpuMemoryPool(const std::shared_ptr<arrow::gpu::CudaContext>& context,
+                int64_t block_size);
+
+  /// Allocate the memory of an object, from a block that has room for it or
+  /// else a new one.
+  ///
+  /// @param size The number of bytes of the object.
+  /// @param out The range of the object, in its block.
+  /// @return The return status, which is OutOfMemory if the GPU has no room
+  ///         for a new block.
+  Status Allocate(int64_t size, std::unique_ptr<GpuAllocation>* out);
+
+ private:
+  friend class GpuAllocation;
+
+  struct Block {
+    std::shared_ptr<arrow::gpu::CudaBuffer> buffer;
+    std::shared_ptr<arrow::gpu::CudaIpcMemHandle> ipc_handle;
+    BlockAllocator allocator;
+  };
+
+  void Free(size_t block, int64_t offset, int64_t size);
+
+  std::shared_ptr<arrow::gpu::CudaContext> context_;
+  int64_t block_size_;
+  /// Protects the blocks, as the objects are created and freed on the threads
+  /// of all of the event loops.
+  std::mutex mutex_;
+  std::vector<std::unique_ptr<Block>> blocks_;
+};
+
+#endif  // PLASMA_GPU
+
+}  // namespace plasma
+
+#endif  // PLASMA_GPU_POOL_H
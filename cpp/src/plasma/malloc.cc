@@ -26,6 +26,7 @@
 #include <unistd.h>
 
 #include <cerrno>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -208,3 +209,173 @@ int64_t GetMmapSize(int fd) {
 }
 
 void SetMallocGranularity(int value) { change_mparam(M_GRANULARITY, value); }
+
+void GetMallocStats(int64_t* footprint, int64_t* allocated) {
+  struct mallinfo info = dlmallinfo();
+  *footprint = static_cast<int64_t>(dlmalloc_footprint());
+  *allocated = static_cast<int64_t>(info.uordblks);
+}
+
+namespace {
+
+// The size and alignment of a slab, which holds the objects of one size class.
+// The slab of an object is found by rounding its address down.
+constexpr int64_t kSlabSize = 256 * 1024;
+
+// The size classes are the powers of two from kBlockSize to kSlabObjectMaxSize.
+constexpr int kNumSizeClasses = 11;
+
+static_assert((plasma::kBlockSize << (kNumSizeClasses - 1)) == kSlabObjectMaxSize,
+              "the size classes must end at the largest object of a slab");
+
+struct Slab {
+  int size_class;
+  int64_t num_slots;
+  // The free slots, from the last to the first.
+  std::vector<uint8_t*> free_slots;
+  // The index of the slab among those of its size class with a free slot.
+  size_t partial_index;
+};
+
+struct Reservation {
+  int64_t count;
+  std::vector<uint8_t*> blocks;
+};
+
+// The slabs, by address.
+std::unordered_map<uintptr_t, std::unique_ptr<Slab>> slabs;
+
+// The slabs of each size class that have a free slot.
+std::vector<Slab*> partial_slabs[kNumSizeClasses];
+
+// The blocks reserved for the objects of each size.
+std::unordered_map<int64_t, Reservation> reservations;
+
+int GetSizeClass(int64_t size) {
+  int size_class = 0;
+  while ((plasma::kBlockSize << size_class) < size) {
+    ++size_class;
+  }
+  return size_class;
+}
+
+void AddPartialSlab(Slab* slab) {
+  std::vector<Slab*>& partial = partial_slabs[slab->size_class];
+  slab->partial_index = partial.size();
+  partial.push_back(slab);
+}
+
+void RemovePartialSlab(Slab* slab) {
+  std::vector<Slab*>& partial = partial_slabs[slab->size_class];
+  partial[slab->partial_index] = partial.back();
+  partial[slab->partial_index]->partial_index = slab->partial_index;
+  partial.pop_back();
+}
+
+uint8_t* AllocateFromSlab(int64_t size) {
+  const int size_class = GetSizeClass(size);
+  std::vector<Slab*>& partial = partial_slabs[size_class];
+  if (partial.empty()) {
+    auto base = reinterpret_cast<uint8_t*>(dlmemalign(kSlabSize, kSlabSize));
+    if (base == nullptr) {
+      return nullptr;
+    }
+    const int64_t slot_size = plasma::kBlockSize << size_class;
+    std::unique_ptr<Slab> slab(new Slab());
+    slab->size_class = size_class;
+    slab->num_slots = kSlabSize / slot_size;
+    for (int64_t i = slab->num_slots - 1; i >= 0; --i) {
+      slab->free_slots.push_back(base + i * slot_size);
+    }
+    AddPartialSlab(slab.get());
+    slabs[reinterpret_cast<uintptr_t>(base)] = std::move(slab);
+  }
+  Slab* slab = partial.back();
+  uint8_t* pointer = slab->free_slots.back();
+  slab->free_slots.pop_back();
+  if (slab->free_slots.empty()) {
+    RemovePartialSlab(slab);
+  }
+  return pointer;
+}
+
+void FreeToSlab(uint8_t* pointer) {
+  const uintptr_t base = reinterpret_cast<uintptr_t>(pointer) & ~(kSlabSize - 1);
+  auto it = slabs.find(base);
+  ARROW_CHECK(it != slabs.end()) << "freeing an object that is in no slab";
+  Slab* slab = it->second.get();
+  slab->free_slots.push_back(pointer);
+  if (slab->free_slots.size() == 1) {
+    AddPartialSlab(slab);
+  }
+  // An empty slab is freed unless it is the last with a free slot of its
+  // class, so that objects created and deleted in turn do not map a slab each.
+  if (static_cast<int64_t>(slab->free_slots.size()) == slab->num_slots &&
+      partial_slabs[slab->size_class].size() > 1) {
+    RemovePartialSlab(slab);
+    slabs.erase(it);
+    dlfree(reinterpret_cast<void*>(base));
+  }
+}
+
+uint8_t* AllocateBlock(int64_t size) {
+  if (size <= kSlabObjectMaxSize) {
+    return AllocateFromSlab(size);
+  }
+  return reinterpret_cast<uint8_t*>(dlmemalign(plasma::kBlockSize, size));
+}
+
+void FreeBlock(uint8_t* pointer, int64_t size) {
+  if (size <= kSlabObjectMaxSize) {
+    FreeToSlab(pointer);
+  } else {
+    dlfree(pointer);
+  }
+}
+
+}  // namespace
+
+uint8_t* PlasmaAllocate(int64_t size) {
+  auto it = reservations.find(size);
+  if (it != reservations.end() && !it->second.blocks.empty()) {
+    uint8_t* pointer = it->second.blocks.back();
+    it->second.blocks.pop_back();
+    return pointer;
+  }
+  return AllocateBlock(size);
+}
+
+void PlasmaFree(uint8_t* pointer, int64_t size) {
+  if (pointer == nullptr) {
+    return;
+  }
+  auto it = reservations.find(size);
+  if (it != reservations.end() &&
+      static_cast<int64_t>(it->second.blocks.size()) < it->second.count) {
+    it->second.blocks.push_back(pointer);
+    return;
+  }
+  FreeBlock(pointer, size);
+}
+
+int64_t ReserveBlocks(int64_t size, int64_t count) {
+  Reservation& reservation = reservations[size];
+  reservation.count = count;
+  std::vector<uint8_t*>& blocks = reservation.blocks;
+  while (static_cast<int64_t>(blocks.size()) > count) {
+    FreeBlock(blocks.back(), size);
+    blocks.pop_back();
+  }
+  while (static_cast<int64_t>(blocks.size()) < count) {
+    uint8_t* pointer = AllocateBlock(size);
+    if (pointer == nullptr) {
+      break;
+    }
+    blocks.push_back(pointer);
+  }
+  const int64_t num_blocks = static_cast<int64_t>(blocks.size());
+  if (count == 0) {
+    reservations.erase(size);
+  }
+  return num_blocks;
+}
@@ -37,4 +37,43 @@ int64_t GetMmapSize(int fd);
 
 void SetMallocGranularity(int value);
 
+/// Get how much memory the allocator mapped, and how much of it is allocated.
+/// The difference is free, either at the end of the mapped files or between
+/// the objects, as fragmentation.
+///
+/// @param footprint The number of bytes mapped.
+/// @param allocated The number of bytes allocated.
+void GetMallocStats(int64_t* footprint, int64_t* allocated);
+
+/// Objects up to this size, data and metadata together, are carved out of
+/// slabs of objects of the same size class rather than allocated one by one.
+constexpr int64_t kSlabObjectMaxSize = 64 * 1024;
+
+/// Allocate the memory of an object on the host, aligned to kBlockSize. It
+/// comes from the blocks reserved for objects of its size if there are any
+/// left, from a slab if it is small, and from dlmalloc otherwise. The callers
+/// must serialize the calls to the functions of the allocator.
+///
+/// @param size The number of bytes of the object.
+/// @return The memory of the object, or null if the memory ran out.
+uint8_t* PlasmaAllocate(int64_t size);
+
+/// Free the memory of an object, which goes back to the blocks reserved for
+/// objects of its size if they are fewer than reserved.
+///
+/// @param pointer The memory of the object, allocated by PlasmaAllocate, or
+///        null.
+/// @param size The number of bytes of the object.
+void PlasmaFree(uint8_t* pointer, int64_t size);
+
+/// Keep blocks of memory for objects of a size, so that creating objects of
+/// the size takes no work of the allocator. The memory of the objects of the
+/// size that are deleted is kept too, until there are as many blocks as
+/// reserved, and is not evicted.
+///
+/// @param size The number of bytes of the objects.
+/// @param count The number of blocks to keep, or 0 to free them all.
+/// @return The number of blocks kept, fewer than count if the memory ran out.
+int64_t ReserveBlocks(int64_t size, int64_t count);
+
 #endif  // MALLOC_H
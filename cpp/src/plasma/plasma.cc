@@ -22,20 +22,17 @@
 #include <unistd.h>
 
 #include "plasma/common.h"
+#include "plasma/malloc.h"
 #include "plasma/protocol.h"
 
 namespace fb = plasma::flatbuf;
 
 namespace plasma {
 
-extern "C" {
-void dlfree(void* mem);
-}
-
 ObjectTableEntry::ObjectTableEntry() : pointer(nullptr), ref_count(0) {}
 
 ObjectTableEntry::~ObjectTableEntry() {
-  dlfree(pointer);
+  PlasmaFree(pointer, info.data_size + info.metadata_size);
   pointer = nullptr;
 }
 
@@ -75,10 +72,34 @@ std::unique_ptr<uint8_t[]> CreateObjectInfoBuffer(fb::ObjectInfoT* object_info)
   return notification;
 }
 
-ObjectTableEntry* GetObjectTableEntry(PlasmaStoreInfo* store_info,
-                                      const ObjectID& object_id) {
-  auto it = store_info->objects.find(object_id);
-  if (it == store_info->objects.end()) {
+/**
+ * This will create a new ObjectInfoBatch buffer, prefixed with its length as
+ * the buffer of CreateObjectInfoBuffer is.
+ *
+ * @param object_infos The object infos to be serialized, in order.
+ * @param num_objects The number of object infos.
+ * @return The object info batch buffer.
+ */
+std::unique_ptr<uint8_t[]> CreateObjectInfoBatchBuffer(
+    const fb::ObjectInfoT* object_infos, int64_t num_objects) {
+  flatbuffers::FlatBufferBuilder fbb;
+  std::vector<flatbuffers::Offset<fb::ObjectInfo>> objects;
+  objects.reserve(num_objects);
+  for (int64_t i = 0; i < num_objects; ++i) {
+    objects.push_back(fb::CreateObjectInfo(fbb, &object_infos[i]));
+  }
+  auto message = fb::CreateObjectInfoBatch(fbb, fbb.CreateVector(objects));
+  fbb.Finish(message);
+  auto notification =
+      std::unique_ptr<uint8_t[]>(new uint8_t[sizeof(int64_t) + fbb.GetSize()]);
+  *(reinterpret_cast<int64_t*>(notification.get())) = fbb.GetSize();
+  memcpy(notification.get() + sizeof(int64_t), fbb.GetBufferPointer(), fbb.GetSize());
+  return notification;
+}
+
+ObjectTableEntry* GetObjectTableEntry(ObjectTable* objects, const ObjectID& object_id) {
+  auto it = objects->find(object_id);
+  if (it == objects->end()) {
     return NULL;
   }
   return it->second.get();
@@ -42,6 +42,7 @@
 
 #ifdef PLASMA_GPU
 #include "arrow/gpu/cuda_api.h"
+#include "plasma/gpu_pool.h"
 
 using arrow::gpu::CudaIpcMemHandle;
 #endif
@@ -131,8 +132,11 @@ struct ObjectTableEntry {
   /// Pointer to the object data. Needed to free the object.
   uint8_t* pointer;
 #ifdef PLASMA_GPU
-  /// IPC GPU handle to share with clients.
+  /// IPC GPU handle to share with clients, that of the block of the pool
+  /// which the object is in, at the offset above.
   std::shared_ptr<CudaIpcMemHandle> ipc_handle;
+  /// The memory of the object on the GPU, freed with the object.
+  std::unique_ptr<GpuAllocation> gpu_allocation;
 #endif
   /// Number of clients currently using this object.
   int ref_count;
@@ -143,10 +147,11 @@ struct ObjectTableEntry {
   unsigned char digest[kDigestSize];
 };
 
+/// A table of objects of the Plasma store, by object ID.
+using ObjectTable = std::unordered_map<ObjectID, std::unique_ptr<ObjectTableEntry>>;
+
 /// The plasma store information that is exposed to the eviction policy.
 struct PlasmaStoreInfo {
-  /// Objects that are in the Plasma store.
-  std::unordered_map<ObjectID, std::unique_ptr<ObjectTableEntry>> objects;
   /// The amount of memory (in bytes) that we allow to be allocated in the
   /// store.
   int64_t memory_capacity;
@@ -162,12 +167,11 @@ struct PlasmaStoreInfo {
 /// Get an entry from the object table and return NULL if the object_id
 /// is not present.
 ///
-/// @param store_info The PlasmaStoreInfo that contains the object table.
+/// @param objects The object table, or the shard of it holding the object.
 /// @param object_id The object_id of the entry we are looking for.
 /// @return The entry associated with the object_id or NULL if the object_id
 ///         is not present.
-ObjectTableEntry* GetObjectTableEntry(PlasmaStoreInfo* store_info,
-                                      const ObjectID& object_id);
+ObjectTableEntry* GetObjectTableEntry(ObjectTable* objects, const ObjectID& object_id);
 
 /// Print a warning if the status is less than zero. This should be used to check
 /// the success of messages sent to plasma clients. We print a warning instead of
@@ -187,6 +191,9 @@ int WarnIfSigpipe(int status, int client_sock);
 
 std::unique_ptr<uint8_t[]> CreateObjectInfoBuffer(flatbuf::ObjectInfoT* object_info);
 
+std::unique_ptr<uint8_t[]> CreateObjectInfoBatchBuffer(
+    const flatbuf::ObjectInfoT* object_infos, int64_t num_objects);
+
 }  // namespace plasma
 
 #endif  // PLASMA_PLASMA_H
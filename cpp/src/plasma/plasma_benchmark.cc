@@ -0,0 +1,416 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Load test of a plasma store: a number of client processes create, seal,
+// get and release objects of the given sizes, in the given mix, and the
+// throughput and latency of each operation are reported, with the objects
+// that the store evicted meanwhile.
+
+#include <getopt.h>
+#include <signal.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cerrno>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "arrow/util/logging.h"
+
+#include "plasma/client.h"
+#include "plasma/common.h"
+
+namespace plasma {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+enum Operation { kCreate, kSeal, kGet, kRelease, kNumOperations };
+
+const char* kOperationNames[] = {"create", "seal", "get", "release"};
+
+struct Options {
+  // The socket of a running store; if empty, a store is launched
+  std::string socket_name;
+  // The plasma_store executable and memory of the store launched
+  std::string store_executable;
+  int64_t store_memory = 1000000000;
+  std::string eviction_policy = "lru";
+  int num_clients = 4;
+  int64_t num_operations = 10000;
+  // The sizes of the objects created, drawn uniformly
+  std::vector<int64_t> object_sizes = {1024, 1 << 20};
+  // The percentage of the operations that get an object rather than create
+  // one
+  int get_percent = 50;
+};
+
+// The latencies of the operations of a client, in nanoseconds, and the
+// number of those that failed, or of gets that did not find their object
+struct ClientResults {
+  std::vector<int64_t> latencies[kNumOperations];
+  int64_t num_failed[kNumOperations] = {};
+  int64_t bytes_created = 0;
+};
+
+int64_t ElapsedNanos(Clock::time_point start) {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start)
+      .count();
+}
+
+// The objects of each client are numbered, so that the other clients can
+// look them up
+ObjectID MakeObjectID(int client, int64_t index) {
+  char binary[kUniqueIDSize] = {};
+  std::snprintf(binary, sizeof(binary), "b%d-%" PRId64, client, index);
+  return ObjectID::from_binary(std::string(binary, sizeof(binary)));
+}
+
+// Run an operation, recording its latency and whether it failed
+template <typename Function>
+void Timed(ClientResults* results, Operation operation, Function&& function) {
+  const auto start = Clock::now();
+  const Status status = function();
+  results->latencies[operation].push_back(ElapsedNanos(start));
+  if (!status.ok()) {
+    ++results->num_failed[operation];
+  }
+}
+
+void RunClient(const Options& options, int client_index, ClientResults* results) {
+  PlasmaClient client;
+  ARROW_CHECK_OK(client.Connect(options.socket_name, ""));
+
+  std::mt19937_64 rng(client_index);
+  std::uniform_int_distribution<int> percent(0, 99);
+  std::uniform_int_distribution<size_t> size_index(0, options.object_sizes.size() - 1);
+  std::uniform_int_distribution<int> other_client(0, options.num_clients - 1);
+
+  int64_t num_created = 0;
+  for (int64_t i = 0; i < options.num_operations; ++i) {
+    if (num_created > 0 && percent(rng) < options.get_percent) {
+      // Another client's objects may not have been created yet, or may have
+      // been evicted, in which case the get fails
+      const ObjectID object_id = MakeObjectID(
+          other_client(rng),
+          std::uniform_int_distribution<int64_t>(0, num_created - 1)(rng));
+      ObjectBuffer object_buffer;
+      Timed(results, kGet,
+            [&]() { return client.Get(&object_id, 1, 0, &object_buffer); });
+      if (object_buffer.data == nullptr) {
+        ++results->num_failed[kGet];
+        continue;
+      }
+      Timed(results, kRelease, [&]() { return client.Release(object_id); });
+      continue;
+    }
+
+    const ObjectID object_id = MakeObjectID(client_index, num_created++);
+    const int64_t size = options.object_sizes[size_index(rng)];
+    std::shared_ptr<Buffer> data;
+    Timed(results, kCreate,
+          [&]() { return client.Create(object_id, size, nullptr, 0, &data); });
+    if (data == nullptr) {
+      continue;
+    }
+    // Write the object, as a producer would, outside of the timings
+    std::memset(data->mutable_data(), static_cast<int>(i), size);
+    results->bytes_created += size;
+    Timed(results, kSeal, [&]() { return client.Seal(object_id); });
+    Timed(results, kRelease, [&]() { return client.Release(object_id); });
+  }
+  ARROW_CHECK_OK(client.Disconnect());
+}
+
+// The results are written to the parent process as the bytes created, then,
+// for each operation, the number of failures, of latencies and the latencies
+void WriteAll(int fd, const void* data, size_t size) {
+  const auto* bytes = static_cast<const uint8_t*>(data);
+  while (size > 0) {
+    ssize_t written = write(fd, bytes, size);
+    ARROW_CHECK(written > 0) << "could not write the results: " << strerror(errno);
+    bytes += written;
+    size -= static_cast<size_t>(written);
+  }
+}
+
+bool ReadAll(int fd, void* data, size_t size) {
+  auto* bytes = static_cast<uint8_t*>(data);
+  while (size > 0) {
+    ssize_t num_read = read(fd, bytes, size);
+    if (num_read <= 0) {
+      return false;
+    }
+    bytes += num_read;
+    size -= static_cast<size_t>(num_read);
+  }
+  return true;
+}
+
+void WriteResults(int fd, const ClientResults& results) {
+  WriteAll(fd, &results.bytes_created, sizeof(int64_t));
+  for (int op = 0; op < kNumOperations; ++op) {
+    const int64_t count = static_cast<int64_t>(results.latencies[op].size());
+    WriteAll(fd, &results.num_failed[op], sizeof(int64_t));
+    WriteAll(fd, &count, sizeof(int64_t));
+    WriteAll(fd, results.latencies[op].data(), count * sizeof(int64_t));
+  }
+}
+
+bool ReadResults(int fd, ClientResults* results) {
+  if (!ReadAll(fd, &results->bytes_created, sizeof(int64_t))) {
+    return false;
+  }
+  for (int op = 0; op < kNumOperations; ++op) {
+    int64_t count;
+    if (!ReadAll(fd, &results->num_failed[op], sizeof(int64_t)) ||
+        !ReadAll(fd, &count, sizeof(int64_t))) {
+      return false;
+    }
+    results->latencies[op].resize(count);
+    if (!ReadAll(fd, results->latencies[op].data(), count * sizeof(int64_t))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+double Percentile(const std::vector<int64_t>& sorted, double fraction) {
+  if (sorted.empty()) {
+    return 0;
+  }
+  const auto index = static_cast<size_t>(fraction * static_cast<double>(sorted.size()));
+  return static_cast<double>(sorted[std::min(index, sorted.size() - 1)]) / 1000;
+}
+
+void PrintResults(const Options& options, const ClientResults& total,
+                  int64_t wall_nanos, const PlasmaStoreStats& before,
+                  const PlasmaStoreStats& after) {
+  const double seconds = static_cast<double>(wall_nanos) / 1e9;
+  std::cout << options.num_clients << " clients, " << options.num_operations
+            << " operations each, " << options.get_percent << "% gets, in " << seconds
+            << "s" << std::endl
+            << std::endl;
+  std::cout << std::left << std::setw(10) << "operation" << std::right << std::setw(10)
+            << "count" << std::setw(10) << "failed" << std::setw(12) << "ops/s"
+            << std::setw(12) << "p50 (us)" << std::setw(12) << "p99 (us)"
+            << std::setw(12) << "p999 (us)" << std::setw(12) << "max (us)" << std::endl;
+  for (int op = 0; op < kNumOperations; ++op) {
+    std::vector<int64_t> sorted = total.latencies[op];
+    std::sort(sorted.begin(), sorted.end());
+    std::cout << std::left << std::setw(10) << kOperationNames[op] << std::right
+              << std::setw(10) << sorted.size() << std::setw(10) << total.num_failed[op]
+              << std::setw(12) << std::fixed << std::setprecision(0)
+              << static_cast<double>(sorted.size()) / seconds << std::setprecision(1)
+              << std::setw(12) << Percentile(sorted, 0.5) << std::setw(12)
+              << Percentile(sorted, 0.99) << std::setw(12) << Percentile(sorted, 0.999)
+              << std::setw(12) << Percentile(sorted, 1.0) << std::endl;
+  }
+  std::cout << std::endl
+            << "created " << static_cast<double>(total.bytes_created) / (1 << 20)
+            << " MiB, " << static_cast<double>(total.bytes_created) / (1 << 20) / seconds
+            << " MiB/s" << std::endl
+            << "evicted " << after.num_evicted - before.num_evicted << " objects, "
+            << static_cast<double>(after.bytes_evicted - before.bytes_evicted) / (1 << 20)
+            << " MiB" << std::endl
+            << "get hits " << after.get_hits - before.get_hits << ", misses "
+            << after.get_misses - before.get_misses << std::endl;
+}
+
+pid_t LaunchStore(Options* options) {
+  options->socket_name = "/tmp/plasma_benchmark" + std::to_string(getpid());
+  const std::string memory = std::to_string(options->store_memory);
+  pid_t pid = fork();
+  ARROW_CHECK(pid >= 0) << "could not fork the store: " << strerror(errno);
+  if (pid == 0) {
+    execl(options->store_executable.c_str(), options->store_executable.c_str(), "-m",
+          memory.c_str(), "-s", options->socket_name.c_str(), "-e",
+          options->eviction_policy.c_str(), static_cast<char*>(nullptr));
+    std::cerr << "could not launch " << options->store_executable << ": "
+              << strerror(errno) << std::endl;
+    _exit(1);
+  }
+  return pid;
+}
+
+int Run(Options options) {
+  pid_t store_pid = -1;
+  if (options.socket_name.empty()) {
+    store_pid = LaunchStore(&options);
+  }
+
+  // Connecting retries until the store is listening
+  PlasmaClient client;
+  ARROW_CHECK_OK(client.Connect(options.socket_name, ""));
+  PlasmaStoreStats before, after;
+  ARROW_CHECK_OK(client.GetStoreStats(&before));
+
+  // The clients start together, once the parent closes the write end of
+  // this pipe, and each writes its results to a pipe of its own
+  int start_pipe[2];
+  ARROW_CHECK(pipe(start_pipe) == 0);
+  std::vector<pid_t> pids;
+  std::vector<int> result_fds;
+  for (int i = 0; i < options.num_clients; ++i) {
+    int result_pipe[2];
+    ARROW_CHECK(pipe(result_pipe) == 0);
+    pid_t pid = fork();
+    ARROW_CHECK(pid >= 0) << "could not fork a client: " << strerror(errno);
+    if (pid == 0) {
+      close(start_pipe[1]);
+      close(result_pipe[0]);
+      char byte;
+      ARROW_CHECK(read(start_pipe[0], &byte, 1) == 0);
+      ClientResults results;
+      RunClient(options, i, &results);
+      WriteResults(result_pipe[1], results);
+      _exit(0);
+    }
+    close(result_pipe[1]);
+    pids.push_back(pid);
+    result_fds.push_back(result_pipe[0]);
+  }
+  close(start_pipe[0]);
+  const auto start = Clock::now();
+  close(start_pipe[1]);
+
+  ClientResults total;
+  int status = 0;
+  for (int i = 0; i < options.num_clients; ++i) {
+    ClientResults results;
+    if (!ReadResults(result_fds[i], &results)) {
+      std::cerr << "client " << i << " did not finish" << std::endl;
+      status = 1;
+    }
+    close(result_fds[i]);
+    waitpid(pids[i], nullptr, 0);
+    for (int op = 0; op < kNumOperations; ++op) {
+      total.latencies[op].insert(total.latencies[op].end(),
+                                 results.latencies[op].begin(),
+                                 results.latencies[op].end());
+      total.num_failed[op] += results.num_failed[op];
+    }
+    total.bytes_created += results.bytes_created;
+  }
+  const int64_t wall_nanos = ElapsedNanos(start);
+
+  ARROW_CHECK_OK(client.GetStoreStats(&after));
+  ARROW_CHECK_OK(client.Disconnect());
+  PrintResults(options, total, wall_nanos, before, after);
+
+  if (store_pid > 0) {
+    kill(store_pid, SIGTERM);
+    waitpid(store_pid, nullptr, 0);
+  }
+  return status;
+}
+
+std::vector<int64_t> ParseSizes(const char* arg) {
+  std::vector<int64_t> sizes;
+  std::stringstream ss(arg);
+  std::string item;
+  while (std::getline(ss, item, ',')) {
+    char extra;
+    int64_t size;
+    ARROW_CHECK(sscanf(item.c_str(), "%" SCNd64 "%c", &size, &extra) == 1 && size >= 0)
+        << "invalid object size " << item;
+    sizes.push_back(size);
+  }
+  ARROW_CHECK(!sizes.empty()) << "no object sizes given";
+  return sizes;
+}
+
+void PrintUsage() {
+  std::cerr
+      << "Usage: plasma_benchmark [options]" << std::endl
+      << "  -s SOCKET  the socket of a running store, rather than launching one"
+      << std::endl
+      << "  -x PATH    the plasma_store executable to launch, by default the one"
+      << std::endl
+      << "             next to this executable" << std::endl
+      << "  -m BYTES   the memory of the store launched, by default 1000000000"
+      << std::endl
+      << "  -e POLICY  the eviction policy of the store launched, by default lru"
+      << std::endl
+      << "  -c N       the number of client processes, by default 4" << std::endl
+      << "  -n N       the number of operations of each client, by default 10000"
+      << std::endl
+      << "  -z SIZES   the comma-separated sizes of the objects, by default 1024,1048576"
+      << std::endl
+      << "  -g PERCENT the percentage of operations that get an object, by default 50"
+      << std::endl;
+}
+
+}  // namespace
+
+}  // namespace plasma
+
+int main(int argc, char** argv) {
+  plasma::Options options;
+  const std::string executable = argv[0];
+  options.store_executable =
+      executable.substr(0, executable.find_last_of('/') + 1) + "plasma_store";
+  int c;
+  while ((c = getopt(argc, argv, "s:x:m:e:c:n:z:g:")) != -1) {
+    char extra;
+    switch (c) {
+      case 's':
+        options.socket_name = optarg;
+        break;
+      case 'x':
+        options.store_executable = optarg;
+        break;
+      case 'm':
+        ARROW_CHECK(sscanf(optarg, "%" SCNd64 "%c", &options.store_memory, &extra) == 1);
+        break;
+      case 'e':
+        options.eviction_policy = optarg;
+        break;
+      case 'c':
+        ARROW_CHECK(sscanf(optarg, "%d%c", &options.num_clients, &extra) == 1 &&
+                    options.num_clients > 0);
+        break;
+      case 'n':
+        ARROW_CHECK(sscanf(optarg, "%" SCNd64 "%c", &options.num_operations, &extra) ==
+                    1);
+        break;
+      case 'z':
+        options.object_sizes = plasma::ParseSizes(optarg);
+        break;
+      case 'g':
+        ARROW_CHECK(sscanf(optarg, "%d%c", &options.get_percent, &extra) == 1 &&
+                    options.get_percent >= 0 && options.get_percent <= 100);
+        break;
+      default:
+        plasma::PrintUsage();
+        return 1;
+    }
+  }
+  return plasma::Run(options);
+}
@@ -178,6 +178,90 @@ Status ReadCreateReply(uint8_t* data, size_t size, ObjectID* object_id,
   return PlasmaErrorStatus(message->error());
 }
 
+Status SendCreateBatchRequest(int sock, const std::vector<ObjectID>& object_ids,
+                              const std::vector<int64_t>& data_sizes,
+                              const std::vector<int64_t>& metadata_sizes) {
+  flatbuffers::FlatBufferBuilder fbb;
+  std::vector<uint64_t> data_sizes_fb(data_sizes.begin(), data_sizes.end());
+  std::vector<uint64_t> metadata_sizes_fb(metadata_sizes.begin(), metadata_sizes.end());
+  auto message = fb::CreatePlasmaCreateBatchRequest(
+      fbb, ToFlatbuffer(&fbb, object_ids.data(), object_ids.size()),
+      fbb.CreateVector(data_sizes_fb), fbb.CreateVector(metadata_sizes_fb));
+  return PlasmaSend(sock, MessageType::PlasmaCreateBatchRequest, &fbb, message);
+}
+
+Status ReadCreateBatchRequest(uint8_t* data, size_t size,
+                              std::vector<ObjectID>* object_ids,
+                              std::vector<int64_t>* data_sizes,
+                              std::vector<int64_t>* metadata_sizes) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<fb::PlasmaCreateBatchRequest>(data);
+  DCHECK(VerifyFlatbuffer(message, data, size));
+  uoffset_t num_objects = message->object_ids()->size();
+  ARROW_CHECK(message->data_sizes()->size() == num_objects);
+  ARROW_CHECK(message->metadata_sizes()->size() == num_objects);
+  object_ids->clear();
+  data_sizes->clear();
+  metadata_sizes->clear();
+  for (uoffset_t i = 0; i < num_objects; ++i) {
+    object_ids->push_back(ObjectID::from_binary(message->object_ids()->Get(i)->str()));
+    data_sizes->push_back(message->data_sizes()->Get(i));
+    metadata_sizes->push_back(message->metadata_sizes()->Get(i));
+  }
+  return Status::OK();
+}
+
+Status SendCreateBatchReply(int sock, const std::vector<ObjectID>& object_ids,
+                            const std::vector<PlasmaObject>& objects, PlasmaError error,
+                            const std::vector<int>& store_fds,
+                            const std::vector<int64_t>& mmap_sizes) {
+  flatbuffers::FlatBufferBuilder fbb;
+  std::vector<PlasmaObjectSpec> specs;
+  for (const PlasmaObject& object : objects) {
+    specs.push_back(PlasmaObjectSpec(object.store_fd, object.data_offset,
+                                     object.data_size, object.metadata_offset,
+                                     object.metadata_size, object.device_num));
+  }
+  auto message = fb::CreatePlasmaCreateBatchReply(
+      fbb, ToFlatbuffer(&fbb, object_ids.data(), object_ids.size()),
+      fbb.CreateVectorOfStructs(specs.data(), specs.size()), error,
+      fbb.CreateVector(store_fds), fbb.CreateVector(mmap_sizes));
+  return PlasmaSend(sock, MessageType::PlasmaCreateBatchReply, &fbb, message);
+}
+
+Status ReadCreateBatchReply(uint8_t* data, size_t size, std::vector<ObjectID>* object_ids,
+                            std::vector<PlasmaObject>* objects,
+                            std::vector<int>* store_fds,
+                            std::vector<int64_t>* mmap_sizes) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<fb::PlasmaCreateBatchReply>(data);
+  DCHECK(VerifyFlatbuffer(message, data, size));
+  object_ids->clear();
+  objects->clear();
+  store_fds->clear();
+  mmap_sizes->clear();
+  for (uoffset_t i = 0; i < message->object_ids()->size(); ++i) {
+    object_ids->push_back(ObjectID::from_binary(message->object_ids()->Get(i)->str()));
+  }
+  for (uoffset_t i = 0; i < message->plasma_objects()->size(); ++i) {
+    const PlasmaObjectSpec* spec = message->plasma_objects()->Get(i);
+    PlasmaObject object;
+    object.store_fd = spec->segment_index();
+    object.data_offset = spec->data_offset();
+    object.data_size = spec->data_size();
+    object.metadata_offset = spec->metadata_offset();
+    object.metadata_size = spec->metadata_size();
+    object.device_num = spec->device_num();
+    objects->push_back(object);
+  }
+  ARROW_CHECK(message->store_fds()->size() == message->mmap_sizes()->size());
+  for (uoffset_t i = 0; i < message->store_fds()->size(); ++i) {
+    store_fds->push_back(message->store_fds()->Get(i));
+    mmap_sizes->push_back(message->mmap_sizes()->Get(i));
+  }
+  return PlasmaErrorStatus(message->error());
+}
+
 Status SendAbortRequest(int sock, ObjectID object_id) {
   flatbuffers::FlatBufferBuilder fbb;
   auto message = fb::CreatePlasmaAbortRequest(fbb, fbb.CreateString(object_id.binary()));
@@ -242,6 +326,36 @@ Status ReadSealReply(uint8_t* data, size_t size, ObjectID* object_id) {
   return PlasmaErrorStatus(message->error());
 }
 
+Status SendSealBatchRequest(int sock, const std::vector<ObjectID>& object_ids,
+                            const std::vector<std::string>& digests) {
+  flatbuffers::FlatBufferBuilder fbb;
+  std::vector<flatbuffers::Offset<flatbuffers::String>> digest_strings;
+  for (const std::string& digest : digests) {
+    digest_strings.push_back(fbb.CreateString(digest));
+  }
+  auto message = fb::CreatePlasmaSealBatchRequest(
+      fbb, ToFlatbuffer(&fbb, object_ids.data(), object_ids.size()),
+      fbb.CreateVector(digest_strings));
+  return PlasmaSend(sock, MessageType::PlasmaSealBatchRequest, &fbb, message);
+}
+
+Status ReadSealBatchRequest(uint8_t* data, size_t size, std::vector<ObjectID>* object_ids,
+                            std::vector<std::string>* digests) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<fb::PlasmaSealBatchRequest>(data);
+  DCHECK(VerifyFlatbuffer(message, data, size));
+  uoffset_t num_objects = message->object_ids()->size();
+  ARROW_CHECK(message->digests()->size() == num_objects);
+  object_ids->clear();
+  digests->clear();
+  for (uoffset_t i = 0; i < num_objects; ++i) {
+    object_ids->push_back(ObjectID::from_binary(message->object_ids()->Get(i)->str()));
+    ARROW_CHECK(message->digests()->Get(i)->size() == kDigestSize);
+    digests->push_back(message->digests()->Get(i)->str());
+  }
+  return Status::OK();
+}
+
 // Release messages.
 
 Status SendReleaseRequest(int sock, ObjectID object_id) {
@@ -274,6 +388,25 @@ Status ReadReleaseReply(uint8_t* data, size_t size, ObjectID* object_id) {
   return PlasmaErrorStatus(message->error());
 }
 
+Status SendReleaseBatchRequest(int sock, const std::vector<ObjectID>& object_ids) {
+  flatbuffers::FlatBufferBuilder fbb;
+  auto message = fb::CreatePlasmaReleaseBatchRequest(
+      fbb, ToFlatbuffer(&fbb, object_ids.data(), object_ids.size()));
+  return PlasmaSend(sock, MessageType::PlasmaReleaseBatchRequest, &fbb, message);
+}
+
+Status ReadReleaseBatchRequest(uint8_t* data, size_t size,
+                               std::vector<ObjectID>* object_ids) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<fb::PlasmaReleaseBatchRequest>(data);
+  DCHECK(VerifyFlatbuffer(message, data, size));
+  object_ids->clear();
+  for (uoffset_t i = 0; i < message->object_ids()->size(); ++i) {
+    object_ids->push_back(ObjectID::from_binary(message->object_ids()->Get(i)->str()));
+  }
+  return Status::OK();
+}
+
 // Delete objects messages.
 
 Status SendDeleteRequest(int sock, const std::vector<ObjectID>& object_ids) {
@@ -434,6 +567,208 @@ Status ReadConnectReply(uint8_t* data, size_t size, int64_t* memory_capacity) {
   return Status::OK();
 }
 
+// ReleaseRing messages.
+
+Status SendReleaseRingRequest(int sock, int64_t capacity) {
+  flatbuffers::FlatBufferBuilder fbb;
+  auto message = fb::CreatePlasmaReleaseRingRequest(fbb, capacity);
+  return PlasmaSend(sock, MessageType::PlasmaReleaseRingRequest, &fbb, message);
+}
+
+Status ReadReleaseRingRequest(uint8_t* data, size_t size, int64_t* capacity) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<fb::PlasmaReleaseRingRequest>(data);
+  DCHECK(VerifyFlatbuffer(message, data, size));
+  *capacity = message->capacity();
+  return Status::OK();
+}
+
+Status SendReleaseRingReply(int sock, bool accepted) {
+  flatbuffers::FlatBufferBuilder fbb;
+  auto message = fb::CreatePlasmaReleaseRingReply(fbb, accepted);
+  return PlasmaSend(sock, MessageType::PlasmaReleaseRingReply, &fbb, message);
+}
+
+Status ReadReleaseRingReply(uint8_t* data, size_t size, bool* accepted) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<fb::PlasmaReleaseRingReply>(data);
+  DCHECK(VerifyFlatbuffer(message, data, size));
+  *accepted = message->accepted();
+  return Status::OK();
+}
+
+// SetOptions messages.
+
+Status SendSetOptionsRequest(int sock, const std::string& client_name,
+                             int64_t output_memory_quota) {
+  flatbuffers::FlatBufferBuilder fbb;
+  auto message = fb::CreatePlasmaSetOptionsRequest(fbb, fbb.CreateString(client_name),
+                                                   output_memory_quota);
+  return PlasmaSend(sock, MessageType::PlasmaSetOptionsRequest, &fbb, message);
+}
+
+Status ReadSetOptionsRequest(uint8_t* data, size_t size, std::string* client_name,
+                             int64_t* output_memory_quota) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<fb::PlasmaSetOptionsRequest>(data);
+  DCHECK(VerifyFlatbuffer(message, data, size));
+  *client_name = message->client_name()->str();
+  *output_memory_quota = message->output_memory_quota();
+  return Status::OK();
+}
+
+Status SendSetOptionsReply(int sock, PlasmaError error) {
+  flatbuffers::FlatBufferBuilder fbb;
+  auto message = fb::CreatePlasmaSetOptionsReply(fbb, error);
+  return PlasmaSend(sock, MessageType::PlasmaSetOptionsReply, &fbb, message);
+}
+
+Status ReadSetOptionsReply(uint8_t* data, size_t size) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<fb::PlasmaSetOptionsReply>(data);
+  DCHECK(VerifyFlatbuffer(message, data, size));
+  return PlasmaErrorStatus(message->error());
+}
+
+// QuotaStats messages.
+
+Status SendQuotaStatsRequest(int sock) {
+  flatbuffers::FlatBufferBuilder fbb;
+  auto message = fb::CreatePlasmaQuotaStatsRequest(fbb);
+  return PlasmaSend(sock, MessageType::PlasmaQuotaStatsRequest, &fbb, message);
+}
+
+Status ReadQuotaStatsRequest(uint8_t* data, size_t size) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<fb::PlasmaQuotaStatsRequest>(data);
+  DCHECK(VerifyFlatbuffer(message, data, size));
+  return Status::OK();
+}
+
+Status SendQuotaStatsReply(int sock, const std::vector<QuotaStats>& stats) {
+  flatbuffers::FlatBufferBuilder fbb;
+  std::vector<flatbuffers::Offset<fb::QuotaStats>> stats_offsets;
+  for (const auto& entry : stats) {
+    stats_offsets.push_back(fb::CreateQuotaStats(
+        fbb, fbb.CreateString(entry.client_name), entry.quota, entry.bytes_used,
+        entry.num_objects, entry.bytes_evicted));
+  }
+  auto message = fb::CreatePlasmaQuotaStatsReply(fbb, fbb.CreateVector(stats_offsets));
+  return PlasmaSend(sock, MessageType::PlasmaQuotaStatsReply, &fbb, message);
+}
+
+Status ReadQuotaStatsReply(uint8_t* data, size_t size, std::vector<QuotaStats>* stats) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<fb::PlasmaQuotaStatsReply>(data);
+  DCHECK(VerifyFlatbuffer(message, data, size));
+  stats->clear();
+  for (const auto entry : *message->stats()) {
+    stats->push_back({entry->client_name()->str(), entry->quota(), entry->bytes_used(),
+                      entry->num_objects(), entry->bytes_evicted()});
+  }
+  return Status::OK();
+}
+
+// StoreStats messages.
+
+Status SendStoreStatsRequest(int sock) {
+  flatbuffers::FlatBufferBuilder fbb;
+  auto message = fb::CreatePlasmaStoreStatsRequest(fbb);
+  return PlasmaSend(sock, MessageType::PlasmaStoreStatsRequest, &fbb, message);
+}
+
+Status ReadStoreStatsRequest(uint8_t* data, size_t size) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<fb::PlasmaStoreStatsRequest>(data);
+  DCHECK(VerifyFlatbuffer(message, data, size));
+  return Status::OK();
+}
+
+Status SendStoreStatsReply(int sock, const PlasmaStoreStats& stats) {
+  flatbuffers::FlatBufferBuilder fbb;
+  std::vector<flatbuffers::Offset<fb::MessageStats>> messages;
+  for (const auto& entry : stats.messages) {
+    messages.push_back(fb::CreateMessageStats(fbb, fbb.CreateString(entry.type),
+                                              entry.count, entry.total_micros,
+                                              entry.max_micros));
+  }
+  auto messages_offset = fbb.CreateVector(messages);
+  fb::PlasmaStoreStatsReplyBuilder builder(fbb);
+  builder.add_num_objects(stats.num_objects);
+  builder.add_memory_capacity(stats.memory_capacity);
+  builder.add_memory_used(stats.memory_used);
+  builder.add_footprint(stats.footprint);
+  builder.add_allocated(stats.allocated);
+  builder.add_get_hits(stats.get_hits);
+  builder.add_get_misses(stats.get_misses);
+  builder.add_num_pending_get_requests(stats.num_pending_get_requests);
+  builder.add_num_evicted(stats.num_evicted);
+  builder.add_bytes_evicted(stats.bytes_evicted);
+  builder.add_num_spilled(stats.num_spilled);
+  builder.add_num_restored(stats.num_restored);
+  builder.add_messages(messages_offset);
+  auto message = builder.Finish();
+  return PlasmaSend(sock, MessageType::PlasmaStoreStatsReply, &fbb, message);
+}
+
+Status ReadStoreStatsReply(uint8_t* data, size_t size, PlasmaStoreStats* stats) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<fb::PlasmaStoreStatsReply>(data);
+  DCHECK(VerifyFlatbuffer(message, data, size));
+  stats->num_objects = message->num_objects();
+  stats->memory_capacity = message->memory_capacity();
+  stats->memory_used = message->memory_used();
+  stats->footprint = message->footprint();
+  stats->allocated = message->allocated();
+  stats->get_hits = message->get_hits();
+  stats->get_misses = message->get_misses();
+  stats->num_pending_get_requests = message->num_pending_get_requests();
+  stats->num_evicted = message->num_evicted();
+  stats->bytes_evicted = message->bytes_evicted();
+  stats->num_spilled = message->num_spilled();
+  stats->num_restored = message->num_restored();
+  stats->messages.clear();
+  for (const auto entry : *message->messages()) {
+    stats->messages.push_back({entry->type()->str(), entry->count(),
+                               entry->total_micros(), entry->max_micros()});
+  }
+  return Status::OK();
+}
+
+// Reserve messages.
+
+Status SendReserveRequest(int sock, int64_t data_size, int64_t metadata_size,
+                          int64_t count) {
+  flatbuffers::FlatBufferBuilder fbb;
+  auto message = fb::CreatePlasmaReserveRequest(fbb, data_size, metadata_size, count);
+  return PlasmaSend(sock, MessageType::PlasmaReserveRequest, &fbb, message);
+}
+
+Status ReadReserveRequest(uint8_t* data, size_t size, int64_t* data_size,
+                          int64_t* metadata_size, int64_t* count) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<fb::PlasmaReserveRequest>(data);
+  DCHECK(VerifyFlatbuffer(message, data, size));
+  *data_size = message->data_size();
+  *metadata_size = message->metadata_size();
+  *count = message->count();
+  return Status::OK();
+}
+
+Status SendReserveReply(int sock, int64_t num_reserved) {
+  flatbuffers::FlatBufferBuilder fbb;
+  auto message = fb::CreatePlasmaReserveReply(fbb, num_reserved);
+  return PlasmaSend(sock, MessageType::PlasmaReserveReply, &fbb, message);
+}
+
+Status ReadReserveReply(uint8_t* data, size_t size, int64_t* num_reserved) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<fb::PlasmaReserveReply>(data);
+  DCHECK(VerifyFlatbuffer(message, data, size));
+  *num_reserved = message->num_reserved();
+  return Status::OK();
+}
+
 // Evict messages.
 
 Status SendEvictRequest(int sock, int64_t num_bytes) {
@@ -467,15 +802,15 @@ Status ReadEvictReply(uint8_t* data, size_t size, int64_t& num_bytes) {
 // Get messages.
 
 Status SendGetRequest(int sock, const ObjectID* object_ids, int64_t num_objects,
-                      int64_t timeout_ms) {
+                      int64_t timeout_ms, int64_t request_id) {
   flatbuffers::FlatBufferBuilder fbb;
   auto message = fb::CreatePlasmaGetRequest(
-      fbb, ToFlatbuffer(&fbb, object_ids, num_objects), timeout_ms);
+      fbb, ToFlatbuffer(&fbb, object_ids, num_objects), timeout_ms, request_id);
   return PlasmaSend(sock, MessageType::PlasmaGetRequest, &fbb, message);
 }
 
 Status ReadGetRequest(uint8_t* data, size_t size, std::vector<ObjectID>& object_ids,
-                      int64_t* timeout_ms) {
+                      int64_t* timeout_ms, int64_t* request_id) {
   DCHECK(data);
   auto message = flatbuffers::GetRoot<fb::PlasmaGetRequest>(data);
   DCHECK(VerifyFlatbuffer(message, data, size));
@@ -484,13 +819,16 @@ Status ReadGetRequest(uint8_t* data, size_t size, std::vector<ObjectID>& object_
     object_ids.push_back(ObjectID::from_binary(object_id));
   }
   *timeout_ms = message->timeout_ms();
+  if (request_id != nullptr) {
+    *request_id = message->request_id();
+  }
   return Status::OK();
 }
 
 Status SendGetReply(int sock, ObjectID object_ids[],
                     std::unordered_map<ObjectID, PlasmaObject>& plasma_objects,
                     int64_t num_objects, const std::vector<int>& store_fds,
-                    const std::vector<int64_t>& mmap_sizes) {
+                    const std::vector<int64_t>& mmap_sizes, int64_t request_id) {
   flatbuffers::FlatBufferBuilder fbb;
   std::vector<PlasmaObjectSpec> objects;
 
@@ -512,10 +850,20 @@ Status SendGetReply(int sock, ObjectID object_ids[],
   auto message = fb::CreatePlasmaGetReply(
       fbb, ToFlatbuffer(&fbb, object_ids, num_objects),
       fbb.CreateVectorOfStructs(objects.data(), num_objects), fbb.CreateVector(store_fds),
-      fbb.CreateVector(mmap_sizes), fbb.CreateVector(handles));
+      fbb.CreateVector(mmap_sizes), fbb.CreateVector(handles), request_id);
   return PlasmaSend(sock, MessageType::PlasmaGetReply, &fbb, message);
 }
 
+Status ReadGetReplyHeader(uint8_t* data, size_t size, int64_t* request_id,
+                          int64_t* num_objects) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<fb::PlasmaGetReply>(data);
+  DCHECK(VerifyFlatbuffer(message, data, size));
+  *request_id = message->request_id();
+  *num_objects = message->object_ids()->size();
+  return Status::OK();
+}
+
 Status ReadGetReply(uint8_t* data, size_t size, ObjectID object_ids[],
                     PlasmaObject plasma_objects[], int64_t num_objects,
                     std::vector<int>& store_fds, std::vector<int64_t>& mmap_sizes) {
@@ -650,6 +998,14 @@ Status SendSubscribeRequest(int sock) {
   return PlasmaSend(sock, MessageType::PlasmaSubscribeRequest, &fbb, message);
 }
 
+// ConnectAsync messages.
+
+Status SendConnectAsyncRequest(int sock) {
+  flatbuffers::FlatBufferBuilder fbb;
+  auto message = fb::CreatePlasmaConnectAsyncRequest(fbb);
+  return PlasmaSend(sock, MessageType::PlasmaConnectAsyncRequest, &fbb, message);
+}
+
 // Data messages.
 
 Status SendDataRequest(int sock, ObjectID object_id, const char* address, int port) {
@@ -19,6 +19,7 @@
 #define PLASMA_PROTOCOL_H
 
 #include <memory>
+#include <string>
 #include <unordered_map>
 #include <vector>
 
@@ -57,6 +58,25 @@ Status SendCreateReply(int sock, ObjectID object_id, PlasmaObject* object,
 Status ReadCreateReply(uint8_t* data, size_t size, ObjectID* object_id,
                        PlasmaObject* object, int* store_fd, int64_t* mmap_size);
 
+Status SendCreateBatchRequest(int sock, const std::vector<ObjectID>& object_ids,
+                              const std::vector<int64_t>& data_sizes,
+                              const std::vector<int64_t>& metadata_sizes);
+
+Status ReadCreateBatchRequest(uint8_t* data, size_t size,
+                              std::vector<ObjectID>* object_ids,
+                              std::vector<int64_t>* data_sizes,
+                              std::vector<int64_t>* metadata_sizes);
+
+Status SendCreateBatchReply(int sock, const std::vector<ObjectID>& object_ids,
+                            const std::vector<PlasmaObject>& objects, PlasmaError error,
+                            const std::vector<int>& store_fds,
+                            const std::vector<int64_t>& mmap_sizes);
+
+Status ReadCreateBatchReply(uint8_t* data, size_t size, std::vector<ObjectID>* object_ids,
+                            std::vector<PlasmaObject>* objects,
+                            std::vector<int>* store_fds,
+                            std::vector<int64_t>* mmap_sizes);
+
 Status SendAbortRequest(int sock, ObjectID object_id);
 
 Status ReadAbortRequest(uint8_t* data, size_t size, ObjectID* object_id);
@@ -76,18 +96,29 @@ Status SendSealReply(int sock, ObjectID object_id, PlasmaError error);
 
 Status ReadSealReply(uint8_t* data, size_t size, ObjectID* object_id);
 
+Status SendSealBatchRequest(int sock, const std::vector<ObjectID>& object_ids,
+                            const std::vector<std::string>& digests);
+
+Status ReadSealBatchRequest(uint8_t* data, size_t size, std::vector<ObjectID>* object_ids,
+                            std::vector<std::string>* digests);
+
 /* Plasma Get message functions. */
 
 Status SendGetRequest(int sock, const ObjectID* object_ids, int64_t num_objects,
-                      int64_t timeout_ms);
+                      int64_t timeout_ms, int64_t request_id = 0);
 
 Status ReadGetRequest(uint8_t* data, size_t size, std::vector<ObjectID>& object_ids,
-                      int64_t* timeout_ms);
+                      int64_t* timeout_ms, int64_t* request_id = nullptr);
 
 Status SendGetReply(int sock, ObjectID object_ids[],
                     std::unordered_map<ObjectID, PlasmaObject>& plasma_objects,
                     int64_t num_objects, const std::vector<int>& store_fds,
-                    const std::vector<int64_t>& mmap_sizes);
+                    const std::vector<int64_t>& mmap_sizes, int64_t request_id = 0);
+
+/// Read the ID of the asynchronous request that a get reply is for, and the
+/// number of its objects, to read the rest of the reply with.
+Status ReadGetReplyHeader(uint8_t* data, size_t size, int64_t* request_id,
+                          int64_t* num_objects);
 
 Status ReadGetReply(uint8_t* data, size_t size, ObjectID object_ids[],
                     PlasmaObject plasma_objects[], int64_t num_objects,
@@ -103,6 +134,11 @@ Status SendReleaseReply(int sock, ObjectID object_id, PlasmaError error);
 
 Status ReadReleaseReply(uint8_t* data, size_t size, ObjectID* object_id);
 
+Status SendReleaseBatchRequest(int sock, const std::vector<ObjectID>& object_ids);
+
+Status ReadReleaseBatchRequest(uint8_t* data, size_t size,
+                               std::vector<ObjectID>* object_ids);
+
 /* Plasma Delete objects message functions. */
 
 Status SendDeleteRequest(int sock, const std::vector<ObjectID>& object_ids);
@@ -151,6 +187,60 @@ Status SendConnectReply(int sock, int64_t memory_capacity);
 
 Status ReadConnectReply(uint8_t* data, size_t size, int64_t* memory_capacity);
 
+/* Plasma ReleaseRing message functions. */
+
+Status SendReleaseRingRequest(int sock, int64_t capacity);
+
+Status ReadReleaseRingRequest(uint8_t* data, size_t size, int64_t* capacity);
+
+Status SendReleaseRingReply(int sock, bool accepted);
+
+Status ReadReleaseRingReply(uint8_t* data, size_t size, bool* accepted);
+
+/* Plasma SetOptions message functions. */
+
+Status SendSetOptionsRequest(int sock, const std::string& client_name,
+                             int64_t output_memory_quota);
+
+Status ReadSetOptionsRequest(uint8_t* data, size_t size, std::string* client_name,
+                             int64_t* output_memory_quota);
+
+Status SendSetOptionsReply(int sock, PlasmaError error);
+
+Status ReadSetOptionsReply(uint8_t* data, size_t size);
+
+/* Plasma QuotaStats message functions. */
+
+Status SendQuotaStatsRequest(int sock);
+
+Status ReadQuotaStatsRequest(uint8_t* data, size_t size);
+
+Status SendQuotaStatsReply(int sock, const std::vector<QuotaStats>& stats);
+
+Status ReadQuotaStatsReply(uint8_t* data, size_t size, std::vector<QuotaStats>* stats);
+
+/* Plasma StoreStats message functions. */
+
+Status SendStoreStatsRequest(int sock);
+
+Status ReadStoreStatsRequest(uint8_t* data, size_t size);
+
+Status SendStoreStatsReply(int sock, const PlasmaStoreStats& stats);
+
+Status ReadStoreStatsReply(uint8_t* data, size_t size, PlasmaStoreStats* stats);
+
+/* Plasma Reserve message functions. */
+
+Status SendReserveRequest(int sock, int64_t data_size, int64_t metadata_size,
+                          int64_t count);
+
+Status ReadReserveRequest(uint8_t* data, size_t size, int64_t* data_size,
+                          int64_t* metadata_size, int64_t* count);
+
+Status SendReserveReply(int sock, int64_t num_reserved);
+
+Status ReadReserveReply(uint8_t* data, size_t size, int64_t* num_reserved);
+
 /* Plasma Evict message functions (no reply so far). */
 
 Status SendEvictRequest(int sock, int64_t num_bytes);
@@ -185,6 +275,10 @@ Status ReadWaitReply(uint8_t* data, size_t size, ObjectRequest object_requests[]
 
 Status SendSubscribeRequest(int sock);
 
+/* Plasma ConnectAsync message functions. */
+
+Status SendConnectAsyncRequest(int sock);
+
 /* Data messages. */
 
 Status SendDataRequest(int sock, ObjectID object_id, const char* address, int port);
@@ -0,0 +1,127 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "plasma/ring.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cstring>
+#include <string>
+
+namespace plasma {
+
+static_assert(ATOMIC_LLONG_LOCK_FREE == 2,
+              "the positions of the ring must be lock-free to be shared by processes");
+
+// The positions of the ring, which only grow, each on a cache line of its own
+// as each is written by one side.
+struct ReleaseRing::Header {
+  /// The position of the next object ID to take, written by the store.
+  alignas(64) std::atomic<int64_t> head;
+  /// The position of the next object ID to add, written by the client.
+  alignas(64) std::atomic<int64_t> tail;
+};
+
+ReleaseRing::ReleaseRing(int fd, uint8_t* memory, int64_t capacity)
+    : fd_(fd),
+      memory_(memory),
+      capacity_(capacity),
+      header_(reinterpret_cast<Header*>(memory)),
+      object_ids_(reinterpret_cast<ObjectID*>(memory + sizeof(Header))) {}
+
+ReleaseRing::~ReleaseRing() {
+  munmap(memory_, GetSize(capacity_));
+  close(fd_);
+}
+
+int64_t ReleaseRing::GetSize(int64_t capacity) {
+  return static_cast<int64_t>(sizeof(Header)) +
+         capacity * static_cast<int64_t>(sizeof(ObjectID));
+}
+
+Status ReleaseRing::Create(int64_t capacity, std::unique_ptr<ReleaseRing>* out) {
+  if (capacity <= 0) {
+    return Status::Invalid("The capacity of a release ring must be positive");
+  }
+  // The file only needs a name until it is opened.
+  static std::atomic<int> counter(0);
+  std::string name = "/plasma-ring-" + std::to_string(getpid()) + "-" +
+                     std::to_string(counter++);
+  int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+  if (fd < 0) {
+    return Status::IOError("Failed to create the shared memory of a release ring");
+  }
+  shm_unlink(name.c_str());
+  const int64_t size = GetSize(capacity);
+  if (ftruncate(fd, static_cast<off_t>(size)) != 0) {
+    close(fd);
+    return Status::IOError("Failed to size the shared memory of a release ring");
+  }
+  void* memory = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if (memory == MAP_FAILED) {
+    close(fd);
+    return Status::IOError("Failed to map the shared memory of a release ring");
+  }
+  // A new file is zeroed, which are the positions of an empty ring.
+  out->reset(new ReleaseRing(fd, reinterpret_cast<uint8_t*>(memory), capacity));
+  return Status::OK();
+}
+
+Status ReleaseRing::Open(int fd, int64_t capacity, std::unique_ptr<ReleaseRing>* out) {
+  struct stat file_stats;
+  if (capacity <= 0 || fstat(fd, &file_stats) != 0 ||
+      static_cast<int64_t>(file_stats.st_size) != GetSize(capacity)) {
+    close(fd);
+    return Status::Invalid("The file of a release ring does not match its capacity");
+  }
+  void* memory = mmap(NULL, GetSize(capacity), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if (memory == MAP_FAILED) {
+    close(fd);
+    return Status::IOError("Failed to map the shared memory of a release ring");
+  }
+  out->reset(new ReleaseRing(fd, reinterpret_cast<uint8_t*>(memory), capacity));
+  return Status::OK();
+}
+
+bool ReleaseRing::Push(const ObjectID& object_id) {
+  const int64_t tail = header_->tail.load(std::memory_order_relaxed);
+  if (tail - header_->head.load(std::memory_order_acquire) >= capacity_) {
+    return false;
+  }
+  memcpy(&object_ids_[tail % capacity_], &object_id, sizeof(ObjectID));
+  header_->tail.store(tail + 1, std::memory_order_release);
+  return true;
+}
+
+bool ReleaseRing::Pop(ObjectID* object_id) {
+  const int64_t head = header_->head.load(std::memory_order_relaxed);
+  const int64_t tail = header_->tail.load(std::memory_order_acquire);
+  // The client may write anything in the shared memory, so the positions it
+  // writes are not trusted to be in bounds.
+  if (tail - head <= 0 || tail - head > capacity_) {
+    return false;
+  }
+  memcpy(object_id, &object_ids_[head % capacity_], sizeof(ObjectID));
+  header_->head.store(head + 1, std::memory_order_release);
+  return true;
+}
+
+}  // namespace plasma
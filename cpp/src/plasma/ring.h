@@ -0,0 +1,87 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef PLASMA_RING_H
+#define PLASMA_RING_H
+
+#include <cstdint>
+#include <memory>
+
+#include "arrow/status.h"
+#include "plasma/common.h"
+
+namespace plasma {
+
+using arrow::Status;
+
+/// A ring of object IDs that a client releases, in memory that it shares with
+/// the store. The client adds the IDs and the store takes them without any
+/// system call or message, as the ring is lock-free for a single producer and
+/// a single consumer.
+class ReleaseRing {
+ public:
+  ~ReleaseRing();
+
+  /// Create a ring in a new shared memory file, for the client.
+  ///
+  /// @param capacity The number of object IDs that the ring holds.
+  /// @param out The ring.
+  /// @return The return status.
+  static Status Create(int64_t capacity, std::unique_ptr<ReleaseRing>* out);
+
+  /// Map the ring that a client created, for the store. The file descriptor
+  /// is owned by the ring.
+  ///
+  /// @param fd The file descriptor of the ring, sent by the client.
+  /// @param capacity The capacity that the client asked for, which the file
+  ///        must match.
+  /// @param out The ring.
+  /// @return The return status.
+  static Status Open(int fd, int64_t capacity, std::unique_ptr<ReleaseRing>* out);
+
+  /// The file descriptor of the shared memory of the ring.
+  int fd() const { return fd_; }
+
+  int64_t capacity() const { return capacity_; }
+
+  /// Add an object ID to the ring, on the client.
+  ///
+  /// @return False if the ring is full.
+  bool Push(const ObjectID& object_id);
+
+  /// Take the oldest object ID of the ring, on the store.
+  ///
+  /// @return False if the ring is empty.
+  bool Pop(ObjectID* object_id);
+
+ private:
+  struct Header;
+
+  ReleaseRing(int fd, uint8_t* memory, int64_t capacity);
+
+  static int64_t GetSize(int64_t capacity);
+
+  int fd_;
+  uint8_t* memory_;
+  int64_t capacity_;
+  Header* header_;
+  ObjectID* object_ids_;
+};
+
+}  // namespace plasma
+
+#endif  // PLASMA_RING_H
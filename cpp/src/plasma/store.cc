@@ -19,12 +19,13 @@
 //
 // It accepts incoming client connections on a unix domain socket
 // (name passed in via the -s option of the executable) and uses a
-// single thread to serve the clients. Each client establishes a
-// connection and can create objects, wait for objects and seal
-// objects through that connection.
+// single thread to serve the clients, or as many as the -t option
+// asks for. Each client establishes a connection and can create
+// objects, wait for objects and seal objects through that connection.
 //
 // It keeps a hash table that maps object_ids (which are 20 byte long,
-// just enough to store and SHA1 hash) to memory mapped files.
+// just enough to store and SHA1 hash) to memory mapped files. With
+// several threads, the table is split into a shard for each.
 
 #include "plasma/store.h"
 
@@ -43,8 +44,14 @@
 #include <sys/un.h>
 #include <unistd.h>
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
 #include <deque>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
@@ -77,7 +84,10 @@ size_t dlmalloc_set_footprint_limit(size_t bytes);
 }
 
 struct GetRequest {
-  GetRequest(Client* client, const std::vector<ObjectID>& object_ids);
+  GetRequest(int64_t id, Client* client, const std::vector<ObjectID>& object_ids);
+  /// The ID of the request among those of the loop of the client, by which
+  /// the shards refer to it.
+  int64_t id;
   /// The client that called get.
   Client* client;
   /// The ID of the timer that will time out and cause this wait to return to
@@ -93,29 +103,172 @@ struct GetRequest {
   /// The number of object requests in this wait request that are already
   /// satisfied.
   int64_t num_satisfied;
+  /// The ID that the client gave the request if it is asynchronous, or 0.
+  int64_t async_id;
 };
 
-GetRequest::GetRequest(Client* client, const std::vector<ObjectID>& object_ids)
-    : client(client),
+GetRequest::GetRequest(int64_t id, Client* client,
+                       const std::vector<ObjectID>& object_ids)
+    : id(id),
+      client(client),
       timer(-1),
       object_ids(object_ids.begin(), object_ids.end()),
       objects(object_ids.size()),
-      num_satisfied(0) {
+      num_satisfied(0),
+      async_id(0) {
   std::unordered_set<ObjectID> unique_ids(object_ids.begin(), object_ids.end());
   num_objects_to_wait_for = unique_ids.size();
 }
 
-Client::Client(int fd) : fd(fd), notification_fd(-1) {}
+/// A get request waiting for an object to be sealed.
+struct GetWaiter {
+  /// The index of the loop of the client that made the request.
+  int loop;
+  /// The ID of the request in the loop.
+  int64_t request_id;
+};
+
+/// The objects whose ID falls in a shard of the object table, and the state
+/// of the store about them. The fields are guarded by the mutex.
+struct ObjectShard {
+  std::mutex mutex;
+  /// The objects of the shard.
+  ObjectTable objects;
+  /// A hash table mapping object IDs to a vector of the get requests that are
+  /// waiting for the object to arrive.
+  std::unordered_map<ObjectID, std::vector<GetWaiter>> get_requests;
+  /// The objects to delete once they are sealed and no longer used.
+  std::unordered_set<ObjectID> deletion_cache;
+};
+
+/// An event loop of the store and the clients it handles, which only its
+/// thread accesses.
+constexpr int kNumMessageTypes = static_cast<int>(fb::MessageType::MAX) + 1;
+
+/// Add to a counter that a single thread writes, and that others may read,
+/// without the cost of an atomic read-modify-write.
+void AddToCounter(std::atomic<int64_t>* counter, int64_t value) {
+  counter->store(counter->load(std::memory_order_relaxed) + value,
+                 std::memory_order_relaxed);
+}
+
+/// The requests of a type that a loop handled.
+struct MessageCounters {
+  MessageCounters() : count(0), total_micros(0), max_micros(0) {}
+
+  std::atomic<int64_t> count;
+  std::atomic<int64_t> total_micros;
+  std::atomic<int64_t> max_micros;
+};
+
+struct ClientLoop {
+  explicit ClientLoop(EventLoop* loop)
+      : loop(loop),
+        next_get_request_id(0),
+        release_ring_timer(-1),
+        get_hits(0),
+        get_misses(0),
+        num_get_requests(0) {}
+
+  EventLoop* loop;
+  /// The clients of the loop, by file descriptor.
+  std::unordered_map<int, std::unique_ptr<Client>> clients;
+  /// The get requests of the clients that have not returned yet, by ID.
+  std::unordered_map<int64_t, GetRequest*> get_requests;
+  int64_t next_get_request_id;
+  /// Input buffer. This is allocated only once to avoid mallocs for every
+  /// call to process_message.
+  std::vector<uint8_t> input_buffer;
+  /// The objects that the eviction policy chose to evict while the loop held
+  /// the lock of a shard, which are deleted once it is released.
+  std::vector<ObjectID> objects_to_evict;
+  /// The timer polling the release rings of the clients, or -1 if none of
+  /// them shares one.
+  int64_t release_ring_timer;
+  /// The counters of the loop, which only it writes, for GetStats.
+  std::array<MessageCounters, kNumMessageTypes> message_counters;
+  std::atomic<int64_t> get_hits;
+  std::atomic<int64_t> get_misses;
+  /// The size of get_requests.
+  std::atomic<int64_t> num_get_requests;
+};
+
+/// How often the release rings of the clients are polled, in milliseconds,
+/// for those that send no other request.
+constexpr int64_t kReleaseRingPollMs = 10;
+
+/// How many objects are written to or read from the external store at once.
+constexpr int kExternalStoreThreads = 4;
+
+/// The largest number of notifications in a message to a subscriber, unless
+/// the store is told otherwise.
+constexpr int64_t kDefaultNotificationBatchSize = 1024;
+
+/// How many chunks of objects are sent, and received, at once by the transfer
+/// service.
+constexpr int kTransferThreads = 4;
+
+#ifdef PLASMA_GPU
+/// The size of the blocks that the objects on a GPU are sub-allocated from,
+/// each of which the clients open a single IPC handle for.
+constexpr int64_t kGpuBlockSize = 256 * 1024 * 1024;
+#endif
+
+Client::Client(int fd, int loop)
+    : fd(fd), loop(loop), notification_fd(-1), async_fd(-1) {}
 
 PlasmaStore::PlasmaStore(EventLoop* loop, int64_t system_memory, std::string directory,
-                         bool hugepages_enabled)
-    : loop_(loop), eviction_policy_(&store_info_) {
+                         bool hugepages_enabled, const std::string& eviction_policy,
+                         const std::string& external_store_directory)
+    : PlasmaStore(std::vector<EventLoop*>{loop}, system_memory, directory,
+                  hugepages_enabled, eviction_policy, external_store_directory) {}
+
+PlasmaStore::PlasmaStore(const std::vector<EventLoop*>& loops, int64_t system_memory,
+                         std::string directory, bool hugepages_enabled,
+                         const std::string& eviction_policy,
+                         const std::string& external_store_directory)
+    : num_evicted_(0),
+      bytes_evicted_(0),
+      num_spilled_(0),
+      num_restored_(0),
+      next_loop_(0),
+      notification_batch_size_(kDefaultNotificationBatchSize),
+      notifications_scheduled_(false),
+      transfer_client_(-1, 0) {
+  ARROW_CHECK(!loops.empty());
+  ARROW_CHECK_OK(EvictionPolicy::Make(eviction_policy, &store_info_, &eviction_policy_));
+  if (!external_store_directory.empty()) {
+    ARROW_CHECK_OK(ExternalStore::Open(external_store_directory, kExternalStoreThreads,
+                                       &external_store_));
+  }
+  for (EventLoop* loop : loops) {
+    loops_.emplace_back(new ClientLoop(loop));
+    shards_.emplace_back(new ObjectShard());
+  }
   store_info_.memory_capacity = system_memory;
   store_info_.directory = directory;
   store_info_.hugepages_enabled = hugepages_enabled;
 #ifdef PLASMA_GPU
   DCHECK_OK(CudaDeviceManager::GetInstance(&manager_));
 #endif
+
+  const int64_t expiry_period_ms = eviction_policy_->expiry_period_ms();
+  if (expiry_period_ms > 0) {
+    loops[0]->AddTimer(expiry_period_ms, [this, expiry_period_ms](int64_t timer_id) {
+      std::vector<ObjectID> objects_to_evict;
+      {
+        std::lock_guard<std::mutex> lock(memory_mutex_);
+        eviction_policy_->ChooseExpiredObjects(&objects_to_evict);
+        evicted_objects_.insert(objects_to_evict.begin(), objects_to_evict.end());
+      }
+      if (!objects_to_evict.empty()) {
+        ARROW_LOG(DEBUG) << "evicting " << objects_to_evict.size()
+                         << " expired objects";
+      }
+      DeleteObjects(objects_to_evict);
+      return static_cast<int>(expiry_period_ms);
+    });
+  }
 }
 
 // TODO(pcm): Get rid of this destructor by using RAII to clean up data.
@@ -123,86 +276,174 @@ PlasmaStore::~PlasmaStore() {}
 
 const PlasmaStoreInfo* PlasmaStore::GetPlasmaStoreInfo() { return &store_info_; }
 
+void PlasmaStore::RunOnLoop(int loop, const std::function<void()>& callback) {
+  if (loops_.size() == 1) {
+    callback();
+  } else {
+    loops_[loop]->loop->Post(callback);
+  }
+}
+
+ObjectShard& PlasmaStore::GetShard(const ObjectID& object_id) {
+  return *shards_[object_id.hash() % shards_.size()];
+}
+
+// Record that the eviction policy chose objects to evict, which the loop of
+// the client deletes once it no longer holds the lock of a shard. This must be
+// called with the memory mutex held.
+void PlasmaStore::MarkEvicted(const std::vector<ObjectID>& object_ids,
+                              Client* client) {
+  evicted_objects_.insert(object_ids.begin(), object_ids.end());
+  auto& objects_to_evict = loops_[client->loop]->objects_to_evict;
+  objects_to_evict.insert(objects_to_evict.end(), object_ids.begin(), object_ids.end());
+}
+
+void PlasmaStore::DeleteEvictedObjects(ClientLoop* client_loop) {
+  std::vector<ObjectID> object_ids;
+  object_ids.swap(client_loop->objects_to_evict);
+  DeleteObjects(object_ids);
+}
+
+// Remove an object from its shard, whose lock must be held, and free its
+// memory.
+void PlasmaStore::EraseObject(ObjectShard* shard, const ObjectID& object_id) {
+  {
+    std::lock_guard<std::mutex> lock(memory_mutex_);
+    shard->objects.erase(object_id);
+  }
+  // Inform all subscribers that the object has been deleted.
+  fb::ObjectInfoT notification;
+  notification.object_id = object_id.binary();
+  notification.is_deletion = true;
+  PushNotification(&notification);
+}
+
 // If this client is not already using the object, add the client to the
-// object's list of clients, otherwise do nothing.
-void PlasmaStore::AddToClientObjectIds(ObjectTableEntry* entry, Client* client) {
+// object's list of clients, otherwise do nothing. This must be called with
+// the lock of the shard of the object held. Return false if the object cannot
+// be used, because it is being evicted.
+bool PlasmaStore::AddToClientObjectIds(ObjectTableEntry* entry, Client* client) {
   // Check if this client is already using the object.
   if (client->object_ids.find(entry->object_id) != client->object_ids.end()) {
-    return;
+    return true;
   }
   // If there are no other clients using this object, notify the eviction policy
   // that the object is being used.
   if (entry->ref_count == 0) {
+    std::lock_guard<std::mutex> lock(memory_mutex_);
+    if (evicted_objects_.count(entry->object_id) != 0) {
+      return false;
+    }
     // Tell the eviction policy that this object is being used.
     std::vector<ObjectID> objects_to_evict;
-    eviction_policy_.BeginObjectAccess(entry->object_id, &objects_to_evict);
-    DeleteObjects(objects_to_evict);
+    eviction_policy_->BeginObjectAccess(entry->object_id, &objects_to_evict);
+    MarkEvicted(objects_to_evict, client);
   }
   // Increase reference count.
   entry->ref_count++;
 
   // Add object id to the list of object ids that this client is using.
   client->object_ids.insert(entry->object_id);
+  return true;
 }
 
-// Create a new object buffer in the hash table.
 PlasmaError PlasmaStore::CreateObject(const ObjectID& object_id, int64_t data_size,
                                       int64_t metadata_size, int device_num,
                                       Client* client, PlasmaObject* result) {
-  ARROW_LOG(DEBUG) << "creating object " << object_id.hex();
-  if (store_info_.objects.count(object_id) != 0) {
-    // There is already an object with the same ID in the Plasma Store, so
-    // ignore this requst.
+  if (external_store_ != nullptr && external_store_->Contains(object_id)) {
+    // The object was evicted, and is restored when it is gotten.
     return PlasmaError::ObjectExists;
   }
-  // Try to evict objects until there is enough space.
+  return AllocateObject(object_id, data_size, metadata_size, device_num, client, result);
+}
+
+// Create a new object buffer in the hash table.
+PlasmaError PlasmaStore::AllocateObject(const ObjectID& object_id, int64_t data_size,
+                                        int64_t metadata_size, int device_num,
+                                        Client* client, PlasmaObject* result) {
+  ARROW_LOG(DEBUG) << "creating object " << object_id.hex();
+  ObjectShard& shard = GetShard(object_id);
+  {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    if (shard.objects.count(object_id) != 0) {
+      // There is already an object with the same ID in the Plasma Store, so
+      // ignore this requst.
+      return PlasmaError::ObjectExists;
+    }
+  }
+  // Try to evict objects until there is enough space. The lock of the shard is
+  // not held meanwhile, so that the objects evicted can be deleted from theirs.
   uint8_t* pointer = nullptr;
+  int fd = -1;
+  int64_t map_size = 0;
+  ptrdiff_t offset = 0;
 #ifdef PLASMA_GPU
-  std::shared_ptr<CudaBuffer> gpu_handle;
-  std::shared_ptr<CudaContext> context_;
-  if (device_num != 0) {
-    DCHECK_OK(manager_->GetContext(device_num - 1, &context_));
-  }
+  std::unique_ptr<GpuAllocation> gpu_allocation;
 #endif
+  if (device_num == 0 && !client->name.empty()) {
+    // Make room for the object within the quota of the client first.
+    std::vector<ObjectID> objects_to_evict;
+    bool within_quota;
+    {
+      std::lock_guard<std::mutex> lock(memory_mutex_);
+      within_quota = eviction_policy_->EnforceQuota(
+          client->name, data_size + metadata_size, &objects_to_evict);
+      evicted_objects_.insert(objects_to_evict.begin(), objects_to_evict.end());
+    }
+    DeleteObjects(objects_to_evict);
+    if (!within_quota) {
+      return PlasmaError::OutOfMemory;
+    }
+  }
   while (true) {
-    // Allocate space for the new object. We use dlmemalign instead of dlmalloc
-    // in order to align the allocated region to a 64-byte boundary. This is not
-    // strictly necessary, but it is an optimization that could speed up the
-    // computation of a hash of the data (see compute_object_hash_parallel in
-    // plasma_client.cc). Note that even though this pointer is 64-byte aligned,
-    // it is not guaranteed that the corresponding pointer in the client will be
+    // Allocate space for the new object, aligned to a 64-byte boundary. This is
+    // not strictly necessary, but it is an optimization that could speed up the
+    // computation of a hash of the data (see ComputeObjectHashParallel in
+    // client.cc). Note that even though this pointer is 64-byte aligned, it is
+    // not guaranteed that the corresponding pointer in the client will be
     // 64-byte aligned, but in practice it often will be.
     if (device_num == 0) {
-      pointer =
-          reinterpret_cast<uint8_t*>(dlmemalign(kBlockSize, data_size + metadata_size));
-      if (pointer == nullptr) {
-        // Tell the eviction policy how much space we need to create this object.
-        std::vector<ObjectID> objects_to_evict;
-        bool success =
-            eviction_policy_.RequireSpace(data_size + metadata_size, &objects_to_evict);
-        DeleteObjects(objects_to_evict);
-        // Return an error to the client if not enough space could be freed to
-        // create the object.
-        if (!success) {
-          return PlasmaError::OutOfMemory;
+      std::vector<ObjectID> objects_to_evict;
+      bool success = false;
+      {
+        std::lock_guard<std::mutex> lock(memory_mutex_);
+        pointer = PlasmaAllocate(data_size + metadata_size);
+        if (pointer != nullptr) {
+          GetMallocMapinfo(pointer, &fd, &map_size, &offset);
+          assert(fd != -1);
+          break;
         }
-      } else {
-        break;
+        // Tell the eviction policy how much space we need to create this object.
+        success =
+            eviction_policy_->RequireSpace(data_size + metadata_size, &objects_to_evict);
+        evicted_objects_.insert(objects_to_evict.begin(), objects_to_evict.end());
+      }
+      DeleteObjects(objects_to_evict);
+      // Return an error to the client if not enough space could be freed to
+      // create the object.
+      if (!success) {
+        return PlasmaError::OutOfMemory;
       }
     } else {
 #ifdef PLASMA_GPU
-      DCHECK_OK(context_->Allocate(data_size + metadata_size, &gpu_handle));
+      GpuMemoryPool* pool;
+      {
+        std::lock_guard<std::mutex> lock(memory_mutex_);
+        pool = GetGpuMemoryPool(device_num);
+      }
+      Status s = pool == nullptr
+                     ? Status::Invalid("No such GPU")
+                     : pool->Allocate(data_size + metadata_size, &gpu_allocation);
+      if (!s.ok()) {
+        ARROW_LOG(WARNING) << "Could not create object on device " << device_num
+                           << ": " << s.ToString();
+        return PlasmaError::OutOfMemory;
+      }
+      offset = gpu_allocation->offset();
       break;
 #endif
     }
   }
-  int fd = -1;
-  int64_t map_size = 0;
-  ptrdiff_t offset = 0;
-  if (device_num == 0) {
-    GetMallocMapinfo(pointer, &fd, &map_size, &offset);
-    assert(fd != -1);
-  }
   auto entry = std::unique_ptr<ObjectTableEntry>(new ObjectTableEntry());
   entry->object_id = object_id;
   entry->info.object_id = object_id.binary();
@@ -217,26 +458,62 @@ PlasmaError PlasmaStore::CreateObject(const ObjectID& object_id, int64_t data_si
   entry->device_num = device_num;
 #ifdef PLASMA_GPU
   if (device_num != 0) {
-    DCHECK_OK(gpu_handle->ExportForIpc(&entry->ipc_handle));
+    entry->ipc_handle = gpu_allocation->ipc_handle();
+    entry->gpu_allocation = std::move(gpu_allocation);
     result->ipc_handle = entry->ipc_handle;
   }
 #endif
-  store_info_.objects[object_id] = std::move(entry);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  if (shard.objects.count(object_id) != 0) {
+    // Another client created the object while it was being allocated.
+    std::lock_guard<std::mutex> memory_lock(memory_mutex_);
+    entry.reset();
+    return PlasmaError::ObjectExists;
+  }
+  ObjectTableEntry* created = entry.get();
+  shard.objects[object_id] = std::move(entry);
   result->store_fd = fd;
   result->data_offset = offset;
   result->metadata_offset = offset + data_size;
   result->data_size = data_size;
   result->metadata_size = metadata_size;
   result->device_num = device_num;
-  // Notify the eviction policy that this object was created. This must be done
-  // immediately before the call to AddToClientObjectIds so that the
-  // eviction policy does not have an opportunity to evict the object.
-  eviction_policy_.ObjectCreated(object_id);
+  {
+    // Notify the eviction policy that this object was created and is being
+    // used at once, so that the eviction policy does not have an opportunity
+    // to evict the object.
+    std::lock_guard<std::mutex> memory_lock(memory_mutex_);
+    std::vector<ObjectID> objects_to_evict;
+    eviction_policy_->ObjectCreated(object_id, data_size + metadata_size, client->name);
+    eviction_policy_->BeginObjectAccess(object_id, &objects_to_evict);
+    MarkEvicted(objects_to_evict, client);
+  }
   // Record that this client is using this object.
-  AddToClientObjectIds(store_info_.objects[object_id].get(), client);
+  created->ref_count++;
+  client->object_ids.insert(object_id);
   return PlasmaError::OK;
 }
 
+#ifdef PLASMA_GPU
+GpuMemoryPool* PlasmaStore::GetGpuMemoryPool(int device_num) {
+  if (device_num < 1 || device_num > manager_->num_devices()) {
+    return nullptr;
+  }
+  if (gpu_pools_.size() < static_cast<size_t>(device_num)) {
+    gpu_pools_.resize(device_num);
+  }
+  std::unique_ptr<GpuMemoryPool>& pool = gpu_pools_[device_num - 1];
+  if (pool == nullptr) {
+    std::shared_ptr<CudaContext> context;
+    if (!manager_->GetContext(device_num - 1, &context).ok()) {
+      return nullptr;
+    }
+    pool.reset(new GpuMemoryPool(context, kGpuBlockSize));
+  }
+  return pool.get();
+}
+#endif
+
 void PlasmaObject_init(PlasmaObject* object, ObjectTableEntry* entry) {
   DCHECK(object != nullptr);
   DCHECK(entry != nullptr);
@@ -259,26 +536,33 @@ void PlasmaStore::ReturnFromGet(GetRequest* get_req) {
   std::unordered_set<int> fds_to_send;
   std::vector<int> store_fds;
   std::vector<int64_t> mmap_sizes;
-  for (const auto& object_id : get_req->object_ids) {
-    PlasmaObject& object = get_req->objects[object_id];
-    int fd = object.store_fd;
-    if (object.data_size != -1 && fds_to_send.count(fd) == 0 && fd != -1) {
-      fds_to_send.insert(fd);
-      store_fds.push_back(fd);
-      mmap_sizes.push_back(GetMmapSize(fd));
+  {
+    std::lock_guard<std::mutex> lock(memory_mutex_);
+    for (const auto& object_id : get_req->object_ids) {
+      PlasmaObject& object = get_req->objects[object_id];
+      int fd = object.store_fd;
+      if (object.data_size != -1 && fds_to_send.count(fd) == 0 && fd != -1) {
+        fds_to_send.insert(fd);
+        store_fds.push_back(fd);
+        mmap_sizes.push_back(GetMmapSize(fd));
+      }
     }
   }
 
-  // Send the get reply to the client.
-  Status s = SendGetReply(get_req->client->fd, &get_req->object_ids[0], get_req->objects,
-                          get_req->object_ids.size(), store_fds, mmap_sizes);
-  WarnIfSigpipe(s.ok() ? 0 : -1, get_req->client->fd);
+  // Send the get reply to the client, on the socket of the asynchronous
+  // replies if the request is one.
+  const int client_fd =
+      get_req->async_id != 0 ? get_req->client->async_fd : get_req->client->fd;
+  Status s = SendGetReply(client_fd, &get_req->object_ids[0], get_req->objects,
+                          get_req->object_ids.size(), store_fds, mmap_sizes,
+                          get_req->async_id);
+  WarnIfSigpipe(s.ok() ? 0 : -1, client_fd);
   // If we successfully sent the get reply message to the client, then also send
   // the file descriptors.
   if (s.ok()) {
     // Send all of the file descriptors for the present objects.
     for (int store_fd : store_fds) {
-      int error_code = send_fd(get_req->client->fd, store_fd);
+      int error_code = send_fd(client_fd, store_fd);
       // If we failed to send the file descriptor, loop until we have sent it
       // successfully. TODO(rkn): This is problematic for two reasons. First
       // of all, sending the file descriptor should just succeed without any
@@ -288,93 +572,118 @@ void PlasmaStore::ReturnFromGet(GetRequest* get_req) {
       while (error_code < 0) {
         if (errno == EMSGSIZE) {
           ARROW_LOG(WARNING) << "Failed to send file descriptor, retrying.";
-          error_code = send_fd(get_req->client->fd, store_fd);
+          error_code = send_fd(client_fd, store_fd);
           continue;
         }
-        WarnIfSigpipe(error_code, get_req->client->fd);
+        WarnIfSigpipe(error_code, client_fd);
         break;
       }
     }
   }
+  RemoveGetRequest(get_req);
+}
 
-  // Remove the get request from each of the relevant object_get_requests hash
-  // tables if it is present there. It should only be present there if the get
-  // request timed out.
-  for (ObjectID& object_id : get_req->object_ids) {
-    auto object_request_iter = object_get_requests_.find(object_id);
-    if (object_request_iter != object_get_requests_.end()) {
+void PlasmaStore::RemoveGetRequest(GetRequest* get_req) {
+  ClientLoop& client_loop = *loops_[get_req->client->loop];
+  // Remove the get request from the waiters of the objects that it did not
+  // get, which are there unless one of them was just sealed.
+  for (const auto& object_id : get_req->object_ids) {
+    if (get_req->objects[object_id].data_size != -1) {
+      continue;
+    }
+    ObjectShard& shard = GetShard(object_id);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto object_request_iter = shard.get_requests.find(object_id);
+    if (object_request_iter != shard.get_requests.end()) {
       auto& get_requests = object_request_iter->second;
       // Erase get_req from the vector.
-      auto it = std::find(get_requests.begin(), get_requests.end(), get_req);
-      if (it != get_requests.end()) {
-        get_requests.erase(it);
+      auto it = std::remove_if(get_requests.begin(), get_requests.end(),
+                               [&](const GetWaiter& waiter) {
+                                 return waiter.loop == get_req->client->loop &&
+                                        waiter.request_id == get_req->id;
+                               });
+      get_requests.erase(it, get_requests.end());
+      if (get_requests.empty()) {
+        shard.get_requests.erase(object_request_iter);
       }
     }
   }
   // Remove the get request.
   if (get_req->timer != -1) {
-    ARROW_CHECK(loop_->RemoveTimer(get_req->timer) == AE_OK);
+    ARROW_CHECK(client_loop.loop->RemoveTimer(get_req->timer) == AE_OK);
   }
+  client_loop.get_requests.erase(get_req->id);
+  AddToCounter(&client_loop.num_get_requests, -1);
   delete get_req;
 }
 
-void PlasmaStore::UpdateObjectGetRequests(const ObjectID& object_id) {
-  auto& get_requests = object_get_requests_[object_id];
-  size_t index = 0;
-  size_t num_requests = get_requests.size();
-  for (size_t i = 0; i < num_requests; ++i) {
-    auto get_req = get_requests[index];
-    auto entry = GetObjectTableEntry(&store_info_, object_id);
-    ARROW_CHECK(entry != nullptr);
-
+// Get an object of the store for a get request, or else make the request wait
+// for the object to be sealed. Return true if the request got the object.
+bool PlasmaStore::AddObjectToGetRequest(GetRequest* get_req, const ObjectID& object_id) {
+  auto it = get_req->objects.find(object_id);
+  if (it != get_req->objects.end() && it->second.data_size != -1) {
+    // The object is requested more than once, and already accounted for.
+    return false;
+  }
+  ObjectShard& shard = GetShard(object_id);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  // Check if this object is already present locally. If so, record that the
+  // client is using it, and mark it as accounted for.
+  auto entry = GetObjectTableEntry(&shard.objects, object_id);
+  if (entry && entry->state == ObjectState::PLASMA_SEALED &&
+      AddToClientObjectIds(entry, get_req->client)) {
+    // Update the get request to take into account the present object.
     PlasmaObject_init(&get_req->objects[object_id], entry);
     get_req->num_satisfied += 1;
-    // Record the fact that this client will be using this object and will
-    // be responsible for releasing this object.
-    AddToClientObjectIds(entry, get_req->client);
+    return true;
+  }
+  // Add a placeholder plasma object to the get request to indicate that the
+  // object is not present. This will be parsed by the client. We set the
+  // data size to -1 to indicate that the object is not present.
+  get_req->objects[object_id].data_size = -1;
+  // Add the get request to the relevant data structures.
+  shard.get_requests[object_id].push_back({get_req->client->loop, get_req->id});
+  return false;
+}
 
+// Update a get request of a loop about an object that was sealed, if the
+// request has not returned yet.
+void PlasmaStore::UpdateGetRequest(int loop, int64_t request_id,
+                                   const ObjectID& object_id) {
+  ClientLoop& client_loop = *loops_[loop];
+  auto it = client_loop.get_requests.find(request_id);
+  if (it == client_loop.get_requests.end()) {
+    return;
+  }
+  GetRequest* get_req = it->second;
+  // The object may have been deleted since, in which case the request waits
+  // for it again.
+  if (AddObjectToGetRequest(get_req, object_id) &&
+      get_req->num_satisfied == get_req->num_objects_to_wait_for) {
     // If this get request is done, reply to the client.
-    if (get_req->num_satisfied == get_req->num_objects_to_wait_for) {
-      ReturnFromGet(get_req);
-    } else {
-      // The call to ReturnFromGet will remove the current element in the
-      // array, so we only increment the counter in the else branch.
-      index += 1;
-    }
+    ReturnFromGet(get_req);
   }
-
-  DCHECK(index == get_requests.size());
-  // Remove the array of get requests for this object, since no one should be
-  // waiting for this object anymore.
-  object_get_requests_.erase(object_id);
+  DeleteEvictedObjects(&client_loop);
 }
 
 void PlasmaStore::ProcessGetRequest(Client* client,
                                     const std::vector<ObjectID>& object_ids,
-                                    int64_t timeout_ms) {
+                                    int64_t timeout_ms, int64_t async_id) {
+  ClientLoop& client_loop = *loops_[client->loop];
+  if (external_store_ != nullptr) {
+    RestoreObjects(object_ids, client);
+  }
   // Create a get request for this object.
-  auto get_req = new GetRequest(client, object_ids);
-
-  for (auto object_id : object_ids) {
-    // Check if this object is already present locally. If so, record that the
-    // object is being used and mark it as accounted for.
-    auto entry = GetObjectTableEntry(&store_info_, object_id);
-    if (entry && entry->state == ObjectState::PLASMA_SEALED) {
-      // Update the get request to take into account the present object.
-      PlasmaObject_init(&get_req->objects[object_id], entry);
-      get_req->num_satisfied += 1;
-      // If necessary, record that this client is using this object. In the case
-      // where entry == NULL, this will be called from SealObject.
-      AddToClientObjectIds(entry, client);
-    } else {
-      // Add a placeholder plasma object to the get request to indicate that the
-      // object is not present. This will be parsed by the client. We set the
-      // data size to -1 to indicate that the object is not present.
-      get_req->objects[object_id].data_size = -1;
-      // Add the get request to the relevant data structures.
-      object_get_requests_[object_id].push_back(get_req);
-    }
+  auto get_req = new GetRequest(client_loop.next_get_request_id++, client, object_ids);
+  get_req->async_id = async_id;
+  client_loop.get_requests[get_req->id] = get_req;
+  AddToCounter(&client_loop.num_get_requests, 1);
+
+  for (const auto& object_id : object_ids) {
+    AddObjectToGetRequest(get_req, object_id);
   }
+  AddToCounter(&client_loop.get_hits, get_req->num_satisfied);
+  AddToCounter(&client_loop.get_misses, get_req->objects.size() - get_req->num_satisfied);
 
   // If all of the objects are present already or if the timeout is 0, return to
   // the client.
@@ -383,13 +692,15 @@ void PlasmaStore::ProcessGetRequest(Client* client,
   } else if (timeout_ms != -1) {
     // Set a timer that will cause the get request to return to the client. Note
     // that a timeout of -1 is used to indicate that no timer should be set.
-    get_req->timer = loop_->AddTimer(timeout_ms, [this, get_req](int64_t timer_id) {
-      ReturnFromGet(get_req);
-      return kEventLoopTimerDone;
-    });
+    get_req->timer =
+        client_loop.loop->AddTimer(timeout_ms, [this, get_req](int64_t timer_id) {
+          ReturnFromGet(get_req);
+          return kEventLoopTimerDone;
+        });
   }
 }
 
+// This must be called with the lock of the shard of the object held.
 int PlasmaStore::RemoveFromClientObjectIds(ObjectTableEntry* entry, Client* client) {
   auto it = client->object_ids.find(entry->object_id);
   if (it != client->object_ids.end()) {
@@ -400,16 +711,20 @@ int PlasmaStore::RemoveFromClientObjectIds(ObjectTableEntry* entry, Client* clie
     // If no more clients are using this object, notify the eviction policy
     // that the object is no longer being used.
     if (entry->ref_count == 0) {
-      if (deletion_cache_.count(entry->object_id) == 0) {
+      ObjectShard& shard = GetShard(entry->object_id);
+      if (shard.deletion_cache.count(entry->object_id) == 0) {
         // Tell the eviction policy that this object is no longer being used.
+        std::lock_guard<std::mutex> lock(memory_mutex_);
         std::vector<ObjectID> objects_to_evict;
-        eviction_policy_.EndObjectAccess(entry->object_id, &objects_to_evict);
-        DeleteObjects(objects_to_evict);
+        eviction_policy_->EndObjectAccess(
+            entry->object_id, entry->info.data_size + entry->info.metadata_size,
+            &objects_to_evict);
+        MarkEvicted(objects_to_evict, client);
       } else {
         // Above code does not really delete an object. Instead, it just put an
         // object to LRU cache which will be cleaned when the memory is not enough.
-        deletion_cache_.erase(entry->object_id);
-        DeleteObjects({entry->object_id});
+        shard.deletion_cache.erase(entry->object_id);
+        EraseObject(&shard, entry->object_id);
       }
     }
     // Return 1 to indicate that the client was removed.
@@ -421,7 +736,9 @@ int PlasmaStore::RemoveFromClientObjectIds(ObjectTableEntry* entry, Client* clie
 }
 
 void PlasmaStore::ReleaseObject(const ObjectID& object_id, Client* client) {
-  auto entry = GetObjectTableEntry(&store_info_, object_id);
+  ObjectShard& shard = GetShard(object_id);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  auto entry = GetObjectTableEntry(&shard.objects, object_id);
   ARROW_CHECK(entry != nullptr);
   // Remove the client from the object's array of clients.
   ARROW_CHECK(RemoveFromClientObjectIds(entry, client) == 1);
@@ -429,31 +746,118 @@ void PlasmaStore::ReleaseObject(const ObjectID& object_id, Client* client) {
 
 // Check if an object is present.
 ObjectStatus PlasmaStore::ContainsObject(const ObjectID& object_id) {
-  auto entry = GetObjectTableEntry(&store_info_, object_id);
+  ObjectShard& shard = GetShard(object_id);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  auto entry = GetObjectTableEntry(&shard.objects, object_id);
+  if (entry == nullptr && external_store_ != nullptr &&
+      external_store_->Contains(object_id)) {
+    return ObjectStatus::OBJECT_FOUND;
+  }
   return entry && (entry->state == ObjectState::PLASMA_SEALED)
              ? ObjectStatus::OBJECT_FOUND
              : ObjectStatus::OBJECT_NOT_FOUND;
 }
 
+void PlasmaStore::GetStats(PlasmaStoreStats* stats) {
+  stats->num_objects = 0;
+  for (auto& shard : shards_) {
+    std::lock_guard<std::mutex> lock(shard->mutex);
+    stats->num_objects += shard->objects.size();
+  }
+  stats->memory_capacity = store_info_.memory_capacity;
+  {
+    std::lock_guard<std::mutex> lock(memory_mutex_);
+    stats->memory_used = eviction_policy_->memory_used();
+    GetMallocStats(&stats->footprint, &stats->allocated);
+  }
+  stats->get_hits = 0;
+  stats->get_misses = 0;
+  stats->num_pending_get_requests = 0;
+  std::vector<MessageStats> messages(kNumMessageTypes, MessageStats{"", 0, 0, 0});
+  for (const auto& client_loop : loops_) {
+    stats->get_hits += client_loop->get_hits;
+    stats->get_misses += client_loop->get_misses;
+    stats->num_pending_get_requests += client_loop->num_get_requests;
+    for (int i = 0; i < kNumMessageTypes; ++i) {
+      const MessageCounters& counters = client_loop->message_counters[i];
+      messages[i].count += counters.count;
+      messages[i].total_micros += counters.total_micros;
+      messages[i].max_micros = std::max<int64_t>(messages[i].max_micros,
+                                                 counters.max_micros);
+    }
+  }
+  stats->messages.clear();
+  for (int i = 0; i < kNumMessageTypes; ++i) {
+    if (messages[i].count > 0) {
+      messages[i].type = fb::EnumNameMessageType(static_cast<fb::MessageType>(i));
+      stats->messages.push_back(messages[i]);
+    }
+  }
+  stats->num_evicted = num_evicted_;
+  stats->bytes_evicted = bytes_evicted_;
+  stats->num_spilled = num_spilled_;
+  stats->num_restored = num_restored_;
+}
+
 // Seal an object that has been created in the hash table.
 void PlasmaStore::SealObject(const ObjectID& object_id, unsigned char digest[]) {
   ARROW_LOG(DEBUG) << "sealing object " << object_id.hex();
-  auto entry = GetObjectTableEntry(&store_info_, object_id);
-  ARROW_CHECK(entry != nullptr);
-  ARROW_CHECK(entry->state == ObjectState::PLASMA_CREATED);
-  // Set the state of object to SEALED.
-  entry->state = ObjectState::PLASMA_SEALED;
-  // Set the object digest.
-  entry->info.digest = std::string(reinterpret_cast<char*>(&digest[0]), kDigestSize);
-  // Inform all subscribers that a new object has been sealed.
-  PushNotification(&entry->info);
+  ObjectShard& shard = GetShard(object_id);
+  std::vector<GetWaiter> waiters;
+  {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto entry = GetObjectTableEntry(&shard.objects, object_id);
+    ARROW_CHECK(entry != nullptr);
+    ARROW_CHECK(entry->state == ObjectState::PLASMA_CREATED);
+    // Set the state of object to SEALED.
+    entry->state = ObjectState::PLASMA_SEALED;
+    // Set the object digest.
+    entry->info.digest = std::string(reinterpret_cast<char*>(&digest[0]), kDigestSize);
+    // Inform all subscribers that a new object has been sealed.
+    PushNotification(&entry->info);
+
+    // Take the get requests waiting for this object, since no one should be
+    // waiting for this object anymore.
+    auto it = shard.get_requests.find(object_id);
+    if (it != shard.get_requests.end()) {
+      waiters = std::move(it->second);
+      shard.get_requests.erase(it);
+    }
+  }
+
+  // Update all get requests that involve this object, on the loops of their
+  // clients.
+  for (const auto& waiter : waiters) {
+    RunOnLoop(waiter.loop, [this, waiter, object_id]() {
+      UpdateGetRequest(waiter.loop, waiter.request_id, object_id);
+    });
+  }
+}
 
-  // Update all get requests that involve this object.
-  UpdateObjectGetRequests(object_id);
+PlasmaError PlasmaStore::CreateObjects(const std::vector<ObjectID>& object_ids,
+                                       const std::vector<int64_t>& data_sizes,
+                                       const std::vector<int64_t>& metadata_sizes,
+                                       Client* client,
+                                       std::vector<PlasmaObject>* results) {
+  results->assign(object_ids.size(), PlasmaObject());
+  for (size_t i = 0; i < object_ids.size(); ++i) {
+    PlasmaError error_code = CreateObject(object_ids[i], data_sizes[i],
+                                          metadata_sizes[i], 0, client, &(*results)[i]);
+    if (error_code != PlasmaError::OK) {
+      for (size_t j = 0; j < i; ++j) {
+        ARROW_CHECK(AbortObject(object_ids[j], client) == 1);
+      }
+      results->clear();
+      return error_code;
+    }
+  }
+  return PlasmaError::OK;
 }
 
 int PlasmaStore::AbortObject(const ObjectID& object_id, Client* client) {
-  auto entry = GetObjectTableEntry(&store_info_, object_id);
+  ObjectShard& shard = GetShard(object_id);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  auto entry = GetObjectTableEntry(&shard.objects, object_id);
   ARROW_CHECK(entry != nullptr) << "To abort an object it must be in the object table.";
   ARROW_CHECK(entry->state != ObjectState::PLASMA_SEALED)
       << "To abort an object it must not have been sealed.";
@@ -464,51 +868,135 @@ int PlasmaStore::AbortObject(const ObjectID& object_id, Client* client) {
     return 0;
   } else {
     // The client requesting the abort is the creator. Free the object.
-    store_info_.objects.erase(object_id);
+    std::lock_guard<std::mutex> memory_lock(memory_mutex_);
+    shard.objects.erase(object_id);
     return 1;
   }
 }
 
 PlasmaError PlasmaStore::DeleteObject(ObjectID& object_id) {
-  auto entry = GetObjectTableEntry(&store_info_, object_id);
+  ObjectShard& shard = GetShard(object_id);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  auto entry = GetObjectTableEntry(&shard.objects, object_id);
   // TODO(rkn): This should probably not fail, but should instead throw an
   // error. Maybe we should also support deleting objects that have been
   // created but not sealed.
   if (entry == nullptr) {
-    // To delete an object it must be in the object table.
+    // To delete an object it must be in the object table, or have been
+    // spilled from it.
+    if (external_store_ != nullptr && external_store_->Remove(object_id)) {
+      return PlasmaError::OK;
+    }
     return PlasmaError::ObjectNonexistent;
   }
 
   if (entry->state != ObjectState::PLASMA_SEALED) {
     // To delete an object it must have been sealed.
     // Put it into deletion cache, it will be deleted later.
-    deletion_cache_.emplace(object_id);
+    shard.deletion_cache.emplace(object_id);
     return PlasmaError::ObjectNotSealed;
   }
 
   if (entry->ref_count != 0) {
     // To delete an object, there must be no clients currently using it.
     // Put it into deletion cache, it will be deleted later.
-    deletion_cache_.emplace(object_id);
+    shard.deletion_cache.emplace(object_id);
     return PlasmaError::ObjectInUse;
   }
 
-  eviction_policy_.RemoveObject(object_id);
+  {
+    std::lock_guard<std::mutex> memory_lock(memory_mutex_);
+    if (evicted_objects_.count(object_id) != 0) {
+      // The object is being evicted, and deleted by the thread evicting it,
+      // which must not keep it in the external store.
+      if (external_store_ != nullptr) {
+        shard.deletion_cache.emplace(object_id);
+      }
+      return PlasmaError::OK;
+    }
+    eviction_policy_->RemoveObject(object_id,
+                                  entry->info.data_size + entry->info.metadata_size);
+  }
+  EraseObject(&shard, object_id);
+  return PlasmaError::OK;
+}
 
-  store_info_.objects.erase(object_id);
-  // Inform all subscribers that the object has been deleted.
-  fb::ObjectInfoT notification;
-  notification.object_id = object_id.binary();
-  notification.is_deletion = true;
-  PushNotification(&notification);
+// Write evicted objects of the host to the external store, before their memory
+// is freed. The objects may not be used meanwhile, as they are being evicted.
+void PlasmaStore::SpillObjects(const std::vector<ObjectID>& object_ids) {
+  std::vector<ExternalObject> objects;
+  for (const auto& object_id : object_ids) {
+    ObjectShard& shard = GetShard(object_id);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto entry = GetObjectTableEntry(&shard.objects, object_id);
+    if (entry != nullptr && entry->device_num == 0 &&
+        shard.deletion_cache.count(object_id) == 0) {
+      objects.push_back({object_id, entry->pointer, entry->info.data_size,
+                         entry->info.metadata_size, entry->info.digest});
+    }
+  }
+  // The memory of the objects is reused as soon as they are deleted, so the
+  // writes are waited for.
+  Status s = external_store_->Put(objects);
+  if (s.ok()) {
+    num_spilled_ += objects.size();
+  } else {
+    ARROW_LOG(WARNING) << "Some evicted objects could not be spilled: " << s.ToString();
+  }
+}
 
-  return PlasmaError::OK;
+// Read objects that were spilled to the external store back into objects
+// created by the client, which are sealed once they are all read.
+void PlasmaStore::RestoreObjects(const std::vector<ObjectID>& object_ids,
+                                 Client* client) {
+  std::vector<ExternalObject> objects;
+  for (const auto& object_id : object_ids) {
+    ExternalObject object;
+    if (!external_store_->Contains(object_id, &object)) {
+      continue;
+    }
+    PlasmaObject result;
+    // The object may be restored by another client at the same time, or there
+    // may be no room for it, in which case the get request waits for it.
+    if (AllocateObject(object_id, object.data_size, object.metadata_size, 0, client,
+                       &result) != PlasmaError::OK) {
+      continue;
+    }
+    ObjectShard& shard = GetShard(object_id);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    object.pointer = GetObjectTableEntry(&shard.objects, object_id)->pointer;
+    objects.push_back(object);
+  }
+  if (objects.empty()) {
+    return;
+  }
+  ARROW_LOG(DEBUG) << "restoring " << objects.size() << " spilled objects";
+  Status s = external_store_->Get(objects);
+  for (auto& object : objects) {
+    if (s.ok()) {
+      unsigned char digest[kDigestSize] = {0};
+      std::copy(object.digest.begin(), object.digest.end(), digest);
+      SealObject(object.object_id, digest);
+    } else {
+      ARROW_CHECK(AbortObject(object.object_id, client) == 1);
+    }
+  }
+  if (s.ok()) {
+    num_restored_ += objects.size();
+  } else {
+    ARROW_LOG(WARNING) << "Spilled objects could not be restored: " << s.ToString();
+  }
 }
 
 void PlasmaStore::DeleteObjects(const std::vector<ObjectID>& object_ids) {
+  if (external_store_ != nullptr && !object_ids.empty()) {
+    SpillObjects(object_ids);
+  }
   for (const auto& object_id : object_ids) {
     ARROW_LOG(DEBUG) << "deleting object " << object_id.hex();
-    auto entry = GetObjectTableEntry(&store_info_, object_id);
+    ObjectShard& shard = GetShard(object_id);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto entry = GetObjectTableEntry(&shard.objects, object_id);
     // TODO(rkn): This should probably not fail, but should instead throw an
     // error. Maybe we should also support deleting objects that have been
     // created but not sealed.
@@ -518,84 +1006,114 @@ void PlasmaStore::DeleteObjects(const std::vector<ObjectID>& object_ids) {
         << "To delete an object it must have been sealed.";
     ARROW_CHECK(entry->ref_count == 0)
         << "To delete an object, there must be no clients currently using it.";
-    store_info_.objects.erase(object_id);
-    // Inform all subscribers that the object has been deleted.
-    fb::ObjectInfoT notification;
-    notification.object_id = object_id.binary();
-    notification.is_deletion = true;
-    PushNotification(&notification);
+    {
+      std::lock_guard<std::mutex> memory_lock(memory_mutex_);
+      evicted_objects_.erase(object_id);
+    }
+    if (shard.deletion_cache.erase(object_id) != 0 && external_store_ != nullptr) {
+      external_store_->Remove(object_id);
+    }
+    num_evicted_++;
+    bytes_evicted_ += entry->info.data_size + entry->info.metadata_size;
+    EraseObject(&shard, object_id);
   }
 }
 
 void PlasmaStore::ConnectClient(int listener_sock) {
   int client_fd = AcceptClient(listener_sock);
 
-  Client* client = new Client(client_fd);
-  connected_clients_[client_fd] = std::unique_ptr<Client>(client);
+  // Hand the clients to the loops in turn.
+  Client* client = new Client(client_fd, next_loop_);
+  next_loop_ = (next_loop_ + 1) % static_cast<int>(loops_.size());
 
-  // Add a callback to handle events on this socket.
-  // TODO(pcm): Check return value.
-  loop_->AddFileEvent(client_fd, kEventLoopRead, [this, client](int events) {
-    Status s = ProcessMessage(client);
-    if (!s.ok()) {
-      ARROW_LOG(FATAL) << "Failed to process file event: " << s;
-    }
+  RunOnLoop(client->loop, [this, client]() {
+    ClientLoop& client_loop = *loops_[client->loop];
+    client_loop.clients[client->fd] = std::unique_ptr<Client>(client);
+
+    // Add a callback to handle events on this socket.
+    // TODO(pcm): Check return value.
+    client_loop.loop->AddFileEvent(client->fd, kEventLoopRead,
+                                   [this, client](int events) {
+                                     Status s = ProcessMessage(client);
+                                     if (!s.ok()) {
+                                       ARROW_LOG(FATAL)
+                                           << "Failed to process file event: " << s;
+                                     }
+                                   });
   });
   ARROW_LOG(DEBUG) << "New connection with fd " << client_fd;
 }
 
-void PlasmaStore::DisconnectClient(int client_fd) {
+void PlasmaStore::DisconnectClient(Client* client) {
+  int client_fd = client->fd;
   ARROW_CHECK(client_fd > 0);
-  auto it = connected_clients_.find(client_fd);
-  ARROW_CHECK(it != connected_clients_.end());
-  loop_->RemoveFileEvent(client_fd);
+  ClientLoop& client_loop = *loops_[client->loop];
+  auto it = client_loop.clients.find(client_fd);
+  ARROW_CHECK(it != client_loop.clients.end());
+  client_loop.loop->RemoveFileEvent(client_fd);
   // Close the socket.
   close(client_fd);
   ARROW_LOG(INFO) << "Disconnecting client on fd " << client_fd;
-  // Release all the objects that the client was using.
-  auto client = it->second.get();
-  std::vector<ObjectTableEntry*> sealed_objects;
-  for (const auto& object_id : client->object_ids) {
-    auto it = store_info_.objects.find(object_id);
-    if (it == store_info_.objects.end()) {
+  // Drop the get requests that the client is waiting for.
+  std::vector<GetRequest*> get_requests;
+  for (const auto& request : client_loop.get_requests) {
+    if (request.second->client == client) {
+      get_requests.push_back(request.second);
+    }
+  }
+  for (GetRequest* get_req : get_requests) {
+    RemoveGetRequest(get_req);
+  }
+  // Release all the objects that the client was using. Do not iterate over
+  // the object IDs of the client, since releasing an object removes it.
+  std::vector<ObjectID> object_ids(client->object_ids.begin(),
+                                   client->object_ids.end());
+  for (const auto& object_id : object_ids) {
+    ObjectShard& shard = GetShard(object_id);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto entry = GetObjectTableEntry(&shard.objects, object_id);
+    if (entry == nullptr) {
       continue;
     }
 
-    if (it->second->state == ObjectState::PLASMA_SEALED) {
-      // Add sealed objects to a temporary list of object IDs. Do not perform
-      // the remove here, since it potentially modifies the object_ids table.
-      sealed_objects.push_back(it->second.get());
+    if (entry->state == ObjectState::PLASMA_SEALED) {
+      RemoveFromClientObjectIds(entry, client);
     } else {
       // Abort unsealed object.
-      AbortObject(it->first, client);
+      std::lock_guard<std::mutex> memory_lock(memory_mutex_);
+      shard.objects.erase(object_id);
     }
   }
-
-  for (const auto& entry : sealed_objects) {
-    RemoveFromClientObjectIds(entry, client);
-  }
+  DeleteEvictedObjects(&client_loop);
 
   if (client->notification_fd > 0) {
-    // This client has subscribed for notifications.
+    // This client has subscribed for notifications, which the first loop sends.
     auto notify_fd = client->notification_fd;
-    loop_->RemoveFileEvent(notify_fd);
-    // Close socket.
-    close(notify_fd);
-    // Remove notification queue for this fd from global map.
-    pending_notifications_.erase(notify_fd);
+    RunOnLoop(0, [this, notify_fd]() {
+      loops_[0]->loop->RemoveFileEvent(notify_fd);
+      // Close socket.
+      close(notify_fd);
+      // Remove notification queue for this fd from global map.
+      pending_notifications_.erase(notify_fd);
+    });
     // Reset fd.
     client->notification_fd = -1;
   }
 
-  connected_clients_.erase(it);
+  if (client->async_fd >= 0) {
+    close(client->async_fd);
+    client->async_fd = -1;
+  }
+
+  client_loop.clients.erase(it);
 }
 
-/// Send notifications about sealed objects to the subscribers. This is called
-/// in SealObject. If the socket's send buffer is full, the notification will
-/// be buffered, and this will be called again when the send buffer has room.
-/// Since we call erase on pending_notifications_, all iterators get
-/// invalidated, which is why we return a valid iterator to the next client to
-/// be used in PushNotification.
+/// Send the batches of notifications queued for a subscriber. If the
+/// socket's send buffer is full, the batches are kept, and this will be called
+/// again when the send buffer has room. Since we call erase on
+/// pending_notifications_, all iterators get invalidated, which is why we
+/// return a valid iterator to the next client to be used in
+/// ScheduleNotifications.
 ///
 /// @param it Iterator that points to the client to send the notification to.
 /// @return Iterator pointing to the next client.
@@ -627,9 +1145,11 @@ PlasmaStore::NotificationMap::iterator PlasmaStore::SendNotifications(
       // at the end of the method.
       // TODO(pcm): Introduce status codes and check in case the file descriptor
       // is added twice.
-      loop_->AddFileEvent(client_fd, kEventLoopWrite, [this, client_fd](int events) {
-        SendNotifications(pending_notifications_.find(client_fd));
-      });
+      loops_[0]->loop->AddFileEvent(client_fd, kEventLoopWrite,
+                                    [this, client_fd](int events) {
+                                      SendNotifications(
+                                          pending_notifications_.find(client_fd));
+                                    });
       break;
     } else {
       ARROW_LOG(WARNING) << "Failed to send notification to client on fd " << client_fd;
@@ -645,7 +1165,7 @@ PlasmaStore::NotificationMap::iterator PlasmaStore::SendNotifications(
 
   // If we have sent all notifications, remove the fd from the event loop.
   if (notifications.empty()) {
-    loop_->RemoveFileEvent(client_fd);
+    loops_[0]->loop->RemoveFileEvent(client_fd);
   }
 
   // Stop sending notifications if the pipe was broken.
@@ -657,21 +1177,231 @@ PlasmaStore::NotificationMap::iterator PlasmaStore::SendNotifications(
   }
 }
 
+void PlasmaStore::SetNotificationBatchSize(int64_t batch_size) {
+  ARROW_CHECK(batch_size > 0);
+  notification_batch_size_ = batch_size;
+}
+
 void PlasmaStore::PushNotification(fb::ObjectInfoT* object_info) {
-  auto it = pending_notifications_.begin();
-  while (it != pending_notifications_.end()) {
-    auto notification = CreateObjectInfoBuffer(object_info);
-    it->second.object_notifications.emplace_back(std::move(notification));
-    it = SendNotifications(it);
-  }
+  // The notifications are sent by the first loop, in the order they are pushed.
+  fb::ObjectInfoT info = *object_info;
+  RunOnLoop(0, [this, info]() {
+    for (auto& entry : pending_notifications_) {
+      entry.second.object_infos.push_back(info);
+    }
+    ScheduleNotifications();
+  });
 }
 
 void PlasmaStore::PushNotification(fb::ObjectInfoT* object_info, int client_fd) {
   auto it = pending_notifications_.find(client_fd);
   if (it != pending_notifications_.end()) {
-    auto notification = CreateObjectInfoBuffer(object_info);
-    it->second.object_notifications.emplace_back(std::move(notification));
-    SendNotifications(it);
+    it->second.object_infos.push_back(*object_info);
+    ScheduleNotifications();
+  }
+}
+
+void PlasmaStore::ScheduleNotifications() {
+  if (notifications_scheduled_) {
+    return;
+  }
+  notifications_scheduled_ = true;
+  // The callback runs after the events that the loop is handling, which may
+  // push many more notifications.
+  loops_[0]->loop->Post([this]() {
+    notifications_scheduled_ = false;
+    auto it = pending_notifications_.begin();
+    while (it != pending_notifications_.end()) {
+      auto& object_infos = it->second.object_infos;
+      if (object_infos.empty()) {
+        ++it;
+        continue;
+      }
+      for (size_t i = 0; i < object_infos.size(); i += notification_batch_size_) {
+        int64_t num_objects = std::min<int64_t>(notification_batch_size_,
+                                                object_infos.size() - i);
+        it->second.object_notifications.emplace_back(
+            CreateObjectInfoBatchBuffer(&object_infos[i], num_objects));
+      }
+      object_infos.clear();
+      it = SendNotifications(it);
+    }
+  });
+}
+
+Status PlasmaStore::OpenTransferService(int port) {
+  EventLoop* loop = loops_[0]->loop;
+  return TransferService::Open(
+      port, kTransferThreads,
+      [loop](const std::function<void()>& callback) { loop->Post(callback); },
+      [this](const TransferChunk& chunk) { return BeginTransferChunk(chunk); },
+      [this](const TransferChunk& chunk, bool ok) { EndTransferChunk(chunk, ok); },
+      &transfer_service_);
+}
+
+void PlasmaStore::TransferObject(const ObjectID& object_id, const std::string& address,
+                                 int port) {
+  if (transfer_service_ == nullptr) {
+    Status s = OpenTransferService(-1);
+    if (!s.ok()) {
+      ARROW_LOG(WARNING) << "Failed to start the transfer service: " << s.ToString();
+      return;
+    }
+  }
+  TransferChunk object;
+  const uint8_t* pointer;
+  int fd;
+  int64_t file_offset;
+  {
+    ObjectShard& shard = GetShard(object_id);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto entry = GetObjectTableEntry(&shard.objects, object_id);
+    if (entry == nullptr || entry->state != ObjectState::PLASMA_SEALED ||
+        entry->device_num != 0) {
+      ARROW_LOG(WARNING) << "Object " << object_id.hex()
+                         << " is not sealed in the memory of the host, and cannot be "
+                            "transferred.";
+      return;
+    }
+    // The object is held once for all the transfers that send it at once.
+    int& num_transfers = outgoing_transfers_[object_id];
+    if (num_transfers == 0 && !AddToClientObjectIds(entry, &transfer_client_)) {
+      outgoing_transfers_.erase(object_id);
+      return;
+    }
+    num_transfers += 1;
+    const int64_t size = entry->info.data_size + entry->info.metadata_size;
+    object = {object_id, entry->info.data_size, entry->info.metadata_size,
+              entry->info.digest, 0, size, 1};
+    pointer = entry->pointer;
+    fd = entry->fd;
+    // The memory-mapped files are mapped from their start.
+    file_offset = entry->offset;
+  }
+  DeleteEvictedObjects(loops_[0].get());
+  transfer_service_->Send(
+      address, port, object, pointer, fd, file_offset,
+      [this, object_id, address, port](const Status& s) {
+        if (!s.ok()) {
+          ARROW_LOG(WARNING) << "Failed to transfer object " << object_id.hex()
+                             << " to " << address << ":" << port << ": " << s.ToString();
+        }
+        if (--outgoing_transfers_[object_id] == 0) {
+          outgoing_transfers_.erase(object_id);
+          ReleaseObject(object_id, &transfer_client_);
+          DeleteEvictedObjects(loops_[0].get());
+        }
+      });
+}
+
+uint8_t* PlasmaStore::BeginTransferChunk(const TransferChunk& chunk) {
+  auto it = incoming_transfers_.find(chunk.object_id);
+  if (it == incoming_transfers_.end()) {
+    IncomingTransfer transfer;
+    transfer.pointer = nullptr;
+    transfer.size = chunk.data_size + chunk.metadata_size;
+    transfer.bytes_remaining = transfer.size;
+    transfer.chunks_remaining = chunk.num_chunks;
+    transfer.failed = false;
+    // The chunks of an object that exists already, or that there is no room
+    // for, are all dropped.
+    PlasmaObject result;
+    if (AllocateObject(chunk.object_id, chunk.data_size, chunk.metadata_size, 0,
+                       &transfer_client_, &result) == PlasmaError::OK) {
+      ObjectShard& shard = GetShard(chunk.object_id);
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      transfer.pointer = GetObjectTableEntry(&shard.objects, chunk.object_id)->pointer;
+    }
+    DeleteEvictedObjects(loops_[0].get());
+    it = incoming_transfers_.emplace(chunk.object_id, transfer).first;
+  }
+  const IncomingTransfer& transfer = it->second;
+  if (transfer.pointer == nullptr || chunk.offset + chunk.length > transfer.size) {
+    return nullptr;
+  }
+  return transfer.pointer + chunk.offset;
+}
+
+void PlasmaStore::EndTransferChunk(const TransferChunk& chunk, bool ok) {
+  auto it = incoming_transfers_.find(chunk.object_id);
+  ARROW_CHECK(it != incoming_transfers_.end());
+  IncomingTransfer& transfer = it->second;
+  if (ok) {
+    transfer.bytes_remaining -= chunk.length;
+  } else {
+    transfer.failed = true;
+  }
+  if (--transfer.chunks_remaining > 0) {
+    return;
+  }
+  if (transfer.pointer != nullptr) {
+    if (!transfer.failed && transfer.bytes_remaining == 0) {
+      unsigned char digest[kDigestSize] = {0};
+      std::copy(chunk.digest.begin(), chunk.digest.end(), digest);
+      SealObject(chunk.object_id, digest);
+      ReleaseObject(chunk.object_id, &transfer_client_);
+    } else {
+      ARROW_CHECK(AbortObject(chunk.object_id, &transfer_client_) == 1);
+    }
+    DeleteEvictedObjects(loops_[0].get());
+  }
+  incoming_transfers_.erase(it);
+}
+
+bool PlasmaStore::UseReleaseRing(Client* client, int64_t capacity) {
+  int fd = recv_fd(client->fd);
+  if (fd < 0) {
+    ARROW_LOG(WARNING) << "Failed to receive file descriptor from client on fd "
+                       << client->fd << ".";
+    return false;
+  }
+  std::unique_ptr<ReleaseRing> ring;
+  Status s = ReleaseRing::Open(fd, capacity, &ring);
+  if (!s.ok()) {
+    ARROW_LOG(WARNING) << "Failed to map the release ring of client on fd "
+                       << client->fd << ": " << s;
+    return false;
+  }
+  if (client->release_ring != nullptr) {
+    // Take the releases of the ring that this one replaces.
+    TakeReleasesFromRing(client);
+  }
+  client->release_ring = std::move(ring);
+
+  ClientLoop& client_loop = *loops_[client->loop];
+  if (client_loop.release_ring_timer == -1) {
+    client_loop.release_ring_timer = client_loop.loop->AddTimer(
+        kReleaseRingPollMs, [this, &client_loop](int64_t timer_id) {
+          bool has_rings = false;
+          for (const auto& entry : client_loop.clients) {
+            if (entry.second->release_ring != nullptr) {
+              TakeReleasesFromRing(entry.second.get());
+              has_rings = true;
+            }
+          }
+          DeleteEvictedObjects(&client_loop);
+          if (!has_rings) {
+            client_loop.release_ring_timer = -1;
+            return kEventLoopTimerDone;
+          }
+          return static_cast<int>(kReleaseRingPollMs);
+        });
+  }
+  return true;
+}
+
+void PlasmaStore::TakeReleasesFromRing(Client* client) {
+  ObjectID object_id;
+  while (client->release_ring->Pop(&object_id)) {
+    ObjectShard& shard = GetShard(object_id);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto entry = GetObjectTableEntry(&shard.objects, object_id);
+    // The shared memory is not trusted to only hold objects that the client
+    // uses, unlike the release requests on the socket.
+    if (entry == nullptr || RemoveFromClientObjectIds(entry, client) == 0) {
+      ARROW_LOG(WARNING) << "Client on fd " << client->fd << " released object "
+                         << object_id.hex() << " that it does not use.";
+    }
   }
 }
 
@@ -693,25 +1423,41 @@ void PlasmaStore::SubscribeToUpdates(Client* client) {
     return;
   }
 
-  // Add this fd to global map, which is needed for this client to receive notifications.
-  pending_notifications_[fd];
   client->notification_fd = fd;
 
-  // Push notifications to the new subscriber about existing sealed objects.
-  for (const auto& entry : store_info_.objects) {
-    if (entry.second->state == ObjectState::PLASMA_SEALED) {
-      PushNotification(&entry.second->info, fd);
+  // The subscribers are served by the first loop. An object sealed on another
+  // loop while the subscriber is added may be notified twice.
+  RunOnLoop(0, [this, fd]() {
+    // Add this fd to global map, which is needed for this client to receive
+    // notifications.
+    pending_notifications_[fd];
+
+    // Push notifications to the new subscriber about existing sealed objects.
+    for (const auto& shard : shards_) {
+      std::lock_guard<std::mutex> lock(shard->mutex);
+      for (const auto& entry : shard->objects) {
+        if (entry.second->state == ObjectState::PLASMA_SEALED) {
+          PushNotification(&entry.second->info, fd);
+        }
+      }
     }
-  }
+  });
 }
 
 Status PlasmaStore::ProcessMessage(Client* client) {
+  ClientLoop& client_loop = *loops_[client->loop];
   fb::MessageType type;
-  Status s = ReadMessage(client->fd, &type, &input_buffer_);
+  Status s = ReadMessage(client->fd, &type, &client_loop.input_buffer);
   ARROW_CHECK(s.ok() || s.IsIOError());
+  const auto start = std::chrono::steady_clock::now();
 
-  uint8_t* input = input_buffer_.data();
-  size_t input_size = input_buffer_.size();
+  uint8_t* input = client_loop.input_buffer.data();
+  size_t input_size = client_loop.input_buffer.size();
+
+  // The releases of the ring precede the request.
+  if (client->release_ring != nullptr) {
+    TakeReleasesFromRing(client);
+  }
   ObjectID object_id;
   PlasmaObject object;
   // TODO(pcm): Get rid of the following.
@@ -729,6 +1475,7 @@ Status PlasmaStore::ProcessMessage(Client* client) {
           CreateObject(object_id, data_size, metadata_size, device_num, client, &object);
       int64_t mmap_size = 0;
       if (error_code == PlasmaError::OK && device_num == 0) {
+        std::lock_guard<std::mutex> lock(memory_mutex_);
         mmap_size = GetMmapSize(object.store_fd);
       }
       HANDLE_SIGPIPE(
@@ -738,6 +1485,35 @@ Status PlasmaStore::ProcessMessage(Client* client) {
         WarnIfSigpipe(send_fd(client->fd, object.store_fd), client->fd);
       }
     } break;
+    case fb::MessageType::PlasmaCreateBatchRequest: {
+      std::vector<ObjectID> object_ids;
+      std::vector<int64_t> data_sizes;
+      std::vector<int64_t> metadata_sizes;
+      RETURN_NOT_OK(ReadCreateBatchRequest(input, input_size, &object_ids, &data_sizes,
+                                           &metadata_sizes));
+      std::vector<PlasmaObject> objects;
+      PlasmaError error_code =
+          CreateObjects(object_ids, data_sizes, metadata_sizes, client, &objects);
+      // Send each file descriptor once, as for the get replies.
+      std::vector<int> store_fds;
+      std::vector<int64_t> mmap_sizes;
+      {
+        std::lock_guard<std::mutex> lock(memory_mutex_);
+        for (const PlasmaObject& created : objects) {
+          if (std::find(store_fds.begin(), store_fds.end(), created.store_fd) ==
+              store_fds.end()) {
+            store_fds.push_back(created.store_fd);
+            mmap_sizes.push_back(GetMmapSize(created.store_fd));
+          }
+        }
+      }
+      HANDLE_SIGPIPE(SendCreateBatchReply(client->fd, object_ids, objects, error_code,
+                                          store_fds, mmap_sizes),
+                     client->fd);
+      for (int store_fd : store_fds) {
+        WarnIfSigpipe(send_fd(client->fd, store_fd), client->fd);
+      }
+    } break;
     case fb::MessageType::PlasmaAbortRequest: {
       RETURN_NOT_OK(ReadAbortRequest(input, input_size, &object_id));
       ARROW_CHECK(AbortObject(object_id, client) == 1) << "To abort an object, the only "
@@ -748,13 +1524,39 @@ Status PlasmaStore::ProcessMessage(Client* client) {
     case fb::MessageType::PlasmaGetRequest: {
       std::vector<ObjectID> object_ids_to_get;
       int64_t timeout_ms;
-      RETURN_NOT_OK(ReadGetRequest(input, input_size, object_ids_to_get, &timeout_ms));
-      ProcessGetRequest(client, object_ids_to_get, timeout_ms);
+      int64_t async_id;
+      RETURN_NOT_OK(ReadGetRequest(input, input_size, object_ids_to_get, &timeout_ms,
+                                   &async_id));
+      if (async_id != 0 && client->async_fd < 0) {
+        ARROW_LOG(WARNING) << "Dropping an asynchronous get request of the client on fd "
+                           << client->fd << ", which has no asynchronous socket";
+        break;
+      }
+      ProcessGetRequest(client, object_ids_to_get, timeout_ms, async_id);
+    } break;
+    case fb::MessageType::PlasmaConnectAsyncRequest: {
+      int fd = recv_fd(client->fd);
+      if (fd < 0) {
+        ARROW_LOG(WARNING) << "Failed to receive the asynchronous socket of the client "
+                           << "on fd " << client->fd;
+        break;
+      }
+      if (client->async_fd >= 0) {
+        close(client->async_fd);
+      }
+      client->async_fd = fd;
     } break;
     case fb::MessageType::PlasmaReleaseRequest: {
       RETURN_NOT_OK(ReadReleaseRequest(input, input_size, &object_id));
       ReleaseObject(object_id, client);
     } break;
+    case fb::MessageType::PlasmaReleaseBatchRequest: {
+      std::vector<ObjectID> object_ids;
+      RETURN_NOT_OK(ReadReleaseBatchRequest(input, input_size, &object_ids));
+      for (const auto& object_id : object_ids) {
+        ReleaseObject(object_id, client);
+      }
+    } break;
     case fb::MessageType::PlasmaDeleteRequest: {
       std::vector<ObjectID> object_ids;
       std::vector<PlasmaError> error_codes;
@@ -778,44 +1580,167 @@ Status PlasmaStore::ProcessMessage(Client* client) {
       RETURN_NOT_OK(ReadSealRequest(input, input_size, &object_id, &digest[0]));
       SealObject(object_id, &digest[0]);
     } break;
+    case fb::MessageType::PlasmaSealBatchRequest: {
+      std::vector<ObjectID> object_ids;
+      std::vector<std::string> digests;
+      RETURN_NOT_OK(ReadSealBatchRequest(input, input_size, &object_ids, &digests));
+      for (size_t i = 0; i < object_ids.size(); ++i) {
+        unsigned char digest[kDigestSize];
+        memcpy(digest, digests[i].data(), kDigestSize);
+        SealObject(object_ids[i], &digest[0]);
+      }
+    } break;
     case fb::MessageType::PlasmaEvictRequest: {
       // This code path should only be used for testing.
       int64_t num_bytes;
       RETURN_NOT_OK(ReadEvictRequest(input, input_size, &num_bytes));
       std::vector<ObjectID> objects_to_evict;
-      int64_t num_bytes_evicted =
-          eviction_policy_.ChooseObjectsToEvict(num_bytes, &objects_to_evict);
+      int64_t num_bytes_evicted;
+      {
+        std::lock_guard<std::mutex> lock(memory_mutex_);
+        num_bytes_evicted =
+            eviction_policy_->ChooseObjectsToEvict(num_bytes, &objects_to_evict);
+        evicted_objects_.insert(objects_to_evict.begin(), objects_to_evict.end());
+      }
       DeleteObjects(objects_to_evict);
       HANDLE_SIGPIPE(SendEvictReply(client->fd, num_bytes_evicted), client->fd);
     } break;
     case fb::MessageType::PlasmaSubscribeRequest:
       SubscribeToUpdates(client);
       break;
+    case fb::MessageType::PlasmaReleaseRingRequest: {
+      int64_t capacity;
+      RETURN_NOT_OK(ReadReleaseRingRequest(input, input_size, &capacity));
+      bool accepted = UseReleaseRing(client, capacity);
+      HANDLE_SIGPIPE(SendReleaseRingReply(client->fd, accepted), client->fd);
+    } break;
+    case fb::MessageType::PlasmaSetOptionsRequest: {
+      std::string name;
+      int64_t quota;
+      RETURN_NOT_OK(ReadSetOptionsRequest(input, input_size, &name, &quota));
+      // The objects created so far stay accounted to the previous name.
+      client->name = name;
+      if (!name.empty()) {
+        std::lock_guard<std::mutex> lock(memory_mutex_);
+        eviction_policy_->SetQuota(name, quota);
+      }
+      HANDLE_SIGPIPE(SendSetOptionsReply(client->fd, PlasmaError::OK), client->fd);
+    } break;
+    case fb::MessageType::PlasmaQuotaStatsRequest: {
+      RETURN_NOT_OK(ReadQuotaStatsRequest(input, input_size));
+      std::vector<QuotaStats> stats;
+      {
+        std::lock_guard<std::mutex> lock(memory_mutex_);
+        eviction_policy_->GetQuotaStats(&stats);
+      }
+      HANDLE_SIGPIPE(SendQuotaStatsReply(client->fd, stats), client->fd);
+    } break;
+    case fb::MessageType::PlasmaStoreStatsRequest: {
+      RETURN_NOT_OK(ReadStoreStatsRequest(input, input_size));
+      PlasmaStoreStats stats;
+      GetStats(&stats);
+      HANDLE_SIGPIPE(SendStoreStatsReply(client->fd, stats), client->fd);
+    } break;
+    case fb::MessageType::PlasmaReserveRequest: {
+      int64_t data_size, metadata_size, count;
+      RETURN_NOT_OK(
+          ReadReserveRequest(input, input_size, &data_size, &metadata_size, &count));
+      int64_t num_reserved;
+      {
+        std::lock_guard<std::mutex> lock(memory_mutex_);
+        num_reserved =
+            ReserveBlocks(data_size + metadata_size, std::max<int64_t>(count, 0));
+      }
+      HANDLE_SIGPIPE(SendReserveReply(client->fd, num_reserved), client->fd);
+    } break;
+    case fb::MessageType::PlasmaDataRequest: {
+      ObjectID object_id;
+      char* address;
+      int port;
+      RETURN_NOT_OK(ReadDataRequest(input, input_size, &object_id, &address, &port));
+      const std::string peer_address(address);
+      free(address);
+      RunOnLoop(0, [this, object_id, peer_address, port]() {
+        TransferObject(object_id, peer_address, port);
+      });
+    } break;
     case fb::MessageType::PlasmaConnectRequest: {
       HANDLE_SIGPIPE(SendConnectReply(client->fd, store_info_.memory_capacity),
                      client->fd);
     } break;
     case fb::MessageType::PlasmaDisconnectClient:
       ARROW_LOG(DEBUG) << "Disconnecting client on fd " << client->fd;
-      DisconnectClient(client->fd);
-      break;
+      DisconnectClient(client);
+      return Status::OK();
     default:
       // This code should be unreachable.
       ARROW_CHECK(0);
   }
+  DeleteEvictedObjects(&client_loop);
+
+  const int64_t micros = std::chrono::duration_cast<std::chrono::microseconds>(
+                             std::chrono::steady_clock::now() - start)
+                             .count();
+  MessageCounters& counters = client_loop.message_counters[static_cast<int>(type)];
+  AddToCounter(&counters.count, 1);
+  AddToCounter(&counters.total_micros, micros);
+  if (micros > counters.max_micros.load(std::memory_order_relaxed)) {
+    counters.max_micros.store(micros, std::memory_order_relaxed);
+  }
   return Status::OK();
 }
 
+// Write to each page of memory, on as many threads as there are cores, so
+// that creating the first objects in it does not take the page faults. The
+// pages are placed as the NUMA policy of the store says, e.g. interleaved
+// when it is started with "numactl --interleave=all".
+static void PrefaultMemory(uint8_t* pointer, int64_t size) {
+  const auto start = std::chrono::steady_clock::now();
+  const int64_t page_size = sysconf(_SC_PAGESIZE);
+  const int64_t num_threads = std::max(1u, std::thread::hardware_concurrency());
+  const int64_t num_pages = (size + page_size - 1) / page_size;
+  const int64_t chunk_size = (num_pages + num_threads - 1) / num_threads * page_size;
+  std::vector<std::thread> threads;
+  for (int64_t begin = 0; begin < size; begin += chunk_size) {
+    const int64_t end = std::min(size, begin + chunk_size);
+    threads.emplace_back([pointer, begin, end, page_size]() {
+      for (int64_t offset = begin; offset < end; offset += page_size) {
+        *static_cast<volatile uint8_t*>(pointer + offset) = 0;
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  ARROW_LOG(INFO) << "Pre-faulted " << size << " bytes of memory in "
+                  << std::chrono::duration_cast<std::chrono::milliseconds>(
+                         std::chrono::steady_clock::now() - start)
+                         .count()
+                  << " ms.";
+}
+
 class PlasmaStoreRunner {
  public:
   PlasmaStoreRunner() {}
 
   void Start(char* socket_name, int64_t system_memory, std::string directory,
-             bool hugepages_enabled, bool use_one_memory_mapped_file) {
-    // Create the event loop.
-    loop_.reset(new EventLoop);
-    store_.reset(
-        new PlasmaStore(loop_.get(), system_memory, directory, hugepages_enabled));
+             bool hugepages_enabled, bool use_one_memory_mapped_file, int num_threads,
+             const std::string& eviction_policy,
+             const std::string& external_store_directory,
+             int64_t notification_batch_size, bool prefault_memory,
+             int transfer_port) {
+    // Create the event loops, the first of which is run by this thread.
+    std::vector<EventLoop*> loops;
+    for (int i = 0; i < num_threads; ++i) {
+      loops_.emplace_back(new EventLoop);
+      loops.push_back(loops_.back().get());
+    }
+    store_.reset(new PlasmaStore(loops, system_memory, directory, hugepages_enabled,
+                                 eviction_policy, external_store_directory));
+    store_->SetNotificationBatchSize(notification_batch_size);
+    if (transfer_port >= 0) {
+      ARROW_CHECK_OK(store_->OpenTransferService(transfer_port));
+    }
     plasma_config = store_->GetPlasmaStoreInfo();
 
     // If the store is configured to use a single memory-mapped file, then we
@@ -824,6 +1749,9 @@ class PlasmaStoreRunner {
     if (use_one_memory_mapped_file) {
       void* pointer = plasma::dlmemalign(kBlockSize, system_memory);
       ARROW_CHECK(pointer != nullptr);
+      if (prefault_memory) {
+        PrefaultMemory(static_cast<uint8_t*>(pointer), system_memory);
+      }
       plasma::dlfree(pointer);
     }
 
@@ -831,20 +1759,39 @@ class PlasmaStoreRunner {
     // TODO(pcm): Check return value.
     ARROW_CHECK(socket >= 0);
 
-    loop_->AddFileEvent(socket, kEventLoopRead, [this, socket](int events) {
+    loops_[0]->AddFileEvent(socket, kEventLoopRead, [this, socket](int events) {
       this->store_->ConnectClient(socket);
     });
-    loop_->Start();
+    // Block SIGTERM in the other threads, so that this one handles it.
+    sigset_t signals;
+    sigemptyset(&signals);
+    sigaddset(&signals, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+    for (size_t i = 1; i < loops_.size(); ++i) {
+      EventLoop* loop = loops_[i].get();
+      threads_.emplace_back([loop]() { loop->Start(); });
+    }
+    pthread_sigmask(SIG_UNBLOCK, &signals, nullptr);
+    loops_[0]->Start();
   }
 
   void Shutdown() {
-    loop_->Stop();
-    loop_ = nullptr;
+    for (size_t i = 1; i < loops_.size(); ++i) {
+      EventLoop* loop = loops_[i].get();
+      loop->Post([loop]() { loop->Stop(); });
+    }
+    for (auto& thread : threads_) {
+      thread.join();
+    }
+    loops_[0]->Stop();
+    // The threads of the store may still post to the loops until it is gone.
     store_ = nullptr;
+    loops_.clear();
   }
 
  private:
-  std::unique_ptr<EventLoop> loop_;
+  std::vector<std::unique_ptr<EventLoop>> loops_;
+  std::vector<std::thread> threads_;
   std::unique_ptr<PlasmaStore> store_;
 };
 
@@ -861,7 +1808,11 @@ void HandleSignal(int signal) {
 }
 
 void StartServer(char* socket_name, int64_t system_memory, std::string plasma_directory,
-                 bool hugepages_enabled, bool use_one_memory_mapped_file) {
+                 bool hugepages_enabled, bool use_one_memory_mapped_file,
+                 int num_threads, const std::string& eviction_policy,
+                 const std::string& external_store_directory,
+                 int64_t notification_batch_size, bool prefault_memory,
+                 int transfer_port) {
   // Ignore SIGPIPE signals. If we don't do this, then when we attempt to write
   // to a client that has already died, the store could die.
   signal(SIGPIPE, SIG_IGN);
@@ -869,7 +1820,9 @@ void StartServer(char* socket_name, int64_t system_memory, std::string plasma_di
   g_runner.reset(new PlasmaStoreRunner());
   signal(SIGTERM, HandleSignal);
   g_runner->Start(socket_name, system_memory, plasma_directory, hugepages_enabled,
-                  use_one_memory_mapped_file);
+                  use_one_memory_mapped_file, num_threads, eviction_policy,
+                  external_store_directory, notification_batch_size, prefault_memory,
+                  transfer_port);
 }
 
 }  // namespace plasma
@@ -881,9 +1834,21 @@ int main(int argc, char* argv[]) {
   bool hugepages_enabled = false;
   // True if a single large memory-mapped file should be created at startup.
   bool use_one_memory_mapped_file = false;
+  // True if all of that file should also be faulted in at startup.
+  bool prefault_memory = false;
   int64_t system_memory = -1;
+  // The number of threads handling the requests of the clients.
+  int num_threads = 1;
+  // The eviction policy, see EvictionPolicy::Make.
+  std::string eviction_policy = "lru";
+  // The directory that evicted objects are spilled to, if any.
+  std::string external_store_directory;
+  // The largest number of notifications in a message to a subscriber.
+  int64_t notification_batch_size = plasma::kDefaultNotificationBatchSize;
+  // The port that objects are received from the other stores on, if any.
+  int transfer_port = -1;
   int c;
-  while ((c = getopt(argc, argv, "s:m:d:hf")) != -1) {
+  while ((c = getopt(argc, argv, "s:m:d:hfpt:e:x:b:r:")) != -1) {
     switch (c) {
       case 'd':
         plasma_directory = std::string(optarg);
@@ -906,6 +1871,34 @@ int main(int argc, char* argv[]) {
       case 'f':
         use_one_memory_mapped_file = true;
         break;
+      case 'p':
+        use_one_memory_mapped_file = true;
+        prefault_memory = true;
+        break;
+      case 't': {
+        char extra;
+        int scanned = sscanf(optarg, "%d%c", &num_threads, &extra);
+        ARROW_CHECK(scanned == 1 && num_threads > 0);
+        break;
+      }
+      case 'e':
+        eviction_policy = std::string(optarg);
+        break;
+      case 'x':
+        external_store_directory = std::string(optarg);
+        break;
+      case 'r': {
+        char extra;
+        int scanned = sscanf(optarg, "%d%c", &transfer_port, &extra);
+        ARROW_CHECK(scanned == 1 && transfer_port >= 0);
+        break;
+      }
+      case 'b': {
+        char extra;
+        int scanned = sscanf(optarg, "%" SCNd64 "%c", &notification_batch_size, &extra);
+        ARROW_CHECK(scanned == 1 && notification_batch_size > 0);
+        break;
+      }
       default:
         exit(-1);
     }
@@ -960,5 +1953,7 @@ int main(int argc, char* argv[]) {
   plasma::dlmalloc_set_footprint_limit((size_t)system_memory);
   ARROW_LOG(DEBUG) << "starting server listening on " << socket_name;
   plasma::StartServer(socket_name, system_memory, plasma_directory, hugepages_enabled,
-                      use_one_memory_mapped_file);
+                      use_one_memory_mapped_file, num_threads, eviction_policy,
+                      external_store_directory, notification_batch_size,
+                      prefault_memory, transfer_port);
 }
@@ -18,8 +18,11 @@
 #ifndef PLASMA_STORE_H
 #define PLASMA_STORE_H
 
+#include <atomic>
 #include <deque>
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
@@ -28,35 +31,58 @@
 #include "plasma/common.h"
 #include "plasma/events.h"
 #include "plasma/eviction_policy.h"
+#include "plasma/external_store.h"
 #include "plasma/plasma.h"
 #include "plasma/protocol.h"
+#include "plasma/ring.h"
+#include "plasma/transfer.h"
 
 namespace plasma {
 
 using flatbuf::ObjectInfoT;
 using flatbuf::PlasmaError;
 
+struct ClientLoop;
 struct GetRequest;
+struct ObjectShard;
 
 struct NotificationQueue {
   /// The object notifications for clients. We notify the client about the
   /// objects in the order that the objects were sealed or deleted.
   std::deque<std::unique_ptr<uint8_t[]>> object_notifications;
+  /// The notifications pushed since those queued last, which are still to be
+  /// batched into messages.
+  std::vector<ObjectInfoT> object_infos;
 };
 
 /// Contains all information that is associated with a Plasma store client.
 struct Client {
-  explicit Client(int fd);
+  Client(int fd, int loop);
 
   /// The file descriptor used to communicate with the client.
   int fd;
 
+  /// The index of the event loop handling the requests of the client, whose
+  /// thread is the only one to use this structure.
+  int loop;
+
   /// Object ids that are used by this client.
   std::unordered_set<ObjectID> object_ids;
 
   /// The file descriptor used to push notifications to client. This is only valid
   /// if client subscribes to plasma store. -1 indicates invalid.
   int notification_fd;
+
+  /// The file descriptor that the replies to the asynchronous get requests of
+  /// the client are sent on, or -1.
+  int async_fd;
+
+  /// The ring of the objects that the client released, if it shares one.
+  std::unique_ptr<ReleaseRing> release_ring;
+
+  /// The name that the objects the client creates are accounted to, which may
+  /// limit their memory, or empty.
+  std::string name;
 };
 
 class PlasmaStore {
@@ -65,7 +91,27 @@ class PlasmaStore {
 
   // TODO: PascalCase PlasmaStore methods.
   PlasmaStore(EventLoop* loop, int64_t system_memory, std::string directory,
-              bool hugetlbfs_enabled);
+              bool hugetlbfs_enabled, const std::string& eviction_policy = "lru",
+              const std::string& external_store_directory = "");
+
+  /// Create a store handling its clients on several event loops, each run by
+  /// a thread of its own. The clients are handed to the loops in turn, and the
+  /// object table is partitioned by object ID into as many shards, which the
+  /// threads lock to access. The memory of the objects, and the eviction of
+  /// those that make room for others, are shared by all the shards.
+  ///
+  /// @param loops The event loops. The first accepts the clients and sends
+  ///        the notifications to the subscribers, and evicts the objects
+  ///        that expire.
+  /// @param eviction_policy The name of the eviction policy, as taken by
+  ///        EvictionPolicy::Make.
+  /// @param external_store_directory If not empty, the directory that the
+  ///        objects evicted from the host are spilled to rather than lost,
+  ///        and that they are restored from when they are gotten again.
+  PlasmaStore(const std::vector<EventLoop*>& loops, int64_t system_memory,
+              std::string directory, bool hugetlbfs_enabled,
+              const std::string& eviction_policy = "lru",
+              const std::string& external_store_directory = "");
 
   ~PlasmaStore();
 
@@ -88,8 +134,8 @@ class PlasmaStore {
   /// @return One of the following error codes:
   ///  - PlasmaError::OK, if the object was created successfully.
   ///  - PlasmaError::ObjectExists, if an object with this ID is already
-  ///    present in the store. In this case, the client should not call
-  ///    plasma_release.
+  ///    present in the store, or was spilled to the external store. In this
+  ///    case, the client should not call plasma_release.
   ///  - PlasmaError::OutOfMemory, if the store is out of memory and
   ///    cannot create the object. In this case, the client should not call
   ///    plasma_release.
@@ -97,6 +143,20 @@ class PlasmaStore {
                            int64_t metadata_size, int device_num, Client* client,
                            PlasmaObject* result);
 
+  /// Create several objects on the host, either all of them or none.
+  ///
+  /// @param object_ids Object IDs of the objects to be created.
+  /// @param data_sizes Sizes in bytes of the objects to be created.
+  /// @param metadata_sizes Sizes in bytes of the objects' metadata.
+  /// @param client The client that created the objects.
+  /// @param results The objects that have been created.
+  /// @return The error code of the first object that could not be created, as
+  ///  with CreateObject, after aborting those created before it.
+  PlasmaError CreateObjects(const std::vector<ObjectID>& object_ids,
+                            const std::vector<int64_t>& data_sizes,
+                            const std::vector<int64_t>& metadata_sizes, Client* client,
+                            std::vector<PlasmaObject>* results);
+
   /// Abort a created but unsealed object. If the client is not the
   /// creator, then the abort will fail.
   ///
@@ -116,7 +176,9 @@ class PlasmaStore {
   PlasmaError DeleteObject(ObjectID& object_id);
 
   /// Delete objects that have been created in the hash table. This should only
-  /// be called on objects that are returned by the eviction policy to evict.
+  /// be called on objects that are returned by the eviction policy to evict,
+  /// without holding the lock of any shard. With an external store, the
+  /// objects are written to it first.
   ///
   /// @param object_ids Object IDs of the objects to be deleted.
   void DeleteObjects(const std::vector<ObjectID>& object_ids);
@@ -127,13 +189,17 @@ class PlasmaStore {
   /// is sealed.
   ///
   /// For each object, the client must do a call to release_object to tell the
-  /// store when it is done with the object.
+  /// store when it is done with the object. The objects that were spilled to
+  /// the external store are restored first.
   ///
   /// @param client The client making this request.
   /// @param object_ids Object IDs of the objects to be gotten.
   /// @param timeout_ms The timeout for the get request in milliseconds.
+  /// @param async_id The ID that the client gave the request if it is
+  ///        asynchronous, whose reply is then sent on the asynchronous socket
+  ///        of the client, or 0.
   void ProcessGetRequest(Client* client, const std::vector<ObjectID>& object_ids,
-                         int64_t timeout_ms);
+                         int64_t timeout_ms, int64_t async_id = 0);
 
   /// Seal an object. The object is now immutable and can be accessed with get.
   ///
@@ -143,6 +209,11 @@ class PlasmaStore {
   ///        with the same object ID are the same.
   void SealObject(const ObjectID& object_id, unsigned char digest[]);
 
+  /// Get the counters of the store, for PlasmaClient::GetStoreStats.
+  ///
+  /// @param stats The counters.
+  void GetStats(PlasmaStoreStats* stats);
+
   /// Check if the plasma store contains an object:
   ///
   /// @param object_id Object ID that will be checked.
@@ -156,6 +227,19 @@ class PlasmaStore {
   /// @param client The client making this request.
   void ReleaseObject(const ObjectID& object_id, Client* client);
 
+  /// Map the ring of the objects that a client releases, whose file descriptor
+  /// it sends, and poll it from then on.
+  ///
+  /// @param client The client making this request.
+  /// @param capacity The number of object IDs that the ring holds.
+  /// @return Whether the ring could be mapped.
+  bool UseReleaseRing(Client* client, int64_t capacity);
+
+  /// Release the objects that a client added to its release ring.
+  ///
+  /// @param client The client, which must share a release ring.
+  void TakeReleasesFromRing(Client* client);
+
   /// Subscribe a file descriptor to updates about new sealed objects.
   ///
   /// @param client The client making this request.
@@ -168,8 +252,25 @@ class PlasmaStore {
 
   /// Disconnect a client from the PlasmaStore.
   ///
-  /// @param client_fd The client file descriptor that is disconnected.
-  void DisconnectClient(int client_fd);
+  /// @param client The client that is disconnected, which is deleted.
+  void DisconnectClient(Client* client);
+
+  /// Set the largest number of notifications batched in a single message to
+  /// a subscriber. The notifications pushed while the first loop handles its
+  /// events are sent together after them, so that a subscriber gets many
+  /// objects sealed at once in few messages.
+  ///
+  /// @param batch_size The number of notifications, which must be positive.
+  void SetNotificationBatchSize(int64_t batch_size);
+
+  /// Start the service sending objects to the other stores, which the
+  /// clients ask for with PlasmaClient::Transfer, and receiving those that
+  /// they send. Without it, the service is only started to send objects.
+  ///
+  /// @param port The TCP port to listen on for the objects sent by the other
+  ///        stores, 0 for any, or -1 to receive none.
+  /// @return The return status.
+  Status OpenTransferService(int port);
 
   NotificationMap::iterator SendNotifications(NotificationMap::iterator it);
 
@@ -180,40 +281,120 @@ class PlasmaStore {
 
   void PushNotification(ObjectInfoT* object_notification, int client_fd);
 
-  void AddToClientObjectIds(ObjectTableEntry* entry, Client* client);
+  /// Batch the notifications pushed to the subscribers and send them, once
+  /// the first loop has handled its current events.
+  void ScheduleNotifications();
+
+  /// Run a callback on the thread of an event loop: right away with a single
+  /// loop, or else after the events that the loop is handling.
+  void RunOnLoop(int loop, const std::function<void()>& callback);
+
+  ObjectShard& GetShard(const ObjectID& object_id);
+
+#ifdef PLASMA_GPU
+  /// Get the memory pool of a GPU, numbered from 1, or null if there is no
+  /// such GPU. The memory lock must be held.
+  GpuMemoryPool* GetGpuMemoryPool(int device_num);
+#endif
+
+  bool AddToClientObjectIds(ObjectTableEntry* entry, Client* client);
+
+  bool AddObjectToGetRequest(GetRequest* get_req, const ObjectID& object_id);
 
   void ReturnFromGet(GetRequest* get_req);
 
-  void UpdateObjectGetRequests(const ObjectID& object_id);
+  void RemoveGetRequest(GetRequest* get_req);
+
+  void UpdateGetRequest(int loop, int64_t request_id, const ObjectID& object_id);
 
   int RemoveFromClientObjectIds(ObjectTableEntry* entry, Client* client);
 
-  /// Event loop of the plasma store.
-  EventLoop* loop_;
-  /// The plasma store information, including the object tables, that is exposed
-  /// to the eviction policy.
+  PlasmaError AllocateObject(const ObjectID& object_id, int64_t data_size,
+                             int64_t metadata_size, int device_num, Client* client,
+                             PlasmaObject* result);
+
+  void SpillObjects(const std::vector<ObjectID>& object_ids);
+
+  void RestoreObjects(const std::vector<ObjectID>& object_ids, Client* client);
+
+  void MarkEvicted(const std::vector<ObjectID>& object_ids, Client* client);
+
+  void DeleteEvictedObjects(ClientLoop* client_loop);
+
+  void EraseObject(ObjectShard* shard, const ObjectID& object_id);
+
+  /// Send an object to another store, on the first loop, keeping it until it
+  /// is sent.
+  void TransferObject(const ObjectID& object_id, const std::string& address, int port);
+
+  /// Get the memory to write a chunk of an object received into, creating the
+  /// object for its first chunk, on the first loop.
+  uint8_t* BeginTransferChunk(const TransferChunk& chunk);
+
+  /// Seal an object received once all its chunks are, or else abort it.
+  void EndTransferChunk(const TransferChunk& chunk, bool ok);
+
+#ifdef PLASMA_GPU
+  /// The memory of the objects on each GPU, created on first use under the
+  /// memory lock. It outlives the object table, whose objects free into it.
+  std::vector<std::unique_ptr<GpuMemoryPool>> gpu_pools_;
+#endif
+  /// The event loops of the plasma store, with the clients that each handles.
+  std::vector<std::unique_ptr<ClientLoop>> loops_;
+  /// The object table, partitioned by object ID into a shard for each loop.
+  std::vector<std::unique_ptr<ObjectShard>> shards_;
+  /// The plasma store information that is exposed to the eviction policy.
   PlasmaStoreInfo store_info_;
+  /// Guards the allocator, the memory-mapped files and the eviction policy,
+  /// which all the shards share. When both are held, it is locked after the
+  /// mutex of a shard.
+  std::mutex memory_mutex_;
   /// The state that is managed by the eviction policy.
-  EvictionPolicy eviction_policy_;
-  /// Input buffer. This is allocated only once to avoid mallocs for every
-  /// call to process_message.
-  std::vector<uint8_t> input_buffer_;
-  /// A hash table mapping object IDs to a vector of the get requests that are
-  /// waiting for the object to arrive.
-  std::unordered_map<ObjectID, std::vector<GetRequest*>> object_get_requests_;
+  std::unique_ptr<EvictionPolicy> eviction_policy_;
+  /// The objects that the eviction policy chose to evict but that are still
+  /// to be removed from their shard. They may not be used again.
+  std::unordered_set<ObjectID> evicted_objects_;
+  /// The store that the evicted objects are spilled to, if any.
+  std::unique_ptr<ExternalStore> external_store_;
+  /// The objects evicted and their bytes, and those spilled and restored.
+  std::atomic<int64_t> num_evicted_;
+  std::atomic<int64_t> bytes_evicted_;
+  std::atomic<int64_t> num_spilled_;
+  std::atomic<int64_t> num_restored_;
+  /// The index of the loop to hand the next client to.
+  int next_loop_;
   /// The pending notifications that have not been sent to subscribers because
   /// the socket send buffers were full. This is a hash table from client file
-  /// descriptor to an array of object_ids to send to that client.
+  /// descriptor to an array of object_ids to send to that client. Only the
+  /// first loop uses it.
   /// TODO(pcm): Consider putting this into the Client data structure and
   /// reorganize the code slightly.
   NotificationMap pending_notifications_;
-
-  std::unordered_map<int, std::unique_ptr<Client>> connected_clients_;
-
-  std::unordered_set<ObjectID> deletion_cache_;
+  /// The largest number of notifications in a message to a subscriber.
+  int64_t notification_batch_size_;
+  /// Whether the notifications pushed are to be sent by the first loop.
+  bool notifications_scheduled_;
+  /// The client that the objects sent and received by the transfer service
+  /// are held by, on the first loop, which only uses the fields below.
+  Client transfer_client_;
+  /// The objects sent, with the number of times each is being sent.
+  std::unordered_map<ObjectID, int> outgoing_transfers_;
+  /// An object being received, in chunks that may come in any order.
+  struct IncomingTransfer {
+    /// The memory of the object, or null if it could not be created.
+    uint8_t* pointer;
+    int64_t size;
+    int64_t bytes_remaining;
+    int64_t chunks_remaining;
+    bool failed;
+  };
+  std::unordered_map<ObjectID, IncomingTransfer> incoming_transfers_;
 #ifdef PLASMA_GPU
   arrow::gpu::CudaDeviceManager* manager_;
 #endif
+  /// The service sending and receiving objects, if started. Its threads call
+  /// back into the store, so it is destroyed first.
+  std::unique_ptr<TransferService> transfer_service_;
 };
 
 }  // namespace plasma
@@ -16,8 +16,10 @@
 // under the License.
 
 #include <assert.h>
+#include <poll.h>
 #include <signal.h>
 #include <stdlib.h>
+#include <sys/stat.h>
 #include <sys/time.h>
 #include <sys/types.h>
 #include <unistd.h>
@@ -26,6 +28,7 @@
 #include <random>
 #include <thread>
 
+#include "arrow/record_batch.h"
 #include "arrow/test-util.h"
 
 #include "plasma/client.h"
@@ -50,7 +53,9 @@ class TestPlasmaStore : public ::testing::Test {
  public:
   // TODO(pcm): At the moment, stdout of the test gets mixed up with
   // stdout of the object store. Consider changing that.
-  void SetUp() {
+  void SetUp() { StartStore(""); }
+
+  void StartStore(const std::string& options) {
     uint64_t seed = std::chrono::high_resolution_clock::now().time_since_epoch().count();
     std::mt19937 rng(static_cast<uint32_t>(seed));
     std::string store_index = std::to_string(rng());
@@ -58,8 +63,9 @@ class TestPlasmaStore : public ::testing::Test {
 
     std::string plasma_directory =
         test_executable.substr(0, test_executable.find_last_of("/"));
-    std::string plasma_command = plasma_directory + "/plasma_store -m 1000000000 -s " +
-                                 store_socket_name_ + " 1> /dev/null 2> /dev/null &";
+    std::string plasma_command = plasma_directory + "/plasma_store -m 1000000000 " +
+                                 options + "-s " + store_socket_name_ +
+                                 " 1> /dev/null 2> /dev/null &";
     system(plasma_command.c_str());
     ARROW_CHECK_OK(client_.Connect(store_socket_name_, ""));
     ARROW_CHECK_OK(client2_.Connect(store_socket_name_, ""));
@@ -145,6 +151,34 @@ TEST_F(TestPlasmaStore, NewSubscriberTest) {
   ARROW_CHECK_OK(local_client.Disconnect());
 }
 
+TEST_F(TestPlasmaStore, BatchedNotificationsTest) {
+  int fd = -1;
+  ARROW_CHECK_OK(client2_.Subscribe(&fd));
+  std::vector<ObjectID> object_ids;
+  for (int i = 0; i < 10; i++) {
+    object_ids.push_back(ObjectID::from_random());
+    CreateObject(client_, object_ids.back(), {1}, {2, 3});
+  }
+  ARROW_CHECK_OK(client_.Delete(object_ids[0]));
+
+  // The notifications may come in one or more batches, in order.
+  std::vector<ObjectNotification> notifications;
+  while (notifications.size() < object_ids.size() + 1) {
+    std::vector<ObjectNotification> batch;
+    ARROW_CHECK_OK(client2_.GetNotifications(fd, &batch));
+    ASSERT_FALSE(batch.empty());
+    notifications.insert(notifications.end(), batch.begin(), batch.end());
+  }
+  ASSERT_EQ(object_ids.size() + 1, notifications.size());
+  for (size_t i = 0; i < object_ids.size(); i++) {
+    ASSERT_EQ(object_ids[i], notifications[i].object_id);
+    ASSERT_EQ(2, notifications[i].data_size);
+    ASSERT_EQ(1, notifications[i].metadata_size);
+  }
+  ASSERT_EQ(object_ids[0], notifications.back().object_id);
+  ASSERT_EQ(-1, notifications.back().data_size);
+}
+
 TEST_F(TestPlasmaStore, SealErrorsTest) {
   ObjectID object_id = ObjectID::from_random();
 
@@ -190,6 +224,36 @@ TEST_F(TestPlasmaStore, DeleteTest) {
   ARROW_CHECK_OK(client_.Delete(object_id));
 }
 
+TEST_F(TestPlasmaStore, ReleaseRingTest) {
+  ARROW_CHECK_OK(client_.UseReleaseRing());
+  ASSERT_RAISES(Invalid, client_.UseReleaseRing());
+
+  ObjectID object_id1 = ObjectID::from_random();
+  ObjectID object_id2 = ObjectID::from_random();
+  int64_t data_size = 100;
+  uint8_t metadata[] = {5};
+  int64_t metadata_size = sizeof(metadata);
+  std::shared_ptr<Buffer> data;
+  for (const ObjectID& object_id : {object_id1, object_id2}) {
+    ARROW_CHECK_OK(client_.Create(object_id, data_size, metadata, metadata_size, &data));
+    ARROW_CHECK_OK(client_.Seal(object_id));
+    // The objects are deleted once they are released.
+    ARROW_CHECK_OK(client_.Delete(object_id));
+  }
+
+  // The store takes the release from the ring before the next request.
+  bool has_object = false;
+  ARROW_CHECK_OK(client_.Release(object_id1));
+  ARROW_CHECK_OK(client_.Contains(object_id1, &has_object));
+  ASSERT_FALSE(has_object);
+
+  // And when polling the ring, for the requests of other clients.
+  ARROW_CHECK_OK(client_.Release(object_id2));
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  ARROW_CHECK_OK(client2_.Contains(object_id2, &has_object));
+  ASSERT_FALSE(has_object);
+}
+
 TEST_F(TestPlasmaStore, DeleteObjectsTest) {
   ObjectID object_id1 = ObjectID::from_random();
   ObjectID object_id2 = ObjectID::from_random();
@@ -240,6 +304,43 @@ TEST_F(TestPlasmaStore, DeleteObjectsTest) {
   ASSERT_FALSE(has_object);
 }
 
+TEST_F(TestPlasmaStore, BatchTest) {
+  std::vector<ObjectID> object_ids;
+  std::vector<int64_t> data_sizes;
+  std::vector<std::string> metadata;
+  for (int i = 0; i < 100; i++) {
+    object_ids.push_back(ObjectID::from_random());
+    data_sizes.push_back(i);
+    metadata.push_back(std::string(i % 3, static_cast<char>(i)));
+  }
+  std::vector<std::shared_ptr<Buffer>> data;
+  ARROW_CHECK_OK(client_.Create(object_ids, data_sizes, metadata, &data));
+  ASSERT_EQ(object_ids.size(), data.size());
+  for (size_t i = 0; i < data.size(); i++) {
+    ASSERT_EQ(data_sizes[i], data[i]->size());
+    memset(data[i]->mutable_data(), static_cast<int>(i), data[i]->size());
+  }
+  ARROW_CHECK_OK(client_.Seal(object_ids));
+  ASSERT_RAISES(PlasmaObjectAlreadySealed, client_.Seal(object_ids));
+  ARROW_CHECK_OK(client_.Release(object_ids));
+
+  std::vector<ObjectBuffer> object_buffers;
+  ARROW_CHECK_OK(client2_.Get(object_ids, -1, &object_buffers));
+  for (size_t i = 0; i < object_ids.size(); i++) {
+    std::vector<uint8_t> object_metadata(metadata[i].begin(), metadata[i].end());
+    std::vector<uint8_t> object_data(data_sizes[i], static_cast<uint8_t>(i));
+    AssertObjectBufferEqual(object_buffers[i], object_metadata, object_data);
+  }
+
+  // None of the objects is created if one of them exists.
+  std::vector<ObjectID> new_object_ids = {ObjectID::from_random(), object_ids[0]};
+  ASSERT_RAISES(PlasmaObjectExists,
+                client_.Create(new_object_ids, {1, 1}, {"", ""}, &data));
+  bool has_object = true;
+  ARROW_CHECK_OK(client_.Contains(new_object_ids[0], &has_object));
+  ASSERT_FALSE(has_object);
+}
+
 TEST_F(TestPlasmaStore, ContainsTest) {
   ObjectID object_id = ObjectID::from_random();
 
@@ -432,6 +533,347 @@ TEST_F(TestPlasmaStore, MultipleClientTest) {
   ASSERT_TRUE(has_object);
 }
 
+class TestPlasmaStoreSharded : public TestPlasmaStore {
+ public:
+  void SetUp() { StartStore("-t 4 "); }
+};
+
+TEST_F(TestPlasmaStoreSharded, GetAcrossThreadsTest) {
+  std::vector<ObjectID> object_ids;
+  for (int i = 0; i < 16; i++) {
+    object_ids.push_back(ObjectID::from_random());
+  }
+
+  // The first client waits for the objects that the second creates, which the
+  // threads of other shards seal.
+  std::vector<ObjectBuffer> object_buffers;
+  std::thread getter([&]() {
+    ARROW_CHECK_OK(client_.Get(object_ids, -1, &object_buffers));
+  });
+  for (size_t i = 0; i < object_ids.size(); i++) {
+    CreateObject(client2_, object_ids[i], {42}, {static_cast<uint8_t>(i)});
+  }
+  getter.join();
+  ASSERT_EQ(object_buffers.size(), object_ids.size());
+  for (size_t i = 0; i < object_ids.size(); i++) {
+    AssertObjectBufferEqual(object_buffers[i], {42}, {static_cast<uint8_t>(i)});
+  }
+
+  // The objects can be deleted once released by the first client, which a
+  // request answered after the releases makes sure of.
+  object_buffers.clear();
+  ARROW_CHECK_OK(client_.FlushReleaseHistory());
+  bool has_object;
+  ARROW_CHECK_OK(client_.Contains(object_ids[0], &has_object));
+  ASSERT_TRUE(has_object);
+  ARROW_CHECK_OK(client2_.Delete(object_ids));
+  for (const auto& object_id : object_ids) {
+    ARROW_CHECK_OK(client_.Contains(object_id, &has_object));
+    ASSERT_FALSE(has_object);
+  }
+}
+
+class TestPlasmaStoreSpilling : public TestPlasmaStore {
+ public:
+  void SetUp() {
+    spill_directory_ = "/tmp/plasma-spill-" + std::to_string(getpid());
+    mkdir(spill_directory_.c_str(), S_IRWXU);
+    StartStore("-m 10000000 -x " + spill_directory_ + " ");
+  }
+
+ protected:
+  std::string spill_directory_;
+};
+
+TEST_F(TestPlasmaStoreSpilling, SpillAndRestoreTest) {
+  // The objects do not fit in memory together, so creating them evicts the
+  // first ones, which are spilled rather than lost.
+  std::vector<ObjectID> object_ids;
+  for (int i = 0; i < 10; i++) {
+    object_ids.push_back(ObjectID::from_random());
+    CreateObject(client_, object_ids[i], {static_cast<uint8_t>(i)},
+                 std::vector<uint8_t>(2000000, static_cast<uint8_t>(i)));
+  }
+  for (const auto& object_id : object_ids) {
+    bool has_object;
+    ARROW_CHECK_OK(client_.Contains(object_id, &has_object));
+    ASSERT_TRUE(has_object);
+    std::shared_ptr<Buffer> data;
+    ASSERT_FALSE(client_.Create(object_id, 1, nullptr, 0, &data).ok());
+  }
+
+  // Getting the objects restores them in turn, evicting the others again.
+  for (int i = 0; i < 10; i++) {
+    std::vector<ObjectBuffer> object_buffers;
+    ARROW_CHECK_OK(client_.Get({object_ids[i]}, 0, &object_buffers));
+    ASSERT_TRUE(object_buffers[0].data);
+    AssertObjectBufferEqual(object_buffers[0], {static_cast<uint8_t>(i)},
+                            std::vector<uint8_t>(2000000, static_cast<uint8_t>(i)));
+    object_buffers.clear();
+    ARROW_CHECK_OK(client_.Release(object_ids[i]));
+  }
+
+  // A spilled object can be deleted like any other.
+  ARROW_CHECK_OK(client_.Delete(object_ids[0]));
+  bool has_object;
+  ARROW_CHECK_OK(client_.Contains(object_ids[0], &has_object));
+  ASSERT_FALSE(has_object);
+}
+
+TEST_F(TestPlasmaStore, StoreStatsTest) {
+  ObjectID object_id = ObjectID::from_random();
+  CreateObject(client_, object_id, {42}, {1, 2, 3});
+
+  // One object is found, and the other is waited for until the timeout.
+  std::vector<ObjectBuffer> object_buffers;
+  ARROW_CHECK_OK(client_.Get({object_id, ObjectID::from_random()}, 0, &object_buffers));
+  object_buffers.clear();
+
+  PlasmaStoreStats stats;
+  ARROW_CHECK_OK(client_.GetStoreStats(&stats));
+  ASSERT_EQ(1, stats.num_objects);
+  ASSERT_EQ(4, stats.memory_used);
+  ASSERT_EQ(1000000000, stats.memory_capacity);
+  ASSERT_GE(stats.footprint, stats.allocated);
+  ASSERT_GE(stats.allocated, stats.memory_used);
+  ASSERT_EQ(1, stats.get_hits);
+  ASSERT_EQ(1, stats.get_misses);
+  ASSERT_EQ(0, stats.num_pending_get_requests);
+  ASSERT_EQ(0, stats.num_evicted);
+  bool found_create = false;
+  for (const auto& message : stats.messages) {
+    if (message.type == "PlasmaCreateRequest") {
+      ASSERT_EQ(1, message.count);
+      ASSERT_GE(message.total_micros, message.max_micros);
+      found_create = true;
+    }
+  }
+  ASSERT_TRUE(found_create);
+}
+
+TEST_F(TestPlasmaStore, GetAsyncTest) {
+  ObjectID present = ObjectID::from_random();
+  ObjectID later = ObjectID::from_random();
+  ObjectID missing = ObjectID::from_random();
+  CreateObject(client2_, present, {1}, {2, 3});
+
+  int fd;
+  ARROW_CHECK_OK(client_.ConnectAsync(&fd));
+  std::vector<std::vector<ObjectBuffer>> replies;
+  auto callback = [&replies](std::vector<ObjectBuffer> object_buffers) {
+    replies.push_back(std::move(object_buffers));
+  };
+  auto wait_for_replies = [this, fd, &replies](size_t num_replies) {
+    for (int i = 0; i < 100 && replies.size() < num_replies; i++) {
+      struct pollfd poll_fd = {fd, POLLIN, 0};
+      poll(&poll_fd, 1, 50);
+      int num_processed;
+      ARROW_CHECK_OK(client_.ProcessAsyncReplies(&num_processed));
+    }
+    ASSERT_LE(num_replies, replies.size());
+  };
+  ARROW_CHECK_OK(client_.GetAsync({present}, -1, callback));
+  ARROW_CHECK_OK(client_.GetAsync({later, present}, -1, callback));
+  ARROW_CHECK_OK(client_.GetAsync({missing}, 50, callback));
+
+  // Only the object in the store is there before the timeout.
+  wait_for_replies(1);
+  AssertObjectBufferEqual(replies[0][0], {1}, {2, 3});
+  wait_for_replies(2);
+  ASSERT_FALSE(replies[1][0].data);
+
+  CreateObject(client2_, later, {4}, {5});
+  wait_for_replies(3);
+  AssertObjectBufferEqual(replies[2][0], {4}, {5});
+  AssertObjectBufferEqual(replies[2][1], {1}, {2, 3});
+  int num_processed;
+  ARROW_CHECK_OK(client_.ProcessAsyncReplies(&num_processed));
+  ASSERT_EQ(0, num_processed);
+}
+
+TEST_F(TestPlasmaStore, KeepMappedTest) {
+  // Release objects right away, so that their files are no longer in use.
+  PlasmaClient client;
+  ARROW_CHECK_OK(client.Connect(store_socket_name_, "", 0));
+  ARROW_CHECK_OK(client.SetKeepMapped(true));
+  std::vector<ObjectID> object_ids;
+  for (int64_t size : {10, 1 << 20, 10, 50 << 20}) {
+    object_ids.push_back(ObjectID::from_random());
+    CreateObject(client2_, object_ids.back(), {1}, std::vector<uint8_t>(size, 7));
+  }
+  for (int i = 0; i < 3; i++) {
+    for (const auto& object_id : object_ids) {
+      std::vector<ObjectBuffer> object_buffers;
+      ARROW_CHECK_OK(client.Get({object_id}, 0, &object_buffers));
+      ASSERT_TRUE(object_buffers[0].data);
+      ASSERT_EQ(7, object_buffers[0].data->data()[0]);
+      ASSERT_EQ(7, object_buffers[0].data->data()[object_buffers[0].data->size() - 1]);
+    }
+  }
+  ARROW_CHECK_OK(client.SetKeepMapped(false));
+  ARROW_CHECK_OK(client.Disconnect());
+}
+
+TEST_F(TestPlasmaStore, TransferTest) {
+  // Start a peer store, which receives the objects sent by this one.
+  std::mt19937 rng(static_cast<uint32_t>(
+      std::chrono::high_resolution_clock::now().time_since_epoch().count()));
+  const int port = 20000 + static_cast<int>(rng() % 20000);
+  const std::string peer_socket_name = store_socket_name_ + "-peer";
+  std::string plasma_directory =
+      test_executable.substr(0, test_executable.find_last_of("/"));
+  std::string plasma_command = plasma_directory + "/plasma_store -m 1000000000 -r " +
+                               std::to_string(port) + " -s " + peer_socket_name +
+                               " 1> /dev/null 2> /dev/null &";
+  system(plasma_command.c_str());
+  PlasmaClient peer;
+  ARROW_CHECK_OK(peer.Connect(peer_socket_name, ""));
+
+  // The large object is sent in several chunks.
+  ObjectID small_object = ObjectID::from_random();
+  ObjectID large_object = ObjectID::from_random();
+  std::vector<uint8_t> large_data(40 << 20);
+  for (size_t i = 0; i < large_data.size(); i++) {
+    large_data[i] = static_cast<uint8_t>(i * 13);
+  }
+  CreateObject(client_, small_object, {1}, {2, 3});
+  CreateObject(client_, large_object, {4}, large_data);
+  ARROW_CHECK_OK(client_.Transfer("127.0.0.1", port, small_object));
+  ARROW_CHECK_OK(client_.Transfer("127.0.0.1", port, large_object));
+
+  std::vector<ObjectBuffer> object_buffers;
+  ARROW_CHECK_OK(peer.Get({small_object, large_object}, 10000, &object_buffers));
+  AssertObjectBufferEqual(object_buffers[0], {1}, {2, 3});
+  ASSERT_TRUE(object_buffers[1].data);
+  ASSERT_EQ(large_data.size(), object_buffers[1].data->size());
+  ASSERT_EQ(0, memcmp(large_data.data(), object_buffers[1].data->data(),
+                      large_data.size()));
+  uint8_t digest[kDigestSize], peer_digest[kDigestSize];
+  ARROW_CHECK_OK(client_.Hash(large_object, digest));
+  ARROW_CHECK_OK(peer.Hash(large_object, peer_digest));
+  ASSERT_EQ(0, memcmp(digest, peer_digest, kDigestSize));
+  object_buffers.clear();
+  ARROW_CHECK_OK(peer.Disconnect());
+}
+
+TEST_F(TestPlasmaStore, DigestTypeTest) {
+  // Large enough to be hashed in several chunks, with a suffix.
+  std::vector<uint8_t> data(5 * (1 << 20) + 3);
+  for (size_t i = 0; i < data.size(); i++) {
+    data[i] = static_cast<uint8_t>(i * 7);
+  }
+  std::vector<uint8_t> other_data = data;
+  other_data.back() ^= 1;
+
+  for (DigestType type : {DigestType::XXH64, DigestType::CRC32C}) {
+    ARROW_CHECK_OK(client_.SetDigestType(type));
+    ARROW_CHECK_OK(client2_.SetDigestType(type));
+    ObjectID object_id1 = ObjectID::from_random();
+    ObjectID object_id2 = ObjectID::from_random();
+    ObjectID object_id3 = ObjectID::from_random();
+    CreateObject(client_, object_id1, {1}, data);
+    CreateObject(client2_, object_id2, {1}, data);
+    CreateObject(client_, object_id3, {1}, other_data);
+    uint8_t digest1[kDigestSize], digest2[kDigestSize], digest3[kDigestSize];
+    ARROW_CHECK_OK(client_.Hash(object_id1, digest1));
+    ARROW_CHECK_OK(client_.Hash(object_id2, digest2));
+    ARROW_CHECK_OK(client_.Hash(object_id3, digest3));
+    ASSERT_EQ(0, memcmp(digest1, digest2, kDigestSize));
+    ASSERT_NE(0, memcmp(digest1, digest3, kDigestSize));
+  }
+
+  // Objects are sealed without a digest, which Hash() still computes.
+  ARROW_CHECK_OK(client_.SetDigestType(DigestType::NONE));
+  ObjectID object_id = ObjectID::from_random();
+  CreateObject(client_, object_id, {1}, data);
+  bool has_object;
+  ARROW_CHECK_OK(client_.Contains(object_id, &has_object));
+  ASSERT_TRUE(has_object);
+  uint8_t digest[kDigestSize], zeros[kDigestSize] = {0};
+  ARROW_CHECK_OK(client_.Hash(object_id, digest));
+  ASSERT_NE(0, memcmp(digest, zeros, kDigestSize));
+}
+
+TEST_F(TestPlasmaStore, ReserveTest) {
+  int64_t num_reserved;
+  ARROW_CHECK_OK(client_.Reserve(100000, 10, 3, &num_reserved));
+  ASSERT_EQ(3, num_reserved);
+  ASSERT_RAISES(Invalid, client_.Reserve(100000, 10, -1, &num_reserved));
+  PlasmaStoreStats stats;
+  ARROW_CHECK_OK(client_.GetStoreStats(&stats));
+  ASSERT_GE(stats.allocated, 3 * 100010);
+  ASSERT_EQ(0, stats.memory_used);
+
+  // The memory of a deleted object is that of the next one of its size.
+  std::vector<uint8_t> metadata(10);
+  std::shared_ptr<Buffer> data;
+  ObjectID object_id1 = ObjectID::from_random();
+  ARROW_CHECK_OK(client_.Create(object_id1, 100000, metadata.data(), 10, &data));
+  const uint8_t* address = data->data();
+  data.reset();
+  ARROW_CHECK_OK(client_.Seal(object_id1));
+  ARROW_CHECK_OK(client_.Release(object_id1));
+  ARROW_CHECK_OK(client_.Delete(object_id1));
+  ObjectID object_id2 = ObjectID::from_random();
+  ARROW_CHECK_OK(client_.Create(object_id2, 100000, metadata.data(), 10, &data));
+  ASSERT_EQ(address, data->data());
+  ARROW_CHECK_OK(client_.Seal(object_id2));
+  ARROW_CHECK_OK(client_.Release(object_id2));
+
+  ARROW_CHECK_OK(client_.Reserve(100000, 10, 0, &num_reserved));
+  ASSERT_EQ(0, num_reserved);
+}
+
+TEST_F(TestPlasmaStore, SmallObjectTest) {
+  // Small objects of the same size class share slabs.
+  std::vector<ObjectID> object_ids;
+  for (int i = 0; i < 100; i++) {
+    object_ids.push_back(ObjectID::from_random());
+    CreateObject(client_, object_ids.back(), {1}, std::vector<uint8_t>(100 + i));
+  }
+  std::vector<ObjectBuffer> object_buffers;
+  ARROW_CHECK_OK(client_.Get(object_ids, -1, &object_buffers));
+  for (int i = 0; i < 100; i++) {
+    AssertObjectBufferEqual(object_buffers[i], {1}, std::vector<uint8_t>(100 + i));
+  }
+  object_buffers.clear();
+  ARROW_CHECK_OK(client_.Delete(object_ids));
+  bool has_object;
+  ARROW_CHECK_OK(client_.Contains(object_ids[0], &has_object));
+  ASSERT_FALSE(has_object);
+}
+
+TEST_F(TestPlasmaStore, RecordBatchTest) {
+  std::shared_ptr<arrow::Array> ints, strings;
+  arrow::ArrayFromVector<arrow::Int32Type, int32_t>({1, 2, 3}, &ints);
+  arrow::ArrayFromVector<arrow::StringType, std::string>({"a", "bc", "def"}, &strings);
+  auto schema = arrow::schema(
+      {arrow::field("ints", arrow::int32()), arrow::field("strings", arrow::utf8())});
+  auto batch = arrow::RecordBatch::Make(schema, 3, {ints, strings});
+
+  ObjectID object_id = ObjectID::from_random();
+  ARROW_CHECK_OK(client_.PutRecordBatch(object_id, *batch));
+  ASSERT_RAISES(PlasmaObjectExists, client_.PutRecordBatch(object_id, *batch));
+
+  // The batch is read from the memory of the object, and with the schema
+  // parsed for the first batch while the object is in use.
+  std::shared_ptr<arrow::RecordBatch> result1, result2;
+  ARROW_CHECK_OK(client2_.GetRecordBatch(object_id, -1, &result1));
+  ARROW_CHECK_OK(client2_.GetRecordBatch(object_id, -1, &result2));
+  ASSERT_TRUE(result1->Equals(*batch));
+  ASSERT_TRUE(result2->schema()->Equals(*schema));
+  ASSERT_EQ(result1->schema(), result2->schema());
+  std::vector<ObjectBuffer> object_buffers;
+  ARROW_CHECK_OK(client2_.Get({object_id}, -1, &object_buffers));
+  const uint8_t* begin = object_buffers[0].data->data();
+  const uint8_t* values = result1->column(0)->data()->buffers[1]->data();
+  ASSERT_GE(values, begin);
+  ASSERT_LT(values, begin + object_buffers[0].data->size());
+
+  ASSERT_RAISES(PlasmaObjectNonexistent,
+                client2_.GetRecordBatch(ObjectID::from_random(), 0, &result1));
+}
+
 TEST_F(TestPlasmaStore, ManyObjectTest) {
   // Create many objects on the first client. Seal one third, abort one third,
   // and leave the last third unsealed.
@@ -0,0 +1,186 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "arrow/test-util.h"
+
+#include "plasma/common.h"
+#include "plasma/eviction_policy.h"
+#include "plasma/plasma.h"
+
+#include "gtest/gtest.h"
+
+namespace plasma {
+
+class TestEvictionPolicy : public ::testing::Test {
+ public:
+  void Make(const std::string& name) {
+    store_info_.memory_capacity = 1000;
+    ARROW_CHECK_OK(EvictionPolicy::Make(name, &store_info_, &policy_));
+  }
+
+  // Create an object, and use it as many times as given.
+  ObjectID CreateObject(int64_t size, int uses = 1, const std::string& owner = "") {
+    ObjectID object_id = ObjectID::from_random();
+    std::vector<ObjectID> objects_to_evict;
+    policy_->ObjectCreated(object_id, size, owner);
+    for (int i = 0; i < uses; i++) {
+      policy_->BeginObjectAccess(object_id, &objects_to_evict);
+      policy_->EndObjectAccess(object_id, size, &objects_to_evict);
+    }
+    EXPECT_TRUE(objects_to_evict.empty());
+    return object_id;
+  }
+
+  std::vector<ObjectID> Evict(int64_t num_bytes) {
+    std::vector<ObjectID> objects_to_evict;
+    policy_->ChooseObjectsToEvict(num_bytes, &objects_to_evict);
+    return objects_to_evict;
+  }
+
+ protected:
+  PlasmaStoreInfo store_info_;
+  std::unique_ptr<EvictionPolicy> policy_;
+};
+
+TEST_F(TestEvictionPolicy, Make) {
+  std::unique_ptr<EvictionPolicy> policy;
+  for (const std::string name : {"lru", "lfu", "gds", "ttl:1000"}) {
+    ARROW_CHECK_OK(EvictionPolicy::Make(name, &store_info_, &policy));
+  }
+  ASSERT_EQ(1000, policy->expiry_period_ms());
+  ASSERT_RAISES(Invalid, EvictionPolicy::Make("mru", &store_info_, &policy));
+  ASSERT_RAISES(Invalid, EvictionPolicy::Make("ttl:", &store_info_, &policy));
+  ASSERT_RAISES(Invalid, EvictionPolicy::Make("ttl:-1", &store_info_, &policy));
+}
+
+TEST_F(TestEvictionPolicy, LRU) {
+  Make("lru");
+  ASSERT_EQ(-1, policy_->expiry_period_ms());
+  ObjectID object_id1 = CreateObject(100);
+  ObjectID object_id2 = CreateObject(100);
+  ObjectID object_id3 = CreateObject(100);
+  // Use the first object again, which makes the second the least recent.
+  std::vector<ObjectID> objects_to_evict;
+  policy_->BeginObjectAccess(object_id1, &objects_to_evict);
+  policy_->EndObjectAccess(object_id1, 100, &objects_to_evict);
+  ASSERT_EQ(std::vector<ObjectID>({object_id2, object_id3}), Evict(150));
+  ASSERT_EQ(std::vector<ObjectID>({object_id1}), Evict(100));
+  ASSERT_TRUE(Evict(100).empty());
+}
+
+TEST_F(TestEvictionPolicy, LFU) {
+  Make("lfu");
+  ObjectID often_used = CreateObject(100, 3);
+  ObjectID rarely_used = CreateObject(100, 1);
+  ObjectID unused = CreateObject(100, 0);
+  ASSERT_EQ(std::vector<ObjectID>({unused, rarely_used}), Evict(200));
+
+  // A new object used as often as the first one outlasts it, as it was used
+  // after the last eviction.
+  ObjectID new_object = CreateObject(100, 3);
+  ASSERT_EQ(std::vector<ObjectID>({often_used}), Evict(100));
+  ASSERT_EQ(std::vector<ObjectID>({new_object}), Evict(100));
+}
+
+TEST_F(TestEvictionPolicy, GreedyDualSize) {
+  Make("gds");
+  ObjectID small_object = CreateObject(20);
+  ObjectID large_object = CreateObject(500);
+  ObjectID medium_object = CreateObject(25);
+  ASSERT_EQ(std::vector<ObjectID>({large_object}), Evict(1));
+  ASSERT_EQ(std::vector<ObjectID>({medium_object}), Evict(1));
+  // The objects used after the evictions outlast the smaller objects used
+  // before them.
+  ObjectID new_object = CreateObject(50);
+  ASSERT_EQ(std::vector<ObjectID>({small_object}), Evict(1));
+  ASSERT_EQ(std::vector<ObjectID>({new_object}), Evict(1));
+}
+
+TEST_F(TestEvictionPolicy, TTL) {
+  Make("ttl:50");
+  ASSERT_EQ(50, policy_->expiry_period_ms());
+  ObjectID expired = CreateObject(100);
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  ObjectID unexpired = CreateObject(100);
+  ObjectID in_use = CreateObject(100);
+  std::vector<ObjectID> objects_to_evict;
+  policy_->BeginObjectAccess(in_use, &objects_to_evict);
+
+  ASSERT_EQ(100, policy_->ChooseExpiredObjects(&objects_to_evict));
+  ASSERT_EQ(std::vector<ObjectID>({expired}), objects_to_evict);
+  // The objects are evicted in LRU order when space is needed.
+  ASSERT_EQ(std::vector<ObjectID>({unexpired}), Evict(1000));
+}
+
+TEST_F(TestEvictionPolicy, RequireSpace) {
+  Make("lru");
+  ObjectID object_id1 = CreateObject(400);
+  ObjectID object_id2 = CreateObject(400);
+  std::vector<ObjectID> objects_to_evict;
+  // Eviction frees at least a fifth of the capacity.
+  ASSERT_TRUE(policy_->RequireSpace(100, &objects_to_evict));
+  ASSERT_EQ(std::vector<ObjectID>({object_id1}), objects_to_evict);
+  objects_to_evict.clear();
+  policy_->RemoveObject(object_id2, 400);
+  ASSERT_FALSE(policy_->RequireSpace(2000, &objects_to_evict));
+  ASSERT_TRUE(objects_to_evict.empty());
+}
+
+TEST_F(TestEvictionPolicy, Quota) {
+  Make("lru");
+  policy_->SetQuota("a", 250);
+  ObjectID object_a1 = CreateObject(100, 1, "a");
+  ObjectID object_b1 = CreateObject(100, 1, "b");
+  ObjectID object_a2 = CreateObject(100, 1, "a");
+
+  // Another object of the first name only fits once its oldest is evicted.
+  std::vector<ObjectID> objects_to_evict;
+  ASSERT_TRUE(policy_->EnforceQuota("a", 100, &objects_to_evict));
+  ASSERT_EQ(std::vector<ObjectID>({object_a1}), objects_to_evict);
+  objects_to_evict.clear();
+  ASSERT_FALSE(policy_->EnforceQuota("a", 300, &objects_to_evict));
+  ASSERT_TRUE(policy_->EnforceQuota("b", 1000, &objects_to_evict));
+  ASSERT_TRUE(objects_to_evict.empty());
+
+  // A name over its quota has its objects evicted before those used less
+  // recently.
+  policy_->SetQuota("a", 50);
+  ASSERT_EQ(std::vector<ObjectID>({object_a2}), Evict(1));
+  ASSERT_EQ(std::vector<ObjectID>({object_b1}), Evict(1));
+
+  std::vector<QuotaStats> stats;
+  policy_->GetQuotaStats(&stats);
+  ASSERT_EQ(2, stats.size());
+  if (stats[0].client_name != "a") {
+    std::swap(stats[0], stats[1]);
+  }
+  ASSERT_EQ("a", stats[0].client_name);
+  ASSERT_EQ(50, stats[0].quota);
+  ASSERT_EQ(0, stats[0].bytes_used);
+  ASSERT_EQ(0, stats[0].num_objects);
+  ASSERT_EQ(200, stats[0].bytes_evicted);
+  ASSERT_EQ(-1, stats[1].quota);
+  ASSERT_EQ(100, stats[1].bytes_evicted);
+}
+
+}  // namespace plasma
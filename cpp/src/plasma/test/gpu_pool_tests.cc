@@ -0,0 +1,56 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "plasma/gpu_pool.h"
+#include "plasma/plasma.h"
+
+#include "gtest/gtest.h"
+
+namespace plasma {
+
+TEST(TestBlockAllocator, AllocateAndFree) {
+  BlockAllocator allocator(10 * kBlockSize);
+  // The ranges are rounded up to the alignment.
+  ASSERT_EQ(0, allocator.Allocate(1));
+  ASSERT_EQ(kBlockSize, allocator.Allocate(2 * kBlockSize));
+  ASSERT_EQ(3 * kBlockSize, allocator.Allocate(kBlockSize));
+  ASSERT_EQ(4 * kBlockSize, allocator.allocated());
+  ASSERT_EQ(-1, allocator.Allocate(7 * kBlockSize));
+
+  // A freed range is reused first fit, by a range that fits in it.
+  allocator.Free(kBlockSize, 2 * kBlockSize);
+  ASSERT_EQ(4 * kBlockSize, allocator.Allocate(3 * kBlockSize));
+  ASSERT_EQ(kBlockSize, allocator.Allocate(kBlockSize));
+  ASSERT_EQ(6 * kBlockSize, allocator.allocated());
+}
+
+TEST(TestBlockAllocator, Coalesce) {
+  BlockAllocator allocator(4 * kBlockSize);
+  for (int i = 0; i < 4; ++i) {
+    ASSERT_EQ(i * kBlockSize, allocator.Allocate(kBlockSize));
+  }
+  // Freeing the ranges out of order merges them back into the whole block.
+  allocator.Free(kBlockSize, kBlockSize);
+  allocator.Free(3 * kBlockSize, kBlockSize);
+  allocator.Free(2 * kBlockSize, kBlockSize);
+  ASSERT_EQ(-1, allocator.Allocate(4 * kBlockSize));
+  allocator.Free(0, kBlockSize);
+  ASSERT_EQ(0, allocator.allocated());
+  ASSERT_EQ(0, allocator.Allocate(4 * kBlockSize));
+}
+
+}  // namespace plasma
@@ -118,6 +118,68 @@ TEST(PlasmaSerialization, CreateReply) {
   close(fd);
 }
 
+TEST(PlasmaSerialization, CreateBatchRequest) {
+  int fd = create_temp_file();
+  std::vector<ObjectID> object_ids1 = {ObjectID::from_random(), ObjectID::from_random()};
+  std::vector<int64_t> data_sizes1 = {42, 0};
+  std::vector<int64_t> metadata_sizes1 = {11, 3};
+  ARROW_CHECK_OK(SendCreateBatchRequest(fd, object_ids1, data_sizes1, metadata_sizes1));
+  std::vector<uint8_t> data =
+      read_message_from_file(fd, MessageType::PlasmaCreateBatchRequest);
+  std::vector<ObjectID> object_ids2;
+  std::vector<int64_t> data_sizes2;
+  std::vector<int64_t> metadata_sizes2;
+  ARROW_CHECK_OK(ReadCreateBatchRequest(data.data(), data.size(), &object_ids2,
+                                        &data_sizes2, &metadata_sizes2));
+  ASSERT_EQ(object_ids1, object_ids2);
+  ASSERT_EQ(data_sizes1, data_sizes2);
+  ASSERT_EQ(metadata_sizes1, metadata_sizes2);
+  close(fd);
+}
+
+TEST(PlasmaSerialization, CreateBatchReply) {
+  int fd = create_temp_file();
+  std::vector<ObjectID> object_ids1 = {ObjectID::from_random(), ObjectID::from_random()};
+  std::vector<PlasmaObject> objects1 = {random_plasma_object(), random_plasma_object()};
+  objects1[1].data_offset += 100;
+  std::vector<int> store_fds1 = {objects1[0].store_fd};
+  std::vector<int64_t> mmap_sizes1 = {1000000};
+  ARROW_CHECK_OK(SendCreateBatchReply(fd, object_ids1, objects1, PlasmaError::OK,
+                                      store_fds1, mmap_sizes1));
+  std::vector<uint8_t> data =
+      read_message_from_file(fd, MessageType::PlasmaCreateBatchReply);
+  std::vector<ObjectID> object_ids2;
+  std::vector<PlasmaObject> objects2;
+  std::vector<int> store_fds2;
+  std::vector<int64_t> mmap_sizes2;
+  ARROW_CHECK_OK(ReadCreateBatchReply(data.data(), data.size(), &object_ids2, &objects2,
+                                      &store_fds2, &mmap_sizes2));
+  ASSERT_EQ(object_ids1, object_ids2);
+  ASSERT_EQ(objects1.size(), objects2.size());
+  for (size_t i = 0; i < objects1.size(); ++i) {
+    ASSERT_EQ(objects1[i].store_fd, objects2[i].store_fd);
+    ASSERT_EQ(objects1[i].data_offset, objects2[i].data_offset);
+    ASSERT_EQ(objects1[i].metadata_offset, objects2[i].metadata_offset);
+    ASSERT_EQ(objects1[i].data_size, objects2[i].data_size);
+    ASSERT_EQ(objects1[i].metadata_size, objects2[i].metadata_size);
+  }
+  ASSERT_EQ(store_fds1, store_fds2);
+  ASSERT_EQ(mmap_sizes1, mmap_sizes2);
+  close(fd);
+
+  // Errors carry no objects.
+  fd = create_temp_file();
+  ARROW_CHECK_OK(SendCreateBatchReply(fd, object_ids1, {}, PlasmaError::OutOfMemory, {},
+                                      {}));
+  data = read_message_from_file(fd, MessageType::PlasmaCreateBatchReply);
+  Status s = ReadCreateBatchReply(data.data(), data.size(), &object_ids2, &objects2,
+                                  &store_fds2, &mmap_sizes2);
+  ASSERT_TRUE(s.IsPlasmaStoreFull());
+  ASSERT_EQ(0, objects2.size());
+  ASSERT_EQ(0, store_fds2.size());
+  close(fd);
+}
+
 TEST(PlasmaSerialization, SealRequest) {
   int fd = create_temp_file();
   ObjectID object_id1 = ObjectID::from_random();
@@ -145,6 +207,23 @@ TEST(PlasmaSerialization, SealReply) {
   close(fd);
 }
 
+TEST(PlasmaSerialization, SealBatchRequest) {
+  int fd = create_temp_file();
+  std::vector<ObjectID> object_ids1 = {ObjectID::from_random(), ObjectID::from_random()};
+  std::vector<std::string> digests1 = {std::string(kDigestSize, 7),
+                                       std::string(kDigestSize, 8)};
+  ARROW_CHECK_OK(SendSealBatchRequest(fd, object_ids1, digests1));
+  std::vector<uint8_t> data =
+      read_message_from_file(fd, MessageType::PlasmaSealBatchRequest);
+  std::vector<ObjectID> object_ids2;
+  std::vector<std::string> digests2;
+  ARROW_CHECK_OK(
+      ReadSealBatchRequest(data.data(), data.size(), &object_ids2, &digests2));
+  ASSERT_EQ(object_ids1, object_ids2);
+  ASSERT_EQ(digests1, digests2);
+  close(fd);
+}
+
 TEST(PlasmaSerialization, GetRequest) {
   int fd = create_temp_file();
   ObjectID object_ids[2];
@@ -198,6 +277,30 @@ TEST(PlasmaSerialization, GetReply) {
   close(fd);
 }
 
+TEST(PlasmaSerialization, AsyncGetRequestAndReply) {
+  int fd = create_temp_file();
+  ObjectID object_id = ObjectID::from_random();
+  ARROW_CHECK_OK(SendGetRequest(fd, &object_id, 1, 10, 42));
+  std::vector<uint8_t> data = read_message_from_file(fd, MessageType::PlasmaGetRequest);
+  std::vector<ObjectID> object_ids_return;
+  int64_t timeout_ms_return;
+  int64_t request_id_return;
+  ARROW_CHECK_OK(ReadGetRequest(data.data(), data.size(), object_ids_return,
+                                &timeout_ms_return, &request_id_return));
+  ASSERT_EQ(42, request_id_return);
+
+  std::unordered_map<ObjectID, PlasmaObject> plasma_objects;
+  plasma_objects[object_id] = random_plasma_object();
+  ARROW_CHECK_OK(SendGetReply(fd, &object_id, plasma_objects, 1, {}, {}, 42));
+  data = read_message_from_file(fd, MessageType::PlasmaGetReply);
+  int64_t num_objects_return;
+  ARROW_CHECK_OK(ReadGetReplyHeader(data.data(), data.size(), &request_id_return,
+                                    &num_objects_return));
+  ASSERT_EQ(42, request_id_return);
+  ASSERT_EQ(1, num_objects_return);
+  close(fd);
+}
+
 TEST(PlasmaSerialization, ReleaseRequest) {
   int fd = create_temp_file();
   ObjectID object_id1 = ObjectID::from_random();
@@ -222,6 +325,18 @@ TEST(PlasmaSerialization, ReleaseReply) {
   close(fd);
 }
 
+TEST(PlasmaSerialization, ReleaseBatchRequest) {
+  int fd = create_temp_file();
+  std::vector<ObjectID> object_ids1 = {ObjectID::from_random(), ObjectID::from_random()};
+  ARROW_CHECK_OK(SendReleaseBatchRequest(fd, object_ids1));
+  std::vector<uint8_t> data =
+      read_message_from_file(fd, MessageType::PlasmaReleaseBatchRequest);
+  std::vector<ObjectID> object_ids2;
+  ARROW_CHECK_OK(ReadReleaseBatchRequest(data.data(), data.size(), &object_ids2));
+  ASSERT_EQ(object_ids1, object_ids2);
+  close(fd);
+}
+
 TEST(PlasmaSerialization, DeleteRequest) {
   int fd = create_temp_file();
   ObjectID object_id1 = ObjectID::from_random();
@@ -313,6 +428,104 @@ TEST(PlasmaSerialization, EvictReply) {
   close(fd);
 }
 
+TEST(PlasmaSerialization, SetOptionsRequest) {
+  int fd = create_temp_file();
+  ARROW_CHECK_OK(SendSetOptionsRequest(fd, "client1", 1000));
+  std::vector<uint8_t> data =
+      read_message_from_file(fd, MessageType::PlasmaSetOptionsRequest);
+  std::string client_name;
+  int64_t output_memory_quota;
+  ARROW_CHECK_OK(ReadSetOptionsRequest(data.data(), data.size(), &client_name,
+                                       &output_memory_quota));
+  ASSERT_EQ("client1", client_name);
+  ASSERT_EQ(1000, output_memory_quota);
+  close(fd);
+}
+
+TEST(PlasmaSerialization, SetOptionsReply) {
+  int fd = create_temp_file();
+  ARROW_CHECK_OK(SendSetOptionsReply(fd, PlasmaError::OutOfMemory));
+  std::vector<uint8_t> data =
+      read_message_from_file(fd, MessageType::PlasmaSetOptionsReply);
+  Status s = ReadSetOptionsReply(data.data(), data.size());
+  ASSERT_TRUE(s.IsPlasmaStoreFull());
+  close(fd);
+}
+
+TEST(PlasmaSerialization, ReserveRequest) {
+  int fd = create_temp_file();
+  ARROW_CHECK_OK(SendReserveRequest(fd, 1000, 10, 5));
+  std::vector<uint8_t> data =
+      read_message_from_file(fd, MessageType::PlasmaReserveRequest);
+  int64_t data_size, metadata_size, count;
+  ARROW_CHECK_OK(
+      ReadReserveRequest(data.data(), data.size(), &data_size, &metadata_size, &count));
+  ASSERT_EQ(1000, data_size);
+  ASSERT_EQ(10, metadata_size);
+  ASSERT_EQ(5, count);
+  close(fd);
+}
+
+TEST(PlasmaSerialization, ReserveReply) {
+  int fd = create_temp_file();
+  ARROW_CHECK_OK(SendReserveReply(fd, 3));
+  std::vector<uint8_t> data =
+      read_message_from_file(fd, MessageType::PlasmaReserveReply);
+  int64_t num_reserved;
+  ARROW_CHECK_OK(ReadReserveReply(data.data(), data.size(), &num_reserved));
+  ASSERT_EQ(3, num_reserved);
+  close(fd);
+}
+
+TEST(PlasmaSerialization, QuotaStatsReply) {
+  int fd = create_temp_file();
+  std::vector<QuotaStats> stats1 = {{"client1", 1000, 500, 2, 100},
+                                    {"client2", -1, 0, 0, 0}};
+  ARROW_CHECK_OK(SendQuotaStatsReply(fd, stats1));
+  std::vector<uint8_t> data =
+      read_message_from_file(fd, MessageType::PlasmaQuotaStatsReply);
+  std::vector<QuotaStats> stats2;
+  ARROW_CHECK_OK(ReadQuotaStatsReply(data.data(), data.size(), &stats2));
+  ASSERT_EQ(stats1.size(), stats2.size());
+  for (size_t i = 0; i < stats1.size(); ++i) {
+    ASSERT_EQ(stats1[i].client_name, stats2[i].client_name);
+    ASSERT_EQ(stats1[i].quota, stats2[i].quota);
+    ASSERT_EQ(stats1[i].bytes_used, stats2[i].bytes_used);
+    ASSERT_EQ(stats1[i].num_objects, stats2[i].num_objects);
+    ASSERT_EQ(stats1[i].bytes_evicted, stats2[i].bytes_evicted);
+  }
+  close(fd);
+}
+
+TEST(PlasmaSerialization, StoreStatsReply) {
+  int fd = create_temp_file();
+  PlasmaStoreStats stats1 = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, {}};
+  stats1.messages.push_back({"PlasmaGetRequest", 13, 14, 15});
+  ARROW_CHECK_OK(SendStoreStatsReply(fd, stats1));
+  std::vector<uint8_t> data =
+      read_message_from_file(fd, MessageType::PlasmaStoreStatsReply);
+  PlasmaStoreStats stats2;
+  ARROW_CHECK_OK(ReadStoreStatsReply(data.data(), data.size(), &stats2));
+  ASSERT_EQ(stats1.num_objects, stats2.num_objects);
+  ASSERT_EQ(stats1.memory_capacity, stats2.memory_capacity);
+  ASSERT_EQ(stats1.memory_used, stats2.memory_used);
+  ASSERT_EQ(stats1.footprint, stats2.footprint);
+  ASSERT_EQ(stats1.allocated, stats2.allocated);
+  ASSERT_EQ(stats1.get_hits, stats2.get_hits);
+  ASSERT_EQ(stats1.get_misses, stats2.get_misses);
+  ASSERT_EQ(stats1.num_pending_get_requests, stats2.num_pending_get_requests);
+  ASSERT_EQ(stats1.num_evicted, stats2.num_evicted);
+  ASSERT_EQ(stats1.bytes_evicted, stats2.bytes_evicted);
+  ASSERT_EQ(stats1.num_spilled, stats2.num_spilled);
+  ASSERT_EQ(stats1.num_restored, stats2.num_restored);
+  ASSERT_EQ(1, stats2.messages.size());
+  ASSERT_EQ("PlasmaGetRequest", stats2.messages[0].type);
+  ASSERT_EQ(13, stats2.messages[0].count);
+  ASSERT_EQ(14, stats2.messages[0].total_micros);
+  ASSERT_EQ(15, stats2.messages[0].max_micros);
+  close(fd);
+}
+
 TEST(PlasmaSerialization, FetchRequest) {
   int fd = create_temp_file();
   ObjectID object_ids[2];
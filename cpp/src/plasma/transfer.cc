@@ -0,0 +1,375 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "plasma/transfer.h"
+
+#include <netdb.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <unistd.h>
+#ifdef __linux__
+#include <sys/sendfile.h>
+#endif
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <string>
+
+#include "arrow/util/logging.h"
+#include "arrow/util/thread-pool.h"
+#include "plasma/io.h"
+
+namespace plasma {
+
+namespace {
+
+constexpr char kMagic[8] = "PLASMAT";
+
+// The header sent before the bytes of a chunk. Stores exchanging objects are
+// expected to run on hosts of the same byte order.
+struct ChunkHeader {
+  char magic[sizeof(kMagic)];
+  uint8_t object_id[kUniqueIDSize];
+  int64_t data_size;
+  int64_t metadata_size;
+  int64_t offset;
+  int64_t length;
+  int64_t num_chunks;
+  uint8_t digest[kDigestSize];
+};
+
+// Objects are split in chunks of at least this size, so that small objects
+// are sent on a single connection.
+constexpr int64_t kMinChunkSize = 16 << 20;
+
+// The send and receive buffers of the sockets, large enough to keep the
+// links of data centers busy.
+constexpr int kSocketBufferSize = 4 << 20;
+
+void SetSocketBufferSizes(int sock) {
+  int size = kSocketBufferSize;
+  // The sizes are only hints, which the kernel may cap.
+  setsockopt(sock, SOL_SOCKET, SO_SNDBUF, &size, sizeof(size));
+  setsockopt(sock, SOL_SOCKET, SO_RCVBUF, &size, sizeof(size));
+}
+
+}  // namespace
+
+TransferService::TransferService(
+    int listener, int port, int num_threads, PostFunction post,
+    BeginChunkFunction begin_chunk, EndChunkFunction end_chunk,
+    std::shared_ptr<arrow::internal::ThreadPool> send_pool,
+    std::shared_ptr<arrow::internal::ThreadPool> receive_pool)
+    : listener_(listener),
+      port_(port),
+      num_threads_(num_threads),
+      post_(std::move(post)),
+      begin_chunk_(std::move(begin_chunk)),
+      end_chunk_(std::move(end_chunk)),
+      send_pool_(std::move(send_pool)),
+      receive_pool_(std::move(receive_pool)),
+      stopped_(false) {
+  if (listener_ >= 0) {
+    acceptor_ = std::thread([this]() { AcceptConnections(); });
+  }
+}
+
+TransferService::~TransferService() {
+  // Wake up the threads waiting for the loop, which is stopped, and those
+  // blocked on their sockets.
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopped_ = true;
+    for (int sock : sockets_) {
+      shutdown(sock, SHUT_RDWR);
+    }
+  }
+  cv_.notify_all();
+  if (listener_ >= 0) {
+    shutdown(listener_, SHUT_RDWR);
+    acceptor_.join();
+    close(listener_);
+  }
+  ARROW_UNUSED(send_pool_->Shutdown(false));
+  ARROW_UNUSED(receive_pool_->Shutdown(false));
+}
+
+Status TransferService::Open(int port, int num_threads, PostFunction post,
+                             BeginChunkFunction begin_chunk, EndChunkFunction end_chunk,
+                             std::unique_ptr<TransferService>* out) {
+  int listener = -1;
+  if (port >= 0) {
+    listener = socket(AF_INET, SOCK_STREAM, 0);
+    if (listener < 0) {
+      return Status::IOError(std::string("Failed to create the transfer socket: ") +
+                             std::strerror(errno));
+    }
+    int on = 1;
+    setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+    // The accepted sockets inherit the size of the receive buffer.
+    SetSocketBufferSizes(listener);
+    struct sockaddr_in address;
+    std::memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_ANY);
+    address.sin_port = htons(static_cast<uint16_t>(port));
+    socklen_t length = sizeof(address);
+    if (bind(listener, reinterpret_cast<struct sockaddr*>(&address), length) != 0 ||
+        listen(listener, 128) != 0 ||
+        getsockname(listener, reinterpret_cast<struct sockaddr*>(&address),
+                    &length) != 0) {
+      Status s = Status::IOError("Failed to listen for transfers on port " +
+                                 std::to_string(port) + ": " + std::strerror(errno));
+      close(listener);
+      return s;
+    }
+    port = ntohs(address.sin_port);
+  }
+  std::shared_ptr<arrow::internal::ThreadPool> send_pool, receive_pool;
+  Status s = arrow::internal::ThreadPool::Make(num_threads, &send_pool);
+  if (s.ok()) {
+    s = arrow::internal::ThreadPool::Make(num_threads, &receive_pool);
+  }
+  if (!s.ok()) {
+    if (listener >= 0) {
+      close(listener);
+    }
+    return s;
+  }
+  out->reset(new TransferService(listener, port, num_threads, std::move(post),
+                                 std::move(begin_chunk), std::move(end_chunk),
+                                 std::move(send_pool), std::move(receive_pool)));
+  return Status::OK();
+}
+
+void TransferService::AcceptConnections() {
+  while (true) {
+    int sock = accept(listener_, nullptr, nullptr);
+    if (sock < 0) {
+      if (errno == EINTR || errno == ECONNABORTED) {
+        continue;
+      }
+      // The listener is shut down when the service is stopped.
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!stopped_) {
+        ARROW_LOG(WARNING) << "Stopped accepting transfers: " << std::strerror(errno);
+      }
+      return;
+    }
+    if (!AddSocket(sock)) {
+      close(sock);
+      return;
+    }
+    if (!receive_pool_->Spawn([this, sock]() { ReceiveChunk(sock); }).ok()) {
+      CloseSocket(sock);
+    }
+  }
+}
+
+void TransferService::ReceiveChunk(int sock) {
+  ChunkHeader header;
+  Status s = ReadBytes(sock, reinterpret_cast<uint8_t*>(&header), sizeof(header));
+  TransferChunk chunk;
+  if (s.ok()) {
+    std::memcpy(&chunk.object_id, header.object_id, sizeof(chunk.object_id));
+    chunk.data_size = header.data_size;
+    chunk.metadata_size = header.metadata_size;
+    chunk.digest.assign(reinterpret_cast<char*>(header.digest), kDigestSize);
+    chunk.offset = header.offset;
+    chunk.length = header.length;
+    chunk.num_chunks = header.num_chunks;
+    if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0 ||
+        chunk.data_size < 0 || chunk.metadata_size < 0 || chunk.offset < 0 ||
+        chunk.length < 0 ||
+        chunk.offset + chunk.length > chunk.data_size + chunk.metadata_size ||
+        chunk.num_chunks < 1) {
+      s = Status::IOError("Received a transfer that is not a chunk of an object");
+    }
+  }
+  // The store is told of every chunk that it gave memory for, or refused to,
+  // so that it can tell when all the chunks of an object are received.
+  uint8_t* pointer = nullptr;
+  auto begin_chunk = [this, &chunk, &pointer]() { pointer = begin_chunk_(chunk); };
+  if (s.ok() && RunOnLoop(begin_chunk)) {
+    if (pointer == nullptr) {
+      s = Status::IOError("The store refused object " + chunk.object_id.hex());
+    } else {
+      s = ReadBytes(sock, pointer, chunk.length);
+    }
+    const bool ok = s.ok();
+    RunOnLoop([this, &chunk, ok]() { end_chunk_(chunk, ok); });
+  }
+  if (!s.ok()) {
+    ARROW_LOG(WARNING) << "Failed to receive a chunk of an object: " << s.ToString();
+  }
+  CloseSocket(sock);
+}
+
+void TransferService::Send(const std::string& address, int port,
+                           const TransferChunk& object, const uint8_t* pointer, int fd,
+                           int64_t file_offset, const SendCallback& callback) {
+  const int64_t size = object.data_size + object.metadata_size;
+  const int64_t num_chunks = std::max<int64_t>(
+      1, std::min<int64_t>(num_threads_, size / kMinChunkSize));
+  const int64_t chunk_size = (size + num_chunks - 1) / num_chunks;
+
+  // The callback is posted once all the chunks are sent, with the first error.
+  struct SendState {
+    std::mutex mutex;
+    Status status;
+    int64_t num_pending;
+  };
+  auto state = std::make_shared<SendState>();
+  state->num_pending = num_chunks;
+  auto finish_chunk = [this, state, callback](const Status& s) {
+    Status status;
+    {
+      std::lock_guard<std::mutex> lock(state->mutex);
+      if (!s.ok() && state->status.ok()) {
+        state->status = s;
+      }
+      if (--state->num_pending > 0) {
+        return;
+      }
+      status = state->status;
+    }
+    post_([callback, status]() { callback(status); });
+  };
+  for (int64_t i = 0; i < num_chunks; ++i) {
+    TransferChunk chunk = object;
+    chunk.offset = i * chunk_size;
+    chunk.length = std::min(chunk_size, size - chunk.offset);
+    chunk.num_chunks = num_chunks;
+    Status s = send_pool_->Spawn([=]() {
+      finish_chunk(SendChunk(address, port, chunk, pointer + chunk.offset, fd,
+                             file_offset + chunk.offset));
+    });
+    if (!s.ok()) {
+      finish_chunk(s);
+    }
+  }
+}
+
+Status TransferService::SendChunk(const std::string& address, int port,
+                                  const TransferChunk& chunk, const uint8_t* pointer,
+                                  int fd, int64_t file_offset) {
+  struct addrinfo hints;
+  std::memset(&hints, 0, sizeof(hints));
+  hints.ai_family = AF_UNSPEC;
+  hints.ai_socktype = SOCK_STREAM;
+  struct addrinfo* addresses;
+  if (getaddrinfo(address.c_str(), std::to_string(port).c_str(), &hints, &addresses) !=
+      0) {
+    return Status::IOError("Failed to resolve the address of a peer store: " + address);
+  }
+  int sock = socket(addresses->ai_family, addresses->ai_socktype, addresses->ai_protocol);
+  if (sock < 0 || !AddSocket(sock)) {
+    if (sock >= 0) {
+      close(sock);
+    }
+    freeaddrinfo(addresses);
+    return Status::IOError("Failed to create a socket to a peer store");
+  }
+  SetSocketBufferSizes(sock);
+  Status s;
+  if (connect(sock, addresses->ai_addr, addresses->ai_addrlen) != 0) {
+    s = Status::IOError("Failed to connect to the peer store at " + address + ":" +
+                        std::to_string(port) + ": " + std::strerror(errno));
+  }
+  freeaddrinfo(addresses);
+
+  if (s.ok()) {
+    ChunkHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    std::memcpy(header.object_id, chunk.object_id.data(), sizeof(header.object_id));
+    header.data_size = chunk.data_size;
+    header.metadata_size = chunk.metadata_size;
+    header.offset = chunk.offset;
+    header.length = chunk.length;
+    header.num_chunks = chunk.num_chunks;
+    std::memcpy(header.digest, chunk.digest.data(),
+                std::min<size_t>(chunk.digest.size(), kDigestSize));
+    s = WriteBytes(sock, reinterpret_cast<uint8_t*>(&header), sizeof(header));
+  }
+#ifdef __linux__
+  // The bytes go from the file of the memory of the object to the socket
+  // without being copied through the store.
+  off_t offset = static_cast<off_t>(file_offset);
+  int64_t remaining = chunk.length;
+  while (s.ok() && remaining > 0) {
+    ssize_t n = sendfile(sock, fd, &offset, static_cast<size_t>(remaining));
+    if (n < 0 && errno == EINTR) {
+      continue;
+    }
+    if (n <= 0) {
+      s = Status::IOError(std::string("Failed to send a chunk of an object: ") +
+                          (n < 0 ? std::strerror(errno) : "unexpected end of file"));
+    } else {
+      remaining -= n;
+    }
+  }
+#else
+  if (s.ok()) {
+    s = WriteBytes(sock, const_cast<uint8_t*>(pointer), chunk.length);
+  }
+#endif
+  CloseSocket(sock);
+  return s;
+}
+
+bool TransferService::RunOnLoop(const std::function<void()>& callback) {
+  // The loop is stopped before the service, so the callback, which may use
+  // the stack of the caller, is never run once this returned false.
+  auto done = std::make_shared<bool>(false);
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (stopped_) {
+      return false;
+    }
+  }
+  post_([this, callback, done]() {
+    callback();
+    std::lock_guard<std::mutex> lock(mutex_);
+    *done = true;
+    cv_.notify_all();
+  });
+  std::unique_lock<std::mutex> lock(mutex_);
+  cv_.wait(lock, [this, &done]() { return *done || stopped_; });
+  return *done;
+}
+
+bool TransferService::AddSocket(int sock) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (stopped_) {
+    return false;
+  }
+  sockets_.insert(sock);
+  return true;
+}
+
+void TransferService::CloseSocket(int sock) {
+  // The socket is closed with the lock held, so that its descriptor is not
+  // reused before it is no longer tracked.
+  std::lock_guard<std::mutex> lock(mutex_);
+  sockets_.erase(sock);
+  close(sock);
+}
+
+}  // namespace plasma
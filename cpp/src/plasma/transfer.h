@@ -0,0 +1,155 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef PLASMA_TRANSFER_H
+#define PLASMA_TRANSFER_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_set>
+
+#include "arrow/status.h"
+#include "plasma/common.h"
+
+namespace arrow {
+namespace internal {
+
+class ThreadPool;
+
+}  // namespace internal
+}  // namespace arrow
+
+namespace plasma {
+
+using arrow::Status;
+
+/// A range of the data and metadata of an object that is sent to a peer
+/// store, on a TCP connection of its own.
+struct TransferChunk {
+  ObjectID object_id;
+  int64_t data_size;
+  int64_t metadata_size;
+  std::string digest;
+  /// The offset of the range from the start of the data of the object.
+  int64_t offset;
+  /// The size of the range.
+  int64_t length;
+  /// The number of chunks that the object is sent in.
+  int64_t num_chunks;
+};
+
+/// The service through which stores send sealed objects to each other without
+/// a plasma manager. An object is streamed from the file of its memory with
+/// sendfile, in chunks sent in parallel on connections of their own, and
+/// written as it is received into the memory of the object in the peer.
+///
+/// The sockets are blocking, and used on threads of the service: one accepts
+/// the connections, and two pools send and receive the chunks, apart so that
+/// a store sending to itself cannot starve its receivers. The store is called
+/// back on the thread of one of its event loops, through a function posting
+/// to it, so that it does its bookkeeping there.
+class TransferService {
+ public:
+  /// Run a callback on the thread of an event loop of the store.
+  using PostFunction = std::function<void(const std::function<void()>&)>;
+  /// Get the memory that a chunk received is written to, which is that of its
+  /// object at the offset of the chunk, or null to drop the chunk.
+  using BeginChunkFunction = std::function<uint8_t*(const TransferChunk&)>;
+  /// Tell whether a chunk, whose memory BeginChunkFunction gave, was written.
+  using EndChunkFunction = std::function<void(const TransferChunk&, bool)>;
+  /// Tell whether an object was sent.
+  using SendCallback = std::function<void(const Status&)>;
+
+  ~TransferService();
+
+  /// Start the service, listening for the chunks of peers on a port.
+  ///
+  /// @param port The TCP port to listen on, 0 for any, or -1 to only send.
+  /// @param num_threads The number of chunks sent, and received, at once.
+  /// @param post The function posting to the loop of the store.
+  /// @param begin_chunk Called, on that loop, when a chunk is received.
+  /// @param end_chunk Called, on that loop, when a chunk has been received.
+  /// @param out The service.
+  /// @return The return status.
+  static Status Open(int port, int num_threads, PostFunction post,
+                     BeginChunkFunction begin_chunk, EndChunkFunction end_chunk,
+                     std::unique_ptr<TransferService>* out);
+
+  /// The port that the service listens on, or -1.
+  int port() const { return port_; }
+
+  /// Send a sealed object to a peer store, which must be kept until the
+  /// callback is run.
+  ///
+  /// @param address The IP address of the host of the peer.
+  /// @param port The port that the service of the peer listens on.
+  /// @param object The object, as a chunk of all of its data and metadata.
+  /// @param pointer The memory of the object.
+  /// @param fd The file that holds the memory of the object.
+  /// @param file_offset The offset of the object in the file.
+  /// @param callback Called, on the loop of the store, once the object is
+  ///        sent or failed to be.
+  void Send(const std::string& address, int port, const TransferChunk& object,
+            const uint8_t* pointer, int fd, int64_t file_offset,
+            const SendCallback& callback);
+
+ private:
+  TransferService(int listener, int port, int num_threads, PostFunction post,
+                  BeginChunkFunction begin_chunk, EndChunkFunction end_chunk,
+                  std::shared_ptr<arrow::internal::ThreadPool> send_pool,
+                  std::shared_ptr<arrow::internal::ThreadPool> receive_pool);
+
+  void AcceptConnections();
+
+  void ReceiveChunk(int sock);
+
+  Status SendChunk(const std::string& address, int port, const TransferChunk& chunk,
+                   const uint8_t* pointer, int fd, int64_t file_offset);
+
+  /// Run a callback on the loop of the store and wait for it, unless the
+  /// service is stopped first. Returns whether it was run.
+  bool RunOnLoop(const std::function<void()>& callback);
+
+  /// Track a socket, which the service shuts down when it is stopped.
+  bool AddSocket(int sock);
+
+  void CloseSocket(int sock);
+
+  int listener_;
+  int port_;
+  int num_threads_;
+  PostFunction post_;
+  BeginChunkFunction begin_chunk_;
+  EndChunkFunction end_chunk_;
+  std::shared_ptr<arrow::internal::ThreadPool> send_pool_;
+  std::shared_ptr<arrow::internal::ThreadPool> receive_pool_;
+  std::thread acceptor_;
+  /// Protects the fields below, and wakes up the threads waiting for the loop.
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  bool stopped_;
+  std::unordered_set<int> sockets_;
+};
+
+}  // namespace plasma
+
+#endif  // PLASMA_TRANSFER_H
@@ -47,6 +47,8 @@ cdef extern from "arrow/adapters/orc/adapter.h" \
         CStatus Read(shared_ptr[CTable]* out)
         CStatus Read(std_vector[int], shared_ptr[CTable]* out)
 
+        void set_use_threads(c_bool use_threads)
+
         int64_t NumberOfStripes()
 
         int64_t NumberOfRows()
@@ -97,11 +97,12 @@ cdef class ORCReader:
         batch.init(sp_record_batch)
         return batch
 
-    def read(self, include_indices=None):
+    def read(self, include_indices=None, c_bool use_threads=False):
         cdef:
             shared_ptr[CTable] sp_table
             std_vector[int] indices
 
+        deref(self.reader).set_use_threads(use_threads)
         if include_indices is None:
             with nogil:
                 check_status(deref(self.reader).Read(&sp_table))
@@ -383,8 +383,8 @@ cdef class PlasmaClient:
             If this is provided, the specified object ID will be used to refer
             to the object.
         memcopy_threads : int, default 6
-            The number of threads to use to write the serialized object into
-            the object store for large objects.
+            Whether to write the serialized object into the object store
+            with multiple threads, if more than 1.
         serialization_context : pyarrow.SerializationContext, default None
             Custom serialization and deserialization context.
 
@@ -396,9 +396,10 @@ cdef class PlasmaClient:
                                    else ObjectID.from_random())
         serialized = pyarrow.serialize(value, serialization_context)
         buffer = self.create(target_id, serialized.total_bytes)
-        stream = pyarrow.FixedSizeBufferWriter(buffer)
-        stream.set_memcopy_threads(memcopy_threads)
-        serialized.write_to(stream)
+        if memcopy_threads > 1:
+            serialized.write_to_buffer(buffer)
+        else:
+            serialized.write_to(pyarrow.FixedSizeBufferWriter(buffer))
         self.seal(target_id)
         return target_id
 
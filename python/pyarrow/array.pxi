@@ -618,7 +618,8 @@ cdef class Array:
 
     def to_pandas(self, c_bool strings_to_categorical=False,
                   c_bool zero_copy_only=False,
-                  c_bool integer_object_nulls=False):
+                  c_bool integer_object_nulls=False,
+                  c_bool deduplicate_objects=False):
         """
         Convert to an array object suitable for use in pandas
 
@@ -631,6 +632,9 @@ cdef class Array:
             the underlying data
         integer_object_nulls : boolean, default False
             Cast integers with nulls to objects
+        deduplicate_objects : boolean, default False
+            Create a single Python object for each distinct string or binary
+            value, shared by its repetitions
 
         See also
         --------
@@ -646,7 +650,8 @@ cdef class Array:
             strings_to_categorical=strings_to_categorical,
             zero_copy_only=zero_copy_only,
             integer_object_nulls=integer_object_nulls,
-            use_threads=False)
+            use_threads=False,
+            deduplicate_objects=deduplicate_objects)
         with nogil:
             check_status(ConvertArrayToPandas(options, self.sp_array,
                                               self, &out))
@@ -674,6 +679,27 @@ cdef class Array:
         return np.frombuffer(buflist[-1], dtype=self.type.to_pandas_dtype())[
             self.offset:self.offset + len(self)]
 
+    def to_numpy_masked(self):
+        """
+        Convert an integer or floating point array, which may have nulls, to
+        a masked array viewing its values without copying them
+
+        Returns
+        -------
+        arr : numpy.ma.MaskedArray
+            Masked where the array is null, with read-only data
+        """
+        cdef:
+            PyObject* out_values
+            PyObject* out_mask
+
+        with nogil:
+            check_status(ConvertArrayToNumPyMasked(self.sp_array, self,
+                                                   &out_values, &out_mask))
+        return np.ma.MaskedArray(PyObject_to_object(out_values),
+                                 mask=PyObject_to_object(out_mask),
+                                 copy=False)
+
     def to_pylist(self):
         """
         Convert to an list of native Python objects.
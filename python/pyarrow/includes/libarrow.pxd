@@ -980,6 +980,10 @@ cdef extern from "arrow/python/api.h" namespace "arrow::py" nogil:
                                  const shared_ptr[CArray]& arr,
                                  object py_ref, PyObject** out)
 
+    CStatus ConvertArrayToNumPyMasked(const shared_ptr[CArray]& arr,
+                                      object py_ref, PyObject** out_values,
+                                      PyObject** out_mask)
+
     CStatus ConvertChunkedArrayToPandas(PandasOptions options,
                                         const shared_ptr[CChunkedArray]& arr,
                                         object py_ref, PyObject** out)
@@ -1021,6 +1025,7 @@ cdef extern from "arrow/python/api.h" namespace "arrow::py" nogil:
         c_bool zero_copy_only
         c_bool integer_object_nulls
         c_bool use_threads
+        c_bool deduplicate_objects
 
 cdef extern from "arrow/python/api.h" namespace 'arrow::py' nogil:
 
@@ -1029,6 +1034,7 @@ cdef extern from "arrow/python/api.h" namespace 'arrow::py' nogil:
         vector[shared_ptr[CTensor]] tensors
 
         CStatus WriteTo(OutputStream* dst)
+        CStatus WriteToBuffer(const shared_ptr[CBuffer]& dst)
         CStatus GetComponents(CMemoryPool* pool, PyObject** dst)
 
     CStatus SerializeObject(object context, object sequence,
@@ -130,7 +130,7 @@ class ORCFile(object):
         include_indices = self._select_indices(columns)
         return self.reader.read_stripe(n, include_indices=include_indices)
 
-    def read(self, columns=None):
+    def read(self, columns=None, use_threads=False):
         """Read the whole file.
 
         Parameters
@@ -139,6 +139,8 @@ class ORCFile(object):
             If not None, only these columns will be read from the file. A
             column name may be a prefix of a nested field, e.g. 'a' will select
             'a.b', 'a.c', and 'a.d.e'
+        use_threads : boolean, default False
+            Decode the stripes of the file in parallel
 
         Returns
         -------
@@ -146,4 +148,5 @@ class ORCFile(object):
             Content of the file as a Table.
         """
         include_indices = self._select_indices(columns)
-        return self.reader.read(include_indices=include_indices)
+        return self.reader.read(include_indices=include_indices,
+                                use_threads=use_threads)
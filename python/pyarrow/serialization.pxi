@@ -244,6 +244,14 @@ cdef class SerializedPyObject:
         with nogil:
             check_status(self.data.WriteTo(stream))
 
+    def write_to_buffer(self, Buffer buffer):
+        """
+        Write serialized object to a mutable buffer of at least total_bytes,
+        copying its tensors and buffers in parallel
+        """
+        with nogil:
+            check_status(self.data.WriteToBuffer(buffer.buffer))
+
     def deserialize(self, SerializationContext context=None):
         """
         Convert back to Python object
@@ -266,10 +274,10 @@ cdef class SerializedPyObject:
         Write serialized data as Buffer
         """
         cdef Buffer output = allocate_buffer(self.total_bytes)
-        sink = FixedSizeBufferWriter(output)
         if nthreads > 1:
-            sink.set_memcopy_threads(nthreads)
-        self.write_to(sink)
+            self.write_to_buffer(output)
+        else:
+            self.write_to(FixedSizeBufferWriter(output))
         return output
 
     @staticmethod
@@ -145,7 +145,8 @@ cdef class ChunkedArray:
     def to_pandas(self,
                   c_bool strings_to_categorical=False,
                   c_bool zero_copy_only=False,
-                  c_bool integer_object_nulls=False):
+                  c_bool integer_object_nulls=False,
+                  c_bool deduplicate_objects=False):
         """
         Convert the arrow::Column to a pandas.Series
 
@@ -161,7 +162,8 @@ cdef class ChunkedArray:
             strings_to_categorical=strings_to_categorical,
             zero_copy_only=zero_copy_only,
             integer_object_nulls=integer_object_nulls,
-            use_threads=False)
+            use_threads=False,
+            deduplicate_objects=deduplicate_objects)
 
         with nogil:
             check_status(libarrow.ConvertChunkedArrayToPandas(
@@ -494,7 +496,8 @@ cdef class Column:
     def to_pandas(self,
                   c_bool strings_to_categorical=False,
                   c_bool zero_copy_only=False,
-                  c_bool integer_object_nulls=False):
+                  c_bool integer_object_nulls=False,
+                  c_bool deduplicate_objects=False):
         """
         Convert the arrow::Column to a pandas.Series
 
@@ -505,7 +508,8 @@ cdef class Column:
         values = self.data.to_pandas(
             strings_to_categorical=strings_to_categorical,
             zero_copy_only=zero_copy_only,
-            integer_object_nulls=integer_object_nulls)
+            integer_object_nulls=integer_object_nulls,
+            deduplicate_objects=deduplicate_objects)
         result = pd.Series(values, name=self.name)
 
         if isinstance(self.type, TimestampType):
@@ -1288,7 +1292,8 @@ cdef class Table:
 
     def to_pandas(self, nthreads=None, strings_to_categorical=False,
                   memory_pool=None, zero_copy_only=False, categories=None,
-                  integer_object_nulls=False, use_threads=False):
+                  integer_object_nulls=False, use_threads=False,
+                  deduplicate_objects=False):
         """
         Convert the arrow::Table to a pandas DataFrame
 
@@ -1307,6 +1312,9 @@ cdef class Table:
             Cast integers with nulls to objects
         use_threads: boolean, default False
             Whether to parallelize the conversion using multiple threads
+        deduplicate_objects : boolean, default False
+            Create a single Python object for each distinct string or binary
+            value, shared by its repetitions
 
         Returns
         -------
@@ -1321,7 +1329,8 @@ cdef class Table:
             strings_to_categorical=strings_to_categorical,
             zero_copy_only=zero_copy_only,
             integer_object_nulls=integer_object_nulls,
-            use_threads=use_threads)
+            use_threads=use_threads,
+            deduplicate_objects=deduplicate_objects)
 
         mgr = pdcompat.table_to_blockmanager(options, self, memory_pool,
                                              categories)
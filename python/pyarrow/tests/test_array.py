@@ -129,6 +129,32 @@ def test_to_numpy_unsupported_types():
         null_arr.to_numpy()
 
 
+def test_to_numpy_masked():
+    arr = pa.array([1, None, 3, None, 5], type=pa.int32())
+    result = arr.to_numpy_masked()
+
+    assert isinstance(result, np.ma.MaskedArray)
+    assert result.dtype == np.int32
+    np.testing.assert_array_equal(result.mask,
+                                  [False, True, False, True, False])
+    assert result.compressed().tolist() == [1, 3, 5]
+
+    # The values are viewed zero-copy, as is a slice
+    values_address = np.frombuffer(arr.buffers()[1],
+                                   dtype=np.int32).ctypes.data
+    assert result.data.ctypes.data == values_address
+    assert not result.data.flags.writeable
+    sliced = arr[1:4].to_numpy_masked()
+    assert sliced.data.ctypes.data == values_address + 4
+    np.testing.assert_array_equal(sliced.mask, [True, False, True])
+
+    result = pa.array([1.5, None], type=pa.float64()).to_numpy_masked()
+    np.testing.assert_array_equal(result.mask, [False, True])
+
+    with pytest.raises(NotImplementedError):
+        pa.array([u'a', None]).to_numpy_masked()
+
+
 def test_to_pandas_zero_copy():
     import gc
 
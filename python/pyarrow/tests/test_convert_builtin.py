@@ -342,6 +342,24 @@ def test_sequence_double():
     assert arr.to_pylist() == data
 
 
+@pytest.mark.parametrize(('data', 'expected_type'), [
+    ([None, 1, 2, None], pa.int64()),
+    ([None, 1, 2, np.nan], pa.int64()),
+    ([np.nan, 1, 2], pa.int64()),
+    ([1, 2.5, None], pa.float64()),
+    ([1.5, 2, None], pa.float64()),
+    ([b'foo', None, b'bar'], pa.binary()),
+    ([b'foo', u'bar'], pa.binary()),
+])
+def test_sequence_homogeneous_fallback(data, expected_type):
+    # The lists of builtin objects are converted in a single pass as their
+    # first non-null element, falling back on type inference for other types
+    arr = pa.array(data, from_pandas=True)
+    assert arr.type == expected_type
+    assert len(arr) == len(data)
+    assert arr.equals(pa.array(data, type=expected_type, from_pandas=True))
+
+
 @parametrize_with_iterable_types
 @pytest.mark.parametrize("np_scalar", [np.float16, np.float32, np.float64])
 @pytest.mark.parametrize("from_pandas", [True, False])
@@ -525,6 +525,26 @@ class TestConvertPrimitiveTypes(object):
         result = table.to_pandas()
         tm.assert_frame_equal(result, ex_frame)
 
+    def test_float_nulls_large(self):
+        # Large enough for the null bitmaps to be built in parallel ranges,
+        # with a length that is not a multiple of the ranges
+        num_values = 3 * (1 << 20) + 5
+
+        values = np.random.randn(num_values)
+        values[::7] = np.nan
+        null_mask = np.zeros(num_values, dtype=bool)
+        null_mask[::11] = True
+
+        arr = pa.array(values, from_pandas=True)
+        assert arr.null_count == np.isnan(values).sum()
+        np.testing.assert_array_equal(arr.to_pandas(), values)
+
+        arr = pa.array(values, mask=null_mask)
+        assert arr.null_count == null_mask.sum()
+        expected = values.copy()
+        expected[null_mask] = np.nan
+        np.testing.assert_array_equal(arr.to_pandas(), expected)
+
     def test_float_nulls_to_ints(self):
         # ARROW-2135
         df = pd.DataFrame({"a": [1.0, 2.0, pd.np.NaN]})
@@ -743,6 +763,29 @@ def test_table_integer_object_nulls_option(dtype):
     tm.assert_frame_equal(result, expected)
 
 
+@pytest.mark.parametrize('typ', [pa.string(), pa.binary()])
+def test_deduplicate_objects_option(typ):
+    values = [u'foo', None, u'bar', u'foo', None, u'bar', u'baz']
+    if typ == pa.binary():
+        values = [x.encode('utf8') if x is not None else None
+                  for x in values]
+    chunked = pa.chunked_array([pa.array(values[:4], type=typ),
+                                pa.array(values[4:], type=typ)])
+    table = pa.Table.from_arrays([chunked], ['strings'])
+
+    result = table.to_pandas(deduplicate_objects=True)
+    tm.assert_frame_equal(result, pd.DataFrame({'strings': values}))
+
+    # The repeated values share a single object
+    column = result['strings']
+    assert column[0] is column[3]
+    assert column[2] is column[5]
+
+    result = pa.array(values, type=typ).to_pandas(deduplicate_objects=True)
+    np.testing.assert_equal(result, np.array(values, dtype=object))
+    assert result[0] is result[3]
+
+
 class TestConvertDateTimeLikeTypes(object):
     """
     Conversion tests for datetime- and timestamp-like types (date64, etc.).
@@ -1901,6 +1944,33 @@ class TestConvertMisc(object):
         df = pd.DataFrame({'cat': pd.Categorical([])})
         _check_pandas_roundtrip(df)
 
+    def test_category_chunks_with_different_dictionaries(self):
+        # The indices of the chunks are transposed onto a unified dictionary
+        arr1 = pa.DictionaryArray.from_arrays([0, 1, None, 1], ['a', 'b'])
+        arr2 = pa.DictionaryArray.from_arrays([1, 0, 2], ['c', 'a', 'd'])
+        chunked = pa.chunked_array([arr1, arr2])
+
+        result = chunked.to_pandas()
+        expected = pd.Categorical(['a', 'b', None, 'b', 'a', 'c', 'd'],
+                                  categories=['a', 'b', 'c', 'd'])
+        tm.assert_categorical_equal(result, expected)
+
+    @pytest.mark.parametrize('use_threads', [False, True])
+    def test_strings_to_categorical_chunks(self, use_threads):
+        # The chunks are encoded one by one, then their dictionaries unified
+        values = ['a', 'b', None, 'c'] * 10
+        batches = [pa.RecordBatch.from_arrays([pa.array(values[i::4])],
+                                              ['strings'])
+                   for i in range(4)]
+        table = pa.Table.from_batches(batches)
+
+        result = table.to_pandas(strings_to_categorical=True,
+                                 use_threads=use_threads)
+        expected = pd.DataFrame({'strings': pd.Categorical(
+            [v for i in range(4) for v in values[i::4]],
+            categories=['a', 'b', 'c'])})
+        tm.assert_frame_equal(result, expected, check_dtype=True)
+
     def test_mixed_types_fails(self):
         data = pd.DataFrame({'a': ['a', 1, 2.0]})
         with pytest.raises(pa.ArrowTypeError):
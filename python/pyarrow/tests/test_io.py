@@ -105,6 +105,32 @@ def test_python_file_read():
     f.close()
 
 
+def test_python_file_small_reads():
+    # The small reads are served from a block read ahead from the Python file
+    data = bytes(bytearray(i % 256 for i in range(200000)))
+    buf = BytesIO(data)
+    f = pa.PythonFile(buf, mode='r')
+
+    pos = 0
+    for nbytes in [1, 7, 100, 3, 70000, 5, 12]:
+        assert f.read(nbytes) == data[pos:pos + nbytes]
+        pos += nbytes
+        assert f.tell() == pos
+
+    for seek_pos in [pos - 10, pos + 10, 5, 150000]:
+        f.seek(seek_pos)
+        assert f.tell() == seek_pos
+        assert f.read(20) == data[seek_pos:seek_pos + 20]
+        assert f.read_buffer(10).to_pybytes() == \
+            data[seek_pos + 20:seek_pos + 30]
+
+    f.seek(len(data) - 5)
+    assert f.read(10) == data[-5:]
+    assert f.read(10) == b''
+    assert f.size() == len(data)
+    f.close()
+
+
 def test_python_file_readall():
     data = b'some sample data'
 
@@ -296,6 +296,22 @@ def test_serialize_to_buffer():
             assert_equal(value, result)
 
 
+def test_serialize_to_buffer_parallel():
+    # Many small tensors, a strided one, large ones and buffers, all written
+    # where the sequential writer puts them
+    value = {'small': [np.arange(i, dtype=np.int8) for i in range(100)],
+             'strided': np.arange(1000, dtype=np.float64).reshape(20, 50)[:, ::3],
+             'large': [np.random.randn(1 << 18) for i in range(3)],
+             'buffers': [pa.py_buffer(b'x' * i) for i in range(0, 1000, 7)]}
+    serialized = pa.serialize(value)
+    expected = serialized.to_buffer()
+    result = serialized.to_buffer(nthreads=4)
+    assert result.equals(expected)
+
+    with pytest.raises(pa.ArrowInvalid):
+        serialized.write_to_buffer(pa.allocate_buffer(expected.size - 1))
+
+
 def test_complex_serialization(large_buffer):
     for obj in COMPLEX_OBJECTS:
         serialization_roundtrip(obj, large_buffer)